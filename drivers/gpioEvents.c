@@ -0,0 +1,251 @@
+#include "gpioEvents.h"
+#include "buttons.h"
+#include "spscRing.h"
+#include "switches.h"
+#include "utils.h"
+#include <stdio.h>
+
+#define INPUT_BITS 4
+
+// Debounce length used by gpioEvents_runTest(), in ticks.
+#define TEST_DEBOUNCE_TICKS 5
+
+// Debounce state for one 4-bit group of inputs
+typedef struct {
+  uint8_t stable;             // Debounced state
+  uint8_t previousRaw;        // Last raw sample, to count raw edges
+  uint8_t counting;           // Bits whose raw value differs from stable
+  uint16_t count[INPUT_BITS]; // Consecutive stable samples per bit
+} debouncer_t;
+
+static debouncer_t buttonsDebouncer;
+static debouncer_t switchesDebouncer;
+static uint16_t debounceTicks;
+static uint32_t ticks;
+
+// Event queue. The tick is the producer and gpioEvents_pop() the consumer.
+static gpioEvents_event_t queue[GPIOEVENTS_QUEUE_SIZE];
+static spscRing_t ring;
+
+static volatile uint32_t rawEdgeCount;
+static volatile uint32_t acceptedEdgeCount;
+
+// Queue an event, or count it as dropped if the queue is full
+static void push(gpioEvents_type_t type, uint8_t mask, uint8_t state) {
+  uint32_t slot;
+  if (!spscRing_reserve(&ring, &slot))
+    return;
+  gpioEvents_event_t *event = &queue[slot];
+  event->type = type;
+  event->mask = mask;
+  event->state = state;
+  event->timestamp = ticks;
+  spscRing_publish(&ring);
+}
+
+// Returns the number of set bits in a group
+static uint8_t countBits(uint8_t bits) {
+  uint8_t count = 0;
+  for (; bits; bits &= bits - 1)
+    count++;
+  return count;
+}
+
+// Start a debouncer from a known state
+static void resetDebouncer(debouncer_t *debouncer, uint8_t state) {
+  debouncer->stable = state;
+  debouncer->previousRaw = state;
+  debouncer->counting = 0;
+  for (uint8_t i = 0; i < INPUT_BITS; i++)
+    debouncer->count[i] = 0;
+}
+
+// Debounce one raw sample. A bit changes once it has differed from the stable
+// state for debounceTicks samples in a row with no raw edge in between.
+// Returns the bits that changed.
+static uint8_t debounce(debouncer_t *debouncer, uint8_t raw) {
+  uint8_t edges = raw ^ debouncer->previousRaw;
+  uint8_t differing = raw ^ debouncer->stable;
+  debouncer->previousRaw = raw;
+  rawEdgeCount += countBits(edges);
+
+  // Nothing moving: the common case
+  if (!differing && !debouncer->counting)
+    return 0;
+
+  uint8_t changed = 0;
+  for (uint8_t i = 0; i < INPUT_BITS; i++) {
+    uint8_t mask = 1 << i;
+    if (!(differing & mask) || (edges & mask))
+      debouncer->count[i] = 0;
+    if ((differing & mask) && ++debouncer->count[i] >= debounceTicks) {
+      debouncer->count[i] = 0;
+      changed |= mask;
+    }
+  }
+  debouncer->stable ^= changed;
+  debouncer->counting = differing & ~changed;
+  acceptedEdgeCount += countBits(changed);
+  return changed;
+}
+
+// Debounce one sample of each group and queue the resulting events
+static void processSample(uint8_t buttonsRaw, uint8_t switchesRaw) {
+  ticks++;
+
+  uint8_t changed = debounce(&buttonsDebouncer, buttonsRaw);
+  for (uint8_t mask = 1; changed; mask <<= 1) {
+    if (!(changed & mask))
+      continue;
+    changed &= ~mask;
+    push((buttonsDebouncer.stable & mask) ? GPIOEVENTS_BUTTON_PRESS
+                                          : GPIOEVENTS_BUTTON_RELEASE,
+         mask, buttonsDebouncer.stable);
+  }
+
+  changed = debounce(&switchesDebouncer, switchesRaw);
+  for (uint8_t mask = 1; changed; mask <<= 1) {
+    if (!(changed & mask))
+      continue;
+    changed &= ~mask;
+    push(GPIOEVENTS_SWITCH_CHANGE, mask, switchesDebouncer.stable);
+  }
+}
+
+// Reset everything except the hardware
+static void reset(uint16_t ticksToDebounce, uint8_t buttonsState,
+                  uint8_t switchesState) {
+  debounceTicks = ticksToDebounce ? ticksToDebounce : 1;
+  resetDebouncer(&buttonsDebouncer, buttonsState);
+  resetDebouncer(&switchesDebouncer, switchesState);
+  ticks = 0;
+  spscRing_init(&ring, GPIOEVENTS_QUEUE_SIZE);
+  rawEdgeCount = 0;
+  acceptedEdgeCount = 0;
+}
+
+// Initialize buttons, switches and the queue.
+void gpioEvents_init(double period_seconds) {
+  buttons_init();
+  switches_init();
+  reset(GPIOEVENTS_DEBOUNCE_TIME_SECONDS / period_seconds, buttons_read(),
+        switches_read());
+}
+
+// Sample and debounce the inputs, queueing any accepted edges.
+void gpioEvents_tick() { processSample(buttons_read(), switches_read()); }
+
+// Remove the oldest event from the queue. Returns false if it was empty.
+bool gpioEvents_pop(gpioEvents_event_t *event) {
+  uint32_t slot;
+  if (!spscRing_peek(&ring, &slot))
+    return false;
+  *event = queue[slot];
+  spscRing_consume(&ring, 1);
+  return true;
+}
+
+// Sleep until an event is available, then remove and return it.
+gpioEvents_event_t gpioEvents_waitForEvent() {
+  gpioEvents_event_t event;
+  while (!gpioEvents_pop(&event))
+    utils_sleep();
+  return event;
+}
+
+// Returns the debounced button state.
+uint8_t gpioEvents_getButtons() { return buttonsDebouncer.stable; }
+
+// Returns the debounced switch state.
+uint8_t gpioEvents_getSwitches() { return switchesDebouncer.stable; }
+
+// Returns the number of events lost because the queue was full.
+uint32_t gpioEvents_getDroppedCount() {
+  return spscRing_overflowCount(&ring);
+}
+
+// Returns the number of raw edges that the debouncer rejected as bounce.
+uint32_t gpioEvents_getSpuriousEdgeCount() {
+  return rawEdgeCount - acceptedEdgeCount;
+}
+
+// One step of the test script: hold these raw values for this many ticks.
+typedef struct {
+  uint8_t buttons;
+  uint8_t switches;
+  uint8_t ticks;
+} testStep_t;
+
+// Bouncing presses and releases, glitches shorter than the debounce time, and
+// two inputs bouncing at once. Each real edge is followed by a stable hold.
+static const testStep_t testScript[] = {
+    {0x0, 0x0, 10},
+    // BTN0 press with bounce
+    {0x1, 0x0, 1}, {0x0, 0x0, 2}, {0x1, 0x0, 1}, {0x0, 0x0, 1}, {0x1, 0x0, 10},
+    // BTN0 release with bounce
+    {0x0, 0x0, 2}, {0x1, 0x0, 1}, {0x0, 0x0, 10},
+    // Glitches shorter than the debounce time: no events
+    {0x8, 0x0, 4}, {0x0, 0x0, 10}, {0x0, 0x4, 3}, {0x0, 0x0, 10},
+    // BTN1 and BTN2 pressed together, bouncing differently
+    {0x6, 0x0, 1}, {0x2, 0x0, 1}, {0x6, 0x0, 1}, {0x4, 0x0, 1}, {0x6, 0x0, 10},
+    // SW3 slid up with bounce, while BTN1 is released cleanly
+    {0x4, 0x8, 1}, {0x4, 0x0, 1}, {0x4, 0x8, 10},
+    // BTN2 released
+    {0x0, 0x8, 10},
+};
+
+// Events the script must produce, in order
+static const gpioEvents_event_t expectedEvents[] = {
+    {GPIOEVENTS_BUTTON_PRESS, 0x1, 0x1, 0},
+    {GPIOEVENTS_BUTTON_RELEASE, 0x1, 0x0, 0},
+    {GPIOEVENTS_BUTTON_PRESS, 0x4, 0x4, 0},
+    {GPIOEVENTS_BUTTON_PRESS, 0x2, 0x6, 0},
+    {GPIOEVENTS_BUTTON_RELEASE, 0x2, 0x4, 0},
+    {GPIOEVENTS_SWITCH_CHANGE, 0x8, 0x8, 0},
+    {GPIOEVENTS_BUTTON_RELEASE, 0x4, 0x0, 0},
+};
+
+#define TEST_STEP_COUNT (sizeof(testScript) / sizeof(testScript[0]))
+#define EXPECTED_EVENT_COUNT                                                   \
+  (sizeof(expectedEvents) / sizeof(expectedEvents[0]))
+
+// Feeds scripted bouncing inputs through the debouncer and checks that exactly
+// one event comes out per real edge.
+bool gpioEvents_runTest() {
+  printf("starting gpioEvents_runTest()\n");
+  reset(TEST_DEBOUNCE_TICKS, 0, 0);
+
+  for (uint8_t step = 0; step < TEST_STEP_COUNT; step++)
+    for (uint8_t i = 0; i < testScript[step].ticks; i++)
+      processSample(testScript[step].buttons, testScript[step].switches);
+
+  bool passed = true;
+  gpioEvents_event_t event;
+  uint8_t eventCount = 0;
+  while (gpioEvents_pop(&event)) {
+    if (eventCount < EXPECTED_EVENT_COUNT) {
+      const gpioEvents_event_t *expected = &expectedEvents[eventCount];
+      if (event.type != expected->type || event.mask != expected->mask ||
+          event.state != expected->state) {
+        printf("event %d: got type %d mask 0x%x state 0x%x, expected type %d "
+               "mask 0x%x state 0x%x\n",
+               eventCount, event.type, event.mask, event.state,
+               expected->type, expected->mask, expected->state);
+        passed = false;
+      }
+    }
+    eventCount++;
+  }
+  if (eventCount != EXPECTED_EVENT_COUNT) {
+    printf("got %d events, expected %d\n", eventCount,
+           (int)EXPECTED_EVENT_COUNT);
+    passed = false;
+  }
+
+  printf("raw edges: %lu, accepted: %lu, spurious edges filtered: %lu\n",
+         (unsigned long)rawEdgeCount, (unsigned long)acceptedEdgeCount,
+         (unsigned long)gpioEvents_getSpuriousEdgeCount());
+  printf("exiting gpioEvents_runTest(): %s\n", passed ? "passed" : "failed");
+  reset(TEST_DEBOUNCE_TICKS, 0, 0);
+  return passed;
+}
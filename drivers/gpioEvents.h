@@ -0,0 +1,70 @@
+#ifndef GPIOEVENTS
+#define GPIOEVENTS
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Debounced button and switch events. gpioEvents_tick() samples the buttons
+// and switches, debounces each bit, and pushes an event for every accepted
+// edge into a lock-free single-producer/single-consumer queue. The tick (the
+// producer) normally runs in a timer ISR; main() (the consumer) pops events, or
+// sleeps in gpioEvents_waitForEvent() instead of spinning on buttons_read().
+//
+// The push-button and switch GPIO blocks in the Zybo hardware design are built
+// without their interrupt output (XPAR_*_INTERRUPT_PRESENT is 0) and the INTC
+// has no free input, so edges are found by sampling in the tick. The sample is
+// two register reads and a compare when nothing is changing.
+
+// How long an input must be stable before an edge is accepted.
+#define GPIOEVENTS_DEBOUNCE_TIME_SECONDS 0.02
+
+// Number of events the queue can hold. Must be a power of two.
+#define GPIOEVENTS_QUEUE_SIZE 32
+
+typedef enum {
+  GPIOEVENTS_BUTTON_PRESS,   // A button went down.
+  GPIOEVENTS_BUTTON_RELEASE, // A button came up.
+  GPIOEVENTS_SWITCH_CHANGE   // A switch was slid up or down.
+} gpioEvents_type_t;
+
+typedef struct {
+  gpioEvents_type_t type;
+  uint8_t mask;       // The single button or switch bit that changed.
+  uint8_t state;      // Debounced state of all buttons or switches after it.
+  uint32_t timestamp; // Tick count when the edge was accepted.
+} gpioEvents_event_t;
+
+// Initialize buttons, switches and the queue. period_seconds is the rate at
+// which gpioEvents_tick() will be called. The current input state is taken as
+// the starting point, so inputs held at init do not produce events.
+void gpioEvents_init(double period_seconds);
+
+// Sample and debounce the inputs, queueing any accepted edges. Call this at
+// the rate given to gpioEvents_init().
+void gpioEvents_tick();
+
+// Remove the oldest event from the queue. Returns false if it was empty.
+bool gpioEvents_pop(gpioEvents_event_t *event);
+
+// Sleep until an event is available, then remove and return it.
+gpioEvents_event_t gpioEvents_waitForEvent();
+
+// Returns the debounced button state (same bit layout as buttons_read()).
+uint8_t gpioEvents_getButtons();
+
+// Returns the debounced switch state (same bit layout as switches_read()).
+uint8_t gpioEvents_getSwitches();
+
+// Returns the number of events lost because the queue was full.
+uint32_t gpioEvents_getDroppedCount();
+
+// Returns the number of raw edges that the debouncer rejected as bounce.
+uint32_t gpioEvents_getSpuriousEdgeCount();
+
+// Feeds scripted bouncing inputs through the debouncer and checks that exactly
+// one event comes out per real edge. Prints the number of spurious edges that
+// were filtered and returns true on success. Does not touch the hardware, but
+// resets the queue, so run it before gpioEvents_init().
+bool gpioEvents_runTest();
+
+#endif /* GPIOEVENTS */
@@ -1,23 +1,42 @@
 #include "interrupts.h"
 #include "armInterrupts.h"
+#include "intervalTimer.h"
 #include "xil_io.h"
 #include "xparameters.h"
+#include <stdbool.h>
+#include <stdio.h>
 
 #define MER_OFFSET 0x1C
 #define MER_IRQ_ENABLE_MASK 0x03
 
 #define CIE_OFFSET 0x14
-#define CLEAR_ALL 0xFF
+#define CLEAR_ALL 0xFFFFFFFF
 
 #define SIE_OFFSET 0x10
 
 #define IPR_OFFSET 0x04
 
 #define IAR_OFFSET 0x0C
-#define NUM_INTERRUPT_INPUTS 3
+#define NUM_INTERRUPT_INPUTS INTERRUPTS_INPUT_COUNT
+
+#define IRQ_MASK(irq) ((uint32_t)1 << (irq))
 
 static void (*isrFcnPtrs[NUM_INTERRUPT_INPUTS])() = {NULL};
 
+// Lines in the order they are serviced, highest priority first.
+static uint8_t priorityOrder[NUM_INTERRUPT_INPUTS];
+
+static volatile uint32_t invocationCounts[NUM_INTERRUPT_INPUTS];
+
+// Timing mode state. lineTiming is indexed by irq.
+static volatile bool timingEnabled = false;
+static uint32_t timingTimer;
+static interrupts_timing_t lineTiming[NUM_INTERRUPT_INPUTS];
+static interrupts_timing_t isrTiming;
+
+// Optional instrumentation called before each callback.
+static void (*entryHook)(uint8_t irq) = NULL;
+
 // Helper function to read from the timer register, given the register's offset
 // returns: value at the register defined above
 static uint32_t readRegister(uint32_t offset) {
@@ -29,24 +48,59 @@ static void writeRegister(uint32_t offset, uint32_t value) {
   Xil_Out32(XPAR_AXI_INTC_0_BASEADDR + offset, value);
 }
 
-// ISR callback
-static void interrupts_isr() {
-  // Loop through each interrupt input
-  for (uint8_t i = 0; i < NUM_INTERRUPT_INPUTS; i++) {
-
-    // Check if it has an interrupt pending
-    if (readRegister(IPR_OFFSET) & (1 << i)) {
-
-      // Check if there is a callback
-      if (isrFcnPtrs[i] != NULL) {
-        // Call the callback function
-        isrFcnPtrs[i]();
-      }
+// Fold one timed invocation into a timing record
+static void recordTiming(interrupts_timing_t *timing, uint32_t entry,
+                         uint32_t exit) {
+  uint32_t cycles = exit - entry;
+  timing->invocations++;
+  timing->totalCycles += cycles;
+  if (cycles > timing->maxCycles)
+    timing->maxCycles = cycles;
+  timing->lastEntry = entry;
+  timing->lastExit = exit;
+}
 
-      // Acknowledge interrupt
-      writeRegister(IAR_OFFSET, (1 << i));
+// ISR callback. IPR is read once and the pending lines are serviced in
+// priority order, then all of them are acknowledged with a single IAR write.
+// Anything that becomes pending meanwhile keeps the IRQ asserted, so the ISR
+// is simply entered again. (IVR is not used because it always reports the
+// lowest-numbered pending line, which ignores the configured order.)
+static void interrupts_isr() {
+  bool timing = timingEnabled;
+  uint32_t isrEntry = timing ? intervalTimer_getCounterValue(timingTimer) : 0;
+
+  uint32_t pending = readRegister(IPR_OFFSET);
+  uint32_t serviced = pending;
+
+  // Walk the priority list until every pending line has been handled
+  for (uint8_t i = 0; pending && i < NUM_INTERRUPT_INPUTS; i++) {
+    uint8_t irq = priorityOrder[i];
+    if (!(pending & IRQ_MASK(irq)))
+      continue;
+    pending &= ~IRQ_MASK(irq);
+    invocationCounts[irq]++;
+
+    // Check if there is a callback
+    if (isrFcnPtrs[irq] == NULL)
+      continue;
+    if (entryHook != NULL)
+      entryHook(irq);
+    if (timing) {
+      uint32_t entry = intervalTimer_getCounterValue(timingTimer);
+      isrFcnPtrs[irq]();
+      recordTiming(&lineTiming[irq], entry,
+                   intervalTimer_getCounterValue(timingTimer));
+    } else {
+      isrFcnPtrs[irq]();
     }
   }
+
+  // Acknowledge everything that was serviced
+  writeRegister(IAR_OFFSET, serviced);
+
+  if (timing)
+    recordTiming(&isrTiming, isrEntry,
+                 intervalTimer_getCounterValue(timingTimer));
 }
 
 // Initialize interrupt hardware
@@ -61,8 +115,12 @@ static void interrupts_isr() {
 //  - armInterrupts_enable()
 void interrupts_init() {
   writeRegister(MER_OFFSET, MER_IRQ_ENABLE_MASK);
-  interrupts_irq_disable(0xFF);
-  // writeRegister(CIE_OFFSET, CLEAR_ALL);
+  writeRegister(CIE_OFFSET, CLEAR_ALL);
+
+  // Default to servicing lines in ascending order, like the INTC's own
+  // priority
+  for (uint8_t irq = 0; irq < NUM_INTERRUPT_INPUTS; irq++)
+    priorityOrder[irq] = irq;
   armInterrupts_init();
   armInterrupts_setupIntc(interrupts_isr);
   armInterrupts_enable();
@@ -71,12 +129,105 @@ void interrupts_init() {
 // Register a callback function (fcn is a function pointer to this callback
 // function) for a given interrupt input number (irq).  When this interrupt
 // input is active, fcn will be called.
-void interrupts_register(uint8_t irq, void (*fcn)()) { isrFcnPtrs[irq] = fcn; }
+void interrupts_register(uint8_t irq, void (*fcn)()) {
+  if (irq < NUM_INTERRUPT_INPUTS)
+    isrFcnPtrs[irq] = fcn;
+}
 
 // Enable single input interrupt line, given by irq number.
-void interrupts_irq_enable(uint8_t irq) { writeRegister(SIE_OFFSET, 1 << irq); }
+void interrupts_irq_enable(uint8_t irq) {
+  writeRegister(SIE_OFFSET, IRQ_MASK(irq));
+}
 
 // Disable single input interrupt line, given by irq number.
 void interrupts_irq_disable(uint8_t irq) {
-  writeRegister(CIE_OFFSET, 1 << irq);
-}
\ No newline at end of file
+  writeRegister(CIE_OFFSET, IRQ_MASK(irq));
+}
+
+// Set the order in which pending lines are serviced, highest priority first.
+// Lines not listed keep their relative (ascending) order after the listed ones.
+void interrupts_setPriorityOrder(const uint8_t order[], uint8_t length) {
+  uint32_t placed = 0;
+  uint8_t count = 0;
+
+  // Listed lines first, ignoring duplicates and invalid numbers
+  for (uint8_t i = 0; i < length; i++) {
+    uint8_t irq = order[i];
+    if (irq >= NUM_INTERRUPT_INPUTS || (placed & IRQ_MASK(irq)))
+      continue;
+    priorityOrder[count++] = irq;
+    placed |= IRQ_MASK(irq);
+  }
+
+  // Then everything else
+  for (uint8_t irq = 0; irq < NUM_INTERRUPT_INPUTS; irq++)
+    if (!(placed & IRQ_MASK(irq)))
+      priorityOrder[count++] = irq;
+}
+
+// Returns how many times the given line has been serviced.
+uint32_t interrupts_getInvocationCount(uint8_t irq) {
+  return irq < NUM_INTERRUPT_INPUTS ? invocationCounts[irq] : 0;
+}
+
+// Reset all invocation counts and timing statistics to zero.
+void interrupts_clearStatistics() {
+  static const interrupts_timing_t empty;
+  for (uint8_t irq = 0; irq < NUM_INTERRUPT_INPUTS; irq++) {
+    invocationCounts[irq] = 0;
+    lineTiming[irq] = empty;
+  }
+  isrTiming = empty;
+}
+
+// Turn on timing mode, using the given interval timer for timestamps.
+void interrupts_enableTiming(uint32_t timerNumber) {
+  timingEnabled = false;
+  timingTimer = timerNumber;
+  intervalTimer_initCountUp(timerNumber);
+  intervalTimer_start(timerNumber);
+  interrupts_clearStatistics();
+  timingEnabled = true;
+}
+
+// Turn off timing mode. Collected statistics are kept.
+void interrupts_disableTiming() { timingEnabled = false; }
+
+// Returns the timing collected for a single line.
+interrupts_timing_t interrupts_getLineTiming(uint8_t irq) {
+  static const interrupts_timing_t empty;
+  return irq < NUM_INTERRUPT_INPUTS ? lineTiming[irq] : empty;
+}
+
+// Returns the timing collected for the whole dispatch routine.
+interrupts_timing_t interrupts_getIsrTiming() { return isrTiming; }
+
+// Returns the current timing-mode timestamp, or 0 if timing mode is off.
+uint32_t interrupts_getTimestamp() {
+  return timingEnabled ? intervalTimer_getCounterValue(timingTimer) : 0;
+}
+
+// Install a function that is called with the irq number immediately before
+// each registered callback runs (NULL removes it).
+void interrupts_setEntryHook(void (*hook)(uint8_t irq)) { entryHook = hook; }
+
+// Print the invocation counts, and the timing if it has been enabled, of every
+// line that has been serviced.
+void interrupts_printStatistics() {
+  printf("irq  invocations  avg cycles  max cycles\n");
+  for (uint8_t irq = 0; irq < NUM_INTERRUPT_INPUTS; irq++) {
+    if (invocationCounts[irq] == 0)
+      continue;
+    interrupts_timing_t timing = lineTiming[irq];
+    uint32_t average =
+        timing.invocations ? timing.totalCycles / timing.invocations : 0;
+    printf("%3d  %11lu  %10lu  %10lu\n", irq,
+           (unsigned long)invocationCounts[irq], (unsigned long)average,
+           (unsigned long)timing.maxCycles);
+  }
+  if (isrTiming.invocations)
+    printf("dispatch: %lu timed, avg %lu cycles, max %lu cycles\n",
+           (unsigned long)isrTiming.invocations,
+           (unsigned long)(isrTiming.totalCycles / isrTiming.invocations),
+           (unsigned long)isrTiming.maxCycles);
+}
@@ -14,6 +14,21 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #include <stdint.h>
 
+// Number of inputs supported by the AXI INTC. The Zybo hardware design only
+// connects the three interval timers, but dispatch handles all of them.
+#define INTERRUPTS_INPUT_COUNT 32
+
+// Timing collected for one interrupt line (or for the whole dispatch routine)
+// while timing mode is on. All values are in interval-timer clock cycles
+// (10 ns), and the entry/exit stamps are raw counter values.
+typedef struct {
+  uint32_t invocations; // Invocations timed since timing was enabled.
+  uint32_t maxCycles;   // Longest single invocation.
+  uint64_t totalCycles; // Sum over all timed invocations.
+  uint32_t lastEntry;   // Counter value when it last started.
+  uint32_t lastExit;    // Counter value when it last returned.
+} interrupts_timing_t;
+
 // Initialize interrupt hardware
 // This function should:
 // 1. Configure AXI INTC registers to:
@@ -37,4 +52,43 @@ void interrupts_irq_enable(uint8_t irq);
 // Disable single input interrupt line, given by irq number.
 void interrupts_irq_disable(uint8_t irq);
 
+// Set the order in which pending lines are serviced, highest priority first.
+// Lines not listed keep their relative (ascending) order after the listed ones.
+// The default is ascending irq number. Call this before enabling the lines.
+void interrupts_setPriorityOrder(const uint8_t order[], uint8_t length);
+
+// Returns how many times the given line has been serviced.
+uint32_t interrupts_getInvocationCount(uint8_t irq);
+
+// Reset all invocation counts and timing statistics to zero.
+void interrupts_clearStatistics();
+
+// Turn on timing mode. The given interval timer is dedicated to timestamping:
+// it is initialized as a free-running count-up timer and read on entry to and
+// exit from the dispatch routine and every callback.
+void interrupts_enableTiming(uint32_t timerNumber);
+
+// Turn off timing mode. Collected statistics are kept.
+void interrupts_disableTiming();
+
+// Returns the timing collected for a single line.
+interrupts_timing_t interrupts_getLineTiming(uint8_t irq);
+
+// Returns the timing collected for the whole dispatch routine (register
+// accesses and all callbacks).
+interrupts_timing_t interrupts_getIsrTiming();
+
+// Returns the current timing-mode timestamp (raw counter value of the timer
+// passed to interrupts_enableTiming()), or 0 if timing mode is off.
+uint32_t interrupts_getTimestamp();
+
+// Install a function that is called with the irq number immediately before
+// each registered callback runs (NULL removes it). Used by instrumentation
+// such as isrLatency; it runs inside the ISR, so keep it short.
+void interrupts_setEntryHook(void (*hook)(uint8_t irq));
+
+// Print the invocation counts, and the timing if it has been enabled, of every
+// line that has been serviced.
+void interrupts_printStatistics();
+
 #endif /* INTERRUPTS */
@@ -136,6 +136,17 @@ double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber) {
   return timerDuration * CYCLE_DURATION;
 }
 
+// Returns the raw value of the lower 32-bit counter of the given timer, in
+// clock cycles (10 ns).
+uint32_t intervalTimer_getCounterValue(uint32_t timerNumber) {
+  return readRegister(timerNumber, TCR0_OFFSET);
+}
+
+// Returns the lower 32 bits of the given timer's load register.
+uint32_t intervalTimer_getLoadValue(uint32_t timerNumber) {
+  return readRegister(timerNumber, TLR0_OFFSET);
+}
+
 // Initialize the timer given by timerNumber by setting it to 64-bit cascade
 // mode, counting down from the `period` in seconds, reloading when it hits 0,
 // and resetting the load registers
@@ -75,6 +75,17 @@ void intervalTimer_reload(uint32_t timerNumber);
 // to a double seconds value.
 double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber);
 
+// Returns the raw value of the lower 32-bit counter of the given timer, in
+// clock cycles (10 ns). This is a single register read, cheap enough to use
+// for timestamps inside an ISR. Differences between two readings are correct
+// across a wrap of the lower counter.
+uint32_t intervalTimer_getCounterValue(uint32_t timerNumber);
+
+// Returns the lower 32 bits of the given timer's load register. For a
+// count-down timer this is the number of cycles in one period, so subtracting
+// the current counter value gives the cycles elapsed since the last rollover.
+uint32_t intervalTimer_getLoadValue(uint32_t timerNumber);
+
 // Enable the interrupt output of the given timer.
 void intervalTimer_enableInterrupt(uint8_t timerNumber);
 
@@ -0,0 +1,185 @@
+#include "isrLatency.h"
+#include "interrupts.h"
+#include "intervalTimer.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+#define CYCLES_PER_US 100
+
+// Configuration and statistics for one line
+typedef struct {
+  bool attached;
+  uint32_t timerNumber;
+  uint32_t loadValue; // Cycles per timer period
+  uint32_t previousCycles;
+  isrLatency_stats_t stats;
+} lineStats_t;
+
+static lineStats_t lines[INTERRUPTS_INPUT_COUNT];
+static isrLatency_worstCase_t worstCase;
+
+// Returns the power-of-two histogram bin for a number of cycles
+static uint8_t histogramBin(uint32_t cycles) {
+  uint8_t bin = 0;
+  while (cycles && bin < ISRLATENCY_HISTOGRAM_BINS - 1) {
+    cycles >>= 1;
+    bin++;
+  }
+  return bin;
+}
+
+// Find the callback that was running for most of the window of the given
+// length ending now. Only called when a new worst case is found.
+static uint8_t findCulprit(uint32_t windowCycles) {
+  uint32_t now = interrupts_getTimestamp();
+  if (now == 0)
+    return ISRLATENCY_UNKNOWN;
+  uint32_t windowStart = now - windowCycles;
+
+  uint8_t culprit = ISRLATENCY_NO_ISR;
+  uint32_t bestOverlap = 0;
+  for (uint8_t irq = 0; irq < INTERRUPTS_INPUT_COUNT; irq++) {
+    interrupts_timing_t timing = interrupts_getLineTiming(irq);
+    if (timing.invocations == 0)
+      continue;
+
+    // Positions of the callback's last run relative to the window start
+    int32_t entry = (int32_t)(timing.lastEntry - windowStart);
+    int32_t exit = (int32_t)(timing.lastExit - windowStart);
+    if (entry < 0)
+      entry = 0;
+    if (exit > (int32_t)windowCycles)
+      exit = windowCycles;
+    if (exit > entry && (uint32_t)(exit - entry) > bestOverlap) {
+      bestOverlap = exit - entry;
+      culprit = irq;
+    }
+  }
+  return culprit;
+}
+
+// Interrupts entry hook: sample the latency of attached lines
+static void sample(uint8_t irq) {
+  lineStats_t *line = &lines[irq];
+  if (!line->attached)
+    return;
+
+  uint32_t cycles =
+      line->loadValue - intervalTimer_getCounterValue(line->timerNumber);
+  isrLatency_recordSample(irq, cycles);
+}
+
+// Clear the statistics of one line, keeping its configuration
+static void resetLine(lineStats_t *line) {
+  static const isrLatency_stats_t empty = {.minCycles = UINT32_MAX};
+  line->previousCycles = 0;
+  line->stats = empty;
+}
+
+// Start measuring the given irq, raised by the given count-down timer.
+void isrLatency_attach(uint8_t irq, uint32_t timerNumber) {
+  if (irq >= INTERRUPTS_INPUT_COUNT)
+    return;
+  lineStats_t *line = &lines[irq];
+  line->attached = false;
+  line->timerNumber = timerNumber;
+  line->loadValue = intervalTimer_getLoadValue(timerNumber);
+  resetLine(line);
+  line->attached = true;
+  interrupts_setEntryHook(sample);
+}
+
+// Stop measuring the given irq. Statistics are kept.
+void isrLatency_detach(uint8_t irq) {
+  if (irq < INTERRUPTS_INPUT_COUNT)
+    lines[irq].attached = false;
+}
+
+// Clear all statistics, including the worst case.
+void isrLatency_reset() {
+  for (uint8_t irq = 0; irq < INTERRUPTS_INPUT_COUNT; irq++)
+    resetLine(&lines[irq]);
+  worstCase.cycles = 0;
+  worstCase.irq = ISRLATENCY_UNKNOWN;
+  worstCase.culprit = ISRLATENCY_UNKNOWN;
+}
+
+// Add one latency sample to the statistics of the given line.
+void isrLatency_recordSample(uint8_t irq, uint32_t cycles) {
+  if (irq >= INTERRUPTS_INPUT_COUNT)
+    return;
+  lineStats_t *line = &lines[irq];
+  isrLatency_stats_t *stats = &line->stats;
+
+  if (stats->samples) {
+    uint32_t jitter = cycles > line->previousCycles
+                          ? cycles - line->previousCycles
+                          : line->previousCycles - cycles;
+    stats->jitterHistogram[histogramBin(jitter)]++;
+    if (jitter > stats->maxJitterCycles)
+      stats->maxJitterCycles = jitter;
+  }
+  line->previousCycles = cycles;
+
+  stats->samples++;
+  stats->totalCycles += cycles;
+  stats->latencyHistogram[histogramBin(cycles)]++;
+  if (cycles < stats->minCycles)
+    stats->minCycles = cycles;
+  if (cycles > stats->maxCycles)
+    stats->maxCycles = cycles;
+
+  if (cycles > worstCase.cycles) {
+    worstCase.cycles = cycles;
+    worstCase.irq = irq;
+    worstCase.culprit = findCulprit(cycles);
+  }
+}
+
+// Returns the statistics of the given line.
+isrLatency_stats_t isrLatency_getStats(uint8_t irq) {
+  static const isrLatency_stats_t empty = {.minCycles = UINT32_MAX};
+  return irq < INTERRUPTS_INPUT_COUNT ? lines[irq].stats : empty;
+}
+
+// Returns the worst latency seen on any attached line.
+isrLatency_worstCase_t isrLatency_getWorstCase() { return worstCase; }
+
+// Print one histogram on a single line, as counts per bin
+static void printHistogram(const char *name, const uint32_t histogram[]) {
+  printf("  %s:", name);
+  for (uint8_t bin = 0; bin < ISRLATENCY_HISTOGRAM_BINS; bin++)
+    printf(" %lu", (unsigned long)histogram[bin]);
+  printf("\n");
+}
+
+// Print statistics and histograms for every line that has been attached, then
+// the worst case.
+void isrLatency_print() {
+  printf("ISR latency in cycles (%d per us); histogram bins are 0, <2, <4, "
+         "<8, ...\n",
+         CYCLES_PER_US);
+  for (uint8_t irq = 0; irq < INTERRUPTS_INPUT_COUNT; irq++) {
+    isrLatency_stats_t stats = lines[irq].stats;
+    if (stats.samples == 0)
+      continue;
+    printf("irq %d: %lu samples, min %lu, avg %lu, max %lu, max jitter %lu\n",
+           irq, (unsigned long)stats.samples, (unsigned long)stats.minCycles,
+           (unsigned long)(stats.totalCycles / stats.samples),
+           (unsigned long)stats.maxCycles,
+           (unsigned long)stats.maxJitterCycles);
+    printHistogram("latency", stats.latencyHistogram);
+    printHistogram("jitter ", stats.jitterHistogram);
+  }
+
+  if (worstCase.cycles == 0)
+    return;
+  printf("worst case: %lu cycles on irq %d, ", (unsigned long)worstCase.cycles,
+         worstCase.irq);
+  if (worstCase.culprit == ISRLATENCY_UNKNOWN)
+    printf("culprit unknown (interrupts timing mode is off)\n");
+  else if (worstCase.culprit == ISRLATENCY_NO_ISR)
+    printf("no callback running (interrupts masked or dispatch overhead)\n");
+  else
+    printf("while irq %d was running\n", worstCase.culprit);
+}
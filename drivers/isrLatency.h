@@ -0,0 +1,67 @@
+#ifndef ISRLATENCY
+#define ISRLATENCY
+
+#include <stdint.h>
+
+// Measures how late interrupts driven by a count-down interval timer are
+// serviced. On entry to the interrupt's callback the timer's counter is read;
+// since the timer reloads at rollover, (load value - counter) is the number of
+// cycles since the interrupt was raised. For each attached irq the harness
+// keeps min/avg/max latency, a histogram of latency and a histogram of jitter
+// (the change in latency from one interrupt to the next). The worst latency
+// seen on any line is attributed to the callback that was running for most of
+// that interval; this needs interrupts timing mode
+// (interrupts_enableTiming()), otherwise the culprit is reported as unknown.
+
+// Histogram bins are powers of two: bin 0 counts 0 cycles, bin n counts
+// [2^(n-1), 2^n) cycles, and the last bin also counts everything larger.
+#define ISRLATENCY_HISTOGRAM_BINS 16
+
+// Culprit values for isrLatency_worstCase_t that are not irq numbers.
+#define ISRLATENCY_NO_ISR 0xFE  // No callback was running: masked or dispatch.
+#define ISRLATENCY_UNKNOWN 0xFF // Timing mode was off, so nothing to compare.
+
+// Statistics for one line.
+typedef struct {
+  uint32_t samples;
+  uint32_t minCycles; // UINT32_MAX until the first sample.
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  uint32_t maxJitterCycles;
+  uint32_t latencyHistogram[ISRLATENCY_HISTOGRAM_BINS];
+  uint32_t jitterHistogram[ISRLATENCY_HISTOGRAM_BINS];
+} isrLatency_stats_t;
+
+// The worst latency seen since the last reset.
+typedef struct {
+  uint32_t cycles; // Latency in interval-timer cycles (10 ns).
+  uint8_t irq;     // Line that was serviced late.
+  uint8_t culprit; // Line whose callback was running, or one of the above.
+} isrLatency_worstCase_t;
+
+// Start measuring the given irq, which must be raised by the given interval
+// timer running as a count-down timer. Installs the interrupts entry hook.
+void isrLatency_attach(uint8_t irq, uint32_t timerNumber);
+
+// Stop measuring the given irq. Statistics are kept.
+void isrLatency_detach(uint8_t irq);
+
+// Clear all statistics, including the worst case.
+void isrLatency_reset();
+
+// Add one latency sample to the statistics of the given line. The entry hook
+// calls this with the cycles read from the timer; tests can call it directly
+// to script latencies.
+void isrLatency_recordSample(uint8_t irq, uint32_t cycles);
+
+// Returns the statistics of the given line.
+isrLatency_stats_t isrLatency_getStats(uint8_t irq);
+
+// Returns the worst latency seen on any attached line.
+isrLatency_worstCase_t isrLatency_getWorstCase();
+
+// Print statistics and histograms for every attached line, then the worst
+// case. Safe to call from any lab main() while interrupts keep running.
+void isrLatency_print();
+
+#endif /* ISRLATENCY */
@@ -0,0 +1,90 @@
+#ifndef SPSCRING_H_
+#define SPSCRING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Index bookkeeping for a lock-free single-producer/single-consumer ring
+// buffer. The caller owns the power-of-two array of elements and uses the
+// slot numbers given here to index it, so the ring works for any element type
+// and the hot paths inline down to a few loads and stores. One side (typically
+// an ISR) only produces, the other (typically main) only consumes; neither
+// needs to disable interrupts.
+//
+// indexIn is written only by the producer and indexOut only by the consumer.
+// Both run freely and are masked into the array, so all capacity slots are
+// usable. Each side publishes its index with release ordering after touching
+// the slot, and reads the other side's index with acquire ordering.
+//
+// Producer:                          Consumer:
+//   uint32_t slot;                     uint32_t slot;
+//   if (spscRing_reserve(&r, &slot)) { if (spscRing_peek(&r, &slot)) {
+//     data[slot] = value;                value = data[slot];
+//     spscRing_publish(&r);              spscRing_consume(&r, 1);
+//   }                                  }
+
+typedef struct {
+  volatile uint32_t indexIn;       // Total elements ever produced.
+  volatile uint32_t indexOut;      // Total elements ever consumed.
+  uint32_t mask;                   // Capacity - 1.
+  volatile uint32_t overflowCount; // Reservations refused because it was full.
+} spscRing_t;
+
+// Empties the ring. capacity must be a power of two. Not safe while a producer
+// or consumer is active.
+static inline void spscRing_init(spscRing_t *r, uint32_t capacity) {
+  r->mask = capacity - 1;
+  r->indexIn = 0;
+  r->indexOut = 0;
+  r->overflowCount = 0;
+}
+
+// Producer side. Sets *slot to the slot to write next and returns true, or
+// counts an overflow and returns false if the ring is full. The element is
+// not visible to the consumer until spscRing_publish().
+static inline bool spscRing_reserve(spscRing_t *r, uint32_t *slot) {
+  uint32_t in = r->indexIn;
+  if (in - __atomic_load_n(&r->indexOut, __ATOMIC_ACQUIRE) > r->mask) {
+    r->overflowCount++;
+    return false;
+  }
+  *slot = in & r->mask;
+  return true;
+}
+
+// Producer side. Hands the reserved slot to the consumer.
+static inline void spscRing_publish(spscRing_t *r) {
+  __atomic_store_n(&r->indexIn, r->indexIn + 1, __ATOMIC_RELEASE);
+}
+
+// Consumer side. Sets *slot to the slot of the oldest element and returns the
+// number of elements available from there on (which may wrap past the end of
+// the array). Returns 0 if the ring is empty.
+static inline uint32_t spscRing_peek(spscRing_t *r, uint32_t *slot) {
+  uint32_t out = r->indexOut;
+  *slot = out & r->mask;
+  return __atomic_load_n(&r->indexIn, __ATOMIC_ACQUIRE) - out;
+}
+
+// Consumer side. Hands count elements, read since spscRing_peek(), back to
+// the producer.
+static inline void spscRing_consume(spscRing_t *r, uint32_t count) {
+  __atomic_store_n(&r->indexOut, r->indexOut + count, __ATOMIC_RELEASE);
+}
+
+// Returns the number of elements in the ring. Exact when called from either
+// side; from elsewhere it is a snapshot.
+static inline uint32_t spscRing_count(spscRing_t *r) {
+  return __atomic_load_n(&r->indexIn, __ATOMIC_ACQUIRE) -
+         __atomic_load_n(&r->indexOut, __ATOMIC_ACQUIRE);
+}
+
+// Returns the capacity.
+static inline uint32_t spscRing_capacity(spscRing_t *r) { return r->mask + 1; }
+
+// Returns the number of reservations refused because the ring was full.
+static inline uint32_t spscRing_overflowCount(spscRing_t *r) {
+  return r->overflowCount;
+}
+
+#endif /* SPSCRING_H_ */
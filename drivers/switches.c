@@ -25,4 +25,4 @@ void switches_init() {
 
 // Returns the current value of all 4 switches as the lower 4 bits of the
 // returned value. bit3 = SW3, bit2 = SW2, bit1 = SW1, bit0 = SW0.
-uint8_t switches_read() { readRegister(0); }
\ No newline at end of file
+uint8_t switches_read() { return readRegister(0); }
\ No newline at end of file
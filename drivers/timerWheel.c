@@ -0,0 +1,161 @@
+#include "timerWheel.h"
+#include "armInterrupts.h"
+
+#define SLOT_MASK (TIMERWHEEL_SLOT_COUNT - 1)
+#define CPSR_IRQ_MASK 0x80 // The I bit: set while IRQs are masked.
+
+// Head of the timer list for each slot.
+static timerWheel_timer_t *slots[TIMERWHEEL_SLOT_COUNT];
+
+// Current tick, and the number of timers in the wheel.
+static volatile uint32_t ticks;
+static volatile uint32_t activeCount;
+
+// Set while timerWheel_tick() is firing callbacks. Callbacks already run with
+// interrupts masked, so the critical section helpers must not re-enable them.
+static volatile bool inTick;
+
+// Next timer to visit in the slot being processed. If a callback cancels this
+// timer, the cursor is moved past it so the walk never follows a stale link.
+static timerWheel_timer_t *cursor;
+
+// Returns true if IRQs are enabled. Off the board there is no CPSR to read,
+// and the armInterrupts stand-ins do nothing either way.
+static bool irqsEnabled() {
+#ifdef __arm__
+  uint32_t cpsr;
+  __asm__ volatile("mrs %0, cpsr" : "=r"(cpsr));
+  return !(cpsr & CPSR_IRQ_MASK);
+#else
+  return true;
+#endif
+}
+
+// Keep the ISR out while a list is being modified from main(). Returns
+// whether IRQs were enabled, for exitCritical(), so that a timer started
+// before interrupts are set up (from isr_init(), say) does not turn them on.
+static bool enterCritical() {
+  bool enabled = !inTick && irqsEnabled();
+  if (enabled)
+    armInterrupts_disable();
+  return enabled;
+}
+
+static void exitCritical(bool enabled) {
+  if (enabled)
+    armInterrupts_enable();
+}
+
+// Link a timer into the slot for its expiration tick. Timers are pushed on the
+// head, so a timer added to the slot currently being walked is not visited
+// until the wheel comes back around.
+static void insert(timerWheel_timer_t *timer) {
+  timerWheel_timer_t **head = &slots[timer->expires & SLOT_MASK];
+  timer->prev = NULL;
+  timer->next = *head;
+  if (*head != NULL)
+    (*head)->prev = timer;
+  *head = timer;
+  timer->active = true;
+  activeCount++;
+}
+
+// Unlink a timer from its slot.
+static void unlink(timerWheel_timer_t *timer) {
+  if (timer == cursor)
+    cursor = timer->next;
+  if (timer->prev != NULL)
+    timer->prev->next = timer->next;
+  else
+    slots[timer->expires & SLOT_MASK] = timer->next;
+  if (timer->next != NULL)
+    timer->next->prev = timer->prev;
+  timer->next = NULL;
+  timer->prev = NULL;
+  timer->active = false;
+  activeCount--;
+}
+
+// Empty the wheel and reset the tick counter.
+void timerWheel_init() {
+  for (uint32_t i = 0; i < TIMERWHEEL_SLOT_COUNT; i++) {
+    timerWheel_timer_t *timer = slots[i];
+    while (timer != NULL) {
+      timerWheel_timer_t *next = timer->next;
+      timer->next = NULL;
+      timer->prev = NULL;
+      timer->active = false;
+      timer = next;
+    }
+    slots[i] = NULL;
+  }
+  ticks = 0;
+  activeCount = 0;
+  inTick = false;
+  cursor = NULL;
+}
+
+// Advance one tick and fire the timers that expire on it.
+void timerWheel_tick() {
+  uint32_t now = ticks + 1;
+  ticks = now;
+
+  // Nothing scheduled, or nothing hashed into this slot.
+  if (activeCount == 0 || slots[now & SLOT_MASK] == NULL)
+    return;
+
+  inTick = true;
+  cursor = slots[now & SLOT_MASK];
+  while (cursor != NULL) {
+    timerWheel_timer_t *timer = cursor;
+    cursor = timer->next;
+
+    // Timers with long delays share the slot with nearer ones; leave them for
+    // a later revolution.
+    if (timer->expires != now)
+      continue;
+
+    unlink(timer);
+    if (timer->period) {
+      timer->expires = now + timer->period;
+      insert(timer);
+    }
+    if (timer->callback != NULL)
+      timer->callback(timer->arg);
+  }
+  inTick = false;
+}
+
+// Start (or restart) a timer.
+void timerWheel_start(timerWheel_timer_t *timer, uint32_t delayTicks,
+                      uint32_t periodTicks, timerWheel_callback_t callback,
+                      void *arg) {
+  bool enabled = enterCritical();
+  if (timer->active)
+    unlink(timer);
+  timer->expires = ticks + (delayTicks ? delayTicks : 1);
+  timer->period = periodTicks;
+  timer->callback = callback;
+  timer->arg = arg;
+  insert(timer);
+  exitCritical(enabled);
+}
+
+// Stop a timer.
+void timerWheel_cancel(timerWheel_timer_t *timer) {
+  bool enabled = enterCritical();
+  if (timer->active)
+    unlink(timer);
+  exitCritical(enabled);
+}
+
+// Is the timer scheduled?
+bool timerWheel_isActive(const timerWheel_timer_t *timer) {
+  return timer->active;
+}
+
+// Ticks since timerWheel_init().
+uint32_t timerWheel_getTicks() { return ticks; }
+
+// Number of scheduled timers.
+uint32_t timerWheel_getActiveCount() { return activeCount; }
@@ -0,0 +1,63 @@
+#ifndef TIMERWHEEL
+#define TIMERWHEEL
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A hashed timer wheel that multiplexes any number of software timers onto a
+// single periodic tick (typically one interval-timer interrupt, or the 100 kHz
+// lasertag isr_function()). Timers are kept in per-slot doubly linked lists
+// indexed by (expiration tick & mask), so starting and cancelling a timer is
+// O(1) and a tick only looks at the timers hashed into the current slot. Idle
+// timers are not in the wheel at all and cost nothing.
+
+// Number of slots in the wheel. Must be a power of two. Delays longer than this
+// are fine; such timers simply stay in their slot for extra revolutions.
+#define TIMERWHEEL_SLOT_COUNT 256
+
+// Function called when a timer expires. It runs in the context that calls
+// timerWheel_tick() (usually an ISR), so keep it short. It may start or cancel
+// any timer, including the one that just expired.
+typedef void (*timerWheel_callback_t)(void *arg);
+
+// A single software timer. Storage is owned by the caller (usually a file
+// static), so the wheel never allocates. Treat the fields as private.
+typedef struct timerWheel_timer_t {
+  struct timerWheel_timer_t *next;
+  struct timerWheel_timer_t *prev;
+  uint32_t expires;               // Absolute tick at which the timer fires.
+  uint32_t period;                // Reload value in ticks, 0 for one-shot.
+  timerWheel_callback_t callback; // May be NULL.
+  void *arg;                      // Passed to callback.
+  volatile bool active;           // True while the timer is in the wheel.
+} timerWheel_timer_t;
+
+// Empty all slots and reset the tick counter. Timers that were running are
+// stopped, so cancelling one later does nothing.
+void timerWheel_init();
+
+// Advance the wheel by one tick and fire every timer that expires on this
+// tick. Call this from exactly one place at a fixed rate.
+void timerWheel_tick();
+
+// Start (or restart) a timer. The callback fires delayTicks ticks from now
+// (a delay of 0 is treated as 1). If periodTicks is non-zero, the timer is
+// re-armed every periodTicks ticks after that until it is cancelled.
+void timerWheel_start(timerWheel_timer_t *timer, uint32_t delayTicks,
+                      uint32_t periodTicks, timerWheel_callback_t callback,
+                      void *arg);
+
+// Stop a timer. Does nothing if the timer is not running.
+void timerWheel_cancel(timerWheel_timer_t *timer);
+
+// Returns true if the timer is currently scheduled.
+bool timerWheel_isActive(const timerWheel_timer_t *timer);
+
+// Returns the number of ticks since timerWheel_init().
+uint32_t timerWheel_getTicks();
+
+// Returns the number of timers currently scheduled.
+uint32_t timerWheel_getActiveCount();
+
+#endif /* TIMERWHEEL */
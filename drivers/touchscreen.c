@@ -1,7 +1,9 @@
 #include "touchscreen.h"
 #include "display.h"
+#include "spscRing.h"
 #include "xparameters.h"
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 
 #define ADC_SETTLE_TIME .05
@@ -15,8 +17,130 @@ enum touchscreen_state {
 static touchscreen_status_t status;
 static uint64_t adc_settle_ticks;
 static uint64_t adc_timer;
-static int16_t x, y;
+static int16_t x, y; // Where the touch settled, for touchscreen_get_location()
+static int16_t dragX, dragY; // Latest position while pressed, for move events
 static uint8_t z;
+static uint32_t ticks;
+
+// Where the touch data comes from (the display, unless a test overrides it)
+static bool (*isTouched)() = display_isTouched;
+static void (*getTouchedPoint)(int16_t *x, int16_t *y,
+                               uint8_t *z) = display_getTouchedPoint;
+
+// Event queue. touchscreen_tick() is the producer and touchscreen_pop_event()
+// the consumer.
+static touchscreen_event_t events[TOUCHSCREEN_EVENT_QUEUE_SIZE];
+static spscRing_t eventRing;
+
+// Position of the last queued event, for move detection
+static int16_t lastEventX, lastEventY;
+
+// Recent samples of the current touch, oldest overwritten first
+static int16_t sampleX[TOUCHSCREEN_MEDIAN_SAMPLES];
+static int16_t sampleY[TOUCHSCREEN_MEDIAN_SAMPLES];
+static uint8_t sampleCount; // Valid samples, up to TOUCHSCREEN_MEDIAN_SAMPLES
+static uint8_t sampleIndex; // Where the next sample goes
+
+static bool adaptive = false;
+static uint32_t touchStartTick;
+static volatile uint32_t pressLatencyTicks;
+
+// Queue an event at (eventX, eventY), or count it as dropped if the queue is
+// full
+static void pushEvent(touchscreen_eventType_t type, int16_t eventX,
+                      int16_t eventY) {
+  uint32_t slot;
+  if (!spscRing_reserve(&eventRing, &slot))
+    return;
+  touchscreen_event_t *event = &events[slot];
+  event->type = type;
+  event->x = eventX;
+  event->y = eventY;
+  event->z = z;
+  event->timestamp = ticks;
+  lastEventX = eventX;
+  lastEventY = eventY;
+  spscRing_publish(&eventRing);
+}
+
+// Read the controller and add the sample to the recent-sample window
+static void takeSample() {
+  int16_t sx, sy;
+  getTouchedPoint(&sx, &sy, &z);
+  sampleX[sampleIndex] = sx;
+  sampleY[sampleIndex] = sy;
+  sampleIndex = (sampleIndex + 1) % TOUCHSCREEN_MEDIAN_SAMPLES;
+  if (sampleCount < TOUCHSCREEN_MEDIAN_SAMPLES)
+    sampleCount++;
+}
+
+// Returns the median of the first count values (insertion sort on a copy; the
+// window is only a handful of samples)
+static int16_t median(const int16_t values[], uint8_t count) {
+  int16_t sorted[TOUCHSCREEN_MEDIAN_SAMPLES];
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t j = i;
+    for (; j > 0 && sorted[j - 1] > values[i]; j--)
+      sorted[j] = sorted[j - 1];
+    sorted[j] = values[i];
+  }
+  return sorted[count / 2];
+}
+
+// Returns true if the last TOUCHSCREEN_SETTLE_SAMPLES samples agree to within
+// TOUCHSCREEN_SETTLE_TOLERANCE in both x and y
+static bool samplesAgree() {
+  if (sampleCount < TOUCHSCREEN_SETTLE_SAMPLES)
+    return false;
+  int16_t minX = INT16_MAX, maxX = INT16_MIN;
+  int16_t minY = INT16_MAX, maxY = INT16_MIN;
+  for (uint8_t i = 1; i <= TOUCHSCREEN_SETTLE_SAMPLES; i++) {
+    uint8_t index = (sampleIndex + TOUCHSCREEN_MEDIAN_SAMPLES - i) %
+                    TOUCHSCREEN_MEDIAN_SAMPLES;
+    if (sampleX[index] < minX)
+      minX = sampleX[index];
+    if (sampleX[index] > maxX)
+      maxX = sampleX[index];
+    if (sampleY[index] < minY)
+      minY = sampleY[index];
+    if (sampleY[index] > maxY)
+      maxY = sampleY[index];
+  }
+  return maxX - minX <= TOUCHSCREEN_SETTLE_TOLERANCE &&
+         maxY - minY <= TOUCHSCREEN_SETTLE_TOLERANCE;
+}
+
+// Get the location from the samples: the median in adaptive mode, otherwise
+// the newest sample
+static void updateLocation(int16_t *newX, int16_t *newY) {
+  if (adaptive) {
+    *newX = median(sampleX, sampleCount);
+    *newY = median(sampleY, sampleCount);
+  } else {
+    uint8_t newest = (sampleIndex + TOUCHSCREEN_MEDIAN_SAMPLES - 1) %
+                     TOUCHSCREEN_MEDIAN_SAMPLES;
+    *newX = sampleX[newest];
+    *newY = sampleY[newest];
+  }
+}
+
+// The touch has settled: report it as pressed. (x, y) keeps this location
+// until the next press; dragging only updates (dragX, dragY).
+static void settled() {
+  updateLocation(&x, &y);
+  dragX = x;
+  dragY = y;
+  pressLatencyTicks = ticks - touchStartTick;
+  pushEvent(TOUCHSCREEN_EVENT_PRESS, x, y);
+}
+
+// Returns true if the drag has moved far enough to queue a move event
+static bool movedSinceLastEvent() {
+  return dragX - lastEventX >= TOUCHSCREEN_MOVE_THRESHOLD ||
+         lastEventX - dragX >= TOUCHSCREEN_MOVE_THRESHOLD ||
+         dragY - lastEventY >= TOUCHSCREEN_MOVE_THRESHOLD ||
+         lastEventY - dragY >= TOUCHSCREEN_MOVE_THRESHOLD;
+}
 
 // print the current state for debugging
 void touchscreen_debugStatePrint() {
@@ -51,33 +175,49 @@ void touchscreen_debugStatePrint() {
 // seconds).
 void touchscreen_init(double period_seconds) {
   touchscreen_current_state = waiting_st;
+  status = TOUCHSCREEN_IDLE;
   adc_timer = 0;
   adc_settle_ticks = ADC_SETTLE_TIME / period_seconds;
+  ticks = 0;
+  spscRing_init(&eventRing, TOUCHSCREEN_EVENT_QUEUE_SIZE);
 }
 
 // Tick the touchscreen driver state machine
 void touchscreen_tick() {
   // touchscreen_debugStatePrint();
+  ticks++;
 
   // Transition
   switch (touchscreen_current_state) {
   case waiting_st:
-    if (display_isTouched()) {
+    if (isTouched()) {
       display_clearOldTouchData();
+      sampleCount = 0;
+      sampleIndex = 0;
+      touchStartTick = ticks;
       touchscreen_current_state = adc_settling_st;
     }
     break;
   case adc_settling_st:
-    if (!display_isTouched()) {
+    if (!isTouched()) {
       touchscreen_current_state = waiting_st;
-    } else if (display_isTouched() && adc_timer == adc_settle_ticks) {
-      display_getTouchedPoint(&x, &y, &z);
+    } else if (adaptive) {
+      // Sample while settling; stop as soon as the samples agree
+      takeSample();
+      if (samplesAgree() || adc_timer >= adc_settle_ticks) {
+        settled();
+        touchscreen_current_state = pressed_st;
+      }
+    } else if (adc_timer == adc_settle_ticks) {
+      takeSample();
+      settled();
       touchscreen_current_state = pressed_st;
     }
     break;
   case pressed_st:
-    if (!display_isTouched()) {
+    if (!isTouched()) {
       status = TOUCHSCREEN_RELEASED;
+      pushEvent(TOUCHSCREEN_EVENT_RELEASE, dragX, dragY);
       touchscreen_current_state = waiting_st;
     }
     break;
@@ -93,6 +233,11 @@ void touchscreen_tick() {
     break;
   case pressed_st:
     status = TOUCHSCREEN_PRESSED;
+    // Drag samples
+    takeSample();
+    updateLocation(&dragX, &dragY);
+    if (movedSinceLastEvent())
+      pushEvent(TOUCHSCREEN_EVENT_MOVE, dragX, dragY);
     break;
   }
 }
@@ -109,8 +254,51 @@ void touchscreen_ack_touch() {
   }
 }
 
-// Get the (x,y) location of the last touchscreen touch
+// Get the (x,y) location where the last touch settled
 display_point_t touchscreen_get_location() {
   display_point_t location = {x, y};
   return location;
-}
\ No newline at end of file
+}
+
+// Remove the oldest event from the queue. Returns false if it was empty.
+bool touchscreen_pop_event(touchscreen_event_t *event) {
+  uint32_t slot;
+  if (!spscRing_peek(&eventRing, &slot))
+    return false;
+  *event = events[slot];
+  spscRing_consume(&eventRing, 1);
+  return true;
+}
+
+// Returns the number of events lost because the queue was full.
+uint32_t touchscreen_get_dropped_event_count() {
+  return spscRing_overflowCount(&eventRing);
+}
+
+// Replace display_isTouched() and display_getTouchedPoint() with other
+// functions, so tests can script touches. Passing NULL for both restores the
+// display functions.
+void touchscreen_set_source(bool (*isTouchedFcn)(),
+                            void (*getTouchedPointFcn)(int16_t *x, int16_t *y,
+                                                       uint8_t *z)) {
+  isTouched = isTouchedFcn ? isTouchedFcn : display_isTouched;
+  getTouchedPoint =
+      getTouchedPointFcn ? getTouchedPointFcn : display_getTouchedPoint;
+}
+
+// Turn adaptive settling on or off.
+void touchscreen_set_adaptive(bool enabled) { adaptive = enabled; }
+
+// Get the median of the recent samples of the current (or last) touch.
+display_point_t touchscreen_get_filtered_location() {
+  display_point_t location = {x, y};
+  if (sampleCount) {
+    location.x = median(sampleX, sampleCount);
+    location.y = median(sampleY, sampleCount);
+  }
+  return location;
+}
+
+// Returns the number of ticks from when the last touch was first detected to
+// when it was reported as pressed.
+uint32_t touchscreen_get_press_latency_ticks() { return pressLatencyTicks; }
@@ -2,6 +2,24 @@
 #define TOUCHSCREEN
 
 #include "display.h"
+#include <stdbool.h>
+
+// Number of events the touchscreen event queue can hold. Must be a power of
+// two.
+#define TOUCHSCREEN_EVENT_QUEUE_SIZE 16
+
+// While pressed, a move event is queued whenever the touch has moved at least
+// this many pixels (in x or y) from the last queued position.
+#define TOUCHSCREEN_MOVE_THRESHOLD 2
+
+// Adaptive settling (see touchscreen_set_adaptive()): a touch is settled once
+// this many consecutive samples agree to within the tolerance, in pixels, in
+// both x and y.
+#define TOUCHSCREEN_SETTLE_SAMPLES 3
+#define TOUCHSCREEN_SETTLE_TOLERANCE 4
+
+// Number of recent samples the median-filtered location is taken over.
+#define TOUCHSCREEN_MEDIAN_SAMPLES 5
 
 // Status of the touchscreen
 typedef enum {
@@ -10,6 +28,22 @@ typedef enum {
   TOUCHSCREEN_RELEASED // Touchscreen has been released, but not acknowledged
 } touchscreen_status_t;
 
+// Kinds of touchscreen events
+typedef enum {
+  TOUCHSCREEN_EVENT_PRESS,   // A touch has settled; first position.
+  TOUCHSCREEN_EVENT_MOVE,    // A drag sample while pressed.
+  TOUCHSCREEN_EVENT_RELEASE, // The touch ended; last position.
+} touchscreen_eventType_t;
+
+// A timestamped touchscreen event
+typedef struct {
+  touchscreen_eventType_t type;
+  int16_t x;
+  int16_t y;
+  uint8_t z;          // Pressure reported by the controller.
+  uint32_t timestamp; // touchscreen_tick() count when the event was queued.
+} touchscreen_event_t;
+
 // Initialize the touchscreen driver state machine, with a given tick period (in
 // seconds).
 void touchscreen_init(double period_seconds);
@@ -25,7 +59,41 @@ touchscreen_status_t touchscreen_get_status();
 // switch to the TOUCHSCREEN_IDLE status.
 void touchscreen_ack_touch();
 
-// Get the (x,y) location of the last touchscreen touch
+// Get the (x,y) location of the last touchscreen touch, where it settled.
+// Drags after that are only reported as move events.
 display_point_t touchscreen_get_location();
 
+// Every press, drag and release is also queued as an event, so touches that
+// happen before the previous one is acknowledged are not lost. The status
+// functions above keep working as before; a consumer may use either, and
+// events that are never popped are simply dropped once the queue is full.
+
+// Remove the oldest event from the queue. Returns false if it was empty.
+bool touchscreen_pop_event(touchscreen_event_t *event);
+
+// Returns the number of events lost because the queue was full.
+uint32_t touchscreen_get_dropped_event_count();
+
+// Replace display_isTouched() and display_getTouchedPoint() with other
+// functions, so tests can script touches. Passing NULL for both restores the
+// display functions.
+void touchscreen_set_source(bool (*isTouched)(),
+                            void (*getTouchedPoint)(int16_t *x, int16_t *y,
+                                                    uint8_t *z));
+
+// Turn adaptive settling on or off (off by default). When on, the controller
+// is sampled on every tick while settling and the touch is declared settled as
+// soon as TOUCHSCREEN_SETTLE_SAMPLES consecutive samples agree, instead of
+// always waiting the fixed 50 ms; the fixed time remains the upper bound.
+// Reported locations (and event positions) are then median filtered.
+void touchscreen_set_adaptive(bool enabled);
+
+// Get the median of the last TOUCHSCREEN_MEDIAN_SAMPLES samples of the current
+// (or last) touch. Available in both modes.
+display_point_t touchscreen_get_filtered_location();
+
+// Returns the number of ticks from when the last touch was first detected to
+// when it was reported as pressed (its press event timestamp).
+uint32_t touchscreen_get_press_latency_ticks();
+
 #endif /* TOUCHSCREEN */
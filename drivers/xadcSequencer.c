@@ -0,0 +1,50 @@
+#include <stdio.h>
+
+#include "xadcSequencer.h"
+#include "xparameters.h"
+#include "xsysmon_hw.h"
+
+#define BASE_ADDRESS XPAR_SYSMON_0_BASEADDR
+// Conversions are left-justified in the 16-bit data registers.
+#define DATA_SHIFT 4
+// Data registers are one word apart, in channel order from the temperature.
+#define DATA_OFFSET(channel) (XSM_TEMP_OFFSET + ((channel) << 2))
+// Sequencer registers 01 (channel enables) and 05 (bipolar) hold one bit per
+// auxiliary input.
+#define SEQ_AUX_CHANNEL_OFFSET XSM_SEQ01_OFFSET
+#define SEQ_AUX_BIPOLAR_OFFSET XSM_SEQ05_OFFSET
+#define SEQ_AUX_AVERAGE_OFFSET XSM_SEQ03_OFFSET
+
+// Enables the sequencer in continuous mode over channels[].
+bool xadcSequencer_init(const uint8_t channels[], uint8_t count, bool bipolar) {
+  if (count == 0 || count > XADCSEQUENCER_MAX_CHANNELS) {
+    printf("xadcSequencer_init: %u channels (1 to %u).\n", count,
+           XADCSEQUENCER_MAX_CHANNELS);
+    return false;
+  }
+  uint32_t mask = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (channels[i] < XSM_CH_AUX_MIN || channels[i] > XSM_CH_AUX_MAX) {
+      printf("xadcSequencer_init: channel %u is not auxiliary.\n",
+             channels[i]);
+      return false;
+    }
+    mask |= 1 << (channels[i] - XSM_CH_AUX_MIN);
+  }
+  // The sequencer must be in safe mode while its registers change.
+  uint32_t cfr1 = XSysMon_ReadReg(BASE_ADDRESS, XSM_CFR1_OFFSET) &
+                  ~XSM_CFR1_SEQ_VALID_MASK;
+  XSysMon_WriteReg(BASE_ADDRESS, XSM_CFR1_OFFSET,
+                   cfr1 | XSM_CFR1_SEQ_SAFEMODE_MASK);
+  XSysMon_WriteReg(BASE_ADDRESS, SEQ_AUX_CHANNEL_OFFSET, mask);
+  XSysMon_WriteReg(BASE_ADDRESS, SEQ_AUX_AVERAGE_OFFSET, 0);
+  XSysMon_WriteReg(BASE_ADDRESS, SEQ_AUX_BIPOLAR_OFFSET, bipolar ? mask : 0);
+  XSysMon_WriteReg(BASE_ADDRESS, XSM_CFR1_OFFSET,
+                   cfr1 | XSM_CFR1_SEQ_CONTINPASS_MASK);
+  return true;
+}
+
+// Returns the latest 12-bit conversion of channel.
+uint32_t xadcSequencer_read(uint8_t channel) {
+  return XSysMon_ReadReg(BASE_ADDRESS, DATA_OFFSET(channel)) >> DATA_SHIFT;
+}
@@ -0,0 +1,31 @@
+#ifndef XADCSEQUENCER_H_
+#define XADCSEQUENCER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Runs the XADC sequencer continuously over several auxiliary inputs so that
+// each has a fresh conversion whenever it is read, instead of the single
+// channel (SELECTED_XADC_CHANNEL) that armInterrupts_getAdcData() reads. The
+// XADC converts at up to 1 MSPS in total, so four channels read at 100 kHz
+// each are refreshed between reads. Channels are XADC channel numbers, e.g.
+// XADC_AUX_CHANNEL_14 from armInterrupts.h.
+
+// The XADC numbers its auxiliary inputs 16 to 31 (xsysmon.h). Defined here
+// too so that the XADC_AUX_CHANNEL_* macros work in builds without xsysmon.h.
+#ifndef XSM_CH_AUX_MAX
+#define XSM_CH_AUX_MIN 16
+#define XSM_CH_AUX_MAX 31
+#endif
+
+#define XADCSEQUENCER_MAX_CHANNELS 4
+
+// Enables the sequencer in continuous mode over channels[0..count-1], all
+// unipolar or all bipolar. Returns false (and leaves the XADC alone) if count
+// is 0 or above XADCSEQUENCER_MAX_CHANNELS or a channel is not auxiliary.
+bool xadcSequencer_init(const uint8_t channels[], uint8_t count, bool bipolar);
+
+// Returns the latest 12-bit conversion of channel.
+uint32_t xadcSequencer_read(uint8_t channel);
+
+#endif /* XADCSEQUENCER_H_ */
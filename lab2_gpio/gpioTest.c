@@ -1,6 +1,9 @@
 #include "gpioTest.h"
 #include "buttons.h"
 #include "display.h"
+#include "gpioEvents.h"
+#include "interrupts.h"
+#include "intervalTimer.h"
 #include "leds.h"
 #include "switches.h"
 #include <stdio.h>
@@ -24,6 +27,10 @@
 #define TEXT_OFFSET_Y 50
 #define TEXT_SIZE 2
 
+// Sampling period of the gpioEvents debouncer
+#define EVENTS_TICK_PERIOD 0.001
+#define ALL_BUTTONS 0xF
+
 // Runs a test of the buttons. As you push the buttons, graphics and messages
 // will be written to the LCD panel. The test will run until all 4 pushbuttons
 // are simultaneously pressed.
@@ -170,4 +177,43 @@ void gpioTest_switches() {
 
   leds_write(0x00);
   return;
-}
\ No newline at end of file
+}
+
+// Interrupt service routine for gpioTest_events()
+static void eventsIsr() {
+  intervalTimer_ackInterrupt(INTERVAL_TIMER_0);
+  gpioEvents_tick();
+}
+
+// Runs the gpioEvents scripted debounce test, then prints debounced events as
+// they arrive until all 4 pushbuttons are simultaneously pressed.
+void gpioTest_events() {
+  gpioEvents_runTest();
+  gpioEvents_init(EVENTS_TICK_PERIOD);
+
+  // Sample the inputs from a timer interrupt
+  interrupts_init();
+  interrupts_register(INTERVAL_TIMER_0_INTERRUPT_IRQ, eventsIsr);
+  interrupts_irq_enable(INTERVAL_TIMER_0_INTERRUPT_IRQ);
+  intervalTimer_initCountDown(INTERVAL_TIMER_0, EVENTS_TICK_PERIOD);
+  intervalTimer_enableInterrupt(INTERVAL_TIMER_0);
+  intervalTimer_start(INTERVAL_TIMER_0);
+
+  gpioEvents_event_t event;
+  do {
+    event = gpioEvents_waitForEvent();
+    const char *name = event.type == GPIOEVENTS_BUTTON_PRESS     ? "press"
+                       : event.type == GPIOEVENTS_BUTTON_RELEASE ? "release"
+                                                                 : "switch";
+    printf("%8lu ms: %s 0x%x (state 0x%x)\n",
+           (unsigned long)(event.timestamp * EVENTS_TICK_PERIOD * 1000), name,
+           event.mask, event.state);
+  } while (event.type != GPIOEVENTS_BUTTON_PRESS ||
+           event.state != ALL_BUTTONS);
+
+  intervalTimer_stop(INTERVAL_TIMER_0);
+  interrupts_irq_disable(INTERVAL_TIMER_0_INTERRUPT_IRQ);
+  printf("spurious edges filtered: %lu, events dropped: %lu\n",
+         (unsigned long)gpioEvents_getSpuriousEdgeCount(),
+         (unsigned long)gpioEvents_getDroppedCount());
+}
@@ -13,4 +13,10 @@ void gpioTest_buttons();
 // return.
 void gpioTest_switches();
 
+// Runs the gpioEvents scripted debounce test, then prints debounced button and
+// switch events as they arrive, sleeping between them instead of polling. The
+// test runs until all 4 pushbuttons are simultaneously pressed, then prints how
+// many raw edges were rejected as bounce.
+void gpioTest_events();
+
 #endif /* GPIOTEST */
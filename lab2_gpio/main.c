@@ -18,5 +18,6 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 int main() {
   gpioTest_switches();
   gpioTest_buttons();
+  gpioTest_events();
   return 0;
 }
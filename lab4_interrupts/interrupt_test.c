@@ -1,6 +1,8 @@
 #include "interrupt_test.h"
+#include "armInterrupts.h"
 #include "interrupts.h"
 #include "intervalTimer.h"
+#include "isrLatency.h"
 #include "leds.h"
 #include "xil_io.h"
 #include "xparameters.h"
@@ -14,6 +16,34 @@
 #define LED_1 0x02
 #define LED_2 0x04
 
+// interrupt_test_runPriority(): timer 0 timestamps, timers 1 and 2 interrupt
+// once each while IRQs are masked, so both lines are pending together.
+#define PRIORITY_TEST_TIMER INTERVAL_TIMER_0
+#define PRIORITY_TEST_PERIOD 0.001        // 1 ms
+#define PRIORITY_TEST_WAIT_CYCLES 1000000 // 10 ms at 100 MHz
+#define PRIORITY_TEST_LINE_COUNT 2
+
+// interrupt_test_runLatency(): scripted samples go to an unconnected line.
+// Then line 1 runs a long callback every 1 ms while line 2, every 0.5 ms, is
+// measured; line 2 is raised at the same time as line 1 every other period.
+#define LATENCY_TEST_SCRIPTED_IRQ 5
+#define LATENCY_TEST_BUSY_PERIOD 0.001      // 1 ms
+#define LATENCY_TEST_MEASURED_PERIOD 0.0005 // 0.5 ms
+#define LATENCY_TEST_BUSY_CYCLES 20000      // 200 us
+#define LATENCY_TEST_RUN_CYCLES 10000000    // 100 ms
+
+// Scripted latencies, and the histogram bins they (and the jitter between
+// them) must land in. The last one saturates the last bin.
+static const uint32_t scriptedCycles[] = {8, 3, 0, 1, 100, 5000, UINT32_MAX};
+static const uint32_t expectedLatencyBins[ISRLATENCY_HISTOGRAM_BINS] = {
+    [0] = 1, [1] = 1, [2] = 1, [4] = 1, [7] = 1, [13] = 1, [15] = 1};
+static const uint32_t expectedJitterBins[ISRLATENCY_HISTOGRAM_BINS] = {
+    [1] = 1, [2] = 1, [3] = 1, [7] = 1, [13] = 1, [15] = 1};
+#define SCRIPTED_COUNT (sizeof(scriptedCycles) / sizeof(scriptedCycles[0]))
+
+static volatile uint8_t serviceOrder[PRIORITY_TEST_LINE_COUNT];
+static volatile uint8_t serviceCount;
+
 // Timer 0 callback
 void isr_timer0() {
   leds_write(leds_read() ^ LED_0);
@@ -32,6 +62,173 @@ void isr_timer2() {
   intervalTimer_ackInterrupt(XPAR_AXI_TIMER_2_DEVICE_ID);
 }
 
+// Record that a timer's line was serviced and stop it, so it interrupts only
+// once.
+static void priorityIsr(uint8_t timerNumber, uint8_t irq) {
+  intervalTimer_stop(timerNumber);
+  intervalTimer_ackInterrupt(timerNumber);
+  if (serviceCount < PRIORITY_TEST_LINE_COUNT)
+    serviceOrder[serviceCount] = irq;
+  serviceCount++;
+}
+
+static void priorityIsr1() {
+  priorityIsr(INTERVAL_TIMER_1, INTERVAL_TIMER_1_INTERRUPT_IRQ);
+}
+
+static void priorityIsr2() {
+  priorityIsr(INTERVAL_TIMER_2, INTERVAL_TIMER_2_INTERRUPT_IRQ);
+}
+
+// Busy-wait on the timing-mode timer
+static void waitCycles(uint32_t cycles) {
+  uint32_t start = interrupts_getTimestamp();
+  while (interrupts_getTimestamp() - start < cycles)
+    ;
+}
+
+// Checks interrupts_setPriorityOrder() and the timing mode. With line 2 given
+// priority over line 1 (the reverse of the default), both timers expire while
+// IRQs are masked; once IRQs are unmasked, a single dispatch must service
+// line 2 and then line 1, each exactly once. A line left out of the IAR write
+// would still be pending and be serviced again.
+bool interrupt_test_runPriority() {
+  printf("starting interrupt_test_runPriority()\n");
+  static const uint8_t order[] = {INTERVAL_TIMER_2_INTERRUPT_IRQ,
+                                  INTERVAL_TIMER_1_INTERRUPT_IRQ};
+  interrupts_init();
+  interrupts_setPriorityOrder(order, PRIORITY_TEST_LINE_COUNT);
+  interrupts_enableTiming(PRIORITY_TEST_TIMER); // Also clears the counts.
+  serviceCount = 0;
+
+  interrupts_register(INTERVAL_TIMER_1_INTERRUPT_IRQ, priorityIsr1);
+  interrupts_register(INTERVAL_TIMER_2_INTERRUPT_IRQ, priorityIsr2);
+  intervalTimer_initCountDown(INTERVAL_TIMER_1, PRIORITY_TEST_PERIOD);
+  intervalTimer_initCountDown(INTERVAL_TIMER_2, PRIORITY_TEST_PERIOD);
+  intervalTimer_enableInterrupt(INTERVAL_TIMER_1);
+  intervalTimer_enableInterrupt(INTERVAL_TIMER_2);
+  interrupts_irq_enable(INTERVAL_TIMER_1_INTERRUPT_IRQ);
+  interrupts_irq_enable(INTERVAL_TIMER_2_INTERRUPT_IRQ);
+
+  armInterrupts_disable();
+  intervalTimer_start(INTERVAL_TIMER_1);
+  intervalTimer_start(INTERVAL_TIMER_2);
+  waitCycles(PRIORITY_TEST_WAIT_CYCLES);
+  armInterrupts_enable();
+  waitCycles(PRIORITY_TEST_WAIT_CYCLES);
+
+  interrupts_irq_disable(INTERVAL_TIMER_1_INTERRUPT_IRQ);
+  interrupts_irq_disable(INTERVAL_TIMER_2_INTERRUPT_IRQ);
+  interrupts_disableTiming();
+
+  bool passed = serviceCount == PRIORITY_TEST_LINE_COUNT &&
+                serviceOrder[0] == INTERVAL_TIMER_2_INTERRUPT_IRQ &&
+                serviceOrder[1] == INTERVAL_TIMER_1_INTERRUPT_IRQ;
+  if (!passed)
+    printf("serviced %d lines, expected irq 2 then irq 1\n", serviceCount);
+  for (uint8_t irq = INTERVAL_TIMER_1_INTERRUPT_IRQ;
+       irq <= INTERVAL_TIMER_2_INTERRUPT_IRQ; irq++) {
+    uint32_t count = interrupts_getInvocationCount(irq);
+    if (count != 1 || interrupts_getLineTiming(irq).invocations != 1) {
+      printf("irq %d serviced %lu times, expected once\n", irq,
+             (unsigned long)count);
+      passed = false;
+    }
+  }
+  interrupts_timing_t first =
+      interrupts_getLineTiming(INTERVAL_TIMER_2_INTERRUPT_IRQ);
+  interrupts_timing_t second =
+      interrupts_getLineTiming(INTERVAL_TIMER_1_INTERRUPT_IRQ);
+  if (interrupts_getIsrTiming().invocations != 1 ||
+      (int32_t)(second.lastEntry - first.lastExit) < 0) {
+    printf("irq 1 and irq 2 were not serviced in one dispatch, in order\n");
+    passed = false;
+  }
+  interrupts_printStatistics();
+  printf("exiting interrupt_test_runPriority(): %s\n",
+         passed ? "passed" : "failed");
+  return passed;
+}
+
+static void latencyBusyIsr() {
+  intervalTimer_ackInterrupt(INTERVAL_TIMER_1);
+  waitCycles(LATENCY_TEST_BUSY_CYCLES);
+}
+
+static void latencyMeasuredIsr() {
+  intervalTimer_ackInterrupt(INTERVAL_TIMER_2);
+}
+
+// Checks isrLatency. First, scripted samples must produce the expected
+// min/max, histogram bins and worst case (with an unknown culprit, since
+// timing mode is off). Then line 2 is measured while line 1's callback keeps
+// it waiting: the worst case must be on line 2, about as long as line 1's
+// callback, and blamed on line 1.
+bool interrupt_test_runLatency() {
+  printf("starting interrupt_test_runLatency()\n");
+  bool passed = true;
+  isrLatency_reset();
+  for (uint8_t i = 0; i < SCRIPTED_COUNT; i++)
+    isrLatency_recordSample(LATENCY_TEST_SCRIPTED_IRQ, scriptedCycles[i]);
+  isrLatency_stats_t stats = isrLatency_getStats(LATENCY_TEST_SCRIPTED_IRQ);
+  if (stats.samples != SCRIPTED_COUNT || stats.minCycles != 0 ||
+      stats.maxCycles != UINT32_MAX ||
+      stats.maxJitterCycles != UINT32_MAX - 5000) {
+    printf("scripted samples: wrong count, min, max or max jitter\n");
+    passed = false;
+  }
+  for (uint8_t bin = 0; bin < ISRLATENCY_HISTOGRAM_BINS; bin++) {
+    if (stats.latencyHistogram[bin] != expectedLatencyBins[bin] ||
+        stats.jitterHistogram[bin] != expectedJitterBins[bin]) {
+      printf("scripted samples: wrong count in histogram bin %d\n", bin);
+      passed = false;
+    }
+  }
+  isrLatency_worstCase_t worst = isrLatency_getWorstCase();
+  if (worst.cycles != UINT32_MAX || worst.irq != LATENCY_TEST_SCRIPTED_IRQ ||
+      worst.culprit != ISRLATENCY_UNKNOWN) {
+    printf("scripted samples: wrong worst case\n");
+    passed = false;
+  }
+
+  interrupts_init();
+  interrupts_enableTiming(INTERVAL_TIMER_0);
+  interrupts_register(INTERVAL_TIMER_1_INTERRUPT_IRQ, latencyBusyIsr);
+  interrupts_register(INTERVAL_TIMER_2_INTERRUPT_IRQ, latencyMeasuredIsr);
+  intervalTimer_initCountDown(INTERVAL_TIMER_1, LATENCY_TEST_BUSY_PERIOD);
+  intervalTimer_initCountDown(INTERVAL_TIMER_2, LATENCY_TEST_MEASURED_PERIOD);
+  intervalTimer_enableInterrupt(INTERVAL_TIMER_1);
+  intervalTimer_enableInterrupt(INTERVAL_TIMER_2);
+  interrupts_irq_enable(INTERVAL_TIMER_1_INTERRUPT_IRQ);
+  interrupts_irq_enable(INTERVAL_TIMER_2_INTERRUPT_IRQ);
+  isrLatency_reset();
+  isrLatency_attach(INTERVAL_TIMER_2_INTERRUPT_IRQ, INTERVAL_TIMER_2);
+  intervalTimer_start(INTERVAL_TIMER_1);
+  intervalTimer_start(INTERVAL_TIMER_2);
+  waitCycles(LATENCY_TEST_RUN_CYCLES);
+  interrupts_irq_disable(INTERVAL_TIMER_1_INTERRUPT_IRQ);
+  interrupts_irq_disable(INTERVAL_TIMER_2_INTERRUPT_IRQ);
+  intervalTimer_stop(INTERVAL_TIMER_1);
+  intervalTimer_stop(INTERVAL_TIMER_2);
+  isrLatency_detach(INTERVAL_TIMER_2_INTERRUPT_IRQ);
+  interrupts_disableTiming();
+
+  isrLatency_print();
+  worst = isrLatency_getWorstCase();
+  if (worst.irq != INTERVAL_TIMER_2_INTERRUPT_IRQ ||
+      worst.culprit != INTERVAL_TIMER_1_INTERRUPT_IRQ ||
+      worst.cycles < LATENCY_TEST_BUSY_CYCLES / 2 ||
+      worst.cycles > LATENCY_TEST_BUSY_CYCLES * 2) {
+    printf("expected the worst case on irq 2, about %d cycles, while irq 1 "
+           "was running\n",
+           LATENCY_TEST_BUSY_CYCLES);
+    passed = false;
+  }
+  printf("exiting interrupt_test_runLatency(): %s\n",
+         passed ? "passed" : "failed");
+  return passed;
+}
+
 /*
 This function is a small test application of your interrupt controller.  The
 goal is to use the three AXI Interval Timers to generate interrupts at different
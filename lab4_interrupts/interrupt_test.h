@@ -1,6 +1,19 @@
 #ifndef INTERRUPT_TEST
 #define INTERRUPT_TEST
 
+#include <stdbool.h>
+
+// Checks that interrupts_setPriorityOrder() changes the order in which lines
+// pending together are serviced, that every serviced line is acknowledged, and
+// that timing mode records each callback. Returns true if it passed.
+bool interrupt_test_runPriority();
+
+// Checks the isrLatency statistics with scripted samples, then measures a
+// line held up by another line's long callback and checks that the worst case
+// is blamed on that callback. Prints the isrLatency report. Returns true if
+// it passed.
+bool interrupt_test_runLatency();
+
 /*
 This function is a small test application of your interrupt controller.  The
 goal is to use the three AXI Interval Timers to generate interrupts at different
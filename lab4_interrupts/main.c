@@ -8,5 +8,7 @@
 // Run the interrupt test to test the driver for the AXI Interrupt Controller
 int main() {
   printf("Running the interrupt test\n");
+  interrupt_test_runPriority();
+  // interrupt_test_runLatency(); // ISR latency and jitter report (isrLatency)
   interrupt_test_run();
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "interrupts.h"
 #include "intervalTimer.h"
 #include "touchscreen.h"
+#include "touchscreen_test.h"
 #include "utils.h"
 
 #define PERIOD_S 0.01
@@ -53,7 +54,10 @@ void test_tick() {
       // New button press detected, draw filled circle
       point1 = touchscreen_get_location();
       radius = 1;
-      printf("x: %hu y: %hu\n", point1.x, point1.y);
+      printf("x: %hu y: %hu, touch-to-press latency: %lu ms\n", point1.x,
+             point1.y,
+             (unsigned long)(touchscreen_get_press_latency_ticks() * PERIOD_S *
+                             MS_PER_S));
     }
     break;
   case TEST_TOUCH_PRESSED_ST:
@@ -158,8 +162,12 @@ int main() {
 
   // Initialize drivers
   display_init();
+  bool passed = touchscreen_test_runRapidTap(PERIOD_S);
+  passed = touchscreen_test_runSettle(PERIOD_S) && passed;
+  printf("Touchscreen scripted tests %s\n", passed ? "passed" : "failed");
   interrupts_init();
   touchscreen_init(PERIOD_S);
+  touchscreen_set_adaptive(true);
 
   // Fill screen black
   display_fillScreen(DISPLAY_BLACK);
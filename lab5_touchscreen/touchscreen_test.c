@@ -0,0 +1,189 @@
+#include "touchscreen_test.h"
+#include "touchscreen.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TAP_COUNT 50
+#define TAP_HOLD_TICKS 8    // Long enough to settle at a 10 ms tick
+#define TAP_RELEASE_TICKS 2 // Gap between taps
+#define TAP_PERIOD_TICKS (TAP_HOLD_TICKS + TAP_RELEASE_TICKS)
+#define TAP_PRESSURE 100
+#define TRAILING_TICKS 20 // Let the last tap be released and consumed
+
+// Consumer polling periods to try, in touchscreen ticks
+static const uint8_t consumerPeriods[] = {1, 5, 10, 20};
+#define CONSUMER_PERIOD_COUNT (sizeof(consumerPeriods) / sizeof(uint8_t))
+
+// Settling test script
+#define SETTLE_TOUCH_COUNT 20
+#define SETTLE_HOLD_TICKS 30
+#define SETTLE_RELEASE_TICKS 5
+#define SETTLE_PERIOD_TICKS (SETTLE_HOLD_TICKS + SETTLE_RELEASE_TICKS)
+#define SETTLE_NOISY_TICKS 1 // Ticks of large noise after the finger lands
+#define SETTLE_NOISE 40      // Peak noise while landing, in pixels
+#define SETTLE_JITTER 1      // Peak noise once landed, in pixels
+#define SETTLE_X 160
+#define SETTLE_Y 120
+
+static uint32_t scriptTick;
+static uint32_t noiseState = 1;
+
+// Scripted touch source: TAP_COUNT taps, then nothing
+static bool scriptIsTouched() {
+  return scriptTick < TAP_COUNT * TAP_PERIOD_TICKS &&
+         scriptTick % TAP_PERIOD_TICKS < TAP_HOLD_TICKS;
+}
+
+// Each tap lands at a different position
+static void scriptGetTouchedPoint(int16_t *x, int16_t *y, uint8_t *z) {
+  uint32_t tap = scriptTick / TAP_PERIOD_TICKS;
+  *x = (tap * 37) % DISPLAY_WIDTH;
+  *y = (tap * 53) % DISPLAY_HEIGHT;
+  *z = TAP_PRESSURE;
+}
+
+// Small deterministic pseudo-random noise in [-peak, peak]
+static int16_t noise(int16_t peak) {
+  noiseState = noiseState * 1103515245 + 12345;
+  return (int16_t)((noiseState >> 16) % (2 * peak + 1)) - peak;
+}
+
+// Settling script source: touches that are noisy while landing
+static bool settleIsTouched() {
+  return scriptTick % SETTLE_PERIOD_TICKS < SETTLE_HOLD_TICKS;
+}
+
+static void settleGetTouchedPoint(int16_t *x, int16_t *y, uint8_t *z) {
+  uint32_t tickInTouch = scriptTick % SETTLE_PERIOD_TICKS;
+  int16_t peak =
+      tickInTouch <= SETTLE_NOISY_TICKS ? SETTLE_NOISE : SETTLE_JITTER;
+  *x = SETTLE_X + noise(peak);
+  *y = SETTLE_Y + noise(peak);
+  *z = TAP_PRESSURE;
+}
+
+// Results of one run of the settling script
+typedef struct {
+  uint32_t presses;
+  uint32_t totalLatency; // In ticks
+  uint32_t maxError;     // In pixels
+} settleResult_t;
+
+// Run the settling script in one mode and print latency and position error
+static settleResult_t runSettleScript(double period_seconds, bool adaptive) {
+  settleResult_t result = {0, 0, 0};
+
+  touchscreen_init(period_seconds);
+  touchscreen_set_adaptive(adaptive);
+  for (scriptTick = 0; scriptTick < SETTLE_TOUCH_COUNT * SETTLE_PERIOD_TICKS;
+       scriptTick++) {
+    touchscreen_tick();
+    touchscreen_event_t event;
+    while (touchscreen_pop_event(&event)) {
+      if (event.type != TOUCHSCREEN_EVENT_PRESS)
+        continue;
+      result.presses++;
+      result.totalLatency += touchscreen_get_press_latency_ticks();
+      uint32_t errorX = abs(event.x - SETTLE_X);
+      uint32_t errorY = abs(event.y - SETTLE_Y);
+      if (errorX > result.maxError)
+        result.maxError = errorX;
+      if (errorY > result.maxError)
+        result.maxError = errorY;
+    }
+  }
+  touchscreen_set_adaptive(false);
+
+  if (result.presses == 0) {
+    printf("%8s: no presses reported\n", adaptive ? "adaptive" : "fixed");
+    return result;
+  }
+  printf("%8s: %lu presses, avg latency %.1f ms, max position error %lu px\n",
+         adaptive ? "adaptive" : "fixed", (unsigned long)result.presses,
+         1000.0 * period_seconds * result.totalLatency / result.presses,
+         (unsigned long)result.maxError);
+  return result;
+}
+
+// Run the script once with a consumer polling every consumerPeriod ticks.
+// Returns the number of taps the event queue consumer missed.
+static uint32_t runScript(double period_seconds, uint8_t consumerPeriod) {
+  uint32_t statusTaps = 0;
+  uint32_t eventTaps = 0;
+
+  touchscreen_init(period_seconds);
+  uint32_t scriptLength = TAP_COUNT * TAP_PERIOD_TICKS + TRAILING_TICKS;
+  for (scriptTick = 0; scriptTick < scriptLength; scriptTick++) {
+    touchscreen_tick();
+    if (scriptTick % consumerPeriod != consumerPeriod - 1)
+      continue;
+
+    // Old API consumer
+    if (touchscreen_get_status() == TOUCHSCREEN_RELEASED) {
+      touchscreen_ack_touch();
+      statusTaps++;
+    }
+
+    // Event queue consumer
+    touchscreen_event_t event;
+    while (touchscreen_pop_event(&event))
+      if (event.type == TOUCHSCREEN_EVENT_RELEASE)
+        eventTaps++;
+  }
+
+  printf("%15d  %14lu  %13lu  %14lu\n", consumerPeriod,
+         (unsigned long)(TAP_COUNT - statusTaps),
+         (unsigned long)(TAP_COUNT - eventTaps),
+         (unsigned long)touchscreen_get_dropped_event_count());
+  return TAP_COUNT - eventTaps;
+}
+
+// Scripted rapid-tap test of the touchscreen driver.
+bool touchscreen_test_runRapidTap(double period_seconds) {
+  printf("Rapid tap test: %d taps, %d ticks each\n", TAP_COUNT,
+         TAP_PERIOD_TICKS);
+  printf("consumer period  dropped/status  dropped/event  queue overflow\n");
+
+  bool passed = true;
+  touchscreen_set_source(scriptIsTouched, scriptGetTouchedPoint);
+  for (uint8_t i = 0; i < CONSUMER_PERIOD_COUNT; i++)
+    if (runScript(period_seconds, consumerPeriods[i]) != 0)
+      passed = false;
+  touchscreen_set_source(NULL, NULL);
+
+  touchscreen_init(period_seconds);
+  printf("Rapid tap test %s\n",
+         passed ? "passed" : "failed: the event queue lost taps");
+  return passed;
+}
+
+// Scripted settling test.
+bool touchscreen_test_runSettle(double period_seconds) {
+  printf("Settle test: %d touches, noisy for %d ticks\n", SETTLE_TOUCH_COUNT,
+         SETTLE_NOISY_TICKS);
+  touchscreen_set_source(settleIsTouched, settleGetTouchedPoint);
+  settleResult_t fixed = runSettleScript(period_seconds, false);
+  settleResult_t adaptive = runSettleScript(period_seconds, true);
+  touchscreen_set_source(NULL, NULL);
+
+  touchscreen_init(period_seconds);
+  bool passed = true;
+  if (fixed.presses != SETTLE_TOUCH_COUNT ||
+      adaptive.presses != SETTLE_TOUCH_COUNT) {
+    printf("Settle test failed: expected %d presses in each mode\n",
+           SETTLE_TOUCH_COUNT);
+    passed = false;
+  } else if (adaptive.totalLatency >= fixed.totalLatency) {
+    printf("Settle test failed: adaptive settling is not faster\n");
+    passed = false;
+  }
+  if (fixed.maxError > TOUCHSCREEN_SETTLE_TOLERANCE ||
+      adaptive.maxError > TOUCHSCREEN_SETTLE_TOLERANCE) {
+    printf("Settle test failed: position error over %d px\n",
+           TOUCHSCREEN_SETTLE_TOLERANCE);
+    passed = false;
+  }
+  if (passed)
+    printf("Settle test passed\n");
+  return passed;
+}
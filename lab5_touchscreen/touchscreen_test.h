@@ -0,0 +1,28 @@
+#ifndef TOUCHSCREEN_TEST
+#define TOUCHSCREEN_TEST
+
+#include <stdbool.h>
+
+/*
+Scripted rapid-tap test of the touchscreen driver. The driver's touch source is
+replaced with a script of short taps at different positions, and the driver is
+ticked directly (no interrupts needed). A consumer polls every few ticks, as a
+game tick would, and counts the taps it sees through the old status API
+(touchscreen_get_status() / touchscreen_ack_touch()) and through the event
+queue. A table of dropped taps for several consumer periods is printed.
+Returns true if the event queue consumer saw every tap at every period.
+*/
+bool touchscreen_test_runRapidTap(double period_seconds);
+
+/*
+Scripted settling test. Each scripted touch reports noisy positions for its
+first few ticks and then a steady position with small jitter, like a finger
+landing on the resistive panel. The touch-to-press latency and the position
+error are printed for the fixed 50 ms settle time and for adaptive settling.
+Returns true if every touch was pressed in both modes, adaptive settling was
+faster on average, and no press was off by more than
+TOUCHSCREEN_SETTLE_TOLERANCE pixels.
+*/
+bool touchscreen_test_runSettle(double period_seconds);
+
+#endif /* TOUCHSCREEN_TEST */
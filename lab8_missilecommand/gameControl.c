@@ -134,20 +134,27 @@ void gameControl_tick() {
       missile_init_enemy(&enemy_missiles[i]);
     }
 
-  // If the screen has been touched, check for a player missile.
-  if (touchscreen_get_status() == TOUCHSCREEN_RELEASED) {
-    touchscreen_ack_touch();
+  // Launch a player missile for every touch released since the last tick.
+  // Touches come from the event queue, so taps that land between game ticks
+  // are not lost. The missile goes where the touch settled (its press event),
+  // not where the finger lifted.
+  static int16_t press_x, press_y;
+  touchscreen_event_t event;
+  while (touchscreen_pop_event(&event)) {
+    if (event.type == TOUCHSCREEN_EVENT_PRESS) {
+      press_x = event.x;
+      press_y = event.y;
+    }
+    if (event.type != TOUCHSCREEN_EVENT_RELEASE)
+      continue;
 
     // Check all player missiles
     for (uint16_t i = 0; i < CONFIG_MAX_PLAYER_MISSILES; i++)
-      // If there is a dead missile, reinitialize it with the new screen touch
-      // location
+      // If there is a dead missile, reinitialize it with the touch location
       if (missile_is_dead(&player_missiles[i])) {
-        display_point_t touched_location = touchscreen_get_location();
         num_shot++;
-        missile_init_player(&player_missiles[i], touched_location.x,
-                            touched_location.y);
-        break; // Only relaunch one player missile per tick
+        missile_init_player(&player_missiles[i], press_x, press_y);
+        break;
       }
   }
 
@@ -0,0 +1,184 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "adcCapture.h"
+
+#define MAGIC "ADCT"
+#define MAGIC_LENGTH 4
+#define SAMPLE_MASK 0xFFF
+#define CRC_POLYNOMIAL 0xEDB88320 // IEEE 802.3, bit-reversed.
+#define CRC_INIT 0xFFFFFFFF
+
+// 12-bit values fit in 16 bits, so the ring holds half as many bytes as an
+// isr_AdcValue_t array would. It is in .bss, which on the board is in DDR with
+// hundreds of MB to spare, while the whole heap (_HEAP_SIZE in lscript.ld) is
+// 2 MB and shared with the filter queues.
+static uint16_t ring[ADCCAPTURE_MAX_CAPACITY];
+static uint32_t ringCapacity; // 0 until adcCapture_init().
+static uint32_t ringNext; // Where the next value goes.
+static uint32_t ringCount;
+
+// Empties the ring and limits it to capacity values.
+bool adcCapture_init(uint32_t capacity) {
+  if (capacity == 0 || capacity > ADCCAPTURE_MAX_CAPACITY) {
+    printf("adcCapture_init: %lu values (1 to %lu).\n",
+           (unsigned long)capacity, (unsigned long)ADCCAPTURE_MAX_CAPACITY);
+    ringCapacity = 0;
+    return false;
+  }
+  ringCapacity = capacity;
+  ringNext = 0;
+  ringCount = 0;
+  return true;
+}
+
+// Empties the ring.
+void adcCapture_garbageCollect() {
+  ringCapacity = 0;
+  ringCount = 0;
+}
+
+// Appends count values to the ring, overwriting the oldest when it is full.
+void adcCapture_addSamples(const isr_AdcValue_t values[], uint32_t count) {
+  if (ringCapacity == 0)
+    return;
+  for (uint32_t i = 0; i < count; i++) {
+    ring[ringNext] = values[i] & SAMPLE_MASK;
+    if (++ringNext == ringCapacity)
+      ringNext = 0;
+  }
+  ringCount = ringCount + count > ringCapacity ? ringCapacity
+                                               : ringCount + count;
+}
+
+// Returns the number of values in the ring.
+uint32_t adcCapture_getSampleCount() { return ringCount; }
+
+// Folds one byte into a running CRC-32.
+static uint32_t crcUpdate(uint32_t crc, uint8_t byte) {
+  crc ^= byte;
+  for (uint8_t bit = 0; bit < 8; bit++)
+    crc = (crc >> 1) ^ (CRC_POLYNOMIAL & -(crc & 1));
+  return crc;
+}
+
+static void writeU16(adcCapture_putByte_t putByte, uint16_t value) {
+  putByte(value & 0xFF);
+  putByte(value >> 8);
+}
+
+static void writeU32(adcCapture_putByte_t putByte, uint32_t value) {
+  writeU16(putByte, value & 0xFFFF);
+  writeU16(putByte, value >> 16);
+}
+
+// Writes a packed byte and folds it into the CRC.
+static void writeByte(adcCapture_putByte_t putByte, uint8_t byte,
+                      uint32_t *crc) {
+  putByte(byte);
+  *crc = crcUpdate(*crc, byte);
+}
+
+// Writes the contents of the ring, oldest first, as a trace.
+void adcCapture_writeTrace(adcCapture_putByte_t putByte) {
+  for (uint32_t i = 0; i < MAGIC_LENGTH; i++)
+    putByte(MAGIC[i]);
+  writeU16(putByte, ADCCAPTURE_VERSION);
+  writeU16(putByte, ADCCAPTURE_SAMPLE_BITS);
+  writeU32(putByte, ADCCAPTURE_SAMPLE_RATE_HZ);
+  writeU32(putByte, ringCount);
+  uint32_t crc = CRC_INIT;
+  uint32_t index = ringNext >= ringCount ? ringNext - ringCount
+                                         : ringNext + ringCapacity - ringCount;
+  for (uint32_t i = 0; i < ringCount; i += 2) {
+    uint16_t s0 = ring[index];
+    index = index + 1 == ringCapacity ? 0 : index + 1;
+    writeByte(putByte, s0 & 0xFF, &crc);
+    if (i + 1 == ringCount) {
+      writeByte(putByte, s0 >> 8, &crc);
+      break;
+    }
+    uint16_t s1 = ring[index];
+    index = index + 1 == ringCapacity ? 0 : index + 1;
+    writeByte(putByte, (s0 >> 8) | (s1 & 0xF) << 4, &crc);
+    writeByte(putByte, s1 >> 4, &crc);
+  }
+  writeU32(putByte, ~crc);
+}
+
+// Reads a little-endian field of byteCount bytes. Returns false at EOF.
+static bool readField(FILE *in, uint32_t byteCount, uint32_t *value) {
+  *value = 0;
+  for (uint32_t i = 0; i < byteCount; i++) {
+    int c = fgetc(in);
+    if (c == EOF)
+      return false;
+    *value |= (uint32_t)c << (8 * i);
+  }
+  return true;
+}
+
+// Skips input up to and including the magic. Returns false at EOF.
+static bool findMagic(FILE *in) {
+  uint32_t matched = 0;
+  int c;
+  while (matched < MAGIC_LENGTH && (c = fgetc(in)) != EOF) {
+    if (c == MAGIC[matched])
+      matched++;
+    else
+      matched = c == MAGIC[0] ? 1 : 0;
+  }
+  return matched == MAGIC_LENGTH;
+}
+
+// Reads a trace into a malloc'd array.
+bool adcCapture_readTrace(FILE *in, isr_AdcValue_t **samples,
+                          uint32_t *sampleCount, uint32_t *sampleRateHz) {
+  uint32_t version, bits, count;
+  if (!findMagic(in) || !readField(in, 2, &version) ||
+      !readField(in, 2, &bits) || !readField(in, 4, sampleRateHz) ||
+      !readField(in, 4, &count)) {
+    printf("adcCapture_readTrace: no trace header found.\n");
+    return false;
+  }
+  if (version != ADCCAPTURE_VERSION || bits != ADCCAPTURE_SAMPLE_BITS) {
+    printf("adcCapture_readTrace: unsupported version %lu, %lu bits.\n",
+           (unsigned long)version, (unsigned long)bits);
+    return false;
+  }
+  isr_AdcValue_t *values =
+      (isr_AdcValue_t *)malloc((count ? count : 1) * sizeof(isr_AdcValue_t));
+  if (values == NULL) {
+    printf("adcCapture_readTrace: malloc of %lu values failed.\n",
+           (unsigned long)count);
+    return false;
+  }
+  uint32_t crc = CRC_INIT;
+  uint32_t i = 0;
+  while (i < count) {
+    uint32_t byteCount = i + 1 == count ? 2 : 3;
+    uint32_t packed = 0;
+    if (!readField(in, byteCount, &packed))
+      break;
+    for (uint32_t b = 0; b < byteCount; b++)
+      crc = crcUpdate(crc, (packed >> (8 * b)) & 0xFF);
+    values[i++] = packed & SAMPLE_MASK;
+    if (byteCount == 3)
+      values[i++] = packed >> ADCCAPTURE_SAMPLE_BITS;
+  }
+  uint32_t expectedCrc;
+  if (i < count || !readField(in, 4, &expectedCrc)) {
+    printf("adcCapture_readTrace: trace truncated after %lu of %lu values.\n",
+           (unsigned long)i, (unsigned long)count);
+    free(values);
+    return false;
+  }
+  if (expectedCrc != ~crc) {
+    printf("adcCapture_readTrace: CRC mismatch.\n");
+    free(values);
+    return false;
+  }
+  *samples = values;
+  *sampleCount = count;
+  return true;
+}
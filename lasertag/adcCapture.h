@@ -0,0 +1,63 @@
+#ifndef ADCCAPTURE_H_
+#define ADCCAPTURE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "isr.h" // isr_AdcValue_t
+
+// Records raw ADC values into a RAM ring so that a session can be sent to a
+// PC and replayed offline (tools/adcReplay). When the ring is full the oldest
+// values are overwritten, so it always holds the most recent capacity values.
+//
+// Trace format (all fields little-endian):
+//   offset  size  field
+//   0       4     magic "ADCT"
+//   4       2     format version (ADCCAPTURE_VERSION)
+//   6       2     bits per sample (12)
+//   8       4     sample rate in Hz
+//   12      4     sample count n
+//   16      *     samples packed two per three bytes: s0 bits 0-7, then
+//                 s0 bits 8-11 | s1 bits 0-3 << 4, then s1 bits 4-11. An odd
+//                 count ends with two bytes for the last sample.
+//   ...     4     CRC-32 (IEEE 802.3) of the packed samples
+// The reader skips anything before the magic, so a console log containing a
+// dump can be read directly.
+
+#define ADCCAPTURE_VERSION 1
+#define ADCCAPTURE_SAMPLE_BITS 12
+#define ADCCAPTURE_SAMPLE_RATE_HZ 100000
+// Ten seconds at 100 kHz. The ring is a static array of this many values
+// (2 MB) rather than heap memory, which it would use up on the board.
+#define ADCCAPTURE_MAX_CAPACITY (10 * ADCCAPTURE_SAMPLE_RATE_HZ)
+#define ADCCAPTURE_DEFAULT_CAPACITY ADCCAPTURE_MAX_CAPACITY
+
+// Empties the ring and limits it to capacity values (1 to
+// ADCCAPTURE_MAX_CAPACITY). Returns false if capacity is out of range.
+bool adcCapture_init(uint32_t capacity);
+
+// Empties the ring. Kept for symmetry with adcCapture_init(); the ring is
+// static, so there is nothing to free.
+void adcCapture_garbageCollect();
+
+// Appends count values to the ring, overwriting the oldest when it is full.
+void adcCapture_addSamples(const isr_AdcValue_t values[], uint32_t count);
+
+// Returns the number of values in the ring.
+uint32_t adcCapture_getSampleCount();
+
+// Sends one byte of a trace. It must send it unchanged: on the board that
+// rules out stdout, whose write() turns every '\n' into "\r\n".
+typedef void (*adcCapture_putByte_t)(uint8_t byte);
+
+// Writes the contents of the ring, oldest first, as a trace, one byte at a
+// time with putByte.
+void adcCapture_writeTrace(adcCapture_putByte_t putByte);
+
+// Reads a trace into a malloc'd array (free it when done). Returns false if
+// no trace is found, it is truncated, or the CRC does not match.
+bool adcCapture_readTrace(FILE *in, isr_AdcValue_t **samples,
+                          uint32_t *sampleCount, uint32_t *sampleRateHz);
+
+#endif /* ADCCAPTURE_H_ */
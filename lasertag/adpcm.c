@@ -0,0 +1,73 @@
+#include "adpcm.h"
+
+#define STEP_INDEX_MAX 88
+#define CODE_SIGN 0x8
+#define CODE_MAGNITUDE 0x7
+
+// The standard IMA ADPCM tables.
+static const int16_t stepSizes[STEP_INDEX_MAX + 1] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+static const int8_t stepIndexChanges[CODE_MAGNITUDE + 1] = {-1, -1, -1, -1,
+                                                            2,  4,  6,  8};
+
+// Sets the state that every asset starts from.
+void adpcm_init(adpcm_state_t *state) {
+  state->predictor = 0;
+  state->stepIndex = 0;
+}
+
+// Decodes one 4-bit code and advances the state. The difference is
+// (magnitude + 0.5) * step / 4, computed with shifts as the standard does.
+int16_t adpcm_decode(adpcm_state_t *state, uint8_t code) {
+  int32_t step = stepSizes[state->stepIndex];
+  int32_t difference = step >> 3;
+  if (code & 0x4)
+    difference += step;
+  if (code & 0x2)
+    difference += step >> 1;
+  if (code & 0x1)
+    difference += step >> 2;
+  int32_t predictor =
+      state->predictor + ((code & CODE_SIGN) ? -difference : difference);
+  predictor = predictor > INT16_MAX ? INT16_MAX : predictor;
+  predictor = predictor < INT16_MIN ? INT16_MIN : predictor;
+  state->predictor = predictor;
+  int32_t stepIndex =
+      state->stepIndex + stepIndexChanges[code & CODE_MAGNITUDE];
+  stepIndex = stepIndex < 0 ? 0 : stepIndex;
+  stepIndex = stepIndex > STEP_INDEX_MAX ? STEP_INDEX_MAX : stepIndex;
+  state->stepIndex = stepIndex;
+  return predictor;
+}
+
+// Quantizes the difference from the prediction in steps of a quarter step,
+// then decodes the code so that the state is the decoder's.
+uint8_t adpcm_encode(adpcm_state_t *state, int16_t sample) {
+  int32_t step = stepSizes[state->stepIndex];
+  int32_t difference = sample - state->predictor;
+  uint8_t code = 0;
+  if (difference < 0) {
+    code = CODE_SIGN;
+    difference = -difference;
+  }
+  if (difference >= step) {
+    code |= 0x4;
+    difference -= step;
+  }
+  if (difference >= step >> 1) {
+    code |= 0x2;
+    difference -= step >> 1;
+  }
+  if (difference >= step >> 2)
+    code |= 0x1;
+  adpcm_decode(state, code);
+  return code;
+}
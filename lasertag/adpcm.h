@@ -0,0 +1,45 @@
+#ifndef ADPCM_H_
+#define ADPCM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// IMA ADPCM: each 16-bit sample is coded as a 4-bit step from a prediction,
+// with a step size that adapts to the signal, for 4:1 compression. The
+// encoder runs the decoder alongside itself, so both stay in step. Sound
+// assets made with "wav2c -a" store two samples per byte, the first in the
+// low nibble, and start from the state adpcm_init() sets.
+
+// The encoder and decoder state.
+typedef struct {
+  int16_t predictor; // The last decoded sample.
+  uint8_t stepIndex; // Into the step-size table, 0 to 88.
+} adpcm_state_t;
+
+// Sets the state that every asset starts from.
+void adpcm_init(adpcm_state_t *state);
+
+// Returns the 4-bit code that best steps from the prediction to sample, and
+// advances the state as the decoder will.
+uint8_t adpcm_encode(adpcm_state_t *state, int16_t sample);
+
+// Decodes one 4-bit code and advances the state.
+int16_t adpcm_decode(adpcm_state_t *state, uint8_t code);
+
+// Returns the 4-bit code of sample index from an asset.
+static inline uint8_t adpcm_getCode(const uint8_t data[], uint32_t index) {
+  uint8_t byte = data[index >> 1];
+  return (index & 1) ? byte >> 4 : byte & 0xF;
+}
+
+/*******************************************************
+ ****************** Test Routines **********************
+ ******************************************************/
+
+// Encodes a sound asset, checks that decoding gives back the original to
+// within ADPCM's quantization noise, and prints the decode time per sample,
+// measured on clockTimerNumber. Returns true if the signal-to-noise ratio is
+// good enough.
+bool adpcm_runTest(uint32_t clockTimerNumber);
+
+#endif /* ADPCM_H_ */
@@ -0,0 +1,66 @@
+#include <math.h>
+#include <stdio.h>
+
+#include "adpcm.h"
+#include "intervalTimer.h"
+#include "sounds/ouch48k.wav.adpcm.h"
+
+#define TEST_SAMPLE_RATE_HZ 48000
+#define TEST_SAMPLES TEST_SAMPLE_RATE_HZ // One second.
+#define TEST_TONE_1_HZ 440.0
+#define TEST_TONE_2_HZ 3000.0
+#define TEST_TONE_AMPLITUDE (INT16_MAX / 4)
+#define TEST_MIN_SNR_DB 20.0
+#define NANOSECONDS_PER_SECOND 1e9
+// The interval timers run at 100 MHz.
+#define NANOSECONDS_PER_TIMER_CYCLE 10.0
+
+static uint8_t testData[(TEST_SAMPLES + 1) / 2];
+
+// The test signal: two tones at -12 dBFS each.
+static int16_t adpcm_testSample(uint32_t i) {
+  double t = (double)i / TEST_SAMPLE_RATE_HZ;
+  return TEST_TONE_AMPLITUDE * (sin(2.0 * M_PI * TEST_TONE_1_HZ * t) +
+                                sin(2.0 * M_PI * TEST_TONE_2_HZ * t));
+}
+
+// Encodes two tones, decodes them and compares, then times decoding ouch48k.
+bool adpcm_runTest(uint32_t clockTimerNumber) {
+  printf("starting adpcm_runTest()\n");
+  adpcm_state_t state;
+  adpcm_init(&state);
+  for (uint32_t i = 0; i < TEST_SAMPLES; i++) {
+    uint8_t code = adpcm_encode(&state, adpcm_testSample(i));
+    testData[i >> 1] = (i & 1) ? testData[i >> 1] | code << 4 : code;
+  }
+  adpcm_init(&state);
+  double signal = 0.0;
+  double noise = 0.0;
+  for (uint32_t i = 0; i < TEST_SAMPLES; i++) {
+    int32_t original = adpcm_testSample(i);
+    int32_t decoded = adpcm_decode(&state, adpcm_getCode(testData, i));
+    int32_t error = decoded - original;
+    signal += (double)original * original;
+    noise += (double)error * error;
+  }
+  double snr = noise > 0.0 ? 10.0 * log10(signal / noise) : INFINITY;
+  bool success = snr >= TEST_MIN_SNR_DB;
+  printf("two tones: SNR %.1f dB (at least %.1f dB).\n", snr,
+         TEST_MIN_SNR_DB);
+
+  // The sum keeps the decoding from being optimized away.
+  volatile int32_t sum = 0;
+  adpcm_init(&state);
+  intervalTimer_initCountUp(clockTimerNumber);
+  intervalTimer_start(clockTimerNumber);
+  for (uint32_t i = 0; i < OUCH48K_WAV_ADPCM_NUMBER_OF_SAMPLES; i++)
+    sum += adpcm_decode(&state, adpcm_getCode(ouch48k_wav_adpcm, i));
+  intervalTimer_stop(clockTimerNumber);
+  double nanoseconds =
+      intervalTimer_getTotalDurationInSeconds(clockTimerNumber) /
+      OUCH48K_WAV_ADPCM_NUMBER_OF_SAMPLES * NANOSECONDS_PER_SECOND;
+  printf("ouch48k: %.1f ns (%.1f timer cycles) to decode a sample.\n",
+         nanoseconds, nanoseconds / NANOSECONDS_PER_TIMER_CYCLE);
+  printf("adpcm_runTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
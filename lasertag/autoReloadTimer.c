@@ -0,0 +1,37 @@
+#include "autoReloadTimer.h"
+#include "timerWheel.h"
+#include "trigger.h"
+
+static timerWheel_timer_t timer;
+static volatile bool enabled;
+
+// Timer wheel callback: the reload delay is over, refill the gun.
+static void expired(void *arg) {
+  trigger_setRemainingShotCount(AUTO_RELOAD_SHOT_VALUE);
+}
+
+// Need to init things.
+void autoReloadTimer_init() {
+  timerWheel_cancel(&timer);
+  enabled = true;
+}
+
+// Standard tick function. The delay itself is counted by the timer wheel; the
+// tick only watches for the shot count reaching zero, which is a single compare
+// while the gun has shots left.
+void autoReloadTimer_tick() {
+  if (enabled && !timerWheel_isActive(&timer) &&
+      trigger_getRemainingShotCount() == 0)
+    autoReloadTimer_start();
+}
+
+// Calling this starts the timer.
+void autoReloadTimer_start() {
+  timerWheel_start(&timer, AUTO_RELOAD_EXPIRE_VALUE, 0, expired, NULL);
+}
+
+// Returns true if the timer is currently running.
+bool autoReloadTimer_running() { return timerWheel_isActive(&timer); }
+
+// Disables the autoReloadTimer and re-initializes it.
+void autoReloadTimer_cancel() { autoReloadTimer_init(); }
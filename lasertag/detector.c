@@ -0,0 +1,763 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "detector.h"
+#include "filter.h"
+#include "hitLedTimer.h"
+#include "isr.h"
+#include "intervalTimer.h"
+#include "lockoutTimer.h"
+#include "slidingDft.h"
+#include "timerWheel.h"
+
+// 12-bit ADC values are centered on 2048.
+#define ADC_MIDSCALE 2048.0
+
+// The largest power must be this many times the median power to be a hit.
+static const double fudgeFactors[] = {5.0,   10.0,  20.0,   50.0,
+                                      100.0, 500.0, 1000.0, 5000.0};
+#define FUDGE_FACTOR_COUNT (sizeof(fudgeFactors) / sizeof(fudgeFactors[0]))
+#define DEFAULT_FUDGE_FACTOR_INDEX 3
+
+// Indices of the two middle values of the sorted power values.
+#define MEDIAN_LOW_INDEX ((FILTER_FREQUENCY_COUNT - 1) / 2)
+#define MEDIAN_HIGH_INDEX (FILTER_FREQUENCY_COUNT / 2)
+
+// One detector: where its ADC values come from, its filter and sliding-DFT
+// state, and its hit bookkeeping.
+struct detector {
+  uint8_t adcChannel; // isr.h channel, 0 for the ADC buffer.
+  filter_state_t *filterState;
+  slidingDft_state_t *slidingDftState;
+  detector_backend_t backend;
+  bool ignoredFrequency[FILTER_FREQUENCY_COUNT];
+  bool ignoreAllHitsFlag;
+  bool hitDetectedFlag;
+  uint16_t lastHitFrequencyNumber;
+  detector_hitCount_t hitCounts[FILTER_FREQUENCY_COUNT];
+  uint32_t fudgeFactorIndex;
+  // The default detector locks out with lockoutTimer and lights the hit LED.
+  // Channel detectors only lock themselves out, so that each reports a shot
+  // once; what a hit means for the player is left to the caller.
+  bool channelLockout;
+  timerWheel_timer_t lockout;
+};
+
+// The detector the functions without a detector_t argument use. It shares the
+// default filter and sliding-DFT states, which detector_initBackend() fills in.
+static detector_t defaultDetector = {.fudgeFactorIndex =
+                                         DEFAULT_FUDGE_FACTOR_INDEX};
+
+// Resets d and its filter state for the backend.
+void detectorChannel_initBackend(detector_t *d, bool ignoredFrequencies[],
+                                 detector_backend_t backend) {
+  d->backend = backend;
+  filterState_init(d->filterState);
+  if (backend == DETECTOR_BACKEND_SLIDING_DFT)
+    slidingDftState_init(d->slidingDftState);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    d->ignoredFrequency[i] = ignoredFrequencies[i];
+    d->hitCounts[i] = 0;
+  }
+  d->ignoreAllHitsFlag = false;
+  d->hitDetectedFlag = false;
+  d->lastHitFrequencyNumber = 0;
+  if (d->channelLockout)
+    timerWheel_cancel(&d->lockout);
+}
+
+// Allocates a detector for an ADC channel with its own filter state.
+detector_t *detector_createChannel(uint8_t adcChannel,
+                                   bool ignoredFrequencies[],
+                                   detector_backend_t backend) {
+  detector_t *detector = (detector_t *)calloc(1, sizeof(detector_t));
+  filter_state_t *filterState = filter_createState();
+  slidingDft_state_t *slidingDftState = slidingDft_createState();
+  if (detector == NULL || filterState == NULL || slidingDftState == NULL) {
+    printf("detector_createChannel: out of memory for channel %u.\n",
+           adcChannel);
+    free(detector);
+    filter_destroyState(filterState);
+    slidingDft_destroyState(slidingDftState);
+    return NULL;
+  }
+  // The states are already initialized, and calloc() cleared the rest.
+  detector->adcChannel = adcChannel;
+  detector->filterState = filterState;
+  detector->slidingDftState = slidingDftState;
+  detector->backend = backend;
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    detector->ignoredFrequency[i] = ignoredFrequencies[i];
+  detector->fudgeFactorIndex = DEFAULT_FUDGE_FACTOR_INDEX;
+  detector->channelLockout = true;
+  return detector;
+}
+
+// Frees a detector from detector_createChannel() and its states.
+void detector_destroyChannel(detector_t *d) {
+  if (d == NULL)
+    return;
+  if (d->channelLockout)
+    timerWheel_cancel(&d->lockout);
+  filter_destroyState(d->filterState);
+  slidingDft_destroyState(d->slidingDftState);
+  free(d);
+}
+
+// Runs one scaled ADC value through the decimating FIR filter. When that
+// completes a decimated output, updates the band power at every frequency
+// with d's backend and returns true.
+static bool detector_runFilters(detector_t *d, double x) {
+  if (!filterState_addNewInputDecimated(d->filterState, x))
+    return false;
+  if (d->backend == DETECTOR_BACKEND_SLIDING_DFT) {
+    queue_t *yQueue = filterState_getYQueue(d->filterState);
+    slidingDftState_addNewInput(
+        d->slidingDftState,
+        queue_readElementAtUnchecked(yQueue, queue_elementCount(yQueue) - 1));
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+      slidingDftState_computePower(d->slidingDftState, i);
+  } else {
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      filterState_iirFilter(d->filterState, i);
+      filterState_computePower(d->filterState, i, false, false);
+    }
+  }
+  return true;
+}
+
+// Copies the band power values from d's backend.
+static void detector_getPowerValues(detector_t *d, double powerValues[]) {
+  if (d->backend == DETECTOR_BACKEND_SLIDING_DFT)
+    slidingDftState_getCurrentPowerValues(d->slidingDftState, powerValues);
+  else
+    filterState_getCurrentPowerValues(d->filterState, powerValues);
+}
+
+// Compare-exchange for the selection network: v[i] gets the smaller value and
+// v[j] the larger. Written as selects so the compiler can use conditional
+// moves instead of branches.
+static inline void compareSwap(double v[], uint16_t i, uint16_t j) {
+  double a = v[i];
+  double b = v[j];
+  v[i] = a < b ? a : b;
+  v[j] = a < b ? b : a;
+}
+
+// Half compare-exchanges, for when only one output is used later.
+static inline void keepMin(double v[], uint16_t i, uint16_t j) {
+  v[i] = v[i] < v[j] ? v[i] : v[j];
+}
+static inline void keepMax(double v[], uint16_t i, uint16_t j) {
+  v[j] = v[i] < v[j] ? v[j] : v[i];
+}
+
+// Returns the k-th smallest (from 0) of values[0..count-1] and reorders
+// values[] so that everything before index k is no larger. Quickselect with a
+// middle pivot: O(count) on average.
+static double detector_quickselect(double values[], uint16_t count,
+                                   uint16_t k) {
+  uint16_t left = 0;
+  uint16_t right = count - 1;
+  while (left < right) {
+    uint16_t middle = left + (right - left) / 2;
+    double pivot = values[middle];
+    values[middle] = values[right];
+    values[right] = pivot;
+    uint16_t store = left;
+    for (uint16_t i = left; i < right; i++) {
+      if (values[i] < pivot) {
+        double value = values[i];
+        values[i] = values[store];
+        values[store++] = value;
+      }
+    }
+    values[right] = values[store];
+    values[store] = pivot;
+    if (k == store)
+      break;
+    if (k < store)
+      right = store - 1;
+    else
+      left = store + 1;
+  }
+  return values[k];
+}
+
+// Median of any number of values with detector_quickselect(), which reorders
+// a copy in v[], a scratch buffer of at least count values. For an even count
+// the lower middle value is the largest of those left of the upper one.
+static double detector_medianQuickselect(const double values[], double v[],
+                                         uint16_t count) {
+  for (uint16_t i = 0; i < count; i++)
+    v[i] = values[i];
+  double upper = detector_quickselect(v, count, count / 2);
+  if (count % 2)
+    return upper;
+  double lower = v[0];
+  for (uint16_t i = 1; i < count / 2; i++)
+    lower = v[i] > lower ? v[i] : lower;
+  return (lower + upper) / 2.0;
+}
+
+#if FILTER_FREQUENCY_COUNT == 10
+// Median of ten values from Waksman's 29-comparator sorting network, keeping
+// only what reaches the two middle outputs: 21 compare-exchanges and 8 halves,
+// in a fixed order with no data-dependent branches.
+static double detector_medianNetwork(const double values[]) {
+  double v[FILTER_FREQUENCY_COUNT];
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    v[i] = values[i];
+  compareSwap(v, 4, 9);
+  compareSwap(v, 3, 8);
+  compareSwap(v, 2, 7);
+  compareSwap(v, 1, 6);
+  compareSwap(v, 0, 5);
+  compareSwap(v, 1, 4);
+  compareSwap(v, 6, 9);
+  compareSwap(v, 0, 3);
+  compareSwap(v, 5, 8);
+  compareSwap(v, 0, 2);
+  compareSwap(v, 3, 6);
+  compareSwap(v, 7, 9);
+  keepMax(v, 0, 1);
+  compareSwap(v, 2, 4);
+  compareSwap(v, 5, 7);
+  keepMin(v, 8, 9);
+  compareSwap(v, 1, 2);
+  compareSwap(v, 4, 6);
+  compareSwap(v, 7, 8);
+  compareSwap(v, 3, 5);
+  compareSwap(v, 2, 5);
+  keepMin(v, 6, 8);
+  keepMax(v, 1, 3);
+  compareSwap(v, 4, 7);
+  keepMax(v, 2, 3);
+  keepMin(v, 6, 7);
+  keepMax(v, 3, 4);
+  keepMin(v, 5, 6);
+  compareSwap(v, 4, 5);
+  return (v[MEDIAN_LOW_INDEX] + v[MEDIAN_HIGH_INDEX]) / 2.0;
+}
+#endif
+
+// Median of the FILTER_FREQUENCY_COUNT power values.
+static double detector_median(const double powerValues[]) {
+#if FILTER_FREQUENCY_COUNT == 10
+  return detector_medianNetwork(powerValues);
+#else
+  double v[FILTER_FREQUENCY_COUNT];
+  return detector_medianQuickselect(powerValues, v, FILTER_FREQUENCY_COUNT);
+#endif
+}
+
+// Hit detection: the frequency with the largest power is a hit if its power is
+// more than the median power times the fudge factor and it is not ignored.
+// Sets *frequencyNumber to the frequency with the largest power.
+static bool detector_checkForHit(detector_t *d, const double powerValues[],
+                                 uint16_t *frequencyNumber) {
+  uint16_t maxIndex = 0;
+  for (uint16_t i = 1; i < FILTER_FREQUENCY_COUNT; i++)
+    maxIndex = powerValues[i] > powerValues[maxIndex] ? i : maxIndex;
+  double median = detector_median(powerValues);
+  *frequencyNumber = maxIndex;
+  return !d->ignoredFrequency[maxIndex] &&
+         powerValues[maxIndex] > median * fudgeFactors[d->fudgeFactorIndex];
+}
+
+// Runs hit detection on the power values for one decimated output, unless
+// hits are being ignored or the lockout timer is running, and records a hit.
+static void detector_runHitDetection(detector_t *d,
+                                     const double powerValues[]) {
+  uint16_t frequencyNumber;
+  bool lockedOut = d->channelLockout ? timerWheel_isActive(&d->lockout)
+                                     : lockoutTimer_running();
+  if (d->ignoreAllHitsFlag || lockedOut ||
+      !detector_checkForHit(d, powerValues, &frequencyNumber))
+    return;
+  if (d->channelLockout) {
+    timerWheel_start(&d->lockout, LOCKOUT_TIMER_EXPIRE_VALUE, 0, NULL, NULL);
+  } else {
+    lockoutTimer_start();
+    hitLedTimer_start();
+  }
+  d->hitCounts[frequencyNumber]++;
+  d->lastHitFrequencyNumber = frequencyNumber;
+  d->hitDetectedFlag = true;
+}
+
+// Runs one ADC value through the filters, and hit detection if it completed a
+// decimated output.
+static void detector_processSample(detector_t *d, isr_AdcValue_t adcValue) {
+  if (!detector_runFilters(d, detector_getScaledAdcValue(adcValue)))
+    return;
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  detector_getPowerValues(d, powerValues);
+  detector_runHitDetection(d, powerValues);
+}
+
+// Runs the entire detector over the values waiting in d's ADC channel.
+void detectorChannel_run(detector_t *d) {
+  uint32_t elementCount = isr_adcChannelElementCount(d->adcChannel);
+  for (uint32_t i = 0; i < elementCount; i++) {
+    isr_AdcValue_t value;
+    isr_removeManyFromAdcChannel(d->adcChannel, &value, 1);
+    detector_processSample(d, value);
+  }
+}
+
+// Block buffers: ADC values, scaled inputs, the decimated FIR outputs they
+// complete, and the band powers after each of those.
+static isr_AdcValue_t adcBlock[DETECTOR_BLOCK_SIZE];
+static double inputBlock[DETECTOR_BLOCK_SIZE];
+#define FIR_BLOCK_SIZE (DETECTOR_BLOCK_SIZE / FILTER_FIR_DECIMATION_FACTOR + 1)
+static double firBlock[FIR_BLOCK_SIZE];
+static double powerBlock[FIR_BLOCK_SIZE][FILTER_FREQUENCY_COUNT];
+
+// Runs count ADC values through the detector one stage at a time.
+static void detector_processAdcBlock(detector_t *d,
+                                     const isr_AdcValue_t adcValues[],
+                                     uint32_t count) {
+#ifdef FILTER_IIR_DIRECT_FORM
+  // The direct form reads its input from yQueue, one output at a time.
+  for (uint32_t i = 0; i < count; i++)
+    detector_processSample(d, adcValues[i]);
+#else
+  for (uint32_t i = 0; i < count; i++)
+    inputBlock[i] = detector_getScaledAdcValue(adcValues[i]);
+  uint32_t firCount =
+      filterState_addNewInputBlock(d->filterState, inputBlock, count, firBlock);
+  if (d->backend == DETECTOR_BACKEND_SLIDING_DFT) {
+    slidingDftState_addNewInputBlock(d->slidingDftState, firBlock, firCount,
+                                     powerBlock);
+  } else {
+    for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+      filterState_iirFilterBlock(d->filterState, f, firBlock, firCount,
+                                 powerBlock);
+  }
+  for (uint32_t n = 0; n < firCount; n++)
+    detector_runHitDetection(d, powerBlock[n]);
+#endif
+}
+
+// Drains d's ADC channel in blocks.
+uint32_t detectorChannel_processBlock(detector_t *d) {
+  uint32_t remaining = isr_adcChannelElementCount(d->adcChannel);
+  uint32_t processed = 0;
+  while (processed < remaining) {
+    uint32_t count = remaining - processed;
+    if (count > DETECTOR_BLOCK_SIZE)
+      count = DETECTOR_BLOCK_SIZE;
+    count = isr_removeManyFromAdcChannel(d->adcChannel, adcBlock, count);
+    if (count == 0)
+      break;
+    detector_processAdcBlock(d, adcBlock, count);
+    processed += count;
+  }
+  return processed;
+}
+
+// Returns true if a hit was detected.
+bool detectorChannel_hitDetected(detector_t *d) { return d->hitDetectedFlag; }
+
+// Returns the frequency number that caused the hit.
+uint16_t detectorChannel_getFrequencyNumberOfLastHit(detector_t *d) {
+  return d->lastHitFrequencyNumber;
+}
+
+// Clear the detected hit once you have accounted for it.
+void detectorChannel_clearHit(detector_t *d) { d->hitDetectedFlag = false; }
+
+// Ignore all hits.
+void detectorChannel_ignoreAllHits(detector_t *d, bool flagValue) {
+  d->ignoreAllHitsFlag = flagValue;
+}
+
+// Get the current hit counts.
+void detectorChannel_getHitCounts(detector_t *d,
+                                  detector_hitCount_t hitArray[]) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    hitArray[i] = d->hitCounts[i];
+}
+
+// Allows the fudge-factor index to be set externally from the detector.
+void detectorChannel_setFudgeFactorIndex(detector_t *d, uint32_t factor) {
+  if (factor >= FUDGE_FACTOR_COUNT) {
+    printf("detector_setFudgeFactorIndex: index %lu out of range (%lu).\n",
+           (unsigned long)factor, (unsigned long)FUDGE_FACTOR_COUNT);
+    return;
+  }
+  d->fudgeFactorIndex = factor;
+}
+
+// The same functions on the default detector.
+
+// Always have to init things. Uses the IIR backend.
+void detector_init(bool ignoredFrequencies[]) {
+  detector_initBackend(ignoredFrequencies, DETECTOR_BACKEND_IIR);
+}
+
+void detector_initBackend(bool ignoredFrequencies[],
+                          detector_backend_t backend) {
+  defaultDetector.filterState = filter_getDefaultState();
+  defaultDetector.slidingDftState = slidingDft_getDefaultState();
+  detectorChannel_initBackend(&defaultDetector, ignoredFrequencies, backend);
+}
+
+// The ADC buffer is a single-producer/single-consumer ring, so values can be
+// removed without disabling interrupts whether or not they are enabled.
+void detector(bool interruptsCurrentlyEnabled) {
+  (void)interruptsCurrentlyEnabled;
+  detectorChannel_run(&defaultDetector);
+}
+
+uint32_t detector_processBlock() {
+  return detectorChannel_processBlock(&defaultDetector);
+}
+
+bool detector_hitDetected() {
+  return detectorChannel_hitDetected(&defaultDetector);
+}
+
+uint16_t detector_getFrequencyNumberOfLastHit() {
+  return detectorChannel_getFrequencyNumberOfLastHit(&defaultDetector);
+}
+
+void detector_clearHit() { detectorChannel_clearHit(&defaultDetector); }
+
+void detector_ignoreAllHits(bool flagValue) {
+  detectorChannel_ignoreAllHits(&defaultDetector, flagValue);
+}
+
+void detector_getHitCounts(detector_hitCount_t hitArray[]) {
+  detectorChannel_getHitCounts(&defaultDetector, hitArray);
+}
+
+void detector_setFudgeFactorIndex(uint32_t factor) {
+  detectorChannel_setFudgeFactorIndex(&defaultDetector, factor);
+}
+
+// Scales a 12-bit ADC value to [-1.0, 1.0).
+double detector_getScaledAdcValue(isr_AdcValue_t adcValue) {
+  return ((double)adcValue - ADC_MIDSCALE) / ADC_MIDSCALE;
+}
+
+/*******************************************************
+ ****************** Test Routines **********************
+ ******************************************************/
+
+// One power set with a clear peak and one without.
+static const double testHitPowerValues[FILTER_FREQUENCY_COUNT] = {
+    150, 20, 40, 10, 15, 30, 35, 15, 25, 80};
+#define TEST_HIT_FREQUENCY 0
+static const double testNoHitPowerValues[FILTER_FREQUENCY_COUNT] = {
+    150, 20, 40, 100, 15, 30, 35, 15, 25, 80};
+#define TEST_FUDGE_FACTOR_INDEX 0
+
+// Runs hit detection on a set of power values that should be a hit and one
+// that should not, with the same fudge factor.
+void detector_runTest() {
+  printf("starting detector_runTest()\n");
+  bool ignoreNone[FILTER_FREQUENCY_COUNT] = {false};
+  detector_init(ignoreNone);
+  uint32_t savedFudgeFactorIndex = defaultDetector.fudgeFactorIndex;
+  detector_setFudgeFactorIndex(TEST_FUDGE_FACTOR_INDEX);
+  bool success = true;
+  uint16_t frequencyNumber;
+  if (!detector_checkForHit(&defaultDetector, testHitPowerValues,
+                            &frequencyNumber) ||
+      frequencyNumber != TEST_HIT_FREQUENCY) {
+    printf("detector_runTest: missed the hit on frequency %d.\n",
+           TEST_HIT_FREQUENCY);
+    success = false;
+  }
+  if (detector_checkForHit(&defaultDetector, testNoHitPowerValues,
+                           &frequencyNumber)) {
+    printf("detector_runTest: detected a hit on frequency %d that is not "
+           "there.\n",
+           frequencyNumber);
+    success = false;
+  }
+  defaultDetector.fudgeFactorIndex = savedFudgeFactorIndex;
+  printf("detector_runTest %s.\n", success ? "passed" : "failed");
+}
+
+// Synthetic trace for the backend test: for each frequency, noise to fill the
+// power windows, a gap of noise that must not be a hit, then a shot (a
+// square-wave pulse of one pulse width plus noise). All values are in ADC
+// counts.
+#define TEST_SHOT_LENGTH                                                       \
+  (FILTER_INPUT_PULSE_WIDTH * FILTER_FIR_DECIMATION_FACTOR)
+#define TEST_WARMUP_LENGTH TEST_SHOT_LENGTH
+#define TEST_GAP_LENGTH TEST_SHOT_LENGTH
+#define TEST_SHOT_START (TEST_WARMUP_LENGTH + TEST_GAP_LENGTH)
+#define TEST_SEGMENT_LENGTH (TEST_SHOT_START + TEST_SHOT_LENGTH)
+#define TEST_SHOT_AMPLITUDE 300
+#define TEST_NOISE_AMPLITUDE 100
+#define TEST_RANDOM_SEED 330
+#define TEST_BENCHMARK_TIMER INTERVAL_TIMER_0
+#define TEST_BACKEND_COUNT 2
+#define TEST_NO_HIT (-1)
+static const char *backendNames[TEST_BACKEND_COUNT] = {"IIR bank",
+                                                       "sliding DFT"};
+
+// Fills trace[] with the gap and shot for frequencyNumber.
+static void detector_makeTestSegment(isr_AdcValue_t trace[],
+                                     uint16_t frequencyNumber) {
+  uint16_t period = filter_frequencyTickTable[frequencyNumber];
+  for (uint32_t i = 0; i < TEST_SEGMENT_LENGTH; i++) {
+    int32_t value = ADC_MIDSCALE + rand() % (2 * TEST_NOISE_AMPLITUDE + 1) -
+                    TEST_NOISE_AMPLITUDE;
+    if (i >= TEST_SHOT_START)
+      value += (i % period) < period / 2 ? -TEST_SHOT_AMPLITUDE
+                                         : TEST_SHOT_AMPLITUDE;
+    trace[i] = value;
+  }
+}
+
+// Runs count trace values through the default detector and returns the
+// frequency of the first hit decision (ignoring the lockout), or TEST_NO_HIT.
+static int32_t detector_runTestTrace(const isr_AdcValue_t trace[],
+                                     uint32_t count) {
+  int32_t firstHit = TEST_NO_HIT;
+  for (uint32_t i = 0; i < count; i++) {
+    if (!detector_runFilters(&defaultDetector,
+                             detector_getScaledAdcValue(trace[i])) ||
+        firstHit != TEST_NO_HIT)
+      continue;
+    double powerValues[FILTER_FREQUENCY_COUNT];
+    uint16_t frequencyNumber;
+    detector_getPowerValues(&defaultDetector, powerValues);
+    if (detector_checkForHit(&defaultDetector, powerValues, &frequencyNumber))
+      firstHit = frequencyNumber;
+  }
+  return firstHit;
+}
+
+// Runs the same traces through both backends and compares the hits, then
+// times each backend.
+bool detector_runBackendTest() {
+  printf("starting detector_runBackendTest()\n");
+  isr_AdcValue_t *trace =
+      (isr_AdcValue_t *)malloc(TEST_SEGMENT_LENGTH * sizeof(isr_AdcValue_t));
+  if (trace == NULL) {
+    printf("detector_runBackendTest: malloc failed.\n");
+    return false;
+  }
+  bool ignoreNone[FILTER_FREQUENCY_COUNT] = {false};
+  bool success = true;
+  double seconds[TEST_BACKEND_COUNT] = {0.0};
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    int32_t gapHit[TEST_BACKEND_COUNT];
+    int32_t shotHit[TEST_BACKEND_COUNT];
+    for (uint16_t backend = 0; backend < TEST_BACKEND_COUNT; backend++) {
+      // Same trace for both backends.
+      srand(TEST_RANDOM_SEED + f);
+      detector_makeTestSegment(trace, f);
+      detector_initBackend(ignoreNone, (detector_backend_t)backend);
+      intervalTimer_initCountUp(TEST_BENCHMARK_TIMER);
+      intervalTimer_start(TEST_BENCHMARK_TIMER);
+      detector_runTestTrace(trace, TEST_WARMUP_LENGTH);
+      gapHit[backend] =
+          detector_runTestTrace(&trace[TEST_WARMUP_LENGTH], TEST_GAP_LENGTH);
+      shotHit[backend] =
+          detector_runTestTrace(&trace[TEST_SHOT_START], TEST_SHOT_LENGTH);
+      intervalTimer_stop(TEST_BENCHMARK_TIMER);
+      seconds[backend] +=
+          intervalTimer_getTotalDurationInSeconds(TEST_BENCHMARK_TIMER);
+    }
+    if (gapHit[0] != gapHit[1] || shotHit[0] != shotHit[1]) {
+      printf("detector_runBackendTest: frequency %d: IIR bank hit %d/%d, "
+             "sliding DFT hit %d/%d (gap/shot).\n",
+             f, gapHit[0], shotHit[0], gapHit[1], shotHit[1]);
+      success = false;
+    } else if (gapHit[0] != TEST_NO_HIT || shotHit[0] != f) {
+      printf("detector_runBackendTest: frequency %d: both backends hit %d/%d "
+             "(gap/shot).\n",
+             f, gapHit[0], shotHit[0]);
+      success = false;
+    }
+  }
+  free(trace);
+  for (uint16_t backend = 0; backend < TEST_BACKEND_COUNT; backend++)
+    printf("%s: %.0lf detector inputs/s\n", backendNames[backend],
+           FILTER_FREQUENCY_COUNT * TEST_SEGMENT_LENGTH / seconds[backend]);
+  detector_init(ignoreNone);
+  printf("detector_runBackendTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
+
+#define TEST_MODE_COUNT 2 // detector() and detector_processBlock().
+#define TEST_CHUNK_SIZE (ISR_ADC_BUFFER_SIZE / 2)
+
+// Pushes count trace values through the ADC buffer, draining it with
+// detector() (mode 0) or detector_processBlock(), and returns the time spent
+// draining.
+static double detector_feedTestTrace(const isr_AdcValue_t trace[],
+                                     uint32_t count, uint16_t mode) {
+  double seconds = 0.0;
+  for (uint32_t i = 0; i < count; i += TEST_CHUNK_SIZE) {
+    for (uint32_t j = i; j < i + TEST_CHUNK_SIZE && j < count; j++)
+      isr_addDataToAdcBuffer(trace[j]);
+    intervalTimer_initCountUp(TEST_BENCHMARK_TIMER);
+    intervalTimer_start(TEST_BENCHMARK_TIMER);
+    if (mode == 0)
+      detector(false);
+    else
+      detector_processBlock();
+    intervalTimer_stop(TEST_BENCHMARK_TIMER);
+    seconds += intervalTimer_getTotalDurationInSeconds(TEST_BENCHMARK_TIMER);
+  }
+  return seconds;
+}
+
+// Pushes a synthetic shot at every frequency through the ADC buffer, draining
+// it with detector() and with detector_processBlock() for each backend, and
+// checks that both record the same hits. Prints samples per second for each
+// against the 100 kHz input rate.
+bool detector_runBlockTest() {
+  printf("starting detector_runBlockTest()\n");
+  static const char *modeNames[TEST_MODE_COUNT] = {"detector()",
+                                                   "detector_processBlock()"};
+  isr_AdcValue_t *trace =
+      (isr_AdcValue_t *)malloc(TEST_SEGMENT_LENGTH * sizeof(isr_AdcValue_t));
+  if (trace == NULL) {
+    printf("detector_runBlockTest: malloc failed.\n");
+    return false;
+  }
+  bool ignoreNone[FILTER_FREQUENCY_COUNT] = {false};
+  bool success = true;
+  for (uint16_t backend = 0; backend < TEST_BACKEND_COUNT; backend++) {
+    double seconds[TEST_MODE_COUNT] = {0.0};
+    for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+      srand(TEST_RANDOM_SEED + f);
+      detector_makeTestSegment(trace, f);
+      detector_hitCount_t counts[TEST_MODE_COUNT][FILTER_FREQUENCY_COUNT];
+      detector_hitCount_t warmupCounts[FILTER_FREQUENCY_COUNT];
+      for (uint16_t mode = 0; mode < TEST_MODE_COUNT; mode++) {
+        detector_initBackend(ignoreNone, (detector_backend_t)backend);
+        seconds[mode] +=
+            detector_feedTestTrace(trace, TEST_WARMUP_LENGTH, mode);
+        // Only count the hits after the power windows have filled.
+        lockoutTimer_init();
+        detector_getHitCounts(warmupCounts);
+        seconds[mode] +=
+            detector_feedTestTrace(&trace[TEST_WARMUP_LENGTH],
+                                   TEST_GAP_LENGTH + TEST_SHOT_LENGTH, mode);
+        detector_getHitCounts(counts[mode]);
+        for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+          counts[mode][i] -= warmupCounts[i];
+      }
+      for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+        if (counts[0][i] != counts[1][i] || counts[0][i] != (i == f)) {
+          printf("detector_runBlockTest: %s, shot %d: frequency %d hit %d "
+                 "times per sample and %d times per block.\n",
+                 backendNames[backend], f, i, counts[0][i], counts[1][i]);
+          success = false;
+        }
+      }
+    }
+    for (uint16_t mode = 0; mode < TEST_MODE_COUNT; mode++) {
+      double rate =
+          FILTER_FREQUENCY_COUNT * TEST_SEGMENT_LENGTH / seconds[mode];
+      printf("%s, %s: %.0lf samples/s (%.1lf times the input rate)\n",
+             backendNames[backend], modeNames[mode], rate,
+             rate / (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000.0));
+    }
+  }
+  free(trace);
+  lockoutTimer_init();
+  detector_init(ignoreNone);
+  printf("detector_runBlockTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
+
+#define TEST_MEDIAN_SET_COUNT 64
+#define TEST_MEDIAN_EVALUATIONS 100000
+#define TEST_MEDIAN_METHOD_COUNT 3
+#define TEST_MEDIAN_DISTINCT_VALUES 16 // Few enough values to get ties.
+#define TEST_CPU_CLOCK_HZ 650.0E6      // Zybo CPU clock.
+// Quickselect is checked on every count up to this, odd and even, including
+// counts past FILTER_FREQUENCY_COUNT.
+#define TEST_MEDIAN_MAX_COUNT (2 * FILTER_FREQUENCY_COUNT + 5)
+
+// Reference median: insertion sort the values, then average the middle two.
+static double detector_medianSort(const double values[], uint16_t count) {
+  double v[TEST_MEDIAN_MAX_COUNT];
+  for (uint16_t i = 0; i < count; i++) {
+    double value = values[i];
+    uint16_t j = i;
+    for (; j > 0 && v[j - 1] > value; j--)
+      v[j] = v[j - 1];
+    v[j] = value;
+  }
+  return (v[(count - 1) / 2] + v[count / 2]) / 2.0;
+}
+
+// Median with each method, by number: sort, quickselect, or the selection
+// network (quickselect again if there is no network for this count).
+static double detector_medianByMethod(uint16_t method, const double values[]) {
+  double v[FILTER_FREQUENCY_COUNT];
+  if (method == 0)
+    return detector_medianSort(values, FILTER_FREQUENCY_COUNT);
+  if (method == 1)
+    return detector_medianQuickselect(values, v, FILTER_FREQUENCY_COUNT);
+  return detector_median(values);
+}
+
+// Checks the selection network and quickselect against sorting on random
+// power values (with ties), then times each and prints the time per
+// evaluation (and the CPU cycles, on the board).
+bool detector_runMedianTest() {
+  printf("starting detector_runMedianTest()\n");
+  static const char *methodNames[TEST_MEDIAN_METHOD_COUNT] = {
+      "insertion sort", "quickselect", "selection network"};
+  static double sets[TEST_MEDIAN_SET_COUNT][TEST_MEDIAN_MAX_COUNT];
+  double scratch[TEST_MEDIAN_MAX_COUNT];
+  srand(TEST_RANDOM_SEED);
+  for (uint16_t n = 0; n < TEST_MEDIAN_SET_COUNT; n++) {
+    for (uint16_t i = 0; i < TEST_MEDIAN_MAX_COUNT; i++)
+      sets[n][i] = rand() % TEST_MEDIAN_DISTINCT_VALUES;
+  }
+  bool success = true;
+  for (uint16_t n = 0; n < TEST_MEDIAN_SET_COUNT; n++) {
+    // Quickselect handles any count; check all of them up to the maximum.
+    for (uint16_t count = 1; count <= TEST_MEDIAN_MAX_COUNT; count++) {
+      double golden = detector_medianSort(sets[n], count);
+      double median = detector_medianQuickselect(sets[n], scratch, count);
+      if (median != golden) {
+        printf("detector_runMedianTest: quickselect median of %d values is "
+               "%lf, should be %lf.\n",
+               count, median, golden);
+        success = false;
+      }
+    }
+    double golden = detector_medianSort(sets[n], FILTER_FREQUENCY_COUNT);
+    if (detector_median(sets[n]) != golden) {
+      printf("detector_runMedianTest: median is %lf, should be %lf.\n",
+             detector_median(sets[n]), golden);
+      success = false;
+    }
+  }
+  for (uint16_t method = 0; method < TEST_MEDIAN_METHOD_COUNT; method++) {
+    volatile double sink = 0.0; // Keeps the medians from being optimized out.
+    intervalTimer_initCountUp(TEST_BENCHMARK_TIMER);
+    intervalTimer_start(TEST_BENCHMARK_TIMER);
+    for (uint32_t i = 0; i < TEST_MEDIAN_EVALUATIONS; i++)
+      sink += detector_medianByMethod(method,
+                                      sets[i % TEST_MEDIAN_SET_COUNT]);
+    intervalTimer_stop(TEST_BENCHMARK_TIMER);
+    double seconds =
+        intervalTimer_getTotalDurationInSeconds(TEST_BENCHMARK_TIMER) /
+        TEST_MEDIAN_EVALUATIONS;
+#ifdef __arm__
+    // On the board the CPU clock is known, so the time converts to cycles.
+    printf("%s: %.1lf ns (%.0lf cycles) per median\n", methodNames[method],
+           seconds * 1.0E9, seconds * TEST_CPU_CLOCK_HZ);
+#else
+    printf("%s: %.1lf ns per median\n", methodNames[method], seconds * 1.0E9);
+#endif
+  }
+  printf("detector_runMedianTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
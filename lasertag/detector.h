@@ -18,11 +18,43 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 typedef uint16_t detector_hitCount_t;
 
+// Ways of computing the band power at each player frequency.
+typedef enum {
+  DETECTOR_BACKEND_IIR,        // IIR bank and power queues (filter.c).
+  DETECTOR_BACKEND_SLIDING_DFT // Sliding DFT bins (slidingDft.c).
+} detector_backend_t;
+
 // Always have to init things.
 // bool array is indexed by frequency number, array location set for true to
 // ignore, false otherwise. This way you can ignore multiple frequencies.
+// Uses the IIR backend.
 void detector_init(bool ignoredFrequencies[]);
 
+// Same as detector_init(), but selects the band-power backend.
+void detector_initBackend(bool ignoredFrequencies[],
+                          detector_backend_t backend);
+
+// Several detectors can run side by side, one per ADC channel (isr.h), each
+// with its own filter state. The functions in this file without a detector_t
+// argument work on a default detector held by detector.c, which reads the ADC
+// buffer, so single-channel code never sees one. The detectorChannel_
+// functions at the end take the detector explicitly.
+typedef struct detector detector_t;
+
+// Allocates a detector for an ADC channel, with its own filter and sliding-DFT
+// state, the default fudge factor and no hits. It is ready to use without a
+// call to detectorChannel_initBackend(). Unlike the default detector, its hits
+// only lock out that detector (for LOCKOUT_TIMER_EXPIRE_VALUE ticks) and do
+// not touch lockoutTimer or the hit LED; multiDetector.h decides what they
+// mean for the player. Returns NULL if out of memory.
+detector_t *detector_createChannel(uint8_t adcChannel,
+                                   bool ignoredFrequencies[],
+                                   detector_backend_t backend);
+
+// Frees a detector from detector_createChannel() and its filter states; NULL
+// is ignored.
+void detector_destroyChannel(detector_t *detector);
+
 // Runs the entire detector: decimating fir-filter, iir-filters,
 // power-computation, hit-detection. if interruptsCurrentlyEnabled = true,
 // interrupts are running. If interruptsCurrentlyEnabled = false you can pop
@@ -37,6 +69,17 @@ void detector_init(bool ignoredFrequencies[]);
 // fill.
 void detector(bool interruptsCurrentlyEnabled);
 
+// ADC values are removed and filtered this many at a time by
+// detector_processBlock().
+#define DETECTOR_BLOCK_SIZE 1000
+
+// Same as detector(), but removes the ADC values in blocks of up to
+// DETECTOR_BLOCK_SIZE and runs each stage (FIR, IIR and power, hit detection)
+// over the whole block before the next, instead of every stage for one value
+// at a time. Hits are detected on exactly the same decimated outputs. Returns
+// the number of ADC values processed.
+uint32_t detector_processBlock();
+
 // Returns true if a hit was detected.
 bool detector_hitDetected();
 
@@ -63,6 +106,20 @@ void detector_setFudgeFactorIndex(uint32_t factor);
 // Encapsulate ADC scaling for easier testing.
 double detector_getScaledAdcValue(isr_AdcValue_t adcValue);
 
+// Each of these is the detector function of the same name working on d
+// instead of the default detector. detectorChannel_run() is detector().
+void detectorChannel_initBackend(detector_t *d, bool ignoredFrequencies[],
+                                 detector_backend_t backend);
+void detectorChannel_run(detector_t *d);
+uint32_t detectorChannel_processBlock(detector_t *d);
+bool detectorChannel_hitDetected(detector_t *d);
+uint16_t detectorChannel_getFrequencyNumberOfLastHit(detector_t *d);
+void detectorChannel_clearHit(detector_t *d);
+void detectorChannel_ignoreAllHits(detector_t *d, bool flagValue);
+void detectorChannel_getHitCounts(detector_t *d,
+                                  detector_hitCount_t hitArray[]);
+void detectorChannel_setFudgeFactorIndex(detector_t *d, uint32_t factor);
+
 /*******************************************************
  ****************** Test Routines **********************
  ******************************************************/
@@ -73,4 +130,20 @@ double detector_getScaledAdcValue(isr_AdcValue_t adcValue);
 // should detect a hit on the first set and not detect a hit on the second.
 void detector_runTest();
 
+// Runs the same synthetic ADC traces through both backends and reports
+// whether they detect the same hits, then times each backend and prints
+// detector inputs per second. Returns true if the hit decisions agree.
+bool detector_runBackendTest();
+
+// Runs the same synthetic ADC traces through the ADC buffer with detector()
+// and with detector_processBlock(), checks that both detect the same hits, and
+// prints samples per second for each. Returns true if the hits match.
+bool detector_runBlockTest();
+
+// Checks the median used by hit detection (a selection network for ten
+// frequencies, quickselect otherwise) against sorting, and prints the time
+// per median for sorting, quickselect and the network. Returns true if the
+// medians match.
+bool detector_runMedianTest();
+
 #endif /* DETECTOR_H_ */
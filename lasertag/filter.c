@@ -0,0 +1,890 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "filter.h"
+
+#define FIR_COEFFICIENT_COUNT 81
+#define IIR_A_COEFFICIENT_COUNT 10 // No leading 1.
+#define IIR_B_COEFFICIENT_COUNT 11
+#define X_QUEUE_SIZE FIR_COEFFICIENT_COUNT
+#define Y_QUEUE_SIZE IIR_B_COEFFICIENT_COUNT
+#define Z_QUEUE_SIZE IIR_A_COEFFICIENT_COUNT
+#define OUTPUT_QUEUE_SIZE 2000
+// Decimated outputs that a single input contributes to.
+#define POLYPHASE_PENDING_COUNT                                                \
+  ((FIR_COEFFICIENT_COUNT + FILTER_FIR_DECIMATION_FACTOR - 1) /                \
+   FILTER_FIR_DECIMATION_FACTOR)
+#define QUEUE_INIT_VALUE 0.0
+
+#ifdef FILTER_IIR_SINGLE_PRECISION
+typedef float iirValue_t;
+#else
+typedef double iirValue_t;
+#endif
+
+// One second-order section with its transposed direct form II state, packed
+// together so a filter's whole cascade is one contiguous run of memory.
+typedef struct {
+  iirValue_t b0, b1, b2, a1, a2;
+  iirValue_t s1, s2;
+} iirSection_t;
+
+// 81-tap Hamming-windowed lowpass, 5 kHz cutoff at the 100 kHz input rate,
+// unity gain at DC. Applied ahead of the decimate-by-10 so the player
+// frequencies (1.5 kHz to 4.2 kHz) pass and everything that would alias into
+// the 10 kHz decimated band is attenuated.
+static const double firCoefficients[FIR_COEFFICIENT_COUNT] = {
+    0.0, -2.05867321188750413774e-04,
+    -4.22843146180012163186e-04, -6.46890571633733412263e-04,
+    -8.64243456744099138381e-04, -1.04866576889474242065e-03,
+    -1.16165530685912810407e-03, -1.15617796154183442164e-03,
+    -9.83886009016220934933e-04, -6.05076846391511095902e-04,
+    0.0, 8.20366259216359530564e-04,
+    1.80617524097742977555e-03, 2.86522152082531933112e-03,
+    3.86567792905117852548e-03, 4.64589553385037507677e-03,
+    5.03113433999087967391e-03, 4.85602149496012786695e-03,
+    3.99050809230908944125e-03, 2.36626898264437768998e-03,
+    0.0, -2.98998546772406793501e-03,
+    -6.37702614625564566386e-03, -9.83151286634025532718e-03,
+    -1.29393935461648325325e-02, -1.52332195221931213092e-02,
+    -1.62335639102205546436e-02, -1.54971716961218239361e-02,
+    -1.26670618263361265537e-02, -7.51915918227407265723e-03,
+    0.0, 9.74933225379471038452e-03,
+    2.13866620468603149674e-02, 3.43814771972838287284e-02,
+    4.80468734108680170514e-02, 6.15884758535680393310e-02,
+    7.41661891139077378288e-02, 8.49630873204730713288e-02,
+    9.32548045542805487118e-02, 9.84725469959279731125e-02,
+    1.00253364822582138882e-01, 9.84725469959279731125e-02,
+    9.32548045542805487118e-02, 8.49630873204730713288e-02,
+    7.41661891139077378288e-02, 6.15884758535680462699e-02,
+    4.80468734108680239903e-02, 3.43814771972838287284e-02,
+    2.13866620468603219063e-02, 9.74933225379471385397e-03,
+    0.0, -7.51915918227407439195e-03,
+    -1.26670618263361282885e-02, -1.54971716961218222014e-02,
+    -1.62335639102205581130e-02, -1.52332195221931195744e-02,
+    -1.29393935461648360019e-02, -9.83151286634026053135e-03,
+    -6.37702614625564653122e-03, -2.98998546772406966973e-03,
+    0.0, 2.36626898264437725630e-03,
+    3.99050809230909030861e-03, 4.85602149496012786695e-03,
+    5.03113433999088054127e-03, 4.64589553385037854621e-03,
+    3.86567792905117982652e-03, 2.86522152082532106585e-03,
+    1.80617524097743020924e-03, 8.20366259216359422143e-04,
+    0.0, -6.05076846391510879061e-04,
+    -9.83886009016221151774e-04, -1.15617796154183572269e-03,
+    -1.16165530685912853776e-03, -1.04866576889474328801e-03,
+    -8.64243456744099138381e-04, -6.46890571633733412263e-04,
+    -4.22843146180012434236e-04, -2.05867321188750413774e-04,
+    0.0,
+};
+
+// 10th-order IIR bandpass filters, one per player frequency: 5th-order
+// Butterworth prototypes spanning +/-50 Hz around each frequency, converted
+// with the bilinear transform at the 10 kHz decimated rate and normalized to
+// unity gain at the center frequency. a[0] multiplies the newest zQueue
+// element (z[n-1]); the leading 1 is omitted.
+static const double
+    iirACoefficientConstants[FILTER_FREQUENCY_COUNT][IIR_A_COEFFICIENT_COUNT] =
+        {
+    {
+        -5.90673427042767507089e+00, 1.87539325625082895499e+01,
+        -3.91627283802575121285e+01, 5.91374530769047765943e+01,
+        -6.66097401631482597395e+01, 5.67803998089176005237e+01,
+        -3.61030713360782726795e+01, 1.65996330746648048660e+01,
+        -5.01981401196711196633e+00, 8.15976680024277589709e-01,
+    },
+    {
+        -4.59111378971226535839e+00, 1.32288861697319042321e+01,
+        -2.53656561091120593687e+01, 3.70419652102642942282e+01,
+        -4.08948500935911596343e+01, 3.55656421073776982666e+01,
+        -2.33839817292502232249e+01, 1.17093021789680165057e+01,
+        -3.90173931600691226151e+00, 8.15976680024278255843e-01,
+    },
+    {
+        -3.02883565037963276012e+00, 8.46660025009052930045e+00,
+        -1.38487233841926613565e+01, 2.04474331956961776768e+01,
+        -2.10899517663332751738e+01, 1.96325517153521253988e+01,
+        -1.27668438186762553954e+01, 7.49410608624144103374e+00,
+        -2.57404361557987471087e+00, 8.15976680024278144820e-01,
+    },
+    {
+        -1.39490145715780355928e+00, 5.57506233119606342541e+00,
+        -5.57104968074985684723e+00, 1.14786773538743016587e+01,
+        -8.12781671214441558959e+00, 1.10212715254363260442e+01,
+        -5.13584664638198340469e+00, 4.93474708441726850339e+00,
+        -1.18545131021225125245e+00, 8.15976680024278921977e-01,
+    },
+    {
+        8.09402945807351947849e-01, 5.05876202338191571783e+00,
+        3.14905080200383924449e+00, 9.96526507996723509564e+00,
+        4.55486739907728122034e+00, 9.56817976583807805468e+00,
+        2.90305281641858226038e+00, 4.47775918472064304865e+00,
+        6.87867789995743716958e-01, 8.15976680024278810954e-01,
+    },
+    {
+        2.68231273880712839386e+00, 7.67490066060868159070e+00,
+        1.18395145499235852071e+01, 1.79086426343764202329e+01,
+        1.78336881367912738483e+01, 1.71949528305417551621e+01,
+        1.09146044292775954432e+01, 6.79335668301190409579e+00,
+        2.27955253347921393825e+00, 8.15976680024277589709e-01,
+    },
+    {
+        4.90075902865164270139e+00, 1.44046533621789532020e+01,
+        2.82290969746715596500e+01, 4.14882427382671750138e+01,
+        4.60740285402342450993e+01, 3.98346922337709372641e+01,
+        2.60237013182145098256e+01, 1.27499976263199386040e+01,
+        4.16489005853291516246e+00, 8.15976680024279810155e-01,
+    },
+    {
+        6.11114655146281648967e+00, 1.97366754245670605883e+01,
+        4.17194036250050714898e+01, 6.33874938675792947151e+01,
+        7.15687657168114981232e+01, 6.08610306626795463103e+01,
+        3.84599871216710482713e+01, 1.74694787626820051685e+01,
+        5.19353295471617837364e+00, 8.15976680024278033798e-01,
+    },
+    {
+        7.33654161428463247319e+00, 2.63288511649838454787e+01,
+        5.97596421371094663755e+01, 9.43942740430005358121e+01,
+        1.08024628534568662985e+02, 9.06318380996733878874e+01,
+        5.50906788708500414486e+01, 2.33043475405029312242e+01,
+        6.23492994752568652217e+00, 8.15976680024277367664e-01,
+    },
+    {
+        8.48836363327654019884e+00, 3.36205968869011897482e+01,
+        8.15233302878387746659e+01, 1.33755503758516823609e+02,
+        1.54993947719837478871e+02, 1.28424041113446946838e+02,
+        7.51538676483137351170e+01, 2.97584199323798799242e+01,
+        7.21380118931750580202e+00, 8.15976680024277922776e-01,
+    },
+};
+
+static const double
+    iirBCoefficientConstants[FILTER_FREQUENCY_COUNT][IIR_B_COEFFICIENT_COUNT] =
+        {
+    {
+        2.76887139891230336708e-08, 0.0,
+        -1.38443569945615158428e-07, 0.0,
+        2.76887139891230316855e-07, 0.0,
+        -2.76887139891230316855e-07, 0.0,
+        1.38443569945615158428e-07, 0.0,
+        -2.76887139891230336708e-08,
+    },
+    {
+        2.76887142845676789955e-08, 0.0,
+        -1.38443571422838394978e-07, 0.0,
+        2.76887142845676789955e-07, 0.0,
+        -2.76887142845676789955e-07, 0.0,
+        1.38443571422838394978e-07, 0.0,
+        -2.76887142845676789955e-08,
+    },
+    {
+        2.76887139686283435930e-08, 0.0,
+        -1.38443569843141721274e-07, 0.0,
+        2.76887139686283442547e-07, 0.0,
+        -2.76887139686283442547e-07, 0.0,
+        1.38443569843141721274e-07, 0.0,
+        -2.76887139686283435930e-08,
+    },
+    {
+        2.76887139821190075654e-08, 0.0,
+        -1.38443569910595031210e-07, 0.0,
+        2.76887139821190062419e-07, 0.0,
+        -2.76887139821190062419e-07, 0.0,
+        1.38443569910595031210e-07, 0.0,
+        -2.76887139821190075654e-08,
+    },
+    {
+        2.76887142332065954678e-08, 0.0,
+        -1.38443571166032987265e-07, 0.0,
+        2.76887142332065974531e-07, 0.0,
+        -2.76887142332065974531e-07, 0.0,
+        1.38443571166032987265e-07, 0.0,
+        -2.76887142332065954678e-08,
+    },
+    {
+        2.76887141134237257082e-08, 0.0,
+        -1.38443570567118621923e-07, 0.0,
+        2.76887141134237243847e-07, 0.0,
+        -2.76887141134237243847e-07, 0.0,
+        1.38443570567118621923e-07, 0.0,
+        -2.76887141134237257082e-08,
+    },
+    {
+        2.76887147633830195303e-08, 0.0,
+        -1.38443573816915081108e-07, 0.0,
+        2.76887147633830162215e-07, 0.0,
+        -2.76887147633830162215e-07, 0.0,
+        1.38443573816915081108e-07, 0.0,
+        -2.76887147633830195303e-08,
+    },
+    {
+        2.76887118489089477273e-08, 0.0,
+        -1.38443559244544745254e-07, 0.0,
+        2.76887118489089490508e-07, 0.0,
+        -2.76887118489089490508e-07, 0.0,
+        1.38443559244544745254e-07, 0.0,
+        -2.76887118489089477273e-08,
+    },
+    {
+        2.76887085289971360337e-08, 0.0,
+        -1.38443542644985676860e-07, 0.0,
+        2.76887085289971353719e-07, 0.0,
+        -2.76887085289971353719e-07, 0.0,
+        1.38443542644985676860e-07, 0.0,
+        -2.76887085289971360337e-08,
+    },
+    {
+        2.76887203562644306952e-08, 0.0,
+        -1.38443601781322143550e-07, 0.0,
+        2.76887203562644287100e-07, 0.0,
+        -2.76887203562644287100e-07, 0.0,
+        1.38443601781322143550e-07, 0.0,
+        -2.76887203562644306952e-08,
+    },
+};
+
+// The same IIR filters factored into second-order sections (conjugate pole
+// pairs ordered by radius, numerator gain split evenly), {b0, b1, b2, a1, a2}
+// per section. The 10th-order direct form above needs double precision; these
+// stay stable in single precision.
+static const double iirSectionConstants
+    [FILTER_FREQUENCY_COUNT][FILTER_IIR_SECTION_COUNT]
+    [FILTER_IIR_SECTION_COEFFICIENT_COUNT] = {
+    {
+        {3.07936065899356362086e-02, 0.0,
+         -3.07936065899356362086e-02, -1.16912311979462035794e+00,
+         9.39062505817492065852e-01},
+        {3.07936065899356362086e-02, 0.0,
+         -3.07936065899356362086e-02, -1.14642229012784868658e+00,
+         9.49753688706775012207e-01},
+        {3.07936065899356362086e-02, 0.0,
+         -3.07936065899356362086e-02, -1.20474691696740587865e+00,
+         9.51103758548031197328e-01},
+        {3.07936065899356362086e-02, 0.0,
+         -3.07936065899356362086e-02, -1.14573686699873444894e+00,
+         9.80351730316585956437e-01},
+        {3.07936065899356362086e-02, 0.0,
+         -3.07936065899356362086e-02, -1.24070507653906703105e+00,
+         9.81211071313340621458e-01},
+    },
+    {
+        {3.07936066556505419478e-02, 0.0,
+         -3.07936066556505419478e-02, -9.08721644045089038677e-01,
+         9.39062505817492509941e-01},
+        {3.07936066556505419478e-02, 0.0,
+         -3.07936066556505419478e-02, -8.81685838760154383387e-01,
+         9.49954779778036773052e-01},
+        {3.07936066556505419478e-02, 0.0,
+         -3.07936066556505419478e-02, -9.45802054623663401856e-01,
+         9.50902424255327116676e-01},
+        {3.07936066556505419478e-02, 0.0,
+         -3.07936066556505419478e-02, -8.75026183456678485761e-01,
+         9.80479709473400129482e-01},
+        {3.07936066556505419478e-02, 0.0,
+         -3.07936066556505419478e-02, -9.79878068826679382575e-01,
+         9.81082996693998676818e-01},
+    },
+    {
+        {3.07936065853770604694e-02, 0.0,
+         -3.07936065853770604694e-02, -5.99499084061659304190e-01,
+         9.39062505817492509941e-01},
+        {3.07936065853770604694e-02, 0.0,
+         -3.07936065853770604694e-02, -5.68452645201950046427e-01,
+         9.50138172821458848460e-01},
+        {3.07936065853770604694e-02, 0.0,
+         -3.07936065853770604694e-02, -6.37172119429505690036e-01,
+         9.50718883698206007615e-01},
+        {3.07936065853770604694e-02, 0.0,
+         -3.07936065853770604694e-02, -5.55516927726694254019e-01,
+         9.80596460796794078263e-01},
+        {3.07936065853770604694e-02, 0.0,
+         -3.07936065853770604694e-02, -6.68194873959823576470e-01,
+         9.80966187442892323389e-01},
+    },
+    {
+        {3.07936065883777504437e-02, 0.0,
+         -3.07936065883777504437e-02, -2.76093602443421959336e-01,
+         9.39062505817492509941e-01},
+        {3.07936065883777504437e-02, 0.0,
+         -3.07936065883777504437e-02, -2.41934386734722534085e-01,
+         9.50300016174189576823e-01},
+        {3.07936065883777504437e-02, 0.0,
+         -3.07936065883777504437e-02, -3.13304634160704198464e-01,
+         9.50556969009136443205e-01},
+        {3.07936065883777504437e-02, 0.0,
+         -3.07936065883777504437e-02, -2.23196869514310280991e-01,
+         9.80699507986737994969e-01},
+        {3.07936065883777504437e-02, 0.0,
+         -3.07936065883777504437e-02, -3.40371964304644669674e-01,
+         9.80863112231553424536e-01},
+    },
+    {
+        {3.07936066442264441689e-02, 0.0,
+         -3.07936066442264441689e-02, 1.60205564335422850908e-01,
+         9.39062505817492509941e-01},
+        {3.07936066442264441689e-02, 0.0,
+         -3.07936066442264441689e-02, 1.25174335914364359690e-01,
+         9.50354443874013243843e-01},
+        {3.07936066442264441689e-02, 0.0,
+         -3.07936066442264441689e-02, 1.97007633882737148712e-01,
+         9.50502529710506194327e-01},
+        {3.07936066442264441689e-02, 0.0,
+         -3.07936066442264441689e-02, 1.04527678348931882257e-01,
+         9.80734163661052815719e-01},
+        {3.07936066442264441689e-02, 0.0,
+         -3.07936066442264441689e-02, 2.22487733325895636893e-01,
+         9.80828452000652495357e-01},
+    },
+    {
+        {3.07936066175834820269e-02, 0.0,
+         -3.07936066175834820269e-02, 5.30911616112364037612e-01,
+         9.39062505817492287896e-01},
+        {3.07936066175834820269e-02, 0.0,
+         -3.07936066175834820269e-02, 4.99118207728252882838e-01,
+         9.50174264538725665830e-01},
+        {3.07936066175834820269e-02, 0.0,
+         -3.07936066175834820269e-02, 5.68573485608415807313e-01,
+         9.50682771293954398395e-01},
+        {3.07936066175834820269e-02, 0.0,
+         -3.07936066175834820269e-02, 4.84891263709029962659e-01,
+         9.80619439971045170346e-01},
+        {3.07936066175834820269e-02, 0.0,
+         -3.07936066175834820269e-02, 5.98818165649065647926e-01,
+         9.80943200143194693474e-01},
+    },
+    {
+        {3.07936067621520648263e-02, 0.0,
+         -3.07936067621520648263e-02, 9.70009894236195546746e-01,
+         9.39062505817492954030e-01},
+        {3.07936067621520648263e-02, 0.0,
+         -3.07936067621520648263e-02, 9.43906853367727505244e-01,
+         9.49912615017665995509e-01},
+        {3.07936067621520648263e-02, 0.0,
+         -3.07936067621520648263e-02, 1.00683499348456195754e+00,
+         9.50944632951391866094e-01},
+        {3.07936067621520648263e-02, 0.0,
+         -3.07936067621520648263e-02, 9.38589585873674803196e-01,
+         9.80452870764378703328e-01},
+        {3.07936067621520648263e-02, 0.0,
+         -3.07936067621520648263e-02, 1.04141770168948322173e+00,
+         9.81109852651954605918e-01},
+    },
+    {
+        {3.07936061138939336235e-02, 0.0,
+         -3.07936061138939336235e-02, 1.20958255351667176569e+00,
+         9.39062505817492287896e-01},
+        {3.07936061138939336235e-02, 0.0,
+         -3.07936061138939336235e-02, 1.18765088088773373975e+00,
+         9.49715866933244501347e-01},
+        {3.07936061138939336235e-02, 0.0,
+         -3.07936061138939336235e-02, 1.24488441425521090267e+00,
+         9.51141635593379608515e-01},
+        {3.07936061138939336235e-02, 0.0,
+         -3.07936061138939336235e-02, 1.18796412848878318869e+00,
+         9.80327665878594323168e-01},
+        {3.07936061138939336235e-02, 0.0,
+         -3.07936061138939336235e-02, 1.28106457431441711492e+00,
+         9.81235157436587512869e-01},
+    },
+    {
+        {3.07936053754553837325e-02, 0.0,
+         -3.07936053754553837325e-02, 1.45212566333620940462e+00,
+         9.39062505817492065852e-01},
+        {3.07936053754553837325e-02, 0.0,
+         -3.07936053754553837325e-02, 1.43550080501588150916e+00,
+         9.49419566418642335570e-01},
+        {3.07936053754553837325e-02, 0.0,
+         -3.07936053754553837325e-02, 1.48480167353628056404e+00,
+         9.51438473541588947135e-01},
+        {3.07936053754553837325e-02, 0.0,
+         -3.07936053754553837325e-02, 1.44233371985738556553e+00,
+         9.80139233678720134257e-01},
+        {3.07936053754553837325e-02, 0.0,
+         -3.07936053754553837325e-02, 1.52177975253887542983e+00,
+         9.81423800328287243566e-01},
+    },
+    {
+        {3.07936080061605235714e-02, 0.0,
+         -3.07936080061605235714e-02, 1.68010642066160276187e+00,
+         9.39062505817492287896e-01},
+        {3.07936080061605235714e-02, 0.0,
+         -3.07936080061605235714e-02, 1.67003195548724558961e+00,
+         9.48879047231986683109e-01},
+        {3.07936080061605235714e-02, 0.0,
+         -3.07936080061605235714e-02, 1.70875203571166278671e+00,
+         9.51980450679109191370e-01},
+        {3.07936080061605235714e-02, 0.0,
+         -3.07936080061605235714e-02, 1.68429414288965961788e+00,
+         9.79796082051708761007e-01},
+        {3.07936080061605235714e-02, 0.0,
+         -3.07936080061605235714e-02, 1.74517907852636811050e+00,
+         9.81767522027158667797e-01},
+    },
+};
+
+// Filter inputs and state, one per filter_state_t. x, y and z are read in
+// full on every output, so they are mirrored delay lines and the
+// multiply-accumulate loops run over a plain array. The output queues are only
+// touched at the ends (incremental power), so they are ordinary queues.
+struct filter_state {
+  queue_t xQueue;
+  queue_t yQueue;
+  queue_t zQueue[FILTER_FREQUENCY_COUNT];
+  queue_t outputQueue[FILTER_FREQUENCY_COUNT];
+
+  // Power values from the last filter_computePower() call, and the oldest
+  // output value each was computed with (it drops out of the window on the
+  // next push).
+  double currentPowerValue[FILTER_FREQUENCY_COUNT];
+  double oldestValue[FILTER_FREQUENCY_COUNT];
+
+  // Working copy of iirSectionConstants in the precision filter_iirFilter()
+  // runs in, with the section state.
+  iirSection_t iirSections[FILTER_FREQUENCY_COUNT][FILTER_IIR_SECTION_COUNT];
+
+  // Polyphase decimator state. polyphaseSum[(polyphaseHead + j) % PENDING] is
+  // the partial sum of the j-th decimated output still to come;
+  // polyphasePhase counts inputs since the last completed output.
+  double polyphaseSum[POLYPHASE_PENDING_COUNT];
+  uint32_t polyphaseHead;
+  uint32_t polyphasePhase;
+
+  // Set once the queues have been allocated; filter_init() only refills them
+  // after that.
+  bool allocated;
+};
+
+// The state the functions without a filter_state_t argument use.
+static filter_state_t defaultState;
+
+// Build the queue name "<prefix>[i]" and initialize the queue.
+static void initQueueArray(queue_t queues[], queue_size_t size,
+                           const char *prefix, bool mirrored) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    char name[QUEUE_MAX_NAME_SIZE];
+    snprintf(name, QUEUE_MAX_NAME_SIZE, "%s[%d]", prefix, i);
+    if (mirrored)
+      queue_initMirrored(&queues[i], size, name);
+    else
+      queue_init(&queues[i], size, name);
+  }
+}
+
+// Allocates the queues of a state.
+static void allocateQueues(filter_state_t *state) {
+  queue_initMirrored(&state->xQueue, X_QUEUE_SIZE, "xQueue");
+  queue_initMirrored(&state->yQueue, Y_QUEUE_SIZE, "yQueue");
+#ifdef FILTER_IIR_DIRECT_FORM
+  initQueueArray(state->zQueue, Z_QUEUE_SIZE, "zQueue", true);
+#else
+  // Only a history of outputs; the sections keep their own state.
+  initQueueArray(state->zQueue, Z_QUEUE_SIZE, "zQueue", false);
+#endif
+  initQueueArray(state->outputQueue, OUTPUT_QUEUE_SIZE, "outputQueue", false);
+  state->allocated = true;
+}
+
+// Initializes state. The queues are allocated on the first call and only
+// refilled after that, so re-initializing between tests or runs does not leak.
+void filterState_init(filter_state_t *state) {
+  if (!state->allocated)
+    allocateQueues(state);
+  filter_fillQueue(&state->xQueue, QUEUE_INIT_VALUE);
+  filter_fillQueue(&state->yQueue, QUEUE_INIT_VALUE);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    filter_fillQueue(&state->zQueue[i], QUEUE_INIT_VALUE);
+    filter_fillQueue(&state->outputQueue[i], QUEUE_INIT_VALUE);
+    state->currentPowerValue[i] = 0.0;
+    state->oldestValue[i] = 0.0;
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+      const double *c = iirSectionConstants[i][s];
+      iirSection_t *section = &state->iirSections[i][s];
+      section->b0 = c[0];
+      section->b1 = c[1];
+      section->b2 = c[2];
+      section->a1 = c[3];
+      section->a2 = c[4];
+    }
+    filterState_clearIirState(state, i);
+  }
+  for (uint32_t j = 0; j < POLYPHASE_PENDING_COUNT; j++)
+    state->polyphaseSum[j] = 0.0;
+  state->polyphaseHead = 0;
+  state->polyphasePhase = 0;
+}
+
+// Allocates and initializes a filter state.
+filter_state_t *filter_createState() {
+  filter_state_t *newState =
+      (filter_state_t *)calloc(1, sizeof(filter_state_t));
+  if (newState == NULL) {
+    printf("filter_createState: calloc failed.\n");
+    return NULL;
+  }
+  filterState_init(newState);
+  return newState;
+}
+
+// Frees oldState, created by filter_createState(), and its queues. Does
+// nothing if oldState is NULL.
+void filter_destroyState(filter_state_t *oldState) {
+  if (oldState == NULL)
+    return;
+  queue_garbageCollect(&oldState->xQueue);
+  queue_garbageCollect(&oldState->yQueue);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    queue_garbageCollect(&oldState->zQueue[i]);
+    queue_garbageCollect(&oldState->outputQueue[i]);
+  }
+  free(oldState);
+}
+
+// Returns the state the functions without a filter_state_t argument use.
+filter_state_t *filter_getDefaultState() { return &defaultState; }
+
+// Use this to copy an input into the input queue of the FIR-filter (xQueue).
+void filterState_addNewInput(filter_state_t *state, double x) {
+  queue_overwritePush(&state->xQueue, x);
+}
+
+// Polyphase decimating FIR. x is tap (inputs left until the next output) of
+// the next pending output, and FILTER_FIR_DECIMATION_FACTOR taps further along
+// for each pending output after that. It is folded into every pending sum
+// whose tap is in range: at most POLYPHASE_PENDING_COUNT multiply-accumulates
+// per input instead of all the taps on every tenth.
+static inline bool polyphaseAdd(filter_state_t *state, double x,
+                                double *output) {
+  queue_overwritePush(&state->xQueue, x);
+  uint32_t tap = FILTER_FIR_DECIMATION_FACTOR - 1 - state->polyphasePhase;
+  uint32_t slot = state->polyphaseHead;
+  for (; tap < FIR_COEFFICIENT_COUNT; tap += FILTER_FIR_DECIMATION_FACTOR) {
+    state->polyphaseSum[slot] += firCoefficients[tap] * x;
+    if (++slot == POLYPHASE_PENDING_COUNT)
+      slot = 0;
+  }
+  if (++state->polyphasePhase < FILTER_FIR_DECIMATION_FACTOR)
+    return false;
+  // That input supplied tap 0 of the oldest pending sum, so it is complete.
+  *output = state->polyphaseSum[state->polyphaseHead];
+  queue_overwritePush(&state->yQueue, *output);
+  state->polyphaseSum[state->polyphaseHead] = 0.0;
+  if (++state->polyphaseHead == POLYPHASE_PENDING_COUNT)
+    state->polyphaseHead = 0;
+  state->polyphasePhase = 0;
+  return true;
+}
+
+// Adds x; a completed output is pushed onto yQueue.
+bool filterState_addNewInputDecimated(filter_state_t *state, double x) {
+  double output;
+  return polyphaseAdd(state, x, &output);
+}
+
+// Block version of filter_addNewInputDecimated().
+uint32_t filterState_addNewInputBlock(filter_state_t *state, const double x[],
+                                      uint32_t count, double firOutputs[]) {
+  uint32_t outputCount = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    if (polyphaseAdd(state, x[i], &firOutputs[outputCount]))
+      outputCount++;
+  }
+  return outputCount;
+}
+
+// Fills a queue with the given fillValue.
+void filter_fillQueue(queue_t *q, double fillValue) {
+  for (queue_size_t i = 0; i < queue_size(q); i++)
+    queue_overwritePush(q, fillValue);
+}
+
+// Invokes the FIR-filter. Input is contents of xQueue. firCoefficients[0]
+// multiplies the newest input.
+double filterState_firFilter(filter_state_t *state) {
+  const queue_data_t *x = queue_getContiguous(&state->xQueue);
+  double y = 0.0;
+  for (uint32_t i = 0; i < FIR_COEFFICIENT_COUNT; i++)
+    y += firCoefficients[i] * x[X_QUEUE_SIZE - 1 - i];
+  queue_overwritePush(&state->yQueue, y);
+  return y;
+}
+
+// Use this to invoke a single iir filter. Input comes from yQueue.
+// Output is returned and is also pushed onto zQueue[filterNumber]. The direct
+// form reads the last Y_QUEUE_SIZE inputs and Z_QUEUE_SIZE outputs; the
+// sections only need the newest input.
+#ifdef FILTER_IIR_DIRECT_FORM
+double filterState_iirFilter(filter_state_t *state, uint16_t filterNumber) {
+  const queue_data_t *y = queue_getContiguous(&state->yQueue);
+  const queue_data_t *z = queue_getContiguous(&state->zQueue[filterNumber]);
+  const double *b = iirBCoefficientConstants[filterNumber];
+  const double *a = iirACoefficientConstants[filterNumber];
+  double bSum = 0.0;
+  for (uint32_t i = 0; i < IIR_B_COEFFICIENT_COUNT; i++)
+    bSum += b[i] * y[Y_QUEUE_SIZE - 1 - i];
+  double aSum = 0.0;
+  for (uint32_t i = 0; i < IIR_A_COEFFICIENT_COUNT; i++)
+    aSum += a[i] * z[Z_QUEUE_SIZE - 1 - i];
+  double output = bSum - aSum;
+  queue_overwritePush(&state->zQueue[filterNumber], output);
+  queue_overwritePush(&state->outputQueue[filterNumber], output);
+  return output;
+}
+#else
+double filterState_iirFilter(filter_state_t *state, uint16_t filterNumber) {
+  iirValue_t x =
+      queue_readElementAtUnchecked(&state->yQueue, Y_QUEUE_SIZE - 1);
+  iirSection_t *section = state->iirSections[filterNumber];
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++, section++) {
+    iirValue_t y = section->s1 + section->b0 * x;
+    section->s1 = section->s2 + section->b1 * x - section->a1 * y;
+    section->s2 = section->b2 * x - section->a2 * y;
+    x = y;
+  }
+  double output = x;
+  queue_overwritePush(&state->zQueue[filterNumber], output);
+  queue_overwritePush(&state->outputQueue[filterNumber], output);
+  return output;
+}
+#endif
+
+#ifndef FILTER_IIR_DIRECT_FORM
+// Block version of filter_iirFilter() and an incremental
+// filter_computePower(). The section state, power and oldest value stay in
+// locals for the whole block; the arithmetic is the same, so the powers are
+// bit-identical to the one-at-a-time calls.
+void filterState_iirFilterBlock(filter_state_t *state, uint16_t filterNumber,
+                                const double firOutputs[], uint32_t count,
+                                double powerValues[][FILTER_FREQUENCY_COUNT]) {
+  iirSection_t *sections = state->iirSections[filterNumber];
+  queue_t *q = &state->outputQueue[filterNumber];
+  double power = state->currentPowerValue[filterNumber];
+  double oldest = state->oldestValue[filterNumber];
+  for (uint32_t n = 0; n < count; n++) {
+    iirValue_t x = firOutputs[n];
+    iirSection_t *section = sections;
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++, section++) {
+      iirValue_t y = section->s1 + section->b0 * x;
+      section->s1 = section->s2 + section->b1 * x - section->a1 * y;
+      section->s2 = section->b2 * x - section->a2 * y;
+      x = y;
+    }
+    double output = x;
+    queue_overwritePush(&state->zQueue[filterNumber], output);
+    queue_overwritePush(q, output);
+    power = power - oldest * oldest + output * output;
+    oldest = queue_readElementAtUnchecked(q, 0);
+    powerValues[n][filterNumber] = power;
+  }
+  state->currentPowerValue[filterNumber] = power;
+  state->oldestValue[filterNumber] = oldest;
+}
+#endif
+
+// Zeroes the state of IIR filter filterNumber.
+void filterState_clearIirState(filter_state_t *state,
+                               uint16_t filterNumber) {
+#ifdef FILTER_IIR_DIRECT_FORM
+  filter_fillQueue(&state->zQueue[filterNumber], QUEUE_INIT_VALUE);
+#else
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+    state->iirSections[filterNumber][s].s1 = 0.0;
+    state->iirSections[filterNumber][s].s2 = 0.0;
+  }
+#endif
+}
+
+// Use this to compute the power for values contained in an outputQueue.
+double filterState_computePower(filter_state_t *state, uint16_t filterNumber,
+                                bool forceComputeFromScratch, bool debugPrint) {
+  queue_t *q = &state->outputQueue[filterNumber];
+  double power;
+  if (forceComputeFromScratch) {
+    queue_spans_t spans;
+    queue_getSpans(q, &spans);
+    power = 0.0;
+    for (queue_size_t i = 0; i < spans.firstCount; i++)
+      power += spans.first[i] * spans.first[i];
+    for (queue_size_t i = 0; i < spans.secondCount; i++)
+      power += spans.second[i] * spans.second[i];
+  } else {
+    double newest = queue_readElementAt(q, queue_elementCount(q) - 1);
+    double oldest = state->oldestValue[filterNumber];
+    power = state->currentPowerValue[filterNumber] - oldest * oldest +
+            newest * newest;
+  }
+  state->oldestValue[filterNumber] = queue_readElementAt(q, 0);
+  state->currentPowerValue[filterNumber] = power;
+  if (debugPrint)
+    printf("filter_computePower(%d): %le\n", filterNumber, power);
+  return power;
+}
+
+// Returns the last-computed output power value for the IIR filter
+// [filterNumber].
+double filterState_getCurrentPowerValue(filter_state_t *state,
+                                        uint16_t filterNumber) {
+  return state->currentPowerValue[filterNumber];
+}
+
+// Sets a current power value for a specific filter number.
+void filterState_setCurrentPowerValue(filter_state_t *state,
+                                      uint16_t filterNumber, double value) {
+  state->currentPowerValue[filterNumber] = value;
+}
+
+// Get a copy of the current power values.
+void filterState_getCurrentPowerValues(filter_state_t *state,
+                                       double powerValues[]) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    powerValues[i] = state->currentPowerValue[i];
+}
+
+// Copy the current power values into normalizedArray[] and divide them all by
+// the largest one.
+void filterState_getNormalizedPowerValues(filter_state_t *state,
+                                          double normalizedArray[],
+                                          uint16_t *indexOfMaxValue) {
+  uint16_t maxIndex = 0;
+  for (uint16_t i = 1; i < FILTER_FREQUENCY_COUNT; i++) {
+    if (state->currentPowerValue[i] > state->currentPowerValue[maxIndex])
+      maxIndex = i;
+  }
+  double maxValue = state->currentPowerValue[maxIndex];
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    normalizedArray[i] =
+        maxValue > 0.0 ? state->currentPowerValue[i] / maxValue : 0.0;
+  *indexOfMaxValue = maxIndex;
+}
+
+/*******************************************************************************
+***** Verification-Assisting Functions
+*******************************************************************************/
+
+// Returns the array of FIR coefficients.
+const double *filter_getFirCoefficientArray() { return firCoefficients; }
+
+// Returns the number of FIR coefficients.
+uint32_t filter_getFirCoefficientCount() { return FIR_COEFFICIENT_COUNT; }
+
+// Returns the array of coefficients for a particular filter number.
+const double *filter_getIirACoefficientArray(uint16_t filterNumber) {
+  return iirACoefficientConstants[filterNumber];
+}
+
+// Returns the number of A coefficients.
+uint32_t filter_getIirACoefficientCount() { return IIR_A_COEFFICIENT_COUNT; }
+
+// Returns the array of coefficients for a particular filter number.
+const double *filter_getIirBCoefficientArray(uint16_t filterNumber) {
+  return iirBCoefficientConstants[filterNumber];
+}
+
+// Returns the number of B coefficients.
+uint32_t filter_getIirBCoefficientCount() { return IIR_B_COEFFICIENT_COUNT; }
+
+// Returns the second-order sections for a particular filter number.
+const double *filter_getIirSectionArray(uint16_t filterNumber) {
+  return &iirSectionConstants[filterNumber][0][0];
+}
+
+// Returns the number of second-order sections per IIR filter.
+uint32_t filter_getIirSectionCount() { return FILTER_IIR_SECTION_COUNT; }
+
+// Returns the size of the yQueue.
+uint32_t filter_getYQueueSize() { return Y_QUEUE_SIZE; }
+
+// Returns the decimation value.
+uint16_t filter_getDecimationValue() { return FILTER_FIR_DECIMATION_FACTOR; }
+
+// Returns the address of xQueue.
+queue_t *filterState_getXQueue(filter_state_t *state) {
+  return &state->xQueue;
+}
+
+// Returns the address of yQueue.
+queue_t *filterState_getYQueue(filter_state_t *state) {
+  return &state->yQueue;
+}
+
+// Returns the address of zQueue for a specific filter number.
+queue_t *filterState_getZQueue(filter_state_t *state, uint16_t filterNumber) {
+  return &state->zQueue[filterNumber];
+}
+
+// Returns the address of the IIR output-queue for a specific filter-number.
+queue_t *filterState_getIirOutputQueue(filter_state_t *state,
+                                       uint16_t filterNumber) {
+  return &state->outputQueue[filterNumber];
+}
+
+/*******************************************************************************
+***** Default-State Functions
+*******************************************************************************/
+
+// Must call this prior to using any filter functions.
+void filter_init() { filterState_init(&defaultState); }
+
+void filter_addNewInput(double x) { filterState_addNewInput(&defaultState, x); }
+
+bool filter_addNewInputDecimated(double x) {
+  return filterState_addNewInputDecimated(&defaultState, x);
+}
+
+uint32_t filter_addNewInputBlock(const double x[], uint32_t count,
+                                 double firOutputs[]) {
+  return filterState_addNewInputBlock(&defaultState, x, count, firOutputs);
+}
+
+double filter_firFilter() { return filterState_firFilter(&defaultState); }
+
+double filter_iirFilter(uint16_t filterNumber) {
+  return filterState_iirFilter(&defaultState, filterNumber);
+}
+
+#ifndef FILTER_IIR_DIRECT_FORM
+void filter_iirFilterBlock(uint16_t filterNumber, const double firOutputs[],
+                           uint32_t count,
+                           double powerValues[][FILTER_FREQUENCY_COUNT]) {
+  filterState_iirFilterBlock(&defaultState, filterNumber, firOutputs, count,
+                             powerValues);
+}
+#endif
+
+void filter_clearIirState(uint16_t filterNumber) {
+  filterState_clearIirState(&defaultState, filterNumber);
+}
+
+double filter_computePower(uint16_t filterNumber, bool forceComputeFromScratch,
+                           bool debugPrint) {
+  return filterState_computePower(&defaultState, filterNumber,
+                                  forceComputeFromScratch, debugPrint);
+}
+
+double filter_getCurrentPowerValue(uint16_t filterNumber) {
+  return filterState_getCurrentPowerValue(&defaultState, filterNumber);
+}
+
+void filter_setCurrentPowerValue(uint16_t filterNumber, double value) {
+  filterState_setCurrentPowerValue(&defaultState, filterNumber, value);
+}
+
+void filter_getCurrentPowerValues(double powerValues[]) {
+  filterState_getCurrentPowerValues(&defaultState, powerValues);
+}
+
+void filter_getNormalizedPowerValues(double normalizedArray[],
+                                     uint16_t *indexOfMaxValue) {
+  filterState_getNormalizedPowerValues(&defaultState, normalizedArray,
+                                       indexOfMaxValue);
+}
+
+queue_t *filter_getXQueue() { return filterState_getXQueue(&defaultState); }
+
+queue_t *filter_getYQueue() { return filterState_getYQueue(&defaultState); }
+
+queue_t *filter_getZQueue(uint16_t filterNumber) {
+  return filterState_getZQueue(&defaultState, filterNumber);
+}
+
+queue_t *filter_getIirOutputQueue(uint16_t filterNumber) {
+  return filterState_getIirOutputQueue(&defaultState, filterNumber);
+}
@@ -21,6 +21,18 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define FILTER_INPUT_PULSE_WIDTH                                               \
   2000 // This is the width of the pulse you are looking for, in terms of
        // decimated sample count.
+// Each IIR filter is also available as this many cascaded second-order
+// sections of {b0, b1, b2, a1, a2} (a0 = 1); see filter_getIirSectionArray().
+#define FILTER_IIR_SECTION_COUNT 5
+#define FILTER_IIR_SECTION_COEFFICIENT_COUNT 5
+
+// filter_iirFilter() runs the sections above in transposed direct form II.
+// Uncomment to run the 10th-order direct form over yQueue and zQueue instead
+// (the structure the IIR A/B alignment tests in filterTest.c check).
+// #define FILTER_IIR_DIRECT_FORM
+// Uncomment to run the sections in single precision (the float used by the
+// NEON bank); the fixed-point version is in filterFixed.c.
+// #define FILTER_IIR_SINGLE_PRECISION
 // These are the tick counts that are used to generate the user frequencies.
 // Not used in filter.h but are used to TEST the filter code.
 // Placed here for general access as they are essentially constant throughout
@@ -43,9 +55,43 @@ static const uint16_t filter_frequencyTickTable[FILTER_FREQUENCY_COUNT] = {
 // Must call this prior to using any filter functions.
 void filter_init();
 
+// The filter's working state (queues, IIR section state, power values and the
+// decimator phase) lives in a filter_state_t. The filter_ functions work on a
+// default state held by filter.c, so single-channel code never sees one. Each
+// channel of the multi-channel detector has its own and uses the filterState_
+// functions declared after these, which take the state explicitly.
+typedef struct filter_state filter_state_t;
+
+// Allocates and initializes a filter state (as filter_init() would). Returns
+// NULL if out of memory.
+filter_state_t *filter_createState();
+
+// Frees a state from filter_createState() and its queues; NULL is ignored.
+void filter_destroyState(filter_state_t *state);
+
+// Returns the default state, the one the filter_ functions use.
+filter_state_t *filter_getDefaultState();
+
 // Use this to copy an input into the input queue of the FIR-filter (xQueue).
 void filter_addNewInput(double x);
 
+// Polyphase alternative to calling filter_addNewInput() on every input and
+// filter_firFilter() on every FILTER_FIR_DECIMATION_FACTOR-th. Adds x to
+// xQueue and folds it into the partial sums of the decimated outputs it
+// contributes to, so the FIR work is spread evenly over the inputs instead of
+// arriving as one 81-tap burst. Every FILTER_FIR_DECIMATION_FACTOR-th call
+// completes an output, pushes it onto yQueue and returns true; the output is
+// the same as filter_firFilter() would have computed at that point.
+// filter_init() resets the decimation phase.
+bool filter_addNewInputDecimated(double x);
+
+// Calls filter_addNewInputDecimated() on each of the count inputs in x[] and
+// writes the decimated outputs they complete to firOutputs[], which must have
+// room for count / FILTER_FIR_DECIMATION_FACTOR + 1. Returns how many were
+// written.
+uint32_t filter_addNewInputBlock(const double x[], uint32_t count,
+                                 double firOutputs[]);
+
 // Fills a queue with the given fillValue. For example,
 // if the queue is of size 10, and the fillValue = 1.0,
 // after executing this function, the queue will contain 10 values
@@ -60,6 +106,21 @@ double filter_firFilter();
 // Output is returned and is also pushed onto zQueue[filterNumber].
 double filter_iirFilter(uint16_t filterNumber);
 
+#ifndef FILTER_IIR_DIRECT_FORM
+// Runs IIR filter filterNumber over count FIR outputs, as filter_iirFilter()
+// followed by filter_computePower(filterNumber, false, false) for each, and
+// writes the power after each output to powerValues[i][filterNumber]. Not
+// available with the direct form, which takes its input from yQueue.
+void filter_iirFilterBlock(uint16_t filterNumber, const double firOutputs[],
+                           uint32_t count,
+                           double powerValues[][FILTER_FREQUENCY_COUNT]);
+#endif
+
+// Zeroes the state of IIR filter filterNumber. With the second-order sections
+// the state is not in zQueue, so clearing zQueue alone does not reset the
+// filter.
+void filter_clearIirState(uint16_t filterNumber);
+
 // Use this to compute the power for values contained in an outputQueue.
 // If force == true, then recompute power by using all values in the
 // outputQueue. This option is necessary so that you can correctly compute power
@@ -97,6 +158,33 @@ void filter_getCurrentPowerValues(double powerValues[]);
 void filter_getNormalizedPowerValues(double normalizedArray[],
                                      uint16_t *indexOfMaxValue);
 
+// Each of these is the filter_ function of the same name working on state
+// instead of the default state.
+void filterState_init(filter_state_t *state);
+void filterState_addNewInput(filter_state_t *state, double x);
+bool filterState_addNewInputDecimated(filter_state_t *state, double x);
+uint32_t filterState_addNewInputBlock(filter_state_t *state, const double x[],
+                                      uint32_t count, double firOutputs[]);
+double filterState_firFilter(filter_state_t *state);
+double filterState_iirFilter(filter_state_t *state, uint16_t filterNumber);
+#ifndef FILTER_IIR_DIRECT_FORM
+void filterState_iirFilterBlock(filter_state_t *state, uint16_t filterNumber,
+                                const double firOutputs[], uint32_t count,
+                                double powerValues[][FILTER_FREQUENCY_COUNT]);
+#endif
+void filterState_clearIirState(filter_state_t *state, uint16_t filterNumber);
+double filterState_computePower(filter_state_t *state, uint16_t filterNumber,
+                                bool forceComputeFromScratch, bool debugPrint);
+double filterState_getCurrentPowerValue(filter_state_t *state,
+                                        uint16_t filterNumber);
+void filterState_setCurrentPowerValue(filter_state_t *state,
+                                      uint16_t filterNumber, double value);
+void filterState_getCurrentPowerValues(filter_state_t *state,
+                                       double powerValues[]);
+void filterState_getNormalizedPowerValues(filter_state_t *state,
+                                          double normalizedArray[],
+                                          uint16_t *indexOfMaxValue);
+
 /*******************************************************************************
 ***** Verification-Assisting Functions
 ***** External test functions access the internal data structures of filter.c
@@ -121,6 +209,14 @@ const double *filter_getIirBCoefficientArray(uint16_t filterNumber);
 // Returns the number of B coefficients.
 uint32_t filter_getIirBCoefficientCount();
 
+// Returns the second-order sections for a particular filter number:
+// FILTER_IIR_SECTION_COUNT rows of FILTER_IIR_SECTION_COEFFICIENT_COUNT.
+// Cascading them matches the A and B coefficient arrays.
+const double *filter_getIirSectionArray(uint16_t filterNumber);
+
+// Returns the number of second-order sections per IIR filter.
+uint32_t filter_getIirSectionCount();
+
 // Returns the size of the yQueue.
 uint32_t filter_getYQueueSize();
 
@@ -139,4 +235,21 @@ queue_t *filter_getZQueue(uint16_t filterNumber);
 // Returns the address of the IIR output-queue for a specific filter-number.
 queue_t *filter_getIirOutputQueue(uint16_t filterNumber);
 
+// The queue getters above for a given state.
+queue_t *filterState_getXQueue(filter_state_t *state);
+queue_t *filterState_getYQueue(filter_state_t *state);
+queue_t *filterState_getZQueue(filter_state_t *state, uint16_t filterNumber);
+queue_t *filterState_getIirOutputQueue(filter_state_t *state,
+                                       uint16_t filterNumber);
+
+// Display-free checks of filter.c, in filter_test.c. Each returns true if it
+// passed.
+
+// Checks filter_addNewInputDecimated() against filter_firFilter().
+bool filter_runPolyphaseTest();
+
+// Checks the cascaded second-order sections run by filter_iirFilter() against
+// a direct-form filter built from the A and B coefficient arrays.
+bool filter_runIirSectionTest();
+
 #endif /* FILTER_H_ */
\ No newline at end of file
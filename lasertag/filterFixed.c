@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "filterFixed.h"
+
+// Section coefficients are Q29 (range +/-4; |a1| is below 2).
+#define COEFFICIENT_FRACTION_BITS 29
+// Shift from the Q30 FIR accumulator to a Q26 signal.
+#define FIR_OUTPUT_SHIFT                                                       \
+  (2 * FILTERFIXED_SAMPLE_FRACTION_BITS - FILTERFIXED_SIGNAL_FRACTION_BITS)
+// Shift from a Q26 signal to the Q15 value that goes into the power window.
+#define POWER_SHIFT                                                            \
+  (FILTERFIXED_SIGNAL_FRACTION_BITS - FILTERFIXED_SAMPLE_FRACTION_BITS)
+
+// ADC values are 12 bits with 2048 as zero; 12 bits to Q15 is 4 more.
+#define ADC_MIDSCALE 2048
+#define ADC_TO_Q15_SHIFT 4
+
+#define SECTION_B0 0
+#define SECTION_B1 1
+#define SECTION_B2 2
+#define SECTION_A1 3
+#define SECTION_A2 4
+
+// Round and shift right, for converting between Q formats.
+#define ROUND_SHIFT(value, shift) (((value) + (1LL << ((shift)-1))) >> (shift))
+
+// FIR coefficients in Q15, and a mirrored delay line holding the newest
+// input at xLine[xPos] and xLine[xPos + tapCount] (see filterSimd.c).
+static int16_t *firCoefficients;
+static filterFixed_sample_t *xLine;
+static uint32_t xPos;
+static uint32_t tapCount;
+static filterFixed_signal_t firOutput;
+
+// Q29 section coefficients and Q26 transposed direct form II state.
+static int32_t sectionCoefficients[FILTER_FREQUENCY_COUNT]
+                                  [FILTER_IIR_SECTION_COUNT]
+                                  [FILTER_IIR_SECTION_COEFFICIENT_COUNT];
+static filterFixed_signal_t sectionState[FILTER_FREQUENCY_COUNT]
+                                        [FILTER_IIR_SECTION_COUNT][2];
+
+// Power window of Q15 outputs for each filter (int32 since the IIR outputs
+// can exceed 1.0), the index of the oldest, and the energy of the window,
+// kept up to date by filterFixed_iirFilter().
+static int32_t outputWindow[FILTER_FREQUENCY_COUNT][FILTERFIXED_OUTPUT_COUNT];
+static uint32_t outputOldest[FILTER_FREQUENCY_COUNT];
+static filterFixed_energy_t runningPower[FILTER_FREQUENCY_COUNT];
+static filterFixed_energy_t currentPower[FILTER_FREQUENCY_COUNT];
+
+// Scale a double to the given number of fraction bits, rounding to nearest.
+static int64_t toFixed(double value, uint32_t fractionBits) {
+  double scaled = value * (double)(1LL << fractionBits);
+  return (int64_t)(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+// Scales the fixed-point coefficients from filter.c and zeroes all state.
+void filterFixed_init() {
+  free(firCoefficients);
+  free(xLine);
+  tapCount = filter_getFirCoefficientCount();
+  firCoefficients = (int16_t *)malloc(tapCount * sizeof(int16_t));
+  xLine = (filterFixed_sample_t *)calloc(2 * tapCount,
+                                         sizeof(filterFixed_sample_t));
+  if (firCoefficients == NULL || xLine == NULL) {
+    printf("filterFixed_init: malloc failed.\n");
+    return;
+  }
+  const double *fir = filter_getFirCoefficientArray();
+  for (uint32_t i = 0; i < tapCount; i++)
+    firCoefficients[i] = toFixed(fir[i], FILTERFIXED_SAMPLE_FRACTION_BITS);
+  xPos = 0;
+  firOutput = 0;
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    const double *sections = filter_getIirSectionArray(f);
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+      for (uint16_t c = 0; c < FILTER_IIR_SECTION_COEFFICIENT_COUNT; c++)
+        sectionCoefficients[f][s][c] =
+            toFixed(sections[s * FILTER_IIR_SECTION_COEFFICIENT_COUNT + c],
+                    COEFFICIENT_FRACTION_BITS);
+    }
+    outputOldest[f] = 0;
+    runningPower[f] = 0;
+    currentPower[f] = 0;
+  }
+  memset(sectionState, 0, sizeof(sectionState));
+  memset(outputWindow, 0, sizeof(outputWindow));
+}
+
+// Converts a 12-bit ADC value to a Q15 sample.
+filterFixed_sample_t filterFixed_getScaledAdcValue(isr_AdcValue_t adcValue) {
+  return ((int32_t)adcValue - ADC_MIDSCALE) << ADC_TO_Q15_SHIFT;
+}
+
+double filterFixed_sampleToDouble(filterFixed_sample_t sample) {
+  return (double)sample / (1 << FILTERFIXED_SAMPLE_FRACTION_BITS);
+}
+
+double filterFixed_signalToDouble(filterFixed_signal_t signal) {
+  return (double)signal / (1 << FILTERFIXED_SIGNAL_FRACTION_BITS);
+}
+
+double filterFixed_energyToDouble(filterFixed_energy_t energy) {
+  return (double)energy / (1LL << FILTERFIXED_ENERGY_FRACTION_BITS);
+}
+
+// Adds a new input to the FIR delay line.
+void filterFixed_addNewInput(filterFixed_sample_t x) {
+  xPos = (xPos == 0 ? tapCount : xPos) - 1;
+  xLine[xPos] = x;
+  xLine[xPos + tapCount] = x;
+}
+
+// Runs the FIR. The sum of |coefficient| is under 1.5, so the Q30 sum fits in
+// 32 bits.
+filterFixed_signal_t filterFixed_firFilter() {
+  const filterFixed_sample_t *x = &xLine[xPos];
+  int32_t acc = 0;
+  for (uint32_t i = 0; i < tapCount; i++)
+    acc += (int32_t)firCoefficients[i] * x[i];
+  firOutput = ROUND_SHIFT(acc, FIR_OUTPUT_SHIFT);
+  return firOutput;
+}
+
+// Runs one IIR filter as a cascade of transposed direct form II sections.
+// Each new state is summed in 64 bits and rounded once.
+filterFixed_signal_t filterFixed_iirFilter(uint16_t filterNumber) {
+  filterFixed_signal_t x = firOutput;
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+    const int32_t *c = sectionCoefficients[filterNumber][s];
+    filterFixed_signal_t *st = sectionState[filterNumber][s];
+    int64_t y = ((int64_t)st[0] << COEFFICIENT_FRACTION_BITS) +
+                (int64_t)c[SECTION_B0] * x;
+    filterFixed_signal_t out = ROUND_SHIFT(y, COEFFICIENT_FRACTION_BITS);
+    int64_t s1 = ((int64_t)st[1] << COEFFICIENT_FRACTION_BITS) +
+                 (int64_t)c[SECTION_B1] * x - (int64_t)c[SECTION_A1] * out;
+    int64_t s2 = (int64_t)c[SECTION_B2] * x - (int64_t)c[SECTION_A2] * out;
+    st[0] = ROUND_SHIFT(s1, COEFFICIENT_FRACTION_BITS);
+    st[1] = ROUND_SHIFT(s2, COEFFICIENT_FRACTION_BITS);
+    x = out;
+  }
+  // Replace the oldest output in the power window and update its energy.
+  uint32_t oldest = outputOldest[filterNumber];
+  int32_t leaving = outputWindow[filterNumber][oldest];
+  int32_t entering = ROUND_SHIFT(x, POWER_SHIFT);
+  outputWindow[filterNumber][oldest] = entering;
+  outputOldest[filterNumber] =
+      oldest + 1 == FILTERFIXED_OUTPUT_COUNT ? 0 : oldest + 1;
+  runningPower[filterNumber] +=
+      (int64_t)entering * entering - (int64_t)leaving * leaving;
+  return x;
+}
+
+// Returns the power of the outputs in the window for filterNumber. The
+// running power is exact, so forcing only recomputes the same value.
+filterFixed_energy_t filterFixed_computePower(uint16_t filterNumber,
+                                              bool forceComputeFromScratch) {
+  if (forceComputeFromScratch) {
+    const int32_t *window = outputWindow[filterNumber];
+    filterFixed_energy_t power = 0;
+    for (uint32_t i = 0; i < FILTERFIXED_OUTPUT_COUNT; i++)
+      power += (int64_t)window[i] * window[i];
+    runningPower[filterNumber] = power;
+  }
+  currentPower[filterNumber] = runningPower[filterNumber];
+  return currentPower[filterNumber];
+}
+
+// Copies the power values from the last filterFixed_computePower() calls.
+void filterFixed_getCurrentPowerValues(filterFixed_energy_t powerValues[]) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    powerValues[i] = currentPower[i];
+}
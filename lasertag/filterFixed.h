@@ -0,0 +1,80 @@
+#ifndef FILTERFIXED_H_
+#define FILTERFIXED_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "filter.h"
+#include "isr.h" // isr_AdcValue_t
+
+// Fixed-point build of the filter chain, with the same shape as filter.h:
+// decimating FIR, the IIR bank, and power over the last
+// FILTERFIXED_OUTPUT_COUNT outputs of each IIR filter. Coefficients are
+// scaled from the double tables in filter.c by filterFixed_init().
+//
+// - Inputs are Q15 (1.0 = 32768), the same range as a scaled ADC value.
+// - The FIR multiplies Q15 samples by Q15 coefficients into a 32-bit Q30
+//   accumulator.
+// - Signals between stages are Q26 in 32 bits, leaving headroom for FIR
+//   overshoot and IIR section gain.
+// - The IIR filters run as the cascaded second-order sections from
+//   filter_getIirSectionArray() with Q29 coefficients and 64-bit products;
+//   the 10th-order direct form does not survive quantization.
+// - Power is the sum of squared Q15 outputs (Q30) in 64 bits. Integer sums
+//   are exact, so the incremental power never drifts from the forced one.
+
+#define FILTERFIXED_SAMPLE_FRACTION_BITS 15
+#define FILTERFIXED_SIGNAL_FRACTION_BITS 26
+#define FILTERFIXED_ENERGY_FRACTION_BITS (2 * FILTERFIXED_SAMPLE_FRACTION_BITS)
+
+// Power is computed over this many IIR outputs, as in filter.c.
+#define FILTERFIXED_OUTPUT_COUNT 2000
+
+typedef int16_t filterFixed_sample_t; // Q15 input sample.
+typedef int32_t filterFixed_signal_t; // Q26 FIR/IIR output.
+typedef int64_t filterFixed_energy_t; // Q30 sum of squares.
+
+// Scales the fixed-point coefficients from filter.c and zeroes all state.
+// filter_init() does not need to be called first.
+void filterFixed_init();
+
+// Converts a 12-bit ADC value to a Q15 sample in [-1.0, 1.0).
+filterFixed_sample_t filterFixed_getScaledAdcValue(isr_AdcValue_t adcValue);
+
+// Converts a Q15 sample, Q26 signal or Q30 energy to double for comparison
+// with the double filter chain.
+double filterFixed_sampleToDouble(filterFixed_sample_t sample);
+double filterFixed_signalToDouble(filterFixed_signal_t signal);
+double filterFixed_energyToDouble(filterFixed_energy_t energy);
+
+// Adds a new input to the FIR delay line.
+void filterFixed_addNewInput(filterFixed_sample_t x);
+
+// Runs the FIR over the delay line. The output is returned and becomes the
+// input of the IIR filters.
+filterFixed_signal_t filterFixed_firFilter();
+
+// Runs one IIR filter on the most recent FIR output. The output is returned
+// and is also added to the filter's power window.
+filterFixed_signal_t filterFixed_iirFilter(uint16_t filterNumber);
+
+// Returns the power of the outputs in the window for filterNumber.
+// filterFixed_iirFilter() keeps a running power up to date as outputs enter
+// and leave the window; forceComputeFromScratch recomputes it from the
+// window, which gives the same value.
+filterFixed_energy_t filterFixed_computePower(uint16_t filterNumber,
+                                              bool forceComputeFromScratch);
+
+// Copies the power values from the last filterFixed_computePower() calls.
+void filterFixed_getCurrentPowerValues(filterFixed_energy_t powerValues[]);
+
+// Checks the fixed-point chain against the double chain: FIR taps within Q15
+// rounding, the same filter with the largest power, and normalized powers
+// within 1%. Returns true if it passed.
+bool filterFixed_runTest();
+
+// Times the double and fixed-point chains and prints detector invocations per
+// second for each.
+void filterFixed_runBenchmark(uint32_t clockTimerNumber);
+
+#endif /* FILTERFIXED_H_ */
@@ -0,0 +1,148 @@
+#include <math.h>
+#include <stdio.h>
+
+#include "filterFixed.h"
+#include "intervalTimer.h"
+
+#define TEST_IMPULSE 0.5                   // Q15 cannot hold 1.0.
+#define TEST_COEFFICIENT_EPSILON 3.0E-5    // Q15 rounding of a tap.
+#define TEST_NORMALIZED_POWER_EPSILON 0.01 // Of the largest power.
+#define TEST_PULSE_WIDTH_LENGTH 20000      // 200 ms at 100 kHz.
+#define TEST_ADC_MIN 0
+#define TEST_ADC_MAX 4095
+#define BENCHMARK_INPUT_COUNT 100000 // One second of input at 100 kHz.
+
+// Full-scale square wave ADC input: minimum for the first half of each
+// period, maximum after.
+static isr_AdcValue_t filterFixed_testInput(uint32_t tick,
+                                            uint16_t periodTicks) {
+  return tick % periodTicks < periodTicks / 2 ? TEST_ADC_MIN : TEST_ADC_MAX;
+}
+
+// 1. FIR impulse response: the outputs must be the FIR coefficients (scaled by
+// the impulse height).
+// 2. A full-scale square wave at each player frequency, converted through
+// filterFixed_getScaledAdcValue(), is run through both the double chain and
+// the fixed-point chain for a whole pulse width. The largest power must come
+// from the same filter (the hit decision) and every normalized power must
+// agree within TEST_NORMALIZED_POWER_EPSILON. The running fixed-point power
+// must equal a forced recomputation exactly.
+bool filterFixed_runTest() {
+  printf("starting filterFixed_runTest()\n");
+  bool passed = true;
+  filter_init();
+  filterFixed_init();
+  filterFixed_addNewInput(TEST_IMPULSE *
+                          (1 << FILTERFIXED_SAMPLE_FRACTION_BITS));
+  for (uint32_t i = 0; i < filter_getFirCoefficientCount(); i++) {
+    double firValue = filterFixed_signalToDouble(filterFixed_firFilter());
+    firValue /= TEST_IMPULSE;
+    double firGoldenOutput = filter_getFirCoefficientArray()[i];
+    if (fabs(firValue - firGoldenOutput) > TEST_COEFFICIENT_EPSILON) {
+      passed = false;
+      printf("filterFixed_runTest: FIR impulse output(%le) does not match "
+             "coefficient(%le) at index(%lu).\n",
+             firValue, firGoldenOutput, (unsigned long)i);
+    }
+    filterFixed_addNewInput(0); // Shift the impulse over one position.
+  }
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    filter_init();
+    filterFixed_init();
+    for (uint32_t i = 0; i < TEST_PULSE_WIDTH_LENGTH; i++) {
+      filterFixed_sample_t sample = filterFixed_getScaledAdcValue(
+          filterFixed_testInput(i, filter_frequencyTickTable[f]));
+      filterFixed_addNewInput(sample);
+      if (!filter_addNewInputDecimated(filterFixed_sampleToDouble(sample)))
+        continue;
+      filterFixed_firFilter();
+      for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++) {
+        filter_iirFilter(j);
+        filterFixed_iirFilter(j);
+      }
+    }
+    double goldenPower[FILTER_FREQUENCY_COUNT];
+    double fixedPower[FILTER_FREQUENCY_COUNT];
+    uint16_t goldenMax = 0;
+    uint16_t fixedMax = 0;
+    for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++) {
+      goldenPower[j] = filter_computePower(j, true, false);
+      filterFixed_energy_t running = filterFixed_computePower(j, false);
+      filterFixed_energy_t forced = filterFixed_computePower(j, true);
+      if (running != forced) {
+        passed = false;
+        printf("filterFixed_runTest: frequency %u, filter %u running power "
+               "%lld != forced power %lld.\n",
+               f, j, (long long)running, (long long)forced);
+      }
+      fixedPower[j] = filterFixed_energyToDouble(forced);
+      goldenMax = goldenPower[j] > goldenPower[goldenMax] ? j : goldenMax;
+      fixedMax = fixedPower[j] > fixedPower[fixedMax] ? j : fixedMax;
+    }
+    if (fixedMax != goldenMax) {
+      passed = false;
+      printf("filterFixed_runTest: frequency %u, largest power in filter %u, "
+             "should be %u.\n",
+             f, fixedMax, goldenMax);
+    }
+    for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++) {
+      double error = fabs(fixedPower[j] / fixedPower[fixedMax] -
+                          goldenPower[j] / goldenPower[goldenMax]);
+      if (error > TEST_NORMALIZED_POWER_EPSILON) {
+        passed = false;
+        printf("filterFixed_runTest: frequency %u, filter %u normalized power "
+               "off by %le.\n",
+               f, j, error);
+      }
+    }
+  }
+  filter_init(); // Leave the double path in a known state.
+  printf("filterFixed_runTest %s.\n", passed ? "passed" : "failed");
+  return passed;
+}
+
+// Times BENCHMARK_INPUT_COUNT inputs through the double chain and the
+// fixed-point chain the way the detector runs them: every input goes into the
+// FIR delay line, and every decimated input runs the FIR, all of the IIR
+// filters and the power computation.
+void filterFixed_runBenchmark(uint32_t clockTimerNumber) {
+  double seconds[2];
+  for (uint16_t fixed = 0; fixed < 2; fixed++) {
+    filter_init();
+    filterFixed_init();
+    uint16_t decimationCount = 0;
+    intervalTimer_initCountUp(clockTimerNumber);
+    intervalTimer_start(clockTimerNumber);
+    for (uint32_t i = 0; i < BENCHMARK_INPUT_COUNT; i++) {
+      isr_AdcValue_t adcValue =
+          filterFixed_testInput(i, filter_frequencyTickTable[0]);
+      if (fixed)
+        filterFixed_addNewInput(filterFixed_getScaledAdcValue(adcValue));
+      else
+        filter_addNewInput(adcValue == TEST_ADC_MIN ? -1.0 : 1.0);
+      if (++decimationCount < filter_getDecimationValue())
+        continue;
+      decimationCount = 0;
+      if (fixed)
+        filterFixed_firFilter();
+      else
+        filter_firFilter();
+      for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++) {
+        if (fixed) {
+          filterFixed_iirFilter(j);
+          filterFixed_computePower(j, false);
+        } else {
+          filter_iirFilter(j);
+          filter_computePower(j, false, false);
+        }
+      }
+    }
+    intervalTimer_stop(clockTimerNumber);
+    seconds[fixed] = intervalTimer_getTotalDurationInSeconds(clockTimerNumber);
+  }
+  printf("double chain: %.0lf invocations/s\n",
+         BENCHMARK_INPUT_COUNT / seconds[0]);
+  printf("fixed-point chain: %.0lf invocations/s\n",
+         BENCHMARK_INPUT_COUNT / seconds[1]);
+  filter_init();
+}
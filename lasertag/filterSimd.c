@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#include "filterSimd.h"
+
+// Section coefficient order, matching filter_getIirSectionArray().
+#define SECTION_B0 0
+#define SECTION_B1 1
+#define SECTION_B2 2
+#define SECTION_A1 3
+#define SECTION_A2 4
+
+// Transposed direct form II state words.
+#define STATE_S1 0
+#define STATE_S2 1
+
+// FIR coefficients in float, and a mirrored delay line of twice the tap count
+// holding the newest input at xLine[xPos] (and xLine[xPos + tapCount]), so
+// &xLine[xPos] is always the last tapCount inputs newest first and lines up
+// with the coefficients.
+static float *firCoefficients;
+static float *xLine;
+static uint32_t xPos;
+static uint32_t tapCount;
+
+// Most recent FIR output, and the IIR bank it feeds.
+static float firOutput;
+static filterSimd_iirBank_t iirBank;
+
+// Loads the section coefficients from filter.c and zeroes the state.
+void filterSimd_initIirBank(filterSimd_iirBank_t *bank) {
+  memset(bank, 0, sizeof(*bank));
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    const double *sections = filter_getIirSectionArray(f);
+    uint16_t group = f / FILTERSIMD_LANE_COUNT;
+    uint16_t lane = f % FILTERSIMD_LANE_COUNT;
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+      for (uint16_t c = 0; c < FILTER_IIR_SECTION_COEFFICIENT_COUNT; c++)
+        bank->coeff[group][s][c][lane] =
+            (float)sections[s * FILTER_IIR_SECTION_COEFFICIENT_COUNT + c];
+    }
+  }
+}
+
+// Scalar reference dot product.
+float filterSimd_dotProductScalar(const float a[], const float b[],
+                                  uint32_t count) {
+  float sum = 0.0f;
+  for (uint32_t i = 0; i < count; i++)
+    sum += a[i] * b[i];
+  return sum;
+}
+
+// Dot product. The NEON version keeps two accumulators so consecutive
+// multiply-accumulates do not wait on each other.
+float filterSimd_dotProduct(const float a[], const float b[], uint32_t count) {
+#ifdef __ARM_NEON
+  float32x4_t acc0 = vdupq_n_f32(0.0f);
+  float32x4_t acc1 = vdupq_n_f32(0.0f);
+  uint32_t i = 0;
+  for (; i + 2 * FILTERSIMD_LANE_COUNT <= count;
+       i += 2 * FILTERSIMD_LANE_COUNT) {
+    acc0 = vmlaq_f32(acc0, vld1q_f32(&a[i]), vld1q_f32(&b[i]));
+    acc1 = vmlaq_f32(acc1, vld1q_f32(&a[i + FILTERSIMD_LANE_COUNT]),
+                     vld1q_f32(&b[i + FILTERSIMD_LANE_COUNT]));
+  }
+  if (i + FILTERSIMD_LANE_COUNT <= count) {
+    acc0 = vmlaq_f32(acc0, vld1q_f32(&a[i]), vld1q_f32(&b[i]));
+    i += FILTERSIMD_LANE_COUNT;
+  }
+  float32x4_t acc = vaddq_f32(acc0, acc1);
+  float32x2_t pair = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+  float sum = vget_lane_f32(vpadd_f32(pair, pair), 0);
+  for (; i < count; i++)
+    sum += a[i] * b[i];
+  return sum;
+#else
+  return filterSimd_dotProductScalar(a, b, count);
+#endif
+}
+
+// Scalar reference IIR bank: each lane's cascade, one section at a time, with
+// the same operation order as the NEON version.
+void filterSimd_iirBankFilterScalar(filterSimd_iirBank_t *bank, float input,
+                                    float output[]) {
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    uint16_t group = f / FILTERSIMD_LANE_COUNT;
+    uint16_t lane = f % FILTERSIMD_LANE_COUNT;
+    float x = input;
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+      float(*c)[FILTERSIMD_LANE_COUNT] = bank->coeff[group][s];
+      float(*st)[FILTERSIMD_LANE_COUNT] = bank->state[group][s];
+      float y = st[STATE_S1][lane] + c[SECTION_B0][lane] * x;
+      st[STATE_S1][lane] = (st[STATE_S2][lane] + c[SECTION_B1][lane] * x) -
+                           c[SECTION_A1][lane] * y;
+      st[STATE_S2][lane] = c[SECTION_B2][lane] * x - c[SECTION_A2][lane] * y;
+      x = y;
+    }
+    output[f] = x;
+  }
+}
+
+// IIR bank. The NEON version runs four filters per instruction; section s of
+// every filter in a group is advanced together.
+void filterSimd_iirBankFilter(filterSimd_iirBank_t *bank, float input,
+                              float output[]) {
+#ifdef __ARM_NEON
+  float32x4_t in = vdupq_n_f32(input);
+  for (uint16_t group = 0; group < FILTERSIMD_GROUP_COUNT; group++) {
+    float32x4_t x = in;
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+      float(*c)[FILTERSIMD_LANE_COUNT] = bank->coeff[group][s];
+      float(*st)[FILTERSIMD_LANE_COUNT] = bank->state[group][s];
+      float32x4_t s1 = vld1q_f32(st[STATE_S1]);
+      float32x4_t s2 = vld1q_f32(st[STATE_S2]);
+      float32x4_t y = vmlaq_f32(s1, vld1q_f32(c[SECTION_B0]), x);
+      s1 = vmlsq_f32(vmlaq_f32(s2, vld1q_f32(c[SECTION_B1]), x),
+                     vld1q_f32(c[SECTION_A1]), y);
+      s2 = vmlsq_f32(vmulq_f32(vld1q_f32(c[SECTION_B2]), x),
+                     vld1q_f32(c[SECTION_A2]), y);
+      vst1q_f32(st[STATE_S1], s1);
+      vst1q_f32(st[STATE_S2], s2);
+      x = y;
+    }
+    float lanes[FILTERSIMD_LANE_COUNT];
+    vst1q_f32(lanes, x);
+    for (uint16_t lane = 0; lane < FILTERSIMD_LANE_COUNT; lane++) {
+      uint16_t f = group * FILTERSIMD_LANE_COUNT + lane;
+      if (f < FILTER_FREQUENCY_COUNT)
+        output[f] = lanes[lane];
+    }
+  }
+#else
+  filterSimd_iirBankFilterScalar(bank, input, output);
+#endif
+}
+
+// Allocates the float FIR delay line and coefficients, and initializes the
+// IIR bank.
+void filterSimd_init() {
+  free(firCoefficients);
+  free(xLine);
+  tapCount = filter_getFirCoefficientCount();
+  firCoefficients = (float *)malloc(tapCount * sizeof(float));
+  xLine = (float *)calloc(2 * tapCount, sizeof(float));
+  if (firCoefficients == NULL || xLine == NULL) {
+    printf("filterSimd_init: malloc failed.\n");
+    return;
+  }
+  const double *coefficients = filter_getFirCoefficientArray();
+  for (uint32_t i = 0; i < tapCount; i++)
+    firCoefficients[i] = (float)coefficients[i];
+  xPos = 0;
+  firOutput = 0.0f;
+  filterSimd_initIirBank(&iirBank);
+}
+
+// Adds a new input to the FIR delay line.
+void filterSimd_addNewInput(float x) {
+  xPos = (xPos == 0 ? tapCount : xPos) - 1;
+  xLine[xPos] = x;
+  xLine[xPos + tapCount] = x;
+}
+
+// Runs the FIR over the delay line.
+float filterSimd_firFilter() {
+  firOutput = filterSimd_dotProduct(firCoefficients, &xLine[xPos], tapCount);
+  return firOutput;
+}
+
+// Runs all of the IIR filters on the most recent FIR output.
+void filterSimd_iirFilters(float output[]) {
+  filterSimd_iirBankFilter(&iirBank, firOutput, output);
+}
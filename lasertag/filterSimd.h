@@ -0,0 +1,71 @@
+#ifndef FILTERSIMD_H_
+#define FILTERSIMD_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "filter.h"
+
+// Single-precision versions of the decimating FIR and the IIR bank for the
+// Cortex-A9 NEON unit, which has no double-precision SIMD. The FIR is a
+// four-wide dot product over a mirrored float delay line. The IIR filters run
+// as the cascaded second-order sections from filter_getIirSectionArray() (the
+// 10th-order direct form is not stable in single precision), interleaved so
+// that lane l of group g is filter 4g+l and one vector instruction advances
+// four filters. filterSimd.c is built with -mfpu=neon on the board; when
+// __ARM_NEON is not defined (the emulator) the kernels use the scalar
+// reference versions instead.
+
+#define FILTERSIMD_LANE_COUNT 4
+#define FILTERSIMD_GROUP_COUNT                                                 \
+  ((FILTER_FREQUENCY_COUNT + FILTERSIMD_LANE_COUNT - 1) / FILTERSIMD_LANE_COUNT)
+
+// Coefficients and transposed direct form II state for the whole IIR bank,
+// laid out lane-interleaved. The spare lanes of the last group have zero
+// coefficients and always output 0.
+typedef struct {
+  float coeff[FILTERSIMD_GROUP_COUNT][FILTER_IIR_SECTION_COUNT]
+             [FILTER_IIR_SECTION_COEFFICIENT_COUNT][FILTERSIMD_LANE_COUNT];
+  float state[FILTERSIMD_GROUP_COUNT][FILTER_IIR_SECTION_COUNT][2]
+             [FILTERSIMD_LANE_COUNT];
+} filterSimd_iirBank_t;
+
+// Loads the section coefficients from filter.c and zeroes the state.
+void filterSimd_initIirBank(filterSimd_iirBank_t *bank);
+
+// Returns the sum of a[i] * b[i] for i < count.
+float filterSimd_dotProduct(const float a[], const float b[], uint32_t count);
+
+// Scalar reference for filterSimd_dotProduct().
+float filterSimd_dotProductScalar(const float a[], const float b[],
+                                  uint32_t count);
+
+// Advances every filter in the bank by one input. output[f] receives the
+// output of filter f, for f < FILTER_FREQUENCY_COUNT.
+void filterSimd_iirBankFilter(filterSimd_iirBank_t *bank, float input,
+                              float output[]);
+
+// Scalar reference for filterSimd_iirBankFilter().
+void filterSimd_iirBankFilterScalar(filterSimd_iirBank_t *bank, float input,
+                                    float output[]);
+
+// Allocates the float FIR delay line and coefficients, and initializes the
+// IIR bank. Must be called after filter_init() and before the functions below.
+void filterSimd_init();
+
+// Adds a new input to the FIR delay line (the float filter_addNewInput()).
+void filterSimd_addNewInput(float x);
+
+// Runs the FIR over the delay line and returns the output, which is also the
+// input for the next filterSimd_iirFilters() call.
+float filterSimd_firFilter();
+
+// Runs all of the IIR filters on the most recent FIR output. output[f]
+// receives the output of filter f.
+void filterSimd_iirFilters(float output[]);
+
+// Checks the float kernels against the double filter chain, and the vector
+// kernels against the scalar references. Returns true if it passed.
+bool filterSimd_runTest();
+
+#endif /* FILTERSIMD_H_ */
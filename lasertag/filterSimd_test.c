@@ -0,0 +1,80 @@
+#include <math.h>
+#include <stdio.h>
+
+#include "filterSimd.h"
+
+#define TEST_COEFFICIENT_EPSILON 1.0E-6 // float rounding of a tap.
+#define TEST_LANE_EPSILON 1.0E-5        // Vector versus scalar float.
+#define TEST_GOLDEN_EPSILON 1.0E-4      // float versus double path.
+#define TEST_INPUTS_PER_FREQUENCY 4000
+
+// Square wave input: -1.0 for the first half of each period, 1.0 after.
+static double filterSimd_testInput(uint32_t tick, uint16_t periodTicks) {
+  return tick % periodTicks < periodTicks / 2 ? -1.0 : 1.0;
+}
+
+// 1. FIR impulse response: the outputs must be the FIR coefficients.
+// 2. A square wave at each player frequency is run through the double
+// pipeline (filter_addNewInputDecimated() and filter_iirFilter()), the float
+// pipeline, and a second IIR bank driven by the scalar reference kernel. Float
+// FIR and IIR outputs must match the double outputs within
+// TEST_GOLDEN_EPSILON, and the vector and scalar IIR banks must match each
+// other within TEST_LANE_EPSILON.
+bool filterSimd_runTest() {
+  printf("starting filterSimd_runTest()\n");
+  bool passed = true;
+  filter_init();
+  filterSimd_init();
+  filterSimd_addNewInput(1.0f); // Single 1.0 in the delay line.
+  for (uint32_t i = 0; i < filter_getFirCoefficientCount(); i++) {
+    double firValue = filterSimd_firFilter();
+    double firGoldenOutput = filter_getFirCoefficientArray()[i];
+    if (fabs(firValue - firGoldenOutput) > TEST_COEFFICIENT_EPSILON) {
+      passed = false;
+      printf("filterSimd_runTest: FIR impulse output(%le) does not match "
+             "coefficient(%le) at index(%lu).\n",
+             firValue, firGoldenOutput, (unsigned long)i);
+    }
+    filterSimd_addNewInput(0.0f); // Shift the 1.0 over one position.
+  }
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    filter_init();
+    filterSimd_init();
+    filterSimd_iirBank_t scalarBank;
+    filterSimd_initIirBank(&scalarBank);
+    double maxGoldenError = 0.0;
+    double maxLaneError = 0.0;
+    for (uint32_t i = 0; i < TEST_INPUTS_PER_FREQUENCY; i++) {
+      double input = filterSimd_testInput(i, filter_frequencyTickTable[f]);
+      filterSimd_addNewInput((float)input);
+      if (!filter_addNewInputDecimated(input))
+        continue;
+      float firValue = filterSimd_firFilter();
+      queue_t *yQueue = filter_getYQueue();
+      double firGolden =
+          queue_readElementAt(yQueue, queue_elementCount(yQueue) - 1);
+      maxGoldenError = fmax(maxGoldenError, fabs(firValue - firGolden));
+      float vectorOutput[FILTER_FREQUENCY_COUNT];
+      float scalarOutput[FILTER_FREQUENCY_COUNT];
+      filterSimd_iirFilters(vectorOutput);
+      filterSimd_iirBankFilterScalar(&scalarBank, firValue, scalarOutput);
+      for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++) {
+        double iirGolden = filter_iirFilter(j);
+        maxGoldenError =
+            fmax(maxGoldenError, fabs(vectorOutput[j] - iirGolden));
+        maxLaneError =
+            fmax(maxLaneError, fabs(vectorOutput[j] - scalarOutput[j]));
+      }
+    }
+    if (maxGoldenError > TEST_GOLDEN_EPSILON ||
+        maxLaneError > TEST_LANE_EPSILON) {
+      passed = false;
+      printf("filterSimd_runTest: frequency %u, max error against double "
+             "%le, vector against scalar %le.\n",
+             f, maxGoldenError, maxLaneError);
+    }
+  }
+  filter_init(); // Leave the double path in a known state.
+  printf("filterSimd_runTest %s.\n", passed ? "passed" : "failed");
+  return passed;
+}
@@ -25,6 +25,8 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #endif
 
 #include "filter.h"
+#include "filterFixed.h"
+#include "filterSimd.h"
 #include "histogram.h"
 #include "utils.h"
 
@@ -545,6 +547,7 @@ void filterTest_runSquareWaveIirPowerTest(uint16_t filterNumber,
     filterTest_fillQueue(
         filter_getZQueue(filterNumber),
         0.0); // zero out the z-queue for the IIR filter under test.
+    filter_clearIirState(filterNumber); // And the second-order sections.
     uint16_t currentPeriodTickCount =
         filterTest_firTestTickCounts[testPeriodIndex]; // You will be generating
                                                        // a frequency with this
@@ -981,6 +984,13 @@ bool filterTest_runTest() {
   success &= filterTest_runFirAlignmentTest(PRINT_INFO_MESSAGES);
   // Confirm that the FIR properly computes its output.
   success &= filterTest_runFirArithmeticTest(PRINT_INFO_MESSAGES);
+  // Confirm that the polyphase decimator computes the same outputs.
+  success &= filter_runPolyphaseTest();
+  // Confirm that the single-precision (NEON) kernels match the double path.
+  success &= filterSimd_runTest();
+  // Confirm that the fixed-point chain makes the same hit decisions.
+  success &= filterFixed_runTest();
+#ifdef FILTER_IIR_DIRECT_FORM
   // Confirm that the IIR A coefficients are properly aligned with the incoming
   // data.
   success &= filterTest_runIirAAlignmentTest(TEST_IIR_FILTER_NUMBER,
@@ -989,6 +999,10 @@ bool filterTest_runTest() {
   // data.
   success &= filterTest_runIirBAlignmentTest(TEST_IIR_FILTER_NUMBER,
                                              PRINT_INFO_MESSAGES);
+#else
+  // Confirm that the second-order sections match the A and B coefficients.
+  success &= filter_runIirSectionTest();
+#endif
   // Verifies correct functionality of the power computation.
   success &= filterTest_runPowerTest();
   // Plots the frequency response of the FIR filter against all user and other
@@ -0,0 +1,99 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "filter.h"
+
+// Largest difference between two computations of the same double output.
+#define TEST_EPSILON 1.0E-12
+#define POLYPHASE_TEST_RANDOM_INPUT_COUNT 2000
+#define IIR_SECTION_TEST_OUTPUT_COUNT 500
+#ifdef FILTER_IIR_SINGLE_PRECISION
+#define IIR_SECTION_TEST_EPSILON 1.0E-4
+#else
+#define IIR_SECTION_TEST_EPSILON 1.0E-6 // The direct-form reference drifts too.
+#endif
+
+// Returns the value most recently added to the queue, or 0 if it is empty.
+static queue_data_t filter_readMostRecentValue(queue_t *q) {
+  if (queue_empty(q))
+    return 0.0;
+  return queue_readElementAt(q, queue_elementCount(q) - 1);
+}
+
+// Feeds a run of 1.0 inputs (one per FIR tap) followed by random inputs. Each
+// time the polyphase decimator completes an output, the same output is
+// recomputed from xQueue with filter_firFilter() and the two must agree.
+bool filter_runPolyphaseTest() {
+  printf("starting filter_runPolyphaseTest()\n");
+  bool passed = true;
+  filter_init(); // Zeroes xQueue and resets the decimation phase.
+  uint32_t inputCount =
+      filter_getFirCoefficientCount() + POLYPHASE_TEST_RANDOM_INPUT_COUNT;
+  uint32_t outputCount = 0;
+  for (uint32_t i = 0; i < inputCount; i++) {
+    double input = i < filter_getFirCoefficientCount()
+                       ? 1.0
+                       : ((double)rand() / (double)RAND_MAX) * 2.0 - 1.0;
+    if (!filter_addNewInputDecimated(input))
+      continue;
+    outputCount++;
+    double polyphaseValue = filter_readMostRecentValue(filter_getYQueue());
+    double firValue = filter_firFilter(); // Golden value from xQueue.
+    if (fabs(polyphaseValue - firValue) >= TEST_EPSILON) {
+      passed = false;
+      printf("filter_runPolyphaseTest: polyphase output(%24.20le) does not "
+             "match FIR output(%24.20le) at input(%lu).\n",
+             polyphaseValue, firValue, (unsigned long)i);
+    }
+  }
+  if (outputCount != inputCount / filter_getDecimationValue()) {
+    passed = false;
+    printf("filter_runPolyphaseTest: %lu outputs for %lu inputs.\n",
+           (unsigned long)outputCount, (unsigned long)inputCount);
+  }
+  filter_init(); // Leave the filters in a known state.
+  printf("filter_runPolyphaseTest %s.\n", passed ? "passed" : "failed");
+  return passed;
+}
+
+// Random inputs are pushed onto yQueue and every output of each filter is
+// compared with a direct-form reference computed here from
+// filter_getIirACoefficientArray() and filter_getIirBCoefficientArray().
+bool filter_runIirSectionTest() {
+  printf("starting filter_runIirSectionTest()\n");
+  bool passed = true;
+  filter_init();
+  uint32_t bCount = filter_getIirBCoefficientCount();
+  uint32_t aCount = filter_getIirACoefficientCount();
+  double inputs[IIR_SECTION_TEST_OUTPUT_COUNT];
+  for (uint32_t i = 0; i < IIR_SECTION_TEST_OUTPUT_COUNT; i++)
+    inputs[i] = 2.0 * rand() / RAND_MAX - 1.0;
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    const double *b = filter_getIirBCoefficientArray(f);
+    const double *a = filter_getIirACoefficientArray(f);
+    double outputs[IIR_SECTION_TEST_OUTPUT_COUNT];
+    filter_fillQueue(filter_getYQueue(), 0.0);
+    filter_clearIirState(f);
+    double maxError = 0.0;
+    for (uint32_t n = 0; n < IIR_SECTION_TEST_OUTPUT_COUNT; n++) {
+      queue_overwritePush(filter_getYQueue(), inputs[n]);
+      double golden = 0.0;
+      for (uint32_t k = 0; k < bCount && k <= n; k++)
+        golden += b[k] * inputs[n - k];
+      for (uint32_t k = 0; k < aCount && k < n; k++)
+        golden -= a[k] * outputs[n - 1 - k];
+      outputs[n] = golden;
+      maxError = fmax(maxError, fabs(filter_iirFilter(f) - golden));
+    }
+    if (maxError > IIR_SECTION_TEST_EPSILON) {
+      passed = false;
+      printf("filter_runIirSectionTest: IIR filter[%u] differs from its A/B "
+             "coefficients by %le.\n",
+             f, maxError);
+    }
+  }
+  filter_init(); // Leave the filters in a known state.
+  printf("filter_runIirSectionTest %s.\n", passed ? "passed" : "failed");
+  return passed;
+}
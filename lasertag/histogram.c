@@ -26,17 +26,16 @@ static uint16_t topLabelMaxWidthInChars; // How many chars will be printed.
 static histogram_data_t
     currentBarData[HISTOGRAM_MAX_BAR_COUNT]; // Current histogram data.
 static histogram_data_t
-    previousBarData[HISTOGRAM_MAX_BAR_COUNT]; // Keep the old stuff around so
-                                              // you can erase things properly.
+    drawnBarData[HISTOGRAM_MAX_BAR_COUNT]; // Height of each bar on the TFT, so
+                                           // only the difference is drawn.
 static char
     topLabel[HISTOGRAM_MAX_BAR_COUNT]
             [HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS]; // Labels at top of
                                                           // histogram bars.
-static char
-    oldTopLabel[HISTOGRAM_MAX_BAR_COUNT]
-               [HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS]; // Old label so you
-                                                             // only update as
-                                                             // necessary.
+// Label on the TFT above each bar (empty if none), so only the characters
+// that change are drawn.
+static char drawnTopLabel[HISTOGRAM_MAX_BAR_COUNT]
+                         [HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS];
 
 #define ONE_HALF(x) ((x) / 2) // Integer divide by 2.
 
@@ -116,9 +115,9 @@ void histogram_init(uint16_t barCount) {
           : HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS - 1;
   for (int i = 0; i < histogram_barCount; i++) {
     currentBarData[i] = 0;
-    previousBarData[i] = 0;
-    topLabel[i][0] = 0;    // Start out with empty strings.
-    oldTopLabel[i][0] = 0; // Start out with empty strings.
+    drawnBarData[i] = 0;
+    topLabel[i][0] = 0;      // Start out with empty strings.
+    drawnTopLabel[i][0] = 0; // Start out with empty strings.
   }
   for (int i = 0; i < HISTOGRAM_MAX_BAR_COUNT; i++) {
     strncpy(histogram_label[i], histogram_defaultLabel[i],
@@ -167,122 +166,139 @@ bool histogram_setBarData(histogram_index_t barIndex, histogram_data_t data,
            data, HISTOGRAM_MAX_BAR_DATA_IN_PIXELS - 1, barIndex);
     return false;
   }
-  // If it has changed, update the data in the array but don't render anything
-  // on the display.
-  if (data !=
-      currentBarData[barIndex]) { // Only modify the data if it has changed.
-    previousBarData[barIndex] =
-        currentBarData[barIndex]; // Save the old data so you render things
-                                  // properly.
-    // Copy the old string so that you can render things properly.
-    currentBarData[barIndex] = data; // Store the data because it changed.
-  }
-  // If the label has changed, move the previous data to old, new data to
-  // current. Labels are handled separately from data because the label may
-  // change even if the underlying bar data does not. This allows the top label
-  // to change and to be redrawn even if the bars stay the same height.
-  if (strncmp(barTopLabel, topLabel[barIndex],
-              HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS)) {
-    // If you get here, the new label is different from the last one.
-    strncpy(oldTopLabel[barIndex], topLabel[barIndex],
-            HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-    // Copy the current label to become the new old label.
-    strncpy(topLabel[barIndex], barTopLabel,
-            HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-    // Copy the new label to become the current label.
-    uint16_t barTopLabelLength =
-        strlen(barTopLabel); // Get the length of the label.
-    // Only copy as many characters as will fit in the available screen space.
-    uint16_t charCopyLimit = (barTopLabelLength < topLabelMaxWidthInChars)
-                                 ? barTopLabelLength
-                                 : topLabelMaxWidthInChars;
-    for (uint16_t i = 0; i < charCopyLimit; i++)
-      topLabel[barIndex][i] = barTopLabel[i];
-    // Null terminate the string in any case.
-    topLabel[barIndex][charCopyLimit] = 0;
-  }
+  // Only store the data; histogram_updateDisplay() compares it with what is
+  // on the TFT and draws the difference.
+  currentBarData[barIndex] = data;
+  // Only copy as many characters as will fit in the available screen space.
+  uint16_t barTopLabelLength = strlen(barTopLabel);
+  uint16_t charCopyLimit = (barTopLabelLength < topLabelMaxWidthInChars)
+                               ? barTopLabelLength
+                               : topLabelMaxWidthInChars;
+  for (uint16_t i = 0; i < charCopyLimit; i++)
+    topLabel[barIndex][i] = barTopLabel[i];
+  // Null terminate the string in any case.
+  topLabel[barIndex][charCopyLimit] = 0;
   return true; // Everything is OK.
 }
 
+// Pixels in one character of a top label.
+#define TOP_LABEL_CHAR_PIXELS                                                  \
+  (DISPLAY_CHAR_WIDTH * DISPLAY_CHAR_HEIGHT * TOP_LABEL_TEXT_SIZE *            \
+   TOP_LABEL_TEXT_SIZE)
+
+// Left edge of a bar.
+static int16_t histogram_barX(uint16_t barIndex) {
+  return barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP);
+}
+
+// Top row of a bar of height data. A bar covers the rows from here down to,
+// but not including, the row above the bottom labels, so it is data - 1
+// pixels tall.
+static int16_t histogram_barTop(histogram_data_t data) {
+  return display_height() - HISTOGRAM_BAR_Y_GAP - (data ? data : 1);
+}
+
+// Top row of the label above a bar of height data.
+static int16_t histogram_topLabelY(histogram_data_t data) {
+  return display_height() - data - HISTOGRAM_BAR_Y_GAP - DISPLAY_CHAR_HEIGHT -
+         1;
+}
+
+// Fills rows top to bottom - 1 across the width of a bar. Returns the number
+// of pixels written.
+static uint32_t histogram_fillRows(uint16_t barIndex, int16_t top,
+                                   int16_t bottom, uint16_t color) {
+  if (bottom <= top)
+    return 0;
+  display_fillRect(histogram_barX(barIndex), top, histogram_barWidth,
+                   bottom - top, color);
+  return (uint32_t)histogram_barWidth * (bottom - top);
+}
+
 // Internal helper function.
-// Erases the old text (using a fillRect because it is small and fast) to erase
-// the old label, if required. Finds the position for the label, just above the
-// top of the bar.
-void histogram_drawTopLabel(uint16_t barIndex, histogram_data_t data,
-                            const char topLabel[], bool eraseOldLabel) {
-  if (eraseOldLabel) {
-    // Erase with a fillRect because the rect is small and should be faster than
-    // hitting individual label pixels.
-    display_fillRect(barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
-                     display_height() - data - HISTOGRAM_BAR_Y_GAP -
-                         DISPLAY_CHAR_HEIGHT - 1,
-                     histogram_barWidth, DISPLAY_CHAR_HEIGHT, DISPLAY_BLACK);
+// Draws the top label above a bar of height data. If a label of the same
+// length is already drawn there, only the characters that differ are drawn;
+// characters are drawn with a black background, so nothing needs erasing.
+// Returns the number of pixels written.
+static uint32_t histogram_drawTopLabel(uint16_t barIndex,
+                                       histogram_data_t data) {
+  const char *label = topLabel[barIndex];
+  char *drawnLabel = drawnTopLabel[barIndex];
+  uint16_t length = strlen(label);
+  int16_t y = histogram_topLabelY(data);
+  uint32_t pixels = 0;
+  // A label of another length is centered differently, so start over.
+  bool sameLength = strlen(drawnLabel) == length;
+  if (!sameLength && drawnLabel[0] != 0)
+    pixels += histogram_fillRows(barIndex, y, y + DISPLAY_CHAR_HEIGHT,
+                                 DISPLAY_BLACK);
+  int16_t x = histogram_barX(barIndex) +
+              ONE_HALF(histogram_barWidth - length * DISPLAY_CHAR_WIDTH);
+  for (uint16_t i = 0; i < length; i++) {
+    if (sameLength && label[i] == drawnLabel[i])
+      continue;
+    display_drawChar(x + i * DISPLAY_CHAR_WIDTH * TOP_LABEL_TEXT_SIZE, y,
+                     label[i], histogram_barTopLabelColors[barIndex],
+                     DISPLAY_BLACK, TOP_LABEL_TEXT_SIZE);
+    pixels += TOP_LABEL_CHAR_PIXELS;
   }
-  uint16_t topLabelXOffset = ONE_HALF(
-      histogram_barWidth -
-      (strlen(topLabel) *
-       DISPLAY_CHAR_WIDTH)); // This helps to center the label over the bar.
-  display_setCursor(
-      barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP) +
-          topLabelXOffset, // This is the location of the top label.
-      display_height() - data - HISTOGRAM_BAR_Y_GAP - DISPLAY_CHAR_HEIGHT - 1);
-  display_setTextSize(TOP_LABEL_TEXT_SIZE); // Use tiny text to pack more
-                                            // characters into the label.
-  display_setTextColor(
-      histogram_barTopLabelColors[barIndex]); // Set the color of the label.
-  display_print(topLabel);                    // Draw the label.
+  strncpy(drawnLabel, label, HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
+  return pixels;
 }
 
-// This updates the display.
-// It loops across all bars, checking:
-// If the height of the bar has changed, redraw both the bar and the top label.
+// Draws the change to one bar since it was last drawn and returns the number
+// of pixels written:
+// If the height of the bar has changed, erase the top label, then extend the
+// bar or erase its top by the difference in height only, and draw the label
+// at the new height.
 // If the height of the bar has not changed, but the top label has changed,
-// update the label.
-void histogram_updateDisplay() {
+// draw the characters of the label that changed.
+// A bar whose height and label are unchanged is not touched.
+uint32_t histogram_updateBar(histogram_index_t barIndex) {
+  if (!initFlag || barIndex >= histogram_barCount) {
+    printf("Error! histogram_updateBar(): call histogram_init() first, and "
+           "barIndex(%d) must be less than %d.\n",
+           barIndex, histogram_barCount);
+    return 0;
+  }
+  uint16_t i = barIndex;
+  uint32_t pixels = 0;
+  histogram_data_t oldData = drawnBarData[i]; // Height on the TFT.
+  histogram_data_t data = currentBarData[i];  // Get the current bar data.
+  if (oldData != data) {
+    if (oldData != 0 && drawnTopLabel[i][0] != 0) {
+      int16_t oldLabelY = histogram_topLabelY(oldData);
+      pixels += histogram_fillRows(i, oldLabelY,
+                                   oldLabelY + DISPLAY_CHAR_HEIGHT,
+                                   DISPLAY_BLACK);
+    }
+    drawnTopLabel[i][0] = 0; // Nothing is drawn at the new height yet.
+    int16_t oldTop = histogram_barTop(oldData);
+    int16_t top = histogram_barTop(data);
+    if (top < oldTop) // Taller: draw the new part of the bar.
+      pixels += histogram_fillRows(i, top, oldTop, histogram_barColors[i]);
+    else // Shorter: erase the part that is gone.
+      pixels += histogram_fillRows(i, oldTop, top, DISPLAY_BLACK);
+    drawnBarData[i] = data;
+  }
+  // Only draw the top label if the bar-data != 0.
+  if (data != 0 && strncmp(topLabel[i], drawnTopLabel[i],
+                           HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS))
+    pixels += histogram_drawTopLabel(i, data);
+  return pixels;
+}
+
+// This updates the display and returns the number of pixels written.
+uint32_t histogram_updateDisplay() {
   if (!initFlag) {
     printf("Error! histogram_displayUpdate(): must call histogram_init() "
            "before calling this function.\n");
-    return;
-  }
-  for (int i = 0; i < histogram_barCount; i++) {
-    histogram_data_t oldData = previousBarData[i]; // Get the previous data.
-    histogram_data_t data = currentBarData[i];     // Get the current bar data.
-    if (oldData !=
-        data) { // If the are not equal, redraw the bar and the top-label.
-      // Erase the old bar and extend the erase rectangle to include the
-      // top-label so that everything is erased at once. Also, redraw the top
-      // label.
-      display_fillRect(i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
-                       display_height() - oldData - HISTOGRAM_BAR_Y_GAP -
-                           DISPLAY_CHAR_HEIGHT - 1,
-                       histogram_barWidth, oldData + DISPLAY_CHAR_HEIGHT + 1,
-                       DISPLAY_BLACK);
-      // Draw the new bar.
-      display_fillRect(i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
-                       display_height() - data - HISTOGRAM_BAR_Y_GAP,
-                       histogram_barWidth, data - 1, histogram_barColors[i]);
-      if (data != 0) { // Only draw the top label if the bar-data != 0.
-        histogram_drawTopLabel(i, data, topLabel[i],
-                               false); // false means that the old label does
-                                       // not need to be erased.
-        previousBarData[i] = currentBarData[i]; // Old data and new data are the
-                                                // same after the update.
-        // Old label and new label are the same after the update.
-        strncpy(oldTopLabel[i], topLabel[i],
-                HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-      }
-    } else if ((data != 0) &&
-               strncmp(topLabel[i], oldTopLabel[i],
-                       HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS)) {
-      histogram_drawTopLabel(
-          i, data, topLabel[i],
-          true); // True means that the old label needs to be erased.
-      // After the update, copy the label to old data so that it won't reupdate
-      // until the next change.
-      strncpy(oldTopLabel[i], topLabel[i],
-              HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-    }
+    return 0;
   }
+  uint32_t pixels = 0;
+  for (int i = 0; i < histogram_barCount; i++)
+    pixels += histogram_updateBar(i);
+  return pixels;
 }
 
 // Set the bar-color for each bar. This overwrites the defaults. Call
@@ -318,6 +334,7 @@ void histogram_setBottomLabelTextSize(uint16_t size) {}
 void histogram_runTest() {
   histogram_init(
       HISTOGRAM_DEFAULT_BAR_COUNT); // Must init the histogram data structures.
+  uint32_t pixels = 0; // Pixels written by all of the updates.
   for (int i = 0; i < HISTOGRAM_RUN_TEST_ITERATION_COUNT;
        i++) { // Loop as required.
     for (int j = 0; j < histogram_barCount;
@@ -325,10 +342,12 @@ void histogram_runTest() {
       histogram_setBarData(j, rand() % HISTOGRAM_MAX_BAR_DATA_IN_PIXELS,
                            RANDOM_LABEL); // set the bar data to a random value.
     }
-    histogram_updateDisplay();                       // update the display.
+    pixels += histogram_updateDisplay();             // update the display.
     utils_msDelay(HISTOGRAM_RUN_TEST_LOOP_DELAY_MS); // Slow the update so you
                                                      // can see it happen.
   }
+  printf("histogram_runTest: %d updates wrote %lu pixels.\n",
+         HISTOGRAM_RUN_TEST_ITERATION_COUNT, (unsigned long)pixels);
 }
 
 // Tries to squeeze a little more into 4 characters by removing the e part of
@@ -370,8 +389,9 @@ void histogram_normalizePowerValues(double normalizedValues[],
     normalizedValues[i] = origValues[i] / maxValue;
 }
 
-// Used to plot the power response for user frequencies 0-9.
-void histogram_plotUserFrequencyPower(double powerValues[]) {
+// Used to plot the power response for user frequencies 0-9. Returns the
+// number of pixels written.
+uint32_t histogram_plotUserFrequencyPower(double powerValues[]) {
   double normalizedPowerValues[FILTER_FREQUENCY_COUNT];
   histogram_normalizePowerValues(normalizedPowerValues, powerValues,
                                  FILTER_FREQUENCY_COUNT);
@@ -407,7 +427,7 @@ void histogram_plotUserFrequencyPower(double powerValues[]) {
       }
     }
   }
-  histogram_updateDisplay();
+  return histogram_updateDisplay();
 }
 
 // Used to display hit-counts in shooter mode.
@@ -426,8 +446,9 @@ void histogram_computeNormalizedHitValues(double normalizedHitValues[],
     normalizedHitValues[i] = (double)hitArray[i] / maxHitValue;
 }
 
-// Used to plot hits for frequencies 0-9.
-void histogram_plotUserHits(uint16_t hitCounts[]) {
+// Used to plot hits for frequencies 0-9. Returns the number of pixels
+// written.
+uint32_t histogram_plotUserHits(uint16_t hitCounts[]) {
   double normalizedHitValues[FILTER_FREQUENCY_COUNT]; // Store normalized values
                                                       // here for the histogram.
   histogram_computeNormalizedHitValues(
@@ -442,8 +463,8 @@ void histogram_plotUserHits(uint16_t hitCounts[]) {
       printf("Error: snprintf encountered an error during conversion.\n");
     histogram_setBarData(
         i, normalizedHitValues[i] * HISTOGRAM_MAX_BAR_DATA_IN_PIXELS, label);
-    histogram_updateDisplay(); // Redraw the histogram.
   }
+  return histogram_updateDisplay(); // Redraw the histogram.
 }
 
 // Normalizes the values in the array argument.
@@ -84,13 +84,23 @@ void histogram_redrawBottomLabels();
 void histogram_setBottomLabelTextSize(uint16_t);
 
 // Call this to draw the histogram with the data from histogram_setBarData().
-void histogram_updateDisplay();
-
-// Used to plot the power response for user frequencies 0-9.
-void histogram_plotUserFrequencyPower(double powerValue[]);
-
-// Used to plot hits for frequencies 0-9.
-void histogram_plotUserHits(uint16_t hit[]);
+// Only the change since the last update is drawn: bars that are the same
+// height in pixels are left alone, a bar that changed height is extended or
+// trimmed by the difference, and only the characters of a top label that
+// changed are redrawn. Returns the number of pixels written, a measure of the
+// time spent on the TFT.
+uint32_t histogram_updateDisplay();
+
+// Same as histogram_updateDisplay(), for one bar, so that a redraw can be
+// spread over several calls.
+uint32_t histogram_updateBar(histogram_index_t barIndex);
+
+// Used to plot the power response for user frequencies 0-9. Returns the
+// number of pixels written.
+uint32_t histogram_plotUserFrequencyPower(double powerValue[]);
+
+// Used to plot hits for frequencies 0-9. Returns the number of pixels written.
+uint32_t histogram_plotUserHits(uint16_t hit[]);
 
 // Plots the FIR power (frequency response).
 // This plotting routine assumes that:
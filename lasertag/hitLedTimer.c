@@ -0,0 +1,75 @@
+#include <stdio.h>
+
+#include "hitLedTimer.h"
+#include "leds.h"
+#include "mio.h"
+#include "timerWheel.h"
+#include "utils.h"
+
+#define LED_ON 1
+#define LED_OFF 0
+#define LD0_MASK 0x01
+
+// Delay between blinks in hitLedTimer_runTest().
+#define TEST_DELAY_MS 300
+
+// The timer only exists in the wheel while the LED is lit.
+static timerWheel_timer_t timer;
+static volatile bool enabled;
+
+// Timer wheel callback: the half second is up.
+static void expired(void *arg) { hitLedTimer_turnLedOff(); }
+
+// Need to init things.
+void hitLedTimer_init() {
+  mio_setPinAsOutput(HIT_LED_TIMER_OUTPUT_PIN);
+  timerWheel_cancel(&timer);
+  hitLedTimer_turnLedOff();
+  enabled = true;
+}
+
+// Calling this starts the timer.
+void hitLedTimer_start() {
+  if (!enabled)
+    return;
+  hitLedTimer_turnLedOn();
+  timerWheel_start(&timer, HIT_LED_TIMER_EXPIRE_VALUE, 0, expired, NULL);
+}
+
+// Returns true if the timer is currently running.
+bool hitLedTimer_running() { return timerWheel_isActive(&timer); }
+
+// Turns the gun's hit-LED on.
+void hitLedTimer_turnLedOn() {
+  mio_writePin(HIT_LED_TIMER_OUTPUT_PIN, LED_ON);
+  leds_write(leds_read() | LD0_MASK);
+}
+
+// Turns the gun's hit-LED off.
+void hitLedTimer_turnLedOff() {
+  mio_writePin(HIT_LED_TIMER_OUTPUT_PIN, LED_OFF);
+  leds_write(leds_read() & ~LD0_MASK);
+}
+
+// Disables the hitLedTimer.
+void hitLedTimer_disable() {
+  enabled = false;
+  timerWheel_cancel(&timer);
+  hitLedTimer_turnLedOff();
+}
+
+// Enables the hitLedTimer.
+void hitLedTimer_enable() { enabled = true; }
+
+// Runs a visual test of the hit LED.
+// The test continuously blinks the hit-led on and off.
+void hitLedTimer_runTest() {
+  printf("starting hitLedTimer_runTest()\n");
+  hitLedTimer_enable();
+  while (1) {
+    hitLedTimer_start();
+    while (hitLedTimer_running())
+      ;
+    utils_msDelay(TEST_DELAY_MS);
+  }
+}
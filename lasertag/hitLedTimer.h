@@ -22,9 +22,6 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // Need to init things.
 void hitLedTimer_init();
 
-// Standard tick function.
-void hitLedTimer_tick();
-
 // Calling this starts the timer.
 void hitLedTimer_start();
 
@@ -0,0 +1,133 @@
+// Runs a synthetic game through the whole signal chain on the host (the real
+// isr.c, filter, detector and timers against the stub HAL) and reports how
+// many 100 kHz channels one core could keep up with, for each detector
+// backend, per value (detector()) and in blocks (detector_processBlock()).
+// Every player frequency fires one shot over a multipath channel with noise;
+// exits with failure unless each configuration detects each shot exactly once.
+// Then prints the CPU load of running one to four channels side by side, and
+// the speed of the double and fixed-point filter chains.
+//
+// Usage: lasertagBench [seconds]
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "detector.h"
+#include "filter.h"
+#include "filterFixed.h"
+#include "hostHal.h"
+#include "intervalTimer.h"
+#include "isr.h"
+#include "lockoutTimer.h"
+#include "multiDetector.h"
+#include "signalGen.h"
+
+#define SAMPLE_RATE_HZ 100000
+#define DEFAULT_SECONDS 10.0
+#define BENCH_TIMER INTERVAL_TIMER_0
+
+// Shots are 200 ms, one player at a time, after a second of start-up.
+#define SHOT_LENGTH (SAMPLE_RATE_HZ / 5)
+#define FIRST_SHOT_START SAMPLE_RATE_HZ
+#define SHOT_AMPLITUDE 300.0
+#define NOISE_DEVIATION 60.0
+#define RANDOM_SEED 330
+
+// Reflections off nearby walls: short delays, weaker copies.
+static const signalGen_echo_t echoes[] = {{37, 0.5}, {113, -0.3}, {290, 0.2}};
+#define ECHO_COUNT (sizeof(echoes) / sizeof(echoes[0]))
+
+typedef struct {
+  const char *name;
+  detector_backend_t backend;
+  bool block;
+} configuration_t;
+
+static const configuration_t configurations[] = {
+    {"IIR bank, per value", DETECTOR_BACKEND_IIR, false},
+    {"IIR bank, block", DETECTOR_BACKEND_IIR, true},
+    {"sliding DFT, per value", DETECTOR_BACKEND_SLIDING_DFT, false},
+    {"sliding DFT, block", DETECTOR_BACKEND_SLIDING_DFT, true},
+};
+#define CONFIGURATION_COUNT (sizeof(configurations) / sizeof(configurations[0]))
+
+// Plays the trace through isr_function() and the detector. Returns true if
+// every frequency registered exactly one hit.
+static bool runConfiguration(const configuration_t *c,
+                             const isr_AdcValue_t trace[],
+                             uint32_t sampleCount) {
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  isr_init();
+  filter_init();
+  detector_initBackend(ignoredFrequencies, c->backend);
+  lockoutTimer_start(); // Ignore the filter start-up transient.
+
+  intervalTimer_initCountUp(BENCH_TIMER);
+  intervalTimer_start(BENCH_TIMER);
+  for (uint32_t i = 0; i < sampleCount; i++) {
+    hostHal_setAdcValue(trace[i]);
+    isr_function();
+    if (isr_adcBufferElementCount() < DETECTOR_BLOCK_SIZE &&
+        i + 1 < sampleCount)
+      continue;
+    if (c->block)
+      detector_processBlock();
+    else
+      detector(false);
+    detector_clearHit();
+  }
+  intervalTimer_stop(BENCH_TIMER);
+  double seconds = intervalTimer_getTotalDurationInSeconds(BENCH_TIMER);
+
+  detector_hitCount_t hitCounts[FILTER_FREQUENCY_COUNT];
+  detector_getHitCounts(hitCounts);
+  bool passed = true;
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+    passed = passed && hitCounts[f] == 1;
+  double valuesPerSecond = sampleCount / seconds;
+  printf("%-24s %7.1f M values/s %6.1f channels  %s\n", c->name,
+         valuesPerSecond * 1e-6, valuesPerSecond / SAMPLE_RATE_HZ,
+         passed ? "hits ok" : "wrong hit counts");
+  return passed;
+}
+
+int main(int argc, char *argv[]) {
+  double traceSeconds = argc > 1 ? atof(argv[1]) : DEFAULT_SECONDS;
+  uint32_t sampleCount = traceSeconds * SAMPLE_RATE_HZ;
+  uint32_t shotSpacing =
+      (sampleCount - FIRST_SHOT_START) / FILTER_FREQUENCY_COUNT;
+  if (traceSeconds <= 0.0 || sampleCount <= FIRST_SHOT_START ||
+      shotSpacing < SHOT_LENGTH + LOCKOUT_TIMER_EXPIRE_VALUE) {
+    printf("lasertagBench: %.2f s is too short for a shot per frequency.\n",
+           traceSeconds);
+    return EXIT_FAILURE;
+  }
+
+  signalGen_t generator;
+  signalGen_init(&generator, NOISE_DEVIATION, RANDOM_SEED);
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+    signalGen_addShot(&generator, f, FIRST_SHOT_START + f * shotSpacing,
+                      SHOT_LENGTH, SHOT_AMPLITUDE);
+  for (uint16_t e = 0; e < ECHO_COUNT; e++)
+    signalGen_addEcho(&generator, echoes[e].delay, echoes[e].gain);
+  isr_AdcValue_t *trace =
+      (isr_AdcValue_t *)malloc(sampleCount * sizeof(isr_AdcValue_t));
+  if (trace == NULL) {
+    printf("lasertagBench: malloc of %u values failed.\n", sampleCount);
+    return EXIT_FAILURE;
+  }
+  signalGen_generate(&generator, trace, sampleCount);
+
+  printf("%.2f s synthetic trace, %u shots, %u echoes, noise %.0f counts\n",
+         traceSeconds, generator.shotCount, generator.echoCount,
+         NOISE_DEVIATION);
+  bool passed = true;
+  for (uint16_t c = 0; c < CONFIGURATION_COUNT; c++)
+    passed = runConfiguration(&configurations[c], trace, sampleCount) && passed;
+  free(trace);
+  multiDetector_runLoadTest();
+  filterFixed_runBenchmark(BENCH_TIMER);
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,34 @@
+// Runs the lasertag self-tests that do not need the board.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "adpcm.h"
+#include "detector.h"
+#include "filter.h"
+#include "filterFixed.h"
+#include "filterSimd.h"
+#include "intervalTimer.h"
+#include "isr.h"
+#include "multiDetector.h"
+#include "queue.h"
+#include "soundDma.h"
+
+int main() {
+  isr_init();
+  bool passed = queue_runTest();
+  passed = filter_runPolyphaseTest() && passed;
+  passed = filter_runIirSectionTest() && passed;
+  passed = filterSimd_runTest() && passed;
+  passed = filterFixed_runTest() && passed;
+  passed = detector_runBackendTest() && passed;
+  passed = detector_runBlockTest() && passed;
+  passed = detector_runMedianTest() && passed;
+  passed = multiDetector_runTest() && passed;
+  soundDma_init(0); // The stand-in has no FIFO register.
+  passed = soundDma_runTest(INTERVAL_TIMER_0) && passed;
+  passed = adpcm_runTest(INTERVAL_TIMER_0) && passed;
+  printf("lasertagHostTest: %s\n", passed ? "passed" : "failed");
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,27 @@
+// The parts of isr_function() that drive the board's outputs or read its
+// buttons. None of them affect the signal chain, so on the host they do
+// nothing.
+
+#include "sound.h"
+#include "transmitter.h"
+#include "trigger.h"
+
+void transmitter_init() {}
+void transmitter_tick() {}
+
+void trigger_init() {}
+void trigger_tick() {}
+void trigger_enable() {}
+void trigger_disable() {}
+
+// autoReloadTimer_tick() polls the count, so it has to hold shots.
+static trigger_shotsRemaining_t shotsRemaining = 1;
+trigger_shotsRemaining_t trigger_getRemainingShotCount() {
+  return shotsRemaining;
+}
+void trigger_setRemainingShotCount(trigger_shotsRemaining_t count) {
+  shotsRemaining = count;
+}
+
+sound_status_t sound_init() { return SOUND_STATUS_OK; }
+void sound_tick() {}
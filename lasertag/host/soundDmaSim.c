@@ -0,0 +1,125 @@
+// Stand-in for the PL330 audio streaming in soundDma.c. The FIFO empties at
+// the sample rate and the DMA keeps it full, so the DMA has finished buffer n
+// once every frame up to the last one of that buffer has either been played
+// or is sitting in the FIFO. soundDma_service() works that out from the
+// clock and refills the buffers that are done, SOUNDDMA_FRAMES_PER_SERVICE
+// frames per call, as the board does when it sees the done interrupt.
+
+#include <time.h>
+
+#include "soundDma.h"
+
+#define WORDS_PER_FRAME 2
+#define FIFO_FRAMES 8 // 16 words, one per channel.
+#define NANOSECONDS_PER_SECOND 1000000000LL
+
+static uint32_t buffers[SOUNDDMA_BUFFER_COUNT]
+                      [SOUNDDMA_FRAMES_PER_BUFFER * WORDS_PER_FRAME];
+static soundDma_fill_t fillFunction;
+static bool running;
+static bool dmaStarted;
+static int64_t startTime;      // In nanoseconds, when the DMA started.
+static uint32_t finishedCount; // Buffers the DMA has finished.
+static uint8_t silentBuffers;
+static uint32_t underrunCount;
+
+// The buffer being filled: its number counting from the start (buffer
+// fillNumber % SOUNDDMA_BUFFER_COUNT), or NO_BUFFER.
+#define NO_BUFFER UINT32_MAX
+static uint32_t fillNumber;
+static uint32_t fillFrame;
+static bool fillSound;
+
+static int64_t now() {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec * NANOSECONDS_PER_SECOND + time.tv_nsec;
+}
+
+// When the DMA has finished buffer n, counting from the start.
+static int64_t finishTime(uint32_t n) {
+  int64_t frame = (int64_t)(n + 1) * SOUNDDMA_FRAMES_PER_BUFFER - FIFO_FRAMES;
+  return startTime + frame * NANOSECONDS_PER_SECOND / SOUNDDMA_SAMPLE_RATE_HZ;
+}
+
+static void startFill(uint32_t number) {
+  fillNumber = number;
+  fillFrame = 0;
+  fillSound = false;
+}
+
+// As on the board: fills up to frameCount more frames, and once the buffer is
+// full starts the DMA or the next buffer if still priming, and stops after
+// enough silence. The DMA plays the buffers in fill order, so fill n is late
+// if the DMA has already finished playing fill n - 1.
+static void continueFill(uint32_t frameCount) {
+  uint32_t number = fillNumber;
+  uint32_t *buffer = buffers[number % SOUNDDMA_BUFFER_COUNT];
+  uint32_t remaining = SOUNDDMA_FRAMES_PER_BUFFER - fillFrame;
+  frameCount = frameCount < remaining ? frameCount : remaining;
+  fillSound |= fillFunction(&buffer[fillFrame * WORDS_PER_FRAME], frameCount);
+  fillFrame += frameCount;
+  if (fillFrame < SOUNDDMA_FRAMES_PER_BUFFER)
+    return;
+  silentBuffers = fillSound ? 0 : silentBuffers + 1;
+  fillNumber = NO_BUFFER;
+  if (dmaStarted && now() >= finishTime(number - 1))
+    underrunCount++;
+  if (!dmaStarted) {
+    startTime = now();
+    dmaStarted = true;
+  }
+  if (number + 1 < SOUNDDMA_BUFFER_COUNT)
+    startFill(number + 1);
+  if (silentBuffers >= SOUNDDMA_BUFFER_COUNT)
+    running = false;
+}
+
+// Nothing to set up.
+bool soundDma_init(uint32_t fifoAddress) {
+  running = false;
+  underrunCount = 0;
+  return true;
+}
+
+// Starts filling the first buffer; the clock starts once it is full.
+void soundDma_start(soundDma_fill_t fill) {
+  if (running)
+    return;
+  fillFunction = fill;
+  silentBuffers = 0;
+  finishedCount = 0;
+  dmaStarted = false;
+  startFill(0);
+  running = true;
+}
+
+// Starts refilling every buffer finished since the last call and fills a few
+// more frames. The board would only see one done interrupt; a refill still
+// going when the next buffer finishes is completed at once.
+void soundDma_service() {
+  int64_t time = now();
+  while (running && dmaStarted && time >= finishTime(finishedCount)) {
+    if (fillNumber != NO_BUFFER)
+      continueFill(SOUNDDMA_FRAMES_PER_BUFFER);
+    if (!running)
+      return;
+    startFill(finishedCount + SOUNDDMA_BUFFER_COUNT);
+    finishedCount++;
+  }
+  if (running && fillNumber != NO_BUFFER)
+    continueFill(SOUNDDMA_FRAMES_PER_SERVICE);
+}
+
+// Stops streaming.
+void soundDma_stop() {
+  running = false;
+  dmaStarted = false;
+  fillNumber = NO_BUFFER;
+}
+
+// Returns true while streaming.
+bool soundDma_isRunning() { return running; }
+
+// Returns the number of buffers refilled too late.
+uint32_t soundDma_getUnderrunCount() { return underrunCount; }
@@ -0,0 +1,36 @@
+#include "invincibilityTimer.h"
+#include "timerWheel.h"
+
+// isr_function() ticks the timer wheel at 100 kHz.
+#define TICKS_PER_SECOND 100000
+
+// A 16-bit number of seconds does not fit in 32 bits of 100 kHz ticks, so the
+// timer runs as a periodic one-second timer that counts the seconds down.
+static timerWheel_timer_t timer;
+static volatile uint16_t secondsRemaining;
+
+// Timer wheel callback, once per second while running.
+static void secondElapsed(void *arg) {
+  if (--secondsRemaining == 0)
+    timerWheel_cancel(&timer);
+}
+
+// Perform any necessary inits for the invincibility timer.
+void invincibilityTimer_init() {
+  timerWheel_cancel(&timer);
+  secondsRemaining = 0;
+}
+
+// Calling this starts the timer.
+void invincibilityTimer_start(uint16_t seconds) {
+  if (seconds == 0) {
+    invincibilityTimer_init();
+    return;
+  }
+  secondsRemaining = seconds;
+  timerWheel_start(&timer, TICKS_PER_SECOND, TICKS_PER_SECOND, secondElapsed,
+                   NULL);
+}
+
+// Returns true if the timer is running.
+bool invincibilityTimer_running() { return timerWheel_isActive(&timer); }
@@ -16,9 +16,6 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // Perform any necessary inits for the invincibility timer.
 void invincibilityTimer_init();
 
-// Standard tick function.
-void invincibilityTimer_tick();
-
 // Calling this starts the timer.
 void invincibilityTimer_start(uint16_t seconds);
 
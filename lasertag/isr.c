@@ -0,0 +1,140 @@
+#include <stdio.h>
+
+#include "isr.h"
+#include "armInterrupts.h"
+#include "autoReloadTimer.h"
+#include "hitLedTimer.h"
+#include "lockoutTimer.h"
+#include "sound.h"
+#include "spscQueue.h"
+#include "timerWheel.h"
+#include "transmitter.h"
+#include "trigger.h"
+#include "xadcSequencer.h"
+
+// adcBuffers[0] is the ADC buffer; the others are only used after
+// isr_initAdcChannels().
+static spscQueue_t adcBuffers[ISR_MAX_ADC_CHANNELS];
+static bool adcBufferAllocated[ISR_MAX_ADC_CHANNELS];
+static uint8_t adcChannels[ISR_MAX_ADC_CHANNELS];
+static uint8_t adcChannelCount;
+// True once the sequencer reads the channels, false while the ISR reads
+// SELECTED_XADC_CHANNEL.
+static bool sequencing;
+
+// Allocates a channel buffer the first time. Buffers are kept after that, so
+// a failed allocation never takes away one the ISR is using.
+static bool allocateAdcBuffer(uint8_t channel) {
+  if (!adcBufferAllocated[channel])
+    adcBufferAllocated[channel] =
+        spscQueue_init(&adcBuffers[channel], ISR_ADC_BUFFER_SIZE);
+  return adcBufferAllocated[channel];
+}
+
+// Allocates a channel buffer the first time, empties it after that.
+static bool initAdcBuffer(uint8_t channel) {
+  if (!allocateAdcBuffer(channel))
+    return false;
+  spscQueue_clear(&adcBuffers[channel]);
+  return true;
+}
+
+// Performs inits for anything in isr.c
+void isr_init() {
+  initAdcBuffer(0);
+  adcChannelCount = 1;
+  sequencing = false;
+  timerWheel_init();
+  transmitter_init();
+  trigger_init();
+  hitLedTimer_init();
+  lockoutTimer_init();
+  autoReloadTimer_init();
+  sound_init();
+}
+
+// This function is invoked by the timer interrupt at 100 kHz.
+void isr_function() {
+  if (sequencing) {
+    for (uint8_t c = 0; c < adcChannelCount; c++)
+      spscQueue_push(&adcBuffers[c], xadcSequencer_read(adcChannels[c]));
+  } else {
+    isr_addDataToAdcBuffer(armInterrupts_getAdcData());
+  }
+  transmitter_tick();
+  trigger_tick();
+  autoReloadTimer_tick();
+  timerWheel_tick();
+  sound_tick();
+}
+
+// This adds data to the ADC buffer. Samples that arrive while the buffer is
+// full are dropped (and counted by the queue).
+void isr_addDataToAdcBuffer(isr_AdcValue_t value) {
+  spscQueue_push(&adcBuffers[0], value);
+}
+
+// This removes a value from the ADC buffer. Returns 0 if it is empty.
+isr_AdcValue_t isr_removeDataFromAdcBuffer() {
+  spscQueue_data_t value = 0;
+  spscQueue_pop(&adcBuffers[0], &value);
+  return value;
+}
+
+// Removes up to count of the oldest values from the ADC buffer into dst.
+uint32_t isr_removeManyFromAdcBuffer(isr_AdcValue_t dst[], uint32_t count) {
+  return spscQueue_popMany(&adcBuffers[0], dst, count);
+}
+
+// This returns the number of values in the ADC buffer.
+uint32_t isr_adcBufferElementCount() {
+  return spscQueue_elementCount(&adcBuffers[0]);
+}
+
+// Reads xadcChannels[0..count-1] from now on.
+bool isr_initAdcChannels(const uint8_t xadcChannels[], uint8_t count) {
+  if (count == 0 || count > ISR_MAX_ADC_CHANNELS) {
+    printf("isr_initAdcChannels: %u channels (1 to %u).\n", count,
+           ISR_MAX_ADC_CHANNELS);
+    return false;
+  }
+  // Everything that can fail comes before the sequencer is reprogrammed, so a
+  // failure leaves the ISR reading what it read before.
+  for (uint8_t c = 0; c < count; c++) {
+    if (!allocateAdcBuffer(c)) {
+      printf("isr_initAdcChannels: no memory for channel %u.\n", c);
+      return false;
+    }
+  }
+  // xadcSequencer_init() checks the channels before touching the hardware.
+  if (!xadcSequencer_init(xadcChannels, count,
+                          armInterrupts_getAdcInputMode() ==
+                              INTERRUPTS_ADC_BIPOLAR_MODE))
+    return false;
+  for (uint8_t c = 0; c < count; c++) {
+    spscQueue_clear(&adcBuffers[c]);
+    adcChannels[c] = xadcChannels[c];
+  }
+  adcChannelCount = count;
+  sequencing = true;
+  return true;
+}
+
+// Returns the number of channels the ISR reads.
+uint8_t isr_getAdcChannelCount() { return adcChannelCount; }
+
+// Adds a value to a channel buffer.
+void isr_addDataToAdcChannel(uint8_t channel, isr_AdcValue_t value) {
+  spscQueue_push(&adcBuffers[channel], value);
+}
+
+// Removes up to count of the oldest values from a channel buffer into dst.
+uint32_t isr_removeManyFromAdcChannel(uint8_t channel, isr_AdcValue_t dst[],
+                                      uint32_t count) {
+  return spscQueue_popMany(&adcBuffers[channel], dst, count);
+}
+
+// Returns the number of values in a channel buffer.
+uint32_t isr_adcChannelElementCount(uint8_t channel) {
+  return spscQueue_elementCount(&adcBuffers[channel]);
+}
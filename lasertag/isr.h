@@ -10,6 +10,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #ifndef ISR_H_
 #define ISR_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 
 typedef uint32_t
@@ -20,19 +21,61 @@ typedef uint32_t
 // Converter (ADC) is implemented in isr.c Values are added to this buffer by
 // the code in isr.c. Values are removed from this buffer by code in detector.c
 
+// Software timers (hitLedTimer, lockoutTimer, autoReloadTimer,
+// invincibilityTimer) live in the timer wheel (drivers/timerWheel.h), so
+// isr_init() must call timerWheel_init() and isr_function() must call
+// timerWheel_tick() once per invocation. Their _tick() functions no longer
+// count anything.
+
 // Performs inits for anything in isr.c
 void isr_init();
 
 // This function is invoked by the timer interrupt at 100 kHz.
 void isr_function();
 
+// The ADC buffer is a lock-free single-producer/single-consumer ring
+// (spscQueue.h): isr_function() is the only producer and the detector the only
+// consumer, so removing values does not require disabling interrupts.
+
+// Capacity of the ADC buffer (a power of two): about 0.33 s of samples.
+#define ISR_ADC_BUFFER_SIZE 32768
+
 // This adds data to the ADC buffer.
 void isr_addDataToAdcBuffer(isr_AdcValue_t value);
 
-// This removes a value from the ADC buffer.
+// This removes a value from the ADC buffer. Returns 0 if it is empty.
 isr_AdcValue_t isr_removeDataFromAdcBuffer();
 
+// Removes up to count of the oldest values from the ADC buffer into dst,
+// oldest first, and returns how many were removed. Use this to drain the
+// buffer in batches rather than one value at a time.
+uint32_t isr_removeManyFromAdcBuffer(isr_AdcValue_t dst[], uint32_t count);
+
 // This returns the number of values in the ADC buffer.
 uint32_t isr_adcBufferElementCount();
 
+// Multiple ADC channels (e.g. several sensors on a vest). By default the ISR
+// reads SELECTED_XADC_CHANNEL into the ADC buffer above. After
+// isr_initAdcChannels() it reads each of the given XADC channels through the
+// XADC sequencer (xadcSequencer.h) into a buffer of its own, in the order
+// given. Channel 0 is the ADC buffer above, so the functions above still work
+// on the first channel.
+
+#define ISR_MAX_ADC_CHANNELS 4
+
+// Reads xadcChannels[0..count-1] from now on (count 1 to ISR_MAX_ADC_CHANNELS)
+// and empties their buffers. Call after isr_init(), with interrupts disabled.
+// Returns false if the channels cannot be set up, leaving the ISR as it was.
+bool isr_initAdcChannels(const uint8_t xadcChannels[], uint8_t count);
+
+// Returns the number of channels the ISR reads (1 unless
+// isr_initAdcChannels() was called).
+uint8_t isr_getAdcChannelCount();
+
+// Channel versions of the buffer functions above.
+void isr_addDataToAdcChannel(uint8_t channel, isr_AdcValue_t value);
+uint32_t isr_removeManyFromAdcChannel(uint8_t channel, isr_AdcValue_t dst[],
+                                      uint32_t count);
+uint32_t isr_adcChannelElementCount(uint8_t channel);
+
 #endif /* ISR_H_ */
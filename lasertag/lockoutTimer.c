@@ -0,0 +1,48 @@
+#include <stdio.h>
+
+#include "intervalTimer.h"
+#include "lockoutTimer.h"
+#include "timerWheel.h"
+
+// Interval timer used to measure the lockout period in lockoutTimer_runTest().
+#define TEST_INTERVAL_TIMER INTERVAL_TIMER_1
+#define TEST_EXPECTED_SECONDS 0.5
+#define TEST_TOLERANCE_SECONDS 0.005
+
+// The lockout is just a one-shot timer in the wheel with no callback.
+static timerWheel_timer_t timer;
+
+// Perform any necessary inits for the lockout timer.
+void lockoutTimer_init() { timerWheel_cancel(&timer); }
+
+// Calling this starts the timer.
+void lockoutTimer_start() {
+  timerWheel_start(&timer, LOCKOUT_TIMER_EXPIRE_VALUE, 0, NULL, NULL);
+}
+
+// Returns true if the timer is running.
+bool lockoutTimer_running() { return timerWheel_isActive(&timer); }
+
+// Test function assumes interrupts have been completely enabled and
+// the timer wheel is ticked by isr_function().
+// Prints out pass/fail status and other info to console.
+// Returns true if passes, false otherwise.
+// This test uses the interval timer to determine correct delay for
+// the interval timer.
+bool lockoutTimer_runTest() {
+  printf("starting lockoutTimer_runTest()\n");
+  intervalTimer_initCountUp(TEST_INTERVAL_TIMER);
+  intervalTimer_start(TEST_INTERVAL_TIMER);
+  lockoutTimer_start();
+  while (lockoutTimer_running())
+    ;
+  intervalTimer_stop(TEST_INTERVAL_TIMER);
+
+  double seconds = intervalTimer_getTotalDurationInSeconds(TEST_INTERVAL_TIMER);
+  bool passed = seconds > TEST_EXPECTED_SECONDS - TEST_TOLERANCE_SECONDS &&
+                seconds < TEST_EXPECTED_SECONDS + TEST_TOLERANCE_SECONDS;
+  printf("lockoutTimer duration: %f seconds (expected %f)\n", seconds,
+         TEST_EXPECTED_SECONDS);
+  printf("exiting lockoutTimer_runTest(): %s\n", passed ? "passed" : "failed");
+  return passed;
+}
@@ -21,9 +21,6 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // Perform any necessary inits for the lockout timer.
 void lockoutTimer_init();
 
-// Standard tick function.
-void lockoutTimer_tick();
-
 // Calling this starts the timer.
 void lockoutTimer_start();
 
@@ -31,7 +28,7 @@ void lockoutTimer_start();
 bool lockoutTimer_running();
 
 // Test function assumes interrupts have been completely enabled and
-// lockoutTimer_tick() function is invoked by isr_function().
+// the timer wheel is ticked by isr_function().
 // Prints out pass/fail status and other info to console.
 // Returns true if passes, false otherwise.
 // This test uses the interval timer to determine correct delay for
@@ -25,6 +25,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "buttons.h"
 #include "detector.h"
 #include "filter.h"
+#include "filterFixed.h"
 #include "filterTest.h"
 #include "hitLedTimer.h"
 #include "interrupts.h"
@@ -32,8 +33,10 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "leds.h"
 #include "lockoutTimer.h"
 #include "mio.h"
+#include "multiDetector.h"
 #include "runningModes.h"
 #include "sound.h"
+#include "spscQueue.h"
 #include "switches.h"
 #include "transmitter.h"
 #include "trigger.h"
@@ -47,9 +50,18 @@ int main() {
 #ifdef RUNNING_MODE_TESTS
   // interrupts not needed for these tests
   queue_runTest(); // M1
+  // queue_runBenchmark(); // queue read-path timing
+  // spscQueue_runTest(); // ADC buffer ISR-vs-main stress test
   // filterTest_runTest(); // M3 T1
+  // filterFixed_runTest(); // fixed-point chain against the double chain
+  // filterFixed_runBenchmark(INTERVAL_TIMER_0); // double vs. fixed-point
   // transmitter_runTest(); // M3 T2
   // detector_runTest(); // M3 T3
+  // detector_runBackendTest(); // IIR bank vs. sliding DFT
+  // detector_runBlockTest(); // detector() vs. detector_processBlock()
+  // detector_runMedianTest(); // hit-detection median timing
+  // multiDetector_runTest(); // hit fusion over several ADC channels
+  // multiDetector_runLoadTest(); // CPU load for 1 to 4 channels
   // sound_runTest(); // M4
 #endif
 
@@ -0,0 +1,303 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "filter.h"
+#include "hitLedTimer.h"
+#include "intervalTimer.h"
+#include "lockoutTimer.h"
+#include "multiDetector.h"
+#include "signalGen.h"
+#include "timerWheel.h"
+#include "xadcSequencer.h"
+
+// One detector per channel. They are allocated by the first
+// multiDetector_init() that needs them and reused after that.
+static detector_t *detectors[MULTIDETECTOR_MAX_CHANNELS];
+static uint8_t channelCount;
+static uint8_t requiredVotes; // Channels that must agree on a hit.
+
+// Channel hits that have not been fused yet, and when they were seen.
+static bool channelHitPending[MULTIDETECTOR_MAX_CHANNELS];
+static uint16_t channelHitFrequency[MULTIDETECTOR_MAX_CHANNELS];
+static uint32_t channelHitTick[MULTIDETECTOR_MAX_CHANNELS];
+
+// Fused hits.
+static bool ignoreAllHitsFlag;
+static bool hitDetectedFlag;
+static uint16_t lastHitFrequencyNumber;
+static detector_hitCount_t hitCounts[FILTER_FREQUENCY_COUNT];
+
+// Starts reading the channels and gives each a detector.
+bool multiDetector_init(const uint8_t xadcChannels[], uint8_t count,
+                        bool ignoredFrequencies[], detector_backend_t backend,
+                        multiDetector_fusion_t fusion, uint8_t votes) {
+  if (fusion == MULTIDETECTOR_FUSION_VOTE && (votes < 1 || votes > count)) {
+    printf("multiDetector_init: %u votes out of %u channels.\n", votes, count);
+    return false;
+  }
+  if (!isr_initAdcChannels(xadcChannels, count))
+    return false;
+  for (uint8_t c = 0; c < count; c++) {
+    if (detectors[c] == NULL) {
+      detectors[c] = detector_createChannel(c, ignoredFrequencies, backend);
+      if (detectors[c] == NULL)
+        return false;
+    } else {
+      detectorChannel_initBackend(detectors[c], ignoredFrequencies, backend);
+    }
+    channelHitPending[c] = false;
+  }
+  channelCount = count;
+  requiredVotes = fusion == MULTIDETECTOR_FUSION_VOTE ? votes : 1;
+  ignoreAllHitsFlag = false;
+  hitDetectedFlag = false;
+  lastHitFrequencyNumber = 0;
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    hitCounts[i] = 0;
+  lockoutTimer_init();
+  return true;
+}
+
+// Turns the pending channel hits into a player hit once enough channels agree
+// on a frequency. Channel hits that are too old to agree with anything are
+// dropped, and so are those that arrive during the lockout.
+static void multiDetector_fuseHits(uint32_t now) {
+  for (uint8_t c = 0; c < channelCount; c++)
+    if (channelHitPending[c] &&
+        now - channelHitTick[c] > MULTIDETECTOR_FUSION_WINDOW_TICKS)
+      channelHitPending[c] = false;
+  for (uint8_t c = 0; c < channelCount; c++) {
+    if (!channelHitPending[c])
+      continue;
+    uint16_t frequencyNumber = channelHitFrequency[c];
+    uint8_t votes = 0;
+    for (uint8_t other = 0; other < channelCount; other++)
+      votes += channelHitPending[other] &&
+               channelHitFrequency[other] == frequencyNumber;
+    if (votes < requiredVotes)
+      continue;
+    for (uint8_t other = 0; other < channelCount; other++)
+      if (channelHitFrequency[other] == frequencyNumber)
+        channelHitPending[other] = false;
+    if (ignoreAllHitsFlag || lockoutTimer_running())
+      continue;
+    lockoutTimer_start();
+    hitLedTimer_start();
+    hitCounts[frequencyNumber]++;
+    lastHitFrequencyNumber = frequencyNumber;
+    hitDetectedFlag = true;
+  }
+}
+
+// Drains every channel through its detector, then fuses the channel hits.
+void multiDetector_run() {
+  uint32_t now = timerWheel_getTicks();
+  for (uint8_t c = 0; c < channelCount; c++) {
+    detector_t *d = detectors[c];
+    detectorChannel_processBlock(d);
+    if (detectorChannel_hitDetected(d)) {
+      channelHitPending[c] = true;
+      channelHitFrequency[c] = detectorChannel_getFrequencyNumberOfLastHit(d);
+      channelHitTick[c] = now;
+      detectorChannel_clearHit(d);
+    }
+  }
+  multiDetector_fuseHits(now);
+}
+
+// Returns true if a fused hit was detected.
+bool multiDetector_hitDetected() { return hitDetectedFlag; }
+
+// Returns the frequency number of the last fused hit.
+uint16_t multiDetector_getFrequencyNumberOfLastHit() {
+  return lastHitFrequencyNumber;
+}
+
+// Clear the fused hit once you have accounted for it.
+void multiDetector_clearHit() { hitDetectedFlag = false; }
+
+// Ignore all hits on every channel.
+void multiDetector_ignoreAllHits(bool flagValue) {
+  ignoreAllHitsFlag = flagValue;
+  for (uint8_t c = 0; c < channelCount; c++) {
+    detectorChannel_ignoreAllHits(detectors[c], flagValue);
+    channelHitPending[c] = false;
+  }
+}
+
+// Copies the fused hit counts into hitArray.
+void multiDetector_getHitCounts(detector_hitCount_t hitArray[]) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    hitArray[i] = hitCounts[i];
+}
+
+// Copies the hits detected on one channel into hitArray.
+void multiDetector_getChannelHitCounts(uint8_t channel,
+                                       detector_hitCount_t hitArray[]) {
+  if (channel >= channelCount) {
+    printf("multiDetector_getChannelHitCounts: no channel %u.\n", channel);
+    return;
+  }
+  detectorChannel_getHitCounts(detectors[channel], hitArray);
+}
+
+/*******************************************************
+ ****************** Test Routines **********************
+ ******************************************************/
+
+// The four XADC inputs on the Zybo JA Pmod header: VAUX14, VAUX7, VAUX15 and
+// VAUX6.
+static const uint8_t testChannels[MULTIDETECTOR_MAX_CHANNELS] = {
+    XSM_CH_AUX_MIN + 14, XSM_CH_AUX_MIN + 7, XSM_CH_AUX_MIN + 15,
+    XSM_CH_AUX_MIN + 6};
+
+// Each test feeds noise to fill the power windows, a gap of noise, then a
+// shot of one pulse width on some of the channels. All values are in ADC
+// counts.
+#define TEST_SHOT_LENGTH                                                       \
+  (FILTER_INPUT_PULSE_WIDTH * FILTER_FIR_DECIMATION_FACTOR)
+#define TEST_WARMUP_LENGTH TEST_SHOT_LENGTH
+#define TEST_GAP_LENGTH TEST_SHOT_LENGTH
+#define TEST_SHOT_START (TEST_WARMUP_LENGTH + TEST_GAP_LENGTH)
+#define TEST_SEGMENT_LENGTH (TEST_SHOT_START + TEST_SHOT_LENGTH)
+#define TEST_CHUNK_SIZE 10000 // 100 ms of input per multiDetector_run().
+#define TEST_CHANNEL_COUNT 3
+#define TEST_FREQUENCY 3
+#define TEST_SHOT_AMPLITUDE 300
+#define TEST_NOISE_DEVIATION 60
+#define TEST_RANDOM_SEED 330
+#define ADC_SAMPLES_PER_SECOND (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000)
+#define TEST_LOAD_SAMPLES ADC_SAMPLES_PER_SECOND // One second per channel.
+#define TEST_BENCHMARK_TIMER INTERVAL_TIMER_0
+
+typedef struct {
+  multiDetector_fusion_t fusion;
+  uint8_t votes;
+  double amplitude[TEST_CHANNEL_COUNT]; // Of the shot on each channel.
+  bool hit;                             // Expected fused hit.
+} multiDetector_testCase_t;
+
+static const multiDetector_testCase_t testCases[] = {
+    {MULTIDETECTOR_FUSION_ANY, 1, {TEST_SHOT_AMPLITUDE, 0, 0}, true},
+    {MULTIDETECTOR_FUSION_VOTE, 2, {TEST_SHOT_AMPLITUDE, 0, 0}, false},
+    {MULTIDETECTOR_FUSION_VOTE,
+     2,
+     {TEST_SHOT_AMPLITUDE, TEST_SHOT_AMPLITUDE, 0},
+     true},
+    {MULTIDETECTOR_FUSION_VOTE,
+     3,
+     {TEST_SHOT_AMPLITUDE, TEST_SHOT_AMPLITUDE, 0},
+     false},
+    {MULTIDETECTOR_FUSION_VOTE,
+     2,
+     {TEST_SHOT_AMPLITUDE, TEST_SHOT_AMPLITUDE, TEST_SHOT_AMPLITUDE},
+     true}};
+#define TEST_CASE_COUNT (sizeof(testCases) / sizeof(testCases[0]))
+
+// Generates count values on each of channels channels, TEST_CHUNK_SIZE at a
+// time, and pushes them into the channel buffers. After each chunk runs the
+// detectors and returns the time spent in multiDetector_run().
+static double multiDetector_feedTest(signalGen_t generators[],
+                                     uint8_t channels, uint32_t count,
+                                     isr_AdcValue_t chunk[]) {
+  double seconds = 0.0;
+  for (uint32_t i = 0; i < count; i += TEST_CHUNK_SIZE) {
+    uint32_t chunkSize =
+        count - i < TEST_CHUNK_SIZE ? count - i : TEST_CHUNK_SIZE;
+    for (uint8_t c = 0; c < channels; c++) {
+      signalGen_generate(&generators[c], chunk, chunkSize);
+      for (uint32_t j = 0; j < chunkSize; j++)
+        isr_addDataToAdcChannel(c, chunk[j]);
+    }
+    intervalTimer_initCountUp(TEST_BENCHMARK_TIMER);
+    intervalTimer_start(TEST_BENCHMARK_TIMER);
+    multiDetector_run();
+    intervalTimer_stop(TEST_BENCHMARK_TIMER);
+    seconds += intervalTimer_getTotalDurationInSeconds(TEST_BENCHMARK_TIMER);
+  }
+  return seconds;
+}
+
+// Runs each test case and checks the fused hits.
+bool multiDetector_runTest() {
+  printf("starting multiDetector_runTest()\n");
+  isr_AdcValue_t *chunk =
+      (isr_AdcValue_t *)malloc(TEST_CHUNK_SIZE * sizeof(isr_AdcValue_t));
+  if (chunk == NULL) {
+    printf("multiDetector_runTest: malloc failed.\n");
+    return false;
+  }
+  bool ignoreNone[FILTER_FREQUENCY_COUNT] = {false};
+  bool success = true;
+  for (uint16_t t = 0; t < TEST_CASE_COUNT; t++) {
+    const multiDetector_testCase_t *test = &testCases[t];
+    if (!multiDetector_init(testChannels, TEST_CHANNEL_COUNT, ignoreNone,
+                            DETECTOR_BACKEND_IIR, test->fusion, test->votes)) {
+      success = false;
+      break;
+    }
+    signalGen_t generators[TEST_CHANNEL_COUNT];
+    for (uint8_t c = 0; c < TEST_CHANNEL_COUNT; c++) {
+      signalGen_init(&generators[c], TEST_NOISE_DEVIATION,
+                     TEST_RANDOM_SEED + c);
+      if (test->amplitude[c] > 0)
+        signalGen_addShot(&generators[c], TEST_FREQUENCY, TEST_SHOT_START,
+                          TEST_SHOT_LENGTH, test->amplitude[c]);
+    }
+    // Only count the hits after the power windows have filled.
+    multiDetector_ignoreAllHits(true);
+    multiDetector_feedTest(generators, TEST_CHANNEL_COUNT, TEST_WARMUP_LENGTH,
+                           chunk);
+    multiDetector_ignoreAllHits(false);
+    multiDetector_feedTest(generators, TEST_CHANNEL_COUNT,
+                           TEST_GAP_LENGTH + TEST_SHOT_LENGTH, chunk);
+    detector_hitCount_t counts[FILTER_FREQUENCY_COUNT];
+    multiDetector_getHitCounts(counts);
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      if (counts[i] != (test->hit && i == TEST_FREQUENCY)) {
+        printf("multiDetector_runTest: case %d (%s, %d votes): frequency %d "
+               "hit %d times.\n",
+               t, test->fusion == MULTIDETECTOR_FUSION_ANY ? "any" : "vote",
+               test->votes, i, counts[i]);
+        success = false;
+      }
+    }
+  }
+  free(chunk);
+  lockoutTimer_init();
+  printf("multiDetector_runTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
+
+// Times one second of noise per channel for each channel count and backend.
+void multiDetector_runLoadTest() {
+  printf("starting multiDetector_runLoadTest()\n");
+  static const char *backendNames[] = {"IIR bank", "sliding DFT"};
+  isr_AdcValue_t *chunk =
+      (isr_AdcValue_t *)malloc(TEST_CHUNK_SIZE * sizeof(isr_AdcValue_t));
+  if (chunk == NULL) {
+    printf("multiDetector_runLoadTest: malloc failed.\n");
+    return;
+  }
+  bool ignoreNone[FILTER_FREQUENCY_COUNT] = {false};
+  for (uint16_t backend = 0; backend <= DETECTOR_BACKEND_SLIDING_DFT;
+       backend++) {
+    for (uint8_t n = 1; n <= MULTIDETECTOR_MAX_CHANNELS; n++) {
+      if (!multiDetector_init(testChannels, n, ignoreNone,
+                              (detector_backend_t)backend,
+                              MULTIDETECTOR_FUSION_ANY, 1))
+        break;
+      signalGen_t generators[MULTIDETECTOR_MAX_CHANNELS];
+      for (uint8_t c = 0; c < n; c++)
+        signalGen_init(&generators[c], TEST_NOISE_DEVIATION,
+                       TEST_RANDOM_SEED + c);
+      double seconds =
+          multiDetector_feedTest(generators, n, TEST_LOAD_SAMPLES, chunk);
+      double inputSeconds = (double)TEST_LOAD_SAMPLES / ADC_SAMPLES_PER_SECOND;
+      printf("%s, %d channel%s: %.1lf%% of the CPU\n", backendNames[backend],
+             n, n == 1 ? "" : "s", 100.0 * seconds / inputSeconds);
+    }
+  }
+  free(chunk);
+  lockoutTimer_init();
+}
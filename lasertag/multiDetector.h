@@ -0,0 +1,73 @@
+#ifndef MULTIDETECTOR_H_
+#define MULTIDETECTOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "detector.h"
+#include "isr.h" // ISR_MAX_ADC_CHANNELS
+
+// Runs one detector per ADC channel (several photodiodes on one player) and
+// fuses their hits into one hit for the player. Each channel has its own
+// filter bank and locks itself out after a hit; the fused hit starts
+// lockoutTimer and the hit LED, as a hit on the single-channel detector does.
+
+#define MULTIDETECTOR_MAX_CHANNELS ISR_MAX_ADC_CHANNELS
+
+// Channel hits on the same frequency at most this many ticks apart (50 ms)
+// are taken to be the same shot.
+#define MULTIDETECTOR_FUSION_WINDOW_TICKS 5000
+
+// How channel hits become a player hit.
+typedef enum {
+  MULTIDETECTOR_FUSION_ANY, // A hit on any channel.
+  MULTIDETECTOR_FUSION_VOTE // At least votes channels hit the same frequency
+                            // within MULTIDETECTOR_FUSION_WINDOW_TICKS.
+} multiDetector_fusion_t;
+
+// Starts reading xadcChannels[0..count-1] (see isr_initAdcChannels()) and
+// gives each a detector with the given backend. votes is only used by
+// MULTIDETECTOR_FUSION_VOTE and must be from 1 to count. Call after
+// isr_init(), with interrupts disabled. Returns false if the channels or
+// votes are invalid, or a detector cannot be allocated.
+bool multiDetector_init(const uint8_t xadcChannels[], uint8_t count,
+                        bool ignoredFrequencies[], detector_backend_t backend,
+                        multiDetector_fusion_t fusion, uint8_t votes);
+
+// Drains every channel's buffer through its detector in blocks, then fuses
+// the channel hits. Call from the main loop instead of detector().
+void multiDetector_run();
+
+// Returns true if a fused hit was detected.
+bool multiDetector_hitDetected();
+
+// Returns the frequency number of the last fused hit.
+uint16_t multiDetector_getFrequencyNumberOfLastHit();
+
+// Clear the fused hit once you have accounted for it.
+void multiDetector_clearHit();
+
+// Ignore all hits on every channel while flagValue is true.
+void multiDetector_ignoreAllHits(bool flagValue);
+
+// Copies the fused hit counts into hitArray.
+void multiDetector_getHitCounts(detector_hitCount_t hitArray[]);
+
+// Copies the hits detected on one channel, fused or not, into hitArray.
+void multiDetector_getChannelHitCounts(uint8_t channel,
+                                       detector_hitCount_t hitArray[]);
+
+/*******************************************************
+ ****************** Test Routines **********************
+ ******************************************************/
+
+// Feeds a shot seen by some of three channels through each fusion policy and
+// checks which ones report a hit. Returns true if all of them behave.
+bool multiDetector_runTest();
+
+// Feeds one second of input to 1 to ISR_MAX_ADC_CHANNELS channels for each
+// backend and prints the share of the CPU multiDetector_run() needs to keep
+// up with 100 kHz per channel.
+void multiDetector_runLoadTest();
+
+#endif /* MULTIDETECTOR_H_ */
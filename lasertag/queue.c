@@ -0,0 +1,172 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "queue.h"
+
+// Round up to the next power of two.
+static queue_size_t roundUpToPowerOfTwo(queue_size_t value) {
+  queue_size_t power = 1;
+  while (power < value)
+    power <<= 1;
+  return power;
+}
+
+// Allocates copies * the power-of-two array length and initializes all parts
+// of the data structure.
+static void queue_allocate(queue_t *q, queue_size_t size, const char *name,
+                           uint32_t copies) {
+  queue_size_t length = roundUpToPowerOfTwo(size ? size : 1);
+  q->data = (queue_data_t *)malloc(copies * length * sizeof(queue_data_t));
+  if (q->data == NULL) {
+    printf("queue_init: malloc of %lu elements for %s failed.\n",
+           (unsigned long)(copies * length), name);
+    assert(false);
+  }
+  q->indexIn = 0;
+  q->indexOut = 0;
+  q->elementCount = 0;
+  q->size = size;
+  q->mask = length - 1;
+  q->mirror = copies > 1 ? q->data + length : NULL;
+  q->underflowFlag = false;
+  q->overflowFlag = false;
+  strncpy(q->name, name, QUEUE_MAX_NAME_SIZE - 1);
+  q->name[QUEUE_MAX_NAME_SIZE - 1] = '\0';
+}
+
+// Allocates memory for the queue (the data* pointer) and initializes all
+// parts of the data structure.
+void queue_init(queue_t *q, queue_size_t size, const char *name) {
+  queue_allocate(q, size, name, 1);
+}
+
+// Same as queue_init(), but every element is stored twice.
+void queue_initMirrored(queue_t *q, queue_size_t size, const char *name) {
+  queue_allocate(q, size, name, 2);
+}
+
+// Store value at the next open slot (and its mirror, if any).
+static inline void queue_store(queue_t *q, queue_data_t value) {
+  queue_index_t slot = q->indexIn & q->mask;
+  q->data[slot] = value;
+  if (q->mirror != NULL)
+    q->mirror[slot] = value;
+  q->indexIn++;
+  q->elementCount++;
+}
+
+// Get the user-assigned name for the queue.
+const char *queue_name(queue_t *q) { return q->name; }
+
+// Returns the capacity of the queue.
+queue_size_t queue_size(queue_t *q) { return q->size; }
+
+// Returns true if the queue is full.
+bool queue_full(queue_t *q) { return q->elementCount == q->size; }
+
+// Returns true if the queue is empty.
+bool queue_empty(queue_t *q) { return q->elementCount == 0; }
+
+// If the queue is not full, pushes a new element into the queue and clears the
+// underflowFlag.
+void queue_push(queue_t *q, queue_data_t value) {
+  if (queue_full(q)) {
+    printf("queue_push: queue %s is full.\n", q->name);
+    q->overflowFlag = true;
+    return;
+  }
+  queue_store(q, value);
+  q->underflowFlag = false;
+}
+
+// If the queue is not empty, remove and return the oldest element in the queue.
+queue_data_t queue_pop(queue_t *q) {
+  if (queue_empty(q)) {
+    printf("queue_pop: queue %s is empty.\n", q->name);
+    q->underflowFlag = true;
+    return QUEUE_RETURN_ERROR_VALUE;
+  }
+  queue_data_t value = q->data[q->indexOut & q->mask];
+  q->indexOut++;
+  q->elementCount--;
+  q->overflowFlag = false;
+  return value;
+}
+
+// If the queue is full, drop the oldest element to make room. Done in place
+// rather than through queue_pop()/queue_push() since this runs for every
+// filter sample.
+void queue_overwritePush(queue_t *q, queue_data_t value) {
+  if (q->size == 0)
+    return;
+  if (queue_full(q)) {
+    q->indexOut++;
+    q->elementCount--;
+    q->overflowFlag = false;
+  }
+  queue_store(q, value);
+  q->underflowFlag = false;
+}
+
+// Provides random-access read capability to the queue. Index 0 is the oldest
+// element.
+queue_data_t queue_readElementAt(queue_t *q, queue_index_t index) {
+  if (index >= q->elementCount) {
+    printf("queue_readElementAt: index %lu out of range for queue %s "
+           "(%lu elements).\n",
+           (unsigned long)index, q->name, (unsigned long)q->elementCount);
+    return QUEUE_RETURN_ERROR_VALUE;
+  }
+  return queue_readElementAtUnchecked(q, index);
+}
+
+// Fills *spans with a view of the current contents of the queue.
+void queue_getSpans(queue_t *q, queue_spans_t *spans) {
+  queue_index_t start = q->indexOut & q->mask;
+  queue_size_t untilEnd = q->mask + 1 - start;
+  spans->first = &q->data[start];
+  if (q->mirror != NULL || q->elementCount <= untilEnd) {
+    spans->firstCount = q->elementCount;
+    spans->second = q->data;
+    spans->secondCount = 0;
+  } else {
+    spans->firstCount = untilEnd;
+    spans->second = q->data;
+    spans->secondCount = q->elementCount - untilEnd;
+  }
+}
+
+// Returns the contents of a mirrored queue as one array, oldest first.
+const queue_data_t *queue_getContiguous(queue_t *q) {
+  if (q->mirror == NULL) {
+    printf("queue_getContiguous: queue %s is not mirrored.\n", q->name);
+    return NULL;
+  }
+  return &q->data[q->indexOut & q->mask];
+}
+
+// Returns a count of the elements currently contained in the queue.
+queue_size_t queue_elementCount(queue_t *q) { return q->elementCount; }
+
+// Returns true if an underflow has occurred.
+bool queue_underflow(queue_t *q) { return q->underflowFlag; }
+
+// Returns true if an overflow has occurred.
+bool queue_overflow(queue_t *q) { return q->overflowFlag; }
+
+// Frees the storage that you malloc'd before.
+void queue_garbageCollect(queue_t *q) {
+  free(q->data);
+  q->data = NULL;
+  q->mirror = NULL;
+}
+
+// Prints the current contents of the queue, oldest element first.
+void queue_print(queue_t *q) {
+  printf("queue %s (%lu of %lu):\n", q->name, (unsigned long)q->elementCount,
+         (unsigned long)q->size);
+  for (queue_index_t i = 0; i < q->elementCount; i++)
+    printf("%lf\n", queue_readElementAt(q, i));
+}
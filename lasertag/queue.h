@@ -30,21 +30,27 @@ typedef double queue_data_t;
 typedef uint32_t queue_size_t;
 
 // The queue struct with elementCount to speed up computations to determine
-// element count. Queue will use the empty location and pointer arithmetic to
-// determine full and empty.
+// element count. The data array is allocated at the next power of two at or
+// above the requested size so that indexIn and indexOut can run freely and be
+// masked into the array instead of wrapped with a modulo. Full and empty are
+// determined from elementCount against size.
 typedef struct {
-  // Always points to the next open slot.
+  // Total number of elements ever pushed; masked, it is the next open slot.
   queue_index_t indexIn;
-  // Always points to the next element to be removed
-  // from the queue (or "oldest" element).
+  // Total number of elements ever popped; masked, it is the next element to be
+  // removed from the queue (or "oldest" element).
   queue_index_t indexOut;
   // Keep track of the number of elements currently in queue.
   queue_size_t elementCount;
-  // This is the size of the data array. Actual queue
-  // capacity is one less.
+  // The capacity requested in queue_init().
   queue_size_t size;
+  // Length of the data array minus one (the array length is a power of two).
+  queue_index_t mask;
   // Points to a dynamically-allocated array.
   queue_data_t *data;
+  // For a mirrored queue, the second copy of the array (data + mask + 1);
+  // NULL otherwise.
+  queue_data_t *mirror;
   // True if queue_pop() is called on an empty queue. Reset
   // to false after queue_push() is called.
   bool underflowFlag;
@@ -60,6 +66,13 @@ typedef struct {
 // and calls assert(false) to print-out line-number information and die.
 void queue_init(queue_t *q, queue_size_t size, const char *name);
 
+// Same as queue_init(), but the queue is a mirrored delay line: the array is
+// allocated twice over and every element is written to both copies, so the
+// contents are always one contiguous run (see queue_getContiguous()). Pushes
+// cost a second store; reads cost nothing extra. Use this for the filter
+// xQueue/yQueue/zQueue, whose whole contents are read on every output.
+void queue_initMirrored(queue_t *q, queue_size_t size, const char *name);
+
 // Get the user-assigned name for the queue.
 const char *queue_name(queue_t *);
 
@@ -92,6 +105,36 @@ void queue_overwritePush(queue_t *q, queue_data_t value);
 // meaningful error message if an error condition is detected.
 queue_data_t queue_readElementAt(queue_t *q, queue_index_t index);
 
+// Same as queue_readElementAt() without the bounds check or error message,
+// for inner loops (filter taps) that already know index <
+// queue_elementCount(q).
+static inline queue_data_t queue_readElementAtUnchecked(const queue_t *q,
+                                                        queue_index_t index) {
+  return q->data[(q->indexOut + index) & q->mask];
+}
+
+// The contents of a queue as at most two contiguous runs of memory, oldest
+// element first: first[0 .. firstCount-1] followed by
+// second[0 .. secondCount-1]. secondCount is 0 when the contents do not wrap
+// around the end of the array. Lets a loop run over plain arrays (and be
+// unrolled or vectorized) with no per-element index arithmetic.
+typedef struct {
+  const queue_data_t *first;
+  queue_size_t firstCount;
+  const queue_data_t *second;
+  queue_size_t secondCount;
+} queue_spans_t;
+
+// Fills *spans with a view of the current contents of the queue. The view is
+// valid until the queue is next modified. For a mirrored queue secondCount is
+// always 0.
+void queue_getSpans(queue_t *q, queue_spans_t *spans);
+
+// Returns the contents of a mirrored queue as one array, oldest element at
+// [0] and newest at [queue_elementCount(q) - 1]. Valid until the queue is next
+// modified. Prints an error and returns NULL if q is not mirrored.
+const queue_data_t *queue_getContiguous(queue_t *q);
+
 // Returns a count of the elements currently contained in the queue.
 queue_size_t queue_elementCount(queue_t *q);
 
@@ -117,4 +160,9 @@ void queue_print(queue_t *q);
 // during the test.
 bool queue_runTest();
 
+// Times queue_readElementAt(), queue_readElementAtUnchecked(), a
+// queue_getSpans() loop, and a modulo-indexed reference, summing a full queue
+// the way filter_firFilter() does. Prints the time per element for each.
+void queue_runBenchmark();
+
 #endif /* QUEUE_H_ */
\ No newline at end of file
@@ -10,6 +10,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "intervalTimer.h"
 #include "queue.h"
 
 #define SMALL_QUEUE_SIZE 1000
@@ -628,3 +629,88 @@ bool queue_runTest() {
   }
   return testResult;
 }
+
+#define BENCHMARK_QUEUE_SIZE 2000 // Same as the filter power queues.
+#define BENCHMARK_PASS_COUNT 100  // Full-queue sums per measurement.
+#define BENCHMARK_TIMER INTERVAL_TIMER_0
+#define BENCHMARK_QUEUE_NAME "benchmarkQ"
+
+// Reference for the benchmark: the conventional ring with one unused slot
+// that wraps its index with a modulo on every access.
+static queue_data_t moduloData[BENCHMARK_QUEUE_SIZE + 1];
+static queue_index_t moduloIndexOut;
+
+// Sum of every element, computed by the method under test, so the compiler
+// cannot discard the reads.
+static volatile queue_data_t benchmarkSink;
+
+// Time BENCHMARK_PASS_COUNT runs of sumPass and print the time per element.
+static void benchmark(const char *label, queue_t *q,
+                      queue_data_t (*sumPass)(queue_t *)) {
+  queue_data_t sum = 0.0;
+  intervalTimer_initCountUp(BENCHMARK_TIMER);
+  intervalTimer_start(BENCHMARK_TIMER);
+  for (uint32_t pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+    sum += sumPass(q);
+  intervalTimer_stop(BENCHMARK_TIMER);
+  benchmarkSink = sum;
+  double seconds = intervalTimer_getTotalDurationInSeconds(BENCHMARK_TIMER);
+  printf("%-28s %8.2lf ns/element (sum %lf)\n", label,
+         seconds * 1e9 / (BENCHMARK_PASS_COUNT * queue_elementCount(q)), sum);
+}
+
+static queue_data_t sumModulo(queue_t *q) {
+  queue_data_t sum = 0.0;
+  for (queue_index_t i = 0; i < queue_elementCount(q); i++)
+    sum += moduloData[(moduloIndexOut + i) % (BENCHMARK_QUEUE_SIZE + 1)];
+  return sum;
+}
+
+static queue_data_t sumChecked(queue_t *q) {
+  queue_data_t sum = 0.0;
+  for (queue_index_t i = 0; i < queue_elementCount(q); i++)
+    sum += queue_readElementAt(q, i);
+  return sum;
+}
+
+static queue_data_t sumUnchecked(queue_t *q) {
+  queue_data_t sum = 0.0;
+  queue_size_t count = queue_elementCount(q);
+  for (queue_index_t i = 0; i < count; i++)
+    sum += queue_readElementAtUnchecked(q, i);
+  return sum;
+}
+
+static queue_data_t sumSpans(queue_t *q) {
+  queue_spans_t spans;
+  queue_getSpans(q, &spans);
+  queue_data_t sum = 0.0;
+  for (queue_index_t i = 0; i < spans.firstCount; i++)
+    sum += spans.first[i];
+  for (queue_index_t i = 0; i < spans.secondCount; i++)
+    sum += spans.second[i];
+  return sum;
+}
+
+// Times each way of reading a full queue. The queues are wrapped part way so
+// the modulo/mask and the two-span split are all exercised.
+void queue_runBenchmark() {
+  queue_t q;
+  queue_init(&q, BENCHMARK_QUEUE_SIZE, BENCHMARK_QUEUE_NAME);
+  for (queue_index_t i = 0; i < BENCHMARK_QUEUE_SIZE + BENCHMARK_QUEUE_SIZE / 3;
+       i++)
+    queue_overwritePush(&q, (queue_data_t)(i % 17));
+  // Mirror the same contents into the modulo reference.
+  moduloIndexOut = BENCHMARK_QUEUE_SIZE / 2;
+  for (queue_index_t i = 0; i < BENCHMARK_QUEUE_SIZE; i++)
+    moduloData[(moduloIndexOut + i) % (BENCHMARK_QUEUE_SIZE + 1)] =
+        queue_readElementAt(&q, i);
+
+  printf("=== Queue read benchmark (%u elements, %u passes) ===\n",
+         BENCHMARK_QUEUE_SIZE, BENCHMARK_PASS_COUNT);
+  benchmark("modulo reference", &q, sumModulo);
+  benchmark("queue_readElementAt", &q, sumChecked);
+  benchmark("queue_readElementAtUnchecked", &q, sumUnchecked);
+  benchmark("queue_getSpans", &q, sumSpans);
+  queue_garbageCollect(&q);
+}
@@ -13,6 +13,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include <stdlib.h>
 #include <string.h>
 
+#include "adcCapture.h"
 #include "buttons.h"
 #include "detector.h"
 #include "display.h"
@@ -27,7 +28,9 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "switches.h"
 #include "transmitter.h"
 #include "trigger.h"
+#include "uiQueue.h"
 #include "utils.h"
+#include "xil_printf.h"
 #include "xparameters.h"
 
 // Uncomment this code so that the code in the various modes will
@@ -53,6 +56,12 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define SYSTEM_TICKS_PER_HISTOGRAM_UPDATE                                      \
   30000 // Update the histogram about 3 times per second.
 
+// Shooter mode draws the histogram from uiQueue for at most this many
+// interval-timer cycles (200 us) per main-loop iteration, and only while at
+// most this many ADC values are waiting.
+#define UI_CYCLE_BUDGET 20000
+#define UI_BACKLOG_THRESHOLD 100
+
 #define RUNNING_MODE_WARNING_TEXT_SIZE 2 // Upsize the text for visibility.
 #define RUNNING_MODE_WARNING_TEXT_COLOR DISPLAY_RED // Red for more visibility.
 #define RUNNING_MODE_NORMAL_TEXT_SIZE 1 // Normal size for reporting.
@@ -73,6 +82,32 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // Keep track of detector invocations.
 uint32_t detectorInvocationCount = 0;
 
+// Time spent and pixels written updating the histogram, to compare with the
+// time spent in the detector. The display is timed by sampling the total
+// run-time timer, since all three interval timers are already in use.
+static double displaySeconds = 0.0;
+static double displayStartSeconds;
+static uint32_t displayPixelCount = 0;
+static uint32_t displayUpdateCount = 0;
+
+// Call before a histogram update.
+static void runningModes_startDisplayUpdate() {
+  displayStartSeconds =
+      intervalTimer_getTotalDurationInSeconds(TOTAL_RUNTIME_TIMER);
+}
+
+// Call after a histogram update with the pixels it wrote. Only updates that
+// wrote something are counted.
+static void runningModes_endDisplayUpdate(uint32_t pixelCount) {
+  if (pixelCount == 0)
+    return;
+  displaySeconds +=
+      intervalTimer_getTotalDurationInSeconds(TOTAL_RUNTIME_TIMER) -
+      displayStartSeconds;
+  displayPixelCount += pixelCount;
+  displayUpdateCount++;
+}
+
 // This array is indexed by frequency number. If array-element[freq_no] == true,
 // the frequency is ignored, e.g., no hit will ever occur at that frequency.
 // static bool ignoredFrequenciesArray[FILTER_FREQUENCY_COUNT] =
@@ -134,6 +169,16 @@ void runningModes_printRunTimeStatistics() {
   display_print(sprintfBuffer);
   display_println("%)");
   display_printChar('\n');
+  // Print out cumulative time spent updating the histogram.
+  display_print("Cumulative run-time in display: ");
+  sprintf(sprintfBuffer, "%5.2f (%5.2f%%)", displaySeconds,
+          displaySeconds / runningSeconds * 100);
+  display_println(sprintfBuffer);
+  display_print("Display updates: ");
+  display_printDecimalInt(displayUpdateCount);
+  display_print(", pixels written: ");
+  display_printlnDecimalInt(displayPixelCount);
+  display_printChar('\n');
   uint32_t interruptCount = interrupts_isrInvocationCount();
   // Print out total interrupt count.
   display_print("Total interrupts:            ");
@@ -177,6 +222,9 @@ void runningModes_initAll() {
   filter_init();
   isr_init(); // includes: transmitter, trigger, hitLedTimer, lockoutTimer, &
               // sound init
+  displaySeconds = 0.0;
+  displayPixelCount = 0;
+  displayUpdateCount = 0;
 }
 
 // Returns the current switch-setting
@@ -245,8 +293,9 @@ void runningModes_continuous() {
                                                   // values to here.
       filter_getCurrentPowerValues(
           powerValues); // Copy the current power values.
-      histogram_plotUserFrequencyPower(
-          powerValues); // Plot the power values on the TFT.
+      runningModes_startDisplayUpdate();
+      runningModes_endDisplayUpdate(histogram_plotUserFrequencyPower(
+          powerValues)); // Plot the power values on the TFT.
       histogramSystemTicks =
           0; // Reset the tick count and wait for the next update time.
     }
@@ -271,6 +320,8 @@ void runningModes_shooter() {
   ignoredFrequencies[runningModes_getFrequencySetting()] = true;
 #endif
   detector_init(ignoredFrequencies);
+  uiQueue_init(HISTOGRAM_BAR_COUNT, TOTAL_RUNTIME_TIMER, UI_CYCLE_BUDGET,
+               UI_BACKLOG_THRESHOLD);
   uint16_t hitCount = 0;
   detectorInvocationCount = 0; // Keep track of detector invocations.
   trigger_enable();         // Makes the trigger state machine responsive to the
@@ -311,10 +362,18 @@ void runningModes_shooter() {
       detector_hitCount_t
           hitCounts[DETECTOR_HIT_ARRAY_SIZE]; // Store the hit-counts here.
       detector_getHitCounts(hitCounts);       // Get the current hit counts.
-      histogram_plotUserHits(hitCounts);      // Plot the hit counts on the TFT.
+      // Post the new count; uiQueue draws it when the detector is caught up.
+      uint16_t frequencyNumber = detector_getFrequencyNumberOfLastHit();
+      uiQueue_postBarValue(frequencyNumber, hitCounts[frequencyNumber]);
     }
     intervalTimer_stop(
         MAIN_CUMULATIVE_TIMER); // All done with actual processing.
+    // Draw the histogram for a time slice if the ADC buffer is nearly empty.
+    // Most iterations have nothing to draw, so only those that do are timed.
+    if (!uiQueue_isIdle()) {
+      runningModes_startDisplayUpdate();
+      runningModes_endDisplayUpdate(uiQueue_run(isr_adcBufferElementCount()));
+    }
   }
   interrupts_disableArmInts(); // Done with loop, disable the interrupts.
   hitLedTimer_turnLedOff();    // Save power :-)
@@ -341,3 +400,40 @@ void runningModes_dumpRawAdcValues() {
     printf("raw ADC value: %d\n", signExtendedValue);
   }
 }
+
+// Values moved from the ADC buffer to the capture ring per pass.
+#define CAPTURE_CHUNK_SIZE 1000
+
+// Sends a trace byte straight to the UART. stdout would turn every '\n' into
+// "\r\n" and break the trace CRC.
+static void runningModes_putTraceByte(uint8_t byte) { outbyte(byte); }
+
+// Records raw ADC values until btn3 is pressed, then dumps them as a trace.
+void runningModes_captureAdcTrace() {
+  runningModes_initAll();
+  if (!adcCapture_init(ADCCAPTURE_DEFAULT_CAPACITY))
+    return;
+  trigger_enable(); // Shots are part of the capture.
+  interrupts_initAll(true);
+  interrupts_enableTimerGlobalInts();
+  interrupts_startArmPrivateTimer();
+  interrupts_enableArmInts();
+  printf("Capturing ADC values, press BTN3 to stop.\n");
+  isr_AdcValue_t chunk[CAPTURE_CHUNK_SIZE];
+  while (!(buttons_read() & BUTTONS_BTN3_MASK)) {
+    transmitter_setFrequencyNumber(runningModes_getFrequencySetting());
+    uint32_t count = isr_removeManyFromAdcBuffer(chunk, CAPTURE_CHUNK_SIZE);
+    adcCapture_addSamples(chunk, count);
+  }
+  interrupts_disableArmInts();
+  // Drain what the ISR left behind so the trace ends at the button press.
+  uint32_t count;
+  while ((count = isr_removeManyFromAdcBuffer(chunk, CAPTURE_CHUNK_SIZE)))
+    adcCapture_addSamples(chunk, count);
+  printf("Sending %lu ADC values.\n",
+         (unsigned long)adcCapture_getSampleCount());
+  fflush(stdout); // Nothing may follow the trace's first byte.
+  adcCapture_writeTrace(runningModes_putTraceByte);
+  printf("\nTrace sent.\n");
+  adcCapture_garbageCollect();
+}
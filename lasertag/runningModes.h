@@ -68,4 +68,11 @@ void runningModes_creative();
 // Will loop forever. Stop the program with an external reset or Ctl-C.
 void runningModes_dumpRawAdcValues();
 
+// This mode records raw ADC values into RAM (the most recent
+// ADCCAPTURE_DEFAULT_CAPACITY of them) until btn3 is pressed, then sends them
+// to the console as a binary trace (adcCapture.h) for tools/adcReplay.
+// Transmit frequency is selected via the slide-switches and BTN0 or the
+// gun-trigger shoots, so a capture can include hits.
+void runningModes_captureAdcTrace();
+
 #endif /* RUNNINGMODES_H_ */
@@ -0,0 +1,88 @@
+#include <math.h>
+#include <stdio.h>
+
+#include "filter.h"
+#include "signalGen.h"
+
+// Any nonzero state works for xorshift; mixing in a constant keeps seed 0
+// usable.
+#define RANDOM_SEED_MIX 0x9E3779B97F4A7C15ULL
+#define RANDOM_MULTIPLIER 0x2545F4914F6CDD1DULL
+#define RANDOM_UNIT (1.0 / 9007199254740992.0) // 2^-53
+
+// Starts a generator at sample 0 with no shots or echoes.
+void signalGen_init(signalGen_t *g, double noiseDeviation, uint32_t seed) {
+  g->shotCount = 0;
+  g->echoCount = 0;
+  g->noiseDeviation = noiseDeviation;
+  g->randomState = seed ^ RANDOM_SEED_MIX;
+  g->sampleNumber = 0;
+}
+
+// Schedules a shot.
+bool signalGen_addShot(signalGen_t *g, uint16_t frequencyNumber,
+                       uint32_t startSample, uint32_t length,
+                       double amplitude) {
+  if (g->shotCount == SIGNALGEN_MAX_SHOTS ||
+      frequencyNumber >= FILTER_FREQUENCY_COUNT) {
+    printf("signalGen_addShot: cannot add a shot at frequency %u.\n",
+           frequencyNumber);
+    return false;
+  }
+  g->shots[g->shotCount++] = (signalGen_shot_t){frequencyNumber, startSample,
+                                                length, amplitude};
+  return true;
+}
+
+// Adds an echo of every shot.
+bool signalGen_addEcho(signalGen_t *g, uint32_t delay, double gain) {
+  if (g->echoCount == SIGNALGEN_MAX_ECHOES) {
+    printf("signalGen_addEcho: at most %u echoes.\n", SIGNALGEN_MAX_ECHOES);
+    return false;
+  }
+  g->echoes[g->echoCount++] = (signalGen_echo_t){delay, gain};
+  return true;
+}
+
+// Uniform on (0, 1], from xorshift64*.
+static double nextUniform(signalGen_t *g) {
+  g->randomState ^= g->randomState >> 12;
+  g->randomState ^= g->randomState << 25;
+  g->randomState ^= g->randomState >> 27;
+  return ((g->randomState * RANDOM_MULTIPLIER >> 11) + 1) * RANDOM_UNIT;
+}
+
+// Standard normal, from Box-Muller (the second value is discarded).
+static double nextGaussian(signalGen_t *g) {
+  return sqrt(-2.0 * log(nextUniform(g))) * cos(2.0 * M_PI * nextUniform(g));
+}
+
+// Value of shot s at sample n over a path with the given delay.
+static double shotValue(const signalGen_shot_t *s, uint32_t n,
+                        uint32_t delay) {
+  if (n < s->startSample + delay || n >= s->startSample + delay + s->length)
+    return 0.0;
+  uint32_t period = filter_frequencyTickTable[s->frequencyNumber];
+  return (n - s->startSample - delay) % period < period / 2 ? -s->amplitude
+                                                            : s->amplitude;
+}
+
+// Writes the next count ADC values to values[].
+void signalGen_generate(signalGen_t *g, isr_AdcValue_t values[],
+                        uint32_t count) {
+  for (uint32_t i = 0; i < count; i++, g->sampleNumber++) {
+    double value = SIGNALGEN_ADC_MIDSCALE;
+    for (uint16_t s = 0; s < g->shotCount; s++) {
+      value += shotValue(&g->shots[s], g->sampleNumber, 0);
+      for (uint16_t e = 0; e < g->echoCount; e++)
+        value += g->echoes[e].gain *
+                 shotValue(&g->shots[s], g->sampleNumber, g->echoes[e].delay);
+    }
+    if (g->noiseDeviation > 0.0)
+      value += g->noiseDeviation * nextGaussian(g);
+    value = round(value);
+    values[i] = value < 0.0                 ? 0
+                : value > SIGNALGEN_ADC_MAX ? SIGNALGEN_ADC_MAX
+                                            : (isr_AdcValue_t)value;
+  }
+}
@@ -0,0 +1,59 @@
+#ifndef SIGNALGEN_H_
+#define SIGNALGEN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "isr.h"
+
+// Synthetic transmitter for tests and host runs of the signal chain: the ADC
+// values the XADC would read at 100 kHz while other players shoot. A shot is a
+// square wave with the period of filter_frequencyTickTable[frequencyNumber], as
+// transmitter.c produces. The received signal is the sum of every shot over
+// the direct path and any echoes (multipath: a delay and a gain each), plus
+// Gaussian noise, around mid-scale and clipped to the 12-bit ADC range.
+
+#define SIGNALGEN_MAX_SHOTS 32
+#define SIGNALGEN_MAX_ECHOES 4
+#define SIGNALGEN_ADC_MIDSCALE 2048
+#define SIGNALGEN_ADC_MAX 4095
+
+typedef struct {
+  uint16_t frequencyNumber;
+  uint32_t startSample; // Sample number of the first value of the shot.
+  uint32_t length;      // In samples.
+  double amplitude;     // Peak, in ADC counts.
+} signalGen_shot_t;
+
+typedef struct {
+  uint32_t delay; // In samples, relative to the direct path.
+  double gain;    // Relative to the direct path.
+} signalGen_echo_t;
+
+typedef struct {
+  signalGen_shot_t shots[SIGNALGEN_MAX_SHOTS];
+  uint16_t shotCount;
+  signalGen_echo_t echoes[SIGNALGEN_MAX_ECHOES];
+  uint16_t echoCount;
+  double noiseDeviation; // Standard deviation of the noise, in ADC counts.
+  uint64_t randomState;
+  uint32_t sampleNumber; // Sample number of the next generated value.
+} signalGen_t;
+
+// Starts a generator at sample 0 with no shots or echoes. The same seed gives
+// the same noise.
+void signalGen_init(signalGen_t *g, double noiseDeviation, uint32_t seed);
+
+// Schedules a shot. Returns false if there is no room for it.
+bool signalGen_addShot(signalGen_t *g, uint16_t frequencyNumber,
+                       uint32_t startSample, uint32_t length,
+                       double amplitude);
+
+// Adds an echo of every shot. Returns false if there is no room for it.
+bool signalGen_addEcho(signalGen_t *g, uint32_t delay, double gain);
+
+// Writes the next count ADC values to values[].
+void signalGen_generate(signalGen_t *g, isr_AdcValue_t values[],
+                        uint32_t count);
+
+#endif /* SIGNALGEN_H_ */
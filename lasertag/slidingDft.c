@@ -0,0 +1,134 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "queue.h"
+#include "slidingDft.h"
+
+#define QUEUE_INIT_VALUE 0.0
+
+struct slidingDft_state {
+  // Twiddle w and w^N for each bin, and the running DFT S.
+  double wRe[FILTER_FREQUENCY_COUNT];
+  double wIm[FILTER_FREQUENCY_COUNT];
+  double wNRe[FILTER_FREQUENCY_COUNT];
+  double wNIm[FILTER_FREQUENCY_COUNT];
+  double sRe[FILTER_FREQUENCY_COUNT];
+  double sIm[FILTER_FREQUENCY_COUNT];
+
+  // The last SLIDINGDFT_WINDOW_SIZE inputs, shared by all of the bins.
+  queue_t window;
+
+  double currentPowerValue[FILTER_FREQUENCY_COUNT];
+};
+
+// The state the functions without a slidingDft_state_t argument use.
+static slidingDft_state_t defaultState;
+
+// Zeroes the window and the bins. The window is allocated on the first call
+// only.
+void slidingDftState_init(slidingDft_state_t *state) {
+  if (state->window.data == NULL)
+    queue_init(&state->window, SLIDINGDFT_WINDOW_SIZE, "slidingDftWindow");
+  filter_fillQueue(&state->window, QUEUE_INIT_VALUE);
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    // Radians per decimated sample: the tick count is the period at the
+    // undecimated rate.
+    double omega = 2.0 * M_PI * FILTER_FIR_DECIMATION_FACTOR /
+                   filter_frequencyTickTable[f];
+    state->wRe[f] = cos(omega);
+    state->wIm[f] = sin(omega);
+    state->wNRe[f] = cos(omega * SLIDINGDFT_WINDOW_SIZE);
+    state->wNIm[f] = sin(omega * SLIDINGDFT_WINDOW_SIZE);
+    state->sRe[f] = 0.0;
+    state->sIm[f] = 0.0;
+    state->currentPowerValue[f] = 0.0;
+  }
+}
+
+// Allocates and initializes a state.
+slidingDft_state_t *slidingDft_createState() {
+  slidingDft_state_t *newState =
+      (slidingDft_state_t *)calloc(1, sizeof(slidingDft_state_t));
+  if (newState == NULL) {
+    printf("slidingDft_createState: calloc failed.\n");
+    return NULL;
+  }
+  slidingDftState_init(newState);
+  return newState;
+}
+
+// Frees oldState, created by slidingDft_createState(), and its window. Does
+// nothing if oldState is NULL.
+void slidingDft_destroyState(slidingDft_state_t *oldState) {
+  if (oldState == NULL)
+    return;
+  queue_garbageCollect(&oldState->window);
+  free(oldState);
+}
+
+// Returns the state the functions without a slidingDft_state_t argument use.
+slidingDft_state_t *slidingDft_getDefaultState() { return &defaultState; }
+
+// Slides every bin forward by one decimated input.
+void slidingDftState_addNewInput(slidingDft_state_t *d, double x) {
+  double oldest = queue_readElementAtUnchecked(&d->window, 0);
+  queue_overwritePush(&d->window, x);
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    double re = d->wRe[f] * d->sRe[f] - d->wIm[f] * d->sIm[f] + x -
+                d->wNRe[f] * oldest;
+    double im = d->wRe[f] * d->sIm[f] + d->wIm[f] * d->sRe[f] -
+                d->wNIm[f] * oldest;
+    d->sRe[f] = re;
+    d->sIm[f] = im;
+  }
+}
+
+// Returns the power in the window for bin frequencyNumber.
+double slidingDftState_computePower(slidingDft_state_t *state,
+                                    uint16_t frequencyNumber) {
+  double re = state->sRe[frequencyNumber];
+  double im = state->sIm[frequencyNumber];
+  state->currentPowerValue[frequencyNumber] =
+      2.0 * (re * re + im * im) / SLIDINGDFT_WINDOW_SIZE;
+  return state->currentPowerValue[frequencyNumber];
+}
+
+// Block version of slidingDftState_addNewInput() and
+// slidingDftState_computePower().
+void slidingDftState_addNewInputBlock(
+    slidingDft_state_t *state, const double x[], uint32_t count,
+    double powerValues[][FILTER_FREQUENCY_COUNT]) {
+  for (uint32_t n = 0; n < count; n++) {
+    slidingDftState_addNewInput(state, x[n]);
+    for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+      powerValues[n][f] = slidingDftState_computePower(state, f);
+  }
+}
+
+// Copies the power values from the last slidingDftState_computePower() calls.
+void slidingDftState_getCurrentPowerValues(slidingDft_state_t *state,
+                                           double powerValues[]) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    powerValues[i] = state->currentPowerValue[i];
+}
+
+// The same functions on the default state.
+void slidingDft_init() { slidingDftState_init(&defaultState); }
+
+void slidingDft_addNewInput(double x) {
+  slidingDftState_addNewInput(&defaultState, x);
+}
+
+double slidingDft_computePower(uint16_t frequencyNumber) {
+  return slidingDftState_computePower(&defaultState, frequencyNumber);
+}
+
+void slidingDft_addNewInputBlock(const double x[], uint32_t count,
+                                 double powerValues[][FILTER_FREQUENCY_COUNT]) {
+  slidingDftState_addNewInputBlock(&defaultState, x, count, powerValues);
+}
+
+void slidingDft_getCurrentPowerValues(double powerValues[]) {
+  slidingDftState_getCurrentPowerValues(&defaultState, powerValues);
+}
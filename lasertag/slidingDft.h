@@ -0,0 +1,69 @@
+#ifndef SLIDINGDFT_H_
+#define SLIDINGDFT_H_
+
+#include <stdint.h>
+
+#include "filter.h"
+
+// Band power at the player frequencies from a sliding DFT over the decimated
+// FIR output, as an alternative to the IIR bank and its power queues. Bin f
+// holds the DFT of the last SLIDINGDFT_WINDOW_SIZE inputs at the frequency of
+// filter_frequencyTickTable[f], and each new input updates it with
+//   S = w * S + x[n] - w^N * x[n - N],   w = exp(j * 2 * pi * f / fs)
+// which is two complex multiplies per bin instead of a 10th-order IIR filter
+// and a power queue. The player frequencies do not fall on whole bins of the
+// window, so the w^N term is kept rather than assumed to be 1.
+//
+// Power is 2 * |S|^2 / N: a sine of amplitude A reads N * A^2 / 2, the same
+// as filter_computePower() over a window of N outputs at unity gain.
+
+// Same window as the IIR output queues.
+#define SLIDINGDFT_WINDOW_SIZE FILTER_INPUT_PULSE_WIDTH
+
+// Zeroes the window and the bins. Must be called before the functions below.
+void slidingDft_init();
+
+// As with filter_state_t, the window and bins live in a slidingDft_state_t.
+// The slidingDft_ functions work on a default one; the slidingDftState_
+// functions at the end take the state explicitly.
+typedef struct slidingDft_state slidingDft_state_t;
+
+// Allocates and initializes a state (as slidingDft_init() would). Returns NULL
+// if out of memory.
+slidingDft_state_t *slidingDft_createState();
+
+// Frees a state from slidingDft_createState() and its window; NULL is
+// ignored.
+void slidingDft_destroyState(slidingDft_state_t *state);
+
+// Returns the default state, the one the slidingDft_ functions use.
+slidingDft_state_t *slidingDft_getDefaultState();
+
+// Slides every bin forward by one decimated input (a FIR output).
+void slidingDft_addNewInput(double x);
+
+// Returns the power in the window for bin frequencyNumber, and saves it for
+// slidingDft_getCurrentPowerValues().
+double slidingDft_computePower(uint16_t frequencyNumber);
+
+// Calls slidingDft_addNewInput() on each of the count inputs in x[] and
+// writes the power of every bin after each input to powerValues[i].
+void slidingDft_addNewInputBlock(const double x[], uint32_t count,
+                                 double powerValues[][FILTER_FREQUENCY_COUNT]);
+
+// Copies the power values from the last slidingDft_computePower() calls.
+void slidingDft_getCurrentPowerValues(double powerValues[]);
+
+// Each of these is the slidingDft_ function of the same name working on state
+// instead of the default state.
+void slidingDftState_init(slidingDft_state_t *state);
+void slidingDftState_addNewInput(slidingDft_state_t *state, double x);
+double slidingDftState_computePower(slidingDft_state_t *state,
+                                    uint16_t frequencyNumber);
+void slidingDftState_addNewInputBlock(
+    slidingDft_state_t *state, const double x[], uint32_t count,
+    double powerValues[][FILTER_FREQUENCY_COUNT]);
+void slidingDftState_getCurrentPowerValues(slidingDft_state_t *state,
+                                           double powerValues[]);
+
+#endif /* SLIDINGDFT_H_ */
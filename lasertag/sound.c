@@ -9,15 +9,17 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #include <stdio.h>
 
+#include "adpcm.h"
 #include "sound.h"
-#include "sounds/bcfire01_48k.wav.h"
-#include "sounds/gameBoyStartup.wav.h"
-#include "sounds/gameOver48k.wav.h"
-#include "sounds/gunEmpty48k.wav.h"
-#include "sounds/ouch48k.wav.h"
-#include "sounds/pacmanDeath.wav.h"
-#include "sounds/powerUp48k.wav.h"
-#include "sounds/screamAndDie48k.wav.h"
+#include "soundDma.h"
+#include "sounds/bcfire01_48k.wav.adpcm.h"
+#include "sounds/gameBoyStartup.wav.adpcm.h"
+#include "sounds/gameOver48k.wav.adpcm.h"
+#include "sounds/gunEmpty48k.wav.adpcm.h"
+#include "sounds/ouch48k.wav.adpcm.h"
+#include "sounds/pacmanDeath.wav.adpcm.h"
+#include "sounds/powerUp48k.wav.adpcm.h"
+#include "sounds/screamAndDie48k.wav.adpcm.h"
 #include "timer_ps.h"
 #include "xiicps.h"
 #include "xil_printf.h"
@@ -51,10 +53,8 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #define SOUND_MULTIPLIER INT16_MAX / 3 // Primitive volume control.
 
-#define NO_SOUND 0 // A zero generates no sound.
 #define ONE_SECOND_OF_SOUND_ARRAY_SIZE                                         \
   48000 // The sample rate is 48k so that is 1 second's worth.
-uint16_t soundOfSilence[ONE_SECOND_OF_SOUND_ARRAY_SIZE];
 
 // Declared below the sound state-machine code.
 static int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr);
@@ -65,17 +65,45 @@ static int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr);
 // True if sound_init() has been called, false otherwise.
 volatile static bool sound_initFlag = false;
 
-// True if a sound should be played, false otherwise.
-// Note that the state-machine sets this back to false once it has completed
-// playing a sound.
-volatile static bool sound_playSoundFlag = false;
-
-// Keep track of the base pointer to the sound array with current sample-rate
-// and sample count.
-volatile static uint16_t *sound_array; // Base pointer to the sound array.
-
-// static uint32_t sound_sampleRate;  // Sample rate for this sound.
-volatile static uint32_t sound_sampleCount; // Number of samples in this sound.
+// The mixer plays up to SOUND_VOICE_COUNT sounds at once. The sounds are
+// stored as IMA ADPCM (see adpcm.h) and each voice decodes its own as it goes,
+// straight into the DMA buffers, which are the only decoded copy. Each active
+// voice contributes sample * gain / SOUND_GAIN_UNITY, the sum is saturated to
+// 16 bits and made offset binary (SOUND_MIDSCALE is silence) and scaled by the
+// volume as a single sound used to be.
+#define SOUND_MIDSCALE 32768
+#define SOUND_GAIN_SHIFT 8 // SOUND_GAIN_UNITY is 1 << SOUND_GAIN_SHIFT.
+#define SOUND_MIX_MIN INT16_MIN
+#define SOUND_MIX_MAX INT16_MAX
+
+typedef struct {
+  const uint8_t *data; // ADPCM codes, or NULL for silence.
+  uint32_t sampleCount;
+  uint32_t index; // Next sample to mix.
+  adpcm_state_t decoder;
+  uint16_t gain;
+  uint8_t priority;
+  uint32_t startNumber; // Orders voices by start time, for stealing.
+  bool active;          // Set last when starting, cleared first when stopping.
+} sound_voice_state_t;
+
+// Written by the main loop, read and advanced by sound_tick() in the ISR.
+// There is no count of active voices, because the two sides would both have
+// to update it; the active flags are scanned instead.
+volatile static sound_voice_state_t voices[SOUND_VOICE_COUNT];
+static uint32_t sound_startCount = 0; // Voices started, for startNumber.
+
+// The sound chosen by sound_setSound() for sound_startSound().
+static sound_sounds_t sound_selectedSound = sound_oneSecondSilence_e;
+
+// Priority of each sound when started with sound_playSound() or
+// sound_startSound(): game events over gun noises over silence.
+static const uint8_t sound_defaultPriority[] = {
+    [sound_gameStart_e] = 2,    [sound_gunFire_e] = 1,
+    [sound_hit_e] = 2,          [sound_gunClick_e] = 1,
+    [sound_gunReload_e] = 1,    [sound_loseLife_e] = 3,
+    [sound_gameOver_e] = 3,     [sound_returnToBase_e] = 3,
+    [sound_oneSecondSilence_e] = 0};
 
 // Keep track of the current volume setting.
 volatile static sound_volume_t sound_currentVolume = sound_minimumVolume_e;
@@ -83,8 +111,8 @@ volatile static sound_volume_t sound_currentVolume = sound_minimumVolume_e;
 // Sound state-machine states.
 typedef enum {
   sound_init_st, // Waiting for sound_init() to be invoked.
-  sound_wait_st, // Waiting for enable to play sound.
-  sound_play_st  // In the process of playing the sound.
+  sound_wait_st, // Waiting for a voice to start.
+  sound_play_st  // Streaming the mixed voices to the FIFO by DMA.
 } sound_st_t;
 
 volatile static sound_st_t currentState = sound_init_st;
@@ -105,22 +133,14 @@ static void sound_disableTxFifo() {
   Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_CTRL_REG, 0b00); // Disable TX FIFO.
 }
 
-// sampleValue is sent to both the left and right channels.
-static void sound_sendDataToBothChannels(uint32_t sampleValue) {
-  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_TX_FIFO_REG,
-            sampleValue); // add to left Channel.
-  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_TX_FIFO_REG,
-            sampleValue); // add to right Channel.
-}
-
 // Must be called before using the sound state machine.
 sound_status_t sound_init() {
   // Setup the audio CODEC.
   AudioInitialize(SCU_TIMER_ID, AUDIO_IIC_ID, AUDIO_CTRL_BASEADDR);
+  // The DMA writes the samples to the TX FIFO.
+  if (!soundDma_init(AUDIO_CTRL_BASEADDR + I2S_TX_FIFO_REG))
+    return SOUND_STATUS_FAIL;
   sound_initFlag = true;
-  // Initialize the silence array.
-  for (uint32_t i = 0; i < ONE_SECOND_OF_SOUND_ARRAY_SIZE; i++)
-    soundOfSilence[i] = NO_SOUND;
   sound_setVolume(sound_minimumVolume_e); // Init the volume level.
   return SOUND_STATUS_OK;
 }
@@ -154,10 +174,42 @@ static void debugStatePrint() {
   }
 }
 
+// Mixes the next sample of every active voice, saturates the sum to 16 bits
+// and scales it by the volume. Voices that reach their end are stopped.
+static uint32_t sound_mixSample() {
+  int32_t sum = 0;
+  for (uint8_t v = 0; v < SOUND_VOICE_COUNT; v++) {
+    volatile sound_voice_state_t *voice = &voices[v];
+    if (!voice->active)
+      continue;
+    int32_t sample = 0;
+    if (voice->data) {
+      adpcm_state_t decoder = voice->decoder;
+      sample = adpcm_decode(&decoder, adpcm_getCode(voice->data, voice->index));
+      voice->decoder = decoder;
+    }
+    sum += (sample * voice->gain) >> SOUND_GAIN_SHIFT;
+    if (++voice->index == voice->sampleCount)
+      voice->active = false;
+  }
+  sum = sum > SOUND_MIX_MAX ? SOUND_MIX_MAX : sum;
+  sum = sum < SOUND_MIX_MIN ? SOUND_MIX_MIN : sum;
+  return (uint32_t)(sum + SOUND_MIDSCALE) * sound_currentVolume;
+}
+
+// Mixes frameCount frames into buffer for the DMA, the same sample on the
+// left and right channels. Returns false if no voice was playing. Called from
+// the ISR a couple of frames at a time (see SOUNDDMA_FRAMES_PER_SERVICE).
+static bool sound_fillBuffer(uint32_t buffer[], uint32_t frameCount) {
+  bool sound = sound_isBusy();
+  for (uint32_t i = 0; i < frameCount; i++)
+    buffer[2 * i] = buffer[2 * i + 1] = sound_mixSample();
+  return sound;
+}
+
 // Standard tick function.
 void sound_tick() {
   //  debugStatePrint();
-  static uint32_t arrayIndex = 0;
   // Action switch statement.
   switch (currentState) {
   case sound_init_st:
@@ -178,116 +230,158 @@ void sound_tick() {
     }
     break;
   case sound_wait_st:
-    if (sound_playSoundFlag) {
-      arrayIndex = 0;
+    if (sound_isBusy()) {
       currentState = sound_play_st;
       sound_resetTxFifo();  // Reset the TX FIFO.
       sound_enableTxFifo(); // Enable the TX FIFO, disable mute.
+      soundDma_start(sound_fillBuffer);
     }
     break;
   case sound_play_st:
-    // Each time you enter this state, add as many samples as will fit in the
-    // FIFO.
-    if (sound_array == NULL) {
-      printf("ERROR, sound_tick: sound array has not been set.\n");
-      return;
-    }
-    // This while-loop continues to load sound-data into the FIFOs until it is
-    // full or the sound data are exhausted.
-    while (!(Xil_In32(AUDIO_CTRL_BASEADDR + I2S_FIFO_STS_REG) &
-             0b0010)) { // while room in FIFO.
-      uint32_t sampleValue =
-          sound_array[arrayIndex] * sound_currentVolume; // Scale by volume.
-      sound_sendDataToBothChannels(
-          sampleValue); // Send the sound data to the left and right channels.
-      arrayIndex++;     // Go to next sample.
-      if (arrayIndex == sound_sampleCount) { // All done?
-        sound_playSoundFlag = false;         // Yes.
-        sound_disableTxFifo();               // Disable the TX FIFO.
-        currentState = sound_wait_st;        // Go back to the wait state.
-      }
+    // The DMA feeds the FIFO; this mixes SOUNDDMA_FRAMES_PER_SERVICE frames
+    // per tick into the buffer the DMA finished last. The DMA stops once the
+    // voices have all finished and their last samples have been streamed out.
+    soundDma_service();
+    if (!soundDma_isRunning()) {
+      sound_disableTxFifo();        // Disable the TX FIFO.
+      currentState = sound_wait_st; // Go back to the wait state.
     }
     break;
   }
 }
 
-// Sets the sound and starts playing it immediately.
+// Starts playing the sound immediately, mixed with anything already playing.
 void sound_playSound(sound_sounds_t sound) {
   sound_setSound(sound); // Set the sound to be played.
   sound_startSound();    // Start playing the sound.
 }
 
-// Returns true if the sound is still playing.
-bool sound_isBusy() {
-  return (sound_playSoundFlag); // Busy if NOT in the wait state.
-}
+// Returns true if any sound is still playing.
+bool sound_isBusy() { return sound_getActiveVoiceCount() > 0; }
 
-// Returns true if the sound has finished playing.
+// Returns true if every sound has finished playing.
 bool sound_isSoundComplete() { return (!sound_isBusy()); }
 
-// Use this to set the base address for the array containing sound data.
-// Allow sounds to be interrupted.
-void sound_setSound(sound_sounds_t sound) {
-  if (sound_isBusy()) { // You are currently playing some sound.
-    sound_stopSound(); // Stop the sound and reset the state-machine, FIFO, etc.
-  }
-  sound_array =
-      NULL; // Set the pointer to NULL so you can detect it never being set.
+// Looks up the array holding the ADPCM data for a sound and its number of
+// samples. Silence has no data. Returns false for a bogus sound.
+static bool sound_getSamples(sound_sounds_t sound, const uint8_t **data,
+                             uint32_t *sampleCount) {
   switch (sound) {
   case sound_gameStart_e:
-    sound_array = gameBoyStartup_wav; // Set the array holding the data.
-    sound_sampleCount =
-        GAMEBOYSTARTUP_WAV_NUMBER_OF_SAMPLES; // Size of the array.
+    *data = gameBoyStartup_wav_adpcm; // Set the array holding the data.
+    *sampleCount = GAMEBOYSTARTUP_WAV_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_gunFire_e:
-    sound_array = bcfire01_48k_wav; // Set the array holding the data.
-    sound_sampleCount =
-        BCFIRE01_48K_WAV_NUMBER_OF_SAMPLES; // Size of the array.
+    *data = bcfire01_48k_wav_adpcm; // Set the array holding the data.
+    *sampleCount = BCFIRE01_48K_WAV_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_hit_e:
-    sound_array = ouch48k_wav; // You get the idea...
-    sound_sampleCount = OUCH48K_WAV_NUMBER_OF_SAMPLES;
+    *data = ouch48k_wav_adpcm; // You get the idea...
+    *sampleCount = OUCH48K_WAV_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_gunClick_e:
-    sound_array = gunEmpty48k_wav;
-    sound_sampleCount = GUNEMPTY48K_WAV_NUMBER_OF_SAMPLES;
+    *data = gunEmpty48k_wav_adpcm;
+    *sampleCount = GUNEMPTY48K_WAV_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_gunReload_e:
-    sound_array = powerUp48k_wav;
-    sound_sampleCount = POWERUP48K_WAV_NUMBER_OF_SAMPLES;
+    *data = powerUp48k_wav_adpcm;
+    *sampleCount = POWERUP48K_WAV_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_loseLife_e:
-    sound_array = screamAndDie48k_wav;
-    sound_sampleCount = SCREAMANDDIE48K_WAV_NUMBER_OF_SAMPLES;
+    *data = screamAndDie48k_wav_adpcm;
+    *sampleCount = SCREAMANDDIE48K_WAV_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_gameOver_e:
-    sound_array = pacmanDeath_wav;
-    sound_sampleCount = PACMANDEATH_WAV_NUMBER_OF_SAMPLES;
+    *data = pacmanDeath_wav_adpcm;
+    *sampleCount = PACMANDEATH_WAV_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_returnToBase_e:
-    sound_array = gameOver48k_wav;
-    sound_sampleCount = GAMEOVER48K_WAV_NUMBER_OF_SAMPLES;
+    *data = gameOver48k_wav_adpcm;
+    *sampleCount = GAMEOVER48K_WAV_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_oneSecondSilence_e:
-    sound_array = soundOfSilence;
-    sound_sampleCount = ONE_SECOND_OF_SOUND_ARRAY_SIZE;
+    *data = NULL;
+    *sampleCount = ONE_SECOND_OF_SOUND_ARRAY_SIZE;
     break;
   default:
-    printf("sound_setSound(): bogus sound value(%d)\n", sound);
+    printf("sound_getSamples(): bogus sound value(%d)\n", sound);
+    return false;
+  }
+  return true;
+}
+
+// Starts a sound on a free voice, or steals one. The voice is inactive while
+// it is set up, so sound_tick() never mixes a half-written voice.
+sound_voice_t sound_playVoice(sound_sounds_t sound, uint16_t gain,
+                              uint8_t priority) {
+  const uint8_t *data;
+  uint32_t sampleCount;
+  if (!sound_getSamples(sound, &data, &sampleCount) || sampleCount == 0)
+    return SOUND_NO_VOICE;
+  // A free voice, or else the lowest-priority voice, the oldest among equals.
+  sound_voice_t chosen = SOUND_NO_VOICE;
+  for (uint8_t v = 0; v < SOUND_VOICE_COUNT; v++) {
+    if (!voices[v].active) {
+      chosen = v;
+      break;
+    }
+    if (chosen == SOUND_NO_VOICE ||
+        voices[v].priority < voices[chosen].priority ||
+        (voices[v].priority == voices[chosen].priority &&
+         voices[v].startNumber < voices[chosen].startNumber))
+      chosen = v;
+  }
+  volatile sound_voice_state_t *voice = &voices[chosen];
+  if (voice->active) {
+    if (voice->priority > priority)
+      return SOUND_NO_VOICE; // Everything playing is more important.
+    sound_stopVoice(chosen);
   }
+  voice->data = data;
+  voice->sampleCount = sampleCount;
+  voice->index = 0;
+  adpcm_state_t decoder;
+  adpcm_init(&decoder);
+  voice->decoder = decoder;
+  voice->gain = gain;
+  voice->priority = priority;
+  voice->startNumber = sound_startCount++;
+  voice->active = true;
+  return chosen;
+}
+
+// Stops one voice.
+void sound_stopVoice(sound_voice_t voice) {
+  if (voice >= 0 && voice < SOUND_VOICE_COUNT)
+    voices[voice].active = false;
+}
+
+// Returns the number of voices playing.
+uint8_t sound_getActiveVoiceCount() {
+  uint8_t count = 0;
+  for (uint8_t v = 0; v < SOUND_VOICE_COUNT; v++)
+    count += voices[v].active;
+  return count;
 }
 
+// Use this to choose the sound that sound_startSound() plays. Sounds that are
+// already playing keep playing.
+void sound_setSound(sound_sounds_t sound) { sound_selectedSound = sound; }
+
 // Used to set the volume. Use one of the provided values.
 void sound_setVolume(sound_volume_t volume) { sound_currentVolume = volume; }
 
-// Tell the state machine to start playing the sound.
-void sound_startSound() { sound_playSoundFlag = true; }
+// Starts the sound chosen by sound_setSound() on top of anything playing.
+void sound_startSound() {
+  sound_playVoice(sound_selectedSound, SOUND_GAIN_UNITY,
+                  sound_defaultPriority[sound_selectedSound]);
+}
 
-// Stops playing the sound and resets the state-machine to the wait state.
+// Stops every voice. sound_tick() goes back to the wait state once the DMA
+// has streamed out the silence that follows.
 void sound_stopSound() {
-  sound_playSoundFlag = false; // disable the state-machine.
-  currentState =
-      sound_wait_st; // Force the state-machine back to the wait state.
+  for (uint8_t v = 0; v < SOUND_VOICE_COUNT; v++)
+    sound_stopVoice(v);
 }
 
 // Plays several sounds.
@@ -338,6 +432,14 @@ void sound_runTest() {
     if (!sound_isBusy())
       break;
   }
+  printf("playing gunFire_e and hit_e together\n");
+  sound_playVoice(sound_gunFire_e, SOUND_GAIN_UNITY, 1);
+  sound_playVoice(sound_hit_e, SOUND_GAIN_UNITY / 2, 2);
+  while (1) {
+    sound_tick();
+    if (!sound_isBusy())
+      break;
+  }
   printf("done.\n");
 }
 
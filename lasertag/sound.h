@@ -45,32 +45,61 @@ typedef enum {
   sound_maximumVolume_e = SOUND_VOLUME_3     // Really loud.
 } sound_volume_t;
 
+// Voices the mixer can play at once.
+#define SOUND_VOICE_COUNT 4
+
+// Per-voice gain that plays a sound at its recorded level. Gains are fixed
+// point with 8 fractional bits, so 128 is half as loud and 512 twice.
+#define SOUND_GAIN_UNITY 256
+
+// Identifies a voice started by sound_playVoice().
+typedef int8_t sound_voice_t;
+#define SOUND_NO_VOICE (-1)
+
 // Must be called before using the sound state machine.
 sound_status_t sound_init();
 
 // Standard tick function.
 void sound_tick();
 
-// Sets the sound and starts playing it immediately.
+// Starts playing the sound immediately, mixed with anything already playing,
+// at its default priority.
 void sound_playSound(sound_sounds_t sound);
 
-// Returns true if the sound is still playing.
+// Starts sound on a voice of its own, mixed with the other voices at the given
+// gain (SOUND_GAIN_UNITY for the recorded level). If every voice is busy, the
+// one with the lowest priority is stolen, the oldest if several tie, but only
+// if its priority is no higher than priority. Returns the voice, or
+// SOUND_NO_VOICE if the sound was not started. Call from the main loop, not
+// from an ISR.
+sound_voice_t sound_playVoice(sound_sounds_t sound, uint16_t gain,
+                              uint8_t priority);
+
+// Stops a voice started by sound_playVoice(). Does nothing if it has already
+// finished.
+void sound_stopVoice(sound_voice_t voice);
+
+// Returns the number of voices playing.
+uint8_t sound_getActiveVoiceCount();
+
+// Returns true if any sound is still playing.
 bool sound_isBusy();
 
-// Returns true if the sound has finished playing.
+// Returns true if every sound has finished playing.
 bool sound_isSoundComplete();
 
-// Use this to set the base address for the array containing sound data.
-// Allow sounds to be interrupted.
+// Chooses the sound that sound_startSound() plays. Sounds already playing
+// keep playing.
 void sound_setSound(sound_sounds_t sound);
 
 // Used to set the volume. Use one of the provided values.
 void sound_setVolume(sound_volume_t);
 
-// Tell the state machine to start playing the sound.
+// Starts the sound chosen by sound_setSound() on a voice, at its default
+// priority.
 void sound_startSound();
 
-// Stops playing the sound and resets the state-machine to the wait state.
+// Stops every voice. The state machine returns to the wait state.
 void sound_stopSound();
 
 // Plays several sounds.
@@ -0,0 +1,262 @@
+#include <stdio.h>
+
+#include "soundDma.h"
+#include "xdmaps.h"
+#include "xil_cache.h"
+#include "xparameters.h"
+
+// The XDmaPs driver only runs memory-to-memory programs that it generates,
+// and expects one done interrupt per program. Streaming to the FIFO needs a
+// program that waits for the FIFO's DMA requests and loops over both buffers
+// forever, so the program is built here and started through the debug
+// registers, as the driver does internally.
+//
+// The done interrupt is not routed through the GIC: armInterrupts owns it
+// and is set up after sound_init(). Instead soundDma_service(), called from
+// sound_tick() in the timer ISR, checks the interrupt status bit. It refills
+// the finished buffer SOUNDDMA_FRAMES_PER_SERVICE frames per call, so no
+// single tick pays for mixing a whole buffer.
+
+#define DMA_DEVICE_ID XPAR_XDMAPS_1_DEVICE_ID // Secure register interface.
+#define DMA_CHANNEL 0
+#define DMA_EVENT 0      // Its interrupt is XPS_DMA0_INT_ID.
+#define DMA_PERIPHERAL 0 // The I2S DMA_TX_REQ is wired to the PS7 DMA0_REQ.
+
+#define WORDS_PER_FRAME 2
+#define WORDS_PER_BUFFER (SOUNDDMA_FRAMES_PER_BUFFER * WORDS_PER_FRAME)
+#define BYTES_PER_BUFFER (WORDS_PER_BUFFER * sizeof(uint32_t))
+// A loop counter holds at most 256 iterations, so each buffer is two nested
+// loops.
+#define INNER_LOOP_WORDS 256
+#define OUTER_LOOP_COUNT (WORDS_PER_BUFFER / INNER_LOOP_WORDS)
+
+// PL330 instruction encodings (see the PL330 TRM, chapter 4).
+#define DMAEND 0x00
+#define DMALD 0x04
+#define DMALP_LC0 0x20
+#define DMALP_LC1 0x22
+#define DMALPFE 0x28
+#define DMALPEND_LC0 0x38
+#define DMALPEND_LC1 0x3C
+#define DMASTP_SINGLE 0x29
+#define DMAWFP_SINGLE 0x30
+#define DMASEV 0x34
+#define DMAFLUSHP 0x35
+#define DMAMOV 0xBC
+#define DMAGO 0xA0
+#define DMAKILL 0x01
+#define DMAMOV_SAR 0
+#define DMAMOV_CCR 1
+#define DMAMOV_DAR 2
+#define DEBUG_THREAD_MANAGER 0
+#define DEBUG_THREAD_CHANNEL 1
+// Channel control: 4-byte single transfers from an incrementing source to a
+// fixed destination.
+#define CCR_SOURCE_INCREMENT 0x1
+#define CCR_SOURCE_4_BYTES (2 << 1)
+#define CCR_DESTINATION_4_BYTES (2 << 15)
+#define CCR_VALUE                                                              \
+  (CCR_SOURCE_INCREMENT | CCR_SOURCE_4_BYTES | CCR_DESTINATION_4_BYTES)
+
+#define PROGRAM_MAX_BYTES 64
+#define CACHE_LINE_BYTES 32
+
+static uint32_t buffers[SOUNDDMA_BUFFER_COUNT][WORDS_PER_BUFFER]
+    __attribute__((aligned(CACHE_LINE_BYTES)));
+static uint8_t program[PROGRAM_MAX_BYTES]
+    __attribute__((aligned(CACHE_LINE_BYTES)));
+static uint32_t programLength;
+
+static uint32_t dmaBase;
+static soundDma_fill_t fillFunction;
+volatile static bool running;
+static bool dmaStarted;       // The channel program is running.
+static uint8_t nextBuffer;    // The next one the DMA finishes.
+static uint8_t silentBuffers; // Filled with silence in a row.
+static uint32_t underrunCount;
+
+// The buffer being filled, a few frames per soundDma_service(), or NO_BUFFER.
+#define NO_BUFFER SOUNDDMA_BUFFER_COUNT
+static uint8_t fillingBuffer;
+static uint32_t fillFrame;    // Frames of it filled so far.
+static bool fillSound;        // Any of them was not silence.
+static uint8_t primedBuffers; // Filled since soundDma_start(), up to all.
+
+static void emit(uint8_t byte) { program[programLength++] = byte; }
+
+static void emit2(uint8_t byte0, uint8_t byte1) {
+  emit(byte0);
+  emit(byte1);
+}
+
+static void emitMov(uint8_t reg, uint32_t value) {
+  emit2(DMAMOV, reg);
+  for (uint8_t i = 0; i < sizeof(value); i++)
+    emit(value >> (8 * i));
+}
+
+// Builds the channel program: for each buffer, wait for a FIFO request and
+// move one word, until the buffer is done, then raise DMA_EVENT; then start
+// over at the first buffer. A backward jump is the distance from the first
+// instruction of the loop to its DMALPEND.
+static void buildProgram(uint32_t fifoAddress) {
+  programLength = 0;
+  emitMov(DMAMOV_CCR, CCR_VALUE);
+  emitMov(DMAMOV_DAR, fifoAddress);
+  emit2(DMAFLUSHP, DMA_PERIPHERAL << 3);
+  uint32_t forever = programLength;
+  emitMov(DMAMOV_SAR, (UINTPTR)buffers);
+  for (uint8_t b = 0; b < SOUNDDMA_BUFFER_COUNT; b++) {
+    emit2(DMALP_LC0, OUTER_LOOP_COUNT - 1);
+    uint32_t outer = programLength;
+    emit2(DMALP_LC1, INNER_LOOP_WORDS - 1);
+    uint32_t inner = programLength;
+    emit2(DMAWFP_SINGLE, DMA_PERIPHERAL << 3);
+    emit(DMALD);
+    emit2(DMASTP_SINGLE, DMA_PERIPHERAL << 3);
+    emit2(DMALPEND_LC1, programLength - inner);
+    emit2(DMALPEND_LC0, programLength - outer);
+    emit2(DMASEV, DMA_EVENT << 3);
+  }
+  emit2(DMALPFE, programLength - forever);
+  emit(DMAEND);
+}
+
+// Runs one instruction on a DMA thread through the debug registers.
+static void debugExecute(uint8_t byte0, uint8_t byte1, uint8_t thread,
+                         uint32_t operand) {
+  while (XDmaPs_ReadReg(dmaBase, XDMAPS_DBGSTATUS_OFFSET) &
+         XDMAPS_DBGSTATUS_BUSY)
+    ;
+  XDmaPs_WriteReg(dmaBase, XDMAPS_DBGINST0_OFFSET,
+                  XDmaPs_DBGINST0(byte1, byte0, DMA_CHANNEL, thread));
+  XDmaPs_WriteReg(dmaBase, XDMAPS_DBGINST1_OFFSET, operand);
+  XDmaPs_WriteReg(dmaBase, XDMAPS_DBGCMD_OFFSET, 0);
+}
+
+// Returns the buffer the DMA is reading. After the last buffer the source
+// address is one past the end until the program starts over.
+static uint8_t bufferBeingRead() {
+  uint32_t source =
+      XDmaPs_ReadReg(dmaBase, XDmaPs_SA_n_OFFSET(DMA_CHANNEL)) -
+      (UINTPTR)buffers;
+  return (source / BYTES_PER_BUFFER) % SOUNDDMA_BUFFER_COUNT;
+}
+
+// Starts the channel program at the first buffer.
+static void startDma() {
+  XDmaPs_WriteReg(dmaBase, XDMAPS_INTCLR_OFFSET, 1 << DMA_EVENT);
+  debugExecute(DMAGO, DMA_CHANNEL, DEBUG_THREAD_MANAGER, (UINTPTR)program);
+  dmaStarted = true;
+}
+
+static void startFill(uint8_t b) {
+  fillingBuffer = b;
+  fillFrame = 0;
+  fillSound = false;
+}
+
+// Fills up to frameCount more frames of fillingBuffer. Once it is full,
+// writes it out of the data cache for the DMA, starts the DMA or the next
+// buffer if still priming, and stops streaming after enough silence.
+static void continueFill(uint32_t frameCount) {
+  uint8_t b = fillingBuffer;
+  uint32_t remaining = SOUNDDMA_FRAMES_PER_BUFFER - fillFrame;
+  frameCount = frameCount < remaining ? frameCount : remaining;
+  fillSound |=
+      fillFunction(&buffers[b][fillFrame * WORDS_PER_FRAME], frameCount);
+  fillFrame += frameCount;
+  if (fillFrame < SOUNDDMA_FRAMES_PER_BUFFER)
+    return;
+  Xil_DCacheFlushRange((INTPTR)buffers[b], BYTES_PER_BUFFER);
+  silentBuffers = fillSound ? 0 : silentBuffers + 1;
+  fillingBuffer = NO_BUFFER;
+  // Too late if the DMA has already come back around to it.
+  if (dmaStarted && bufferBeingRead() == b)
+    underrunCount++;
+  if (primedBuffers < SOUNDDMA_BUFFER_COUNT) {
+    // The first buffer is enough to start on: the DMA takes a whole buffer
+    // time to play it, and the rest are filled long before then.
+    if (!dmaStarted)
+      startDma();
+    if (++primedBuffers < SOUNDDMA_BUFFER_COUNT)
+      startFill(primedBuffers);
+  }
+  if (silentBuffers >= SOUNDDMA_BUFFER_COUNT)
+    soundDma_stop();
+}
+
+// Starts refilling nextBuffer once the DMA has finished it, and fills a few
+// more frames of the buffer being refilled.
+void soundDma_service() {
+  if (!running)
+    return;
+  if (dmaStarted &&
+      XDmaPs_ReadReg(dmaBase, XDMAPS_INTSTATUS_OFFSET) & (1 << DMA_EVENT)) {
+    XDmaPs_WriteReg(dmaBase, XDMAPS_INTCLR_OFFSET, 1 << DMA_EVENT);
+    // A refill still going when the next buffer finishes is finished at once;
+    // it is an underrun.
+    if (fillingBuffer != NO_BUFFER) {
+      continueFill(SOUNDDMA_FRAMES_PER_BUFFER);
+      if (!running)
+        return;
+    }
+    startFill(nextBuffer);
+    nextBuffer = (nextBuffer + 1) % SOUNDDMA_BUFFER_COUNT;
+  }
+  if (fillingBuffer != NO_BUFFER)
+    continueFill(SOUNDDMA_FRAMES_PER_SERVICE);
+}
+
+// Builds the channel program and enables its done interrupt.
+bool soundDma_init(uint32_t fifoAddress) {
+  XDmaPs_Config *dmaConfig = XDmaPs_LookupConfig(DMA_DEVICE_ID);
+  if (dmaConfig == NULL) {
+    printf("soundDma_init: no DMA controller %d.\n", DMA_DEVICE_ID);
+    return false;
+  }
+  dmaBase = dmaConfig->BaseAddress;
+  buildProgram(fifoAddress);
+  Xil_DCacheFlushRange((INTPTR)program, programLength);
+  // With its interrupt enabled, DMASEV sets the status bit instead of
+  // signalling an event to other channels.
+  XDmaPs_WriteReg(dmaBase, XDMAPS_INTEN_OFFSET,
+                  XDmaPs_ReadReg(dmaBase, XDMAPS_INTEN_OFFSET) |
+                      (1 << DMA_EVENT));
+  running = false;
+  underrunCount = 0;
+  return true;
+}
+
+// Starts filling the first buffer; soundDma_service() starts the channel
+// program once it is full.
+void soundDma_start(soundDma_fill_t fill) {
+  if (running)
+    return;
+  fillFunction = fill;
+  silentBuffers = 0;
+  nextBuffer = 0;
+  primedBuffers = 0;
+  dmaStarted = false;
+  startFill(0);
+  running = true;
+}
+
+// Kills the channel program.
+void soundDma_stop() {
+  if (!running)
+    return;
+  running = false;
+  fillingBuffer = NO_BUFFER;
+  if (!dmaStarted)
+    return;
+  dmaStarted = false;
+  debugExecute(DMAKILL, 0, DEBUG_THREAD_CHANNEL, 0);
+  XDmaPs_WriteReg(dmaBase, XDMAPS_INTCLR_OFFSET, 1 << DMA_EVENT);
+}
+
+// Returns true while streaming.
+bool soundDma_isRunning() { return running; }
+
+// Returns the number of buffers refilled too late.
+uint32_t soundDma_getUnderrunCount() { return underrunCount; }
@@ -0,0 +1,70 @@
+#ifndef SOUNDDMA_H_
+#define SOUNDDMA_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Streams audio to the I2S TX FIFO with the PL330 DMA controller, so that
+// playback takes no CPU time between buffers. Two buffers are played in turn:
+// while the DMA empties one into the FIFO, paced by the FIFO's DMA requests,
+// the other waits. When the DMA finishes a buffer it raises its done
+// interrupt flag, and soundDma_service() asks the fill function to refill
+// that buffer, a few frames per call.
+//
+// The host build links a stand-in (host/soundDmaSim.c) that works out from
+// the clock which buffers the FIFO would have drained.
+
+// Frames (a left and a right sample) in each of the two buffers. At 48 kHz a
+// buffer lasts about 5.3 ms, which is how late the interrupt can be serviced.
+#define SOUNDDMA_FRAMES_PER_BUFFER 256
+#define SOUNDDMA_BUFFER_COUNT 2
+#define SOUNDDMA_SAMPLE_RATE_HZ 48000
+// Frames filled per soundDma_service() call. Called from the 100 kHz ISR, a
+// refill takes 128 ticks (1.3 ms) of the 5.3 ms the DMA spends on the other
+// buffer, and each tick mixes only two frames.
+#define SOUNDDMA_FRAMES_PER_SERVICE 2
+
+// Fills buffer with frameCount frames (at most SOUNDDMA_FRAMES_PER_SERVICE
+// except when catching up), left then right sample of each. Returns false if
+// everything written was silence. Called from soundDma_service(), usually in
+// an ISR, so it must not take long.
+typedef bool (*soundDma_fill_t)(uint32_t buffer[], uint32_t frameCount);
+
+// Sets up the DMA channel to write to the FIFO register at fifoAddress.
+// Returns false if the DMA controller cannot be set up.
+bool soundDma_init(uint32_t fifoAddress);
+
+// Starts streaming with fill: soundDma_service() fills the first buffer and
+// starts the DMA on it, then fills the others and refills each as it
+// finishes. The FIFO must be enabled, since it only requests data while it
+// is. Streaming stops by itself once SOUNDDMA_BUFFER_COUNT buffers in a row
+// have been filled with silence. Does nothing if already streaming.
+void soundDma_start(soundDma_fill_t fill);
+
+// Fills the next SOUNDDMA_FRAMES_PER_SERVICE frames of the buffer being
+// refilled, and starts refilling the buffer the DMA has finished, if it has.
+// Call it often enough to fill a buffer while the DMA plays the other one:
+// at least SOUNDDMA_FRAMES_PER_BUFFER / SOUNDDMA_FRAMES_PER_SERVICE times per
+// 5.3 ms. sound_tick() calls it every tick. Costs one register read when
+// there is nothing to do.
+void soundDma_service();
+
+// Stops streaming at once.
+void soundDma_stop();
+
+// Returns true while streaming.
+bool soundDma_isRunning();
+
+// Returns the number of buffers that were refilled too late, so that the
+// DMA played some of the old samples again.
+uint32_t soundDma_getUnderrunCount();
+
+// Streams a ramp followed by silence, calling soundDma_service() in a loop,
+// and checks that streaming stopped by itself after the expected number of
+// buffers, and that it took as long as they take to play at 48 kHz,
+// measured on clockTimerNumber. Expects
+// soundDma_init() to have been called and the FIFO to be enabled. Returns
+// true if all of that holds.
+bool soundDma_runTest(uint32_t clockTimerNumber);
+
+#endif /* SOUNDDMA_H_ */
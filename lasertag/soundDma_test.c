@@ -0,0 +1,71 @@
+#include <stdio.h>
+
+#include "intervalTimer.h"
+#include "soundDma.h"
+
+// Not a whole number of buffers, so the last one is part ramp, part silence.
+#define TEST_RAMP_FRAMES (SOUNDDMA_FRAMES_PER_BUFFER * 20 + 100)
+#define TEST_FILLS                                                             \
+  ((TEST_RAMP_FRAMES + SOUNDDMA_FRAMES_PER_BUFFER - 1) /                       \
+       SOUNDDMA_FRAMES_PER_BUFFER +                                            \
+   SOUNDDMA_BUFFER_COUNT)
+// Both buffers are filled at the start; every later fill is the DMA finishing
+// a buffer.
+#define TEST_EXPECTED_SECONDS                                                  \
+  ((double)(TEST_FILLS - SOUNDDMA_BUFFER_COUNT) *                              \
+   SOUNDDMA_FRAMES_PER_BUFFER / SOUNDDMA_SAMPLE_RATE_HZ)
+#define TEST_MIN_SECONDS (0.9 * TEST_EXPECTED_SECONDS)
+#define TEST_MAX_SECONDS (2.0 * TEST_EXPECTED_SECONDS)
+#define TEST_TIMEOUT_SECONDS (10 * TEST_EXPECTED_SECONDS)
+
+static uint32_t testFrames; // Frames filled so far.
+
+// Fills the ramp 1, 2, 3... and then zeros.
+static bool soundDma_testFill(uint32_t buffer[], uint32_t frameCount) {
+  bool sound = false;
+  for (uint32_t i = 0; i < frameCount; i++, testFrames++) {
+    uint32_t value = testFrames < TEST_RAMP_FRAMES ? testFrames + 1 : 0;
+    buffer[2 * i] = buffer[2 * i + 1] = value;
+    sound |= value != 0;
+  }
+  return sound;
+}
+
+// Streams the ramp, servicing the DMA until streaming stops by itself.
+bool soundDma_runTest(uint32_t clockTimerNumber) {
+  printf("starting soundDma_runTest()\n");
+  testFrames = 0;
+  uint32_t underruns = soundDma_getUnderrunCount();
+  intervalTimer_initCountUp(clockTimerNumber);
+  intervalTimer_start(clockTimerNumber);
+  soundDma_start(soundDma_testFill);
+  double seconds;
+  do {
+    soundDma_service();
+    seconds = intervalTimer_getTotalDurationInSeconds(clockTimerNumber);
+  } while (soundDma_isRunning() && seconds < TEST_TIMEOUT_SECONDS);
+  intervalTimer_stop(clockTimerNumber);
+  bool success = true;
+  if (soundDma_isRunning()) {
+    printf("soundDma_runTest: still streaming after %.3f s.\n", seconds);
+    soundDma_stop();
+    success = false;
+  }
+  uint32_t expectedFrames = TEST_FILLS * SOUNDDMA_FRAMES_PER_BUFFER;
+  if (testFrames != expectedFrames) {
+    printf("soundDma_runTest: filled %lu frames, expected %lu.\n",
+           (unsigned long)testFrames, (unsigned long)expectedFrames);
+    success = false;
+  }
+  if (seconds < TEST_MIN_SECONDS || seconds > TEST_MAX_SECONDS) {
+    printf("soundDma_runTest: took %.3f s, expected %.3f s.\n", seconds,
+           TEST_EXPECTED_SECONDS);
+    success = false;
+  }
+  underruns = soundDma_getUnderrunCount() - underruns;
+  printf("%lu frames in %.3f s (%.3f s expected), %lu underruns.\n",
+         (unsigned long)testFrames, seconds, TEST_EXPECTED_SECONDS,
+         (unsigned long)underruns);
+  printf("soundDma_runTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
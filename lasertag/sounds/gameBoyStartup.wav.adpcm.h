@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a gameBoyStartup.wav
+extern const uint8_t gameBoyStartup_wav_adpcm[];
+#define GAMEBOYSTARTUP_WAV_ADPCM_SAMPLE_RATE 480000
+#define GAMEBOYSTARTUP_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define GAMEBOYSTARTUP_WAV_ADPCM_NUMBER_OF_SAMPLES 105488
@@ -0,0 +1,4900 @@
+// This file was generated by executing this statement: wav2c -a gameOver48k.wav
+
+#include <stdint.h>
+
+const uint8_t gameOver48k_wav_adpcm[78298] = {
+0xbf,0xa7,0x7b,0x97,0x09,0x28,0xd3,0x49,0xb9,0x01,0x89,0x53,0xc9,0x90,0x2a,0x11,
+0xca,0x22,0xc3,0x6b,0x83,0x8a,0xa9,0xaa,0x7a,0x90,0x22,0x8c,0x85,0x1d,0xa0,0x11,
+0x89,0x18,0x07,0x88,0x5a,0xd0,0x00,0xa9,0x1b,0x93,0xc1,0x08,0x0b,0x8a,0x27,0xb2,
+0x0f,0x18,0x02,0xd0,0x30,0x8c,0x83,0x08,0xa0,0x01,0x02,0xeb,0x68,0x82,0xa9,0x28,
+0x08,0x9a,0x22,0x72,0x94,0x8a,0x01,0x48,0xc9,0x30,0x20,0xb1,0x36,0xa9,0xaf,0x99,
+0x11,0x24,0xbb,0x05,0x2c,0xc2,0x02,0x48,0xc1,0x2b,0xa9,0x15,0xa8,0xb8,0x61,0xab,
+0x84,0xa8,0x51,0x88,0xd1,0x09,0x1b,0xa5,0x30,0x41,0xb8,0x90,0x89,0xe8,0x89,0x28,
+0x70,0xc1,0x19,0x18,0x90,0x8f,0x20,0xa0,0x12,0x02,0x58,0x8b,0xb2,0x8b,0x0a,0xa7,
+0x2a,0xa0,0x63,0xb8,0x49,0xc2,0x8d,0x12,0x80,0x51,0xaa,0xa2,0x41,0x39,0xa9,0xd8,
+0x33,0x8e,0x88,0xc1,0x6b,0x03,0x08,0x89,0xc1,0x22,0x78,0xba,0xb0,0x05,0x3a,0x89,
+0xb8,0x12,0x8b,0x73,0xb1,0x58,0xa0,0x03,0x8d,0x00,0x82,0xd8,0x0a,0x12,0x9a,0xba,
+0xe0,0x38,0x85,0x09,0x9a,0x04,0xb1,0x0f,0xb9,0x19,0x52,0x9a,0x07,0x1a,0xb8,0x01,
+0x09,0x02,0xda,0x21,0x39,0xbd,0x07,0x99,0x28,0x31,0xb0,0x50,0xa0,0x78,0x90,0x09,
+0xb0,0x89,0x58,0xb2,0x8a,0x29,0x1a,0x87,0x9c,0x40,0xe9,0x31,0xc0,0x30,0xaa,0x21,
+0xc0,0x29,0xc9,0x62,0x10,0xd0,0x51,0x90,0x88,0x23,0x0a,0xb0,0xd0,0x60,0x8b,0xa2,
+0x80,0x89,0x69,0xc2,0x98,0x51,0x98,0x09,0x22,0x97,0x19,0x09,0xc9,0x06,0x98,0x2c,
+0x88,0x81,0xb0,0x14,0x19,0x2b,0xb7,0x13,0xab,0x80,0x2b,0xcc,0x06,0x1b,0x98,0x05,
+0x80,0x8a,0x0a,0x4a,0xa3,0x90,0xae,0x48,0xbc,0x34,0x88,0x28,0xfa,0x20,0x08,0x00,
+0x97,0x4b,0x98,0xa1,0x19,0x19,0x80,0x13,0x42,0x0f,0xd0,0x38,0x92,0x01,0x89,0x0a,
+0xb4,0x01,0x9f,0x12,0x88,0xd0,0x52,0xaa,0x32,0x00,0x81,0x8a,0x27,0x3c,0xa1,0x98,
+0xa8,0x68,0x99,0xf9,0x30,0xa2,0x1b,0x00,0xb1,0x80,0x02,0x9f,0x09,0xd5,0x88,0x39,
+0x82,0x10,0x53,0xb3,0x9f,0x41,0x99,0xb3,0x2e,0x92,0x08,0x19,0x12,0x0a,0xb2,0x30,
+0x29,0xb2,0x73,0x0a,0x0a,0xa6,0x2c,0xeb,0x90,0x40,0x09,0x82,0x9b,0x23,0x99,0xfb,
+0x30,0xc1,0x08,0x00,0x9d,0x07,0x1a,0xa0,0x19,0xa8,0x58,0xd1,0x91,0x2d,0x93,0x38,
+0x94,0x8a,0x81,0x8c,0x21,0xac,0x07,0x2a,0x01,0x00,0x09,0x07,0x2b,0xd9,0x21,0x1a,
+0x00,0x91,0x41,0xfb,0x88,0x18,0x1b,0xa6,0x00,0x8d,0x11,0x90,0x01,0x9e,0x42,0x08,
+0xd8,0x01,0x19,0x92,0x24,0x99,0x9b,0x0f,0x95,0x0a,0x10,0x00,0x13,0xa9,0xb1,0x08,
+0x6a,0x11,0x8c,0x37,0x89,0x11,0x29,0x18,0xf2,0x00,0x7b,0xb0,0x02,0xaa,0x00,0x8f,
+0x30,0xb3,0x22,0x19,0xbc,0x32,0x08,0x84,0x98,0x9f,0x00,0x32,0xb4,0x8f,0x00,0x80,
+0x32,0x90,0xb0,0xaf,0xb2,0x81,0x2e,0x08,0xc0,0x8a,0x15,0x11,0x1d,0xb8,0x91,0x32,
+0x1c,0x23,0x1a,0x98,0xec,0x25,0x09,0x9c,0xa2,0x20,0x32,0xad,0x02,0x68,0x81,0xa1,
+0x19,0x29,0xf9,0x3d,0xb8,0x80,0x2a,0x96,0x2a,0x90,0x14,0x00,0x09,0x86,0xa8,0x8a,
+0xd0,0x04,0x3a,0x01,0x2b,0xf8,0x02,0x28,0x0d,0x86,0x89,0x89,0x01,0x90,0x68,0x98,
+0x96,0x88,0x3b,0xe1,0x10,0x88,0x9a,0x12,0x11,0x13,0xfb,0x19,0x80,0x39,0xf2,0x38,
+0x19,0x0a,0xf1,0x20,0x09,0x00,0x80,0xd1,0xab,0x23,0x29,0xb0,0x69,0xe2,0x51,0xc8,
+0x00,0x38,0x19,0xa6,0x10,0x3b,0xd9,0x21,0x9a,0x18,0xb8,0x4a,0x23,0xab,0xf9,0x01,
+0x9a,0x64,0xa0,0xaa,0x89,0x81,0x0d,0x89,0x12,0x72,0xa0,0x80,0x29,0xf9,0x62,0xb9,
+0x02,0x0a,0x44,0x0a,0x91,0x98,0x8d,0xa3,0x71,0xa8,0x99,0x80,0x98,0x71,0x00,0x08,
+0xc1,0x41,0x0e,0x92,0x90,0x49,0x89,0xb8,0x29,0x90,0x7a,0xb0,0x20,0x01,0x02,0x3f,
+0xc2,0x12,0xba,0x3b,0x01,0xc9,0x92,0x69,0xa1,0x40,0x9a,0xa5,0x6b,0x90,0xb1,0x8b,
+0x34,0x29,0x03,0x18,0x08,0x95,0x9a,0x24,0xa8,0xaf,0x93,0x48,0x88,0x93,0x8b,0xa0,
+0xa1,0xef,0x18,0xb2,0x3a,0xdb,0x28,0x92,0x37,0x8a,0x48,0xb0,0x2b,0xb3,0xd2,0x0f,
+0x90,0x81,0xa1,0x19,0x53,0x90,0x03,0x9d,0x91,0x53,0x1a,0x92,0xb9,0x37,0x9b,0x48,
+0xd1,0x19,0x93,0x8e,0x92,0x18,0x09,0x50,0xb0,0x92,0x10,0x2d,0x98,0xa6,0x2a,0x2b,
+0xa3,0xd3,0x09,0x30,0xdc,0x50,0xea,0x18,0x11,0x0a,0x91,0x90,0x79,0xb2,0x8d,0x08,
+0x12,0x83,0x29,0x14,0x9a,0x0c,0x03,0x3b,0xe2,0x19,0x84,0x8b,0x99,0x20,0xb6,0x1d,
+0x31,0x93,0x4b,0x87,0x18,0x9a,0x58,0xd8,0x00,0x88,0x0a,0x20,0xb1,0x31,0xd1,0x9a,
+0x39,0x99,0x22,0x02,0x87,0x2e,0xc8,0x41,0xc1,0x58,0xa0,0x99,0x05,0x89,0x0b,0x81,
+0x03,0x59,0xb8,0x0f,0x82,0x0a,0x99,0x01,0x11,0x3b,0xb6,0x09,0x43,0xfa,0x39,0xb3,
+0xb8,0x7a,0x88,0x93,0x1c,0xb8,0x42,0xbc,0x22,0x09,0xb0,0xc0,0x09,0x84,0x2b,0x20,
+0xca,0xb7,0x59,0x89,0xb2,0xd1,0x19,0x42,0xa9,0x06,0x08,0x89,0x49,0x92,0x21,0xb1,
+0x10,0xb8,0x0b,0x72,0xd3,0x82,0x3d,0x92,0x10,0x07,0x2b,0xb9,0x83,0x58,0x89,0xd8,
+0x81,0x1a,0x2b,0xca,0x03,0x61,0x3a,0xc3,0x02,0x49,0x18,0xd0,0xaa,0x2b,0x17,0x0a,
+0x8b,0x21,0xa4,0x1c,0x1a,0x87,0x29,0x8b,0xc3,0x01,0x42,0x0e,0xc2,0x81,0x0a,0x68,
+0xc8,0x82,0x29,0xb1,0x10,0xb0,0x9c,0xca,0x15,0x8a,0x08,0x93,0x79,0xa0,0xa0,0x80,
+0x4a,0x04,0x00,0xa4,0x2a,0x23,0x1d,0xd2,0x18,0x52,0xaa,0xdc,0x21,0x08,0xa2,0x10,
+0x1c,0x21,0x97,0x28,0xd9,0x40,0x19,0xc1,0xb8,0x22,0x2d,0xa0,0x01,0x8f,0x83,0x91,
+0x4b,0xa1,0x90,0x84,0xab,0x12,0x59,0xb1,0x19,0x85,0x3b,0x80,0xe8,0x09,0x3a,0xfc,
+0x24,0x1b,0x81,0xb2,0x3a,0xe8,0x43,0x8a,0xa0,0xb2,0x28,0x2a,0xce,0xa2,0x9d,0x32,
+0x11,0xb9,0x13,0xa9,0xce,0x3a,0x92,0x12,0x11,0x3a,0xb7,0x0f,0x10,0x09,0x95,0x38,
+0x89,0x9b,0xa6,0x39,0x09,0x19,0x06,0x01,0x38,0xc0,0x70,0x89,0x83,0xb8,0x2a,0x8f,
+0xa3,0xa0,0xba,0x6b,0xa0,0x03,0x1b,0xe1,0x38,0x28,0x43,0x8a,0xca,0x35,0xaa,0x18,
+0x93,0x42,0x81,0x79,0xf1,0x01,0x99,0x88,0xa9,0x33,0xa2,0x61,0x8c,0xa1,0xa3,0x00,
+0x31,0x9f,0xc8,0x24,0x39,0x01,0x98,0x05,0x1d,0xa0,0xb1,0x51,0x39,0xa2,0xb2,0xca,
+0x00,0x90,0x78,0xa1,0x81,0xc8,0x3a,0xae,0xa3,0x39,0x32,0x16,0xad,0x81,0x10,0xaa,
+0x52,0xa1,0xb2,0x8e,0x9a,0xb1,0xaa,0x37,0x09,0x8d,0x95,0x00,0xba,0x38,0x90,0xa5,
+0x39,0xb1,0x3e,0xc4,0x81,0x5a,0x08,0x91,0x09,0xa0,0x8d,0x22,0x12,0xf0,0x21,0x81,
+0x8a,0xa0,0x71,0x12,0x8a,0xb3,0x2c,0xa8,0xa0,0x59,0x91,0x9b,0xc1,0x69,0x93,0x2c,
+0xa4,0x1c,0x12,0xe0,0x29,0x11,0xc0,0x91,0x5a,0xd1,0x59,0xa8,0x01,0x39,0x82,0x19,
+0x91,0x10,0x38,0x1c,0xf8,0x80,0x48,0x00,0x8e,0x03,0xb1,0x3b,0x18,0x80,0xa0,0xc6,
+0x0b,0x7b,0xd2,0x02,0x8b,0x99,0x10,0x49,0xf1,0x4b,0x01,0x0a,0xa9,0xf2,0x22,0x4b,
+0x80,0xc1,0xba,0x51,0x89,0xa1,0x20,0x12,0xa0,0xa3,0x3f,0x82,0x91,0xaa,0x12,0xb9,
+0xca,0x7c,0x82,0xc2,0xa8,0x59,0x58,0xc1,0xa0,0x51,0x00,0x00,0x89,0xc8,0x89,0x12,
+0xbb,0x48,0x09,0xc5,0x31,0x8f,0x20,0x01,0x00,0xa9,0x18,0x60,0xd2,0x28,0x9a,0xa1,
+0x60,0x90,0x0d,0xc3,0x2a,0x11,0xaa,0x06,0x0a,0x08,0xbb,0x09,0x23,0xba,0x5a,0x50,
+0xe2,0x80,0x6a,0xb9,0x98,0x42,0x98,0x88,0x92,0xb8,0x6c,0xa2,0x12,0x0f,0x82,0xb1,
+0x2a,0x19,0x94,0xa1,0x0a,0x9a,0x34,0x0e,0x07,0x28,0x09,0x02,0x99,0xaa,0x11,0x3c,
+0x15,0x03,0xb9,0x5c,0x00,0xf9,0x10,0x99,0x14,0x2a,0xa2,0x09,0x80,0xbb,0x11,0x08,
+0x74,0x99,0x22,0x10,0xfb,0x60,0x0c,0x82,0x91,0x82,0x3b,0x98,0xa7,0x9c,0x23,0x08,
+0x8a,0xb6,0x01,0x0c,0x01,0xc9,0x29,0x02,0xa3,0x9d,0x81,0x4b,0xda,0x93,0x58,0x9c,
+0xb2,0x20,0xcb,0x52,0x90,0x8b,0x42,0x82,0x8d,0x82,0xf0,0x39,0x00,0x81,0x44,0xa1,
+0x00,0xa9,0x8b,0x09,0x13,0x97,0xae,0x33,0x18,0xc0,0x09,0xd8,0x42,0x19,0xa2,0xe1,
+0x0b,0x03,0x4d,0x82,0x05,0x1a,0x91,0xc9,0x10,0x88,0x1e,0x04,0xa8,0x19,0x05,0xab,
+0x88,0x21,0x1d,0xa4,0x30,0x90,0x79,0xb0,0x80,0x2a,0x81,0xec,0x22,0x19,0xa8,0xc2,
+0x38,0x8b,0x81,0x14,0xc0,0x9a,0x48,0x13,0xf0,0x33,0x29,0xf9,0x18,0x1d,0x98,0xa2,
+0x19,0x2a,0x83,0x13,0xa0,0x49,0x45,0xb2,0x0c,0x92,0xdc,0x99,0x39,0x99,0x0f,0xd1,
+0x28,0x43,0xc0,0x09,0x49,0xe9,0x10,0x10,0x18,0x3a,0xa7,0x09,0x1a,0xb3,0x2c,0x28,
+0xab,0x87,0x2d,0x90,0xb0,0x22,0xb8,0x50,0xaa,0x87,0x49,0xb8,0x10,0x08,0x88,0xb0,
+0x69,0x90,0x85,0x1a,0x89,0x96,0x8c,0x11,0x28,0xe9,0x01,0x19,0x49,0xab,0x85,0x01,
+0x3c,0x90,0xa2,0x19,0xaa,0x83,0x22,0x16,0x8d,0x94,0x31,0xae,0x80,0x33,0x89,0x21,
+0x98,0x2b,0xf1,0x49,0x99,0x0c,0xb9,0x63,0x01,0xab,0x01,0x1a,0x91,0xa1,0x0a,0x79,
+0xf3,0x22,0x9a,0x10,0x0a,0x51,0xba,0x16,0xa1,0x0c,0x80,0xba,0x06,0x09,0x2b,0x13,
+0xe5,0x29,0xba,0x12,0x10,0x8b,0x34,0xd5,0x1b,0x33,0x9b,0x22,0xbb,0x65,0x08,0x9c,
+0x12,0xba,0x31,0xba,0x07,0x18,0x49,0xb0,0xa3,0x4c,0x8c,0xa2,0x88,0x58,0x05,0x99,
+0x90,0x41,0x88,0xc0,0x81,0x5a,0x09,0xd3,0x19,0xb0,0x7b,0xd3,0x28,0xa8,0x39,0xd8,
+0x10,0x39,0xc8,0x21,0xb8,0xaa,0xba,0x9b,0x27,0x0c,0x15,0x10,0x88,0xb8,0x71,0x00,
+0x91,0x19,0x02,0xc0,0x12,0x1e,0x18,0xa9,0xa6,0x9d,0x1a,0x81,0xa9,0xb3,0x13,0x58,
+0xda,0x01,0x99,0x49,0x34,0xf8,0x2a,0x84,0x88,0x89,0x02,0x1d,0xa9,0xc2,0x50,0x08,
+0x08,0x00,0x18,0xb0,0x47,0x00,0x8d,0x01,0xa8,0x80,0x30,0x49,0xc9,0x42,0xf9,0x38,
+0xc3,0x2b,0x15,0xca,0x18,0x1a,0x22,0xa9,0x52,0xc1,0x1a,0x8a,0xa0,0x83,0x29,0xf9,
+0x18,0x18,0x90,0xba,0x9d,0x36,0x9e,0x82,0x08,0x92,0x20,0x10,0x16,0xbc,0x04,0x2b,
+0xc3,0x29,0x11,0xb5,0x8b,0x28,0x11,0x97,0x11,0x81,0xcf,0x12,0xb1,0x58,0x80,0x9b,
+0xc3,0x51,0xa0,0x19,0x41,0xa0,0xa9,0x40,0x00,0xaa,0x11,0x93,0x4f,0xd3,0x80,0x2c,
+0xd1,0x39,0xa2,0x89,0x2a,0x14,0xc9,0x30,0xb9,0xa8,0x44,0x99,0x63,0xd9,0x21,0x99,
+0x09,0xb2,0x73,0x89,0x01,0xbb,0xb8,0x07,0x2b,0x09,0x20,0x10,0xfb,0x18,0x60,0x9d,
+0x82,0x81,0x31,0x0c,0x80,0x20,0x91,0xa9,0x78,0x02,0x00,0xbc,0x9a,0xb2,0x2d,0xba,
+0x23,0x18,0xf0,0x61,0x4b,0xb1,0xb3,0x1a,0x3a,0xb0,0xac,0x71,0x93,0xb8,0x84,0x4d,
+0x08,0xb8,0x02,0x99,0x39,0x90,0x48,0xa0,0x42,0xfb,0x21,0x4a,0xa2,0x9b,0xf3,0x49,
+0x99,0x38,0x87,0x18,0x09,0x18,0xb1,0xba,0x63,0x10,0x80,0x28,0x0f,0xb3,0x22,0x1e,
+0x00,0x12,0xb2,0x10,0x3b,0x20,0xa7,0x09,0x9b,0xa8,0xb3,0x6c,0x91,0x92,0x2d,0x08,
+0x85,0x08,0x82,0x0e,0xd2,0x1b,0xb2,0xa8,0x78,0xa1,0x9a,0xa3,0x79,0x00,0xc0,0x98,
+0x28,0x01,0x9d,0x91,0x31,0x9b,0xd8,0x49,0x9c,0x04,0x08,0x81,0xac,0x80,0x89,0x95,
+0x0c,0x8b,0x81,0xf8,0x30,0x19,0xab,0x07,0x29,0xc8,0x0c,0x83,0x4a,0xa4,0x28,0x12,
+0x42,0xe0,0xb8,0x51,0x19,0xb1,0x49,0x00,0xa9,0x04,0x34,0x1c,0x88,0xa5,0x28,0x20,
+0x9d,0x16,0x19,0x98,0x28,0xb1,0x18,0x0a,0x49,0xc2,0x81,0x08,0x6b,0x8c,0xf3,0x9b,
+0x02,0x2b,0xc0,0xa1,0x0c,0x42,0xf8,0x10,0x00,0x41,0xd1,0x39,0xb1,0x00,0x9c,0x1a,
+0x85,0x09,0xa9,0x29,0x31,0x87,0x8e,0xb1,0x28,0x19,0x24,0x88,0x13,0x3c,0xe1,0x91,
+0x48,0x1a,0xf2,0x88,0x39,0x81,0x98,0x92,0x6b,0xba,0x07,0xa9,0x31,0x9c,0x03,0x91,
+0x73,0x18,0xb8,0x99,0x39,0x96,0x8a,0x08,0xdb,0x91,0x1b,0x09,0x23,0xe2,0x59,0x82,
+0x81,0x99,0x8a,0x9a,0xb5,0x28,0xf8,0x41,0xac,0x12,0x81,0xa2,0x8c,0x4a,0x91,0x01,
+0x16,0xca,0x5a,0x81,0x91,0x22,0x8e,0x23,0x8b,0x81,0xd0,0x5b,0x82,0x8a,0x92,0x48,
+0x14,0x2d,0xe8,0x01,0x89,0x21,0x29,0xf8,0x19,0x10,0xa8,0x33,0x40,0xba,0x95,0xb9,
+0x69,0x09,0x84,0x8a,0x08,0x2a,0x37,0xaa,0x90,0x90,0x3e,0x91,0xa5,0x0a,0xa9,0x81,
+0x30,0x17,0xba,0x10,0xb1,0x3a,0x13,0x95,0xaa,0x56,0xaa,0xa9,0x92,0x39,0x2b,0xf9,
+0x10,0x20,0xb4,0x1b,0x1f,0x91,0x13,0x8c,0xa5,0x1c,0xa8,0x33,0xc0,0x3a,0xd1,0x9b,
+0x12,0x1a,0xc2,0x92,0x6c,0xa9,0xa1,0x51,0x80,0xcb,0x81,0x42,0xdc,0x01,0x18,0x14,
+0xa9,0x91,0x2a,0x82,0x9e,0x13,0x13,0x2f,0x82,0xa2,0x58,0xba,0x93,0x1a,0x61,0x92,
+0xb8,0xa2,0x2a,0xb8,0x78,0x04,0xc0,0x0d,0x04,0xaa,0x8c,0x96,0x09,0x11,0x10,0x80,
+0xd0,0x39,0x99,0x23,0x8a,0x06,0x8c,0xb1,0x6b,0xa2,0x03,0x1d,0xc1,0x80,0x08,0x9a,
+0x28,0x13,0x80,0x86,0x40,0xda,0x89,0x23,0xaa,0x44,0xa0,0xac,0x20,0x34,0xf9,0x38,
+0x00,0x3c,0x95,0x9a,0x21,0x88,0x91,0x61,0x80,0x9e,0x00,0xc0,0x30,0x08,0x31,0x82,
+0xaf,0x8a,0x23,0x1a,0xd8,0x83,0x09,0x79,0x10,0x01,0xe2,0x1c,0x88,0x09,0x91,0x82,
+0x5c,0x93,0xbb,0x99,0x3b,0x93,0x10,0x37,0x9f,0x12,0xac,0x82,0x0a,0x11,0x1c,0xb9,
+0x07,0x0a,0x13,0x4b,0xa2,0x84,0x12,0x5d,0xc1,0x19,0x80,0x80,0x0a,0x8c,0x34,0xd0,
+0x51,0xac,0x90,0x80,0x40,0xaa,0x60,0xb1,0x88,0x81,0x3d,0x94,0x1a,0xb2,0x19,0x1a,
+0x84,0x11,0x99,0x0e,0x07,0x1b,0x90,0x18,0xb4,0x29,0x00,0x98,0x96,0x2c,0x95,0x8a,
+0x18,0x18,0xf4,0x20,0x99,0x08,0x1a,0xc3,0x40,0xb9,0x70,0xaa,0x10,0x94,0x29,0x9b,
+0x07,0x1b,0x92,0x88,0x0a,0x49,0x00,0xd1,0x28,0x98,0x8b,0x10,0x99,0x67,0x9a,0x03,
+0x8d,0x19,0xb3,0x28,0x83,0x58,0xca,0x62,0x81,0x80,0x98,0x8d,0x93,0x29,0xa1,0x41,
+0xcc,0xa1,0x9b,0x78,0x83,0x90,0x18,0x0b,0xbc,0x80,0x25,0x71,0x8e,0x81,0x00,0x01,
+0x09,0x9b,0xd1,0x23,0x82,0x2e,0x92,0x98,0x8c,0x15,0x9a,0x38,0xc9,0x18,0x92,0x38,
+0x41,0x03,0x11,0xb6,0x13,0x0c,0x1b,0xf2,0x91,0x9a,0x18,0xae,0x88,0x49,0xe2,0x18,
+0x08,0x90,0xc9,0x20,0xad,0x19,0x92,0x12,0xe0,0x29,0x3a,0xc2,0xdb,0x04,0x2c,0x90,
+0x08,0xb4,0x70,0x80,0x09,0x13,0x99,0x39,0xf0,0x12,0x19,0x00,0xa2,0x8d,0xa1,0x51,
+0x89,0x09,0x11,0x57,0xea,0x20,0x18,0x01,0x81,0x28,0xd1,0x8c,0x31,0x89,0xa0,0xa3,
+0x4d,0x80,0x80,0xb8,0x26,0x9d,0x00,0x08,0x80,0x33,0x90,0x8f,0xf8,0x00,0x00,0x3a,
+0x94,0x10,0xa2,0x9a,0x8a,0x72,0x00,0x86,0x1b,0x95,0x8c,0x98,0x82,0x40,0xa9,0x00,
+0x12,0x3d,0xb5,0x29,0x03,0x20,0xac,0xe3,0x38,0xb9,0x39,0xd0,0xb1,0x68,0x18,0xba,
+0xd4,0x30,0x0d,0x91,0x31,0xc9,0x02,0x39,0x8c,0x87,0x0a,0x29,0xa0,0x09,0xa1,0x02,
+0x3c,0x9c,0x06,0x38,0xb0,0x2a,0x11,0x3b,0xcb,0x16,0xcb,0x23,0x88,0xa8,0xaf,0x94,
+0x2c,0x13,0x19,0x03,0x9e,0x14,0x12,0x9d,0x20,0xf9,0x18,0x10,0x89,0x98,0x10,0xb4,
+0x0d,0x82,0x31,0x22,0xe9,0x18,0x91,0x20,0x0e,0x82,0xa1,0x60,0x90,0x02,0xcb,0x93,
+0x1c,0xa8,0xec,0x43,0x09,0x89,0x9c,0x13,0xb9,0x00,0x9a,0x32,0x03,0x1c,0xbf,0x17,
+0x48,0x00,0x8a,0xd8,0x12,0x2b,0x93,0x9a,0x19,0x13,0xc1,0x01,0x60,0x48,0xfb,0x98,
+0x39,0x24,0x99,0x20,0xf1,0x19,0x38,0x20,0xa9,0x02,0xaf,0x25,0x0c,0x90,0x12,0xb0,
+0x4a,0x81,0x0c,0xc1,0x10,0xa2,0x1f,0x18,0x90,0xc2,0x00,0x3c,0xc8,0x83,0x31,0x03,
+0x1c,0x11,0x86,0xaa,0x9f,0x34,0xcb,0x40,0xa0,0x01,0x18,0x98,0x81,0x0d,0xc4,0x48,
+0x90,0x09,0x9b,0x05,0x31,0xa9,0x8b,0xf9,0x42,0xdb,0x08,0x38,0x91,0x12,0x2a,0x08,
+0x51,0xba,0x98,0xb0,0x17,0x2a,0x9d,0x07,0x08,0x98,0x80,0x38,0x9c,0x14,0x03,0x8b,
+0x02,0x20,0xd9,0x14,0x2c,0x13,0xfa,0x2b,0x03,0x10,0xc4,0x1b,0x11,0xb0,0x01,0x94,
+0x2f,0xc1,0x28,0xe8,0x29,0x99,0x02,0xf3,0x4a,0x00,0x8b,0x84,0x0a,0x12,0x28,0x9d,
+0x92,0x0e,0x02,0x19,0x71,0x98,0x93,0x81,0x8e,0x20,0x90,0xa0,0x95,0x0a,0xaa,0x0b,
+0xb4,0xa7,0x3a,0x01,0x29,0xf9,0x20,0x98,0x89,0xad,0x03,0xa8,0xb0,0x3f,0xa3,0x81,
+0x51,0x8c,0xa3,0x31,0x31,0xbd,0x98,0x62,0xa0,0x18,0x12,0xbc,0xc3,0x22,0x8f,0x83,
+0x1a,0x09,0x94,0x38,0x8a,0x02,0xa5,0x1f,0x02,0x81,0x21,0x1b,0xd9,0x23,0x10,0x29,
+0x9f,0xb2,0x62,0x12,0x88,0x6d,0xd1,0x10,0x90,0x88,0x18,0x19,0xc4,0x1a,0x8a,0xa4,
+0x48,0x89,0x82,0xb3,0x9b,0x23,0xdf,0x82,0x31,0xe8,0x82,0x7a,0xa8,0x01,0x10,0x01,
+0x8a,0x2a,0x98,0xe3,0x10,0x4a,0xd1,0x09,0x04,0x19,0x82,0x99,0x83,0x1e,0xb8,0x89,
+0x32,0x99,0x60,0xb3,0x1e,0xa5,0x29,0x80,0x9c,0x22,0xc0,0x2b,0x01,0x13,0x05,0x0d,
+0x89,0xa8,0x92,0x3f,0xf0,0x18,0x91,0xc1,0x29,0xbb,0x15,0x19,0xa2,0x80,0x2e,0xc2,
+0x82,0x29,0x9a,0x94,0x0d,0xa9,0x35,0x0d,0x82,0xc0,0x60,0x9a,0x80,0x29,0x80,0x09,
+0x49,0x90,0x98,0x22,0x15,0x3e,0xc0,0x12,0x10,0x0a,0x1b,0xa5,0xb8,0x18,0x73,0x0b,
+0xb5,0x29,0x08,0x28,0xb9,0x8e,0x06,0x11,0x9c,0x23,0x20,0xf8,0x12,0x48,0x88,0xd0,
+0x12,0x8a,0x0a,0xb2,0x71,0xb8,0x88,0x9c,0x83,0x1b,0x1b,0x95,0x0a,0x21,0x31,0xaa,
+0x7b,0xb4,0xc9,0x8c,0x22,0x9f,0x85,0x89,0x80,0x10,0x80,0xa0,0x39,0x59,0xe4,0x88,
+0x19,0xaa,0x05,0x20,0x03,0x5a,0x98,0x8a,0x21,0xf1,0x3a,0x8c,0x83,0x12,0x8a,0x81,
+0x1e,0x11,0x07,0x09,0x9a,0x12,0x89,0x09,0xa5,0xb0,0x7c,0x01,0xc8,0x29,0xa4,0x1b,
+0x80,0x32,0x94,0x3a,0xe9,0x8a,0x01,0x90,0xb1,0x3a,0xaa,0x11,0x27,0xa0,0xaf,0x14,
+0xa1,0x3a,0x11,0xba,0x30,0xd8,0x93,0x7a,0xb0,0xa3,0x28,0xbf,0x83,0x14,0x08,0xbb,
+0x03,0x29,0xfc,0x02,0x2a,0x90,0xd8,0x11,0x8b,0xe1,0x28,0x48,0x94,0x8a,0x3a,0x86,
+0x3b,0xea,0x90,0x39,0x00,0x08,0x52,0x12,0xf3,0x3c,0x83,0x29,0xc0,0x01,0x1a,0x2b,
+0x91,0xa2,0x3d,0xa4,0x32,0xad,0x29,0xf0,0x33,0x9c,0x82,0x09,0xea,0x51,0x91,0x39,
+0xb5,0x38,0x29,0xe0,0x38,0x82,0x8e,0x01,0x00,0x8a,0xb8,0x41,0x22,0x33,0xae,0xc8,
+0x89,0x18,0x83,0x21,0x3a,0x89,0x15,0xf1,0x20,0x0b,0xa3,0xba,0x40,0xf0,0x7b,0x98,
+0x00,0x12,0x28,0xe9,0x11,0x98,0x00,0x2b,0xb4,0xbb,0x19,0xf9,0x32,0xab,0xa5,0x2a,
+0x73,0xb9,0x83,0x80,0x2f,0xa2,0x81,0xba,0x39,0x42,0xaf,0x92,0x10,0x10,0x8f,0xa2,
+0x19,0x02,0x30,0x89,0x58,0xa2,0xf9,0x3a,0xbd,0x28,0x92,0x03,0x40,0x99,0xb0,0x99,
+0x8c,0xb8,0x46,0x09,0x13,0xa8,0x94,0x3e,0xc1,0x80,0x52,0x80,0x8a,0x95,0x1e,0x81,
+0x31,0xaa,0xa1,0x1d,0x82,0x10,0x13,0xf8,0x39,0x88,0xa0,0x96,0x79,0xa1,0x00,0x19,
+0xd0,0x01,0x3a,0xca,0x13,0xa9,0x1b,0xa3,0x23,0x0f,0xb3,0x33,0xbb,0x17,0xab,0x07,
+0x1c,0xa0,0x81,0x39,0x10,0x01,0x8b,0x31,0xf1,0x32,0x9f,0x12,0x0c,0xb2,0x23,0x0b,
+0x8c,0xc3,0x81,0x3a,0x87,0x11,0xda,0x88,0x00,0x3a,0x10,0xc3,0x74,0x89,0x89,0x0a,
+0x93,0x2a,0xa1,0xbc,0x54,0x91,0x3a,0xb1,0x23,0x91,0xcc,0x4e,0xe2,0x10,0x19,0x92,
+0x09,0x21,0x8b,0x21,0xa7,0xa1,0x3c,0x00,0x15,0xa0,0xa8,0x8f,0x13,0x89,0x20,0xc9,
+0x13,0x21,0x8f,0xa1,0xb1,0x7a,0xc8,0x19,0x90,0x82,0x28,0x79,0xb3,0x09,0x9d,0x23,
+0x9a,0x1a,0x91,0x10,0xb4,0x00,0x4f,0xc0,0x86,0x19,0x99,0x82,0x11,0xaa,0x13,0xeb,
+0x10,0x19,0x89,0xf3,0x61,0xaa,0x42,0x88,0xb8,0x01,0x1c,0x84,0x0f,0x90,0x00,0x02,
+0x9c,0x82,0xab,0x26,0xa9,0x10,0x10,0x93,0x31,0x88,0x78,0x91,0xf2,0x29,0x09,0x82,
+0xd0,0x40,0x0b,0x99,0xa6,0x28,0xb0,0x49,0xb9,0x93,0x8a,0xb2,0x8e,0x51,0xd9,0x12,
+0x9b,0x80,0x02,0xab,0x83,0x79,0xb2,0x2a,0xe0,0x48,0x9a,0xd1,0x10,0x81,0x19,0xdb,
+0xa3,0x22,0x49,0xb6,0x1c,0x18,0x23,0xb2,0x4b,0x08,0x90,0xf3,0x61,0x98,0x18,0xc8,
+0x40,0x2a,0x02,0x80,0x9f,0x15,0x0b,0xb1,0x01,0x9a,0x38,0xc2,0x43,0x1b,0x39,0xa7,
+0x3b,0x01,0x19,0xf9,0x90,0x8d,0x91,0x01,0x5a,0xd1,0x11,0x09,0x00,0x98,0x33,0x99,
+0xa0,0xea,0x3d,0xa3,0x8d,0x13,0x18,0x21,0xf9,0x98,0x28,0x03,0xb0,0x1f,0x12,0xc2,
+0x99,0x40,0xa0,0xc8,0x49,0x01,0x93,0xda,0x2f,0xb8,0x22,0x11,0x38,0x83,0x9b,0x17,
+0x2a,0xc0,0x23,0x18,0x1f,0xa0,0xc1,0x05,0x0c,0x08,0xb2,0x04,0x1b,0x09,0xb8,0x04,
+0x5a,0x10,0xa8,0xdb,0x73,0x88,0x91,0x99,0x03,0x1e,0xc1,0x21,0x08,0xb0,0xa0,0x3d,
+0x83,0xbc,0x10,0x14,0x0f,0x13,0x09,0x90,0x0b,0xb9,0x25,0x00,0x29,0x3b,0xe7,0x88,
+0x11,0x50,0xc8,0x90,0x39,0x99,0x03,0xa1,0x4c,0xc8,0x20,0x88,0x89,0x01,0x8f,0xb4,
+0x48,0x21,0x20,0xf1,0x29,0x90,0x1c,0xa0,0x34,0x10,0xc0,0x1b,0x86,0x29,0x0b,0xb4,
+0x8d,0x81,0x4a,0x20,0xd1,0x03,0x0c,0x93,0x29,0x88,0x23,0xf0,0x1f,0x08,0xa0,0x01,
+0x20,0x00,0xbc,0x19,0xc2,0x08,0x33,0xbf,0x22,0x9a,0x17,0x1b,0x85,0x9a,0x0c,0x98,
+0x19,0x23,0x91,0x9a,0xf9,0x1c,0x93,0x0a,0x23,0x1a,0x21,0xf8,0x19,0x65,0x9a,0xa0,
+0x40,0x81,0x00,0x0a,0xa2,0xdc,0x31,0x09,0x04,0xba,0xa8,0x73,0xd8,0x5b,0xa2,0x01,
+0x39,0x0a,0xb1,0x81,0x45,0x8c,0xa1,0x12,0x6a,0x90,0x14,0xba,0x8b,0x88,0x08,0x81,
+0x97,0x5b,0x89,0xb1,0x73,0x9a,0xa2,0x39,0xac,0x34,0x9b,0x90,0x0c,0x30,0x19,0xa2,
+0x00,0x4a,0x99,0xbf,0x28,0xf4,0x39,0xb0,0x14,0x3d,0x93,0xb0,0x72,0x98,0x89,0x80,
+0x08,0x98,0x58,0xc0,0x8a,0x21,0xd0,0x08,0x2d,0xb3,0x92,0x10,0x5b,0x83,0x09,0xdb,
+0x90,0x45,0x98,0xaa,0x39,0x22,0x87,0x0b,0x12,0x08,0xfc,0x12,0x59,0xc1,0x01,0x88,
+0x19,0xa1,0x12,0xab,0x71,0x88,0x00,0xb8,0x71,0x19,0xd2,0x29,0x22,0xcb,0xb4,0x48,
+0x89,0x91,0x68,0x11,0x91,0x9c,0x00,0x89,0x89,0xa0,0x0c,0xd4,0x10,0x6a,0x98,0xaa,
+0x85,0x48,0x8c,0xb2,0x20,0xa9,0x70,0xa1,0x92,0x98,0x49,0xfa,0x10,0x90,0x08,0x48,
+0x98,0x98,0x39,0x83,0x6b,0x88,0xda,0x11,0x49,0xe1,0x38,0x14,0x9b,0x90,0x8b,0x84,
+0x29,0x81,0x2a,0x93,0x27,0x78,0xa8,0x09,0xb3,0x5a,0xb2,0x48,0xc9,0xa9,0xb9,0x49,
+0xbb,0x27,0x1a,0x9b,0x06,0x1c,0x90,0x19,0x99,0x93,0x7b,0x99,0x99,0x23,0x73,0xa9,
+0x89,0x80,0xa3,0x4c,0xc8,0x21,0xb0,0xbd,0x41,0x28,0xa1,0xe1,0x49,0x08,0x29,0xc4,
+0x88,0x22,0x00,0xad,0x04,0xa1,0x3a,0x0a,0x01,0x86,0x59,0x80,0x90,0xe2,0x49,0x19,
+0xf8,0x11,0xa9,0x19,0x99,0x82,0x04,0x1c,0xa9,0x45,0x8b,0x94,0x38,0x08,0x90,0x10,
+0xb2,0x1f,0x01,0xb0,0x78,0x81,0x9a,0x91,0x38,0x52,0xf9,0x89,0x01,0x38,0x81,0x29,
+0xf3,0x98,0x7c,0x08,0x82,0x98,0x10,0x48,0xae,0x01,0x98,0xb1,0x3d,0x90,0xa2,0x30,
+0x10,0xb0,0x0b,0x07,0x81,0x8a,0x8a,0xc2,0x62,0x42,0xa8,0xc0,0x79,0x80,0xa9,0x91,
+0x53,0x8a,0x22,0xd0,0x18,0x99,0x20,0xca,0x31,0x9c,0x14,0xc9,0x89,0x18,0xa6,0x09,
+0x0e,0x91,0xb0,0x29,0x30,0x4b,0xd4,0x38,0x98,0x04,0x1f,0x80,0xd1,0x00,0x19,0xb0,
+0x83,0x49,0x11,0x85,0x01,0x1d,0x03,0x18,0x9a,0x0d,0xa0,0x68,0xb9,0x01,0x83,0x79,
+0x91,0x29,0x11,0xaa,0xe3,0x1b,0x99,0x68,0xd3,0x38,0x89,0x92,0x08,0x21,0xfa,0x0b,
+0xb4,0x3c,0xb9,0x22,0xbc,0x69,0x90,0x90,0xa4,0x4c,0x2b,0xa2,0x18,0x08,0xa3,0x8f,
+0x04,0x88,0x23,0x99,0xa4,0x3b,0x08,0xd0,0x80,0x10,0x0f,0x13,0x13,0x1a,0xea,0x36,
+0xb9,0x20,0x32,0xfb,0x01,0x28,0x81,0x93,0x8d,0x84,0x18,0x99,0x06,0x9b,0x82,0x9c,
+0x32,0xc9,0xb0,0x0b,0x98,0x80,0x80,0x41,0x26,0x1f,0x88,0xa2,0xca,0x79,0xa0,0x29,
+0xc1,0x91,0x4d,0x91,0x8b,0xb3,0x31,0x0e,0x98,0xa2,0x2a,0x20,0xa8,0x57,0x9b,0xa2,
+0x11,0x5b,0x99,0xb4,0x0c,0x39,0x32,0xf0,0x18,0x14,0x2b,0xc8,0xa8,0xc1,0x49,0x00,
+0x02,0x0b,0x17,0x80,0x2a,0xaa,0xa8,0x33,0x14,0x5a,0xaa,0x53,0xd0,0x49,0x02,0x9a,
+0x98,0x01,0x22,0xae,0x04,0x8c,0x42,0x81,0x11,0xe9,0x8a,0x09,0x92,0x48,0x2d,0xd5,
+0x19,0x18,0x1a,0xa1,0x03,0xa2,0x1e,0x0c,0x84,0x9a,0x22,0xbb,0x42,0xbb,0x61,0xba,
+0xb2,0x4e,0x11,0xc0,0x30,0x09,0x99,0xb1,0x78,0x91,0xa9,0x33,0x8d,0x0c,0x06,0x80,
+0x19,0x08,0xc2,0x1c,0x88,0x00,0x03,0x04,0xdf,0x23,0x00,0xca,0x03,0x00,0x4b,0xe0,
+0x00,0x88,0x28,0x98,0xd2,0x39,0x21,0xf0,0x28,0x00,0x2c,0xa7,0x09,0x81,0x3b,0xd1,
+0x81,0x39,0x9a,0xa5,0x09,0x2a,0x81,0x06,0x10,0x91,0x8d,0x02,0x8a,0x90,0x92,0x91,
+0x3f,0xda,0x01,0x48,0x14,0x19,0x01,0x84,0xbc,0x31,0xb9,0xf2,0x3a,0xa0,0x87,0x0c,
+0x89,0x83,0xa9,0x29,0x9c,0x84,0x23,0xb0,0x9a,0x5b,0xa5,0x00,0x8a,0x29,0x09,0x57,
+0x1b,0x98,0x8d,0x34,0xa9,0x11,0x8a,0x8b,0x97,0x18,0x09,0x93,0x1c,0xc3,0x48,0xc0,
+0x41,0xa8,0x01,0xab,0x33,0x7a,0xf3,0x09,0x80,0x88,0x08,0x22,0x01,0xad,0x52,0x00,
+0x10,0xba,0x9f,0x94,0x3a,0xa9,0x28,0xa4,0x1a,0x24,0x99,0xab,0x31,0xb5,0x7a,0xb4,
+0x2a,0xca,0x41,0x91,0x49,0xc1,0x18,0x99,0x88,0x88,0x29,0x83,0x41,0xf9,0x2d,0xa0,
+0x48,0x90,0x10,0x42,0x99,0xa0,0x91,0xfc,0x3c,0x80,0xa2,0x2a,0x30,0x15,0xea,0x0c,
+0x15,0x9a,0x10,0x08,0x00,0x21,0xb9,0x09,0x84,0x24,0x0b,0x8e,0xd4,0x20,0x2a,0x03,
+0xc8,0x23,0x8b,0x21,0x13,0xc1,0x60,0xaf,0xb2,0x38,0x11,0xa8,0xc9,0x8d,0x43,0x01,
+0x99,0x26,0x90,0x1a,0x88,0xeb,0x92,0x6a,0x80,0x99,0xb1,0x0c,0x84,0x19,0x34,0xd0,
+0x09,0x85,0x0b,0x8a,0x12,0xe9,0x12,0x19,0x9d,0x90,0x93,0x18,0x59,0xb2,0xbb,0x42,
+0xb0,0x79,0xe9,0x21,0x90,0x08,0x16,0x3b,0xb8,0x00,0xb0,0x8f,0x91,0x48,0xba,0x90,
+0x37,0x19,0x0b,0xb1,0x97,0x1a,0x89,0x23,0x8b,0xb3,0xf0,0x2b,0x10,0xb0,0x01,0x00,
+0xb3,0xb3,0x9f,0x86,0x28,0x98,0xa8,0xdb,0x58,0x22,0xa3,0xad,0x84,0x3b,0xb1,0x51,
+0x01,0x9a,0x03,0xbd,0x68,0x01,0xba,0x21,0x80,0x9a,0x82,0x3c,0x04,0x9b,0x94,0x49,
+0xca,0x42,0x0e,0x95,0x1b,0x81,0x14,0x98,0x80,0x20,0x29,0xa5,0x95,0x4b,0x99,0xf1,
+0x00,0x3a,0x23,0x92,0x8a,0x08,0xee,0x43,0x1b,0xc1,0x32,0xa9,0x29,0x90,0x18,0xae,
+0xc1,0x28,0x0e,0x94,0x09,0x29,0xa8,0x22,0xf9,0x00,0x8c,0xa2,0x38,0x13,0x0b,0x31,
+0x87,0x51,0x3a,0xd8,0x04,0x28,0x09,0x98,0x81,0x40,0x69,0x80,0xe9,0x80,0x88,0x28,
+0xa8,0x90,0x43,0x0b,0xfc,0x03,0x0b,0x90,0x50,0xb3,0x2c,0xa1,0x9f,0x11,0x13,0x08,
+0x9e,0x04,0x98,0x41,0x98,0x12,0xbb,0x31,0x80,0xb9,0x0f,0x12,0xb0,0x0b,0x70,0x03,
+0x91,0xc9,0x08,0xbf,0x43,0x88,0x09,0x19,0x97,0x0a,0xa8,0x04,0x8d,0x81,0x42,0x81,
+0x8a,0x18,0xfb,0x09,0x41,0xc8,0x80,0x29,0xb0,0x21,0x8e,0xb1,0x16,0x3b,0xa0,0x12,
+0x08,0x09,0x98,0x42,0x57,0x99,0x89,0xc2,0x18,0x08,0x8b,0x16,0xb9,0x90,0x49,0x23,
+0x0d,0xa5,0x08,0x3b,0x84,0xe9,0x39,0x1a,0xb1,0x30,0xb0,0x36,0x8c,0xd0,0x00,0x28,
+0xb2,0x0f,0xa0,0x9a,0xe9,0x71,0x98,0x00,0x98,0xa1,0x20,0x1a,0x94,0x1c,0x96,0x00,
+0x11,0x82,0x8d,0x91,0x90,0x2b,0xc2,0x13,0x89,0x9b,0x14,0xa2,0xcb,0x37,0x2a,0xe9,
+0x84,0x1b,0x11,0xea,0x18,0x80,0x89,0x99,0x2c,0x26,0x09,0x00,0x39,0x12,0xde,0x20,
+0x21,0xab,0xa4,0x48,0x29,0x00,0xc3,0x38,0xbb,0x55,0x00,0xa9,0xf2,0x21,0x3b,0xa2,
+0x9c,0x07,0x8a,0x89,0xc8,0x8b,0x81,0x94,0x40,0x0c,0x03,0xc1,0x00,0x0f,0x01,0x29,
+0xc8,0x13,0x1c,0x08,0x82,0x23,0xaa,0x78,0x10,0xe2,0x28,0xba,0x39,0xd3,0x34,0x8c,
+0xaa,0x14,0x18,0xa9,0x32,0x0a,0x84,0x2e,0xa4,0x1a,0x10,0xb2,0x0a,0xd0,0x49,0x33,
+0xfa,0x39,0xb2,0x42,0x1b,0xf9,0x08,0x58,0xa2,0x19,0x9d,0x12,0x82,0xa9,0x21,0xc3,
+0x39,0x85,0x9d,0x98,0x98,0x24,0x69,0xb0,0x12,0x8d,0x18,0x82,0x81,0xcb,0x40,0x96,
+0x89,0x4a,0xb4,0x48,0x98,0x89,0x19,0xb9,0xba,0x71,0x19,0x12,0xc9,0x01,0x1f,0x91,
+0x04,0x8e,0x80,0x12,0x18,0xa8,0xaa,0xa0,0x29,0x73,0xd2,0x20,0x90,0x94,0x2d,0x90,
+0x85,0x1b,0x00,0x92,0x30,0x8c,0xb7,0x0c,0x1a,0x94,0x84,0x0d,0x00,0x89,0x33,0xbb,
+0xb1,0x59,0x09,0xba,0xb3,0x3c,0x86,0x1e,0x80,0xb3,0x58,0xaa,0xa1,0x38,0x80,0x10,
+0xfa,0x18,0xa0,0x79,0xa1,0x88,0x18,0x8a,0x21,0x15,0xca,0x38,0x99,0xa4,0x4a,0x8a,
+0x87,0x8c,0x81,0x50,0xa8,0xa3,0x4a,0xb0,0x6b,0xc2,0x39,0xb1,0x2a,0x33,0xb9,0xb8,
+0x71,0x02,0xda,0x01,0x2a,0xc9,0x03,0x59,0x00,0xb0,0xa7,0x1f,0xa3,0x80,0x1a,0x00,
+0x91,0x14,0xa9,0x94,0x1a,0xdc,0x30,0x01,0x98,0x90,0xca,0x70,0xa1,0x09,0x14,0xc1,
+0x7b,0x90,0xb0,0x61,0x09,0xa0,0x08,0x21,0x9c,0x23,0xbc,0x08,0x08,0x92,0x82,0x8c,
+0x20,0xd8,0xa3,0x49,0xb1,0xbf,0x07,0x0a,0x1b,0xa3,0x10,0x2a,0xf9,0x41,0x8a,0x00,
+0xc3,0x79,0x82,0x88,0x3b,0x97,0x09,0x20,0x89,0xa3,0x88,0x8c,0xa0,0x61,0xb9,0x31,
+0xc8,0x38,0x1b,0x43,0x9b,0x95,0x68,0xc9,0x3a,0xa3,0x9c,0x01,0x48,0xab,0xe9,0x12,
+0x08,0x7c,0xa0,0x18,0x03,0x1b,0xab,0x82,0x10,0xda,0x15,0x1d,0x81,0xc8,0x10,0x09,
+0x91,0x1b,0xfa,0x13,0x1c,0x42,0x98,0xa2,0xa0,0x59,0x80,0x01,0xbb,0x44,0x10,0xd3,
+0x3c,0xc9,0x88,0x81,0x40,0xa2,0x9d,0x93,0x09,0x32,0xbb,0x07,0xf9,0x24,0x2b,0x99,
+0x87,0x98,0x00,0x18,0x21,0xb0,0xd9,0x58,0xaa,0xa9,0x15,0x19,0x00,0x0a,0x91,0xe1,
+0x2b,0x29,0xe3,0x88,0x4b,0xf2,0x28,0x09,0xca,0x33,0x9a,0x82,0x4a,0xa2,0x59,0xb0,
+0x5a,0x01,0xb2,0x8a,0x1e,0xe9,0x20,0x80,0x12,0x19,0x0a,0x93,0x01,0x5a,0x30,0xab,
+0x17,0xad,0x71,0xb9,0x12,0x98,0x0a,0x21,0xb8,0xc3,0x4c,0x88,0x12,0x59,0xd2,0x00,
+0x29,0x8a,0x02,0x93,0x53,0xcb,0x3d,0x92,0x95,0x38,0xba,0x09,0x04,0x9f,0x94,0x11,
+0x2c,0x80,0x18,0x18,0xa5,0x8f,0x82,0x1c,0x82,0x80,0x00,0x31,0x18,0xd1,0x92,0x9d,
+0x93,0x59,0x89,0xa3,0x20,0x79,0xb3,0x11,0xcb,0x3d,0x85,0x2b,0xc8,0x29,0x02,0x01,
+0x89,0xb1,0x3c,0xa0,0x3a,0xf1,0x11,0x4c,0xa2,0xb2,0xad,0x01,0x0f,0x92,0x81,0x31,
+0x2c,0xa2,0x1a,0x84,0x6a,0x82,0xa9,0x23,0x9f,0xa8,0x18,0xd1,0x30,0x54,0x8a,0x80,
+0x94,0x28,0x8a,0x9a,0x27,0x1a,0x92,0x8d,0x81,0x84,0x1a,0xcb,0x19,0xa6,0x3a,0xaa,
+0x10,0xf0,0x4a,0x98,0x88,0x10,0x85,0x1c,0x12,0x00,0x8f,0x84,0x08,0x0b,0x08,0xb0,
+0x31,0xca,0x92,0x8f,0x83,0x20,0xa4,0x3d,0xc1,0x33,0x8c,0x80,0xa2,0x49,0x90,0x62,
+0xe9,0x00,0x21,0x0a,0x00,0x02,0xb8,0x06,0x0f,0xa8,0x10,0x20,0x22,0xdc,0x88,0x80,
+0x89,0x09,0x86,0x29,0x81,0x99,0x92,0x18,0x3c,0x88,0x07,0x00,0x80,0x71,0xcb,0xa2,
+0x58,0x90,0x81,0x8b,0x18,0xa5,0x73,0xc0,0x18,0x80,0xa8,0x89,0x49,0xb2,0x01,0x08,
+0xbd,0xcc,0x15,0x18,0x98,0x03,0x91,0x0f,0x91,0xc2,0x79,0x90,0x09,0x91,0x30,0xd8,
+0x80,0x99,0x20,0x91,0x97,0x0c,0x2a,0x94,0x08,0x21,0xbd,0x93,0x1b,0x9a,0xb0,0x43,
+0x99,0x2f,0x95,0x01,0x30,0xb0,0x23,0x33,0xff,0x08,0x03,0x18,0x89,0x83,0xbd,0x29,
+0xf1,0x08,0x02,0x78,0x90,0x80,0x90,0x09,0x8c,0x29,0xb1,0x01,0xe3,0x69,0x8a,0xa1,
+0x80,0x02,0x8d,0x29,0x30,0xf0,0x00,0x2a,0x02,0x03,0x1a,0x2c,0x87,0x80,0x40,0x8b,
+0xa1,0x91,0x50,0xaa,0x83,0x9c,0x8f,0x83,0x9a,0x21,0x0e,0x86,0x09,0x01,0x9a,0x10,
+0x18,0x01,0x97,0x5c,0x00,0xa1,0xa1,0x1a,0x0c,0x90,0x95,0x81,0x1c,0xbb,0x83,0x29,
+0x71,0x00,0x92,0x2b,0x90,0xc1,0xe9,0x29,0x41,0x99,0xa0,0x19,0x27,0x4a,0x08,0xc3,
+0x98,0x78,0x99,0x00,0x0a,0xb2,0x24,0x8d,0xa9,0x23,0x32,0x68,0xc8,0x89,0xb1,0x71,
+0xa8,0x00,0xa4,0x99,0x29,0x1e,0x82,0x06,0x8b,0x01,0x9c,0x35,0xa8,0x83,0x0b,0xa9,
+0x63,0xa3,0x09,0x98,0x53,0x13,0x0e,0xa3,0x0c,0x85,0x1c,0x99,0xa2,0x8a,0x94,0x69,
+0x88,0x00,0xc1,0x10,0x69,0xba,0x83,0x38,0x99,0xae,0x08,0x04,0x3c,0xe1,0x22,0x19,
+0xa2,0x09,0xdb,0x0a,0x13,0x08,0x9c,0x26,0x8a,0x84,0x88,0x8c,0x81,0x99,0xbd,0x01,
+0x0a,0x26,0xd9,0x19,0x93,0x83,0x91,0x1d,0x83,0xfc,0x08,0x19,0x33,0x08,0xa1,0xb6,
+0x3a,0x18,0x9a,0x87,0x08,0x83,0x6a,0x09,0xb0,0xa4,0x3a,0x99,0x2d,0xd2,0x21,0x92,
+0x0d,0x34,0x09,0xaa,0x97,0x1d,0x11,0xb1,0xa8,0x11,0x0d,0x10,0xa8,0x90,0x26,0x88,
+0x10,0xca,0x08,0xc8,0x58,0x19,0x9a,0xa7,0x19,0x2a,0x98,0x22,0xba,0x13,0x9f,0xa3,
+0x79,0x83,0x0b,0x00,0x09,0x86,0x8c,0x81,0x32,0x92,0x4e,0xd3,0x0a,0x29,0xb8,0xa5,
+0x89,0x3a,0x89,0x81,0x86,0x18,0x0b,0x9e,0x91,0x41,0x98,0x03,0xe1,0x4a,0xa8,0x83,
+0x98,0x24,0x19,0xd0,0x12,0xaf,0x12,0x82,0x1d,0x83,0x82,0x5b,0xd9,0x22,0x0b,0xc1,
+0x48,0x90,0x82,0xbb,0x6a,0x90,0xb0,0x98,0x2c,0x89,0x85,0x2c,0x01,0x05,0x1a,0x00,
+0x29,0xc9,0xa6,0x3c,0x00,0xda,0x21,0x92,0x0c,0x49,0x03,0x00,0x01,0x00,0x3e,0x05,
+0x81,0x8b,0x20,0xa2,0xa0,0x41,0x05,0x0f,0xc1,0x1b,0xa0,0x2c,0x00,0x83,0x9d,0x85,
+0x2a,0xe2,0x41,0xaa,0x10,0x01,0x38,0xe0,0x52,0x89,0xb2,0x1c,0x09,0x9a,0xa7,0x18,
+0x88,0x20,0xa1,0x22,0x0e,0x84,0x28,0x98,0xaa,0x82,0x0c,0xb3,0x4b,0xf9,0x94,0x1b,
+0x08,0x06,0xba,0x13,0xaf,0x10,0x39,0xa8,0x83,0x00,0x1e,0x90,0x34,0x8a,0xe0,0x23,
+0x0f,0x11,0x80,0x98,0x19,0x04,0x2b,0xa9,0xb5,0x70,0x88,0xa0,0x89,0x09,0x93,0x35,
+0x31,0x9b,0xda,0xa9,0x37,0x0c,0xba,0x10,0xdb,0x20,0x90,0x03,0x82,0x9f,0x01,0x99,
+0xb3,0x4b,0x53,0x8b,0x16,0x89,0x88,0x51,0x88,0xba,0x13,0x59,0x81,0x1c,0xda,0x25,
+0x90,0x3a,0x9b,0xb4,0x72,0x9a,0x91,0x91,0x22,0x2f,0x98,0xe4,0x20,0x09,0x92,0x98,
+0xa1,0x01,0x0a,0xb1,0x0e,0x04,0x9a,0x5c,0xa2,0x11,0x18,0x1f,0xa3,0x81,0x3a,0x09,
+0x8c,0xf2,0x50,0xb9,0x01,0x1a,0x20,0xc4,0x00,0x18,0x10,0xac,0x36,0xc0,0x20,0x0a,
+0x19,0xb4,0x98,0x71,0x88,0x9b,0xf0,0x28,0x89,0xa0,0x11,0x10,0xd3,0x49,0x08,0x88,
+0x04,0x19,0xe8,0x30,0x9e,0x81,0x98,0x4a,0x83,0x88,0x1c,0xa4,0xaa,0x38,0xd3,0x1b,
+0x30,0x9a,0x05,0x12,0x38,0xbb,0x4d,0x97,0x99,0x09,0x00,0xba,0x20,0x93,0x27,0x1a,
+0x28,0x15,0x22,0xbc,0x99,0x0f,0x92,0x80,0x00,0x0f,0xb9,0x07,0x10,0x0b,0x08,0x06,
+0x08,0x99,0x0a,0xd0,0x83,0x4c,0x92,0x91,0x89,0x1a,0xb4,0xa1,0x0d,0x18,0x50,0xf0,
+0x11,0x20,0xc9,0x39,0xc2,0x81,0x39,0xcb,0xb0,0x11,0xa1,0x53,0x0c,0x01,0xa3,0x8f,
+0x02,0x91,0x5b,0x81,0xa0,0x18,0x17,0x8d,0x00,0x03,0xa9,0x2a,0x29,0xdc,0x07,0x1a,
+0xa0,0xaa,0x52,0xca,0x82,0x22,0x28,0x19,0x95,0x00,0x09,0x92,0x9e,0x29,0x04,0xb0,
+0x80,0x4c,0xd0,0x8a,0x39,0x03,0x01,0x94,0x8f,0x90,0x86,0x1b,0x8a,0x85,0x18,0x19,
+0xb9,0x41,0xb0,0x82,0x9b,0x8f,0x85,0x83,0x0c,0xac,0x13,0x01,0x0b,0x1a,0x08,0x83,
+0x85,0xaf,0xa1,0x00,0x09,0x1b,0x17,0x08,0x39,0x12,0x97,0x1c,0xa9,0xc4,0x29,0x1a,
+0xa2,0x22,0x84,0x3a,0x13,0xdf,0x12,0x30,0xb9,0x02,0x48,0xd1,0x1b,0x41,0xe8,0x20,
+0xa8,0x58,0x00,0xb9,0x14,0x4a,0xd2,0x30,0xa9,0x02,0xfa,0x2a,0xa9,0x88,0xb1,0x38,
+0xb3,0x47,0x9e,0x18,0x10,0x83,0x19,0x0a,0x10,0xa2,0x61,0xca,0xa1,0x2d,0x92,0x91,
+0x3a,0x83,0xad,0x51,0x11,0x88,0x95,0x8f,0x02,0x11,0x9b,0x98,0x59,0x82,0x0d,0xb5,
+0x38,0x8b,0x15,0x81,0x1a,0xcb,0x16,0x8a,0x00,0xb0,0x11,0x2c,0x04,0x91,0x6c,0x99,
+0xb2,0x4a,0x99,0x02,0x2a,0x28,0xe9,0x03,0x0f,0xa0,0x80,0xa0,0x92,0x4e,0xb8,0x08,
+0x06,0x3b,0xb0,0x20,0x09,0xa8,0x11,0x14,0x0f,0x82,0x90,0x22,0x88,0x9f,0x41,0xc9,
+0x21,0xa8,0x31,0x92,0x7b,0xb6,0x10,0x19,0xa9,0x11,0x9a,0x06,0x0d,0x01,0xa0,0x28,
+0x0b,0xe0,0x02,0x0c,0xba,0x12,0xe2,0x4b,0x94,0x40,0xa8,0x81,0x10,0x81,0x79,0xc8,
+0x10,0x08,0x03,0x99,0x18,0xcb,0xe2,0x60,0x98,0x11,0xb2,0x4a,0x89,0x95,0x20,0x8d,
+0x89,0x02,0x1a,0x91,0xc8,0x00,0x89,0x7a,0x02,0x96,0x3a,0x00,0x93,0xc8,0x4b,0xa9,
+0xb4,0x4f,0xa1,0x90,0x2a,0x98,0x25,0xb0,0x1e,0xa0,0x91,0x19,0x31,0x92,0x3c,0xa2,
+0x04,0x1e,0x12,0xf9,0x31,0xb9,0x10,0xa3,0x18,0x91,0x3a,0x0c,0x87,0x2e,0xb0,0xc0,
+0x5a,0xa8,0xa2,0x35,0x0d,0x01,0xa2,0x0a,0x8a,0x21,0xb9,0xb2,0x0f,0x40,0xb1,0x1a,
+0xcb,0x40,0x41,0xb9,0xd0,0x30,0xa1,0x21,0x1a,0x18,0xf1,0x22,0x4d,0x88,0xb0,0x01,
+0x52,0x89,0x8f,0xa2,0x80,0x38,0x0a,0xe9,0x53,0x01,0xc0,0x0d,0x02,0x89,0xb0,0x8a,
+0x0b,0x97,0x43,0x8a,0x81,0x08,0x01,0x2b,0x95,0x9b,0xa0,0x8f,0x84,0x31,0x09,0x31,
+0xa0,0xc1,0x79,0x04,0xa8,0xc1,0x4d,0xb8,0x01,0x28,0x92,0x3a,0xa2,0xbe,0x14,0x9b,
+0x89,0x04,0xa1,0xa8,0x3b,0xc1,0x19,0x97,0x42,0x9b,0xa8,0x17,0x9b,0x39,0xe0,0x00,
+0x43,0x39,0xe3,0x81,0x3c,0xa0,0xb0,0x80,0x9b,0x1a,0x87,0x08,0x98,0x12,0xda,0x20,
+0x05,0x39,0x88,0xda,0x33,0x3a,0x01,0xc4,0x18,0x8d,0xa0,0x89,0x85,0x8e,0x81,0x08,
+0xa7,0x38,0x8a,0xf2,0x28,0x01,0x0b,0x00,0x94,0x5a,0xb1,0x30,0xa8,0x99,0x99,0x19,
+0x97,0x93,0x5b,0xb9,0x04,0xd0,0x1a,0x13,0x20,0x22,0xec,0x83,0x0c,0x91,0x89,0x01,
+0x08,0xa9,0x64,0xb3,0x43,0x1e,0x93,0xa9,0x01,0x42,0x9c,0xd3,0x20,0x81,0xbb,0x28,
+0xd3,0x3d,0x00,0x04,0x1a,0x88,0xae,0x80,0x8d,0x93,0x29,0x41,0x96,0x9a,0x28,0x93,
+0xda,0xa2,0x70,0x89,0xa0,0x88,0x13,0x52,0x9d,0x92,0x3a,0xd1,0x22,0x2a,0xf9,0x19,
+0x20,0x11,0x2c,0x94,0xa1,0x1f,0x02,0x9a,0x91,0x89,0xac,0x23,0x8a,0xd9,0x01,0x3a,
+0xa9,0x89,0x70,0x04,0xbb,0x71,0x29,0xf3,0x0a,0x29,0x19,0xd3,0x20,0x89,0x00,0x00,
+0x91,0x29,0xb2,0x3a,0x82,0xf6,0xa9,0x51,0xd8,0x8c,0x02,0x23,0x8c,0x90,0x03,0x2a,
+0xd1,0x32,0x71,0xa8,0x89,0x20,0x89,0x92,0x51,0x18,0xa1,0xf2,0x3b,0x80,0x68,0x08,
+0xa5,0x2b,0xa4,0x10,0xac,0xab,0x13,0x89,0x08,0x2b,0x47,0x30,0x9a,0xd0,0x23,0x9f,
+0x83,0x19,0x62,0x98,0x81,0x20,0xab,0x23,0x9f,0x21,0xa0,0x1d,0x92,0x29,0x98,0xd4,
+0x2b,0x01,0x81,0xa1,0x9f,0x01,0x88,0x43,0xfa,0x1a,0x93,0x02,0x98,0x1c,0xa6,0x28,
+0x0a,0x88,0x99,0x22,0x09,0xcc,0x7a,0xa2,0x30,0x04,0x1b,0x94,0x8c,0x86,0x9c,0x22,
+0x11,0xab,0xa3,0x0c,0x25,0x98,0x88,0x9f,0x83,0x00,0x2c,0x02,0x93,0xaf,0x23,0x18,
+0x89,0xb3,0x08,0x8f,0xa3,0x01,0xa8,0xa8,0xbb,0x18,0x86,0x82,0x8e,0x84,0xa9,0x19,
+0xf8,0x38,0x82,0x4a,0xf2,0x18,0x38,0x01,0xca,0x61,0x18,0xb8,0x13,0x29,0xf0,0x88,
+0x11,0x0b,0x9c,0x80,0x15,0x8a,0x1b,0xb0,0x31,0xa5,0x1b,0x70,0xd2,0x00,0x1c,0x89,
+0x06,0xa8,0x8a,0x91,0x88,0x13,0x18,0x15,0xcb,0x00,0xc4,0x52,0x1a,0x9a,0x84,0x0b,
+0x01,0x28,0x21,0xde,0xb8,0x58,0xa8,0xa8,0x22,0x44,0xac,0x9a,0x93,0x74,0x99,0x22,
+0x02,0xb8,0x2a,0x1b,0x98,0x85,0x32,0x43,0x8f,0x91,0x02,0x1e,0xa0,0x19,0x81,0x33,
+0x49,0x8f,0xb3,0x09,0x38,0x49,0x04,0xaf,0x21,0x84,0x1b,0xb9,0x01,0xba,0x06,0x4a,
+0xb8,0x2b,0xf2,0x19,0x18,0x01,0x72,0x90,0x10,0x19,0x8a,0x86,0x1b,0x24,0x9c,0xa2,
+0x30,0x98,0x2d,0x83,0x93,0x8e,0xa1,0x23,0x69,0xd8,0x09,0x13,0x99,0x1d,0x85,0x1b,
+0x98,0xc2,0xaa,0x1c,0x80,0x05,0x2a,0x02,0x9a,0x9b,0xea,0x40,0x90,0x00,0x90,0x2a,
+0xe1,0x25,0x29,0x88,0x20,0xb2,0xec,0x60,0x90,0x88,0x11,0x00,0xa2,0x1e,0xc3,0x30,
+0xbc,0x82,0xa0,0x0f,0x03,0x89,0xb0,0xa1,0x3c,0x01,0x12,0xe2,0x68,0xa1,0x20,0x9d,
+0x91,0x04,0x11,0x5a,0xb1,0x91,0x2a,0x71,0x83,0x91,0x10,0x4c,0xd0,0xb9,0x2a,0x90,
+0x42,0xbd,0x20,0x38,0xf8,0x28,0x28,0xb0,0x09,0x8c,0x95,0x11,0x1d,0x80,0xb8,0x12,
+0x50,0x8f,0x92,0x88,0x1a,0x21,0x52,0xb1,0xa9,0x59,0xa3,0x03,0x3b,0xa0,0xbf,0x01,
+0xb1,0x41,0x9e,0x89,0x90,0x27,0x09,0xaa,0x04,0x0b,0x61,0x92,0x91,0x8e,0x81,0x0a,
+0xc0,0x62,0x98,0x20,0xb8,0x98,0x2a,0xa1,0x13,0xae,0x01,0x9b,0x07,0x9b,0x0a,0x97,
+0x4a,0xa1,0x40,0xca,0x00,0x18,0x89,0x83,0x1e,0xc0,0x5a,0x90,0x11,0xa0,0x30,0x33,
+0x79,0xb0,0x12,0x1a,0xab,0x0c,0x87,0x19,0x1a,0x84,0xc1,0x88,0x2e,0x92,0xd1,0x32,
+0x3a,0xb0,0xa9,0x29,0xb1,0x27,0x09,0x1c,0xb1,0x17,0x2c,0x98,0xb0,0x31,0x11,0x0a,
+0x00,0xf3,0x4a,0x8c,0x90,0x20,0x90,0xb3,0x68,0x0c,0xc9,0x02,0x1b,0x72,0xa0,0x95,
+0x19,0xc8,0x5a,0x80,0x91,0xad,0x19,0x32,0x8a,0xb3,0x19,0x4a,0x12,0x08,0x07,0x1d,
+0xa2,0x81,0x1c,0x91,0x10,0x25,0x80,0x8e,0x92,0x19,0x82,0x93,0x6c,0x21,0xa0,0xa2,
+0x08,0x1f,0x89,0x02,0xd9,0x12,0x60,0xb8,0x92,0x29,0x91,0x3c,0xd9,0x53,0xa8,0xa9,
+0x00,0x09,0x2f,0x93,0x19,0xb1,0x7c,0xb0,0x1a,0x84,0x99,0x02,0x90,0x79,0xe9,0x10,
+0x28,0xab,0x94,0x40,0x9b,0x88,0x92,0x28,0x38,0x33,0x92,0x22,0xbf,0xf3,0x4d,0x91,
+0x99,0x08,0x88,0x9d,0x00,0x30,0x83,0x39,0x89,0xb1,0x99,0xda,0x27,0x8d,0x29,0x95,
+0xa0,0x3a,0x50,0xb8,0x06,0x19,0xaa,0x4a,0xb9,0x32,0x19,0xd3,0x38,0x9c,0x97,0x19,
+0xb2,0x3a,0x82,0xc9,0x13,0x0a,0x93,0x8b,0x71,0x85,0x9e,0x11,0x00,0x48,0xb0,0x98,
+0x23,0x0d,0xa2,0x60,0x9b,0xa1,0x91,0x2a,0x0d,0x91,0x02,0x20,0x01,0x25,0xa9,0x9f,
+0xa6,0x1a,0xbb,0x92,0xb0,0x5e,0x00,0x94,0x39,0x03,0xb8,0x1d,0x81,0x8b,0x15,0x81,
+0x49,0x84,0x8b,0xb6,0x1a,0x22,0x9e,0xb2,0x2a,0x80,0x29,0xa9,0x95,0x22,0xa9,0xb9,
+0x8f,0x27,0x9b,0x80,0x1a,0x61,0xb8,0xb2,0x69,0x8b,0x02,0xa4,0x2c,0x80,0x80,0x9d,
+0x94,0x8d,0x30,0xf0,0x18,0x1a,0x99,0x13,0xa1,0x29,0x08,0xf3,0x11,0x3b,0x98,0x27,
+0xab,0x84,0x09,0x91,0x09,0xd9,0x29,0x81,0x13,0x78,0xa9,0x89,0x03,0x0a,0x52,0x89,
+0x93,0x71,0xc4,0x09,0x9a,0x21,0x0d,0xf2,0x20,0x98,0x1c,0x91,0xb2,0xac,0x52,0x89,
+0xa0,0x00,0x42,0xa8,0x51,0x84,0x29,0xa1,0x43,0x93,0x0b,0x31,0xf1,0x8b,0x7a,0x93,
+0x00,0x1a,0x1a,0x47,0xb9,0x82,0x2a,0x00,0x19,0x92,0xeb,0x18,0x61,0x9a,0xc4,0x10,
+0x0b,0x92,0x8a,0x92,0x0b,0xec,0x22,0x11,0xdb,0x93,0x0b,0xfd,0x11,0x3a,0x90,0xa3,
+0x8d,0x28,0x04,0x80,0x21,0x09,0xa8,0x12,0xa6,0x3d,0xc9,0x15,0x33,0x9b,0xd0,0x19,
+0x12,0x08,0x1a,0xf2,0x04,0x3c,0xd0,0x10,0x08,0x09,0xb9,0x13,0x93,0x0f,0x83,0x6b,
+0xc2,0xb8,0x0a,0x31,0x11,0x8d,0xb3,0x97,0x29,0x69,0xe8,0x80,0x11,0x08,0x0a,0x02,
+0x83,0x01,0x1d,0xab,0x00,0x84,0x00,0x4c,0xb1,0xd3,0x09,0x3a,0x82,0x25,0xb9,0xcb,
+0x49,0x12,0x19,0xb4,0x52,0xba,0x8b,0xb1,0xe8,0x78,0x98,0x83,0x29,0x8f,0x94,0x00,
+0x09,0x89,0x59,0xd8,0x01,0x48,0x9b,0x83,0x29,0x01,0xb8,0x07,0x39,0xa8,0x01,0x05,
+0xbb,0x78,0x90,0x03,0xb0,0x49,0xab,0x28,0xf8,0x9a,0x43,0x28,0xbc,0x02,0xa1,0x71,
+0xb0,0xa0,0x31,0xc9,0x88,0x3a,0x33,0x07,0xba,0xa9,0x3c,0xca,0x95,0x0c,0x23,0xa0,
+0x2d,0x91,0xb8,0x11,0x0a,0x2d,0x23,0x22,0xa8,0x16,0x2f,0xa5,0x08,0xbb,0x10,0x21,
+0x10,0x86,0x8d,0x93,0x38,0x09,0xc0,0x49,0x01,0x80,0xf8,0x2a,0x92,0xc9,0x32,0x11,
+0x1f,0x03,0x03,0xbc,0x09,0x39,0x89,0xa5,0x9e,0x1a,0x01,0x00,0xa1,0x7c,0x90,0xba,
+0x91,0x1d,0x90,0x8a,0xe0,0x62,0x08,0xa8,0x92,0x3a,0x99,0x17,0x28,0xb0,0x8a,0x01,
+0x79,0xb2,0x60,0xa8,0x10,0x12,0x48,0xc9,0xa9,0x13,0x7b,0xb3,0x9a,0x08,0x90,0x09,
+0x11,0x0c,0xcc,0x99,0x84,0x7b,0x98,0x01,0x8e,0x03,0x4a,0x82,0xf9,0x10,0x0b,0x02,
+0x80,0x89,0x80,0x40,0xbc,0x02,0x53,0x2a,0x92,0x11,0x99,0x54,0xa9,0xc4,0x4c,0x9a,
+0x85,0x9a,0x53,0x8b,0xb1,0x12,0x58,0xb2,0x10,0x7b,0xd3,0x89,0x31,0x88,0xad,0x22,
+0x12,0xae,0xa8,0x01,0x0b,0x24,0xa0,0x22,0xf9,0x19,0x28,0xc1,0x0c,0x51,0x93,0x0b,
+0xa1,0x18,0x25,0x89,0xf8,0x33,0x89,0xcb,0x40,0x12,0x80,0x50,0xa9,0x0a,0x13,0xaa,
+0x2a,0xc7,0x2e,0x90,0x89,0x92,0x4a,0xb8,0x48,0xc1,0xaa,0x14,0x18,0x1b,0xf8,0x1b,
+0x15,0x8c,0x10,0x91,0xc0,0x59,0x90,0xa8,0x2a,0x82,0x1a,0x39,0x23,0x37,0x9c,0x81,
+0x99,0x10,0x74,0x81,0x93,0x09,0xab,0x1c,0xfc,0x22,0x88,0x88,0x39,0xfa,0x21,0x88,
+0x88,0x12,0x9c,0x05,0x82,0x2a,0x80,0x82,0x91,0x3c,0x11,0xad,0xbc,0x07,0x1a,0x48,
+0xbb,0x06,0x88,0x08,0xba,0x2a,0xd2,0x38,0x12,0xd9,0x72,0xa0,0xb9,0x23,0x2a,0x9d,
+0x80,0x86,0x39,0xa0,0x28,0x8e,0x94,0x1c,0xa0,0x81,0xa8,0x2d,0xba,0x95,0x63,0x09,
+0x92,0x98,0x99,0x11,0x30,0x0c,0x07,0xc8,0x40,0xab,0x15,0x98,0x90,0x30,0x1a,0x08,
+0xa1,0x11,0x92,0x2f,0xa6,0x09,0xb8,0x29,0xb1,0x32,0xae,0x38,0x91,0x72,0x14,0x8b,
+0x90,0xb2,0x3e,0xa2,0x93,0x1f,0xd2,0x01,0x80,0x00,0x38,0xb3,0x88,0x45,0xa9,0xb8,
+0x03,0x74,0x8b,0xb4,0x09,0x9b,0x42,0xe0,0x80,0x0b,0x12,0x0a,0x13,0x02,0x0f,0xb1,
+0xc2,0x8d,0x13,0x3b,0xb4,0x21,0x0b,0x11,0xdb,0x69,0xc1,0x23,0x0c,0xb8,0x09,0x17,
+0x0a,0x09,0x12,0x19,0xe0,0x89,0x91,0x0f,0x10,0xd1,0x10,0x3a,0xb9,0x53,0xb8,0x82,
+0x4d,0x82,0xc1,0x89,0x4a,0x91,0x05,0x08,0x9c,0x38,0xa5,0x8b,0x01,0x9a,0xc8,0x2c,
+0x87,0x19,0x23,0x8a,0x06,0x0b,0x08,0xcc,0x84,0x5a,0x82,0x89,0xb8,0x38,0x88,0x0b,
+0x95,0x0a,0x11,0x50,0x9a,0x87,0x8a,0x8a,0x19,0x36,0xa2,0x3a,0xf9,0x99,0x09,0x12,
+0x84,0x0b,0x1a,0x00,0xbb,0xe4,0x39,0x80,0x80,0x11,0xc3,0x4b,0x9f,0xc1,0x58,0x01,
+0x8a,0xa1,0x01,0x39,0x03,0xbf,0x10,0xd2,0x89,0x0c,0x90,0x71,0x98,0x11,0x00,0x29,
+0x31,0x82,0xf8,0x30,0x58,0x01,0x8a,0xc2,0x02,0x6b,0x48,0xd0,0x12,0x08,0x9a,0x1c,
+0xc4,0x8c,0x90,0x49,0xb2,0x23,0x3b,0xda,0x94,0x2b,0x17,0x8b,0xc9,0x42,0xc0,0x00,
+0x2b,0xb2,0x08,0x01,0x10,0x20,0x8f,0xf2,0x11,0x09,0x12,0x08,0xa9,0x29,0x94,0x41,
+0xa9,0x00,0x06,0x0e,0x84,0x11,0x1b,0xb2,0x82,0x9b,0x0c,0x00,0x95,0x08,0x9d,0xb0,
+0x60,0xa8,0xb9,0x60,0xa9,0x43,0x99,0xc9,0x42,0x2a,0xd2,0x21,0x10,0x88,0x8b,0xb2,
+0x2e,0xd3,0x29,0x50,0xe3,0x1a,0x82,0x99,0xa9,0x1a,0x21,0x0a,0x05,0x5a,0x99,0xb3,
+0x30,0x58,0xaf,0x21,0xf0,0x29,0x08,0xa1,0x09,0x43,0x89,0x80,0x17,0x2b,0xc2,0x8c,
+0x10,0x02,0x48,0xa9,0xa3,0x4b,0x04,0x88,0x0c,0x82,0x10,0x99,0x84,0x1f,0x80,0x04,
+0x19,0x51,0x21,0xfb,0x82,0x89,0x0b,0x06,0x8a,0x19,0x01,0x91,0x92,0xaf,0x81,0x84,
+0x0b,0x8b,0xa2,0xaa,0xad,0x11,0x05,0x62,0xba,0xba,0x06,0x8c,0x34,0x9b,0x10,0xc2,
+0x0b,0x0c,0x12,0xc0,0x12,0x88,0x82,0x3f,0x12,0xc3,0x19,0x30,0x9d,0x00,0x91,0x18,
+0xa1,0x63,0xbd,0x01,0x15,0x8b,0x99,0xf0,0x59,0x91,0x0a,0x80,0x81,0x60,0x18,0xb9,
+0x25,0xcb,0x51,0x18,0x98,0xc4,0x19,0x49,0xb3,0x8b,0x30,0x80,0xbb,0x23,0xaa,0xdf,
+0x02,0x3a,0x02,0x99,0xb9,0x47,0x2d,0x93,0x08,0x09,0x9d,0x02,0x01,0x2c,0x11,0xe1,
+0x68,0x92,0x8a,0x0c,0x12,0x88,0x01,0x2b,0x18,0xf3,0x80,0x3b,0xae,0xa3,0x0c,0x83,
+0x49,0xe1,0x30,0x28,0xc9,0x84,0x88,0x29,0x1a,0x05,0x80,0x80,0xc9,0x4e,0x92,0xb1,
+0x3b,0x83,0x13,0x2c,0xc1,0x22,0xae,0x80,0xba,0x6b,0xd1,0x08,0x30,0x8a,0xc3,0xa4,
+0x1f,0x08,0xa1,0x10,0x81,0xa0,0x7c,0x90,0x90,0xa0,0x08,0x7a,0xa1,0x92,0x89,0x61,
+0x9a,0x03,0x80,0xa1,0x3f,0xa3,0x40,0x98,0xa0,0x8e,0x90,0x70,0x81,0x00,0x09,0xb8,
+0x2a,0xa1,0x98,0x39,0x46,0xb0,0x8c,0x39,0x92,0x07,0x8c,0x00,0x2a,0x90,0xc6,0x29,
+0x10,0x89,0x93,0xb9,0x37,0xc9,0x48,0xa1,0x0a,0x21,0xa8,0xe1,0x39,0x38,0xd3,0x00,
+0x10,0x3d,0xb2,0x98,0x78,0xba,0xb4,0x4a,0x3b,0xc4,0x20,0x1a,0x13,0x9c,0x83,0xfb,
+0x2a,0x08,0xc1,0x40,0xa1,0x58,0x9a,0xb3,0x18,0x08,0x62,0xc0,0x12,0x00,0xc0,0x1a,
+0x19,0x17,0x9b,0x42,0x02,0x88,0xd1,0x00,0x09,0xda,0x19,0x1c,0x07,0x90,0x28,0x9c,
+0xa9,0x12,0x84,0x3a,0xb1,0x8d,0x08,0xc1,0x0a,0x32,0xa3,0xb0,0xdf,0xa2,0xbf,0x13,
+0x48,0x08,0x21,0xa4,0x40,0xac,0x89,0x22,0xcb,0x83,0x40,0x0c,0x80,0xb6,0x5a,0x09,
+0xa2,0x30,0xaa,0x00,0x24,0x9b,0x28,0x39,0x02,0x96,0x79,0x9a,0x81,0x9e,0x83,0xa0,
+0x2b,0x2f,0xa1,0xc2,0x3a,0x04,0xa8,0x0e,0x12,0xa2,0x10,0x1a,0x9f,0x03,0xa0,0x10,
+0x28,0x78,0x91,0x89,0xba,0x31,0xaf,0x19,0x93,0x8a,0x0f,0x91,0x33,0x08,0x90,0x23,
+0xaf,0x01,0x01,0x07,0x8b,0x09,0x00,0x94,0x51,0x01,0x52,0x9e,0xb3,0x28,0x8b,0xa9,
+0x59,0x01,0xa4,0x2b,0x91,0x0a,0xb2,0x73,0x8d,0xc2,0x20,0x01,0x39,0xaa,0xc3,0x2a,
+0x0a,0xfa,0x2b,0x49,0xb1,0x60,0xc0,0x09,0x9a,0x13,0xab,0x45,0xbb,0x11,0x72,0x9a,
+0x90,0xb9,0x0a,0x7c,0x82,0x91,0x22,0x51,0x90,0xa8,0x34,0x8d,0x81,0x18,0x89,0xe1,
+0x20,0xab,0x89,0xd3,0x10,0x38,0x0b,0xb4,0x43,0x59,0xb1,0x95,0x4a,0x19,0xc4,0x50,
+0x90,0x28,0x09,0xd3,0x40,0x00,0xb1,0x8e,0xa0,0x80,0x0d,0x91,0x20,0x9f,0x81,0x11,
+0x91,0x2b,0xb8,0x15,0x90,0x8a,0x29,0xf9,0x88,0x18,0x22,0x33,0xe8,0x99,0x4c,0xc2,
+0x58,0xa0,0x98,0x19,0x49,0xc3,0x80,0x58,0x20,0xeb,0x81,0x40,0xc0,0x3a,0x91,0xa3,
+0x2e,0x06,0x0a,0xa8,0x09,0xb8,0x35,0x1d,0xa2,0x81,0x09,0x98,0x29,0x93,0x02,0x42,
+0x40,0xc0,0x90,0x1c,0x59,0x95,0x82,0x49,0x2c,0xf1,0x88,0x3b,0x80,0xa0,0x10,0x80,
+0x2e,0x03,0x83,0x6c,0xb2,0x09,0xab,0xa0,0xbd,0x60,0xa1,0x09,0x51,0xb1,0x3a,0xb0,
+0x33,0xf8,0x59,0x02,0xa9,0x62,0xaa,0x13,0x40,0x8a,0x82,0xb0,0x92,0x2f,0x17,0x99,
+0x29,0xd8,0x30,0xb0,0xa3,0x1f,0x92,0x80,0x01,0x80,0x09,0x22,0xd8,0x88,0x09,0x24,
+0xae,0x01,0x0b,0x05,0x0a,0xd8,0x21,0xa2,0x9f,0x80,0x10,0x9a,0xc0,0x1b,0x31,0x29,
+0xd5,0x08,0x38,0xb3,0x8f,0x02,0x82,0xb9,0x31,0x0c,0x18,0xf0,0x08,0x2a,0x01,0xfa,
+0x30,0x89,0x8e,0x93,0x91,0x92,0x0f,0x00,0x12,0x13,0xe9,0x09,0x92,0x4c,0xd8,0x23,
+0xbb,0x20,0x93,0x23,0x12,0x0d,0x84,0x31,0x9b,0xfb,0xa0,0x10,0x20,0x22,0x0b,0xf2,
+0x06,0x8e,0x12,0x88,0x00,0xa8,0x90,0x0c,0x00,0x15,0x8d,0xb1,0x98,0x2b,0x25,0x0a,
+0xb3,0x7a,0xb1,0x83,0x18,0xa9,0x0f,0xa6,0x01,0x18,0x0c,0x80,0x91,0x99,0x42,0x1e,
+0xa3,0x8a,0xb0,0x78,0x89,0x94,0x2b,0x10,0x44,0xcb,0x03,0x43,0x8c,0x90,0xb2,0x28,
+0x41,0xb8,0x0a,0x8e,0xb3,0x58,0x39,0x88,0xb1,0x9b,0x31,0x39,0xfb,0x59,0xa4,0x20,
+0x09,0x27,0xc8,0x11,0x11,0x0a,0x08,0xe2,0x42,0x8d,0x89,0xb2,0x80,0xa9,0x79,0xb8,
+0x13,0x89,0xea,0x40,0x38,0xa1,0x32,0x39,0xbb,0xf3,0x49,0x88,0xa9,0xa6,0x39,0x00,
+0x18,0x84,0xe9,0x20,0x31,0xa8,0xc3,0x8d,0xa1,0x11,0x2a,0xeb,0x12,0x00,0x13,0x9d,
+0x4a,0xb1,0x86,0x0b,0x80,0x6b,0xb6,0x98,0x89,0x3a,0xea,0x14,0x1a,0x8a,0x82,0x2a,
+0x13,0x0b,0x92,0x1c,0xb2,0x18,0x1d,0xa5,0x71,0x09,0xd0,0x60,0x88,0x90,0x20,0x9a,
+0xa1,0x49,0x04,0x8c,0xb1,0xaa,0x89,0x21,0x30,0xee,0x91,0x18,0x42,0xad,0x85,0x90,
+0x19,0x14,0x0b,0x83,0x8d,0x81,0x29,0x03,0x24,0x0c,0xc0,0x61,0xa9,0xb1,0x5b,0xb0,
+0x31,0xb8,0x05,0x8d,0x01,0x11,0xa2,0x1b,0xc5,0x3a,0x9a,0xb5,0x68,0xb8,0x00,0x38,
+0x84,0x00,0xa8,0xaa,0x18,0x31,0xe8,0x51,0xb1,0x04,0x8b,0x9f,0x12,0xa8,0x90,0x4a,
+0x01,0xab,0x47,0x89,0x00,0x10,0xc9,0xdb,0x01,0x28,0xca,0x38,0xb5,0x30,0x91,0x1a,
+0x1c,0xc2,0x99,0x6a,0x10,0x17,0x99,0x8d,0x82,0xa2,0x4c,0x80,0xda,0x20,0x00,0x01,
+0x9e,0x13,0x03,0x9b,0x9a,0x16,0x0b,0xa0,0x81,0x71,0xa0,0xd9,0x30,0xb0,0x20,0x0d,
+0x51,0xc3,0x10,0x3a,0xb1,0x0a,0xb4,0x79,0x09,0xa2,0x63,0xbb,0x85,0x0b,0x08,0x93,
+0x90,0x0a,0x91,0x51,0xa8,0x17,0xac,0x11,0xa0,0xac,0x15,0x88,0x0a,0x11,0x24,0xea,
+0x09,0x01,0x19,0x89,0xf9,0x6a,0x09,0x92,0x21,0xa8,0x38,0x20,0x09,0xf9,0x18,0x38,
+0x89,0xc6,0x38,0x28,0x89,0x86,0x8a,0x21,0x89,0xb9,0x26,0x1a,0xab,0xc3,0x1d,0x3b,
+0x87,0x2c,0xa8,0x39,0x84,0x01,0x22,0x8f,0xa1,0x19,0x83,0xab,0x68,0xb9,0xa2,0x38,
+0xbe,0x10,0x23,0x14,0x1c,0x06,0xb9,0x99,0x30,0x9c,0xd8,0x25,0x8c,0x09,0x85,0x29,
+0xa8,0xa9,0x71,0xb2,0x1b,0x0a,0xa2,0x9b,0x92,0x0e,0x03,0x52,0xdb,0x02,0x08,0x48,
+0xd8,0x3a,0x80,0xb9,0x16,0x0e,0x92,0x12,0xa9,0x98,0x18,0x41,0x08,0x07,0x89,0x0b,
+0x20,0x95,0xb9,0x22,0x0f,0xa0,0x91,0x01,0x49,0x92,0x02,0x9d,0x86,0x1a,0x11,0x49,
+0xe2,0x81,0x09,0x49,0xe8,0x82,0x19,0x1a,0xbb,0x85,0x2a,0xc0,0x31,0x39,0x80,0xf0,
+0x0a,0x19,0x02,0x68,0x9b,0x86,0x09,0x89,0x82,0x39,0xc1,0x12,0x08,0x12,0xb5,0x1d,
+0x95,0x29,0x01,0xb1,0xb0,0x79,0xd1,0x0c,0x03,0x1b,0x8a,0x85,0xb9,0x0d,0x90,0x31,
+0x1a,0x17,0x2a,0x98,0xa2,0x2d,0x01,0x26,0x98,0x20,0x29,0xf2,0x10,0x99,0x28,0xa9,
+0xa1,0x23,0xa4,0x8f,0x22,0x90,0xcd,0x03,0x18,0x3d,0xc1,0x80,0x8c,0xa8,0x28,0x29,
+0xa2,0x15,0x8f,0x93,0x51,0x89,0x91,0x40,0xb1,0x5a,0xc0,0x08,0xb2,0x50,0x2b,0xd1,
+0x92,0x20,0x39,0x39,0xd4,0x00,0x93,0x2c,0xa9,0x50,0xb0,0x09,0x0a,0xb3,0x9e,0xbb,
+0x67,0x08,0x0a,0xa2,0x0a,0xb8,0x91,0x2b,0x04,0x82,0xbf,0x92,0x79,0xa0,0x10,0x82,
+0x21,0x9b,0x8c,0x53,0x84,0xea,0x39,0xa1,0x03,0x0f,0x03,0x28,0xba,0xb8,0x41,0x2b,
+0xc4,0xaa,0x72,0x81,0x98,0x01,0x32,0xac,0xa0,0x33,0xc9,0x38,0x4c,0xa7,0x0a,0x39,
+0x01,0xf9,0x18,0x0d,0x82,0x10,0x1a,0x90,0x1a,0x10,0xa0,0x4c,0xa1,0x01,0xaf,0x18,
+0x01,0xc6,0x49,0x0d,0xb2,0x92,0x49,0xa9,0x92,0x38,0x8a,0xb2,0x78,0x82,0x9b,0x0b,
+0x82,0xbf,0x94,0x7b,0x90,0x92,0x20,0x8a,0x22,0x95,0x7a,0xc8,0x10,0x08,0x09,0x91,
+0xc1,0x4b,0xb0,0x22,0x18,0xa9,0x4a,0x87,0x01,0x0a,0x1b,0xd1,0x80,0x24,0x3a,0xbc,
+0x04,0x20,0x94,0x38,0xac,0x23,0xf0,0x1b,0x08,0xd9,0x31,0xc8,0x48,0x09,0xf3,0x29,
+0x0a,0xc8,0x33,0x8b,0x12,0xb2,0x70,0x01,0x92,0xaa,0x4a,0x01,0x50,0xb5,0x19,0x29,
+0xf9,0x21,0x89,0xa3,0x1c,0xb3,0x5a,0x0a,0xa4,0x89,0xda,0x1a,0x00,0x84,0xbc,0x1b,
+0x71,0xa2,0x83,0x7c,0xb0,0x80,0x11,0x19,0xa2,0x38,0x21,0xf0,0x10,0x68,0xaa,0x13,
+0xab,0x20,0xbb,0x25,0x0b,0x07,0x98,0x2c,0xa3,0x81,0x9c,0x9a,0x58,0xa2,0x02,0xb8,
+0x4e,0xc0,0x19,0xd2,0x21,0x29,0x9c,0x91,0xb0,0x61,0xca,0x68,0xa1,0xa8,0x48,0x12,
+0x9a,0xa1,0x89,0xc2,0x69,0x09,0xc3,0x89,0x61,0x98,0xb0,0x1c,0x21,0xb8,0x90,0x4d,
+0x11,0xc0,0x30,0x09,0x8b,0x87,0x00,0x80,0x2e,0xc8,0x01,0xa0,0x2c,0x12,0xd9,0x19,
+0x01,0x51,0xa4,0x4b,0x82,0x09,0xa8,0x31,0x8c,0xe1,0x39,0x05,0x1c,0x01,0xa8,0xa1,
+0x50,0x8a,0xfa,0x1c,0x90,0x32,0x12,0xb1,0x31,0xb8,0x18,0x00,0x87,0x2f,0xb0,0x08,
+0x22,0xdb,0x49,0xf2,0x3b,0x80,0x88,0x01,0x18,0x82,0x10,0x0f,0xa4,0x28,0x09,0x92,
+0x58,0x9a,0xa0,0x11,0x30,0x0a,0xa9,0x09,0x37,0x3e,0x90,0xd5,0x3a,0x80,0xaa,0xb2,
+0x33,0x79,0x98,0x14,0xf9,0x48,0xa0,0x99,0x91,0x0b,0x05,0x29,0xc1,0x29,0x92,0x8b,
+0x32,0xa0,0xa2,0xbf,0x33,0xea,0x32,0x0b,0xf8,0x60,0x09,0x80,0x81,0x3a,0x89,0xba,
+0x85,0x28,0x8c,0x02,0x19,0xe8,0x53,0x18,0x81,0x86,0x88,0x19,0xfa,0x10,0x80,0x38,
+0xd8,0x08,0x89,0x84,0x19,0x19,0x29,0x06,0x58,0xc1,0x28,0xc0,0x8f,0x81,0x10,0x12,
+0xb0,0x50,0x08,0xa3,0x92,0x0b,0x8e,0x89,0x81,0xbc,0x08,0x18,0x3b,0x26,0x90,0x95,
+0x38,0x8a,0x88,0xf8,0x19,0x30,0x19,0x87,0xa1,0x8b,0x9c,0xc3,0xa8,0x7a,0x90,0x21,
+0x24,0xbb,0xa2,0x8f,0x22,0xb0,0xa0,0x98,0x29,0x27,0x19,0xd2,0x49,0x99,0x40,0xa2,
+0xa0,0x3a,0x68,0x92,0xb0,0x34,0x3b,0xe9,0x05,0x18,0x98,0xa9,0x18,0xa3,0x1f,0xb1,
+0x41,0x32,0x0b,0xb0,0xb1,0x0d,0xbb,0xd2,0x5a,0x82,0x9a,0x1b,0x5a,0x27,0xba,0x29,
+0xa9,0x18,0xf8,0x0a,0xc8,0x40,0x20,0x88,0x07,0xa8,0x3a,0xa0,0xa2,0x20,0xbc,0x9d,
+0x09,0xc8,0x33,0x90,0x39,0x0f,0x25,0xe3,0x20,0x2b,0x90,0xa4,0x2b,0x42,0xb9,0x50,
+0xc8,0x0a,0xb0,0x52,0xa8,0x39,0xb3,0xae,0x84,0x0c,0x82,0xbd,0x14,0x4b,0xc1,0x00,
+0x58,0x98,0xa1,0x19,0x00,0x11,0x29,0x97,0x2b,0x99,0xa1,0x71,0x11,0xb8,0x50,0x98,
+0x28,0x11,0x0a,0x94,0xf9,0x4b,0xb0,0x2c,0x93,0x83,0x1e,0x10,0x98,0x90,0x11,0x36,
+0x98,0x9e,0x12,0xb1,0x0a,0x60,0x99,0xb0,0xa9,0x48,0x00,0x88,0x42,0x8d,0x91,0xb5,
+0x7b,0x08,0xa0,0xa1,0x4a,0x02,0x19,0x09,0x87,0x28,0x8a,0x10,0x04,0xbc,0x51,0x8a,
+0xf2,0x39,0xc8,0x3a,0x06,0x1a,0x81,0x82,0x82,0x8e,0x85,0x09,0x09,0xa0,0x99,0xbb,
+0x8a,0xbb,0x22,0x35,0x49,0x07,0x18,0x12,0xda,0x9a,0x39,0x90,0xdb,0x73,0xba,0xb2,
+0x29,0xab,0x92,0x18,0x46,0xbb,0x21,0xa0,0x0a,0x94,0x14,0x8f,0x83,0x49,0x00,0xb1,
+0x1a,0xc1,0x0d,0xb8,0x01,0x3b,0xfc,0x32,0x82,0x4b,0xc0,0x44,0xa0,0x82,0x39,0x03,
+0xb1,0x8a,0xa9,0xb9,0x6d,0x03,0xd1,0x30,0x1b,0x81,0x4b,0xb1,0x04,0x0d,0xcc,0x38,
+0x08,0xd0,0x82,0x3a,0xac,0x02,0x01,0x06,0x0a,0x28,0xc2,0x8b,0xda,0x53,0x1a,0x84,
+0xcc,0x38,0x9a,0x14,0x11,0x43,0x19,0xb4,0x9f,0x90,0x81,0x33,0x8d,0xa0,0x16,0x0c,
+0x80,0x8a,0x32,0x24,0x99,0x92,0x99,0x43,0x2c,0xa5,0xaf,0x82,0x29,0x98,0xbb,0x90,
+0x95,0x58,0x1a,0x90,0x96,0x1a,0x8a,0x12,0x04,0xda,0x38,0x58,0x02,0xd0,0x89,0x02,
+0x0d,0xa3,0x09,0x08,0x18,0xe2,0x1b,0xd0,0x28,0x81,0x83,0x09,0xcf,0x14,0x88,0x8a,
+0x24,0x30,0xa2,0xa0,0xf2,0x1e,0x01,0x80,0x08,0x09,0x05,0x2a,0x98,0xc0,0x13,0x04,
+0x0e,0xa0,0xa8,0x27,0x00,0x98,0x81,0x99,0x23,0x02,0x41,0x98,0xcf,0x32,0x00,0x8c,
+0x90,0xa2,0x0f,0x98,0x81,0xb1,0x1c,0x38,0x04,0x04,0x1a,0x8b,0xea,0x58,0xa9,0x86,
+0x1c,0x98,0x10,0xac,0x22,0xc1,0x21,0x1e,0x84,0x81,0x9a,0x48,0x82,0xa3,0x8d,0x08,
+0x89,0x22,0xa1,0x9c,0x3b,0xe0,0x83,0x4a,0x19,0xdb,0x58,0xa3,0x29,0x20,0x9f,0x16,
+0x00,0x9a,0x03,0x8b,0x92,0x1d,0x10,0x14,0xc8,0x02,0x3c,0xcc,0xa2,0x19,0x01,0x8e,
+0x69,0x92,0x02,0x0c,0xa9,0x00,0x11,0x29,0x91,0x29,0xb8,0x05,0x9a,0x18,0x77,0x99,
+0xc8,0x18,0x49,0x01,0xd9,0x0a,0x9a,0x15,0x11,0x8b,0xcb,0x34,0x99,0x52,0x88,0x08,
+0xa8,0x8c,0x15,0xa0,0x79,0xd0,0x00,0x82,0x89,0x99,0x01,0x93,0x8a,0x99,0x21,0x1d,
+0x21,0xfb,0x0a,0x71,0x0b,0xb0,0x91,0x89,0x53,0x39,0xd8,0xb8,0x31,0x3a,0x97,0x39,
+0xd0,0x14,0x9b,0x10,0x98,0x50,0x01,0x90,0x8a,0x7b,0xd0,0x12,0x01,0x0f,0x11,0xa1,
+0x24,0x0a,0xb8,0x00,0x09,0x8a,0xa3,0x11,0x6c,0x12,0x81,0x93,0xa1,0x02,0xbf,0x79,
+0xa6,0x00,0x98,0x18,0x2c,0xd2,0x03,0x99,0x1b,0xad,0xa4,0xa8,0x0d,0x40,0xa8,0xa2,
+0x79,0x80,0x01,0x99,0x92,0x10,0x0c,0x8f,0xa4,0x09,0x2a,0x10,0x91,0xa8,0x62,0x1b,
+0xf2,0x00,0x81,0x0c,0x14,0x10,0x00,0x12,0xa1,0x0c,0x71,0xaa,0xb2,0xa0,0x52,0x8d,
+0xb8,0x31,0xa1,0x1b,0x52,0xb3,0x3b,0x9a,0xa7,0x1a,0x30,0xac,0x84,0x89,0x45,0xac,
+0x04,0xa8,0x8c,0xa3,0x00,0x11,0x5a,0xc2,0x48,0xca,0x98,0x28,0x3a,0x85,0x20,0xd2,
+0x9b,0x40,0xa9,0x06,0x28,0xaa,0x91,0xa8,0x52,0x9f,0x93,0x08,0xab,0x8a,0x84,0x09,
+0x82,0x79,0xa0,0x90,0x53,0x29,0x82,0xe0,0x01,0x19,0x1f,0xa4,0x28,0x48,0xc1,0x03,
+0xad,0x09,0x02,0x18,0x08,0x9c,0x06,0x88,0x2b,0xc2,0x28,0x31,0x09,0xb8,0x0d,0x02,
+0x94,0x4c,0xb0,0x9a,0x27,0x0a,0x10,0x98,0xa7,0x1c,0x90,0x11,0x80,0xa0,0x33,0x0f,
+0xc2,0x21,0x38,0x18,0xb9,0x98,0xf3,0x5a,0xab,0xa0,0x58,0x84,0x28,0x39,0xe8,0x99,
+0x24,0x09,0x1a,0x07,0x08,0x90,0x0c,0x03,0xca,0x2a,0x01,0x02,0x68,0xa8,0x08,0xac,
+0x34,0xba,0xb9,0x1a,0xc0,0x1f,0x93,0x1c,0xb9,0x86,0x3b,0x01,0xb4,0x24,0x30,0xbe,
+0xa3,0x42,0x8b,0x89,0x84,0x10,0x00,0x0b,0x86,0x53,0x8c,0x10,0x8a,0xa9,0x51,0x29,
+0xf9,0x93,0x48,0xab,0x95,0x0a,0x99,0x10,0x00,0x9a,0x97,0x8b,0x43,0xda,0x02,0x2b,
+0x81,0x28,0xda,0x24,0x2e,0xc2,0x90,0x99,0x31,0x90,0x81,0x31,0xc4,0x45,0x9a,0x2a,
+0x90,0xfb,0x81,0x5b,0x08,0x95,0x88,0x2b,0xe0,0x81,0x40,0x09,0xa4,0x3b,0x98,0xc2,
+0x00,0x1c,0x09,0xf5,0x21,0x3a,0x98,0x98,0x80,0x3a,0xa8,0x2b,0x87,0x01,0x1e,0xa2,
+0x39,0x9a,0xa6,0x2e,0xa0,0x92,0x40,0x8a,0x81,0x00,0x80,0x8b,0x51,0x0a,0x05,0xc0,
+0x3c,0xb0,0x14,0x09,0x09,0x15,0x19,0xb9,0x01,0x20,0x50,0xfb,0x28,0x22,0x91,0x9c,
+0x90,0x20,0xb9,0x5d,0xa8,0x52,0x9a,0x03,0x2f,0xb0,0x44,0x9b,0x84,0x1b,0xa8,0x99,
+0x03,0x00,0xbf,0x33,0x37,0x11,0xba,0xd8,0x89,0x9d,0x93,0x88,0x72,0x92,0xb2,0x9d,
+0x49,0x04,0x99,0x9a,0x99,0x51,0x81,0x90,0x02,0x2e,0xa5,0x9b,0x39,0xa4,0x33,0xaa,
+0x9b,0x31,0xd1,0x12,0x2d,0x05,0x9a,0x19,0xb1,0x84,0x2a,0xaf,0x90,0xa2,0x3a,0xad,
+0x32,0xe2,0x19,0x80,0x31,0x34,0xb8,0x94,0xbf,0x30,0x11,0xc0,0x31,0xb8,0x3b,0x90,
+0x97,0x2c,0x90,0x18,0x02,0x39,0x94,0x39,0x95,0x99,0x21,0xfa,0x3d,0x33,0x14,0xab,
+0xe9,0x0b,0x69,0xb3,0x89,0x19,0xcc,0x00,0x09,0x17,0x08,0x98,0xc2,0x8d,0x01,0x41,
+0x82,0x9a,0x0b,0xd3,0x21,0x2c,0x84,0x10,0x0b,0xd0,0xaa,0x47,0x80,0x90,0x9a,0x00,
+0x80,0x29,0x40,0xc4,0x09,0x8b,0x00,0x36,0x28,0xca,0xa8,0x0d,0x82,0x44,0x90,0x01,
+0x99,0xae,0x20,0x80,0xc8,0x02,0x30,0xda,0x39,0xc1,0x09,0x25,0x0a,0x0c,0xa1,0x63,
+0x83,0x2d,0x80,0xc0,0x11,0x09,0x2c,0xb8,0x28,0x62,0x08,0x10,0x90,0x68,0x84,0x99,
+0x09,0x98,0x5c,0xb2,0x18,0xd2,0x3d,0x80,0x98,0x94,0xa8,0x19,0x0f,0x42,0xa8,0x11,
+0x99,0x89,0x14,0x2a,0xf1,0x03,0x1d,0x92,0x9b,0x32,0x9b,0x0e,0xa1,0xda,0x22,0x4a,
+0xb0,0x8a,0xb7,0x4c,0xa0,0x20,0x20,0xd9,0x11,0x89,0x62,0x90,0x84,0x88,0x1b,0xa2,
+0x02,0x68,0x9a,0x97,0x3b,0x1a,0xd3,0x00,0x99,0x9a,0x9b,0x13,0x10,0xba,0x65,0x1a,
+0x9f,0x94,0x29,0x28,0xa1,0x08,0x12,0xa9,0x28,0x37,0x8e,0x80,0x15,0x88,0x39,0x99,
+0xa1,0x8b,0xf2,0x0c,0x11,0xa9,0xa8,0x00,0x61,0xa9,0x81,0x19,0x58,0xb6,0x1c,0x90,
+0x0a,0x07,0xab,0x19,0x11,0xb1,0x90,0x3b,0x01,0x9c,0x01,0xa9,0x1c,0x15,0x10,0x8f,
+0x86,0x30,0x80,0x98,0x2a,0x29,0xa2,0x27,0xaf,0x00,0x49,0xb0,0x05,0x89,0x08,0xb8,
+0xa1,0x7a,0xa2,0x11,0x38,0xa9,0xf8,0x12,0x9a,0x0b,0x04,0x32,0xda,0x63,0xa8,0x81,
+0xc9,0x30,0x9d,0x84,0x20,0x98,0x11,0xc2,0x3a,0xa6,0x02,0x8c,0x33,0x92,0x13,0xa9,
+0xff,0x01,0x88,0x90,0x18,0x20,0xd0,0x8a,0x15,0xbb,0x51,0x89,0x90,0xa3,0x11,0x3c,
+0x1c,0x93,0x82,0xf8,0x2b,0x8a,0x13,0x82,0xbe,0x23,0x8b,0x8e,0xa3,0x2a,0xe9,0x01,
+0x0a,0x9e,0x05,0x00,0x81,0x01,0x19,0x8b,0x12,0x07,0xc2,0x2d,0xa0,0x03,0x08,0xc9,
+0x23,0x48,0x01,0xae,0x02,0x05,0x0d,0xa8,0x83,0x48,0xc0,0xb9,0x32,0x98,0x68,0x91,
+0x05,0x09,0x42,0x88,0xd9,0x18,0x03,0x1d,0xb0,0x41,0x9b,0x14,0x11,0x02,0x8f,0xb1,
+0x21,0x19,0x49,0xa1,0xf2,0x5a,0xa0,0xb9,0x28,0xa1,0x10,0x21,0x1f,0x91,0xb4,0x0d,
+0x02,0x98,0xc8,0x63,0xaa,0x23,0x09,0x90,0xd9,0x41,0x19,0xa3,0x80,0x09,0x81,0x9f,
+0x31,0x43,0x12,0xfa,0x2b,0xbb,0x02,0xa5,0x6b,0x99,0xc0,0x81,0x5b,0xba,0x80,0x72,
+0x88,0xa0,0x2a,0x93,0x2d,0x80,0xc1,0x21,0x9c,0x13,0x1c,0x81,0x07,0x2a,0xd9,0x10,
+0x20,0xe8,0x08,0x88,0x09,0x06,0xab,0x01,0x10,0x21,0xc8,0x09,0xb1,0x70,0x00,0x1c,
+0xca,0x84,0x4d,0x92,0x01,0x1a,0xa1,0x9a,0x07,0x1d,0x90,0x91,0x38,0x90,0x01,0xb8,
+0x99,0x41,0xdd,0x2a,0xa0,0x06,0x0d,0x80,0x89,0x07,0x89,0x88,0x80,0x91,0x19,0xa1,
+0x82,0x8b,0x52,0x28,0xf0,0x2b,0x83,0x91,0x9f,0x07,0x28,0x08,0xb9,0x18,0x92,0x2c,
+0x50,0xc0,0x04,0x19,0x08,0xa1,0x34,0xbb,0x11,0xb8,0x32,0x8f,0x82,0x9d,0x33,0x12,
+0x9f,0x13,0xb1,0x38,0x2b,0xf9,0xa0,0x18,0x10,0x0a,0xb9,0x95,0x36,0xaf,0x41,0x90,
+0x18,0x82,0x3c,0xa8,0xb1,0x89,0x29,0x3c,0xa3,0xe3,0x49,0x9b,0x23,0xb8,0x1d,0x94,
+0x9a,0x29,0x32,0x85,0x59,0xac,0x13,0x9b,0x3c,0xa5,0x10,0x29,0xb0,0x90,0x34,0x47,
+0x98,0x1b,0xab,0x82,0x11,0xf8,0x18,0x60,0x09,0x95,0x89,0xbb,0x39,0x20,0x16,0xa1,
+0x0f,0xa4,0x38,0x9c,0x00,0xd8,0x00,0x39,0xab,0x04,0x02,0x19,0x24,0x0c,0x96,0x19,
+0x81,0x41,0x1c,0x93,0xc0,0x12,0x9f,0xb2,0x22,0x0c,0x12,0x81,0xb8,0x1b,0x6a,0xf1,
+0x08,0x89,0xa1,0x10,0x0e,0xc1,0x22,0x18,0x4a,0xc1,0x24,0x8b,0x10,0xb8,0x21,0x50,
+0xbb,0x05,0x9b,0x08,0x27,0x0b,0xab,0x82,0x53,0xa9,0xda,0x19,0x02,0x19,0x95,0x9c,
+0x82,0xc2,0x0f,0x81,0x92,0x0a,0x78,0xb3,0x1c,0xb3,0x18,0x29,0xa1,0xba,0xa9,0x0a,
+0x3a,0x73,0x97,0x00,0x28,0x8a,0x22,0xd4,0x89,0x8b,0x1b,0x85,0x93,0x1d,0x03,0xad,
+0x94,0x13,0x2f,0xb2,0x03,0x1c,0x18,0x94,0xa4,0x3c,0x9b,0x86,0x11,0x0a,0x91,0x59,
+0xc0,0x19,0x80,0x58,0x9a,0xc1,0x04,0x2c,0x80,0xa8,0x81,0x50,0xb0,0x32,0x9b,0x20,
+0x24,0xde,0x02,0x39,0xaf,0x12,0x93,0x1b,0x38,0xfa,0x10,0x28,0xa0,0x99,0x3a,0xf3,
+0x69,0xa0,0x18,0x81,0x98,0x89,0x14,0x20,0xb8,0x98,0x12,0x8f,0x14,0x08,0xab,0xc8,
+0x3a,0x73,0xb3,0x1d,0xa2,0xb0,0x70,0x10,0xb0,0x09,0x23,0xaa,0xaf,0x11,0x02,0x8b,
+0x17,0x1b,0xb1,0x73,0xa8,0x2a,0xa2,0x1a,0xad,0x84,0x18,0x1b,0xd1,0x24,0x0c,0x88,
+0xe3,0x4b,0xa3,0x49,0xc2,0x59,0x90,0x18,0xa2,0x2a,0xac,0x85,0x0a,0xa1,0x12,0x9e,
+0x21,0x81,0x94,0x1c,0x8b,0x93,0x5a,0xd2,0x19,0x28,0x91,0x29,0x88,0xe4,0x19,0x38,
+0xb8,0x90,0x28,0xf3,0x7a,0x98,0x80,0x1a,0x10,0x84,0x0b,0x01,0xa8,0x28,0x9e,0x83,
+0xa8,0x79,0x93,0x81,0xb5,0x5a,0x99,0x92,0xab,0x4a,0x81,0x21,0x71,0xa0,0x13,0x9f,
+0xa2,0x94,0x3d,0x1c,0xa7,0x11,0x1f,0xa0,0x81,0x20,0x1b,0x01,0xb1,0x29,0x9b,0x01,
+0xbb,0x87,0x19,0x10,0xd9,0x00,0x58,0xb2,0x0a,0xa8,0x51,0x81,0xca,0x12,0x0d,0x90,
+0xa5,0x28,0x09,0xa9,0x04,0x98,0xbe,0x54,0x03,0x8f,0x90,0x32,0xa9,0x59,0x03,0xba,
+0x10,0x80,0x09,0x02,0xa0,0x2a,0x03,0x16,0x1d,0xe9,0x20,0xb0,0x3a,0x22,0xbc,0x25,
+0x08,0x93,0x48,0x29,0xf2,0x39,0x9a,0x0a,0x13,0xbf,0x09,0x05,0x1a,0x49,0xc9,0x16,
+0xab,0x3a,0xa8,0xa7,0x30,0x2c,0xe1,0x82,0x3b,0x99,0x93,0x18,0x02,0x8f,0x11,0xa0,
+0x92,0x39,0xaa,0x15,0x88,0x9b,0x34,0xa9,0x12,0xaf,0xa9,0x90,0x61,0x94,0x9a,0x5a,
+0x90,0xb3,0x08,0x0f,0x42,0xa2,0xcb,0x73,0x89,0xa1,0x89,0x30,0x93,0x9c,0xb1,0x16,
+0x3c,0xc1,0xb8,0x2a,0xa9,0x18,0x42,0x82,0x50,0x12,0xa1,0x9a,0x8b,0xa4,0x42,0xf9,
+0x0a,0x41,0xd2,0x18,0x80,0x23,0x9d,0x80,0x20,0xc1,0x15,0x1a,0x8b,0xb4,0x52,0xa1,
+0x19,0xab,0x2e,0x27,0x88,0x18,0x00,0xa0,0x42,0x9b,0x04,0x11,0xae,0x91,0xc0,0x8a,
+0x38,0x13,0x22,0xf8,0x88,0x49,0xe8,0x88,0x00,0x8a,0x49,0x93,0x38,0x80,0xad,0x31,
+0xbd,0x48,0xf2,0x20,0x39,0xc0,0x9b,0x05,0x88,0x9b,0x05,0x8b,0x34,0xd0,0x3a,0xa0,
+0x12,0x09,0xca,0x48,0x11,0xda,0x30,0x08,0x20,0xdf,0x64,0xb8,0x0a,0x38,0x32,0xf9,
+0x3d,0x81,0x88,0x18,0xc8,0x52,0xb8,0x49,0xa0,0x1b,0x94,0x0c,0x11,0x0b,0x12,0x9a,
+0x3a,0xb2,0x39,0x14,0x0d,0x86,0x99,0x0a,0x12,0xc8,0x20,0x80,0x1b,0x27,0xb8,0x13,
+0x0f,0x08,0x92,0x1e,0xa3,0x10,0x59,0xab,0x92,0x91,0x19,0x88,0x48,0x91,0xbb,0x24,
+0x23,0xaf,0xc3,0xab,0xa4,0x0b,0x11,0x78,0xe3,0x38,0xb9,0x01,0x32,0x9d,0x80,0x30,
+0xb1,0x0c,0xa8,0x20,0xaa,0x91,0x7f,0xb3,0x8a,0x31,0xdb,0x32,0xb0,0x50,0x29,0xe1,
+0x32,0x88,0x91,0x5b,0x0a,0x94,0xd8,0x41,0xb9,0x01,0xac,0xa5,0x4b,0x20,0xb4,0x89,
+0x1c,0x01,0xa8,0x30,0x61,0xdb,0x21,0x32,0x11,0x03,0xaf,0x10,0x33,0xba,0x0b,0x93,
+0x0f,0x25,0x98,0x09,0xc2,0x0a,0x28,0xd2,0x42,0xba,0xac,0xb0,0x78,0x80,0xc5,0x20,
+0x8b,0x22,0x9d,0x14,0x98,0x1a,0x93,0xa3,0x20,0xad,0x01,0x9a,0x55,0xc0,0x28,0x80,
+0x4b,0xa2,0xb8,0x6c,0x80,0x90,0x2b,0x07,0x0a,0x80,0x98,0xcb,0x28,0x8c,0x81,0x80,
+0x33,0x29,0x07,0x3e,0xc1,0x01,0x1b,0x12,0xd1,0x5a,0x83,0x8c,0x00,0x03,0x08,0xd8,
+0x10,0x2b,0x81,0xa1,0x99,0x9b,0x7b,0xf2,0x81,0x90,0x1d,0x03,0x12,0xc9,0x08,0x1e,
+0x81,0x84,0x09,0xb8,0x59,0x82,0x1a,0xf1,0x5a,0x82,0x09,0x9a,0xb2,0xc1,0x5f,0xa1,
+0x01,0x28,0x19,0xa1,0x20,0x8b,0xba,0xf8,0x99,0x58,0xa1,0x18,0x00,0x32,0xf8,0x00,
+0x78,0x98,0x83,0x58,0xa9,0xba,0x73,0xe1,0x29,0xa2,0x3b,0xc4,0x5b,0xb3,0x1d,0x83,
+0x9c,0x24,0xba,0x31,0xa0,0x2a,0xa2,0x10,0x03,0x8e,0x12,0xb1,0xd0,0x7a,0xb0,0xb4,
+0x1f,0x22,0xb8,0x21,0x1f,0xb4,0x5a,0xa8,0x18,0x01,0x09,0x89,0x12,0xaa,0x20,0x81,
+0x2a,0x93,0xfa,0x69,0xb8,0x19,0x22,0xcb,0x01,0x18,0x8b,0xb4,0x0a,0x32,0xaa,0xfb,
+0x6b,0x03,0x0a,0x13,0x89,0x0b,0x10,0xc0,0x0b,0xb6,0x79,0xb1,0x81,0x18,0x02,0x89,
+0x19,0xe9,0x16,0x0c,0x8a,0xb3,0x89,0x63,0xab,0x24,0xa8,0x80,0x21,0x32,0x0f,0x83,
+0x99,0x91,0x68,0xaa,0x33,0xf9,0x20,0x20,0x89,0xd1,0x72,0xc9,0x20,0xb2,0x4b,0x08,
+0xf2,0x29,0x10,0xbb,0x86,0x20,0x8c,0x22,0xda,0x28,0xa2,0x1d,0x13,0xa1,0x8c,0x12,
+0x91,0x9b,0x03,0xba,0x70,0xa4,0x6a,0x90,0x98,0x81,0x99,0x10,0x8c,0x01,0xa3,0x3b,
+0x33,0xfb,0x20,0xad,0x63,0x02,0xaa,0x31,0x8e,0x93,0x19,0xac,0x95,0x09,0x2a,0x97,
+0x39,0xd8,0x38,0xaa,0x13,0xac,0x83,0x80,0x18,0x9f,0x18,0x57,0xcb,0x39,0xa1,0x53,
+0xcc,0x41,0xa1,0x0a,0x83,0xa9,0x38,0xa3,0x8c,0x06,0x09,0x98,0x18,0x14,0xcb,0x10,
+0xa2,0x2b,0x93,0x89,0xd0,0x5b,0x83,0x8c,0x02,0xa8,0x20,0x8a,0x12,0x0c,0x86,0xdb,
+0x28,0x40,0x80,0xd2,0x39,0x19,0xd2,0x81,0x1c,0x83,0x1b,0x93,0x32,0xbc,0x60,0x99,
+0x81,0xab,0xb8,0x68,0x32,0xa1,0xd8,0x6b,0xf9,0x31,0x18,0x90,0xa8,0x2c,0x58,0xa1,
+0x81,0x50,0x0a,0x9a,0xb4,0x59,0x18,0x03,0xad,0x81,0x2a,0xf3,0x78,0xa8,0x08,0x82,
+0xa9,0x4a,0x11,0xf9,0x18,0x20,0x99,0x48,0xb1,0x1a,0x63,0xdb,0x20,0x21,0xca,0x01,
+0x11,0xac,0x12,0x33,0xa2,0x0b,0x5a,0xd9,0x34,0x9b,0xa3,0x2d,0xb0,0x31,0x90,0x9b,
+0x53,0xbd,0x93,0x8c,0x30,0x20,0x90,0x27,0xc9,0x6c,0xb3,0x09,0xab,0x03,0x73,0xaa,
+0x21,0xc0,0x38,0x91,0x0e,0x24,0xca,0x11,0x9b,0x53,0xd1,0x1b,0xa3,0x29,0xa8,0x0d,
+0xa4,0x00,0x3a,0xfa,0x22,0x80,0x8c,0x01,0x1a,0x05,0x8a,0x81,0x89,0xc2,0x3e,0x98,
+0xa4,0x28,0x2a,0xa3,0x29,0x8e,0x85,0x0c,0x28,0xa4,0x12,0x8e,0x81,0x20,0xb8,0x84,
+0x1a,0x39,0xa1,0xb1,0x47,0x89,0x99,0x08,0x80,0xbb,0x27,0x0b,0x59,0xa1,0xd2,0x8a,
+0x38,0x08,0x98,0x94,0x33,0xa0,0xdf,0x01,0xa2,0x69,0x82,0x80,0x01,0x9d,0x03,0xaf,
+0x20,0x08,0x90,0x0a,0xb0,0x36,0x31,0x98,0xff,0x32,0xa8,0x99,0x59,0x04,0xb9,0x8c,
+0x63,0x90,0xac,0x21,0x08,0x88,0x89,0x01,0x34,0x8c,0x93,0x19,0xab,0x27,0x10,0xa9,
+0x58,0x91,0x8a,0x0a,0x35,0xb1,0x0e,0xa8,0x82,0x20,0x90,0xaa,0xba,0x53,0xd0,0x33,
+0x8d,0x11,0x83,0x29,0x80,0x1a,0xf3,0x0c,0x4a,0xa1,0xc3,0x69,0x90,0x8a,0xb0,0x03,
+0x2a,0x91,0x9f,0x05,0x0a,0xa3,0x4a,0x31,0x90,0x82,0xae,0x1b,0x85,0xbe,0x20,0x19,
+0x14,0xa0,0x2a,0x84,0xdb,0x29,0x11,0x81,0x88,0xfc,0x41,0xba,0x03,0x78,0xb1,0x09,
+0x30,0x98,0x85,0x88,0x2d,0xb3,0x41,0xa0,0x0b,0xf8,0x0a,0x31,0x97,0x8b,0x88,0x13,
+0x88,0x1a,0xa3,0x2c,0x14,0xa2,0x01,0x7b,0x80,0xc2,0x8b,0x0e,0xb3,0x28,0x92,0x0c,
+0xb0,0x10,0xa2,0xab,0x7c,0xc3,0x51,0xba,0x01,0x02,0x8a,0xbf,0x16,0x19,0x89,0xb3,
+0x1a,0x1b,0x08,0x27,0x98,0x0a,0x10,0xc1,0xa0,0x8b,0x61,0x00,0x31,0xd4,0x6b,0x92,
+0x08,0x98,0x20,0x0c,0xf9,0x41,0xb8,0x39,0xc8,0x90,0x91,0x48,0x08,0x29,0xc9,0x43,
+0x89,0x08,0xbc,0xb8,0x78,0xa1,0x19,0x00,0xba,0x2d,0xa3,0x39,0x89,0x9d,0x36,0xa8,
+0x74,0xc0,0x29,0xa3,0x1c,0x05,0x89,0x22,0x19,0x90,0x90,0x58,0x90,0x8a,0x04,0x33,
+0xbf,0x22,0x95,0x0d,0x00,0xb2,0x89,0x30,0x38,0xf8,0x00,0x39,0x9b,0xb9,0xa7,0x8b,
+0x2a,0x10,0xd0,0x12,0x08,0x39,0x41,0xfa,0x00,0x39,0x80,0x48,0xd1,0x8b,0x50,0x04,
+0x9c,0x94,0x48,0xc0,0x8b,0x04,0x0b,0x15,0xa8,0xba,0x68,0x94,0x18,0x8a,0x80,0xca,
+0x42,0xa8,0x8c,0x94,0x30,0x99,0x12,0xba,0x95,0x5b,0xb0,0x00,0xa8,0x42,0x2a,0xf1,
+0x11,0x09,0x13,0x0a,0xfa,0x21,0x10,0x00,0x29,0xb4,0x10,0xf3,0x1e,0x02,0x31,0xa1,
+0xfa,0x38,0x11,0xc0,0x10,0x80,0x98,0xc9,0x71,0x89,0xa8,0x06,0x2c,0xb1,0x1c,0x94,
+0x89,0x89,0x31,0xc2,0x09,0x80,0x1b,0xf8,0x20,0x0b,0x69,0xa2,0xb0,0x1b,0x1f,0x96,
+0x0a,0x13,0xa0,0xa1,0x1d,0x14,0x82,0xac,0x28,0x30,0xb0,0x9a,0x0b,0x79,0x93,0x8c,
+0xc8,0x20,0x36,0x9a,0x98,0xb1,0x0a,0x7a,0x21,0xf3,0x19,0x30,0xb9,0xbc,0x23,0xb9,
+0x78,0x01,0x89,0xc0,0x10,0x88,0x02,0x80,0x9e,0x34,0x91,0x8c,0x31,0xb3,0xbc,0x30,
+0xaa,0x30,0x47,0xca,0x59,0xb0,0x00,0x22,0x8c,0x15,0x98,0x1c,0x08,0x87,0x98,0x2c,
+0xa2,0x00,0x31,0xeb,0x39,0xa8,0x08,0x90,0xb9,0x5a,0xba,0xa5,0x1e,0x84,0x10,0xaa,
+0x84,0x10,0x4a,0x81,0xd2,0x10,0x10,0x0f,0xa4,0x31,0xab,0x20,0x80,0x53,0x8b,0xb3,
+0x89,0x78,0xe1,0x28,0x8a,0x81,0x83,0x11,0x19,0xad,0xb1,0x82,0x92,0x7c,0x91,0xf2,
+0x11,0x9c,0x81,0x89,0x85,0x1a,0x02,0xca,0x23,0x0b,0x18,0x18,0xf2,0x51,0x88,0x0c,
+0x82,0x82,0x3b,0xa2,0x38,0xe9,0xda,0x22,0x0b,0x91,0xb1,0x11,0xb9,0x59,0xab,0x77,
+0x01,0x01,0x29,0xa9,0xad,0x24,0x2a,0x9b,0xa3,0x11,0xcc,0x0a,0x92,0x9a,0xa4,0x8b,
+0x68,0xa1,0x78,0x88,0xb1,0x70,0x91,0x8b,0x84,0x98,0x32,0x0f,0x03,0xb8,0x48,0xca,
+0x81,0x89,0x28,0xfb,0x29,0x18,0x10,0xc8,0x4a,0x92,0x0b,0x42,0xa5,0x31,0x1b,0xf1,
+0x00,0x8a,0x2b,0x86,0x90,0x2b,0x92,0x98,0x24,0x3c,0x97,0xac,0x93,0x0a,0x18,0x93,
+0xb1,0x01,0xcf,0x04,0x2c,0x93,0x12,0x89,0xa9,0xda,0x23,0x1a,0xab,0x37,0x0d,0xb8,
+0x26,0xa9,0x2b,0xb8,0x03,0xa9,0x68,0x92,0x32,0xf8,0x38,0x09,0xa1,0x40,0x9a,0x15,
+0xa1,0x30,0x9f,0x87,0x89,0x20,0x99,0xd1,0x80,0x5a,0x8a,0x93,0x20,0x0c,0x91,0x09,
+0x1b,0x06,0xab,0x31,0x00,0x1b,0xe9,0x95,0x20,0x9a,0x29,0xa5,0x21,0xba,0x72,0xd1,
+0x82,0xab,0x38,0xb8,0xa5,0x82,0x3c,0xb9,0x07,0x99,0xab,0x1a,0x11,0xfa,0x81,0x1b,
+0x28,0xf1,0x61,0x99,0x00,0x30,0x00,0xa1,0x69,0x00,0xb9,0x20,0xb9,0x3a,0x70,0xb2,
+0x33,0x1a,0x29,0xb0,0x40,0x28,0xb3,0xae,0x41,0x13,0x1f,0x01,0x13,0x23,0x2e,0x06,
+0x0d,0xc2,0x09,0x09,0x89,0xa3,0x2b,0xba,0x45,0xaa,0x0d,0x83,0xc2,0x5b,0x98,0xa8,
+0x08,0x99,0x40,0x05,0x4a,0x23,0xa9,0x81,0xb1,0x61,0x0d,0x92,0xa8,0x91,0x61,0x90,
+0x21,0x83,0xa3,0x9f,0xc8,0x18,0x81,0xa1,0xae,0x35,0x0a,0xbb,0xe9,0x42,0x21,0x89,
+0xa1,0x84,0x1f,0x11,0x91,0x10,0x1a,0xa0,0x1b,0xf8,0x10,0x2a,0x9c,0x05,0x83,0x1a,
+0x00,0x24,0x9a,0xe1,0x21,0x0b,0xba,0xc7,0x40,0x39,0xa1,0xc8,0x31,0x30,0xad,0x91,
+0xd8,0x20,0xb2,0x1f,0x91,0xd9,0x18,0x09,0x22,0xfb,0x18,0x19,0x82,0xd2,0x5b,0x99,
+0x24,0x98,0x84,0x1a,0xab,0xa4,0x28,0x0a,0xb8,0x17,0x9c,0x12,0x20,0xc9,0x20,0x21,
+0x0d,0x10,0x34,0xab,0x3c,0xd3,0x38,0xb0,0x21,0xbf,0x22,0xa8,0x80,0x69,0x09,0xc3,
+0x0a,0x18,0x0e,0xa4,0x29,0x63,0xc9,0x83,0x9c,0x01,0x50,0xa0,0x02,0x19,0x39,0xe1,
+0x18,0x80,0x8c,0xa2,0x1a,0x8e,0x81,0x81,0x15,0x0b,0xa9,0x05,0x71,0x9a,0x93,0x19,
+0x3a,0xeb,0x2a,0x15,0x80,0x4a,0x40,0xcb,0x05,0x09,0x88,0x20,0xf1,0x49,0x09,0xa0,
+0x93,0x78,0x90,0xf0,0x01,0x21,0x0d,0x89,0xb5,0x80,0x28,0x8a,0x98,0xb2,0x30,0xa3,
+0x29,0x9f,0x93,0x23,0x38,0x98,0xca,0x22,0x0d,0x80,0x27,0x8c,0x91,0x09,0x8a,0x14,
+0x04,0x9d,0x00,0x90,0x80,0x28,0x40,0xfa,0x81,0x33,0x3f,0xb0,0x02,0x18,0x88,0x9b,
+0x88,0x13,0xf0,0x0e,0x22,0x98,0xb1,0x2b,0x50,0x98,0x87,0x09,0x8c,0x91,0x11,0x4b,
+0xc8,0x15,0x8b,0x08,0x91,0x18,0xae,0x33,0x19,0xf3,0x31,0x0e,0x92,0x81,0x2a,0x91,
+0xbb,0xd3,0x72,0xa9,0xa4,0x29,0x8b,0x92,0x15,0x00,0x0d,0x89,0xd2,0xa1,0x5b,0x8a,
+0x13,0xb1,0x00,0x78,0x00,0xb0,0x2a,0x18,0x17,0xaa,0x20,0x10,0x80,0xd0,0x81,0x1e,
+0x83,0xba,0x12,0x19,0x15,0x2b,0xb2,0xc8,0xa1,0x2d,0x00,0xb9,0xd2,0x73,0x9b,0xa3,
+0x83,0x49,0x9a,0x19,0xa6,0x11,0x0a,0x08,0x25,0xc2,0xaf,0x81,0x83,0x8b,0x9f,0x13,
+0xa8,0x21,0xd3,0x5b,0x98,0x93,0x28,0xbb,0x24,0x92,0x0d,0x91,0x61,0x08,0x84,0x08,
+0x8d,0x91,0xa9,0x37,0xb1,0x0f,0x82,0x11,0xa0,0x49,0xa8,0x11,0x90,0x08,0x50,0xb0,
+0x23,0x0a,0xf3,0x40,0x9c,0x08,0xa1,0x8a,0x19,0xda,0x9c,0x14,0x99,0x8b,0x2b,0xa7,
+0x4b,0x0a,0x95,0xaa,0x52,0x81,0x90,0x0d,0x04,0x88,0x80,0x69,0xc1,0x18,0x10,0x0a,
+0x80,0x90,0xdb,0x79,0x93,0xa0,0x31,0x38,0xf1,0x00,0x00,0x8c,0x85,0x01,0x10,0x90,
+0x9b,0x33,0xa8,0x81,0x6b,0xc1,0x0b,0xd1,0x29,0xd8,0x29,0xa1,0x32,0x0f,0x81,0xa8,
+0xb0,0x9f,0xa9,0xb3,0x4a,0x48,0xe9,0x13,0xb0,0x4a,0x20,0x81,0x94,0x0c,0x09,0xa5,
+0x2a,0xca,0x4a,0x96,0x1a,0x69,0xa0,0x98,0x10,0x1b,0x92,0x8c,0x37,0xa8,0x8d,0x81,
+0x23,0x0c,0x92,0xb0,0x30,0xa3,0x8f,0x92,0x8a,0x73,0xa0,0x88,0x33,0xb8,0x0c,0x32,
+0xd1,0x90,0x72,0x99,0xd0,0x10,0x13,0x98,0x88,0x11,0xa9,0x0f,0x94,0x20,0xb9,0x02,
+0x3d,0xb8,0x07,0x0a,0x09,0x9a,0x01,0xd5,0x3a,0x08,0x13,0xd8,0x8f,0x92,0xab,0x22,
+0x88,0xa8,0x13,0x1b,0x0c,0xfb,0x93,0x58,0xaa,0x03,0x1f,0xb0,0x12,0x30,0x09,0x88,
+0x06,0x6a,0x11,0x10,0xb0,0x20,0x4b,0xe2,0x89,0x48,0x81,0xd9,0x80,0x90,0x48,0xd0,
+0x28,0x1b,0xc8,0x34,0x80,0x92,0x7b,0xb8,0xa1,0x31,0x0f,0x82,0x99,0x1b,0x00,0xd3,
+0x18,0x12,0xbb,0x62,0x88,0xa5,0xa8,0x5c,0x81,0x82,0x18,0x82,0xcb,0x39,0x17,0xba,
+0xa1,0x7b,0xa2,0xa1,0x52,0xcb,0x11,0xa9,0x10,0x18,0xae,0x27,0x9a,0x48,0xc2,0x3a,
+0xb2,0x8c,0x21,0xa8,0x18,0xb9,0x7c,0xa2,0xa8,0x21,0x1c,0x32,0xd1,0x11,0x1b,0x29,
+0xc5,0x28,0x20,0x99,0x00,0xb0,0x0f,0xd2,0x21,0x8b,0x89,0x85,0x01,0x28,0x49,0xe1,
+0xa0,0x50,0x99,0x94,0x8a,0x49,0x82,0x99,0xb4,0x2d,0x01,0xb9,0x03,0x90,0x3c,0xd3,
+0x08,0xbb,0x32,0xb4,0x0f,0xa1,0x82,0x80,0x1b,0xa2,0x3c,0x40,0x07,0x3b,0xba,0xc5,
+0x09,0x31,0x1b,0xe0,0xb0,0x59,0x22,0xeb,0x40,0xaa,0x05,0x30,0xa0,0xb9,0xa8,0x5d,
+0xc0,0x10,0x18,0x28,0xc2,0x9c,0xa2,0x49,0x01,0x01,0x91,0x99,0xbb,0x7a,0xa8,0x93,
+0x94,0x5c,0x18,0x97,0x3a,0xa0,0x38,0x13,0xa9,0x28,0xc2,0xa0,0x2e,0x92,0x2c,0x97,
+0x8a,0x39,0x90,0x41,0xe9,0x30,0xa2,0x68,0x90,0xd1,0x11,0x2a,0x98,0xd1,0x28,0x90,
+0x0b,0xb4,0x98,0x73,0xbb,0x12,0x4a,0x02,0xd3,0x29,0x8d,0xa0,0x28,0xc0,0x43,0x8e,
+0x02,0x81,0x2c,0xc2,0x18,0x31,0x8b,0xb9,0xb0,0x23,0x74,0x8c,0xb2,0x82,0x1a,0x8d,
+0x01,0x84,0x2b,0x17,0x02,0x2d,0xc0,0x80,0x8a,0x79,0x91,0xa1,0x21,0x99,0x9a,0x52,
+0xc1,0x28,0x3b,0xe1,0x89,0x41,0xa0,0xa8,0x18,0x0d,0x23,0xf8,0x18,0x19,0xc1,0x10,
+0x9e,0x13,0x99,0x01,0x8f,0x02,0x12,0x80,0x8b,0x38,0xce,0x13,0x33,0xeb,0x19,0x10,
+0x99,0x10,0x28,0xb2,0x8b,0x9d,0x38,0x16,0x81,0x0d,0x9f,0x13,0x28,0x01,0x1b,0x96,
+0x58,0x88,0x93,0x9a,0x08,0x3a,0x93,0xc8,0x1a,0x9b,0x12,0xbb,0x02,0x73,0x61,0x99,
+0x27,0x08,0x9a,0x28,0x94,0xd9,0x91,0x1c,0x90,0x94,0x8c,0x10,0x96,0x08,0x0d,0x95,
+0x8b,0x93,0xb8,0x6a,0x9a,0x91,0x01,0x50,0x1b,0xf1,0x20,0x20,0x18,0x90,0x81,0x2a,
+0xa0,0x0d,0x11,0x97,0x8a,0x2b,0xa9,0x06,0x80,0x39,0x82,0xaf,0x83,0x5b,0x80,0xb0,
+0x18,0xe8,0x31,0x1a,0xba,0x26,0xa0,0x98,0x1d,0x32,0x01,0xb0,0x81,0xaf,0xc3,0x28,
+0x33,0xda,0x85,0x2a,0x8a,0x00,0xa2,0x16,0x2c,0x10,0x10,0xfd,0x11,0x1a,0xa1,0x99,
+0x29,0x05,0x01,0xa9,0x06,0x28,0xba,0x92,0x18,0xa3,0x7b,0x12,0xf3,0x0c,0x02,0x49,
+0x01,0xd0,0x33,0x9d,0x88,0x82,0x02,0x8d,0x98,0xa3,0xf9,0x68,0x09,0x81,0x91,0x01,
+0x02,0x9b,0x01,0xb8,0x8d,0x22,0x1a,0x9a,0x27,0x18,0xb1,0xb8,0x92,0x71,0x87,0xe8,
+0x98,0x18,0x14,0x98,0x00,0xa2,0x00,0x9d,0xa1,0x31,0x71,0xc0,0x32,0x19,0xaa,0x83,
+0x8d,0x80,0xd9,0x63,0x8a,0x03,0x98,0x2b,0xac,0xf4,0x2a,0x20,0xfa,0x73,0x93,0x83,
+0x0c,0x04,0xef,0x81,0x1b,0x98,0x21,0xb1,0x10,0x08,0x99,0xba,0x12,0x12,0x48,0x14,
+0x45,0xa2,0x48,0xb9,0x22,0xad,0x04,0x0b,0x14,0x4a,0x95,0x1a,0x91,0x30,0xec,0x20,
+0x80,0x40,0xa1,0x01,0x90,0x2b,0xf8,0x18,0xb9,0x69,0xa0,0x80,0x28,0x00,0xab,0xa1,
+0xb1,0x2c,0xe9,0x03,0x09,0x51,0xc8,0x10,0xc0,0x78,0xbb,0x93,0x6b,0x91,0x39,0xb1,
+0x1a,0x12,0x1b,0xf0,0x7a,0x81,0x00,0xad,0x25,0xaa,0x01,0x8a,0x86,0x0d,0x82,0x08,
+0x99,0x31,0xcb,0xc2,0x69,0x88,0xaa,0x21,0x82,0x1b,0x11,0xd3,0x6a,0x03,0x88,0x90,
+0x10,0x00,0x8f,0xc3,0x6a,0xa1,0x1a,0x12,0xa9,0x03,0x2b,0xf0,0x3b,0x07,0x88,0x19,
+0x05,0x9b,0x13,0x09,0xfa,0x7a,0xb1,0x2a,0x81,0x02,0xab,0x30,0xa2,0x8d,0x14,0x89,
+0x8c,0x27,0x9d,0x10,0x88,0x88,0x08,0x11,0xad,0x24,0x89,0xa1,0x68,0xa9,0x01,0x09,
+0xa9,0x89,0x35,0xb1,0x0e,0x22,0xc0,0x4a,0x89,0x84,0x1a,0x03,0x28,0xcd,0x34,0x90,
+0x8c,0x22,0x81,0xf9,0x38,0x98,0x18,0x89,0x85,0x20,0x8d,0x10,0x83,0x19,0x98,0x52,
+0xf8,0x9a,0x3a,0xa4,0x19,0x49,0x86,0xba,0x29,0xa1,0x0a,0xea,0x41,0x98,0x31,0x18,
+0x21,0xf8,0x1c,0x90,0x88,0x9a,0x46,0x99,0x01,0x32,0xe1,0x9d,0x30,0xb1,0xab,0x71,
+0x81,0xa1,0x31,0xbc,0x08,0x12,0xbf,0x31,0x10,0x82,0x2d,0xa6,0x19,0x9a,0x10,0x82,
+0x89,0x38,0x57,0xa9,0x99,0x03,0xab,0x8b,0x15,0xa9,0x9b,0x37,0xa8,0x02,0x49,0xc2,
+0x2b,0xe3,0x2a,0x86,0x2a,0x83,0x09,0x94,0x2b,0xc1,0x1b,0xa0,0x09,0xca,0x0c,0xda,
+0x44,0x98,0x0a,0x44,0x11,0x15,0x08,0x89,0x22,0xf9,0xac,0xaa,0xa8,0x1b,0x01,0x88,
+0x37,0x20,0xfc,0x99,0x21,0xaa,0x98,0x41,0xa2,0x5a,0xa1,0x28,0x88,0x16,0x9a,0x01,
+0x43,0x08,0x18,0x10,0x41,0x83,0x18,0x16,0x49,0xb1,0x31,0x04,0xaf,0x44,0xc1,0x1b,
+0x84,0x28,0xc9,0x50,0xc1,0x29,0x80,0x9b,0xc9,0x33,0xbe,0x42,0x08,0x90,0x29,0xc8,
+0x19,0x0a,0x03,0x9d,0x35,0x81,0xac,0x8d,0x02,0xcb,0x39,0x89,0xa4,0x51,0x80,0xab,
+0xb1,0x7c,0x92,0x36,0x99,0x80,0x18,0x87,0xbf,0x02,0x19,0xa2,0x0c,0x12,0x09,0xb1,
+0x19,0x38,0x84,0x9a,0xba,0x59,0x97,0x1a,0x98,0x10,0x92,0x28,0xbc,0x54,0x18,0x92,
+0x18,0x24,0x0c,0x83,0xaf,0x21,0x13,0xb0,0x2d,0x83,0x39,0x92,0x14,0xaf,0x8a,0x30,
+0xf2,0x1b,0x22,0x89,0x91,0x88,0xc8,0x9d,0x89,0x31,0x93,0x1a,0x44,0xa9,0x92,0x0c,
+0xb8,0x3b,0xb4,0x7a,0xa2,0x89,0x25,0x9c,0x01,0x9b,0xc1,0x4a,0x12,0x00,0x73,0x03,
+0x14,0xaf,0x08,0x19,0x05,0x8a,0x99,0x41,0x91,0x91,0x8f,0x22,0x1a,0xc3,0x58,0xca,
+0x30,0xa0,0x70,0x90,0x80,0x9a,0x81,0x8a,0x04,0x2a,0xc2,0x5b,0x02,0xc8,0x19,0x80,
+0x90,0x68,0xb1,0x29,0x35,0x98,0x9c,0x86,0x29,0xfb,0x3a,0xa1,0x4a,0x81,0x01,0xad,
+0x32,0x88,0xea,0x12,0x88,0x8a,0xcb,0x26,0xab,0x00,0x13,0x19,0xc1,0x80,0xbd,0x1b,
+0x16,0x28,0xc8,0x48,0x81,0xbb,0x28,0x95,0x8a,0x30,0x82,0x94,0x2a,0x26,0xae,0x24,
+0x89,0x12,0x0a,0x00,0x03,0x02,0xad,0x31,0xb0,0x48,0xa1,0x9d,0x21,0x39,0x06,0x22,
+0xa8,0x0f,0x83,0x9b,0xbd,0x32,0xa0,0x9a,0x54,0x98,0x8a,0x04,0xac,0xa8,0x19,0xa1,
+0x4a,0x81,0x80,0x3b,0xf9,0x30,0xb0,0x9b,0x25,0xcf,0xb8,0x50,0x14,0xa9,0xa8,0x18,
+0x82,0x18,0xf9,0x30,0x82,0x28,0x90,0xbd,0x32,0xcc,0x61,0x93,0x21,0xcc,0x10,0x10,
+0x13,0x8d,0x08,0x22,0x05,0x9d,0xaa,0x01,0x14,0x90,0x18,0x9c,0x22,0x23,0xcd,0x28,
+0x81,0x9b,0x69,0x16,0xa1,0x3b,0x83,0xda,0x1b,0x92,0x1b,0x81,0x53,0xc8,0xd8,0x3a,
+0x82,0xd8,0x2b,0x92,0x3a,0xa4,0x71,0xa8,0xc9,0x08,0xc1,0x9f,0x31,0x80,0x88,0xb1,
+0x29,0xa2,0x1a,0xb9,0xca,0x92,0x70,0xc0,0xa1,0x29,0x05,0x9a,0x82,0x49,0xa1,0x56,
+0xb8,0x0a,0x20,0x20,0x04,0xa9,0x9a,0x04,0x2c,0x13,0x67,0x90,0x29,0xa1,0x08,0xbc,
+0xb0,0x2c,0x84,0x31,0x13,0x1b,0xd3,0xc8,0x5b,0x91,0x80,0x2b,0x36,0xa4,0x38,0xaa,
+0x10,0x62,0xc0,0x38,0x04,0xb9,0x1b,0xb3,0x1b,0xbb,0x37,0x29,0x80,0xbb,0xfc,0x3c,
+0x80,0x10,0x48,0xa4,0xae,0x31,0x81,0xb8,0x50,0x91,0x1a,0xa1,0x11,0x8e,0x24,0xaa,
+0x48,0x14,0xb0,0x8c,0x11,0x08,0x91,0x8a,0x13,0x7b,0x97,0x2a,0xca,0x33,0xa9,0x63,
+0x88,0x08,0x22,0xb5,0x3a,0xac,0x10,0x18,0x17,0x01,0x4b,0xb4,0xaa,0x00,0xba,0x78,
+0xa2,0x1b,0x1a,0x85,0x98,0x1d,0x83,0xab,0x25,0x88,0xac,0x63,0x90,0xa9,0x33,0xf1,
+0x8b,0x11,0xba,0x99,0x21,0x10,0xac,0x92,0xcf,0x88,0x08,0x18,0xca,0xa8,0xba,0x4b,
+0xa2,0x92,0xaf,0xa2,0x8d,0xb8,0x80,0xad,0xb1,0x0e,0x91,0x98,0x9b,0x10,0x9f,0xb0,
+0x89,0xbb,0x9f,0x26,0xc9,0x18,0x81,0x9b,0x04,0xac,0xc9,0x48,0x90,0x0a,0x80,0x68,
+0x82,0x0a,0x01,0xa9,0xa1,0xbb,0xaa,0x0f,0x06,0x93,0x2a,0x08,0xc3,0x9b,0x16,0xbb,
+0x78,0x16,0xa8,0x89,0x10,0xfb,0x0a,0x10,0x02,0x72,0x82,0x19,0x01,0xba,0x8d,0x10,
+0xd9,0x0b,0x98,0x20,0x35,0x08,0x98,0x19,0xf9,0xcb,0x69,0xa1,0x73,0x42,0x34,0x34,
+0x22,0x02,0x10,0xb9,0xac,0x09,0x51,0x33,0x36,0x34,0x21,0x21,0x01,0x31,0x13,0x81,
+0xbb,0xbb,0xee,0xac,0xa9,0xa9,0x00,0xb9,0xba,0xac,0xcc,0xea,0x9a,0xba,0xcd,0xda,
+0xba,0x9b,0x9b,0x99,0x00,0x11,0x09,0x99,0xea,0xc9,0xac,0xac,0x98,0x80,0x18,0x21,
+0x26,0x11,0x35,0x22,0x31,0x44,0x91,0x41,0x13,0x02,0x71,0x14,0x20,0x32,0x22,0x21,
+0x23,0x02,0x23,0x20,0xe2,0x8a,0xdb,0x88,0x8d,0x32,0x31,0x16,0x11,0x8a,0xda,0xdc,
+0xba,0xac,0xb9,0xaa,0xb9,0x9c,0x8a,0xc8,0x8a,0x98,0xaa,0xfb,0x9e,0xab,0x9a,0xaa,
+0xdb,0xa9,0xeb,0x88,0xaa,0x81,0x88,0x21,0x93,0xca,0xce,0x8a,0xba,0x10,0x99,0x61,
+0x03,0x51,0x43,0x23,0x23,0x62,0x33,0x00,0x53,0x12,0x20,0x80,0x74,0x21,0x13,0x64,
+0x02,0x00,0x88,0x18,0xe9,0x28,0xb9,0x1a,0xb1,0x59,0xb2,0x1c,0x87,0xad,0xab,0xba,
+0xbd,0xab,0x88,0xeb,0x8a,0xd8,0x9c,0x09,0x02,0x31,0x67,0x34,0x32,0x35,0x23,0x11,
+0x01,0xda,0xbb,0x88,0xba,0x70,0x24,0x42,0x53,0x12,0x11,0x01,0x88,0xcc,0x89,0xba,
+0xad,0x88,0xb9,0x99,0x88,0xa9,0x89,0x81,0xfb,0xad,0xb9,0xbf,0xaa,0xbb,0xbb,0xbb,
+0xa9,0x88,0x30,0x26,0x21,0x44,0x81,0x99,0xb9,0xcd,0xbb,0x9a,0x8a,0x53,0x36,0x24,
+0x44,0x22,0x12,0x21,0x01,0x00,0x01,0x20,0x52,0x24,0x41,0x24,0x34,0x22,0x32,0x82,
+0xcb,0xaa,0xcd,0x8a,0x08,0xa0,0x9b,0x98,0xb8,0x8c,0x81,0x8b,0xd1,0xee,0xac,0xca,
+0xbd,0xbb,0xa9,0xab,0x18,0x98,0x08,0x21,0xaa,0xeb,0xab,0xcb,0xcc,0x99,0xca,0x1a,
+0x82,0x38,0x36,0x32,0x11,0x34,0x10,0x12,0x22,0x11,0x73,0x13,0x22,0x56,0x34,0x43,
+0x43,0x23,0x23,0x01,0x22,0x01,0x30,0x22,0x42,0x57,0x11,0x12,0x11,0x91,0x98,0x8a,
+0xbb,0x8a,0x89,0xca,0xa9,0xc2,0xff,0x9c,0xc9,0x9b,0xca,0x9a,0xb9,0xcb,0x89,0xcc,
+0x89,0xeb,0x9a,0xab,0x99,0xcb,0x08,0x80,0xaa,0x08,0xb9,0xcc,0x09,0xdf,0xab,0xb9,
+0xdb,0x9a,0xb9,0x88,0xb8,0x8c,0x8b,0x24,0x01,0x51,0x92,0x98,0x11,0xce,0x72,0x57,
+0x23,0x45,0x24,0x23,0x12,0x90,0xb9,0xbc,0xbb,0x8a,0x52,0x35,0x45,0x22,0x22,0x01,
+0x98,0xaa,0x9c,0xba,0xbc,0xcb,0xbb,0xaa,0x9b,0x18,0x13,0x21,0xfa,0xcc,0xcb,0xbc,
+0xcb,0xaa,0xab,0xcb,0xab,0xaa,0x8a,0x21,0x52,0x44,0x12,0x01,0xa8,0xab,0xac,0xbc,
+0x99,0x10,0x43,0x55,0x45,0x43,0x33,0x43,0x12,0x10,0x80,0x99,0xaa,0x18,0x11,0x53,
+0x46,0x22,0x43,0x12,0x81,0x89,0xca,0xad,0xab,0xbc,0xab,0x99,0x89,0x18,0x22,0x81,
+0x00,0xfb,0xbf,0xca,0xeb,0xaa,0xab,0xaa,0x9a,0x89,0x10,0x22,0x33,0x21,0x02,0xdd,
+0xda,0xac,0xab,0x99,0x18,0x52,0x43,0x32,0x34,0x23,0x43,0x33,0x80,0x00,0xa8,0xac,
+0x29,0x55,0x34,0x36,0x24,0x22,0x23,0x01,0x80,0x98,0xab,0x99,0x88,0x62,0x34,0x35,
+0x43,0x23,0x80,0x99,0xea,0xaa,0x9b,0x9a,0x2a,0x91,0x90,0xad,0xdc,0xbc,0xab,0xba,
+0xad,0xa8,0xcd,0xaa,0xea,0xab,0xa9,0xab,0x89,0x11,0xb9,0x9b,0x91,0xde,0x9a,0x90,
+0xfb,0xaa,0xa9,0xbd,0x9b,0xb8,0xba,0xfb,0x8c,0xda,0x99,0x11,0x12,0x52,0x24,0x81,
+0xa8,0x0a,0xda,0x71,0x47,0x53,0x44,0x23,0x12,0x80,0xdb,0xcc,0x9a,0x88,0x31,0x55,
+0x22,0x12,0x01,0x99,0xa9,0x89,0x98,0xb9,0xcc,0xcc,0xab,0x99,0x21,0x53,0x23,0x80,
+0xdb,0xbc,0xbc,0xaa,0x8a,0x89,0xa9,0xbc,0xbb,0xab,0x20,0x34,0x36,0x24,0x12,0x00,
+0xb8,0xbc,0xbd,0xac,0x9a,0x41,0x54,0x53,0x33,0x24,0x12,0x11,0x08,0x98,0x88,0xa9,
+0x9a,0x09,0x43,0x73,0x27,0x22,0x11,0x80,0xca,0xcb,0xbb,0xcb,0x9a,0xa9,0x99,0x99,
+0x10,0x80,0x43,0x04,0xa9,0xec,0xcc,0xbc,0x9b,0xbb,0x9a,0x18,0x89,0x30,0x45,0x32,
+0x34,0x03,0xcb,0xbc,0xcc,0xab,0x10,0x42,0x42,0x33,0x12,0x11,0x52,0x11,0x33,0x11,
+0xc0,0xdb,0x9a,0x89,0x21,0x46,0x34,0x33,0x43,0x33,0x21,0x81,0xba,0xdd,0xbb,0xab,
+0x0a,0x63,0x43,0x35,0x23,0x22,0x90,0xca,0xdc,0xab,0x9a,0x0a,0x42,0x42,0x12,0x80,
+0xca,0xdb,0x9b,0xb9,0xaa,0xda,0xcb,0xbc,0xa9,0x08,0x00,0x22,0xb8,0xcc,0xcb,0x8a,
+0x09,0x01,0x08,0xba,0xcf,0xda,0xae,0x8a,0xb9,0x8b,0x10,0x99,0x08,0xbe,0xcc,0x9a,
+0x88,0x29,0x47,0x03,0x00,0x01,0x08,0x75,0x36,0x45,0x43,0x13,0x00,0xb9,0xbe,0xac,
+0x09,0x10,0x54,0x24,0x12,0x10,0x80,0x9a,0x8a,0x98,0xb9,0xbc,0xbd,0xad,0x99,0x20,
+0x32,0x35,0x02,0xb9,0xbe,0xad,0xab,0x9a,0x89,0x89,0x88,0xa9,0x9a,0x28,0x34,0x44,
+0x33,0x22,0x82,0xca,0xcb,0xbc,0xcb,0x9a,0x20,0x47,0x44,0x43,0x33,0x22,0x11,0x80,
+0x89,0x98,0xcb,0x8b,0x98,0x50,0x35,0x26,0x32,0x03,0xa8,0xdb,0xac,0xcc,0xaa,0x99,
+0x9a,0x08,0x88,0x28,0x32,0x81,0x20,0xea,0xdc,0xac,0xeb,0x9a,0x98,0x98,0x28,0x02,
+0x20,0x53,0x22,0x31,0x14,0xc9,0xbd,0xb9,0xac,0x09,0x44,0x33,0x53,0x11,0x01,0x10,
+0x80,0x08,0x00,0xa0,0x9d,0xab,0x00,0x42,0x44,0x44,0x34,0x22,0x33,0x12,0x82,0xba,
+0xdf,0xaa,0xab,0x09,0x31,0x56,0x34,0x32,0x11,0x80,0xca,0xcb,0xbc,0xa9,0x09,0x23,
+0x43,0x34,0x14,0x99,0xb9,0xbb,0xcd,0xad,0xbb,0xaa,0xa9,0x09,0x41,0x12,0x13,0xc9,
+0xcb,0xfb,0x9b,0xa9,0x8b,0x12,0x0a,0xea,0x9a,0xdf,0xa9,0xab,0x99,0x99,0xb1,0xab,
+0xb8,0xdc,0x09,0x44,0x14,0x52,0x23,0x51,0x54,0x46,0x42,0x23,0x01,0xd9,0xcc,0xab,
+0x8a,0x30,0x55,0x33,0x23,0x01,0xa9,0xcb,0x99,0x98,0x88,0xb8,0xeb,0xac,0x8a,0x28,
+0x35,0x43,0x02,0xc9,0xeb,0xbb,0xab,0x89,0x00,0x81,0x88,0xaa,0x9b,0x40,0x34,0x36,
+0x13,0x90,0xa9,0xbc,0xaa,0x8b,0x88,0x00,0x31,0x57,0x44,0x34,0x34,0x12,0x01,0x98,
+0xaa,0x8b,0x88,0x08,0x21,0x12,0x44,0x46,0x33,0x22,0x81,0xed,0xbb,0xbd,0xab,0x99,
+0x88,0x08,0x10,0x00,0x20,0x02,0x28,0xe8,0xdc,0xbc,0xbc,0xab,0x99,0x08,0x21,0x01,
+0x22,0x45,0x35,0x43,0x13,0xb0,0xbd,0xcc,0x9b,0x18,0x63,0x32,0x43,0x01,0x89,0x08,
+0x88,0x20,0x23,0xb8,0xbc,0xbe,0x0a,0x20,0x45,0x34,0x22,0x81,0x90,0xaa,0x89,0x00,
+0x32,0x25,0xa9,0xac,0xca,0x1a,0x65,0x43,0x43,0x02,0xb0,0xcc,0xbb,0x9a,0x28,0x44,
+0x22,0x81,0xfb,0xbb,0xcb,0x8a,0x12,0x11,0x11,0xca,0xcd,0xab,0x9a,0x09,0x32,0x91,
+0x9e,0xc8,0x9e,0x10,0x31,0x14,0x80,0xb8,0xcf,0xbc,0xa9,0xa9,0x10,0x20,0x02,0x9b,
+0xb2,0xbf,0x89,0x30,0x26,0x42,0x47,0x22,0x44,0x35,0x13,0x02,0xb8,0xdd,0xad,0x89,
+0x08,0x52,0x44,0x12,0x11,0x88,0xb9,0xab,0x89,0xa9,0x99,0xc9,0xbd,0x9a,0x28,0x53,
+0x34,0x13,0xb8,0xce,0xcb,0xbb,0x89,0x18,0x11,0x80,0xa8,0xaa,0x09,0x44,0x53,0x24,
+0x01,0xa8,0xbb,0xcb,0x99,0x18,0x11,0x53,0x53,0x63,0x43,0x34,0x32,0x11,0x80,0xaa,
+0xbb,0x9b,0x88,0x42,0x53,0x33,0x53,0x24,0x01,0x99,0xcd,0xbd,0xad,0xab,0x9a,0x08,
+0x10,0x08,0x81,0x99,0x80,0x8a,0xb9,0xee,0xab,0xdc,0x8a,0x88,0x18,0x80,0x15,0x9a,
+0x40,0x33,0x52,0x24,0x83,0xcb,0xab,0xcc,0x89,0x53,0x43,0x32,0x23,0x98,0x9b,0x98,
+0x09,0x32,0x12,0xf8,0xba,0xbb,0x18,0x45,0x35,0x23,0x82,0xa9,0xcc,0x9a,0x00,0x31,
+0x35,0x13,0x90,0xb9,0x9d,0x02,0x58,0x37,0x03,0x88,0xb9,0xbf,0x8a,0x20,0x34,0x34,
+0x12,0xe9,0xcb,0xbc,0x9a,0x08,0x22,0x11,0x00,0xba,0xed,0x8a,0x90,0x1a,0xa2,0x9b,
+0xec,0x99,0xaa,0x21,0x63,0x04,0xa9,0xa8,0xff,0x89,0xa9,0x00,0x08,0x01,0x99,0x90,
+0xa9,0x28,0x73,0x03,0x73,0x37,0x42,0x44,0x23,0x80,0x99,0xdd,0xac,0x8a,0x10,0x51,
+0x35,0x22,0x11,0x90,0xb9,0xbc,0x99,0x99,0xa9,0xa8,0xdb,0x8a,0x21,0x36,0x53,0x12,
+0xb8,0xbe,0xbc,0xac,0x89,0x10,0x11,0x02,0x80,0x98,0x09,0x32,0x35,0x14,0x80,0xba,
+0xbd,0xac,0x88,0x11,0x43,0x33,0x43,0x53,0x34,0x34,0x23,0x13,0xa8,0xca,0xbc,0x89,
+0x18,0x64,0x32,0x13,0x32,0x83,0x9a,0xdd,0xcb,0xbd,0xbb,0x9c,0x98,0x19,0x21,0x11,
+0x18,0x93,0xbc,0xab,0xcc,0xec,0x9a,0xa9,0xab,0x52,0x11,0x21,0x16,0x99,0x19,0x11,
+0x11,0x73,0x14,0xa9,0x99,0xdb,0x8a,0x52,0x24,0x32,0x23,0x99,0xcb,0x99,0x9b,0x12,
+0x10,0xb0,0xba,0x9d,0x22,0x61,0x36,0x13,0x91,0xab,0xcd,0xab,0x09,0x42,0x42,0x24,
+0x22,0x81,0x88,0x19,0xa1,0x38,0x81,0xbc,0xfa,0x8c,0x00,0x41,0x46,0x33,0x00,0xb8,
+0xbf,0xcc,0xab,0x89,0x00,0x42,0x23,0x80,0x88,0xba,0xae,0x9a,0x99,0xdc,0x9b,0xc9,
+0x9a,0x50,0x44,0x02,0x02,0xea,0xbd,0xcb,0xba,0x99,0x21,0x33,0x43,0x43,0x02,0x88,
+0x12,0x75,0x44,0x44,0x33,0x12,0xb0,0xcf,0xbb,0xaa,0x18,0x54,0x34,0x23,0x12,0xa8,
+0xbb,0xbb,0x9a,0xa8,0xa9,0xdb,0xbd,0x9a,0x21,0x55,0x34,0x12,0xa0,0xcd,0xcb,0xbb,
+0x89,0x10,0x22,0x22,0x00,0x89,0x08,0x31,0x45,0x12,0x90,0xcb,0xbd,0xab,0x09,0x21,
+0x34,0x25,0x23,0x33,0x43,0x24,0x22,0x81,0xa8,0xcc,0xba,0x9a,0x19,0x64,0x34,0x43,
+0x33,0x83,0xaa,0xce,0xdb,0xac,0xaa,0x9a,0x08,0x10,0x11,0x33,0x21,0x01,0xa0,0xfb,
+0xcc,0xcb,0xab,0x8a,0x28,0x44,0x33,0x33,0xa1,0xbc,0xa9,0x18,0x54,0x35,0x02,0x98,
+0xba,0xad,0x28,0x26,0x34,0x13,0x91,0xdb,0xbb,0x9a,0x28,0x43,0x03,0x00,0xc9,0xac,
+0x08,0x11,0x34,0x81,0xc9,0xbd,0xab,0x00,0x33,0x57,0x13,0x90,0x80,0xaa,0x08,0x72,
+0x24,0x43,0x01,0x99,0xeb,0xab,0x99,0x40,0x43,0x24,0x02,0xa8,0xdc,0xbb,0xbc,0x99,
+0x88,0x80,0x08,0x82,0x99,0x19,0x45,0x92,0xbe,0x99,0xdf,0x8b,0x08,0x22,0x41,0x35,
+0xa1,0xcb,0xcb,0xcd,0x8a,0x88,0x00,0x30,0x13,0x08,0x40,0x13,0x00,0x35,0x73,0x43,
+0x65,0x23,0x12,0x81,0xea,0xbd,0x9b,0x89,0x41,0x55,0x22,0x11,0x81,0xb9,0xbb,0xab,
+0x99,0x99,0x90,0xdb,0x8a,0x20,0x44,0x36,0x22,0xa8,0xdc,0xbc,0xac,0x99,0x01,0x22,
+0x22,0x01,0x98,0x9a,0x28,0x32,0x44,0x82,0xc9,0xbb,0xbd,0x0a,0x12,0x62,0x33,0x23,
+0x22,0x52,0x23,0x12,0x32,0xa2,0x9c,0xbc,0xba,0x1a,0x44,0x65,0x33,0x41,0x02,0xba,
+0xcd,0xbb,0xbe,0x99,0x89,0x98,0x10,0x81,0x08,0x01,0x90,0x0c,0xf9,0x8a,0xcb,0x9a,
+0x88,0x20,0x66,0x82,0x11,0xa0,0xcd,0x9a,0x08,0x51,0x53,0x14,0x00,0x90,0xba,0xab,
+0x10,0x34,0x21,0x23,0xd9,0x9d,0x88,0x18,0x62,0x23,0x81,0xa9,0xdc,0xac,0x99,0x18,
+0x22,0x22,0x11,0x98,0x89,0x42,0x63,0x24,0x23,0xb8,0xac,0xeb,0x8a,0x30,0x44,0x42,
+0x24,0x80,0xb9,0x9a,0xbc,0x18,0x13,0x11,0x98,0xfd,0xbc,0xaa,0x89,0x32,0x43,0x53,
+0xa0,0xac,0xcb,0xcb,0x9a,0x10,0x99,0xa9,0x19,0x91,0x59,0x37,0x12,0x91,0xed,0xcc,
+0xab,0xcb,0x09,0x31,0x23,0x53,0x23,0x90,0x88,0x10,0x73,0x36,0x46,0x33,0x10,0x90,
+0xdc,0xbc,0x8b,0x00,0x52,0x45,0x22,0x01,0x90,0xc9,0xaa,0x9a,0x98,0x99,0x80,0xb9,
+0x0a,0x62,0x53,0x23,0x13,0xea,0xcc,0xac,0xab,0x89,0x22,0x33,0x33,0x82,0xa9,0xab,
+0x99,0x01,0x43,0xc8,0xba,0xdb,0x9a,0x51,0x33,0x54,0x22,0x02,0x88,0x21,0x13,0x11,
+0x22,0x90,0x9a,0x89,0x10,0x77,0x23,0x34,0x32,0x32,0xd1,0xbd,0xcd,0xdb,0x9a,0x99,
+0x08,0x22,0x02,0x89,0x80,0xdc,0xab,0x98,0xcc,0x0a,0xb8,0x8b,0x32,0x34,0x57,0x02,
+0x80,0xa1,0xbe,0x9b,0x89,0x28,0x55,0x23,0x11,0x00,0x90,0x9a,0x52,0x13,0x98,0x89,
+0xfd,0x9a,0x18,0x21,0x52,0x24,0x81,0x90,0xa9,0xcc,0xa9,0x9a,0xa8,0x8a,0x31,0x43,
+0x34,0x37,0x12,0x12,0x98,0xbb,0xbb,0xba,0x38,0x56,0x33,0x23,0x90,0xba,0xbc,0x0a,
+0x31,0x36,0x33,0xe8,0xdc,0xbb,0xbc,0x9a,0x89,0x42,0x83,0x20,0x13,0xca,0xab,0xaa,
+0xda,0xce,0x89,0xea,0x9c,0x11,0x01,0x41,0x33,0xb0,0xcf,0xca,0xac,0x9a,0x19,0x30,
+0x03,0x31,0x27,0x98,0x28,0x36,0x33,0x57,0x43,0x11,0x88,0xc9,0xbe,0x9b,0x18,0x32,
+0x47,0x23,0x02,0x80,0xba,0xcb,0x9a,0x89,0x99,0x89,0xb8,0xab,0x62,0x44,0x24,0x21,
+0xb0,0xce,0xac,0xbb,0x8a,0x31,0x32,0x24,0x12,0x98,0x99,0x8a,0x00,0x20,0xc8,0xcd,
+0xab,0xaa,0x10,0x45,0x43,0x33,0x12,0x01,0x08,0x88,0x89,0xb9,0xab,0x2b,0x83,0x73,
+0x37,0x43,0x33,0x23,0x11,0xea,0xdb,0xcc,0xac,0x9a,0x98,0x10,0x33,0x32,0x11,0xd8,
+0xab,0xdd,0x9a,0xa9,0x89,0x08,0x88,0x22,0x22,0x67,0x12,0x81,0x88,0xfb,0xac,0x88,
+0x08,0x51,0x25,0x01,0x00,0x80,0x99,0x29,0x33,0x01,0x98,0xeb,0xbd,0x8a,0x32,0x43,
+0x35,0x23,0x90,0xc9,0xac,0xab,0xaa,0x80,0xaa,0x18,0x14,0x40,0x36,0x34,0x23,0x81,
+0xeb,0x9a,0xcb,0x19,0x32,0x55,0x23,0x91,0x88,0xda,0xaa,0x9a,0x10,0x34,0x12,0xba,
+0xdd,0xbb,0xad,0x08,0x18,0x13,0x80,0xa8,0xae,0x89,0x28,0x17,0x80,0x88,0xdc,0xcc,
+0x9b,0x11,0x08,0x32,0x06,0xfb,0x99,0xba,0xbb,0x8a,0xa8,0x0a,0x41,0x23,0x63,0x35,
+0x32,0x24,0x54,0x35,0x43,0x11,0x01,0xeb,0xcc,0x9a,0x08,0x52,0x44,0x24,0x11,0x88,
+0xa9,0xbc,0x9a,0x88,0x98,0x18,0xa0,0x9a,0x42,0x44,0x53,0x12,0xb9,0xcf,0xbb,0xbb,
+0x9a,0x31,0x34,0x43,0x01,0x98,0x99,0x99,0x8a,0x80,0xa9,0xec,0xaa,0x99,0x21,0x45,
+0x33,0x53,0x02,0x00,0x00,0xa9,0xa9,0x99,0x98,0x1a,0x57,0x42,0x33,0x53,0x11,0x00,
+0xa8,0xcc,0xbc,0xca,0xad,0x89,0x88,0x11,0x53,0x01,0x08,0xc9,0xdc,0x9c,0x99,0x8a,
+0x00,0x20,0x80,0x33,0x21,0x13,0x32,0xd8,0xea,0xbf,0x9a,0x09,0x21,0x55,0x33,0x23,
+0x18,0xa8,0x9c,0x08,0x20,0x00,0x23,0xa0,0xac,0x20,0x53,0x46,0x22,0x91,0xa9,0xca,
+0xac,0x9b,0x98,0x28,0x02,0x08,0x31,0x67,0x22,0x13,0x41,0x82,0xcd,0xba,0x09,0x88,
+0x54,0x23,0x24,0x00,0xb0,0xbc,0xab,0x98,0x09,0x53,0x80,0xb8,0xbd,0xce,0x9a,0x89,
+0x08,0x01,0x02,0xda,0xaa,0xab,0xba,0x74,0x81,0x09,0xb8,0xef,0x89,0x08,0x80,0x30,
+0x93,0xdf,0xaa,0xc9,0x9c,0x88,0x88,0x88,0x41,0x23,0x32,0x54,0x13,0x32,0x22,0x57,
+0x33,0x13,0x22,0xb0,0xee,0x9b,0x18,0x32,0x74,0x43,0x12,0x80,0x98,0xbc,0xab,0x88,
+0x98,0x18,0x12,0xa9,0x38,0x27,0x21,0x23,0xd0,0xcf,0xbb,0xcb,0x9a,0x20,0x43,0x23,
+0x13,0x98,0xba,0xbb,0xbc,0x99,0x98,0xaa,0x9a,0x0a,0x72,0x54,0x22,0x22,0x13,0x90,
+0x80,0xb9,0x0a,0x91,0xac,0x71,0x35,0x34,0x54,0x13,0x01,0x08,0xc9,0xcb,0xab,0xc9,
+0xac,0x09,0x98,0x29,0x36,0x81,0x08,0xc9,0xbf,0xac,0xaa,0x99,0x18,0x32,0x02,0x31,
+0x23,0xb8,0xab,0xec,0xbb,0xfc,0x9a,0x18,0x12,0x63,0x44,0x12,0x80,0x80,0xca,0x9a,
+0x10,0x10,0x32,0x33,0x13,0x1a,0x54,0x13,0x11,0x12,0xfb,0xaa,0x9a,0xab,0x10,0x18,
+0x35,0x18,0x32,0x27,0x22,0x33,0x80,0x23,0xf8,0xbb,0x00,0xa9,0x70,0x37,0x00,0x31,
+0xa1,0xbd,0xba,0x09,0xaa,0x2a,0x14,0xca,0x9b,0xac,0xda,0xbc,0x21,0x01,0x88,0x98,
+0xfa,0xbc,0x89,0xba,0x74,0x03,0x8a,0xb9,0xba,0xbf,0x09,0x11,0x98,0xbb,0xef,0xaa,
+0xbb,0x9b,0x99,0x21,0x82,0x0b,0x57,0x81,0x20,0x42,0x13,0x30,0x57,0x34,0x33,0x23,
+0x12,0xfa,0xbb,0xab,0x20,0x64,0x34,0x25,0x12,0x88,0xb9,0xbb,0x9b,0x89,0x08,0x20,
+0xa0,0x99,0x28,0x45,0x33,0x82,0xfa,0xdf,0xaa,0xba,0x99,0x30,0x23,0x32,0x01,0xb9,
+0x9e,0xa9,0x9b,0xa8,0x08,0xb9,0x9a,0x0a,0x22,0x47,0x33,0x43,0x33,0x22,0x11,0x12,
+0x01,0x29,0x85,0x68,0x42,0x57,0x22,0x20,0x43,0xa8,0x99,0xc8,0xac,0xbb,0xbb,0x9a,
+0xa9,0x21,0x02,0x98,0xcb,0xff,0xab,0xba,0x9c,0x9a,0x88,0x20,0xb8,0x68,0x01,0x00,
+0xb9,0xc9,0xbc,0xcf,0x08,0x10,0x52,0x43,0x24,0x00,0x80,0xb9,0xcb,0x08,0x30,0x33,
+0x45,0x03,0x00,0x08,0x12,0x80,0x31,0x24,0xdd,0x09,0xba,0x19,0x90,0x54,0x23,0x02,
+0x21,0x03,0x18,0x38,0x47,0x19,0x91,0xbc,0x00,0x9a,0x3a,0x47,0x42,0x82,0x81,0xdb,
+0xbd,0x9b,0xba,0x4a,0x92,0x00,0x80,0xfb,0x8c,0x90,0x09,0x08,0x81,0xfa,0xaa,0xbc,
+0x00,0x41,0x15,0x88,0x88,0xfb,0x9b,0x89,0x00,0x81,0xdc,0xdb,0xbc,0xbc,0xab,0x89,
+0x80,0x08,0x29,0x27,0x91,0x4b,0x05,0x98,0x39,0x06,0x41,0x56,0x24,0x11,0x11,0x92,
+0xdc,0xab,0x08,0x10,0x63,0x35,0x22,0x21,0x80,0xca,0x8a,0x89,0xa9,0x8c,0x88,0xaa,
+0x0a,0x34,0x44,0x52,0x82,0xea,0xcb,0xca,0xbb,0x9a,0x10,0x22,0x32,0x12,0x89,0x88,
+0xba,0xba,0xcb,0xda,0xdc,0xaa,0x9a,0x20,0x35,0x43,0x44,0x22,0x11,0x10,0x80,0xb8,
+0x9a,0x40,0x01,0x73,0x34,0x24,0x43,0x32,0x12,0x88,0xe0,0xce,0xaa,0xa9,0xab,0x10,
+0x11,0x12,0x00,0xab,0xca,0xbd,0xad,0xdb,0xbb,0x9a,0xa9,0x18,0x32,0x35,0x14,0x88,
+0x99,0xf9,0x9e,0x08,0x11,0x28,0x36,0x01,0x08,0x88,0xaa,0x40,0x34,0x24,0x11,0x80,
+0xd9,0xaa,0x28,0x34,0x45,0x22,0x91,0x09,0xda,0x99,0x00,0x42,0x33,0x03,0x89,0xca,
+0x08,0x38,0x45,0x36,0x13,0xa8,0xcb,0xbb,0x8b,0x08,0x44,0x24,0xa0,0xdb,0xad,0x9a,
+0x89,0x40,0x14,0x81,0xa9,0xcf,0xcb,0x09,0x80,0x10,0x35,0x80,0xa9,0x9a,0xc9,0x8b,
+0x34,0x82,0xbd,0xd9,0xac,0x89,0x21,0x33,0x43,0xd0,0xce,0xab,0xdb,0x9b,0x08,0x80,
+0xaa,0x52,0xa2,0x9c,0x74,0x91,0x89,0x11,0x80,0x99,0x74,0x23,0x63,0x43,0x81,0x18,
+0xa0,0xcc,0x9a,0x21,0x22,0x73,0x34,0x02,0x21,0x81,0x9a,0x8a,0xa8,0xbd,0x9c,0x9a,
+0xaa,0x20,0x45,0x23,0x33,0xb1,0xdf,0xba,0xcc,0xaa,0x89,0x00,0x01,0x12,0x02,0x08,
+0x81,0x98,0xa9,0xbc,0xfb,0xcc,0x99,0x89,0x20,0x34,0x34,0x44,0x12,0x22,0x01,0x18,
+0x01,0xa9,0x18,0x19,0x03,0x73,0x47,0x23,0x23,0x22,0xa0,0xde,0x9b,0xdb,0xaa,0x89,
+0x89,0x09,0x10,0x00,0xaa,0x28,0xe1,0xcf,0x98,0xba,0x9c,0x98,0x88,0x11,0x42,0x11,
+0x10,0x13,0xb8,0x9d,0x13,0x9b,0x31,0x16,0x89,0x88,0x30,0x45,0x72,0x35,0x12,0x20,
+0x92,0x8a,0x88,0x00,0x11,0x00,0x13,0xa9,0x70,0x16,0x43,0x53,0x01,0x01,0xba,0xbd,
+0x99,0x89,0x30,0x46,0x02,0x80,0x90,0x98,0x0b,0x14,0x08,0xc9,0xfb,0xbe,0xaa,0x99,
+0x12,0x54,0x13,0x21,0xa9,0xce,0xa9,0xaa,0x0a,0x80,0x21,0xa9,0xc9,0x8a,0x19,0x27,
+0x11,0x19,0xd0,0xdc,0xad,0x88,0x98,0x08,0x88,0xa1,0x9e,0xdb,0xbc,0x9a,0x90,0xbb,
+0x28,0x00,0x02,0xde,0x0b,0x82,0x21,0x0a,0x77,0x05,0x11,0x43,0x24,0x12,0x22,0x12,
+0xcc,0xab,0xaa,0x18,0x54,0x46,0x21,0x32,0x02,0xa8,0x89,0xa8,0xaa,0xaa,0xca,0xdc,
+0x9a,0x88,0x11,0x35,0x43,0xa0,0xcb,0xcc,0xdb,0x9b,0x99,0x89,0x89,0x99,0x98,0x08,
+0x33,0x34,0x33,0x11,0xea,0xca,0xbe,0x9a,0x88,0x08,0x41,0x25,0x43,0x42,0x24,0x23,
+0x21,0x25,0x88,0x90,0x90,0xb9,0x9c,0x08,0x32,0x10,0x46,0x02,0x9a,0xba,0xbd,0xcd,
+0xab,0xcb,0xad,0xac,0xa9,0x8b,0x10,0x20,0x12,0x52,0xc1,0x9b,0xda,0xab,0xab,0xba,
+0xaa,0x89,0x89,0x55,0x45,0x43,0x24,0x11,0x80,0xbc,0xba,0x89,0x28,0x36,0x43,0x04,
+0x10,0x11,0x00,0x42,0x24,0x10,0xb1,0x9b,0xbb,0xcc,0x41,0x43,0x22,0x24,0x81,0xa9,
+0xb9,0x31,0x18,0x34,0x35,0xcb,0xc8,0x8c,0x9a,0x0a,0x43,0x00,0x99,0xda,0xbc,0xab,
+0x40,0x33,0x80,0xa2,0xff,0xac,0xb9,0xab,0x19,0x13,0x40,0x23,0xd0,0x9b,0xaa,0xba,
+0x8a,0x25,0xfb,0x9c,0xb8,0xaf,0x80,0x01,0x9b,0xa8,0xc4,0xbf,0xaa,0xa8,0x9b,0xab,
+0x18,0xe9,0x8a,0x11,0xbb,0x45,0x13,0x39,0x37,0x22,0x22,0x76,0x23,0x32,0x32,0x14,
+0x99,0x8a,0x99,0x00,0x58,0x36,0x21,0x33,0x25,0x10,0x52,0x23,0x01,0x90,0xa9,0xdf,
+0xab,0xba,0xcb,0x09,0x80,0x98,0x08,0x08,0xa8,0x9a,0x80,0xdb,0xdb,0xae,0xcc,0xaa,
+0xbb,0x9a,0x08,0x30,0x25,0x32,0x23,0x32,0x21,0x93,0x50,0x02,0x41,0x03,0x72,0x01,
+0x32,0x73,0x22,0x23,0x54,0x01,0x11,0x02,0x21,0x2a,0xb4,0xaa,0xce,0xcb,0xac,0xbd,
+0xab,0xab,0xb9,0x8c,0xa0,0x83,0x29,0x09,0xf2,0x01,0xab,0xba,0xfb,0xac,0xaa,0xd9,
+0x0a,0x98,0x28,0x24,0x42,0x34,0x53,0x12,0x12,0x80,0x13,0x10,0x10,0x8b,0xb2,0xb2,
+0x3f,0x21,0x26,0x36,0x22,0x51,0x83,0x21,0x80,0x10,0x10,0x11,0x12,0xf8,0xac,0x8a,
+0xbb,0x10,0x73,0x16,0x10,0x01,0x88,0xa8,0x48,0x01,0x01,0x18,0x89,0xfd,0x8d,0xaa,
+0x8a,0x18,0x00,0xc9,0x89,0xac,0xb8,0x61,0x22,0x42,0x91,0xda,0xae,0xcb,0xaa,0x9a,
+0x18,0x08,0x82,0xb1,0x2c,0xc1,0x89,0xa8,0x9a,0xfb,0xef,0xa9,0xac,0xaa,0x89,0x8b,
+0x81,0x08,0x01,0xaa,0x52,0xa0,0x72,0x11,0x21,0x24,0x62,0x45,0x32,0x53,0x33,0x24,
+0x13,0x33,0x32,0x32,0x43,0x03,0x89,0x11,0xe9,0x8a,0x63,0x12,0x31,0x44,0x92,0xa8,
+0x09,0xe8,0xad,0x9a,0xc8,0xac,0x9a,0xb8,0xba,0x9b,0xfb,0xba,0xbc,0xcb,0xba,0xab,
+0x9a,0x10,0x11,0x34,0x51,0x02,0xa8,0x18,0x88,0xca,0x20,0x32,0x64,0x44,0x63,0x22,
+0x23,0x24,0x02,0x21,0x02,0x09,0x18,0xa0,0x31,0xab,0x42,0xc3,0xaf,0x8a,0xcb,0xbc,
+0xcc,0xab,0xcd,0xbb,0xba,0xbc,0xab,0xa9,0xba,0x9b,0x08,0x00,0x80,0x72,0xa0,0x90,
+0xce,0xb9,0x8a,0xac,0x23,0x43,0x31,0x37,0x01,0xa8,0x2a,0x22,0xa2,0x68,0x36,0x32,
+0x33,0x64,0x21,0x12,0x10,0x98,0xb8,0x9c,0x01,0x08,0x30,0x77,0x01,0x01,0x20,0x01,
+0x88,0x40,0x23,0x33,0x54,0x11,0x80,0x8a,0xba,0xbc,0xba,0x89,0xaa,0x81,0x33,0x31,
+0x77,0x82,0xb8,0xac,0xbe,0xbb,0x8c,0x80,0x00,0x54,0x01,0x98,0xaa,0xbb,0xbd,0x9d,
+0xa9,0x99,0xba,0xbd,0xe9,0x9a,0xd9,0xba,0xcb,0xbc,0xac,0xbc,0xbc,0x9b,0xa9,0xbb,
+0x9a,0xd9,0xab,0x9a,0xaa,0xa8,0x40,0x36,0x98,0x21,0x11,0xc8,0x60,0x53,0x03,0x44,
+0x36,0x43,0x53,0x23,0x33,0x23,0x10,0x10,0x10,0x52,0x35,0x46,0x22,0x43,0x23,0x02,
+0x18,0x00,0xd8,0xcb,0x89,0xa9,0x99,0x22,0x24,0x21,0x08,0xb1,0xdf,0xab,0xa9,0xbb,
+0xab,0x18,0x10,0x28,0x34,0xb3,0xbf,0xdb,0xeb,0xbb,0xab,0x8b,0x00,0x22,0x44,0x24,
+0x22,0x13,0x18,0x08,0x93,0x19,0x88,0x51,0x34,0x01,0x99,0xaa,0xf8,0xbf,0x8a,0xba,
+0xea,0xab,0x88,0xcb,0xac,0xc8,0xcc,0xac,0xaa,0x9c,0x9a,0x10,0x01,0x98,0x08,0xc9,
+0xbd,0xbc,0x9a,0xba,0xba,0x9b,0x19,0xa9,0x38,0x85,0xab,0x38,0x57,0xba,0x00,0x24,
+0x08,0x71,0x34,0x13,0x12,0x40,0xa0,0x88,0x59,0x34,0x22,0x44,0x22,0x98,0x99,0x11,
+0x12,0x73,0x63,0x23,0x03,0x21,0x02,0xba,0xab,0x30,0x91,0x01,0x75,0x54,0x12,0x14,
+0x22,0x20,0xba,0x98,0xbd,0x08,0x52,0x23,0x43,0x25,0x03,0x08,0x89,0xdc,0xb9,0x89,
+0x9a,0x99,0x31,0x14,0xb9,0xff,0xcb,0xdb,0xab,0xcb,0xbb,0xbb,0xba,0xba,0x10,0xb9,
+0xbc,0xcb,0xea,0x9b,0x18,0x88,0x90,0x71,0x91,0x1a,0x12,0x45,0x62,0x34,0x54,0x22,
+0x32,0x34,0x22,0x10,0x32,0x13,0x22,0x46,0x24,0x22,0x34,0x23,0x01,0x01,0x81,0xcb,
+0xbd,0xa9,0xab,0xa9,0x21,0x10,0x90,0xb9,0xed,0xbd,0xba,0xba,0xcb,0xab,0x89,0xbb,
+0xde,0x99,0xa9,0xce,0xaa,0xa8,0xac,0x89,0x10,0x11,0x33,0x54,0x33,0x18,0x11,0x31,
+0x12,0x52,0x37,0x01,0x33,0x02,0x98,0xc8,0xad,0xca,0xcb,0x9b,0x88,0xa9,0xdb,0x11,
+0xcc,0xb8,0xbb,0xcd,0xaa,0xbc,0xba,0x9a,0x8a,0x32,0x80,0x0b,0xc3,0x9c,0xcf,0x9a,
+0x88,0xbc,0x80,0x8a,0x18,0xc9,0xb0,0x8e,0x29,0xc0,0x13,0x5a,0x44,0x03,0x00,0x11,
+0x01,0xac,0x88,0xc9,0x88,0x1c,0x11,0x44,0x32,0x36,0x32,0x01,0x81,0x91,0x09,0x60,
+0x24,0x62,0x44,0x33,0x23,0x21,0x19,0xa8,0xd8,0x1b,0x64,0x01,0x22,0x17,0x11,0x12,
+0x83,0x0a,0xb1,0x9a,0xec,0x8a,0x8a,0x00,0x33,0x74,0x43,0x32,0x01,0x01,0x88,0xcb,
+0x9b,0xda,0xa8,0x9d,0xaa,0xac,0xbd,0xba,0xce,0xac,0xad,0xcb,0xba,0xab,0x8b,0x99,
+0x19,0x01,0x88,0x18,0x11,0xe9,0x99,0xbc,0xba,0xb9,0x48,0x74,0x25,0x34,0x44,0x42,
+0x32,0x22,0x24,0x01,0x00,0x30,0x12,0x53,0x46,0x33,0x33,0x26,0x12,0x80,0x18,0x90,
+0xad,0x8a,0x99,0xa9,0x10,0x00,0x10,0x90,0xca,0xbe,0xcd,0x9a,0x98,0xa9,0x89,0x38,
+0xe8,0xca,0x99,0xac,0xcd,0xac,0x99,0xba,0x1a,0x00,0x43,0x31,0x05,0x10,0x80,0x01,
+0x22,0x18,0x33,0x44,0x94,0x68,0x23,0x01,0x18,0x02,0xdc,0xcc,0xb9,0xac,0xa8,0xdb,
+0x9b,0x88,0x9c,0xca,0x99,0xca,0x8a,0xda,0x9a,0x8b,0xa0,0x8a,0x11,0x1b,0x98,0xd8,
+0x89,0x4b,0xf2,0x8b,0x9c,0x88,0x9b,0xc3,0x8f,0x01,0xa0,0x9a,0x34,0x01,0x22,0x18,
+0xd3,0x8b,0x81,0x3a,0xa0,0x60,0x07,0x3a,0x63,0x15,0x04,0x08,0xa9,0x99,0xb9,0x0a,
+0x62,0x33,0x42,0x24,0x33,0x99,0x41,0x92,0xca,0x2b,0x03,0x50,0x14,0x45,0x33,0x31,
+0x14,0x24,0x20,0x19,0x05,0x9a,0x11,0x35,0x01,0x71,0x83,0x00,0x23,0x08,0xaa,0x83,
+0xbf,0x88,0x08,0xaf,0x90,0xba,0xdd,0xaa,0xea,0xac,0xbb,0xcd,0xba,0xbb,0xba,0xaa,
+0xbb,0x99,0x08,0x99,0x32,0x08,0x9e,0x90,0x98,0xaf,0xa0,0x11,0x49,0x36,0x36,0x54,
+0x34,0x22,0x43,0x33,0x11,0x10,0x42,0x12,0x72,0x43,0x32,0x24,0x43,0x11,0x91,0x80,
+0x98,0xea,0x9a,0x98,0x98,0x1a,0x12,0x92,0xca,0xcc,0xdb,0xad,0x9a,0x18,0x90,0x8a,
+0x42,0xa0,0xad,0x9a,0xe8,0xbd,0xbb,0xba,0x9d,0x99,0x22,0x13,0x42,0x31,0x03,0x88,
+0x10,0x33,0x81,0x65,0x22,0x25,0x82,0x18,0x12,0xd8,0x1a,0xa8,0xed,0x8b,0xc9,0xaa,
+0xac,0xba,0x09,0xd9,0x99,0x8d,0xa8,0xba,0x8c,0x91,0xbc,0x88,0x29,0xb1,0x23,0xaa,
+0x51,0xc0,0xc9,0x1b,0xf9,0xad,0x80,0xa9,0x9a,0x00,0x21,0x00,0x00,0x79,0x82,0x90,
+0x89,0x27,0xbb,0x2b,0x17,0x90,0x48,0x32,0x02,0x18,0x54,0x33,0x90,0x22,0x01,0xec,
+0x09,0x21,0x23,0x25,0x20,0x98,0x03,0x09,0x23,0x21,0xde,0x73,0x82,0x41,0x33,0x23,
+0x31,0x14,0x42,0x24,0x15,0x30,0x33,0x93,0x42,0x23,0x10,0x40,0x21,0xc3,0x1a,0x20,
+0x73,0x80,0xb8,0x18,0xf8,0x8f,0x89,0xb8,0xbc,0xcc,0xbb,0xce,0xba,0xbc,0xad,0xab,
+0xbb,0xda,0x9a,0x08,0xba,0xa9,0x98,0xca,0x0a,0x88,0x08,0xc8,0x8b,0x10,0xa1,0x20,
+0x72,0x47,0x34,0x55,0x33,0x33,0x34,0x24,0x01,0x12,0x52,0x23,0x25,0x44,0x33,0x32,
+0x32,0x13,0x80,0x99,0xc0,0xbd,0x9b,0x99,0x01,0x20,0x20,0x81,0xfc,0xbb,0xcb,0x9a,
+0xcb,0x08,0x80,0x89,0x09,0xc0,0xbe,0xbc,0xbd,0xbe,0xab,0xba,0x09,0x18,0x22,0x24,
+0x02,0x00,0x20,0xba,0x81,0x53,0x51,0x25,0x23,0x43,0x13,0x08,0x90,0xec,0xcb,0xab,
+0xa9,0xbc,0x01,0xca,0x09,0xae,0xaa,0xce,0x98,0x9a,0xab,0x01,0xaa,0x24,0x41,0x99,
+0x99,0x83,0xbe,0x28,0xda,0x89,0xbc,0xb8,0x9d,0x08,0x89,0x91,0xeb,0xd9,0x0b,0xb9,
+0x0a,0x21,0x14,0x11,0x8c,0x20,0x37,0x41,0x32,0x12,0x80,0x22,0x50,0x12,0x73,0x04,
+0x81,0x8a,0x33,0x90,0xac,0x09,0xf8,0x9b,0xbb,0x10,0x29,0x26,0x36,0x33,0x12,0x53,
+0x24,0x08,0x12,0x24,0x31,0x62,0x25,0x23,0x43,0x22,0x11,0x81,0xb8,0x19,0x99,0x99,
+0x75,0x01,0x88,0x35,0x81,0xa9,0x18,0xfa,0xac,0x9a,0xc9,0x10,0x19,0x81,0xe0,0xbe,
+0xca,0xeb,0xac,0xba,0xca,0xac,0xaa,0x99,0x99,0xa9,0xa9,0xab,0xcc,0xaa,0x18,0xba,
+0x9b,0x16,0xb8,0x09,0x70,0x90,0x11,0x53,0x47,0x32,0x34,0x44,0x22,0x12,0x32,0x23,
+0x31,0x46,0x32,0x32,0x63,0x12,0x22,0x01,0x80,0xa9,0xdb,0xaa,0x09,0x80,0x19,0x21,
+0xc8,0xfb,0x0b,0xba,0xfa,0x08,0x88,0x98,0x0a,0x00,0xc9,0xba,0xbd,0xbf,0xcb,0xbb,
+0x9b,0x08,0x89,0x21,0x32,0xa2,0x28,0x13,0xcc,0x00,0x54,0x52,0x14,0x43,0x33,0x22,
+0x80,0x90,0xbe,0xba,0x98,0x09,0x89,0x11,0xf9,0x9c,0xbf,0xbb,0x89,0xcc,0x9a,0x80,
+0xb9,0x8c,0x91,0x9a,0x08,0xb9,0xbd,0xfb,0x0c,0x98,0xa8,0x8b,0x98,0xeb,0xbd,0x10,
+0x99,0xf9,0x89,0x89,0x88,0x08,0x11,0x30,0xa1,0x38,0x42,0x34,0x56,0x22,0x11,0x08,
+0x44,0x21,0x80,0x72,0x01,0x09,0x82,0x83,0x0d,0xb0,0x88,0xab,0x99,0xbe,0x12,0x31,
+0x82,0x77,0x82,0x02,0x50,0x03,0x21,0x43,0x12,0x52,0x23,0x31,0x13,0x33,0x30,0x01,
+0xc9,0xb9,0xa9,0x2d,0x81,0x77,0x01,0x12,0x00,0x88,0x08,0xaa,0xaf,0x22,0xca,0x8a,
+0x51,0x90,0xa2,0x10,0xdf,0xcc,0xaa,0xbc,0xbc,0xaa,0xca,0xbb,0xab,0x80,0xae,0x9a,
+0xa9,0xa8,0xac,0x0b,0x92,0x99,0x29,0x32,0xfb,0x0e,0x32,0x88,0x52,0x47,0x22,0x32,
+0x35,0x23,0x21,0x33,0x34,0x21,0x34,0x34,0x53,0x34,0x33,0x32,0x91,0x08,0xaa,0xcc,
+0x8b,0x30,0x99,0x98,0x18,0xa1,0x8b,0xcc,0xc8,0xdd,0x9a,0xaa,0xaa,0x41,0x22,0xa1,
+0xa8,0xff,0xbb,0xbb,0xbb,0xac,0x89,0x88,0x18,0x11,0x02,0x41,0xa8,0xaa,0x23,0x59,
+0x57,0x33,0x24,0x42,0x13,0x01,0x9a,0x09,0xca,0xac,0x81,0x1a,0xbc,0x01,0x98,0xff,
+0xaa,0xcb,0xba,0x9c,0x8a,0x02,0x98,0x2a,0x81,0xec,0x09,0x90,0xd9,0x0a,0x99,0xba,
+0xbb,0x18,0xd8,0xae,0xba,0xbd,0xc9,0xaa,0x19,0x80,0xb9,0x88,0x32,0x92,0x7a,0x27,
+0x00,0x10,0x32,0x11,0x47,0x12,0x82,0x12,0x10,0x00,0x20,0xa2,0x39,0x00,0xd5,0xae,
+0x0a,0x90,0xa9,0x88,0x30,0x69,0x32,0x16,0x25,0x21,0x12,0x14,0x02,0x41,0x34,0x44,
+0x32,0x32,0x32,0x42,0x83,0x51,0x82,0x0b,0x88,0x85,0x50,0x42,0x22,0x03,0x10,0x01,
+0xcc,0x8a,0xc8,0x8b,0xc9,0xaa,0x58,0x04,0x0a,0xe8,0xda,0xcc,0xad,0xbb,0xcb,0xbc,
+0xaa,0xca,0xac,0x9a,0xb9,0xbc,0x8c,0xc9,0xab,0x89,0x89,0xab,0x03,0x91,0xaf,0x88,
+0x98,0x9a,0x73,0x33,0x46,0x44,0x32,0x24,0x42,0x21,0x20,0x33,0x14,0x53,0x24,0x23,
+0x44,0x13,0x10,0x10,0x80,0xb9,0x98,0x8b,0x00,0x90,0x09,0x05,0x9a,0x98,0xad,0xec,
+0x98,0x9b,0x8b,0x23,0x14,0x28,0xc0,0xbd,0xce,0xac,0xaa,0x9b,0x89,0xd9,0x99,0x10,
+0x18,0x13,0x90,0x79,0x80,0x23,0x44,0x52,0x14,0x21,0x32,0x81,0x89,0xa8,0x9a,0xcc,
+0xad,0x91,0xab,0x8a,0x98,0xfc,0x9a,0xbe,0x9c,0xa9,0xbb,0x28,0x98,0xa9,0x00,0x8d,
+0xb0,0x89,0x88,0xfb,0xbc,0xbb,0x90,0xce,0x8a,0xa8,0xbe,0xaa,0xca,0x0b,0xa8,0xb8,
+0x00,0x09,0x30,0x34,0x53,0x13,0x78,0x02,0x81,0x71,0x02,0x41,0x01,0x22,0x23,0x38,
+0x31,0x17,0x01,0x19,0xab,0xa0,0xcc,0xab,0x10,0xac,0x90,0xa0,0x39,0x22,0x67,0x02,
+0x32,0x12,0x14,0x33,0x27,0x34,0x25,0x30,0x21,0x16,0x29,0x01,0x81,0x80,0x8a,0x18,
+0x83,0x73,0x17,0x00,0x12,0x88,0x10,0x91,0x0b,0x11,0x16,0xbb,0x29,0x53,0xe2,0x1a,
+0xd9,0xdd,0xcb,0xbb,0xbb,0xcd,0x9b,0xca,0x9c,0xca,0xaa,0x9a,0xab,0xba,0x2a,0xa9,
+0x0b,0x85,0x49,0x13,0x52,0x24,0x34,0x35,0x63,0x25,0x21,0x35,0x32,0x13,0x42,0x14,
+0x20,0x33,0x01,0x53,0x13,0x11,0x01,0x13,0xeb,0x99,0xc9,0xae,0xaa,0xdb,0xbb,0x99,
+0xcb,0xab,0xb9,0xad,0xa9,0xbb,0x89,0x88,0x02,0x99,0x32,0x0a,0xb1,0xe9,0x19,0xcc,
+0xeb,0xab,0x98,0x80,0x39,0x82,0xa8,0x0c,0x15,0x09,0x57,0x33,0x31,0x36,0x03,0x41,
+0x44,0x22,0x10,0x33,0x22,0x41,0x34,0x34,0x32,0x23,0xa8,0xa9,0x9b,0xcd,0xeb,0x89,
+0xaa,0xbd,0x9a,0xa1,0xde,0x0a,0xa8,0xdc,0x9b,0x98,0xaa,0xbb,0xaa,0xaa,0x99,0xde,
+0x89,0x80,0xb9,0x8c,0x80,0x18,0x08,0x45,0x90,0x18,0x16,0xa9,0x00,0x43,0x01,0x01,
+0x00,0x50,0x03,0x09,0x47,0x33,0x83,0x0a,0x45,0x22,0x81,0x50,0x13,0x81,0x28,0x43,
+0x16,0x31,0x34,0x12,0x52,0x22,0x12,0x20,0x05,0x99,0x28,0xb1,0x5b,0x03,0xd8,0x0c,
+0x11,0xdc,0xca,0x8b,0x99,0xca,0xac,0x00,0xda,0x9c,0x89,0xc9,0xac,0x98,0xbb,0x9c,
+0xa8,0xa8,0x0b,0xa3,0x0e,0x12,0xfb,0x0c,0x02,0xba,0x0b,0x23,0xab,0x10,0x92,0x9d,
+0xf9,0xbd,0xab,0xba,0xbd,0x98,0xbf,0x88,0xba,0xda,0x0b,0x92,0xbc,0x10,0xa0,0x19,
+0x71,0x05,0x30,0x26,0x22,0x44,0x24,0x43,0x44,0x33,0x43,0x43,0x32,0x43,0x11,0x32,
+0x15,0x00,0x21,0x03,0xa9,0x0a,0xd8,0xbd,0xad,0xca,0xac,0xbb,0xbc,0xbb,0xbb,0xbd,
+0xcb,0xaa,0xcb,0xaa,0x99,0x9b,0x08,0x80,0x11,0x12,0x73,0x11,0x03,0x42,0x12,0x30,
+0x33,0x63,0x35,0x32,0x21,0x44,0x02,0x31,0x12,0x64,0x03,0x53,0x33,0x35,0x23,0x34,
+0x24,0x11,0x32,0x31,0x32,0x33,0x13,0x01,0xaa,0xfd,0xca,0xac,0xeb,0xab,0xdb,0xab,
+0xcb,0xbc,0xaa,0xca,0xbb,0xaa,0xdb,0x89,0x8a,0x99,0x01,0x00,0x80,0x52,0x02,0x41,
+0x64,0x81,0x31,0x42,0x12,0x31,0x23,0x12,0x50,0x02,0x23,0x63,0x14,0x30,0x23,0xc1,
+0x39,0x14,0x10,0x22,0x20,0x35,0x81,0x51,0x45,0x00,0x31,0xcb,0x31,0xda,0x10,0x80,
+0x20,0x13,0xfc,0x28,0xa8,0xda,0x38,0xe9,0x08,0x8a,0x10,0x88,0x24,0x00,0x9b,0x83,
+0xdc,0x09,0x81,0x9d,0x13,0xdd,0x9a,0xaa,0xdb,0xac,0xc9,0xbc,0xab,0xab,0xdc,0x18,
+0xc8,0x09,0x98,0x9b,0x18,0xa2,0x1e,0x25,0x09,0x10,0x34,0x15,0x09,0x42,0xb0,0x8b,
+0xa0,0xbd,0x18,0xd9,0xae,0x00,0xda,0xbb,0x10,0x98,0xdb,0x08,0x18,0x90,0x38,0x37,
+0x45,0x22,0x54,0x33,0x53,0x33,0x44,0x43,0x23,0x52,0x23,0x13,0x22,0x34,0x01,0x98,
+0x32,0xa1,0xce,0x89,0xca,0xcc,0xbb,0xbc,0xdb,0xab,0xbb,0xac,0xbb,0xbc,0xaa,0xba,
+0xbb,0xbb,0x10,0xa8,0x40,0x43,0x12,0x53,0x23,0x42,0x25,0x21,0x43,0x02,0x21,0x22,
+0x44,0x42,0x12,0x44,0x22,0x12,0x50,0x44,0x02,0x41,0x44,0x02,0x30,0x25,0x13,0x30,
+0x23,0x00,0x33,0xd0,0x9d,0x00,0xfb,0x9d,0x9a,0xda,0xab,0xba,0xdb,0xbb,0xaa,0xad,
+0x9b,0xa9,0xbb,0x99,0x08,0x80,0x11,0x72,0x24,0x23,0x43,0x24,0x32,0x43,0x33,0x31,
+0x35,0x33,0x08,0x34,0x02,0x88,0x11,0x8a,0x13,0x2a,0xb1,0x79,0x27,0x88,0x28,0x27,
+0x89,0x21,0x11,0x81,0x20,0x89,0x91,0x8a,0xb1,0xff,0x8a,0xad,0xba,0xaa,0xcb,0x9b,
+0xa8,0xab,0xca,0x08,0x42,0x32,0x82,0x75,0x13,0x40,0x34,0x23,0x38,0x26,0x91,0x09,
+0x82,0xdc,0x09,0xba,0xbf,0xaa,0xc9,0xbd,0xaa,0xcb,0xbb,0xab,0xbb,0xab,0x80,0x8c,
+0x12,0x24,0x10,0x22,0x46,0x23,0x53,0x32,0x34,0x23,0x11,0x03,0x0a,0xeb,0xba,0xdb,
+0xac,0xbd,0x8a,0xeb,0xbb,0x89,0xb8,0x9e,0x82,0x88,0x38,0x02,0x54,0x63,0x23,0x52,
+0x35,0x24,0x21,0x45,0x22,0x12,0x43,0x23,0x23,0x22,0x24,0x22,0x82,0x88,0x08,0xd8,
+0xae,0xb9,0xca,0xbd,0xbc,0xbb,0xbc,0xad,0xab,0xba,0xbc,0xab,0xba,0xac,0x9b,0xa9,
+0xaa,0x89,0x08,0x10,0x41,0x24,0x21,0x36,0x11,0x32,0x47,0x12,0x31,0x34,0x23,0x32,
+0x45,0x42,0x24,0x22,0x24,0x33,0x23,0x34,0x53,0x22,0x22,0x23,0x21,0x23,0xa0,0x28,
+0x13,0xff,0x8a,0xda,0xbc,0xbb,0xeb,0xbb,0xac,0xda,0xbb,0xb9,0xcb,0xac,0xa0,0xab,
+0x0b,0xa0,0x9a,0x00,0x31,0x25,0x32,0x57,0x21,0x24,0x22,0x32,0x35,0x11,0x53,0x32,
+0x21,0x33,0x11,0x25,0x01,0x10,0x12,0x00,0x80,0x81,0xb0,0x9d,0x81,0xdc,0xac,0xa8,
+0xdb,0x9c,0xdb,0xab,0x9b,0xca,0xbc,0x9a,0xc0,0xdb,0x8a,0x90,0x08,0xa9,0x35,0x30,
+0x13,0x73,0x33,0x45,0x11,0x53,0x32,0x13,0x12,0x52,0x23,0x08,0x18,0x02,0xeb,0xaa,
+0xab,0xfc,0xac,0xba,0xcb,0xad,0x99,0xbc,0xaa,0xba,0xac,0x8a,0xab,0x99,0x18,0x12,
+0xa9,0x71,0x05,0x09,0x22,0x14,0x11,0x24,0x01,0x00,0x00,0xb1,0x9e,0x88,0xa9,0xf9,
+0x9c,0x9a,0x98,0xbb,0x8c,0x32,0x24,0x8a,0x45,0x73,0x03,0x28,0x53,0x34,0x02,0x61,
+0x34,0x22,0x52,0x22,0x34,0x33,0x21,0x35,0x24,0x23,0x31,0x26,0x11,0x00,0x11,0x80,
+0x98,0xb9,0xae,0xda,0xbb,0xbe,0xbc,0xbc,0xcb,0xbc,0xab,0xcb,0xac,0xaa,0xbb,0xbb,
+0xcb,0x9a,0x9a,0x88,0x01,0x10,0x62,0x24,0x23,0x64,0x32,0x43,0x33,0x23,0x35,0x22,
+0x53,0x12,0x53,0x12,0x11,0x32,0x02,0x32,0x02,0x40,0x22,0x82,0x38,0x92,0x8b,0xd8,
+0x09,0x89,0xe8,0xcd,0x8b,0xfc,0xac,0xba,0xbb,0xbe,0xba,0xdb,0xac,0xba,0xbc,0x9a,
+0xcb,0xaa,0x9a,0xa8,0xab,0x30,0x12,0x53,0x36,0x63,0x32,0x43,0x43,0x34,0x22,0x53,
+0x32,0x33,0x43,0x22,0x22,0x11,0x81,0x80,0x88,0xda,0xbc,0xbb,0xdd,0xbb,0xca,0xac,
+0xab,0xca,0xba,0x9c,0x9a,0xba,0xab,0x80,0x19,0x91,0x61,0x03,0x63,0x14,0x21,0x63,
+0x13,0x22,0x52,0x23,0x22,0x33,0x24,0x31,0x11,0x33,0x81,0x1a,0xa2,0xc9,0xbd,0xb9,
+0xcf,0xbb,0xbd,0xeb,0xab,0xbb,0xbe,0xaa,0xda,0xac,0xaa,0xa9,0xdb,0xba,0x99,0xba,
+0x9c,0x80,0x8a,0x08,0x01,0x21,0x37,0x32,0x12,0x73,0x15,0x10,0x43,0x12,0x23,0x31,
+0x14,0x11,0x10,0x14,0xa8,0x98,0x32,0xfa,0x8b,0x83,0xb8,0x8f,0x11,0x90,0x41,0x22,
+0x23,0x76,0x12,0x42,0x34,0x44,0x33,0x43,0x34,0x33,0x43,0x43,0x32,0x34,0x21,0x23,
+0x02,0x10,0xb8,0xcb,0xda,0xcc,0xbb,0xbe,0xcb,0xdb,0xbb,0xcb,0xbc,0xba,0xcb,0xba,
+0xba,0xcb,0x9a,0x8b,0xa9,0x89,0x20,0x11,0x62,0x14,0x42,0x43,0x43,0x33,0x53,0x32,
+0x23,0x34,0x23,0x43,0x34,0x22,0x43,0x14,0x32,0x22,0x42,0x14,0x22,0x33,0x23,0x43,
+0x24,0x10,0x80,0x10,0xb0,0xbe,0x9a,0xdf,0xac,0xca,0xcc,0xba,0xcb,0xac,0xcb,0xba,
+0xcb,0xab,0xab,0xdb,0x89,0x8a,0x09,0x18,0x31,0x34,0x53,0x44,0x34,0x43,0x33,0x44,
+0x33,0x33,0x24,0x24,0x32,0x22,0x21,0x21,0x83,0x98,0xa9,0xdb,0xae,0xc9,0xbb,0xad,
+0xbb,0xbc,0xdb,0xaa,0xb9,0xbb,0x9b,0xca,0xaa,0x9a,0x89,0x10,0x12,0x34,0x61,0x24,
+0x41,0x43,0x23,0x32,0x44,0x43,0x24,0x31,0x34,0x13,0x32,0x43,0x22,0x11,0x01,0x30,
+0x26,0xcb,0x8a,0xc0,0xaf,0xba,0xbc,0xcc,0xbb,0xcc,0xbc,0xaa,0xcb,0xcb,0xaa,0xcb,
+0xbb,0x9a,0xcb,0x09,0x99,0x09,0x33,0x21,0x21,0x57,0x23,0x32,0x26,0x43,0x23,0x42,
+0x33,0x23,0x22,0x53,0x82,0x21,0x12,0xb8,0x20,0xf8,0x8c,0x90,0xd9,0x9a,0x89,0xd9,
+0x8a,0x98,0x28,0xa9,0x88,0x71,0x16,0x99,0x51,0x43,0x12,0x42,0x35,0x24,0x12,0x53,
+0x23,0x43,0x22,0x32,0x27,0x81,0x31,0x13,0x81,0x90,0x89,0x99,0xdc,0xbc,0xb9,0xbd,
+0xbd,0xac,0xcb,0xbc,0xac,0xab,0xdb,0xaa,0x9b,0xba,0xad,0x98,0xaa,0x9a,0x98,0x08,
+0x20,0x22,0x63,0x34,0x25,0x31,0x35,0x43,0x32,0x43,0x25,0x33,0x32,0x34,0x25,0x31,
+0x33,0x32,0x43,0x23,0x31,0x32,0x07,0x88,0x21,0xb8,0xbc,0x8a,0xdc,0xbb,0xbb,0xbf,
+0xca,0xbc,0xbb,0xcb,0xcc,0x9a,0xbb,0xbb,0xab,0xac,0xba,0x9a,0x88,0x90,0x60,0x12,
+0x51,0x34,0x24,0x42,0x35,0x23,0x43,0x33,0x44,0x12,0x32,0x33,0x33,0x23,0x10,0x24,
+0xa8,0xba,0xac,0xfa,0xbb,0xad,0xc9,0xac,0xbb,0xbc,0xbb,0xcb,0x9c,0xaa,0xaa,0x8c,
+0x08,0x99,0x9a,0x22,0x42,0x15,0x52,0x33,0x35,0x32,0x53,0x44,0x11,0x02,0x43,0x22,
+0x02,0x20,0x15,0x08,0x8a,0x98,0xb8,0xec,0xbb,0xac,0xea,0xab,0xab,0xdb,0xbc,0xbb,
+0xac,0xbc,0xaa,0xbb,0xba,0xca,0xaa,0x8a,0x10,0xb8,0x58,0x42,0x03,0x51,0x14,0x30,
+0x44,0x02,0x53,0x43,0x10,0x18,0x14,0x11,0x31,0x14,0x22,0x53,0x91,0x29,0x06,0x99,
+0x40,0x83,0x8d,0x32,0xb1,0xab,0x38,0xcb,0x21,0x92,0x8f,0x33,0xf2,0x8d,0x22,0xb9,
+0x2a,0x17,0x10,0x32,0x35,0x43,0x32,0x35,0x53,0x53,0x12,0x41,0x25,0x11,0x20,0x25,
+0x00,0x10,0x10,0x88,0x99,0xda,0xbb,0xcb,0xed,0xaa,0xba,0xbd,0xac,0xba,0xbc,0xba,
+0xcb,0xaa,0xab,0xaa,0xac,0x99,0xa9,0x08,0x33,0x13,0x64,0x34,0x22,0x44,0x33,0x24,
+0x53,0x22,0x32,0x35,0x13,0x42,0x24,0x21,0x43,0x12,0x21,0x43,0x02,0x21,0x24,0x81,
+0x39,0x83,0xcd,0x29,0xd0,0xac,0x88,0xfb,0x9b,0xaa,0xcd,0xaa,0xbb,0xbd,0xba,0xbb,
+0xbd,0xaa,0xcb,0xab,0x09,0xcc,0x18,0x01,0x99,0x51,0x13,0x32,0x56,0x12,0x43,0x33,
+0x24,0x42,0x42,0x22,0x42,0x12,0x12,0x32,0x80,0x00,0x99,0xb9,0xbc,0xcd,0xda,0xaa,
+0xcd,0xba,0xba,0xcb,0xbb,0xba,0xb9,0xbb,0xba,0xba,0xa8,0x08,0x51,0x32,0x37,0x22,
+0x54,0x23,0x32,0x35,0x33,0x51,0x31,0x12,0x33,0x11,0x31,0x03,0xa9,0xfb,0x88,0xca,
+0xae,0x80,0xb9,0xac,0x99,0x8d,0xd9,0xab,0xbb,0xa9,0xde,0x0a,0x90,0xbc,0x0a,0xc9,
+0xac,0x99,0x9a,0x9c,0x91,0x9b,0x89,0x30,0xe0,0x49,0x04,0x00,0x30,0x15,0x43,0x42,
+0x24,0x42,0x23,0x13,0x53,0x80,0x22,0x23,0x82,0x1a,0x31,0xfa,0x9c,0xca,0x9b,0xba,
+0xcc,0x98,0xac,0xb8,0xac,0x21,0x81,0x5a,0x36,0x35,0x43,0x34,0x35,0x25,0x23,0x43,
+0x44,0x32,0x33,0x34,0x23,0x33,0x32,0x21,0x14,0x82,0xaa,0xcb,0xbd,0xec,0xbb,0xbc,
+0xbc,0xbd,0xbb,0xbc,0xbb,0xbd,0xba,0xbb,0xcb,0xba,0xba,0x8b,0x98,0x9a,0x28,0x51,
+0x83,0x73,0x24,0x42,0x32,0x24,0x33,0x35,0x32,0x43,0x34,0x22,0x33,0x24,0x43,0x23,
+0x42,0x21,0x33,0x42,0x21,0x32,0x23,0x90,0x22,0xb9,0x0b,0x86,0xbd,0x99,0xfb,0xad,
+0xcc,0xab,0xbb,0xcc,0xcb,0xba,0xbc,0xbc,0xbb,0xbb,0xbc,0xab,0xcb,0x9a,0xb8,0x8b,
+0x33,0x30,0x45,0x25,0x53,0x33,0x35,0x43,0x43,0x33,0x34,0x32,0x34,0x32,0x21,0x12,
+0x02,0x80,0xbb,0xba,0xfb,0xbc,0xbe,0xab,0xbd,0xbb,0xbc,0xab,0xbb,0xbc,0xaa,0xba,
+0xa9,0x99,0x21,0x42,0x43,0x44,0x44,0x33,0x34,0x53,0x33,0x32,0x32,0x25,0x23,0x22,
+0x11,0x11,0x80,0xa9,0xba,0xc8,0xbf,0xcb,0xba,0xcc,0x9b,0xbb,0xcb,0xac,0xda,0x9a,
+0xbb,0xbb,0xb9,0xac,0xeb,0xaa,0xb9,0xcb,0xcb,0xdb,0x99,0xba,0xbb,0x99,0xbb,0x98,
+0xb9,0x21,0x4c,0xb3,0x74,0x41,0x25,0x21,0x44,0x33,0x42,0x43,0x32,0x32,0x25,0x18,
+0x51,0x13,0xa9,0x18,0x11,0xdc,0xaa,0x9a,0xe9,0x99,0xbc,0xab,0x88,0xfb,0x9a,0x10,
+0x00,0x09,0x44,0x45,0x32,0x43,0x25,0x53,0x23,0x33,0x35,0x24,0x23,0x33,0x24,0x32,
+0x02,0x11,0x23,0xb1,0xad,0xca,0xdb,0xbc,0xbc,0xfb,0xaa,0xca,0xcb,0xaa,0xba,0xcb,
+0xab,0xbb,0xdb,0xb9,0x9a,0x99,0xa8,0x98,0x18,0x12,0x01,0x62,0x15,0x52,0x21,0x13,
+0x42,0x24,0x22,0x25,0x43,0x31,0x43,0x12,0x53,0x24,0x21,0x33,0x34,0x52,0x33,0x23,
+0x63,0x22,0x00,0x31,0x02,0x21,0x88,0x90,0xcb,0xed,0xbc,0xbb,0xad,0xac,0xcc,0x9b,
+0xc9,0xac,0xab,0xaa,0xba,0x9c,0xbb,0x9a,0x98,0x8b,0x22,0x44,0x22,0x44,0x44,0x23,
+0x53,0x22,0x53,0x33,0x11,0x34,0x13,0x12,0x02,0x88,0xa0,0x98,0xae,0xca,0xaa,0xdc,
+0xac,0xab,0xba,0xbc,0xb9,0xbb,0x8a,0xca,0x88,0x39,0x23,0x34,0x55,0x34,0x23,0x32,
+0x46,0x22,0x23,0x22,0x43,0x12,0x00,0x91,0x51,0x90,0xba,0x8a,0xbc,0xdb,0xda,0x9c,
+0xba,0xdb,0xab,0xab,0xd9,0xac,0xa9,0xac,0xaa,0xcb,0xac,0xa9,0xa8,0xad,0xca,0x9c,
+0x88,0xba,0xab,0x89,0xa0,0xcf,0x18,0x03,0x89,0x10,0x34,0x33,0x02,0x73,0x33,0x17,
+0x40,0x31,0x15,0x11,0x38,0x14,0x90,0x28,0x04,0xb9,0x0a,0xba,0xcf,0x8a,0xc9,0xad,
+0x09,0xc9,0x9a,0x90,0xc9,0x1a,0x00,0x89,0x37,0x34,0x33,0x46,0x34,0x24,0x51,0x33,
+0x24,0x43,0x42,0x32,0x33,0x53,0x22,0x43,0x12,0x02,0x10,0x11,0xc0,0xaa,0xdb,0xcb,
+0xcc,0xac,0xca,0xbc,0xbb,0xad,0xbb,0xad,0xba,0xcb,0x9b,0xca,0xaa,0xab,0x9a,0xba,
+0x9b,0x88,0x09,0x11,0x22,0x54,0x54,0x11,0x33,0x25,0x33,0x44,0x32,0x53,0x23,0x43,
+0x33,0x43,0x24,0x33,0x33,0x35,0x22,0x32,0x44,0x13,0x22,0x25,0x20,0x23,0x02,0x08,
+0x51,0xd9,0x99,0x8a,0xca,0xbd,0xbc,0xca,0xcc,0xba,0xad,0xbb,0xcb,0xba,0xbc,0xab,
+0xac,0xcb,0x9a,0x9a,0xb9,0x90,0x89,0x28,0x14,0x41,0x37,0x32,0x52,0x23,0x34,0x33,
+0x34,0x22,0x63,0x13,0x11,0x21,0x12,0xa8,0x19,0xb8,0xcd,0xa8,0xac,0xbc,0xa8,0xcb,
+0x9b,0xaa,0xbc,0x89,0x98,0x71,0x11,0x21,0x43,0x34,0x34,0x33,0x23,0x44,0x02,0x42,
+0x21,0x12,0x41,0x98,0xb8,0xae,0xac,0xcb,0xac,0xaa,0xbd,0xcb,0xaa,0xa9,0xaf,0x89,
+0xbb,0x8a,0x9c,0xa9,0xa8,0xab,0x98,0xcb,0xb1,0x9e,0xc9,0xca,0x9a,0x99,0xdc,0x0a,
+0xa0,0xbc,0x0d,0xa2,0xba,0x19,0x83,0xab,0x34,0x32,0x49,0x77,0x02,0x31,0x52,0x02,
+0x22,0x34,0x21,0x62,0x82,0x08,0x42,0x98,0x8a,0x11,0xeb,0x19,0xa0,0xdc,0x08,0x80,
+0x9b,0x00,0xa2,0x48,0x44,0x11,0x72,0x37,0x12,0x53,0x34,0x22,0x43,0x34,0x42,0x33,
+0x32,0x35,0x23,0x31,0x33,0x01,0x18,0x82,0xdb,0xad,0xb9,0xce,0xcb,0xaa,0xeb,0xac,
+0xab,0xbb,0xcc,0xba,0xab,0xbc,0xbb,0xbb,0xab,0xbb,0xab,0xba,0x9c,0x90,0x08,0x10,
+0x47,0x22,0x32,0x35,0x33,0x43,0x34,0x25,0x42,0x24,0x21,0x32,0x35,0x22,0x42,0x33,
+0x12,0x43,0x33,0x43,0x34,0x03,0x52,0x33,0x12,0x42,0x12,0x10,0x22,0x98,0x09,0x86,
+0x8d,0xa9,0xb9,0xbf,0xbc,0xca,0xbc,0xba,0xdc,0xaa,0xcb,0xbb,0xba,0xad,0x9a,0xbb,
+0xdb,0x89,0xb8,0x9b,0x88,0x10,0x01,0x32,0x63,0x12,0x35,0x11,0x63,0x22,0x42,0x04,
+0x10,0x34,0x01,0x21,0x81,0x31,0x80,0x11,0x31,0xa0,0x81,0x29,0x63,0x40,0xa5,0x22,
+0x70,0x82,0x25,0x40,0x43,0x32,0x12,0x24,0x43,0x12,0x30,0x25,0x12,0x30,0x89,0xc1,
+0xd0,0xad,0x8a,0xec,0xba,0xb8,0xad,0xba,0xeb,0xba,0xba,0xbd,0xab,0xcc,0x99,0x9a,
+0xc9,0x8c,0x80,0x9a,0xa0,0x09,0xca,0x09,0x9a,0x99,0x08,0x11,0x9b,0x71,0x17,0x18,
+0x30,0x11,0x13,0x25,0x11,0x64,0x23,0x04,0x41,0x35,0x80,0x89,0x53,0x91,0x00,0x88,
+0x43,0x81,0xac,0x11,0x24,0xa9,0x18,0x31,0x13,0x78,0x14,0x49,0x47,0x10,0x41,0x54,
+0x21,0x12,0x53,0x23,0x43,0x24,0x32,0x35,0x32,0x12,0x63,0x03,0x11,0x01,0x21,0x91,
+0xb8,0xac,0xac,0xcd,0xdb,0xbc,0xba,0xae,0xca,0xab,0xcb,0xbb,0xcb,0xbb,0xac,0xbb,
+0xcb,0xab,0xa9,0xbb,0x9a,0x98,0x00,0x00,0x28,0x47,0x42,0x22,0x43,0x44,0x22,0x43,
+0x33,0x34,0x24,0x23,0x34,0x33,0x33,0x24,0x43,0x53,0x12,0x22,0x33,0x33,0x33,0x33,
+0x45,0x23,0x11,0x22,0x35,0x11,0x00,0x33,0x23,0xa1,0x2b,0xf9,0x8b,0xdf,0x99,0xbb,
+0xdb,0xbc,0xad,0xbb,0xad,0xcb,0xbb,0xac,0xbb,0xad,0xab,0xbb,0xcc,0xa9,0xaa,0x99,
+0xa9,0xaa,0x10,0x10,0x81,0x53,0x64,0x12,0x22,0x53,0x33,0x33,0x25,0x42,0x32,0x34,
+0x40,0x12,0x33,0x33,0x21,0x24,0x32,0x24,0x11,0x34,0x63,0x81,0x43,0x31,0x22,0x34,
+0x04,0x43,0x22,0x11,0x53,0x41,0x91,0x08,0xa0,0xab,0xbe,0xda,0xbd,0xb8,0xad,0xbc,
+0xbc,0xba,0xbe,0xca,0x9b,0xca,0xbb,0xbc,0xa9,0xbb,0xbd,0x89,0xaa,0x99,0xaa,0x8b,
+0x80,0x09,0xaa,0x61,0x15,0x18,0x32,0x46,0x03,0x21,0x42,0x34,0x12,0x22,0x45,0x42,
+0x03,0x10,0x72,0x23,0x88,0x31,0x42,0x83,0x89,0x12,0x41,0x82,0xbb,0x51,0x34,0x92,
+0x8c,0x52,0x13,0xe8,0x49,0x33,0x91,0x21,0x72,0x63,0x14,0x11,0x43,0x43,0x03,0x32,
+0x36,0x42,0x12,0x33,0x33,0x27,0x80,0x10,0x32,0x90,0x89,0x98,0xac,0xfb,0xbc,0xbc,
+0xba,0xcd,0xac,0xba,0xbb,0xbd,0xac,0xba,0xbb,0xbc,0xbb,0xbb,0xba,0xcc,0x8a,0x98,
+0x88,0x0a,0x11,0x53,0x22,0x32,0x55,0x34,0x12,0x34,0x43,0x34,0x32,0x33,0x35,0x24,
+0x12,0x33,0x54,0x12,0x11,0x32,0x25,0x11,0x42,0x12,0x34,0x22,0x22,0x63,0x12,0x11,
+0x20,0x53,0x23,0x90,0x10,0x41,0x91,0xad,0xab,0xaa,0xdd,0xbd,0xbb,0xca,0xdc,0xbb,
+0xab,0xdb,0xbc,0xca,0xba,0xca,0xbb,0xbb,0x9a,0xbc,0xbb,0x9b,0x88,0x9c,0x99,0x10,
+0x42,0x02,0x41,0x46,0x23,0x21,0x33,0x73,0x23,0x22,0x42,0x44,0x12,0x21,0x41,0x24,
+0x21,0x12,0x43,0x23,0x31,0x13,0x35,0x34,0x20,0x13,0x73,0x03,0x08,0x31,0x22,0x02,
+0x29,0xa9,0xc1,0xa9,0xbe,0xad,0xc8,0xcc,0xcb,0xaa,0xcb,0xcc,0xcb,0xaa,0xbb,0xcb,
+0xad,0xa8,0x9b,0xad,0xa8,0xaa,0x9a,0x9c,0x99,0xa0,0x9d,0x88,0x19,0x81,0x08,0xba,
+0x49,0x94,0x9c,0x28,0x15,0x12,0x2a,0x45,0x33,0x13,0x73,0x23,0x44,0x12,0x31,0x44,
+0x24,0x10,0x35,0x22,0x12,0x32,0x20,0x32,0x17,0x80,0x28,0x15,0x88,0x08,0x23,0x39,
+0x86,0xbc,0x10,0x17,0xcb,0x20,0x32,0x23,0x52,0x24,0x60,0x24,0x00,0x52,0x24,0x11,
+0x43,0x24,0x23,0x43,0x02,0x32,0x14,0x00,0x08,0x22,0xb8,0xce,0x8a,0xdb,0xdb,0xbc,
+0xba,0xbd,0xbc,0xcb,0xbb,0xbc,0xcb,0xbb,0xac,0xaa,0xbc,0xaa,0xaa,0xba,0x9c,0x89,
+0x81,0x00,0x31,0x34,0x53,0x44,0x23,0x44,0x34,0x22,0x44,0x33,0x23,0x63,0x12,0x32,
+0x24,0x32,0x42,0x33,0x22,0x33,0x24,0x22,0x35,0x81,0x21,0x24,0x81,0x10,0x33,0x10,
+0x15,0xb9,0x68,0x93,0xcb,0x8b,0xa1,0xcc,0xaa,0xcd,0xaa,0xc9,0xce,0xaa,0xb8,0xcc,
+0xab,0xac,0xdb,0xab,0xac,0xab,0xc9,0xba,0xbb,0xca,0xaa,0xbb,0xab,0xa9,0xaa,0x89,
+0x38,0x32,0x13,0x65,0x42,0x25,0x21,0x44,0x33,0x33,0x34,0x52,0x32,0x43,0x32,0x34,
+0x25,0x31,0x23,0x32,0x34,0x43,0x22,0x33,0x26,0x12,0x20,0x62,0x83,0x11,0x11,0x20,
+0x18,0x94,0xaa,0x31,0xfb,0x9c,0xa9,0xe1,0x9c,0xac,0xda,0x9a,0xab,0xbd,0xab,0xe8,
+0xbb,0x8a,0xbb,0xbc,0xbb,0xca,0xaa,0xaa,0xbd,0x9a,0xa0,0xbc,0xaa,0x38,0xe0,0x88,
+0x08,0x15,0x88,0x42,0x12,0x44,0x12,0x22,0x44,0x52,0x22,0x13,0x33,0x74,0x81,0x11,
+0x42,0x02,0x18,0x20,0x83,0x0a,0x81,0x2a,0x17,0xa9,0x8a,0x44,0xa2,0xac,0x50,0x92,
+0x88,0x40,0x82,0x78,0x12,0x02,0x72,0x24,0x11,0x43,0x44,0x12,0x31,0x35,0x23,0x33,
+0x54,0x22,0x42,0x32,0x22,0x22,0x43,0x80,0x20,0x93,0xba,0xbc,0xdc,0xcc,0xac,0xdb,
+0xbb,0xac,0xbc,0xbc,0xcb,0xdb,0xaa,0xbb,0xbc,0xab,0xac,0xbb,0xab,0xca,0xaa,0xaa,
+0x09,0x00,0x11,0x33,0x26,0x44,0x43,0x24,0x43,0x34,0x32,0x34,0x43,0x24,0x23,0x34,
+0x24,0x23,0x22,0x34,0x23,0x22,0x43,0x33,0x32,0x13,0x33,0x43,0x01,0x10,0x33,0x01,
+0x9f,0x00,0x23,0xa9,0xb9,0x8b,0xb9,0xef,0xeb,0xa8,0xab,0xcd,0xab,0xbc,0xbb,0xad,
+0xdb,0xbb,0xdb,0xb9,0xbc,0xba,0xbb,0xad,0xaa,0xbb,0xbb,0xdb,0x9b,0x9a,0xa9,0xba,
+0xb9,0x0c,0x90,0x18,0x89,0x57,0x21,0x11,0x32,0x55,0x02,0x23,0x63,0x33,0x34,0x32,
+0x44,0x43,0x23,0x33,0x53,0x32,0x33,0x24,0x41,0x24,0x11,0x20,0x34,0x01,0x12,0x42,
+0x98,0xa8,0x39,0x80,0xdc,0xbc,0xbb,0xc8,0xdc,0xbc,0x99,0xcb,0xcb,0xba,0xac,0xba,
+0xbc,0xab,0xca,0xda,0xaa,0x8b,0xba,0xfb,0xa9,0x09,0xba,0x9b,0x8a,0xa1,0x8b,0x10,
+0x34,0xc0,0x30,0x84,0x0a,0x48,0x14,0x89,0x73,0x13,0x89,0x88,0x12,0x68,0x80,0x15,
+0x73,0x88,0x32,0x02,0x21,0x72,0x21,0x01,0x42,0x44,0x02,0x18,0x53,0x02,0x10,0x21,
+0x43,0x31,0x06,0x82,0x39,0x12,0x19,0xa2,0x54,0x80,0x20,0x32,0x56,0x23,0x00,0x46,
+0x21,0x18,0x36,0x16,0x20,0x33,0x44,0x33,0x20,0x35,0x32,0x24,0x11,0x23,0x22,0x81,
+0x89,0x18,0xfa,0xdb,0x9c,0xbc,0xcc,0xbc,0xab,0xcc,0xbb,0xbc,0xab,0xbc,0xbb,0xca,
+0xaa,0xaa,0x99,0x99,0x89,0x11,0x31,0x53,0x36,0x42,0x33,0x27,0x32,0x22,0x53,0x33,
+0x32,0x25,0x32,0x22,0x42,0x32,0x03,0x41,0x01,0xa1,0x18,0x9a,0x90,0xab,0xd9,0xab,
+0x30,0x9d,0xb2,0x8a,0x90,0x39,0x28,0xaf,0x07,0x28,0x1c,0x84,0x98,0x99,0x4b,0xa0,
+0xfb,0x99,0xea,0x8b,0xc9,0xaa,0xbd,0xa9,0xbb,0xbd,0xac,0xc9,0xad,0x99,0xbb,0xdb,
+0xba,0xaa,0xca,0xaa,0x8c,0xca,0xa8,0x98,0x0b,0x09,0x98,0xa3,0x71,0x18,0x72,0x82,
+0x24,0x41,0x32,0x43,0x23,0x34,0x34,0x32,0x73,0x13,0x00,0x43,0x32,0x12,0x12,0x31,
+0x61,0xb1,0x10,0x51,0x81,0x99,0x92,0x48,0xdd,0x18,0xb0,0x8a,0xa9,0x8c,0xa1,0xbf,
+0x90,0x0a,0x01,0xe9,0x9b,0xc9,0x18,0xdb,0xaa,0x9b,0xa0,0xeb,0x9a,0x08,0xb9,0xbf,
+0x10,0xea,0xda,0x1a,0x12,0xdb,0x81,0x80,0xa8,0xad,0xba,0x98,0x9c,0xab,0xb0,0x3a,
+0xd8,0x12,0x39,0x21,0x86,0x1a,0x47,0x01,0x11,0x31,0x45,0xb1,0x70,0x83,0x20,0x33,
+0x21,0x16,0x00,0x12,0x48,0x93,0x2a,0x15,0x09,0x81,0x9c,0x05,0x9a,0x98,0xaa,0xb0,
+0xaf,0x98,0xbc,0xc9,0xaa,0x00,0xcb,0xaa,0x8b,0x93,0x5b,0x26,0xa8,0x71,0x24,0x00,
+0x41,0x33,0x43,0x52,0x23,0x51,0x23,0x32,0x33,0x62,0x12,0x21,0x12,0x11,0x15,0x09,
+0x88,0xa8,0xae,0x88,0xac,0xbb,0xbd,0xba,0xcc,0xaa,0x9a,0x00,0xc1,0x00,0x2a,0x81,
+0x89,0x13,0xb0,0x79,0x51,0x94,0x28,0x14,0x89,0x08,0x03,0x52,0x91,0xc0,0x28,0x21,
+0xbf,0xc3,0xbb,0x9d,0x89,0xbe,0xa8,0x80,0xaf,0x89,0xaa,0x99,0x99,0xcf,0x88,0x09,
+0x98,0x88,0x01,0x82,0xad,0x82,0x31,0x9a,0x87,0x50,0xa1,0x42,0x23,0x29,0xfa,0x11,
+0xc0,0x9b,0x98,0xbb,0xee,0x18,0x80,0xaa,0x8a,0x01,0xd2,0x1b,0xa9,0xb9,0x03,0xaa,
+0x51,0x2c,0x05,0xa1,0x40,0x3c,0x17,0x00,0x93,0x11,0x20,0x9b,0xb5,0x30,0x29,0x02,
+0xaf,0x83,0xac,0x8b,0x99,0x84,0xbf,0xa9,0x6a,0xc0,0x9a,0x12,0x9c,0x32,0xa0,0x11,
+0x20,0x36,0x53,0xb1,0x09,0x22,0x58,0xf9,0x28,0xa8,0x18,0xa0,0xca,0x4b,0x16,0xa8,
+0x30,0x01,0xb8,0xb0,0x0c,0x9a,0x8f,0xc2,0x20,0xaf,0x88,0xd0,0x39,0x89,0xcc,0x12,
+0x29,0xea,0x0a,0x80,0x20,0xcb,0x42,0x02,0x8d,0x00,0x25,0x9d,0x30,0x24,0xcb,0x10,
+0x33,0x01,0xab,0x36,0x80,0x18,0x52,0x93,0x38,0x33,0xa0,0x13,0x73,0x91,0x30,0x86,
+0x39,0xc9,0x88,0xca,0x2c,0xa3,0x00,0xbf,0x84,0x9c,0x98,0xca,0x18,0xab,0x98,0xdc,
+0x10,0xaa,0xcb,0xa0,0x8d,0x8a,0xa8,0xa9,0x21,0x9b,0xc9,0x54,0xea,0x18,0x31,0x89,
+0x42,0x12,0x37,0x30,0x02,0x26,0x20,0x33,0x37,0x11,0x34,0x30,0x25,0x22,0x41,0x12,
+0x23,0x28,0x14,0x31,0x22,0x33,0x80,0x13,0x88,0xae,0xc2,0x8e,0xc9,0x0a,0xdb,0x9a,
+0x99,0xca,0xdb,0x99,0x8c,0xbb,0x81,0xca,0xbb,0x1a,0xbd,0xcb,0x90,0x1b,0x9c,0xc8,
+0x1a,0xb9,0xe8,0x29,0x1a,0xa4,0x08,0x63,0x89,0xb9,0x91,0x50,0xa8,0x12,0x39,0xbc,
+0xe1,0x20,0x30,0xad,0xb0,0x61,0x81,0xa9,0x58,0x84,0x22,0x9c,0x31,0x04,0x1b,0x10,
+0x27,0xab,0x09,0x44,0xd8,0x19,0x89,0xb1,0x9e,0x01,0x48,0xb8,0x8a,0x23,0x31,0xf9,
+0x30,0x34,0x11,0xb0,0x52,0xac,0x09,0x15,0xa0,0xae,0x18,0xea,0x88,0xa8,0x2a,0x27,
+0x81,0xad,0x61,0x81,0xb9,0x1c,0x05,0xa8,0x9a,0x08,0x98,0xca,0x9b,0x20,0xf8,0x8b,
+0x10,0xa9,0x12,0x9c,0x90,0x0c,0xb8,0x30,0xa9,0xa0,0x8c,0x18,0xd4,0x89,0x8c,0x55,
+0xb0,0x08,0x49,0x02,0xe9,0x51,0x03,0x90,0x09,0x26,0x9a,0xa9,0x64,0x02,0xcb,0x51,
+0x02,0x99,0x09,0x24,0xc8,0x09,0x20,0x31,0xb2,0x71,0x34,0x90,0x08,0x13,0x81,0x9c,
+0x33,0xa2,0xcf,0x20,0xb0,0x9e,0x90,0x00,0xba,0x8c,0x08,0xe0,0x9b,0x10,0xa9,0x00,
+0x02,0xda,0x9d,0x13,0xdb,0x00,0x98,0x90,0x9d,0x25,0xbb,0xae,0x21,0x25,0xc8,0x28,
+0x33,0xba,0xa0,0x59,0x05,0x8a,0x22,0x24,0x14,0x19,0x15,0xb9,0x28,0x12,0xac,0x12,
+0x52,0x82,0x32,0xb0,0x1d,0x82,0xaa,0x52,0x00,0x63,0xc1,0x8c,0x13,0x98,0xaa,0x8e,
+0x05,0xa9,0x28,0xd2,0x0c,0x01,0xa1,0x1a,0x22,0x99,0x37,0x33,0x99,0x63,0x85,0x19,
+0x22,0xa2,0x2b,0x22,0x17,0x08,0x00,0x16,0x00,0x90,0x11,0x00,0x11,0x60,0x01,0xe1,
+0x11,0x0c,0x90,0xcb,0xba,0xbe,0x48,0xd9,0x88,0x88,0x81,0x89,0x1a,0x16,0xa8,0x89,
+0x0a,0xfc,0x09,0x42,0x90,0x98,0x00,0x11,0xd9,0x8f,0x00,0x13,0x9c,0x88,0x22,0x18,
+0xe1,0x1a,0x11,0x98,0xc0,0x69,0x03,0xfa,0x19,0x13,0x90,0xbe,0x62,0xa8,0x8a,0x22,
+0x15,0x9b,0x00,0x12,0xfa,0x29,0x01,0xc0,0x0a,0x32,0xc9,0x02,0xa0,0x29,0xc8,0x19,
+0xe0,0x8b,0x0b,0xc2,0x09,0xcf,0xb9,0x09,0x11,0xbb,0x44,0x93,0xac,0xb9,0x0c,0x81,
+0xb0,0x78,0xb3,0x0d,0x28,0x93,0xb0,0x0f,0x33,0xb1,0xad,0x54,0x88,0x80,0x22,0x02,
+0xc9,0x9a,0x98,0x63,0xaa,0x53,0x23,0x02,0x8f,0x14,0xa8,0x09,0x10,0x02,0xbc,0x64,
+0xa1,0x9a,0x39,0x27,0xc9,0x28,0x13,0xba,0x9b,0x24,0xdb,0x9a,0x91,0x88,0x18,0xea,
+0xaa,0x30,0x34,0xcb,0xb9,0x70,0xb2,0x8e,0x10,0x02,0xaa,0x40,0x03,0xa9,0x09,0x29,
+0x07,0xbc,0x70,0x02,0xcb,0x20,0x33,0xdb,0x51,0x83,0xaa,0x18,0x22,0xb9,0x41,0x84,
+0x8a,0x50,0x93,0xfb,0x39,0x23,0xd1,0x9b,0x63,0xb0,0x9d,0x21,0x23,0xca,0x1b,0x14,
+0xa9,0x98,0x98,0x8b,0x16,0xca,0x8a,0x02,0x00,0x98,0x19,0x93,0x67,0x9b,0x88,0x14,
+0x80,0x8b,0x12,0xc8,0x20,0x01,0x71,0xd2,0x28,0x98,0x29,0x21,0x04,0xbc,0x73,0x14,
+0xab,0x11,0x00,0x71,0xd9,0x08,0x91,0x00,0xa8,0x02,0x8e,0x01,0x82,0x8d,0x81,0xa0,
+0x2a,0x15,0x89,0x03,0x89,0x18,0x04,0x8d,0x84,0x49,0xc9,0x1a,0x17,0xba,0x11,0x92,
+0xba,0x58,0x33,0xc3,0x8e,0x32,0x90,0xba,0x10,0x88,0xfb,0x19,0x32,0xd1,0x8e,0x25,
+0xa9,0xa9,0x31,0xa0,0x08,0x01,0x19,0x61,0xe3,0x0b,0x23,0xc8,0x98,0x49,0xa0,0xa1,
+0x8d,0x52,0xd9,0x99,0x40,0x93,0x8a,0x88,0x21,0xb8,0xaf,0x42,0x35,0xcc,0x0a,0x24,
+0x90,0xbc,0x41,0x82,0x98,0x08,0x42,0x81,0x89,0x91,0x48,0xb4,0xae,0x1a,0x02,0xec,
+0x28,0x18,0x80,0x91,0x9c,0x68,0x93,0x89,0x41,0x10,0x99,0x01,0xe9,0x28,0x39,0xf9,
+0x0b,0x13,0x38,0xfa,0x19,0x42,0xc0,0x9b,0x22,0x12,0xfc,0x19,0x02,0x88,0x99,0x19,
+0xb1,0xae,0x61,0xa2,0xab,0x71,0x03,0x9e,0x21,0x82,0xaa,0x38,0xb1,0x9c,0x11,0x91,
+0x28,0x35,0x02,0x89,0x00,0x22,0xbc,0xcd,0x70,0x13,0xaa,0x39,0xa1,0x0a,0x10,0x99,
+0xb9,0x23,0x06,0x0f,0x03,0xca,0x45,0xa9,0xbb,0x51,0x13,0xda,0x99,0x49,0xa2,0xeb,
+0x40,0x03,0xb9,0x8b,0x14,0x98,0x11,0x9a,0x31,0x13,0xbd,0x28,0x14,0x18,0x00,0xcd,
+0x10,0x62,0xe8,0x0b,0x41,0xa2,0x10,0x4a,0x33,0xe1,0x89,0x31,0x90,0xac,0x33,0xe0,
+0x1d,0x12,0x02,0xa0,0x8d,0x22,0xf0,0x9b,0x41,0x94,0x9b,0x31,0x81,0xbb,0x4b,0x27,
+0xac,0x19,0x02,0x80,0x8b,0xa3,0x1e,0x16,0xdb,0x19,0x32,0xc0,0x1a,0x22,0xa0,0x8a,
+0x90,0x53,0xf9,0x19,0x23,0x8a,0xb8,0x41,0xa0,0x3a,0x86,0x88,0x0a,0x12,0x90,0xea,
+0x2a,0x35,0xe1,0x0b,0x32,0xc2,0xac,0x50,0x92,0xbb,0x52,0x91,0x29,0x12,0xa3,0xac,
+0x38,0x84,0xcc,0x29,0x14,0xb1,0x9e,0x42,0xa9,0xa1,0x3c,0x03,0x9a,0x34,0x21,0xcb,
+0xaa,0x54,0xb9,0x31,0xc2,0x7b,0x90,0x80,0x10,0x89,0x82,0x50,0xb2,0x8c,0x34,0x90,
+0xa0,0xbc,0x1a,0xa4,0x0c,0x03,0x09,0x87,0x4a,0xca,0x12,0xb8,0x8e,0x32,0xe0,0x8b,
+0x32,0x95,0x8d,0x18,0x11,0x82,0xbb,0x39,0x05,0x98,0x9b,0x70,0x93,0xac,0x09,0x34,
+0xb0,0xad,0x2a,0x27,0xba,0x29,0x83,0x10,0xeb,0x30,0x00,0xa2,0x0b,0xa0,0x4a,0x09,
+0x37,0x08,0x80,0xad,0x43,0x81,0xac,0x30,0x06,0xdb,0x28,0xb1,0x0b,0x40,0xa5,0x9c,
+0x39,0x86,0x9a,0x28,0x32,0xc1,0x1b,0x92,0xaa,0xbb,0x74,0xd1,0x8a,0x24,0xba,0x88,
+0x2a,0x44,0xb8,0x8a,0x31,0xc9,0x8c,0x08,0x54,0xa2,0x0f,0x02,0x89,0x80,0x11,0x8a,
+0x02,0xc0,0x4c,0x04,0x80,0x80,0x69,0xd1,0x18,0x88,0x0a,0x21,0xb2,0x0d,0x31,0x37,
+0xa8,0x51,0x21,0xa3,0xbd,0x8b,0xb9,0xd9,0xaf,0x21,0xb9,0x1a,0x01,0x03,0x8b,0x35,
+0x01,0x04,0x89,0x18,0x50,0xe2,0x09,0xbb,0x11,0xa8,0x9f,0x22,0x91,0x31,0x80,0x91,
+0x59,0x36,0xa1,0x20,0x19,0x27,0xc0,0x8b,0x43,0x98,0x10,0xb9,0x73,0x92,0x8d,0x88,
+0x93,0x88,0xab,0x98,0x32,0xfa,0x0c,0x80,0x81,0xdb,0x09,0x49,0xa3,0x1b,0x03,0x61,
+0x91,0x9c,0x89,0x36,0x99,0x98,0x00,0xc9,0x81,0x0b,0x13,0x98,0x29,0xa0,0x77,0x02,
+0xcd,0x30,0x84,0xaa,0x18,0x19,0x04,0x09,0xb8,0x60,0x12,0x88,0x33,0x27,0x40,0x02,
+0x35,0x8a,0x83,0x08,0x40,0xc2,0x3a,0x98,0x90,0x23,0xae,0x89,0x51,0x82,0xaa,0x91,
+0x6a,0x88,0xa2,0x99,0xbf,0x28,0xe2,0xdb,0x18,0x80,0xc9,0x9b,0x32,0xdb,0x0a,0xba,
+0x41,0xfa,0x0a,0x81,0x09,0xb9,0x21,0x20,0x94,0x1a,0xd0,0x38,0x25,0x0b,0x37,0x09,
+0x00,0x23,0xba,0x41,0x94,0x9c,0x31,0xc1,0x1d,0xa3,0x2b,0xb1,0x69,0x03,0x50,0x08,
+0xa8,0x25,0x1a,0xb0,0x61,0x11,0x34,0x13,0x98,0x37,0x09,0x00,0x98,0xb0,0x8d,0x23,
+0xfd,0x08,0x18,0xb8,0x9b,0x10,0xcc,0xaa,0x09,0xac,0xf9,0x0a,0x21,0xa9,0x81,0x1b,
+0x93,0x0b,0xe8,0x1a,0xb8,0x3b,0xf2,0xad,0x11,0x0a,0xeb,0x82,0x9b,0x50,0x01,0x83,
+0x21,0x40,0xd2,0x28,0x05,0xad,0x81,0x72,0x98,0x18,0x03,0x1a,0x98,0x03,0x9d,0x01,
+0x09,0x86,0x1a,0xab,0x14,0x02,0x58,0x98,0x03,0x90,0x08,0x8a,0x8a,0x93,0xf9,0x3f,
+0xb3,0x0c,0x05,0x8e,0x02,0x9a,0x10,0xa9,0x22,0x9e,0x10,0xd0,0x29,0x88,0xa9,0xb0,
+0x2b,0xd0,0x9e,0x98,0x10,0xcb,0x08,0xca,0x41,0xa2,0xbc,0x1b,0xb8,0x37,0xbd,0x08,
+0x03,0x99,0xee,0x2a,0x04,0xaa,0x10,0x31,0x03,0x9e,0x21,0x98,0xab,0x15,0x0d,0x92,
+0x18,0x20,0x31,0x04,0x52,0x11,0x90,0x53,0x51,0x98,0x81,0x72,0x23,0x51,0x27,0x41,
+0x23,0x34,0x34,0x53,0x33,0x12,0x31,0x02,0x80,0xa8,0xab,0xfb,0x9e,0xba,0xac,0x99,
+0xbb,0xab,0xba,0xca,0xab,0xca,0xbb,0x99,0xbd,0xbc,0xac,0xbc,0xb9,0x9c,0x9a,0x99,
+0x00,0xad,0x99,0xba,0xcd,0x09,0xda,0xab,0x09,0x9a,0x00,0x54,0x24,0x62,0x53,0x33,
+0x63,0x23,0x41,0x33,0x12,0x11,0x32,0x00,0xa0,0x18,0x0a,0x88,0xd8,0x20,0x33,0x42,
+0x65,0x04,0x20,0x31,0x90,0x08,0x18,0xd1,0x9f,0xa0,0xbc,0xcb,0xcb,0x99,0x8a,0xca,
+0xaf,0x99,0xaa,0x9c,0xaa,0xa9,0xbc,0xcc,0x89,0x99,0x88,0x0a,0x23,0x10,0x31,0x55,
+0x13,0x30,0x83,0x40,0x93,0x8d,0x12,0x00,0xe0,0x39,0x44,0x81,0x18,0x16,0x10,0x21,
+0x42,0x14,0x01,0x91,0x38,0x27,0x08,0x89,0x32,0x90,0x0a,0x55,0x83,0x10,0xb0,0x19,
+0x15,0xcb,0xb9,0x18,0xf9,0x8c,0x88,0x19,0xa0,0x82,0x18,0x81,0x8c,0x03,0xff,0x99,
+0x1b,0xd9,0xbb,0x9a,0xbc,0xcc,0x9c,0xa8,0x8b,0x28,0xa0,0x0b,0xa8,0x11,0x67,0x10,
+0xb0,0x2a,0x96,0x09,0x01,0x10,0xc8,0x1b,0x10,0xb9,0x52,0xa9,0x52,0x03,0x59,0x14,
+0x00,0x80,0x63,0x00,0x9a,0x22,0x25,0x8c,0xca,0x08,0x54,0xb9,0x99,0x81,0xce,0x8a,
+0x98,0xb9,0xcc,0xbc,0x8a,0x98,0xec,0x0a,0x98,0xeb,0x8a,0x10,0x10,0x41,0x44,0x55,
+0x53,0x33,0x63,0x43,0x23,0x33,0x44,0x22,0x11,0x11,0x01,0xb8,0xab,0xcc,0xcc,0xda,
+0xaa,0xaa,0xba,0xaa,0x9b,0x89,0xb8,0x9b,0x00,0xc9,0xcd,0xba,0xca,0xdc,0xac,0xaa,
+0xca,0xbc,0xaa,0xba,0xaa,0xbc,0x8a,0x90,0x9a,0x80,0x30,0x44,0x32,0x47,0x34,0x33,
+0x45,0x33,0x34,0x24,0x24,0x33,0x22,0x12,0x13,0x82,0x08,0x08,0xbd,0x98,0x9a,0x3a,
+0x23,0x89,0x55,0x45,0x22,0x31,0x33,0x11,0x12,0xc0,0xaf,0xc8,0xeb,0xaa,0xcb,0xcb,
+0xab,0xbb,0xbd,0xaa,0xba,0xbb,0x9b,0xbc,0xcb,0x9b,0xbb,0x8c,0xaa,0x99,0x88,0x0a,
+0x35,0x41,0x24,0x13,0x43,0x32,0x03,0x20,0x16,0x32,0x14,0x41,0x45,0x13,0x52,0x63,
+0x23,0x43,0x43,0x33,0x22,0x14,0x21,0x10,0x90,0xaa,0xa9,0xcb,0xac,0x9a,0xb9,0xbc,
+0xca,0x60,0x81,0x09,0x01,0x30,0x99,0xd9,0xd9,0xaa,0xcd,0xbc,0xba,0xcb,0xcb,0x9a,
+0xab,0xca,0xbb,0x08,0xaa,0xde,0x99,0x88,0xaa,0x89,0x81,0xcb,0x38,0xb9,0x25,0x23,
+0x29,0x89,0x87,0x19,0x2b,0xa0,0xd8,0xcd,0x38,0x12,0x38,0x26,0x62,0x33,0x32,0x47,
+0x12,0x22,0x22,0x22,0x81,0x12,0xa8,0x0b,0xf9,0x9b,0x90,0xaa,0xbf,0x09,0x98,0xac,
+0x90,0x18,0xa8,0x9c,0xa0,0xaf,0x00,0x99,0x91,0xfc,0x8a,0x80,0x8a,0x08,0xf9,0x8e,
+0x89,0xca,0xab,0x88,0xca,0x9d,0x10,0x11,0x42,0x73,0x43,0x43,0x34,0x44,0x33,0x34,
+0x32,0x25,0x21,0x22,0x11,0x02,0xa8,0xaa,0xca,0xcc,0xc9,0xba,0xba,0xbc,0xaa,0xb9,
+0xbb,0xbb,0xcb,0xba,0xdd,0xa9,0xbd,0xbc,0xbc,0xdb,0xcb,0xba,0xbc,0xbb,0xca,0xaa,
+0x89,0xbb,0x90,0x31,0x30,0x45,0x43,0x44,0x33,0x34,0x35,0x33,0x53,0x33,0x33,0x33,
+0x34,0x32,0x31,0x04,0x21,0x11,0x10,0x03,0x41,0x24,0x41,0x63,0x24,0x43,0x22,0x14,
+0x02,0x22,0xb8,0x89,0xfd,0xdb,0xab,0xcb,0xbc,0xcb,0xcb,0xba,0xaa,0xca,0x99,0xa9,
+0xba,0x09,0xb9,0xbc,0xaa,0xfb,0x8a,0xba,0xba,0x8a,0xba,0x0b,0x25,0x41,0x44,0x35,
+0x43,0x53,0x23,0x33,0x24,0x42,0x31,0x12,0x32,0x31,0x22,0x13,0x03,0x71,0x21,0x23,
+0x15,0x09,0x13,0x30,0x02,0x01,0x80,0x0f,0x98,0x80,0x0c,0x81,0xcb,0x99,0xbd,0xec,
+0xac,0xca,0xbd,0xbb,0xad,0xbb,0xdb,0xaa,0x99,0xab,0x00,0x00,0x33,0x72,0x32,0x13,
+0x23,0x30,0x99,0xb8,0xfc,0xac,0xbb,0xcc,0xba,0xab,0x9b,0x08,0x01,0x73,0x33,0x34,
+0x12,0x73,0x23,0x21,0x21,0x33,0xa3,0x49,0x31,0x06,0x13,0x89,0x37,0x01,0x88,0x22,
+0x21,0xc8,0xb9,0x19,0x99,0xcf,0xa9,0x08,0xdd,0x08,0x10,0x88,0xa0,0x8a,0x43,0xc1,
+0x9f,0xba,0x89,0xdd,0x9a,0xab,0xb9,0xbd,0x9a,0x98,0xb9,0x0d,0x34,0x88,0x88,0x51,
+0x36,0x10,0x44,0x35,0x23,0x44,0x44,0x33,0x43,0x43,0x33,0x22,0x42,0x22,0x01,0xa8,
+0xb9,0xca,0xbf,0xbb,0xb9,0xbd,0xba,0xa9,0x99,0x8a,0x00,0x20,0x81,0xd9,0xba,0xcf,
+0xbc,0xbc,0xbc,0xcd,0xba,0xbb,0xac,0xba,0x9a,0x88,0x00,0x10,0x34,0x36,0x22,0x35,
+0x24,0x12,0x32,0x33,0x22,0x43,0x32,0x24,0x15,0x31,0x44,0x23,0x43,0x24,0x22,0x33,
+0x32,0x22,0x34,0x01,0x42,0x11,0x80,0x22,0x32,0xa8,0xbc,0xc0,0xcc,0xbf,0xdc,0xaa,
+0xbc,0xcb,0xcb,0xbb,0xcb,0xbb,0xaa,0xaa,0xab,0x9c,0xc9,0xac,0xaa,0xca,0xba,0xcc,
+0xbd,0x9b,0xaa,0xba,0x29,0x88,0x12,0x55,0x44,0x43,0x34,0x33,0x44,0x22,0x22,0x23,
+0x12,0x11,0x11,0x11,0x89,0x00,0x21,0x55,0x24,0x42,0x24,0x21,0x34,0x32,0x22,0x20,
+0x91,0xeb,0xac,0xac,0xa9,0xbd,0xba,0xcc,0xab,0xbb,0xca,0x9a,0xbb,0xbc,0xdc,0xba,
+0x9a,0x0a,0xba,0xcb,0x98,0x1a,0x02,0x02,0x46,0x00,0x08,0x08,0xc9,0xcd,0xbb,0xfb,
+0xbc,0x9a,0xaa,0xaa,0x0a,0x38,0x27,0x54,0x22,0x34,0x32,0x53,0x32,0x22,0x01,0x98,
+0xa9,0xac,0xa9,0xa9,0xbd,0x19,0x00,0x00,0x67,0x33,0x03,0x42,0x43,0x02,0x20,0x80,
+0xaa,0xca,0xbd,0xaa,0xbe,0xab,0xcb,0x8b,0x99,0xab,0x88,0x98,0x89,0xbb,0xac,0x91,
+0xff,0x8b,0xa9,0x90,0xdb,0x19,0x98,0xcc,0x09,0x09,0xe8,0x8c,0xa0,0xac,0xac,0x99,
+0x32,0xa8,0x73,0x27,0x52,0x43,0x44,0x33,0x34,0x43,0x23,0x23,0x24,0x11,0x80,0x98,
+0xda,0xbb,0xae,0xab,0xbb,0xac,0xab,0x9a,0x88,0x11,0x40,0x23,0x01,0x08,0xc9,0xcd,
+0xcc,0xbc,0xcc,0xbc,0xbc,0xaa,0xac,0xaa,0x99,0x88,0x80,0x11,0x44,0x33,0x44,0x24,
+0x22,0x22,0x33,0x23,0x33,0x14,0x21,0x33,0x24,0x32,0x45,0x43,0x33,0x34,0x33,0x34,
+0x24,0x22,0x34,0x01,0x33,0x11,0x42,0x03,0x20,0x83,0x09,0xdf,0xca,0xbc,0xcc,0xcb,
+0xcb,0xcb,0xbb,0xbd,0xaa,0xab,0xba,0x9a,0xa9,0x08,0x29,0x91,0x21,0x00,0xf9,0xbc,
+0xcb,0xbb,0xdb,0xcc,0x88,0x9a,0x28,0x32,0x37,0x73,0x32,0x53,0x22,0x14,0x23,0x21,
+0x13,0x11,0x88,0xa8,0xba,0x9c,0xc8,0x88,0x08,0x28,0x43,0x35,0x63,0x32,0x15,0x10,
+0x00,0xa9,0xca,0xbb,0xdc,0xbb,0xae,0xbb,0xba,0x9a,0xaa,0x99,0x89,0x09,0xa8,0x08,
+0x9a,0xd2,0x0a,0xd0,0xcb,0x19,0x09,0xb4,0x28,0x1d,0xa2,0x8e,0x89,0xea,0xbb,0xaf,
+0xaa,0xba,0x9c,0x89,0x01,0x10,0x73,0x44,0x23,0x44,0x53,0x22,0x11,0x32,0x91,0x90,
+0x89,0xbb,0xbc,0xbb,0xbd,0x08,0x08,0x42,0x55,0x32,0x25,0x42,0x23,0x02,0x11,0x90,
+0xf8,0xbb,0xac,0xca,0xbc,0xab,0xa9,0xad,0x88,0x18,0xa8,0x29,0x04,0xaa,0x99,0xaa,
+0xfc,0xdb,0xaa,0xbb,0xbb,0xab,0x98,0x22,0xb9,0x65,0x03,0x38,0x12,0x8b,0xf1,0xbc,
+0xbb,0xac,0xba,0x08,0x32,0x77,0x34,0x54,0x43,0x34,0x34,0x43,0x33,0x33,0x33,0x23,
+0x01,0x98,0xcb,0xcc,0xad,0xac,0xba,0xbb,0xab,0xab,0x0a,0x01,0x31,0x35,0x21,0x31,
+0xc1,0x9c,0xdd,0xdb,0xcb,0xcc,0xbb,0xcb,0xbb,0xab,0xab,0x9a,0x88,0x20,0x44,0x53,
+0x43,0x33,0x24,0x33,0x32,0x22,0x12,0x01,0x81,0x88,0x09,0x11,0x71,0x34,0x52,0x44,
+0x33,0x44,0x32,0x34,0x22,0x23,0x32,0x12,0x11,0x01,0xb9,0xa9,0x8d,0xcc,0xbc,0xcc,
+0xba,0xbc,0xcc,0xca,0xba,0xbc,0xcb,0xaa,0xbb,0xaa,0xa9,0x99,0x89,0x9a,0x00,0x00,
+0xbd,0xc9,0xcd,0xdb,0xbb,0xca,0xbb,0x9b,0x9a,0x18,0x72,0x26,0x43,0x44,0x33,0x33,
+0x34,0x23,0x22,0x03,0x90,0xaa,0xbd,0xdb,0xbb,0x9c,0xaa,0x1a,0x19,0x53,0x42,0x45,
+0x22,0x33,0x24,0x11,0x01,0xa8,0xdb,0xdb,0xbb,0xbc,0xad,0xa9,0x9a,0x88,0x80,0x21,
+0x24,0x51,0x33,0x23,0x33,0x81,0x08,0xd9,0xdb,0xca,0xbc,0xbb,0x09,0xbd,0x98,0xba,
+0x2b,0xa8,0xb9,0xb9,0xcb,0xbe,0x80,0xab,0xca,0x2a,0x91,0x57,0x00,0x52,0x32,0x13,
+0x33,0x49,0x02,0xbb,0xaa,0xf9,0x8f,0x98,0x0a,0x12,0x01,0x73,0x35,0x21,0x33,0x64,
+0x22,0x11,0x11,0x02,0xbb,0xba,0xca,0xdd,0xaa,0xaa,0xa9,0x9a,0x20,0x31,0x11,0x27,
+0x22,0x00,0x13,0x99,0xdc,0xbf,0xaa,0xcd,0xab,0xba,0xcb,0xaa,0x89,0x08,0x00,0x34,
+0x25,0x18,0x33,0x08,0xd0,0x8a,0xba,0xab,0x9d,0x88,0x62,0x74,0x53,0x44,0x43,0x34,
+0x34,0x42,0x22,0x33,0x22,0x11,0x88,0xba,0xbd,0xcc,0xcb,0xac,0xaa,0xab,0x9a,0x89,
+0x10,0x13,0x43,0x53,0x11,0x01,0x99,0xce,0xdb,0xcc,0xcb,0xcb,0xbb,0xbb,0xac,0x99,
+0x99,0x18,0x22,0x53,0x34,0x34,0x53,0x22,0x22,0x11,0x11,0x98,0xa8,0xba,0x9d,0xab,
+0x88,0x28,0x36,0x73,0x33,0x35,0x43,0x34,0x23,0x24,0x21,0x11,0x11,0x81,0x88,0xa8,
+0xac,0xbb,0xbd,0xcb,0xcb,0xab,0xda,0xcb,0xab,0xbb,0xcc,0x9a,0xba,0xac,0xa9,0xba,
+0x09,0xaa,0x01,0xbd,0xfa,0xba,0xcc,0xca,0xbb,0xad,0xbb,0xab,0xba,0x09,0x20,0x26,
+0x44,0x35,0x53,0x23,0x24,0x23,0x12,0x82,0x88,0xc9,0xdb,0xbb,0xdb,0xab,0x9a,0x9a,
+0x20,0x43,0x74,0x32,0x33,0x44,0x22,0x22,0x22,0x80,0x88,0xbc,0xcc,0xca,0xab,0xca,
+0xab,0x98,0x10,0x12,0x44,0x73,0x13,0x21,0x33,0x11,0x08,0x88,0xc9,0xbe,0xbc,0xba,
+0xbc,0xbc,0xba,0x9c,0x99,0xa9,0x00,0x98,0x8a,0xaa,0x12,0xa0,0x09,0x12,0xcf,0x1a,
+0x92,0x08,0x88,0x1a,0xbc,0xe9,0xa0,0xba,0x1c,0xde,0x80,0x38,0x14,0x71,0x35,0x23,
+0x52,0x34,0x33,0x25,0x22,0x12,0x01,0x81,0xba,0xad,0xcb,0xcc,0x99,0x99,0x89,0x90,
+0x30,0x57,0x10,0x42,0x23,0x11,0x18,0x98,0xfb,0xcb,0xca,0xcc,0xbb,0xac,0xaa,0xaa,
+0xca,0x09,0x00,0x01,0x52,0x12,0x24,0x91,0x10,0xa8,0xcd,0xaa,0xcb,0xbd,0x99,0x8a,
+0x42,0x35,0x44,0x45,0x43,0x34,0x43,0x43,0x22,0x33,0x23,0x12,0x90,0x88,0xba,0xce,
+0xab,0xab,0xbe,0xaa,0x8a,0x9a,0x89,0x12,0x22,0x20,0x53,0x81,0xa9,0xfb,0xbd,0xbd,
+0xcc,0xbb,0xbc,0xbc,0xba,0xbb,0x9a,0x99,0x19,0x32,0x34,0x54,0x43,0x32,0x32,0x23,
+0x22,0x11,0x20,0xb9,0xb8,0x08,0xaa,0x09,0x67,0x33,0x44,0x44,0x24,0x43,0x43,0x23,
+0x42,0x22,0x21,0x12,0x02,0x80,0x9b,0xc9,0x9b,0xcd,0xaa,0xbb,0xbe,0xab,0xca,0xba,
+0xab,0xac,0xd9,0x89,0x9a,0xa8,0x89,0xab,0xac,0xeb,0xaa,0xdb,0xcc,0xdb,0xab,0xbb,
+0xcb,0x9b,0xca,0x9a,0x00,0x41,0x32,0x35,0x53,0x23,0x34,0x33,0x12,0x12,0x99,0xca,
+0xaa,0xad,0xad,0xb9,0x9a,0x11,0x42,0x46,0x25,0x43,0x25,0x23,0x53,0x21,0x21,0x01,
+0x00,0xb9,0xb9,0xbc,0xad,0xcb,0xaa,0xaa,0x99,0x08,0x31,0x34,0x24,0x46,0x12,0x21,
+0x21,0x89,0xda,0xbb,0xbc,0xcf,0xba,0xca,0xbb,0xba,0xab,0xbb,0x9b,0x88,0x88,0x32,
+0x72,0x12,0x03,0x63,0x01,0x01,0x08,0xb8,0x9c,0xc8,0xba,0x9f,0xb0,0x88,0x9a,0x1b,
+0x14,0x54,0x43,0x33,0x64,0x33,0x24,0x33,0x43,0x22,0x13,0x20,0x22,0xb8,0xa8,0xbc,
+0xae,0x98,0xdb,0x0a,0x98,0x30,0x16,0x31,0x24,0x83,0x51,0x13,0xaa,0xb1,0xbf,0xdb,
+0xad,0xba,0xeb,0xbb,0xaa,0xcb,0x8a,0xaa,0xaa,0xaa,0x89,0x98,0xbc,0x1b,0xa4,0xbf,
+0x90,0xda,0xbb,0x0a,0xc8,0xa9,0x42,0x43,0x73,0x26,0x44,0x32,0x44,0x43,0x22,0x44,
+0x32,0x12,0x32,0x32,0x01,0x09,0x98,0xfb,0xbb,0xaa,0xdb,0xbc,0x89,0xba,0x9a,0x10,
+0x11,0x11,0x22,0x11,0xaa,0xea,0xfe,0xbb,0xcc,0xdb,0xbb,0xbc,0xbb,0xcb,0xaa,0x99,
+0x89,0x20,0x42,0x33,0x37,0x23,0x24,0x32,0x12,0x12,0x08,0xa0,0xc9,0x8c,0xa9,0x9a,
+0x00,0x73,0x43,0x36,0x43,0x34,0x43,0x43,0x23,0x32,0x23,0x02,0x11,0xa8,0xab,0xcc,
+0xbc,0xbc,0xbb,0xac,0xba,0xac,0x9a,0x99,0xa0,0x18,0x10,0x98,0xba,0xb0,0xcf,0x9a,
+0xdb,0xcd,0xbb,0xcd,0xaa,0xcb,0xcb,0xca,0xab,0x9b,0xaa,0x98,0x88,0x21,0x44,0x53,
+0x34,0x24,0x33,0x24,0x21,0x11,0x01,0xa8,0xbb,0xcc,0xbc,0xab,0xa9,0x0a,0x42,0x65,
+0x43,0x34,0x53,0x33,0x34,0x23,0x33,0x22,0x01,0xa9,0xba,0xde,0xaa,0xcb,0xba,0x9c,
+0x89,0x09,0x10,0x31,0x34,0x63,0x23,0x23,0x22,0x80,0xdc,0xcc,0xaa,0xbe,0xba,0xbc,
+0xbb,0xbc,0xa9,0xa9,0x99,0x18,0x81,0x13,0x62,0x14,0x11,0x12,0x13,0x80,0x89,0x81,
+0xaf,0xbb,0x89,0xb8,0x3b,0x35,0x25,0x30,0x65,0x24,0x22,0x43,0x42,0x14,0x30,0x24,
+0x02,0x20,0x12,0x01,0x98,0x09,0x28,0x9e,0xd9,0x80,0xcb,0x39,0x91,0xd9,0x21,0x61,
+0x11,0x28,0x21,0x94,0x9c,0x18,0xea,0x9d,0xca,0xbc,0xdb,0xab,0xca,0xac,0xaa,0x8a,
+0xbb,0x8a,0x99,0x88,0x10,0x41,0x01,0x49,0x85,0x89,0x09,0xf1,0x9a,0x9c,0xa1,0x8d,
+0x98,0x32,0x32,0x74,0x27,0x32,0x34,0x44,0x24,0x42,0x33,0x33,0x34,0x31,0x32,0x02,
+0x11,0x90,0xa9,0xdb,0xcb,0xbb,0xbd,0xaa,0xbb,0xba,0xa9,0xb9,0x99,0xb2,0xaf,0xb9,
+0xec,0xeb,0xac,0xcb,0xdb,0xbb,0xcb,0xcb,0xab,0xbb,0xab,0x9a,0x0a,0x81,0x21,0x54,
+0x43,0x22,0x25,0x32,0x22,0x32,0x31,0x00,0x90,0x31,0x04,0x39,0x56,0x23,0x55,0x33,
+0x44,0x43,0x33,0x34,0x43,0x22,0x23,0x22,0x10,0x88,0xc8,0xba,0xdc,0xac,0xba,0xda,
+0xaa,0xb9,0xa9,0x89,0x8a,0x18,0x89,0x03,0x11,0x0c,0xfc,0xb9,0xcd,0xab,0xaf,0xba,
+0xcb,0xac,0xbb,0xbb,0xba,0xbb,0x9a,0x19,0x34,0x32,0x27,0x43,0x24,0x34,0x21,0x32,
+0x12,0x21,0x81,0x8a,0xba,0xbb,0xdb,0x0a,0x20,0x54,0x16,0x63,0x32,0x25,0x43,0x32,
+0x33,0x33,0x33,0x02,0x01,0xca,0xac,0xdb,0xbc,0xbb,0xbb,0x9d,0xaa,0x99,0x28,0x00,
+0x63,0x82,0x20,0x32,0xb1,0xac,0xdc,0xda,0xdb,0xbd,0xaa,0xcb,0xaa,0xab,0xab,0xab,
+0x8a,0x98,0x12,0x40,0x33,0x35,0x34,0x30,0x94,0x2b,0x43,0xa9,0x9a,0xd9,0x08,0x2c,
+0x91,0x13,0x72,0x60,0x25,0x22,0x41,0x35,0x22,0x03,0x43,0x33,0x01,0x20,0x10,0xe0,
+0x99,0x09,0xbc,0xcb,0x38,0xba,0xbc,0x11,0x72,0x11,0x00,0x22,0x88,0x18,0x04,0x0b,
+0xfd,0xba,0xbc,0xcc,0xab,0xbc,0xac,0xb9,0x9c,0xaa,0xa8,0x9b,0x28,0x34,0x81,0x38,
+0x26,0x11,0x08,0x72,0xd0,0xaa,0x8a,0x98,0xfa,0x1b,0x80,0x9d,0x08,0x35,0x20,0x32,
+0x37,0x43,0x42,0x44,0x33,0x42,0x33,0x24,0x32,0x33,0x32,0x12,0x13,0x10,0x9a,0xa0,
+0xbc,0xbd,0x0a,0xfb,0x9b,0x80,0xc9,0x0b,0x10,0xf0,0x8c,0x9a,0xca,0xcd,0xab,0xbc,
+0xbc,0xbc,0xbb,0xbd,0xaa,0xbb,0xaa,0xba,0x08,0x88,0x41,0x12,0x43,0x24,0x43,0x12,
+0x12,0x11,0x32,0x0a,0x86,0x80,0x79,0x04,0x43,0x53,0x34,0x43,0x43,0x34,0x14,0x32,
+0x33,0x22,0x11,0x12,0x88,0xb9,0xbf,0xa8,0xbc,0xab,0xab,0xac,0xca,0x09,0x02,0x1b,
+0x31,0x05,0x01,0x0b,0xb1,0xfa,0xaf,0x99,0xcc,0xbc,0xab,0xab,0xec,0xa9,0x9a,0xaa,
+0xb9,0x88,0x81,0x1a,0x32,0x26,0x12,0x46,0x10,0x10,0x03,0x20,0x20,0xa8,0x80,0xf8,
+0x0a,0xb9,0x18,0xb8,0x9b,0x57,0x12,0x31,0x37,0x23,0x23,0x45,0x22,0x22,0x12,0x11,
+0x90,0x18,0xca,0xbd,0xa8,0xac,0xba,0xbb,0x00,0x89,0x42,0x52,0x44,0x14,0x00,0x20,
+0x80,0xad,0x91,0xdc,0xbd,0xca,0xba,0xcb,0xac,0x98,0xa9,0xbc,0x08,0x98,0x02,0x19,
+0x20,0x80,0x24,0x8c,0x03,0xd0,0x1d,0xb0,0xa1,0x1b,0xec,0x08,0x88,0x21,0x00,0x62,
+0x38,0x07,0x08,0x27,0x10,0x08,0x33,0x23,0x94,0x1a,0x41,0xb0,0x99,0x24,0x99,0x29,
+0x43,0xc9,0x30,0x47,0x08,0x20,0x33,0x21,0x83,0x20,0x3c,0xf4,0x0a,0x9b,0xc9,0x9a,
+0xdc,0xa8,0x9b,0x19,0xa1,0x0c,0x09,0x83,0x2a,0xf8,0x3b,0xc8,0xa9,0xbc,0xcf,0xa8,
+0x0b,0xa9,0xcc,0x88,0x8a,0x00,0x1a,0x32,0x22,0x9a,0x57,0x11,0x34,0x34,0x14,0x52,
+0x35,0x42,0x31,0x45,0x23,0x21,0x54,0x22,0x21,0x43,0x22,0x22,0x11,0x22,0xa0,0x99,
+0x29,0xbf,0xaa,0xdb,0xab,0xcc,0x9a,0xc8,0xad,0xaa,0xba,0xeb,0xba,0xaa,0xbd,0xbb,
+0xbb,0xdb,0x9c,0xa9,0xba,0x8c,0xa8,0xab,0x80,0xaa,0x09,0x31,0x73,0x12,0x42,0x35,
+0x24,0x43,0x32,0x24,0x53,0x42,0x32,0x24,0x24,0x32,0x11,0x23,0x23,0x43,0x34,0x02,
+0x8a,0x28,0xb3,0x9d,0x10,0xa9,0xba,0xaf,0x09,0xfb,0x8b,0xa8,0xad,0xa8,0xbc,0xb9,
+0xaa,0xaf,0xb8,0xbc,0xa8,0x9c,0xca,0x80,0xca,0x8c,0x90,0x0a,0xa0,0x1c,0x98,0xd9,
+0x20,0x21,0xc0,0x99,0x12,0x1e,0x03,0x10,0x21,0x1c,0x27,0x23,0x1a,0x37,0x98,0x00,
+0x21,0x21,0xb2,0x2d,0x90,0xa8,0xa8,0x08,0x4a,0xf9,0x38,0x21,0xb8,0x54,0x27,0x21,
+0x30,0x15,0x10,0x41,0x00,0x12,0x51,0x80,0x88,0xba,0x01,0x0e,0xf0,0x89,0xa9,0x88,
+0x1b,0x11,0xe0,0x09,0x9c,0x88,0x89,0xb0,0xca,0xae,0xcb,0xcc,0x98,0xcb,0xbb,0x09,
+0xca,0xd9,0x1a,0xab,0x98,0x11,0x33,0x9a,0x02,0x34,0xcd,0x34,0x68,0xa9,0x12,0xba,
+0xab,0x68,0xb1,0xaa,0x28,0x11,0x71,0x92,0x36,0x32,0x44,0x23,0x44,0x31,0x11,0x42,
+0x04,0x10,0x81,0x80,0xfb,0x0a,0x88,0x9b,0x9b,0x90,0x30,0x5b,0x02,0x57,0x22,0x42,
+0x83,0x32,0x21,0x8a,0xf2,0x1c,0xac,0xbc,0xbb,0xbe,0xa8,0xac,0x98,0x89,0x80,0x50,
+0x13,0x33,0x52,0x21,0x05,0x88,0x18,0xd9,0xaa,0xcb,0xcb,0xbe,0x99,0xa9,0x9a,0x10,
+0x31,0x40,0x37,0x43,0x52,0x12,0x44,0x02,0x32,0x23,0x20,0x14,0x31,0x21,0x33,0x25,
+0x32,0x53,0x42,0x14,0x31,0x17,0x01,0x01,0x32,0x91,0xaa,0x98,0xbe,0xaa,0xdf,0x99,
+0xab,0xbb,0xdb,0x9b,0xbb,0xad,0xba,0xbb,0xbb,0xbc,0xdb,0x99,0xcb,0x19,0xa8,0x9a,
+0x11,0x00,0xbb,0x53,0x02,0x46,0x81,0x52,0x91,0x44,0x01,0x32,0x42,0x53,0x22,0x73,
+0x21,0x32,0x24,0x30,0x23,0x13,0x04,0x20,0x88,0x99,0xca,0xb9,0x98,0xaf,0xb9,0xa9,
+0xba,0x0f,0xa1,0x19,0xc9,0x98,0x8d,0x99,0xc0,0xbc,0xa9,0xaf,0xaa,0xcb,0xab,0xb8,
+0x8f,0x99,0xa9,0x08,0xbb,0x8a,0x82,0xa9,0x51,0x91,0x90,0x29,0xa1,0x35,0xb8,0xaf,
+0xa3,0x8f,0xa2,0xa9,0x91,0x1c,0xd1,0x28,0x00,0x56,0x00,0x40,0x43,0x81,0x35,0x20,
+0x12,0x23,0x42,0x31,0x91,0x1a,0xa2,0x28,0x09,0xaf,0x15,0x19,0x30,0x15,0x28,0x23,
+0x32,0x14,0x71,0xb1,0x08,0xcb,0x1b,0xec,0xba,0xac,0x9c,0xb9,0xbc,0x99,0xac,0x99,
+0x88,0xaa,0xaa,0x08,0xf8,0x48,0x90,0xa2,0x19,0xad,0xd0,0xab,0xb8,0x8c,0x9a,0xe0,
+0x20,0x0c,0x22,0x11,0x11,0x71,0x11,0x24,0x33,0x26,0x91,0x50,0x13,0x18,0xa2,0x25,
+0xa9,0x3a,0x84,0x98,0x78,0x98,0x81,0x34,0x72,0x11,0x11,0x13,0x33,0x40,0x00,0x84,
+0xa9,0x41,0x93,0xbf,0x00,0x9b,0x99,0xb9,0x3c,0xf3,0x2a,0x81,0x41,0xd0,0x30,0x52,
+0xc0,0x00,0x19,0xa1,0x89,0x91,0xbe,0x9b,0x8a,0xc0,0xce,0x8b,0x88,0xa8,0x4b,0xc0,
+0x00,0x40,0xd0,0x30,0x30,0xa3,0x93,0x58,0xb2,0x0c,0x8a,0xc5,0x9d,0x9b,0xc9,0xaa,
+0x28,0xc0,0x2a,0x1a,0x57,0x01,0x60,0x01,0x00,0x20,0x12,0xa1,0x88,0x54,0x90,0x09,
+0x16,0x21,0x20,0x45,0x24,0x21,0x63,0x22,0x22,0x11,0x00,0x88,0xc0,0xca,0x9e,0xb8,
+0xcc,0x9a,0xaa,0xaa,0x9e,0x81,0x88,0x9a,0x28,0xa2,0x0d,0x12,0x81,0xcd,0x8b,0xa8,
+0xac,0xeb,0x8b,0x99,0x39,0x81,0x89,0x72,0x13,0x34,0x28,0x34,0x26,0x14,0x19,0x91,
+0x20,0x15,0xa8,0x08,0x20,0x83,0xbb,0x9d,0x22,0x17,0x99,0xaa,0x1a,0xa2,0x8c,0xb8,
+0xae,0x88,0x89,0xbf,0x89,0xa0,0x9f,0xb9,0xc9,0x0a,0x9a,0xd8,0x8b,0x98,0x01,0x0f,
+0x02,0x98,0x1a,0x33,0x11,0x01,0x45,0xa9,0x49,0x13,0x80,0x6a,0x84,0x0a,0xa8,0x38,
+0x14,0x09,0x58,0x80,0x06,0x09,0x1a,0x80,0x86,0x28,0x0d,0xc0,0x22,0x80,0x9a,0xae,
+0x90,0x3a,0x95,0x9c,0x49,0xfa,0x88,0x11,0x01,0x08,0x06,0xab,0x52,0x03,0x21,0x12,
+0xa8,0x08,0x47,0x10,0x88,0x03,0x0a,0x10,0x25,0x81,0x01,0x9e,0xba,0x22,0x79,0xca,
+0x91,0x1b,0xbb,0xc3,0x0c,0xaa,0xa0,0x9e,0xa1,0x98,0x9b,0x9b,0xc5,0x1c,0xb0,0x49,
+0xd9,0x10,0xba,0xbd,0x81,0x1a,0xb9,0x98,0x2e,0xa4,0x19,0x01,0x59,0x84,0x83,0x49,
+0x01,0x72,0x08,0xb1,0x51,0x89,0x18,0x93,0x29,0xb9,0x69,0xc1,0x51,0x10,0x11,0x17,
+0x28,0x83,0x12,0x62,0x88,0x21,0x48,0xb3,0x39,0x89,0x10,0xe3,0x9d,0xb0,0x8d,0x00,
+0xbb,0x96,0x8d,0x82,0x0b,0x8a,0x92,0x83,0x0b,0x93,0x0f,0x41,0xb3,0x12,0x5b,0x99,
+0xa1,0xad,0x92,0xda,0x1f,0x80,0xc1,0x39,0x31,0x02,0x00,0x57,0x21,0x28,0x15,0x00,
+0x80,0x18,0x9e,0x92,0x8d,0x88,0xb9,0x0a,0x81,0x9a,0x80,0x12,0x43,0x69,0x96,0x30,
+0xa9,0xc9,0x8a,0x9d,0xb9,0xc9,0xc0,0x1e,0x80,0x28,0x82,0x72,0x32,0x32,0x44,0x25,
+0x24,0x22,0x22,0x15,0x20,0x32,0x33,0xd0,0x29,0xd8,0xaa,0xbc,0xab,0xbd,0xeb,0xaa,
+0xaa,0x9b,0x9a,0x02,0x10,0x89,0x26,0x11,0x43,0x00,0x88,0xa0,0xcf,0xda,0xba,0xbb,
+0xc9,0xbb,0x8a,0x11,0x51,0x14,0x55,0x22,0x43,0x34,0x02,0x31,0x80,0x88,0xcb,0xaa,
+0xbc,0xce,0xaa,0x88,0x9b,0xb9,0x22,0x53,0x33,0x53,0x41,0x04,0x23,0x09,0xca,0xb9,
+0xa9,0xaf,0xbc,0xcb,0xba,0xbb,0x89,0x9a,0x88,0x44,0x50,0x23,0x14,0x24,0x42,0x12,
+0x11,0x80,0xa8,0x2b,0xdb,0xd9,0x9a,0xba,0xbb,0x8e,0xa1,0x00,0x18,0xc1,0x6a,0x33,
+0x25,0x52,0x81,0x48,0x11,0x13,0x53,0xc2,0x2a,0x80,0x8a,0xcb,0xb8,0x8d,0x9b,0xb8,
+0xa1,0x2a,0x3d,0x17,0x32,0x30,0x42,0x15,0x23,0x22,0x88,0xba,0xaa,0x8b,0xfe,0xbb,
+0xaa,0xac,0x9b,0x81,0x30,0x3a,0x16,0x25,0x24,0x31,0x30,0x94,0x98,0x9d,0xca,0xba,
+0xbe,0xcb,0xb9,0x9a,0xaa,0x99,0xb0,0x40,0x24,0x24,0x31,0x36,0x11,0x82,0x10,0x9a,
+0xe0,0x80,0xba,0xbd,0xba,0xa9,0xae,0x90,0x9b,0xa1,0x7a,0xa4,0x32,0x08,0x24,0x11,
+0x35,0x83,0x68,0x11,0xa1,0x11,0xdb,0xab,0x93,0x8c,0xa9,0x00,0xb0,0x70,0x14,0x32,
+0x22,0x70,0x83,0x52,0x91,0x38,0x09,0xa4,0x0c,0xcb,0x98,0x98,0x98,0xaf,0xa8,0x08,
+0x11,0x4d,0x91,0x16,0x00,0x28,0x01,0x08,0xa0,0x42,0xdb,0x8c,0xc0,0x8a,0x80,0x00,
+0x4a,0x84,0x20,0x36,0x20,0x23,0x32,0x27,0x31,0x99,0x10,0xa3,0x2b,0xfb,0x9b,0x0c,
+0x98,0xf9,0x29,0xa9,0xac,0x10,0xb0,0x04,0x38,0x8b,0xa1,0x27,0xa1,0x8a,0x50,0x0c,
+0xf1,0x09,0x82,0x0f,0x80,0xa0,0x09,0x29,0x06,0x88,0x10,0x12,0x00,0x02,0xa1,0x89,
+0xa2,0x18,0xbf,0x98,0xfc,0x9e,0x0b,0x82,0x8b,0x00,0x91,0x40,0x38,0x82,0x47,0x15,
+0x28,0x03,0x32,0x03,0x18,0x21,0x94,0x10,0x10,0x82,0x0f,0x26,0x8a,0x95,0x1b,0x99,
+0x21,0xa1,0x68,0x9b,0x91,0x9b,0x20,0x92,0xc8,0x3c,0x57,0x08,0xa8,0xb8,0x2d,0xd1,
+0x08,0xb8,0x29,0xba,0xb8,0xba,0x5c,0xa2,0x31,0x25,0x19,0x04,0x63,0x02,0xa9,0x18,
+0xa3,0x1d,0x81,0xf1,0x9d,0x98,0x81,0x88,0xa8,0x24,0x10,0x04,0xc9,0x18,0x1a,0xf4,
+0x1b,0xb8,0xdb,0x88,0xc9,0xbb,0x89,0xac,0xa0,0x00,0x00,0x10,0x17,0x38,0x82,0xa7,
+0x18,0x39,0x1a,0xb7,0xac,0x28,0x90,0x29,0xde,0xc0,0x31,0x0b,0xb0,0x00,0x21,0xdb,
+0x20,0x8c,0x10,0x12,0x09,0x00,0xb9,0xda,0x59,0x51,0xb0,0x19,0xf0,0x0a,0x89,0xb3,
+0x4a,0x88,0xc2,0x2b,0xa8,0x4c,0xc4,0x20,0xa3,0x1d,0x33,0x13,0xb8,0x19,0x79,0x07,
+0x08,0x00,0x99,0x36,0x8a,0x88,0x06,0x0a,0x01,0xd0,0x29,0x89,0x13,0xf8,0x28,0x99,
+0xb2,0x61,0xa0,0x90,0x00,0x8e,0x05,0x99,0x41,0x9a,0x91,0x32,0x8c,0x81,0x02,0x59,
+0xa9,0x0a,0x05,0x0e,0x92,0xc8,0x28,0x12,0xcb,0x3a,0x96,0x32,0x3b,0x50,0xb5,0x58,
+0x81,0x19,0x11,0xc1,0x20,0x98,0x10,0x8b,0x16,0xac,0x11,0x18,0xf0,0x98,0x4a,0xb0,
+0x81,0x29,0x01,0x48,0xb3,0x21,0x71,0x93,0x0b,0x42,0x96,0x8c,0x10,0xea,0x99,0x02,
+0x28,0xcb,0x83,0x02,0x9e,0x21,0x83,0x11,0x0b,0xf8,0x0d,0x88,0x00,0xcc,0x88,0x01,
+0xcb,0x10,0x90,0xa0,0x8a,0x54,0xfb,0x81,0x2c,0x03,0xb0,0x51,0x53,0x23,0x61,0x25,
+0x22,0x43,0x42,0x21,0x22,0x82,0xcb,0xba,0xbd,0x9d,0xeb,0xca,0xba,0x9b,0xb9,0x0a,
+0x82,0x08,0x61,0x13,0x22,0x63,0x24,0x08,0x88,0x18,0x9a,0x99,0xc8,0xc8,0x9f,0x01,
+0x18,0x23,0x55,0x21,0x33,0x25,0x11,0x28,0x91,0x98,0xbe,0xcd,0x9a,0xaa,0xa8,0xbc,
+0xab,0x88,0x09,0x88,0x60,0x25,0x32,0x02,0x20,0x05,0x18,0x91,0x08,0x29,0xba,0x20,
+0x91,0xf8,0x2a,0xbb,0xa3,0x46,0xb8,0x1b,0x33,0xb2,0x9f,0x03,0x61,0x21,0xd9,0x49,
+0x16,0x08,0x11,0xb8,0x88,0x29,0xab,0xbd,0xc0,0xbd,0x8a,0xa1,0x19,0x30,0x57,0x01,
+0x11,0x33,0x15,0x52,0x90,0x00,0xb9,0x90,0xbf,0xb0,0xbb,0xcb,0x89,0xcd,0x19,0x00,
+0x98,0x33,0x9a,0x24,0x42,0x00,0xab,0x08,0xca,0xcf,0x10,0x20,0x81,0x90,0x51,0xa0,
+0x45,0x30,0x13,0x84,0x49,0x89,0xb1,0x11,0xb9,0xde,0x9c,0xb1,0x8b,0x01,0xb8,0xcf,
+0x00,0x10,0xa8,0x9b,0x53,0xb0,0x9a,0xa8,0x0a,0x57,0x89,0x38,0x23,0x82,0x64,0x20,
+0x01,0x81,0x91,0x42,0x8f,0xc0,0x0a,0x18,0xa8,0x02,0x1a,0x92,0x35,0x01,0x48,0x01,
+0xb3,0x68,0xdb,0x08,0xfa,0x89,0x9c,0x80,0xa9,0x9b,0x08,0x08,0x73,0x25,0x32,0x21,
+0x26,0x00,0x48,0xa0,0x22,0xaa,0xa0,0xaa,0xfb,0x3b,0xf9,0x88,0x89,0x10,0x18,0x9a,
+0xf2,0x0b,0x22,0x2a,0x99,0xd4,0x30,0x9d,0x00,0x89,0xc2,0x71,0x80,0x20,0xaa,0x22,
+0x32,0x81,0x9f,0x01,0x06,0x10,0x10,0xaa,0x42,0x11,0xa1,0x26,0x8d,0x92,0x91,0x8c,
+0xd8,0x0a,0xb9,0x9b,0xd9,0x09,0x2b,0xd0,0x00,0x72,0x18,0x14,0x01,0x38,0x00,0xd8,
+0x80,0x99,0xbc,0x80,0x8c,0x42,0x81,0x91,0x71,0x07,0x20,0x13,0x13,0x00,0x01,0x88,
+0xfa,0x11,0x8e,0x80,0x9a,0xa1,0x0b,0x20,0x91,0x28,0x37,0x25,0x0c,0x15,0x00,0x89,
+0x00,0x02,0xa8,0x69,0x91,0x88,0x83,0x39,0x0b,0x82,0x87,0x9f,0xbb,0xa0,0xaf,0xaa,
+0xbc,0x89,0x99,0x88,0xaa,0x42,0x83,0x71,0x28,0x94,0x43,0x0a,0x02,0x83,0x0b,0x15,
+0x52,0x88,0xb1,0x71,0x01,0x09,0x98,0x24,0xb0,0x2b,0xd9,0x8b,0xc9,0xba,0xc9,0x8f,
+0x0a,0xb9,0x13,0x2b,0x05,0x12,0x88,0x70,0xa4,0x22,0x2b,0xc2,0x0c,0xb1,0x30,0x9b,
+0x20,0xc4,0x58,0x42,0x83,0x98,0x35,0x00,0x08,0x24,0xcf,0xa9,0x22,0x9f,0x90,0xb1,
+0x0b,0x11,0x88,0xb4,0x3c,0x81,0x83,0x39,0x0a,0xf1,0x8a,0xc8,0x5a,0x81,0x23,0x40,
+0x41,0x01,0x48,0x73,0xa2,0x28,0x88,0x00,0xa0,0xd8,0x9c,0xaa,0x9b,0xc0,0xab,0x3c,
+0xb2,0x91,0x0f,0x30,0x01,0xd8,0xa0,0x9e,0x0b,0xa0,0xbc,0x29,0x11,0x11,0x49,0x21,
+0x50,0x24,0x10,0x63,0x83,0x1b,0xf8,0x39,0xea,0x19,0xa0,0x8b,0xaa,0x91,0x10,0x28,
+0xc3,0x39,0x11,0xc0,0x03,0xbf,0xaf,0xa8,0x82,0x8b,0x2b,0xa0,0xb4,0x73,0x45,0x02,
+0x22,0x80,0x18,0x20,0x89,0x37,0x9a,0xe1,0x2a,0xac,0xa0,0x03,0x2c,0x91,0x14,0x12,
+0x21,0x33,0x83,0x00,0x32,0xff,0x08,0x0a,0xdb,0x31,0xba,0xa9,0x46,0xa2,0x3a,0x83,
+0x32,0x12,0x05,0x38,0x32,0x50,0xf1,0x10,0x09,0xbc,0x01,0xae,0xa0,0x2b,0x26,0xb9,
+0x10,0xa0,0x33,0x9a,0xdb,0x03,0x2b,0xfb,0x13,0x2c,0xb1,0x60,0xc0,0x01,0x19,0x29,
+0x31,0x87,0x0a,0xb1,0x1b,0x30,0x94,0x0b,0x16,0x92,0x2b,0x0f,0x85,0x88,0x41,0x10,
+0xd9,0x18,0x00,0xad,0x14,0x2a,0xbb,0x31,0xb5,0x3a,0x1a,0xc4,0x39,0xa0,0x72,0xc1,
+0x19,0x04,0x1a,0x86,0x19,0x01,0x91,0x1a,0x90,0x19,0x90,0xa1,0xf9,0x59,0xea,0x01,
+0x0a,0x80,0xda,0x20,0xd2,0x3b,0x98,0x02,0x18,0x26,0x99,0x88,0x29,0xb1,0x30,0x74,
+0xd8,0x21,0x81,0x18,0x0a,0x8b,0xd4,0x52,0x3a,0xb2,0x89,0x11,0x99,0x99,0xaf,0x91,
+0x1a,0x0b,0xf2,0x1e,0xa9,0x85,0x1a,0x11,0x59,0xa1,0x12,0x63,0x08,0x13,0xc8,0x0a,
+0xca,0x88,0x8b,0x99,0x91,0xdb,0x7b,0xa2,0x19,0x0a,0xc0,0xc2,0x2c,0xd9,0x09,0x92,
+0xba,0x8e,0x48,0xa0,0x0c,0x85,0x80,0x18,0x39,0x93,0x57,0x19,0x08,0xa3,0x39,0x80,
+0xd0,0xac,0x2b,0x10,0x90,0x1c,0x25,0x9b,0x88,0x25,0x82,0x8e,0xa3,0x8b,0x09,0xa9,
+0x0c,0xc1,0x04,0x9f,0x98,0x12,0x90,0x39,0x78,0xc2,0x30,0x23,0x19,0xe3,0x08,0x0a,
+0xda,0x09,0xa0,0x80,0x0e,0x00,0x29,0xc2,0x20,0xb0,0x5c,0xb1,0x42,0xba,0xd1,0x6b,
+0x00,0xb1,0x31,0x00,0x3a,0x99,0x33,0x27,0x19,0x01,0x6a,0x84,0xb9,0x18,0x1b,0xf8,
+0x82,0x3c,0x08,0xa8,0xa5,0x0a,0x1b,0xa1,0xc4,0x2a,0x53,0xb9,0x01,0xa2,0x29,0xfe,
+0x10,0x90,0x18,0x30,0x87,0x8a,0x29,0xb0,0x30,0x31,0x82,0xbf,0x82,0x19,0x73,0xa9,
+0x20,0x92,0x70,0x90,0x88,0xda,0x63,0x10,0x99,0x82,0x99,0x1e,0x83,0x81,0x88,0x1e,
+0xc3,0x21,0xa2,0x3b,0x98,0xc3,0x42,0x0e,0x82,0x88,0xb2,0x0d,0x8a,0x52,0xb2,0x2a,
+0x58,0xea,0x33,0x98,0x31,0x00,0xe3,0x51,0x10,0x00,0x88,0xd8,0x21,0x2a,0x88,0xb4,
+0x3a,0x42,0xd4,0x8c,0xa9,0xb1,0x0d,0x91,0x0a,0xa2,0x03,0x78,0x82,0x70,0x90,0x92,
+0x1a,0xb0,0xb9,0x7a,0x98,0xb0,0x11,0x80,0x98,0x9f,0x81,0x22,0x17,0x29,0xb9,0x10,
+0xda,0x43,0x1b,0x89,0xb6,0x18,0x0d,0xc0,0x09,0x89,0x25,0xa8,0x1a,0xb2,0x40,0x38,
+0x82,0x3a,0xf8,0x12,0xc0,0x1f,0x03,0x00,0x89,0x03,0x5b,0xa9,0x89,0xb6,0x2b,0xc0,
+0x9b,0x09,0x8c,0xc3,0x53,0x1b,0xc0,0x2a,0x23,0x07,0x20,0x10,0xba,0xcb,0x17,0x1b,
+0x09,0xc0,0x11,0x8e,0x00,0x81,0x38,0x21,0xfa,0x29,0x80,0x20,0xc1,0x10,0xba,0xc8,
+0xa8,0xbc,0x9e,0x93,0x2d,0x13,0xa2,0x18,0x60,0xbc,0x02,0x3a,0xc3,0x8a,0x1b,0x0b,
+0x17,0x07,0x0b,0x0a,0xc1,0x01,0xbc,0x12,0x1a,0xc1,0x32,0xd2,0x19,0xf1,0x28,0x28,
+0xa9,0xb2,0x2a,0x3a,0x15,0x30,0x03,0xa5,0x0f,0xa9,0x13,0xa8,0x6a,0x13,0xc8,0x28,
+0x13,0x9f,0x01,0x80,0x32,0xd3,0x11,0x40,0x22,0x23,0xf0,0x9b,0x83,0x2c,0x82,0xfa,
+0x39,0x38,0xac,0xb1,0x72,0x29,0xb0,0x02,0x89,0x11,0x9d,0xa8,0x86,0x38,0xca,0xb0,
+0x81,0x0a,0x4b,0xd0,0xb8,0x6b,0x12,0x93,0x63,0x09,0xb3,0x7a,0x84,0x08,0x29,0x02,
+0x82,0x60,0xb1,0x8b,0x03,0x14,0x9d,0x81,0x83,0x29,0x8e,0x98,0x27,0x8a,0xa8,0xa1,
+0x0a,0x0b,0xb7,0x3a,0x81,0x29,0xa1,0x2b,0xb0,0xf9,0x8b,0x03,0x8e,0xa8,0xb3,0x73,
+0xa9,0x89,0x84,0x20,0x9a,0x5b,0xf8,0x02,0x1c,0x12,0xd1,0x80,0x8e,0x80,0x91,0x31,
+0x80,0x9a,0x00,0x93,0x7c,0x80,0x90,0x81,0x49,0x12,0xa3,0x08,0x10,0x29,0x71,0xc1,
+0x32,0xbb,0x1c,0xb1,0xb9,0x0f,0x80,0xd8,0x18,0x74,0xb0,0x32,0x21,0xea,0x23,0x0b,
+0x91,0x20,0xca,0x34,0xa3,0x5a,0xb1,0x01,0x8b,0x84,0xbb,0x0e,0xe1,0x12,0xe9,0x38,
+0xa8,0x98,0x81,0x21,0xa2,0xcf,0x93,0x99,0x99,0x11,0x0c,0x94,0x0b,0x26,0x9a,0x08,
+0xa3,0x3c,0x09,0x15,0x9c,0x73,0xc1,0x18,0x01,0x01,0x2c,0xd3,0x21,0xab,0xd9,0x8a,
+0x98,0x20,0x0a,0x85,0x9c,0x15,0x8a,0x3a,0xd2,0x10,0x12,0x0d,0x90,0x99,0xf9,0x00,
+0x2a,0xca,0xa2,0x0c,0x21,0x10,0x44,0x9b,0xd1,0x2b,0x86,0x1a,0x31,0xbc,0x93,0x98,
+0x3b,0xc0,0x50,0x90,0x16,0x9c,0x91,0x20,0x22,0x09,0x27,0x08,0x43,0xac,0xa4,0x0a,
+0x69,0xb1,0x08,0x01,0x19,0x13,0x92,0x79,0xb2,0xe1,0x50,0x1b,0xa2,0xa1,0x49,0xaa,
+0x92,0x9c,0x82,0x60,0x91,0x25,0x0a,0x18,0xb2,0x94,0x2c,0x38,0xba,0xa7,0x98,0x1a,
+0xa8,0x91,0x19,0x11,0xd5,0x9e,0x21,0x12,0xe9,0x9b,0x25,0x08,0x18,0x32,0x92,0xdd,
+0x41,0x98,0x9a,0xa1,0x92,0x0e,0x10,0x02,0xb1,0x22,0x1d,0x29,0xe1,0x02,0x9a,0x13,
+0x78,0xf2,0x18,0x00,0xa1,0x09,0x09,0x34,0xd0,0x1a,0x23,0xc0,0x09,0x5b,0xd3,0x28,
+0x29,0x88,0xfb,0x11,0x10,0x21,0x8e,0x82,0xb1,0x12,0x8f,0x91,0x11,0x28,0xb4,0x0e,
+0x80,0x1a,0xa8,0xc9,0x13,0x18,0x24,0x2a,0xfb,0x32,0x80,0x30,0x50,0x38,0x97,0xaa,
+0x08,0x4a,0xa2,0x83,0x09,0xd9,0x50,0x88,0xd2,0x08,0x53,0x9a,0x9b,0x90,0xa5,0x9a,
+0x0c,0x50,0xc0,0x81,0xb8,0x3b,0xa9,0x48,0xc3,0x0b,0x32,0x44,0xab,0xc2,0x43,0xbc,
+0x9e,0x92,0x8d,0x13,0x02,0x10,0x09,0xc5,0x30,0x9e,0x41,0x99,0x90,0x98,0x49,0x2b,
+0xe0,0x03,0x20,0x29,0x22,0x9d,0x06,0x00,0x99,0x1a,0xd3,0x21,0x90,0x8b,0x88,0x0f,
+0x16,0x9b,0x98,0x1a,0x93,0x9c,0x30,0xda,0x00,0x08,0x42,0xa0,0x22,0xef,0x11,0xa8,
+0x19,0x4b,0xb9,0x93,0x54,0x19,0x1a,0x96,0x88,0x11,0x99,0xc1,0x8c,0x85,0x42,0xab,
+0x83,0x18,0x0b,0xf9,0x34,0x8c,0x01,0x91,0x88,0x78,0xb8,0x88,0x30,0x19,0xf3,0x18,
+0x92,0x80,0x0d,0x8a,0x22,0xa2,0x70,0x09,0x83,0xa8,0x20,0xeb,0x12,0x04,0x9a,0x1d,
+0xf1,0x21,0xab,0x30,0xea,0x11,0x20,0x19,0x80,0x13,0xc1,0x0d,0x23,0x9b,0xe1,0x21,
+0x9d,0x90,0x33,0x7c,0xb1,0x81,0x18,0x89,0x80,0xcc,0x03,0x41,0x89,0x98,0x27,0xa8,
+0x20,0x9b,0x09,0x16,0x83,0x3a,0xb3,0x1f,0x92,0x32,0xa1,0x3d,0x40,0xc3,0xb9,0x18,
+0x2a,0x81,0xa2,0x73,0x8c,0x8c,0x87,0x1b,0x10,0x89,0xc3,0x69,0x98,0xa9,0x39,0xd1,
+0x40,0x98,0x08,0x85,0x2b,0xf9,0x08,0x00,0x49,0xd1,0x10,0x12,0x8b,0x81,0x88,0x04,
+0x01,0xbc,0x2d,0xe2,0x28,0x98,0xb8,0x30,0x22,0xb3,0x15,0x9e,0x40,0x82,0xa1,0x08,
+0x11,0x4b,0xa2,0x17,0x0a,0x89,0x95,0x21,0xbc,0x0d,0x13,0x88,0x08,0x81,0xcf,0x91,
+0x81,0x2c,0x85,0x08,0x0a,0xb2,0x22,0x8a,0x5b,0xa2,0x91,0xf1,0x6b,0xa8,0xa3,0x59,
+0x0a,0x11,0x90,0x98,0x0e,0x90,0x0b,0x07,0x11,0x10,0x8e,0xb2,0x29,0x30,0xdb,0xb9,
+0x83,0x8c,0x31,0x33,0x05,0x08,0x8f,0xa1,0x09,0x90,0x2d,0xe8,0x91,0x29,0x4a,0x82,
+0x21,0xb4,0x4a,0x8a,0xa8,0x52,0x19,0x89,0x27,0xbb,0x08,0x18,0xc4,0x59,0x90,0x22,
+0x9b,0x8c,0x94,0x88,0x0f,0x80,0x98,0x12,0x41,0x1b,0xa3,0xa8,0xb9,0x21,0x75,0x89,
+0x91,0x88,0xba,0x29,0xae,0x5b,0x95,0x1a,0xa0,0x88,0x25,0x99,0xd0,0x02,0x40,0x0a,
+0xa3,0x61,0xb9,0x38,0x12,0xa3,0x8d,0xa8,0x78,0xd9,0x00,0x08,0x9a,0x43,0x0a,0xda,
+0x91,0x73,0x08,0x83,0x89,0x09,0x43,0xa3,0xa9,0x5d,0xb0,0xa8,0x70,0xa8,0x21,0x99,
+0x33,0x9c,0x19,0x85,0x1e,0x04,0x90,0x9b,0x10,0xc1,0x2a,0xa8,0xd4,0x38,0x39,0x98,
+0x87,0x1a,0x94,0x89,0x9d,0x02,0xcb,0x10,0x4b,0xb2,0x09,0x03,0x1f,0x00,0xc8,0x42,
+0x11,0x9e,0x13,0x08,0x09,0xd2,0x8a,0x28,0xe1,0x58,0xa8,0x21,0x81,0x8a,0x86,0x0b,
+0x59,0xd2,0x18,0x1c,0xb2,0x09,0x1a,0xba,0xa5,0x68,0x90,0x19,0x0a,0xa5,0x28,0x80,
+0x79,0xb1,0xa8,0xc9,0x29,0x22,0x9f,0x23,0xa8,0x88,0x52,0x89,0xc2,0x32,0x50,0x99,
+0x95,0x2a,0xb0,0x21,0x08,0x03,0x05,0x3a,0xfb,0x40,0xa0,0x10,0xb0,0x9e,0x02,0x19,
+0x80,0xc8,0x38,0x70,0xb3,0x0c,0x82,0xa8,0x1c,0xa3,0x58,0x33,0xbf,0x21,0xb0,0x1b,
+0x49,0x05,0xc1,0x09,0x1b,0x39,0xa6,0x09,0x42,0xba,0x21,0xa8,0xe8,0x99,0x32,0x4a,
+0x1d,0xa5,0xa0,0x29,0x29,0xd9,0xa9,0xba,0x10,0x70,0xa9,0x82,0x90,0x39,0xfb,0x48,
+0xda,0x18,0x92,0x41,0x09,0x23,0xb2,0x4a,0x30,0x9b,0x36,0x0a,0xda,0xb3,0x0c,0x2e,
+0x91,0xa5,0x39,0x90,0x3b,0xc1,0xb2,0x2a,0x28,0x4b,0x90,0x87,0x15,0x0c,0xa8,0x71,
+0xb8,0x83,0x1c,0x9e,0x13,0xa0,0x32,0xa0,0x4a,0xa1,0x06,0x19,0xaa,0xa1,0xab,0x68,
+0x82,0xc9,0x0b,0x93,0x3a,0xb8,0x73,0xa3,0x83,0x04,0x2f,0x90,0x13,0x18,0x3b,0xd4,
+0x21,0x90,0x0f,0x83,0x89,0x0a,0x84,0x20,0xb8,0x91,0x79,0xc4,0x11,0x10,0x8d,0x80,
+0x89,0xb0,0x31,0x8f,0xb2,0xb8,0x5b,0x92,0x18,0x9b,0xe3,0x3a,0x08,0x41,0xd0,0x20,
+0xb3,0xaf,0x88,0xa1,0x43,0xa9,0x8b,0xa8,0x04,0x51,0x8b,0x70,0x92,0x48,0xa8,0x88,
+0x4a,0x93,0x3c,0xd3,0x10,0x89,0x1f,0x93,0x98,0x04,0x42,0x1b,0x92,0x88,0x16,0x00,
+0x2a,0xdc,0x88,0x32,0xdb,0x82,0x10,0x2b,0xf3,0x18,0x11,0x8c,0x18,0xb3,0x9d,0x62,
+0x90,0x39,0xb9,0xa5,0x39,0x9a,0xfb,0x11,0x20,0x89,0x18,0x99,0x7b,0xa2,0xca,0x09,
+0x38,0x81,0x17,0x08,0x8a,0x2c,0x92,0x32,0x86,0x9d,0x19,0x90,0xba,0x38,0x1a,0x04,
+0xfa,0x20,0xab,0x83,0x83,0xae,0x72,0xc0,0x91,0x40,0xa1,0x28,0x0a,0x85,0x18,0x9c,
+0x93,0x69,0x88,0x81,0x48,0xc2,0x0e,0x00,0x02,0x3c,0xd0,0x92,0x4a,0xab,0x22,0xb9,
+0x02,0xa0,0x0f,0x08,0x07,0x80,0x18,0x99,0xa0,0xa3,0x9c,0x19,0x0b,0x27,0x9a,0x32,
+0x9d,0xa2,0x0c,0x03,0x80,0x2e,0xc3,0xab,0x63,0x1a,0xa4,0x1c,0x00,0x90,0x3a,0xb8,
+0x83,0x39,0x7a,0xa5,0x84,0x39,0x19,0x9a,0x96,0x29,0x30,0xcd,0x33,0x81,0x00,0x0d,
+0x83,0x31,0xd0,0x41,0x8b,0x23,0xb8,0xfa,0x19,0x9c,0x91,0x3b,0x80,0xf1,0x68,0xa9,
+0x99,0x41,0xc8,0x82,0x2b,0x88,0x82,0x18,0x2d,0x92,0x24,0xaa,0xbc,0x42,0x99,0xb8,
+0x25,0x64,0xa8,0xd0,0x19,0x00,0x22,0xd3,0x4b,0x90,0x83,0x39,0x83,0x20,0xb8,0xe1,
+0x1a,0x78,0xb3,0x99,0x50,0x90,0xba,0xc3,0x8e,0x28,0xe9,0x28,0x83,0x39,0x86,0x29,
+0x25,0xb9,0x12,0x88,0x4b,0xb0,0xb1,0x12,0x8f,0x82,0x00,0x51,0xbb,0xc3,0x80,0x2d,
+0xb8,0x00,0x07,0x89,0x9b,0xa2,0x0f,0x90,0x11,0x1b,0x91,0x00,0x51,0x98,0x88,0x11,
+0x17,0x0f,0xa0,0xa8,0x2c,0xa2,0xac,0x03,0x60,0x00,0x92,0x89,0xb1,0x79,0xa9,0x84,
+0x10,0x11,0x87,0x89,0x99,0x52,0xa1,0x8a,0x00,0xf9,0x39,0x9a,0x85,0x00,0x9a,0x3a,
+0xbb,0x14,0x99,0x09,0x1b,0x23,0xf8,0x39,0x5c,0xa5,0x19,0xa2,0x1a,0x08,0xf0,0x21,
+0xb2,0x8c,0x48,0xeb,0x13,0x23,0x0f,0x01,0x89,0x90,0x38,0xa0,0x98,0x7b,0xb0,0x08,
+0x12,0x39,0x50,0xf3,0x21,0x0c,0x88,0xb2,0x20,0x1d,0x01,0x01,0xa8,0x8b,0x25,0x40,
+0xa9,0x90,0x78,0xd2,0x18,0x28,0x01,0x3a,0xb3,0x8f,0x83,0x08,0x83,0x0f,0xc3,0x0d,
+0x82,0x4b,0xb8,0x18,0x32,0x90,0xf2,0x39,0x18,0xd8,0xb2,0x40,0x0d,0xa0,0x04,0x0b,
+0x02,0xc1,0x0c,0x00,0x22,0xc1,0x20,0x4b,0xb0,0xac,0x07,0x9a,0x92,0x88,0x4c,0xd2,
+0x10,0x49,0xaa,0x07,0x90,0x20,0x08,0xe1,0x1a,0x81,0x89,0x0c,0x80,0xa8,0x60,0x82,
+0x0a,0x91,0x9b,0x61,0x82,0xb9,0x3d,0xf0,0x3a,0x81,0x04,0x09,0x2a,0xe1,0x41,0x89,
+0x83,0x39,0xb1,0x2b,0x83,0xbd,0x2c,0x91,0x48,0xfa,0x2a,0xa3,0x29,0x49,0xf3,0x28,
+0x21,0x98,0x23,0x0c,0x23,0xd9,0x10,0x61,0xa1,0xa9,0x01,0x41,0xd0,0x1b,0x84,0x00,
+0x68,0x80,0x8b,0x85,0x29,0x21,0x8d,0xa2,0x81,0x3b,0xa4,0x11,0x9a,0x81,0x8c,0x21,
+0x57,0x19,0x18,0x0b,0xa7,0x0a,0x2d,0xb9,0x81,0x12,0xac,0x2c,0xc3,0x80,0x19,0x1b,
+0x96,0x19,0x50,0x93,0x0a,0xa1,0xae,0x92,0x1e,0x08,0xfa,0x88,0x00,0x3b,0xa0,0x96,
+0x41,0x0b,0x01,0xa9,0x26,0x0a,0x00,0x91,0xaa,0x2a,0x52,0x31,0xa1,0x07,0x1b,0xc9,
+0x1c,0xca,0x06,0x2a,0x99,0xb0,0xd1,0x38,0x08,0x02,0xb0,0x3b,0xb6,0x0b,0xa4,0x8a,
+0xda,0x28,0x16,0x00,0x00,0x3f,0xa4,0x11,0x2c,0x11,0x10,0xdb,0x32,0x08,0xb8,0x39,
+0xc5,0x1a,0x8c,0xa2,0xa9,0x50,0x0a,0x97,0x0a,0x90,0x3a,0x9a,0xa1,0x02,0x7d,0xa3,
+0x0a,0x38,0x95,0x19,0x33,0xac,0xb2,0x92,0x9f,0x21,0x8a,0x39,0xc5,0x1b,0x80,0x44,
+0x99,0x91,0x12,0x4b,0x8a,0xd3,0xad,0x8a,0xd1,0x21,0x08,0x1a,0xf1,0x2c,0xb1,0x31,
+0x48,0x80,0xb1,0x98,0x1d,0x02,0x51,0x1e,0xc4,0x28,0x2a,0x89,0x85,0x80,0x18,0x41,
+0xda,0x81,0x0c,0x03,0x1a,0x09,0xa0,0xb8,0x1f,0xf0,0x18,0x59,0xb2,0x09,0x11,0xb0,
+0x12,0x3a,0xa9,0xd4,0x7a,0x80,0x80,0x11,0x4c,0xb0,0x03,0x29,0x10,0x0d,0xb5,0x22,
+0x08,0xfa,0x30,0xb0,0x09,0x82,0x92,0x0d,0xab,0x15,0x02,0x22,0x4a,0xa0,0xb9,0x27,
+0x8c,0x9b,0x34,0xda,0x32,0x9c,0x32,0xb0,0x31,0x88,0x0c,0xe2,0x89,0x28,0x9d,0x92,
+0x3b,0xc5,0x48,0x00,0x1d,0xc8,0x25,0x88,0x8c,0x20,0xb2,0x10,0x20,0x0b,0x16,0xd1,
+0x3b,0xc8,0x15,0x1a,0x89,0x83,0x01,0x0a,0x28,0xab,0xc0,0xea,0x80,0x4b,0x11,0xf3,
+0x30,0x03,0xb9,0x1c,0x91,0x10,0xf9,0x04,0x4e,0x90,0xb8,0x92,0x1c,0x28,0x90,0x92,
+0xb3,0x58,0x8a,0x54,0xc1,0x11,0x19,0x08,0xc2,0x1a,0xbd,0x93,0x9c,0x23,0x0a,0xb6,
+0x0c,0x0d,0x91,0x81,0x4a,0x0b,0x07,0x90,0x19,0xc2,0x39,0x08,0xb1,0x95,0x1a,0x0b,
+0x86,0x18,0xba,0x22,0xa2,0x4b,0x71,0xb3,0x42,0x0c,0x91,0x51,0x81,0xb3,0x8f,0x81,
+0xb1,0x88,0x71,0x08,0xb3,0x29,0xad,0x19,0x90,0x9a,0x82,0xba,0x73,0x2c,0xdc,0x02,
+0x00,0x8a,0x30,0xf9,0x21,0x00,0x2a,0xa1,0x11,0x09,0x24,0x40,0x94,0x2b,0xae,0x93,
+0x2a,0x2b,0xc0,0x95,0x1c,0x72,0x98,0x83,0x59,0x03,0x8d,0x89,0x91,0x92,0x38,0x2a,
+0x99,0xc1,0xa1,0x34,0x39,0x8f,0xf0,0x00,0x18,0xa1,0x1d,0x91,0x82,0x29,0x08,0x01,
+0x84,0x83,0x9f,0x91,0xa8,0x10,0x9b,0xd4,0x6a,0xcb,0x41,0xe1,0x1a,0x00,0x80,0x00,
+0x0b,0x06,0x10,0xbc,0x80,0xa2,0x5b,0x91,0x05,0x09,0x4a,0x91,0x82,0x21,0x28,0x1f,
+0x13,0xc8,0x0c,0xa0,0x0a,0x13,0xb0,0x70,0x43,0xc8,0x39,0x9a,0x05,0x0b,0x08,0x93,
+0x04,0x9c,0x90,0xa1,0x37,0x9f,0x12,0xa8,0x11,0x8a,0x79,0xb1,0x91,0x3a,0x09,0xb0,
+0x04,0x9b,0x2c,0xb2,0xac,0xbe,0x45,0x28,0x90,0x88,0xa0,0x04,0x1d,0x01,0x03,0x0c,
+0xb1,0x71,0x89,0x81,0x1a,0x13,0x81,0xcf,0x11,0x0a,0xa9,0x10,0x33,0x98,0x39,0xfb,
+0xc0,0x39,0x0a,0x08,0xdd,0x17,0x18,0x0a,0xa3,0x43,0x92,0x1e,0x90,0xa1,0x0c,0x01,
+0xa1,0xbb,0x47,0x09,0xd8,0x12,0x4a,0x9a,0x84,0x19,0xa0,0x18,0x8b,0x26,0xa2,0x08,
+0x2f,0x83,0x10,0xa0,0x39,0xaa,0x73,0xfb,0x81,0x49,0x90,0xd9,0x08,0x98,0x01,0x99,
+0x13,0xb9,0x17,0x8d,0x19,0x85,0x19,0x8a,0xa2,0x29,0x9b,0x87,0x0a,0x91,0x0b,0x23,
+0x91,0x19,0x79,0xf1,0x00,0x90,0x80,0x29,0x19,0x17,0x3b,0xb0,0x21,0x4b,0x12,0xb1,
+0xea,0x70,0x01,0xa9,0xa8,0x28,0x93,0x73,0x0c,0x91,0x92,0x8a,0x28,0x9b,0x17,0x8f,
+0x80,0x19,0x31,0x91,0xbb,0x38,0xab,0xf1,0x70,0xb0,0x10,0x9b,0xb3,0x32,0x3b,0x82,
+0x0b,0xb4,0x9b,0x8d,0x65,0xc9,0x01,0x2a,0xb0,0x58,0xa9,0x99,0x52,0x99,0x98,0x33,
+0xb8,0x2c,0xf3,0x2c,0x90,0x02,0x39,0x0c,0xf1,0x20,0x38,0x02,0xc2,0x8b,0x30,0xeb,
+0x95,0x59,0xb8,0x01,0x20,0xcd,0x12,0x18,0x90,0x2b,0xb1,0x3a,0xd3,0x53,0x0c,0x90,
+0x99,0x90,0x41,0x53,0xfb,0x18,0x82,0x99,0x04,0x30,0xaa,0x08,0xf0,0x1a,0x20,0xaa,
+0x09,0x87,0x10,0x29,0xa9,0xb0,0xd3,0x79,0x99,0x83,0x2a,0x96,0xaa,0x1c,0xa9,0x16,
+0x2c,0xb1,0x2a,0xa0,0x19,0x14,0xeb,0x18,0x24,0x21,0x08,0x39,0x86,0x80,0x38,0xb9,
+0x34,0x0e,0xb2,0x42,0xcc,0x52,0x89,0x08,0x80,0x8a,0x16,0x8a,0x02,0xc1,0x38,0x08,
+0x94,0x7b,0xa1,0x80,0x8a,0xb9,0x11,0xa0,0x73,0xb9,0x8c,0x87,0x09,0x10,0x91,0x01,
+0x38,0x29,0xf0,0x12,0x1c,0xa8,0x13,0x11,0x40,0xb9,0xaa,0x09,0xb7,0x9f,0x90,0x02,
+0xa1,0x2f,0xa1,0x29,0x93,0x2f,0x91,0x02,0x9a,0x18,0xb8,0xaa,0xdd,0x29,0x01,0xb8,
+0x4a,0x12,0x28,0x11,0x1e,0x97,0x39,0xba,0xa8,0x4a,0x32,0x91,0xb0,0xeb,0x70,0xc9,
+0x11,0xa9,0x01,0x30,0x08,0xce,0x21,0x16,0x99,0x49,0xb0,0x10,0xcb,0x40,0x81,0x9a,
+0x40,0x01,0x92,0x39,0x9f,0x81,0x40,0x00,0xab,0x0e,0x01,0x17,0x1a,0x81,0xa1,0x58,
+0x9a,0x81,0x8b,0x8b,0x42,0xb5,0x8e,0x80,0xa8,0x98,0x70,0x92,0xa1,0x00,0x10,0x1b,
+0x98,0x03,0x71,0xf3,0x39,0x18,0x11,0x98,0xc3,0x2b,0x1b,0x92,0x87,0x19,0x31,0xcb,
+0x99,0x92,0x79,0xb3,0x9f,0x81,0xb2,0x39,0x1d,0xd1,0x32,0x9d,0x80,0x29,0x03,0x00,
+0x0a,0x49,0x88,0xb8,0x66,0x0d,0x83,0x8b,0xa2,0x9b,0x82,0x8d,0x51,0x83,0x89,0xa1,
+0x1e,0xca,0x28,0x93,0x0a,0xc0,0x4b,0x34,0x8a,0xc2,0x73,0x19,0xb2,0x43,0x08,0xca,
+0x91,0x8b,0xd2,0x1d,0x98,0x80,0x35,0x19,0x83,0x8a,0x83,0x0f,0x14,0xc9,0x08,0x23,
+0x3b,0xba,0xd4,0x32,0x0b,0x21,0xb5,0x09,0xb8,0x32,0x8f,0xb6,0x48,0x98,0x18,0xb0,
+0x43,0x9a,0x0a,0xb8,0xd8,0x8b,0x59,0xa3,0x2a,0xea,0x1b,0x14,0xa9,0x28,0x0f,0xd1,
+0x30,0xb1,0x18,0x49,0x16,0x90,0x0c,0x92,0x02,0x6b,0x98,0xb2,0x3b,0x01,0x92,0xf9,
+0x3a,0x22,0xcb,0x42,0x30,0x15,0xab,0x11,0x2a,0x93,0x86,0x2c,0xd8,0x58,0x9b,0x81,
+0x8b,0x01,0x18,0x9b,0x04,0x2a,0x87,0x8a,0x0f,0x81,0x82,0x8b,0x22,0xc4,0x7a,0x90,
+0xc3,0x19,0x29,0x92,0x44,0xcb,0x81,0x0a,0x88,0x21,0x23,0x8d,0x98,0x17,0x5b,0xc0,
+0x08,0x88,0xa2,0x09,0x88,0x21,0x83,0x40,0xe9,0x3a,0xbc,0x42,0x00,0xa0,0x0f,0x01,
+0xa1,0x9d,0x42,0x00,0x02,0xda,0x01,0x29,0x38,0xbd,0x27,0x2a,0x89,0xb9,0x90,0x8a,
+0x04,0x8b,0xfb,0x02,0x1b,0x30,0x91,0x97,0x2c,0x90,0xb1,0x58,0x93,0x2b,0x98,0xf9,
+0x00,0x6a,0x08,0xb0,0xc8,0x8c,0x39,0xa1,0x4a,0x85,0xa9,0xac,0x33,0x3b,0xc6,0x18,
+0x9b,0x22,0x14,0xa8,0x1a,0x03,0x18,0x27,0x02,0x1d,0x90,0x90,0x94,0xc9,0x30,0x2f,
+0x94,0x89,0x32,0xb9,0xbc,0x11,0x98,0xa9,0x45,0x39,0x2a,0xa7,0x90,0x3c,0xa1,0x13,
+0x31,0x9b,0x85,0x1e,0x81,0x19,0xf8,0x29,0x18,0x9a,0xc3,0x10,0x88,0x49,0x84,0x28,
+0x92,0x41,0x09,0x20,0xa2,0x9e,0xa8,0x17,0x54,0xca,0x19,0x93,0x08,0x01,0x0c,0x11,
+0xa8,0xda,0x42,0x8a,0x81,0xaf,0xd4,0x01,0x3a,0x90,0x91,0x22,0xdb,0x8a,0x48,0x81,
+0xf1,0x48,0x2a,0x90,0xd3,0x18,0x18,0x1a,0xcc,0x82,0x31,0x8c,0x92,0x29,0x01,0x53,
+0x19,0xb3,0x4a,0xab,0x86,0xeb,0x50,0xaa,0x12,0x38,0x88,0x0a,0x87,0x0d,0x88,0x83,
+0x1c,0x14,0xa0,0xa9,0x39,0x11,0x98,0xfc,0x19,0x29,0x53,0x1a,0x07,0x10,0x0c,0xb1,
+0x09,0x95,0x39,0x00,0xb4,0xa9,0x08,0x2d,0xb3,0x43,0x1b,0xcd,0x98,0x99,0x20,0x89,
+0x58,0xa0,0x31,0x9c,0xb5,0x9a,0x3c,0xe9,0x12,0x81,0x3b,0x16,0xbd,0x81,0x3a,0x8c,
+0x03,0x10,0x0e,0x02,0x95,0x4b,0x12,0x91,0xc0,0x09,0x7a,0xa1,0xb1,0x79,0x90,0x02,
+0x88,0x2b,0x83,0xe9,0x08,0x0a,0x89,0xa0,0x53,0x44,0xa8,0x91,0x03,0x7b,0x99,0xc0,
+0x03,0x8e,0xa0,0x08,0x93,0x8b,0x42,0xdb,0x20,0x88,0x88,0x10,0xb2,0x2f,0xa1,0x85,
+0x18,0x1d,0xa0,0x86,0x09,0x21,0xba,0x9c,0x69,0x83,0x99,0x80,0x2b,0x48,0xf4,0x2a,
+0x29,0x03,0x92,0xbb,0x8a,0x12,0x48,0xc0,0x73,0x20,0xb3,0x9e,0x31,0x8a,0x91,0x28,
+0x03,0xfa,0x8d,0xa0,0x11,0x21,0x08,0xf2,0x29,0x38,0xa4,0x84,0x68,0xa8,0x21,0xb8,
+0x18,0x89,0x0c,0xd5,0x10,0x20,0xbe,0x20,0xa2,0x12,0x1e,0xb8,0x42,0xb8,0x10,0x19,
+0x12,0x9a,0x87,0x8b,0x9d,0x95,0x08,0x08,0x8e,0x11,0xc3,0x3c,0x88,0x01,0xa8,0x8a,
+0xd0,0x59,0x91,0x8a,0x93,0x50,0x84,0x33,0x8e,0x90,0x03,0x10,0xe8,0x48,0xb2,0x0a,
+0x21,0xb0,0x21,0x95,0x8e,0x09,0x06,0x08,0x94,0x1a,0x10,0xa8,0xd8,0x21,0x39,0xc8,
+0x41,0x82,0x91,0x20,0x2a,0x80,0x73,0xb9,0x13,0x62,0xf9,0x0a,0x11,0x83,0x1c,0xd8,
+0x18,0x96,0x0d,0x91,0xa9,0x81,0x6b,0x92,0x91,0x89,0x10,0x20,0x15,0xcb,0x28,0x11,
+0x9b,0xc2,0x49,0xa8,0x9f,0x11,0xc2,0x38,0x12,0x89,0xa1,0x24,0xa4,0x59,0x5a,0xd0,
+0x82,0x4a,0xc0,0x31,0x8a,0x91,0xa9,0x8a,0x5a,0x89,0x94,0x39,0xb8,0x1f,0x0c,0x91,
+0x10,0x8b,0x26,0x8f,0x88,0x95,0x1a,0x08,0x18,0x18,0x94,0x99,0xaa,0x11,0x1d,0x82,
+0xd2,0x69,0xc0,0x31,0x99,0xca,0x28,0xb4,0x22,0x2d,0x88,0xa1,0x18,0xaf,0x63,0x91,
+0x99,0x30,0x8c,0xb2,0x68,0xa1,0x10,0x1a,0x02,0xc9,0x58,0x90,0x08,0xbf,0x14,0x9b,
+0xc2,0x39,0x0b,0x94,0x91,0x12,0x79,0x81,0xa8,0x11,0x2b,0xa9,0x06,0x01,0xc9,0x59,
+0xc8,0x42,0xc9,0x20,0x0b,0x13,0x95,0x9a,0x2b,0x19,0x14,0x07,0xaa,0x03,0x1a,0xbf,
+0x92,0x99,0x11,0x1b,0x25,0x9e,0x94,0x28,0x89,0x84,0xa8,0x58,0xc8,0x02,0x29,0x50,
+0xc2,0x18,0xa2,0x8d,0xaa,0x28,0x33,0xa9,0x11,0x0f,0x21,0x17,0x9a,0x20,0x01,0x91,
+0x8a,0xc8,0x59,0xa3,0x51,0x20,0xbc,0x85,0x19,0x0b,0xac,0xa1,0xa8,0x70,0x91,0x3a,
+0xb6,0x1b,0x20,0xc9,0x09,0xa2,0x02,0xbe,0x98,0x12,0x33,0x93,0x43,0xff,0x23,0x8a,
+0xa2,0x38,0xa9,0x3a,0xa2,0x37,0x1e,0x02,0x89,0x82,0x4b,0xdb,0x15,0x08,0x89,0xba,
+0x20,0x09,0x93,0x12,0x3b,0x8f,0xd1,0x18,0x42,0x12,0x8f,0x11,0x91,0x10,0x1f,0xc2,
+0x18,0x89,0x81,0x3b,0xa5,0x38,0x13,0xaa,0x0a,0xba,0xa6,0x93,0x3f,0xb3,0x94,0x2b,
+0x01,0xab,0xd8,0x56,0x09,0xa0,0x10,0xb9,0x8d,0x01,0x9a,0x24,0x99,0x03,0xb3,0x0f,
+0x13,0xa9,0x8a,0xc4,0x48,0x39,0xe8,0xa9,0x80,0x09,0x0b,0xf2,0x31,0x29,0x00,0xf9,
+0x80,0x3b,0x91,0xb1,0xb0,0x71,0x14,0x90,0xb0,0x12,0x0e,0x11,0x00,0x95,0x38,0x80,
+0x9a,0xe9,0x14,0x0a,0xad,0x0a,0x17,0x28,0x90,0x28,0xad,0xb3,0x50,0x8a,0x95,0x29,
+0x92,0x09,0x21,0xa4,0xad,0x8d,0x00,0x84,0x18,0x1a,0xb2,0x3c,0x14,0xfb,0x11,0x8a,
+0x19,0x90,0x86,0x02,0x8e,0x90,0x00,0x33,0x19,0xd8,0x2b,0xe3,0x09,0x11,0x39,0xfa,
+0x13,0x1c,0xa0,0x9a,0x15,0x89,0x92,0x82,0x22,0xde,0x01,0x39,0xa1,0x93,0x9f,0x38,
+0x82,0x08,0xd3,0x0d,0xa0,0x48,0x11,0xdb,0x23,0x00,0x4a,0x8b,0x87,0x00,0x9b,0xb0,
+0x12,0x3c,0x92,0xe9,0x28,0x40,0x00,0xc9,0x01,0x4a,0x10,0x30,0xd5,0x5a,0xa3,0x39,
+0xaa,0x85,0x19,0xa3,0x5b,0xca,0xa2,0x20,0x88,0x1b,0x92,0x86,0x3b,0xe0,0x93,0x5b,
+0xa8,0x31,0x03,0x90,0xa2,0x1f,0xe8,0x88,0xc8,0x39,0x01,0xc9,0x11,0x58,0xa7,0x2a,
+0x30,0xa0,0xb4,0x58,0x89,0x88,0x94,0x88,0x0a,0x58,0xc0,0x33,0x9b,0x43,0x0b,0xf9,
+0x10,0x11,0x0d,0xc0,0x38,0x02,0x11,0x09,0x0b,0xf9,0x38,0x98,0x53,0xcb,0x98,0x49,
+0xa2,0xd0,0x09,0x21,0x68,0x95,0xb9,0x10,0x5b,0xda,0x81,0x81,0x69,0x90,0x10,0xc1,
+0x18,0x09,0x01,0x8b,0x07,0x98,0x29,0x01,0x88,0xc0,0x81,0xdc,0x2a,0x22,0xe0,0x20,
+0xda,0x19,0x99,0x22,0xaa,0x84,0x00,0x8c,0xca,0x34,0x22,0xe0,0x6b,0xc1,0x00,0x09,
+0x9b,0xc3,0x30,0x58,0x09,0x16,0xb9,0x81,0x9d,0x31,0xb2,0x43,0x9a,0x48,0x02,0x84,
+0xac,0x00,0x26,0x8a,0x88,0x91,0x11,0x19,0xff,0x19,0x01,0x09,0x82,0x88,0x91,0x3b,
+0x87,0x08,0x4a,0x01,0xd3,0x1a,0x21,0x9d,0x92,0x61,0xb1,0x1b,0x9e,0x02,0x30,0x80,
+0x1b,0x81,0x00,0x1b,0x1f,0x05,0x0b,0xa6,0x3a,0x01,0xa0,0xa3,0xc8,0x7b,0xb9,0x00,
+0x88,0x30,0x10,0x84,0x20,0xb9,0xfb,0x53,0x94,0x0b,0x1c,0xa2,0x82,0xbd,0xc8,0x3a,
+0x00,0x0c,0x27,0xca,0x81,0x4c,0x91,0x92,0x1c,0x03,0x88,0x49,0xa0,0x90,0x02,0x8e,
+0x61,0xb2,0x5b,0xa1,0x19,0x81,0x0a,0xaa,0xa3,0x38,0x49,0x10,0xf1,0x0a,0xca,0x60,
+0xaa,0x97,0x49,0x90,0x98,0x01,0x88,0x98,0x34,0x18,0x84,0xd1,0x31,0x2b,0xc1,0xf9,
+0x89,0x30,0x28,0xc0,0xda,0x24,0x1d,0x89,0x82,0xa2,0x19,0xbc,0x16,0x8a,0x12,0x91,
+0x82,0x8d,0x9b,0x08,0xe8,0x61,0x80,0x19,0x01,0x02,0x30,0x9e,0xa8,0x03,0x18,0xb8,
+0x72,0xca,0x13,0x02,0x8b,0xc2,0x7a,0xa2,0x32,0x08,0xaf,0x11,0xaa,0x88,0x99,0x02,
+0x48,0xf9,0x80,0x38,0x20,0x00,0x86,0x09,0x2d,0xa7,0x28,0x0a,0x98,0xb3,0x3d,0x18,
+0x91,0x93,0x0b,0xbf,0x42,0x80,0xc1,0x18,0x58,0xd8,0x03,0x2a,0x98,0xb1,0x2b,0xd1,
+0x79,0xd8,0x01,0x30,0x0a,0x83,0xa0,0x3a,0xc8,0x32,0xb1,0x6b,0xb8,0x43,0x21,0xbd,
+0x90,0x4d,0xb1,0xac,0x21,0x82,0x3f,0x81,0x93,0xc9,0x19,0x69,0xb1,0xa0,0x93,0x59,
+0x0c,0xb3,0xa8,0x2c,0x4a,0xd1,0x12,0x0b,0x92,0x1d,0xb4,0x08,0x28,0x1e,0xb2,0x80,
+0x71,0x88,0x22,0x03,0x98,0xd8,0x42,0x3a,0xe0,0xa8,0x62,0x89,0xc0,0x18,0x48,0x98,
+0x90,0xc8,0x2a,0x80,0x10,0x8b,0xc5,0x39,0x99,0xd0,0x01,0x2b,0xb3,0x27,0x91,0x39,
+0xb1,0x0b,0x17,0x9b,0x08,0x53,0x00,0x90,0xc0,0x7c,0xb8,0x80,0x21,0x19,0x9d,0x02,
+0x83,0x7b,0x89,0x08,0x93,0xae,0x58,0x98,0x19,0xb3,0xa9,0x61,0xbb,0x8a,0xc1,0x51,
+0x9a,0x41,0xb1,0x11,0xd0,0x89,0x38,0x3a,0xa6,0x32,0x9a,0x03,0xad,0x24,0x1a,0xf9,
+0x31,0x8b,0xa1,0x3c,0xa2,0x50,0x94,0x1e,0x93,0x11,0xa9,0x10,0xd9,0x42,0x8d,0x82,
+0x8b,0x80,0x94,0x39,0x89,0xbd,0x16,0x30,0x3a,0xf8,0x80,0x1a,0x0c,0x91,0x22,0xa4,
+0x4c,0xa8,0x80,0x91,0x01,0x7b,0x80,0xa9,0x87,0x49,0x82,0x99,0x90,0xb2,0x19,0x4e,
+0xb3,0xa9,0x82,0x61,0x99,0xb0,0xba,0x1a,0x71,0xa1,0x19,0x11,0xf2,0x3b,0x8a,0x95,
+0x98,0x08,0x3d,0x91,0x11,0x21,0x90,0x86,0x2c,0x38,0xf0,0x58,0x08,0x80,0x02,0x20,
+0xa9,0xc1,0x3d,0x93,0xdb,0x10,0x81,0x09,0x6b,0xc1,0x91,0x32,0x8f,0x81,0xc2,0x1b,
+0x10,0x19,0x92,0xa0,0x71,0xbb,0x05,0xbb,0x50,0x02,0x8b,0x88,0x85,0x20,0x4b,0xf9,
+0x00,0x1a,0xb1,0x42,0x98,0xa9,0x54,0x99,0xea,0x28,0x39,0xa3,0x81,0x03,0x0f,0x41,
+0xa1,0x98,0x38,0xa4,0x3a,0xd8,0x0c,0x86,0x19,0xa9,0x50,0xa1,0x18,0x8a,0x99,0x28,
+0xb8,0x90,0x71,0xd3,0xc9,0x49,0x90,0x09,0x41,0x84,0x0b,0x94,0x0d,0x00,0x11,0x93,
+0x1a,0x6b,0xe1,0x80,0x39,0x90,0xa0,0x8b,0x13,0x32,0x2a,0x16,0xe0,0x8a,0x69,0x92,
+0x93,0x3d,0x91,0xb3,0xca,0x39,0x8d,0x98,0xa3,0x8a,0x3f,0xb9,0x07,0x4a,0x9a,0x90,
+0x03,0x29,0x0c,0x06,0x19,0x02,0x09,0xc3,0x2b,0xb8,0x2d,0x09,0x07,0x49,0x89,0x9a,
+0x02,0x1a,0x34,0xb4,0x8e,0x38,0xb3,0x13,0x09,0x9f,0x84,0xa8,0x3b,0x11,0x89,0x12,
+0x81,0x1b,0xae,0xa4,0x20,0x91,0x3a,0xb7,0x60,0x2c,0xd2,0x18,0x8c,0x92,0x0a,0xa3,
+0x2a,0x9a,0x90,0x9d,0xb3,0x0c,0x51,0x04,0x29,0xf8,0x22,0x10,0x38,0x80,0xb7,0x1b,
+0x91,0x91,0x1e,0xb1,0x93,0x0f,0x08,0x18,0x82,0xa9,0xc1,0x1f,0x80,0x94,0x28,0xa9,
+0x51,0x03,0xd0,0x28,0x3a,0x95,0x0a,0x11,0xd9,0x1b,0x13,0xdb,0x10,0xb3,0x79,0x99,
+0x09,0xb1,0x6b,0x92,0x00,0x41,0xb3,0x0b,0xd9,0x01,0x8a,0x13,0x80,0xe3,0x9f,0x96,
+0x20,0x9b,0x90,0x23,0x10,0x91,0x1e,0xa4,0xa1,0x11,0x4c,0xd8,0xa8,0x18,0x22,0x72,
+0xa9,0x93,0x28,0x98,0x9c,0x2a,0x19,0xf3,0x20,0x2b,0x01,0xf0,0x08,0x80,0x0b,0x48,
+0x00,0x92,0xa2,0x73,0x83,0xf0,0x83,0x1b,0x89,0x80,0x17,0xb9,0x28,0x10,0xeb,0x91,
+0x07,0x09,0x2b,0xb2,0x15,0x2a,0x89,0xc1,0x20,0x9c,0xc3,0x31,0x10,0x3a,0xe5,0x39,
+0x91,0x1b,0xe9,0x19,0x31,0x90,0xd8,0x48,0x9d,0xa1,0x31,0x89,0xb1,0x48,0xaa,0x99,
+0x27,0xb9,0x5a,0x88,0x02,0x50,0xb9,0x13,0x0b,0xfb,0x01,0x90,0x50,0xb8,0xb0,0x00,
+0x48,0x03,0x9b,0xa7,0x5a,0x89,0x23,0xb9,0x40,0x9a,0xe3,0x0f,0x91,0x89,0xb0,0x61,
+0x88,0x21,0xd8,0x18,0x83,0x08,0x3a,0xd8,0x11,0x82,0x9c,0x29,0x28,0x95,0x9b,0x08,
+0x71,0xb4,0x81,0x31,0x4c,0xc1,0x88,0x30,0x84,0x8e,0x10,0xc0,0xab,0x08,0x25,0x0c,
+0xb8,0x5a,0xb1,0x0a,0x07,0x2a,0x81,0x93,0x90,0x4c,0xba,0xb0,0x21,0x21,0xbc,0x61,
+0xa3,0x52,0x09,0x05,0x9a,0xb2,0x49,0x2a,0xd4,0x21,0xba,0x71,0xa0,0x01,0x89,0xaa,
+0xcd,0x13,0x0a,0x2c,0x84,0x28,0xb9,0x93,0x7d,0x98,0x81,0x9a,0x32,0x8e,0x81,0x80,
+0x29,0x01,0x28,0x87,0x8d,0x11,0xb0,0x19,0x33,0x9a,0x1b,0x3b,0x87,0x8a,0x2e,0x11,
+0xd4,0x19,0x02,0x20,0x11,0x0a,0xb8,0xad,0xca,0x21,0x07,0x1d,0x01,0xa8,0x18,0x15,
+0x1a,0xc2,0x08,0x49,0xfa,0x10,0xa8,0x00,0x09,0x53,0xa4,0x89,0x29,0xb8,0x11,0x40,
+0x87,0x18,0xb9,0x19,0x18,0xf8,0x19,0xb8,0xba,0x35,0xba,0x24,0x91,0xa0,0x21,0xc1,
+0x1f,0xc3,0x88,0x3a,0x38,0xf3,0x40,0x38,0xc8,0x8a,0xe1,0x12,0x28,0x08,0x8d,0x92,
+0xc0,0x6a,0x99,0x12,0x80,0xa8,0x39,0x90,0x40,0xa1,0x84,0xfa,0x3d,0x98,0x98,0x30,
+0xa2,0x88,0xaf,0x29,0x25,0xcb,0x01,0x0b,0x9a,0x36,0x09,0x31,0xc3,0x8d,0xaa,0x92,
+0x91,0x51,0x08,0xba,0x34,0xda,0x21,0x52,0xd8,0x0b,0xc1,0x83,0x78,0x02,0xa2,0x08,
+0x91,0x63,0x09,0xba,0xf0,0x22,0x89,0x19,0xc3,0x0a,0x11,0x30,0xfb,0x90,0x10,0x19,
+0x85,0x90,0x0a,0x70,0x00,0xa7,0x29,0x0a,0xa0,0xc8,0x81,0x50,0x80,0xb3,0x38,0x99,
+0x28,0xc1,0xa1,0x9e,0x28,0xa0,0x80,0xad,0x45,0xba,0x1a,0xa2,0x20,0x02,0x8f,0x95,
+0x28,0x53,0x3a,0xf8,0x11,0x1a,0x40,0xb8,0x99,0x82,0x9e,0x2b,0x97,0x2a,0x31,0x92,
+0x1c,0xa8,0xb9,0x5a,0x98,0x83,0xeb,0x2c,0x98,0x12,0x01,0x0b,0x93,0x93,0xa8,0x7b,
+0x07,0x91,0x8d,0x00,0x12,0x23,0xaa,0xfa,0x5a,0xa1,0x00,0x81,0x18,0x91,0x8c,0x89,
+0xc4,0x58,0x9b,0x55,0x80,0x90,0x88,0x8b,0x3a,0x97,0x30,0x9d,0x11,0x20,0x00,0xb2,
+0x29,0x09,0x80,0x10,0x97,0x08,0x3d,0x91,0x83,0xad,0x8a,0x6a,0xe8,0x08,0x80,0x1b,
+0xa3,0x85,0x7a,0x90,0xa3,0x09,0x5a,0xb9,0xb4,0x19,0x2e,0xb1,0x91,0x90,0x0c,0x22,
+0x11,0x9a,0x97,0x18,0x69,0xa0,0x13,0x9c,0x23,0x39,0xcb,0x02,0x82,0x2d,0xdd,0x91,
+0x0a,0x23,0x88,0x29,0xe0,0x38,0xa1,0x4b,0x13,0xea,0x41,0xa9,0xb8,0x13,0x2e,0xb2,
+0x88,0x42,0x00,0x2a,0xf1,0x0c,0x05,0x2b,0xc0,0x2a,0xa5,0x48,0x91,0x20,0x88,0x98,
+0x01,0xe8,0x49,0x19,0xe2,0x10,0x89,0xa8,0x20,0x42,0xd2,0x0a,0xa1,0x3a,0xbe,0x04,
+0x19,0x08,0xb9,0x3a,0x07,0x90,0x38,0x84,0xda,0x09,0x28,0x94,0x21,0x1f,0xc2,0x08,
+0xa1,0x2b,0xd0,0x31,0x18,0x97,0x58,0x08,0x99,0xb8,0x15,0x09,0x3b,0xb0,0x82,0x20,
+0xd8,0x4a,0xa1,0x8a,0x15,0xab,0xa9,0xab,0x46,0xb0,0x58,0x90,0x22,0xad,0x10,0x1c,
+0xfb,0x12,0x9b,0x21,0x8e,0x82,0x90,0x2b,0x14,0x00,0xa0,0x91,0xc0,0x1f,0xb1,0x42,
+0x9a,0xab,0x26,0x82,0x2b,0x01,0xb0,0x8a,0x63,0x31,0xb4,0x0b,0x41,0x28,0xf2,0xad,
+0x20,0x08,0x9b,0x92,0x97,0x38,0x1c,0x95,0x81,0x10,0xbc,0x10,0x81,0xb4,0x4a,0x41,
+0x91,0x99,0x61,0xab,0xb4,0x3b,0x81,0xbb,0x26,0x82,0x00,0x62,0xb1,0x9b,0x50,0x11,
+0x98,0xc8,0x18,0x89,0x43,0x9e,0x04,0xaa,0x92,0x70,0x12,0xb4,0x09,0xba,0x20,0xb1,
+0x2a,0x7c,0xf1,0x08,0x19,0xa1,0x81,0x9b,0x94,0x79,0xb2,0x31,0x3b,0xf1,0x10,0x0b,
+0x00,0xe8,0x28,0x12,0x19,0xd8,0x0a,0x12,0xba,0x43,0x0f,0xa1,0x10,0x19,0x87,0x8d,
+0x08,0x90,0x14,0x1a,0xa9,0x99,0xa2,0x7a,0x13,0xc9,0x83,0x3b,0x98,0x03,0xb9,0x2f,
+0xb4,0x39,0x89,0x20,0xe3,0xb9,0x69,0x00,0x88,0xd0,0x12,0x68,0x0a,0xb4,0x31,0x0a,
+0x84,0x89,0x39,0xa8,0x97,0xab,0x59,0x10,0xca,0x91,0x51,0x8d,0x02,0x81,0x28,0x0a,
+0xe0,0x08,0x49,0xa8,0x30,0xb4,0x41,0x8b,0x94,0x0f,0xb3,0x10,0xa9,0x4a,0xa0,0x81,
+0x9b,0x16,0x49,0xe0,0x80,0x10,0x39,0xf3,0x38,0x20,0x82,0xa0,0x3b,0xd9,0x24,0x18,
+0x0b,0x91,0x97,0x1c,0x01,0xcb,0x91,0x8c,0xb2,0x3d,0x96,0x88,0x1a,0x98,0x21,0x90,
+0x02,0xfb,0x49,0xc2,0x02,0x39,0x0c,0xc4,0x28,0x1a,0x1a,0xe3,0x88,0x9a,0x21,0xa9,
+0x34,0x19,0xe4,0x29,0x3b,0x96,0x2a,0xba,0x02,0x09,0x1b,0x31,0xbf,0x03,0x08,0x4a,
+0xa4,0x8d,0x31,0x12,0xe2,0x18,0x9a,0x18,0x37,0x29,0xbc,0x91,0x09,0x2c,0x23,0x0d,
+0x97,0x1a,0x09,0x10,0xa9,0x92,0x89,0x4d,0x31,0xc3,0x34,0x2a,0xf2,0x39,0x10,0x82,
+0x9a,0x34,0x9b,0xa8,0x7b,0x17,0xc8,0x1a,0x11,0x80,0xd2,0x01,0x2b,0xb8,0x23,0x5a,
+0xb2,0x29,0x19,0xf0,0x3e,0x90,0xb1,0x89,0x09,0x20,0x8a,0xb6,0x92,0x0e,0x09,0xb0,
+0x04,0x4c,0x82,0x00,0x4b,0xb0,0xa0,0x39,0x09,0xa3,0x7b,0xf5,0x29,0x19,0xa1,0x84,
+0x50,0x9b,0x18,0xf1,0x18,0x3a,0xa1,0xa0,0x20,0xb9,0x02,0xac,0x62,0x8a,0x93,0xab,
+0x96,0x2d,0xa0,0x03,0x39,0xab,0x55,0x89,0xa9,0x15,0x2b,0xa3,0x50,0x9b,0xb4,0x3b,
+0x81,0x91,0x39,0xb1,0x87,0x4d,0xc1,0x08,0x09,0x10,0x92,0x0e,0xa1,0x80,0x38,0x62,
+0xa1,0x01,0x28,0xc4,0x59,0x19,0x85,0xda,0x08,0x39,0xc1,0x21,0xb8,0x82,0x0f,0x82,
+0x88,0x8a,0x30,0x03,0xce,0x13,0x8a,0x40,0xd8,0x81,0x39,0x18,0xe0,0x08,0x30,0xd1,
+0x48,0xa2,0x1a,0xa9,0x14,0x02,0x8f,0xa8,0x92,0xb8,0x19,0x3a,0x97,0x19,0xc9,0x12,
+0x99,0x5e,0xc1,0x98,0x22,0x90,0x8a,0x0c,0xd4,0x01,0x4a,0x82,0xa9,0x94,0x60,0x08,
+0x99,0xba,0x34,0x0e,0xa0,0xaa,0x22,0x91,0x50,0x11,0x89,0xc4,0x49,0x99,0x10,0x10,
+0xfb,0x2a,0x08,0x17,0x2c,0xa0,0x98,0x01,0x30,0x0e,0x92,0x09,0x24,0x0d,0x01,0x99,
+0x01,0x08,0xe8,0x61,0xaa,0x03,0x21,0x48,0x1b,0x97,0x28,0x48,0xea,0x81,0x80,0x29,
+0x9d,0x93,0x29,0x22,0x1c,0x81,0x91,0x92,0x73,0x8b,0xa0,0x8c,0xe2,0x51,0x9b,0x12,
+0x90,0x09,0xc3,0x5c,0xa8,0x90,0x82,0x0d,0x2a,0x05,0xa8,0x10,0x18,0x1c,0x95,0x0b,
+0xc0,0x19,0x01,0x2c,0xb4,0x31,0x2c,0x01,0xe0,0x0a,0xa3,0x5b,0xcc,0x05,0x1b,0x08,
+0x30,0xb0,0x53,0xa9,0x08,0x0a,0x02,0xb7,0x49,0x20,0xd0,0x18,0xd1,0x4a,0x81,0x80,
+0x0a,0x10,0xb0,0x03,0x20,0x7d,0xf3,0x09,0x21,0x09,0x08,0x82,0x21,0x1b,0x50,0xa2,
+0x00,0xbf,0x93,0x11,0x1d,0xc3,0x0a,0x14,0x81,0x1b,0x9c,0x06,0xb9,0x31,0x10,0x1b,
+0x01,0x94,0x9a,0x6b,0x38,0xd0,0x92,0x4b,0xc8,0x8b,0x33,0xd8,0x4a,0x88,0xc1,0x73,
+0x99,0x99,0x90,0x93,0x8d,0x9a,0x07,0xa8,0x2b,0x00,0x05,0x03,0x3d,0xb8,0x85,0x50,
+0x99,0x90,0xa9,0x1a,0x93,0xb8,0x8f,0x41,0xc2,0x28,0xb1,0x5a,0x0a,0xd0,0x02,0x18,
+0x49,0x40,0xe9,0xa2,0x2b,0x18,0x99,0xa8,0xd3,0x42,0xae,0x30,0xb1,0x40,0x81,0xaa,
+0x1d,0xa3,0x5b,0x01,0xa1,0x91,0x7b,0x90,0x89,0x96,0x29,0x28,0x0a,0xf3,0x00,0x28,
+0x1d,0xa5,0x8b,0x22,0x12,0x0d,0x84,0x12,0x88,0xa8,0x8b,0x22,0x3b,0x87,0x02,0x0d,
+0xa8,0x98,0x19,0xfa,0x08,0x01,0x1c,0x91,0xc9,0x26,0x2a,0x18,0x01,0xc8,0x92,0x2d,
+0x91,0xa1,0x16,0x0b,0x33,0xaf,0xa1,0x34,0xbb,0x9a,0xc1,0x42,0xa9,0x1a,0xea,0x83,
+0x1d,0x82,0x40,0xa3,0x8a,0x08,0xb0,0x1f,0xb0,0x86,0x3a,0x8b,0xd3,0x0b,0x13,0x48,
+0x05,0x0c,0xa1,0x00,0x39,0xb1,0xd0,0xa0,0x71,0xab,0x87,0x10,0x2a,0xb9,0xa3,0x40,
+0x8d,0x01,0xa0,0x4a,0xba,0x15,0x1b,0x20,0x22,0xaa,0xa7,0x0d,0x20,0xa8,0xb9,0x39,
+0x54,0x88,0x0b,0x95,0x60,0x90,0xb1,0x1b,0x41,0xc2,0x80,0x30,0xaf,0x11,0x81,0x0a,
+0x72,0xa9,0x14,0x8a,0x38,0x83,0x0d,0x90,0x85,0xaa,0x32,0x1b,0x0c,0xf1,0x52,0xa9,
+0x88,0x22,0x8a,0xe2,0x32,0x8a,0xc8,0x31,0xb1,0xb1,0xac,0xb9,0x7b,0x85,0x9b,0x01,
+0x02,0xfb,0x28,0x10,0xa0,0x06,0x1a,0x20,0x98,0xf3,0x3a,0x28,0xa0,0x93,0x38,0xea,
+0x08,0x20,0x04,0x19,0xad,0xf8,0x81,0x18,0x8a,0x98,0xbb,0x82,0x72,0xbc,0x20,0xb1,
+0x51,0x99,0x25,0x31,0xbc,0x13,0xda,0x30,0x0a,0x94,0x00,0xb0,0x70,0x89,0x97,0x20,
+0x1a,0xd9,0x21,0x98,0x10,0x21,0x11,0xaf,0x91,0x48,0xc0,0x09,0x09,0x00,0xfb,0x40,
+0x9a,0x09,0x80,0xd0,0x53,0x89,0x00,0xa9,0x07,0x89,0x29,0xaa,0x14,0x32,0xe9,0x20,
+0x10,0x2a,0xc4,0xa3,0x5b,0xaa,0x94,0x20,0x59,0xc1,0x88,0x82,0x51,0xa9,0x90,0xb4,
+0x58,0xab,0x80,0x9a,0x84,0x18,0x8f,0xa0,0x11,0x19,0x06,0xab,0x8e,0x93,0x8a,0x31,
+0x0b,0x05,0xb3,0x1d,0x19,0x20,0x82,0x33,0xc1,0x3c,0xa9,0x17,0x29,0x3c,0xc5,0x09,
+0x18,0xb9,0x24,0x98,0x4a,0xea,0x12,0xcb,0x08,0x4c,0xa3,0xa1,0x49,0x13,0x9f,0x94,
+0x10,0x88,0x99,0x00,0xb1,0x98,0x5a,0x92,0x08,0x33,0xbd,0x21,0x15,0x35,0xa9,0x10,
+0x13,0xfb,0x09,0x2a,0x48,0xd3,0xd9,0x68,0x01,0x01,0x10,0x80,0x81,0xaa,0xdb,0x72,
+0xa0,0x00,0x89,0xaa,0x98,0x81,0x9c,0xbf,0x83,0x18,0x09,0x18,0xf0,0x41,0x2a,0xc9,
+0x93,0x01,0x71,0xb0,0x11,0x10,0x8a,0x0b,0x87,0x1d,0x10,0x92,0x19,0x81,0x16,0x9a,
+0x11,0x0b,0xa7,0x09,0x12,0x2d,0xba,0x04,0xb8,0xa9,0x3e,0xa1,0xb0,0x44,0x3d,0xd3,
+0x38,0x10,0xb8,0x60,0xa9,0x83,0xab,0x48,0x09,0x92,0x91,0x3b,0xbb,0x0b,0x67,0xa0,
+0x3a,0x80,0xda,0x30,0x89,0xbc,0x8a,0x15,0x10,0xbb,0xdb,0x21,0x2b,0xb1,0xe1,0x53,
+0x8c,0x01,0xa3,0x80,0x7c,0xb1,0x89,0x16,0x91,0x19,0x88,0xc1,0x82,0x3e,0x11,0xa9,
+0xa5,0x09,0x8a,0xb8,0x14,0x1d,0x82,0xc1,0x5a,0x08,0xd8,0x91,0x40,0xa8,0x20,0xc8,
+0x15,0x1d,0x18,0x04,0x0a,0x88,0x2a,0x90,0xc0,0xb0,0x40,0xa9,0xc8,0x2b,0x06,0x18,
+0x83,0x39,0x14,0xaa,0x78,0x98,0xa1,0x0b,0xc3,0x0f,0x88,0xc9,0x58,0xa8,0x44,0x0a,
+0x13,0xc0,0x20,0x08,0x89,0x31,0xf3,0x58,0x19,0x93,0xac,0x22,0x48,0xc9,0x00,0x04,
+0x1f,0xa0,0x10,0xca,0x80,0x9d,0x02,0x82,0x8c,0x40,0xc1,0x12,0x1a,0x98,0xa1,0x39,
+0xb9,0x78,0x86,0x88,0x42,0xba,0xc2,0x18,0x89,0x20,0x99,0xc0,0x42,0x11,0xbe,0xb0,
+0x89,0x7b,0x9a,0x95,0x98,0x02,0x2b,0x18,0x25,0xb4,0x6b,0x8b,0xc1,0x10,0x20,0x30,
+0xb0,0x14,0xa0,0x32,0xc8,0x78,0xc8,0x80,0x8b,0x92,0x21,0x9f,0xd0,0x72,0x98,0x09,
+0x90,0x00,0x29,0xa0,0x91,0x9c,0x23,0xc8,0x19,0x27,0x90,0x9b,0x40,0xb2,0x11,0x2c,
+0xe1,0x31,0xd9,0x43,0xda,0x80,0x28,0xc0,0x98,0xa2,0x54,0x0a,0x81,0xb1,0xaf,0x41,
+0x99,0x83,0x43,0x8b,0xa8,0x80,0x32,0x28,0xc3,0x1b,0x51,0x48,0xc9,0x04,0x4a,0xa9,
+0xaa,0x80,0x97,0x08,0xad,0x81,0x15,0x9b,0x1b,0x84,0xc1,0x30,0x9c,0xa8,0x92,0x41,
+0x15,0x8c,0x91,0x24,0x01,0xbd,0x92,0x79,0xb1,0x0a,0xa3,0x9a,0x9c,0xb1,0x52,0x2b,
+0xb6,0x50,0x91,0xa9,0x2a,0x86,0x10,0xaa,0x53,0x92,0x2a,0x91,0x99,0x94,0x50,0x99,
+0x02,0x93,0x6a,0x29,0xe3,0x32,0x8b,0x1a,0xe2,0x00,0x39,0xf1,0x29,0x03,0x8a,0xb9,
+0x30,0xed,0x12,0x29,0xa8,0xda,0x28,0xb9,0x00,0x1c,0x71,0xe0,0x18,0x99,0x00,0x80,
+0x4a,0x92,0xa1,0x1a,0x07,0x49,0x11,0xba,0xb3,0x7b,0x80,0x92,0xb8,0x3b,0x87,0x1b,
+0x19,0x04,0x18,0x90,0x9e,0x18,0x82,0xf8,0x19,0x1a,0x85,0x38,0xb0,0xdb,0x51,0xb0,
+0x02,0x0d,0x12,0xc1,0x40,0x9a,0x9b,0x96,0x1b,0x10,0xfb,0x12,0x1a,0x10,0x91,0x83,
+0xcf,0x30,0x92,0x83,0x29,0x9b,0x02,0xf9,0x40,0x12,0x9a,0x24,0x9a,0xab,0x29,0xa4,
+0x1a,0x35,0x93,0x1a,0xf1,0x2d,0x95,0x18,0x8d,0x90,0x12,0xc8,0x28,0x18,0x82,0x82,
+0xdf,0x21,0x89,0x0b,0x94,0x81,0x4a,0xc0,0xb9,0x5a,0x02,0x83,0xcc,0x00,0x38,0xc1,
+0x32,0xa9,0x05,0x78,0x98,0x01,0x20,0x0d,0x09,0x13,0xa0,0xcb,0x11,0xaa,0x3c,0xd5,
+0x39,0xc8,0x11,0x8e,0x20,0x11,0xc8,0xa0,0x71,0x00,0x81,0xa0,0x1c,0x90,0x81,0x58,
+0x11,0x05,0x9c,0x98,0x99,0x49,0xf1,0x30,0x98,0x98,0x3a,0x83,0xb2,0x1b,0x37,0x29,
+0xd9,0xb9,0x20,0x2c,0x97,0x28,0xbb,0x85,0x0b,0xa0,0x09,0x30,0x16,0x81,0x01,0xdb,
+0x04,0x2b,0x02,0xe0,0x22,0x1a,0x18,0x23,0xf4,0x19,0xb0,0x9b,0x01,0x98,0x87,0x28,
+0x1a,0x97,0x18,0x8c,0x91,0x09,0x3a,0x98,0xb0,0x3c,0x27,0x41,0x18,0xda,0x11,0xa1,
+0x3b,0xc4,0x22,0xdb,0x01,0x08,0x1a,0x96,0x0b,0x0c,0x96,0x99,0x2c,0xa0,0xb2,0x5a,
+0x82,0x29,0xa5,0x89,0x28,0x8c,0x95,0x12,0x1e,0x00,0x80,0x24,0x2a,0x0b,0xa9,0xe1,
+0x30,0x4b,0xb2,0x0c,0x91,0x0a,0x33,0x69,0xb4,0x09,0x38,0x1d,0xc5,0x09,0xa8,0x12,
+0x0d,0x88,0x90,0x2b,0x26,0x98,0x20,0xfb,0x14,0x0a,0x00,0x1a,0x96,0x18,0x48,0xe3,
+0x08,0x2a,0x81,0xa8,0x9a,0x07,0x9b,0x38,0x9a,0xa7,0x12,0x0b,0x88,0xe0,0x9a,0x10,
+0x83,0x1a,0xc0,0x8a,0x73,0x18,0x06,0x09,0x09,0x04,0x1c,0xb8,0x38,0xa9,0xa8,0xa2,
+0xb8,0x29,0xaa,0x9d,0xf8,0x17,0x29,0x9b,0xaa,0xb5,0x38,0x6a,0xb8,0xa0,0x30,0x88,
+0x15,0x8a,0xa2,0x4c,0x08,0x34,0x02,0x9d,0x96,0x2c,0x88,0xc3,0x28,0x31,0x88,0x0a,
+0xf1,0x42,0xab,0x18,0x90,0xa1,0x49,0xb3,0x9a,0x0c,0x17,0xc9,0x8a,0xd2,0x4a,0x12,
+0x01,0x1a,0x99,0x27,0x08,0x2b,0xb8,0x07,0x2a,0x09,0xbc,0x03,0x90,0x1b,0x22,0x9a,
+0xd3,0xe1,0x50,0x99,0x98,0x95,0x1a,0x82,0x4a,0x84,0x29,0x14,0xcb,0x20,0x98,0x1b,
+0xb2,0xeb,0x7a,0x32,0xf1,0x10,0x9a,0x10,0xa9,0x02,0x2a,0xa5,0x3b,0x99,0x0b,0xf2,
+0x70,0x98,0xa1,0x38,0x8e,0xa0,0x04,0x39,0x08,0xf2,0x89,0x80,0x29,0x07,0x28,0xa9,
+0x12,0xa9,0x88,0x00,0xd1,0x48,0xa8,0xc4,0x0b,0x1b,0xa4,0x00,0x39,0x97,0x30,0x9d,
+0x92,0x81,0x1e,0x91,0x10,0x18,0x11,0xfa,0x82,0x60,0xa9,0x10,0x02,0xba,0x24,0x18,
+0x1b,0xc9,0xb8,0x73,0x81,0x0b,0x22,0xe4,0x18,0x00,0x19,0x83,0x28,0xa5,0x3f,0x91,
+0x09,0x8b,0x83,0x9b,0x71,0xab,0x85,0x28,0xa9,0x12,0x12,0xdf,0x91,0xa8,0x48,0x18,
+0x1b,0x94,0xa0,0x0c,0x9b,0x39,0x97,0x2a,0x88,0xaa,0xf1,0x3c,0x94,0x1b,0x21,0x23,
+0x91,0x00,0x71,0xa0,0x03,0x0e,0xa3,0xb0,0x61,0xab,0xb1,0x13,0x39,0xac,0x93,0x01,
+0x2c,0xf9,0x78,0xa9,0x80,0x13,0x9a,0x31,0xb0,0xa0,0x0f,0xa8,0x91,0x13,0x8f,0x13,
+0x21,0x10,0xc0,0x44,0x2a,0xaa,0xb4,0x73,0x08,0x30,0xa1,0x17,0x1a,0x92,0xa9,0x98,
+0xad,0x02,0x1b,0xac,0x06,0x3a,0xf0,0x1b,0xc3,0x39,0x88,0x91,0x9b,0x89,0x45,0x9b,
+0x04,0x99,0x22,0x9c,0x21,0x34,0x81,0xfa,0x0d,0x82,0x90,0x8b,0x03,0xc9,0x25,0x1b,
+0x33,0x20,0xea,0x19,0x82,0x7b,0xa4,0x29,0x90,0x2a,0x85,0x81,0xba,0x2b,0x19,0xa7,
+0x04,0x0d,0x80,0xb3,0x0d,0x11,0xa8,0x1a,0x9a,0xa8,0x0b,0xf8,0x1b,0x91,0x88,0xc8,
+0xc2,0x3d,0x09,0x82,0x08,0x08,0x79,0x9a,0x96,0x39,0x8b,0x03,0x39,0x99,0xe9,0x10,
+0x64,0x0a,0x58,0xb5,0x49,0x19,0x13,0xe8,0x21,0x19,0x99,0x91,0x32,0x28,0x90,0x95,
+0x8b,0x0b,0xfa,0x1c,0x92,0x1c,0x91,0xf8,0x31,0x8f,0x80,0x31,0xb0,0x01,0xad,0x08,
+0x08,0x07,0x09,0xa9,0x02,0x3a,0x06,0x08,0x98,0x90,0x2a,0xb2,0x93,0x78,0xd1,0x91,
+0x28,0x28,0xc9,0x34,0xf0,0x20,0x91,0x8b,0x06,0x18,0xb9,0x05,0x1a,0x8b,0x00,0xa8,
+0x83,0x22,0x1d,0xaa,0xcb,0xf3,0x3d,0x80,0xa3,0x9f,0x22,0x99,0x01,0xa1,0x80,0x1a,
+0x6a,0x22,0xd6,0x0a,0x28,0x11,0x02,0x94,0x3c,0x02,0xb9,0x73,0xd8,0x18,0x00,0x90,
+0x41,0x98,0x91,0x8c,0x89,0xc9,0x32,0xa0,0xe4,0x10,0x0d,0xb1,0x20,0xa9,0x3a,0x12,
+0x17,0xcb,0x51,0x98,0x1a,0xc3,0x18,0x29,0xc9,0x05,0x89,0x1a,0xc3,0x42,0xdc,0x08,
+0x90,0x08,0x28,0x01,0xb5,0x39,0x40,0x11,0x17,0x9a,0x94,0x32,0x0f,0x90,0x08,0xa1,
+0x18,0x82,0x0f,0xa2,0x94,0x29,0x42,0xbb,0x18,0xd3,0x8a,0xab,0x09,0x16,0x03,0x1d,
+0xa0,0x9c,0x11,0x06,0x9c,0x21,0xa8,0x11,0xda,0x0a,0x22,0x03,0x51,0x40,0xb2,0x2e,
+0x83,0xda,0x01,0x29,0xa0,0x21,0xd0,0x8b,0x08,0xec,0x19,0x99,0x06,0x18,0x8c,0x80,
+0x07,0x98,0x31,0x1c,0xe2,0x81,0x89,0x10,0x09,0xa2,0x32,0x90,0x8a,0xcf,0x88,0x02,
+0xaa,0x9a,0x32,0x27,0x39,0x14,0xa0,0x12,0x2d,0x19,0xf3,0x92,0x1f,0xb8,0x02,0x1a,
+0x84,0x19,0x21,0x20,0xb2,0xb1,0x4c,0x51,0x11,0xa7,0x1b,0x08,0xc0,0x38,0x9a,0x14,
+0x02,0x2a,0x96,0x1c,0x84,0x2b,0xb1,0xac,0x31,0x32,0xcc,0x14,0xb9,0x8e,0xa3,0x9a,
+0xba,0x36,0x8b,0xc3,0x0a,0x82,0x71,0xd8,0x00,0x98,0x20,0x9c,0xa1,0x1c,0x94,0x12,
+0xbb,0x2a,0x87,0x2e,0xa2,0x03,0x9c,0x29,0xb2,0x11,0x0a,0x7b,0xc2,0x89,0x01,0x11,
+0xaa,0x30,0xc3,0x21,0x8e,0x99,0x62,0x80,0x29,0x97,0x09,0x39,0xf0,0x28,0xa0,0x21,
+0x4b,0xb8,0x18,0x01,0x40,0xf9,0x28,0x19,0x87,0x28,0xaa,0x88,0x41,0xf2,0x1a,0x90,
+0x31,0xa0,0xa0,0x98,0x28,0xa5,0x39,0xad,0x13,0x01,0xc1,0x59,0x51,0xa1,0xd1,0x29,
+0x29,0xcb,0x16,0x89,0x11,0x00,0x8a,0xab,0x34,0xa1,0x9f,0xc1,0x24,0x9b,0x92,0x88,
+0x8e,0x83,0x89,0xc2,0x60,0x9a,0x81,0xa0,0x2b,0x4b,0xa2,0x17,0x99,0x39,0xb8,0xf9,
+0x40,0x00,0x80,0xf9,0x20,0x38,0xb2,0x40,0xb8,0x22,0x20,0xf8,0x09,0x38,0xad,0x25,
+0x00,0xa8,0x3b,0xa2,0xd8,0x0a,0x10,0x98,0x25,0x0e,0x90,0x09,0x88,0x5a,0x03,0x94,
+0x3c,0xb1,0x10,0x2b,0xe2,0x99,0x78,0x81,0xc1,0x28,0x10,0x10,0x18,0x97,0xcd,0x30,
+0x28,0x93,0x8a,0x19,0x16,0x19,0xb0,0x4c,0xc0,0x10,0x18,0x0a,0xe1,0x51,0xbb,0x84,
+0x09,0x19,0xb9,0x05,0x8a,0xaa,0xb9,0x41,0x81,0x45,0xbb,0xe0,0x10,0x8d,0x90,0xb2,
+0x28,0x2a,0x07,0x89,0x18,0xc1,0x04,0x2c,0xa2,0x8b,0xbb,0x07,0x71,0x80,0x98,0xa0,
+0x28,0xaa,0x30,0x93,0x80,0x78,0xb9,0x24,0xba,0x9a,0x10,0x25,0x39,0xf9,0x58,0x89,
+0x88,0xa1,0x19,0x83,0x9f,0x43,0xa1,0x09,0x81,0x2d,0x17,0x19,0xb0,0x92,0x1f,0x91,
+0x18,0xaa,0xb0,0x38,0x4b,0x05,0xf8,0x10,0x19,0x88,0x14,0xca,0x41,0x08,0xa8,0xc1,
+0x58,0x00,0x01,0xb2,0x2b,0x28,0x82,0x10,0xc2,0x6b,0x80,0xa0,0x83,0xd9,0x78,0x94,
+0xcb,0x82,0x2d,0xa1,0x19,0xb4,0x39,0x8b,0xfa,0x82,0x40,0x88,0xa8,0x39,0x98,0xe2,
+0x5b,0x82,0x28,0x88,0xd0,0x48,0x20,0xc1,0x11,0x9a,0x26,0x9d,0x81,0x88,0x52,0x88,
+0x92,0xa9,0xd9,0x2a,0x02,0x2a,0x87,0x21,0x0e,0xb0,0x81,0x28,0x0d,0x81,0x50,0xa0,
+0x10,0x0c,0xd9,0x08,0x98,0x30,0x9c,0xb3,0x9a,0x57,0x0a,0xa0,0x91,0x8b,0x09,0x8b,
+0x91,0x8f,0x92,0xa1,0x3c,0x8b,0x13,0x13,0x71,0xb4,0x09,0x94,0x18,0x78,0xc8,0x84,
+0x0b,0x01,0x52,0xa8,0xa2,0x7a,0xa1,0x8a,0xba,0x63,0x89,0xa5,0x2a,0x8a,0x14,0x10,
+0x19,0x23,0xcc,0x20,0xb8,0xfa,0x60,0xa0,0x18,0xa0,0x10,0x89,0x98,0x40,0x9a,0x17,
+0x1b,0xa2,0x31,0x8e,0xc8,0x10,0x18,0x05,0x49,0x98,0xaa,0x03,0x01,0x2c,0x41,0xe1,
+0x00,0x29,0x88,0x01,0x0b,0x81,0xe5,0x78,0x82,0xaa,0xa1,0x20,0x89,0x59,0x81,0xc9,
+0x83,0x3d,0x98,0x09,0x20,0xf1,0x4d,0x89,0x88,0xa8,0x08,0x01,0x2c,0xa3,0x45,0xa1,
+0x2b,0x95,0x29,0xab,0xb3,0xcf,0x34,0x8a,0x88,0x90,0x4a,0x02,0xf9,0x20,0x99,0x11,
+0x1a,0xc1,0x01,0x3f,0xd8,0x12,0xaa,0x23,0x09,0x40,0xc1,0x10,0x88,0x04,0x5b,0x80,
+0xc1,0x42,0xbb,0x12,0x8b,0xf3,0x2c,0x80,0x02,0x00,0x89,0x1c,0x10,0x85,0xaa,0x70,
+0xb3,0x99,0x33,0x89,0xbf,0x11,0xbb,0x12,0x4a,0x00,0x85,0x2a,0x40,0xa0,0x93,0x7a,
+0x21,0x93,0x9b,0x4d,0xd2,0x18,0x11,0xa8,0x12,0x18,0x7a,0x96,0x8a,0x2a,0x11,0x28,
+0xb1,0x10,0xed,0x48,0xb8,0x02,0xcb,0x38,0x03,0xe3,0xab,0x39,0xf1,0x99,0x2c,0xc8,
+0x90,0x48,0x21,0x11,0xb1,0x20,0x02,0x0f,0x83,0x88,0xbc,0xa2,0x79,0x90,0x93,0x3a,
+0x1f,0xc2,0x20,0x38,0xd2,0x3a,0x91,0x99,0xd5,0x1a,0x1b,0x14,0x88,0x91,0x40,0xab,
+0x29,0x53,0xe3,0x38,0x08,0xab,0x94,0x84,0x2d,0xab,0x86,0x18,0xb8,0x18,0x6a,0x85,
+0x00,0x80,0x3d,0x90,0xc3,0x18,0x08,0x38,0xab,0x01,0x81,0x97,0x1c,0x99,0x17,0x80,
+0x98,0x88,0x21,0x0b,0xd1,0x25,0x8c,0x90,0x89,0x91,0x21,0x23,0x2e,0xf4,0x2c,0x90,
+0x98,0x80,0x09,0x21,0xa9,0xa1,0x9f,0x20,0x82,0x0b,0x50,0xd9,0x31,0xba,0x00,0x47,
+0x18,0x89,0xc1,0x4a,0xa9,0x04,0x0a,0x03,0x9e,0xa0,0x80,0x70,0x00,0x98,0x00,0x01,
+0x1e,0x93,0x19,0x01,0x43,0x0c,0x09,0xf3,0x08,0x2b,0x08,0xd0,0x14,0x08,0xa0,0x29,
+0xb8,0xa2,0x5b,0xe2,0x39,0x14,0x18,0x83,0x0c,0xc3,0x2d,0x90,0x23,0x90,0x5b,0xd9,
+0xa2,0x3a,0x8a,0x05,0xb8,0x78,0xb1,0xa8,0x33,0x09,0xeb,0x83,0x81,0x6d,0xb1,0x90,
+0x0b,0x98,0x10,0xef,0x08,0x90,0x19,0x0a,0x14,0xbb,0x43,0x38,0xa0,0x41,0x91,0x00,
+0x9d,0x1d,0xb1,0x04,0x59,0x1a,0xa4,0xb9,0x49,0x42,0x89,0x85,0x81,0x52,0xaa,0x32,
+0x98,0x00,0xc2,0x1d,0x11,0xcb,0x02,0xb2,0x12,0xef,0x81,0x38,0xd8,0x03,0x3b,0x90,
+0x1a,0xd5,0x29,0x00,0x1d,0xe1,0x00,0x38,0x01,0xb9,0xa4,0x8c,0x91,0x28,0x28,0xe9,
+0x23,0x80,0x0b,0x88,0x18,0x21,0x78,0xa9,0xb4,0x79,0x93,0xb1,0x31,0x0b,0xe8,0x01,
+0x9a,0x17,0x9e,0xa3,0x09,0x09,0x99,0x82,0x1a,0x72,0xb3,0x29,0x51,0xe8,0x12,0x19,
+0x08,0x00,0x20,0xa8,0xa8,0x8e,0x07,0xaa,0x00,0xa1,0x11,0xeb,0x41,0x89,0x93,0x08,
+0x1d,0x83,0xd0,0x69,0x92,0x18,0x80,0x0a,0x85,0x98,0x29,0x00,0xb3,0x44,0x9f,0xa1,
+0x20,0xb8,0x39,0xa0,0xc8,0x28,0x08,0x89,0x91,0x49,0x67,0x8d,0xa2,0x21,0x3a,0xe8,
+0x22,0x0b,0x89,0x13,0x19,0x03,0xdf,0x93,0x7b,0x91,0x98,0x31,0x08,0xbd,0x00,0x81,
+0x93,0x7b,0xa2,0x90,0x80,0x2c,0xd8,0x08,0x91,0x58,0x88,0x29,0x85,0xa8,0x09,0x19,
+0x10,0xf2,0x2b,0x04,0x31,0x2d,0xb4,0x0a,0x0a,0x84,0x0b,0x19,0xb0,0x06,0x19,0x5b,
+0x06,0xa1,0x1a,0x8b,0x1a,0x17,0x9a,0x1b,0x0b,0xa4,0x01,0x68,0xb9,0x08,0x0b,0xc3,
+0x19,0x24,0x0f,0x84,0x21,0xa9,0x99,0xba,0x14,0x1f,0xa1,0xba,0x40,0x18,0x41,0xa8,
+0x06,0x38,0xc9,0x21,0x8d,0x93,0x01,0x0c,0x92,0x0d,0xc0,0x58,0xb0,0x10,0x12,0x7a,
+0xc8,0x83,0x8a,0x51,0xb8,0xa3,0x30,0x8b,0x26,0x99,0x91,0x10,0x8f,0xb0,0x71,0xa8,
+0x12,0x21,0x2a,0xf2,0x20,0x8d,0x81,0x81,0x30,0xa1,0x9e,0x80,0x81,0xac,0x92,0x49,
+0x41,0xc3,0x8a,0x88,0xaa,0x81,0xad,0x71,0xb1,0x29,0xaa,0x93,0xb0,0x0f,0xe2,0x02,
+0x2a,0xaa,0x84,0x99,0x11,0x19,0x11,0x86,0x9a,0x02,0x53,0x0d,0xb5,0x09,0x10,0x30,
+0xc2,0x02,0xad,0x1b,0x04,0xb1,0x18,0x9d,0xe0,0x09,0x12,0x21,0x82,0xd9,0x5a,0xc8,
+0x84,0x49,0xa9,0x14,0x1b,0x12,0xc4,0x3a,0x98,0xa0,0x01,0x01,0x79,0xb3,0x31,0xa0,
+0x70,0x91,0x0b,0x92,0x10,0x9c,0x34,0xaa,0x69,0x0a,0x94,0x21,0x9c,0x8f,0xc0,0x48,
+0x11,0xa0,0xc1,0x3a,0x99,0x97,0x29,0x88,0xe2,0x2b,0x88,0xb0,0x33,0xb0,0x1a,0xc4,
+0xaf,0x12,0x21,0xc9,0x22,0x18,0x99,0xe1,0x91,0x29,0x2a,0x07,0xab,0x11,0x32,0x9d,
+0x92,0x9c,0x50,0xc9,0x24,0x1a,0x92,0x18,0xa0,0x52,0x08,0x94,0x81,0x0c,0x1c,0xc4,
+0x19,0x00,0x71,0xb8,0xa1,0xba,0x39,0x14,0xb9,0x11,0xb2,0xcd,0x59,0xb0,0x23,0x8d,
+0x93,0x48,0xc0,0x50,0x92,0x08,0xc9,0x29,0xd2,0x10,0x4b,0xd3,0x20,0x9a,0x00,0x17,
+0x89,0x0a,0x82,0x0a,0x18,0x7b,0x92,0x92,0x19,0x8d,0x45,0xd9,0x80,0x08,0x99,0x48,
+0x39,0xf3,0x09,0x2a,0x93,0x21,0xea,0x41,0x01,0x9c,0x95,0x29,0x29,0x92,0x02,0xb9,
+0x82,0x7b,0xc0,0x00,0x10,0x1b,0x95,0x48,0xb9,0xe0,0x49,0xbb,0x92,0x14,0x8c,0x05,
+0x89,0xa0,0x2b,0x30,0xd2,0x98,0x62,0x89,0x10,0xbd,0x13,0x48,0x95,0x49,0xd0,0x29,
+0x90,0x00,0xb9,0x1b,0x13,0xd3,0x50,0xb9,0x30,0xb3,0xca,0x2a,0x29,0xcb,0xc9,0x55,
+0x03,0x2d,0xa3,0x80,0x2c,0xa2,0x1c,0xa8,0x05,0x20,0xba,0xad,0xc3,0x20,0xcb,0x09,
+0xaa,0x85,0x51,0x00,0x0a,0x84,0x10,0x9a,0x16,0x02,0x1b,0x3b,0x17,0x22,0x2e,0x9a,
+0xb3,0x21,0x51,0x1b,0xd1,0x01,0x1b,0x87,0x80,0x3b,0xb5,0x90,0x1d,0x98,0x23,0xa8,
+0x81,0xac,0x40,0xda,0xa0,0x98,0x42,0x9a,0xdc,0x83,0x19,0x11,0xb9,0xc2,0x49,0xdb,
+0x93,0x41,0x8f,0x93,0x10,0x90,0x09,0x69,0xaa,0x85,0x19,0x81,0x72,0xa9,0x00,0x84,
+0x1c,0x90,0x12,0x0a,0x02,0xfb,0x38,0x88,0xa1,0x28,0x41,0xa0,0x9b,0x7b,0x91,0x97,
+0x19,0x1c,0x92,0x80,0x30,0x11,0xd0,0x0b,0xa0,0x5e,0xa1,0x85,0x28,0x08,0xd0,0x30,
+0xb9,0x09,0x0b,0x28,0xf0,0x23,0x0b,0x00,0x16,0xbb,0x60,0xb9,0x91,0x0d,0x31,0xb0,
+0xc9,0x44,0x0a,0x10,0xe9,0x80,0x18,0x39,0x84,0x98,0x02,0x9f,0x9a,0x95,0x1b,0x11,
+0x81,0x13,0x9f,0x10,0xb9,0x80,0x3b,0x9f,0x84,0x28,0x3a,0xd9,0x69,0xa1,0x41,0xa8,
+0x84,0x8a,0x92,0x8d,0x24,0x88,0x01,0x0a,0xe9,0x8a,0x12,0x29,0xcc,0xa2,0x5a,0x32,
+0x02,0xb8,0x00,0x0d,0xa3,0x1d,0x05,0x88,0xa9,0x38,0x82,0xd8,0x9a,0x73,0xca,0x20,
+0xd9,0x11,0x02,0x0b,0x88,0x17,0x09,0x19,0x13,0xd1,0x78,0x90,0xa9,0x11,0x0f,0x01,
+0x91,0x19,0xa0,0x78,0xa0,0x00,0x99,0x1a,0x81,0x3e,0xc3,0x90,0x59,0x9b,0x85,0xa8,
+0x29,0x02,0xa1,0x58,0x19,0xe9,0x82,0x4a,0x8c,0x85,0x8a,0x82,0x98,0x0b,0xc2,0x28,
+0xc8,0x4b,0xa1,0xb3,0x0d,0x50,0x85,0x90,0x18,0x0e,0x14,0x80,0x18,0x99,0xb0,0x4b,
+0x85,0x09,0x21,0xa2,0x11,0x7b,0xa4,0x18,0x12,0x88,0x28,0xf9,0x31,0x29,0xb2,0x1c,
+0x88,0x33,0xfa,0x29,0x9f,0x10,0xb0,0x88,0x12,0x7a,0xe9,0x12,0x10,0x8b,0x92,0x8d,
+0xa1,0x11,0x19,0x9f,0x13,0x89,0x19,0x90,0xe1,0x20,0x18,0xac,0x86,0x99,0x02,0x9b,
+0x32,0x9b,0x87,0x8f,0x92,0x5b,0x83,0x09,0xa2,0x00,0x0c,0x9b,0x92,0x25,0x32,0x2b,
+0xcb,0x80,0x24,0xc2,0x7a,0xc9,0x12,0x08,0xa1,0x61,0x91,0x0a,0x8a,0x80,0x50,0xf9,
+0x3a,0x00,0xa1,0x09,0x6a,0x87,0x18,0x18,0xb0,0x28,0xc8,0x89,0x19,0xf2,0x1a,0x82,
+0x10,0x82,0x3a,0xf9,0x12,0x0a,0xac,0x81,0x18,0x01,0xeb,0x49,0x92,0x92,0x3b,0xab,
+0x26,0xb9,0x27,0x29,0xdb,0x90,0x03,0x4c,0xcb,0x85,0x29,0x1b,0x83,0x81,0x99,0x80,
+0x3d,0x94,0xcb,0x20,0x80,0x3b,0x78,0xe1,0x10,0x11,0x0a,0xa0,0x10,0x69,0xc8,0x00,
+0x0a,0x22,0x21,0x91,0xa1,0x0d,0x0f,0xd8,0x28,0x03,0x8a,0x31,0xee,0x12,0x99,0x10,
+0x13,0x9c,0xc3,0x0b,0x89,0x22,0x22,0x53,0xcb,0x88,0x73,0xa2,0x8a,0xcb,0x73,0xca,
+0x98,0x00,0x20,0x81,0x1c,0x93,0x27,0x89,0x8a,0xa1,0x1a,0x80,0x32,0xaa,0x20,0xad,
+0x27,0x8e,0x19,0x06,0xbb,0x30,0x18,0xf9,0x01,0x19,0x28,0xaa,0x84,0xa0,0x7b,0x93,
+0xb0,0x82,0x71,0x01,0xd1,0x20,0x19,0xa9,0x80,0xb3,0x38,0x7b,0xab,0x97,0x1a,0x18,
+0x88,0x91,0x80,0x8d,0x11,0xa3,0x0b,0xaa,0x71,0xd1,0xa1,0x19,0x0d,0x15,0x11,0x89,
+0x91,0x2a,0x80,0xdd,0x02,0x40,0xa0,0x30,0xf0,0x29,0x1b,0xb0,0x28,0xb8,0x04,0x2a,
+0x69,0x04,0x93,0xbf,0x48,0x12,0x99,0x83,0x29,0x1a,0x8c,0xe0,0x18,0x19,0x2a,0xe1,
+0x09,0x83,0x73,0x9a,0x81,0xea,0x80,0x61,0x19,0x81,0xa8,0x31,0x0d,0x02,0xab,0x83,
+0x68,0xc2,0x89,0x3a,0x21,0xc0,0x90,0x58,0x13,0x9b,0x81,0xf9,0x25,0x0c,0x80,0x1a,
+0xa8,0xb2,0x0d,0xc3,0x8d,0x41,0x02,0x1a,0xc1,0x11,0x29,0x8d,0xc3,0x25,0x2b,0x99,
+0x08,0xd1,0x03,0x2c,0x01,0xd9,0x08,0x98,0x50,0xd8,0x68,0xc1,0x20,0x08,0xa9,0x11,
+0x00,0x29,0xe1,0x49,0x01,0x90,0x43,0x9b,0x16,0x80,0x0b,0x30,0xe2,0x10,0x39,0xac,
+0xa6,0x39,0x31,0xc9,0x00,0x99,0xb3,0x7b,0xaa,0xb4,0x99,0x48,0xc0,0xb3,0x8d,0x91,
+0x01,0x59,0xe1,0x09,0x01,0x28,0xb5,0x0c,0x98,0x83,0x90,0x33,0x9f,0x96,0x8b,0x83,
+0x81,0x10,0x0a,0x14,0xba,0xbc,0x21,0x10,0xcd,0x04,0x3b,0x05,0x0b,0x92,0x98,0x83,
+0xaf,0xa3,0x15,0x0a,0x0b,0x84,0x08,0x62,0x00,0x8a,0xd8,0x42,0xab,0xc0,0x1b,0x20,
+0xc4,0x22,0xa1,0x5b,0x03,0xd0,0x1a,0x23,0x23,0xec,0x98,0x32,0x8a,0x82,0x10,0xf9,
+0x79,0xa2,0x8a,0xa1,0x2a,0xc2,0x8b,0x44,0xb8,0x85,0x0b,0x49,0xb4,0x1c,0x88,0x92,
+0xba,0x21,0x8c,0x28,0xa2,0x27,0x3c,0xd2,0x29,0x81,0x99,0x22,0xe2,0x3b,0xb8,0x15,
+0x2a,0x1a,0xf2,0x89,0x83,0x09,0x99,0xa0,0x58,0x93,0xac,0x31,0x91,0x61,0x14,0x11,
+0x71,0x98,0xb3,0x08,0x2d,0x0a,0xa4,0x1d,0xc2,0x4a,0x08,0x13,0x81,0x23,0xab,0x1a,
+0xcf,0xa1,0x18,0x9c,0x44,0xa9,0xc2,0x11,0x19,0x11,0xc5,0x13,0x8f,0xa9,0x05,0x18,
+0xa1,0x8a,0x11,0x48,0x91,0xa0,0x44,0x4b,0xe4,0x01,0x99,0x0a,0xa1,0x38,0x96,0xaa,
+0x30,0xaa,0xb5,0x3a,0xb3,0x2a,0x8a,0xd6,0x38,0x08,0x28,0xf2,0x28,0x8d,0x80,0x83,
+0x34,0x9d,0x01,0x10,0xbb,0xa0,0x8b,0x22,0x2d,0xc6,0x12,0x9e,0x30,0xb0,0x33,0xda,
+0x31,0x19,0x9a,0xe0,0x71,0xa8,0x08,0x00,0x21,0x8c,0x92,0xa2,0x4f,0x90,0x10,0xb0,
+0x28,0x08,0x2a,0x94,0xe0,0x39,0x09,0xa3,0x9d,0x00,0x09,0x05,0x2d,0xb1,0x93,0x42,
+0x59,0xa9,0x85,0x1a,0x80,0x2b,0x05,0x09,0x92,0xd0,0x7a,0xa9,0x81,0x89,0x84,0x8c,
+0x01,0x40,0x83,0x99,0x11,0x8f,0xa0,0x18,0xe1,0x2a,0xc1,0x39,0xf9,0x30,0xf9,0x21,
+0x19,0x08,0xa0,0x81,0x28,0xaa,0x25,0x69,0xb2,0x28,0x82,0xbb,0xac,0x28,0x9c,0x17,
+0x99,0x02,0x09,0xba,0x33,0xbe,0x43,0xa9,0xc1,0x50,0x02,0x18,0x32,0x06,0xa9,0x3b,
+0xd1,0x41,0xa9,0xb2,0x2a,0xa0,0xbc,0x37,0x01,0xcb,0x4a,0x13,0x99,0x09,0x8d,0xc0,
+0x32,0x9b,0x0a,0xca,0x97,0x2c,0x30,0x98,0xa2,0x91,0x00,0x5f,0x91,0x98,0x85,0x3b,
+0xa2,0x98,0x98,0x79,0xcb,0xa3,0x39,0x9b,0x20,0xb8,0x59,0x07,0x0b,0x91,0x48,0xb1,
+0x23,0x9a,0x9f,0x10,0x31,0xb2,0xc0,0x4b,0xc9,0x00,0x83,0x7a,0x84,0x90,0x19,0x99,
+0x09,0xc5,0x1d,0x34,0x99,0x90,0x90,0x4b,0xa0,0xa2,0x94,0x69,0x01,0x98,0x11,0xfb,
+0x29,0x1a,0x38,0x94,0xb3,0x9c,0x89,0x28,0xa8,0xd5,0x8b,0x42,0xb9,0xb1,0x73,0xb0,
+0x19,0x80,0x8a,0x92,0xdb,0x57,0x18,0xd1,0x91,0x18,0x3a,0xb4,0x9c,0x18,0x13,0x98,
+0x9b,0xbc,0x00,0x26,0x91,0xa2,0x1c,0x90,0x0f,0x83,0x04,0x1d,0x01,0x05,0x09,0xfa,
+0x00,0x18,0x01,0x29,0xc0,0xda,0x39,0x09,0x00,0x86,0x38,0x39,0xe3,0x19,0x98,0x88,
+0x18,0x16,0xab,0x1a,0xc0,0x00,0x43,0x91,0x8f,0xa1,0x41,0x0a,0x82,0x1b,0x97,0x1d,
+0x98,0x21,0xa3,0x2a,0xc0,0x28,0x2b,0x93,0xf3,0x29,0xb9,0x20,0xbc,0x74,0x88,0x93,
+0x6b,0x90,0x99,0x03,0x9a,0x79,0x90,0x93,0x8a,0x1d,0xb3,0x42,0xbb,0x38,0xb2,0x7a,
+0xe3,0x30,0x28,0xc0,0x1b,0x13,0xc8,0x5a,0xb8,0x85,0x19,0x1a,0x01,0xb1,0x0a,0x88,
+0x70,0xb0,0x19,0xab,0xf1,0x59,0x09,0xa4,0xa0,0x78,0xba,0xa8,0x81,0x79,0xa1,0x1a,
+0xb1,0x31,0x11,0x8c,0x91,0xc9,0x10,0xa0,0x7e,0xb0,0x01,0x20,0x9e,0x00,0xb3,0x38,
+0x5b,0xb2,0x90,0x1d,0x11,0x09,0x02,0xa9,0xcd,0x30,0x00,0x88,0x03,0x5b,0x53,0xf0,
+0x18,0x2a,0x81,0x2a,0xb8,0x37,0x0b,0xa0,0x99,0x19,0xb4,0x48,0x19,0x99,0x32,0x22,
+0xf5,0x9c,0x08,0x22,0xa8,0x09,0x00,0x94,0x54,0x1c,0x94,0x80,0x58,0xb0,0x61,0xc9,
+0x81,0x89,0x38,0xa0,0x83,0x3d,0xc2,0x49,0x08,0xc2,0x18,0xbb,0x16,0x00,0x9b,0x01,
+0xeb,0x81,0x2b,0xbd,0xa3,0x01,0x2c,0x63,0x88,0xe4,0x39,0x01,0x98,0x9a,0xb9,0x24,
+0x20,0x8c,0x07,0x8a,0x08,0x80,0x12,0x1a,0x92,0xf3,0x29,0x78,0xc0,0x13,0x89,0x9b,
+0x13,0x39,0xa6,0x10,0x8c,0x0a,0x21,0xf2,0x2a,0x08,0xa8,0x08,0x24,0x21,0x02,0x33,
+0xff,0x02,0xba,0x39,0x03,0x38,0xda,0x92,0x92,0x3f,0xb0,0x82,0x0c,0x8a,0x24,0xc9,
+0xb8,0x59,0x82,0x29,0x33,0xa9,0x14,0x8f,0xa5,0x20,0x8c,0xa8,0x85,0xad,0x29,0x33,
+0x03,0x90,0x7a,0x88,0xc0,0x91,0x39,0xb8,0xb1,0x23,0x51,0xaf,0x00,0x82,0x19,0xdb,
+0x89,0x53,0xa9,0x02,0x20,0x9a,0xbb,0x4a,0xf2,0x7b,0x90,0x01,0x91,0x2a,0x20,0xd0,
+0x21,0x92,0x5c,0xe1,0x00,0x01,0x59,0xc8,0x23,0x19,0x0a,0x94,0x89,0xc9,0x48,0x0a,
+0x07,0x98,0x19,0xb9,0x5a,0xd2,0x19,0x18,0xa0,0x19,0x09,0x91,0xef,0x82,0x48,0x90,
+0xa1,0x1c,0x11,0x83,0x22,0x1a,0x19,0xe1,0x22,0x9c,0x88,0xc0,0x38,0x15,0x18,0xf9,
+0x79,0x90,0x00,0x89,0x30,0xca,0x83,0x1c,0xa0,0x12,0x9b,0x05,0x29,0x00,0x26,0x88,
+0x1a,0x58,0xc2,0x39,0x01,0x02,0x9f,0x80,0x9c,0x95,0x3b,0x09,0x92,0x42,0x92,0x0a,
+0xf8,0x1b,0x38,0x02,0xa0,0x14,0x4a,0xda,0x93,0x9c,0x14,0x28,0xb0,0x2a,0x8a,0x84,
+0xa5,0x82,0x1f,0xa8,0x20,0x9b,0x13,0xff,0x2b,0x02,0x02,0x20,0x99,0x89,0xc0,0x4b,
+0xd1,0x39,0x8d,0x07,0x89,0x01,0x9a,0x11,0xa4,0x00,0x2e,0x90,0xa3,0x49,0x9c,0x02,
+0x02,0x80,0x90,0x9d,0x34,0xeb,0x93,0x1a,0x9a,0x38,0x94,0x33,0x4b,0x02,0xb4,0x1d,
+0x90,0xd9,0x42,0x19,0xa0,0xb5,0x1a,0x3a,0x94,0xa1,0x0f,0x1a,0x88,0x06,0x98,0x29,
+0xf8,0x29,0x91,0x93,0x0d,0x1b,0xb4,0x5a,0x92,0x0c,0x81,0x88,0x1a,0x83,0x12,0x1f,
+0x98,0xb1,0x21,0x69,0xaa,0xa2,0x94,0x0c,0x8c,0x01,0x28,0x87,0xab,0x01,0x9f,0x83,
+0x18,0x05,0x18,0x09,0xdb,0x32,0x88,0xa9,0x2a,0xe4,0x42,0x28,0x9b,0x87,0x20,0x19,
+0xaa,0x81,0x51,0x89,0xd2,0x42,0x1b,0xb0,0x84,0x39,0xaa,0x1b,0x06,0x93,0x01,0x7b,
+0xc3,0xa8,0x11,0xaa,0x1e,0xb2,0xb9,0x3a,0x09,0x61,0x84,0x98,0x38,0xea,0x29,0xa9,
+0x80,0x88,0x7b,0xc9,0x20,0x81,0x39,0x43,0xf9,0x9b,0x9b,0x32,0x1d,0xe1,0x01,0x01,
+0x19,0x9c,0x87,0x12,0x19,0x90,0x88,0x94,0xa0,0x1c,0x21,0xa4,0x82,0x1a,0x92,0x9f,
+0xa6,0x1a,0x92,0x13,0x28,0xca,0x95,0x5a,0x01,0xa0,0x14,0x9a,0xca,0x02,0x41,0xc0,
+0x4b,0xc0,0x81,0x58,0x0a,0x9a,0xa5,0x1a,0x14,0x88,0xba,0x15,0xb8,0xcd,0x32,0x20,
+0xb8,0xb0,0xa9,0xa6,0x3d,0xb2,0x59,0xd2,0x08,0x68,0x98,0xa2,0x1b,0x3a,0x82,0xd8,
+0x33,0x3a,0xcb,0xa2,0x0f,0x91,0x10,0xaa,0x12,0x1b,0xb3,0x78,0x06,0xa9,0x9a,0x01,
+0x6b,0x12,0xb3,0x7a,0xc8,0x40,0x90,0xa8,0x0a,0x0b,0x07,0x90,0x5a,0x93,0xa0,0x20,
+0x0d,0x91,0x90,0x12,0x9c,0xa1,0x08,0xba,0x49,0x72,0xc2,0x18,0x98,0x0a,0x04,0x49,
+0xf9,0x23,0xab,0x11,0x00,0x80,0x10,0xfb,0x09,0x4b,0x04,0xaa,0xa1,0x89,0x45,0x48,
+0xc2,0x90,0x29,0x98,0x94,0x9d,0x09,0x05,0x90,0x70,0xc8,0x81,0x09,0x18,0xa0,0x13,
+0x8e,0xc2,0x58,0xa0,0x08,0x1a,0x85,0x09,0x39,0x81,0xd2,0x58,0xb0,0x23,0x8d,0x00,
+0xa0,0xe8,0x09,0x18,0xb8,0x16,0x99,0x62,0x9a,0xb2,0x31,0xac,0x04,0x19,0xa9,0xa2,
+0x05,0x2e,0x92,0xba,0x86,0x89,0x10,0x20,0xe0,0x11,0xa9,0x3b,0xa1,0x31,0xb2,0x43,
+0x8b,0x26,0xf0,0x0a,0xab,0x32,0xcb,0x90,0xf9,0x7b,0x81,0x98,0x23,0x0a,0xa1,0x2a,
+0xc4,0x12,0x20,0x89,0x99,0x83,0xbf,0x95,0x8a,0x30,0x19,0xd2,0x91,0x41,0x60,0xb9,
+0xb4,0x28,0x99,0x02,0x09,0x22,0xff,0x02,0x99,0x13,0x0a,0x1a,0x97,0x08,0x88,0x20,
+0xd3,0x39,0xdb,0x20,0x9b,0x85,0x1a,0xa2,0x0e,0xa4,0x3b,0x53,0x9a,0x91,0x21,0x0b,
+0x83,0x7a,0xb4,0x18,0x1a,0xca,0x48,0xc1,0x38,0x1b,0xa1,0x33,0x42,0x8f,0xa6,0x19,
+0x11,0x12,0x19,0xe3,0x89,0x31,0x0a,0x08,0x80,0x51,0xf8,0x89,0x38,0xb4,0x19,0xbb,
+0x42,0xa0,0xa9,0x8b,0x3f,0xf0,0x32,0x19,0x88,0x11,0xe2,0x98,0x4c,0xb1,0x00,0x14,
+0x1a,0x89,0x08,0xf8,0x2a,0x02,0x09,0x09,0x52,0x08,0xf9,0x1e,0x99,0x04,0x89,0x88,
+0xb0,0x39,0x83,0x1c,0x85,0x8a,0x24,0x2c,0xe0,0x83,0xb9,0x5c,0x81,0x93,0x09,0x1a,
+0x29,0x94,0x32,0x08,0xb0,0x00,0xbb,0x17,0x9f,0x20,0x8a,0xa5,0x31,0x08,0x9d,0xb9,
+0x50,0x22,0xac,0x88,0x50,0x88,0xc8,0x3a,0x80,0xa2,0x5a,0x3b,0x87,0xa8,0x80,0x08,
+0x0f,0x00,0x82,0x0a,0x9f,0x13,0xa8,0x1b,0x92,0x0d,0x95,0x1a,0x19,0x29,0x87,0x18,
+0x20,0xbc,0x28,0xa4,0x1a,0x9a,0x3b,0x9e,0x06,0x00,0x2a,0x01,0xb4,0x60,0x82,0x0b,
+0x87,0x1a,0x19,0x89,0xa6,0x28,0x0f,0x90,0x93,0x1a,0x28,0x98,0x12,0x30,0xbb,0xd0,
+0x43,0x98,0x28,0xbb,0x87,0x9e,0x31,0x88,0x10,0x13,0x84,0x9f,0xb1,0x22,0x8a,0xb9,
+0x62,0xa2,0x40,0xb0,0x48,0x80,0xaf,0x82,0x98,0x13,0x1a,0xad,0x03,0xa9,0x70,0xb2,
+0x1a,0x29,0x9c,0x87,0x48,0x99,0xb0,0x89,0x18,0xab,0xea,0x30,0x08,0xb5,0x28,0x1b,
+0x14,0xbc,0x96,0x30,0x1a,0x98,0x92,0x0c,0x07,0x2c,0x09,0xb0,0x03,0x41,0x04,0x3a,
+0xd3,0x3a,0x01,0xf0,0x2e,0x00,0x80,0x21,0x89,0x9a,0x8a,0x00,0xb8,0x71,0x90,0x01,
+0x0d,0x94,0x38,0x33,0x1f,0xc2,0x14,0x30,0x2b,0xd8,0xba,0x29,0x04,0x49,0x91,0x94,
+0x89,0x20,0xa5,0xcb,0x1b,0xc8,0x01,0x31,0x20,0xfd,0x28,0x81,0xac,0x12,0x0c,0xb1,
+0x88,0x41,0x81,0x83,0x60,0x91,0xaa,0x3c,0xa3,0xca,0x03,0x7a,0x18,0xe3,0x00,0x10,
+0x28,0x3a,0xb7,0x08,0x00,0x50,0x88,0xb1,0x89,0xae,0x28,0x2a,0xa3,0x8a,0x62,0x9d,
+0x8a,0x14,0x09,0xa9,0x10,0x68,0x40,0xd0,0x14,0x3a,0xbb,0x81,0x38,0xf2,0x48,0x11,
+0x9c,0xa0,0x92,0x2c,0x83,0xaf,0x04,0x8a,0x90,0x40,0xb2,0x98,0x8e,0x95,0x1c,0x30,
+0xe1,0x00,0x39,0x0a,0xc3,0x90,0x40,0x89,0xa9,0x90,0x01,0x29,0xba,0x72,0x92,0x6a,
+0xa3,0xa0,0x8b,0x4a,0x98,0xda,0x85,0x5a,0x11,0x00,0xa3,0x89,0x01,0x1d,0xb3,0x9b,
+0x25,0x0e,0x18,0xa2,0x82,0x45,0x0a,0xa1,0xf0,0x51,0x1b,0xb8,0x81,0xe8,0x48,0x08,
+0x09,0xe3,0x19,0x02,0xba,0x00,0x18,0x08,0x85,0xab,0x29,0xa3,0x17,0x48,0x20,0xb8,
+0x94,0x8d,0x00,0xb0,0xad,0x16,0x58,0x88,0xa0,0x01,0x1a,0x8b,0x99,0xa6,0x89,0x18,
+0x71,0xa1,0x83,0x8e,0x13,0x38,0xb9,0x1a,0xa6,0x40,0x1d,0x90,0x20,0xa2,0x92,0x0c,
+0x39,0xf2,0x90,0x41,0x00,0x1a,0x99,0xf4,0x18,0x2a,0xb0,0x05,0x0c,0x82,0xb8,0xb8,
+0x5b,0x48,0xd2,0x3a,0x10,0x09,0xba,0x91,0x5a,0xc1,0x1a,0x00,0xd8,0x00,0x9e,0x83,
+0x79,0x99,0x91,0x18,0x88,0x81,0x5b,0xf2,0x31,0x31,0x99,0xa0,0xc2,0x1a,0x4b,0x04,
+0xeb,0x38,0x18,0x91,0xc1,0x50,0x99,0x20,0x03,0xe1,0x20,0x9b,0x11,0x0a,0x97,0xa0,
+0x7a,0xc8,0x40,0x90,0x91,0x38,0xac,0x13,0x02,0x2c,0x93,0x93,0xbf,0x40,0x88,0x09,
+0xb2,0x88,0x40,0x2a,0xf4,0x38,0x98,0x09,0x18,0x9a,0x00,0x04,0x0f,0xc9,0x10,0x90,
+0x21,0x98,0x18,0x91,0x15,0xcb,0x73,0xc8,0x0a,0x82,0x20,0xaf,0x83,0x02,0x99,0x1a,
+0x01,0xc3,0xa0,0x5c,0x33,0xeb,0x80,0x83,0x70,0xc1,0x98,0x10,0x9a,0x72,0x00,0x98,
+0x98,0x49,0xcb,0x91,0x98,0x51,0x00,0x81,0x50,0xf8,0x20,0x98,0x48,0xa0,0x0a,0x89,
+0xa2,0x31,0x2f,0xa8,0x01,0x02,0x20,0x51,0x00,0xf3,0x4e,0x80,0xd1,0x20,0x8b,0x08,
+0x85,0x09,0x80,0x02,0x3a,0xc1,0xc3,0x1b,0x4b,0xa1,0x06,0x20,0x0b,0x88,0xb0,0x10,
+0x3c,0x98,0x81,0x6a,0xf8,0xb9,0x5a,0x92,0x2a,0xc2,0x39,0x95,0x0a,0x99,0x58,0xb3,
+0x78,0xa9,0x01,0xc0,0x19,0x9c,0x62,0xa1,0x21,0x9a,0xb3,0x9f,0xb2,0x01,0x89,0x33,
+0x3c,0xbb,0xa7,0x19,0x91,0x9d,0x10,0x24,0x0a,0x13,0x01,0x0f,0x91,0x53,0xc9,0x80,
+0x29,0xb9,0x32,0xdb,0x10,0x09,0xba,0x37,0x18,0x10,0x9c,0x85,0xb2,0x88,0x2c,0xab,
+0x11,0x27,0xab,0x08,0x7b,0x92,0x03,0x80,0x1f,0xba,0x13,0xa8,0x78,0xb1,0x40,0xe8,
+0x20,0x18,0x83,0x2a,0xd3,0x98,0x5b,0x01,0x92,0xc9,0x29,0x19,0xbd,0x07,0x10,0x1b,
+0xb1,0x02,0x30,0xa9,0xdb,0x32,0xa9,0x0a,0xcf,0x12,0x20,0x09,0xf9,0x01,0x4b,0x83,
+0xa9,0x32,0x2b,0x87,0x3b,0x39,0xa7,0x20,0x29,0x11,0xec,0x10,0x02,0x0a,0x9c,0xb3,
+0x98,0x39,0xa8,0xa9,0xad,0x82,0x99,0x62,0x88,0x93,0x2f,0x18,0xa0,0x04,0x8b,0x1f,
+0xb4,0x10,0x8a,0x33,0x18,0xd3,0xc8,0x4a,0x85,0xaa,0x38,0xc0,0x69,0x95,0x9b,0x80,
+0x10,0x81,0xaa,0xb3,0x33,0x2f,0x34,0xf9,0x01,0x08,0x0b,0x93,0xb3,0x7c,0x00,0x10,
+0xe8,0x11,0x49,0x98,0xa1,0x92,0xaa,0x40,0x8b,0xa7,0x89,0x1a,0x01,0x91,0x10,0x1b,
+0x05,0x14,0x0b,0xa1,0x2a,0xe2,0xa3,0xfa,0x3b,0xdb,0x03,0x18,0xca,0x20,0x39,0xfb,
+0x28,0x29,0x82,0x32,0x0d,0xb4,0x94,0x1e,0x20,0x02,0x9b,0xa3,0x71,0x09,0x0b,0x95,
+0x09,0x09,0x09,0x80,0x11,0x0f,0xc1,0x30,0x1a,0xc1,0xa9,0x22,0xcb,0x31,0xcc,0xa3,
+0x8f,0x84,0x1a,0x89,0x81,0x04,0xaf,0x41,0xa0,0x88,0x09,0x81,0x12,0x01,0x52,0xb8,
+0x9d,0x80,0x31,0x37,0x2a,0x98,0xc5,0x0b,0x00,0xa0,0x28,0x51,0xd1,0x12,0x98,0x1b,
+0x39,0xb6,0x19,0x36,0x0b,0xf0,0x18,0x99,0xba,0x34,0x29,0x31,0xfb,0x19,0x8a,0x1a,
+0xc1,0x12,0x14,0x38,0xba,0x64,0xc2,0x89,0x23,0x39,0xc8,0x31,0xb5,0x01,0x8c,0x5b,
+0xb8,0x93,0x81,0x2b,0x1f,0x91,0xb1,0x17,0x1c,0x10,0xa1,0x01,0xad,0x90,0x70,0x01,
+0xa8,0x01,0xa8,0x1c,0x21,0xca,0xd1,0x3a,0x9a,0x40,0xa3,0x73,0x99,0x98,0x80,0x80,
+0x2d,0xb1,0x84,0x28,0x8a,0x54,0xa3,0x78,0x00,0x8b,0x05,0x18,0x29,0xc5,0x19,0x19,
+0xe2,0x99,0x88,0x11,0x1a,0x00,0x95,0x9c,0x88,0x32,0xdf,0x01,0xba,0x41,0x0a,0x02,
+0xa0,0x42,0xd9,0x80,0x70,0x08,0x93,0x09,0x01,0xba,0x0b,0x47,0xc1,0x2a,0x1a,0x94,
+0x0a,0x09,0x04,0x8a,0xba,0x13,0x72,0xa1,0x00,0x8c,0x04,0xa9,0x21,0xb1,0x78,0xb1,
+0x03,0x8d,0x81,0x06,0x0d,0x90,0x80,0x00,0x38,0xa9,0xa1,0xaf,0x15,0x90,0x4a,0x81,
+0xc0,0x19,0x81,0x0c,0xd8,0x01,0x2c,0xa8,0xb2,0x50,0xca,0x98,0x11,0x11,0xc0,0x6b,
+0x00,0xc2,0x40,0xa9,0x01,0xab,0x37,0xbc,0x01,0x89,0x42,0x02,0x38,0xaa,0xc4,0x93,
+0x7d,0x90,0x80,0x99,0x99,0x2b,0xb1,0x11,0x27,0xb9,0x79,0xa0,0x82,0x19,0xa1,0x5a,
+0xc9,0x58,0xb3,0x38,0x1a,0xb4,0x98,0x24,0x0f,0xa1,0x98,0x14,0x8a,0x20,0x9a,0x93,
+0xf8,0x38,0x38,0x41,0xb0,0x24,0xd1,0x2b,0xdb,0x41,0x20,0xc9,0x82,0x8d,0x21,0xa0,
+0x88,0x89,0x3a,0xfb,0x31,0x8c,0x12,0x1e,0xa4,0x08,0x2a,0x88,0xb3,0x1c,0x08,0xde,
+0xa2,0x60,0x89,0xa1,0x40,0x80,0x92,0x1b,0x24,0xaa,0xb4,0x8f,0x80,0x29,0x8b,0x07,
+0xa8,0x3b,0x14,0x39,0x90,0xa4,0x4c,0xa0,0x8a,0x30,0x28,0xe3,0x81,0x3c,0x90,0x12,
+0xb0,0xd1,0x7a,0x08,0x91,0x86,0x0a,0x09,0x02,0x9a,0xa2,0x72,0x19,0xc3,0xa3,0x78,
+0xaa,0xe0,0x22,0x0b,0x99,0x94,0x08,0x49,0xd1,0x8a,0x8a,0x92,0x59,0xb1,0x82,0x08,
+0x2d,0x90,0xa3,0x2e,0x81,0x89,0x8a,0x49,0x94,0x79,0xb3,0x22,0x19,0x58,0xfb,0x19,
+0x00,0x19,0x81,0x8c,0x00,0x31,0x25,0xb0,0x4b,0xd0,0x20,0x29,0xeb,0x10,0xb2,0x49,
+0x00,0xd0,0x40,0x1b,0x93,0xa0,0x89,0x4c,0x05,0xbb,0x02,0x0a,0x03,0xb3,0x6c,0xb9,
+0x01,0xa8,0x03,0xcf,0x11,0x18,0xd8,0x80,0x30,0xa9,0x63,0xa8,0xc2,0x74,0x08,0x08,
+0x82,0x92,0x1d,0x99,0x90,0x8e,0x04,0x8a,0x02,0x88,0xaa,0x9b,0x84,0x91,0xcf,0x11,
+0x04,0x89,0x09,0x12,0xc2,0x2b,0xd0,0x34,0x14,0x5b,0xb1,0x00,0xa8,0xb1,0x30,0x9d,
+0xe4,0x39,0xac,0xa0,0x52,0x19,0x22,0xba,0x42,0x8b,0xc8,0x19,0x16,0xab,0x48,0xa9,
+0xb3,0x19,0x62,0x1b,0x97,0x1a,0x13,0x8d,0xc1,0x0a,0xb0,0x2b,0x13,0x17,0x9b,0x08,
+0x31,0x95,0x8e,0x01,0x0a,0x18,0x88,0x04,0x69,0xb1,0x9a,0xa2,0x9a,0x60,0x33,0xc8,
+0xa9,0x80,0x08,0x59,0xbe,0x21,0x91,0xaa,0x59,0x18,0x10,0xd1,0x88,0x30,0x0c,0xa2,
+0x14,0x1d,0x07,0x0b,0x10,0x03,0xaa,0x44,0xa2,0x29,0x4a,0xea,0x03,0xb9,0x4c,0xa8,
+0x81,0x0b,0x8b,0x96,0x72,0xa8,0xb3,0x49,0x89,0x22,0x93,0x39,0xb2,0xaf,0x02,0x5a,
+0xa8,0x23,0x1b,0x24,0x8b,0x37,0xd3,0x19,0x8c,0x83,0xa1,0x1b,0xb5,0x5b,0xb1,0x91,
+0x02,0x8a,0x9e,0x88,0x81,0xea,0x08,0x2c,0x04,0x12,0xb8,0xf0,0x29,0x08,0x28,0xa7,
+0x09,0x08,0x01,0x8d,0xb1,0x80,0x3a,0x53,0x82,0xc0,0x11,0x29,0x40,0xa0,0x17,0xaa,
+0x0b,0x95,0x20,0x12,0xdc,0x38,0xfa,0x08,0x10,0x41,0x99,0x21,0x99,0x00,0x8c,0x36,
+0xc0,0x19,0x12,0x98,0x20,0xe9,0x81,0x3b,0x38,0xf8,0x2c,0x0d,0x92,0x2b,0x05,0xa1,
+0x19,0xcb,0x71,0xb0,0x02,0x0a,0xab,0x10,0xa8,0x27,0x0c,0x08,0xa1,0x20,0x9a,0x20,
+0x2b,0x87,0x09,0x79,0xfa,0x82,0x19,0x81,0x28,0x02,0x44,0xc9,0x4a,0x98,0xba,0x11,
+0x99,0x94,0x2b,0xaa,0x13,0xc3,0x0f,0x90,0x89,0x61,0xc9,0x01,0x88,0x0a,0x8f,0x83,
+0xba,0xa2,0x79,0x01,0x80,0x91,0x40,0x01,0xba,0x32,0xbb,0xe0,0x8c,0xd3,0x79,0xa2,
+0x38,0x88,0x00,0x13,0x08,0x86,0x4a,0xb9,0xb8,0x10,0x59,0xd3,0x18,0x21,0xd8,0x8a,
+0x24,0x9a,0xcb,0x80,0x1d,0x81,0x24,0x02,0x8c,0x54,0x90,0xa1,0x9b,0x9a,0x05,0x9e,
+0x02,0xa0,0x09,0xc9,0x71,0x08,0x82,0x08,0xda,0x42,0x10,0xa3,0x8e,0x22,0x98,0x41,
+0x92,0x92,0x0b,0x00,0x3b,0xd7,0x2a,0x92,0xa8,0x69,0xc9,0x18,0x82,0xa0,0x4b,0x10,
+0xfb,0x10,0xa8,0x89,0x32,0xf9,0x9b,0x94,0x21,0x3b,0xbb,0xb7,0x29,0x39,0x01,0x07,
+0x2a,0x08,0x49,0xe0,0x02,0x09,0xbb,0x80,0x81,0x7a,0xa6,0xa9,0x40,0x8b,0x03,0x83,
+0xa9,0x8b,0x49,0x20,0xa7,0x21,0x0a,0x8a,0x05,0xa0,0x29,0x80,0xf5,0x29,0x91,0x18,
+0xa9,0x25,0xd9,0x49,0x99,0xb8,0x86,0x48,0x9b,0xb2,0xa0,0x61,0x80,0x0b,0x83,0xc2,
+0x0e,0x10,0x01,0xa0,0x80,0x6b,0x02,0x28,0x24,0xa8,0x7a,0x91,0xb9,0x03,0x5b,0x98,
+0xa5,0x29,0x08,0x92,0xbb,0x0e,0x97,0x0a,0x19,0xa3,0x08,0x2b,0x6b,0x85,0x99,0x98,
+0x39,0xb8,0x31,0x91,0x1c,0xa4,0x1c,0x0b,0x41,0xf3,0x39,0x99,0x97,0x08,0x31,0x0b,
+0xf1,0x10,0x81,0x00,0x28,0x81,0xb0,0x4c,0xf0,0x29,0xb8,0x19,0x80,0xba,0x54,0x90,
+0x0c,0xd9,0x03,0x49,0x98,0x04,0x10,0x38,0xf3,0x8c,0xb8,0x8a,0x5a,0xa2,0xb0,0x19,
+0x23,0x0b,0xe1,0x83,0x28,0x2f,0xf3,0x18,0x08,0x18,0x80,0x81,0x01,0x9a,0x20,0x51,
+0x30,0xfa,0x2a,0x68,0x21,0xe9,0x31,0x08,0xc0,0x18,0x9a,0x28,0x17,0xbb,0x51,0x08,
+0xa1,0x9a,0x01,0x08,0xab,0x28,0xf2,0x30,0x20,0x11,0xcf,0x90,0x25,0x1a,0xa9,0x03,
+0xa3,0x2b,0xaf,0x91,0x2a,0xb3,0x09,0x86,0x19,0x50,0x91,0x85,0x32,0x0d,0xc9,0x90,
+0x51,0x98,0xaa,0x72,0x9a,0x0a,0x95,0x2b,0x9a,0x31,0x91,0x27,0x9a,0xb0,0x20,0x1d,
+0x94,0x04,0x89,0x39,0xdd,0x22,0x98,0xbb,0x1a,0x03,0x18,0x03,0x92,0x4f,0xf9,0x48,
+0x08,0x88,0x13,0xda,0x12,0x89,0xa9,0xb0,0x19,0x93,0x43,0x72,0xa8,0x40,0x91,0xb9,
+0x59,0x28,0x96,0x3b,0x31,0xe0,0x9a,0x18,0x68,0x80,0xb1,0x28,0x32,0xab,0xbf,0x43,
+0xa0,0x9c,0x32,0x00,0x81,0x3a,0xc5,0x00,0x1e,0xb0,0x98,0x5a,0xdb,0x90,0x10,0x09,
+0x41,0x90,0x30,0xd1,0x11,0x4c,0xc1,0x1a,0xa0,0x43,0x48,0xa0,0x20,0xac,0x00,0x18,
+0x17,0x28,0xae,0x91,0x80,0x13,0x2e,0x30,0xf0,0x01,0x50,0x08,0xa0,0x82,0x3a,0xca,
+0x80,0xda,0x29,0xb1,0x50,0x19,0xe3,0x09,0x49,0xc9,0x80,0x29,0x85,0xda,0x1b,0x92,
+0x16,0x9b,0x02,0xa0,0x69,0x88,0x82,0x02,0x38,0xaf,0x30,0x92,0x99,0x2b,0x07,0x10,
+0x19,0xe0,0x88,0x48,0x81,0x90,0x90,0xaf,0x20,0x04,0x88,0x90,0x9b,0x88,0x39,0xf1,
+0x14,0x32,0x9c,0x13,0xb9,0x88,0xc8,0x40,0xaa,0x10,0x3d,0xf1,0x39,0x12,0x09,0x59,
+0x03,0x89,0xa2,0xa0,0xfb,0x3f,0x11,0xd1,0x21,0x1a,0x02,0x0c,0x88,0x04,0x98,0x3c,
+0x40,0xb0,0xfa,0x5a,0x99,0x01,0x80,0x10,0x03,0xad,0x70,0xc2,0x98,0x30,0xaa,0x80,
+0x41,0x08,0xba,0x03,0x3c,0xe0,0x18,0xb1,0xa1,0x29,0xbb,0xed,0x2a,0x17,0xa0,0x38,
+0x2c,0xd3,0x00,0x21,0x8e,0xb3,0x28,0x39,0x00,0x94,0x0a,0x98,0x89,0x25,0xec,0x28,
+0x92,0x19,0x88,0x92,0x1e,0x12,0x21,0xc0,0x9a,0x3a,0x22,0x84,0xf2,0x7b,0xa0,0xa9,
+0x08,0x88,0x9a,0x12,0xad,0x00,0xa9,0x61,0x95,0x4b,0x89,0xb0,0x99,0xe1,0x2a,0x2a,
+0x03,0x83,0x64,0x99,0x9a,0x26,0x9a,0x81,0x9a,0x18,0xea,0x30,0x9c,0x16,0xca,0x21,
+0xc8,0x18,0x19,0x20,0xc8,0x48,0x23,0xf9,0x40,0x81,0x00,0x9d,0x92,0x9b,0x01,0x18,
+0x04,0x88,0x00,0x26,0x11,0x98,0xad,0x03,0x0e,0x85,0x80,0x2a,0xb9,0x12,0x27,0x8a,
+0x9b,0x02,0x14,0xa8,0x74,0x88,0x99,0x08,0x12,0x0e,0x23,0x99,0x51,0xa1,0x4a,0xd8,
+0x00,0xb8,0x18,0xe0,0x38,0xa1,0x18,0x33,0xc2,0x61,0x8b,0xb5,0x1b,0x9e,0x84,0x01,
+0x30,0x39,0xa7,0x28,0x01,0x8c,0x01,0xa0,0x14,0x99,0x61,0x0a,0xc3,0x11,0x2b,0xea,
+0x80,0x10,0xa1,0x81,0x0b,0x8d,0x14,0x9b,0x98,0x86,0x4a,0x92,0x10,0xc8,0x42,0x45,
+0x98,0x12,0x8b,0x94,0x89,0x79,0xa0,0x91,0x33,0x0f,0x94,0x0a,0x00,0xb9,0x12,0x92,
+0x2f,0x93,0x81,0x30,0xa9,0xb8,0x80,0xd9,0xdd,0x8b,0x02,0x04,0x0f,0x92,0x42,0x99,
+0xa9,0x33,0xb3,0x0f,0x02,0x98,0xa9,0x83,0xcf,0x91,0xaa,0x21,0x99,0xad,0x22,0xda,
+0x98,0x20,0xcf,0x11,0x0a,0xb9,0x20,0xc1,0xac,0x18,0xbc,0xa8,0x9a,0x60,0xc0,0x9a,
+0x0a,0xe9,0x00,0x1a,0x90,0x52,0x09,0x02,0x91,0x0f,0x91,0x81,0x80,0x0e,0x84,0xb8,
+0x4a,0xbb,0x07,0x0c,0x01,0x89,0xab,0x82,0x3c,0x81,0xf1,0x00,0x29,0x08,0xa2,0x41,
+0x0c,0x84,0x1d,0xda,0x31,0xb8,0x9e,0x81,0xab,0xac,0xb1,0xac,0x9a,0xf9,0x0b,0x92,
+0xbd,0x1a,0xf2,0x9a,0x09,0xac,0x80,0xb8,0xad,0x0a,0xe1,0x89,0x38,0x81,0x63,0x25,
+0x22,0x46,0x24,0x62,0x43,0x32,0x25,0x32,0x42,0x12,0x32,0x12,0x01,0x08,0xe9,0x8a,
+0xbb,0xba,0x9a,0xbb,0x10,0x31,0x36,0x36,0x34,0x01,0x10,0xd9,0xac,0xdc,0xbc,0xbd,
+0xdb,0xba,0xab,0xbb,0xaa,0x99,0x00,0x20,0x33,0x36,0x23,0x23,0x11,0xa8,0xeb,0xbc,
+0xbc,0xcb,0xcb,0x9b,0x89,0x18,0x34,0x45,0x34,0x34,0x34,0x33,0x34,0x22,0x22,0x22,
+0x88,0x00,0x88,0xbc,0x09,0xa9,0xaa,0x31,0xda,0x73,0x12,0x21,0x33,0x02,0x50,0x03,
+0x34,0x18,0xb9,0xd9,0xdc,0xad,0xcb,0xbc,0xcb,0xbc,0xba,0xac,0xba,0x8a,0xba,0x09,
+0x52,0x10,0x43,0x82,0x48,0xb1,0xa9,0x8c,0xee,0xaa,0xbb,0xbb,0x9c,0x99,0x88,0x28,
+0x41,0x36,0x63,0x13,0x42,0x22,0x21,0x11,0x32,0x90,0x81,0x22,0x9b,0x32,0x23,0x65,
+0x36,0x43,0x53,0x23,0x43,0x32,0x32,0x33,0x21,0x02,0x31,0xd0,0x9b,0xeb,0xac,0x9a,
+0xdb,0x0a,0xa9,0x99,0xa8,0xaa,0x9a,0xfa,0xac,0x89,0xcd,0xa9,0xeb,0xad,0xaa,0xba,
+0xaa,0xac,0xa9,0xba,0x80,0x99,0x99,0xa9,0xcb,0xb9,0x0a,0xff,0xaa,0xba,0xcb,0x8a,
+0xc9,0x19,0xc0,0x20,0x02,0x28,0x43,0x05,0x31,0xa9,0x46,0x83,0x19,0x14,0x41,0x42,
+0x24,0x34,0x55,0x23,0x44,0x43,0x23,0x43,0x24,0x22,0x32,0x23,0x12,0x02,0x08,0x80,
+0x98,0x28,0x00,0x73,0x13,0x62,0x14,0x11,0x22,0xa0,0xbb,0xed,0xbd,0xdb,0xcc,0xaa,
+0xac,0xbb,0xab,0xab,0xaa,0x99,0x09,0x89,0xa1,0x0a,0xa9,0xdd,0xdb,0xbc,0xcb,0xcb,
+0xbb,0xaa,0xa9,0x29,0x31,0x35,0x44,0x53,0x24,0x23,0x23,0x32,0x13,0x22,0x12,0x28,
+0x23,0x12,0x77,0x21,0x43,0x34,0x32,0x24,0x42,0x22,0x21,0x11,0x10,0x00,0xa0,0xac,
+0xa0,0xaa,0x39,0xd0,0x9a,0x80,0x00,0xea,0x08,0xef,0xa9,0xab,0xbc,0xbc,0xdb,0xac,
+0xba,0xac,0xaa,0x9a,0x9b,0x08,0xaa,0x00,0x9c,0xd8,0x8d,0xca,0xbb,0x9d,0xcb,0xba,
+0xcb,0x8b,0xa8,0x10,0x15,0x41,0x44,0x32,0x24,0x33,0x23,0x25,0x08,0x02,0x11,0x21,
+0x42,0x35,0x34,0x35,0x63,0x42,0x42,0x32,0x22,0x23,0x22,0x11,0x98,0xa9,0xb8,0x8e,
+0xa0,0x8a,0x91,0x2a,0x34,0x32,0x34,0x83,0x39,0xfb,0xdb,0xdb,0xbd,0xcb,0xeb,0xaa,
+0xcb,0x9a,0xba,0xa9,0xc9,0xa9,0x00,0x9a,0x99,0xc8,0xbc,0xec,0xab,0xdb,0xab,0xbb,
+0xad,0x89,0xa9,0x19,0x32,0x81,0x57,0x11,0x22,0x11,0x81,0x32,0x98,0x9a,0xca,0x99,
+0x98,0x41,0x36,0x73,0x53,0x33,0x24,0x25,0x22,0x22,0x02,0x12,0x09,0x80,0x89,0x01,
+0x10,0x47,0x53,0x43,0x32,0x35,0x22,0x12,0x32,0x91,0x98,0x10,0xdd,0x8a,0x98,0x0c,
+0x93,0x39,0x43,0x83,0x11,0xa0,0xe9,0xbb,0xef,0xa9,0xbb,0xab,0xcb,0xbb,0x8a,0xc8,
+0x89,0x80,0xcb,0xa9,0xe8,0x9c,0xdb,0xbb,0xbb,0xda,0x9a,0xab,0xa0,0x42,0x39,0x16,
+0x80,0x30,0x14,0x8a,0x23,0x8b,0x33,0x16,0x40,0x22,0x57,0x32,0x42,0x22,0x32,0x43,
+0x01,0x22,0x22,0x24,0x30,0x07,0x30,0x14,0x13,0x31,0x15,0x08,0x11,0xca,0xb9,0xa0,
+0xaf,0x88,0xab,0x88,0xe1,0x08,0x09,0x99,0xf8,0xb9,0x9f,0x99,0xda,0x9a,0xb9,0x9c,
+0x9b,0xca,0x99,0x00,0x9b,0xba,0xd9,0xbc,0xbb,0xb9,0x9c,0x8c,0xc9,0x8a,0x18,0x12,
+0x51,0x13,0x40,0x84,0x29,0x09,0xc9,0x99,0x9f,0x81,0x13,0x20,0x54,0x14,0x35,0x51,
+0x12,0x22,0x23,0x21,0x23,0x08,0x38,0x06,0x08,0x98,0x40,0x02,0x27,0x11,0x00,0x80,
+0x02,0x21,0xbf,0xa9,0x89,0xbb,0xcf,0xa9,0x9b,0xea,0x9a,0xb0,0x9c,0x00,0xdd,0x99,
+0xaa,0xa9,0xbd,0xb9,0xad,0xbc,0xb8,0x9a,0xba,0x09,0xe0,0x20,0xda,0x8b,0x9a,0xfa,
+0x09,0xac,0xc9,0x89,0xca,0x88,0x9a,0x30,0x14,0x8c,0x99,0x83,0xbc,0x08,0xbd,0xb9,
+0x10,0x33,0x79,0x36,0x44,0x34,0x44,0x32,0x44,0x24,0x33,0x43,0x23,0x43,0x33,0x53,
+0x32,0x44,0x23,0x33,0x24,0x22,0x33,0x43,0x80,0x11,0x00,0x81,0x98,0x0c,0xf9,0x09,
+0xa9,0xcc,0xba,0xac,0xcc,0xdb,0xdb,0xbb,0xdb,0xaa,0xac,0xba,0xab,0xab,0xac,0xbb,
+0xba,0xbc,0xab,0xae,0xcb,0xba,0xbb,0xac,0xbb,0xbb,0x8a,0x90,0x20,0x00,0x50,0x52,
+0x24,0x33,0x71,0x33,0x23,0x35,0x43,0x21,0x27,0x11,0x42,0x32,0x23,0x44,0x32,0x24,
+0x42,0x22,0x11,0x32,0x01,0x33,0x63,0x12,0x33,0x35,0x33,0x52,0x12,0x81,0x18,0xf9,
+0x8a,0xca,0xb9,0x9c,0xbb,0x9a,0x08,0x14,0x88,0xc9,0xcc,0xcc,0xbc,0xcc,0xca,0xab,
+0xbc,0xaa,0x9b,0xa9,0x90,0x8a,0xcb,0xc9,0xaa,0xbd,0xae,0xcb,0xaa,0xab,0x8a,0x08,
+0x21,0x13,0x64,0x12,0x43,0x22,0x14,0x21,0x88,0x21,0x02,0x52,0x62,0x34,0x44,0x42,
+0x33,0x43,0x23,0x23,0x21,0x24,0x22,0x22,0x42,0x13,0x32,0x35,0x41,0x32,0x43,0x12,
+0x90,0x99,0xfb,0xac,0xca,0xa9,0x9c,0xc9,0x9a,0xb9,0xbb,0x9d,0xda,0xba,0xbe,0xcb,
+0xac,0xcb,0xbb,0xbc,0xaa,0x9c,0x99,0xa9,0xaa,0xca,0xbb,0xbb,0xcb,0xdb,0x9a,0x99,
+0xad,0x9a,0x91,0x1b,0x32,0x43,0x98,0x14,0x37,0x20,0x24,0x62,0x03,0x51,0x31,0x15,
+0x21,0x23,0x35,0x02,0x45,0x12,0x23,0x35,0x43,0x23,0x25,0x22,0x33,0x35,0x23,0x33,
+0x34,0x31,0x42,0x25,0x32,0x32,0x24,0x33,0x08,0x32,0x90,0x11,0x00,0x08,0xbe,0xba,
+0xcd,0xdb,0xab,0xac,0xcc,0xba,0xdb,0xac,0xad,0xaa,0xbc,0xaa,0xdb,0xab,0xab,0xbb,
+0xbc,0xbc,0xba,0xad,0xca,0xa9,0xbb,0xba,0xca,0xbb,0x89,0x9b,0x19,0x33,0x81,0x45,
+0x30,0x32,0x23,0x17,0x21,0x38,0x44,0x34,0x34,0x53,0x52,0x33,0x44,0x22,0x23,0x24,
+0x31,0x22,0x44,0x21,0x22,0x33,0x33,0x45,0x22,0x33,0x43,0x11,0x32,0x53,0x22,0x13,
+0x00,0x29,0xc9,0x08,0xb8,0xbf,0xc8,0x9e,0xab,0xb9,0xbc,0xab,0xeb,0xab,0xbb,0xbe,
+0xc9,0xab,0xda,0x9d,0xb8,0xaa,0x9c,0xb9,0xbc,0xaa,0xcb,0xbb,0xab,0xd9,0x9b,0x9a,
+0xb9,0xbc,0x99,0xbb,0xaa,0x22,0x09,0x43,0x01,0x56,0x52,0x04,0x31,0x45,0x12,0x32,
+0x43,0x04,0x22,0x34,0x43,0x22,0x43,0x34,0x31,0x33,0x34,0x33,0x63,0x31,0x24,0x22,
+0x02,0x29,0x40,0xa3,0x2a,0x13,0x01,0x9c,0xfb,0xa9,0xac,0xda,0xab,0x98,0xad,0xea,
+0xaa,0xcb,0xdb,0xab,0xb9,0xcc,0x9c,0xab,0xdb,0xaa,0xaa,0x9b,0xa0,0xba,0x9d,0xdb,
+0xa9,0x9a,0xa9,0xac,0xb9,0x89,0x38,0xb9,0x05,0x1b,0xec,0x11,0x98,0x59,0x03,0x14,
+0x52,0x11,0x43,0x44,0x24,0x21,0x23,0x33,0x24,0x37,0x42,0x33,0x62,0x24,0x13,0x52,
+0x12,0x00,0x11,0x52,0x23,0x32,0x36,0x32,0x22,0x54,0x22,0x00,0x21,0x82,0x88,0x08,
+0x81,0x9d,0x08,0x81,0xbb,0x0c,0x92,0xcf,0xab,0xd9,0xbc,0xad,0xb9,0xcb,0xcb,0xba,
+0xbc,0xab,0xcb,0xcb,0xaa,0xcb,0xbb,0x99,0xdb,0xdb,0xaa,0xc9,0x9a,0x89,0xb9,0xac,
+0x0a,0x11,0x11,0x03,0x90,0x1c,0x81,0x34,0xb2,0x69,0xa0,0x51,0x55,0x21,0x26,0x22,
+0x22,0x33,0x22,0x14,0x30,0x12,0x50,0x24,0x25,0x48,0x14,0x33,0x32,0x13,0x52,0x02,
+0x32,0x01,0x82,0xa9,0x50,0x21,0x22,0xc3,0x1c,0x98,0x23,0x31,0xaf,0xf1,0x9c,0x89,
+0x9a,0xc9,0xab,0xad,0xea,0x89,0x9a,0xdb,0xaa,0xca,0x9a,0xcb,0xba,0xac,0xdb,0x99,
+0xaa,0xa9,0xab,0xbd,0x99,0x98,0xb9,0x9c,0xc9,0xca,0x0a,0xb8,0xac,0x12,0x17,0x31,
+0x04,0x43,0x43,0x43,0x15,0x88,0x22,0x22,0x41,0x24,0x43,0x13,0x32,0x43,0x62,0x23,
+0x22,0x33,0x52,0x12,0x33,0x14,0x23,0x28,0x83,0x04,0x8e,0x08,0x92,0x01,0x62,0x08,
+0xda,0x9b,0xe9,0xcb,0xaa,0xbb,0xab,0xcb,0xa9,0xbe,0xbb,0x8a,0xda,0x88,0xab,0xdd,
+0xca,0xbd,0xaa,0xab,0x18,0x80,0x99,0x10,0xc9,0x8d,0xa8,0x89,0x8a,0x0b,0x96,0x1b,
+0x63,0x83,0x31,0x23,0x23,0x4b,0x16,0x91,0x39,0xa8,0x18,0x93,0x75,0x54,0x21,0x43,
+0x32,0x35,0x41,0x35,0x22,0x13,0x02,0x81,0x8a,0x81,0x21,0x53,0x46,0x33,0x34,0x63,
+0x22,0x22,0x33,0x90,0x80,0x8a,0xda,0x19,0xa9,0xa8,0x01,0x20,0x74,0x01,0x01,0xec,
+0xb9,0xbc,0x9b,0xa8,0xda,0xaa,0x9b,0xba,0x9c,0xb8,0x8d,0xe0,0x9a,0x9a,0xbc,0x9a,
+0xeb,0x89,0x9a,0xab,0x1a,0x98,0x8a,0xb8,0x71,0xba,0x98,0x31,0x94,0x68,0x90,0xa0,
+0x3b,0xd2,0x09,0x42,0xd2,0x59,0x80,0x82,0x10,0x3c,0xa1,0x81,0x83,0x48,0x40,0xb2,
+0x34,0x85,0x3b,0x27,0x91,0x0a,0xea,0x99,0x08,0x99,0x23,0xba,0x24,0x09,0x28,0x77,
+0x20,0xb9,0x12,0xfb,0xab,0x88,0xaa,0x2a,0xca,0x90,0x29,0x81,0xaf,0x91,0xab,0xfa,
+0xbd,0x89,0xa9,0xb0,0x9a,0xba,0x8d,0xae,0x98,0x10,0xaa,0xba,0xd0,0xba,0x08,0x3a,
+0x86,0x9a,0xb8,0x1d,0x99,0x34,0x51,0x01,0x13,0x73,0x8a,0x05,0x11,0x28,0x22,0x03,
+0x59,0x25,0x41,0x05,0x08,0x33,0x00,0xe2,0x8a,0x29,0x43,0x24,0x82,0x28,0x25,0x05,
+0xb9,0x1b,0x21,0x86,0x8b,0x09,0x22,0xa9,0x9b,0x9b,0x13,0xfb,0x1f,0x11,0xb1,0x4a,
+0x21,0xa2,0xcf,0x81,0x09,0x99,0x38,0x07,0x80,0x39,0x11,0x23,0xc0,0x0c,0x90,0x99,
+0x3a,0x57,0xa0,0x69,0x16,0xb9,0x30,0x90,0x99,0x88,0x11,0x30,0xb0,0x28,0x62,0x25,
+0x81,0x39,0xb3,0xaf,0x8a,0xa1,0x19,0x9a,0x8b,0x05,0xb1,0x99,0xac,0x02,0xbc,0x10,
+0xfa,0x9d,0x8b,0xc9,0x18,0xe1,0x29,0x80,0xdb,0x10,0x39,0x27,0x51,0x10,0x33,0x92,
+0x10,0x53,0x24,0x22,0x08,0xf9,0xbc,0x9d,0xaa,0x01,0x42,0x22,0x44,0x02,0x02,0x9a,
+0x81,0xde,0x08,0xbb,0x0a,0xa0,0x41,0x10,0x73,0x91,0x39,0xb8,0x8b,0x02,0x1a,0x67,
+0x01,0x39,0x05,0xa9,0x28,0x90,0x09,0x37,0xb1,0x38,0x84,0x8c,0x11,0xd8,0x09,0x23,
+0x9d,0x11,0x08,0x9a,0x18,0x08,0xa9,0xad,0x80,0xd9,0x9b,0xc8,0x88,0xb0,0xaf,0x00,
+0xc2,0xbb,0x8e,0x93,0xac,0x00,0x8b,0xa3,0xac,0x8c,0xc9,0x19,0xba,0xab,0x35,0xcc,
+0x99,0xc1,0x9d,0xa0,0x8d,0xa0,0x9b,0xa8,0x2a,0x85,0x0a,0x23,0xfb,0x2a,0x00,0x9d,
+0x13,0x00,0x4a,0x06,0xa1,0x4b,0x83,0x0c,0x87,0x89,0x28,0x08,0x15,0x20,0x11,0x82,
+0x02,0x52,0x18,0x91,0x79,0xc1,0x28,0x31,0x30,0x83,0xac,0x82,0x0c,0x30,0x82,0x55,
+0x88,0x11,0xa0,0x9f,0x99,0xa9,0xa2,0x70,0x01,0xb8,0xb9,0x1c,0xb9,0x98,0xaa,0x8f,
+0x01,0xb3,0x0e,0x98,0xc0,0x1a,0xe9,0x98,0x0a,0xc8,0x5a,0xa2,0x30,0x80,0x44,0x9a,
+0xe0,0x18,0x39,0xb9,0x23,0x39,0x98,0x62,0x10,0x06,0x38,0x54,0x01,0x23,0x21,0x23,
+0x21,0x19,0x29,0xa7,0x98,0x3b,0x81,0x57,0x19,0x82,0x43,0x13,0x9b,0xb9,0xbc,0x1a,
+0x90,0x00,0x1c,0xf1,0x2c,0xb8,0x8a,0x9a,0x93,0x8f,0xf8,0x2a,0xb8,0x8d,0x98,0x99,
+0x80,0x02,0x0e,0xb1,0xaa,0x19,0x92,0x22,0xae,0x9b,0xd2,0x10,0x8c,0x10,0x43,0x92,
+0x02,0x70,0x35,0x99,0x86,0x51,0x80,0x02,0x08,0x04,0x18,0x08,0x21,0x06,0x18,0x37,
+0x28,0x92,0x02,0x50,0x81,0x09,0x90,0x23,0x43,0x48,0x04,0x08,0x14,0x71,0xb1,0x19,
+0x12,0x98,0x0c,0x91,0x18,0xa2,0x8f,0x11,0xca,0x92,0xae,0x0c,0x92,0xbb,0x08,0xb2,
+0xaf,0xe8,0xc9,0x88,0x9d,0x88,0xb8,0x8b,0x98,0xb9,0x8e,0xaa,0x89,0xda,0x9b,0x38,
+0x98,0xa2,0xfb,0x0d,0x11,0x8b,0x88,0xfa,0x0b,0x10,0x02,0x98,0x53,0x33,0xc9,0xae,
+0x90,0xb0,0x5b,0x15,0x43,0x83,0x20,0x8a,0x90,0xac,0x44,0x33,0x52,0x01,0x35,0x91,
+0x19,0x89,0xc4,0x40,0x09,0x12,0x25,0x09,0x10,0x95,0x20,0x2b,0x98,0xb5,0x18,0x8a,
+0x28,0x92,0xf1,0x49,0x08,0xa0,0xaf,0xa0,0x38,0x3b,0xfa,0x83,0x29,0xda,0x88,0xba,
+0xb9,0x8d,0x4a,0xb0,0xf9,0x18,0x29,0xc9,0x99,0x28,0xc0,0xbb,0x22,0x2a,0x70,0xd3,
+0x10,0x89,0xca,0x09,0x37,0x89,0x02,0x28,0x20,0xa2,0x30,0x40,0x16,0x09,0x90,0x21,
+0x2c,0x06,0x11,0x64,0xa8,0x22,0x01,0x81,0x0a,0x22,0x8b,0x27,0x91,0x89,0xd8,0x91,
+0x1e,0x13,0x01,0xb2,0x4b,0xba,0xcd,0xa1,0x1c,0x14,0x9e,0x91,0x38,0xe8,0x18,0xb9,
+0x90,0x0c,0xab,0x80,0x83,0x4a,0xf9,0x30,0xa9,0x91,0x1c,0xc3,0x0d,0x08,0x81,0x58,
+0x84,0x08,0x41,0xb8,0xc1,0x58,0x8b,0x94,0x33,0x1b,0x03,0x10,0x32,0xc0,0x7a,0x81,
+0x09,0x27,0x9a,0x61,0x80,0x91,0x2a,0x20,0x87,0x38,0x09,0xa2,0x10,0x40,0x10,0x21,
+0xb9,0x9d,0x07,0x1b,0xb9,0x02,0x13,0x4a,0x41,0xb8,0xc3,0xeb,0x48,0xd9,0x08,0x81,
+0x2b,0xb3,0x1c,0xb8,0x9b,0xdf,0x80,0x9a,0x38,0xb1,0xca,0x89,0xd8,0x10,0xca,0xfa,
+0x09,0x38,0xaa,0xa3,0x11,0x1a,0x0e,0xb1,0x91,0xc9,0x99,0x9f,0x18,0x23,0x33,0x6b,
+0x91,0xb8,0x41,0x8f,0x81,0x12,0x18,0x35,0x90,0x31,0x21,0x98,0x50,0x07,0x08,0x28,
+0x40,0xc3,0x0a,0x42,0x8c,0x88,0x91,0x38,0x14,0x69,0x98,0x24,0x80,0x3a,0x0a,0xfa,
+0x89,0x31,0x19,0xc4,0x99,0x1a,0x87,0x9a,0x9c,0x01,0xad,0x99,0x18,0x91,0x9f,0xa0,
+0x29,0x82,0xac,0x08,0xa2,0x2c,0xcc,0x28,0x86,0x9c,0x01,0x9a,0xb0,0x10,0x9c,0x41,
+0x88,0xa4,0x33,0x72,0xa1,0x18,0x97,0x2b,0x88,0x00,0x18,0x97,0x20,0x8e,0x11,0x92,
+0x34,0x0a,0x91,0x89,0x81,0x04,0x0c,0x29,0xb4,0x34,0x02,0x1c,0x91,0xea,0x09,0x93,
+0x79,0x09,0x14,0xb1,0x40,0x10,0x8d,0xc3,0x8c,0x80,0x28,0xf9,0x10,0x00,0xa0,0x01,
+0x88,0x31,0x80,0x06,0x8a,0x28,0x9b,0x04,0x9b,0x37,0x39,0xab,0x96,0x38,0xe1,0x1d,
+0x01,0x11,0x91,0x80,0x01,0x2d,0xba,0x90,0x17,0x28,0x8c,0x20,0x10,0x07,0x89,0x2b,
+0xfa,0x00,0x11,0x98,0x01,0x9b,0xb9,0x37,0x3d,0xb8,0xc9,0x24,0x8b,0x2c,0x92,0x05,
+0x9b,0x1a,0xa2,0x9a,0x34,0x2c,0xa2,0x97,0x39,0x09,0xb8,0x11,0xb0,0x2d,0x08,0xe8,
+0x10,0x14,0x1b,0x07,0x91,0x91,0x4b,0xcb,0xb1,0x90,0x1c,0x4a,0xc3,0x98,0x52,0xd9,
+0x28,0xbb,0xe1,0x1a,0x83,0x48,0x28,0xc0,0x84,0x0b,0x20,0xfa,0x90,0x09,0x10,0x80,
+0xb0,0x48,0x07,0x2a,0x04,0xab,0x00,0x81,0x89,0x4b,0xe6,0x19,0x12,0x00,0x98,0x98,
+0x08,0x61,0xb0,0x30,0xeb,0x00,0x8a,0x91,0x88,0xa4,0x1c,0x1a,0xca,0x12,0xb2,0x79,
+0x22,0xda,0x30,0x91,0x08,0x2d,0xa8,0xf2,0x60,0x82,0x19,0x0c,0xf1,0x38,0x10,0x88,
+0x91,0x19,0x41,0xa5,0x2b,0x99,0x04,0x3a,0xca,0x33,0x9f,0x84,0x29,0x20,0x98,0xf2,
+0x40,0x18,0x01,0xb0,0x82,0x0b,0x1e,0x00,0x14,0x91,0x8a,0xb9,0x14,0x8f,0x00,0x13,
+0x8c,0xcc,0x11,0x2a,0xb0,0x82,0xbb,0x3f,0x86,0x88,0x01,0x09,0x08,0x20,0xe0,0x00,
+0x89,0x88,0x35,0x80,0x21,0x92,0xcf,0x09,0x14,0x02,0x1a,0xc2,0xb3,0x2b,0x9e,0x02,
+0xcb,0x21,0x89,0x01,0x08,0x08,0x37,0x0e,0x8a,0xc3,0x15,0x2d,0x88,0x01,0xb2,0x21,
+0x9f,0x08,0x80,0x20,0x85,0x19,0x0a,0x81,0xc5,0x1b,0x11,0x8d,0x88,0xa4,0x24,0x2c,
+0x18,0xc1,0x03,0x0c,0xb9,0x8d,0x04,0x21,0xb9,0x09,0x83,0xbf,0x09,0x05,0x2a,0x04,
+0xca,0x29,0x10,0x80,0x71,0xd1,0x29,0x98,0x12,0x59,0xb9,0x83,0x1f,0xa2,0x8a,0x85,
+0x10,0xab,0x83,0x30,0x8b,0x92,0x1d,0xc3,0x79,0x21,0x00,0x91,0x3a,0x96,0x09,0x3a,
+0x18,0xa0,0xa9,0x52,0x0a,0x37,0x82,0x0d,0xa5,0x19,0xb8,0xa9,0xaa,0x09,0xc2,0x9d,
+0x54,0x81,0xcc,0x10,0x80,0x81,0xcc,0x01,0x22,0x95,0x0f,0x90,0x99,0xaa,0x80,0x8d,
+0x12,0x18,0xa1,0xc1,0x2b,0x2d,0xb2,0xaa,0xa2,0x53,0x78,0x99,0x84,0x80,0x1c,0x09,
+0x02,0xa4,0x3b,0x11,0x8c,0xe1,0x20,0x80,0x2d,0xd3,0x3a,0xa0,0x23,0x60,0x93,0x9d,
+0x82,0x88,0x2c,0x97,0x08,0x29,0x89,0xb1,0x53,0x1a,0x10,0x14,0x83,0x11,0x0d,0xa0,
+0x43,0xe1,0x2e,0xa1,0x31,0x9a,0x92,0x31,0x53,0xa8,0x82,0x0b,0x9d,0x22,0x9b,0xfc,
+0x32,0x9e,0x02,0x90,0x21,0x8d,0xb0,0x48,0x01,0x98,0xb2,0x69,0x02,0xc9,0x10,0x49,
+0x82,0x9b,0x02,0x8f,0x32,0xd0,0x8a,0x01,0x5d,0xc3,0x09,0x23,0x3a,0xd3,0xb1,0x39,
+0x05,0xab,0x89,0x54,0x81,0x91,0x32,0x59,0x91,0x00,0xa3,0x53,0x79,0xa9,0x89,0x06,
+0x09,0x3a,0x91,0x98,0x02,0x0c,0x19,0xa7,0x2a,0x0e,0xa3,0x01,0x08,0x0a,0x2b,0xc0,
+0x33,0x2a,0xfa,0x61,0xa9,0xc2,0x19,0xb9,0x0e,0x01,0xa2,0x40,0x88,0xa3,0x9e,0xa0,
+0x09,0xa1,0x79,0xa9,0x89,0x18,0x20,0xf2,0x1d,0x09,0xd9,0x80,0x3c,0x81,0x89,0xa0,
+0x89,0xba,0x70,0x90,0x12,0x98,0xeb,0x30,0x2e,0xa4,0x99,0x88,0x5a,0xc1,0x41,0x91,
+0x49,0xb1,0x21,0x03,0x5b,0x91,0xc3,0xb1,0x71,0x88,0x98,0xa3,0x09,0x62,0x8a,0x13,
+0xe0,0x4b,0xa9,0x04,0x0a,0x22,0xb0,0x41,0x1a,0xa5,0x20,0xe1,0x2c,0xb1,0x21,0x1b,
+0xa1,0xb1,0x2d,0xda,0xa0,0x9c,0x17,0x0b,0x91,0x98,0x89,0x8e,0x18,0x02,0xcb,0x16,
+0x19,0xb9,0xb9,0x13,0x1b,0x15,0xaa,0x8e,0x96,0x2a,0x24,0x98,0x9c,0x05,0x89,0xa1,
+0x3a,0x29,0xe4,0x38,0x09,0x20,0x04,0x19,0xab,0x33,0xa5,0x4d,0x91,0x91,0x29,0xa9,
+0x32,0xcd,0x28,0x05,0x31,0xdb,0x23,0x0a,0x12,0x71,0x22,0xf0,0x28,0x90,0xa0,0x99,
+0x29,0x92,0xcb,0x20,0x18,0xfb,0x1c,0xb8,0x99,0x15,0x0a,0x99,0xc5,0x19,0x08,0xfa,
+0x19,0x1a,0x84,0x22,0x9d,0xa8,0x02,0x9c,0x23,0xb9,0x98,0x40,0xd4,0x42,0x1a,0xd9,
+0x08,0x10,0x10,0x3b,0xe1,0x90,0x1c,0x12,0x71,0xa1,0x99,0x34,0x80,0x42,0xd1,0x31,
+0x89,0xa3,0x38,0x11,0xf3,0x4b,0x01,0x92,0x20,0x0d,0x14,0x03,0x71,0x80,0xc8,0x24,
+0x0b,0x90,0x06,0xbb,0x00,0x59,0x91,0xa1,0x50,0xa8,0x19,0x2a,0xf0,0x9b,0x12,0x00,
+0x18,0xbc,0x82,0xc3,0x4e,0x88,0x91,0x99,0x32,0x1c,0x18,0xf2,0x41,0x8a,0x2b,0xb5,
+0x19,0x89,0xa0,0x08,0x71,0x95,0x24,0x76,0x57,0x11,0x80,0xdb,0xcb,0xcc,0x9a,0x09,
+0x43,0x43,0x22,0x01,0xa8,0xbb,0xcc,0x99,0x18,0x32,0x34,0x13,0x81,0xb9,0xad,0xbb,
+0x9b,0x52,0x53,0x43,0x22,0x81,0xb8,0xcc,0xbb,0x8a,0x11,0x36,0x32,0x13,0x99,0xca,
+0xbb,0xad,0x08,0x20,0x20,0x31,0x77,0x23,0x53,0x12,0x81,0xdd,0xbc,0xbc,0xaa,0x89,
+0x20,0x53,0x22,0x01,0xa8,0xab,0xbb,0x0a,0x42,0x45,0x33,0x81,0x80,0xa9,0xac,0x0a,
+0x32,0x44,0x53,0x24,0x02,0x99,0xb1,0xaf,0x08,0x31,0x22,0x44,0x52,0x16,0xb9,0x1a,
+0xa0,0xce,0xab,0x09,0x82,0xa9,0x29,0x31,0x26,0x11,0x44,0x11,0xb8,0xbc,0xbc,0xaa,
+0x89,0x32,0x41,0x25,0xfb,0x0b,0x21,0x01,0x08,0x47,0x22,0x90,0x99,0xbb,0x9a,0x81,
+0x8a,0x41,0x47,0xb1,0x9c,0x10,0x42,0xe1,0x8b,0x43,0xe0,0xab,0x88,0x31,0x91,0x09,
+0x53,0x91,0xcb,0x08,0xb9,0x28,0x56,0x12,0x02,0xa0,0xbc,0xba,0xbd,0x09,0x33,0x46,
+0x21,0x01,0x99,0x89,0xca,0x8a,0x88,0x73,0x23,0x33,0xc1,0x9b,0xaa,0xdc,0x89,0xca,
+0x5a,0x04,0x11,0x11,0x99,0x81,0x98,0xbd,0x8a,0x46,0x02,0xa8,0x0a,0x02,0xcc,0x9c,
+0x11,0x90,0x21,0x9a,0x90,0xa1,0x3a,0x04,0xff,0x20,0x01,0xa8,0xdb,0x19,0x33,0xd0,
+0x1a,0x27,0xa0,0xbb,0xae,0x42,0x81,0x18,0x43,0x03,0xa9,0x49,0x93,0xbc,0x99,0x0b,
+0x02,0x10,0x1a,0x77,0x81,0xab,0x88,0x08,0x11,0x30,0x26,0x80,0xd8,0x9b,0x10,0x89,
+0x99,0x23,0x09,0xbc,0x08,0xc0,0x6b,0x16,0x34,0xc9,0x9c,0x88,0xa1,0xbf,0x18,0x42,
+0x93,0x1a,0x80,0x08,0x04,0x8b,0x44,0x23,0xb8,0x19,0xe9,0x8b,0x34,0xdc,0x8a,0x81,
+0x09,0x81,0xbb,0x39,0xb0,0x33,0xff,0x9b,0x51,0x33,0x04,0xa9,0x38,0x90,0xba,0xdb,
+0x18,0x91,0xc0,0x8f,0x32,0x02,0x61,0x32,0x12,0x90,0x0a,0x33,0xf1,0x9f,0x11,0xa8,
+0x9b,0x10,0x53,0x83,0xca,0x89,0x08,0x80,0x0a,0x92,0x40,0x24,0x41,0x27,0x28,0x13,
+0xdb,0x88,0xa9,0xbc,0xec,0x29,0x21,0x02,0x39,0x27,0x91,0xad,0x90,0xab,0x89,0xcb,
+0x0a,0x26,0x00,0x81,0x20,0x35,0xb8,0x1a,0x34,0xf1,0x9e,0x02,0x20,0x00,0x98,0x21,
+0x12,0xda,0xba,0xae,0x28,0x82,0x11,0x52,0x22,0x53,0xeb,0x1a,0x13,0xaa,0x9b,0x21,
+0x32,0x01,0xbc,0x71,0x17,0x10,0xa8,0x8b,0xaa,0xab,0x0b,0x47,0x10,0x91,0x9a,0x21,
+0xda,0xbb,0x8a,0x13,0x22,0x67,0x81,0x20,0x01,0x90,0xed,0x8a,0x01,0xa9,0x99,0x18,
+0x23,0x11,0xec,0x30,0x91,0x98,0xae,0x19,0x81,0x63,0x32,0x32,0x82,0x30,0xea,0xab,
+0xcd,0x8c,0x12,0xa9,0x88,0x31,0x26,0x30,0x16,0x99,0x8b,0x98,0xba,0xcc,0x8a,0x23,
+0x08,0x41,0x26,0x31,0x33,0x01,0xcb,0xcb,0x9c,0xca,0x1a,0x32,0x37,0x01,0x09,0x12,
+0x81,0xbb,0xeb,0xac,0x98,0x11,0x02,0x8b,0x14,0x80,0xdd,0xc9,0x1a,0x10,0x92,0x9b,
+0x62,0xb0,0xab,0x58,0x34,0x33,0x01,0x67,0xb1,0xac,0x99,0x12,0xeb,0x19,0x03,0x9a,
+0x19,0x04,0x08,0x43,0x32,0x24,0x10,0xc0,0x9e,0x9a,0x91,0xbd,0x53,0x92,0x0a,0x80,
+0x51,0xa8,0x08,0xb0,0x78,0x81,0x9a,0x08,0x72,0x90,0x9d,0x12,0xa9,0x8c,0x43,0x90,
+0x09,0x08,0x93,0x1b,0x03,0xdc,0xcc,0x08,0x40,0x26,0x81,0x88,0x10,0x98,0x08,0xeb,
+0x9c,0x98,0x8a,0x99,0x54,0x24,0x31,0x91,0xcb,0x41,0x00,0x22,0x40,0x93,0xac,0xdd,
+0x9b,0xaa,0x8a,0x21,0x35,0x47,0x12,0x21,0x13,0xa8,0xbb,0xfb,0xaf,0x88,0xa8,0x09,
+0x22,0x44,0x22,0x12,0x11,0x90,0xaa,0xce,0xcb,0x08,0xa8,0x0a,0x44,0x13,0x80,0x21,
+0xa8,0x98,0xbe,0x1a,0xa1,0x9c,0x8a,0x44,0x43,0x90,0x41,0x25,0xb0,0xac,0x08,0x9a,
+0x99,0x1b,0x16,0x8a,0xa1,0x49,0x47,0x01,0x21,0x22,0xa8,0xbe,0x9a,0xac,0x08,0xfb,
+0x0a,0x34,0x00,0x21,0x00,0x33,0xb0,0xdb,0xad,0x19,0x81,0x98,0x20,0x89,0xfb,0x7a,
+0x23,0x20,0x26,0x80,0xab,0xa9,0xac,0x8a,0x98,0x38,0x05,0x19,0x03,0x10,0xe1,0x9c,
+0xba,0xbd,0xac,0x12,0xb9,0x71,0x13,0x08,0x31,0x81,0x22,0xca,0x52,0xb0,0xcc,0xa9,
+0x08,0x99,0x23,0x28,0x47,0x22,0x11,0x64,0x03,0x18,0xb0,0xdb,0x9b,0xbc,0x8a,0x53,
+0x24,0x82,0x30,0x25,0x80,0x89,0x99,0xea,0xac,0xbb,0x8a,0x98,0x19,0x41,0x34,0x12,
+0x35,0x80,0xa9,0xcb,0xcb,0xdf,0x8a,0x90,0xab,0x21,0x33,0x91,0x73,0xb8,0x73,0x90,
+0x10,0x89,0x11,0xab,0xb3,0x8f,0x02,0x0a,0xa1,0x08,0x03,0x56,0x91,0x21,0xb0,0x68,
+0x82,0x18,0x8a,0x34,0xda,0x10,0xdb,0xaa,0x38,0x13,0x8b,0x67,0x11,0x90,0x10,0x01,
+0xaa,0xbb,0x88,0xbc,0xfa,0x8b,0x23,0x9b,0x85,0x28,0x18,0x12,0xba,0xca,0xce,0x41,
+0xc9,0x88,0x18,0x32,0x9b,0xd0,0x1a,0xa0,0x8a,0xc8,0x50,0x73,0x85,0x9a,0x10,0x24,
+0x81,0xa0,0xaa,0xaa,0xbe,0x8a,0x24,0x24,0x8a,0x36,0x23,0x00,0x72,0x04,0xaa,0x21,
+0xea,0x18,0x98,0xa8,0x18,0xa1,0x8d,0x88,0x98,0x60,0x83,0x8b,0x83,0xab,0xf9,0x9d,
+0x01,0x9b,0x9b,0x80,0xca,0x2b,0x01,0x46,0x42,0x33,0x12,0x23,0x18,0x90,0x80,0xaa,
+0xff,0x8a,0x01,0x31,0x15,0x32,0x62,0x22,0x82,0x08,0xcd,0xaa,0xb9,0xaf,0x89,0xb9,
+0x0d,0x21,0x08,0x81,0x32,0x04,0x9a,0x00,0xa1,0xef,0x01,0x8f,0x81,0x8d,0x86,0x1b,
+0x86,0x1a,0x84,0x0b,0x03,0x8b,0x12,0x89,0x13,0xcb,0x31,0xb0,0x38,0xa0,0x60,0xa1,
+0x18,0x82,0x51,0xea,0x10,0xa0,0xcb,0x9b,0x01,0x99,0x18,0x09,0x25,0x10,0x25,0x20,
+0xa3,0xae,0xb8,0xae,0x99,0x09,0x21,0x10,0x44,0x13,0x88,0x28,0x80,0x85,0x9a,0x1c,
+0xd2,0xae,0x98,0x09,0x38,0x84,0x9c,0x62,0x82,0x19,0x98,0x8b,0x24,0x9a,0x38,0x24,
+0x80,0x00,0x4a,0xf0,0x2c,0xc8,0x8b,0xdc,0x19,0xea,0x71,0x91,0x30,0x12,0x13,0x88,
+0x01,0xa2,0xbf,0xb1,0x9e,0x80,0xab,0x30,0xa1,0x60,0x13,0x71,0x93,0x51,0xa0,0x10,
+0x98,0xaa,0xb9,0xbd,0xaa,0x09,0x91,0x8d,0x54,0x02,0x01,0x31,0x10,0x02,0x82,0x09,
+0xbe,0x88,0xcf,0xa8,0xad,0x21,0xab,0x20,0xb9,0x64,0x99,0x36,0x88,0x14,0x29,0x91,
+0x8a,0xbb,0x90,0xbe,0x9a,0xab,0x1a,0x81,0x54,0x34,0x31,0x35,0x24,0x89,0x02,0x19,
+0xc9,0xbc,0xda,0x8a,0x90,0x29,0x01,0x53,0x22,0x13,0x53,0x54,0x90,0x00,0xa9,0xbf,
+0x8a,0xca,0x9a,0x9b,0x08,0xa9,0x10,0x62,0x35,0x11,0x12,0x18,0xb1,0xcf,0x89,0x88,
+0x9a,0xca,0x08,0x98,0xbc,0x40,0x16,0x10,0x73,0x02,0x00,0x41,0x03,0x98,0x89,0xd9,
+0xbc,0xa8,0x99,0x09,0x31,0x01,0x65,0x23,0x11,0x13,0x62,0x92,0xa8,0xad,0x98,0xcb,
+0xeb,0x8b,0xc9,0x8a,0x80,0x9a,0x52,0x53,0x01,0x01,0x52,0x12,0x89,0x08,0x90,0x88,
+0xbe,0xad,0x88,0x89,0x22,0x22,0x63,0x12,0x34,0x18,0x53,0x84,0x08,0xba,0xcd,0xaa,
+0xba,0xab,0xab,0xa9,0x9e,0x82,0x8d,0x32,0x80,0x47,0x00,0x21,0x23,0xd8,0x9b,0xc8,
+0xab,0xa8,0x8d,0x80,0x10,0x53,0x41,0x14,0x41,0x25,0x32,0x11,0xa1,0x21,0xba,0xdd,
+0xdb,0x0a,0xc9,0x8c,0x01,0x11,0x41,0x32,0x02,0x33,0x41,0xa2,0xae,0x9a,0xab,0xfc,
+0x8b,0xa9,0x9a,0xaa,0x19,0x63,0x32,0x44,0x01,0x20,0x41,0xa1,0x9a,0x18,0xf9,0xac,
+0x10,0xbc,0x08,0x88,0x89,0x53,0x43,0x62,0x02,0x31,0x22,0x00,0x89,0xe8,0x9b,0xa8,
+0xbb,0xcf,0x09,0x00,0x22,0x88,0x54,0x24,0x15,0x10,0x33,0x01,0x90,0xcb,0xbc,0xcc,
+0xcb,0x8a,0xb9,0x9b,0x18,0x43,0x25,0x32,0x73,0x13,0x11,0x80,0xbb,0xab,0xfc,0x8c,
+0x9a,0x90,0x8a,0x88,0x32,0x44,0x35,0x42,0x13,0x88,0x02,0xbc,0xbc,0xbf,0xb9,0xac,
+0x99,0x8a,0x92,0x09,0x73,0x14,0x52,0x21,0x13,0x20,0x80,0xa1,0xaa,0x9a,0xca,0xac,
+0x88,0x18,0x31,0x27,0x11,0x45,0x25,0x32,0x81,0x08,0x98,0xcb,0xcc,0xab,0xa0,0xae,
+0xb9,0x8a,0x9a,0x02,0x00,0x11,0x75,0x01,0x12,0x09,0xa0,0xbb,0xbf,0xda,0xaa,0xbc,
+0x0a,0x11,0x08,0x64,0x42,0x13,0x01,0x11,0x01,0xc1,0x8d,0x98,0xa9,0xd9,0x09,0x19,
+0xa9,0x42,0x14,0x32,0x45,0x23,0x11,0x82,0x89,0xac,0x09,0xef,0xa9,0x98,0x09,0xaa,
+0x98,0x10,0x82,0x51,0x93,0x72,0x15,0x99,0x08,0x58,0x02,0xb9,0x0b,0x08,0x8a,0xfb,
+0x19,0xda,0x29,0x00,0xa0,0xb9,0x79,0x93,0x9c,0x18,0xc8,0xb9,0xcc,0x08,0xcc,0x9b,
+0x22,0xbd,0x80,0x43,0x11,0x14,0x12,0x52,0x12,0x00,0x12,0x11,0x1b,0xf8,0x9b,0xc8,
+0x09,0x10,0xb9,0x74,0x15,0x22,0x11,0x28,0x03,0x84,0xaf,0x02,0xab,0xba,0x90,0x38,
+0xd1,0x50,0x33,0x44,0x88,0x55,0x21,0x01,0x10,0x52,0x12,0x09,0xa2,0xab,0x9c,0x11,
+0x14,0x09,0x37,0x21,0x14,0x53,0x23,0x04,0x10,0x0a,0x26,0xa9,0x88,0x9a,0x8c,0xa0,
+0xea,0xab,0x9a,0xbd,0x88,0xbb,0xab,0xb1,0x30,0xde,0x9c,0x92,0xba,0x1b,0xa0,0xdf,
+0x90,0xdb,0x8a,0x9b,0xc9,0x89,0x89,0x60,0x01,0x03,0x34,0x54,0x22,0x22,0x00,0x01,
+0xab,0xfb,0xba,0xab,0x80,0x8a,0x41,0x23,0x73,0x34,0x12,0x33,0x08,0x92,0x9c,0xea,
+0xab,0xbe,0xc9,0x8c,0x9a,0x8a,0x80,0xa8,0x51,0x33,0x00,0x85,0x28,0xca,0x99,0xea,
+0x9b,0xcb,0xbb,0xbb,0x9a,0x88,0xab,0x42,0x89,0x64,0x14,0x10,0x19,0x82,0xbb,0xdd,
+0xdc,0xab,0xca,0xba,0xa9,0x19,0x30,0x42,0x35,0x43,0x34,0x12,0x24,0x81,0x10,0xa8,
+0xc9,0xab,0xbf,0x88,0xeb,0x00,0x20,0x38,0x16,0x10,0x18,0x04,0xcb,0x9a,0xab,0xdf,
+0x9a,0xbb,0xba,0xcc,0xaa,0x98,0xb9,0x0a,0xb0,0x18,0x93,0x72,0x17,0x54,0x44,0x34,
+0x44,0x44,0x32,0x43,0x43,0x12,0x11,0x02,0x80,0xbb,0xbc,0xdb,0xcc,0x9b,0x9a,0x89,
+0x89,0x32,0x54,0x33,0x43,0x23,0x01,0xa0,0xec,0xcc,0xbc,0xcc,0xcb,0xba,0xaa,0xab,
+0x89,0x10,0x23,0x45,0x43,0x43,0x32,0x21,0x01,0x90,0xcb,0xbd,0xcb,0xcb,0xba,0x99,
+0x00,0x32,0x55,0x53,0x34,0x32,0x43,0x32,0x12,0x80,0x89,0xca,0xcc,0xab,0xbb,0xbb,
+0x9b,0x18,0x32,0x44,0x35,0x34,0x32,0x22,0x82,0xa8,0xcc,0xbd,0xbc,0xbc,0xcb,0xba,
+0x9a,0x08,0x10,0x31,0x44,0x33,0x12,0x20,0x02,0xdc,0xbb,0xbd,0xbd,0xab,0xbb,0x8a,
+0x90,0x40,0x73,0x33,0x43,0x42,0x33,0x11,0x01,0x89,0xca,0xdc,0xab,0xbc,0xaa,0x99,
+0x19,0x43,0x51,0x44,0x33,0x33,0x35,0x22,0x11,0x81,0x98,0xab,0xbd,0xad,0xba,0xaa,
+0x9a,0x28,0x32,0x47,0x52,0x23,0x32,0x33,0x02,0x98,0xc9,0xbe,0xbd,0xbd,0xbb,0xbc,
+0xcb,0xab,0x9b,0xaa,0x19,0x11,0x10,0x43,0x20,0xa8,0xfb,0x98,0xdb,0x9a,0xaa,0x20,
+0x54,0x54,0x45,0x34,0x44,0x42,0x32,0x23,0x21,0x12,0x00,0xba,0xcb,0xcd,0xbb,0xbc,
+0xaa,0x98,0x18,0x53,0x33,0x35,0x34,0x14,0x11,0x98,0xcb,0xdd,0xcb,0xbc,0xcb,0xbb,
+0xba,0x9b,0x89,0x21,0x63,0x53,0x33,0x24,0x33,0x32,0x00,0x98,0xcb,0xcd,0xbb,0xac,
+0xab,0x8a,0x18,0x53,0x44,0x34,0x35,0x33,0x33,0x33,0x12,0x80,0xca,0xcc,0xdb,0xbb,
+0xac,0xab,0x9a,0x89,0x20,0x32,0x35,0x34,0x43,0x12,0x80,0xa8,0xcd,0xbc,0xbc,0xbc,
+0xbb,0xab,0xaa,0x08,0x31,0x35,0x44,0x43,0x33,0x32,0x22,0x00,0x98,0xdb,0xbb,0xad,
+0xab,0x8a,0x88,0x42,0x44,0x44,0x24,0x33,0x43,0x22,0x01,0x90,0xc9,0xdb,0xcb,0xbc,
+0xaa,0xbc,0x99,0x88,0x00,0x42,0x42,0x43,0x32,0x33,0x32,0x00,0x88,0xe9,0xbb,0xcb,
+0xad,0x9a,0xa8,0x09,0x23,0x54,0x44,0x24,0x43,0x23,0x12,0x13,0x80,0xba,0xdc,0xbc,
+0xcc,0xac,0xab,0xbb,0xac,0xaa,0x8a,0x98,0x00,0x11,0x31,0x28,0x15,0xba,0xbb,0xbf,
+0xdd,0xbb,0xcb,0xab,0xab,0x0a,0x10,0x55,0x46,0x53,0x53,0x32,0x34,0x33,0x23,0x23,
+0x11,0x91,0xca,0xcc,0xdb,0xbb,0xbb,0xbb,0x89,0x08,0x63,0x53,0x33,0x34,0x43,0x11,
+0x90,0xca,0xdc,0xeb,0xba,0xbc,0xcb,0xaa,0xaa,0x88,0x10,0x52,0x43,0x24,0x24,0x33,
+0x22,0x02,0x80,0xba,0xbe,0xbc,0xac,0xbb,0xaa,0x08,0x31,0x55,0x43,0x35,0x33,0x24,
+0x23,0x22,0x00,0xa8,0xdb,0xcc,0xbb,0xbc,0xbb,0xba,0x99,0x08,0x21,0x54,0x33,0x43,
+0x23,0x11,0x90,0xdb,0xcc,0xdb,0xbb,0xcb,0xab,0xaa,0x89,0x20,0x35,0x43,0x44,0x23,
+0x33,0x23,0x12,0x90,0xba,0xcc,0xdb,0xbb,0xaa,0x8a,0x18,0x33,0x56,0x43,0x33,0x43,
+0x13,0x12,0x80,0xcb,0xbc,0xbe,0xbc,0xbb,0xac,0x9b,0x89,0x08,0x32,0x44,0x34,0x34,
+0x33,0x24,0x01,0x01,0xa8,0xcb,0xcb,0xbc,0xaa,0xaa,0x08,0x32,0x54,0x35,0x34,0x34,
+0x24,0x22,0x02,0x90,0xb9,0xdb,0xbd,0xcb,0xbc,0xbb,0xcb,0xaa,0x99,0x88,0x11,0x11,
+0x41,0x22,0x22,0x80,0x90,0xcd,0xcd,0xdb,0xba,0xac,0xac,0x99,0x00,0x20,0x54,0x35,
+0x44,0x43,0x34,0x24,0x32,0x33,0x22,0x10,0x88,0xba,0xcd,0xcb,0xbc,0xba,0xbb,0x89,
+0x08,0x41,0x53,0x53,0x33,0x22,0x22,0x98,0xdc,0xcc,0xbc,0xad,0xbc,0xab,0xab,0xab,
+0x89,0x31,0x63,0x43,0x44,0x32,0x32,0x22,0x22,0xa8,0xb9,0xdc,0xbc,0xbb,0xbb,0x9b,
+0x09,0x42,0x46,0x43,0x44,0x32,0x33,0x33,0x22,0x00,0xa9,0xdc,0xdb,0xca,0xbb,0xbb,
+0xbb,0x99,0x89,0x21,0x34,0x53,0x33,0x33,0x03,0x80,0xdc,0xcb,0xcd,0xba,0xcb,0xab,
+0xa9,0x8a,0x31,0x42,0x35,0x44,0x24,0x32,0x23,0x12,0x01,0x99,0xc9,0xbc,0xac,0xac,
+0x9a,0x89,0x28,0x33,0x45,0x34,0x53,0x23,0x12,0x01,0x98,0xdb,0xcc,0xcc,0xba,0xcb,
+0xab,0x99,0x8a,0x28,0x32,0x55,0x33,0x34,0x43,0x12,0x11,0x81,0xa9,0xaa,0xdc,0xab,
+0xaa,0xaa,0x18,0x21,0x47,0x34,0x33,0x45,0x21,0x21,0x81,0x89,0xca,0xcc,0xbb,0xbd,
+0xbb,0xcc,0xa9,0x9a,0x88,0x28,0x12,0x21,0x23,0x32,0x23,0xd8,0xab,0xfc,0xbc,0xca,
+0xcb,0xba,0xaa,0x89,0x20,0x53,0x65,0x33,0x44,0x34,0x43,0x23,0x23,0x33,0x12,0x80,
+0xa9,0xcc,0xbc,0xbc,0xbb,0xac,0xaa,0x08,0x32,0x52,0x44,0x24,0x23,0x22,0x01,0xca,
+0xdc,0xbc,0xbd,0xdb,0xba,0xab,0xab,0x99,0x00,0x43,0x44,0x34,0x34,0x32,0x23,0x12,
+0x81,0xb9,0xbd,0xcc,0xbc,0xba,0xaa,0x09,0x21,0x44,0x35,0x44,0x33,0x24,0x22,0x12,
+0x00,0xa9,0xcc,0xbc,0xbc,0xcb,0xba,0xaa,0x89,0x00,0x31,0x53,0x33,0x43,0x22,0x11,
+0xc9,0xcb,0xcc,0xbc,0xbb,0xbc,0x9a,0x8a,0x10,0x33,0x46,0x43,0x33,0x34,0x22,0x11,
+0x02,0xa9,0xbb,0xbd,0xad,0xaa,0x9a,0x19,0x41,0x44,0x53,0x43,0x23,0x23,0x22,0x80,
+0xb9,0xcd,0xcc,0xcb,0xac,0xbb,0xbb,0xaa,0x09,0x10,0x33,0x45,0x34,0x34,0x32,0x23,
+0x12,0x98,0xba,0xcd,0xac,0xcb,0xaa,0x89,0x89,0x53,0x34,0x35,0x35,0x33,0x34,0x22,
+0x22,0x90,0xbb,0xcd,0xcc,0xbb,0xcb,0xbb,0xaa,0x9b,0x88,0x18,0x42,0x24,0x32,0x23,
+0x81,0xb9,0xdf,0xca,0xba,0xcc,0xbb,0xbb,0xab,0x9b,0x18,0x42,0x63,0x44,0x33,0x36,
+0x33,0x44,0x43,0x22,0x33,0x33,0x02,0x01,0x88,0xb8,0xcd,0xbb,0xcc,0xab,0xaa,0x09,
+0x11,0x41,0x45,0x34,0x23,0x32,0x02,0xc9,0xdd,0xdb,0xcb,0xbc,0xcb,0xab,0xaa,0x9b,
+0x08,0x32,0x45,0x34,0x34,0x24,0x22,0x11,0x81,0xa9,0xbc,0xcc,0xcb,0xab,0xab,0x88,
+0x20,0x54,0x63,0x33,0x34,0x33,0x23,0x12,0x90,0xc9,0xbc,0xcd,0xbb,0xbb,0xac,0xaa,
+0x09,0x21,0x32,0x45,0x23,0x33,0x11,0x88,0xb9,0xcf,0xdb,0xbb,0xbb,0xac,0x9a,0x08,
+0x21,0x44,0x44,0x43,0x22,0x33,0x12,0x81,0x98,0xdb,0xcb,0xbc,0xaa,0xab,0x8a,0x00,
+0x45,0x44,0x33,0x34,0x24,0x12,0x11,0x90,0xca,0xcc,0xcb,0xcb,0xcb,0xab,0x9a,0x8a,
+0x18,0x32,0x34,0x35,0x43,0x24,0x12,0x12,0x80,0xab,0xcc,0xcb,0xbb,0xbb,0xab,0x10,
+0x41,0x55,0x24,0x34,0x34,0x33,0x24,0x11,0x00,0xa9,0xcc,0xbb,0xcd,0xbb,0xaa,0xcb,
+0x09,0x08,0x20,0x43,0x53,0x23,0x21,0x80,0xa9,0xed,0xcb,0xcb,0xba,0xbd,0xaa,0x88,
+0x9a,0x28,0x42,0x43,0x14,0x43,0x33,0x12,0x20,0x43,0x11,0x20,0x46,0x34,0x33,0x44,
+0x33,0x24,0x21,0x11,0x11,0xc9,0xbd,0xba,0xcc,0xbb,0x99,0x18,0x01,0x63,0x34,0x24,
+0x12,0x02,0xb9,0xdd,0xbc,0xbd,0xdb,0xab,0xbb,0xaa,0x89,0x20,0x45,0x53,0x43,0x32,
+0x33,0x21,0x01,0xa9,0xdb,0xcc,0xac,0xbb,0xab,0x9a,0x20,0x53,0x54,0x33,0x44,0x32,
+0x22,0x01,0x90,0xc9,0xbc,0xcc,0xbb,0xbc,0xaa,0x9a,0x08,0x30,0x44,0x33,0x34,0x33,
+0x12,0x88,0xca,0xcc,0xcc,0xbb,0xcb,0xaa,0x8a,0x18,0x42,0x34,0x35,0x25,0x13,0x22,
+0x82,0x80,0xb8,0xbd,0xac,0xcb,0xab,0x9a,0x10,0x21,0x46,0x53,0x23,0x33,0x33,0x12,
+0x90,0xcc,0xcb,0xcd,0xbb,0xbb,0xbc,0xab,0x89,0x18,0x41,0x25,0x34,0x24,0x22,0x23,
+0x01,0x90,0xca,0xdb,0xcb,0xbb,0xab,0x8a,0x18,0x73,0x53,0x43,0x43,0x53,0x22,0x12,
+0x11,0x90,0xba,0xcc,0xbc,0xbc,0xbc,0xaa,0x9a,0x89,0x21,0x33,0x45,0x34,0x33,0x23,
+0x81,0xc9,0xcd,0xcb,0xcc,0xbb,0xac,0xba,0x99,0x00,0x10,0x53,0x34,0x43,0x32,0x23,
+0x10,0xa8,0xba,0xcd,0xab,0xab,0x29,0x46,0x53,0x63,0x33,0x24,0x33,0x23,0x12,0xa8,
+0xba,0xbe,0xbd,0xdb,0x9a,0x99,0x08,0x11,0x54,0x33,0x24,0x43,0x11,0x90,0xc9,0xdb,
+0xcc,0xcb,0xbb,0xba,0xaa,0x89,0x31,0x54,0x43,0x34,0x43,0x22,0x11,0x80,0xaa,0xcc,
+0xcc,0xba,0xac,0x9a,0x99,0x10,0x43,0x44,0x24,0x24,0x23,0x21,0x01,0x98,0xca,0xbd,
+0xbc,0xcb,0xaa,0x9a,0x89,0x20,0x43,0x44,0x43,0x33,0x12,0x11,0x98,0xda,0xbc,0xbc,
+0xbc,0xab,0xab,0x1a,0x00,0x53,0x44,0x43,0x23,0x22,0x13,0x81,0xaa,0xdb,0xcc,0xbb,
+0xbc,0xa9,0x88,0x10,0x41,0x35,0x53,0x33,0x33,0x24,0x00,0xa8,0xcb,0xbd,0xcc,0xab,
+0xbb,0xab,0x9a,0x08,0x31,0x63,0x35,0x53,0x12,0x33,0x21,0x80,0xa8,0xbc,0xdb,0xbc,
+0xab,0xa8,0x19,0x22,0x47,0x42,0x24,0x53,0x32,0x12,0x21,0x98,0xc9,0xad,0xbc,0xac,
+0xbb,0xbb,0x99,0x09,0x32,0x64,0x24,0x43,0x22,0x13,0x11,0xc9,0xdc,0xbb,0xcd,0xab,
+0xac,0xaa,0x99,0x88,0x31,0x53,0x43,0x33,0x25,0x11,0x80,0xa9,0xcd,0xcb,0xbb,0xcb,
+0x9a,0x00,0x42,0x46,0x53,0x33,0x34,0x24,0x22,0x01,0x90,0xb9,0xbd,0xcc,0xab,0xab,
+0xaa,0x19,0x42,0x44,0x34,0x34,0x24,0x22,0x01,0x98,0xcc,0xbc,0xbd,0xcb,0xbb,0xaa,
+0x8a,0x18,0x32,0x36,0x44,0x33,0x33,0x13,0x01,0xb9,0xbd,0xbe,0xbc,0xbb,0xac,0x8a,
+0x88,0x22,0x54,0x43,0x43,0x32,0x32,0x21,0x80,0xb9,0xbd,0xbd,0xcb,0xba,0xaa,0x89,
+0x21,0x53,0x53,0x34,0x23,0x23,0x22,0x98,0xc9,0xcc,0xbc,0xbc,0xbc,0xaa,0x99,0x09,
+0x22,0x53,0x34,0x43,0x23,0x13,0x10,0x90,0xbc,0xbd,0xbd,0xcb,0xaa,0xaa,0x09,0x20,
+0x63,0x33,0x35,0x34,0x23,0x32,0x02,0x98,0xba,0xce,0xca,0xac,0xaa,0xaa,0x99,0x18,
+0x31,0x45,0x34,0x33,0x34,0x33,0x12,0x81,0xa9,0xec,0xbb,0xbc,0xbb,0xab,0x88,0x21,
+0x45,0x53,0x24,0x42,0x22,0x32,0x81,0x99,0xba,0xbf,0xbc,0xac,0xab,0xaa,0x08,0x31,
+0x73,0x43,0x43,0x23,0x32,0x01,0x89,0xdb,0xbc,0xcd,0xcb,0xab,0xbb,0x99,0x89,0x20,
+0x33,0x34,0x45,0x22,0x01,0x09,0xea,0xac,0xcc,0xbb,0xbb,0xbb,0xaa,0x18,0x37,0x44,
+0x53,0x34,0x33,0x24,0x23,0x11,0x00,0xa9,0xbc,0xdb,0xac,0xab,0x8a,0x00,0x31,0x55,
+0x34,0x34,0x33,0x24,0x02,0x80,0xca,0xcc,0xbc,0xcc,0xaa,0xab,0xaa,0x89,0x11,0x43,
+0x44,0x43,0x23,0x23,0x11,0xb8,0xeb,0xdb,0xdb,0xba,0xbb,0xaa,0x89,0x10,0x53,0x44,
+0x43,0x43,0x23,0x32,0x01,0x90,0xba,0xcd,0xca,0xab,0xab,0x9a,0x10,0x41,0x45,0x42,
+0x24,0x22,0x22,0x81,0xa8,0xcc,0xbc,0xcc,0xbb,0xbb,0xab,0x89,0x28,0x41,0x45,0x32,
+0x33,0x24,0x12,0x91,0xbb,0xdc,0xcc,0xbb,0xca,0x9a,0x9a,0x10,0x32,0x36,0x34,0x34,
+0x43,0x22,0x01,0x00,0xaa,0xcd,0xbb,0xbc,0xbb,0xaa,0x0a,0x20,0x53,0x45,0x42,0x33,
+0x33,0x22,0x02,0xa8,0xbc,0xbd,0xbd,0xcb,0xaa,0x99,0x88,0x22,0x54,0x43,0x43,0x32,
+0x14,0x11,0x88,0xa8,0xcc,0xcb,0xbb,0xcb,0xaa,0x88,0x00,0x53,0x53,0x33,0x35,0x32,
+0x12,0x01,0xb9,0xbd,0xbd,0xdb,0xbb,0xca,0xaa,0x09,0x00,0x21,0x32,0x24,0x30,0x83,
+0xb9,0xce,0xbc,0xcd,0xcb,0xba,0xab,0xaa,0x09,0x10,0x43,0x53,0x25,0x33,0x24,0x34,
+0x33,0x21,0x34,0x21,0x22,0x11,0x03,0x32,0x21,0x25,0x54,0x22,0x31,0x37,0x23,0x33,
+0x35,0x15,0x11,0x01,0x80,0xdb,0xda,0xcb,0xdb,0xbb,0xac,0xb9,0xaa,0x09,0x10,0x22,
+0x24,0x13,0x33,0x80,0xcc,0xdd,0xdb,0xcb,0xba,0xbb,0xab,0x09,0x42,0x53,0x35,0x53,
+0x33,0x32,0x23,0x81,0x98,0xba,0xcd,0xbc,0xb9,0x8a,0x08,0x62,0x52,0x34,0x43,0x23,
+0x33,0x81,0xa0,0xad,0xbe,0xdb,0xbb,0xbb,0xab,0x9b,0x20,0x20,0x36,0x44,0x22,0x23,
+0x11,0xa0,0xcc,0xeb,0xcb,0xbb,0xca,0x9a,0x88,0x00,0x52,0x34,0x43,0x33,0x24,0x11,
+0x81,0x99,0xcc,0xca,0xac,0x9b,0x9a,0x09,0x32,0x35,0x54,0x43,0x23,0x23,0x21,0x88,
+0xa0,0xcc,0xcb,0xcb,0xba,0x9b,0x89,0x10,0x52,0x44,0x33,0x53,0x13,0x12,0x88,0xa8,
+0xdb,0xcb,0xac,0xbb,0xab,0x8b,0x11,0x52,0x43,0x43,0x34,0x33,0x22,0x11,0xb1,0xbc,
+0xbd,0xda,0xcb,0xaa,0xab,0xa9,0x09,0x20,0x02,0x12,0x13,0x09,0xca,0xdc,0xce,0xab,
+0xbd,0xdb,0x9b,0xaa,0xab,0x99,0x99,0x81,0x19,0x80,0xa0,0x1c,0xa0,0x89,0x32,0x73,
+0x37,0x44,0x36,0x34,0x43,0x53,0x23,0x12,0x21,0x01,0x80,0x98,0x09,0x89,0x82,0x72,
+0x45,0x33,0x35,0x25,0x11,0x12,0x80,0xa9,0xfb,0xcb,0xbc,0xcb,0xba,0xab,0xa9,0x08,
+0x11,0x42,0x42,0x14,0x02,0x00,0xb9,0xbd,0xbe,0xcb,0xbb,0xaa,0x9b,0x08,0x32,0x73,
+0x35,0x33,0x34,0x12,0x22,0x90,0xa8,0xbb,0xcb,0xaa,0xaa,0x42,0x42,0x47,0x43,0x22,
+0x33,0x03,0x90,0xd8,0xbd,0xcb,0xcc,0x9b,0xaa,0xab,0x08,0x01,0x32,0x35,0x23,0x33,
+0x80,0xe9,0xbc,0xcd,0xcb,0xcb,0xab,0x8b,0x99,0x30,0x63,0x33,0x33,0x34,0x22,0x80,
+0x90,0xcb,0xbf,0xba,0xac,0xa8,0x18,0x30,0x47,0x32,0x44,0x33,0x32,0x13,0x11,0xa8,
+0xbb,0xbe,0xbc,0xcb,0x99,0x09,0x21,0x35,0x44,0x33,0x34,0x23,0x12,0x00,0xba,0xdd,
+0xcb,0xbb,0xac,0x9a,0x89,0x10,0x34,0x43,0x35,0x33,0x32,0x23,0x80,0xca,0xdc,0xbb,
+0xbc,0xac,0xba,0x9a,0x88,0x31,0x34,0x63,0x24,0x22,0x11,0x80,0xbb,0xfb,0xbb,0xbe,
+0xcb,0xba,0xcb,0x99,0xab,0x99,0x19,0x00,0x10,0x90,0xea,0xa9,0xcb,0xcd,0xba,0xbb,
+0xab,0x08,0x31,0x57,0x43,0x54,0x32,0x43,0x24,0x32,0x22,0x02,0x01,0xa8,0x9a,0x00,
+0x09,0x40,0x47,0x34,0x63,0x33,0x23,0x21,0x02,0xa8,0xbc,0xcd,0xcb,0xac,0xbb,0xba,
+0xa9,0x08,0x12,0x34,0x35,0x23,0x23,0x81,0xda,0xcd,0xbb,0xcd,0xaa,0xaa,0xaa,0x08,
+0x21,0x34,0x54,0x23,0x24,0x22,0x02,0x08,0xba,0xdb,0xba,0xab,0xaa,0x38,0x30,0x46,
+0x36,0x52,0x23,0x12,0x12,0x81,0xba,0xae,0xcc,0xbb,0xbb,0xba,0xaa,0x99,0x12,0x89,
+0x26,0x01,0x00,0xb8,0xed,0xaa,0xbb,0xae,0xcb,0xab,0x9a,0x9b,0x18,0x34,0x20,0x33,
+0x15,0x80,0x38,0x02,0xe9,0x99,0x99,0x30,0x32,0x36,0x27,0x23,0x38,0x54,0x82,0x31,
+0x00,0x80,0x88,0xa9,0x11,0x40,0x83,0x64,0x34,0x03,0x63,0x08,0xa1,0x98,0xcc,0xbc,
+0xbb,0xa9,0x99,0x50,0x22,0x37,0x42,0x23,0x52,0x12,0x81,0x99,0xca,0xab,0xcc,0xaa,
+0x9b,0xb9,0x30,0x72,0x34,0x25,0x33,0x42,0x11,0x90,0xa9,0xdc,0xac,0xbb,0xbb,0xcb,
+0xab,0x01,0x99,0x01,0x11,0xca,0xc9,0xbd,0xfd,0xaa,0xba,0xcd,0xab,0xb9,0xbb,0x9c,
+0x08,0x9b,0x31,0x32,0x43,0x43,0x24,0x12,0x21,0x33,0x00,0x46,0x23,0x42,0x43,0x35,
+0x42,0x34,0x33,0x46,0x22,0x42,0x33,0x32,0x33,0x23,0x01,0x80,0x88,0x98,0x8a,0xa8,
+0xba,0x08,0xe0,0x30,0xb8,0xb1,0xdc,0xcc,0xda,0x9c,0x99,0xca,0xa9,0xbd,0xcb,0x99,
+0xcb,0xab,0x8a,0xeb,0x89,0xb8,0xac,0x9a,0x10,0x09,0x08,0x53,0x43,0x24,0x54,0x11,
+0x21,0x90,0x29,0xb9,0x80,0x81,0x1d,0x02,0x09,0x12,0x9a,0x47,0xb0,0x0b,0xf8,0xbf,
+0x9a,0xcb,0xcc,0xa9,0xcb,0xa9,0xaa,0xa9,0x80,0x4a,0xb2,0x0a,0x08,0xeb,0x1b,0xc3,
+0xaf,0x88,0xba,0xba,0x8a,0xc9,0x08,0x8b,0x89,0x84,0x70,0x34,0x41,0x26,0x11,0x11,
+0x11,0x00,0x81,0x31,0x9b,0xf8,0x08,0x9a,0x48,0xa2,0x50,0x32,0x14,0x35,0x33,0x11,
+0x24,0x0a,0x92,0xbb,0x9e,0xb0,0x08,0x38,0x33,0x67,0x13,0x53,0x43,0x22,0x24,0x13,
+0x41,0x22,0x82,0x20,0xa8,0xa9,0x9d,0xa0,0x22,0x79,0x13,0x25,0x23,0x14,0x40,0x04,
+0x91,0x9a,0x98,0xdf,0xab,0xba,0xbc,0xdc,0xbb,0xcb,0xbb,0xaa,0xcb,0xca,0xac,0xab,
+0xba,0xbd,0xac,0xda,0xba,0xaa,0xaa,0x88,0x18,0x11,0x43,0x44,0x25,0x44,0x33,0x32,
+0x32,0x32,0x33,0x36,0x34,0x43,0x32,0x44,0x24,0x53,0x32,0x43,0x22,0x13,0x01,0x00,
+0x81,0x09,0x83,0x9a,0xaa,0x8b,0x4a,0xa4,0x81,0xb8,0xcf,0xcb,0xbc,0x08,0xca,0xae,
+0xaa,0xcc,0xa9,0xa9,0x98,0x8a,0xb0,0x99,0xba,0xab,0xeb,0x99,0xbc,0xa9,0x22,0x9e,
+0x22,0x23,0x34,0x73,0x24,0x32,0x24,0x00,0x53,0x22,0x01,0x93,0x1b,0xcd,0x80,0xb9,
+0xcb,0xab,0xbf,0xaa,0x88,0x90,0x8c,0xb0,0xcd,0xaa,0x8b,0xdb,0xa8,0xba,0xdc,0x9a,
+0xbd,0x9a,0x9a,0xca,0x00,0x8b,0xb2,0x30,0x9a,0x34,0x28,0xfc,0x9a,0xa8,0xac,0x2a,
+0x84,0xaa,0xb9,0x30,0x31,0x65,0x33,0x14,0x25,0x31,0x51,0x84,0x80,0x99,0xa9,0xcc,
+0x1b,0xab,0x80,0x52,0x21,0x40,0x16,0x24,0x34,0x42,0x22,0x13,0x82,0x18,0x20,0x06,
+0x9a,0x12,0x50,0x32,0x35,0x25,0x53,0x23,0x33,0x41,0x03,0x11,0x01,0xbb,0xaa,0x82,
+0x9b,0x8d,0xa2,0xc9,0x80,0x9c,0xc2,0x1f,0xb8,0x98,0x99,0xdd,0xaf,0xbb,0xec,0xab,
+0xbb,0xcc,0xcb,0xba,0xa9,0xac,0x9b,0x98,0xbb,0x8a,0x80,0x9a,0x1b,0x17,0xca,0x89,
+0x22,0x00,0x62,0x25,0x22,0x73,0x33,0x32,0x34,0x25,0x22,0x63,0x22,0x21,0x53,0x32,
+0x22,0x42,0x23,0x00,0x32,0x14,0x88,0x41,0x11,0x90,0x80,0x0a,0xbd,0xac,0xdb,0xc9,
+0xad,0x9a,0xb9,0x99,0x9a,0xa9,0xac,0xa9,0xcd,0x8a,0x81,0xaa,0x9c,0xac,0xda,0x1a,
+0x8a,0xf9,0x08,0x98,0x19,0x62,0x21,0x34,0x13,0x55,0x10,0x21,0x84,0x28,0x21,0x91,
+0xbb,0x9c,0xea,0x99,0xad,0x88,0xcb,0x99,0x01,0xad,0x81,0x18,0xf8,0x8c,0x8a,0xfb,
+0x99,0x98,0xac,0x99,0xa8,0x9c,0x01,0x99,0x09,0x11,0x10,0xeb,0x22,0xa0,0x9d,0x41,
+0xfa,0x8b,0x88,0x8a,0x00,0x31,0x24,0x14,0x29,0x23,0x12,0x72,0xa9,0x28,0xf9,0x08,
+0xa9,0x98,0x88,0xbb,0x01,0x84,0x0f,0x43,0x81,0x14,0x1b,0x13,0xd9,0x40,0x02,0x2b,
+0x26,0x22,0x63,0x24,0x21,0x24,0x24,0x31,0x34,0x33,0x15,0x21,0x32,0x21,0x02,0x82,
+0x34,0x38,0x73,0x04,0x12,0x28,0x27,0x10,0x90,0x88,0x81,0xaf,0x08,0xa8,0xda,0x8e,
+0x00,0xea,0x8a,0xc9,0xba,0xba,0xac,0xba,0xae,0xba,0xbd,0xaa,0xda,0xba,0xaa,0xba,
+0xbb,0xab,0xd8,0x0a,0x09,0x80,0x80,0x75,0x01,0x32,0x25,0x11,0x52,0x23,0x01,0x52,
+0x32,0x22,0x44,0x35,0x32,0x44,0x43,0x22,0x42,0x22,0x12,0x11,0x01,0x02,0x99,0xb9,
+0x00,0xea,0x1b,0xa8,0x01,0x8a,0x05,0x89,0x1c,0xe8,0x90,0xa9,0xcd,0xac,0xa9,0xdb,
+0x8b,0x00,0xab,0x80,0x13,0x39,0x18,0x04,0x06,0x9d,0x20,0xc8,0x8a,0x23,0x9f,0x03,
+0x19,0x44,0x23,0x61,0x02,0x82,0x20,0x21,0xab,0xb8,0xd8,0xaf,0xb9,0xcb,0xbd,0x89,
+0xb9,0x0e,0x90,0xab,0x90,0x9a,0xca,0x9c,0xc8,0xcd,0x0a,0xb8,0xad,0x00,0xa9,0xab,
+0x18,0x98,0xad,0x10,0x90,0xd9,0x1a,0xb8,0xc9,0x88,0x9f,0x18,0xb2,0x0d,0x43,0x99,
+0x80,0x16,0x91,0x69,0x99,0x98,0x11,0xab,0x00,0x0a,0xc3,0x1c,0x25,0xa9,0x10,0x16,
+0x2a,0x02,0x34,0xa0,0x4a,0x07,0x18,0x31,0x20,0x24,0x55,0x12,0x43,0x35,0x31,0x34,
+0x12,0x12,0x40,0x03,0x20,0x23,0x23,0x62,0x25,0x00,0x23,0x52,0x11,0x15,0x20,0x22,
+0x10,0xa0,0xc8,0x98,0xbd,0x0a,0xfa,0xa9,0x19,0xca,0xeb,0x09,0xcc,0xad,0xa9,0xbc,
+0xad,0xbb,0xbd,0xbb,0xac,0xbb,0xac,0xab,0xba,0x9c,0x98,0xa9,0xbb,0x00,0xa9,0x98,
+0x4b,0x34,0x43,0x37,0x43,0x52,0x23,0x14,0x53,0x42,0x22,0x23,0x44,0x23,0x33,0x63,
+0x32,0x13,0x34,0x32,0x21,0x03,0x24,0x11,0x10,0x89,0xb8,0xad,0xcb,0x09,0x8a,0xa0,
+0x9d,0x81,0x01,0xcb,0x0a,0xc1,0xef,0x89,0xba,0xbb,0xab,0xcb,0xac,0x08,0xa8,0x8c,
+0x34,0x21,0x20,0x32,0x05,0x43,0x73,0x02,0x11,0x13,0x21,0x39,0x26,0x12,0x52,0x01,
+0x80,0x31,0xa0,0xd9,0xbb,0xfb,0x9b,0xaf,0xaa,0xbc,0xaa,0xcb,0xbc,0xaa,0xb9,0xcb,
+0x9c,0xcb,0xc9,0x8a,0xa9,0xcc,0x9b,0x9b,0xbc,0xfa,0x1a,0xa9,0xa9,0xa2,0x18,0x30,
+0x81,0xa0,0x53,0x29,0x02,0x98,0x03,0x38,0xdc,0x0e,0x91,0x0a,0x43,0x89,0x24,0x4b,
+0x86,0x13,0x69,0x90,0xb8,0x89,0xba,0x9b,0x18,0x8b,0x33,0xa5,0x73,0x41,0x15,0x12,
+0x31,0x25,0x51,0x34,0x11,0x25,0x11,0x43,0x41,0x02,0x25,0x42,0x32,0x43,0x32,0x11,
+0x14,0x32,0x52,0x02,0x03,0x52,0x11,0x24,0x10,0x43,0x01,0x13,0x28,0xbb,0xb4,0xab,
+0x9e,0xfb,0x99,0xbd,0xbb,0xda,0xcb,0xca,0x8b,0xdc,0xbb,0xbb,0xcc,0xcb,0xbb,0xcb,
+0xac,0xba,0xab,0xba,0x9b,0xb8,0x8a,0x99,0x09,0x03,0x53,0x32,0x65,0x21,0x22,0x34,
+0x22,0x46,0x33,0x44,0x23,0x34,0x35,0x31,0x14,0x43,0x23,0x22,0x53,0x11,0x12,0x20,
+0x12,0x02,0x10,0x34,0xb0,0x01,0x08,0xa8,0xbc,0xa1,0x9f,0xac,0xcb,0xaa,0xd0,0x8d,
+0x00,0x80,0xb9,0x99,0xbb,0xaa,0x1b,0xde,0x00,0x00,0xa8,0x38,0x74,0x82,0x33,0x40,
+0x32,0x37,0x22,0x41,0x12,0x01,0x81,0x11,0x82,0x0b,0xac,0xaf,0x91,0x0c,0x89,0xdc,
+0x80,0xcc,0x0b,0xe8,0xab,0x8b,0xcc,0xba,0x9b,0xbb,0xaa,0xbe,0xac,0x89,0xab,0xab,
+0xeb,0x8c,0xaa,0xa9,0xaa,0xc8,0x0a,0xab,0xd1,0x19,0xa2,0x40,0x09,0x43,0x90,0x1b,
+0x07,0x2c,0x03,0xa9,0x98,0x91,0x4d,0xb1,0x40,0xa1,0x42,0x3a,0x94,0x99,0x53,0xb0,
+0x9f,0x81,0x0c,0xa2,0x29,0x3a,0x94,0x2b,0x83,0x27,0x31,0x43,0x33,0x07,0x62,0x11,
+0x03,0x23,0x51,0x11,0x25,0x11,0x24,0x33,0x22,0x27,0x23,0x30,0x23,0x53,0x00,0x43,
+0x03,0x40,0x11,0x05,0x11,0x28,0x01,0x02,0x22,0xac,0xf8,0x00,0xab,0xbd,0xc8,0x9c,
+0xab,0xbb,0xdf,0x99,0x9c,0xab,0xea,0xaa,0xbb,0xbc,0xac,0xbb,0xad,0xbb,0xab,0xad,
+0x9a,0xaa,0xba,0x9a,0x99,0xca,0x80,0x40,0x88,0x22,0x53,0x33,0x45,0x31,0x16,0x41,
+0x21,0x26,0x43,0x22,0x25,0x42,0x22,0x32,0x15,0x31,0x33,0x22,0x21,0x25,0x41,0x02,
+0x22,0x81,0x21,0x10,0xaa,0x81,0x9a,0x99,0xf9,0x0d,0xb1,0x88,0xca,0x1a,0x9b,0x82,
+0xe9,0x0b,0x31,0xec,0x98,0xaa,0x9b,0x03,0x2d,0xa2,0x0b,0x55,0x51,0x21,0x34,0x63,
+0x11,0x12,0x22,0x00,0x43,0x91,0x91,0x89,0x09,0x11,0x00,0xbf,0xc8,0xab,0xba,0x9d,
+0xcb,0xdd,0xa0,0xbb,0x9f,0xb9,0xbd,0xa9,0xdb,0xaa,0xa9,0xaa,0xbd,0xba,0xaa,0xbc,
+0xd9,0x8b,0xaa,0xdb,0xab,0x91,0x8b,0x8a,0x10,0xbb,0x91,0x72,0x80,0x89,0x41,0xa0,
+0x05,0x8b,0x30,0xb9,0x08,0xa6,0x0d,0xc8,0x52,0x81,0x18,0xb2,0xa2,0x5a,0xc0,0x20,
+0xec,0x18,0xa8,0x80,0x2b,0xb2,0x89,0x04,0x1f,0x42,0x04,0x13,0x71,0x24,0x12,0x00,
+0x31,0x25,0x22,0x13,0x31,0x44,0x61,0x12,0x25,0x31,0x24,0x12,0x42,0x10,0x22,0x14,
+0x10,0x34,0x09,0x04,0x22,0x11,0x12,0x23,0x12,0x29,0x87,0x9f,0x99,0xb1,0xcc,0x9e,
+0xb8,0xb9,0xaa,0xbc,0xad,0xb9,0xab,0x9c,0x9a,0xcc,0xca,0xad,0xba,0xcc,0xb9,0x9d,
+0xbb,0xb9,0x9c,0x9a,0xc9,0xab,0xab,0xb9,0xaa,0xae,0xb8,0x29,0xa2,0x90,0x28,0x50,
+0x12,0x24,0x35,0x74,0x11,0x23,0x42,0x25,0x32,0x34,0x41,0x23,0x24,0x43,0x41,0x23,
+0x23,0x63,0x21,0x23,0x52,0x80,0x13,0x82,0x32,0x80,0x01,0x51,0x23,0x82,0x59,0x11,
+0x12,0x0b,0xa3,0x82,0x39,0xff,0x0a,0x01,0xa0,0x08,0x98,0x10,0x19,0x01,0xe4,0x54,
+0x2b,0xd3,0x23,0x4a,0x02,0x91,0x21,0x20,0x52,0x17,0x10,0x13,0x30,0x43,0xd8,0x12,
+0x88,0x8d,0xc9,0xa8,0xea,0x9c,0x99,0x56,0x81,0xba,0x09,0x00,0x32,0xca,0x02,0xbf,
+0xbe,0xcd,0x99,0x0c,0x00,0x80,0x10,0xa0,0x89,0x8a,0x99,0xc0,0x99,0xdc,0x9c,0xca,
+0x0b,0x91,0x08,0x11,0x9b,0x81,0xaa,0x63,0x36,0x21,0x02,0xda,0xad,0xbb,0x0b,0x10,
+0x52,0x43,0x01,0x89,0x11,0x41,0x11,0xa8,0x40,0xdb,0xca,0x29,0x01,0x05,0x30,0x00,
+0xc8,0x18,0x66,0x12,0x35,0x22,0x23,0x01,0x31,0x99,0x12,0xea,0x30,0x21,0x35,0x52,
+0x45,0x12,0x31,0x81,0xa3,0x0e,0x91,0x3b,0x07,0xa8,0x0b,0xf1,0x29,0x90,0x98,0x03,
+0x9f,0x80,0x10,0x18,0x83,0xb8,0x8f,0xb8,0xae,0xa8,0x8c,0x18,0x80,0x1b,0xc0,0xbb,
+0x19,0xca,0xba,0xdd,0xac,0xba,0xaa,0xad,0xba,0xcc,0x9b,0xbb,0x89,0xab,0x18,0x92,
+0x23,0xae,0x20,0x80,0x43,0x77,0x53,0x22,0x22,0x22,0x21,0x10,0x27,0x51,0x13,0x34,
+0x33,0x32,0x13,0x42,0x31,0x42,0x24,0x42,0x23,0x21,0x41,0x84,0x28,0x00,0xc9,0xba,
+0xbe,0xbb,0x9b,0xa8,0xba,0xbd,0xbe,0xbc,0xad,0xbb,0xbb,0xa9,0xca,0x9b,0xbd,0xdb,
+0xbb,0xbc,0xda,0xaa,0xaa,0x9a,0x99,0x80,0x9a,0x98,0x8a,0x90,0x2b,0xa0,0x8a,0x92,
+0x76,0x45,0x33,0x34,0x23,0x63,0x01,0x01,0x42,0x53,0x35,0x34,0x33,0x11,0x01,0x22,
+0x33,0x36,0x14,0x10,0x18,0x91,0x62,0x34,0x14,0x11,0xa8,0x99,0xb9,0x19,0x23,0x8a,
+0xb4,0xef,0xab,0xbb,0xac,0x98,0xa9,0x99,0xfb,0xac,0xba,0xaa,0xaa,0xbd,0xca,0xbc,
+0xbc,0xcb,0xba,0xa9,0xb9,0xaa,0xaa,0xae,0xaa,0xb8,0x3a,0xa1,0x80,0xa8,0x8d,0x08,
+0x8b,0x36,0x35,0x34,0x35,0x33,0x24,0x33,0x27,0x43,0x33,0x25,0x23,0x21,0x22,0x24,
+0x51,0x43,0x43,0x32,0x23,0x33,0x13,0x12,0x10,0x22,0x34,0x11,0xd0,0x9c,0xcd,0xaa,
+0x08,0xa0,0x8a,0xde,0xcb,0xab,0x9c,0xba,0xba,0xcd,0xbc,0xcc,0xa9,0xaa,0x9a,0xa9,
+0xbb,0xbc,0xdb,0xab,0x9c,0xab,0xcb,0xbb,0xba,0xbb,0xac,0xea,0xab,0x99,0xaa,0xa8,
+0xa8,0x2b,0xc9,0x42,0x46,0x44,0x25,0x22,0x34,0x44,0x43,0x44,0x33,0x43,0x32,0x33,
+0x53,0x43,0x33,0x32,0x23,0x00,0x08,0x28,0x36,0x45,0x43,0x12,0x81,0x80,0x89,0x09,
+0x98,0xea,0xbc,0xdc,0xbc,0xab,0xba,0xba,0xcb,0xcb,0xbb,0xbc,0xba,0xab,0xad,0xbc,
+0xcb,0xbc,0xbc,0xbb,0xcb,0xbb,0xaa,0x9a,0x89,0x31,0x21,0x32,0x23,0x32,0x35,0x63,
+0x23,0x43,0x43,0x25,0x32,0x37,0x43,0x34,0x33,0x24,0x33,0x25,0x35,0x43,0x32,0x22,
+0x12,0x08,0x88,0x32,0x63,0x34,0x22,0x13,0x11,0x01,0x98,0x18,0x82,0xec,0xbc,0xfb,
+0xab,0xbb,0xdb,0xaa,0xcb,0xcc,0xbb,0xbb,0xbb,0xaa,0x9a,0xeb,0xda,0xbc,0xcb,0xba,
+0xaa,0xa9,0xaa,0xba,0xbb,0x9b,0x89,0x18,0x22,0x12,0x39,0x17,0x11,0x44,0x33,0x45,
+0x43,0x34,0x53,0x43,0x32,0x43,0x63,0x33,0x34,0x42,0x22,0x11,0x22,0x32,0x53,0x33,
+0x33,0x33,0x22,0x33,0x44,0x34,0x43,0x12,0xa9,0xa8,0xdc,0x9a,0xbb,0xbb,0xeb,0xcd,
+0xab,0xbd,0xba,0xbb,0xac,0xc9,0xcb,0xac,0xbb,0xac,0xba,0xcb,0xaa,0xbc,0xbc,0xba,
+0xdb,0xaa,0xbb,0x9a,0x99,0x8a,0xa8,0xaa,0xaf,0x80,0x10,0x31,0x11,0x10,0x02,0x20,
+0x74,0x44,0x73,0x33,0x33,0x64,0x34,0x43,0x44,0x43,0x32,0x22,0x43,0x22,0x32,0x24,
+0x13,0x00,0x80,0x08,0x20,0x74,0x33,0x33,0x24,0x80,0x88,0x80,0xaa,0xea,0xbd,0xdc,
+0xad,0xba,0xbb,0xbb,0xac,0xcb,0xbb,0xaa,0xcb,0xaa,0xaa,0xbc,0xcc,0xbb,0xbd,0xbb,
+0xcb,0xbb,0xbb,0xab,0x98,0x20,0x34,0x36,0x33,0x34,0x32,0x33,0x53,0x24,0x24,0x23,
+0x33,0x53,0x34,0x35,0x44,0x32,0x44,0x22,0x43,0x24,0x22,0x23,0x11,0x80,0x89,0x89,
+0x08,0x42,0x22,0x24,0x42,0x01,0x00,0x13,0xac,0xb9,0xdf,0xbd,0xcb,0xad,0xba,0xbb,
+0xbb,0xbd,0xac,0xba,0xab,0x98,0x89,0xa0,0xeb,0xbb,0xcd,0xaa,0xbb,0xba,0xab,0xdb,
+0x89,0x08,0x22,0x34,0x35,0x43,0x32,0x24,0x22,0x33,0x33,0x11,0x53,0x42,0x34,0x44,
+0x33,0x35,0x44,0x43,0x33,0x53,0x12,0x22,0x11,0x01,0x10,0x10,0x00,0x00,0x89,0x01,
+0x31,0x57,0x31,0x14,0x81,0xa9,0xeb,0xbc,0xac,0xbc,0xcb,0xbc,0xbc,0xcb,0xab,0xa9,
+0xaa,0xaa,0xd9,0xab,0xbc,0xbb,0xdb,0xac,0xbb,0xcd,0x9b,0xba,0xba,0x9a,0x89,0x08,
+0x31,0x44,0x11,0x44,0x82,0x88,0x10,0x23,0xb9,0x38,0x37,0x12,0x72,0x35,0x34,0x34,
+0x43,0x44,0x43,0x33,0x44,0x53,0x23,0x21,0x22,0x23,0x11,0x32,0x23,0x81,0x00,0x00,
+0x41,0x46,0x13,0x43,0x11,0x90,0xbc,0xbb,0xfb,0xbc,0xbc,0xcd,0xbb,0xbc,0xbb,0xbc,
+0xba,0xba,0xbc,0xba,0xbb,0xbb,0xdb,0xbb,0xcc,0xcb,0xca,0xbb,0xaa,0xaa,0xa9,0x08,
+0x21,0x43,0x45,0x44,0x33,0x33,0x34,0x42,0x32,0x43,0x43,0x34,0x23,0x43,0x43,0x24,
+0x43,0x34,0x43,0x34,0x23,0x33,0x23,0x01,0x91,0x88,0x99,0xba,0xba,0x90,0x28,0x82,
+0x60,0x82,0xd0,0xbc,0xcf,0xbb,0xdb,0xcc,0xac,0xcb,0xbb,0xbb,0xcb,0xbb,0xbb,0xac,
+0xab,0x88,0x08,0xa9,0xbb,0xdc,0xbc,0xaa,0xbb,0xcb,0xab,0x99,0x28,0x45,0x63,0x33,
+0x34,0x24,0x33,0x33,0x34,0x33,0x11,0x22,0x34,0x53,0x33,0x53,0x43,0x34,0x53,0x33,
+0x35,0x33,0x22,0x23,0x12,0x01,0x99,0xa8,0xba,0xcb,0xcb,0x08,0x10,0x81,0x72,0x14,
+0xa8,0xca,0xdd,0xbc,0xbb,0xcc,0xcb,0xcb,0xbb,0xbc,0xaa,0xab,0xba,0xba,0xbc,0xbb,
+0xab,0x99,0xda,0xbd,0xdb,0xbc,0xbb,0x9b,0xbc,0xaa,0x08,0x43,0x32,0x45,0x33,0x53,
+0x12,0x21,0x32,0x13,0x00,0x99,0x65,0x13,0x10,0x55,0x12,0x31,0x54,0x43,0x43,0x34,
+0x34,0x43,0x34,0x12,0x22,0x24,0x00,0x10,0x32,0x81,0x99,0x18,0xa9,0x19,0x47,0x22,
+0x31,0x82,0xbc,0xad,0xba,0xdd,0xcb,0xcb,0xdc,0xba,0xbb,0xcb,0xab,0xaa,0xbb,0xac,
+0xaa,0xba,0xbb,0xaa,0xcc,0xcb,0xca,0xbc,0xba,0xaa,0xaa,0x89,0x21,0x22,0x55,0x44,
+0x34,0x43,0x24,0x23,0x23,0x43,0x23,0x34,0x33,0x43,0x33,0x54,0x33,0x34,0x53,0x33,
+0x33,0x34,0x34,0x22,0x22,0x98,0xbb,0xba,0xcc,0x9a,0x89,0xa8,0x0c,0x81,0x9a,0x0a,
+0xe2,0xbf,0xba,0xdc,0xbc,0xbc,0xcb,0xcb,0xbb,0xaa,0xbc,0xa9,0xcb,0x8a,0x09,0x00,
+0x01,0x88,0xa9,0xbe,0x9b,0xca,0x9b,0xaa,0xac,0x88,0x50,0x35,0x44,0x34,0x43,0x32,
+0x33,0x34,0x22,0x22,0x01,0x22,0x32,0x25,0x22,0x45,0x34,0x42,0x44,0x43,0x33,0x32,
+0x23,0x12,0x11,0x02,0xb9,0xca,0xbd,0xaa,0xbb,0x0a,0x88,0x01,0x48,0x91,0xb9,0xff,
+0xcb,0xbb,0xdc,0xbb,0xbc,0xbc,0xbd,0xab,0xaa,0x9b,0x9a,0xba,0xaa,0xba,0x09,0xb9,
+0xac,0xfc,0xac,0xbb,0xac,0x9b,0xba,0xaa,0x1a,0x32,0x45,0x35,0x53,0x12,0x32,0x31,
+0x33,0x22,0x12,0x10,0x35,0x81,0x62,0x54,0x31,0x24,0x44,0x44,0x34,0x43,0x34,0x43,
+0x23,0x22,0x43,0x11,0x11,0x12,0x00,0xa8,0x9b,0xaa,0x09,0x73,0x24,0x62,0x12,0x89,
+0x98,0xba,0xdc,0xcb,0xcc,0xcc,0xbb,0xbc,0xbb,0xcb,0xaa,0xbb,0xcb,0xaa,0xa9,0xaa,
+0xa9,0xba,0xcc,0xcb,0xbc,0xbb,0xbb,0xcc,0xaa,0x99,0x88,0x41,0x54,0x34,0x33,0x35,
+0x33,0x34,0x33,0x34,0x23,0x24,0x12,0x23,0x34,0x33,0x37,0x24,0x53,0x33,0x43,0x33,
+0x33,0x24,0x01,0x90,0x88,0xaa,0xba,0x9b,0xa0,0xad,0x99,0x88,0x20,0x24,0xfb,0x8a,
+0xcc,0xdd,0xbb,0xdb,0xcb,0xbb,0xbc,0xbc,0xbb,0xcb,0xaa,0x89,0x88,0x80,0x08,0xb8,
+0xab,0xb9,0xaf,0xcb,0xba,0xcc,0xbb,0x89,0x88,0x20,0x35,0x44,0x43,0x24,0x25,0x32,
+0x23,0x22,0x33,0x31,0x23,0x23,0x61,0x23,0x43,0x46,0x43,0x24,0x43,0x33,0x33,0x34,
+0x22,0x21,0x01,0x99,0xc8,0x9a,0x9a,0xab,0x99,0x9a,0x18,0xa2,0xbf,0x9a,0xbb,0xfc,
+0xcb,0xcd,0xdb,0xcb,0xbb,0xbc,0xac,0xaa,0xac,0x9b,0xaa,0x9a,0x88,0x99,0xba,0x9d,
+0xcb,0xcc,0xab,0xbb,0xac,0xab,0xab,0x10,0x28,0x34,0x34,0x54,0x43,0x32,0x24,0x22,
+0x32,0x32,0x42,0x21,0x42,0x15,0x41,0x43,0x35,0x43,0x44,0x24,0x43,0x34,0x33,0x34,
+0x33,0x24,0x13,0x43,0x21,0x22,0x81,0x89,0x90,0x89,0x31,0x21,0x36,0x13,0x10,0xa8,
+0xb9,0xfb,0xaf,0xbc,0xbe,0xbc,0xbc,0xcb,0xab,0xac,0xbb,0xcb,0xab,0xbb,0xbb,0xbb,
+0xcb,0xbb,0xdb,0xab,0xaa,0xdb,0xaa,0xbb,0xcb,0xbb,0x9c,0x09,0x20,0x53,0x52,0x44,
+0x33,0x35,0x33,0x34,0x24,0x32,0x34,0x33,0x43,0x33,0x35,0x33,0x44,0x33,0x43,0x43,
+0x23,0x13,0x34,0x32,0x22,0x43,0x22,0x23,0x13,0x10,0xa0,0x20,0xc8,0xbc,0xab,0xbf,
+0xcd,0xbb,0xcb,0xcb,0xbb,0xcc,0xcb,0xca,0xcb,0xab,0xbb,0xcb,0xbb,0xbc,0xcb,0xcb,
+0xab,0xab,0xba,0xab,0xad,0xcb,0xba,0xab,0x9b,0x9a,0xa0,0xbb,0x18,0x28,0x27,0x35,
+0x43,0x73,0x23,0x34,0x53,0x33,0x34,0x32,0x25,0x33,0x33,0x53,0x23,0x34,0x32,0x24,
+0x33,0x44,0x22,0x11,0x32,0x11,0x00,0x31,0x80,0x88,0xb9,0xdf,0xca,0xba,0xcb,0xba,
+0xcb,0xbc,0xac,0xbb,0xbc,0xac,0xba,0xcc,0xcb,0xbb,0xbc,0xcb,0xbb,0xba,0xad,0xa9,
+0xcb,0xba,0xa9,0x9b,0xba,0x99,0xaa,0xaa,0x9a,0x9a,0xc8,0x19,0xbc,0x41,0x42,0x02,
+0x47,0x21,0x33,0x37,0x43,0x22,0x42,0x13,0x53,0x53,0x12,0x24,0x32,0x33,0x53,0x33,
+0x35,0x53,0x33,0x34,0x43,0x32,0x34,0x23,0x32,0x22,0x21,0x53,0x12,0x41,0x81,0x22,
+0x00,0x13,0x99,0x91,0xbd,0xbc,0xda,0xbd,0xcb,0xbc,0xbc,0xbe,0xba,0xae,0xaa,0xc9,
+0xaa,0xba,0x9b,0xab,0xaa,0xcb,0x99,0xbc,0xcb,0x9a,0xbc,0xbb,0xaa,0xbc,0x8a,0x04,
+0x81,0x62,0x22,0x25,0x24,0x53,0x32,0x34,0x15,0x32,0x23,0x24,0x31,0x33,0x53,0x42,
+0x22,0x22,0x35,0x53,0x32,0x33,0x25,0x31,0x22,0x02,0x81,0x89,0xba,0xfa,0xac,0xca,
+0x9a,0x9c,0xb8,0xaa,0xbb,0x9a,0xbe,0xa9,0xca,0xaf,0xb9,0xbc,0xac,0xbb,0xcb,0xac,
+0x9a,0xbb,0xaa,0xda,0x99,0xab,0xa9,0xc9,0x9b,0xc8,0xbb,0xac,0xcb,0xdb,0xba,0x9b,
+0x08,0xa0,0x16,0x09,0x34,0x33,0x51,0x46,0x12,0x23,0x03,0x22,0x78,0x02,0x03,0x61,
+0x88,0x11,0x00,0x12,0x23,0x43,0x53,0x20,0x83,0x41,0x23,0x01,0x29,0x10,0x07,0xa9,
+0xaa,0x88,0x9e,0x98,0x89,0x51,0xe8,0x9a,0x9a,0xab,0xeb,0x90,0xab,0xbc,0xda,0x9c,
+0xa0,0x8a,0x8a,0xda,0x01,0x0b,0xbb,0xb3,0xc8,0x1f,0xc0,0x10,0xa9,0x29,0x00,0x86,
+0xa8,0x30,0x8a,0xcb,0xa2,0xd0,0x79,0x0b,0x85,0x40,0x23,0x40,0xa1,0x29,0x92,0xaa,
+0x42,0x9d,0x84,0x8a,0x80,0x48,0x80,0xea,0x81,0x30,0x9e,0xa8,0xc0,0x1a,0x9c,0x90,
+0x10,0x1f,0x84,0x80,0x73,0x82,0x31,0x51,0x13,0x00,0x48,0x14,0x31,0x81,0x16,0x18,
+0x31,0x35,0x23,0x14,0x50,0x13,0x32,0x13,0x89,0x11,0xb0,0xa8,0x29,0xca,0xba,0x17,
+0x79,0x90,0x08,0x04,0x80,0x18,0x8f,0x23,0xa1,0x90,0x1e,0x81,0xa9,0x81,0x9c,0x9a,
+0x30,0x11,0x05,0x47,0x12,0x12,0x24,0x92,0x42,0x28,0x92,0x11,0x20,0x58,0x26,0x14,
+0x0a,0x04,0x20,0x39,0x34,0xd8,0x43,0xae,0x99,0x99,0xeb,0xa9,0x9e,0xa9,0xa9,0xaa,
+0xbb,0x9c,0xe9,0x98,0x9a,0xa9,0xb9,0xbb,0xaf,0xca,0xaa,0x8b,0xbb,0xda,0x0a,0xaa,
+0xc8,0x40,0xb0,0x01,0x36,0x80,0x22,0x82,0x09,0x51,0x81,0xc0,0x1b,0x08,0xe8,0xad,
+0x98,0xba,0x13,0x8d,0x24,0x98,0x80,0xf8,0x28,0x8d,0xd0,0xb9,0x1b,0xc9,0x88,0xca,
+0x9c,0xb8,0x18,0x81,0xa8,0x18,0x0c,0xc1,0xa3,0x59,0x5a,0xa0,0x17,0x00,0x08,0x21,
+0x71,0x04,0x41,0x33,0x26,0x10,0x21,0x22,0x13,0x22,0x40,0x21,0xb1,0x05,0x60,0x11,
+0x89,0x14,0x13,0x70,0x00,0x14,0x81,0x32,0x08,0x88,0xb3,0x0c,0xeb,0xa9,0xcb,0x9e,
+0x90,0x0a,0xb8,0x8a,0xaa,0xb9,0x46,0xab,0xb0,0xcb,0xbd,0xbc,0xbd,0xca,0xdb,0x9c,
+0xab,0xda,0x89,0x89,0x88,0x99,0x98,0xbb,0x02,0xad,0x98,0xeb,0x8a,0xa9,0x10,0x48,
+0x98,0x37,0x58,0x32,0x35,0x34,0x32,0x43,0x24,0x42,0x33,0x23,0x25,0x20,0x24,0x41,
+0x22,0x34,0x33,0x34,0x32,0x26,0x31,0x23,0x12,0x41,0x00,0xa0,0xaa,0x90,0x99,0x1c,
+0xfa,0x91,0xaa,0x9a,0x8f,0x88,0xc1,0x99,0x99,0xaa,0xdc,0xac,0xca,0xcb,0x9a,0xbb,
+0xb1,0x9c,0x9a,0xa0,0x90,0x2a,0xbc,0x07,0x22,0x1b,0x93,0xda,0xa0,0x0d,0xb1,0x8c,
+0xb9,0x19,0x8a,0xf2,0x58,0x41,0x91,0x08,0x32,0x01,0xb9,0x00,0x32,0x34,0xb3,0xef,
+0x90,0x00,0x08,0x00,0x31,0x56,0x23,0x09,0x24,0x10,0x02,0x09,0xf1,0xeb,0x8b,0xd9,
+0x98,0xaa,0xca,0x18,0xc9,0x81,0x19,0xa8,0xb9,0xbc,0xd9,0xbd,0xac,0xf9,0x99,0xab,
+0xcc,0xab,0x9a,0xb8,0xac,0xa9,0x0d,0x98,0xb2,0x0d,0xa9,0x9a,0xa9,0xfb,0x8b,0xba,
+0x90,0x99,0x10,0x33,0x89,0x55,0x21,0x44,0x54,0x14,0x23,0x38,0x04,0x01,0x20,0x15,
+0x31,0x44,0x32,0x43,0x35,0x21,0x50,0x03,0x42,0x21,0x31,0x13,0x00,0x82,0x21,0x99,
+0x58,0xf1,0x30,0x82,0x41,0x00,0xa1,0x25,0x08,0x0c,0xf9,0x98,0x99,0xbd,0xbb,0xca,
+0x9a,0xae,0x98,0xb8,0x9f,0x99,0x88,0x99,0xb0,0x9a,0x8c,0xeb,0xaa,0xb9,0xad,0x9a,
+0xbb,0xfb,0x89,0x99,0xc0,0x8b,0x81,0x01,0x89,0x00,0x82,0xdd,0x30,0xa1,0x0c,0x86,
+0x28,0x11,0x41,0x27,0x21,0x10,0x22,0x55,0x22,0x24,0x11,0x73,0x12,0x13,0x13,0x42,
+0x21,0x32,0x27,0x30,0x13,0x31,0x43,0x41,0xa3,0x43,0x31,0x08,0x93,0x9b,0x88,0xb8,
+0xdb,0xbe,0xac,0xba,0xba,0xbf,0x8a,0x98,0xbd,0xa9,0xbb,0xfa,0x09,0xb9,0xbb,0xaa,
+0xac,0x9c,0xd9,0x89,0xab,0x21,0x08,0x89,0x53,0x49,0x01,0x15,0x38,0x17,0x38,0x14,
+0x33,0x02,0x02,0x56,0x11,0x30,0x15,0x01,0x31,0x34,0x11,0x09,0x13,0x32,0x19,0x00,
+0xfb,0x29,0xbc,0x92,0x19,0x2c,0xda,0xf8,0x08,0xac,0xb9,0xb9,0x8d,0xea,0x0a,0xba,
+0x9b,0xe9,0xaa,0x0a,0xac,0xa8,0xb9,0x09,0xac,0x9c,0xb9,0xbc,0xba,0xcb,0xcb,0x90,
+0xbf,0xbb,0xb0,0x9c,0x09,0xc8,0xa9,0x9e,0x81,0xaa,0xca,0x0b,0xc9,0xe9,0x1a,0x09,
+0x81,0x13,0x63,0x0a,0x24,0x90,0x04,0x48,0x23,0x12,0x43,0x07,0x29,0x33,0x42,0x33,
+0x53,0x62,0x22,0x14,0x32,0x11,0x43,0x03,0x21,0x69,0x11,0x94,0x40,0x11,0x00,0x38,
+0x08,0xa3,0x01,0x72,0x82,0x09,0xf0,0x01,0x0c,0xa8,0x9a,0xc3,0x8b,0xaf,0x90,0x8c,
+0x88,0xea,0x9b,0x8b,0xb9,0xba,0xcb,0xbd,0x99,0x90,0xa9,0x98,0x8c,0xa3,0x1f,0x90,
+0x22,0x81,0xeb,0x0b,0x10,0xb1,0xea,0x78,0xb0,0x18,0x90,0x5a,0x02,0x00,0x85,0x59,
+0x18,0xb2,0x82,0x0a,0xab,0x12,0x08,0x61,0x87,0x80,0x61,0x09,0x83,0x32,0xaa,0x51,
+0x89,0xc0,0x51,0x11,0x00,0x14,0x91,0x51,0x11,0x2b,0x86,0x10,0x52,0x11,0x92,0x50,
+0x00,0x25,0x29,0x91,0x98,0x10,0x53,0x30,0x84,0x52,0x8b,0x92,0x11,0x32,0x9a,0x16,
+0x34,0x25,0x0a,0x53,0x86,0x2a,0x12,0x28,0x03,0x20,0x94,0x0d,0xc2,0x51,0x88,0xa1,
+0x51,0x08,0x22,0x12,0x46,0x80,0x21,0x04,0x31,0x0b,0x84,0x04,0x4c,0xa9,0xa3,0x3b,
+0xa1,0x8c,0x91,0x2a,0xbc,0x02,0x4d,0xf1,0x9d,0x99,0xc9,0x9a,0xca,0xa8,0xad,0xaa,
+0x80,0x9d,0xd9,0x98,0x9b,0x9c,0xc9,0x9a,0xbc,0xaa,0xbc,0x9a,0xa9,0xe1,0xac,0x09,
+0xa8,0x91,0x09,0xd9,0x38,0x83,0x83,0x9d,0x38,0xa2,0x71,0xc9,0x22,0x38,0x0a,0xa5,
+0x32,0x62,0x10,0xd4,0x51,0x08,0x02,0x01,0x21,0x2b,0x80,0xb3,0x2c,0x31,0xe0,0x09,
+0x87,0x20,0x99,0x88,0xb8,0x94,0x8f,0x20,0x90,0xa0,0xaa,0x38,0xcc,0x24,0x9a,0x8a,
+0x22,0x18,0x48,0xfa,0x83,0x78,0x90,0x01,0x89,0xb8,0x53,0x11,0x20,0x23,0x16,0x61,
+0x89,0x01,0x22,0x52,0x00,0x22,0x35,0x08,0x98,0x38,0x27,0x1a,0x28,0x20,0x05,0x81,
+0x2a,0x38,0x15,0xe9,0x09,0xa0,0x51,0xa9,0x21,0xae,0xdb,0xca,0x88,0x09,0x9c,0xf3,
+0x0a,0x88,0xb8,0xdb,0x8a,0x9a,0xea,0x11,0x2b,0xb8,0xf0,0x9a,0x18,0xa9,0xab,0xfb,
+0xa8,0x2a,0xc9,0x98,0xca,0x31,0x0c,0xd9,0x24,0x28,0x01,0x83,0x51,0x32,0x41,0x16,
+0x32,0x03,0x32,0x56,0x10,0x22,0x34,0x32,0x01,0x51,0x23,0x25,0x23,0x80,0x52,0x13,
+0x19,0x15,0x41,0x23,0x18,0x80,0x15,0x0a,0x28,0x83,0x80,0x21,0xc2,0x6a,0x98,0x94,
+0x8c,0x91,0x8a,0x9f,0x10,0xdb,0x88,0x09,0x99,0xfb,0xdb,0x18,0xa8,0x0a,0x98,0x9a,
+0x0d,0xb9,0xe0,0x98,0x3a,0xc8,0xab,0xaa,0xb8,0x9f,0x99,0x9d,0x83,0x88,0x20,0x8d,
+0x04,0x0a,0x08,0xb8,0x22,0x30,0x9f,0xb5,0x4c,0x08,0x84,0x38,0x02,0xb9,0x49,0x35,
+0x80,0x01,0x81,0x8c,0x29,0xf3,0x00,0x08,0x8c,0xa0,0xf8,0x3b,0xc9,0xa3,0x09,0xab,
+0x8b,0xa6,0x9b,0x98,0xfc,0x8c,0x90,0xa8,0x9b,0xdc,0x8b,0xd9,0x08,0x8a,0xa8,0xa9,
+0xa9,0xbc,0x10,0xbf,0xc2,0x9b,0x2a,0xf9,0x8a,0x28,0x20,0xc3,0x40,0x09,0x01,0xa1,
+0x29,0x56,0x01,0x1a,0x24,0xa0,0x31,0x54,0x31,0x30,0x86,0x42,0x2a,0x14,0x01,0x40,
+0x40,0x93,0x31,0x20,0x9a,0x95,0x39,0x00,0x52,0xca,0x00,0x9a,0x28,0x03,0x7b,0x88,
+0xe4,0x09,0x19,0xac,0xbc,0xa2,0x0c,0x30,0xed,0x11,0x99,0xa9,0x99,0x0b,0xb0,0xc8,
+0x08,0x8f,0x81,0x75,0x86,0x00,0x11,0x32,0xed,0x18,0x98,0x09,0x80,0x98,0x08,0x8a,
+0x28,0x80,0x10,0x32,0x23,0xba,0x65,0x98,0x98,0x79,0xc3,0x0a,0x55,0x20,0xe1,0x18,
+0x33,0xbc,0x88,0x80,0xb0,0x9f,0x80,0xb9,0x8a,0xaa,0x9c,0xba,0x89,0xc8,0x18,0x8a,
+0xc2,0x9b,0x31,0x9c,0xca,0xbd,0x32,0x08,0x51,0x54,0x34,0x12,0x46,0x22,0x32,0x43,
+0x13,0x32,0x21,0x21,0x15,0x10,0x33,0x09,0x27,0x20,0x21,0x14,0x50,0x12,0x32,0x52,
+0x05,0x10,0x00,0x89,0xa8,0x04,0xbf,0xe0,0x99,0xab,0x89,0xd0,0x0a,0xa0,0x09,0x83,
+0xab,0x80,0x9d,0xa9,0xaf,0xb0,0xac,0x9d,0x99,0xdc,0x88,0xa9,0x0a,0x81,0xc8,0x19,
+0x8a,0xa6,0x1a,0x98,0x01,0x08,0xbc,0x91,0x2c,0xf0,0x8b,0x00,0x11,0x2b,0x37,0x15,
+0x22,0x54,0x11,0x13,0x52,0x21,0x43,0x32,0x12,0x10,0x90,0x09,0xba,0x0b,0xb9,0x67,
+0x00,0xa8,0x50,0x82,0x32,0xa2,0x8a,0x0b,0xfa,0xcd,0xac,0x9b,0xd9,0x9b,0xc8,0x89,
+0xab,0xbb,0x88,0xc8,0x89,0x0a,0x81,0xfa,0x8e,0xba,0xba,0xbb,0xca,0x9d,0x98,0x0b,
+0xc0,0x39,0x33,0x21,0x16,0x63,0x21,0x02,0x41,0xb8,0x01,0x18,0x09,0x51,0x02,0x49,
+0x14,0x25,0x44,0x21,0x44,0x12,0x12,0x10,0x33,0xc9,0x23,0x9d,0x98,0x80,0x29,0x09,
+0x35,0x93,0x55,0x18,0x83,0x39,0x07,0x09,0xa9,0xc8,0xcb,0xb9,0x8d,0xc8,0x89,0xb8,
+0xcb,0x8c,0xc9,0xbb,0xbb,0xeb,0xaa,0x09,0xfb,0xba,0xbd,0xda,0xdb,0xbb,0xab,0xdb,
+0x9b,0x99,0x99,0x1a,0x80,0x00,0xb0,0x8e,0x38,0x57,0x42,0x54,0x24,0x24,0x33,0x53,
+0x22,0x33,0x43,0x22,0x81,0x08,0xa9,0x9a,0x20,0x45,0x54,0x32,0x21,0x23,0x01,0x80,
+0x80,0xba,0xde,0xbc,0xdb,0xcb,0xac,0xba,0xcb,0xbb,0xbb,0xca,0xaa,0x9a,0xa9,0x09,
+0xca,0x9a,0xbc,0xdb,0xbc,0xbd,0xbc,0xac,0xaa,0x99,0x11,0x43,0x44,0x42,0x32,0x32,
+0x24,0x32,0x43,0x22,0x12,0x12,0x53,0x53,0x63,0x32,0x34,0x33,0x22,0x21,0x35,0x22,
+0x43,0x44,0x11,0x21,0x80,0x80,0x89,0xdb,0xeb,0x9a,0x99,0x9b,0x11,0x90,0x08,0xb8,
+0xce,0xdb,0xfb,0xbb,0xbd,0xbb,0xbc,0xba,0xaa,0x89,0x8a,0x98,0xa9,0xab,0xac,0xdb,
+0x99,0x80,0x89,0xba,0xbc,0xda,0xcb,0x8b,0x80,0x22,0x55,0x42,0x37,0x43,0x43,0x43,
+0x22,0x12,0x01,0x10,0x88,0x00,0x80,0x64,0x32,0x34,0x44,0x33,0x32,0x24,0x21,0x22,
+0x00,0xa9,0xba,0xac,0xac,0xcb,0xdb,0xa9,0xbb,0xbd,0xba,0xaa,0x98,0xbc,0x08,0xd8,
+0xce,0xcb,0xcc,0xcb,0xab,0xbb,0x9c,0xaa,0xa8,0x08,0x32,0x21,0x22,0x14,0xc9,0xbb,
+0xcc,0xbb,0xab,0xcb,0xba,0x2a,0x41,0x25,0x41,0x45,0x23,0x32,0x44,0x23,0x23,0x12,
+0x88,0xa9,0xba,0xcf,0x9a,0x00,0xa9,0x40,0x45,0x81,0x42,0x53,0x13,0x44,0x34,0x44,
+0x44,0x33,0x43,0x43,0x23,0x01,0x21,0xa8,0xbd,0xba,0xbc,0x9b,0x22,0x43,0x53,0x33,
+0x02,0x98,0xaa,0xbe,0xbd,0xdb,0xcc,0xbb,0xbc,0xbc,0xba,0xba,0xba,0xab,0xba,0xaa,
+0x98,0x28,0x33,0x32,0x03,0xfc,0xba,0xcd,0xbc,0x9a,0xa9,0x28,0x45,0x35,0x44,0x24,
+0x33,0x23,0x23,0x22,0x12,0x21,0x12,0x41,0x42,0x32,0x37,0x22,0x53,0x32,0x22,0x21,
+0x23,0x31,0x11,0x83,0xba,0xfa,0xbf,0xcc,0xcb,0xcb,0xba,0x9a,0x98,0x18,0x10,0x21,
+0x91,0xbd,0xeb,0xcc,0xcb,0xcb,0xab,0xaa,0xba,0x99,0x11,0x10,0x42,0x62,0x13,0x22,
+0x11,0x22,0x41,0x14,0x20,0x11,0xa8,0x9b,0xa9,0x19,0x77,0x53,0x32,0x35,0x24,0x13,
+0x12,0x98,0xa8,0xbb,0x9d,0x99,0x99,0x09,0x42,0x35,0x42,0x24,0x22,0x11,0x01,0x88,
+0x9a,0xe9,0xac,0xba,0xbd,0xcb,0xaa,0xbb,0x08,0x10,0x22,0x57,0x11,0x00,0xb9,0xcc,
+0xcb,0xdb,0xcb,0xbb,0xca,0xab,0x09,0x00,0x18,0x12,0x12,0x08,0x21,0xb0,0x01,0xa8,
+0xbf,0xcd,0xda,0x9a,0x98,0x9c,0x28,0x45,0x43,0x23,0x44,0x12,0x81,0x10,0xb9,0xca,
+0xac,0xab,0x08,0x34,0x62,0x21,0x14,0x23,0x80,0x80,0x89,0xfc,0xbb,0x99,0xac,0x88,
+0xb8,0x0e,0x20,0x26,0x64,0x35,0x44,0x33,0x33,0x24,0x12,0x00,0x80,0xc8,0xbc,0xbc,
+0xba,0x99,0x30,0x44,0x54,0x22,0x10,0x80,0xa9,0xeb,0xbb,0xdb,0xbc,0xbc,0xbb,0xad,
+0xba,0x9a,0x9a,0x99,0x00,0x01,0x31,0x44,0x11,0xa9,0xdb,0xcc,0xcb,0xab,0xab,0x09,
+0x22,0x45,0x37,0x43,0x43,0x23,0x23,0x12,0x02,0x00,0x18,0x00,0x21,0x42,0x32,0x45,
+0x33,0x35,0x34,0x34,0x13,0x12,0x01,0xa8,0xbc,0xeb,0xbc,0xdb,0xbc,0xab,0xdb,0xab,
+0x89,0x80,0x00,0x12,0x00,0xda,0xcb,0xbe,0xba,0xad,0xbb,0xab,0xab,0x89,0x00,0x21,
+0x53,0x43,0x24,0x73,0x22,0x11,0x12,0x02,0x39,0x82,0x11,0x40,0x03,0x50,0x22,0x36,
+0x44,0x23,0x43,0x12,0x00,0xab,0xcc,0xba,0xab,0xab,0x89,0x08,0x9a,0x00,0x53,0x24,
+0x22,0x11,0xd0,0x88,0xbe,0xaa,0xac,0xad,0xa9,0x9b,0x28,0x03,0x52,0x35,0x62,0x01,
+0x32,0x01,0xc9,0xbb,0xfb,0xab,0xaa,0x09,0x88,0x80,0xea,0x89,0xc9,0xcb,0x9a,0xec,
+0xaa,0xbb,0x89,0x98,0x9a,0x88,0x89,0xab,0x0a,0xbb,0xa8,0x1d,0x81,0xb9,0x33,0xff,
+0x41,0x80,0x88,0x51,0x26,0x88,0x08,0x04,0x10,0x42,0x32,0x06,0xab,0x9c,0x02,0x8c,
+0x89,0x62,0x13,0x90,0xaa,0x1a,0xa4,0xdd,0x1a,0x03,0x91,0x2e,0x65,0x34,0x44,0x44,
+0x23,0x32,0x21,0x01,0x21,0x21,0xc8,0xba,0x9c,0xdb,0x8a,0x31,0x54,0x02,0x12,0x98,
+0xab,0xfa,0xac,0xba,0xdb,0xdc,0xbb,0xbb,0xbc,0xab,0xa8,0x8a,0x88,0x89,0x98,0x10,
+0x81,0x0c,0xd0,0xab,0xbd,0xac,0x09,0x20,0x34,0x74,0x33,0x45,0x32,0x43,0x33,0x13,
+0x13,0x02,0x13,0x22,0x32,0x53,0x23,0x44,0x33,0x44,0x24,0x33,0x23,0x13,0x99,0xca,
+0xcd,0xcb,0xba,0xcc,0xba,0xda,0xbc,0xab,0xbb,0x99,0x0a,0xa1,0xa9,0xdb,0xbd,0xca,
+0xba,0xac,0xcb,0x8a,0xaa,0x89,0x51,0x12,0x33,0x35,0x44,0x23,0x35,0x21,0x11,0x22,
+0x21,0x33,0x45,0x22,0x23,0x21,0x13,0x71,0x11,0x21,0x33,0x12,0xba,0xce,0xdb,0x9c,
+0xaa,0x9a,0x9b,0x98,0xac,0x90,0x0b,0x80,0x00,0xdb,0xda,0xae,0x89,0x98,0x9a,0x14,
+0x30,0x15,0x34,0x11,0x41,0x93,0x39,0x23,0x61,0x84,0x41,0x00,0x08,0x90,0x9a,0x89,
+0x01,0xbb,0xbb,0xff,0xca,0x9d,0xa9,0xac,0xcc,0x9a,0xba,0x99,0x99,0x08,0x18,0x01,
+0xb8,0x9e,0xa0,0x8d,0x9b,0x93,0x0c,0x02,0x5a,0x25,0x51,0x03,0x40,0x44,0x91,0x89,
+0x12,0x89,0x9a,0x44,0x31,0x22,0x27,0x01,0x43,0xa0,0x08,0x83,0xbe,0xfb,0xa9,0xaa,
+0xba,0x8c,0x08,0x9a,0xd8,0x58,0x64,0x32,0x55,0x33,0x34,0x22,0x22,0x22,0x90,0x10,
+0x11,0xd8,0xcb,0x9a,0xda,0x28,0x35,0x62,0x13,0x81,0xaa,0xdb,0xbc,0xbb,0xac,0xdb,
+0xcb,0xcb,0xcb,0x9a,0x9a,0x88,0x08,0x00,0x88,0x88,0x99,0xb9,0xca,0xac,0xcc,0xba,
+0x8a,0x28,0x65,0x25,0x43,0x34,0x34,0x32,0x23,0x33,0x11,0x11,0x22,0x00,0x34,0x53,
+0x34,0x34,0x33,0x34,0x23,0x22,0x34,0x81,0xb8,0xdb,0xbe,0xcd,0xba,0xaa,0xbc,0xab,
+0xcc,0xbb,0xcb,0x99,0x99,0x90,0xa8,0x9a,0xfc,0x9a,0x99,0x89,0x99,0xb0,0x39,0xb1,
+0x39,0x76,0x11,0x34,0x33,0x44,0x22,0x14,0x21,0x21,0x14,0x21,0x21,0x00,0x81,0x01,
+0x21,0x00,0x50,0xd0,0x19,0xc9,0xad,0xcb,0xcb,0xab,0xcc,0xaa,0xbb,0xca,0xcc,0xab,
+0x98,0xa9,0x99,0x80,0x0a,0x21,0x26,0x42,0x24,0x33,0x9a,0x46,0x98,0x11,0x14,0x41,
+0x33,0x34,0x34,0x53,0x24,0x01,0x30,0x82,0x8a,0x11,0x24,0xcb,0xba,0xee,0x9a,0xbb,
+0xbd,0xba,0x9a,0xab,0x99,0x08,0x11,0xbd,0xba,0xee,0x9b,0xba,0xcb,0x89,0x99,0x88,
+0x01,0x31,0xa2,0x4c,0x93,0x22,0x75,0x02,0x01,0x10,0x33,0xa2,0x3a,0x57,0x10,0x81,
+0x51,0x13,0x98,0x53,0x80,0x21,0xc1,0xbd,0x99,0xc0,0x0b,0x28,0x24,0xaa,0x22,0xeb,
+0x39,0x45,0x44,0x55,0x43,0x22,0x31,0x12,0x12,0x31,0x32,0x34,0x91,0xcc,0xac,0x9a,
+0x8a,0x32,0x56,0x12,0x98,0xab,0xdc,0xbb,0xbb,0xbb,0xcc,0xcc,0xbc,0xcb,0xaa,0x9a,
+0x88,0x88,0x98,0xaa,0xab,0x9a,0x99,0xca,0xba,0x0b,0xe9,0x89,0x72,0x34,0x35,0x34,
+0x35,0x43,0x22,0x32,0x33,0x23,0x11,0x32,0x34,0x43,0x35,0x53,0x34,0x12,0x53,0x12,
+0x01,0x80,0xaa,0xeb,0xab,0xcb,0x9a,0xa8,0xcc,0xba,0xcd,0xcc,0x9a,0xa9,0x88,0x0a,
+0xa9,0xcb,0xbc,0xcb,0x9a,0x88,0x9a,0x18,0x90,0x3a,0x35,0x45,0x24,0x14,0x12,0x09,
+0x81,0x08,0x63,0x45,0x33,0x14,0x11,0x80,0x88,0x88,0x11,0x43,0x01,0x98,0xb8,0xba,
+0xcf,0xaa,0x99,0xbd,0xa8,0xad,0x9a,0x99,0xba,0x99,0x9c,0xfb,0xac,0xcb,0x9a,0x39,
+0x12,0x53,0x44,0x02,0x00,0x08,0x12,0x10,0x28,0x57,0x11,0x21,0x22,0x43,0x32,0x32,
+0x26,0x81,0x02,0x88,0x9b,0xa0,0x8b,0xf9,0xaf,0xca,0xba,0xcb,0x9d,0x88,0x98,0x9a,
+0x08,0xd8,0xcd,0x9b,0xa8,0xca,0x08,0x92,0x09,0x00,0x80,0x89,0x43,0x40,0x03,0x51,
+0x82,0x09,0x24,0x29,0x37,0x31,0x22,0x32,0xb8,0x0b,0x33,0xb0,0x74,0x77,0x80,0x00,
+0xa8,0xaa,0x09,0x10,0x9a,0x53,0x03,0x9d,0x22,0xc0,0xbe,0x8a,0x88,0x29,0x77,0x24,
+0x53,0x23,0x32,0x32,0x12,0x01,0x21,0x22,0xed,0xaa,0xb9,0xab,0x29,0x55,0x32,0x12,
+0x08,0xc9,0x9c,0xcb,0xac,0xaa,0xcd,0xcb,0xab,0xbb,0xbb,0x89,0x99,0x88,0x01,0xab,
+0x98,0x00,0xc9,0xdc,0xab,0xdc,0xab,0x08,0x51,0x44,0x24,0x53,0x24,0x32,0x23,0x33,
+0x22,0x01,0x00,0x30,0x12,0x36,0x44,0x43,0x43,0x23,0x33,0x43,0x12,0x88,0xa8,0xdb,
+0xbd,0xcb,0xbb,0xbc,0xa9,0xab,0xbb,0xca,0xcf,0xab,0xaa,0xca,0xaa,0xaa,0xda,0xbb,
+0xaa,0x1a,0x01,0x80,0x08,0x34,0x11,0x10,0x57,0x11,0x90,0x33,0x42,0x23,0x53,0x23,
+0x55,0x31,0x24,0x31,0x32,0x81,0x80,0x80,0x89,0xa9,0xbd,0xaa,0xaa,0xb8,0xbd,0x8a,
+0xdc,0xcb,0x9a,0xca,0xcd,0xbb,0xca,0xab,0x9d,0xa9,0x0a,0x02,0x43,0x44,0x53,0x02,
+0x01,0x31,0x00,0x9a,0x81,0x89,0x71,0x14,0x44,0x53,0x33,0x14,0x21,0x22,0xa8,0xaa,
+0x98,0x99,0xbd,0xdc,0xcb,0xac,0xb9,0xac,0x98,0xda,0x9b,0x89,0x99,0xca,0xab,0xcd,
+0xcc,0xba,0x99,0x08,0x00,0x11,0x44,0x24,0x90,0x52,0x92,0x8c,0x20,0x82,0x40,0x22,
+0x44,0x13,0x41,0x20,0x22,0xc1,0x0d,0x32,0x08,0x22,0x44,0x32,0xa8,0x8a,0x11,0xac,
+0xa8,0x71,0xa0,0x0a,0xe8,0x9b,0xda,0xbb,0xcd,0xca,0x09,0x42,0x54,0x36,0x34,0x22,
+0x13,0x02,0x00,0x08,0x23,0x43,0x12,0xb8,0x9a,0xfb,0x89,0x31,0x56,0x12,0x00,0x90,
+0xdb,0xcb,0xbc,0xbb,0xbd,0xbb,0xbd,0xbb,0xaa,0xac,0x88,0x99,0x89,0xcc,0xa9,0xbb,
+0xbc,0xea,0x9a,0x80,0x99,0x22,0x43,0x53,0x14,0x53,0x34,0x43,0x23,0x24,0x23,0x11,
+0x13,0x22,0x25,0x33,0x45,0x53,0x23,0x33,0x34,0x03,0x33,0x90,0x88,0x9b,0xfc,0x9a,
+0xaa,0xda,0x9a,0xaa,0x88,0xa8,0xcc,0xca,0xdd,0xac,0xab,0xa9,0x9a,0x88,0x89,0xa9,
+0xac,0x8b,0x91,0x9c,0xa8,0x28,0xb0,0x8a,0xab,0xd0,0x39,0x36,0x67,0x21,0x33,0x31,
+0x33,0x25,0x53,0x12,0x80,0x81,0xbb,0x9c,0xa9,0x41,0x53,0x22,0x24,0x11,0x90,0xb9,
+0xab,0xbf,0xdb,0xac,0xab,0xcc,0xaa,0x99,0x28,0x21,0x23,0x24,0x91,0x08,0xaf,0xca,
+0x89,0x9a,0x30,0x10,0x12,0x63,0x44,0x44,0x34,0x34,0x23,0x82,0x80,0xac,0xb8,0x9b,
+0x9b,0x22,0x9a,0x91,0x0d,0x98,0x98,0xda,0xba,0xfe,0xbd,0xbb,0xc9,0x9b,0x98,0x9a,
+0xaa,0xb9,0x99,0x4c,0x12,0xb0,0x9a,0x10,0x88,0xfb,0x0d,0x11,0x00,0x31,0x57,0x24,
+0x11,0x20,0x34,0x90,0x18,0x0a,0xba,0xf0,0x9b,0x51,0x12,0x13,0x56,0x03,0x89,0x30,
+0xc8,0xbc,0x89,0xaa,0xcc,0x08,0x08,0xba,0xb9,0x8c,0x11,0x31,0x73,0x77,0x13,0x20,
+0x22,0x04,0x81,0x19,0x16,0x22,0x32,0x33,0x05,0x98,0x99,0x88,0x41,0x80,0x52,0x81,
+0xba,0xcc,0xbb,0xeb,0xac,0xba,0xcc,0xbb,0xcc,0xab,0xba,0xbb,0xba,0xcc,0xaa,0xac,
+0xba,0xac,0x8a,0xb0,0x8c,0x11,0x11,0x33,0x22,0x57,0x32,0x53,0x43,0x43,0x33,0x32,
+0x34,0x23,0x43,0x63,0x32,0x43,0x24,0x21,0x33,0x13,0x23,0x42,0x82,0x31,0xb0,0xbc,
+0x9a,0xcc,0xbd,0xa9,0xac,0xcc,0xba,0xbc,0xbb,0xbc,0x9c,0xa9,0xca,0xbd,0xbb,0xdc,
+0x9c,0x8a,0x90,0x00,0x00,0x00,0xa9,0xb8,0x8a,0x29,0xb0,0x08,0x61,0x13,0x46,0x33,
+0x35,0x42,0x33,0x23,0x40,0x13,0x33,0x17,0x41,0x22,0x10,0x00,0xa9,0x09,0x81,0x49,
+0x27,0x21,0x01,0x89,0xe9,0x9b,0xbd,0xca,0x99,0x8a,0xab,0x22,0xc8,0x0b,0xda,0xaa,
+0xbb,0x0a,0xc9,0x32,0x36,0x20,0x17,0x11,0x98,0x40,0x93,0x0a,0x42,0x32,0x44,0x08,
+0x84,0x9b,0x33,0xdf,0x9b,0xa9,0x99,0x9c,0x09,0x83,0x9c,0xc9,0xad,0xbb,0xec,0xbc,
+0x89,0x80,0x98,0x50,0x12,0xa0,0x9c,0xc9,0x19,0x82,0x38,0x37,0x80,0x22,0x10,0x24,
+0x08,0x55,0x11,0x61,0x82,0x32,0x81,0x18,0x12,0xaa,0x81,0xad,0xa8,0xbd,0x39,0x35,
+0x23,0x23,0xe3,0x8c,0xba,0xbc,0xba,0x8a,0xec,0x9c,0x81,0xcc,0x08,0x90,0x88,0x99,
+0x09,0x92,0x8f,0x80,0x51,0x57,0x21,0x32,0x34,0x22,0x80,0x42,0x24,0x11,0x35,0x12,
+0x10,0x90,0x98,0x19,0x01,0x10,0x73,0x04,0xb9,0xab,0xe9,0xad,0xbb,0xcc,0xdb,0xba,
+0xcb,0xba,0x99,0xaa,0x9b,0xa9,0xeb,0xab,0xad,0xaa,0x99,0x08,0x10,0x23,0x24,0x18,
+0x45,0x43,0x25,0x43,0x33,0x43,0x22,0x34,0x22,0x53,0x32,0x43,0x34,0x32,0x34,0x32,
+0x34,0x14,0x11,0x01,0x00,0x08,0x98,0xeb,0xb9,0xcc,0x9d,0x98,0xb9,0xad,0x9a,0xcc,
+0xab,0xaa,0x98,0x9a,0xcc,0xfb,0xcb,0xba,0xab,0x88,0x30,0x20,0x91,0xa0,0xbd,0x89,
+0xeb,0xba,0x9a,0x9c,0x88,0x18,0x35,0x25,0x32,0x44,0x12,0x11,0x12,0x09,0x25,0x50,
+0x23,0x43,0x26,0x21,0x12,0x23,0x00,0x31,0x09,0x80,0x33,0xd0,0x9d,0xc8,0xaa,0x8e,
+0x33,0x02,0x21,0x40,0xa0,0xfa,0xac,0xad,0xbb,0xca,0x19,0x91,0x89,0x91,0x09,0x20,
+0xc2,0x70,0xa0,0x88,0xbe,0x08,0x99,0x88,0x0b,0x16,0x20,0xe0,0x8b,0x12,0x20,0x33,
+0x44,0x83,0xbf,0x9c,0xa0,0x09,0xa2,0x0c,0xa8,0xac,0x11,0x3b,0x13,0xf8,0x0a,0x98,
+0xba,0xae,0x80,0xa8,0x0f,0x25,0x21,0x33,0x83,0x8b,0x8a,0x31,0x86,0x71,0x23,0xa8,
+0x00,0x89,0x21,0x81,0x65,0xc9,0x99,0xc9,0x9c,0x18,0x12,0x34,0x43,0xc0,0x1b,0xd0,
+0x9e,0x89,0x88,0x89,0xb9,0x11,0x8b,0x22,0x16,0xcd,0x88,0xde,0x89,0x81,0x42,0x43,
+0x43,0x04,0x20,0x04,0x08,0x34,0x22,0x54,0x21,0x24,0x80,0x10,0xb8,0x99,0x88,0x20,
+0x45,0x43,0x22,0x90,0x8a,0xf9,0x9d,0xa9,0xc9,0xba,0xbc,0xab,0xdb,0x98,0xaa,0x8b,
+0xc9,0xbd,0xb9,0xbc,0xab,0xaa,0x99,0x8a,0xba,0xa9,0x9c,0x8a,0x53,0x25,0x74,0x22,
+0x23,0x13,0x32,0x32,0x22,0x26,0x42,0x42,0x44,0x33,0x33,0x26,0x32,0x32,0x23,0x91,
+0x30,0x81,0x11,0x22,0x87,0x10,0x8a,0xc9,0x8c,0xa0,0xad,0x99,0xfa,0xad,0xa9,0xbb,
+0xb9,0xbb,0xdb,0xcc,0xbc,0xbd,0xa9,0xa9,0x8a,0xb9,0xd9,0xca,0x9c,0xba,0x98,0x89,
+0x09,0x21,0x81,0x81,0x28,0x22,0x67,0x42,0x14,0x42,0x12,0x12,0x20,0x17,0x21,0x34,
+0x32,0x42,0x12,0x22,0x34,0x33,0x42,0x12,0x32,0x92,0x69,0x01,0x12,0x91,0xa8,0x8d,
+0xfb,0xcb,0x9a,0x99,0xac,0x8a,0xc8,0xab,0xeb,0xbb,0xcb,0xaa,0x9a,0x8b,0xa0,0xdc,
+0x9b,0xbb,0xac,0xb9,0x2c,0xc8,0x9a,0x81,0x9c,0x19,0x22,0x80,0x3b,0x87,0x9f,0x82,
+0x8a,0x88,0x52,0x32,0xaa,0x44,0x82,0x0c,0x80,0x42,0x20,0xb8,0x54,0x72,0x81,0x31,
+0x13,0x14,0x19,0x44,0xa0,0x98,0x89,0x41,0x82,0x50,0x15,0x33,0x98,0x8a,0x08,0xfb,
+0x8b,0x80,0x32,0xdf,0x88,0xaa,0x90,0xbb,0x32,0x09,0x96,0xac,0x90,0xcd,0xca,0xaa,
+0x9a,0x88,0xbc,0x09,0x9a,0x94,0x8e,0x81,0xc8,0xad,0x99,0x98,0x72,0x53,0x22,0x42,
+0x03,0x88,0x42,0x25,0x41,0x34,0x44,0x22,0x22,0x13,0x08,0x12,0xa0,0x29,0x37,0x01,
+0x22,0x43,0x82,0x8a,0xb3,0xcf,0xa9,0xcc,0xba,0xab,0xca,0xbc,0x9a,0xb9,0xad,0xda,
+0xac,0xba,0xbb,0xbb,0x9a,0x99,0xbc,0x9a,0xa8,0xab,0x8d,0x81,0x62,0x24,0x30,0x34,
+0x24,0x13,0x71,0x22,0x02,0x52,0x32,0x25,0x43,0x32,0x53,0x22,0x23,0x31,0x23,0x08,
+0x80,0x21,0x42,0x21,0x94,0x29,0x08,0xd0,0xad,0xa1,0xcf,0x99,0xc9,0xab,0xaa,0xae,
+0xca,0xac,0xdb,0xaa,0xa9,0xab,0x90,0x89,0x99,0xdc,0xca,0xcb,0x9a,0xb9,0x8a,0x11,
+0x00,0x22,0x40,0x21,0x47,0x21,0x42,0x22,0x23,0x01,0x53,0x53,0x24,0x24,0x42,0x23,
+0x42,0x21,0x33,0x33,0x01,0x24,0x08,0x12,0x8a,0x91,0x18,0x2d,0xb2,0x82,0xbf,0xdb,
+0xcc,0xbb,0xca,0xcb,0xcb,0xbb,0xba,0xae,0xa0,0x8c,0x99,0x98,0xaa,0xaa,0xae,0xba,
+0xcb,0x99,0xaa,0x1a,0x33,0x17,0x28,0x22,0x99,0x23,0x70,0x81,0x04,0x2b,0x92,0x21,
+0x12,0x66,0x14,0x01,0x81,0x09,0x8a,0x25,0x41,0x41,0x03,0x74,0x80,0x01,0x09,0x80,
+0x08,0x98,0x08,0xa1,0x0b,0x32,0x0d,0x24,0x86,0x9f,0xa0,0x9c,0x88,0x9c,0x11,0x10,
+0x30,0xfb,0x8b,0xd9,0xbb,0x9b,0x90,0x0a,0x10,0x67,0x88,0x08,0x98,0xcc,0x08,0x80,
+0xad,0x20,0x91,0x09,0x49,0x15,0xa9,0x18,0xc0,0xaf,0x81,0xac,0x31,0x26,0x33,0x72,
+0x13,0x90,0x20,0x32,0x21,0x56,0x24,0x23,0x33,0x24,0x00,0x09,0x82,0xbb,0x60,0x80,
+0x50,0x13,0x33,0x13,0x08,0xfc,0x9c,0x99,0xbc,0x9a,0xa9,0xda,0x9a,0xbb,0xdb,0xbb,
+0xbc,0xbb,0xac,0xdb,0x88,0xab,0xa9,0xbb,0xad,0xc9,0x9b,0x08,0x08,0x42,0x24,0x52,
+0x12,0x10,0x10,0x02,0x12,0x73,0x23,0x65,0x23,0x42,0x33,0x32,0x43,0x13,0x32,0x15,
+0x42,0x21,0x22,0x32,0x12,0x31,0x45,0xa0,0x31,0x00,0xc0,0x5a,0xd2,0x19,0xab,0xfb,
+0x9a,0x90,0x99,0x9b,0xc2,0xbf,0xce,0x99,0xab,0x9a,0x8a,0xb8,0x89,0xbc,0xbd,0xa9,
+0xcb,0xba,0x9a,0x9a,0xc9,0x8d,0x80,0xb0,0x61,0x02,0x28,0x83,0x21,0x8b,0x16,0x63,
+0x80,0x26,0x12,0x11,0x41,0x22,0x24,0x52,0x23,0x63,0x12,0x11,0x10,0x03,0xaa,0x10,
+0x33,0x33,0x46,0x43,0x03,0x18,0x91,0xcf,0x88,0xba,0x8b,0x98,0x08,0xc8,0x18,0xc9,
+0xdc,0xaa,0xce,0xa9,0xaa,0xaa,0xca,0x08,0xa9,0xad,0x91,0x8c,0xaa,0x99,0x0b,0xb9,
+0x09,0x9f,0x22,0xd9,0x19,0x34,0xaa,0x90,0x3a,0x14,0x70,0x13,0x91,0x30,0xb2,0x8f,
+0x23,0x44,0x14,0x52,0x24,0x08,0x80,0x98,0x30,0x01,0x44,0x31,0x26,0x10,0x00,0x14,
+0x82,0x51,0x18,0x92,0x13,0xfe,0x08,0x88,0xa9,0x10,0x11,0xd8,0xbb,0x89,0xcd,0xa9,
+0x98,0x9d,0x88,0xb9,0x8a,0xcc,0x88,0xbc,0x9a,0xb9,0x8e,0xb1,0x9d,0x18,0xfa,0xac,
+0x08,0x80,0xb9,0x70,0x02,0x89,0x33,0x21,0x55,0x14,0x00,0x43,0x01,0x52,0x41,0x26,
+0x12,0x52,0x12,0x00,0x11,0x11,0x10,0x63,0x02,0x20,0x32,0x88,0x30,0x13,0x18,0xb2,
+0xbd,0xff,0x99,0xb9,0xbb,0x9a,0xba,0xce,0x9a,0xbb,0xad,0xba,0xba,0xbb,0xcc,0xab,
+0xab,0xbc,0xbb,0xda,0x99,0xaa,0x9a,0x80,0x09,0x11,0x89,0x45,0x21,0x14,0x53,0x52,
+0x21,0x26,0x22,0x54,0x32,0x33,0x26,0x31,0x12,0x12,0x32,0x25,0x22,0x25,0x22,0x22,
+0x03,0x52,0x11,0x91,0x30,0x33,0x22,0x01,0xf8,0xad,0xec,0xac,0x9a,0xa9,0x89,0xa1,
+0x10,0xea,0xbb,0xcd,0xcb,0xab,0xbb,0xba,0x8b,0xad,0xa8,0x8a,0xbb,0x98,0xab,0xcb,
+0xcb,0xba,0xa9,0x9f,0x81,0x10,0x41,0x24,0x32,0x35,0x32,0x34,0x43,0x52,0x14,0x21,
+0x32,0x04,0x53,0x33,0x35,0x72,0x12,0x11,0x11,0x11,0x10,0x91,0x40,0x12,0x22,0x43,
+0x11,0x02,0x01,0x03,0x50,0xc9,0xfa,0xbc,0xda,0xaa,0xcb,0xaa,0xa9,0xaa,0xbb,0xab,
+0xca,0xbf,0xbb,0xcb,0xcd,0xaa,0xac,0xaa,0x99,0x18,0x81,0x09,0x91,0xd9,0x8b,0xd9,
+0x9d,0x90,0x08,0x10,0x34,0x27,0x21,0x34,0x23,0x02,0x28,0x04,0x10,0x46,0x01,0x41,
+0x17,0x20,0x12,0x33,0x01,0x20,0x85,0x00,0x38,0xa9,0x91,0x29,0x81,0x79,0x16,0x98,
+0x03,0x9b,0xbd,0x99,0xaa,0xcc,0x89,0xc9,0xae,0x99,0xba,0x9b,0x20,0x83,0xbe,0x19,
+0xfe,0x9a,0x80,0xac,0x0a,0x82,0xab,0xa9,0x08,0xdd,0x89,0x02,0x0b,0x64,0x02,0x88,
+0x43,0x03,0x0a,0x75,0x02,0x28,0x44,0x00,0x42,0x24,0x21,0x43,0x22,0x88,0x32,0x02,
+0x21,0x35,0x43,0x02,0x28,0x02,0xa8,0x53,0xcb,0x91,0x9b,0xdd,0xac,0xa9,0xbd,0x8b,
+0xc9,0xad,0xb9,0xbb,0xae,0x99,0xca,0xab,0xab,0xcb,0xac,0xaa,0xad,0x9a,0xa9,0x9a,
+0x90,0x0a,0xba,0x88,0xc9,0x9a,0x50,0x32,0x27,0x32,0x45,0x22,0x33,0x44,0x32,0x25,
+0x41,0x33,0x23,0x44,0x22,0x24,0x33,0x24,0x24,0x31,0x22,0x31,0x14,0x63,0x11,0x33,
+0x23,0x10,0x91,0xde,0xac,0x9a,0xaa,0x18,0x22,0x98,0xc1,0xcf,0xbb,0xac,0xbc,0xcb,
+0x9a,0xbb,0x9c,0xcb,0xa9,0xac,0xab,0xaa,0xcc,0xab,0xca,0xba,0xab,0xa8,0x08,0x10,
+0x90,0x40,0x00,0x04,0x60,0x24,0x43,0x63,0x01,0x34,0x32,0x42,0x35,0x33,0x53,0x33,
+0x33,0x33,0x34,0x34,0x21,0x23,0x26,0x31,0x34,0x42,0x21,0x21,0x23,0x20,0x10,0xfa,
+0xba,0xaa,0xaa,0x9e,0x88,0xd0,0x9d,0x98,0xdc,0x9a,0xac,0xba,0xba,0xba,0xaf,0xaa,
+0xbb,0xbb,0xab,0xc9,0x9d,0xb9,0xdb,0x9b,0x88,0xaa,0xb8,0x41,0x98,0x1a,0x12,0x02,
+0x35,0x73,0x11,0x03,0x44,0x42,0x34,0x24,0x50,0x33,0x11,0x52,0x33,0x04,0x22,0x43,
+0x42,0x24,0x32,0x21,0x32,0x94,0x38,0x22,0x80,0x03,0x52,0x22,0xa9,0x43,0xfc,0x09,
+0xe8,0xba,0xba,0x0e,0xb9,0xb9,0xaa,0xbc,0xad,0xba,0xbd,0xaa,0x98,0xac,0xba,0x8a,
+0xd9,0xad,0x00,0xbb,0x99,0x89,0xea,0x9b,0x08,0xb8,0x63,0x22,0x03,0x60,0x12,0x91,
+0x10,0x72,0x13,0x61,0x36,0x80,0x51,0x81,0x18,0x42,0x23,0x32,0x37,0x12,0x31,0x22,
+0x01,0x20,0x05,0x20,0x63,0x24,0x10,0x12,0x00,0xa0,0x0b,0xd3,0x9d,0x98,0xab,0xaa,
+0xab,0xfa,0xac,0xb9,0xbd,0xcb,0xba,0xbe,0x9b,0xaa,0xcb,0x9b,0xd9,0xab,0xab,0xfa,
+0x9a,0x99,0xa9,0x8a,0xb8,0x09,0xa9,0x8a,0xbc,0x02,0x42,0x3a,0x57,0x31,0x33,0x33,
+0x42,0x43,0x15,0x41,0x24,0x32,0x53,0x13,0x41,0x25,0x11,0x33,0x23,0x40,0x15,0x21,
+0x32,0x43,0x22,0x33,0x91,0xac,0xdc,0x8a,0x10,0x18,0x44,0x81,0xb8,0xbd,0xc9,0xbf,
+0x9a,0xbb,0x9a,0x99,0xd9,0xad,0x88,0xbc,0x9a,0xc9,0xca,0x9b,0xc9,0xcb,0x09,0xaa,
+0xa9,0x98,0xab,0xb8,0x0d,0xb3,0x1a,0x4c,0x04,0x18,0x12,0x19,0x10,0x14,0x66,0x42,
+0x43,0x23,0x22,0x34,0x11,0x14,0x41,0x22,0x54,0x12,0x43,0x33,0x11,0x31,0x34,0x81,
+0x41,0x00,0x12,0x24,0x80,0x39,0x05,0x01,0x8d,0xb0,0xda,0xab,0xac,0xd8,0x9b,0xf9,
+0x9c,0xb9,0xac,0x9a,0x9a,0xbb,0xac,0xad,0xb9,0xcb,0xbb,0xbd,0xaa,0xbb,0x9a,0xab,
+0xa1,0xaf,0x11,0xa8,0xca,0x30,0xb2,0x2c,0xb2,0x24,0x58,0x34,0x13,0x31,0x77,0x00,
+0x30,0x01,0x32,0x33,0x44,0x81,0x41,0x11,0x54,0x11,0x40,0x23,0x22,0x01,0x19,0x13,
+0x80,0x19,0xc2,0x39,0x41,0xa0,0x80,0x35,0x8d,0xb0,0x08,0xff,0x8a,0xb8,0xba,0x9d,
+0x9a,0xb8,0x0d,0x02,0xbf,0x00,0xba,0xab,0xad,0x08,0xdb,0x1b,0xa1,0xb9,0xa9,0x0d,
+0xe9,0x9b,0x23,0x9a,0x62,0xa1,0x21,0x31,0xa2,0x11,0x54,0x10,0x82,0x55,0x24,0x00,
+0x35,0x11,0x24,0x63,0x22,0x31,0x33,0x02,0x52,0x24,0x80,0x53,0x01,0x33,0x31,0x25,
+0x28,0x32,0x91,0x0a,0x82,0xac,0xb9,0xce,0x00,0xac,0x90,0xbd,0x89,0xdd,0xba,0xba,
+0xac,0xeb,0x99,0xba,0xac,0xaa,0xbc,0xcb,0xaa,0xbb,0x8a,0xbc,0xca,0xaa,0x8b,0xcd,
+0xba,0x19,0xa1,0x0a,0x40,0x93,0x19,0x16,0x29,0x43,0x21,0x25,0x52,0x43,0x12,0x64,
+0x12,0x23,0x43,0x43,0x33,0x32,0x15,0x20,0x23,0x08,0x36,0x33,0x62,0x14,0x11,0x10,
+0x02,0x0a,0x81,0x01,0x0b,0x00,0xda,0xda,0xa9,0xbb,0x9c,0xdc,0xca,0xc9,0xac,0xcb,
+0xab,0xdb,0x9a,0xba,0xbc,0xbb,0xcd,0x8a,0xba,0xa9,0xcb,0xdb,0x9a,0xca,0x9a,0x99,
+0xa9,0x08,0x31,0x80,0x11,0x42,0x82,0x45,0x32,0x63,0x13,0x33,0x62,0x36,0x13,0x42,
+0x33,0x32,0x35,0x24,0x20,0x42,0x24,0x13,0x72,0x11,0x11,0x12,0x32,0x21,0x42,0x94,
+0x1a,0x13,0xb1,0x0b,0x81,0xdc,0xa9,0x9a,0xde,0xbb,0x9b,0xad,0xb9,0xca,0xac,0x9d,
+0xb9,0xbb,0x9f,0xb9,0xbb,0x9a,0xa8,0xca,0xbb,0xba,0xbf,0x8b,0xbb,0xa8,0x29,0x80,
+0xac,0x52,0xc1,0x0b,0x42,0x32,0x90,0x63,0x32,0x80,0x66,0x81,0x40,0x22,0x14,0x21,
+0x34,0x10,0x42,0x33,0x11,0x45,0x34,0x22,0x32,0x13,0x21,0x30,0x12,0x00,0x84,0x73,
+0x22,0x24,0x99,0x10,0xf9,0x0c,0xba,0xa9,0xdb,0x09,0x99,0xb0,0x9d,0xcb,0x9c,0xd8,
+0x9d,0xaa,0xca,0xac,0x89,0x10,0x99,0x01,0xb8,0xdb,0xac,0xdd,0x9a,0xa9,0x89,0x21,
+0x22,0x11,0x99,0x80,0xbe,0x18,0xd9,0x40,0x35,0x21,0x14,0x54,0x81,0x00,0x21,0x00,
+0x30,0x37,0x32,0x23,0x27,0x02,0x63,0x81,0x21,0x13,0x32,0x11,0x72,0x01,0x00,0x53,
+0x10,0x20,0x13,0x01,0x09,0x24,0xd8,0x09,0xc8,0xca,0x40,0xda,0x99,0xaa,0xb9,0x9e,
+0x90,0xba,0xcc,0x9a,0xaa,0xbd,0x9a,0xec,0x8a,0xa8,0x9a,0x9a,0xaa,0xdc,0x89,0x8a,
+0xa8,0xab,0x8a,0xd0,0x0a,0x20,0xa0,0x20,0x83,0x0f,0x32,0x04,0x00,0x39,0x36,0x23,
+0x73,0x34,0x88,0x51,0x33,0x02,0x73,0x90,0x21,0x53,0x82,0x32,0xb1,0x20,0x2b,0x27,
+0x00,0x01,0x30,0x08,0x45,0x00,0xa9,0x0a,0x80,0x0a,0x93,0xfc,0x1c,0xc9,0x18,0xd8,
+0x8b,0xa8,0x9d,0x10,0xb9,0xcb,0x8c,0xbf,0x88,0x89,0x9b,0x90,0xfb,0x88,0xab,0x8b,
+0xd8,0xac,0x0a,0x98,0x02,0xc8,0x8e,0xa0,0x19,0xca,0xb8,0xbb,0x73,0xa0,0x43,0x81,
+0x21,0x10,0x92,0x20,0x15,0x22,0x71,0x93,0x72,0x22,0x19,0x05,0x18,0x42,0x01,0x42,
+0x01,0x03,0x21,0x41,0x32,0x05,0x02,0x4b,0x02,0xb9,0xc8,0x0c,0x33,0xfa,0x9b,0xa9,
+0xac,0xbb,0x8d,0x41,0xa9,0x11,0xcb,0x88,0xaf,0xda,0xa9,0x8a,0xac,0x11,0x90,0xa0,
+0x0e,0xc0,0x99,0x21,0x99,0xbd,0xc1,0x38,0xba,0x60,0x01,0x32,0x91,0x43,0x10,0xe0,
+0x19,0x03,0x31,0x73,0x03,0x00,0x44,0x00,0x62,0x83,0x10,0x18,0x73,0x81,0x10,0x31,
+0xc1,0x58,0x04,0x40,0x90,0x42,0x01,0xa8,0x10,0xa2,0x4b,0xc1,0x52,0xa1,0x63,0x88,
+0x01,0xc8,0x41,0x09,0xcd,0x00,0xa9,0x9b,0xb9,0xab,0x39,0x06,0xa9,0x89,0xfa,0x9d,
+0xda,0x09,0xc9,0x28,0xb0,0x29,0xb9,0x88,0x9b,0x04,0xae,0xb9,0x00,0x29,0x1e,0x14,
+0xa9,0x34,0x59,0xc8,0x52,0x81,0xc8,0x58,0x80,0x20,0x33,0x28,0x24,0x00,0x27,0x20,
+0x92,0x99,0x80,0x3a,0x16,0x43,0x41,0x82,0x90,0x72,0x82,0x89,0x00,0x01,0x42,0x90,
+0x10,0xdb,0x69,0x83,0x08,0x52,0xc9,0x80,0x88,0xd0,0x1b,0xe0,0x8b,0x12,0x18,0xb8,
+0x9d,0xa0,0xac,0xba,0x83,0xcf,0x10,0x09,0xc1,0x29,0xc9,0x0a,0xa9,0x93,0x9d,0x28,
+0xfd,0x18,0x09,0x10,0x09,0x13,0x9a,0x10,0x21,0xcd,0x92,0x1e,0x10,0x41,0x86,0x31,
+0x90,0x00,0x9a,0x02,0x99,0xbf,0x53,0x98,0x51,0x03,0x98,0x80,0x29,0x0a,0xf1,0x89,
+0x18,0x8a,0x32,0x14,0x41,0x43,0xac,0x86,0x4a,0x31,0x81,0xba,0x89,0xfb,0x8e,0xa8,
+0xb9,0x59,0x23,0x12,0x08,0xca,0xb8,0xd9,0x9f,0xa8,0x9b,0x81,0x81,0x0b,0x11,0xd9,
+0x0a,0xc3,0xaf,0x9a,0xac,0x09,0x98,0x42,0x28,0x99,0x81,0x89,0x13,0x2e,0xb0,0x40,
+0x02,0x30,0x33,0x82,0x72,0x2a,0x37,0x11,0x51,0x00,0x21,0x06,0x89,0x10,0x80,0x9a,
+0x32,0x55,0x22,0xa2,0x69,0xb1,0x30,0xa0,0xdb,0x0a,0x90,0x01,0x70,0x83,0x41,0x23,
+0x99,0x98,0xf1,0x1d,0x80,0x98,0x21,0x22,0xc8,0xa9,0x00,0x41,0xf8,0xab,0xc9,0x9c,
+0x22,0xb0,0x30,0xc9,0x9d,0xc8,0x82,0xbc,0xac,0x0b,0x85,0x82,0x98,0x8f,0x91,0x01,
+0x03,0x1a,0xca,0x81,0x26,0x71,0x81,0x11,0x08,0x80,0x63,0xba,0x38,0x82,0x19,0x36,
+0x33,0x10,0x24,0x13,0x88,0x73,0x10,0x24,0xb0,0x12,0x3b,0x32,0x06,0x43,0x49,0x04,
+0x9a,0xb1,0x9e,0x01,0x8a,0x24,0xba,0x58,0x05,0x8d,0x81,0x98,0x00,0xc8,0x9d,0x81,
+0xa0,0x2b,0x91,0x02,0x4a,0xf1,0x49,0xaa,0x0a,0xe8,0xab,0x20,0xc2,0x2d,0x82,0x89,
+0x81,0x0c,0xba,0xaa,0x09,0xd1,0xa9,0x3e,0x84,0x31,0xb3,0x28,0x7b,0xe0,0x98,0x21,
+0xca,0x20,0x05,0x3a,0x13,0x94,0x78,0x92,0x0c,0xb0,0x18,0x22,0x99,0x23,0x21,0xed,
+0x21,0xa3,0x8e,0x00,0x01,0x30,0xa0,0x39,0x04,0x8b,0x72,0xa1,0x29,0x13,0x9b,0x94,
+0x8a,0x01,0x0c,0xb9,0x10,0xfb,0x80,0x1a,0xd3,0x8b,0x30,0xc5,0xa8,0x2d,0x94,0x9d,
+0x81,0xb9,0xeb,0x20,0xcd,0x22,0x09,0xa0,0x30,0xb9,0xa8,0x10,0xb8,0x20,0x1e,0x77,
+0xa8,0x28,0x89,0x13,0x11,0x31,0xa1,0x91,0x2d,0xb1,0x26,0xb0,0x73,0x00,0x01,0x9b,
+0x16,0x11,0x1c,0xa0,0x91,0x9a,0xbf,0xa2,0x49,0x34,0x80,0x01,0x55,0xa9,0x81,0xd0,
+0x28,0xa8,0x00,0x10,0xa1,0x38,0x8a,0x9f,0x92,0x29,0x80,0x7a,0xb1,0x21,0xb9,0x39,
+0x8a,0xff,0x22,0xba,0x31,0x40,0xc8,0x00,0x89,0xa2,0xbf,0x10,0xa9,0xb8,0x68,0x20,
+0xc9,0x10,0xaa,0x10,0xdd,0xa8,0x8b,0x00,0x89,0x9b,0x17,0xa1,0x1c,0xb0,0x9d,0xb0,
+0xbb,0x69,0xa2,0x1a,0x21,0xb2,0x2f,0xb8,0x13,0x53,0xbb,0x74,0xa0,0x81,0x2a,0xb3,
+0x2b,0x02,0xca,0x21,0x52,0x73,0xa3,0x03,0x88,0x9b,0x96,0x9e,0xa8,0x12,0x28,0xa0,
+0x05,0x28,0x18,0xe8,0x28,0x81,0x2b,0x36,0x30,0x23,0x84,0x21,0x11,0x1a,0xe9,0x01,
+0x34,0xca,0x28,0x02,0xfb,0x99,0x0b,0xbe,0x22,0xc1,0x1b,0x00,0xc0,0x9a,0xd8,0xbf,
+0x99,0x89,0x92,0x9d,0x33,0x11,0xf9,0x08,0x09,0xea,0x18,0x80,0xa9,0x01,0x36,0x02,
+0x53,0x88,0x00,0x83,0xd9,0x8e,0x81,0x48,0x02,0x12,0x21,0x24,0x08,0xba,0xfc,0xb9,
+0x99,0x49,0x42,0xb3,0x51,0x81,0x81,0xca,0x8e,0xa8,0xb0,0x1c,0x09,0x37,0x20,0x80,
+0x22,0x99,0xdb,0x28,0xc9,0x48,0x12,0x01,0x27,0x98,0x08,0xb8,0x02,0x99,0x10,0x8a,
+0x87,0xae,0x31,0x81,0xd9,0x9c,0x41,0xa8,0xcc,0x09,0x01,0x99,0x8a,0x34,0x10,0xd0,
+0x48,0xb1,0x9a,0xb2,0x8c,0x23,0xe9,0x1b,0x26,0x32,0x31,0x74,0x05,0x10,0x08,0x89,
+0xa8,0x30,0x90,0x58,0x01,0x23,0x08,0x18,0xfb,0x8a,0xa8,0x1c,0x25,0xa8,0xaa,0x31,
+0x00,0xfc,0x39,0x90,0xcb,0x38,0x84,0xcb,0x09,0x41,0xa4,0xad,0x20,0xa8,0x28,0x82,
+0x83,0x6c,0xb4,0x98,0x5a,0x14,0xa8,0x92,0x9c,0xaa,0xcd,0xaa,0x0a,0x14,0x8d,0x53,
+0x12,0x81,0x99,0x0a,0x10,0xf0,0x9b,0x31,0xb8,0x1c,0x11,0x27,0x08,0x21,0x12,0x15,
+0xbc,0xa9,0xaa,0xd9,0x29,0x02,0x67,0x11,0x01,0xb8,0x18,0x0b,0xd8,0xbc,0x20,0x21,
+0x82,0x71,0x03,0x80,0xcc,0x8a,0xaa,0x89,0xcb,0x38,0x64,0x21,0x01,0xa9,0x0a,0xfa,
+0x0d,0x11,0xa8,0x20,0x83,0x0a,0x21,0xf0,0xac,0x41,0xb8,0x38,0x04,0x88,0x00,0x81,
+0xc1,0x9e,0x20,0xf8,0x9a,0x40,0x23,0x22,0x12,0x00,0xf0,0xbc,0x8a,0x88,0xd9,0x40,
+0x25,0x18,0x10,0x04,0x88,0x29,0xb0,0xaf,0x18,0xa8,0x80,0x72,0x13,0x11,0xa1,0xad,
+0x98,0x80,0xdd,0x29,0x02,0x32,0x09,0x25,0x82,0x8c,0x80,0xba,0xfc,0x28,0x08,0x18,
+0x38,0x16,0xa0,0x9f,0x18,0xa2,0x9d,0x28,0x12,0x88,0x23,0x62,0x92,0x9a,0xec,0x18,
+0xa8,0x9a,0x19,0x25,0x90,0x38,0x02,0xda,0x1b,0x81,0x8b,0xf0,0x3b,0x32,0xb9,0x1b,
+0x47,0x08,0x29,0x17,0xc8,0x89,0x20,0x90,0xab,0x72,0xa1,0x28,0x24,0xa9,0x19,0x9a,
+0xe0,0x3a,0xa9,0x73,0x24,0x01,0x29,0x04,0xcd,0x89,0xba,0xba,0x70,0x13,0x20,0x91,
+0x80,0x99,0xab,0xeb,0x9a,0x50,0x83,0xb8,0x7c,0x14,0xa9,0x88,0x10,0x90,0xbd,0x19,
+0x23,0xa1,0x0c,0x35,0xa2,0x00,0x9c,0x32,0x88,0xa0,0xcd,0x54,0x88,0xa1,0x09,0x99,
+0x20,0x95,0xae,0x28,0x17,0xbb,0x20,0x31,0xb8,0x8d,0x80,0x80,0x0a,0x53,0xe8,0x8a,
+0x24,0x02,0xad,0x29,0x14,0xb0,0x2c,0xb1,0x0a,0x24,0x10,0xd9,0x22,0x21,0x12,0x93,
+0xdf,0x20,0xb8,0xba,0x3b,0x27,0x99,0x42,0x02,0xba,0x0f,0x13,0x89,0xbc,0x28,0x05,
+0xba,0x9f,0x42,0x90,0x10,0xb9,0x31,0x82,0x20,0xb8,0x08,0x9a,0x08,0xa6,0x7a,0xb7,
+0x0a,0x14,0x89,0xb0,0x4a,0x03,0xa9,0xac,0x73,0x92,0xbb,0x8d,0x53,0xc0,0x8b,0x43,
+0x91,0x9a,0x41,0xa8,0x9a,0x10,0xfb,0x38,0x12,0x81,0xba,0x74,0xc1,0x0a,0x20,0x88,
+0xb9,0x63,0xca,0x30,0xa3,0x1b,0x01,0x19,0xa2,0xaf,0x43,0xa1,0xbc,0x70,0x05,0xab,
+0x28,0x02,0x90,0x9b,0x89,0x40,0x82,0xad,0x41,0x91,0x8a,0x82,0x2a,0x84,0xbc,0x0a,
+0x46,0xe0,0x3a,0x05,0x9a,0x10,0x91,0x9b,0x09,0x33,0x01,0xaa,0x19,0x26,0xbd,0x30,
+0x04,0xcf,0x39,0x05,0x90,0x9c,0x33,0x02,0xd8,0x1c,0x23,0x80,0xce,0x38,0x82,0xaa,
+0x42,0xc0,0x1b,0x16,0xa8,0x0b,0x34,0xd8,0x0a,0x12,0x02,0xbc,0x18,0x20,0x20,0xf9,
+0x40,0x83,0xbc,0x18,0x26,0xbb,0x21,0xc8,0x30,0xc9,0x28,0x33,0xb9,0x3c,0x06,0xa9,
+0x28,0x02,0xb8,0x0a,0x8a,0x56,0x93,0xbf,0x38,0x04,0x9a,0x99,0x31,0x23,0x08,0xef,
+0x32,0x90,0x9c,0x10,0x85,0x9e,0x42,0xa8,0x1a,0x20,0xb2,0x1c,0x11,0x90,0x0a,0xb9,
+0x41,0xa0,0x50,0xc9,0x40,0x91,0x99,0x22,0x11,0x4a,0x97,0x8d,0x10,0x92,0xad,0x40,
+0x91,0x88,0x0a,0x42,0x15,0xeb,0x0a,0x41,0x05,0xac,0x00,0x08,0x05,0xac,0x80,0x22,
+0xb8,0x1a,0x82,0x58,0xb2,0x0c,0x13,0x00,0xd9,0x89,0x98,0x1b,0x85,0x9e,0x61,0x02,
+0xb9,0x18,0x11,0x01,0xe9,0x8d,0x53,0xa1,0x9c,0x20,0x13,0xea,0x28,0x03,0x08,0xd9,
+0x1a,0x35,0xb0,0x8c,0x21,0x88,0x00,0xb0,0x9d,0x61,0xa2,0x09,0x89,0x34,0xc8,0x2a,
+0x03,0xae,0x10,0x90,0x88,0x01,0x41,0x92,0x60,0xb3,0x2b,0x11,0xb0,0xdf,0x1a,0x34,
+0xea,0x19,0x04,0x1a,0x00,0x01,0xbb,0x73,0xb3,0xaf,0x33,0x88,0xb9,0x1b,0x06,0x99,
+0x09,0x80,0x50,0x91,0x80,0x1b,0x06,0xba,0x0a,0x93,0x0d,0x16,0xaa,0x09,0x40,0xb1,
+0x19,0x31,0x98,0x00,0xf8,0x0e,0x24,0xd9,0x0a,0x31,0xc1,0x28,0x80,0x27,0xea,0x48,
+0x91,0x09,0xa9,0x30,0xc1,0x2a,0x33,0xc9,0x00,0x88,0x38,0xa1,0x09,0xa2,0xdb,0x7c,
+0x25,0xda,0x28,0xa1,0x11,0xda,0x28,0x81,0x20,0xe9,0x50,0x93,0x8a,0x90,0xc0,0x1e,
+0x24,0xa9,0x9a,0x42,0xa1,0x0b,0x52,0xa0,0x9d,0x30,0x84,0x9c,0x20,0x90,0x88,0x81,
+0x20,0xa8,0x30,0x01,0x10,0xef,0x41,0xb1,0x8b,0x90,0x1d,0x26,0x98,0xbb,0x71,0x83,
+0x9c,0x11,0xb8,0x49,0x90,0x0a,0x24,0x90,0xbc,0x31,0x82,0x10,0xfa,0x20,0x61,0xd0,
+0x39,0x04,0xc9,0x9a,0x23,0x89,0xc0,0xb9,0x71,0x95,0x9a,0x32,0x91,0x8c,0x13,0xbc,
+0x0a,0x36,0xe0,0x9b,0x34,0x91,0x9d,0x31,0x94,0xab,0x28,0x04,0xba,0x21,0xa8,0x2b,
+0x17,0xd9,0x19,0x93,0x1a,0x11,0xd9,0x19,0x37,0xda,0x08,0x21,0x98,0x9a,0x22,0x89,
+0x20,0xd9,0x28,0x42,0x83,0xcc,0x29,0x27,0xb9,0x8b,0x80,0x64,0xb0,0xad,0x52,0x92,
+0x9a,0x00,0x10,0xb2,0x1b,0x01,0x10,0x86,0xaf,0x21,0x80,0x90,0x8c,0x34,0x99,0x98,
+0x1c,0x43,0x99,0xba,0x25,0xab,0x20,0x05,0xac,0x19,0x95,0x1a,0x12,0xaa,0x15,0xcb,
+0x79,0xa2,0x9b,0x33,0x98,0xea,0x3a,0x16,0x88,0xaa,0x40,0xa2,0x9d,0x63,0xc0,0x09,
+0x12,0x89,0x0a,0x06,0xac,0x48,0x04,0xcb,0x39,0x13,0xb8,0x8b,0x43,0x91,0x99,0x8b,
+0x15,0x8a,0xa0,0x09,0x58,0x15,0xcb,0x20,0x10,0x91,0xab,0x1b,0x37,0xca,0x8e,0x25,
+0xa9,0x09,0x10,0x80,0x38,0xe0,0x8a,0x20,0x21,0xf8,0x28,0x91,0x19,0x84,0x9e,0x80,
+0x32,0xa0,0xa9,0x4b,0x17,0xb8,0x1a,0x22,0xd8,0x9b,0x53,0xa8,0x88,0x32,0x98,0x9a,
+0x70,0x95,0x9c,0x32,0xb0,0x0e,0x15,0xca,0x48,0x92,0xb8,0x2a,0x06,0x99,0x11,0x89,
+0xab,0x64,0xb0,0x8d,0x32,0x90,0x9b,0x28,0x15,0xaa,0x18,0x99,0x14,0x8c,0x01,0xa8,
+0x62,0x9a,0xa0,0x61,0x82,0xcd,0x18,0x22,0xb1,0x9b,0x12,0x39,0xa4,0x50,0xd8,0x1b,
+0x83,0x90,0x8b,0x0a,0x25,0x02,0xea,0x2b,0x87,0x19,0x02,0xbe,0x43,0x81,0xbc,0x11,
+0x30,0x91,0xb9,0x48,0x22,0x98,0xbc,0x57,0xba,0x81,0x30,0xa0,0xb8,0x0c,0x35,0xc9,
+0x28,0x12,0xf9,0x58,0x82,0xbd,0x31,0x82,0x89,0xc9,0x48,0x11,0xd9,0x28,0x01,0x20,
+0xc8,0xbb,0x33,0x48,0xc5,0x9e,0x21,0x23,0xea,0x09,0x14,0x9a,0x89,0x52,0xa0,0x09,
+0xca,0x50,0x03,0xcc,0x39,0x06,0x8a,0x98,0x20,0x82,0x0a,0xa9,0x10,0x02,0x21,0xfd,
+0x38,0x83,0xca,0x50,0xa2,0x8b,0x04,0xaa,0x81,0x50,0xc0,0x28,0x92,0x8c,0x80,0x41,
+0xa0,0xac,0x64,0xa1,0x9c,0x41,0x82,0x9c,0x0b,0x37,0xb9,0x8a,0x21,0x93,0x9c,0x08,
+0x31,0x31,0xf9,0x1b,0x23,0x9b,0xa3,0x0a,0x23,0xcd,0x4a,0x06,0xac,0x11,0x23,0xbd,
+0x28,0x24,0xea,0x29,0x83,0xab,0x18,0x38,0x87,0xac,0x20,0x82,0x98,0x49,0x81,0x88,
+0x88,0x63,0xb1,0xad,0x52,0xa0,0x89,0x22,0xeb,0x60,0xa2,0x8c,0x21,0x03,0xcd,0x40,
+0xa1,0x9a,0x43,0xb9,0x29,0x17,0xac,0x28,0x12,0xc9,0x1a,0x85,0x09,0xaa,0x53,0xa8,
+0x08,0x00,0xc2,0x0c,0x14,0x9a,0x01,0x12,0xab,0x41,0xd8,0x29,0x07,0xbc,0x11,0x28,
+0x04,0x9e,0x21,0x80,0x99,0x09,0x12,0x80,0x51,0xfb,0x3a,0x84,0x00,0xcc,0x52,0xb0,
+0x2a,0x02,0x19,0xd1,0x49,0x91,0x9b,0x42,0x01,0xba,0xca,0x73,0xc1,0x0a,0x31,0x85,
+0xae,0x41,0x82,0xcb,0x30,0x82,0xab,0x30,0xa9,0x38,0x03,0xc9,0x3b,0x43,0x94,0x9f,
+0x81,0x09,0x24,0xcc,0x38,0x91,0x01,0x9c,0x26,0xdb,0x31,0x11,0xfb,0x18,0x11,0xa8,
+0x18,0x92,0x28,0xd9,0x38,0x83,0x1b,0xf8,0x5c,0x83,0xab,0x29,0x53,0xc0,0x8a,0x42,
+0xb8,0x28,0x00,0xa0,0x09,0x34,0xca,0x18,0x98,0x23,0xfb,0x1e,0x24,0xa1,0xbc,0x71,
+0xa4,0xab,0x31,0x01,0xd9,0x29,0x84,0x0c,0x02,0x98,0x08,0x10,0xa3,0xac,0x09,0x55,
+0xb8,0xaa,0x51,0x82,0x9b,0x10,0xaa,0x50,0x15,0xbc,0x1a,0x25,0xb0,0x8b,0x38,0x06,
+0xbb,0x39,0xa1,0x60,0xc9,0x30,0xa2,0xac,0x61,0x82,0xba,0x4b,0x85,0xaa,0x01,0x20,
+0xba,0x20,0xa0,0x72,0xd9,0x48,0x92,0xa9,0x51,0xc0,0x0b,0x17,0xa9,0x8a,0x33,0xc1,
+0x0b,0x32,0xb1,0x1c,0x13,0xa8,0x8b,0x61,0x85,0x9e,0x30,0x82,0xac,0x20,0x13,0xac,
+0x18,0x82,0x1d,0x86,0x9a,0x2a,0x13,0xc0,0x9a,0x68,0x92,0xaa,0x88,0x73,0xc0,0x0b,
+0x42,0xa2,0x9c,0x01,0x33,0xeb,0x1a,0x43,0xc0,0x1b,0x93,0x09,0xa3,0x0e,0x34,0xa8,
+0xba,0x41,0xaa,0x00,0x41,0xb1,0xbf,0x35,0xb0,0x1c,0x05,0x98,0xaa,0x51,0xa1,0xa9,
+0x58,0x93,0x9b,0x01,0x29,0x04,0xab,0x0d,0x15,0xc0,0x3b,0x13,0xa1,0x9d,0x41,0x82,
+0xab,0x29,0x86,0xbb,0x70,0xb1,0x2a,0x81,0x18,0xa9,0x58,0x92,0x9d,0x82,0x35,0xce,
+0x29,0x04,0x19,0xc8,0x19,0x13,0x09,0xe9,0x10,0x08,0x41,0xf8,0x2a,0x25,0xea,0x38,
+0x82,0xbb,0x41,0xa1,0x8a,0x34,0xea,0x29,0x14,0xb9,0x8a,0x44,0xb8,0x19,0x91,0x1a,
+0x22,0xb8,0x0c,0x80,0x62,0x92,0xcb,0x8c,0x37,0xa9,0x99,0x41,0xa1,0xcb,0x61,0x90,
+0x09,0x92,0x9a,0x48,0x85,0xbb,0x40,0x82,0xaa,0x11,0xd9,0x50,0x02,0xbd,0x21,0x32,
+0xcc,0x28,0x02,0x89,0xa9,0x18,0x44,0xc9,0x89,0x11,0x98,0x52,0xa2,0xbe,0x62,0x90,
+0x0a,0x83,0x0e,0x22,0xa1,0x9b,0x21,0xca,0x63,0xc8,0x1b,0x15,0xba,0x59,0x04,0xbc,
+0x40,0x83,0xac,0x30,0x00,0xa9,0x10,0x28,0xa1,0xda,0x48,0x14,0xcc,0x10,0x14,0xbb,
+0x20,0x02,0xdb,0x60,0x81,0xca,0x1a,0x16,0xc8,0x19,0x22,0xc1,0x0c,0x22,0x80,0x8a,
+0x80,0x38,0x93,0xbf,0x31,0xa2,0x99,0x78,0xc3,0x0d,0x22,0x80,0x99,0x99,0x42,0x03,
+0xcd,0x29,0x33,0xf9,0x39,0xb3,0x0d,0x13,0x98,0x99,0x43,0xa0,0x9d,0x42,0x92,0xbc,
+0x2b,0x47,0xc9,0x09,0x10,0x00,0x00,0xaa,0x10,0x01,0x1a,0x92,0x90,0xac,0x54,0x82,
+0x8d,0x8a,0x26,0xd9,0x19,0x20,0x82,0xaa,0x1a,0x27,0x9c,0x00,0x82,0xaa,0x42,0xc8,
+0x19,0x14,0xa9,0x08,0x22,0x9f,0x13,0xa8,0x42,0xbc,0x20,0x01,0x01,0xbc,0x48,0x22,
+0xe3,0x8c,0x41,0x83,0xda,0x89,0x71,0xb0,0x19,0x91,0x88,0x22,0xbe,0x35,0xb9,0x19,
+0x08,0x11,0xbc,0x37,0xdb,0x20,0x00,0x88,0x88,0x0b,0x53,0x82,0xbb,0x8b,0x36,0xa8,
+0x2a,0x89,0x27,0xe9,0x1a,0x31,0x84,0xbd,0x28,0x12,0x10,0xd9,0x99,0x44,0x98,0x9a,
+0x30,0xa2,0x9c,0x51,0xb1,0x8c,0x30,0x04,0xcb,0x70,0xa2,0xbd,0x73,0xa1,0x9c,0x32,
+0x92,0x9b,0x10,0x01,0xb0,0x1a,0x10,0x05,0xbb,0x48,0xa3,0x0e,0x13,0xba,0x09,0x72,
+0xb0,0x8a,0x4a,0x16,0xeb,0x38,0x15,0xda,0x19,0x03,0x89,0x18,0xc2,0x0d,0x25,0xc9,
+0x1a,0x15,0xb9,0x29,0x13,0xac,0x10,0x11,0x9b,0x19,0x81,0x22,0xae,0x58,0x86,0xab,
+0x31,0xb1,0x9b,0x52,0x90,0xb9,0x41,0x81,0x0d,0x13,0xb9,0x09,0x19,0x47,0xb8,0x9c,
+0x21,0x23,0xcb,0xa9,0x38,0x17,0xba,0x08,0x41,0xc8,0x28,0x03,0xae,0x22,0x91,0xba,
+0x73,0xa0,0x9a,0x29,0x24,0xba,0x1c,0x86,0x10,0xba,0x42,0xa8,0x9a,0x41,0x05,0xbc,
+0x38,0x16,0xea,0x2a,0x15,0xcb,0x20,0x84,0xab,0x38,0x92,0x8a,0x12,0x90,0x8a,0x82,
+0x8d,0x35,0xea,0x39,0x12,0xca,0x20,0xa2,0x49,0x94,0xac,0x33,0xcd,0x48,0x13,0xbc,
+0x2a,0x37,0xda,0x19,0x13,0xb8,0x0b,0x14,0x80,0x0a,0x8a,0x16,0xbc,0x30,0x05,0xcb,
+0x38,0x93,0xbb,0x31,0x26,0xeb,0x19,0x25,0xb9,0x0c,0x23,0xb1,0x9c,0x43,0xc0,0x1b,
+0x15,0xa9,0x0b,0x34,0xc8,0x1b,0x33,0xa0,0xbb,0x49,0x04,0xcb,0x40,0x93,0xae,0x52,
+0xa1,0x9c,0x42,0xa2,0x9c,0x30,0x83,0xcb,0x18,0x13,0xb8,0x8b,0x55,0xd8,0x1a,0x34,
+0xd9,0x2a,0x14,0xba,0x08,0x13,0xa8,0x8d,0x33,0xc2,0x8b,0x21,0x02,0xda,0x58,0x83,
+0xbc,0x30,0x03,0xbc,0x3b,0x37,0xda,0x1c,0x25,0xc8,0x0a,0x24,0xa9,0x99,0x42,0x98,
+0x09,0x08,0x00,0x88,0x9a,0x22,0x0c,0x94,0x1b,0x06,0x9c,0x31,0xa1,0xaf,0x44,0xc9,
+0x2b,0x25,0xc8,0x9b,0x53,0x92,0x9d,0x31,0x92,0x9c,0x31,0xb0,0x09,0x32,0xb1,0x8f,
+0x12,0x88,0x90,0x48,0xa1,0x9c,0x23,0x24,0xde,0x39,0x05,0xca,0x18,0x24,0xe8,0x1a,
+0x23,0xb9,0x09,0x12,0x80,0xa9,0x18,0x91,0x09,0x15,0xda,0x29,0x32,0xa0,0xcd,0x72,
+0x92,0x9c,0x28,0x23,0xda,0x0a,0x24,0x99,0x9b,0x35,0xa9,0x19,0x89,0x02,0x8c,0x25,
+0xd9,0x1a,0x13,0x98,0x1b,0xf2,0x58,0xa2,0x8c,0x03,0xca,0x51,0x91,0x9a,0x28,0x16,
+0xfb,0x29,0x14,0xa8,0x8c,0x32,0xa0,0x0a,0x28,0xb2,0x09,0x42,0x08,0xf0,0x0c,0x32,
+0x91,0x9d,0x32,0x92,0xad,0x52,0xa9,0x11,0x80,0xb8,0x4a,0x84,0xa9,0x8a,0x54,0xb1,
+0x9b,0x1a,0x34,0x98,0xe9,0x59,0x93,0xad,0x32,0x82,0xab,0x28,0x86,0x8f,0x21,0x90,
+0x9a,0x31,0x93,0x8f,0x11,0x00,0xa9,0x28,0x03,0x9c,0x18,0x53,0xf9,0x00,0x3a,0x84,
+0xbd,0x33,0x18,0xc0,0x0a,0x25,0xbb,0x78,0xa3,0x9c,0x10,0x21,0xc8,0x19,0x83,0x0d,
+0x84,0x88,0x09,0x38,0xb2,0x19,0xba,0x59,0x84,0xbb,0x71,0xc0,0x49,0x94,0x8b,0x88,
+0x01,0x21,0x91,0xdf,0x42,0x81,0xcb,0x28,0x25,0xca,0x89,0x22,0x81,0x8a,0x19,0xa0,
+0x11,0x9a,0x25,0x9c,0x12,0x9a,0xb2,0x48,0xaa,0x30,0xd2,0x70,0x81,0xb2,0xbf,0x44,
+0x92,0xda,0x2a,0x15,0xb9,0x18,0x08,0x98,0x51,0xa2,0x8d,0x29,0x07,0xba,0x20,0x11,
+0xa8,0x0b,0x15,0xab,0x82,0x29,0x94,0x0c,0x25,0xc0,0x8e,0x33,0xa0,0xab,0x21,0x11,
+0xc3,0x9f,0x41,0xb2,0x0d,0x24,0xc8,0x19,0x21,0xc9,0x18,0x02,0xb9,0x29,0x43,0xf0,
+0x1b,0x14,0xb0,0x0c,0x14,0x9a,0x21,0xc0,0x1a,0x22,0xe9,0x09,0x25,0xa8,0x0e,0x13,
+0x8a,0x19,0x05,0xac,0x61,0xa2,0x9d,0x40,0x91,0x9b,0x31,0xa3,0x8e,0x23,0xc0,0x8b,
+0x43,0x01,0xeb,0x38,0x02,0xa9,0x9a,0x43,0x81,0xbd,0x22,0x20,0xc9,0x3c,0x95,0x08,
+0x18,0x04,0xcc,0x30,0xa1,0x0a,0x40,0xa1,0xcb,0x40,0x12,0xc0,0x9d,0x48,0x85,0xab,
+0x30,0x03,0xfa,0x2a,0x93,0x80,0x08,0x18,0xe9,0x32,0xa0,0x8f,0x14,0x81,0xac,0x38,
+0x16,0xca,0x99,0x43,0x90,0x89,0x80,0x88,0x28,0x14,0xab,0xa8,0x74,0xa1,0x8e,0x24,
+0xb8,0x8d,0x33,0xa8,0x8b,0x25,0xb9,0x18,0x01,0xa9,0x71,0xb1,0x1d,0x04,0x99,0x9a,
+0x32,0xc1,0x1a,0x08,0x21,0x96,0xac,0x40,0x82,0xca,0x19,0x26,0xc9,0x0a,0x23,0xd8,
+0x29,0x84,0x9b,0x30,0x23,0xfe,0x30,0x82,0xaa,0x10,0x13,0xcb,0x18,0x01,0x99,0x11,
+0x8b,0x25,0xd0,0x09,0x30,0xa2,0x39,0xc0,0x2b,0xb4,0x41,0xbf,0x42,0xb8,0x40,0xa9,
+0x23,0xaa,0x29,0x07,0x99,0x18,0x90,0x92,0xdf,0x32,0x81,0xd9,0x1a,0x33,0xa1,0x8e,
+0x26,0xc8,0x0b,0x43,0x90,0x9b,0x20,0x81,0x98,0xdc,0x79,0x93,0xba,0x38,0x06,0xaa,
+0x10,0x80,0x80,0x08,0x09,0x10,0xb8,0x8e,0x33,0xa9,0x2b,0x47,0xd8,0x39,0x82,0xab,
+0x20,0xb3,0x2e,0x92,0x18,0xcf,0x52,0x90,0x8a,0x22,0x02,0xcb,0x98,0x21,0xb1,0x5a,
+0xa0,0x01,0x0d,0x06,0xaa,0x9a,0x23,0x45,0xba,0x0c,0x27,0xb9,0x0c,0x22,0xa1,0xba,
+0x50,0x80,0xaa,0x15,0x09,0xc9,0x40,0x93,0xcc,0x38,0x22,0x92,0xcf,0x21,0x33,0xf8,
+0x1c,0x23,0xb9,0x2a,0x13,0xaa,0x09,0x34,0xdb,0x31,0x88,0x8b,0x15,0xba,0x38,0x85,
+0x0c,0x12,0xe9,0x00,0x10,0x98,0x20,0xa2,0x9f,0x34,0xb9,0x2b,0x85,0x8b,0x30,0xa4,
+0xaf,0x42,0x91,0x9a,0x30,0x81,0x98,0x38,0xbb,0xa4,0x2c,0x54,0xfb,0x39,0x03,0x9c,
+0x10,0x83,0x8b,0x28,0xb3,0x98,0x52,0x9e,0x80,0x24,0x9a,0x08,0xa8,0x61,0xa2,0xaf,
+0x31,0x85,0xba,0x79,0x91,0xa8,0x18,0x31,0xd9,0x18,0xa1,0x32,0xcd,0x41,0x91,0xb8,
+0x39,0x31,0xd2,0x9d,0x61,0x91,0x9a,0x80,0x31,0xa1,0x9b,0x38,0x37,0xdb,0x09,0x13,
+0xb9,0x61,0xd8,0x2a,0x24,0xc0,0x8c,0x22,0x91,0x9a,0x08,0x83,0x38,0xf0,0x2a,0x06,
+0xaa,0x0a,0x32,0x98,0xc8,0x69,0x92,0x8a,0x22,0xb8,0x3a,0x84,0x08,0xce,0x10,0x20,
+0x03,0xad,0x22,0x22,0x9c,0x28,0xb3,0x58,0xaa,0xdd,0x09,0x17,0x88,0x09,0x83,0xcb,
+0x59,0x82,0x98,0x81,0x0a,0x28,0x94,0xcd,0x52,0xa0,0xb8,0x49,0xa3,0x0b,0x48,0x85,
+0x90,0x8c,0x39,0x27,0xd9,0x8c,0x52,0xc2,0x8c,0x33,0xb2,0xae,0x52,0x90,0x99,0x20,
+0x01,0x9b,0x08,0x82,0x41,0xe8,0x8a,0x32,0x82,0xba,0x4a,0x14,0xc8,0xac,0x61,0x82,
+0x9a,0x9a,0x62,0xb1,0x8b,0x31,0x92,0x8c,0x20,0xe1,0x38,0x12,0xc9,0x38,0xb1,0x1b,
+0x24,0xe8,0x8c,0x44,0xc8,0x1b,0x15,0xa0,0x89,0x00,0x01,0x81,0xbd,0x52,0x81,0xac,
+0x18,0x22,0xa8,0x39,0xf2,0x29,0x12,0x01,0x9f,0x22,0x91,0xac,0x29,0x04,0xa1,0x3c,
+0xb2,0x0d,0x14,0x88,0x89,0x11,0x1a,0xb2,0xba,0x61,0x18,0xed,0x31,0x81,0x09,0xa0,
+0x00,0xa1,0x7b,0xc3,0x29,0x88,0x37,0xce,0x10,0x13,0xca,0x2a,0x85,0x88,0x0a,0x08,
+0x23,0x92,0x9f,0x21,0x93,0x9f,0x33,0xba,0x1a,0x22,0xc1,0x0d,0x14,0xaa,0x08,0x16,
+0x9a,0x90,0x53,0xb8,0x8c,0x23,0x84,0xaf,0x21,0x81,0xd9,0x49,0x03,0xab,0x20,0x80,
+0x20,0xa8,0xba,0x78,0x85,0xac,0x18,0x13,0xca,0x09,0x30,0x02,0x80,0x98,0x2e,0x04,
+0xc8,0x5b,0x03,0xb9,0x0a,0x06,0x8a,0x98,0x10,0x19,0xc1,0x51,0x18,0xa8,0x33,0xb0,
+0x6c,0xe2,0x09,0x11,0xba,0x1c,0x23,0xf8,0x3b,0x43,0xb2,0xad,0x30,0x14,0x98,0x9d,
+0x42,0xa1,0x9d,0x12,0x80,0x89,0x09,0x02,0x8a,0x25,0x29,0xd9,0x32,0xf9,0x09,0x35,
+0x99,0xc9,0x39,0x05,0xbd,0x38,0x14,0xba,0x1a,0x15,0x88,0x99,0x02,0x89,0xb0,0x4b,
+0x92,0x85,0x9f,0x01,0x11,0x8a,0x20,0x94,0x1c,0x81,0x19,0x92,0xcd,0x72,0x83,0xcd,
+0x10,0x13,0xcb,0x18,0x03,0x81,0x8b,0x19,0x06,0x22,0xbd,0x10,0x00,0x18,0xd2,0x0b,
+0x22,0xaa,0xa2,0x1f,0x13,0x41,0xea,0x88,0x42,0xa1,0x9b,0x84,0x39,0xd9,0x84,0x8f,
+0x32,0xc1,0x8e,0x31,0xa2,0xa9,0x1a,0x14,0x90,0xb9,0x62,0x92,0x09,0xcb,0x00,0x52,
+0x92,0xad,0x00,0x62,0xd1,0x09,0x20,0x03,0xdb,0x18,0x42,0xc8,0x89,0x30,0x92,0x0b,
+0xc9,0x32,0x09,0x9a,0x04,0xbb,0x71,0xa8,0x03,0x5a,0xb1,0xac,0x00,0x51,0x92,0xcb,
+0x2a,0x94,0x2b,0x24,0x98,0x89,0x27,0xac,0x21,0xa2,0x38,0xdd,0x11,0x38,0xb8,0x32,
+0xca,0x89,0x13,0xaa,0x71,0xc3,0x0b,0x82,0x9f,0x33,0x83,0xfc,0x29,0x12,0xb9,0x0b,
+0x35,0xb8,0x0b,0x07,0x09,0x18,0xb0,0xb8,0x70,0x01,0xf8,0x29,0x12,0xab,0x18,0x03,
+0x9a,0x30,0xf3,0x1a,0x34,0xc2,0x8d,0x21,0x81,0xaa,0x80,0x1a,0x37,0x9a,0x81,0xaa,
+0x8a,0x32,0x11,0x41,0x12,0xf0,0x8f,0x84,0xa1,0x29,0x1a,0xc3,0xbd,0x50,0x12,0xa9,
+0xaa,0x45,0x99,0x80,0x9b,0x34,0xc8,0x09,0x10,0x94,0x1c,0x93,0x8b,0x60,0xb1,0xda,
+0x69,0x01,0xb8,0x10,0x44,0xba,0xa8,0x49,0x05,0x9b,0xa1,0x39,0xb2,0x8c,0x28,0x04,
+0x09,0x10,0x87,0xbd,0x40,0xa2,0x99,0x40,0xd0,0x39,0x94,0x8d,0x52,0xa0,0xaa,0x42,
+0xa2,0x8c,0x02,0x11,0xdb,0x3b,0x07,0x99,0x18,0x02,0xec,0x30,0x02,0x98,0x8b,0x15,
+0x8b,0x1a,0xa3,0x21,0x8a,0xfb,0x4c,0x04,0xba,0x29,0x24,0xfb,0x38,0x02,0x99,0x89,
+0x33,0xbb,0xab,0x74,0x91,0xaa,0x11,0x83,0x0f,0x04,0xaa,0x18,0x41,0xb8,0x19,0x01,
+0x50,0xd9,0x00,0x18,0x10,0xeb,0x11,0x38,0xaa,0x15,0x39,0xe1,0x8b,0x20,0x23,0xdd,
+0x40,0x02,0xdb,0x0a,0x45,0xa8,0x8b,0x43,0xb9,0x8a,0x62,0xa0,0x28,0x82,0xcb,0x10,
+0x08,0xa3,0x9d,0x38,0x82,0xaa,0x00,0x66,0xa8,0x80,0xa9,0x71,0xb2,0x8a,0x31,0xb0,
+0xaf,0x12,0x81,0x29,0xca,0x02,0x59,0x03,0xbd,0x43,0x11,0xf9,0x8a,0x44,0xb0,0xab,
+0x50,0x02,0xeb,0x29,0x15,0xb9,0x0a,0x33,0x91,0xbb,0x68,0x82,0x9c,0x08,0x34,0xcb,
+0x10,0x01,0xb9,0x58,0xa2,0x09,0x00,0x04,0x9f,0x31,0x10,0xe8,0x2a,0x93,0x8b,0x20,
+0xb3,0x1f,0x05,0x99,0x89,0x43,0xd8,0x29,0x92,0x8a,0x10,0x92,0x2d,0xa2,0x9c,0x18,
+0x26,0x99,0x9a,0x24,0xb0,0x0d,0x05,0xaa,0x08,0x33,0xd8,0x0c,0x06,0x80,0x0a,0x98,
+0x00,0x83,0x1e,0x80,0x14,0xb0,0x0b,0x31,0x96,0xad,0x32,0x00,0xfa,0x29,0x03,0x90,
+0x8e,0x11,0x93,0x9d,0x32,0xa4,0x8d,0x13,0x08,0xeb,0x50,0x91,0x99,0x0c,0x15,0xaa,
+0x01,0x41,0xb0,0x9b,0x42,0x82,0xcb,0x40,0x92,0x8b,0x1a,0xc4,0x0c,0x72,0xa1,0xba,
+0x62,0x98,0x89,0x23,0x98,0x9d,0x23,0x8a,0x88,0x02,0x80,0x0a,0x0b,0xa7,0x1c,0x23,
+0x00,0xfc,0x59,0x82,0xb9,0x2c,0x16,0x99,0xaa,0x38,0x83,0x2b,0xd1,0x58,0x81,0xa9,
+0x2a,0x14,0xa0,0x8a,0x78,0xc1,0x09,0x18,0x32,0xfa,0x08,0x12,0x9a,0x81,0x8b,0x13,
+0x38,0xaa,0x87,0x3b,0xa1,0x92,0xbf,0x63,0xd8,0x0a,0x35,0xba,0x29,0x14,0xc0,0x2b,
+0x82,0x92,0xbb,0x72,0x11,0xf8,0x18,0x18,0x90,0xa8,0x89,0x40,0xb0,0x22,0x9b,0x04,
+0x18,0xf9,0x7a,0xa3,0x9b,0x10,0x94,0x8d,0x03,0x10,0xc8,0x4b,0xa3,0x0a,0x1a,0x14,
+0xb0,0x9b,0x20,0x14,0x12,0xff,0x41,0xa1,0xaa,0x21,0x91,0x4a,0x92,0xb8,0x2a,0x36,
+0xca,0x09,0x15,0x81,0x8f,0x00,0x81,0x0a,0x2b,0x87,0x89,0x18,0xb9,0x22,0x38,0xe8,
+0x20,0x81,0xa8,0x0a,0x81,0x1e,0x13,0xc3,0xac,0x2d,0x16,0xb9,0x09,0x73,0xb0,0x8a,
+0x41,0x93,0x9d,0x12,0x01,0xbd,0x20,0x02,0x09,0x89,0xc8,0x41,0x85,0xab,0x28,0x05,
+0x91,0x9d,0x2b,0x17,0xaa,0x1a,0x14,0xc8,0x0c,0x04,0x89,0x89,0xa2,0x48,0x22,0xd1,
+0x89,0x01,0x1a,0xb0,0x43,0xbc,0x58,0x13,0xe8,0x0c,0x54,0xa0,0x9a,0x48,0x92,0x8a,
+0x81,0x20,0x8b,0x95,0x90,0x8f,0x82,0x90,0x08,0x18,0x87,0x9a,0x01,0x12,0x89,0xb9,
+0x41,0x00,0xca,0xa1,0x1c,0xa0,0x47,0xea,0x09,0x28,0x06,0x9c,0x20,0x23,0xb0,0x8c,
+0x10,0x40,0xe0,0x8a,0x22,0x02,0xcd,0x51,0x92,0x99,0x09,0x22,0xa9,0x91,0x49,0x12,
+0xf8,0x0b,0x20,0xc0,0x48,0x08,0x90,0x09,0x28,0xba,0x03,0x78,0x10,0xa1,0xdc,0x40,
+0x81,0xc8,0x8a,0x54,0x98,0xb9,0x58,0x13,0xb8,0xaf,0x53,0x00,0xbb,0x51,0xb2,0x0c,
+0x81,0x00,0x08,0x91,0x1d,0x90,0x94,0x2a,0x02,0x2b,0x97,0x0d,0x10,0x82,0x90,0xa0,
+0x0f,0x00,0x22,0xe1,0x2b,0x92,0x12,0x91,0x9f,0x33,0x92,0x9d,0x9a,0x48,0x96,0xac,
+0x20,0x33,0xc8,0x9b,0x44,0x01,0xbf,0x51,0x91,0x88,0x8b,0x25,0x99,0x99,0x58,0x81,
+0xab,0x22,0x80,0xbd,0x62,0x81,0x9b,0x22,0xb0,0x8d,0x23,0x90,0xb9,0x6a,0x05,0xcb,
+0x40,0x80,0xb8,0x2a,0x01,0x09,0x92,0x39,0x03,0xba,0xcf,0x36,0xa1,0x9d,0x31,0x92,
+0x19,0xeb,0x38,0x84,0xaa,0x1b,0x17,0x99,0x99,0x12,0x09,0x83,0x0a,0xa3,0x8f,0x32,
+0x91,0x9f,0x32,0x92,0xdc,0x4a,0x05,0x99,0x0a,0x21,0x88,0x9a,0x23,0xa8,0x8a,0x41,
+0xa1,0xae,0x47,0xba,0x22,0xb0,0x0e,0x24,0xd9,0x08,0x22,0xe0,0x28,0x91,0x89,0x39,
+0xb3,0x0e,0x22,0x88,0xa8,0x31,0xba,0x01,0x8c,0xb3,0x5b,0x05,0xcb,0x22,0x60,0xb8,
+0x08,0x99,0x41,0xa8,0xa8,0x72,0xb2,0x9e,0x38,0x95,0x9c,0x61,0x91,0xcb,0x30,0x04,
+0xab,0x10,0x11,0x9a,0x09,0x31,0xa2,0xc1,0x8f,0x17,0xaa,0x18,0x33,0xd9,0x89,0x42,
+0xa1,0x9d,0x43,0x98,0xbc,0x48,0x04,0x9a,0x1b,0x13,0x80,0x8c,0x23,0x88,0x92,0x9d,
+0x40,0x04,0xdc,0x38,0x81,0xa0,0x8b,0x26,0x1a,0xc1,0x8a,0x34,0x09,0xda,0x34,0xb9,
+0x0b,0x08,0x04,0x09,0xbc,0x41,0x80,0xfc,0x52,0xa0,0x89,0x34,0xe0,0x0b,0x34,0xb0,
+0xae,0x43,0xa0,0x9a,0x22,0x01,0xab,0x21,0xa0,0x0b,0x45,0xc0,0x19,0x80,0x18,0x98,
+0xa8,0x2c,0x17,0xca,0x0a,0x35,0xa2,0x9d,0x32,0xb2,0x9b,0x51,0xa2,0x9c,0x81,0x28,
+0xb2,0x20,0xad,0x73,0xd8,0x09,0x21,0xa3,0x8e,0x23,0x88,0xc9,0x48,0x00,0x90,0xbb,
+0x22,0x12,0x0c,0xb1,0x01,0x9f,0x62,0x90,0x38,0xb0,0x0a,0x59,0xb2,0xbb,0x55,0x02,
+0xbe,0x10,0x01,0xb1,0x5a,0xa3,0x9e,0x52,0x91,0x9b,0x11,0x82,0x9b,0x01,0x98,0x20,
+0x87,0xcc,0x29,0x25,0xc0,0x8b,0x31,0x82,0xcb,0x41,0x81,0x18,0xc1,0x0d,0x13,0x99,
+0xaa,0x73,0xb8,0x18,0xa0,0x40,0x00,0xb1,0x3d,0x95,0x8b,0x15,0x09,0xba,0x42,0xd0,
+0x8b,0x58,0xa4,0xac,0x50,0x02,0xbc,0x43,0x80,0xaa,0x88,0x13,0xab,0x89,0x26,0xcb,
+0x29,0x96,0x0c,0x21,0x01,0xb8,0x2b,0x05,0x08,0xfb,0x70,0x91,0x89,0x88,0x31,0xa8,
+0xca,0x50,0x03,0xaf,0x31,0x12,0xbc,0x38,0x83,0x9a,0x09,0x33,0xb0,0xac,0x40,0x91,
+0x8a,0x55,0xc9,0x19,0x11,0x98,0x8a,0x83,0x8a,0x74,0xf8,0x1a,0x23,0x99,0x88,0x18,
+0x91,0x19,0xfb,0x4a,0x81,0x91,0x29,0x10,0xd0,0x29,0xa3,0x0c,0x46,0xb8,0x8b,0x23,
+0xc9,0x12,0x40,0xa0,0x28,0xd0,0xac,0x32,0x24,0x80,0xbb,0x58,0x85,0x8c,0xa2,0x70,
+0xb0,0x9b,0x98,0x22,0x08,0x98,0x11,0x85,0x9f,0x03,0x01,0x00,0x8b,0xf9,0x21,0x58,
+0xa8,0xa8,0x51,0xa8,0x9b,0x42,0x84,0x1a,0x09,0xf0,0x48,0x11,0x82,0xbf,0x48,0x93,
+0xad,0x32,0xa1,0x9b,0x81,0xbb,0x78,0x87,0x9a,0x30,0x90,0x89,0x90,0x0b,0x27,0x98,
+0xba,0x62,0xa0,0x9a,0x50,0x83,0x9d,0x38,0x03,0xcc,0x40,0x10,0x90,0x8a,0x08,0x01,
+0x81,0x8c,0x30,0x33,0xf8,0x1c,0x30,0xc3,0x1c,0x14,0x99,0xbb,0x21,0x99,0x31,0xb1,
+0x78,0xf0,0x8a,0x59,0x04,0xc9,0x0a,0x12,0xa9,0x20,0x43,0xa8,0x88,0x20,0xfb,0x3b,
+0x25,0xa8,0x9d,0x21,0x01,0xba,0x28,0x05,0x98,0x09,0x35,0xc0,0x8a,0x08,0xb2,0x9f,
+0x52,0x83,0xdc,0x3a,0x15,0xdb,0x29,0x14,0xa0,0x89,0x81,0x29,0x85,0x8e,0x13,0x09,
+0x88,0x18,0xa8,0x8a,0xa0,0x49,0x23,0x8a,0x25,0x88,0xbd,0x61,0x91,0x8a,0x33,0xcd,
+0xa9,0x53,0xa8,0x0b,0x45,0xd8,0x1b,0x22,0x82,0x88,0x9e,0x52,0xa2,0x9d,0x30,0x85,
+0xaa,0x18,0xa0,0x29,0x03,0xfb,0x40,0x83,0x9c,0x28,0x04,0xbb,0x02,0x18,0xa3,0x9b,
+0x18,0xa0,0xba,0x76,0x91,0xac,0x53,0xa0,0x8a,0x31,0xa8,0x40,0x96,0xbc,0x30,0x04,
+0xaa,0x0a,0x81,0x48,0xd1,0x8d,0x73,0x91,0xac,0x42,0x80,0x8a,0x01,0x8a,0x00,0xda,
+0x39,0x15,0xc9,0x0a,0x34,0xda,0x28,0x12,0x90,0xbb,0x48,0x23,0xfb,0x39,0x06,0xc9,
+0x09,0x23,0xc8,0x18,0x01,0xa9,0x00,0x00,0x50,0x94,0x8c,0x23,0xc9,0x19,0x13,0xbd,
+0x40,0x91,0x9e,0x41,0x82,0x9b,0x20,0x84,0xab,0x00,0x02,0x99,0x9b,0x14,0x80,0xac,
+0x28,0xe3,0x9e,0x62,0x92,0xac,0x59,0x84,0xba,0x29,0x16,0x98,0x89,0x81,0x8a,0x91,
+0x0a,0x25,0xa8,0x29,0x06,0xac,0x53,0xa3,0x9c,0x30,0xb8,0x2a,0x81,0xa8,0x89,0x9a,
+0x42,0xe3,0xaf,0x43,0x81,0xca,0x48,0x84,0xaa,0x19,0x33,0x81,0xab,0xad,0x22,0xd9,
+0x1b,0x44,0x92,0x8b,0x31,0x21,0x98,0x82,0x70,0xf2,0x0c,0x14,0xab,0x00,0x00,0x92,
+0x9f,0x18,0x33,0xe9,0x39,0x06,0xaa,0x20,0x23,0xba,0x9c,0x41,0xa0,0x9a,0x88,0x43,
+0xfa,0x29,0x14,0xba,0x48,0x02,0x81,0xcc,0x19,0x34,0xe8,0x0c,0x12,0x99,0x29,0xb2,
+0x9f,0x53,0x91,0x8a,0x31,0x02,0xdb,0x29,0x24,0x88,0xbd,0x18,0x41,0xb0,0x9c,0x72,
+0x91,0x88,0x18,0x98,0x42,0xb1,0x0b,0x41,0xb0,0xeb,0x29,0x01,0x9b,0x08,0x26,0x89,
+0x88,0x2a,0x26,0x81,0xce,0x50,0x92,0x9d,0x20,0x91,0xbc,0x51,0x03,0xbc,0x28,0x25,
+0xba,0x1a,0x23,0x88,0xb0,0x2b,0x01,0x80,0xaa,0x30,0x11,0xbe,0x72,0x91,0xc8,0x70,
+0x91,0xbb,0x70,0x82,0xcb,0x29,0x14,0xd9,0x18,0x12,0xba,0x48,0x03,0xb9,0x5a,0x03,
+0xca,0x9b,0x64,0x90,0x8a,0x11,0x80,0x99,0x19,0x62,0xa8,0x8a,0x02,0xac,0x50,0xb0,
+0x38,0x04,0xdc,0x3a,0x16,0xca,0x1a,0x24,0xb8,0x9c,0x51,0xa1,0x8a,0x10,0x82,0x2a,
+0x94,0xbd,0x40,0x22,0xea,0x0a,0x44,0xb0,0x8c,0x33,0x99,0x98,0x48,0x83,0x8c,0x11,
+0x43,0xfa,0x19,0x11,0xc8,0x28,0x84,0x9d,0x31,0x91,0x9c,0x42,0x81,0x9b,0x28,0x84,
+0xdd,0x29,0x14,0xb9,0x09,0x24,0xc9,0x28,0x18,0xa0,0x1a,0x17,0xa9,0x09,0x12,0xb0,
+0x2d,0x06,0xaa,0x08,0x11,0x81,0xbd,0x0a,0x72,0x84,0x9c,0x10,0x32,0xa0,0x9d,0x12,
+0x23,0xec,0x89,0x11,0x09,0xa2,0x08,0x89,0x10,0xd2,0x19,0x72,0x16,0xba,0x18,0x31,
+0xd8,0x9d,0x21,0x12,0xea,0x29,0x14,0x89,0x89,0x43,0xa9,0x0b,0x15,0xba,0x32,0x98,
+0x99,0x21,0xfa,0x8d,0x31,0xa1,0x8a,0x19,0x83,0xad,0x70,0x94,0x0a,0x11,0x80,0xeb,
+0x41,0xa8,0x80,0x80,0x0a,0x91,0xbc,0x60,0x11,0x04,0x88,0x38,0xd1,0x29,0x42,0xe1,
+0x0b,0x12,0xb8,0x9d,0x20,0x22,0xca,0x11,0x49,0x85,0x88,0x11,0xce,0x23,0xa0,0xbe,
+0x58,0x92,0xa8,0x8b,0x22,0x98,0x35,0xb9,0x33,0x41,0xb2,0xcf,0x33,0xa0,0x8b,0x98,
+0x19,0x92,0xbe,0x19,0x14,0xeb,0x4a,0x16,0x09,0x91,0x08,0xb9,0x52,0xa1,0x08,0x9b,
+0x80,0x99,0x98,0x33,0x72,0x05,0xb8,0x1b,0x65,0xa0,0x0b,0x13,0xb8,0xac,0x53,0xa0,
+0x01,0xbb,0x44,0xa1,0x9e,0x01,0x01,0x88,0xa0,0x0a,0x02,0xed,0x4b,0x14,0xb8,0x0a,
+0x44,0xe9,0x1a,0x43,0x90,0xac,0x51,0xa2,0x9c,0x12,0x80,0x99,0x10,0xb9,0x60,0x92,
+0x9f,0x21,0x13,0xba,0x19,0x22,0xb0,0x3b,0xa5,0x8a,0x9b,0x35,0xe1,0x1c,0x35,0xa0,
+0x99,0x41,0xb8,0x29,0xa3,0x8e,0x42,0x91,0xbb,0x09,0x14,0xaf,0x10,0x11,0x13,0xdb,
+0x10,0x18,0x81,0x48,0xd3,0x19,0x02,0x8c,0xf8,0x2a,0x33,0xf8,0x9c,0x52,0x92,0x8b,
+0x30,0xb0,0x8a,0x32,0xb8,0x48,0x24,0xec,0x88,0x81,0x88,0x20,0x91,0x40,0xa1,0x1a,
+0xa3,0x3d,0x47,0xa9,0x19,0x00,0x00,0xa8,0xdc,0x28,0x34,0xf9,0x89,0x30,0x92,0x30,
+0x88,0x19,0x27,0xd9,0x1a,0x22,0x00,0xc0,0xab,0x30,0xb1,0xac,0x41,0x05,0xbb,0x90,
+0x88,0x40,0x55,0xa8,0xb9,0x08,0x08,0x02,0xce,0x10,0x25,0xa8,0x9a,0x40,0x02,0xb1,
+0x9f,0x23,0xa0,0x09,0xc0,0x9b,0x23,0xac,0x2a,0x27,0xd0,0x2b,0xa1,0x2a,0x37,0x90,
+0x09,0x01,0xad,0x23,0x9a,0xa9,0x68,0xa2,0xbb,0x20,0x72,0x06,0x99,0xa9,0x22,0xb8,
+0x0d,0x15,0x99,0x80,0x18,0xd9,0x58,0x92,0x9b,0x20,0x12,0xfa,0x5b,0x02,0xba,0x48,
+0x14,0xb9,0x19,0x23,0xf8,0x8b,0x53,0x80,0xaa,0x0c,0x12,0x91,0xae,0x38,0x85,0xba,
+0x08,0x24,0x0b,0xc1,0x18,0x88,0xa8,0x13,0x78,0x96,0xbb,0x31,0x12,0xcb,0x0a,0x33,
+0xa3,0x9e,0x18,0x84,0x9a,0x59,0x17,0xba,0x43,0xa8,0xa9,0x28,0x03,0x98,0x43,0x29,
+0xc2,0x1b,0x08,0x54,0x12,0xeb,0x29,0x23,0xea,0x8a,0x42,0xb0,0x9c,0x80,0x03,0x9d,
+0x11,0x9a,0x81,0x89,0x92,0x2e,0x35,0xa2,0xdd,0x1c,0xa2,0x9d,0x20,0x15,0xca,0x09,
+0x31,0x82,0xac,0x63,0x33,0xb8,0xad,0x31,0x90,0x99,0x49,0x94,0xcb,0x0c,0x13,0x90,
+0x08,0x10,0x98,0x23,0xc8,0x38,0x43,0xca,0x18,0x02,0x8b,0x3d,0xe4,0x48,0x81,0x81,
+0xac,0x44,0x00,0x28,0x03,0xb9,0xbf,0x25,0x88,0xa1,0x8d,0x11,0xa0,0x9a,0x41,0xc1,
+0x8c,0x88,0x92,0x39,0x53,0x25,0xe9,0x9b,0x12,0x90,0x8b,0x01,0xf2,0x0d,0x28,0x82,
+0x08,0x48,0x91,0x38,0x80,0x81,0x41,0xb3,0x2b,0x23,0xfa,0xac,0x9a,0x54,0x98,0xbb,
+0x30,0x76,0xb0,0x99,0x53,0x08,0x99,0xb0,0x2c,0x18,0x81,0xa2,0x9b,0x11,0x8a,0xa2,
+0x4a,0x67,0x82,0x0b,0x12,0x10,0x32,0x11,0x8b,0xf3,0xbe,0x29,0x33,0xae,0x10,0xa1,
+0xab,0x49,0x82,0x99,0xd0,0x6a,0xa1,0x99,0x11,0xc2,0x0c,0x18,0xd9,0x30,0x08,0x05,
+0x0a,0x01,0x48,0x85,0x9a,0x43,0x99,0x12,0x30,0x88,0x22,0x77,0xc8,0x28,0x12,0xf9,
+0x19,0x09,0x92,0x91,0x1f,0x03,0x89,0xa8,0x48,0x80,0xa0,0x59,0x81,0xbc,0x78,0x84,
+0xbd,0x28,0x83,0xca,0x4a,0x03,0xc8,0x0a,0x34,0xa8,0x8a,0x32,0xca,0x09,0x34,0x9b,
+0x0a,0x27,0x18,0x38,0xa5,0x09,0x48,0xb2,0xad,0x38,0x04,0xba,0x89,0x22,0xed,0x89,
+0x88,0xa1,0xb9,0x79,0x91,0x80,0x12,0x98,0x0c,0x26,0xb8,0x8b,0x24,0x83,0x8b,0x13,
+0x9b,0x37,0x1b,0x83,0xa8,0x11,0x7a,0xc1,0xa8,0x8d,0x80,0xa1,0x0d,0x32,0xe0,0x8a,
+0x9a,0x88,0x20,0x20,0x29,0xb7,0x5b,0x22,0xa0,0x11,0x35,0xcc,0x09,0xb0,0x79,0xa3,
+0x00,0x9a,0x35,0xa9,0x01,0x41,0xc3,0xab,0x12,0x09,0x30,0xf0,0xa9,0x88,0x14,0x9d,
+0xa8,0x32,0x11,0xb8,0x1f,0x90,0x11,0xca,0x08,0x9d,0x05,0x98,0x88,0x3a,0xc3,0xb8,
+0x7a,0x87,0x89,0x90,0x2a,0x81,0x43,0xc9,0x33,0x61,0xb9,0xc8,0x51,0x08,0xc0,0x88,
+0x18,0x1a,0xf0,0x43,0x08,0xb0,0x8a,0x20,0xa3,0x8a,0x2a,0x93,0x30,0x8c,0x07,0x9a,
+0x41,0xa9,0xbb,0x96,0x19,0x3e,0xc2,0x22,0x22,0x1a,0x2a,0xa4,0xd9,0x52,0x10,0x0c,
+0xb3,0x99,0xa9,0xca,0x3a,0xb6,0x39,0x85,0xab,0xda,0x68,0x91,0x98,0x89,0xda,0x08,
+0xa9,0x8c,0x91,0xcb,0x38,0x41,0x15,0xa9,0x55,0x99,0x21,0xa0,0x09,0x21,0x00,0x9c,
+0xb1,0x12,0x9e,0x53,0xa3,0x84,0xaf,0x03,0x10,0x00,0x19,0x03,0x03,0x89,0x84,0x0f,
+0x14,0xd9,0x9c,0x21,0x98,0x39,0x81,0x07,0x1c,0x13,0x80,0x2b,0x14,0xdd,0x29,0x98,
+0xa3,0x29,0xeb,0x19,0x94,0xa8,0x41,0x58,0xd0,0x22,0x09,0x11,0x70,0xb8,0x00,0xca,
+0x3a,0xb9,0xc8,0x29,0x28,0xa9,0x41,0x01,0x60,0xb8,0x43,0x28,0x00,0xa2,0x90,0x0f,
+0xe0,0x1b,0xa2,0x19,0x44,0xca,0x28,0x13,0x48,0x01,0xa1,0x3c,0x83,0xfb,0xab,0x28,
+0xab,0x00,0x9b,0x17,0x09,0x39,0x17,0x9b,0x82,0x00,0x08,0x81,0x61,0x05,0x0c,0xa3,
+0x00,0x0c,0xba,0x04,0x83,0x0f,0xb0,0x01,0x22,0x29,0x09,0x21,0xe4,0x09,0x63,0x8a,
+0x11,0x97,0x0b,0xba,0x18,0xa5,0x89,0x1b,0x04,0x12,0x00,0x00,0x33,0xa0,0xff,0x28,
+0x90,0x88,0x01,0xae,0xb8,0x80,0x10,0xa9,0x20,0x0a,0x77,0x81,0x29,0x12,0x81,0x31,
+0x09,0xee,0x09,0x83,0x1b,0x52,0xba,0x08,0xb0,0x78,0x91,0x89,0x03,0x39,0xd2,0xab,
+0x39,0xd8,0xa9,0x30,0xd8,0x68,0x10,0xd3,0x2b,0xab,0x54,0x81,0xb0,0x39,0x92,0x39,
+0x9a,0xd5,0x20,0x0b,0xbe,0x07,0x00,0x89,0x1a,0x06,0x10,0xc9,0x30,0x02,0xab,0x19,
+0x92,0xd8,0x40,0x9b,0xf8,0x00,0x2a,0xc1,0x01,0x1c,0x04,0x11,0x80,0x38,0x20,0xb6,
+0x0b,0x09,0x90,0x99,0xec,0x08,0xb9,0x2a,0x75,0x88,0xa0,0x54,0x98,0x90,0x10,0x90,
+0x59,0xc1,0x20,0x9a,0xa9,0x39,0xb7,0x38,0x39,0xb3,0x03,0x1e,0x20,0xb3,0x13,0x00,
+0x8a,0x38,0xf8,0xef,0x10,0x88,0x09,0x1a,0x33,0x19,0x11,0x92,0x2f,0xb8,0x84,0x28,
+0x08,0xba,0xd1,0x0e,0x02,0xba,0x5a,0xb0,0x88,0x33,0xc2,0x1f,0x99,0x95,0x83,0x1c,
+0x49,0xd2,0x90,0xba,0x31,0x99,0x20,0x83,0x43,0x51,0xca,0x18,0x04,0x38,0x53,0xe3,
+0x28,0x30,0xba,0x98,0xa0,0x0d,0x10,0x0d,0x04,0x8a,0x81,0xab,0x84,0x1f,0xc0,0x38,
+0x10,0xa3,0x1b,0x8f,0xc1,0x08,0x22,0x0b,0x38,0xa6,0x8a,0x00,0x58,0xa9,0x91,0x1f,
+0x11,0xf3,0x1a,0x31,0x8a,0xe0,0x12,0x29,0x99,0x89,0x14,0xf3,0x69,0x91,0x00,0x0a,
+0x00,0xc0,0x49,0xb1,0x29,0x83,0x0d,0x00,0xb8,0xb2,0x4e,0x10,0x91,0xca,0x12,0x15,
+0x1c,0xa0,0x03,0x01,0x8e,0x92,0x80,0xac,0xa2,0x32,0x0f,0x22,0xc2,0x11,0x8f,0x90,
+0x28,0xb3,0x14,0x3c,0x98,0xb1,0x1a,0x06,0x0b,0x10,0x8e,0xc3,0x88,0x3c,0x91,0x27,
+0xa0,0x01,0x19,0x00,0xc3,0x48,0xb8,0xb9,0x73,0x08,0xaa,0x98,0x34,0xc9,0x30,0x10,
+0xf3,0x58,0x00,0x9d,0x90,0x41,0xa9,0x01,0x89,0x39,0xf0,0x09,0x28,0x81,0x18,0xbf,
+0x22,0x9a,0x92,0x42,0x2b,0x3a,0x97,0x09,0x2d,0x13,0x03,0x0a,0xc2,0x00,0x29,0x33,
+0x2e,0x85,0xb0,0x0f,0x91,0x01,0x0b,0x43,0xa4,0x9e,0x10,0x93,0x2b,0xa0,0x99,0x43,
+0x91,0x1f,0xf0,0x12,0x1c,0x08,0xa4,0x8a,0x08,0x1d,0x83,0x13,0xac,0x18,0xa8,0xa1,
+0x45,0x90,0x9b,0x22,0xf9,0x09,0x99,0x18,0x8a,0xa6,0x38,0xe9,0x38,0x02,0xeb,0x11,
+0x11,0x1a,0x13,0x01,0x9f,0x90,0x00,0x40,0x54,0x99,0x83,0x29,0xba,0x71,0xd8,0x13,
+0x98,0x8c,0x01,0x09,0xb9,0x92,0x1b,0x70,0x82,0xc5,0x2a,0x12,0xa9,0x89,0x08,0x8b,
+0x24,0xf2,0x1b,0x92,0xca,0x1a,0xa7,0x28,0x80,0x59,0xa0,0x90,0x51,0xb0,0x3a,0xda,
+0x22,0xa9,0xa8,0x30,0x80,0x44,0xf0,0x28,0xb0,0x99,0x5e,0x93,0xa0,0x21,0x9c,0x8a,
+0x81,0x49,0x06,0xaa,0x5b,0xa4,0x80,0x98,0x3b,0x86,0x90,0x51,0xbb,0x22,0x98,0x0c,
+0x91,0x8d,0x05,0x10,0x2a,0xd3,0x13,0x3c,0xac,0x91,0xbb,0x60,0x02,0xaa,0x58,0xd1,
+0x0a,0x11,0x10,0x9a,0x63,0xd8,0x8b,0x25,0x8c,0x80,0x03,0xa0,0x78,0x09,0x98,0xa3,
+0x22,0x0f,0x08,0x83,0x3a,0xb2,0x5b,0xf0,0x21,0x99,0x0b,0x11,0x95,0x22,0xab,0x38,
+0x98,0x85,0xad,0xa9,0x31,0x1d,0x90,0x98,0x03,0x0c,0x91,0x91,0x40,0x71,0x01,0xd1,
+0x2a,0x89,0x23,0xea,0x81,0x0e,0x31,0xd3,0x09,0x49,0x94,0x29,0xe0,0x58,0x90,0xa9,
+0x11,0x18,0x9c,0x07,0x19,0x99,0x94,0x08,0x09,0x93,0x09,0x5b,0xb2,0x01,0xa9,0x3b,
+0x02,0xd7,0x2a,0xbd,0x83,0x0a,0x30,0x91,0x10,0x81,0x87,0x59,0xa8,0x82,0xc8,0x51,
+0x18,0xa0,0xba,0x5a,0xb2,0x3a,0xc2,0x90,0x2f,0xa5,0x8b,0x99,0x23,0x59,0x04,0x09,
+0x38,0xb2,0xa1,0x71,0x0c,0xf2,0x11,0x8a,0x08,0x93,0x9d,0x83,0x9a,0x53,0x32,0x9c,
+0xb1,0x10,0xea,0x62,0x88,0xb0,0x20,0x18,0xb8,0x78,0xa9,0x80,0xa0,0xaa,0x70,0x90,
+0x90,0x8a,0x25,0xb9,0x3a,0x11,0xc2,0x2c,0x24,0x08,0xc9,0x53,0xa9,0x59,0x92,0x80,
+0x40,0xf0,0x18,0x10,0xba,0x01,0x00,0x8d,0x19,0x91,0x24,0x9f,0x02,0x99,0x19,0x85,
+0x18,0x20,0xa9,0x22,0x20,0x90,0xfa,0x2d,0xb8,0xa0,0x4c,0xb0,0x07,0x20,0x8c,0x01,
+0xb0,0x52,0xb8,0x0d,0x94,0x09,0xeb,0x28,0x98,0x3b,0x97,0x90,0x2c,0xa1,0x18,0xc3,
+0x10,0x8b,0x23,0x58,0xb0,0xb2,0x59,0x29,0xa3,0x62,0xa8,0x04,0x1c,0x11,0xda,0xb0,
+0x44,0x29,0x82,0xcd,0x00,0x11,0x29,0x09,0xb3,0x19,0x79,0xf4,0x09,0x0a,0x11,0x08,
+0x12,0x01,0xca,0x72,0x98,0xa1,0x84,0x29,0x4a,0xb0,0xa3,0x9e,0x21,0x88,0x82,0xb9,
+0x1c,0x00,0xc6,0x48,0x0f,0x80,0x91,0x20,0x88,0x98,0xb8,0x31,0xe8,0x59,0x80,0xc0,
+0x2a,0x0c,0x04,0xa3,0x6a,0x18,0xb1,0x31,0x88,0xb2,0x0d,0x9c,0x34,0xca,0x01,0x88,
+0x0a,0x9b,0xc4,0x50,0x81,0x72,0xca,0x22,0x2a,0x92,0x1a,0xf1,0x19,0x88,0x83,0x89,
+0x0e,0x80,0x34,0xa8,0x89,0x58,0x84,0x91,0x38,0x8c,0xe2,0x08,0x19,0x21,0x8a,0xcc,
+0x15,0x19,0xa2,0xdc,0x31,0xba,0x33,0x09,0xa9,0x71,0xa2,0x28,0x9f,0x02,0xa9,0x2a,
+0x11,0x8c,0x06,0x10,0x0c,0x90,0x01,0x1b,0x20,0xc4,0x2a,0xb2,0x70,0x94,0xb8,0x20,
+0x99,0xa2,0x8e,0x21,0x83,0x96,0x8f,0xb1,0x10,0x28,0xa1,0xda,0x5a,0x05,0x29,0xc9,
+0x01,0x08,0x0a,0x32,0x49,0xf3,0x01,0x8d,0x08,0x81,0x33,0x88,0xcb,0x19,0xa5,0x38,
+0x0b,0x85,0x98,0x88,0x44,0xb9,0x39,0xfa,0x20,0x98,0x9c,0x09,0xc8,0x43,0x88,0x9e,
+0x20,0x01,0xda,0x40,0x18,0x80,0xa8,0x43,0xf9,0x39,0x10,0x82,0x88,0x91,0x72,0x0c,
+0xb2,0x11,0x1a,0xeb,0x28,0x99,0x00,0x82,0x72,0x91,0x40,0x89,0xa0,0xb5,0x2c,0x8a,
+0x17,0x89,0x01,0x91,0x9d,0x01,0x81,0x9a,0x73,0x00,0xa9,0x00,0xb9,0x15,0x2d,0xb1,
+0x92,0x28,0x8e,0xf9,0x99,0x30,0x18,0xa0,0x8a,0x25,0x0b,0xa2,0x23,0x39,0x80,0xf1,
+0x8e,0x83,0x28,0xb0,0x80,0x8f,0x83,0x00,0x49,0xb2,0x42,0x2b,0xd2,0x39,0xdd,0x31,
+0x00,0x0a,0xa0,0xb0,0x34,0x0b,0xcd,0x16,0x89,0x08,0xc1,0x49,0x33,0x09,0xc3,0x28,
+0x11,0x0f,0xb0,0x01,0x31,0x2b,0x88,0xe3,0x8a,0x58,0x84,0x09,0xbb,0x87,0x8b,0x98,
+0x99,0x28,0x91,0x17,0x8a,0x08,0x85,0x8d,0x01,0x31,0x92,0x8f,0x03,0x91,0x0d,0x39,
+0xa6,0x2a,0x19,0x94,0x08,0x8a,0xe9,0x89,0x02,0x18,0x60,0xa1,0x68,0xc8,0x1a,0x92,
+0x14,0x8a,0xbb,0x84,0x50,0xc0,0x08,0x89,0xa9,0xa0,0x2c,0xf2,0x19,0x34,0x89,0x02,
+0xa4,0x2c,0xa0,0x48,0x82,0x18,0x9b,0x0a,0x98,0x21,0xd3,0x3f,0x90,0xb1,0x22,0x9d,
+0x39,0x47,0x80,0xb0,0x31,0x8e,0xa2,0xb8,0x09,0x00,0x8f,0x03,0xb3,0x14,0x1f,0xa0,
+0x21,0x89,0x8a,0x83,0x91,0x7a,0x98,0x83,0x0c,0x53,0xba,0x81,0x58,0x11,0x92,0x01,
+0xe9,0x74,0xa8,0x02,0x89,0x21,0xb9,0x1b,0xcd,0x03,0x21,0x9c,0x99,0x82,0xa8,0x31,
+0x59,0x05,0x47,0x9a,0x01,0xa8,0x80,0xb8,0x9a,0x6a,0xa3,0x18,0x18,0xb8,0x11,0x4f,
+0xb2,0x94,0x7b,0x08,0xa1,0xa2,0x8f,0x09,0xb2,0x81,0x1a,0xdb,0x01,0x02,0x9a,0x11,
+0x58,0xda,0x20,0xa4,0x48,0x0b,0x10,0xd9,0x83,0x0a,0xa8,0x0f,0xa2,0x23,0x7b,0x88,
+0x24,0xc2,0x9b,0x98,0x8c,0x14,0x88,0x82,0x19,0xdb,0x43,0x81,0x8e,0xa0,0x0b,0x01,
+0x15,0x99,0x35,0xca,0x22,0x80,0xaa,0x67,0x89,0x02,0x01,0xba,0xa1,0x1e,0xa8,0x30,
+0xc0,0x12,0x48,0xb8,0xb9,0x1b,0xb1,0x91,0x5f,0xc2,0x2b,0xd1,0x19,0x91,0x8c,0x94,
+0x2b,0xe0,0x22,0x09,0x99,0x16,0x19,0x9b,0x41,0xf0,0x20,0x89,0x30,0xb0,0x2a,0x91,
+0xc1,0x2a,0x7a,0xd1,0x39,0xa4,0x18,0x8a,0x23,0xb0,0xba,0x01,0xcc,0x55,0x9a,0x81,
+0xa8,0x11,0x48,0x00,0xa0,0xf9,0x71,0x99,0x90,0x11,0x58,0x9c,0xc2,0x28,0x18,0x21,
+0xc0,0x24,0x09,0x22,0x90,0x59,0x83,0xb9,0xbf,0x13,0x23,0xbc,0x1a,0x89,0xa2,0x34,
+0x8f,0x63,0xb8,0x33,0x9b,0xbc,0x44,0x11,0xeb,0x80,0x20,0x88,0x80,0x31,0xd0,0x1b,
+0x06,0x99,0x9e,0x12,0x02,0x5b,0xb0,0x20,0x11,0x8a,0x9d,0x83,0x38,0x3a,0xe3,0xca,
+0x3c,0xd2,0x8a,0x18,0x81,0x79,0xb0,0x90,0x31,0xba,0x17,0x9a,0x08,0xb4,0x10,0x62,
+0x8b,0xb0,0x95,0x4a,0x9f,0x03,0x08,0x11,0x28,0xa0,0xa0,0x6a,0x02,0xb2,0x0e,0x0b,
+0xb2,0x10,0x04,0x1c,0x80,0xb2,0x99,0x69,0x80,0xac,0xc3,0x89,0x49,0x39,0xb5,0x98,
+0x39,0x16,0xab,0xc0,0x33,0x8f,0x00,0x31,0xb8,0x30,0xba,0x35,0x19,0x2b,0xdc,0x14,
+0x08,0xa0,0x71,0x09,0xd1,0x00,0x39,0x88,0xb9,0x80,0xaa,0x85,0x0f,0x03,0x19,0xb3,
+0x8a,0x2d,0x00,0xa5,0x1a,0x13,0x0d,0xb1,0x26,0xcb,0x38,0x02,0x10,0xf9,0x41,0xb0,
+0x8b,0xa8,0x96,0x1b,0x9b,0x97,0x29,0x90,0x02,0x2b,0x14,0x88,0xea,0x2b,0x80,0xa2,
+0x03,0x08,0x2e,0x8b,0xb7,0x10,0x9d,0x10,0x94,0xa9,0x30,0x3a,0x87,0x08,0x8b,0x98,
+0x43,0x88,0x28,0x98,0x82,0x3b,0x58,0xf2,0x30,0xaf,0x22,0x00,0xf0,0x39,0x80,0x08,
+0xab,0x53,0x12,0x08,0x2b,0xc7,0x29,0xaa,0x02,0x18,0x11,0x1a,0xb7,0x1c,0x84,0x2a,
+0xa3,0x1c,0x85,0x19,0xd0,0x53,0xba,0x11,0x31,0xb3,0x9a,0x1d,0x85,0x99,0xba,0x39,
+0xea,0x33,0x3a,0xe2,0x38,0x10,0xa0,0x8b,0x09,0x26,0x02,0xbe,0x00,0x3b,0xa4,0x98,
+0x31,0x1d,0xd4,0x4b,0xb1,0x28,0x90,0x38,0x08,0xe1,0xc8,0xc2,0x4c,0xa2,0x21,0xb2,
+0x2b,0xb8,0x03,0x59,0x1c,0xd3,0x32,0x62,0xd8,0x19,0x80,0xaa,0x30,0xf9,0x11,0x3a,
+0xbb,0x85,0x28,0x01,0x10,0xf0,0x22,0x9c,0x92,0x30,0xf8,0x10,0x30,0xab,0x05,0xca,
+0x10,0x48,0x91,0x91,0xc0,0x0f,0x12,0x00,0x00,0x1a,0xe0,0x51,0x90,0x41,0x89,0x99,
+0x05,0x3a,0x99,0x94,0x88,0x3b,0xfc,0x01,0x19,0x90,0x88,0x11,0x58,0x99,0x91,0xb3,
+0x70,0xa9,0xad,0x06,0x01,0x09,0xd8,0x0a,0xa1,0x21,0x29,0xb8,0x0c,0x11,0x91,0x60,
+0x9e,0xa1,0x20,0x2f,0xa3,0x32,0xea,0x18,0x9a,0x8a,0x81,0x10,0x45,0x1a,0x95,0x00,
+0x9a,0x04,0x8c,0x30,0x89,0x94,0x4a,0x28,0xa1,0x1b,0xb4,0x10,0x73,0xb4,0x93,0x0c,
+0x31,0x88,0xf0,0x89,0x99,0x01,0xab,0x90,0x70,0x13,0xb0,0x0b,0x04,0x0e,0xa0,0x34,
+0x1d,0xa2,0x98,0x8d,0x19,0x23,0xd8,0x12,0x34,0xcc,0x08,0x8a,0x97,0x28,0x90,0x28,
+0xb0,0x08,0x21,0xa4,0x9b,0xef,0x12,0xaa,0x22,0x8d,0xb1,0x32,0xbd,0x01,0x05,0x3a,
+0x81,0x03,0xac,0x12,0x9a,0xc9,0x82,0x10,0x1f,0xaa,0x05,0x19,0x41,0x90,0xda,0x73,
+0xa0,0x2a,0x81,0xa0,0x02,0x1f,0x12,0x14,0x91,0x0b,0xac,0x14,0x22,0xbb,0x48,0xe9,
+0x10,0x80,0x1a,0xf1,0x3a,0xa8,0x04,0x1a,0xbb,0x07,0x99,0x2c,0xa1,0x22,0xc1,0x40,
+0x9e,0x13,0x8a,0xa1,0x40,0x01,0xa8,0x14,0x0b,0x15,0x08,0xb8,0x8e,0xa8,0x40,0xbb,
+0x01,0x45,0x8a,0x13,0x61,0xc3,0xab,0x28,0xa8,0x38,0xea,0x25,0x38,0xca,0x02,0x3a,
+0xb8,0x07,0x8b,0x98,0x91,0x0a,0xe2,0x39,0x9b,0x96,0x02,0x39,0x11,0xe1,0x20,0x18,
+0xe5,0x18,0x10,0xc8,0x82,0x01,0x4d,0xc1,0x11,0x28,0x08,0xd4,0x2b,0x11,0x00,0xf8,
+0x38,0x8a,0x1a,0xb3,0x1d,0x01,0xc8,0x19,0x49,0x83,0x03,0x10,0x9f,0xb1,0x24,0xb8,
+0x8f,0x00,0x80,0x48,0x91,0x91,0x2f,0x82,0xa0,0xa0,0x2c,0x20,0xaa,0x27,0xaa,0x19,
+0x09,0x2a,0xd1,0x04,0x8f,0x03,0x81,0x90,0x0c,0x98,0x96,0x0a,0x28,0x8a,0x87,0x2a,
+0x80,0x3a,0x91,0xc6,0x2c,0x10,0xa3,0x3a,0x89,0xe9,0x10,0x30,0x89,0x01,0x32,0xff,
+0x01,0x39,0x09,0x92,0x89,0x92,0x12,0x4d,0xd2,0x20,0x01,0x9a,0x88,0x1e,0x87,0x09,
+0x80,0x99,0x91,0x90,0x8f,0xb2,0x08,0x1b,0x45,0xb2,0x29,0x31,0xd8,0x0a,0x2b,0xb3,
+0x49,0xc4,0x18,0x6a,0x23,0xe2,0x38,0xab,0x04,0x1a,0xa1,0x8c,0x23,0xc0,0x08,0x00,
+0xc2,0x7a,0xe9,0x01,0x10,0xaa,0x38,0xda,0x14,0x80,0x28,0x83,0x8f,0x90,0x12,0x9c,
+0x30,0x18,0x82,0x13,0x0c,0x2b,0xc1,0xe9,0x38,0x12,0x42,0x02,0xf9,0x0b,0x81,0x0e,
+0x98,0x03,0xd9,0x38,0x04,0x8b,0xf0,0x20,0x0a,0x12,0x03,0x3c,0x14,0x8d,0xb2,0x19,
+0x32,0x8b,0xb5,0x5b,0x21,0xe0,0x10,0x29,0x80,0x09,0x85,0x8a,0x81,0xdd,0x41,0x98,
+0xb1,0x11,0x05,0x8f,0x92,0x81,0x1b,0xa3,0x0a,0x8f,0x32,0x90,0x03,0x38,0xab,0x60,
+0xe1,0x18,0x49,0xa0,0x03,0x8d,0x00,0x80,0xa0,0x40,0x88,0x83,0xbd,0x24,0x6a,0x98,
+0xc1,0x32,0x89,0x00,0x1a,0xf9,0x1a,0xb0,0x0e,0x29,0x17,0xa0,0x19,0x11,0xb9,0xb3,
+0x4a,0x79,0xb0,0x92,0x1d,0xc8,0x11,0x29,0xc0,0x89,0x83,0x3c,0x19,0xd1,0x62,0x99,
+0x31,0xa1,0x0a,0x99,0x90,0x85,0x1e,0x88,0xa1,0x63,0x9a,0xb1,0x0b,0x17,0x8c,0x81,
+0x33,0x22,0xaf,0xb3,0x12,0x3c,0x98,0xd1,0x51,0x98,0x18,0xab,0x11,0x51,0xc4,0x0c,
+0x8a,0xa1,0x08,0x89,0x12,0x0e,0x00,0x05,0x98,0x20,0x8b,0x84,0xba,0x0b,0xad,0x17,
+0x18,0x8a,0x87,0x10,0x8a,0x89,0x87,0x1b,0xa0,0x10,0x13,0xaa,0xc8,0x59,0xa1,0x2a,
+0xc3,0x38,0xae,0x93,0x2c,0x03,0xea,0xa9,0x40,0x00,0xa0,0x8a,0x2b,0x98,0x67,0x39,
+0x00,0x83,0x0c,0x04,0x38,0x88,0x28,0xf2,0x89,0x23,0x9c,0x2a,0xd2,0x13,0x48,0x80,
+0x0d,0x02,0x91,0x28,0x9d,0x98,0x22,0x81,0xc3,0x9e,0x8f,0xc1,0x21,0x4b,0xa0,0x92,
+0x48,0x31,0xc8,0x81,0x32,0x9d,0x82,0x60,0xa3,0x99,0x8c,0x82,0xea,0x19,0x90,0x61,
+0x90,0x12,0x90,0x0a,0xa8,0x8f,0xb0,0x15,0x2a,0x19,0x93,0x8b,0x50,0x22,0xa4,0xbf,
+0x40,0xb8,0x02,0x19,0x99,0xf9,0x28,0xab,0x03,0xe1,0x28,0x0b,0xc1,0x06,0x49,0x88,
+0xb1,0x10,0x8c,0x80,0x91,0xa0,0x72,0xaa,0x81,0x16,0xab,0x04,0x2c,0x96,0x1a,0x18,
+0xb9,0x22,0x29,0xdc,0x19,0x01,0x85,0x8c,0x80,0x03,0x38,0xf1,0x2c,0x90,0x2a,0x87,
+0x9c,0x22,0x10,0xb8,0xa3,0x10,0x6b,0x83,0xc9,0x23,0x3c,0x90,0x91,0xc3,0x59,0x1c,
+0xb3,0x94,0x2a,0x3b,0xc0,0x99,0x27,0x1c,0x81,0x00,0xa2,0x02,0xbf,0x21,0xc3,0x4b,
+0x01,0xb9,0x61,0xc0,0x99,0x09,0x19,0xb2,0xc8,0x42,0x09,0x82,0x20,0x2c,0xc8,0xd3,
+0x11,0x4d,0xa8,0xa1,0x8b,0x48,0xd0,0x0b,0x20,0x82,0x53,0x2b,0xa1,0xf2,0x60,0x09,
+0xa8,0xc9,0x50,0xa9,0x18,0x81,0x03,0x2a,0xf0,0x40,0x90,0x88,0x99,0x22,0x1a,0xbb,
+0x87,0x1b,0xc0,0x9b,0x20,0x21,0x72,0x86,0x00,0x8a,0xc8,0x20,0x8c,0xd0,0x88,0x43,
+0x39,0xe8,0x11,0x10,0x49,0xb8,0x11,0xa3,0x7a,0xd1,0x92,0x20,0x99,0x34,0xdb,0x13,
+0x20,0x21,0xb8,0x30,0xb8,0xed,0x89,0x22,0x0e,0x82,0x02,0x4a,0xa9,0x1b,0x87,0x88,
+0x4c,0xb0,0x91,0x8b,0x83,0x0d,0x8a,0xf3,0x90,0x68,0x88,0x09,0xb1,0x85,0x1c,0x10,
+0xc0,0x90,0x42,0x1a,0x92,0x91,0x19,0x2a,0x47,0xcb,0x30,0x08,0x83,0xa3,0x9a,0x8d,
+0xd2,0x89,0x03,0x4b,0xf1,0x2a,0x81,0x9a,0x31,0x05,0x03,0xbd,0x80,0x53,0x9a,0x13,
+0x92,0xcc,0x41,0x5a,0x90,0xb2,0x9a,0x79,0x98,0x00,0xa0,0x0a,0xa0,0xda,0x53,0x1b,
+0xf1,0x31,0x10,0xaa,0x99,0x11,0x81,0x2f,0x9a,0x13,0x16,0x8d,0xa2,0x49,0xb8,0x28,
+0xa8,0xb0,0x68,0x98,0x9c,0xb0,0x35,0x21,0xb0,0xb2,0x0d,0x4a,0x86,0x0a,0x99,0xa3,
+0x6b,0x91,0x83,0x5a,0xc8,0x05,0x9a,0x22,0x8a,0x99,0xa2,0x73,0xb0,0x85,0x0c,0x93,
+0x39,0x90,0x03,0x10,0xad,0xaa,0x8f,0x84,0x0a,0x39,0xd2,0x12,0x80,0x8f,0x90,0x15,
+0x9b,0x81,0x88,0x11,0x12,0xaa,0x0d,0xa1,0x07,0x1d,0x91,0x80,0x11,0x82,0x19,0xcb,
+0x04,0x82,0x9f,0x92,0x20,0x8c,0xc8,0x81,0x3c,0x82,0x91,0x14,0xc1,0x0d,0xc8,0x61,
+0x00,0xb1,0x18,0x48,0x00,0xb2,0x00,0x2b,0x07,0x8a,0x8b,0x16,0x81,0x1c,0xaa,0x85,
+0x19,0x11,0x1a,0xcb,0xb5,0x3a,0xa2,0x7b,0xd2,0x89,0x91,0x30,0x9c,0xb1,0x20,0x98,
+0x55,0xaa,0x88,0x02,0x81,0x3f,0x91,0x32,0xaf,0x80,0x03,0x2c,0xa0,0x32,0x94,0x18,
+0x08,0xb2,0x8c,0x87,0x18,0x30,0xaa,0x7c,0xf1,0x00,0x28,0x89,0x01,0x02,0x81,0x8f,
+0x08,0x02,0x90,0xaa,0x0d,0x84,0xaa,0x62,0xa9,0x12,0x29,0x22,0xfb,0x28,0x8b,0xa4,
+0x59,0x10,0x89,0xb1,0x10,0x41,0x41,0xab,0xe8,0x91,0xad,0x09,0x54,0xa9,0x32,0xb9,
+0x0a,0xa9,0x82,0x61,0xc9,0x09,0x73,0xb8,0x10,0x0a,0xc1,0x38,0xa8,0x94,0x0b,0xa8,
+0xa9,0xa3,0x79,0x97,0x9b,0x10,0x89,0x91,0x08,0x79,0xa3,0x11,0xa4,0x6a,0x8c,0xb2,
+0x22,0x19,0x8e,0x92,0xb9,0x23,0x70,0x09,0x84,0x81,0xba,0x7c,0x82,0x9a,0x83,0x79,
+0xc9,0x08,0x10,0x10,0x10,0xf1,0x20,0x0a,0xb9,0x83,0x8a,0x71,0x10,0x89,0x90,0xa3,
+0x0f,0x83,0x0a,0x08,0x00,0xe3,0x40,0x18,0xc8,0x09,0xb1,0x0a,0x0d,0x12,0x02,0x09,
+0xfa,0x53,0x08,0xbb,0x15,0xa1,0x3b,0x22,0xc9,0x07,0x80,0x1d,0xa2,0x82,0x99,0x09,
+0x09,0xe5,0x19,0x10,0x91,0x0a,0xa1,0x90,0x32,0x0f,0x84,0x00,0x01,0x28,0xaa,0xef,
+0xd0,0x10,0x38,0x88,0x10,0x92,0x18,0xbc,0x21,0x4c,0xc0,0x00,0xa0,0x4c,0xa4,0x4a,
+0xb1,0x04,0x1c,0x81,0xc1,0x4b,0x99,0x86,0x1a,0x28,0x82,0xa8,0x09,0x1c,0xb0,0x50,
+0x84,0x89,0x41,0xcc,0x02,0x95,0x2c,0x88,0x21,0xa2,0xba,0x70,0xb0,0x33,0x1a,0x84,
+0x52,0x9e,0x10,0xb2,0x1a,0x19,0x92,0x99,0x9a,0x86,0x6a,0x11,0x0a,0xa1,0x08,0x17,
+0x99,0x68,0xba,0xc2,0x5a,0x80,0x09,0x98,0x92,0x9a,0xbb,0x3d,0x30,0x27,0x00,0xbb,
+0x28,0x02,0x93,0x2b,0x33,0xdf,0x11,0x19,0xd3,0x8c,0xa9,0x65,0x89,0x01,0x8b,0x02,
+0xa8,0x5b,0x86,0x99,0x38,0xa8,0xb1,0x60,0x8b,0x94,0x18,0x32,0xf2,0x19,0x18,0xaa,
+0x24,0x8c,0x18,0x98,0x2b,0xaa,0x97,0x1e,0x99,0x10,0xa2,0x43,0x0a,0x0b,0x04,0xe4,
+0x09,0x51,0x0b,0xc3,0x09,0x22,0x20,0xa2,0x8b,0xa2,0x48,0xfd,0x29,0x99,0x83,0x08,
+0x22,0xac,0x06,0x9a,0x13,0x50,0x99,0xb0,0x00,0x6a,0x81,0xf0,0x08,0x89,0x90,0x81,
+0x9f,0xa1,0x40,0x81,0x12,0x89,0x30,0xd8,0x25,0xcb,0x11,0x99,0x81,0x89,0x81,0x2e,
+0xd8,0x39,0x21,0x85,0x0d,0x91,0x9a,0x1a,0x32,0xe0,0x10,0x01,0x72,0xaa,0x98,0x04,
+0x30,0x28,0xf3,0x2a,0x8e,0xb2,0x22,0x8b,0x0d,0x91,0x99,0x35,0x9e,0xa8,0x10,0x23,
+0x40,0xa0,0xb3,0x40,0x3b,0x94,0x06,0x09,0x19,0x40,0xcb,0x93,0x1f,0xb8,0x13,0x6b,
+0xc8,0x01,0x09,0x20,0x02,0x99,0xe0,0x40,0x0a,0x91,0x13,0x1e,0xa4,0x01,0x09,0x90,
+0x20,0x07,0x99,0x2f,0x82,0x9a,0x11,0x38,0xeb,0x01,0x39,0x9b,0xe3,0x2a,0x32,0xb1,
+0xc0,0x3a,0xac,0x06,0x9a,0x02,0x21,0xe0,0x18,0x9b,0x0a,0x14,0x08,0x17,0x9f,0x02,
+0x8a,0x21,0xe9,0x08,0x0a,0x11,0x99,0xb9,0x01,0x09,0x62,0x0d,0x84,0x29,0x93,0x59,
+0x12,0x9b,0x17,0x0a,0x88,0xa1,0x30,0x4a,0x00,0x94,0xa8,0x9f,0x20,0x93,0x3a,0x3a,
+0xc1,0x27,0x8f,0x88,0x81,0x48,0xa0,0x18,0xca,0x81,0xaa,0x42,0x88,0xb9,0x27,0x28,
+0xa9,0x94,0x8f,0x11,0x90,0x80,0x0c,0x28,0x92,0x0a,0x8e,0xb1,0x06,0x2a,0x2d,0xb3,
+0x92,0x3d,0xb0,0x59,0xa8,0x01,0x13,0x69,0xe8,0x11,0x28,0x20,0xf1,0x09,0x98,0x20,
+0xa8,0x82,0x80,0x89,0x70,0x08,0xe1,0x0a,0x01,0x48,0x00,0xe0,0x12,0x1b,0x99,0x02,
+0x88,0x31,0xf8,0x8e,0x41,0x98,0xa2,0x33,0xac,0x00,0x10,0xf9,0x49,0x82,0x49,0xb0,
+0x93,0x38,0x3d,0x85,0x18,0xb8,0x8a,0x90,0x79,0xd8,0x00,0x21,0x98,0x38,0xa1,0xa0,
+0x02,0xec,0x50,0x9a,0xb1,0x39,0x02,0x29,0xdd,0x12,0xd9,0x59,0x09,0x94,0x89,0x39,
+0x8c,0x82,0x20,0x93,0x91,0x0f,0xf3,0x09,0x00,0x20,0x0c,0xa3,0x53,0x09,0x09,0xa6,
+0x0a,0x38,0xa0,0xf3,0x49,0xa8,0x29,0x91,0x82,0x21,0x4a,0xe1,0x10,0x81,0x28,0xaa,
+0x05,0xbb,0xac,0x21,0xbe,0x94,0x0e,0x13,0x99,0x82,0x1b,0x18,0x86,0x40,0x80,0x98,
+0xa9,0xfa,0x10,0x28,0x0d,0x01,0x87,0x18,0x2b,0x88,0xd3,0x99,0x5a,0xb1,0x19,0xcb,
+0x24,0x99,0x2d,0x92,0x52,0xb8,0x18,0x02,0x98,0x28,0xa4,0xcb,0x0b,0x85,0x1d,0xc4,
+0x1a,0x24,0x99,0x22,0x02,0x9e,0x01,0x85,0x8a,0x5a,0xb9,0x81,0x00,0x33,0x10,0xb8,
+0x84,0x8f,0x05,0x99,0x90,0x80,0xa1,0xaa,0x47,0x88,0x99,0x81,0x22,0x0e,0x13,0x92,
+0x8f,0x83,0x19,0x0b,0x81,0xb2,0x6b,0xe0,0x38,0xd8,0x20,0x8a,0x05,0x1a,0x88,0xa3,
+0x1b,0xde,0x93,0x8c,0x68,0xa0,0x11,0x3a,0xc2,0x89,0x32,0xc8,0x11,0x0d,0x12,0x90,
+0x3c,0xf1,0x28,0x0a,0x93,0x18,0xb9,0x39,0x57,0xaa,0x03,0x0c,0x88,0xa8,0x83,0x0c,
+0x10,0xb8,0x17,0x3a,0xab,0x87,0x08,0x0b,0xa4,0x23,0xa8,0x3c,0x19,0xa7,0x18,0xac,
+0x91,0x35,0xac,0x11,0xb9,0x16,0x8b,0x10,0xd1,0x9a,0x21,0x28,0xb8,0x53,0xa4,0x40,
+0x3a,0x04,0x94,0x8f,0x93,0x19,0x88,0x32,0xf8,0x19,0x88,0x10,0x42,0xd0,0x39,0x40,
+0x80,0x99,0x09,0x9a,0xb1,0xcf,0x19,0x85,0x29,0xb0,0x0b,0x24,0x12,0x00,0xbf,0xa1,
+0x2a,0x28,0x16,0xbb,0x59,0xb8,0x2a,0xb0,0x01,0xba,0x51,0x42,0x9b,0xe4,0x19,0x31,
+0xa4,0x8b,0x1c,0xd2,0x49,0x92,0x8a,0x30,0xb8,0x04,0x2a,0x52,0x1a,0xe4,0x3a,0x32,
+0xd0,0x10,0xa0,0x11,0x28,0x06,0x0d,0xc1,0x28,0x83,0x1a,0x8c,0x97,0x1a,0xa9,0x24,
+0x0a,0x88,0x93,0xdb,0x20,0x00,0x39,0xf1,0x29,0x1a,0x43,0xab,0x95,0xb8,0x0e,0x09,
+0x05,0x22,0xea,0x2a,0x81,0xab,0x83,0x8d,0x01,0xa4,0x4c,0x93,0x11,0x0b,0x47,0xac,
+0x90,0x30,0xa2,0x09,0x49,0x96,0x0b,0x90,0x01,0x2b,0x12,0x41,0x19,0x05,0x10,0x70,
+0xca,0x98,0x13,0xa8,0x2a,0xaa,0x07,0x10,0xfb,0x89,0x12,0x0a,0x0c,0xb1,0x89,0x41,
+0xaa,0xa0,0x0f,0x82,0x91,0x22,0x8f,0x09,0xa3,0xc9,0x69,0x49,0xa2,0x91,0x2b,0x9a,
+0xeb,0x18,0x61,0x91,0xa0,0x2a,0x19,0xb3,0x27,0x9c,0x81,0xa2,0x28,0x08,0xe4,0x1b,
+0x11,0x15,0x09,0x82,0x28,0x30,0xf3,0x0c,0xa2,0x68,0xc9,0x28,0x02,0xb0,0x71,0x9c,
+0x91,0x04,0x29,0x19,0x91,0xa2,0x11,0x2f,0xa0,0xb9,0x68,0x08,0xa1,0x23,0x59,0xc0,
+0x8b,0xa8,0x33,0x39,0x96,0x89,0x1b,0xac,0x26,0xc0,0x19,0x00,0xbb,0x81,0xb8,0x4d,
+0xb4,0x78,0xa9,0x13,0x31,0xca,0x19,0x19,0xfb,0x31,0x83,0x8a,0x19,0x16,0xf0,0x00,
+0x3b,0xa8,0x84,0xac,0x11,0x0a,0x38,0xc2,0x99,0x1b,0x9e,0x04,0x19,0x83,0xa9,0x89,
+0x49,0x84,0x21,0x0c,0x94,0x50,0x8a,0xa8,0x05,0x11,0x1b,0x11,0x19,0xf8,0x9a,0x72,
+0xa9,0x2b,0x10,0xd3,0x31,0xb9,0x10,0x2c,0x83,0x93,0xbd,0x3d,0x93,0x50,0x90,0x80,
+0x3b,0x9a,0x97,0x0f,0x95,0x8a,0x28,0xa1,0x19,0x38,0x99,0xf4,0x3b,0x1a,0xd2,0x8a,
+0x14,0x1b,0x90,0x22,0x70,0xa1,0x80,0x81,0x0e,0x13,0x28,0x9b,0xe4,0x1b,0x90,0x0b,
+0x25,0x8d,0x15,0x9a,0x23,0x08,0xb3,0x9a,0x4c,0xa5,0xa9,0x40,0x10,0xb2,0x01,0x7a,
+0x81,0x8a,0xc0,0x33,0x0c,0xb8,0x8b,0xc3,0x31,0x3c,0x84,0xa8,0x44,0xc1,0x0c,0x00,
+0x9b,0x26,0xd2,0x8a,0x28,0xb4,0x4b,0xa1,0x9a,0xd0,0x0a,0x82,0x3b,0xa5,0x51,0x88,
+0x13,0x81,0x8d,0x8a,0x14,0xb1,0x2c,0xc0,0x8f,0x98,0x23,0x0c,0x92,0x4a,0x8d,0x83,
+0x92,0x2b,0x19,0x14,0x11,0xab,0x25,0x2b,0xc4,0x8d,0xb2,0x7a,0x80,0x91,0x2a,0x90,
+0xb0,0x7b,0x01,0x10,0xa9,0x8b,0x27,0x30,0x80,0xac,0x83,0x29,0x1f,0x90,0x08,0x83,
+0x28,0x1d,0x10,0x14,0xa0,0x10,0x39,0xdf,0xb2,0x30,0xa0,0x2c,0xa3,0xa5,0x3d,0x0a,
+0xc2,0x90,0x7a,0xb0,0x42,0xa1,0x3b,0xab,0x95,0x28,0xa9,0x26,0x9e,0x83,0x99,0x30,
+0x98,0xa8,0x53,0xac,0x04,0x0d,0xb0,0x31,0x3b,0x43,0xc9,0x13,0x0d,0x9a,0x85,0x0b,
+0x80,0x98,0xa2,0x41,0x33,0xef,0x10,0x82,0x29,0xb1,0x99,0x13,0x9e,0xa2,0x48,0x01,
+0x04,0x4a,0xea,0x11,0x29,0x87,0x0a,0x08,0xb1,0x09,0x42,0xa1,0x9b,0x99,0xa0,0x29,
+0x44,0xc0,0x3b,0x93,0x27,0xcf,0x12,0x98,0x38,0x90,0x81,0x03,0x1d,0x98,0x20,0xa5,
+0x00,0x3a,0xa0,0x81,0xfb,0x29,0x09,0xee,0x30,0x81,0x08,0x9a,0xaa,0x59,0xb5,0x20,
+0x8d,0x81,0x29,0xb4,0x0f,0x80,0x11,0x22,0x8c,0x99,0x92,0x85,0x50,0x0a,0xb0,0x97,
+0x20,0x9a,0xa0,0x19,0xa3,0xc0,0x7b,0x08,0x02,0xb9,0x49,0x99,0xb2,0x23,0x2f,0xd9,
+0x84,0x38,0x1a,0xd1,0x01,0x1a,0x92,0xea,0x3a,0xa2,0x2a,0x92,0x53,0xb1,0x2a,0x95,
+0x0b,0xac,0xa1,0x17,0x1c,0x81,0x10,0xf1,0x20,0x49,0x00,0xf2,0x18,0x39,0xd0,0x82,
+0x8a,0x29,0xa2,0x32,0xb9,0x38,0xbb,0x46,0xca,0x06,0x1b,0x8a,0xa0,0xa3,0x1c,0x41,
+0x02,0x72,0xb0,0x08,0x20,0xf8,0x18,0x98,0x88,0x04,0x32,0x0a,0xa9,0xc6,0x1a,0x0c,
+0xa1,0x41,0x86,0x1b,0x99,0x88,0x04,0x89,0x9f,0xa3,0x8a,0x28,0x85,0x48,0x91,0xa2,
+0x2f,0x91,0x21,0x99,0x88,0x2a,0xb2,0xf8,0x59,0x90,0x08,0x02,0xa9,0x08,0xa1,0x12,
+0xef,0x41,0x9b,0x91,0xa2,0x18,0x51,0x8a,0x09,0x25,0xac,0xa1,0x09,0x7b,0xa8,0x83,
+0x10,0x2b,0x04,0x13,0xbc,0xc2,0x70,0x99,0x01,0x38,0xc3,0x99,0x0c,0x41,0x14,0x92,
+0xf0,0x1d,0x28,0x82,0x08,0x00,0xb0,0x2e,0xb3,0xaa,0xa9,0x21,0x28,0xb5,0x40,0x01,
+0x0a,0x1f,0x97,0x19,0x0a,0x81,0x81,0xc9,0x51,0xc9,0x01,0x09,0x29,0x21,0xb3,0x9b,
+0x1a,0x27,0x7b,0x90,0xa2,0x8a,0x88,0x0d,0x20,0xb2,0x28,0xd6,0x39,0x10,0x0a,0xf2,
+0x39,0x8c,0x22,0xcc,0x21,0x82,0x0b,0x02,0x17,0x8b,0xda,0x24,0x1a,0xa8,0x94,0x18,
+0x00,0x19,0xad,0x17,0x8c,0x10,0x11,0x88,0xb1,0x88,0x79,0xb0,0x84,0x5a,0xb9,0x00,
+0x90,0x09,0x28,0x21,0xca,0xc8,0x44,0x28,0xb8,0xa0,0x13,0x9f,0x02,0xa1,0x2b,0x87,
+0x0c,0x38,0xd0,0x01,0x38,0x8d,0xa2,0x11,0x0e,0x10,0xa1,0x29,0xb1,0x2f,0xb0,0x02,
+0x5d,0xb1,0x20,0x80,0x22,0x0c,0xa9,0xa2,0x74,0x00,0x00,0x00,0xab,0xa0,0x1f,0xd8,
+0x11,0x80,0x8c,0x13,0xa8,0x04,0x1b,0x90,0x38,0x27,0x79,0x99,0xb3,0xa8,0x10,0x9c,
+0x00,0xeb,0x91,0x31,0xa9,0xac,0x31,0x00,0x94,0x0f,0x93,0x19,0x80,0xda,0x20,0x9b,
+0x45,0xe0,0x49,0x00,0xc0,0x38,0x41,0xcc,0xa1,0x38,0x19,0x99,0xb4,0x38,0x33,0x28,
+0xf8,0x31,0xa8,0x9c,0x09,0x01,0x07,0x9c,0x12,0x3b,0x95,0x20,0xa9,0x22,0x8c,0xa0,
+0x07,0x08,0x48,0xd1,0x19,0x09,0xd2,0x2a,0x03,0x32,0x0d,0x84,0x01,0x0c,0x9b,0x26,
+0x8c,0xc1,0x92,0x6a,0x08,0xc0,0x18,0x00,0x08,0x88,0x81,0x0e,0x91,0x31,0x20,0xd0,
+0x49,0xa1,0x8b,0xb1,0x88,0x9f,0x44,0x18,0xba,0x10,0x34,0xa8,0x12,0x1b,0xea,0x26,
+0x80,0x3d,0xe8,0x00,0x82,0x98,0x4a,0xa2,0xb0,0x29,0x8c,0x99,0x81,0x44,0x00,0x00,
+0x09,0xb5,0x0d,0x3b,0xf4,0x31,0xba,0x88,0x41,0xb0,0x80,0x2c,0x11,0x34,0xf0,0x09,
+0x29,0xbb,0x83,0x73,0xb0,0x29,0xb2,0x40,0xb1,0x8d,0x10,0x23,0xf9,0x2c,0x0a,0x02,
+0x02,0x98,0x80,0x1e,0x05,0x90,0x70,0x99,0x02,0xe8,0x21,0x89,0x99,0x02,0xa8,0x29,
+0x42,0x28,0x09,0xc3,0x29,0xfb,0x2a,0x13,0xaa,0xe3,0x19,0x08,0x33,0x80,0x41,0x3a,
+0xf3,0x88,0x6a,0x09,0xfb,0x84,0x0c,0x10,0x91,0x39,0x00,0xb2,0x2c,0x9b,0x13,0x17,
+0x29,0x89,0xf8,0x19,0x50,0x90,0x99,0xa0,0x2c,0xf8,0x3b,0x11,0x01,0x03,0xaa,0x28,
+0xab,0xaf,0x83,0x61,0x0b,0x12,0xf0,0x08,0x89,0x49,0x19,0xd8,0x04,0x09,0x19,0x40,
+0x81,0xd8,0x83,0x1a,0x0f,0x92,0xb1,0x7a,0x93,0x88,0x3b,0xc1,0x52,0xb8,0x80,0x1c,
+0x02,0x09,0xa2,0x22,0x1f,0xc9,0x01,0x80,0x40,0x28,0xd3,0xaa,0x49,0x32,0x11,0xab,
+0xa1,0x94,0x7c,0x29,0xc1,0x80,0x80,0x3c,0xfb,0x28,0x00,0x93,0x11,0x48,0xab,0xb0,
+0xca,0x52,0x21,0x41,0xc1,0xb1,0x1d,0x06,0x99,0xc2,0x2e,0x91,0x80,0x10,0x08,0x99,
+0x33,0xab,0x99,0x80,0x9b,0x07,0x88,0x2b,0x9f,0xb3,0x98,0x70,0x02,0x19,0x90,0xb2,
+0x9c,0x2b,0x4b,0x97,0x09,0x0a,0x09,0x07,0xa8,0xa9,0x64,0x9a,0xa2,0x90,0x10,0x79,
+0xb1,0x10,0x89,0xd2,0x80,0x3c,0x06,0xba,0x28,0x88,0xa3,0x7a,0xa0,0x20,0xc0,0x41,
+0x0a,0xb8,0xd8,0x0c,0x93,0x32,0xa9,0x19,0x31,0xeb,0x90,0x50,0x8b,0x19,0xb7,0x5b,
+0x02,0x9d,0x84,0x0a,0x22,0x9b,0xa2,0x85,0x2f,0xb1,0x20,0x18,0x11,0x03,0x0d,0xf9,
+0x38,0x19,0xa1,0x93,0x8f,0x01,0x90,0x01,0x38,0xa8,0xb8,0x38,0x81,0x01,0x71,0xc2,
+0x86,0x2d,0xa9,0x83,0x4a,0x01,0x94,0x19,0x90,0x0d,0x21,0xb8,0xa1,0x59,0x9d,0x01,
+0xa1,0xa8,0x2f,0x84,0xc8,0x40,0x18,0xa0,0xb2,0x7a,0x13,0xd9,0x10,0x0b,0xb2,0x30,
+0x31,0x82,0x0f,0xd9,0x10,0x1a,0x14,0x08,0xa0,0x81,0x99,0x69,0xf0,0x09,0x0a,0x31,
+0xc4,0x99,0x18,0x1b,0x86,0x32,0x98,0x0d,0x88,0x90,0x01,0x5a,0xa9,0xa4,0x2b,0x21,
+0x41,0xd0,0x28,0xc8,0x21,0x1a,0x12,0xf5,0x1c,0x12,0x18,0xbe,0x13,0x1c,0x88,0xb0,
+0x40,0xb0,0x9b,0x21,0x26,0x9a,0x13,0x12,0xad,0x59,0xb8,0x06,0x00,0x19,0x9e,0xb3,
+0x1a,0x24,0x58,0x04,0x0a,0xa2,0x80,0x09,0x0a,0x04,0xb0,0x80,0xdf,0x12,0x0a,0xb8,
+0x89,0x72,0x09,0x84,0x10,0xa9,0x1a,0xc1,0x10,0x30,0x63,0xc8,0x10,0x24,0xcd,0x19,
+0x80,0x15,0x2a,0xa8,0xa9,0x03,0x2b,0x9f,0xad,0x30,0x94,0x40,0xb8,0x52,0x88,0xa9,
+0xd1,0x19,0x8b,0xa0,0x22,0x55,0x8a,0x01,0x89,0x3d,0xf3,0x18,0x38,0x89,0x01,0xe9,
+0x14,0x8c,0x00,0x82,0x19,0x83,0xa3,0x80,0x3c,0x1b,0xa7,0x13,0x4b,0xcb,0x89,0x25,
+0xa8,0xaa,0x1c,0x97,0x19,0x12,0xbb,0xa1,0x40,0x0d,0xa0,0x30,0x32,0xbc,0x72,0xa1,
+0x9a,0x90,0x8b,0x1a,0xb7,0x60,0x91,0x8a,0x98,0x91,0x86,0x30,0x8a,0x11,0x18,0xf8,
+0x21,0x8c,0x18,0x9a,0x83,0xc2,0x3c,0x14,0x21,0x48,0xd1,0xac,0x52,0x11,0xdb,0x01,
+0x1a,0x08,0x91,0xea,0x18,0x01,0x12,0x33,0x85,0x0e,0xc9,0xb3,0x2e,0x32,0x18,0x98,
+0x87,0x8a,0x99,0x32,0x14,0xb1,0x1f,0x92,0xb8,0x29,0x8d,0x94,0x92,0x8b,0x3a,0xf0,
+0x08,0xaa,0x63,0x90,0x91,0x39,0x81,0x99,0xa4,0x4b,0x0e,0x85,0xa8,0x11,0x0c,0xc8,
+0x18,0x81,0x00,0x31,0xae,0x24,0x1c,0xb0,0x05,0x3b,0xe9,0x01,0x89,0x19,0xb5,0x58,
+0x99,0x84,0x31,0xab,0x93,0x1c,0x80,0x08,0x08,0x43,0xe2,0x58,0x8a,0xc0,0x12,0xa0,
+0x6a,0x98,0x00,0x92,0x28,0x58,0x9c,0xb3,0x91,0x1f,0xb8,0x18,0x21,0x96,0x28,0xba,
+0xb0,0x3b,0x83,0xa5,0x63,0x2d,0x81,0xc1,0x32,0x0e,0x81,0x8a,0xc9,0x33,0x2a,0x91,
+0xb9,0x2d,0x97,0x19,0x20,0xc8,0x83,0x08,0x2c,0xe0,0x01,0x01,0x8e,0x94,0x00,0x2c,
+0xb9,0x11,0x8a,0x22,0x03,0x98,0x84,0xbf,0x91,0x24,0x8c,0x93,0x2c,0xa2,0x0b,0x10,
+0x81,0x07,0x60,0x80,0xc1,0x0c,0x11,0x1a,0x01,0x90,0x04,0x4e,0xa1,0x80,0xd2,0x18,
+0x4b,0xa1,0xa4,0xb9,0x19,0x3d,0xb4,0xc2,0x2b,0x32,0x8b,0x33,0xf2,0x08,0x1b,0x52,
+0xd0,0x90,0x8c,0x20,0x41,0x8a,0x14,0x11,0x2b,0xd5,0x18,0x28,0xb8,0x94,0xa8,0x70,
+0xa9,0xa0,0x11,0x0f,0x81,0x91,0x10,0x1a,0x25,0x9c,0x93,0x0b,0x09,0x3c,0xc4,0x32,
+0x0b,0x30,0x31,0xd0,0x99,0x3a,0x73,0xb4,0x8d,0x12,0x99,0x24,0x9a,0xe8,0x0b,0x61,
+0xb8,0x01,0x08,0x4b,0xc8,0x89,0x80,0x13,0x28,0x0b,0x74,0xc2,0x8a,0x60,0xb9,0x10,
+0x18,0xa9,0x0c,0xf2,0x18,0x20,0x09,0x03,0x03,0xc3,0x2f,0xa1,0x18,0xe0,0x52,0x9a,
+0x90,0x0a,0x23,0x49,0xb2,0xb9,0x79,0xc0,0x82,0x8b,0xa1,0x78,0x91,0xd8,0x08,0x59,
+0xa2,0x88,0x50,0x98,0x00,0x98,0xa9,0x80,0x38,0xd3,0x14,0x9e,0x28,0x07,0x09,0x09,
+0x28,0x00,0xb1,0x2d,0x0b,0xc4,0x28,0x79,0x91,0x91,0x8a,0x21,0xc0,0x09,0x13,0xcc,
+0x1a,0x17,0x1a,0xb1,0x3a,0x99,0x84,0xaa,0xa4,0x3d,0xc0,0x18,0xd3,0x59,0x88,0x81,
+0x88,0x41,0xb9,0x90,0x31,0x80,0xca,0x89,0x9e,0x83,0x0d,0x18,0xa8,0x08,0x20,0xe0,
+0xdc,0x61,0x99,0xa1,0xa0,0x69,0x10,0x20,0x82,0x80,0x89,0x2a,0xbc,0x26,0x99,0xa8,
+0x4a,0x39,0x17,0xe9,0x19,0x00,0xa1,0x89,0x98,0x3e,0xb3,0x8b,0x32,0x11,0x14,0xfb,
+0x58,0xa0,0x39,0x21,0xc1,0xc9,0x70,0x08,0x20,0xba,0x01,0x40,0x40,0x80,0x1a,0xbc,
+0x15,0x19,0xa1,0x39,0xbc,0x12,0x08,0x4a,0x0d,0x81,0x27,0x81,0xaf,0x32,0x98,0x9a,
+0xc6,0x39,0x99,0x20,0x91,0x51,0xa1,0x0a,0x9a,0xa9,0x9d,0x34,0xe9,0x28,0x38,0xc9,
+0x25,0x98,0x98,0x29,0x30,0xf1,0x2a,0x94,0x53,0xaa,0x89,0x19,0xc9,0x9b,0x71,0x21,
+0x99,0xc8,0x1a,0xab,0x07,0x1b,0x21,0xb8,0x93,0x41,0xba,0x32,0xac,0xc8,0x47,0x08,
+0xa9,0x92,0x1a,0x51,0xc9,0x82,0x00,0x0f,0x91,0x82,0x98,0x09,0x12,0xaf,0x81,0x22,
+0x9b,0x49,0x27,0x99,0x92,0xac,0x20,0x10,0x20,0xf0,0x18,0x9a,0x41,0x89,0xa2,0x28,
+0x6b,0x85,0x3b,0xc8,0x03,0x10,0x0e,0xa1,0x16,0x0b,0x22,0xbd,0x04,0x82,0x8d,0x18,
+0xb2,0x10,0x11,0xa2,0x02,0x69,0xe3,0x0a,0x99,0x48,0xa9,0xa2,0x1c,0x24,0x33,0xea,
+0x91,0x3c,0x98,0x94,0x30,0x9d,0x91,0x1d,0xe1,0x20,0x89,0x3a,0xa2,0x91,0x78,0x90,
+0xba,0x25,0xaa,0x48,0xd4,0x3a,0x89,0x89,0xc0,0x23,0x2b,0xb0,0x4a,0xf2,0x40,0x99,
+0x29,0x15,0x8a,0x11,0x93,0x2d,0x9a,0x84,0x0a,0x08,0x0b,0x12,0x90,0x57,0xc9,0x88,
+0x28,0xa1,0x1d,0x01,0x99,0xd1,0x38,0x09,0x99,0xa2,0x0f,0xa3,0x08,0x4b,0xc7,0x4c,
+0xc1,0x28,0x10,0xa1,0x30,0x99,0xb0,0xf8,0x38,0x8b,0x94,0x19,0x43,0xa8,0x18,0x90,
+0x8a,0x87,0x80,0x4b,0xaa,0xb4,0x40,0x98,0x12,0x1f,0x92,0x92,0x89,0x31,0xdc,0x01,
+0x11,0x00,0x79,0xc1,0x21,0x62,0xa8,0x08,0x04,0x8a,0x19,0xb4,0x0c,0x21,0x99,0xcb,
+0x12,0xad,0x85,0x3c,0xb1,0x24,0x09,0x0c,0x85,0xa8,0x48,0x1b,0x17,0xb9,0x48,0xa9,
+0x01,0x89,0x94,0x1a,0x33,0x3c,0xe8,0x02,0x0a,0x09,0xac,0x98,0xab,0x63,0x13,0x9d,
+0x21,0xd9,0x43,0xcb,0x28,0x2c,0xa4,0x38,0xca,0x4a,0x81,0xb9,0x19,0xa8,0x10,0x31,
+0x96,0xa9,0x00,0xfa,0x88,0x17,0x98,0x83,0x0c,0x11,0xf1,0x29,0x81,0xd9,0x19,0x92,
+0x40,0x81,0xad,0x00,0x91,0x90,0x1b,0x31,0x30,0x87,0xa0,0x2e,0x91,0xa4,0x69,0xb9,
+0x01,0x8a,0x02,0x0f,0x94,0x99,0x58,0xa0,0x28,0xb9,0x31,0x00,0x79,0x89,0x85,0x98,
+0x29,0x82,0x18,0xc9,0x81,0xab,0x01,0xaa,0x0f,0xa1,0x03,0x0f,0x91,0xe9,0x3b,0x84,
+0x91,0x1c,0x83,0x12,0x50,0x48,0xd3,0x88,0x18,0x9c,0xc0,0x52,0x80,0x80,0x99,0x05,
+0x30,0xb3,0x0f,0x03,0x58,0xb3,0x1a,0x19,0xe4,0x89,0x10,0xbb,0x10,0x23,0xb0,0x8a,
+0xbf,0x16,0xa8,0x80,0x21,0x1d,0xa2,0xc1,0x1a,0x23,0x9d,0xd8,0x41,0x91,0x90,0x1c,
+0x30,0xd2,0x01,0x1c,0xa2,0x10,0xd3,0x41,0xac,0x40,0x18,0xc5,0x1b,0x81,0x80,0x41,
+0xd9,0xa1,0x8b,0x28,0x82,0x30,0x04,0xbd,0x28,0x92,0x60,0xc1,0x2a,0x01,0x03,0x1e,
+0x90,0x80,0x24,0x1a,0xa8,0x18,0x75,0x88,0x21,0xa8,0xc9,0xbc,0x58,0x10,0xcc,0x05,
+0x3b,0x92,0x90,0x2b,0xb3,0x3b,0xa3,0x37,0x80,0x29,0x09,0xf2,0x41,0x88,0x09,0xc8,
+0x18,0xb1,0x18,0x18,0xdf,0x02,0x01,0x02,0x99,0x1c,0xa1,0x03,0xd0,0x41,0xaf,0x04,
+0x98,0x13,0x0d,0x80,0x83,0x34,0x0a,0xc9,0x12,0x9c,0xb8,0x4b,0x95,0x2e,0x81,0x01,
+0xb8,0x1b,0x18,0x89,0x05,0xca,0x08,0xda,0x23,0x18,0x32,0xd9,0x86,0x20,0x9d,0x20,
+0x82,0x17,0x8f,0x21,0x91,0x81,0x0b,0xa9,0x8a,0x96,0x49,0x9a,0x92,0x1a,0x73,0x92,
+0x01,0x08,0x8d,0xa8,0x03,0x3a,0xb4,0x32,0xac,0xd9,0x01,0x59,0xd1,0x28,0x12,0x8b,
+0x0a,0xb0,0x01,0x70,0xa1,0x29,0xf9,0x10,0x78,0xd8,0x81,0x1a,0x01,0x90,0x99,0x50,
+0xa1,0x9a,0xb0,0x5d,0x93,0xa8,0x90,0x19,0x17,0x29,0x88,0xa1,0xd1,0x7b,0x91,0xa0,
+0x80,0x1a,0x01,0x86,0x08,0x08,0x30,0x85,0xb8,0x12,0x0b,0xbe,0xa2,0xb1,0x78,0x30,
+0xf1,0x20,0xaa,0x90,0x09,0x81,0xac,0x94,0x51,0x0d,0xa1,0x8b,0x89,0x00,0x82,0x4e,
+0x04,0xc0,0x1a,0x10,0x08,0x82,0x0a,0x95,0x28,0x3a,0x86,0x1a,0xb1,0x1b,0x17,0x1a,
+0x31,0xbd,0x72,0x98,0x01,0x89,0x28,0x82,0xb8,0xa0,0x78,0x9a,0xd2,0x01,0x5c,0x01,
+0x9a,0x17,0x9b,0x0a,0x9b,0x24,0xc1,0x28,0x18,0xcb,0x81,0xd8,0x1b,0xc9,0x01,0x85,
+0x3a,0xcc,0xa2,0x5a,0xd0,0x00,0x30,0x09,0xb2,0x92,0x10,0x71,0xb2,0x49,0xb8,0x15,
+0x91,0x0f,0xa1,0x89,0x15,0x81,0x1a,0x89,0xb2,0x31,0xaf,0x92,0x8c,0x88,0x89,0x40,
+0xa2,0x11,0x72,0xe1,0x01,0x80,0x00,0x9b,0x05,0x28,0x01,0xa0,0x42,0x88,0x8f,0xb3,
+0x99,0x79,0x90,0x92,0x31,0x9c,0x05,0x28,0x28,0xb2,0xa2,0x2c,0xa8,0x90,0x28,0x59,
+0xc8,0xa1,0x2d,0x98,0x9b,0xc2,0xbe,0x38,0x82,0x24,0x0d,0xac,0xa3,0x73,0x20,0xa8,
+0x0a,0x32,0xb9,0xfb,0x6a,0x1a,0x05,0x88,0x28,0x99,0xa8,0x08,0x42,0x3a,0xdf,0x11,
+0x0b,0x00,0x91,0x8a,0x81,0x11,0xb0,0xc3,0x3c,0xd3,0x28,0x07,0x8a,0xc9,0xa1,0x4a,
+0xa9,0x16,0xa8,0x4a,0xa8,0x41,0x90,0x01,0xa2,0x4b,0x40,0xe8,0x30,0x33,0x0b,0xcd,
+0xa0,0x73,0x19,0xa2,0x98,0x5b,0x9b,0x12,0x19,0x82,0x4c,0x92,0x12,0xa0,0x09,0xb7,
+0x8f,0x01,0x8c,0x04,0x22,0xad,0x80,0x91,0x09,0x29,0x20,0x05,0xa8,0x19,0xda,0x70,
+0xc0,0x00,0x00,0x28,0x8a,0xf1,0x10,0x13,0x8f,0x92,0x08,0x92,0x0b,0x00,0xab,0x85,
+0x4a,0x33,0xb1,0x9c,0x81,0x2c,0x83,0xdb,0xb4,0x2f,0x90,0x34,0x00,0x02,0x8f,0x81,
+0x90,0x32,0x8b,0x91,0x32,0x01,0xcf,0xa0,0x13,0x48,0x0b,0x90,0x94,0x7b,0x91,0x00,
+0x1a,0xa8,0xa8,0x39,0x37,0xdb,0x38,0xa1,0x93,0x9c,0x1f,0x98,0x02,0x18,0x81,0x9c,
+0xa8,0x50,0x12,0xf0,0x2e,0x98,0x03,0x08,0x0a,0x00,0x78,0xd0,0x02,0x0a,0x89,0xa9,
+0x07,0x99,0xa0,0x39,0xb2,0x58,0xb4,0x3a,0x29,0x16,0x08,0x91,0x80,0x48,0xdb,0x10,
+0xa8,0x2b,0x1a,0x97,0x08,0x98,0x1f,0xa1,0xb8,0x62,0x19,0x19,0xa6,0x0a,0x0c,0xa8,
+0x21,0x20,0x13,0x0b,0xc8,0xf0,0x3c,0x80,0x03,0x0c,0x09,0x11,0xaa,0x06,0x2c,0xb2,
+0x33,0x8e,0xa0,0x05,0x0b,0x99,0x24,0xb8,0x21,0x33,0xa1,0x1f,0x87,0x18,0xa8,0x09,
+0x99,0x06,0x99,0x48,0xc9,0x00,0xd2,0x89,0x43,0x9a,0x84,0x18,0x04,0x8b,0xa1,0x30,
+0x94,0x10,0x73,0xaa,0x97,0x1a,0x19,0x80,0x32,0xe0,0x08,0x2b,0xc1,0x28,0xc3,0x11,
+0x8d,0x19,0xb2,0xa8,0x65,0x8a,0x91,0x20,0xd8,0x41,0x00,0x39,0xe4,0x12,0x9d,0x90,
+0x08,0x00,0x9b,0x10,0x48,0xc5,0x10,0x2b,0xc3,0xb1,0x62,0x9a,0x08,0x91,0xa0,0x48,
+0xbb,0x81,0x18,0x81,0x6c,0xa0,0xb1,0x79,0xa8,0x0c,0x95,0x80,0x1f,0x88,0x92,0x88,
+0x0a,0xa2,0x49,0xc0,0x05,0x2a,0x8f,0x86,0x89,0x00,0x28,0x90,0x08,0xa2,0x5a,0x11,
+0xa0,0x9b,0xa1,0x73,0xbc,0x80,0x25,0x2a,0xd0,0x80,0x29,0x24,0xa9,0x10,0xec,0x20,
+0xa9,0x62,0xaa,0x83,0x28,0x12,0xd2,0x3a,0xcc,0x82,0x08,0x0c,0x04,0x33,0xf8,0x39,
+0x99,0xc9,0x84,0x1b,0x18,0xa2,0x02,0x8d,0x98,0xd8,0x11,0x1b,0x60,0x82,0x98,0xd8,
+0x3c,0x84,0xaa,0x82,0x52,0x9b,0x10,0x01,0x87,0x3b,0x18,0xfc,0x81,0x40,0x90,0x39,
+0xa2,0xa3,0x3a,0x9b,0x8b,0x87,0x21,0x9a,0x49,0xa4,0x1c,0x18,0x26,0x89,0x18,0xa2,
+0xa8,0x29,0x0f,0x92,0xa1,0x2a,0x3b,0xf1,0x22,0x90,0x8f,0x33,0xd0,0x81,0x29,0x59,
+0xd8,0x90,0x10,0x5b,0x0a,0xc1,0x99,0xa8,0x52,0x09,0x15,0xc9,0x38,0x88,0xa9,0x82,
+0x03,0x9f,0x05,0x21,0x1a,0x91,0xca,0x20,0x3a,0x94,0x9b,0xa0,0x9e,0x30,0xa3,0x78,
+0xa0,0x32,0xeb,0x14,0x8d,0x01,0x91,0x39,0xeb,0x20,0x32,0xb1,0x8e,0x90,0x49,0x23,
+0xd9,0x32,0x21,0xb1,0x9e,0x08,0x18,0x81,0x52,0x9b,0x05,0x0f,0x08,0x92,0x1b,0x88,
+0x00,0x30,0x00,0xf8,0x2b,0x93,0x88,0x99,0x61,0x11,0xcd,0xa3,0x2d,0x00,0x90,0x31,
+0xb2,0x39,0xbf,0xa6,0x28,0x68,0xb8,0x81,0x38,0xb0,0x8b,0x27,0xba,0x39,0xab,0xa5,
+0x3b,0x81,0x5a,0x85,0x98,0x1b,0x98,0x0c,0x92,0x09,0xf0,0x2d,0x81,0x00,0x23,0x28,
+0x83,0x3a,0xfa,0xb9,0x80,0x8f,0x38,0xa5,0x32,0x28,0xc8,0x90,0x09,0xaa,0x1e,0x33,
+0x80,0x81,0x8d,0x25,0xa8,0xd9,0x48,0x98,0x09,0xa0,0x31,0x8b,0x11,0xfc,0x8a,0x89,
+0x70,0x05,0x08,0x9b,0x81,0xb4,0x7b,0xb2,0xa0,0xa8,0x50,0x1b,0xa1,0xd3,0x08,0x30,
+0x9b,0xa9,0x83,0xb2,0x6b,0x8a,0x52,0x80,0x87,0x09,0x60,0x89,0x82,0xb9,0x43,0x1a,
+0x52,0xc2,0x8c,0x20,0xc9,0x50,0xd0,0x0c,0x80,0x91,0x21,0x1b,0x29,0x84,0x04,0x2b,
+0x15,0x8c,0x98,0x81,0x1a,0x41,0xf9,0xa9,0x58,0x00,0xa2,0x2a,0xa1,0x00,0x0b,0x38,
+0xc7,0x1a,0x08,0x09,0xa3,0x51,0x99,0x8f,0x91,0x81,0x21,0x1d,0x85,0x91,0xc9,0x2c,
+0x84,0x98,0x29,0x15,0xa8,0x00,0x28,0xad,0xa4,0x53,0x19,0x81,0xaf,0x91,0x08,0x29,
+0x12,0x98,0x8c,0x94,0x79,0x81,0xaa,0x02,0x0c,0xa2,0xc8,0xac,0x91,0x45,0x91,0x0a,
+0x0a,0x90,0x17,0x01,0x99,0x1a,0x25,0xfa,0x28,0x88,0x28,0xc8,0x09,0x10,0xa5,0x1d,
+0xa0,0x10,0x04,0x20,0x18,0x29,0xf0,0xa2,0x3e,0xa2,0x8a,0x88,0xca,0x22,0x53,0x0a,
+0xc8,0x14,0x1a,0x02,0x9d,0x23,0xb9,0x51,0x06,0x0b,0x10,0xa2,0x89,0x26,0x8d,0x88,
+0xa9,0x19,0xb8,0x23,0x5c,0xa1,0xb8,0x18,0x5b,0xe8,0x91,0x5b,0xa0,0xa3,0x2b,0x98,
+0x79,0xb2,0x10,0x8a,0x23,0xdc,0x30,0x08,0x90,0x01,0xa1,0x0f,0x86,0x10,0xa2,0x90,
+0x33,0x2d,0x85,0xac,0x21,0xc8,0x69,0x41,0xd1,0x38,0x98,0x89,0x02,0x8b,0x28,0x03,
+0x54,0xab,0x85,0x90,0x38,0xf0,0x0a,0x81,0x91,0x0d,0xa9,0x03,0x21,0x0b,0x0e,0x96,
+0x00,0x2c,0x86,0x8a,0xa0,0x82,0x3a,0x80,0x99,0xc3,0xfa,0x50,0x09,0xb8,0x84,0x28,
+0x18,0xdb,0xa9,0x39,0x13,0x1b,0x82,0x86,0x7a,0x00,0xd2,0x10,0x0a,0xa9,0x3b,0xb1,
+0x07,0x99,0x38,0x1c,0xa4,0x89,0x83,0x50,0x0c,0xe2,0x40,0x99,0x01,0x9a,0x10,0x12,
+0xbe,0x11,0x2a,0xd0,0x32,0x9a,0x37,0x1b,0x99,0x93,0xcc,0x71,0x08,0xc1,0x89,0x39,
+0x84,0x90,0x00,0x02,0x90,0x33,0x9f,0xa8,0x52,0x98,0x48,0xb8,0xbb,0x24,0x9b,0x13,
+0x53,0xdb,0x12,0x1a,0xb9,0x70,0xa9,0x90,0x91,0x7b,0xab,0x82,0xc8,0x34,0x9e,0x10,
+0xa8,0x03,0x11,0x60,0x2b,0xf1,0x08,0x29,0x2b,0xb2,0x30,0xaa,0x02,0x35,0x20,0xaa,
+0x1b,0x96,0x26,0x2a,0x08,0xc8,0x09,0x71,0xc1,0xa8,0x40,0x99,0x98,0xa0,0x78,0xd1,
+0x19,0x01,0x08,0xd0,0x40,0xaa,0x22,0x98,0x93,0x1a,0xca,0x17,0x90,0x1c,0x13,0xa9,
+0x52,0xc8,0xb8,0x68,0x90,0x00,0x12,0xb2,0x2d,0xc0,0x21,0x82,0x5a,0xd1,0x09,0x99,
+0x02,0xea,0x31,0x3b,0xd0,0xc0,0x30,0x0c,0x94,0x0a,0xa2,0x01,0x9f,0x83,0x90,0x80,
+0x79,0x89,0xa3,0x08,0x02,0x29,0x24,0xda,0xa1,0x2a,0xa3,0x2f,0xb0,0xd5,0x89,0x2b,
+0x94,0x00,0xdb,0x20,0x98,0x58,0x10,0x82,0xd9,0x22,0x8e,0x80,0xa9,0x02,0x38,0x86,
+0x0b,0x19,0xe2,0x28,0xa8,0x73,0xa0,0xba,0x11,0xa0,0x50,0x18,0xfb,0x20,0x01,0x81,
+0x20,0xae,0x22,0xb2,0x91,0x20,0x0d,0x07,0x88,0x90,0x18,0x9a,0xa8,0xd0,0x99,0x78,
+0xa3,0x18,0x25,0x8b,0x84,0x2a,0xc9,0x40,0xb1,0x29,0x19,0xba,0xa0,0x5a,0xb1,0x89,
+0x0e,0xa9,0x57,0x8c,0x92,0x21,0x0b,0x12,0xb2,0x92,0x29,0x09,0x7b,0x96,0x28,0x8d,
+0x81,0x89,0x1a,0x82,0xdc,0x25,0x0c,0x93,0x0d,0xa3,0x51,0x8b,0xe1,0x81,0x1a,0x08,
+0x88,0xa2,0x14,0x3b,0x0c,0x03,0xb0,0xcb,0x22,0x9f,0x19,0xd3,0x09,0x8a,0x44,0x0b,
+0x84,0x98,0x20,0x5b,0xa8,0xb2,0x79,0x92,0xfa,0x28,0x30,0xb0,0xd2,0x49,0x8a,0x93,
+0x22,0x1b,0xa6,0x0e,0x01,0x80,0x28,0x20,0xb2,0x31,0xc9,0x89,0x02,0x1f,0x80,0x99,
+0xe3,0x34,0x2a,0x08,0xd1,0x03,0x1b,0x40,0xd9,0x84,0x1a,0x38,0xb9,0x81,0xad,0x01,
+0x38,0x96,0xaf,0x21,0x99,0xa1,0x70,0x90,0x02,0x89,0x89,0x30,0xd8,0x63,0x99,0xa0,
+0x99,0x0a,0x2a,0xc4,0x48,0xa3,0x2a,0x9a,0xbe,0x34,0xaa,0xc1,0x6b,0x82,0xa0,0xbb,
+0x48,0x37,0xa1,0x39,0xc0,0x40,0xa0,0x81,0x09,0xb3,0x7c,0xb8,0xc8,0x40,0x1a,0xa3,
+0x90,0x24,0x99,0x9c,0x83,0xa5,0x3d,0x22,0xd0,0x01,0x00,0xbb,0x33,0x63,0xaa,0x87,
+0x2a,0x99,0xb1,0x3a,0x8c,0xa4,0x32,0xf9,0x42,0x9c,0xa3,0x8a,0x31,0x20,0xbc,0x94,
+0x1a,0x20,0xa1,0xaf,0x82,0x29,0xa0,0x98,0x78,0x13,0xda,0x25,0x8b,0x0a,0x91,0x85,
+0x01,0x2c,0xba,0x85,0x9a,0x10,0x2e,0xc3,0x11,0xa0,0x09,0xac,0x35,0xb0,0x21,0x9a,
+0x42,0xa9,0x52,0xa9,0xa9,0xf4,0x49,0x0c,0x00,0xb4,0x2a,0x32,0xaa,0x00,0xaa,0xa1,
+0x66,0x08,0x19,0xa1,0xa3,0x79,0xb1,0x1b,0xa3,0x23,0x0c,0x8a,0xa5,0x30,0x8f,0x02,
+0x8b,0x90,0x32,0x68,0x89,0x87,0x19,0x3b,0xc3,0x89,0x01,0x1c,0x93,0x1d,0x24,0xe9,
+0x28,0xaa,0x30,0xc1,0x80,0x00,0x3b,0xb6,0xab,0x1a,0x8e,0x92,0x81,0x98,0x79,0xc0,
+0x88,0x08,0x43,0x12,0x60,0xa8,0xa2,0x19,0xaf,0x00,0x05,0x29,0xd2,0x3b,0x89,0xa3,
+0x8c,0xa2,0x3a,0x5b,0xa9,0xc5,0x90,0x4c,0xa0,0x13,0x02,0x1a,0x32,0xbb,0x72,0xc2,
+0xbb,0x52,0x99,0x28,0x92,0xb2,0x1f,0x38,0xc0,0x28,0x80,0x0c,0x21,0x39,0xa4,0x18,
+0x70,0xca,0xb9,0x20,0x07,0x48,0x98,0xb8,0x31,0x30,0xba,0xcb,0x22,0xb8,0x29,0x80,
+0x3f,0x07,0xaa,0x8a,0x38,0x80,0x27,0x9f,0x00,0x89,0x91,0x30,0x11,0x21,0xec,0x00,
+0x21,0x19,0x9a,0x13,0xb5,0xaa,0x39,0x8f,0xb2,0x87,0x20,0xab,0x88,0xd2,0x53,0x00,
+0x1a,0x90,0xb8,0xa3,0x95,0x2f,0xa8,0x98,0x82,0x42,0x4a,0x41,0xf1,0x90,0x2c,0x98,
+0x13,0x09,0x90,0x08,0x8a,0x62,0x00,0xb2,0x8b,0x38,0x85,0x83,0xaf,0x38,0x82,0xa2,
+0x70,0xaa,0x01,0xe2,0x4a,0x90,0x00,0xa0,0x10,0xb9,0x39,0xaa,0x57,0x10,0xc2,0x2c,
+0x91,0x89,0xc8,0x94,0x4c,0xa8,0xb0,0x30,0xc9,0x51,0xac,0x28,0x85,0x0b,0x13,0x09,
+0xb8,0xb8,0x28,0x70,0xb3,0x68,0xb0,0x43,0xae,0x18,0x30,0x81,0xa8,0x30,0xc1,0x99,
+0x6c,0xb0,0x13,0x80,0x42,0xba,0x18,0x17,0xa8,0x4a,0xdc,0x08,0x02,0x92,0x71,0x09,
+0xb3,0x0a,0x39,0x83,0x81,0xb9,0x4d,0xe0,0x80,0x19,0xca,0x14,0x0b,0x11,0xc1,0x20,
+0xdb,0x40,0x1a,0x04,0x18,0x93,0xeb,0x28,0x8a,0x30,0xf9,0x8a,0x9d,0x31,0x19,0xe3,
+0x31,0x00,0x99,0x31,0xbd,0x85,0x2b,0x02,0x50,0x98,0xd2,0x18,0x1a,0xc9,0x90,0x12,
+0x70,0xb8,0x59,0xc0,0x89,0x9a,0x0d,0xa1,0x05,0x09,0x5a,0x91,0xa4,0x1c,0x00,0x88,
+0x93,0x8e,0x88,0x13,0x04,0x59,0x0b,0xc1,0x00,0x14,0x29,0x09,0x10,0xa4,0x89,0x1b,
+0x85,0x0b,0x2a,0x07,0x16,0x9e,0x01,0x88,0x21,0x89,0xb0,0x39,0xdb,0x20,0x00,0xd9,
+0x11,0x8d,0x22,0xbb,0xf0,0x48,0x91,0x49,0xa8,0x86,0x80,0x1c,0xa1,0x08,0xd2,0x12,
+0x3a,0x2a,0x07,0xd1,0x19,0x1b,0x91,0xb1,0x30,0x10,0xbe,0x22,0x42,0x90,0x81,0x1b,
+0xb5,0x1d,0x01,0xe9,0x1a,0x10,0x05,0x88,0x39,0xc0,0x61,0x01,0x88,0x80,0x26,0xab,
+0x20,0x82,0xfa,0x38,0x88,0x90,0x23,0x69,0xb1,0x19,0x2a,0xd8,0x4a,0x88,0x96,0x0a,
+0x32,0x1e,0xc1,0x09,0x21,0x03,0x0c,0xb1,0x48,0xf9,0x0b,0x20,0x28,0xd0,0x00,0x98,
+0x9a,0x00,0x98,0xab,0xd4,0x5c,0xb1,0x91,0x02,0x2f,0x81,0x94,0x1b,0x83,0xbb,0x8b,
+0x47,0x88,0x83,0x1c,0x80,0x90,0x48,0x01,0xea,0x24,0x90,0x1e,0xc1,0x90,0x38,0x20,
+0x0a,0xc2,0x1a,0x71,0xa0,0x12,0xac,0x03,0x91,0x81,0xaf,0x22,0xa3,0xab,0x73,0xda,
+0x82,0x89,0x43,0x8a,0x80,0x91,0x28,0x21,0x99,0x39,0xa7,0x21,0xaf,0x14,0x9a,0x92,
+0x1d,0x00,0x83,0x19,0x9f,0x88,0x40,0x8a,0x95,0x48,0xbb,0x02,0xa2,0x1c,0xbc,0x86,
+0x90,0x1a,0xa9,0xa4,0x49,0x0a,0x90,0xa1,0x30,0xd0,0x00,0xbc,0x34,0x28,0xcc,0x03,
+0x60,0xab,0xa3,0x2f,0x02,0x32,0x9a,0xfa,0x32,0x2b,0xc8,0x21,0x00,0xd9,0x29,0x81,
+0x99,0x49,0x94,0x0d,0x23,0x9a,0x82,0x1f,0x97,0x29,0xa0,0x80,0x49,0x89,0xa8,0x13,
+0x0b,0x91,0x9d,0xb8,0x78,0xe0,0x03,0x1b,0x20,0xc9,0x82,0x6b,0x8a,0x43,0xd9,0x23,
+0x80,0x39,0xc2,0xa2,0xad,0x11,0xbc,0x42,0x80,0x99,0x32,0x8f,0x92,0x30,0x3a,0x87,
+0xc9,0x3a,0xc1,0x88,0xa8,0x39,0x03,0x27,0xb8,0x39,0xa1,0x06,0x0d,0x09,0xb1,0x22,
+0x29,0xac,0x34,0xb9,0x35,0x89,0xd0,0x63,0x9a,0xb1,0x29,0x15,0x00,0x8e,0x95,0x8a,
+0x00,0x10,0x9a,0xa4,0x29,0x88,0x18,0x22,0xcc,0x87,0x2a,0x9c,0x10,0xb4,0x20,0x4b,
+0x8a,0x87,0x09,0x8b,0x80,0x90,0x91,0x1a,0x98,0x4f,0xc3,0x88,0x52,0x08,0xbb,0x92,
+0x28,0x90,0x52,0xf0,0x3b,0xd2,0x08,0x41,0x92,0x1a,0xb8,0x71,0x04,0x08,0x90,0x28,
+0x02,0x88,0x8e,0x83,0x2c,0xf9,0x39,0xc2,0x19,0x08,0x12,0xaa,0xb1,0x59,0x8a,0x54,
+0xf9,0x00,0x28,0x98,0x01,0x58,0xa1,0x00,0x05,0x2c,0x80,0x82,0x8d,0x00,0xbb,0x32,
+0xaf,0xb1,0x30,0xba,0x59,0x10,0xa3,0x21,0x00,0x4e,0xd8,0x11,0x9b,0x88,0x18,0x92,
+0xbb,0x46,0x09,0xb8,0xa5,0x08,0x4c,0xd1,0x88,0x10,0x50,0x92,0x10,0x09,0x09,0xb0,
+0x74,0xa8,0xb2,0x0a,0xa9,0x10,0x32,0x12,0x87,0xae,0x22,0xa0,0xa0,0xa0,0x68,0x48,
+0xa2,0xb9,0x78,0xa1,0x83,0x0d,0x82,0x0b,0x07,0x49,0xb8,0x80,0x30,0xb9,0x09,0x19,
+0x97,0x2c,0xc0,0x89,0x22,0xaa,0x42,0xab,0x86,0x09,0xb0,0x02,0x24,0xbd,0x22,0xf8,
+0x20,0x29,0xab,0xc3,0x88,0x68,0x0b,0xb8,0x85,0x38,0xba,0x83,0x9f,0x90,0x11,0xba,
+0x43,0xa8,0x08,0x09,0x38,0xf9,0x29,0x4f,0x83,0xb8,0x38,0xd8,0x53,0xb8,0x11,0xb0,
+0x39,0xf0,0x38,0x28,0xb3,0xb0,0x3f,0xc9,0x10,0x93,0x8c,0x31,0x98,0xd9,0x12,0x0c,
+0xc2,0x2a,0xb2,0x34,0x3d,0xe1,0x21,0x80,0x01,0xbf,0x12,0x20,0x85,0x09,0x13,0x0a,
+0x02,0xd1,0x4a,0x09,0x41,0xbc,0x83,0x38,0x9d,0x10,0x33,0xf1,0x4a,0xa8,0x28,0x99,
+0xd9,0x93,0x0e,0x10,0x42,0xb1,0x03,0x8e,0x0b,0xb3,0x20,0xc1,0x7a,0xb8,0x52,0x00,
+0xa1,0x19,0x19,0xb0,0xda,0x80,0x4a,0x2a,0xa7,0x09,0x2c,0xab,0x06,0x81,0x29,0x19,
+0xa1,0x09,0x93,0xa4,0x71,0x0d,0xc2,0x90,0x09,0x21,0x98,0x59,0x94,0xa1,0x0a,0xaa,
+0x1f,0x02,0x94,0x1b,0x41,0x0b,0x99,0x01,0xa7,0x3b,0x32,0x8a,0xd0,0x25,0x9a,0x20,
+0x8a,0xa4,0x0b,0xb0,0x1e,0x31,0xa9,0x30,0x31,0x97,0x7b,0x92,0x8a,0x14,0xcd,0x11,
+0x88,0x99,0x22,0xa2,0x69,0xa0,0xaa,0xa3,0x10,0x72,0xd0,0x92,0x3b,0x9a,0xf8,0x2c,
+0x81,0x92,0x59,0x19,0xa4,0x28,0x8a,0x92,0xba,0x20,0x63,0x99,0xab,0x17,0x08,0x2b,
+0x8b,0xb6,0x09,0x5b,0x85,0x0a,0x88,0x84,0x19,0xab,0x33,0x27,0x01,0x8f,0xd2,0x1a,
+0x82,0xa9,0x21,0xa8,0x89,0x13,0x09,0x06,0x08,0x38,0xfb,0x08,0x50,0x19,0x92,0xc8,
+0x1b,0x18,0x87,0x88,0x2d,0xb3,0x38,0x91,0x40,0xe8,0x30,0xbc,0x01,0x08,0x2a,0x92,
+0x27,0x1d,0xa9,0x83,0x99,0x2a,0x84,0xf9,0x4b,0x99,0x42,0xc0,0x20,0xaa,0x10,0x85,
+0xa8,0x4b,0xa2,0x04,0x20,0x80,0x3b,0xb8,0xa3,0xfa,0x19,0xba,0x21,0x19,0x87,0xa8,
+0x3a,0x2b,0x57,0x80,0x19,0x9d,0xa3,0x2a,0xc0,0xa0,0x39,0x11,0x27,0xf9,0x29,0x00,
+0x01,0x0d,0x01,0x98,0x01,0x0a,0x78,0xc1,0x11,0x39,0xb1,0x2a,0x99,0xe2,0x28,0xb8,
+0x6c,0x93,0x91,0x4a,0x12,0xd1,0x3b,0x99,0xe0,0x21,0x1a,0x3c,0xc3,0x18,0x0a,0x20,
+0x1d,0xe8,0x80,0x33,0x39,0xb0,0x10,0x02,0x81,0x7a,0xa9,0xc2,0x33,0x20,0x09,0x4a,
+0xbe,0xb9,0xe1,0x3c,0x50,0xa3,0x10,0x0a,0x44,0x03,0x1d,0xc2,0x4a,0xd3,0x8b,0x03,
+0x3d,0xd1,0x88,0x00,0x43,0x89,0xa9,0x0b,0x42,0xd8,0x12,0x0b,0x63,0x08,0x82,0xad,
+0x19,0x91,0x1c,0x88,0x15,0x90,0x09,0xba,0x8c,0xf1,0x1e,0x80,0x10,0xa0,0x12,0x50,
+0x10,0xf8,0x91,0x1a,0x18,0x0a,0xa4,0x10,0x2e,0xa2,0x91,0x08,0x01,0xbb,0xd6,0x4a,
+0xb9,0x32,0xc0,0x40,0x59,0x82,0x80,0x8a,0x1a,0xb3,0x62,0xca,0x90,0x30,0x1a,0xe5,
+0x80,0x60,0x19,0xc1,0x19,0x89,0x00,0x82,0x48,0x8a,0xb0,0x26,0x0b,0x11,0x08,0xad,
+0x44,0xaa,0x0a,0x11,0x9a,0x74,0x92,0x2b,0x91,0xa1,0x24,0x0a,0x8e,0xb2,0x58,0xb8,
+0x59,0xd1,0x19,0x2b,0xc2,0x80,0x0a,0x13,0x1b,0xca,0xc2,0x1f,0xa2,0x42,0x09,0x90,
+0xbb,0x59,0xc2,0x13,0x2a,0x91,0x9f,0x03,0xb2,0x40,0x19,0x8c,0xa6,0x0a,0x15,0x8c,
+0x23,0xb0,0x8b,0x94,0x40,0x29,0x12,0xcb,0xa1,0xae,0x3a,0x62,0xb1,0x98,0x90,0x3d,
+0xc0,0x95,0x2a,0x82,0xa1,0xa9,0x3f,0x95,0x80,0x89,0x20,0x1d,0xb2,0x91,0x1c,0x78,
+0xc0,0x18,0x2a,0xa2,0x1c,0xb8,0x08,0x44,0x89,0x21,0xa8,0x0c,0xc3,0x69,0x88,0xa2,
+0x21,0xb9,0x2d,0xc1,0x10,0x9a,0x7b,0xc3,0x42,0x10,0xa0,0x39,0xa0,0xa8,0x42,0x10,
+0xcf,0x04,0x8a,0x1b,0xc3,0x91,0x41,0xbc,0x80,0x33,0x31,0xf2,0x0a,0x29,0x00,0xdb,
+0x11,0x07,0x1b,0x02,0x89,0xf1,0x08,0x4b,0x98,0x91,0x08,0x21,0x52,0xab,0x89,0xc2,
+0x7a,0x0a,0xa4,0x58,0x0a,0x02,0xc0,0x0b,0x16,0x1a,0xb8,0x01,0x93,0x1e,0x83,0x0a,
+0x04,0xaa,0x69,0xc8,0x08,0x93,0x00,0x09,0xa0,0x3b,0xb6,0x78,0x00,0x9c,0x80,0x81,
+0x63,0x98,0x29,0x23,0xf2,0x09,0x18,0x08,0xd0,0x30,0x49,0xc4,0x8b,0x20,0xd1,0x01,
+0x3c,0x05,0xaa,0xb1,0x20,0x58,0xaa,0x93,0x23,0x1d,0xb1,0x81,0x80,0x50,0xc9,0x82,
+0xdb,0x62,0x99,0x0a,0xf3,0x89,0x21,0x8b,0x83,0x30,0xb2,0xc1,0x8d,0x81,0x9f,0x88,
+0x11,0x41,0xb9,0x0a,0x21,0x49,0x43,0xb2,0x1a,0x0b,0xfa,0x3b,0x95,0xa1,0x9c,0x44,
+0x99,0xb0,0xa0,0x5b,0x1a,0xf1,0x40,0x98,0x38,0xb8,0x23,0xac,0x33,0xa1,0xf3,0x0f,
+0x08,0x12,0x8a,0x30,0x92,0x58,0x94,0x19,0x1a,0xd9,0x30,0x95,0x1c,0x88,0xb0,0x2c,
+0x85,0x09,0x3a,0x23,0x90,0xc3,0x79,0x91,0x48,0xf9,0x38,0xa8,0x10,0x18,0x9b,0xf1,
+0x19,0x11,0x88,0x10,0xb5,0x3b,0x9b,0x07,0x2a,0x92,0x03,0x8f,0x49,0xc2,0x10,0x18,
+0x29,0xe9,0x30,0xc0,0x80,0x10,0x1a,0xd0,0x19,0x90,0xd0,0x70,0x02,0xa8,0xa1,0x9b,
+0x32,0x00,0x11,0x07,0x2b,0x0c,0x98,0x28,0xb0,0x16,0x3a,0x00,0x28,0xf2,0x4b,0x19,
+0x08,0x84,0x9d,0xd1,0x48,0x01,0xa0,0x48,0x89,0xe1,0x12,0x50,0xb9,0x98,0xa1,0x48,
+0x40,0x90,0xb1,0x08,0x52,0x1a,0xf1,0x09,0x11,0xa0,0x70,0xba,0x12,0xc8,0x20,0x12,
+0x10,0xb9,0x29,0xe3,0x89,0x8f,0x13,0xbb,0x90,0x13,0xbf,0x81,0x1b,0xa8,0x73,0xa0,
+0x30,0xa3,0x9d,0x17,0x0c,0x82,0x40,0x89,0x8c,0x84,0x0b,0x93,0x0a,0x12,0x92,0x4a,
+0xf9,0x38,0x88,0x20,0xb8,0xc5,0x3b,0x0a,0x94,0x9a,0x0a,0xb0,0x42,0x90,0xca,0x87,
+0x01,0x33,0x88,0xbd,0x93,0xab,0x41,0xaf,0x01,0x33,0x90,0x2b,0x02,0xf1,0x78,0x98,
+0xa0,0x21,0xda,0x00,0x3b,0x9b,0x87,0x2b,0x01,0x18,0x42,0x19,0x80,0x87,0x5c,0xa1,
+0xaa,0x91,0x3c,0xb4,0x90,0x59,0x0a,0xa3,0x90,0xa9,0x1f,0x92,0x28,0xda,0x03,0x48,
+0x8c,0x92,0x81,0x38,0x27,0x8b,0x29,0xa4,0x80,0x0c,0xa3,0x09,0x4a,0xfd,0x18,0x88,
+0x19,0x11,0x01,0x19,0x17,0x1c,0xbb,0x94,0x28,0x11,0xcb,0x11,0x8a,0x9a,0x00,0x62,
+0x02,0x72,0xa8,0xd9,0x41,0xab,0x82,0x11,0x09,0xd1,0x31,0x8b,0xd8,0x86,0x49,0x88,
+0xb0,0x22,0x88,0x29,0xa0,0x8f,0x07,0x99,0x0a,0x93,0x18,0x21,0x8d,0xc3,0x0e,0x03,
+0x1a,0x09,0x96,0x09,0x03,0x1c,0x90,0x2a,0x45,0xf1,0x2a,0xa8,0x11,0x98,0x29,0xa1,
+0xdb,0x20,0x21,0xa3,0x4e,0x93,0x19,0x88,0xab,0x3d,0x86,0x9a,0x20,0x30,0x8c,0x97,
+0x38,0x10,0x80,0x28,0xe1,0x01,0x1d,0xc9,0x02,0x92,0x8a,0x8f,0x94,0x20,0x89,0xa1,
+0x19,0x98,0x70,0xc2,0x21,0x9a,0x9b,0x14,0x17,0x9a,0x80,0x80,0x79,0xc0,0x02,0x8b,
+0x18,0x99,0x86,0x10,0x0c,0xc1,0x1a,0x03,0x39,0x84,0xa9,0x02,0x2a,0x8d,0xc3,0x38,
+0x30,0x07,0x0d,0x20,0xb0,0xb0,0x79,0x8a,0x88,0x85,0xac,0x24,0xaa,0x29,0xa1,0x01,
+0x8e,0x88,0x00,0x09,0xd1,0x20,0x20,0xa8,0x71,0xb1,0x19,0x80,0x93,0x0c,0x03,0x2e,
+0xa5,0xa0,0x2d,0xd1,0x42,0x19,0xaa,0x81,0x30,0x18,0xf3,0x20,0x1a,0x81,0xa9,0x14,
+0x89,0x0a,0x7c,0xa3,0xcb,0x1b,0x85,0x99,0x41,0x89,0x90,0x21,0x16,0x0a,0xb8,0x94,
+0x7a,0x80,0x81,0x2a,0xfb,0x49,0xca,0x23,0x19,0x98,0xd3,0x4a,0xb8,0xa0,0x48,0x09,
+0x05,0x08,0x94,0x4b,0xc8,0x10,0xda,0x10,0x9a,0x03,0x88,0xc8,0x15,0x38,0xeb,0x80,
+0x03,0x1e,0x98,0x84,0x1b,0x10,0x02,0x99,0x58,0xa8,0x91,0x5d,0xa2,0x40,0x08,0xca,
+0x82,0x7c,0xb1,0x80,0x8a,0x82,0x8f,0x03,0x0a,0x08,0x90,0x85,0x18,0x28,0xf0,0x22,
+0x2a,0x88,0xc8,0x00,0x11,0xa1,0x0f,0x91,0x18,0x96,0x28,0x5a,0x02,0x83,0x19,0x4c,
+0x01,0xd2,0x33,0x8f,0x08,0xa0,0xb8,0x3c,0x83,0x09,0x59,0xe1,0x00,0x29,0xb1,0x29,
+0xbd,0x16,0x11,0x1a,0x09,0x83,0xd0,0x4b,0x99,0x04,0x0b,0x89,0xa8,0xc8,0x22,0xe9,
+0x1f,0x11,0x90,0x0a,0x30,0x2a,0x07,0xa8,0x49,0xa2,0x48,0xd9,0x30,0x01,0x98,0x28,
+0xca,0xeb,0x33,0x00,0x41,0x22,0x9c,0x93,0x8c,0x8a,0x98,0x37,0x0d,0x82,0x80,0x08,
+0x98,0x72,0xc1,0x29,0x91,0xc8,0x4a,0xa9,0x82,0x1a,0xbf,0xa2,0x78,0x82,0xa1,0x0a,
+0x2a,0xec,0x02,0x3a,0x99,0x22,0xb1,0x8e,0x15,0xa8,0x20,0x0a,0x86,0x90,0x0c,0x88,
+0x12,0xca,0x20,0x29,0x26,0xae,0x85,0x18,0x98,0x08,0x88,0x10,0x94,0x18,0xba,0x3c,
+0xb3,0x9e,0xb2,0x2b,0x9e,0x93,0x06,0x09,0x1d,0x84,0xa0,0x38,0x3c,0xf3,0x28,0x88,
+0x10,0x18,0x90,0x22,0x24,0x9f,0xba,0x25,0x0b,0x11,0xb9,0xa8,0x63,0x99,0x90,0x00,
+0xb5,0x7a,0xa8,0xa9,0x91,0x38,0x30,0x92,0x1c,0xb5,0x99,0x79,0xb1,0xa1,0x28,0xa1,
+0xa1,0x0f,0x81,0x21,0x14,0x4a,0xf9,0x01,0x19,0x29,0xb2,0x0a,0x19,0xc4,0x1b,0xb8,
+0xa9,0xb5,0x49,0x20,0x86,0x00,0x0c,0xc1,0xa8,0x39,0x32,0xa6,0x0c,0x84,0x08,0x8b,
+0x12,0xe8,0x8d,0x85,0x2a,0x00,0xa3,0xba,0x4c,0x11,0xe3,0x0a,0x30,0x28,0x91,0x11,
+0x49,0xa5,0x8f,0x91,0x01,0x3a,0xa1,0x90,0x86,0x8b,0x29,0xb9,0x02,0x32,0xf2,0x4b,
+0x10,0x19,0xb0,0x04,0x92,0x9f,0x02,0x0b,0x16,0x01,0x5a,0xc3,0x5a,0x91,0x8b,0x23,
+0xbb,0x00,0x0e,0xa0,0x22,0x80,0x18,0x8a,0x27,0x99,0x8b,0xf8,0x5d,0xb8,0x22,0x09,
+0xa9,0x81,0x90,0x69,0x02,0xa2,0x09,0x7b,0xaa,0x87,0x8b,0x20,0x90,0x19,0x20,0x13,
+0xc8,0xa0,0x6b,0x21,0xa5,0x99,0x70,0xb0,0x19,0x82,0x1b,0xe2,0x09,0xc8,0x12,0x29,
+0x84,0x8d,0x05,0x18,0xbb,0x51,0xb2,0x33,0x98,0x4c,0xe2,0x10,0x19,0x9a,0x13,0x2a,
+0xdb,0xd2,0x51,0x89,0x29,0xa1,0x20,0xbd,0x58,0xa2,0x08,0x18,0x88,0x59,0x43,0xea,
+0x0b,0x89,0x22,0x38,0xdb,0x95,0x1c,0xd9,0x28,0x82,0x13,0x8c,0x03,0x2b,0x59,0xd2,
+0x01,0x88,0x0d,0xc0,0x33,0x0c,0xa8,0x90,0x12,0x3a,0x95,0x1b,0xc4,0x3b,0x4b,0x87,
+0x09,0x11,0xaa,0xe9,0x08,0x02,0x40,0xe0,0x08,0x69,0xb1,0x80,0x39,0xcb,0x02,0x10,
+0x92,0xda,0x51,0x09,0x02,0x10,0xb9,0x88,0x28,0x9b,0x41,0xf8,0x38,0x0b,0xbf,0x86,
+0x01,0x0a,0x12,0x29,0xc3,0x9b,0x8a,0xa9,0xd0,0x01,0x1f,0xab,0x85,0x1b,0xb3,0x61,
+0x99,0x23,0x89,0x02,0x3a,0xd0,0x09,0x2d,0x91,0x37,0x0b,0x02,0x83,0x1d,0xd3,0x4b,
+0x88,0x28,0x03,0x92,0x2c,0xc0,0x91,0xcf,0x21,0x20,0xb4,0x38,0x9a,0x9b,0x15,0xa1,
+0x48,0x9a,0x11,0x99,0x09,0xbb,0x57,0x3b,0xf2,0x39,0xe0,0x28,0x02,0x19,0x99,0xd8,
+0x32,0x0f,0x82,0x80,0x30,0x91,0xd3,0x59,0x88,0xc8,0xb1,0x5a,0x80,0x8a,0xa1,0x23,
+0x09,0x50,0xa2,0x0c,0x31,0xa7,0x49,0x0b,0xa0,0x68,0xb9,0x24,0x9a,0x80,0x09,0xa8,
+0xa1,0x55,0xab,0x20,0x88,0x92,0x91,0xbf,0x42,0xbb,0x21,0xa8,0x1c,0xc0,0x79,0x80,
+0x00,0xba,0x29,0x00,0xc3,0x8c,0x73,0xc1,0x99,0x62,0x99,0x11,0xa0,0x24,0x09,0x09,
+0xa4,0x2d,0xa8,0x41,0x09,0x07,0x89,0x00,0x98,0xa9,0xcc,0x20,0x11,0x9c,0xd9,0x20,
+0x80,0x79,0xa0,0xa2,0x28,0x39,0x25,0x81,0xac,0xc3,0x5b,0x00,0x91,0xb9,0x15,0x9a,
+0x10,0x90,0xa2,0x0b,0x7a,0xb2,0x59,0xb1,0x25,0xbb,0x10,0x99,0xc7,0x1d,0x12,0xa8,
+0xa1,0x00,0x0c,0x15,0xa9,0x68,0xc9,0xa2,0x59,0x89,0x02,0x9d,0x82,0x39,0xc1,0x32,
+0x1c,0xc1,0x01,0xeb,0x22,0x8a,0x20,0x28,0xb4,0x03,0x29,0x29,0x73,0xd4,0xa8,0x20,
+0x3c,0x92,0xf2,0x31,0x2c,0x9a,0x11,0xa1,0x2c,0x20,0x8d,0x04,0x8a,0x00,0x0e,0xb3,
+0x1a,0x19,0x24,0xbe,0x01,0x19,0x28,0xa8,0xb3,0x70,0x90,0x83,0x7b,0xe3,0xa8,0x23,
+0x2a,0xab,0xb1,0x26,0x1d,0x91,0x88,0x29,0xb0,0x18,0x8e,0x91,0x98,0x41,0x43,0xbb,
+0x04,0x22,0x09,0x5b,0xc9,0x97,0x21,0x0b,0xfa,0x00,0x02,0x3b,0x90,0xc3,0x18,0x08,
+0x29,0x99,0xb5,0x55,0xaa,0x88,0x11,0x91,0xc0,0x8b,0x0f,0xa0,0x22,0x21,0x8e,0x28,
+0x92,0x8c,0x14,0x98,0x9a,0x38,0x87,0x08,0x21,0xa8,0x41,0xf8,0xa8,0x71,0x90,0xa9,
+0x98,0x21,0x0a,0x0a,0x42,0xe3,0x6a,0x98,0x81,0x91,0x0a,0x30,0xf9,0x22,0x99,0x82,
+0x43,0xaf,0x90,0x10,0xaa,0x95,0x48,0x81,0x09,0xa0,0x83,0x42,0x89,0xba,0x9d,0x93,
+0x20,0x62,0x9b,0xb1,0x87,0x3b,0x23,0xda,0x02,0x81,0x3d,0xc3,0x90,0x10,0xa0,0x7b,
+0x92,0x38,0xa2,0x33,0x78,0xa0,0xb8,0xc5,0x3a,0x09,0x92,0x12,0xc8,0x1d,0x19,0xb6,
+0x9a,0xa9,0x08,0x0e,0x14,0x92,0x18,0x8a,0xcf,0x22,0x04,0x0b,0xc0,0x91,0x2c,0xb0,
+0x17,0x28,0xb8,0x80,0x08,0xc9,0x74,0x9a,0xd3,0x19,0x11,0x9a,0xa1,0x00,0x42,0x02,
+0xcc,0x03,0xa9,0x8f,0x33,0xb8,0x20,0x43,0x8d,0x13,0xd9,0x19,0x39,0xaa,0xe1,0x12,
+0x2a,0x28,0xcb,0x12,0xa0,0x34,0x51,0x00,0x91,0xdb,0x88,0x18,0xdc,0x9a,0x00,0x2a,
+0x91,0xe0,0x01,0x0a,0x17,0x5a,0xb3,0x29,0x30,0xf9,0x00,0x0d,0x90,0x22,0x80,0x8a,
+0xb9,0x27,0x8c,0xa1,0x0a,0x20,0x11,0x97,0x2b,0x15,0x98,0xa9,0x04,0x2a,0x9a,0x08,
+0x27,0x0a,0x20,0xa9,0x33,0xdb,0xa2,0x8f,0x92,0x8a,0x33,0xb8,0x92,0x82,0xff,0x28,
+0xa1,0x31,0x03,0xcc,0x48,0xba,0x14,0x3a,0x8b,0xe4,0x11,0x8c,0x91,0x31,0xa3,0x09,
+0x80,0x11,0xf8,0x5b,0x99,0xd9,0x92,0x3c,0xa0,0xa8,0xa8,0x72,0xab,0x20,0xa1,0x31,
+0xad,0x34,0xac,0x82,0x3b,0xa3,0x35,0xa0,0x1a,0x75,0x00,0xb1,0x1b,0x99,0x52,0xb0,
+0x43,0x18,0x1a,0x17,0xa9,0x98,0x6a,0x98,0xc1,0x71,0x80,0x99,0x81,0x28,0x89,0xa8,
+0x20,0x1b,0x59,0x87,0xab,0x20,0x0c,0x83,0xa0,0x39,0x33,0x90,0x74,0xc3,0xba,0x89,
+0x70,0x83,0x8c,0x92,0x42,0x8c,0xc2,0x42,0xa9,0xa9,0xc9,0x69,0x10,0x80,0x98,0x30,
+0x9b,0xb3,0x2b,0xf3,0x1b,0x18,0x34,0x11,0xfb,0x0d,0x92,0x40,0x00,0x91,0x18,0x9f,
+0x04,0x28,0x88,0x80,0x81,0x0a,0xa0,0x60,0x13,0xdb,0xea,0x10,0x49,0xa3,0x90,0x29,
+0x18,0xb0,0xf3,0x2b,0x08,0xc0,0xbc,0x24,0x9d,0xa2,0x89,0x80,0x72,0x90,0x82,0x38,
+0x91,0x2c,0xa1,0x94,0x20,0x4e,0xb8,0x04,0xa1,0x98,0x1c,0x12,0xb6,0x39,0x89,0x33,
+0xba,0xf3,0x1f,0xb0,0x02,0x19,0x1a,0xa2,0x24,0x19,0x39,0x94,0xab,0x9c,0x15,0x02,
+0x8f,0x80,0x03,0x80,0x9e,0x88,0x91,0x64,0x00,0x98,0x09,0xb1,0x89,0xaa,0x7a,0xa8,
+0x92,0x54,0x8a,0xc9,0x08,0x81,0x39,0x04,0x81,0xca,0x7b,0xc0,0x91,0x19,0x48,0x0a,
+0xe3,0xa0,0x19,0x1f,0x90,0xb0,0x43,0xc9,0x28,0x8c,0xa4,0x28,0x22,0x13,0x2c,0x95,
+0x20,0xa9,0x27,0x8b,0xb0,0xa9,0x34,0x99,0xbb,0xc8,0x55,0x08,0xb8,0x0a,0xa0,0x90,
+0x42,0x32,0xb2,0x9e,0x42,0x02,0x3a,0x64,0xa0,0x09,0xba,0xa9,0xb8,0x33,0xdf,0xb8,
+0x20,0x23,0x64,0x00,0x82,0x9f,0x93,0x2a,0x89,0xa1,0x02,0x2b,0xc0,0x29,0x9c,0x05,
+0xac,0xa2,0x2e,0x21,0x89,0x27,0x90,0x19,0x89,0xd9,0x19,0xc4,0x49,0x8a,0xa3,0x80,
+0x2b,0x05,0x89,0x51,0x80,0xb8,0xa3,0x4b,0xaf,0x54,0xb1,0x08,0x01,0x3c,0xa1,0xa2,
+0xa1,0x3b,0xfa,0x00,0x11,0x08,0x80,0x93,0x4b,0x8d,0x97,0x18,0xd8,0x48,0x29,0xd3,
+0x08,0x08,0xb0,0x0b,0x35,0xb2,0x39,0xb9,0x9a,0x49,0x03,0x0d,0x82,0x71,0x92,0x08,
+0xa0,0x31,0x50,0x4d,0xd4,0x8b,0x08,0x18,0x82,0x08,0xb4,0x40,0xa8,0x93,0x08,0x2f,
+0x94,0x14,0x0c,0x98,0x98,0xb1,0x0a,0x25,0x9b,0x09,0x80,0x62,0xc0,0x19,0x1b,0x17,
+0x99,0x8e,0x02,0x19,0xe3,0x2a,0x99,0x94,0x4a,0x09,0xa2,0x03,0x0f,0x81,0x00,0x11,
+0xb2,0x4b,0x49,0xf8,0x11,0x18,0x08,0xb0,0x89,0x2c,0xe9,0x53,0x88,0x03,0x9f,0x90,
+0x80,0x8a,0x32,0x88,0xb9,0x54,0x8d,0x92,0x18,0x88,0x9a,0x39,0xb3,0x23,0xaf,0x08,
+0xc3,0x38,0x2b,0xda,0xb8,0x46,0xca,0x3a,0xc8,0x12,0x81,0x78,0xa0,0xb3,0x3b,0xe1,
+0x21,0x01,0x80,0xc8,0x01,0xc8,0x6b,0x00,0x88,0x34,0xa9,0x9b,0xa1,0x15,0x0a,0x04,
+0x09,0x99,0x53,0xba,0xf8,0x7b,0x91,0x88,0x99,0x32,0x93,0x0c,0xb8,0xc0,0x2c,0x80,
+0x48,0xd1,0x81,0x4b,0xb9,0x0d,0x97,0x11,0x0c,0xa1,0x00,0x10,0x81,0x88,0x4b,0xd8,
+0x88,0x25,0x09,0x7b,0xa2,0x02,0x98,0x0a,0x29,0x11,0xa9,0x87,0x78,0xa1,0x80,0x9c,
+0x02,0x11,0x88,0xba,0x00,0xa6,0x79,0xd1,0x10,0x90,0x28,0x99,0xa2,0x99,0x13,0x4e,
+0xc3,0x28,0x01,0x8b,0x17,0xa8,0x00,0xb9,0x12,0x71,0xbc,0x22,0x90,0x2e,0xa1,0xa0,
+0x11,0xa9,0x11,0x0a,0xd1,0x43,0x9b,0xf3,0x49,0x91,0x88,0x18,0x12,0x06,0x1a,0x4a,
+0xa4,0x10,0x8f,0x81,0x90,0xa9,0x78,0x93,0x18,0xb0,0x52,0x88,0xb8,0x1a,0xea,0xb1,
+0x6a,0x93,0x1a,0x8a,0xb1,0x19,0x43,0x16,0x0d,0x19,0xd1,0x81,0x19,0x1c,0xe8,0xa0,
+0x20,0x1c,0xb1,0x12,0x19,0x11,0x3b,0xb7,0x39,0x23,0x02,0x2e,0xa0,0x06,0x1b,0x38,
+0xea,0x92,0xaa,0x40,0x89,0xa8,0x51,0x30,0x98,0x94,0x4a,0x8c,0x85,0x90,0x5a,0x88,
+0x48,0x99,0x05,0x28,0x8e,0xa1,0x20,0x98,0x8d,0x03,0x90,0x59,0x18,0xd2,0xa9,0x81,
+0x5a,0xb2,0x80,0x2a,0x50,0x23,0xbe,0xb9,0x61,0x80,0xae,0xa5,0x48,0x89,0x90,0x08,
+0x18,0x01,0x11,0xbb,0x05,0x3a,0x9a,0x87,0x09,0x81,0x9d,0x81,0x92,0x48,0x8a,0xf0,
+0x38,0x94,0x29,0x99,0x87,0x8b,0x21,0xa9,0x91,0x9b,0x21,0xa6,0x11,0x4a,0x91,0xe1,
+0x51,0x1c,0xb0,0x08,0x1b,0xb0,0x23,0x53,0x10,0x01,0xb8,0xc0,0x3d,0x91,0x1a,0x29,
+0x70,0x97,0x1b,0x03,0xaa,0x92,0x0e,0x22,0x98,0x18,0x33,0x93,0x14,0x2d,0xfb,0x19,
+0x11,0xea,0x8b,0x00,0x15,0x89,0x11,0x2a,0xe3,0x18,0x18,0x19,0x92,0xf3,0x6b,0xc0,
+0x10,0x10,0x34,0x9c,0xb2,0x3a,0x39,0xf2,0x19,0x99,0x0b,0x00,0x30,0xa2,0x2a,0xfb,
+0xa3,0x8f,0x22,0x11,0x12,0x99,0x1a,0x1a,0x8e,0xe2,0x38,0x18,0x99,0x83,0xa8,0x53,
+0x2d,0x84,0x81,0xb2,0x6b,0xbc,0x94,0x98,0x8a,0x1a,0xaa,0x51,0x22,0xf0,0x61,0x98,
+0x89,0xb1,0x3a,0x81,0x92,0x9b,0x5d,0x02,0x96,0x1b,0x18,0xe1,0x21,0x0b,0xb8,0x02,
+0x0c,0x14,0x8b,0x90,0x46,0x01,0x9b,0x92,0x41,0x3b,0xdb,0x17,0x0a,0x11,0xbc,0x91,
+0x2b,0x03,0x88,0x35,0x0b,0x97,0xa8,0x0e,0x23,0x81,0x1a,0x9e,0xb4,0x20,0x4a,0xb8,
+0x86,0x18,0x9b,0x21,0x58,0xb3,0x9c,0x90,0x4b,0xa0,0x01,0x0b,0x82,0x9a,0xaf,0x62,
+0xa1,0x19,0x90,0x4b,0xc0,0x82,0x0a,0x8f,0x21,0xb1,0x91,0xcb,0x31,0x0c,0x85,0x8b,
+0x11,0xb0,0x91,0x7c,0x95,0x91,0x20,0x99,0x28,0xac,0xb2,0x05,0x8a,0x8b,0x24,0xd8,
+0x80,0x38,0x79,0x83,0x8a,0x98,0x9c,0x18,0x99,0xc3,0x70,0x9e,0x83,0x49,0xb9,0x81,
+0x2c,0x94,0x09,0x80,0x93,0x3a,0x8a,0x27,0x21,0x81,0xca,0x60,0xa9,0x93,0xcb,0x68,
+0x99,0xb3,0x28,0xaf,0x14,0x90,0x20,0xc9,0x02,0x2b,0xa3,0x33,0x49,0xa1,0xfb,0x90,
+0x3b,0xa2,0xf0,0x1a,0x19,0x06,0x21,0x98,0x40,0xa0,0x00,0xb9,0x24,0xbd,0x91,0x22,
+0xb0,0x98,0xcf,0x25,0xa8,0x01,0x8b,0xb2,0x34,0x8a,0x28,0x61,0xd9,0x9c,0x83,0x13,
+0x9f,0x15,0x0c,0x91,0x01,0x1a,0x9b,0x32,0xb4,0x19,0x92,0x79,0xb8,0x02,0xb5,0x3b,
+0x88,0x01,0xb7,0x7b,0x90,0x09,0x02,0x29,0xb2,0x28,0xba,0x6b,0xa3,0x02,0x0c,0x09,
+0x97,0x39,0xb1,0x0a,0xad,0x61,0xa2,0x08,0x1e,0x81,0x81,0x9d,0x91,0x49,0x28,0xb2,
+0x89,0x99,0x72,0x88,0xaa,0xa1,0x60,0x00,0x80,0x80,0x3b,0xfa,0x40,0xa9,0xa1,0x81,
+0x6a,0x82,0xb9,0x06,0x59,0xba,0x05,0x08,0xab,0x00,0x0a,0x95,0x32,0x9b,0x50,0xb0,
+0xd2,0x59,0x9b,0x91,0x88,0x0a,0xb7,0x1a,0x8c,0x02,0xb2,0x30,0x4c,0xa1,0x33,0x2b,
+0x06,0x88,0x9e,0x08,0x02,0x11,0x40,0x81,0xfb,0x12,0x3a,0x98,0xa1,0x1d,0x35,0xb0,
+0x18,0x1a,0xdb,0xb1,0x48,0x58,0xf1,0x29,0xa9,0x01,0x8a,0xa9,0x52,0x9b,0xa2,0x81,
+0x39,0x3b,0xf2,0x21,0xbf,0xa0,0x17,0x19,0x10,0xc8,0x98,0x0d,0x81,0x13,0x20,0xb9,
+0x14,0x79,0x04,0x98,0x0b,0x03,0xa1,0x2b,0x2c,0x94,0x18,0x86,0x2b,0x9e,0x01,0xa4,
+0x18,0x79,0xc1,0x09,0x88,0x09,0x02,0xa8,0x20,0x2e,0xe2,0x8a,0x21,0x04,0x2c,0x98,
+0x83,0xa9,0x18,0x29,0xf8,0x29,0x21,0x19,0xb3,0x1f,0xa1,0x38,0xa8,0xb9,0x9d,0x01,
+0x31,0xff,0x21,0x89,0x91,0x00,0xe2,0x3c,0xc0,0x14,0x09,0x81,0x9b,0x83,0x00,0x42,
+0x9f,0x01,0x81,0x49,0x02,0x99,0x88,0x88,0x04,0x1a,0x03,0x30,0x70,0xa5,0x19,0x8a,
+0x84,0xed,0x28,0x91,0xa2,0x39,0x11,0x29,0xca,0xd8,0x30,0x06,0x4b,0xbb,0x94,0x38,
+0x90,0x08,0x0a,0xf4,0x38,0x19,0x00,0x85,0x9a,0x40,0x95,0x2f,0xb1,0xa1,0x28,0x2b,
+0x11,0xf8,0x11,0x80,0x20,0xe4,0x1a,0x09,0x82,0x91,0x88,0x2a,0x30,0xa7,0x98,0x2c,
+0x0a,0xf1,0x11,0x00,0x9a,0x98,0x71,0x92,0x01,0x3b,0xd3,0x0a,0x01,0x38,0x21,0xa3,
+0x5b,0xb2,0x2b,0xdf,0x04,0x20,0xab,0x91,0xac,0x10,0x5b,0x86,0x0b,0x93,0x80,0x1b,
+0xcb,0x97,0x48,0xc8,0x01,0x41,0x0a,0x90,0xa9,0x02,0x2e,0x91,0x00,0xb3,0x29,0x4c,
+0x81,0xd0,0x18,0x44,0xeb,0x81,0x1a,0xc9,0x20,0x39,0x98,0xc1,0x80,0x2e,0x08,0x85,
+0x08,0x89,0x30,0xdb,0x24,0xd2,0x60,0x8b,0xb2,0x02,0x28,0x30,0x1a,0xf2,0x59,0x9a,
+0x09,0x14,0x88,0x98,0x08,0xe0,0x1b,0x13,0x09,0x01,0x18,0x62,0xb1,0xaa,0x99,0x69,
+0xc8,0x06,0x18,0xbb,0xb1,0x3a,0x7a,0xc1,0x04,0x5b,0xc8,0x20,0xa9,0xa1,0x29,0x3b,
+0x17,0x09,0x28,0xc8,0x80,0x20,0xb9,0x50,0x93,0x0b,0xab,0xa7,0x68,0x18,0x00,0x81,
+0x8d,0xc2,0x2c,0x10,0xd0,0x81,0x8a,0x20,0x8d,0xc4,0x38,0x8a,0x84,0x19,0x28,0x81,
+0x2a,0x00,0x73,0x95,0x0e,0x90,0x23,0x98,0x34,0xaf,0x91,0x10,0x1b,0x90,0xa2,0x3a,
+0x9f,0x12,0x30,0x04,0x1b,0xa0,0x02,0x51,0xb8,0xaf,0x28,0x01,0x28,0x01,0x17,0x1b,
+0x08,0xf3,0x08,0x11,0xb8,0x8a,0x01,0x64,0xca,0x05,0x2c,0x08,0x90,0x10,0x20,0x40,
+0x99,0x96,0x29,0x88,0x8d,0xa3,0x08,0x48,0xb0,0xd0,0x0c,0x01,0x8c,0xa0,0x41,0x82,
+0x3d,0xa8,0x25,0x8a,0x98,0x0a,0x01,0x3c,0xd1,0x91,0x1f,0x60,0xb1,0x00,0x11,0x8c,
+0x8a,0x80,0x0d,0xa3,0x70,0x00,0x8a,0x80,0xa2,0x2d,0xc8,0x83,0x28,0x1c,0x95,0x01,
+0x0e,0x10,0x18,0xa1,0x06,0x3b,0x01,0x48,0x80,0xc2,0x0b,0x82,0x9c,0x4b,0xa6,0xa0,
+0x2c,0x02,0x21,0xb1,0x8f,0x03,0x88,0xc0,0x3a,0xa3,0xd0,0x00,0x6b,0x81,0xa1,0x8e,
+0x14,0x8b,0x21,0x80,0xa1,0x8b,0x42,0x8a,0xb1,0x9f,0xc4,0x49,0x80,0x11,0xa8,0xb9,
+0x09,0x19,0x07,0xa9,0x38,0xfa,0x40,0xbb,0x08,0x18,0xb4,0x2b,0x00,0x04,0x53,0xa0,
+0x10,0xd1,0x10,0x48,0xf9,0x30,0xc8,0x18,0x00,0xaa,0x83,0xb0,0x0f,0x04,0x02,0x9a,
+0xca,0x42,0x33,0x0c,0xc2,0x50,0x99,0x01,0x21,0xd8,0x2d,0xa1,0x3a,0xc3,0x3b,0x31,
+0xe9,0x84,0x2d,0x88,0x92,0xa8,0x52,0x8c,0xb2,0x43,0x3a,0xd8,0xa9,0x52,0x08,0x02,
+0x30,0xaf,0x94,0x2b,0x98,0xbc,0x26,0x00,0x1a,0xd8,0x22,0x9a,0x08,0x83,0xbb,0x71,
+0x01,0x9e,0x85,0x29,0x08,0x88,0x18,0xc1,0x98,0x59,0xd9,0x22,0x9c,0x01,0x80,0x30,
+0x1a,0xa6,0x1b,0xb3,0x28,0x9a,0x0e,0x02,0xa2,0x9f,0xa3,0x1a,0x03,0x88,0xc3,0x8f,
+0x94,0x13,0x8d,0x00,0x10,0x97,0x3b,0xab,0x14,0x90,0x59,0x11,0xb9,0xe1,0x28,0x88,
+0xb0,0x10,0x91,0x8d,0xe0,0x21,0x0a,0xaa,0x34,0x96,0x1a,0x13,0x1b,0xea,0x81,0x09,
+0x01,0x38,0x17,0xc1,0x8a,0x22,0x38,0x0a,0x86,0x91,0x1f,0xc9,0x01,0x40,0x80,0xd1,
+0x31,0xaa,0x99,0x09,0x32,0xc6,0x3a,0x88,0xc0,0x21,0x01,0x0c,0xf0,0x80,0x30,0xa8,
+0x85,0x41,0x9a,0x92,0x2a,0x86,0xa9,0x2b,0x68,0xe0,0x20,0x1a,0x92,0xa0,0x90,0x4b,
+0x90,0xa4,0xa0,0x79,0x91,0x9b,0xb2,0x51,0x3a,0x97,0x9c,0x11,0x32,0xd1,0x38,0xac,
+0x98,0x15,0x39,0xb4,0x2b,0x09,0xaa,0xa0,0x71,0x98,0x31,0xab,0x02,0xbb,0x2b,0x23,
+0xa3,0x3c,0xb7,0x0f,0x91,0x2a,0xa1,0x8a,0xd0,0x8d,0x92,0x52,0x10,0xab,0x86,0x60,
+0x99,0x08,0xb2,0x19,0x0c,0x03,0xe2,0x09,0x12,0x22,0x0b,0x17,0x0a,0x83,0x38,0xbf,
+0x21,0xa0,0x82,0x4d,0xba,0x85,0x20,0x9b,0x12,0xd9,0x21,0xa3,0x2e,0xa9,0xa4,0xa9,
+0x42,0x09,0x12,0x0b,0xb8,0xd8,0x3b,0x15,0x8b,0x1d,0x17,0x91,0x10,0xba,0x18,0x89,
+0x8b,0x17,0x0b,0x1f,0x95,0x88,0x9b,0x02,0x30,0x4a,0x93,0x92,0x03,0x1f,0xf8,0x02,
+0x0a,0xa0,0x86,0x4a,0x98,0xa3,0x1a,0xa9,0x09,0xea,0x32,0x99,0x50,0x91,0x98,0x69,
+0x93,0x3e,0xc1,0x22,0x0a,0x00,0xa8,0x51,0x91,0x98,0x9c,0x05,0x00,0x0d,0xa8,0xe2,
+0x48,0xb9,0x10,0xa9,0x23,0xb2,0x79,0xb2,0x99,0x28,0x9a,0x16,0x28,0x9c,0xa1,0x22,
+0xca,0x8e,0x26,0xaa,0xb8,0x22,0x8e,0x01,0xa2,0x41,0xb8,0x48,0x8a,0x85,0x98,0x11,
+0x09,0x83,0xfb,0x78,0xa8,0xa2,0x49,0x89,0x91,0x29,0xc2,0x69,0xa9,0x33,0x1b,0xa3,
+0xb9,0x8c,0xb9,0x26,0x99,0x49,0xb7,0x28,0x3b,0xb8,0xc4,0x3b,0x21,0xa4,0x9f,0x81,
+0x09,0x19,0x80,0xa3,0x1f,0x21,0x02,0x04,0x8c,0x92,0x50,0x81,0x90,0x11,0x11,0xfb,
+0x8b,0x81,0x28,0x95,0x0f,0x00,0xa3,0x29,0x8c,0x02,0x32,0xf1,0x1c,0x10,0x2b,0xc5,
+0x39,0x90,0x48,0xc8,0x08,0x83,0x1d,0xa3,0x90,0x59,0x08,0x80,0x95,0x2c,0x88,0xa0,
+0x5a,0xd2,0x51,0x09,0xa0,0x91,0x0b,0xd9,0x28,0x33,0xbc,0x48,0xb0,0x35,0x0c,0x82,
+0xd1,0x2a,0x18,0x38,0xc0,0xaa,0x62,0x9a,0xb1,0x31,0x9f,0x42,0x99,0xc3,0x39,0x0f,
+0x93,0xb1,0x11,0x49,0x18,0xd2,0x2a,0x80,0xe1,0x39,0x00,0xc0,0x11,0x30,0x8a,0xc1,
+0x9d,0x18,0x96,0x2b,0xb8,0x51,0x14,0x19,0x03,0x21,0xbe,0x80,0x90,0x3b,0x95,0xb2,
+0x39,0x7c,0xc1,0x00,0x28,0xb9,0x39,0x1a,0xf3,0x5b,0x08,0x28,0xb1,0x05,0x1b,0x0a,
+0xa5,0x81,0x9a,0x4a,0xc0,0x22,0x92,0x20,0xf2,0x0e,0x88,0x08,0x12,0x1a,0x23,0x52,
+0x88,0xe3,0x1a,0xa1,0x2b,0x9b,0xe4,0x39,0x98,0x2a,0x85,0xbb,0x8f,0x31,0xb1,0x60,
+0xa9,0x20,0xa1,0x03,0x4c,0x12,0x89,0xea,0x33,0x0e,0x95,0x1b,0x91,0x11,0xb0,0xaa,
+0x73,0xa1,0x8b,0xb0,0x38,0xa4,0x3b,0x98,0xec,0xa8,0x47,0x9a,0x08,0xa0,0x12,0x29,
+0xb9,0x42,0x91,0x2d,0x93,0x00,0x22,0xaf,0x81,0x08,0x82,0x29,0x09,0x91,0x87,0x09,
+0x60,0xb3,0x8e,0x81,0x90,0x3c,0x89,0xb2,0x80,0x79,0xe2,0x50,0xa0,0x89,0x09,0xa0,
+0x25,0x0c,0x82,0xaa,0x30,0x12,0x91,0x30,0x37,0x9b,0x26,0xea,0x08,0x81,0x09,0x12,
+0xaa,0x61,0xca,0x88,0x98,0xaa,0x42,0x99,0xd9,0x10,0x3a,0x93,0x45,0x08,0x22,0xfa,
+0xb9,0x71,0xb0,0x2a,0x02,0xba,0x24,0x09,0x22,0x9a,0xd3,0x2c,0x11,0x29,0x86,0x98,
+0xbd,0x21,0x9a,0x43,0xc1,0x0c,0xb4,0x39,0x8a,0x61,0xd1,0x82,0x4a,0x2b,0xc4,0x29,
+0x28,0xd8,0x20,0x8a,0xb8,0x04,0x9f,0x81,0x41,0x89,0x19,0xa4,0x1b,0x31,0x16,0x90,
+0x90,0x0d,0xc0,0x00,0xa9,0x09,0x38,0x30,0xf2,0x1a,0x99,0x18,0x59,0x86,0x9a,0xa2,
+0x49,0x9c,0x86,0x80,0x18,0x28,0x12,0xa0,0x88,0xc3,0x7b,0xa0,0xa0,0x15,0xb2,0x3c,
+0xdb,0x80,0x04,0x1c,0x04,0x9a,0xb1,0x06,0x9b,0x89,0x05,0x88,0x10,0x88,0x59,0xa4,
+0x2a,0x1e,0xa5,0x00,0x0a,0x89,0xc9,0x24,0x98,0x1e,0x98,0x92,0x10,0x9b,0x59,0xda,
+0x32,0x8a,0x23,0xc9,0x54,0x80,0x99,0x92,0x28,0x30,0xf0,0x41,0x98,0xa0,0x18,0x1b,
+0xe3,0x3a,0x0a,0x85,0x62,0x9c,0x04,0x18,0x88,0xb2,0x4a,0x80,0x81,0x01,0x9e,0x98,
+0x9a,0x3a,0x87,0x1b,0x22,0xcb,0x22,0xb2,0xcf,0x51,0x81,0xb8,0x28,0x81,0x8a,0x9a,
+0x86,0x8b,0x30,0xd1,0x26,0x8d,0x92,0x12,0x8a,0x28,0xa9,0x92,0xbc,0x0c,0x21,0xc3,
+0x88,0x81,0x2d,0xad,0x23,0x84,0x70,0x90,0x9b,0x85,0xa0,0x48,0x88,0x11,0xa2,0xf9,
+0x2a,0x38,0xa9,0xb5,0x13,0x3c,0xb1,0x90,0x19,0xf2,0x09,0x11,0xbc,0xd9,0x32,0x43,
+0xad,0x52,0xb1,0x2a,0x08,0x09,0x12,0xf2,0x79,0x89,0xb3,0x88,0x48,0x88,0xb3,0x38,
+0x82,0xaf,0x88,0x01,0x28,0x18,0x91,0x03,0x99,0x0f,0x84,0x9e,0x83,0x41,0xba,0x9d,
+0x92,0x09,0x88,0x70,0x81,0xb1,0x09,0xc9,0x0c,0x93,0x43,0x21,0xdb,0x18,0x01,0xbb,
+0x31,0x63,0xd4,0x9b,0x0d,0xa3,0x1a,0x22,0x8f,0x15,0x00,0x80,0x19,0x0a,0x82,0x62,
+0xd9,0x11,0x1a,0xc8,0xa1,0x32,0x3a,0x81,0xd1,0x08,0x35,0x9a,0xb4,0x1c,0xb8,0x33,
+0x02,0xee,0x81,0x42,0xa9,0x20,0xd0,0x23,0x49,0xc1,0x8c,0x21,0x82,0xd1,0x3b,0xe9,
+0x18,0x83,0x10,0x8f,0x80,0x01,0xa2,0x5c,0xc9,0x83,0x00,0x0b,0x52,0xe0,0x08,0x11,
+0x81,0xa9,0x42,0xb9,0x34,0xfa,0x2b,0xa0,0x08,0x32,0xcb,0x8a,0xb2,0x70,0x18,0x29,
+0x91,0x0b,0x07,0x18,0x51,0x99,0xa1,0xe0,0x28,0x48,0xc0,0xa2,0x18,0x6a,0x81,0x91,
+0x19,0x0c,0xb9,0x44,0x89,0x90,0x22,0x99,0x3c,0xe2,0x03,0x19,0x8d,0x82,0xc9,0x81,
+0x30,0x98,0x95,0x0a,0xd9,0x16,0x19,0xba,0x22,0x92,0xca,0x5a,0x40,0xf2,0x0a,0x22,
+0x09,0x89,0x81,0xf2,0x5a,0xa0,0x89,0x9c,0x21,0xb2,0x2a,0x0d,0x92,0x1c,0x17,0x99,
+0x39,0x12,0xf2,0x38,0xba,0x23,0x8c,0xd3,0x48,0x19,0x90,0x83,0xa0,0x3e,0x81,0xe0,
+0x33,0x9d,0x02,0x0a,0xb1,0x24,0x2b,0x1a,0xf2,0x38,0x01,0x80,0x2c,0x22,0xf1,0x00,
+0x2b,0x9c,0xb2,0x08,0xa0,0x3e,0x01,0xe0,0x92,0x3b,0x0c,0x87,0x81,0x0a,0x90,0x11,
+0x1a,0x87,0x0a,0x0c,0x90,0x19,0x53,0x81,0x91,0x38,0x9a,0xc4,0x00,0x09,0xe0,0x0d,
+0x03,0x06,0x0a,0x80,0x99,0xb0,0x79,0x04,0x30,0xa9,0x99,0xb4,0x0a,0x79,0x81,0xa8,
+0x90,0x48,0x12,0xca,0x18,0x09,0x82,0xa2,0x8f,0x86,0x39,0x94,0x0a,0x0b,0xe9,0x21,
+0xc1,0x1d,0xa1,0x80,0x0a,0x04,0x20,0x02,0x2b,0x28,0xb7,0x8b,0x99,0x86,0x1c,0xa2,
+0x8a,0x93,0x19,0x1d,0xda,0xb2,0x39,0x52,0x10,0xd0,0x03,0x38,0xdd,0x43,0x21,0xc9,
+0x01,0xb1,0x9e,0x00,0x29,0x85,0x30,0xb9,0xb2,0x1e,0x10,0xa1,0x81,0x7b,0x88,0x04,
+0xbc,0x81,0xa1,0x7b,0xa1,0xa8,0x93,0x4b,0x90,0xa3,0xab,0xe8,0x60,0xa0,0x13,0x8d,
+0x02,0x09,0x09,0x13,0xb1,0x2e,0x82,0xfb,0x93,0x2d,0x10,0xc0,0x01,0x01,0x3b,0xa9,
+0xb2,0x0b,0xb7,0x2e,0x89,0xa2,0x29,0x32,0x02,0xae,0x46,0x9a,0x81,0x38,0x83,0x4c,
+0xe2,0x18,0x09,0x12,0xaa,0xd2,0x51,0x88,0x10,0xb8,0x50,0x03,0x8b,0xa1,0x31,0xaa,
+0x37,0x9b,0xab,0x86,0x2b,0xb3,0x08,0x11,0xab,0x1f,0xb7,0x38,0x19,0x19,0x99,0xc2,
+0x41,0x9c,0x42,0x88,0x85,0x81,0x28,0xa9,0xa9,0xb1,0x1f,0x89,0x22,0xa1,0xab,0x0f,
+0x83,0x13,0x1f,0xc2,0x21,0x8e,0x81,0x98,0x3b,0x84,0x22,0x2a,0xba,0xab,0xc2,0x60,
+0x9a,0xea,0x39,0x85,0x08,0x18,0x99,0xc9,0x04,0x1e,0x81,0x30,0x00,0x12,0xc2,0x2d,
+0x01,0xbd,0x26,0x8a,0x02,0x00,0x89,0xbe,0x31,0xb4,0x49,0x0c,0x85,0x81,0x88,0x80,
+0x4a,0xc0,0xa0,0x29,0x21,0xf3,0x29,0x01,0x9c,0x08,0xd3,0x38,0x89,0x09,0x83,0x55,
+0x19,0x91,0x00,0x4a,0xbb,0xa8,0x87,0x8c,0x3c,0x95,0x0a,0xca,0x40,0x8a,0xa0,0x83,
+0x3d,0x88,0xa1,0x99,0x0f,0x94,0x38,0xa9,0x9a,0x20,0x31,0xe2,0x2a,0x36,0x98,0x03,
+0x0b,0x1e,0x05,0x80,0xb9,0x4c,0xb2,0x29,0x00,0xe1,0x2b,0x38,0xd2,0xa8,0x80,0x1f,
+0xa2,0x98,0x88,0x71,0xb0,0x00,0x19,0xc8,0x09,0x48,0x84,0x81,0x89,0x0f,0x05,0x98,
+0x20,0x8c,0x84,0xb1,0x3c,0x90,0x10,0xa0,0x08,0x71,0x91,0x38,0xb1,0x52,0xab,0x84,
+0x89,0x41,0xac,0x09,0x10,0xa7,0x38,0x0b,0xaf,0x05,0x01,0x1a,0x19,0xe3,0x18,0x18,
+0x09,0x22,0x98,0xb0,0x2d,0x99,0x96,0x51,0x28,0xba,0xb3,0x68,0x90,0x09,0x15,0x98,
+0x88,0x9f,0x81,0x1c,0xa1,0x11,0x1a,0x86,0x0a,0xa9,0xa9,0xa1,0x51,0x18,0x17,0x9a,
+0x98,0x14,0x39,0x13,0x9b,0x87,0x00,0xb9,0x3c,0xb3,0xb9,0x28,0xff,0x11,0x83,0x8c,
+0x12,0xac,0x05,0x2c,0xb1,0x08,0x11,0x0a,0x0a,0x33,0xf3,0x4c,0x08,0xa9,0x10,0x98,
+0x91,0x10,0x1d,0x8c,0xa7,0x1b,0x01,0x51,0xb9,0x85,0x28,0x2a,0xb1,0x88,0x89,0x39,
+0xb8,0x9b,0x17,0x00,0x2b,0xfc,0x22,0x8a,0x32,0xba,0x22,0x86,0x1a,0xc1,0x8d,0x27,
+0x1a,0xc0,0x10,0x1a,0xa1,0x9e,0x31,0x28,0x91,0x92,0x70,0x90,0x05,0x8c,0x88,0x80,
+0x99,0xb8,0x49,0x50,0xb0,0x03,0x2a,0x09,0x11,0x8c,0xe0,0x51,0xd9,0x2a,0xa2,0xbd,
+0x31,0x40,0x98,0x96,0x59,0x80,0x09,0x08,0x21,0xba,0x3f,0xb0,0x12,0xac,0x10,0x5b,
+0xc8,0x98,0x01,0x69,0x01,0x80,0x8a,0xc2,0x23,0x1e,0x8a,0xa3,0x22,0x1c,0xb2,0x33,
+0x71,0xe1,0x18,0xa8,0x0b,0x01,0x90,0x10,0xaf,0x13,0x10,0x02,0xa0,0x9b,0xbc,0x15,
+0x3a,0x87,0x09,0xf9,0x81,0x31,0xaa,0x02,0xd1,0x91,0x79,0x88,0xb8,0x52,0xc2,0x0b,
+0x81,0x59,0xe0,0x11,0x09,0x90,0x05,0x8a,0x89,0xb3,0x92,0x19,0x9d,0x32,0xb1,0x51,
+0xc0,0x1c,0x62,0x91,0x0a,0x32,0x91,0x4a,0xdd,0x13,0x89,0x01,0x80,0x40,0x11,0x9a,
+0x90,0x40,0xc0,0x02,0x0d,0xa8,0xa2,0x8f,0x39,0x95,0x9b,0x01,0x19,0x59,0xa1,0x83,
+0x90,0x8b,0x0f,0xf1,0x91,0x2a,0x33,0x26,0xbc,0x31,0x94,0x1a,0x30,0xb0,0x21,0xf0,
+0x2d,0xb8,0x00,0x2b,0x94,0x0a,0xa2,0x9e,0x21,0x18,0x14,0xf8,0x1a,0x99,0x07,0x19,
+0x09,0x93,0x91,0x48,0xc8,0x2a,0x99,0x84,0x18,0x7a,0xc2,0x18,0xa8,0x8a,0x89,0x22,
+0x94,0xbc,0x72,0xa2,0x18,0x2c,0xa3,0xc9,0x32,0x4d,0xe1,0x11,0x9b,0x08,0x90,0x13,
+0xba,0x8d,0x32,0x82,0x26,0x1a,0xc9,0x38,0xcc,0x32,0x81,0x9f,0x93,0x58,0x98,0x8b,
+0x96,0x09,0x0a,0xa3,0x00,0x31,0xd2,0x9a,0x72,0x02,0xa8,0xbc,0x84,0x39,0xca,0x94,
+0x11,0x0c,0x11,0x2a,0xf3,0x19,0x2a,0x93,0xa8,0x45,0x02,0x8c,0xba,0x05,0x0d,0x01,
+0xa0,0x9c,0x12,0xba,0x00,0xdb,0x53,0x11,0x00,0xd0,0x20,0xbb,0x36,0x90,0x88,0x60,
+0xd8,0x92,0x49,0x18,0xba,0xa8,0x13,0x6a,0x00,0x00,0xc8,0x82,0x80,0x2b,0x1e,0xd4,
+0x19,0x01,0xbd,0x38,0x81,0x28,0x85,0x83,0x6a,0x8b,0x94,0x19,0xb8,0x3c,0xb1,0x35,
+0x8b,0x03,0x22,0x1e,0xb8,0x13,0x63,0xab,0x09,0x84,0x1a,0xcb,0x28,0x0b,0x87,0x78,
+0xb0,0x09,0x90,0x81,0x19,0x28,0xf9,0xb8,0x7b,0x83,0x09,0xa9,0x04,0x9d,0x20,0xa9,
+0xa0,0x23,0x9f,0x42,0xa0,0xb0,0x1c,0x19,0x81,0xa4,0x94,0x3f,0x81,0xa3,0x00,0x39,
+0xa9,0x07,0x08,0x8a,0xd8,0x38,0xa8,0x52,0xbc,0x30,0x93,0x33,0x2f,0xb8,0x91,0x00,
+0x60,0x82,0x0e,0xa0,0x04,0x0d,0x80,0x0a,0xa2,0x29,0x35,0x0b,0x03,0x3c,0x85,0x02,
+0x1c,0x98,0x98,0x1f,0xb3,0x39,0x8e,0x83,0x1a,0x33,0xf0,0x08,0x11,0xa9,0x8a,0x02,
+0xa8,0xa7,0x1f,0x83,0x89,0x80,0xa8,0x30,0x29,0x80,0x17,0x12,0x2a,0x03,0x8c,0xc4,
+0xa9,0x5a,0x83,0x1c,0x83,0xfa,0x2a,0x89,0x99,0x94,0x9a,0x3a,0x45,0xc9,0x80,0x14,
+0x0b,0xb8,0x0b,0x25,0x91,0x08,0x0a,0x41,0xf1,0x99,0x6b,0x91,0x91,0xb2,0x51,0x1c,
+0x01,0x94,0x89,0xaa,0x1c,0xb2,0x31,0x89,0x47,0x9a,0xf2,0x09,0x12,0xbb,0x50,0xa2,
+0x00,0x8a,0x96,0x8c,0x11,0xc0,0x88,0x1b,0x03,0x62,0x09,0x90,0x33,0xaf,0x05,0x0b,
+0x88,0x99,0x15,0xa8,0x0b,0x04,0x1c,0x19,0x14,0x02,0x1a,0xa9,0x48,0xc2,0x2a,0xde,
+0x43,0xa9,0x00,0x1c,0xb9,0x16,0x88,0x20,0x11,0x2b,0xa6,0x90,0xa9,0x1d,0x84,0x00,
+0x1d,0x82,0x84,0x0c,0x88,0xb4,0x51,0x9c,0x03,0xa0,0x80,0x10,0x30,0xf2,0x0a,0x19,
+0xab,0xc0,0x4a,0x19,0x16,0x91,0xa8,0x20,0x2b,0x07,0x88,0x8c,0xb0,0x52,0x8c,0x91,
+0x93,0x5b,0x00,0x18,0xec,0x22,0xa8,0x40,0x99,0xa8,0x54,0x90,0x88,0xc0,0x28,0x4b,
+0xe9,0x03,0x18,0x1a,0x00,0x09,0xf0,0x01,0x79,0xb1,0x01,0xa9,0x1a,0xf2,0x08,0x49,
+0xa8,0x23,0x09,0x88,0x10,0x13,0xf8,0x4c,0xc1,0x31,0x8a,0xc0,0x38,0xc8,0x11,0x2a,
+0x90,0x45,0xc1,0x19,0xc1,0x58,0xaa,0xb3,0x1b,0x44,0x8b,0xc2,0xa3,0x5c,0x98,0x91,
+0x9c,0x02,0x0c,0xb1,0x49,0x93,0x90,0x18,0x26,0x1a,0x94,0xd3,0x98,0x48,0x8e,0x95,
+0x80,0x41,0x9a,0xa0,0x30,0x99,0x30,0x97,0x3c,0xa1,0x09,0x9a,0x93,0x99,0xc9,0x2a,
+0x3a,0xd4,0x60,0xba,0x13,0x1b,0x92,0x00,0x38,0x92,0xff,0x31,0x8c,0x98,0x23,0x03,
+0xdc,0x58,0x91,0xc8,0x38,0xc1,0x29,0x90,0x89,0xaa,0x86,0x4c,0xc1,0x18,0x09,0xa0,
+0x19,0x83,0x6b,0x80,0x91,0x01,0x8d,0x72,0xa9,0x82,0x10,0x0b,0xa4,0x18,0x8b,0xc3,
+0xd0,0x49,0x42,0xa2,0x91,0x32,0x0e,0x42,0xa0,0x15,0x0b,0xaa,0x9a,0x81,0x37,0x0d,
+0x83,0x11,0x88,0x89,0x2c,0xf2,0x39,0xd0,0x19,0x89,0x92,0x16,0xa8,0x8e,0x22,0xa2,
+0x29,0x1a,0x02,0xac,0x19,0x14,0x13,0x8f,0x11,0x09,0xba,0x87,0x09,0x99,0x8d,0xa3,
+0x90,0x2a,0x73,0xa8,0xa2,0x6b,0xd8,0x1a,0x33,0x10,0x0c,0x85,0x18,0x08,0x8a,0x21,
+0xba,0x09,0x85,0xaf,0x92,0x10,0x81,0x51,0x11,0xdc,0x30,0x9b,0x82,0x41,0xc9,0x81,
+0x2c,0x92,0x98,0x12,0x7a,0x99,0x98,0xb7,0x1c,0x20,0x12,0x88,0xf0,0x8b,0x81,0x91,
+0x89,0x73,0x81,0x01,0x22,0x8d,0x18,0x14,0xd8,0x28,0x1a,0xc1,0x10,0xa1,0x39,0x92,
+0x3d,0xf9,0x21,0x8a,0x82,0x1c,0x10,0xf8,0x1a,0x22,0x68,0xb8,0xb1,0x30,0x9e,0x21,
+0x8d,0xa3,0x29,0x20,0x43,0x8a,0xb1,0x8c,0x99,0xf8,0x7a,0xa3,0x98,0x88,0x00,0x8c,
+0x85,0x29,0xa1,0x11,0x00,0x41,0x11,0xe9,0x13,0x0c,0xd1,0x59,0x90,0x91,0x98,0x33,
+0x2e,0xc3,0x43,0x99,0x89,0x10,0xc8,0x19,0xf2,0x40,0x19,0xe2,0x19,0x08,0x88,0x81,
+0x90,0x4b,0xc9,0xb8,0x40,0x0e,0x04,0x13,0x8d,0x91,0x81,0x0c,0x94,0x08,0x80,0x2a,
+0xb0,0x14,0x1b,0x05,0xab,0x58,0xfc,0x01,0x30,0x89,0x03,0x09,0xc3,0x3d,0x04,0x89,
+0x92,0x29,0xe8,0x2a,0xd2,0x28,0x0a,0x23,0xf2,0x89,0x20,0x81,0xb0,0xa1,0x7b,0x02,
+0x01,0xa0,0xa2,0x2d,0x01,0xd2,0x1d,0x14,0x38,0xaa,0x83,0xa3,0x8f,0xc8,0x19,0x02,
+0x88,0x40,0xa0,0xc3,0x20,0x1c,0xa1,0x10,0x11,0x07,0x89,0x0f,0xd8,0x32,0xb0,0x1d,
+0x15,0x1b,0xc3,0x29,0x39,0xfb,0x10,0x98,0x10,0x19,0xc3,0x0f,0x13,0x01,0x8c,0xb1,
+0xa2,0x59,0x90,0x28,0x94,0x83,0x9d,0x2a,0x96,0x90,0x19,0x33,0x8a,0xf7,0x28,0x09,
+0xa8,0x23,0x1a,0xb2,0x0a,0x9a,0xba,0x27,0x9b,0x3a,0x95,0x1d,0xa0,0x11,0x20,0x4c,
+0xb4,0x2b,0x11,0xaa,0xc9,0x00,0x2e,0x97,0x30,0xb9,0x90,0x21,0x82,0xb2,0x4b,0x20,
+0xc5,0x1a,0xca,0x51,0x80,0x02,0xa0,0x50,0x0a,0x10,0x85,0x30,0x00,0xbd,0x9a,0x93,
+0x9c,0x0a,0x64,0x39,0xf3,0x2a,0x0a,0x84,0x00,0x18,0x0a,0xc0,0x31,0xc2,0x3c,0xc3,
+0x29,0x08,0xf9,0x1a,0x90,0x50,0x00,0xba,0x97,0x09,0x2c,0xa1,0xa2,0x53,0xba,0x8e,
+0x02,0xa2,0x40,0x9b,0xca,0x42,0x92,0x19,0x2b,0xf1,0x29,0x1a,0x54,0xa4,0x1a,0xa0,
+0xbb,0x81,0x72,0x32,0xdb,0x88,0x28,0x98,0x00,0x98,0x0c,0x93,0x23,0x09,0x2e,0x97,
+0x1c,0xd9,0x22,0x09,0x08,0xa3,0x19,0x9c,0xa8,0xaa,0x72,0x01,0x89,0x27,0x09,0x10,
+0x0b,0x95,0x8b,0x06,0x1a,0xba,0x07,0x0a,0x20,0xd8,0x20,0x89,0x92,0x19,0xb8,0x0e,
+0xd4,0x20,0x1a,0x98,0xa0,0x03,0x4c,0xbb,0x82,0x01,0xbf,0x07,0x0b,0x31,0xb8,0x83,
+0x4b,0x11,0xc0,0xab,0x82,0x1d,0x85,0x20,0xac,0xa3,0x8b,0x33,0x41,0x89,0x39,0xf8,
+0x53,0x8f,0x01,0x80,0x31,0x99,0xa1,0x38,0x09,0xac,0x9a,0x93,0x94,0x9f,0x62,0xa1,
+0x01,0x31,0x88,0x89,0x82,0x26,0xbf,0x01,0x1a,0x02,0xba,0x41,0xf9,0x40,0x98,0x82,
+0x8a,0x91,0x7c,0xa9,0x82,0x12,0x0e,0x12,0xc2,0x58,0x80,0x08,0x90,0x0b,0x09,0x91,
+0xf8,0x1a,0x00,0x19,0x27,0x0b,0x00,0xb1,0x99,0xae,0x43,0x9a,0x01,0x92,0x42,0x9a,
+0x89,0xa3,0x89,0x4a,0x3b,0x97,0xab,0x74,0xba,0x22,0x11,0x1c,0x05,0x88,0xb8,0x1c,
+0xd0,0x01,0x28,0xb9,0xa4,0x4d,0xb0,0x04,0x0a,0x00,0xb8,0x84,0x61,0x0b,0x03,0xcb,
+0x12,0x03,0x79,0xf1,0x28,0xa8,0x83,0xa9,0x30,0x89,0x91,0x15,0x2d,0x20,0xb4,0x99,
+0x3b,0x28,0xc0,0xf0,0x2a,0x04,0xaa,0x2a,0xc3,0x00,0x70,0xb2,0x19,0xaa,0x82,0x12,
+0x4b,0x82,0xd4,0x0b,0x4a,0x83,0xb0,0x91,0x6f,0xe9,0x82,0x4a,0x91,0x89,0x10,0x82,
+0x0c,0x23,0x00,0xbf,0x32,0xbc,0x83,0x30,0x9f,0x00,0x01,0xc0,0x6c,0xa1,0x80,0x89,
+0x08,0x98,0xa0,0x5a,0x42,0xa2,0x09,0x22,0xb8,0x3b,0x85,0x09,0xf9,0x60,0x92,0x99,
+0x00,0xd8,0x38,0x02,0xbb,0x92,0x8f,0x21,0x9b,0x85,0x89,0x82,0x4d,0x11,0xb2,0x5b,
+0x90,0x0a,0xc0,0x3a,0x13,0xb3,0x78,0x8b,0xac,0x06,0xab,0x28,0x11,0xaa,0xab,0x54,
+0xa0,0x38,0x17,0x09,0x15,0xac,0x11,0x0a,0x00,0x81,0xc0,0x30,0xaa,0x9b,0x17,0x3b,
+0xb0,0x58,0x02,0xaf,0x02,0x14,0x9a,0x10,0x10,0xad,0x93,0x98,0x8f,0x31,0x95,0x98,
+0x9a,0x58,0xa8,0x50,0xc1,0x89,0x31,0x1b,0xc5,0x28,0x20,0x0a,0x18,0x85,0xca,0x59,
+0xa0,0x82,0x8a,0xc0,0x1d,0x12,0x1a,0x84,0x9e,0x20,0x90,0xa0,0x20,0x68,0xd2,0x29,
+0x80,0x28,0x98,0xd9,0x58,0x89,0xb0,0x51,0xc8,0x01,0x10,0x4a,0xb0,0xd2,0x48,0x1c,
+0xb3,0x19,0x93,0xda,0x1d,0xb3,0x39,0x05,0xa9,0x3a,0xd0,0x92,0x2b,0x50,0x8a,0x85,
+0x9a,0x09,0x71,0xb2,0x21,0xd0,0x89,0x78,0x98,0xa2,0x0c,0x28,0x91,0x02,0x9c,0x22,
+0xd0,0x38,0x98,0xb1,0x18,0x2e,0xf8,0x04,0x18,0x2d,0xb1,0x15,0x18,0x98,0x11,0x18,
+0xb3,0xea,0x29,0x28,0xc4,0x0b,0xb2,0x2f,0x82,0x99,0x18,0x3a,0xb1,0x97,0x39,0x08,
+0xb0,0xfb,0x91,0x68,0x80,0xa9,0x33,0x89,0x10,0x11,0xba,0x4a,0xf1,0x3a,0x03,0x48,
+0x0a,0xb2,0x77,0x18,0x91,0x19,0xc1,0x8a,0x8c,0x06,0x1a,0xa9,0x10,0xe1,0x08,0x00,
+0x18,0x09,0x96,0x19,0xc0,0x31,0x8f,0x90,0x83,0x31,0x9c,0x98,0x32,0x98,0x04,0x70,
+0x9b,0x95,0x1a,0x02,0x41,0xa0,0x31,0x2a,0xe9,0xc2,0x4a,0x8b,0x01,0xfb,0x30,0xca,
+0x10,0x28,0x19,0x95,0x80,0x19,0xd8,0x18,0xa9,0x48,0x13,0xb9,0x72,0x00,0x8a,0x11,
+0xa4,0x3c,0x82,0x9c,0xb7,0x3a,0x88,0x12,0xba,0xb2,0x88,0x1f,0xc4,0x80,0x0a,0x10,
+0x39,0xa0,0x13,0x0f,0x0a,0x87,0x18,0x80,0x30,0xb6,0x1b,0xb8,0x60,0xb8,0xa8,0x48,
+0x8d,0x04,0xc0,0x28,0x1e,0xc1,0x10,0x11,0x88,0x48,0xc1,0x90,0x10,0x0e,0x92,0x88,
+0x82,0x18,0x1d,0x92,0x14,0xaa,0x48,0xc9,0x5b,0xf2,0x11,0x29,0x80,0xa1,0x09,0x08,
+0xa1,0x51,0x2b,0xc4,0x01,0x1f,0xc2,0x38,0x0a,0x83,0x0a,0x38,0xeb,0x01,0xa9,0x33,
+0x8d,0xab,0xb0,0x73,0x09,0x11,0x8d,0x99,0x15,0x19,0xa8,0x20,0x6b,0xc3,0x49,0x88,
+0x02,0xae,0x2a,0x82,0x33,0x3b,0x97,0xab,0x4a,0x84,0x0c,0x11,0x09,0x10,0x3c,0xc6,
+0x31,0xa9,0x10,0x9b,0xc2,0x58,0xa1,0x58,0x90,0x80,0x38,0xd2,0xcb,0x30,0xb8,0x09,
+0x40,0x86,0x28,0xbb,0xca,0x33,0x4b,0x83,0xba,0x85,0x59,0x11,0xf9,0x28,0x80,0x9a,
+0x00,0xb0,0x1e,0x93,0x1b,0x50,0x9b,0x17,0x00,0x9a,0x01,0x38,0x22,0xec,0x88,0x23,
+0x09,0x21,0xf9,0x19,0x84,0x39,0xae,0x43,0x80,0xb1,0x3c,0x1a,0xf2,0x10,0xa0,0x12,
+0x1c,0x13,0xa0,0xfd,0x11,0x1c,0x81,0x12,0x10,0xaa,0x03,0x0e,0xb9,0x05,0x68,0xa0,
+0x08,0xa1,0x09,0xaa,0x17,0x1c,0x0a,0xc2,0x00,0x68,0xa8,0x10,0xb0,0x4a,0x08,0x85,
+0x10,0xb9,0x10,0xe8,0x22,0x8c,0x38,0xb4,0x31,0x39,0xa8,0x13,0xcc,0x0b,0x87,0x89,
+0x0a,0x21,0xb4,0x41,0xb9,0x5a,0xd8,0x80,0x8a,0x40,0xa0,0xb8,0xaf,0x02,0x18,0x71,
+0xb0,0x2c,0x94,0x18,0x0a,0x11,0xa2,0x20,0x50,0xac,0x33,0x86,0x5b,0xa8,0x80,0x88,
+0x3a,0xc4,0x4a,0xa1,0x10,0xbc,0x24,0x2a,0xc0,0xe9,0x60,0x98,0x00,0x08,0xa8,0x22,
+0x0f,0x80,0xa3,0x1b,0x10,0x02,0xa0,0x85,0xab,0x8c,0x9c,0x30,0x94,0x78,0xb2,0x3a,
+0xb8,0xc1,0x21,0x48,0x8f,0x84,0x88,0x90,0x28,0x01,0xd2,0x32,0x0c,0x08,0x01,0xcb,
+0x80,0xca,0x34,0x98,0x97,0x1a,0x21,0x49,0xda,0x95,0x59,0x99,0xb0,0x11,0x0a,0x91,
+0x98,0x21,0xf1,0x3b,0x12,0xa5,0xbb,0x78,0x10,0xa1,0x31,0x99,0x78,0xd9,0x10,0xa8,
+0x88,0x29,0x18,0xb4,0xba,0x5a,0x28,0xc8,0xa3,0x48,0xaa,0x32,0x8d,0x17,0xb1,0x1d,
+0x13,0xba,0x09,0x33,0x9c,0xc8,0x18,0xad,0x12,0x39,0xb8,0x33,0x95,0x89,0x7b,0xd1,
+0x01,0x80,0xea,0x20,0x80,0x03,0x1d,0xa3,0x8b,0xe3,0x58,0x09,0x82,0x0a,0x95,0x48,
+0x1b,0xd0,0x99,0x93,0x60,0x11,0xb0,0x1a,0x03,0x5b,0xd0,0x03,0x9c,0xa1,0x89,0x40,
+0xb0,0x16,0x88,0x9b,0x12,0x27,0xac,0x12,0x80,0x11,0x7a,0xb1,0x00,0x3a,0xb0,0xa1,
+0x7a,0xb9,0x35,0xab,0xa3,0xb9,0x3c,0xa0,0xfa,0x31,0x90,0xc0,0x0b,0xbb,0x30,0x30,
+0xc4,0x69,0xd8,0x3a,0xa3,0x03,0x8e,0x21,0x88,0xe2,0x29,0x00,0x20,0x05,0x11,0xbc,
+0x93,0x2d,0x88,0xb1,0x84,0x7b,0x90,0x90,0x89,0x21,0x90,0x1f,0xc0,0xa3,0x4a,0x48,
+0xd0,0xa8,0x28,0x88,0x22,0x0c,0xc8,0x92,0x78,0xa9,0x11,0xb1,0x34,0x1e,0x81,0x81,
+0xb1,0x2d,0x40,0xab,0x94,0xa9,0x5d,0x80,0x13,0xca,0x21,0x98,0x42,0xc1,0x91,0x49,
+0x80,0xa2,0x08,0x9c,0x44,0xb3,0x6a,0xa0,0xa0,0x5b,0x12,0x02,0x9b,0xc1,0x0c,0x2a,
+0xb3,0x8f,0x01,0x89,0x40,0xa8,0x92,0xbb,0x5e,0xd0,0x82,0x09,0x28,0xf2,0x28,0x91,
+0x80,0x2b,0x90,0xb3,0x07,0x0f,0x92,0x8a,0x85,0x89,0x10,0x1c,0xc1,0xa2,0x30,0x59,
+0x90,0x13,0xc9,0x50,0x08,0xd9,0x88,0x10,0x8c,0x00,0x98,0x1c,0xd2,0x70,0x89,0x11,
+0x98,0x10,0x19,0x02,0x1b,0xfb,0x9c,0x20,0x31,0x10,0x94,0x00,0x8f,0x81,0xa9,0x98,
+0x48,0x9f,0x11,0x11,0x3a,0x98,0xb5,0x58,0x98,0x93,0x28,0x09,0x85,0x21,0x20,0xf1,
+0x1a,0x1c,0x00,0x93,0x90,0xcc,0x11,0x08,0x8b,0x27,0x09,0x40,0x98,0xf2,0x22,0x39,
+0x8f,0xc4,0x0a,0x20,0x01,0x89,0x88,0x92,0x51,0xa8,0x10,0xb8,0x95,0x18,0x3a,0xb0,
+0x24,0x17,0x19,0xcc,0x89,0x2a,0xc3,0x48,0x08,0xd9,0x34,0x80,0x89,0x12,0xbc,0x84,
+0x1a,0xa1,0xa8,0x06,0x5b,0xa9,0xb9,0x73,0x11,0x88,0x1b,0xa2,0x14,0x1a,0x38,0x8f,
+0x83,0xa9,0x3c,0xdb,0x91,0x25,0x1d,0xc8,0x11,0xa2,0x8e,0x23,0x99,0xa2,0x89,0x8a,
+0x89,0x1b,0x07,0x81,0x8c,0x49,0x91,0x11,0x09,0x73,0x99,0xac,0xf9,0x28,0x94,0x49,
+0x88,0x11,0x80,0x99,0x84,0x3d,0xa1,0xa0,0x52,0xac,0x80,0x39,0xf8,0x20,0x1a,0x12,
+0x87,0x1c,0xa8,0x02,0x0f,0x82,0x99,0x42,0x9a,0x82,0x40,0x99,0x98,0x42,0xa5,0x3b,
+0x8a,0xc1,0x26,0x88,0x0d,0x91,0x01,0x81,0x12,0x0f,0xe1,0x00,0x09,0x80,0x18,0xd8,
+0x21,0xca,0x32,0x1b,0x94,0x81,0x1b,0xd0,0x85,0x18,0x19,0x00,0xa0,0x72,0xd8,0x19,
+0x39,0x94,0x0a,0x29,0x15,0x0b,0xc4,0x38,0xac,0xd3,0x18,0x98,0x19,0x13,0x90,0xdb,
+0x69,0xb0,0x1b,0x23,0x85,0xd9,0x59,0xb8,0x11,0x81,0x31,0x09,0x18,0x5b,0xb9,0xd4,
+0xa9,0x5d,0x91,0x29,0xe2,0x19,0x88,0x00,0x8c,0x20,0x91,0x98,0x31,0x72,0x09,0xb4,
+0x01,0x2b,0x93,0x4b,0xc2,0x43,0x09,0x3c,0x06,0xac,0x01,0xc9,0x10,0x9a,0x21,0xec,
+0x91,0x50,0x88,0x91,0x91,0x19,0x10,0xa0,0x37,0x9c,0x1c,0x94,0x49,0xd1,0x28,0x0b,
+0x20,0x97,0x21,0x8a,0x28,0x93,0x99,0x10,0x2a,0xc1,0x00,0x3c,0xb0,0xc9,0xa6,0x8b,
+0x0b,0xbb,0x27,0xf9,0x30,0x1a,0x80,0xa4,0x29,0x61,0x99,0xb0,0x90,0x39,0x24,0x12,
+0x9c,0xb9,0x47,0x08,0xb8,0xaa,0xb2,0x4d,0xd2,0x28,0x88,0x80,0x01,0x30,0xb0,0x0f,
+0x93,0x0f,0x93,0x61,0x90,0x20,0x9a,0x01,0x9d,0x30,0xb3,0x89,0xae,0x15,0x89,0x8a,
+0xc1,0x40,0x91,0x00,0x1d,0x12,0x07,0x8a,0x01,0xab,0x95,0x1a,0xab,0x02,0x21,0x38,
+0xd7,0x4b,0xb9,0xa2,0x48,0xe9,0x08,0x29,0xa8,0x03,0x12,0x8f,0x18,0x82,0xb8,0x20,
+0x0c,0x17,0x18,0xa0,0x10,0x42,0xc9,0x08,0x2a,0xd8,0x89,0x58,0x98,0x93,0x58,0xad,
+0x80,0x04,0x80,0x2d,0x90,0x23,0xb9,0x31,0x89,0x94,0x69,0xc8,0x40,0x81,0x30,0xbb,
+0xd4,0x09,0x8c,0x21,0x21,0xc1,0x01,0x5d,0x82,0x18,0xab,0xa7,0x4a,0x98,0x88,0x98,
+0x02,0x94,0x4d,0xa8,0x00,0x49,0xa2,0x3a,0xc1,0x0a,0x91,0x8a,0x9e,0x05,0x09,0x09,
+0x8d,0x85,0x41,0x99,0x40,0xc8,0x81,0x29,0x8b,0xa4,0x59,0x20,0xd8,0x2b,0x32,0xd1,
+0x19,0xbc,0xb2,0x28,0x1f,0xb1,0x33,0x0b,0x81,0xba,0x52,0x92,0x72,0xd0,0x42,0x8d,
+0x00,0xb8,0x38,0x19,0xc1,0x92,0x5a,0xac,0x85,0x00,0x29,0x08,0xa3,0x09,0x34,0x8f,
+0xa9,0x03,0x2a,0x8d,0x83,0x91,0x9f,0x01,0x38,0xc3,0x90,0x0f,0x99,0x84,0x00,0x29,
+0x12,0xb3,0x0e,0x11,0x1a,0xa5,0x0c,0x12,0x1c,0xa3,0x24,0x39,0xd9,0x33,0x9f,0x82,
+0x12,0x0d,0xa0,0x91,0x5a,0xb1,0x41,0xcb,0x00,0x08,0xc2,0x1b,0x28,0x88,0x87,0x3a,
+0x81,0x91,0x3a,0x02,0xaf,0xc2,0x28,0x6a,0x81,0x88,0x91,0xa2,0x41,0x1f,0x91,0x13,
+0x01,0x9f,0x92,0x2a,0x9a,0x16,0x19,0xb8,0x08,0x90,0x44,0x9c,0xa9,0x21,0x62,0x89,
+0x81,0x18,0x09,0x83,0x71,0xa2,0x9d,0x91,0x1a,0x0b,0xae,0xa4,0x58,0xaa,0xb0,0x98,
+0x86,0x39,0x28,0x02,0x86,0x99,0x13,0x8d,0x92,0x52,0xa9,0x13,0x9c,0x25,0xa9,0x24,
+0x9b,0xcb,0x28,0xc2,0x50,0x82,0x0c,0x96,0x00,0x29,0xc9,0x07,0x39,0xba,0x20,0xc0,
+0x09,0x02,0x24,0x9f,0x00,0x11,0xa8,0x11,0x4a,0x90,0xf2,0x89,0x2a,0x91,0xd0,0x8a,
+0x81,0x3a,0x92,0xc9,0x20,0x91,0x71,0xf2,0x01,0x0a,0x21,0xfb,0x11,0x01,0x99,0x41,
+0xb9,0x03,0x18,0x82,0xaf,0x12,0x18,0xd3,0x1b,0x10,0xcb,0xc0,0x2b,0xd8,0x64,0x00,
+0x90,0xb8,0x99,0x70,0xa8,0x11,0x08,0x80,0x1a,0x98,0x54,0x9e,0x24,0x00,0x29,0xc1,
+0x09,0x22,0x8b,0xfb,0x80,0x53,0x08,0x09,0xc8,0x11,0x92,0x0e,0x8a,0xb1,0x32,0xbe,
+0x35,0x99,0x81,0x83,0x8f,0x08,0x82,0x18,0x34,0xa9,0x02,0xba,0x0b,0x42,0x0a,0x07,
+0x11,0xab,0x0f,0xc3,0x1a,0x10,0x01,0x32,0xa9,0xab,0xb5,0x79,0x80,0x81,0xaa,0xb0,
+0x27,0x1d,0x84,0x9a,0x81,0x19,0x0e,0x03,0x0a,0x84,0x90,0x9a,0x02,0x7a,0xc9,0x90,
+0x15,0x1b,0x0a,0xb8,0x83,0x78,0x10,0xe0,0x32,0x18,0xa1,0xa1,0x0c,0x90,0x51,0xd1,
+0x98,0x70,0x28,0xa2,0x99,0x18,0x99,0xa3,0x3a,0x31,0xe6,0x81,0x1f,0x91,0x00,0x89,
+0x84,0x09,0x08,0x08,0xa2,0xc8,0x49,0xc0,0x2a,0x1c,0x87,0x2a,0xb0,0x11,0x5b,0xb2,
+0x02,0x4a,0x9a,0x8e,0x96,0x80,0x4a,0xa9,0xa1,0xc1,0x2e,0x11,0x82,0xb0,0x0a,0x3a,
+0xfa,0xb0,0x58,0xb0,0x21,0x18,0x03,0x90,0xb9,0x9a,0x23,0x05,0xfb,0xad,0x32,0x99,
+0x82,0x7a,0xa9,0x15,0x80,0x1b,0xa9,0xf0,0x31,0x19,0xc0,0x1d,0x90,0x82,0x81,0x48,
+0x50,0xb2,0x05,0x48,0xa8,0x1a,0xa1,0x8d,0x05,0xb1,0x2a,0x8c,0xa4,0x98,0x41,0x21,
+0xb2,0xbb,0x13,0x2a,0x4a,0x87,0x00,0x9b,0x38,0xb6,0x19,0xbc,0x02,0x80,0x09,0x1c,
+0xf2,0x80,0x4b,0x08,0x92,0x88,0xad,0x42,0xbc,0x94,0x28,0x19,0xa2,0x9a,0x72,0x86,
+0x10,0xba,0x53,0x88,0x18,0xb8,0x14,0x8b,0xab,0x16,0xd2,0x39,0x2b,0x97,0xa8,0x40,
+0x8c,0x91,0x88,0x40,0x92,0x9a,0xfb,0x38,0x80,0xc8,0x31,0x08,0x2b,0xf9,0x38,0x99,
+0xa1,0x4c,0xa8,0xa8,0x89,0xa9,0x70,0xdb,0x89,0x34,0x90,0x10,0xc8,0x08,0x22,0xd0,
+0x71,0x90,0x92,0x11,0xbc,0x2b,0x81,0x3b,0xe1,0x1b,0x40,0xd1,0x28,0xdb,0x44,0x8a,
+0x91,0xa3,0x49,0xa9,0x90,0x52,0x82,0x08,0x00,0x90,0x72,0x24,0x01,0xa0,0xab,0x74,
+0xa9,0xc8,0x38,0x03,0x10,0x8b,0xf1,0xa9,0x10,0x3d,0x92,0xa8,0x20,0x90,0x23,0x2f,
+0xa7,0x00,0x49,0x01,0x82,0x1a,0x88,0x23,0xa0,0xaf,0x88,0xa1,0xa1,0x9f,0x31,0x22,
+0xcb,0x15,0x81,0x1a,0x9f,0x10,0xb1,0x40,0x80,0x2e,0xd2,0x31,0x3c,0xc3,0x80,0x1b,
+0x29,0xba,0xa4,0x41,0xc8,0x2f,0xb4,0x89,0x82,0x11,0x19,0xd9,0x13,0x08,0x8b,0x14,
+0x89,0x22,0x2b,0xf3,0x09,0x29,0x1f,0x86,0x88,0x0a,0xa0,0x30,0x09,0x88,0x87,0x2a,
+0x8a,0x05,0x9a,0x9a,0x96,0x00,0x4b,0xc1,0x04,0x2b,0xa2,0x24,0x8d,0x81,0x8a,0x05,
+0x89,0x99,0x1b,0x09,0xf0,0x30,0x41,0x10,0xa8,0xfa,0x31,0xa0,0x2a,0xc8,0xc8,0x50,
+0xc1,0x89,0x09,0xeb,0x18,0x30,0x01,0xa3,0x1b,0x8a,0xba,0xa9,0x94,0x7a,0xba,0x37,
+0x92,0x8f,0x82,0x4b,0x90,0x95,0x2c,0x90,0x8a,0x01,0x38,0xb8,0xc3,0x29,0x70,0xb9,
+0x11,0x99,0x84,0x8f,0xb1,0x22,0x01,0x1a,0xa3,0x92,0x2e,0x0c,0x97,0x80,0x3b,0x25,
+0xa9,0x82,0x23,0x19,0x14,0x38,0xc9,0x95,0x8b,0x1d,0xc1,0x28,0x09,0x87,0x20,0x9a,
+0x89,0x9b,0xa4,0x70,0xb9,0x20,0x8a,0x81,0x34,0xbb,0x34,0x9b,0xd5,0x2a,0x03,0x98,
+0x90,0x29,0x1b,0xf2,0x63,0x99,0x9b,0xa1,0x21,0x93,0x0f,0x25,0x98,0x19,0x81,0x5b,
+0xa1,0x06,0x0c,0xb1,0x88,0x98,0x61,0x82,0x9a,0x00,0x99,0xb1,0x32,0x9e,0xfc,0x00,
+0x18,0x89,0x98,0x53,0x85,0x1c,0xa0,0x14,0xcb,0x18,0x31,0xe8,0x32,0xbb,0x20,0x89,
+0x87,0x9c,0x03,0x2a,0xe0,0x0a,0x94,0x38,0xd9,0x28,0xa1,0x22,0x08,0x14,0x19,0xe9,
+0xba,0x33,0x24,0x39,0xa8,0xf3,0x30,0xab,0x99,0x7a,0xa3,0x88,0x1a,0x49,0x92,0x95,
+0x0f,0x90,0x82,0x21,0x0c,0x11,0x01,0xf0,0x1b,0x08,0x93,0x0c,0x07,0x18,0x0a,0xb0,
+0x99,0x22,0x2a,0x09,0xf8,0x50,0xaa,0x88,0xa9,0x88,0x0e,0x94,0x39,0x13,0xcb,0x2a,
+0x23,0xf0,0x39,0x0d,0x05,0x18,0xb9,0x08,0x20,0xa9,0x03,0x20,0x28,0xb7,0x19,0x9d,
+0xca,0x45,0x98,0x99,0x00,0x61,0xb9,0x25,0x19,0x99,0x34,0xfa,0x08,0x90,0x80,0x89,
+0x8b,0xa5,0x10,0x2a,0x80,0x93,0x3c,0x31,0xb6,0x98,0x7c,0x82,0x90,0x94,0x0b,0x32,
+0xaa,0x89,0xb6,0x00,0x8f,0x88,0x31,0x84,0xfb,0x18,0x39,0xb1,0x09,0xa4,0x39,0x82,
+0xdc,0x41,0x03,0x20,0x99,0xaa,0x32,0x8a,0x91,0x3a,0xbf,0xc6,0x18,0xa0,0x71,0xa8,
+0x98,0x80,0x1e,0x90,0x03,0xac,0x28,0xa1,0x0e,0x94,0x00,0x11,0x4b,0x94,0xa9,0x51,
+0xa0,0x1b,0xaa,0x36,0x0a,0x24,0x88,0xc8,0x2b,0x83,0x85,0x69,0x91,0x09,0x89,0x90,
+0x11,0x0b,0x0b,0xf2,0x28,0x8d,0xb8,0x13,0x78,0xd2,0x08,0xbb,0x28,0x27,0x99,0x8a,
+0x80,0x90,0xbe,0x58,0xb0,0x62,0xa0,0x90,0x00,0x08,0x9c,0x03,0x5a,0xa2,0x0a,0x59,
+0x80,0x90,0x3a,0xf1,0x48,0x9b,0xc0,0x40,0xba,0x11,0xa9,0x22,0x6c,0x85,0x08,0x99,
+0x02,0x31,0x48,0xbb,0x82,0x44,0xb2,0x1f,0x18,0xb5,0x18,0x1a,0x18,0xd0,0x31,0x0a,
+0x38,0xb2,0x12,0xaa,0xaf,0x34,0xf2,0x20,0x20,0xa8,0x02,0xd9,0x30,0x0c,0xd1,0x33,
+0x8d,0x03,0x9a,0x9a,0xc8,0xa2,0x72,0x4b,0xc0,0x91,0x20,0x30,0x9b,0xa0,0x12,0x12,
+0x1b,0x62,0x96,0x60,0x9a,0xa3,0x11,0xad,0x10,0x99,0x81,0xb9,0x16,0x49,0xa8,0x01,
+0xa8,0xfa,0x3d,0x29,0xb2,0x3b,0xf3,0x38,0x30,0x99,0xe0,0x01,0x1b,0xa9,0x04,0x10,
+0xae,0x22,0x92,0x0a,0xd9,0x73,0xe8,0x00,0x80,0x08,0x89,0x22,0x88,0x04,0xc0,0x2c,
+0xbb,0x04,0xb1,0x2a,0x29,0xc1,0xc3,0x7c,0x84,0x90,0x08,0x23,0x99,0xb9,0x9d,0x33,
+0xd8,0x3a,0x04,0xa8,0x17,0x1d,0x88,0x92,0x30,0xab,0x8b,0x15,0xd8,0x00,0x18,0x20,
+0xc1,0x38,0x9d,0xb0,0x04,0x58,0x98,0x80,0xc0,0x20,0x11,0x4d,0xd3,0x89,0x89,0x01,
+0x8b,0x99,0xb2,0x9e,0x20,0x04,0xca,0x71,0x02,0xba,0x24,0x2e,0x93,0x8a,0xb8,0x2e,
+0x12,0xb2,0x29,0x0b,0xc2,0x95,0x2b,0x09,0x92,0x85,0x1b,0x61,0xaa,0xa2,0x38,0xcd,
+0x20,0x98,0x01,0x25,0xd8,0x38,0xbc,0x94,0x1c,0x10,0x95,0x02,0x3b,0x1d,0x06,0x90,
+0x08,0x39,0x9a,0xd0,0x93,0x4d,0xa8,0x94,0x28,0x10,0x09,0xf3,0x2b,0x90,0x08,0x00,
+0x81,0x09,0x19,0x23,0xf1,0x9c,0x51,0x98,0x07,0x0c,0x80,0x92,0x18,0x9b,0x88,0x42,
+0xe3,0x50,0x1b,0xa3,0x88,0x11,0xbd,0x22,0x83,0x08,0xaf,0xb3,0x99,0x10,0x68,0xb1,
+0xa9,0x23,0x18,0xb0,0x7a,0xa1,0xd0,0x4a,0xc9,0x92,0x48,0x91,0x18,0x85,0x28,0x21,
+0xc9,0xc0,0x1b,0xf0,0x49,0xb8,0x2a,0x01,0x22,0x98,0x3a,0x3a,0xf3,0x8d,0x29,0x01,
+0x8c,0xc3,0x28,0x90,0x7b,0xf2,0x89,0x28,0x12,0x99,0xc9,0x50,0x12,0x20,0x89,0x23,
+0xdb,0x1a,0xe8,0x1a,0x15,0x2b,0x85,0x12,0x89,0x12,0xad,0x94,0x09,0x1a,0x31,0xf1,
+0x89,0x40,0x9a,0x98,0x33,0xa0,0xaa,0x7b,0x84,0xf8,0x39,0x29,0x18,0xc5,0x3b,0xa9,
+0xa1,0x02,0x8d,0x09,0x01,0x27,0x8b,0xa2,0x78,0xa8,0x20,0xd3,0x39,0x0a,0xaa,0x95,
+0x30,0x99,0x28,0xa1,0xca,0x81,0x63,0x08,0x1b,0x17,0x90,0x1d,0xb1,0x22,0x8d,0x04,
+0x88,0x30,0x00,0xb8,0xda,0x19,0x30,0x97,0x8f,0x81,0x0a,0x24,0x88,0x18,0x91,0xab,
+0x01,0x91,0x9f,0x94,0x51,0xc0,0x81,0x5b,0xa9,0x04,0xa8,0x29,0xd9,0x31,0xba,0x00,
+0x48,0x99,0xa9,0x43,0x3f,0xb4,0x29,0x2a,0xb2,0x04
+};
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a gameOver48k.wav
+extern const uint8_t gameOver48k_wav_adpcm[];
+#define GAMEOVER48K_WAV_ADPCM_SAMPLE_RATE 480000
+#define GAMEOVER48K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define GAMEOVER48K_WAV_ADPCM_NUMBER_OF_SAMPLES 156595
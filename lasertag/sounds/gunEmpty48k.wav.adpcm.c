@@ -0,0 +1,489 @@
+// This file was generated by executing this statement: wav2c -a gunEmpty48k.wav
+
+#include <stdint.h>
+
+const uint8_t gunEmpty48k_wav_adpcm[7728] = {
+0x10,0x4b,0x3b,0x9b,0xb2,0xb3,0xb3,0x01,0x11,0xb0,0x92,0x93,0x9b,0x11,0xb3,0xc1,
+0xb4,0xc5,0xa2,0x82,0x80,0x90,0x90,0x21,0x1b,0x19,0xd3,0x01,0x18,0xb0,0xb4,0xb2,
+0xb3,0xb3,0x21,0x93,0x0a,0x49,0x09,0xbb,0xa1,0xb4,0xb1,0x31,0x92,0x3b,0x57,0xb0,
+0x20,0x47,0xb0,0x0a,0x33,0xc9,0xbc,0xc8,0xfb,0x09,0x10,0xba,0x3a,0x17,0xa9,0x41,
+0x03,0x1a,0x64,0xa0,0x0a,0x12,0x0a,0x61,0xa8,0x8c,0x11,0xba,0x9c,0x9b,0x41,0xb1,
+0x8c,0x33,0x10,0x55,0x02,0x63,0x04,0x98,0x53,0xf9,0xff,0xcf,0xbb,0x09,0x73,0x45,
+0x12,0xa0,0xaa,0x99,0xaa,0x09,0x22,0x90,0x9a,0x99,0x71,0x27,0x82,0xa8,0x98,0x98,
+0x88,0x42,0x13,0xb9,0x9b,0xcb,0x8b,0xfa,0xcd,0x89,0x32,0x25,0x22,0x10,0x88,0x09,
+0x13,0xfc,0x9c,0x00,0x00,0x00,0x98,0x29,0x22,0x21,0x45,0x03,0x88,0xd9,0xbd,0x9a,
+0xa9,0x89,0x10,0x11,0x44,0x14,0x81,0xba,0x0a,0x24,0xb8,0xba,0xeb,0x0b,0x34,0x91,
+0x50,0x83,0xcb,0x29,0x24,0x01,0x98,0x9a,0x88,0x28,0x46,0x01,0x31,0x02,0x99,0x80,
+0xbb,0x9a,0xff,0xae,0x8a,0x11,0x33,0x11,0x62,0x35,0x81,0x98,0xaa,0xbb,0x09,0x91,
+0xdc,0x0a,0x13,0xa9,0x40,0x93,0xab,0xa0,0xbe,0x19,0x81,0x19,0x13,0x08,0x14,0xde,
+0x19,0xc1,0xff,0x9a,0x40,0x25,0xb0,0x39,0x37,0xb8,0x1b,0x34,0xb9,0x28,0xd1,0xae,
+0x62,0x91,0x9b,0x31,0x81,0xaa,0x99,0x98,0xa8,0x9b,0x31,0xd9,0x2a,0x16,0x98,0xaa,
+0x8a,0x56,0x12,0x10,0x22,0x99,0x51,0xa2,0xad,0x21,0xb0,0x9c,0xb8,0xbf,0x61,0x83,
+0xaa,0x73,0x92,0x9a,0x11,0x80,0x30,0x92,0xbb,0x99,0x30,0x25,0xfa,0x8b,0x11,0x08,
+0x81,0xdb,0x09,0x98,0x20,0xfa,0x78,0x77,0xa1,0x9c,0x00,0x98,0xcb,0x29,0x56,0x12,
+0xa9,0xaa,0x89,0x21,0xa8,0xbc,0x99,0x52,0x25,0xb0,0xac,0x10,0x90,0xaa,0x28,0x46,
+0x22,0x88,0x10,0xc1,0xcf,0x28,0x03,0xab,0x63,0x91,0x0a,0x12,0xcb,0x18,0x91,0x38,
+0x17,0x98,0x21,0xd8,0x8b,0x22,0xca,0x1a,0x16,0x90,0x28,0x13,0xea,0x89,0x90,0x9c,
+0x00,0xaa,0x70,0x02,0x8a,0x02,0xdc,0x29,0x91,0xac,0x11,0x88,0x73,0xa1,0x9f,0x30,
+0x13,0x80,0x88,0x98,0x88,0x12,0xd8,0x0b,0x46,0x81,0x08,0x11,0x88,0x09,0x64,0x13,
+0xcd,0x19,0xa0,0x9d,0x43,0x82,0x09,0x91,0xbc,0x09,0xa8,0x0b,0x33,0xb8,0x19,0x55,
+0x03,0xfb,0x9b,0x31,0x02,0xb9,0x99,0xa9,0x8b,0x64,0x13,0x01,0xa1,0xde,0x8b,0x21,
+0x24,0x22,0x98,0x89,0x21,0x80,0x10,0x11,0x72,0x13,0xb9,0x20,0xf8,0x1a,0x04,0xcb,
+0x41,0xc0,0x0c,0x46,0x90,0xab,0x9a,0x38,0x33,0x00,0x52,0xb1,0xac,0x98,0xcb,0x09,
+0x81,0xab,0x10,0xc8,0xbd,0xab,0x9c,0x40,0x35,0x22,0x22,0xb8,0xcc,0xaa,0x19,0x11,
+0x00,0x65,0x23,0x02,0xb0,0x9c,0x72,0x22,0x11,0xb8,0xbd,0x18,0xb8,0x49,0x36,0x00,
+0x40,0x23,0x88,0xba,0xad,0x08,0x90,0x99,0xb9,0xbe,0x9a,0x08,0x08,0x00,0x53,0x35,
+0xa2,0xbf,0xbb,0xdc,0x9b,0x21,0x24,0x12,0x80,0x28,0x23,0xb9,0x48,0x14,0x08,0xb1,
+0xef,0x09,0x11,0x11,0x23,0x33,0x35,0xb8,0xae,0xb9,0x9c,0x10,0x00,0x73,0x26,0x00,
+0x88,0x89,0x08,0x80,0x89,0x81,0x20,0x45,0x82,0xaa,0xbb,0xcb,0xcd,0x9a,0x62,0x03,
+0xea,0x9b,0x09,0x31,0x46,0x82,0xba,0x89,0xeb,0x9b,0x11,0x10,0x31,0x80,0xdb,0xbf,
+0x29,0x16,0x99,0x41,0xc1,0x8b,0x25,0xa9,0x61,0x82,0x18,0x03,0xce,0x38,0xa1,0x0b,
+0x15,0xbc,0x71,0xa3,0xbd,0x41,0x92,0xbb,0x40,0x03,0xbb,0x38,0x84,0xbb,0x73,0x92,
+0x9d,0x32,0xd8,0x0b,0x35,0xa8,0x19,0x83,0xcc,0x28,0x01,0x89,0x01,0xaa,0x48,0xf0,
+0x8d,0x53,0xa1,0x8b,0x34,0xb8,0x9c,0x31,0x12,0x99,0x40,0xb2,0x9f,0x42,0xc0,0x1b,
+0x05,0xda,0x28,0x13,0x9a,0x09,0x10,0x81,0x8a,0x55,0xb1,0x0c,0x11,0xcb,0x28,0x02,
+0x9a,0x41,0x24,0x90,0xab,0xeb,0x0b,0x23,0xaa,0x74,0x91,0x2a,0x93,0x8e,0x15,0xdf,
+0x3a,0x24,0x89,0x41,0xb8,0x9c,0xca,0x4a,0x47,0x90,0x9b,0x89,0x30,0xa1,0x9f,0x63,
+0x82,0xbb,0x88,0x21,0x82,0xbe,0x60,0x83,0x9a,0x02,0xfb,0x48,0x83,0xac,0x32,0xb1,
+0x1c,0x15,0xda,0x28,0x03,0x9a,0x10,0x98,0x29,0x22,0x90,0xcd,0x3a,0x16,0xdb,0x49,
+0x04,0xac,0x20,0x81,0x0b,0x23,0xa8,0x18,0xc8,0x19,0x02,0x19,0x07,0xfb,0x38,0x84,
+0xbb,0x50,0x82,0x99,0x80,0x88,0x01,0xaa,0x61,0xb1,0x0b,0x37,0xda,0x29,0x13,0xcb,
+0x28,0x13,0xaa,0xab,0x48,0x14,0xca,0x29,0x12,0x98,0x90,0xcb,0x48,0x16,0x98,0x19,
+0x80,0xbb,0x8a,0x42,0x23,0xf9,0x9c,0x21,0x90,0x18,0x02,0x20,0x25,0xda,0x39,0x27,
+0x91,0xab,0x28,0xb1,0xad,0x10,0x99,0x61,0xb2,0xae,0x20,0x90,0x30,0xc1,0x0d,0x35,
+0xa1,0x0a,0x82,0x89,0x33,0xf9,0x0a,0x33,0xfa,0xbb,0x31,0x35,0x80,0xaa,0xbb,0xac,
+0x73,0x37,0xca,0x29,0x05,0xeb,0x09,0x22,0x80,0x99,0x0a,0x62,0x03,0xba,0xab,0x38,
+0x04,0xab,0x50,0x92,0x8c,0x11,0x89,0x53,0xb1,0x0d,0x12,0xda,0x19,0x02,0xaa,0x38,
+0x02,0xca,0x60,0x26,0xa8,0xab,0x00,0x08,0x22,0x01,0xc9,0x8c,0x64,0xb1,0xae,0x38,
+0x13,0x81,0xb9,0x2a,0x14,0xfb,0x0a,0x22,0x22,0x02,0xec,0x19,0x14,0xda,0x19,0x35,
+0xa8,0x0a,0x01,0xba,0x30,0xa3,0x9e,0x20,0x80,0x18,0x80,0x09,0xb0,0x0d,0x47,0xa8,
+0x49,0x84,0xbd,0x38,0x04,0x08,0x01,0xcc,0x19,0x14,0x89,0x08,0xb9,0x18,0x23,0xb0,
+0xdb,0x0a,0x55,0x82,0x8a,0x01,0xdc,0x39,0x24,0xca,0x28,0x81,0xbb,0xbb,0x9c,0x73,
+0x83,0xab,0x41,0x81,0x09,0x12,0xca,0x09,0x24,0x34,0x24,0xc9,0x2a,0x26,0xdb,0x2a,
+0x83,0x9d,0x73,0xa2,0x9c,0x00,0xba,0x38,0x92,0x2a,0x06,0xbe,0x48,0x84,0xaa,0x10,
+0x80,0x00,0x81,0x20,0xc2,0xae,0x31,0x11,0x42,0x83,0xbb,0x09,0x21,0x14,0xfa,0x8b,
+0x00,0xb9,0xbc,0x1a,0x47,0x82,0xa9,0xba,0x39,0x83,0xae,0x73,0x82,0x8b,0x46,0xc0,
+0xac,0x20,0x81,0x08,0x00,0x28,0x25,0xb9,0x48,0xe1,0x8d,0x43,0xc0,0x19,0x93,0xad,
+0x42,0xd8,0x89,0x14,0x88,0x32,0xb1,0x2b,0xa2,0xaf,0x31,0xa1,0x28,0x82,0xad,0x11,
+0xc8,0x29,0x24,0x88,0x80,0xda,0x1a,0x36,0xc8,0x9b,0x02,0xac,0x74,0xa1,0x9c,0x23,
+0xc8,0x38,0x04,0x8a,0x11,0xdb,0x29,0x83,0x9c,0x42,0xa1,0x9b,0x53,0x92,0x09,0x13,
+0xfd,0x19,0x33,0xa8,0x8a,0x98,0x99,0xaa,0x73,0x86,0x89,0x22,0xe9,0x2a,0x13,0xbb,
+0x41,0xb0,0x1b,0x84,0x9c,0x62,0x82,0xa9,0xaa,0x40,0x13,0xa9,0x00,0xd9,0xac,0x20,
+0x26,0xa0,0x30,0xc3,0xcf,0x31,0x82,0xab,0x31,0xb1,0x9e,0x52,0x92,0xac,0x31,0x92,
+0x0a,0x03,0xcb,0x89,0x08,0x47,0xd0,0x0b,0x15,0xb9,0x38,0x92,0x9a,0x80,0xad,0x20,
+0x90,0x52,0xc8,0x4a,0x07,0xba,0x60,0x81,0x9a,0x31,0x01,0x08,0x00,0x90,0xdc,0x19,
+0x02,0x8a,0x35,0xd9,0x9b,0x88,0x29,0x83,0x1b,0x77,0xc8,0x0a,0x80,0x8b,0x44,0xb1,
+0x2a,0x05,0xdb,0x19,0x12,0x9a,0x20,0x83,0xbc,0x28,0x13,0x90,0x08,0x64,0x82,0xae,
+0x30,0xb2,0x8d,0x44,0xa8,0x38,0x04,0xdb,0x09,0x21,0x11,0xa9,0x09,0xb8,0x9d,0x31,
+0x23,0xc1,0xdf,0x19,0x82,0x28,0x35,0xc9,0x19,0x91,0x8b,0x34,0xa8,0x50,0x83,0x99,
+0x80,0xdb,0x29,0x04,0x89,0x21,0xd9,0x8c,0x32,0x02,0x98,0xcc,0x2a,0x84,0xde,0x38,
+0x04,0xcb,0x30,0x04,0xa8,0x09,0x12,0xc9,0x1a,0x25,0x80,0x09,0xb9,0x8d,0x63,0x02,
+0xa9,0x08,0x32,0xa0,0xbd,0x09,0x34,0x22,0x01,0xfb,0x9b,0x81,0xbb,0x73,0xc3,0x9e,
+0x42,0xb8,0x1b,0x03,0xbd,0x40,0x81,0x19,0x14,0x8a,0x20,0xc8,0x39,0x85,0xac,0x48,
+0x23,0x99,0x28,0x82,0xbc,0x41,0x82,0x3a,0x27,0xc9,0x09,0xf9,0x0a,0x24,0xca,0x2a,
+0x25,0xb9,0x0a,0x01,0xaa,0x28,0x91,0x29,0x17,0xba,0x50,0x82,0x0b,0x14,0xcc,0x30,
+0x82,0xab,0x90,0x49,0x17,0xdc,0x49,0x03,0x9b,0x53,0x91,0x9b,0x88,0x88,0x43,0x81,
+0x08,0x90,0xcb,0xbd,0x9b,0x31,0x02,0x8b,0x54,0xc8,0x3b,0x47,0xc9,0x1a,0x04,0xaa,
+0x30,0xc0,0x8c,0x32,0x91,0x8a,0x20,0x33,0xc8,0x8c,0x31,0x23,0xb0,0x0e,0x54,0xa1,
+0x8a,0xd9,0x1a,0x47,0xb8,0x9b,0x02,0x8a,0x52,0x91,0x0a,0x33,0xfb,0x1c,0x23,0xa8,
+0x1a,0xa0,0xae,0x38,0x11,0x30,0xa0,0x3b,0x47,0xb9,0x70,0x92,0xac,0x28,0x98,0x30,
+0x93,0xac,0x21,0xea,0x48,0x02,0x9b,0x44,0xc0,0x8b,0x12,0xa8,0x38,0x15,0xc9,0x19,
+0xb0,0x8d,0x54,0xa0,0x0a,0x82,0xbc,0x20,0x02,0x09,0x90,0x1a,0x05,0xbb,0x74,0xb3,
+0x9c,0x52,0x90,0x09,0x33,0xb9,0x8b,0x12,0xeb,0x29,0x17,0x88,0x20,0xb1,0x8d,0x80,
+0xdb,0x30,0x82,0xaa,0x91,0xbc,0x72,0x83,0xab,0x00,0x88,0x42,0xb0,0x9e,0x20,0x92,
+0xac,0x58,0x25,0xb9,0x29,0x17,0xb9,0x19,0x03,0xb9,0x2a,0x23,0x90,0x9a,0x20,0x34,
+0x33,0x11,0x22,0x80,0xfe,0x9c,0x31,0xb3,0xaf,0x18,0xd8,0x9c,0x21,0xa1,0xac,0x41,
+0x92,0xad,0x61,0x03,0x98,0x00,0x98,0x88,0x90,0x71,0x13,0xab,0x63,0xa1,0x3a,0x86,
+0xcb,0x40,0xa2,0x8b,0x90,0xac,0x52,0xb0,0x1b,0x04,0x89,0x34,0xe9,0x1a,0x13,0x9a,
+0x42,0xc0,0x9c,0x81,0xb9,0x19,0x24,0xb0,0x8c,0x24,0xd8,0x2a,0x16,0xb8,0x29,0x25,
+0x80,0x09,0x32,0xb2,0xcf,0x28,0x13,0xa9,0x31,0xd1,0x9d,0x21,0xc0,0x0b,0x14,0xa9,
+0x41,0xc8,0x2b,0x04,0xbc,0x50,0x91,0x39,0x05,0x9b,0x52,0xc8,0x1b,0x24,0xca,0x09,
+0x91,0x9c,0x61,0x14,0xb9,0x1a,0x14,0xa9,0x20,0x91,0xac,0x80,0xab,0x8a,0x09,0x56,
+0x91,0xab,0x32,0xa8,0x28,0x83,0xdc,0x08,0x13,0x20,0x37,0xc0,0x9c,0x02,0xda,0x38,
+0x04,0x8a,0x23,0xa9,0x61,0xd8,0x1b,0x15,0xca,0x28,0xa2,0x0b,0x22,0x89,0x21,0x90,
+0x41,0xb0,0x59,0x85,0x9c,0x21,0xfb,0x8b,0x12,0x10,0x01,0x08,0x33,0xea,0x68,0x83,
+0x9b,0x42,0xa0,0x0a,0x11,0x98,0x9c,0x72,0x83,0xae,0x28,0xa0,0x8b,0x23,0xd9,0x9b,
+0x31,0x15,0x88,0x32,0xd0,0x9c,0x31,0x01,0xc8,0x0c,0x45,0xb0,0x1c,0x84,0xcb,0x42,
+0xc1,0x0b,0x02,0xbc,0x40,0x81,0x0a,0x81,0x19,0x36,0x82,0x89,0x18,0x21,0x98,0x99,
+0xec,0x49,0xa3,0xbf,0x63,0xc1,0x0a,0x15,0xc9,0x18,0x01,0x89,0x88,0x09,0x34,0xc9,
+0x19,0x83,0xbc,0x19,0x33,0xd9,0x1a,0x17,0xb8,0x51,0xa1,0x1c,0x14,0xca,0x40,0xb1,
+0x8d,0x22,0xa9,0x40,0x92,0x9b,0x91,0x9d,0x42,0xb8,0x1b,0x16,0xb8,0x0a,0x43,0xa8,
+0x2a,0x16,0xca,0x48,0x92,0x9b,0x21,0xa9,0x21,0xfa,0x58,0x83,0x9c,0x52,0xb0,0x1a,
+0x04,0xba,0x30,0x92,0xbb,0x30,0xa1,0xbe,0x10,0xb1,0x3a,0x86,0x9c,0x54,0xb0,0x1a,
+0xa3,0xaf,0x33,0xfa,0x39,0x04,0xbb,0x62,0xa1,0x09,0x13,0xa9,0x18,0x88,0x00,0xa8,
+0x1a,0x23,0x22,0x80,0x68,0xc2,0xbf,0x62,0xa0,0x1b,0x84,0xac,0x50,0xa0,0x1a,0x04,
+0xbb,0x51,0x91,0x9c,0x10,0x90,0x88,0x00,0x00,0x99,0x10,0x88,0x51,0xb1,0x79,0x05,
+0xcb,0x62,0xa1,0x8b,0x32,0xb8,0x0a,0x90,0x41,0xa2,0x8d,0x22,0xa9,0x51,0xb0,0x49,
+0x93,0x8a,0x05,0xcc,0x18,0xc9,0x29,0xb2,0x9f,0x42,0xa8,0x0a,0x82,0x88,0x91,0x50,
+0xb3,0xaf,0x65,0xb0,0x0c,0x23,0xaa,0x51,0x82,0x89,0x02,0x99,0x42,0xc8,0x29,0x93,
+0xad,0x41,0x91,0xbb,0x28,0x92,0xad,0x20,0xf9,0x1a,0x84,0xad,0x41,0xb0,0x2b,0x15,
+0xaa,0x53,0xc0,0x19,0x82,0x9d,0x43,0xb0,0x29,0x15,0xbb,0x39,0x03,0xbc,0x39,0x15,
+0xa9,0x51,0x81,0x0a,0x91,0x1a,0x47,0xf9,0x09,0x82,0xac,0x41,0xa1,0x8a,0x80,0x8c,
+0x32,0xb1,0x38,0x17,0xcb,0x29,0x13,0xb9,0x48,0x92,0x8b,0x27,0xc9,0x48,0x93,0xad,
+0x32,0xc9,0x4a,0x04,0xad,0x40,0x82,0x08,0x90,0xbb,0x20,0xb8,0x61,0x83,0xbf,0x29,
+0x13,0xaa,0x72,0x91,0x9d,0x10,0x81,0x28,0x92,0x8d,0x22,0xda,0x68,0x03,0xac,0x30,
+0xb0,0x0c,0x33,0xa8,0x89,0xa9,0x2a,0x35,0xa1,0x2b,0x27,0xd9,0x19,0x05,0xcb,0x30,
+0x93,0x9c,0x02,0xba,0x51,0xa1,0x49,0x05,0xcc,0x28,0x90,0x29,0x14,0xb9,0x20,0xa1,
+0x8b,0x25,0xe8,0x8b,0x33,0xb1,0x0c,0x12,0xca,0x30,0x92,0x49,0x03,0x9c,0x34,0xf9,
+0x49,0x04,0x9a,0x30,0xa0,0x09,0x82,0xab,0xb0,0xcf,0x28,0x82,0xaa,0x8a,0x52,0x02,
+0x30,0xa3,0xff,0x29,0x02,0x09,0x23,0x80,0x80,0xcd,0x48,0x83,0x09,0x83,0xbf,0x30,
+0x91,0x3b,0x17,0xaa,0x30,0xb2,0x8c,0x22,0x98,0x11,0x98,0xdb,0x9b,0x52,0xa1,0x38,
+0x94,0xcf,0x09,0x10,0x22,0xa0,0x4a,0x94,0x9e,0x53,0xb1,0x0a,0x14,0x9a,0x11,0xb9,
+0x72,0x91,0x0c,0x43,0xb0,0x9b,0xa8,0x0a,0x73,0x05,0xfa,0x8a,0x12,0x98,0x52,0xa1,
+0x8d,0x11,0xa8,0x08,0x10,0x63,0xb1,0xaf,0x18,0x08,0x41,0x04,0xcb,0x8a,0x32,0x82,
+0xa9,0x11,0x98,0x38,0x83,0xad,0x18,0x54,0x04,0xdd,0x29,0x03,0xbb,0x21,0xa0,0x68,
+0x93,0x9d,0x31,0x81,0x58,0x92,0xae,0x40,0x14,0xa8,0x99,0x00,0xa9,0x10,0xa0,0x8b,
+0x81,0xbf,0x89,0x98,0x76,0x83,0xac,0x20,0xb8,0x29,0x04,0x9b,0x63,0xa0,0x8c,0x81,
+0x89,0x22,0xa8,0x08,0xc8,0x9b,0x12,0x98,0x10,0xa9,0xbb,0x71,0x67,0x81,0x9a,0x10,
+0x21,0x03,0xde,0x1a,0x23,0x8a,0x32,0xf8,0x0a,0x24,0xb8,0x8c,0x32,0x04,0xa8,0x89,
+0x89,0x31,0x12,0x8a,0xa0,0x9e,0x42,0xf8,0x0a,0x14,0xb8,0x19,0x01,0x21,0x83,0x3a,
+0x07,0xdc,0x29,0x92,0xbc,0x20,0x01,0xeb,0xbb,0x42,0x83,0x8a,0x33,0x02,0x73,0x24,
+0x81,0xaa,0x50,0x04,0xca,0x8a,0x80,0x21,0xa1,0xcd,0xa9,0x1a,0x35,0xb0,0x39,0x85,
+0xae,0x28,0x81,0x18,0x02,0x18,0x84,0xbf,0x48,0x04,0x99,0x31,0x02,0xfb,0x9c,0x32,
+0x91,0x8b,0x90,0x9c,0x21,0xfa,0x49,0x25,0xa0,0xaa,0x19,0x23,0xc8,0x28,0xd0,0x9e,
+0x52,0xa0,0x48,0x03,0xcf,0x28,0x25,0xb0,0xad,0x51,0x03,0xcc,0x29,0x12,0x99,0x10,
+0x08,0x62,0xb1,0x9e,0x21,0xa9,0x29,0xa2,0xac,0x31,0x91,0x30,0x24,0x41,0xb2,0x9f,
+0x52,0xb0,0x9d,0x00,0x98,0x30,0x91,0x0a,0x25,0xb8,0x29,0x14,0xb9,0x09,0x11,0x32,
+0xc2,0xdf,0x38,0x14,0x80,0x00,0xb8,0x8a,0x81,0xab,0x10,0xba,0x78,0x05,0xba,0x0b,
+0x32,0x25,0x81,0x99,0x10,0xd9,0xbd,0x18,0x82,0xaa,0x28,0x34,0x23,0xfb,0x0f,0x32,
+0xa9,0x39,0xb2,0xaf,0x21,0x82,0x18,0x80,0x61,0x93,0xcf,0x31,0x93,0x8c,0x34,0xd8,
+0x0b,0x12,0x89,0x28,0x80,0x31,0xa2,0x8d,0x22,0xe9,0x19,0x02,0x9a,0x52,0xb0,0x8b,
+0x01,0x9a,0x08,0x00,0x21,0xfb,0x2c,0x34,0xa8,0x0b,0x10,0x82,0xda,0x49,0x14,0xaa,
+0x41,0xb0,0x8b,0x24,0x08,0x44,0x90,0xcb,0xbe,0x48,0x04,0xbb,0x29,0x90,0x40,0x93,
+0x8d,0x35,0xd8,0x39,0x03,0xbc,0x31,0x81,0x8a,0xb8,0x0c,0x25,0xd9,0x9b,0x21,0x32,
+0x25,0xd8,0x9c,0x31,0x91,0x2a,0x16,0xcb,0x39,0x93,0x8c,0x45,0xa8,0x30,0x93,0xbf,
+0x20,0x91,0xaa,0x08,0x18,0x11,0xa8,0x20,0x33,0x11,0xc8,0xbe,0x40,0x26,0x98,0x0a,
+0x01,0xbb,0x30,0xf9,0x1a,0x93,0xaf,0x31,0xb1,0x2b,0x27,0xa9,0x88,0x90,0x30,0x16,
+0xb9,0x8a,0x42,0xa0,0x0b,0x24,0xd9,0x28,0xb0,0x5b,0x17,0xb9,0x30,0x92,0x29,0x85,
+0xcc,0x21,0xc8,0x29,0x06,0xb9,0x20,0xa2,0x8c,0x11,0x01,0x89,0x10,0xc8,0x8c,0x33,
+0xca,0x40,0xc1,0x1c,0x26,0xb9,0x19,0xc1,0x9c,0x01,0xcb,0x31,0x82,0x39,0x04,0x18,
+0x27,0x88,0x30,0x91,0x8b,0xa0,0xbb,0xc0,0xaf,0x18,0xe9,0x19,0x02,0x20,0x24,0xaa,
+0x52,0xc8,0x49,0x84,0x8b,0x22,0xda,0x51,0xa1,0x0b,0x04,0xbd,0x40,0xa0,0x0c,0x13,
+0xa9,0x20,0x91,0x29,0x12,0x21,0x82,0x51,0xc2,0x8e,0x33,0xcc,0x61,0xb1,0x0d,0x15,
+0xb9,0x40,0xb2,0x8d,0x33,0xda,0x39,0x83,0x9b,0x43,0xa8,0x1a,0x12,0xa9,0x30,0xb1,
+0xcf,0x21,0xd8,0x3b,0x17,0xab,0x61,0x91,0x8c,0x13,0xd9,0x28,0x93,0x9b,0x43,0xc8,
+0x29,0x92,0xab,0x38,0x81,0x8a,0x43,0xb8,0x6a,0x16,0xaa,0x61,0xa2,0x9c,0x23,0xea,
+0x38,0xa2,0x8c,0x43,0xa9,0x28,0x92,0x0c,0x13,0xca,0x28,0xa1,0x0b,0x22,0x98,0x09,
+0x64,0xa1,0x0c,0x35,0xea,0x2a,0x83,0x9c,0x43,0xb9,0x58,0x92,0x0b,0x25,0xdb,0x38,
+0xb1,0x0c,0x23,0xba,0x20,0x81,0x42,0x03,0x28,0xc2,0x9d,0x01,0xbb,0x40,0xa9,0x71,
+0xc3,0x0b,0x17,0xbb,0x50,0xb1,0x0d,0x03,0xcb,0x40,0xa2,0x0a,0x24,0x08,0x22,0xa9,
+0x28,0xc0,0x0b,0x83,0xad,0x21,0xb8,0x19,0xca,0x60,0xc1,0x1c,0x17,0xa9,0x38,0xb1,
+0x1c,0x25,0xa9,0x11,0xc8,0x19,0xb1,0x8d,0x23,0xba,0x73,0x92,0x0b,0x01,0xaa,0x21,
+0x01,0x13,0xde,0x0a,0x81,0x38,0x06,0x20,0x16,0xba,0x60,0xd8,0x8c,0x04,0xaa,0x40,
+0xa1,0x0d,0x23,0xc9,0x38,0x92,0x9b,0x12,0xb8,0x9a,0x8a,0x43,0x35,0x24,0xa9,0x18,
+0xf9,0x1b,0x16,0xc9,0x31,0xb2,0x2c,0x27,0xc9,0x38,0xa2,0xab,0x12,0xb9,0x39,0xa0,
+0x0c,0x82,0x08,0x44,0x12,0xc9,0x39,0x16,0xbc,0x71,0xb1,0x9e,0x23,0xc8,0x28,0x93,
+0x9f,0x20,0x98,0x40,0x82,0xac,0x10,0xb8,0x1a,0x12,0xb9,0x1b,0x25,0xaa,0x60,0x03,
+0x38,0x37,0xa9,0x71,0x03,0x9b,0x12,0xca,0x0a,0xfb,0x0b,0x22,0xdb,0x28,0x91,0x0b,
+0x14,0x88,0x10,0xa8,0x58,0x23,0x00,0x01,0xdb,0x8a,0x10,0x52,0x34,0x84,0xdd,0x1a,
+0xc8,0x9e,0x20,0xa0,0x38,0x16,0x99,0x41,0x91,0x20,0x04,0x09,0x22,0xfb,0x9c,0x98,
+0x9a,0x08,0x98,0x88,0x38,0x36,0x32,0x33,0xb0,0x49,0x06,0xbc,0x31,0xd8,0x8c,0x01,
+0xac,0x31,0xc8,0x2a,0x03,0x40,0xd4,0xcf,0x67,0xa3,0xbf,0x68,0x13,0xcc,0x19,0x15,
+0xb8,0x0a,0x22,0x98,0x89,0x00,0x21,0xa0,0xac,0x48,0x23,0xc8,0x9c,0x62,0xa1,0xac,
+0x43,0xa1,0x9b,0x22,0x98,0x89,0x88,0x54,0xd1,0x8c,0x43,0xb0,0x0b,0x32,0x90,0x18,
+0x80,0x9a,0xb9,0x1b,0x36,0x91,0x41,0xa2,0xae,0x28,0x82,0xcb,0x28,0x25,0xc8,0x8c,
+0x31,0xb8,0x8b,0x63,0x22,0x80,0xba,0x18,0xc0,0xac,0x21,0x08,0x74,0x81,0xab,0x18,
+0x98,0x89,0x31,0x46,0xa2,0xad,0x00,0xd9,0x29,0x23,0x9a,0x40,0x82,0xa9,0xcb,0x48,
+0x14,0xda,0x28,0x13,0xba,0x19,0x11,0x20,0x80,0x19,0x36,0xc0,0x9e,0x51,0x93,0xdc,
+0x09,0x12,0xa9,0x19,0x14,0xb8,0x38,0x03,0xbb,0x62,0x01,0x28,0x23,0xb8,0x9a,0xfb,
+0xbc,0x09,0x35,0xa1,0x1b,0x92,0xbf,0x40,0x02,0x89,0x02,0xab,0x54,0xe8,0x8b,0x55,
+0x91,0x99,0x11,0x90,0xbb,0x89,0xa8,0x29,0x35,0x82,0x88,0x88,0x81,0xdb,0x70,0x15,
+0xa9,0x19,0xa0,0xad,0x80,0x89,0x51,0x14,0x81,0x20,0x24,0xca,0x0a,0x14,0x88,0x23,
+0xfd,0x1a,0x04,0xcb,0x28,0x82,0x09,0x82,0xac,0x41,0xd0,0x8b,0x43,0x01,0x80,0xa9,
+0x9a,0x80,0xab,0x40,0x24,0xb8,0x0b,0xe9,0xaf,0x30,0x92,0x0a,0x46,0x81,0x09,0x20,
+0x01,0xb9,0x51,0x05,0xa9,0x99,0x9a,0x41,0xe0,0x2b,0x35,0xb9,0x48,0xb1,0x9c,0x02,
+0x10,0x47,0xc0,0x8a,0x01,0xba,0x9c,0x30,0x36,0xb0,0x9b,0x11,0x99,0x10,0xa0,0x0a,
+0x22,0x55,0x82,0xde,0xaa,0x10,0x32,0x23,0x81,0xec,0x19,0x82,0xac,0x63,0xa2,0x9b,
+0x01,0x8a,0x53,0xa1,0x09,0xb8,0x1c,0x27,0x81,0x80,0xfb,0x0a,0x23,0x88,0x00,0xb8,
+0x3a,0x14,0x80,0x80,0xba,0x19,0x53,0x05,0xea,0x19,0x12,0x30,0x85,0xcf,0x29,0x03,
+0xa9,0x08,0x18,0x81,0xce,0x39,0x03,0xa9,0x88,0x09,0x36,0xf9,0x1b,0x35,0xb9,0x0a,
+0x02,0xab,0x40,0x83,0xbe,0x2a,0x26,0xa0,0x9b,0x11,0x12,0xa8,0x39,0x47,0xc8,0x8b,
+0x21,0xb8,0xac,0x40,0x14,0x98,0x73,0xa1,0xac,0x21,0x91,0x88,0x89,0x31,0xd2,0x9d,
+0x42,0x92,0x19,0x11,0x00,0xc9,0x8b,0x26,0xfc,0x8a,0x12,0x80,0x08,0x09,0x22,0xa0,
+0x39,0x84,0xbc,0x20,0x11,0x34,0xf9,0x0b,0x24,0xa8,0x10,0xa9,0x38,0xc8,0x2b,0x15,
+0xcc,0x18,0xa1,0x9a,0x81,0x50,0x82,0x8f,0x52,0xa0,0x29,0x25,0xa8,0x09,0x29,0x24,
+0xfa,0x0b,0x14,0xca,0x29,0x24,0xa8,0x8b,0x52,0x92,0xab,0x18,0x98,0x31,0xb8,0x70,
+0x07,0xaa,0x21,0x81,0x50,0x92,0xbc,0x10,0xd9,0x9b,0x88,0x38,0x14,0xa9,0x20,0x11,
+0x42,0x33,0x55,0x91,0xad,0x51,0x82,0xa9,0x09,0x99,0xcd,0x19,0xd8,0x9d,0x41,0xc9,
+0x0b,0x04,0xba,0x58,0x02,0x20,0x14,0x18,0x44,0x90,0x20,0x92,0xae,0x08,0x98,0xab,
+0x88,0xea,0x9c,0x51,0x02,0x18,0x23,0x19,0x45,0xb1,0x09,0xc1,0x9c,0x45,0xb8,0x0a,
+0xa1,0x9e,0x12,0xc9,0x19,0x02,0xab,0x88,0x19,0x35,0x80,0x63,0xa1,0x8b,0x34,0x21,
+0x03,0xac,0x72,0xb2,0x9d,0x02,0xcb,0x89,0xea,0x09,0x82,0x99,0x22,0x82,0x63,0x12,
+0x52,0x14,0xa9,0x88,0xda,0x29,0x82,0xac,0x00,0x90,0xbb,0x1a,0x25,0xec,0x19,0x03,
+0xac,0x31,0x12,0x51,0x91,0x68,0x14,0xba,0x19,0xa1,0x9a,0xdb,0x2b,0x17,0xc9,0x28,
+0x03,0x08,0x23,0x02,0xea,0x9c,0x53,0xb8,0x1c,0x15,0xa8,0x89,0x88,0x33,0xf8,0x1a,
+0x14,0xcc,0x18,0x92,0x8a,0x00,0x99,0x00,0x99,0x73,0x12,0x18,0xa8,0x39,0x07,0xba,
+0x08,0xfb,0x1b,0x33,0x73,0x84,0xce,0x29,0x03,0x09,0x35,0xd8,0x8a,0x01,0x10,0x35,
+0xc0,0xbc,0x09,0x21,0x12,0xa9,0x9a,0x20,0xd8,0x9d,0x41,0x02,0x8a,0xb8,0xbe,0x50,
+0x25,0x02,0x80,0x11,0xb8,0x9b,0x03,0xdf,0x29,0xa2,0xae,0x88,0x18,0x53,0xd8,0x8c,
+0x12,0xb9,0x72,0x84,0xba,0x21,0x23,0x31,0x13,0x80,0x8a,0x64,0xa2,0xcf,0x31,0xb2,
+0xbf,0x10,0x91,0x08,0xa2,0xad,0x40,0x82,0x20,0x13,0x9a,0x80,0xcc,0x71,0x84,0xbd,
+0x39,0x24,0x90,0x88,0x88,0x99,0x8a,0x10,0xc8,0x2a,0x47,0xa0,0xab,0xa9,0x30,0x37,
+0xb8,0x0b,0x02,0xab,0x76,0x84,0xba,0x19,0x01,0xa9,0x09,0x91,0xcd,0x39,0x27,0xb0,
+0x0a,0x02,0xba,0x72,0x83,0xcc,0x09,0x01,0x88,0x21,0x13,0xba,0x50,0x83,0xcc,0x28,
+0x35,0x82,0xcd,0x09,0x82,0xac,0x41,0x12,0x10,0xd0,0x9f,0x51,0x92,0x8a,0x01,0xba,
+0x48,0x05,0xba,0x18,0x03,0xcc,0x19,0x12,0x99,0x99,0x88,0x41,0x13,0xa0,0xfb,0x8e,
+0x42,0x92,0x8b,0x32,0x80,0x51,0x83,0xcd,0x8a,0x32,0x02,0x99,0xa0,0xcf,0x68,0x13,
+0xa9,0x28,0x90,0x0a,0x11,0x99,0x21,0x11,0x42,0xe8,0x9c,0x98,0xbc,0x20,0x92,0xac,
+0x89,0x09,0x54,0x02,0x98,0xaa,0x28,0x14,0xa8,0x51,0x02,0xcb,0x09,0x10,0x08,0x10,
+0x80,0xcb,0x50,0x37,0x03,0xa9,0x88,0xfb,0x70,0x17,0xb9,0x09,0x03,0xaa,0x21,0xfa,
+0x2b,0x24,0xaa,0x40,0x91,0x0b,0x33,0xfb,0x89,0xa8,0x0b,0x22,0xc9,0x29,0x34,0x90,
+0xac,0x29,0x33,0x91,0xba,0xbf,0x0b,0x54,0x02,0x88,0x52,0x82,0x9a,0x30,0x82,0xeb,
+0x8a,0x11,0xc8,0x4a,0x26,0x88,0x51,0x91,0x08,0x03,0xbe,0x38,0x04,0xaa,0xbb,0x8b,
+0x34,0xd9,0x0a,0x91,0xcc,0xa9,0x09,0x53,0x02,0x20,0x91,0xbd,0x8a,0x71,0x27,0xa0,
+0x0a,0x00,0xcb,0x29,0x13,0xa0,0x09,0x63,0x01,0x19,0x11,0xcc,0x48,0xa3,0xbf,0x09,
+0x23,0x01,0x88,0x11,0x81,0x09,0x43,0xd8,0xac,0x10,0x91,0xae,0x40,0x14,0x00,0x81,
+0xba,0x8a,0xfb,0x19,0x82,0xbd,0x40,0x91,0x8b,0x54,0x22,0x22,0xc9,0x8b,0x90,0x8b,
+0x62,0x01,0x18,0x01,0x31,0x25,0xda,0x8a,0x11,0x98,0x89,0x9a,0x51,0x04,0xea,0xdc,
+0xac,0x38,0x03,0x99,0x41,0x83,0xbb,0x73,0x91,0x9b,0xfa,0x9e,0x52,0xa0,0x78,0x84,
+0xbf,0x60,0x03,0x9a,0x33,0xfb,0x0a,0xa1,0x8e,0x52,0xb0,0x29,0x17,0xb9,0x19,0x81,
+0x9a,0x43,0x81,0x89,0xfb,0x9c,0x42,0x12,0x11,0x11,0xca,0xac,0x08,0x02,0x00,0x46,
+0xc0,0x9d,0x22,0xb9,0x4a,0x16,0x99,0x18,0xc9,0x8a,0x01,0x8a,0x55,0x82,0x8a,0x00,
+0xb9,0x09,0x88,0x70,0x26,0xc9,0x9c,0x21,0xa0,0x1a,0x36,0xb0,0x89,0xa0,0x8c,0x42,
+0x90,0x29,0x13,0xca,0xaa,0x99,0x31,0x53,0x34,0xe9,0x8c,0x12,0xdb,0x48,0x13,0x10,
+0x83,0xbf,0x39,0xb2,0x0d,0x35,0xa8,0x1a,0xc0,0x9d,0x52,0x82,0x99,0x80,0x00,0x98,
+0xaa,0x41,0x23,0x81,0xdc,0x38,0x85,0xbd,0x48,0x13,0x10,0xc8,0x9d,0x01,0xcb,0x68,
+0x04,0x99,0x21,0xc9,0x1a,0x14,0x9a,0x31,0xc0,0x1b,0x16,0xba,0x0b,0x11,0x32,0x83,
+0x09,0x93,0xff,0x0b,0x31,0x34,0xa0,0xac,0x08,0xb9,0x70,0x83,0x8a,0x34,0xf8,0x8c,
+0x32,0x80,0x08,0x80,0x18,0xa2,0xcf,0x30,0x14,0xaa,0x19,0x03,0xbc,0x0b,0x32,0x91,
+0x89,0x44,0xa1,0xbe,0x19,0x35,0x81,0x0a,0x43,0xd0,0x9c,0x21,0x02,0xa9,0x08,0x81,
+0xa8,0x9a,0x00,0x98,0x73,0x06,0xa9,0x09,0x91,0xcc,0x0a,0x72,0x24,0xe9,0x8a,0x34,
+0xc8,0x0b,0x35,0xb0,0x9b,0x21,0xa9,0x09,0x90,0x60,0x14,0xea,0x09,0x03,0xa9,0x30,
+0x24,0x98,0xca,0x9b,0x32,0x90,0x70,0x14,0xca,0x09,0x90,0x08,0x34,0xb1,0x8b,0x21,
+0xeb,0x8b,0x21,0xa9,0x29,0x24,0x11,0xc9,0x8d,0x47,0x91,0xbb,0x00,0x98,0x9b,0x9a,
+0x72,0x16,0xa8,0x0a,0x11,0x90,0x10,0x42,0x81,0xcc,0x8a,0x88,0x98,0x19,0x57,0x83,
+0xca,0x29,0x82,0xab,0x8a,0x08,0x33,0xfd,0x8e,0x32,0x83,0x89,0x20,0x11,0x01,0xeb,
+0x1a,0x23,0xc9,0x1a,0x03,0xcc,0x2a,0x44,0x02,0xc9,0x9b,0x62,0x92,0x8a,0x41,0xa0,
+0x9d,0x09,0x00,0x11,0xa8,0x1a,0x35,0x82,0xca,0x89,0x32,0xa0,0x8b,0x24,0xa8,0x9b,
+0xca,0xad,0x72,0x36,0x92,0xbb,0x29,0x02,0xeb,0xcb,0x9a,0x31,0xa0,0x2a,0x36,0x80,
+0x51,0x92,0x0a,0x26,0xe9,0x0a,0x02,0xdb,0x8a,0x10,0x43,0x03,0x09,0x34,0xb1,0xac,
+0x10,0x01,0xc8,0xbc,0x0a,0x11,0x91,0x89,0x64,0x81,0x18,0x35,0xc8,0x0a,0xa1,0xad,
+0x31,0xa2,0xcb,0x19,0x65,0x13,0xc9,0x89,0x80,0x89,0x80,0xc9,0xac,0x08,0xa8,0x39,
+0x77,0x84,0xa9,0x29,0x33,0xa1,0x8a,0x82,0xdb,0x9b,0xaa,0x70,0x83,0xbe,0x28,0x13,
+0x09,0x43,0x81,0x88,0x99,0xa9,0xbe,0x79,0x15,0xb9,0x8a,0xca,0x39,0x16,0x98,0x41,
+0xc0,0x8b,0x33,0x98,0x42,0xf8,0x0c,0x22,0xa8,0x09,0x90,0x60,0x04,0xca,0x20,0xb2,
+0x9d,0x31,0x91,0x10,0xb1,0x8c,0x24,0xca,0x71,0x93,0xbc,0x10,0xa0,0x19,0x13,0xcb,
+0x50,0x03,0xba,0x18,0x43,0x11,0x88,0x11,0xd0,0xcc,0x09,0x12,0x88,0x20,0x15,0xdc,
+0xac,0x10,0x24,0x91,0xaa,0x00,0xc9,0x0b,0x32,0xa8,0x30,0x25,0x42,0x25,0xb8,0x2a,
+0x24,0x01,0xa0,0xcf,0x38,0x84,0xcc,0x28,0x83,0xba,0x18,0x10,0x12,0xd9,0x0b,0x82,
+0x8b,0x54,0xe8,0x0a,0x12,0xbb,0x60,0x14,0x18,0x23,0xdb,0x0a,0x14,0xc9,0x0a,0x32,
+0xa0,0xac,0x18,0x33,0x12,0xb8,0xae,0x48,0xb1,0xaf,0x52,0x82,0x9a,0x11,0xdc,0x1a,
+0x24,0x00,0x22,0xb8,0x9e,0x19,0x32,0x13,0xb9,0xbb,0xad,0x40,0xa2,0x1c,0x37,0xd8,
+0x1a,0x13,0xb9,0x18,0xa1,0x8c,0x33,0xd8,0x9b,0x10,0x42,0x33,0x02,0x89,0x31,0xf0,
+0x9c,0x44,0xc0,0x9c,0x21,0xa0,0x29,0x37,0x90,0xab,0x20,0x83,0xba,0x19,0xf9,0xaf,
+0x28,0x11,0x11,0x83,0xca,0x40,0x02,0x8b,0x44,0xc8,0x0b,0x01,0xab,0x61,0x92,0x09,
+0x25,0x00,0x10,0xe9,0x9c,0x88,0x20,0x35,0xa0,0xdb,0xab,0x58,0x25,0xa8,0x8a,0xb8,
+0x9c,0x42,0x81,0x9a,0x88,0x18,0x45,0x11,0x23,0xa1,0x5a,0x27,0xa8,0x8a,0xa8,0xbb,
+0x10,0x88,0x12,0xfd,0x9c,0x22,0x91,0x10,0x90,0xad,0x09,0x21,0x45,0x90,0xac,0x21,
+0x23,0x42,0x14,0x98,0x8a,0x41,0x13,0xdc,0x0b,0x80,0xac,0x19,0x81,0xac,0x99,0x98,
+0x31,0x04,0x99,0xaa,0xbc,0x49,0x47,0x82,0xbc,0x39,0x27,0x90,0x28,0x04,0xb9,0x18,
+0x03,0xaa,0xba,0xce,0x0a,0x22,0x81,0xca,0xbc,0x0a,0x21,0x13,0x12,0xa8,0xdc,0xab,
+0x40,0x34,0x10,0x73,0x03,0x09,0x46,0xa1,0x9c,0x31,0x02,0x89,0xc9,0xab,0xb9,0xaf,
+0x41,0x93,0xbb,0x29,0x32,0x81,0xcc,0x9a,0xcb,0x39,0x16,0xb9,0x29,0x04,0x18,0x36,
+0x43,0x02,0xba,0x0a,0xe0,0xac,0x53,0x13,0x80,0x98,0x99,0xa8,0x9c,0x63,0x92,0xcc,
+0xbb,0x9b,0x08,0x98,0x30,0x04,0x89,0x00,0x9a,0x77,0x13,0x98,0xaa,0x8a,0x41,0x43,
+0x23,0x12,0x98,0xaa,0x38,0x37,0x82,0xeb,0xab,0xca,0xbc,0x51,0x14,0x98,0x80,0xdd,
+0x8b,0x22,0x80,0x10,0xb8,0xac,0x99,0x0a,0x56,0x22,0x21,0x82,0x9a,0x40,0x35,0x25,
+0x01,0xba,0xba,0xdb,0x09,0x80,0xbc,0x9b,0x02,0xfb,0x8b,0x11,0xb9,0x19,0x91,0xaf,
+0x19,0x00,0x20,0x04,0x10,0x57,0x12,0x11,0x44,0x12,0x88,0x99,0x99,0xa8,0x08,0x23,
+0xfc,0xae,0x99,0x99,0x10,0x92,0xcb,0xba,0xbf,0x0a,0x32,0x41,0x34,0x03,0x09,0x11,
+0x22,0x65,0x22,0x88,0x98,0xb9,0x8b,0x32,0x03,0x11,0xd0,0xcc,0x09,0x99,0xb9,0xfb,
+0xad,0xab,0x9b,0x60,0x04,0xaa,0x20,0xa1,0x0c,0x46,0x82,0x09,0x11,0xa9,0x39,0x34,
+0x42,0x14,0xa0,0xab,0xda,0xad,0x19,0xa0,0x9b,0x21,0xfb,0xad,0x18,0x10,0x02,0xa0,
+0xca,0xbc,0x9b,0x41,0x32,0x64,0x13,0x80,0x31,0x22,0x40,0x34,0x01,0x21,0xc1,0x9c,
+0x43,0x91,0x0a,0x12,0xca,0xcd,0xac,0x09,0xa8,0xbc,0xaa,0xac,0x89,0xa9,0x50,0x13,
+0x19,0x47,0x81,0x29,0x17,0xa0,0x9a,0x98,0x19,0x42,0x32,0x93,0xdd,0x8b,0x00,0x19,
+0x55,0x02,0xa9,0xbb,0xbd,0x89,0x00,0x11,0xa0,0x99,0xec,0xab,0x62,0x33,0x43,0x22,
+0x11,0x82,0x9b,0x72,0x13,0x11,0x14,0x98,0x12,0xf8,0x9e,0x01,0xa9,0x99,0xda,0xad,
+0x09,0x81,0xdb,0x8a,0x22,0xa0,0x18,0x25,0x21,0x43,0x52,0x55,0x82,0x08,0x02,0xe9,
+0x9a,0x08,0x08,0x18,0x88,0xb8,0xff,0x0a,0x01,0xa8,0x18,0x83,0x00,0x23,0xbc,0x70,
+0x06,0x71,0x57,0x01,0x9a,0x98,0xdb,0x8a,0x80,0xbb,0x18,0xb8,0x9b,0x21,0xa9,0x08,
+0x20,0x56,0x13,0x53,0x24,0x00,0x32,0xa1,0x1a,0x26,0xc9,0x0a,0x21,0x11,0x11,0x13,
+0xb8,0x9c,0x21,0xda,0x1a,0x92,0xae,0xa8,0xcf,0x0a,0x02,0x88,0x43,0x82,0x8a,0xa8,
+0xbf,0x89,0xb9,0xaa,0xb8,0xcb,0x8a,0xb9,0x0b,0x23,0xa0,0x60,0x04,0xba,0x8b,0x61,
+0x35,0x24,0x22,0x34,0x23,0x53,0x24,0x01,0x00,0x01,0x20,0x21,0xa0,0xcc,0xbb,0xeb,
+0xaa,0x99,0xbb,0xad,0x89,0xa8,0x00,0x91,0x19,0x77,0x04,0x98,0x98,0x89,0x10,0x88,
+0x9b,0x9a,0xbc,0xce,0xdd,0xaa,0x88,0x89,0x21,0x90,0x9a,0x22,0x00,0x54,0x13,0x00,
+0x12,0x10,0x71,0x24,0x11,0x98,0xaa,0x00,0xb0,0x4a,0x67,0x13,0x21,0x11,0x99,0x30,
+0x12,0x89,0x33,0xf9,0xcf,0x08,0xb9,0xab,0x10,0xfb,0xab,0x80,0xda,0x8a,0x22,0x31,
+0x36,0x02,0x41,0x24,0x91,0x20,0x22,0x09,0x52,0x13,0x98,0x99,0x18,0x01,0xaf,0x48,
+0x16,0xb9,0x8a,0x80,0x9a,0x9a,0x99,0x83,0xf9,0xaf,0x89,0x10,0x43,0x23,0x53,0x03,
+0xb9,0x9c,0x18,0x11,0xc8,0xaa,0xbc,0x1b,0xca,0xaf,0x32,0xe9,0x1a,0x93,0xcf,0x08,
+0xc0,0x9a,0x13,0xb8,0x28,0x14,0x89,0x21,0x30,0x47,0x83,0x08,0x33,0xb0,0x9a,0xa1,
+0xad,0x73,0x23,0x42,0x25,0x90,0x89,0xa0,0x9a,0x33,0xfc,0x8a,0xa9,0xbe,0x10,0x91,
+0x88,0xb8,0x1a,0x37,0x80,0x72,0x25,0x08,0x21,0xa0,0x9a,0xb8,0xac,0x44,0x82,0x89,
+0x01,0xea,0xcb,0xbb,0x99,0xa9,0xbb,0x89,0xb9,0xbb,0x11,0x24,0x33,0x56,0x27,0x03,
+0x10,0x41,0x23,0x80,0x19,0x24,0xe0,0xab,0x18,0xba,0x8c,0xa0,0x9b,0x24,0xfb,0xbf,
+0x00,0x00,0x20,0x11,0x21,0x03,0x89,0x41,0x02,0x10,0xf9,0x9c,0x18,0xab,0x61,0x25,
+0x01,0x09,0x88,0xa8,0xcb,0x9a,0xa9,0x9b,0x73,0x24,0x80,0xab,0x0c,0x19,0x50,0x36,
+0xb0,0x9c,0x22,0xea,0x19,0x36,0x81,0x18,0x10,0x99,0xbb,0x1b,0x21,0x3a,0x46,0xb0,
+0x9e,0x11,0x80,0x08,0xa8,0x81,0xfb,0xaf,0x88,0xaa,0x29,0x92,0x09,0x25,0xda,0x29,
+0x14,0x10,0x14,0xa1,0x44,0x93,0xab,0x11,0xcd,0x39,0x26,0x00,0x22,0x90,0xaa,0xa9,
+0x10,0xb1,0xdf,0x18,0x91,0xbb,0xcc,0xbb,0x30,0xc8,0xad,0x89,0x10,0x46,0x13,0x52,
+0x25,0x88,0x19,0x91,0xbb,0x08,0x22,0x13,0xf9,0xab,0xea,0xab,0x08,0xca,0x49,0x16,
+0x98,0x89,0x98,0x31,0xd2,0x9d,0x42,0x91,0x18,0x23,0x08,0x54,0x11,0x53,0x92,0xbc,
+0x01,0xb9,0x28,0xd2,0xae,0x12,0xd8,0x8a,0x02,0xb9,0x30,0x05,0x01,0x91,0xdb,0x38,
+0x33,0x88,0x11,0x30,0x22,0xef,0x0b,0x34,0xa0,0xcb,0x18,0x12,0xfb,0x8c,0x33,0x90,
+0x48,0x04,0xdb,0x19,0xb0,0x0b,0x54,0x11,0x08,0x80,0x30,0x04,0xab,0x88,0xba,0x50,
+0x93,0x61,0x17,0x88,0x10,0xfb,0x9a,0xa1,0xad,0x18,0x98,0x38,0x26,0x00,0x00,0x90,
+0x99,0x11,0xdb,0x73,0xc4,0x8d,0x45,0xe9,0x0a,0x04,0xaa,0x42,0xb8,0x70,0x94,0x9d,
+0x43,0xc8,0x3a,0x94,0x9c,0x43,0xd8,0x29,0x83,0x9c,0x32,0xda,0x48,0xa2,0x9c,0x43,
+0xc9,0x38,0xa2,0x8c,0x14,0xb9,0x40,0xa1,0x8b,0x15,0xba,0x30,0xb3,0x8d,0x13,0xb8,
+0x38,0x90,0x3a,0xa3,0x9f,0x53,0xb8,0x39,0x05,0xab,0x32,0xb0,0x2a,0x04,0x8a,0x42,
+0xd9,0x29,0x83,0xae,0x30,0x90,0x0a,0x23,0x99,0x18,0xd9,0x19,0xa3,0xaf,0x52,0xb8,
+0x0c,0x24,0xca,0x20,0x92,0x9b,0x24,0xda,0x38,0x93,0x8c,0x12,0xcb,0x48,0x83,0x9b,
+0x32,0xb0,0x1a,0x22,0x32,0x85,0x9b,0x45,0xb0,0x0c,0x34,0xa9,0x19,0x84,0xaa,0x01,
+0xca,0x28,0x13,0x40,0x05,0xdc,0x0a,0x31,0x34,0x92,0xab,0x98,0xbd,0x38,0xa1,0x78,
+0x16,0xcb,0x9a,0x98,0x19,0x23,0xaa,0x48,0x91,0x8c,0x08,0xcb,0x1a,0x44,0x12,0xaa,
+0xaa,0xdd,0x1a,0x64,0x01,0x18,0x12,0x02,0x23,0xb0,0xbe,0xba,0x9a,0x53,0x03,0x88,
+0x10,0x18,0x74,0x13,0xba,0xac,0xb9,0xbb,0x4a,0x23,0xd9,0x09,0x52,0x43,0x81,0x9b,
+0x40,0x12,0x28,0x12,0xeb,0x9b,0xcb,0xac,0x99,0xd9,0xab,0x2a,0x54,0x01,0xaa,0x8a,
+0xa8,0xbe,0x3b,0x37,0x23,0x43,0x92,0xbc,0x19,0x91,0xbb,0x73,0x24,0x88,0x99,0x30,
+0x25,0xa8,0xab,0x80,0xca,0x1a,0x42,0xda,0x9d,0x18,0x34,0x13,0xd9,0xac,0x9a,0xa9,
+0x99,0x29,0x57,0x83,0x99,0x89,0xcc,0x1a,0x42,0x33,0x34,0x11,0x21,0xa8,0x3a,0x37,
+0x12,0xb8,0xff,0x9a,0x98,0x89,0x32,0x11,0x21,0x83,0x89,0x28,0x8a,0x44,0xd1,0x29,
+0x86,0xce,0x09,0x90,0x19,0x36,0x81,0x28,0x82,0xbc,0x89,0x20,0x34,0xa1,0xbd,0x18,
+0xb8,0xbe,0x8b,0x22,0x43,0x54,0x12,0x91,0xda,0xad,0x28,0x13,0x10,0x33,0xb8,0x49,
+0x24,0xa0,0x00,0xf9,0xac,0x8a,0x88,0x98,0x28,0x77,0x01,0x9a,0x10,0xa8,0xac,0x18,
+0x01,0x00,0x11,0x21,0x98,0x71,0x27,0x90,0x8a,0x99,0xad,0x8a,0x80,0x10,0x11,0x33,
+0x36,0x33,0x22,0x90,0x09,0x03,0xa2,0xf9,0xcd,0x0a,0xa0,0xbf,0x89,0x02,0x21,0x55,
+0x22,0xb8,0xcd,0x09,0x21,0x99,0x18,0x82,0x38,0x27,0x11,0x31,0x92,0xcb,0xca,0x8d,
+0x41,0x02,0x00,0x11,0x41,0x14,0xb9,0x48,0x13,0xaa,0x30,0xa1,0xbc,0x0c,0x29,0xea,
+0x9a,0xb1,0xce,0x19,0x03,0xca,0x9c,0x38,0x83,0xdd,0x18,0x12,0x56,0x14,0xfb,0x0a,
+0x33,0xa8,0x0a,0xd9,0xad,0x18,0xb8,0x9c,0x31,0x01,0x18,0x34,0xc0,0x2a,0x77,0x90,
+0x89,0x22,0x90,0x9a,0x10,0x90,0xdb,0x0b,0x34,0xb8,0x8c,0x52,0x33,0x91,0xac,0x40,
+0x92,0x9a,0x22,0xa8,0x2a,0xb1,0xae,0x21,0x83,0x80,0x42,0x37,0xd0,0xad,0x28,0x82,
+0xaa,0x20,0x01,0xab,0x9a,0xb9,0x8b,0x18,0x98,0x08,0xbb,0xff,0x9b,0x30,0x26,0x02,
+0x10,0x23,0x32,0x43,0x80,0x0b,0x72,0x11,0x09,0x59,0x53,0x80,0x0a,0x42,0x23,0x88,
+0x43,0x05,0x98,0x38,0x43,0x33,0x05,0xb0,0x90,0xe8,0xbc,0x18,0x20,0x00,0x01,0xda,
+0xce,0x8b,0x40,0x22,0x08,0x00,0x92,0xa2,0x90,0x80,0x01,0x0b,0x8e,0x29,0xa9,0xec,
+0xba,0x10,0x81,0xbf,0x60,0x33,0xa0,0xca,0xdf,0x9b,0x00,0xb8,0x29,0x24,0xaa,0x2a,
+0x12,0x2a,0x1a,0xcf,0x29,0x23,0x99,0x09,0x03,0x24,0x14,0xc1,0xcc,0x09,0x90,0xeb,
+0xbb,0x3b,0x74,0x02,0xb0,0xcb,0x9b,0x99,0xbb,0x2a,0x21,0x29,0x34,0xf1,0x09,0x53,
+0x81,0x89,0x54,0x34,0x82,0x99,0x08,0xc8,0xcc,0x09,0xa2,0xbf,0x0c,0x88,0x8a,0x41,
+0x25,0x23,0xa2,0xba,0x34,0xc1,0x1a,0x27,0xb9,0xac,0xda,0xac,0x9a,0x00,0x54,0x43,
+0x22,0x22,0x10,0x63,0x02,0x88,0xb9,0xdf,0x8a,0x80,0x98,0x88,0x98,0x10,0x43,0x63,
+0x54,0x12,0x90,0x99,0x08,0x88,0x08,0x22,0xa8,0xcc,0xdd,0x9a,0x41,0x22,0x01,0x90,
+0xca,0xdb,0x9a,0x98,0xc9,0xab,0x89,0xea,0xab,0x38,0x65,0x33,0x82,0x99,0x00,0x11,
+0x34,0x24,0x80,0xdb,0xae,0x8a,0x00,0x89,0x31,0x12,0x20,0x31,0x73,0x73,0x12,0x90,
+0xaa,0x08,0x32,0x24,0xb1,0xcd,0xaa,0xbc,0xac,0x08,0x01,0x11,0x88,0x98,0xb9,0x9a,
+0xad,0x0b,0x73,0xc8,0xdd,0xbb,0xab,0x30,0x34,0x02,0x18,0x18,0x40,0x54,0x23,0x91,
+0xbb,0x88,0x24,0xa2,0x70,0x46,0x02,0x98,0x08,0x21,0x82,0xfb,0xae,0x9a,0x08,0x11,
+0x32,0x83,0xdc,0x19,0x24,0x12,0x20,0xc9,0xae,0x99,0xba,0x9a,0x32,0x13,0x80,0xa0,
+0xdb,0xbc,0xbf,0xab,0x28,0x31,0x11,0x18,0x63,0x44,0x44,0x43,0x01,0xc9,0xba,0x09,
+0x81,0x18,0x65,0x13,0xa8,0x18,0x11,0x01,0xfc,0xab,0x28,0x14,0x80,0x00,0x81,0xdc,
+0x8c,0x62,0x22,0x80,0x88,0xa9,0xbb,0xdd,0x8b,0x54,0x02,0x9a,0x30,0x82,0xbb,0x29,
+0x26,0xb1,0xcd,0x09,0x02,0xca,0x39,0x46,0x22,0xb8,0xac,0x89,0xb8,0xab,0x40,0x82,
+0xaa,0x28,0x31,0x42,0x32,0x53,0x35,0xb8,0xaf,0x19,0x33,0x02,0x0a,0x63,0x82,0x99,
+0x80,0xea,0xab,0x42,0x04,0x98,0x8a,0x10,0x43,0x02,0x9b,0x64,0x91,0xaa,0x23,0xf8,
+0xbf,0x99,0x08,0x11,0x12,0x10,0x53,0x24,0xa0,0x9c,0x00,0xb8,0xbf,0x08,0x21,0x00,
+0x32,0x12,0x01,0x91,0x01,0x13,0xfc,0x9e,0x20,0x03,0xba,0x8b,0x01,0xa2,0xed,0x0a,
+0x46,0x23,0x80,0x09,0x21,0xa0,0xdf,0x9a,0x10,0x00,0x10,0x42,0x02,0xbd,0x1a,0x26,
+0x90,0x09,0x32,0x92,0xbb,0x8a,0x65,0x35,0x03,0xec,0xbc,0xac,0xa9,0x99,0x88,0x98,
+0x38,0x56,0x43,0x23,0x12,0x31,0x34,0x91,0xbb,0xba,0xdb,0xac,0xaa,0x98,0xba,0xac,
+0x00,0x03,0x00,0x73,0x27,0x81,0xa9,0xb9,0xca,0x9a,0xa9,0x08,0x43,0xb0,0xbe,0x08,
+0x01,0x99,0x40,0x35,0x90,0xaa,0x21,0x13,0x34,0x37,0x34,0x14,0xb9,0xae,0x08,0x32,
+0x23,0xb9,0x1a,0x34,0xb1,0x9c,0x72,0x22,0x98,0x28,0x14,0xe9,0xcb,0x08,0x33,0x13,
+0x99,0xa9,0xcb,0xbb,0xbb,0xaf,0x0a,0xc8,0xcf,0x19,0x32,0xa8,0xbb,0x08,0x13,0xb0,
+0x3a,0x37,0xf8,0xad,0x09,0x22,0x23,0x80,0x00,0x45,0x14,0x01,0x21,0x92,0xec,0xab,
+0x28,0x80,0xcb,0x8a,0x52,0x36,0x23,0x88,0x80,0xeb,0x9a,0x10,0x98,0x99,0x89,0x20,
+0x35,0x81,0x88,0x52,0x03,0xcc,0x0a,0x43,0x80,0xca,0x89,0x64,0x13,0x90,0x99,0xbb,
+0x3a,0x47,0x82,0xd9,0xbb,0xab,0xaa,0x10,0x02,0x32,0x37,0x03,0xba,0x9d,0x20,0x12,
+0xa9,0x0a,0x11,0x90,0x71,0x36,0x12,0x11,0x92,0xfb,0xbc,0xbc,0x9a,0x08,0x20,0x53,
+0x32,0x21,0x22,0x21,0x30,0x45,0x81,0x19,0xa0,0xff,0x9d,0x08,0x00,0x88,0x98,0x32,
+0x12,0x8a,0x30,0x15,0x02,0xc9,0xac,0x20,0x12,0x48,0x44,0x82,0xa9,0x09,0xb8,0xab,
+0xc9,0xdf,0x30,0x84,0x1a,0x34,0xfa,0x8b,0x21,0x21,0x92,0xca,0x63,0x15,0x98,0x89,
+0x99,0x20,0x83,0xce,0x9b,0x11,0xb0,0xac,0x51,0x13,0xb9,0xad,0xab,0x18,0x21,0x73,
+0x27,0x80,0x9a,0x89,0x09,0x52,0x02,0xdb,0xbb,0x89,0x32,0x11,0x31,0x24,0x72,0x14,
+0xd9,0x8b,0x11,0x98,0xba,0xbb,0x71,0x03,0xba,0x18,0x22,0x32,0xc1,0xae,0x50,0x04,
+0xd9,0x8a,0x10,0x88,0xa9,0xca,0x8a,0x72,0x43,0x12,0xa9,0x8b,0x11,0x41,0x34,0xb0,
+0x10,0x95,0xce,0xab,0x08,0x42,0x23,0x01,0x81,0xea,0xbb,0x09,0x63,0x13,0xba,0x8c,
+0x20,0x21,0x32,0xd0,0x8a,0x54,0xb1,0xdd,0x89,0x30,0x43,0x02,0x89,0x20,0xd8,0xcf,
+0x9a,0x80,0x98,0x30,0x37,0x01,0x88,0x11,0x81,0x09,0x00,0x10,0x34,0xf8,0xcf,0x89,
+0x01,0x98,0x19,0x42,0x12,0x00,0x21,0x43,0x22,0xda,0xbc,0xac,0x8b,0x10,0x12,0x99,
+0x38,0x67,0x12,0x80,0x01,0xb9,0x9c,0x80,0xeb,0xab,0x31,0x22,0x80,0x31,0x23,0x9a,
+0x68,0x81,0xbb,0x10,0xbb,0x2e,0x45,0x90,0x28,0x13,0xb8,0xcb,0xa8,0xb9,0xad,0x2b,
+0x64,0x14,0x92,0xaa,0x49,0x52,0x21,0x90,0xcc,0x9b,0x98,0xbb,0x39,0x26,0x12,0x08,
+0x99,0xbc,0xab,0xa8,0xba,0x78,0x37,0x02,0x91,0xa8,0x88,0x00,0x09,0xa0,0xc0,0xf9,
+0xbe,0x8a,0x73,0x21,0x08,0x20,0x80,0xdb,0xab,0x89,0x09,0x20,0x32,0x42,0x53,0x00,
+0x00,0x82,0xf0,0xa8,0x01,0x98,0xaf,0x8c,0x19,0x00,0x20,0x45,0x12,0x91,0x91,0xa9,
+0xa8,0x9a,0x9b,0x9e,0x09,0x32,0x55,0x25,0x14,0x02,0x00,0x24,0x14,0x40,0x44,0x12,
+0x01,0x90,0xbb,0xcb,0xcf,0xac,0xba,0xbb,0x9a,0xca,0xae,0x09,0x18,0x31,0x34,0x22,
+0x32,0x14,0x08,0x29,0x09,0x08,0xa3,0xfa,0xac,0x00,0x43,0x45,0x53,0x31,0x01,0x80,
+0x88,0x90,0xb0,0xa9,0x44,0xa3,0xbd,0x8a,0x8b,0x51,0x23,0x8a,0x19,0xc1,0xf9,0xdb,
+0xbb,0xbc,0xac,0x9a,0x9a,0x48,0x41,0x31,0x32,0x10,0x39,0xbb,0x0f,0x39,0x0a,0x89,
+0x34,0x37,0x14,0x04,0x14,0x22,0x22,0x21,0x08,0xba,0xbb,0xa9,0xd0,0xad,0x8e,0x39,
+0x33,0x83,0xca,0xbd,0x9b,0xa0,0xba,0x90,0x91,0x90,0xfb,0xae,0x28,0x11,0xab,0xbd,
+0xbf,0x9b,0x20,0x43,0x40,0x31,0x40,0x30,0x80,0x9b,0x32,0x15,0x24,0x83,0x9a,0x18,
+0xfb,0x9b,0x12,0xb9,0x9d,0x02,0x92,0x00,0x46,0x25,0xa1,0xb8,0x81,0x52,0x53,0x98,
+0xbc,0xa9,0x21,0x41,0x10,0xba,0xbd,0x99,0xc9,0xb9,0x91,0xd2,0xdb,0xbb,0xc9,0x09,
+0x8a,0x2a,0x27,0x14,0x25,0x03,0x90,0xc8,0xfb,0x89,0x00,0x08,0x80,0x01,0x31,0xc1,
+0xd9,0x02,0x32,0x36,0x06,0x81,0x11,0x11,0x52,0x13,0x18,0x50,0x00,0x0a,0x90,0x99,
+0x46,0x13,0x99,0xac,0x9c,0x00,0xbb,0xaf,0x38,0x32,0x61,0x32,0x42,0x43,0xa2,0xfc,
+0xcc,0xbb,0xbc,0xaa,0x99,0xa8,0x80,0x35,0x37,0x34,0x32,0x21,0x80,0xb9,0xdc,0xca,
+0xcb,0xbc,0xaa,0x89,0x11,0x11,0x32,0x35,0x35,0x24,0x34,0x12,0x90,0x88,0x89,0x80,
+0x90,0xc8,0xa9,0x90,0xa1,0xc9,0xaa,0x19,0x33,0xf0,0xbf,0x89,0x99,0x48,0x33,0x99,
+0x50,0x35,0x80,0xab,0xab,0xbc,0x3b,0x31,0xd0,0xcf,0x19,0x36,0x92,0x0a,0x22,0xed,
+0x0a,0x22,0xb8,0x1a,0x47,0x02,0xba,0x38,0x37,0x82,0xdc,0x9a,0x88,0xdb,0x19,0x25,
+0x00,0x42,0x82,0x88,0x10,0xe9,0x9d,0x20,0xa0,0xbf,0x19,0x25,0x12,0x80,0x00,0x21,
+0xc8,0xad,0x18,0x88,0xcb,0x9b,0x61,0x24,0x01,0x08,0x11,0xc9,0x9f,0x30,0x92,0xbc,
+0x20,0x02,0x28,0x13,0x09,0x46,0xa0,0xcb,0x9a,0x09,0x11,0x99,0x88,0x30,0x47,0x81,
+0x48,0x13,0xce,0x08,0x02,0x9a,0x99,0x8a,0x32,0xa1,0x0a,0x45,0x12,0x08,0x08,0xc9,
+0x9d,0x18,0xdb,0x1b,0x82,0xaf,0x41,0x04,0x89,0x01,0x10,0x33,0xf9,0x9f,0x20,0x01,
+0x99,0x11,0x08,0x31,0x84,0xab,0x42,0xe8,0x9d,0x21,0x01,0x80,0xcb,0x19,0x93,0xdf,
+0x38,0x27,0x90,0x89,0x00,0x98,0x20,0x02,0x9a,0x88,0xba,0x48,0xb2,0xaf,0x73,0x81,
+0x99,0x21,0x90,0x0a,0x33,0xa1,0xbb,0x80,0x90,0xcd,0x9c,0x80,0x90,0x10,0x24,0xd0,
+0xcd,0x48,0x26,0x98,0x18,0xc1,0xae,0x20,0x91,0xab,0x30,0x22,0x91,0xcc,0x58,0x36,
+0x82,0xdb,0x8a,0x12,0x98,0x21,0x83,0x09,0x10,0xaa,0x38,0x13,0x81,0xfc,0x8b,0x02,
+0xca,0x38,0x37,0x91,0xdc,0x09,0x24,0xb8,0x0a,0xa1,0xac,0x53,0x92,0x1a,0x14,0xcb,
+0x29,0x04,0xcb,0x29,0x21,0x18,0x88,0x09,0x14,0xa0,0xac,0xab,0x1b,0x73,0x14,0x90,
+0x8b,0x72,0x02,0xc9,0x99,0xa8,0xa9,0xda,0xab,0x09,0xa8,0x0a,0x67,0x12,0x98,0x80,
+0xb9,0x20,0x12,0x18,0x23,0xfb,0xab,0x9c,0x4a,0x44,0x12,0x91,0xac,0x29,0x18,0x38,
+0x14,0x03,0x37,0xa2,0x99,0x34,0x36,0x91,0xcc,0x19,0x80,0x09,0x30,0x80,0xac,0x99,
+0x92,0x84,0x17,0xc8,0xbc,0xa9,0xbc,0x40,0x16,0x98,0x8a,0x98,0x9a,0x29,0x15,0xb1,
+0xb9,0xa8,0x12,0x03,0x19,0x8a,0xaf,0x71,0x13,0x8a,0x51,0x82,0x19,0x21,0x12,0x27,
+0x03,0xeb,0x0c,0x18,0x20,0x41,0x91,0xbb,0x29,0x01,0x08,0x12,0x28,0xac,0xad,0x25,
+0xa3,0x9d,0x52,0x12,0x1a,0x39,0x40,0x8a,0xae,0xcb,0x10,0x34,0xa8,0x8b,0xba,0xaf,
+0x40,0x81,0x9c,0x00,0xb1,0x90,0x43,0x22,0x00,0x9a,0xb9,0x1a,0x3b,0x11,0xdb,0xae,
+0x08,0x20,0x52,0x14,0xc8,0xa8,0x84,0x01,0x68,0x21,0x89,0x1b,0x9b,0x9c,0x58,0x20,
+0x82,0xb0,0x0d,0x2a,0x0a,0x69,0x20,0xcb,0x98,0x81,0x0d,0x39,0xa9,0x11,0x37,0x89,
+0x1c,0x08,0x9c,0x28,0x93,0x29,0x37,0xb3,0x9a,0x53,0x20,0x3a,0x82,0xba,0xcb,0xdb,
+0x30,0x05,0xb1,0x12,0x33,0x59,0x20,0x8c,0x8b,0xf1,0xc8,0x90,0x93,0x92,0x01,0xba,
+0x7a,0x51,0x2a,0x3a,0x02,0xd8,0x9b,0x08,0xa2,0xf9,0xbb,0x21,0x25,0x10,0x80,0xc9,
+0x9d,0x28,0x42,0x22,0xb8,0xbf,0x9c,0xab,0x59,0x55,0x81,0x99,0x09,0x89,0x29,0x44,
+0x80,0x9b,0x39,0x72,0x01,0xb9,0x89,0x10,0xba,0xdb,0xba,0x3b,0x4a,0x3a,0x77,0x03,
+0x80,0x98,0xcb,0xbb,0x88,0x13,0x04,0xb9,0xbf,0x1a,0x54,0x02,0xa8,0xa9,0x11,0xa1,
+0x9b,0x52,0x90,0x9b,0x99,0x9f,0x3a,0x24,0x93,0x83,0xd0,0x0c,0x71,0x01,0x98,0xa1,
+0xb9,0x18,0x13,0x43,0x24,0x15,0xc1,0xdb,0x09,0x21,0x24,0xa0,0x61,0x33,0xfb,0xff,
+0x28,0x14,0xa8,0x72,0x93,0xaf,0x18,0x81,0xaa,0x21,0x23,0x83,0xcd,0x40,0x04,0xaa,
+0x18,0xc8,0x8a,0x98,0x9c,0x63,0x22,0x00,0x99,0x30,0x83,0xbc,0x09,0x90,0xc9,0xcf,
+0x39,0x25,0x90,0x08,0x00,0x31,0xc1,0x9e,0x30,0x81,0xcb,0xab,0x71,0x13,0x99,0x21,
+0x92,0xaa,0x9a,0x58,0x04,0xdd,0x19,0x01,0x08,0x00,0x08,0x32,0x81,0x08,0x81,0x52,
+0xf1,0xbf,0x20,0x82,0x89,0x22,0x90,0x18,0x98,0x50,0x15,0xa8,0xbb,0xbc,0x8a,0x11,
+0x34,0x13,0x11,0x05,0xb9,0x31,0xd1,0xbc,0xa9,0xac,0x51,0x81,0x29,0x26,0x90,0x28,
+0x25,0xb0,0xad,0x89,0x99,0x9b,0x09,0x20,0x65,0x13,0x81,0x98,0x80,0xa1,0xdd,0x0a,
+0x21,0xa9,0x8c,0x52,0x03,0x89,0x42,0xa0,0x89,0xd0,0xad,0x30,0xb2,0x9d,0x53,0x13,
+0x80,0x88,0x08,0xb0,0xdc,0x00,0x12,0xb8,0xae,0x28,0x26,0x81,0xa8,0xa9,0x32,0x16,
+0xba,0x3a,0x24,0xbc,0x1b,0x26,0x92,0xca,0xaa,0x09,0x18,0x21,0x35,0x83,0x9c,0x4b,
+0x20,0x10,0x10,0xbf,0x1c,0x18,0x09,0x19,0x90,0x12,0x27,0xa9,0x4a,0x22,0xb9,0x9a,
+0xd9,0x1a,0x34,0xa1,0xcb,0xfb,0x00,0x14,0x91,0x31,0x93,0xb0,0x90,0xa3,0x44,0x15,
+0xd9,0xab,0x01,0x09,0x5b,0x21,0xaa,0x0b,0x0b,0x60,0x14,0xb8,0x0a,0x09,0xc1,0xb4,
+0x92,0x05,0xd0,0x9b,0x39,0x20,0x01,0x03,0x07,0xb0,0xba,0x03,0x31,0x39,0xaf,0x09,
+0x05,0xa1,0x89,0x99,0x23,0x93,0x8d,0x58,0x1a,0x2c,0x2b,0x19,0x93,0x31,0x29,0xac,
+0xb1,0xa4,0x01,0x31,0x0b,0x1d,0x1a,0x10,0x87,0x01,0x09,0x1b,0x3b,0x99,0x99,0x9a,
+0x0b,0x30,0x39,0x5b,0x41,0x18,0xb9,0xe8,0x91,0x91,0x90,0x9a,0x09,0xb3,0xc4,0xa4,
+0x92,0x21,0x11,0x9b,0x90,0xa5,0x91,0x90,0x1b,0x01,0x12,0x5b,0x2c,0x09,0x09,0x39,
+0x32,0x29,0x19,0xb1,0x0b,0x4b,0x19,0x1a,0x00,0x99,0x29,0x90,0x91,0x13,0x49,0x5b,
+0x1a,0x0b,0x00,0x92,0xc9,0xb3,0xb3,0xb0,0x01,0x0a,0x21,0x13,0x29,0x4b,0x19,0xb9,
+0xa3,0xa3,0xa9,0x10,0x00,0xa1,0x02,0x92,0xa3,0x11,0x1b,0x0a,0xa2,0x91,0x00,0xb1,
+0xa3,0x02,0x39,0x39,0x09,0x99,0xc3,0xa1,0x20,0x3b,0x2b,0x90,0xa2,0x92,0x1a,0x91,
+0xb3,0xb3,0xa1,0xb3,0xd3,0x92,0x00,0x10,0x19,0x4a,0x2b,0x1a,0x00,0x09,0xa1,0x91,
+0x39,0x3b,0x90,0x91,0x01,0x1a,0x02,0x19,0x3b,0x3b,0x1b,0x19,0x12,0x3b,0x3b,0x1a,
+0x91,0x91,0x10,0x90,0xa1,0x11,0x29,0x1b,0x39,0x0a,0x19,0x29,0x2b,0x09,0xa1,0xb3,
+0xb3,0xb2,0x12,0x3b,0x2b,0x91,0x11,0x2a,0x3b,0x19,0x2a,0x3b,0x99,0xa0,0x93,0x11,
+0x1b,0x00,0xa2,0x01,0x19,0x09,0x01,0x91,0x90,0x20,0x2a,0x99,0x90,0x39,0x3b,0x3b,
+0x1a,0xb2,0xa3,0xa1,0xa2,0x93,0xc2,0xa2,0x12,0x90,0xd2,0xa3,0x11,0x2b,0xb9,0xb3,
+0x93,0x01,0x29,0x3b,0x1b,0xb3,0x11,0x3a,0x1a,0x91,0xb1,0xb3,0x93,0x29,0x2b,0xa9,
+0x93,0x91,0x90,0x01,0xa1,0x02,0x3a,0x1a,0x91,0x10,0x19,0x3a,0x1a,0x90,0x11,0x3b,
+0x1a,0xd3,0xb3,0xa4,0x00,0x39,0x1b,0x11,0x99,0x20,0x99,0x3a,0x39,0x1e,0x31,0xc1
+};
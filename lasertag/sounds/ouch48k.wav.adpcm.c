@@ -0,0 +1,740 @@
+// This file was generated by executing this statement: wav2c -a ouch48k.wav
+
+#include <stdint.h>
+
+const uint8_t ouch48k_wav_adpcm[11734] = {
+0xff,0xff,0x0f,0x88,0x99,0x89,0x18,0x10,0x00,0x08,0x32,0x43,0x01,0xa9,0x9b,0x28,
+0x33,0x01,0xdb,0x9a,0x10,0x53,0x44,0x34,0x15,0x82,0xa0,0x98,0xa9,0xbd,0xaf,0x9b,
+0x28,0x32,0x91,0xeb,0x0a,0x54,0x34,0x81,0xda,0xbb,0x09,0x12,0x02,0xa9,0x8b,0x30,
+0x33,0xc0,0xcb,0x18,0x63,0x10,0xcb,0x9a,0x42,0x24,0xc8,0xbc,0x29,0x57,0x23,0xa1,
+0xdb,0x9a,0x41,0x43,0x12,0xa9,0xa9,0x10,0x22,0x91,0xbb,0x89,0x24,0x03,0xd9,0x9b,
+0x31,0x35,0xa8,0xbe,0x2a,0x66,0x53,0x11,0x88,0x89,0x80,0x11,0x80,0xa9,0x90,0x13,
+0x02,0xca,0xaa,0x50,0x43,0xa0,0xbd,0x8c,0x54,0x36,0x23,0xa8,0xbe,0xab,0x19,0x31,
+0x12,0xc9,0xab,0x50,0x46,0x33,0x01,0xaa,0x9a,0x31,0x34,0xa8,0xcf,0xab,0x09,0x42,
+0x24,0x02,0x80,0x89,0x99,0x98,0x22,0x55,0x34,0x34,0x11,0xa9,0xdd,0xdb,0xaa,0x9a,
+0x88,0x90,0x98,0x00,0x44,0x35,0x12,0x01,0x88,0x00,0xa9,0xed,0xcb,0x9a,0x18,0x21,
+0x08,0x99,0x18,0xa0,0xef,0xbc,0x8b,0x40,0x34,0x23,0xa9,0xcc,0xab,0x09,0x63,0x45,
+0x32,0x91,0xdc,0xbc,0x89,0x32,0x26,0x12,0xa9,0xcb,0x99,0x18,0x21,0x32,0x43,0x12,
+0xa8,0xbd,0x9c,0x18,0x34,0x23,0x02,0x00,0x98,0xdc,0xad,0x9b,0x41,0x34,0x12,0xc8,
+0xba,0x9a,0x08,0x88,0x0a,0x72,0x34,0x13,0xca,0xbc,0x19,0x54,0x33,0x80,0xdb,0xbb,
+0xaa,0x08,0x22,0x44,0x43,0x21,0x88,0x9a,0x09,0x30,0x11,0x99,0x8c,0x19,0x13,0x02,
+0x9b,0x1f,0x29,0x21,0x00,0x8c,0x0b,0x12,0x33,0xb2,0xeb,0x99,0x43,0x34,0xd8,0xef,
+0xbc,0x9a,0x08,0x13,0x92,0xca,0x9a,0x63,0x35,0x33,0x80,0x80,0x02,0x91,0xde,0xac,
+0x0a,0x52,0x43,0x01,0xa9,0x99,0x10,0x22,0x90,0xca,0x90,0x33,0x02,0xd9,0xa9,0x31,
+0x14,0xc1,0xcb,0x28,0x35,0xa3,0xef,0xcb,0xaa,0x00,0x12,0x08,0x9a,0x88,0x12,0x01,
+0xa9,0xb9,0x13,0x14,0x99,0x9d,0x08,0x15,0x92,0xe9,0xa8,0x04,0x05,0xb0,0xbc,0x19,
+0x67,0x34,0x32,0x80,0x98,0x09,0x08,0x80,0x39,0x74,0x45,0x23,0x91,0xbb,0x9b,0x74,
+0x24,0x92,0xeb,0xbc,0x09,0x52,0x23,0xa0,0xcd,0xaa,0x18,0x34,0x02,0xc9,0xbc,0x09,
+0x52,0x23,0xb0,0xdc,0x9b,0x18,0x53,0x12,0xa0,0xdb,0x9b,0x08,0x43,0x24,0x12,0x88,
+0x9a,0x19,0x31,0x02,0xfb,0xbe,0xab,0x28,0x53,0x81,0xdd,0xbd,0x9b,0x30,0x47,0x34,
+0x32,0x81,0xb8,0xcc,0xbb,0xaa,0x18,0x22,0x24,0x02,0x90,0xba,0xba,0xab,0xba,0xbb,
+0x19,0x76,0x44,0x33,0x12,0x98,0xdb,0xba,0xab,0xbb,0x9b,0x20,0x44,0x23,0x98,0xaa,
+0x19,0x43,0x02,0xda,0xab,0x40,0x44,0x02,0x90,0x18,0x34,0x13,0xfa,0xcc,0xaa,0x99,
+0x98,0x89,0x18,0x33,0x03,0xfb,0xad,0x8a,0x18,0x88,0x08,0x53,0x36,0x12,0xba,0x9d,
+0x28,0x22,0xfa,0xcd,0x8a,0x20,0x12,0xa8,0xbc,0x18,0x44,0x02,0x88,0x60,0x45,0x13,
+0xda,0xbd,0x8a,0x31,0x24,0x81,0x88,0x21,0x03,0xfb,0xaf,0x09,0x42,0x02,0xc9,0x9c,
+0x40,0x44,0x81,0xdb,0x8a,0x52,0x82,0xff,0xbf,0xbb,0x0a,0x72,0x44,0x33,0x03,0x90,
+0xcc,0xbc,0xab,0x18,0x43,0x33,0x22,0x80,0x00,0x31,0x22,0xc8,0xdf,0xcb,0xab,0x0a,
+0x41,0x44,0x24,0x12,0x90,0xdb,0xcb,0x9a,0x09,0x22,0x34,0x33,0x01,0xb9,0xcd,0xbc,
+0x9b,0x08,0x63,0x53,0x23,0x11,0xa8,0xcb,0xbb,0x9a,0x00,0x22,0x32,0x32,0x42,0x33,
+0x22,0xa0,0xcf,0xbd,0xac,0x9b,0x09,0x30,0x34,0x35,0x33,0x23,0x12,0x90,0xdb,0xcd,
+0xbc,0xbb,0x9a,0x41,0x44,0x24,0x81,0xba,0xbe,0xab,0x0a,0x42,0x35,0x24,0x13,0x80,
+0xa9,0xaa,0xaa,0xaa,0x99,0x89,0x21,0x63,0x34,0x32,0x00,0xeb,0xcc,0xbc,0xab,0x19,
+0x53,0x35,0x24,0x01,0xb9,0xbc,0xac,0x8a,0x21,0x35,0x34,0x12,0x98,0xeb,0xdb,0xbb,
+0xab,0x8a,0x41,0x55,0x43,0x23,0x01,0xb8,0xbc,0xbc,0x9a,0x08,0x21,0x43,0x22,0x11,
+0x88,0xa9,0xcb,0xcd,0xcb,0x9a,0x28,0x54,0x35,0x33,0x13,0x91,0xca,0xbd,0xbb,0xaa,
+0xb9,0xcc,0x8d,0x08,0x28,0x77,0x23,0x00,0x00,0xb9,0xab,0xab,0xbc,0x8b,0x80,0x78,
+0x45,0x23,0x00,0x00,0xcb,0xbc,0xaa,0x89,0x28,0x44,0x34,0x23,0x81,0xa9,0xbd,0xac,
+0xab,0x99,0x10,0x43,0x53,0x23,0x23,0x02,0xb9,0xcd,0xbc,0xba,0x88,0x32,0x34,0x34,
+0x12,0x00,0xa9,0xab,0x9b,0x99,0xa9,0xca,0xab,0x30,0x47,0x24,0x12,0x80,0x9a,0xcb,
+0xbb,0x8a,0x73,0x47,0x24,0x12,0xa8,0xcc,0xbd,0xad,0x0b,0x88,0x30,0x47,0x23,0x00,
+0xaa,0xac,0x89,0x31,0x33,0x12,0xa9,0xcd,0xab,0xab,0x98,0x80,0xa9,0xcb,0x0a,0x74,
+0x45,0x24,0x03,0x80,0xb0,0xbc,0xab,0x08,0x31,0x25,0x13,0xa0,0xdd,0xbc,0xba,0x89,
+0x30,0x53,0x43,0x12,0x98,0xca,0xab,0x19,0x54,0x43,0x01,0xb9,0xbe,0xac,0x8a,0x32,
+0x45,0x32,0x80,0xca,0xbc,0x9b,0x20,0x44,0x23,0x13,0x80,0xa8,0xbb,0x9b,0x28,0x45,
+0x23,0xc8,0xbd,0x9b,0x31,0x25,0xa0,0xcf,0xad,0x80,0x08,0x73,0x43,0x00,0x00,0xc9,
+0xad,0x89,0x31,0x35,0x01,0x80,0xcc,0xbb,0x08,0x88,0x41,0x34,0x24,0x00,0xa0,0xcd,
+0xbb,0x88,0x00,0x44,0x33,0x22,0x00,0xba,0xbc,0x9b,0x08,0x22,0x82,0xfb,0xcc,0xab,
+0x08,0x48,0x45,0x24,0x12,0x00,0xa0,0xa9,0x99,0xa8,0xeb,0xdb,0xcb,0x08,0x88,0x71,
+0x43,0x33,0x00,0xb0,0xcd,0x9b,0x08,0x43,0x24,0x12,0xa8,0xcc,0xaa,0x89,0x32,0x34,
+0x33,0x11,0x01,0x98,0xfb,0xbe,0xad,0x09,0x18,0x44,0x33,0x02,0x80,0xcc,0xdb,0x9a,
+0x00,0x35,0x15,0x00,0xc9,0xac,0x19,0x52,0x13,0x80,0x80,0xad,0x8a,0x10,0x11,0x90,
+0xdb,0xbb,0x08,0x78,0x53,0x13,0x00,0xa8,0xbe,0xab,0x10,0x54,0x13,0x00,0xc8,0xbb,
+0xab,0x89,0x08,0x20,0x44,0x44,0x02,0xa0,0x9a,0x19,0x44,0x14,0x00,0xa0,0xbc,0xbb,
+0xbd,0xad,0x88,0x80,0x74,0x33,0x02,0x00,0xc0,0xcd,0x9a,0x08,0x18,0x45,0x22,0x00,
+0x08,0x00,0x08,0xca,0xcc,0xbb,0x8b,0x80,0x21,0x44,0x44,0x23,0x01,0xb8,0xdd,0xbb,
+0x0a,0x88,0x40,0x36,0x33,0x00,0x00,0xca,0xbb,0xcb,0xbb,0x0b,0x88,0x20,0x44,0x34,
+0x45,0x33,0x80,0x00,0xde,0xac,0x89,0x80,0x40,0x34,0x04,0x00,0xa0,0xbd,0xac,0x80,
+0x08,0x18,0x21,0x43,0x34,0x23,0x02,0x00,0xa9,0xcd,0xcc,0x9b,0x18,0x53,0x23,0xa1,
+0xeb,0xac,0x0a,0x88,0x42,0x35,0x34,0x08,0x90,0xbd,0xab,0x99,0x88,0x00,0x31,0x44,
+0x24,0x81,0xc9,0xbc,0xbb,0x8b,0x20,0x46,0x43,0x12,0x88,0x9a,0x20,0x44,0x23,0x08,
+0x08,0x00,0x00,0xfe,0xbf,0x8a,0x80,0x48,0x34,0x12,0x80,0x80,0xdc,0xbc,0x08,0x88,
+0x45,0x13,0x98,0xbc,0x8a,0x41,0x34,0x00,0x08,0xbe,0x9c,0x00,0x43,0x23,0x00,0xca,
+0xbc,0x9a,0x00,0x53,0x24,0x12,0x90,0xdb,0xac,0x8a,0x30,0x45,0x13,0x00,0xc9,0xad,
+0x9a,0x00,0x22,0x32,0x81,0xa8,0xbb,0x8b,0x51,0x45,0x43,0x02,0x80,0xeb,0xbb,0x9c,
+0x09,0x21,0x13,0xa0,0xdc,0xab,0x10,0x64,0x43,0x22,0x01,0xa9,0xbd,0xbc,0x9a,0x31,
+0x54,0x23,0x12,0x88,0x99,0xa9,0xbc,0xbd,0xbc,0x8a,0x18,0x53,0x44,0x33,0x13,0x90,
+0xdd,0xac,0x9a,0x20,0x34,0x25,0x01,0xa9,0xdb,0xab,0x08,0x41,0x24,0x12,0xb8,0xdb,
+0x9b,0x18,0x43,0x33,0x82,0xda,0xcc,0xaa,0x20,0x64,0x33,0x81,0x00,0xdc,0xcb,0x8a,
+0x08,0x32,0x34,0x22,0x80,0xb9,0x9a,0x8a,0x10,0x11,0x01,0x00,0xa8,0xcd,0xac,0x09,
+0x64,0x34,0x23,0xb9,0xce,0xcb,0x99,0x11,0x43,0x32,0x01,0xb9,0xbb,0x09,0x73,0x33,
+0x91,0xeb,0xbc,0xaa,0x88,0x21,0x34,0x45,0x33,0x13,0x00,0x08,0x42,0x00,0x08,0xff,
+0xaf,0x0a,0x88,0x20,0x33,0x33,0x23,0x01,0xba,0xcf,0xbb,0x8b,0x30,0x35,0x23,0x80,
+0x9a,0x09,0x52,0x33,0x01,0xca,0xbb,0x1a,0x53,0x23,0xd9,0xcf,0xcb,0x8a,0x00,0x53,
+0x34,0x23,0x80,0xca,0xbc,0xaa,0x10,0x43,0x23,0x81,0xb9,0xab,0x19,0x32,0x24,0x91,
+0xec,0xbc,0xab,0x28,0x64,0x34,0x22,0x90,0xda,0xbb,0xab,0x19,0x22,0x34,0x22,0x80,
+0xa9,0xcb,0xaa,0x8a,0x08,0x21,0x43,0x53,0x34,0x23,0x13,0x98,0xdc,0xcb,0xbb,0x09,
+0x43,0x25,0x02,0xfb,0xcd,0xbb,0x8a,0x51,0x54,0x33,0x12,0x90,0xcb,0xbb,0xaa,0x18,
+0x11,0x02,0x80,0x99,0x18,0x53,0x33,0xb0,0xdf,0xcc,0xaa,0x18,0x44,0x44,0x22,0x00,
+0xba,0xcc,0xab,0x8a,0x21,0x34,0x34,0x11,0xa8,0xbc,0xac,0x89,0x30,0x34,0x13,0xb8,
+0xde,0xab,0x0a,0x62,0x35,0x33,0x01,0xb9,0xcd,0xaa,0x89,0x80,0x00,0x90,0x98,0x10,
+0x63,0x43,0x23,0x80,0xeb,0xcb,0xaa,0x18,0x53,0x34,0x23,0x12,0xa9,0xdc,0xcb,0x9b,
+0x89,0x21,0x43,0x22,0x22,0x11,0xb8,0xcf,0xcd,0xaa,0x19,0x63,0x44,0x32,0x81,0xb9,
+0xcd,0xba,0x99,0x21,0x53,0x33,0x23,0x01,0xb8,0xec,0xcb,0x9a,0x20,0x45,0x24,0x02,
+0xc8,0xdc,0xbb,0x08,0x88,0x54,0x33,0x83,0x90,0xbc,0xac,0x0a,0x20,0x22,0x01,0xa8,
+0x8a,0x50,0x54,0x33,0x02,0xca,0xad,0x8b,0x18,0x12,0xa0,0xed,0xcb,0x88,0x10,0x45,
+0x24,0x02,0x98,0xdb,0xab,0x8a,0x32,0x34,0x23,0x90,0xbb,0xad,0x89,0x20,0x21,0x81,
+0xba,0xad,0x8a,0x51,0x45,0x33,0x03,0xa9,0xbe,0xcb,0x9a,0x18,0x21,0x33,0x33,0x12,
+0x88,0xdb,0xdb,0xab,0x8a,0x31,0x55,0x33,0x12,0x90,0xba,0xac,0x99,0x10,0x11,0x11,
+0x98,0x88,0x20,0xa0,0xff,0xcf,0xbb,0x9b,0x30,0x47,0x43,0x12,0x81,0xa9,0xaa,0x89,
+0x00,0x88,0xca,0xcb,0x9a,0x21,0x34,0x02,0xda,0xbc,0x9a,0x42,0x44,0x12,0x98,0xaa,
+0x08,0x44,0x24,0xa0,0xdd,0xbc,0x8b,0x31,0x37,0x24,0x82,0xc9,0xcc,0xab,0x8a,0x10,
+0x44,0x34,0x23,0x82,0xb9,0xcc,0xab,0x8a,0x18,0x12,0x02,0x81,0x88,0x88,0xa9,0xca,
+0xcb,0x99,0x62,0x55,0x43,0x13,0x91,0xcb,0xbc,0x9b,0x18,0x43,0x34,0x12,0xb8,0xcf,
+0xcc,0xab,0x89,0x41,0x53,0x33,0x13,0x81,0xa9,0xba,0xab,0x09,0x00,0x01,0x00,0x21,
+0x36,0x24,0x80,0x89,0x72,0x37,0x13,0xf9,0xcd,0xbc,0x08,0x88,0x54,0x43,0x01,0x80,
+0xb0,0xad,0x9b,0x89,0x10,0x23,0x23,0x13,0x22,0x22,0x02,0xd9,0xdd,0xcb,0x9a,0x28,
+0x53,0x33,0x80,0xeb,0xcb,0x8a,0x41,0x44,0x23,0x82,0xca,0xbc,0xab,0x08,0x32,0x34,
+0x12,0x98,0xab,0x9a,0x31,0x35,0x13,0xb8,0xbe,0xab,0x30,0x37,0x12,0xe9,0xcd,0xbb,
+0x09,0x61,0x43,0x33,0x81,0xb9,0xbc,0x9b,0x09,0x21,0x23,0x01,0xba,0xad,0x89,0x53,
+0x35,0x14,0x80,0xcb,0xbc,0xaa,0x28,0x43,0x34,0x02,0xb8,0xcd,0xbb,0xaa,0x10,0x52,
+0x43,0x23,0x13,0x81,0xba,0xbd,0xbb,0x9b,0x10,0x32,0x33,0x33,0x43,0x43,0x22,0x81,
+0xda,0xdb,0xba,0xbc,0xce,0xdc,0xba,0x89,0x62,0x35,0x34,0x11,0x99,0xbc,0xaa,0x18,
+0x52,0x32,0x01,0xb9,0xcc,0xac,0x9a,0x08,0x10,0x32,0x42,0x23,0x12,0xb8,0xdd,0xbb,
+0x8a,0x51,0x34,0x24,0x11,0x80,0x98,0xa9,0xdc,0xbd,0xbc,0x8a,0x28,0x53,0x33,0x13,
+0x80,0x21,0x55,0x34,0x03,0xea,0xcd,0xab,0x8a,0x30,0x43,0x24,0x02,0x80,0xba,0xdb,
+0xab,0x99,0x20,0x53,0x33,0x24,0x33,0x32,0x22,0x90,0xfb,0xdd,0xdb,0xaa,0x8a,0x28,
+0x22,0x43,0x32,0x53,0x32,0x11,0xb9,0xbd,0xbb,0x9a,0x08,0x10,0x43,0x34,0x13,0x08,
+0x73,0x57,0x33,0x00,0xf9,0xcc,0xba,0x89,0x08,0x31,0x44,0x43,0x13,0x80,0xcc,0xbb,
+0xab,0x00,0x22,0x22,0x42,0x53,0x34,0x12,0xa8,0xcc,0xac,0xab,0xa9,0xba,0xba,0x89,
+0x63,0x55,0x43,0x23,0x01,0xb9,0xbd,0xac,0x8a,0x00,0x32,0x32,0x11,0x80,0x88,0x08,
+0x01,0x90,0xcd,0xbd,0x9c,0x29,0x73,0x34,0x33,0x91,0xfb,0xbc,0x9c,0x09,0x31,0x35,
+0x33,0x81,0xa9,0xcc,0xaa,0x89,0x10,0x21,0x22,0x21,0x21,0x53,0x23,0x01,0xeb,0xbd,
+0xac,0x8a,0x28,0x42,0x22,0x81,0xca,0xac,0x8a,0x32,0x37,0x23,0x81,0xb9,0xbc,0xab,
+0x88,0x21,0x23,0x02,0xa9,0xaa,0x40,0x57,0x43,0x13,0x90,0xdc,0xcb,0xab,0x99,0x88,
+0x98,0xbb,0xac,0x18,0x57,0x45,0x23,0x12,0xa8,0xcc,0xac,0x99,0x18,0x11,0x12,0x10,
+0x00,0x32,0x44,0x34,0x13,0xa0,0xed,0xcc,0xdb,0xaa,0x89,0x31,0x36,0x24,0x13,0x81,
+0xa8,0xaa,0x9b,0x9a,0x9a,0xab,0xaa,0x20,0x55,0x24,0x12,0xa8,0xbc,0xaa,0x20,0x22,
+0xb1,0xcf,0xcb,0x08,0x62,0x34,0x32,0x11,0xa8,0xca,0xcc,0xbb,0xbb,0x9b,0x19,0x52,
+0x45,0x25,0x33,0x02,0xa8,0xcc,0xbc,0xba,0xaa,0x08,0x42,0x34,0x24,0x12,0x00,0x88,
+0x88,0x98,0xeb,0xcc,0xcb,0xaa,0x09,0x42,0x44,0x33,0x22,0x10,0x00,0x21,0x13,0xb8,
+0xff,0xbc,0xbd,0xbb,0x08,0x60,0x44,0x33,0x12,0x90,0xba,0xbc,0xbb,0x99,0x10,0x34,
+0x24,0x01,0x18,0x54,0x35,0x03,0xe8,0xcd,0xac,0x88,0x80,0x41,0x33,0x33,0x12,0x90,
+0xdc,0xcb,0x99,0x10,0x32,0x11,0x99,0x9a,0x30,0x46,0x33,0x82,0xda,0xbd,0xbc,0x9b,
+0x19,0x31,0x34,0x43,0x22,0x22,0x22,0x81,0xb9,0xcd,0xac,0xab,0x8a,0x18,0x33,0x23,
+0x01,0xcb,0xbb,0x29,0x66,0x44,0x22,0xa0,0xec,0xdb,0xaa,0x08,0x42,0x44,0x23,0x01,
+0xb9,0xdb,0xab,0x89,0x11,0x33,0x13,0x80,0xa9,0x28,0x73,0x43,0x01,0xca,0xce,0xac,
+0xab,0x08,0x32,0x35,0x34,0x23,0x11,0x80,0xa9,0xdb,0xac,0xbb,0x9a,0x08,0x32,0x34,
+0x32,0x11,0x90,0x98,0x88,0xa8,0xdd,0xcd,0xaa,0x18,0x44,0x25,0x13,0x98,0xba,0xab,
+0x09,0x22,0x03,0xd9,0xbd,0x8b,0x72,0x36,0x25,0x12,0x98,0xcd,0xbc,0xcb,0xaa,0x80,
+0x38,0x54,0x43,0x22,0x12,0x00,0x99,0xaa,0xaa,0xac,0xcb,0xab,0xab,0x10,0x55,0x44,
+0x13,0x90,0xdc,0xcc,0xaa,0x08,0x43,0x35,0x23,0x01,0xa9,0xac,0x9a,0x18,0x01,0x90,
+0xeb,0xbc,0x8b,0x30,0x46,0x43,0x01,0x98,0xcb,0xab,0x8a,0x20,0x32,0x23,0x00,0x88,
+0x28,0x63,0x43,0x02,0xc9,0xcd,0xbc,0xbb,0x88,0x42,0x35,0x24,0x12,0x88,0xba,0xcb,
+0xbb,0xbb,0x99,0x28,0x63,0x44,0x43,0x33,0x23,0x98,0xce,0xbd,0xcb,0x99,0x10,0x53,
+0x43,0x12,0x81,0xa8,0xa9,0x99,0x88,0xb9,0xdd,0xcb,0x99,0x41,0x54,0x33,0x12,0x98,
+0xbc,0xbc,0x9a,0x18,0x21,0x12,0x11,0x52,0x55,0x43,0x02,0xca,0xbe,0xbc,0xab,0x08,
+0x21,0x35,0x34,0x23,0x82,0x98,0x9a,0x09,0x88,0xca,0xcd,0xbb,0x19,0x54,0x35,0x23,
+0xa8,0xce,0xbc,0x0b,0x88,0x51,0x34,0x12,0x90,0xca,0x9a,0x10,0x43,0x33,0xa1,0xdc,
+0xbc,0x8a,0x30,0x45,0x22,0x80,0xca,0xbc,0x9a,0x19,0x31,0x33,0x12,0x90,0x8a,0x30,
+0x47,0x24,0x03,0xa8,0xcd,0xbb,0xbb,0x89,0x11,0x21,0x23,0x32,0x22,0x12,0x90,0xca,
+0xbd,0xbb,0x18,0x64,0x43,0x23,0x00,0x99,0x08,0x31,0x12,0xc8,0xcc,0xab,0x99,0xfb,
+0xef,0xcb,0xab,0x08,0x70,0x53,0x32,0x11,0xa8,0xaa,0x9b,0x18,0x43,0x12,0xb8,0xcf,
+0xab,0x8a,0x41,0x43,0x22,0x98,0xca,0xbb,0x89,0x30,0x33,0x12,0x98,0x89,0x73,0x36,
+0x34,0x01,0xc9,0xcc,0xaa,0x8a,0x10,0x00,0xa8,0xcb,0x8a,0x52,0x55,0x32,0x01,0xb9,
+0xcc,0x9a,0x28,0x43,0x13,0xc8,0xdc,0xab,0x09,0x53,0x44,0x12,0x98,0xb9,0x9a,0x28,
+0x44,0x12,0xc9,0xce,0xcb,0x9a,0x18,0x53,0x43,0x12,0x08,0x89,0x18,0x42,0x43,0x81,
+0xda,0xbd,0xac,0x8a,0x10,0x33,0x22,0x98,0xca,0xaa,0x20,0x45,0x34,0x22,0x80,0x9a,
+0xaa,0x88,0x01,0xa8,0xde,0xcc,0xaa,0x89,0x42,0x34,0x33,0x01,0xa9,0xbc,0xbb,0x89,
+0x31,0x32,0x11,0x99,0x1a,0x64,0x36,0x34,0x12,0xa8,0xdb,0xcb,0x9a,0x89,0x98,0xcb,
+0xbd,0xbc,0x99,0x20,0x33,0x35,0x43,0x44,0x33,0x25,0x33,0x12,0x90,0xdc,0xcc,0xcb,
+0xaa,0x9a,0x88,0x21,0x43,0x33,0x81,0xca,0xbc,0x9b,0x28,0x63,0x34,0x34,0x33,0x13,
+0x11,0x22,0x33,0xa1,0xff,0xad,0x89,0x42,0x34,0x91,0xec,0xbc,0x8c,0x08,0x38,0x44,
+0x23,0x12,0x98,0xbc,0x9a,0x30,0x46,0x22,0xa8,0xcd,0xbb,0x09,0x41,0x34,0x22,0x98,
+0xcc,0xcb,0xaa,0x18,0x32,0x24,0x12,0x88,0x88,0x30,0x45,0x24,0x13,0x80,0xeb,0xbc,
+0xbb,0x9b,0x00,0x11,0x80,0xcb,0xac,0x18,0x54,0x35,0x24,0x12,0x88,0xaa,0xaa,0x88,
+0x01,0xa0,0xcd,0xbd,0x9c,0x89,0x22,0x34,0x23,0x80,0xba,0xac,0x08,0x44,0x44,0x12,
+0x88,0xaa,0x9b,0x20,0x44,0x23,0xa8,0xde,0xac,0xab,0x09,0x32,0x34,0x13,0x90,0xca,
+0xbb,0x09,0x31,0x35,0x23,0x81,0x99,0x18,0x55,0x44,0x33,0x02,0xc9,0xcc,0xbb,0x89,
+0x20,0x02,0xe9,0xde,0xcb,0x9b,0x18,0x53,0x35,0x32,0x11,0x08,0x08,0x31,0x34,0x03,
+0xea,0xce,0xcb,0xaa,0x89,0x21,0x22,0x11,0x81,0x20,0x52,0x35,0x24,0x12,0x98,0xdb,
+0xbb,0xab,0x9a,0x99,0xa9,0xcb,0x9a,0x20,0x64,0x53,0x23,0x33,0x33,0x22,0x80,0xeb,
+0xcd,0xbc,0xbb,0xaa,0x88,0x11,0x21,0x42,0x44,0x45,0x43,0x23,0x02,0x98,0xca,0xba,
+0x9a,0xaa,0xdc,0xcd,0xbb,0x9c,0x09,0x32,0x44,0x23,0x22,0x21,0x33,0x45,0x32,0x01,
+0xc9,0xbd,0xbc,0xab,0x8a,0x80,0x81,0x90,0x88,0x21,0x44,0x34,0x12,0x80,0x99,0x09,
+0x32,0x24,0x91,0xca,0x9b,0x50,0x55,0x23,0x91,0xea,0xbc,0xaa,0x08,0x00,0xc8,0xdd,
+0xcb,0x9b,0x18,0x53,0x43,0x32,0x12,0x33,0x54,0x33,0x22,0xa0,0xec,0xcb,0xbb,0x9a,
+0x99,0x99,0xaa,0xab,0x9a,0x30,0x46,0x34,0x34,0x32,0x33,0x33,0x33,0x24,0x12,0x90,
+0xba,0xce,0xbc,0xcc,0xbb,0xac,0xaa,0x9a,0x98,0x88,0x88,0x31,0x56,0x44,0x43,0x33,
+0x24,0x22,0x12,0x88,0xcb,0xcd,0xbc,0xba,0x9a,0x9a,0xba,0xdb,0x9b,0x19,0x64,0x34,
+0x43,0x11,0x00,0x00,0x31,0x44,0x12,0xa8,0xce,0xbc,0xba,0x89,0x08,0x80,0x99,0xaa,
+0x28,0x55,0x35,0x33,0x11,0x80,0x89,0x20,0x32,0x81,0xee,0xcc,0xcb,0x99,0x10,0x21,
+0x12,0x90,0x89,0x40,0x65,0x53,0x33,0x22,0x01,0xb9,0xdc,0xdb,0xbb,0xcb,0xba,0xaa,
+0x9a,0x08,0x41,0x55,0x44,0x33,0x24,0x12,0x80,0x88,0x99,0x99,0xca,0xcc,0xdb,0xab,
+0xab,0x99,0x98,0x98,0x99,0x18,0x54,0x45,0x34,0x33,0x23,0x21,0x20,0x10,0x90,0xda,
+0xcc,0xac,0xaa,0x89,0xa9,0xcc,0xdc,0xba,0x8a,0x20,0x44,0x33,0x12,0x00,0x21,0x64,
+0x34,0x24,0x02,0xb8,0xdb,0xba,0x89,0x08,0x98,0xdc,0xcc,0xba,0x8a,0x10,0x32,0x23,
+0x12,0x22,0x54,0x54,0x33,0x33,0x81,0xa9,0xcb,0xab,0xab,0xbc,0xdc,0xbb,0xac,0x89,
+0x10,0x23,0x11,0x88,0x08,0x73,0x54,0x33,0x23,0x81,0xa8,0x89,0x20,0x43,0x02,0xfb,
+0xbd,0xbb,0x09,0x42,0x23,0xb0,0xdf,0xcb,0xaa,0x18,0x31,0x22,0x90,0x9a,0x48,0x57,
+0x44,0x33,0x11,0x98,0xba,0xaa,0x18,0x11,0xb8,0xdf,0xcc,0xbb,0x9a,0x08,0x21,0x11,
+0x01,0x10,0x63,0x45,0x53,0x22,0x12,0x88,0x99,0x9a,0x9a,0xaa,0xcc,0xdc,0xbb,0xbb,
+0x9a,0x10,0x22,0x12,0x12,0x42,0x54,0x35,0x34,0x23,0x01,0x98,0xaa,0xaa,0x99,0xca,
+0xcd,0xbd,0xbc,0x9a,0x08,0x22,0x32,0x11,0x10,0x21,0x46,0x34,0x23,0x02,0xa9,0xbb,
+0x89,0x42,0x34,0x81,0xeb,0xbc,0xac,0x88,0x10,0x81,0xca,0xbd,0xac,0x89,0x20,0x33,
+0x11,0x80,0x20,0x56,0x44,0x33,0x12,0x88,0x99,0x10,0x43,0x23,0x90,0xce,0xbc,0xab,
+0x9a,0xa9,0xed,0xcc,0xbc,0xaa,0x08,0x31,0x33,0x33,0x43,0x45,0x44,0x43,0x23,0x12,
+0x00,0x08,0x18,0x32,0x13,0xfa,0xce,0xcd,0xbb,0xab,0x8a,0x18,0x00,0xa8,0xaa,0x18,
+0x75,0x44,0x34,0x23,0x01,0x90,0x08,0x11,0x43,0x22,0xa8,0xcf,0xbc,0xbc,0xaa,0x9a,
+0x98,0x98,0x9a,0x99,0x30,0x65,0x53,0x24,0x23,0x13,0x01,0x01,0x10,0x01,0x80,0xeb,
+0xcd,0xcb,0xab,0x9a,0x99,0x99,0xba,0xba,0x19,0x64,0x44,0x24,0x22,0x12,0x20,0x21,
+0x33,0x23,0xa0,0xdd,0xbd,0xbb,0xaa,0x9a,0xaa,0xda,0xbb,0xab,0x19,0x44,0x35,0x43,
+0x21,0x11,0x32,0x44,0x34,0x22,0x91,0xba,0xbd,0xab,0x89,0x80,0xca,0xbf,0xbd,0xac,
+0x99,0x00,0x12,0x00,0x88,0x00,0x73,0x54,0x43,0x23,0x12,0x81,0x80,0x00,0x01,0x90,
+0xfb,0xdc,0xbb,0xbb,0x9a,0x99,0xa8,0xdb,0xab,0x89,0x73,0x34,0x34,0x13,0x12,0x20,
+0x32,0x45,0x22,0x81,0xca,0xcc,0xab,0x9a,0x98,0xa9,0xdc,0xbc,0xbb,0x89,0x20,0x24,
+0x23,0x01,0x10,0x63,0x45,0x24,0x23,0x00,0x88,0x88,0x20,0x32,0x81,0xeb,0xbd,0xad,
+0xab,0xaa,0xdb,0xdb,0xbb,0xab,0x09,0x21,0x23,0x24,0x44,0x45,0x44,0x33,0x33,0x12,
+0x80,0x00,0x00,0x80,0xeb,0xdd,0xcb,0xbb,0xab,0xa9,0xaa,0xca,0xba,0x89,0x52,0x54,
+0x43,0x33,0x33,0x24,0x43,0x32,0x22,0x80,0xba,0xbe,0xbc,0xcb,0xcb,0xbb,0xbc,0xab,
+0x9a,0x08,0x21,0x34,0x34,0x34,0x34,0x34,0x25,0x33,0x22,0x00,0x99,0xba,0xbb,0xcc,
+0xdb,0xcb,0xbb,0xac,0x99,0x99,0x99,0xa9,0x9a,0x20,0x55,0x34,0x22,0x81,0x89,0x30,
+0x66,0x34,0x23,0x02,0x99,0x09,0x51,0x34,0x23,0xa8,0xde,0xcb,0xaa,0x9a,0xa9,0xda,
+0xbc,0xbc,0x9a,0x19,0x32,0x35,0x34,0x34,0x34,0x44,0x32,0x23,0x23,0x11,0x98,0xdb,
+0xbd,0xcc,0xba,0xbb,0xcb,0xcb,0xbb,0xaa,0x89,0x41,0x44,0x43,0x32,0x32,0x43,0x34,
+0x35,0x23,0x12,0x98,0xdb,0xcb,0xab,0xcb,0xcb,0xdb,0xcb,0xaa,0x99,0x20,0x32,0x34,
+0x33,0x53,0x44,0x34,0x34,0x22,0x81,0xa8,0xcb,0xaa,0xab,0xbc,0xce,0xdb,0xab,0xaa,
+0x18,0x21,0x33,0x23,0x22,0x63,0x54,0x53,0x32,0x12,0x80,0x98,0x89,0x88,0x98,0xec,
+0xbc,0xbd,0xaa,0x8a,0x88,0x90,0xa9,0x9a,0x38,0x57,0x34,0x33,0x13,0x80,0x00,0x41,
+0x43,0x12,0xc9,0xcd,0xbc,0x9a,0x09,0x00,0xa9,0xcc,0xac,0x89,0x42,0x35,0x33,0x01,
+0x98,0x09,0x52,0x44,0x23,0xa0,0xdc,0xcb,0x9a,0x08,0x11,0x88,0xcc,0xbc,0x8a,0x30,
+0x36,0x24,0x11,0x80,0x18,0x63,0x34,0x14,0x91,0xda,0xcb,0x9a,0x08,0x08,0xca,0xdd,
+0xbb,0x9a,0x21,0x44,0x32,0x00,0x98,0x18,0x73,0x35,0x24,0x11,0x99,0xaa,0x9a,0x11,
+0x11,0xb8,0xdf,0xcb,0xaa,0x09,0x10,0x01,0x99,0xcb,0x8a,0x51,0x54,0x33,0x22,0x80,
+0x99,0x18,0x53,0x43,0x01,0xc9,0xbd,0xbb,0x8a,0x08,0x80,0xcb,0xbe,0xab,0x09,0x53,
+0x34,0x22,0x00,0x88,0x20,0x54,0x34,0x12,0xa0,0xdb,0xbb,0x9a,0x08,0x98,0xfb,0xdb,
+0xab,0x89,0x21,0x34,0x23,0x11,0x11,0x54,0x54,0x33,0x23,0x80,0xb9,0xcb,0xbb,0xaa,
+0xcc,0xdc,0xdb,0xab,0xaa,0x88,0x22,0x33,0x22,0x22,0x62,0x54,0x34,0x34,0x23,0x01,
+0x88,0x88,0x08,0x01,0xa8,0xed,0xbc,0xad,0xab,0x99,0x89,0x99,0xba,0xab,0x9a,0x52,
+0x54,0x43,0x23,0x13,0x23,0x43,0x53,0x23,0x22,0x80,0xba,0xbd,0xcb,0xab,0xcb,0xcb,
+0xbc,0xbc,0xab,0x9a,0x10,0x22,0x33,0x01,0x88,0x30,0x57,0x44,0x43,0x11,0x98,0xba,
+0x9a,0x20,0x34,0x82,0xec,0xbd,0xab,0x09,0x32,0x24,0x80,0xcb,0xaa,0x61,0x45,0x34,
+0x12,0xa8,0xcb,0x9c,0x08,0x22,0x81,0xfc,0xcc,0xbb,0x9a,0x11,0x33,0x12,0x98,0xbb,
+0x39,0x77,0x34,0x33,0x11,0x90,0x88,0x41,0x44,0x23,0x81,0xeb,0xcb,0xab,0x99,0x00,
+0xa8,0xec,0xdb,0xaa,0x89,0x31,0x33,0x23,0x88,0x99,0x30,0x66,0x43,0x33,0x11,0x98,
+0x9a,0x08,0x32,0x23,0xc9,0xde,0xcb,0xab,0x99,0x00,0x81,0xb9,0xcc,0x9b,0x19,0x63,
+0x43,0x12,0x81,0x98,0x19,0x42,0x35,0x14,0x91,0xca,0xcb,0xaa,0x00,0x32,0x81,0xea,
+0xbc,0xac,0x18,0x43,0x35,0x22,0x11,0x08,0x10,0x32,0x25,0x13,0xb8,0xcf,0xcc,0xbb,
+0xaa,0x9a,0x99,0xba,0xcc,0xbc,0x99,0x41,0x36,0x35,0x33,0x23,0x32,0x53,0x44,0x33,
+0x22,0x80,0xca,0xbb,0xbb,0x99,0xba,0xdd,0xdc,0xbb,0xbb,0x9a,0x89,0x89,0xaa,0xaa,
+0x09,0x73,0x44,0x24,0x23,0x12,0x21,0x32,0x45,0x33,0x22,0x80,0xb9,0xba,0x99,0x88,
+0xd9,0xdd,0xcc,0xbb,0xbb,0x8a,0x89,0x99,0xba,0xac,0x09,0x42,0x35,0x34,0x22,0x01,
+0x21,0x44,0x34,0x24,0x02,0x98,0xaa,0x9a,0x18,0x11,0xb9,0xcf,0xcb,0x99,0x31,0x56,
+0x43,0x23,0x13,0x80,0xaa,0x09,0x53,0x35,0x02,0xfb,0xbe,0xbc,0xaa,0x88,0x80,0xb9,
+0xce,0xac,0x9a,0x20,0x45,0x23,0x12,0x00,0x18,0x63,0x54,0x23,0x13,0x80,0x99,0x99,
+0x11,0x23,0x91,0xec,0xbd,0xac,0x9a,0x89,0x98,0xc9,0xcc,0xbb,0x9b,0x00,0x33,0x24,
+0x01,0x88,0x20,0x55,0x44,0x33,0x22,0x11,0x80,0x11,0x33,0x34,0x82,0xea,0xcc,0xab,
+0xaa,0x88,0x99,0xeb,0xdb,0xbb,0x8a,0x08,0x21,0x02,0x90,0xa9,0x30,0x56,0x44,0x22,
+0x02,0x90,0x88,0x20,0x33,0x14,0xa0,0xdd,0xcb,0x9b,0x08,0x32,0x24,0x00,0x99,0x29,
+0x67,0x44,0x24,0x12,0x98,0xaa,0x0a,0x51,0x34,0x12,0xeb,0xbd,0xbc,0x99,0x20,0x11,
+0xc9,0xdd,0xcb,0x9a,0x10,0x33,0x24,0x81,0xb9,0x8a,0x51,0x55,0x33,0x23,0x80,0xa9,
+0x08,0x42,0x35,0x23,0xa8,0xcc,0xcb,0x99,0x11,0x11,0xa0,0xdd,0xbc,0xab,0x89,0x10,
+0x02,0xa8,0xdc,0xab,0x0a,0x42,0x44,0x12,0x91,0x99,0x8a,0x41,0x54,0x32,0x12,0x88,
+0x99,0x08,0x53,0x43,0x11,0xb9,0xcc,0xbb,0x09,0x11,0x01,0xd9,0xcd,0xac,0x9a,0x88,
+0x11,0x80,0xb9,0xad,0x8b,0x30,0x45,0x33,0x11,0x98,0x89,0x20,0x35,0x34,0x01,0xa9,
+0xab,0x19,0x56,0x34,0x33,0x12,0x32,0x64,0x34,0x34,0x01,0x98,0x9a,0x31,0x57,0x23,
+0x82,0xea,0xbc,0xac,0x89,0x11,0x12,0xc9,0xde,0xbc,0xaa,0x08,0x22,0x22,0xb8,0xdd,
+0xab,0x08,0x73,0x43,0x22,0x01,0x99,0x99,0x21,0x46,0x33,0x13,0x98,0xcb,0x9a,0x21,
+0x44,0x23,0xa8,0xcd,0xbc,0x9b,0x09,0x10,0x98,0xdc,0xbc,0xbb,0x8a,0x21,0x22,0x01,
+0xba,0xac,0x19,0x64,0x34,0x33,0x11,0x98,0x98,0x20,0x45,0x33,0x13,0x98,0xab,0x8b,
+0x40,0x44,0x23,0x80,0xba,0xac,0x09,0x32,0x25,0x80,0xdc,0xcc,0xab,0x9a,0x89,0xa9,
+0xcc,0xcc,0xba,0xaa,0x89,0x00,0x00,0x01,0x11,0x53,0x54,0x34,0x35,0x34,0x44,0x43,
+0x24,0x23,0x11,0x80,0x10,0x42,0x44,0x22,0x91,0xeb,0xbc,0xbb,0x99,0x11,0x11,0xc9,
+0xcf,0xcb,0xab,0x8a,0x00,0x80,0xca,0xcd,0xbb,0x9a,0x21,0x44,0x33,0x12,0x88,0x08,
+0x53,0x45,0x43,0x13,0x02,0x08,0x08,0x42,0x53,0x23,0x81,0xba,0xbd,0xac,0x99,0x08,
+0x98,0xea,0xbd,0xad,0xbb,0x9a,0x88,0x99,0xda,0xdb,0xba,0x89,0x31,0x44,0x24,0x11,
+0x88,0x88,0x10,0x45,0x44,0x22,0x02,0x88,0x99,0x00,0x43,0x43,0x02,0xb8,0xbd,0xab,
+0x50,0x46,0x34,0x23,0xa0,0xcb,0x9b,0x38,0x55,0x23,0x81,0xfb,0xcb,0xaa,0x08,0x32,
+0x23,0xd8,0xce,0xbc,0x9a,0x18,0x32,0x23,0xa8,0xce,0xac,0x09,0x30,0x35,0x24,0x01,
+0x99,0x9a,0x20,0x46,0x34,0x23,0x01,0xb9,0xaa,0x20,0x45,0x24,0x02,0xb8,0xdb,0xab,
+0x88,0x21,0x23,0xa0,0xec,0xcc,0xaa,0x9a,0x08,0x88,0xb9,0xdd,0xbb,0xaa,0x09,0x21,
+0x23,0x11,0x98,0x89,0x41,0x45,0x34,0x33,0x12,0x80,0x00,0x32,0x46,0x43,0x22,0x01,
+0x98,0x88,0x31,0x35,0x35,0x12,0x80,0xca,0xbb,0xaa,0x89,0xa9,0xec,0xcc,0xbc,0xbb,
+0xab,0xaa,0x99,0xaa,0xcc,0xbc,0x9c,0x89,0x42,0x54,0x33,0x34,0x23,0x33,0x43,0x44,
+0x53,0x43,0x22,0x02,0x88,0x9a,0x18,0x52,0x34,0x12,0xd9,0xdc,0xcb,0x9a,0x18,0x22,
+0x23,0xa8,0xcf,0xbc,0xbb,0x8a,0x18,0x01,0xb8,0xde,0xcb,0x9a,0x18,0x42,0x34,0x12,
+0x80,0xa9,0x89,0x51,0x54,0x43,0x22,0x11,0x88,0x98,0x08,0x10,0x32,0x12,0x82,0xc9,
+0xdd,0xdb,0xbb,0xab,0x89,0x10,0x00,0xb9,0xcf,0xcb,0x9b,0x19,0x52,0x34,0x22,0x98,
+0xcc,0xbc,0x8a,0x20,0x44,0x33,0x01,0xcb,0xbd,0xab,0x28,0x54,0x34,0x23,0x81,0xa8,
+0x8a,0x50,0x45,0x35,0x33,0x12,0x90,0xba,0xab,0x99,0x11,0x22,0xa8,0xef,0xbc,0xad,
+0xab,0x89,0x88,0x80,0xb9,0xcc,0xcb,0x9a,0x09,0x22,0x43,0x12,0x80,0x99,0x9b,0x08,
+0x63,0x53,0x33,0x12,0x80,0xba,0xbc,0x8a,0x42,0x45,0x34,0x43,0x22,0x33,0x43,0x34,
+0x34,0x33,0x24,0x11,0x08,0x99,0x99,0x89,0xa9,0xdc,0xcc,0xbc,0xbc,0xbb,0xbd,0xbc,
+0xcb,0x9a,0x18,0x11,0x81,0xca,0xbd,0x9b,0x52,0x46,0x43,0x13,0x02,0x00,0x20,0x54,
+0x35,0x34,0x23,0x01,0x99,0x8a,0x20,0x35,0x25,0x81,0xdb,0xdc,0xbb,0xab,0xaa,0x99,
+0xa9,0xcc,0xbc,0xbd,0xba,0x9a,0x89,0x00,0x11,0x12,0x33,0x34,0x44,0x43,0x33,0x34,
+0x24,0x33,0x24,0x23,0x12,0x11,0x80,0x90,0x98,0x9a,0xbb,0xab,0x9a,0x88,0xaa,0xde,
+0xcb,0x9b,0x30,0x55,0x24,0x02,0xb8,0xdc,0xbb,0xab,0xab,0xca,0xcb,0xbc,0xcc,0xcb,
+0xdb,0xbc,0xdb,0xba,0xaa,0x99,0x88,0x00,0x10,0x11,0x22,0x44,0x44,0x53,0x33,0x34,
+0x35,0x44,0x43,0x23,0x33,0x22,0x11,0x11,0x32,0x36,0x35,0x24,0x13,0x00,0x9a,0xab,
+0x8a,0x08,0x98,0xfb,0xbe,0xbd,0xcb,0xba,0xaa,0xba,0xcb,0xbc,0xbc,0xbb,0xbb,0xba,
+0xaa,0xaa,0xaa,0x89,0x30,0x54,0x34,0x44,0x43,0x53,0x53,0x33,0x43,0x23,0x32,0x22,
+0x33,0x25,0x24,0x22,0x12,0x00,0x99,0xaa,0xab,0xcb,0xdb,0xdb,0xbc,0xcb,0x9a,0x9a,
+0xa9,0xda,0xdb,0xba,0x9a,0x98,0xa8,0xcb,0xbd,0xac,0xab,0xab,0xcb,0xdb,0xbb,0xab,
+0xab,0x9a,0xaa,0xbb,0xbc,0x8a,0x30,0x56,0x53,0x43,0x33,0x34,0x34,0x43,0x33,0x22,
+0x80,0xaa,0x9a,0x51,0x56,0x43,0x33,0x22,0x11,0x21,0x53,0x44,0x34,0x43,0x32,0x43,
+0x43,0x43,0x24,0x22,0x80,0xa8,0xbb,0xaa,0xaa,0xba,0xce,0xcc,0xcb,0xbb,0xab,0xaa,
+0xb9,0xcb,0xbc,0xbb,0x99,0x21,0x33,0x12,0xa8,0xcc,0x9a,0x28,0x63,0x33,0x92,0xfb,
+0xbd,0xbb,0x8a,0x00,0x01,0xda,0xcd,0xac,0x8a,0x28,0x52,0x33,0x34,0x34,0x35,0x45,
+0x43,0x33,0x22,0x11,0x10,0x20,0x21,0x80,0xca,0xcc,0xbb,0x9a,0x99,0xaa,0xcc,0xcc,
+0xaa,0x89,0x22,0x25,0x13,0xa8,0xdc,0xbb,0x8a,0x20,0x33,0x13,0xc9,0xcd,0xbc,0xbb,
+0xac,0xbb,0xbc,0xcb,0xbb,0xbb,0xba,0xab,0x09,0x72,0x54,0x33,0x12,0xa8,0xca,0x99,
+0x62,0x54,0x53,0x32,0x23,0x13,0x81,0xa9,0xcb,0xab,0x09,0x53,0x44,0x23,0x12,0x81,
+0x89,0x18,0x74,0x44,0x44,0x43,0x23,0x24,0x22,0x12,0x11,0x88,0xa8,0xba,0xbd,0xcc,
+0xac,0xcb,0xaa,0xaa,0xaa,0xcb,0xcc,0xcc,0xbb,0xbb,0xaa,0x89,0xa9,0xbc,0xbc,0x9a,
+0x20,0x44,0x34,0x22,0x01,0x00,0x00,0x32,0x53,0x12,0xa8,0xce,0xbc,0xab,0x89,0x88,
+0xb9,0xce,0xcc,0xaa,0x8a,0x88,0x00,0x81,0x88,0x98,0x89,0x20,0x64,0x34,0x24,0x02,
+0xba,0xcf,0xcc,0xbb,0xac,0xcb,0xba,0xcb,0xbb,0xbc,0xbb,0xbc,0xca,0xba,0xba,0xab,
+0x99,0x08,0x10,0x81,0x98,0xca,0xbc,0xbd,0xbc,0xbc,0xbb,0xac,0xbb,0xbc,0xab,0x09,
+0x42,0x24,0x01,0xa9,0x09,0x75,0x45,0x34,0x33,0x33,0x22,0x21,0x21,0x23,0x01,0xc8,
+0xdd,0xcc,0xbb,0xab,0x99,0x00,0x01,0x90,0x99,0x0a,0x74,0x55,0x34,0x34,0x32,0x01,
+0x88,0x89,0x00,0x33,0x35,0x02,0xb9,0xbf,0xbc,0x9a,0x88,0x11,0x11,0x33,0x36,0x45,
+0x53,0x43,0x34,0x33,0x33,0x12,0x88,0x89,0x09,0x10,0x98,0xfb,0xcd,0xcc,0xbb,0xbc,
+0xbb,0xbb,0xcb,0xba,0xbb,0x99,0x18,0x43,0x33,0x12,0x90,0xa9,0x9a,0x20,0x43,0x34,
+0x91,0xed,0xcd,0xbc,0xba,0xaa,0xaa,0xcb,0xcc,0xaa,0x19,0x54,0x44,0x43,0x12,0x01,
+0x88,0x98,0x99,0xa8,0xca,0xcb,0xcb,0xaa,0x9a,0x09,0x21,0x44,0x53,0x53,0x33,0x43,
+0x33,0x23,0x33,0x12,0x91,0xca,0xdc,0xbb,0xab,0x09,0x20,0x23,0x81,0xda,0xcb,0x9a,
+0x31,0x56,0x43,0x43,0x33,0x34,0x33,0x24,0x23,0x33,0x34,0x33,0x34,0x33,0x35,0x44,
+0x33,0x23,0x02,0x00,0x20,0x45,0x44,0x22,0x81,0xa8,0x08,0x55,0x45,0x24,0x22,0x90,
+0xba,0xbc,0x9a,0x10,0x53,0x24,0x23,0x12,0x21,0x42,0x34,0x24,0x13,0x32,0x44,0x46,
+0x43,0x33,0x23,0x10,0x08,0x31,0x54,0x43,0x22,0x88,0xbb,0xbc,0x89,0x31,0x34,0x25,
+0x22,0x21,0x22,0x12,0xa8,0xcd,0xad,0x9b,0x10,0x34,0x03,0xfa,0xdd,0xcb,0xab,0x99,
+0x00,0x00,0x90,0xb9,0xbc,0x9b,0x89,0x21,0x02,0xb8,0xdd,0xab,0x18,0x73,0x33,0x13,
+0xb8,0xce,0xbc,0xab,0x9a,0x88,0xa9,0xeb,0xdb,0xaa,0x19,0x42,0x35,0x23,0x12,0x98,
+0x09,0x41,0x54,0x23,0x82,0xcb,0xbd,0x9a,0x08,0x11,0xa8,0xde,0xcb,0xab,0x9a,0x99,
+0x98,0x89,0x89,0x80,0x98,0xdb,0xdc,0xcb,0xaa,0x09,0x41,0x44,0x33,0x12,0x80,0x88,
+0x31,0x54,0x33,0x22,0x01,0x20,0x63,0x44,0x23,0xa0,0xec,0xcc,0xaa,0x88,0x22,0x22,
+0x91,0xbc,0xac,0x29,0x63,0x34,0x23,0x01,0x80,0x10,0x42,0x44,0x34,0x24,0x23,0x43,
+0x54,0x44,0x53,0x22,0x81,0xa8,0xbb,0xab,0x08,0x10,0xa8,0xde,0xcc,0xbb,0x9a,0x28,
+0x53,0x44,0x23,0x23,0x21,0x11,0x10,0x10,0x11,0x42,0x54,0x34,0x24,0x81,0xb8,0xbc,
+0xaa,0x08,0x33,0x25,0x12,0x81,0x00,0x10,0x21,0xa8,0xde,0xcd,0xcb,0xba,0x99,0x08,
+0x98,0xeb,0xcd,0xcb,0xab,0x8a,0x88,0x98,0xdb,0xbd,0xbc,0x99,0x10,0x34,0x24,0x02,
+0xa0,0xaa,0x9a,0x20,0x44,0x33,0x13,0x81,0xba,0xcd,0xcc,0xcc,0xcb,0xba,0xab,0x09,
+0x31,0x44,0x33,0x12,0x11,0x31,0x46,0x53,0x33,0x23,0x23,0x31,0x42,0x33,0x22,0xc8,
+0xed,0xcc,0xbb,0xac,0x9a,0x8a,0x98,0x98,0x99,0xa9,0x89,0x10,0x42,0x63,0x43,0x43,
+0x43,0x23,0x22,0x01,0x80,0x00,0x42,0x54,0x34,0x33,0x12,0x00,0x09,0x62,0x55,0x43,
+0x32,0x11,0x80,0x00,0x42,0x33,0x24,0x00,0x88,0x89,0x98,0xea,0xdd,0xbd,0xbd,0xab,
+0x9a,0x08,0x21,0x11,0x90,0xb9,0x99,0x41,0x46,0x24,0x13,0x91,0xb9,0xab,0x19,0x63,
+0x33,0x02,0xca,0xbe,0xba,0x08,0x53,0x34,0x12,0xb8,0xcc,0xac,0x89,0x31,0x23,0x82,
+0xcc,0xcd,0xaa,0x99,0x80,0x00,0xa8,0xba,0xab,0x09,0x44,0x45,0x23,0x13,0x02,0x11,
+0x21,0x21,0x11,0x11,0x63,0x45,0x33,0x02,0xea,0xbd,0xbc,0xaa,0x08,0x21,0x32,0x22,
+0x12,0x22,0x91,0xfd,0xde,0xbc,0xbc,0xbb,0x09,0x10,0x11,0xb8,0xce,0xbc,0xbc,0x99,
+0x09,0x20,0x31,0x33,0x36,0x35,0x44,0x22,0x12,0x88,0xba,0xba,0x89,0x11,0x12,0xa0,
+0xad,0x8b,0x73,0x45,0x33,0x01,0xb9,0xbd,0xaa,0x21,0x37,0x35,0x23,0x02,0xa9,0xbc,
+0xac,0xaa,0xba,0xca,0xbb,0xbb,0x8a,0x10,0x43,0x32,0x01,0x88,0x08,0x63,0x55,0x53,
+0x23,0x23,0x80,0xa9,0xac,0xab,0x89,0x88,0xba,0xce,0xab,0x39,0x66,0x44,0x23,0x02,
+0xa8,0xbc,0xac,0x9a,0x08,0x08,0xb9,0xcd,0xbd,0xbc,0xba,0xba,0xaa,0xcb,0xba,0x8a,
+0x20,0x45,0x24,0x02,0xa9,0xab,0x29,0x67,0x34,0x25,0x22,0x80,0x99,0xaa,0x89,0x11,
+0x32,0x01,0xda,0xbc,0xac,0x89,0x08,0x90,0xcb,0xbd,0xab,0x38,0x47,0x35,0x43,0x22,
+0x11,0x98,0xa9,0xbb,0xac,0xab,0xab,0xcc,0xbd,0xbc,0xaa,0x18,0x53,0x43,0x02,0xa0,
+0xda,0xba,0x09,0x42,0x36,0x24,0x12,0x98,0xaa,0xab,0xba,0xbb,0xce,0xcb,0xba,0x89,
+0x18,0x00,0xb9,0xdd,0xbb,0x9a,0x20,0x33,0x82,0xfb,0xbc,0xcb,0xaa,0xcb,0xbc,0xbd,
+0xac,0xaa,0x89,0x20,0x34,0x33,0x12,0xa9,0x9c,0x30,0x67,0x34,0x23,0x13,0x01,0x11,
+0x32,0x23,0xa1,0xee,0xdc,0xbb,0xaa,0x09,0x21,0x22,0x80,0xdb,0xbd,0xbc,0xaa,0x8a,
+0x10,0x43,0x34,0x14,0x01,0x98,0x88,0x20,0x43,0x12,0xdb,0xcd,0xab,0x19,0x44,0x45,
+0x23,0x02,0xb9,0xcd,0xbb,0x99,0x21,0x34,0x23,0x00,0x89,0x08,0x32,0x35,0x03,0xe9,
+0xdc,0xbb,0x8a,0x28,0x32,0x01,0xdb,0xbc,0x8b,0x40,0x43,0x02,0xca,0xbe,0xad,0x8a,
+0x28,0x42,0x22,0x81,0xba,0xbb,0x19,0x53,0x34,0x22,0x32,0x63,0x44,0x34,0x24,0x12,
+0x90,0xa9,0x8a,0x40,0x46,0x24,0x03,0xa0,0xcb,0xab,0x09,0x21,0x02,0xc9,0xce,0xcb,
+0xbb,0xaa,0x99,0xb9,0xeb,0xcb,0xaa,0x10,0x55,0x34,0x34,0x23,0x11,0x00,0x00,0x88,
+0x80,0x88,0x99,0x08,0x32,0x35,0x23,0xb8,0xbf,0xad,0xaa,0x89,0x10,0x22,0x44,0x53,
+0x23,0x22,0x00,0xa9,0xbc,0xcb,0xaa,0x18,0x33,0x82,0xfb,0xbe,0x9a,0x20,0x43,0xc0,
+0xcf,0xbd,0xab,0x18,0x53,0x34,0x22,0x80,0x88,0x10,0x54,0x34,0x33,0x11,0x88,0x88,
+0x31,0x54,0x23,0x91,0xcc,0xbd,0xab,0x8a,0x10,0x80,0xc9,0xcd,0xbb,0x8a,0x18,0x21,
+0x01,0x99,0xab,0x0a,0x72,0x44,0x44,0x43,0x23,0x13,0x80,0xba,0xbb,0x8b,0x40,0x54,
+0x33,0x01,0xc9,0xbd,0xac,0x09,0x43,0x45,0x23,0x11,0x99,0xbc,0xbc,0xab,0xaa,0xaa,
+0xdc,0xcc,0xbc,0xab,0x89,0x31,0x34,0x33,0x11,0x88,0x08,0x21,0x46,0x44,0x43,0x23,
+0x12,0x90,0xa9,0xac,0xbb,0xcc,0xbb,0xab,0x18,0x63,0x33,0x12,0xa9,0xbc,0x8a,0x52,
+0x34,0x34,0x23,0x22,0x33,0x33,0x22,0x00,0xeb,0xdd,0xcd,0xdb,0xbb,0xba,0xaa,0xa9,
+0xa9,0x9a,0x0a,0x40,0x44,0x34,0x23,0x22,0x53,0x45,0x35,0x34,0x23,0x01,0x88,0x99,
+0x88,0x01,0x90,0xfb,0xcd,0xcb,0x9b,0x89,0x31,0x34,0x13,0x98,0xcd,0xcb,0xaa,0x88,
+0x10,0x32,0x43,0x34,0x35,0x33,0x02,0xc9,0xcd,0xab,0x8a,0x20,0x43,0x22,0x01,0x98,
+0x88,0x08,0x21,0x34,0x35,0x34,0x34,0x34,0x32,0x32,0x32,0x46,0x35,0x24,0x91,0xec,
+0xcc,0xbb,0x99,0x10,0x32,0x01,0xc9,0xcc,0xbb,0x09,0x31,0x35,0x14,0x81,0xaa,0x99,
+0x20,0x35,0x24,0x91,0xcb,0xbc,0x9a,0x00,0x32,0x22,0x23,0x43,0x35,0x24,0x91,0xfb,
+0xcb,0x9b,0x20,0x44,0x24,0x02,0x98,0xca,0xcb,0xaa,0xbb,0xcc,0xcc,0xcb,0xaa,0x09,
+0x20,0x22,0x02,0x98,0x99,0x31,0x57,0x33,0x33,0x01,0x98,0x30,0x55,0x44,0x23,0x91,
+0xda,0xcc,0xaa,0x08,0x42,0x43,0x12,0x81,0x89,0x89,0x11,0x22,0x00,0xba,0xbb,0x08,
+0x42,0x22,0xa9,0xdb,0x89,0x42,0x35,0x43,0x22,0x43,0x45,0x44,0x33,0x13,0xa9,0xcd,
+0xab,0x09,0x63,0x43,0x12,0xa8,0xdb,0xbb,0x89,0x21,0x43,0x81,0xec,0xcc,0xac,0xaa,
+0x18,0x32,0x35,0x23,0x01,0xb9,0xcb,0x8a,0x51,0x35,0x35,0x33,0x12,0x01,0x00,0x08,
+0x88,0xda,0xbc,0xac,0x18,0x55,0x43,0x22,0x98,0xcc,0xbc,0x9b,0x09,0x22,0x23,0x90,
+0xdc,0xbb,0x89,0x43,0x24,0x81,0xfb,0xcb,0x9a,0x20,0x43,0x24,0x01,0xa8,0xba,0x89,
+0x30,0x43,0x12,0x88,0x00,0x42,0x12,0xea,0xcd,0xbd,0xcc,0xcd,0xcc,0xaa,0x19,0x54,
+0x35,0x33,0x81,0xda,0xbc,0xac,0x88,0x42,0x34,0x24,0x01,0xa9,0xcc,0xaa,0x09,0x21,
+0x34,0x23,0x81,0xca,0xad,0xab,0x18,0x43,0x44,0x21,0x88,0xba,0xad,0xaa,0x08,0x21,
+0x32,0x13,0x81,0xa9,0xcc,0xcb,0xbb,0x99,0x31,0x25,0x02,0xdc,0xbe,0x9b,0x38,0x57,
+0x43,0x23,0x01,0xba,0xcc,0xab,0x08,0x42,0x34,0x12,0x90,0xba,0xac,0x8a,0x10,0x21,
+0x02,0x90,0xcb,0xbc,0xba,0x99,0x88,0x99,0xaa,0xab,0xab,0xcd,0xcd,0xbb,0x8b,0x41,
+0x36,0x24,0x12,0x98,0xaa,0x9a,0x20,0x45,0x34,0x22,0x80,0x9a,0x19,0x73,0x33,0x13,
+0xb8,0xbd,0x9c,0x09,0x32,0x25,0x12,0xb9,0xcf,0xbc,0xbb,0x9a,0x88,0x00,0x98,0xa9,
+0x0a,0x74,0x45,0x34,0x23,0x02,0xa9,0xba,0xaa,0x00,0x00,0xfa,0xcd,0xbc,0xac,0x99,
+0x88,0x88,0xb9,0xcc,0xab,0x18,0x44,0x35,0x34,0x22,0x23,0x33,0x43,0x33,0x22,0x12,
+0x11,0x80,0xba,0xcd,0xcb,0xcb,0xca,0xca,0xbb,0xcc,0xac,0xac,0x9a,0x18,0x42,0x34,
+0x24,0x12,0x81,0x90,0x80,0x21,0x42,0x22,0x91,0xdb,0xbd,0xbc,0xba,0xbb,0xcc,0xaa,
+0x28,0x74,0x53,0x33,0x23,0x01,0x90,0x98,0x08,0x21,0x33,0x13,0xf9,0xdd,0xcc,0xba,
+0xbb,0xaa,0xa9,0x9a,0x89,0x31,0x55,0x34,0x43,0x22,0x11,0x11,0x21,0x33,0x35,0x33,
+0x22,0x01,0x98,0xcb,0xcc,0xcb,0xac,0x9b,0x8a,0x08,0x22,0x43,0x43,0x34,0x36,0x35,
+0x34,0x23,0x90,0xdb,0xbc,0x8a,0x30,0x34,0x02,0xdc,0xbe,0xbc,0xaa,0x89,0x00,0x80,
+0xa9,0xdb,0x9a,0x20,0x54,0x43,0x12,0x80,0x89,0x10,0x42,0x33,0x13,0xa8,0xcf,0xbc,
+0xab,0x08,0x53,0x43,0x12,0x80,0x9a,0x18,0x43,0x24,0x02,0xa8,0xab,0x18,0x66,0x34,
+0x24,0x82,0xb9,0xcd,0xbb,0xab,0x99,0x9a,0xbb,0xbb,0x8b,0x40,0x64,0x34,0x34,0x24,
+0x11,0x01,0x88,0x00,0x10,0x42,0x43,0x22,0xa1,0xde,0xcd,0xbb,0xab,0x89,0x10,0x10,
+0x11,0x22,0x44,0x34,0x23,0x02,0xa8,0xbc,0x89,0x63,0x45,0x33,0x02,0xc9,0xcd,0xdb,
+0xab,0x9b,0x09,0x20,0x33,0x33,0x33,0x36,0x45,0x33,0x12,0xb9,0xce,0xbb,0x8a,0x18,
+0x31,0x02,0x91,0xbb,0xad,0x09,0x62,0x44,0x23,0x82,0xca,0xbc,0xab,0x8a,0x98,0xca,
+0xcc,0xbc,0xaa,0xaa,0xa9,0xaa,0x09,0x62,0x44,0x33,0x12,0x80,0x10,0x65,0x44,0x34,
+0x33,0x11,0x99,0x9a,0x8a,0x10,0x11,0x90,0xb9,0xbb,0x99,0xb8,0xef,0xcc,0xbb,0xab,
+0x18,0x42,0x32,0x01,0xba,0xbd,0x9a,0x00,0x33,0x13,0xda,0xdf,0xdb,0xba,0x89,0x21,
+0x34,0x22,0x98,0xaa,0x38,0x67,0x43,0x22,0x91,0xa9,0x9b,0x28,0x45,0x53,0x12,0x90,
+0xaa,0xac,0x89,0x20,0x11,0x90,0xba,0x19,0x54,0x25,0x13,0xa9,0xce,0xcc,0xaa,0x89,
+0x31,0x25,0x02,0xc9,0xbb,0x8b,0x41,0x13,0xc8,0xbf,0xbd,0x9a,0x08,0x20,0x11,0x88,
+0xaa,0x9b,0x58,0x55,0x43,0x13,0x80,0x99,0x08,0x43,0x45,0x33,0x22,0x98,0xdc,0xbc,
+0xac,0x99,0x99,0xa9,0xa9,0x09,0x42,0x33,0x02,0xa8,0xaa,0x9a,0x89,0x20,0x46,0x14,
+0xc0,0xcd,0x9b,0x50,0x45,0x33,0x02,0xa9,0xcb,0xba,0x8a,0x38,0x55,0x23,0x81,0xbc,
+0x8c,0x40,0x33,0x91,0xce,0xab,0x18,0x22,0x80,0x09,0x72,0x33,0xe9,0xcf,0xaa,0x31,
+0x35,0xb1,0xef,0xbb,0x09,0x73,0x43,0x02,0xa8,0xcb,0x9b,0x18,0x42,0x23,0x01,0xa8,
+0x08,0x73,0x44,0x02,0xd9,0xcd,0x9c,0x09,0x42,0x24,0x12,0xa8,0xca,0x99,0x18,0x11,
+0x81,0xba,0xbb,0x28,0x55,0x43,0x02,0xb9,0xcc,0xab,0x10,0x43,0x23,0xa1,0xcc,0xac,
+0x09,0x42,0x24,0x03,0xa8,0xeb,0xab,0x8a,0x30,0x44,0x33,0x12,0xa8,0xbc,0xbb,0x89,
+0x32,0x35,0x22,0x91,0xba,0xbc,0xab,0x18,0x63,0x44,0x22,0x90,0xfb,0xbb,0x8b,0x20,
+0x34,0x33,0x01,0xa9,0xcc,0xdc,0xcb,0x99,0x31,0x55,0x33,0x01,0xb9,0xdc,0xaa,0x09,
+0x43,0x35,0x02,0xdb,0xbe,0x9a,0x40,0x45,0x32,0x91,0xca,0xcc,0x9a,0x18,0x42,0x34,
+0x13,0xa0,0xdc,0xcb,0x9a,0x28,0x44,0x34,0x23,0xa8,0xdc,0xbc,0x9a,0x31,0x45,0x33,
+0x81,0xcb,0xbd,0xaa,0x18,0x53,0x34,0x12,0x98,0xbd,0xbc,0x89,0x41,0x43,0x23,0x01,
+0xb8,0xdc,0xcb,0x0a,0x88,0x50,0x34,0x23,0x00,0xdb,0xbc,0x8a,0x28,0x44,0x24,0x00,
+0xb8,0xdc,0x9a,0x08,0x08,0x45,0x23,0x08,0x80,0xbd,0xbb,0x8a,0x41,0x35,0x23,0x90,
+0xdc,0xbb,0x08,0x88,0x45,0x23,0x01,0xa8,0xdb,0xbb,0x8b,0x08,0x73,0x43,0x12,0xa8,
+0xeb,0xab,0x88,0x50,0x43,0x03,0x00,0xb0,0xbe,0x9b,0x88,0x41,0x44,0x12,0x98,0xbb,
+0xad,0x09,0x31,0x34,0x12,0x90,0xcb,0xab,0x09,0x33,0x24,0x91,0xcb,0x9b,0x28,0x35,
+0x23,0xb8,0xce,0xac,0x9a,0x20,0x54,0x33,0x13,0xb8,0xce,0xbb,0x8b,0x40,0x44,0x23,
+0x01,0xba,0xbe,0xab,0x18,0x54,0x33,0x02,0xca,0xcc,0xaa,0x10,0x43,0x24,0x01,0xba,
+0xac,0x8a,0x31,0x35,0x13,0xa0,0xcc,0xab,0x0a,0x42,0x43,0x13,0x91,0xca,0xbd,0x9b,
+0x19,0x53,0x24,0x01,0xa9,0xbc,0x8a,0x21,0x44,0x11,0xb9,0xcc,0xab,0x19,0x44,0x34,
+0x03,0xa8,0xbd,0xbc,0x9a,0x08,0x32,0x54,0x43,0x23,0x91,0xdc,0xbc,0x9b,0x28,0x44,
+0x34,0x23,0xa0,0xeb,0xbc,0xab,0x18,0x63,0x24,0x12,0x90,0xaa,0xac,0xac,0xbb,0x0b,
+0x58,0x46,0x33,0x82,0xdb,0xcc,0x09,0x88,0x43,0x34,0x01,0x80,0xcc,0xbb,0x89,0x41,
+0x35,0x12,0x80,0xcc,0xbb,0x09,0x31,0x25,0x03,0x90,0xba,0xab,0x8a,0x10,0x43,0x32,
+0x81,0xba,0xbc,0x9b,0x10,0x43,0x43,0x32,0x12,0xa8,0xce,0xab,0x1a,0x53,0x25,0x02,
+0xb8,0xbd,0xbb,0x09,0x52,0x35,0x12,0xa0,0xcd,0xbb,0x18,0x54,0x33,0x82,0xda,0xbc,
+0x9b,0x10,0x34,0x34,0x13,0xa8,0xcd,0xbb,0x9b,0x41,0x35,0x24,0x90,0xeb,0xbb,0x8a,
+0x42,0x35,0x23,0xa0,0xdc,0xab,0x09,0x42,0x44,0x11,0xb8,0xbc,0xac,0x19,0x52,0x24,
+0x02,0xa8,0xcc,0x9b,0x09,0x32,0x35,0x13,0x81,0xda,0xcc,0xaa,0x19,0x53,0x34,0x13,
+0xa9,0xbd,0xac,0x89,0x22,0x44,0x22,0x81,0xba,0xcd,0xaa,0x18,0x53,0x24,0x02,0xa9,
+0xbc,0xbb,0x08,0x41,0x43,0x13,0x91,0xca,0xcb,0x9a,0x18,0x23,0x23,0x11,0x12,0x81,
+0xe9,0xcd,0xac,0x18,0x44,0x34,0x12,0xb9,0xbe,0xaa,0x19,0x42,0x43,0x12,0xa0,0xdb,
+0xbb,0x89,0x41,0x43,0x12,0xa8,0xbb,0x9a,0x32,0x25,0xa8,0xce,0xbb,0x28,0x47,0x24,
+0x12,0xca,0xdc,0xab,0x19,0x42,0x35,0x12,0x90,0xcb,0xac,0x9a,0x08,0x33,0x35,0x23,
+0x81,0xeb,0xcb,0x8a,0x21,0x45,0x02,0xa8,0xbe,0xac,0x08,0x28,0x46,0x32,0x00,0xca,
+0xbc,0x8b,0x20,0x45,0x23,0x00,0xc8,0xad,0x8b,0x20,0x35,0x04,0x00,0xc8,0xbc,0x0a,
+0x38,0x34,0x24,0x80,0xda,0xab,0x8a,0x31,0x35,0x13,0xb8,0xcc,0x9b,0x18,0x42,0x23,
+0x81,0xaa,0xac,0x99,0x10,0x21,0x12,0x01,0x98,0x99,0x21,0x24,0xe9,0xbf,0xac,0x40,
+0x55,0x23,0x90,0xcd,0xbb,0x89,0x52,0x43,0x22,0x98,0xcb,0xac,0x9a,0x20,0x53,0x24,
+0x02,0xa8,0xbd,0xbc,0x09,0x52,0x43,0x13,0xa8,0xcd,0xaa,0x19,0x53,0x33,0x81,0xca,
+0xcb,0x8a,0x20,0x34,0x23,0x81,0xdb,0xbc,0x9b,0x30,0x45,0x24,0x81,0xca,0xbc,0x9b,
+0x38,0x54,0x33,0x01,0xda,0xdb,0x9a,0x00,0x43,0x34,0x01,0xb9,0xcd,0x9a,0x08,0x51,
+0x43,0x02,0xa8,0xdb,0xab,0x09,0x43,0x25,0x02,0xa0,0xcc,0xab,0x09,0x42,0x25,0x03,
+0x90,0xcc,0xac,0x08,0x28,0x44,0x22,0x90,0xdb,0xac,0x08,0x28,0x54,0x12,0x80,0xcb,
+0xbb,0x89,0x51,0x43,0x12,0xa0,0xdb,0xbb,0x0a,0x41,0x44,0x12,0x90,0xdb,0xbb,0x89,
+0x42,0x34,0x02,0xa8,0xcb,0x9a,0x10,0x22,0x01,0x98,0x08,0x42,0x12,0xb9,0xbf,0xab,
+0x28,0x54,0x24,0x01,0xb9,0xcd,0xaa,0x08,0x53,0x24,0x12,0x98,0xdb,0xbc,0x8a,0x20,
+0x45,0x23,0x91,0xcc,0xbb,0x18,0x45,0x22,0x90,0xcc,0x9b,0x18,0x53,0x32,0x80,0xcb,
+0xac,0x89,0x42,0x34,0x13,0xca,0xcd,0x9b,0x38,0x45,0x33,0x80,0xcc,0xcb,0x0a,0x28,
+0x35,0x33,0x80,0xdb,0xbc,0x8a,0x20,0x34,0x14,0x81,0x99,0xab,0x9a,0x9a,0x88,0x20,
+0x63,0x43,0x22,0x81,0xda,0xcd,0xab,0x1a,0x73,0x43,0x03,0xb8,0xcd,0xaa,0x08,0x34,
+0x24,0x02,0xba,0xcc,0xaa,0x18,0x53,0x33,0x02,0xc9,0xbc,0x9b,0x29,0x53,0x33,0x03,
+0xb9,0xbe,0x9c,0x19,0x52,0x33,0x12,0xc9,0xbc,0xbb,0x08,0x44,0x34,0x02,0xb8,0xbe,
+0xbb,0x09,0x53,0x43,0x12,0x99,0xcb,0x99,0x20,0x23,0x01,0xa8,0x9b,0x19,0x22,0x13,
+0x01,0x00,0xa0,0xde,0xac,0x39,0x47,0x23,0xd8,0xcd,0x9a,0x41,0x44,0x12,0xb9,0xcc,
+0x9a,0x11,0x43,0x11,0x90,0xba,0xaa,0x8a,0x20,0x45,0x23,0x91,0xcc,0x9a,0x31,0x25,
+0xb1,0xde,0xbb,0x19,0x44,0x34,0x13,0x90,0xdb,0xbc,0x9b,0x28,0x36,0x24,0x90,0xeb,
+0xab,0x08,0x63,0x32,0x01,0xa8,0xbb,0xbb,0x9a,0x20,0x44,0x33,0x01,0xca,0xab,0x28,
+0x43,0x82,0xeb,0xab,0x18,0x35,0x23,0xc8,0xcb,0x8a,0x42,0x34,0x82,0xeb,0xbc,0xab,
+0x31,0x47,0x23,0x90,0xeb,0xbb,0x8a,0x53,0x34,0x02,0xb0,0xcc,0xab,0x09,0x42,0x34,
+0x13,0xa0,0xcc,0xbb,0x0a,0x53,0x25,0x83,0xc0,0xbc,0xab,0x28,0x54,0x23,0x00,0xc8,
+0xbc,0xaa,0x10,0x43,0x24,0x01,0xc9,0xcb,0x9a,0x31,0x36,0x22,0xa8,0xbd,0xab,0x28,
+0x44,0x13,0xa0,0xdc,0xab,0x08,0x62,0x43,0x01,0x88,0xbc,0xbc,0x09,0x42,0x34,0x02,
+0x90,0xcb,0xbb,0x89,0x22,0x24,0x02,0xa9,0xaa,0x89,0x21,0x21,0x81,0x89,0x18,0x43,
+0x33,0xd8,0xcf,0xcc,0x8a,0x31,0x47,0x23,0x91,0xdb,0xad,0x8a,0x30,0x35,0x22,0xa8,
+0xcc,0xba,0x08,0x42,0x34,0x13,0xb8,0xcd,0xab,0x19,0x42,0x34,0x02,0xb9,0xbc,0x9b,
+0x28,0x43,0x33,0x82,0xb8,0xcb,0xbb,0x9b,0x10,0x63,0x34,0x23,0x91,0xeb,0xbc,0x9b,
+0x19,0x63,0x34,0x23,0xa1,0xdd,0xbc,0x8b,0x41,0x45,0x22,0x90,0xcc,0xbb,0x89,0x52,
+0x43,0x12,0xa8,0xbc,0xac,0x08,0x33,0x34,0x02,0xa9,0xbc,0xab,0x08,0x33,0x35,0x12,
+0x98,0xcc,0xbb,0x0a,0x53,0x34,0x02,0xc9,0xcb,0x9b,0x08,0x42,0x43,0x33,0x02,0xea,
+0xbd,0xac,0x28,0x63,0x23,0x81,0xb9,0xac,0x99,0x80,0x08,0x18,0x44,0x25,0x82,0xea,
+0xbc,0x9a,0x41,0x34,0x22,0xa8,0xeb,0xaa,0x09,0x43,0x44,0x02,0xa8,0xdc,0xab,0x19,
+0x63,0x34,0x01,0xb9,0xbe,0xaa,0x10,0x44,0x22,0x80,0xca,0xba,0x88,0x32,0x34,0x81,
+0xc9,0xbb,0x9b,0x31,0x36,0x22,0x98,0xcb,0xaa,0x18,0x33,0x24,0x90,0xcb,0xaa,0x28,
+0x54,0x23,0x91,0xdc,0xbb,0x0a,0x53,0x33,0xb0,0xdd,0x9b,0x38,0x45,0x33,0x80,0xcb,
+0xbc,0xaa,0x89,0x41,0x45,0x33,0x81,0xdc,0xbb,0x0a,0x42,0x24,0x81,0xa9,0x9a,0x18,
+0x01,0xd9,0xac,0x29,0x65,0x24,0x81,0xda,0xcc,0x9a,0x28,0x44,0x24,0x02,0xba,0xbe,
+0xab,0x20,0x35,0x24,0x80,0xcb,0xbb,0x89,0x32,0x35,0x12,0x98,0xcb,0xaa,0x09,0x32,
+0x33,0x91,0xdb,0x9a,0x41,0x24,0x82,0xdb,0xbc,0x89,0x31,0x34,0x32,0x12,0x98,0xdd,
+0xbc,0x9b,0x41,0x36,0x22,0xb8,0xbc,0xab,0x20,0x34,0x13,0x90,0xa9,0xbc,0xbb,0x09,
+0x56,0x34,0x01,0xdb,0xac,0x89,0x33,0x24,0x90,0xcb,0x89,0x52,0x22,0xa8,0xcd,0xaa,
+0x18,0x43,0x34,0x13,0xa8,0xbf,0xad,0x19,0x73,0x23,0x82,0xeb,0xbb,0x0a,0x52,0x24,
+0x02,0xb8,0xbc,0xab,0x19,0x44,0x33,0x03,0xd9,0xcc,0x9a,0x28,0x34,0x14,0x90,0xca,
+0xaa,0x18,0x22,0x22,0x01,0x00,0x99,0xdb,0xac,0x0a,0x62,0x33,0x02,0xc9,0xac,0x8a,
+0x31,0x32,0x12,0x80,0xaa,0xcc,0x9a,0x30,0x45,0x13,0xca,0xad,0x18,0x54,0x13,0xc8,
+0xbe,0xab,0x38,0x54,0x24,0x02,0xa8,0xeb,0xac,0x8a,0x41,0x35,0x13,0xb9,0xbe,0x9b,
+0x40,0x34,0x23,0xb9,0xcd,0xaa,0x18,0x53,0x23,0x12,0xb9,0xbe,0xab,0x19,0x44,0x24,
+0x01,0xca,0xcb,0x89,0x21,0x34,0x12,0x98,0xbc,0xbb,0x09,0x42,0x35,0x12,0xb8,0xcd,
+0xaa,0x10,0x53,0x22,0x90,0xb9,0xaa,0x89,0x08,0x10,0x42,0x34,0x12,0xe9,0xbc,0x9c,
+0x18,0x43,0x24,0x13,0x81,0xdb,0xcd,0xaa,0x29,0x54,0x33,0x91,0xeb,0xbb,0x0a,0x53,
+0x34,0x01,0xb9,0xbd,0xab,0x18,0x63,0x24,0x02,0xa8,0xad,0xab,0x18,0x42,0x22,0x80,
+0x99,0x88,0x00,0x80,0xba,0xbc,0x9a,0x20,0x54,0x35,0x34,0x80,0xdd,0xcc,0x99,0x31,
+0x44,0x13,0x90,0xbc,0xbb,0x08,0x42,0x23,0x80,0xdb,0xaa,0x20,0x45,0x23,0xb8,0xce,
+0xab,0x18,0x44,0x24,0x01,0xa9,0xcc,0xaa,0x08,0x32,0x34,0x13,0xa9,0xad,0x9a,0x21,
+0x33,0xa1,0xdc,0xaa,0x30,0x44,0x23,0x81,0xca,0xcd,0xab,0x0a,0x72,0x44,0x12,0xb8,
+0xbd,0xac,0x28,0x43,0x24,0x81,0xb9,0xbc,0x9a,0x00,0x33,0x25,0x01,0xa8,0xbc,0x9a,
+0x28,0x33,0x34,0x11,0xb9,0xdd,0xcb,0x89,0x63,0x34,0x13,0xd9,0xcc,0x9a,0x20,0x35,
+0x13,0xa8,0xbc,0x9c,0x28,0x53,0x13,0xa1,0xeb,0xab,0x0a,0x53,0x43,0x02,0xb9,0xbd,
+0x9b,0x20,0x44,0x23,0x81,0xba,0xae,0x9b,0x18,0x53,0x43,0x11,0xa9,0xcc,0xaa,0x08,
+0x43,0x33,0x02,0xb9,0xbc,0x9b,0x08,0x22,0x43,0x32,0x12,0xc8,0xcd,0xac,0x29,0x54,
+0x24,0x81,0xdb,0xbc,0x8a,0x42,0x35,0x12,0xa8,0xcc,0x9c,0x89,0x32,0x35,0x22,0x98,
+0xbc,0xac,0x09,0x31,0x34,0x11,0xb9,0xdb,0x9a,0x20,0x44,0x24,0x91,0xdb,0xbc,0x8a,
+0x41,0x35,0x22,0xa8,0xcc,0xbb,0x89,0x32,0x36,0x22,0x91,0xca,0xab,0x89,0x21,0x82,
+0xeb,0xab,0x40,0x56,0x23,0x90,0xdc,0xbb,0x9a,0x32,0x37,0x23,0x81,0xcb,0xbd,0x9a,
+0x20,0x44,0x23,0x90,0xcb,0xab,0x09,0x32,0x33,0x02,0xa9,0xbb,0x99,0x08,0x00,0x90,
+0x08,0x31,0x56,0x33,0x91,0xdd,0xbc,0x9a,0x41,0x45,0x22,0x90,0xdb,0xac,0x9a,0x30,
+0x45,0x33,0x82,0xda,0xbc,0xab,0x20,0x63,0x32,0x01,0xa9,0xbc,0xab,0x09,0x53,0x43,
+0x11,0xb9,0xba,0x18,0x33,0xc0,0xdf,0xab,0x28,0x47,0x33,0x91,0xea,0xbb,0x9b,0x31,
+0x45,0x23,0x81,0xdb,0xbc,0x9a,0x31,0x45,0x23,0x90,0xda,0xbb,0x9a,0x20,0x34,0x24,
+0x12,0xa8,0xbc,0xbc,0x89,0x31,0x35,0x12,0x98,0xcb,0xab,0x08,0x41,0x44,0x12,0xb0,
+0xcd,0xac,0x19,0x53,0x24,0x91,0xca,0x9b,0x18,0x43,0x11,0xba,0xac,0x29,0x53,0x13,
+0x98,0xbb,0x9b,0x20,0x13,0x81,0x99,0x9a,0xba,0xbb,0x49,0x77,0x43,0x12,0xb9,0xce,
+0xab,0x0a,0x42,0x36,0x23,0x90,0xdc,0xcb,0x99,0x31,0x44,0x22,0xa0,0xdb,0xab,0x19,
+0x53,0x34,0x01,0xda,0xcc,0x9a,0x20,0x35,0x34,0x80,0xca,0xbc,0x9b,0x20,0x34,0x24,
+0x01,0xa9,0xbb,0xac,0x0a,0x21,0x34,0x23,0x81,0xb9,0xac,0x9a,0x88,0x88,0x08,0x62,
+0x54,0x22,0x98,0xcc,0xbb,0x08,0x42,0x12,0xa8,0xbd,0x9b,0x63,0x36,0x23,0xc8,0xce,
+0xab,0x29,0x64,0x23,0x81,0xeb,0xbb,0x09,0x42,0x43,0x01,0xa8,0xab,0x9b,0x00,0x12,
+0x22,0x80,0xa9,0x89,0x51,0x44,0x01,0xeb,0xbc,0x8a,0x43,0x35,0x01,0xb9,0xcc,0x8a,
+0x18,0x33,0x26,0x12,0xb8,0xce,0xab,0x18,0x45,0x24,0x90,0xbc,0xad,0x08,0x43,0x24,
+0x02,0xc8,0xdb,0xaa,0x80,0x43,0x25,0x02,0xb9,0xbd,0x8a,0x20,0x45,0x12,0x98,0xcb,
+0xbb,0x09,0x43,0x34,0x13,0xb8,0xdc,0xab,0x08,0x53,0x33,0x02,0xc9,0xcc,0x8a,0x28,
+0x42,0x23,0x81,0xaa,0xbc,0x9b,0x18,0x43,0x34,0x02,0xc9,0xbc,0x8a,0x21,0x34,0x12,
+0xb9,0xac,0x09,0x21,0x01,0xa9,0x0a,0x62,0x33,0xa1,0xcc,0xab,0x09,0x12,0x33,0x54,
+0x23,0xb1,0xcf,0xac,0x18,0x63,0x13,0x91,0xbb,0xab,0x89,0xa9,0xaa,0x71,0x47,0x23,
+0xb0,0xdd,0xbb,0x09,0x34,0x35,0x02,0xa8,0xcc,0xab,0x09,0x42,0x35,0x02,0xb8,0xcc,
+0x9a,0x10,0x32,0x12,0x99,0x9a,0x08,0x12,0x22,0x00,0xa8,0xec,0xbc,0x9a,0x62,0x34,
+0x12,0xb9,0xad,0x19,0x43,0x23,0xb9,0xbf,0xab,0x28,0x45,0x24,0x82,0xd9,0xbc,0x9c,
+0x28,0x63,0x33,0x02,0xba,0xbd,0xac,0x09,0x31,0x35,0x23,0xa0,0xcb,0xab,0x28,0x33,
+0x92,0xce,0xac,0x20,0x36,0x24,0x80,0xdb,0xab,0x8a,0x21,0x43,0x12,0x98,0xa9,0x08,
+0x42,0x13,0xfa,0xbe,0xab,0x40,0x46,0x23,0x80,0xeb,0xcb,0x89,0x20,0x34,0x14,0x80,
+0xcb,0xbb,0x89,0x41,0x43,0x12,0xa8,0xbc,0xab,0x18,0x53,0x33,0x02,0xb9,0xcc,0xab,
+0x0a,0x42,0x34,0x33,0x90,0xcc,0xbc,0x8a,0x30,0x44,0x13,0x80,0xba,0x9c,0x89,0x10,
+0x00,0x00,0x11,0x01,0x88,0x0a,0x74,0x44,0x81,0xdd,0xbc,0x8b,0x62,0x34,0x13,0xa8,
+0xcd,0xab,0x19,0x42,0x34,0x02,0xa8,0xcd,0xaa,0x18,0x53,0x33,0x81,0xda,0xcb,0x89,
+0x31,0x34,0x11,0xc9,0xbb,0x8a,0x42,0x34,0x03,0xca,0xbc,0x9b,0x20,0x34,0x22,0x01,
+0x80,0x88,0xcb,0xcd,0xaa,0x10,0x45,0x33,0x81,0xca,0xbc,0x8b,0x20,0x44,0x22,0x80,
+0xdb,0xbb,0x8b,0x40,0x45,0x33,0x12,0xda,0xbd,0xbb,0x20,0x55,0x23,0x91,0xdb,0xac,
+0x09,0x32,0x24,0x81,0xa9,0x9a,0x08,0x01,0x90,0xaa,0xbb,0xaa,0x20,0x57,0x45,0x22,
+0xb8,0xcf,0xab,0x09,0x63,0x33,0x12,0xb9,0xdb,0xab,0x89,0x21,0x44,0x34,0x02,0xca,
+0xbd,0x9c,0x18,0x34,0x33,0x81,0xca,0xcb,0x8a,0x28,0x42,0x24,0x01,0xca,0xbc,0x9b,
+0x41,0x35,0x13,0xb8,0xdc,0xaa,0x09,0x32,0x44,0x23,0x81,0xeb,0xbc,0xaa,0x31,0x46,
+0x22,0x90,0xdb,0xbb,0x8a,0x43,0x34,0x13,0xa0,0xcc,0xac,0x0a,0x31,0x44,0x23,0x91,
+0xdb,0xac,0x8b,0x20,0x35,0x33,0x80,0xcc,0xbb,0x8a,0x42,0x34,0x13,0xa9,0xdb,0xaa,
+0x09,0x21,0x33,0x33,0x12,0xb8,0xce,0xab,0x0a,0x31,0x44,0x13,0x81,0xcb,0xad,0x8b,
+0x40,0x45,0x12,0xb8,0xcd,0x8a,0x31,0x36,0x12,0xca,0xbd,0x8b,0x30,0x36,0x23,0x91,
+0xcc,0xcb,0x8a,0x30,0x44,0x33,0x81,0xdb,0xcc,0x8a,0x20,0x44,0x23,0x81,0xca,0xbc,
+0x9a,0x08,0x43,0x24,0x12,0x90,0xca,0xbc,0x99,0x10,0x34,0x24,0x82,0xc9,0xcb,0x9b,
+0x18,0x44,0x33,0x12,0xba,0xcd,0xab,0x08,0x32,0x44,0x22,0x01,0xa9,0xcd,0xac,0x9a,
+0x31,0x37,0x23,0x91,0xeb,0xbc,0x8a,0x31,0x45,0x23,0x90,0xfb,0xbb,0x89,0x41,0x35,
+0x22,0xb8,0xcc,0xaa,0x08,0x43,0x33,0x81,0xba,0xbc,0x09,0x21,0x24,0x80,0xdb,0xbb,
+0x38,0x55,0x33,0x90,0xdc,0xbb,0x8a,0x42,0x35,0x22,0x90,0xdb,0xbb,0x9b,0x20,0x35,
+0x24,0x01,0xba,0xbc,0x0a,0x41,0x33,0x81,0xcb,0xbc,0x89,0x32,0x44,0x23,0x02,0xd9,
+0xcc,0xbb,0x09,0x63,0x34,0x11,0xb9,0xbd,0x9a,0x10,0x34,0x32,0x80,0xcb,0xac,0x0a,
+0x51,0x34,0x02,0xc9,0xbe,0x9a,0x31,0x44,0x13,0xb8,0xbc,0x89,0x31,0x24,0xa8,0xcd,
+0x9a,0x41,0x44,0x23,0xa8,0xcd,0xbb,0x89,0x41,0x45,0x22,0x90,0xcc,0xbb,0x8a,0x52,
+0x34,0x12,0xa8,0xcc,0xaa,0x08,0x32,0x24,0x01,0x99,0xbb,0x9a,0x18,0x43,0x23,0x91,
+0xcb,0xab,0x88,0x00,0x98,0x09,0x64,0x44,0x02,0xc9,0xac,0x0a,0x41,0x23,0x80,0xcb,
+0xba,0x89,0x10,0x21,0x45,0x34,0x91,0xfb,0xbb,0x09,0x44,0x22,0xa0,0xbc,0x9b,0x28,
+0x32,0x32,0x53,0x24,0x92,0xde,0xbc,0x8a,0x53,0x34,0x01,0xca,0xbb,0x09,0x63,0x33,
+0x81,0xdb,0xbc,0x8a,0x41,0x35,0x13,0xb9,0xbe,0x9c,0x20,0x44,0x23,0x90,0xdb,0xac,
+0x89,0x21,0x34,0x33,0x80,0xea,0xcb,0x9b,0x28,0x35,0x34,0x01,0xb9,0xcc,0xab,0x9a,
+0x10,0x44,0x34,0x34,0x81,0xdb,0xbd,0xab,0x18,0x53,0x34,0x12,0x98,0xcc,0xbb,0x89,
+0x32,0x36,0x02,0xa8,0xbc,0xab,0x28,0x44,0x23,0x90,0xcb,0xab,0x09,0x32,0x34,0x12,
+0x90,0xdb,0xcb,0x9a,0x31,0x37,0x24,0x91,0xcc,0xad,0x8a,0x31,0x44,0x13,0x90,0xdb,
+0xab,0x8a,0x31,0x34,0x33,0x90,0xdb,0xbc,0x8a,0x31,0x36,0x23,0xb0,0xce,0xab,0x19,
+0x54,0x43,0x01,0xc9,0xcc,0x9a,0x21,0x44,0x23,0x90,0xdb,0xcb,0x8a,0x21,0x44,0x12,
+0x91,0xb9,0xac,0x9a,0x20,0x33,0x25,0x02,0xb9,0xdc,0xba,0x88,0x42,0x34,0x12,0xa0,
+0xbd,0xac,0x19,0x42,0x34,0x02,0xb9,0xbe,0xab,0x10,0x44,0x24,0x01,0xa9,0xbb,0x9c,
+0x09,0x21,0x32,0x12,0x90,0x9a,0x8a,0x21,0x34,0x11,0xa9,0xbd,0xbc,0xac,0x9a,0x41,
+0x46,0x24,0x01,0xc9,0xcb,0x99,0x11,0x02,0xb8,0xbc,0x1a,0x65,0x43,0x12,0xc9,0xcc,
+0xab,0x08,0x44,0x34,0x12,0xc9,0xbc,0x9c,0x08,0x33,0x34,0x01,0xa8,0xbb,0xab,0x28,
+0x44,0x34,0x02,0xca,0xbd,0xbc,0x99,0x21,0x45,0x35,0x32,0xa0,0xec,0xbb,0x8a,0x51,
+0x34,0x02,0xb9,0xcc,0x9b,0x10,0x34,0x34,0x11,0xb8,0xeb,0xab,0x9a,0x30,0x63,0x22,
+0x81,0xb9,0xbc,0x8a,0x41,0x35,0x24,0x90,0xdd,0xcb,0x99,0x31,0x45,0x23,0x80,0xca,
+0xbc,0xaa,0x20,0x35,0x24,0x81,0xca,0xcb,0x89,0x30,0x23,0x82,0xba,0xac,0x28,0x55,
+0x33,0x01,0xea,0xbc,0xac,0x09,0x53,0x34,0x23,0x98,0xdb,0xac,0x9a,0x10,0x23,0x33,
+0x02,0xa0,0xaa,0x9b,0x19,0x21,0x02,0xa8,0x9a,0x30,0x44,0x90,0xce,0xac,0x29,0x55,
+0x33,0x81,0xeb,0xbc,0x89,0x42,0x45,0x02,0xc8,0xcc,0xbb,0x18,0x54,0x34,0x12,0xa8,
+0xcd,0xab,0x8a,0x31,0x45,0x12,0x91,0xba,0xac,0x89,0x21,0x22,0x01,0xb9,0xaa,0x18,
+0x44,0x33,0xa0,0xdd,0xbb,0x0a,0x73,0x24,0x13,0xa8,0xbc,0xbb,0x8a,0x01,0x11,0x11,
+0x52,0x54,0x32,0x81,0xdb,0xcd,0xaa,0x0a,0x31,0x45,0x23,0x02,0xa8,0xbc,0xac,0x8a,
+0x08,0x21,0x21,0x32,0x43,0x12,0xa0,0xdc,0xbc,0xab,0x18,0x54,0x34,0x22,0xa0,0xec,
+0xbb,0x8a,0x30,0x35,0x24,0x02,0x98,0xca,0xcc,0xba,0x89,0x51,0x44,0x23,0x91,0xdb,
+0xcb,0x8a,0x20,0x43,0x23,0x81,0xda,0xcb,0x8a,0x20,0x44,0x33,0x80,0xdb,0xab,0x89,
+0x31,0x33,0x01,0xa9,0x9a,0x00,0x00,0xba,0xad,0x40,0x47,0x24,0x80,0xdc,0xcc,0x8a,
+0x20,0x54,0x33,0x02,0xb9,0xbe,0xac,0x89,0x42,0x34,0x23,0xa0,0xcc,0xbc,0x8a,0x31,
+0x45,0x23,0x81,0xcb,0xad,0x9b,0x20,0x63,0x23,0x01,0xb9,0xbd,0xab,0x18,0x43,0x24,
+0x82,0xba,0xae,0x8a,0x41,0x35,0x22,0xa8,0xcd,0xbb,0x0a,0x42,0x35,0x22,0xa0,0xdb,
+0xbb,0x8a,0x30,0x44,0x22,0x90,0xca,0xbb,0x89,0x31,0x44,0x22,0xa8,0xcb,0xab,0x38,
+0x46,0x23,0x81,0xeb,0xbc,0x9a,0x20,0x45,0x24,0x01,0xb9,0xbd,0xbb,0x09,0x43,0x34,
+0x33,0x01,0xa8,0xcc,0xbc,0xab,0x0a,0x52,0x44,0x23,0x81,0xc9,0xbc,0x9b,0x18,0x43,
+0x33,0x82,0xc9,0xbb,0x8a,0x31,0x35,0x81,0xca,0xcb,0x09,0x52,0x34,0x01,0xb9,0xcd,
+0xaa,0x08,0x32,0x35,0x24,0x01,0xb8,0xcd,0xcb,0x9a,0x28,0x63,0x33,0x13,0xa0,0xdb,
+0xac,0x9a,0x20,0x53,0x23,0x81,0xda,0xbb,0x8a,0x52,0x34,0x03,0xca,0xcc,0x9a,0x30,
+0x35,0x23,0x90,0xdc,0xac,0x99,0x21,0x44,0x33,0x82,0xc9,0xbc,0xac,0x88,0x32,0x25,
+0x13,0x98,0xca,0xbb,0x89,0x21,0x23,0x11,0x98,0x08,0x42,0x24,0x91,0xec,0xbd,0xaa,
+0x20,0x54,0x34,0x02,0xa0,0xdb,0xac,0xaa,0x09,0x20,0x53,0x44,0x33,0x02,0xb9,0xce,
+0xbb,0x99,0x21,0x34,0x32,0x01,0x98,0x99,0x89,0x08,0x98,0xcb,0xcd,0x9a,0x30,0x46,
+0x24,0x81,0xda,0xbc,0x9b,0x28,0x54,0x24,0x12,0xb8,0xdc,0xaa,0x09,0x32,0x25,0x81,
+0xba,0xac,0x29,0x45,0x23,0xa0,0xcd,0xac,0x0a,0x41,0x44,0x22,0x90,0xda,0xbb,0xab,
+0x20,0x44,0x34,0x01,0xa8,0xbc,0xac,0x09,0x31,0x44,0x33,0x81,0xca,0xbe,0x9b,0x29,
+0x63,0x24,0x02,0xa9,0xbc,0xab,0x18,0x44,0x33,0x02,0xda,0xcc,0x9a,0x18,0x44,0x33,
+0x81,0xda,0xbc,0x9a,0x30,0x44,0x23,0x80,0xba,0xad,0x9b,0x00,0x42,0x22,0x01,0x88,
+0x08,0x21,0x12,0xe9,0xce,0xab,0x19,0x73,0x43,0x12,0x98,0xcc,0xcb,0x89,0x30,0x35,
+0x14,0x81,0xcb,0xbc,0x8a,0x30,0x34,0x24,0x80,0xdb,0xbb,0x89,0x43,0x44,0x11,0xb9,
+0xcd,0x9a,0x20,0x63,0x23,0x01,0xca,0xcc,0x9b,0x29,0x63,0x33,0x03,0xc8,0xcc,0xaa,
+0x09,0x33,0x35,0x02,0x98,0xbc,0xbb,0x09,0x43,0x34,0x03,0xb9,0xcc,0xab,0x10,0x44,
+0x32,0x81,0xba,0xae,0x9b,0x18,0x63,0x43,0x02,0xb8,0xcd,0xab,0x08,0x53,0x33,0x12,
+0xc9,0xcc,0xaa,0x18,0x52,0x33,0x03,0xb0,0xcc,0xbb,0x8a,0x21,0x34,0x33,0x02,0x80,
+0xb9,0xcb,0xcc,0xaa,0x09,0x42,0x35,0x24,0x02,0x80,0xcb,0xcc,0xab,0x8a,0x41,0x34,
+0x33,0x81,0xaa,0xbb,0x9b,0x98,0x99,0x9a,0x18,0x55,0x44,0x12,0x90,0xeb,0xcb,0xbb,
+0x18,0x73,0x44,0x22,0x81,0xc9,0xbc,0xac,0x9a,0x08,0x43,0x35,0x24,0x02,0xb8,0xcc,
+0xab,0x9a,0x20,0x42,0x12,0x00,0x08,0x08,0x11,0x91,0xcc,0xbc,0x09,0x64,0x43,0x01,
+0xca,0xcc,0xaa,0x10,0x53,0x22,0x01,0x9a,0x8a,0x31,0x35,0x82,0xfc,0xcc,0xaa,0x19,
+0x53,0x34,0x13,0x90,0xca,0xab,0x8a,0x10,0x11,0x90,0xda,0xab,0x28,0x55,0x34,0x12,
+0xc9,0xcc,0xaa,0x19,0x42,0x33,0x02,0xba,0xbe,0xaa,0x18,0x44,0x34,0x13,0xa0,0xcc,
+0xcb,0x99,0x18,0x22,0x23,0x23,0x01,0xa9,0xbd,0xab,0x09,0x42,0x23,0x80,0xbb,0xbc,
+0x89,0x10,0x32,0x46,0x35,0x24,0x81,0xcb,0xbd,0xcb,0xa9,0x99,0x08,0x41,0x46,0x34,
+0x23,0x01,0xc9,0xbc,0xcd,0xaa,0x89,0x42,0x45,0x23,0x81,0xca,0xbc,0x9a,0x31,0x44,
+0x13,0x91,0xcb,0xcc,0xaa,0x89,0x21,0x44,0x33,0x23,0x12,0x98,0xcc,0xcd,0xbb,0x9a,
+0x10,0x35,0x25,0x23,0x01,0xb8,0xdb,0xac,0x99,0x10,0x21,0x02,0x00,0x21,0x44,0x23,
+0xc8,0xce,0xac,0x89,0x42,0x35,0x33,0x81,0xda,0xcc,0xab,0x89,0x31,0x45,0x23,0x12,
+0x99,0xcc,0xcb,0x9a,0x08,0x32,0x34,0x23,0x11,0x10,0x11,0xb8,0xef,0xcb,0xab,0x18,
+0x53,0x44,0x12,0x81,0xb9,0xbc,0xbb,0x08,0x42,0x34,0x12,0xa0,0xbb,0xac,0x8a,0x20,
+0x43,0x24,0x12,0x81,0x99,0xa9,0xdb,0xde,0xbc,0x9c,0x29,0x54,0x35,0x22,0x81,0xcb,
+0xbc,0xbb,0x0a,0x21,0x34,0x22,0x81,0x98,0x00,0x43,0x23,0xb0,0xde,0xbb,0x8a,0x41,
+0x35,0x22,0xb8,0xdc,0xab,0x19,0x53,0x35,0x23,0x90,0xdb,0xbd,0xba,0x09,0x31,0x35,
+0x33,0x12,0x90,0xba,0xbc,0xaa,0xab,0xac,0xac,0x89,0x73,0x35,0x24,0x02,0xc9,0xcb,
+0x9b,0x08,0x33,0x33,0x80,0xca,0xbb,0x09,0x42,0x35,0x22,0x81,0xaa,0xac,0xab,0xaa,
+0xbd,0xbc,0x0a,0x73,0x35,0x34,0x01,0xb8,0xdb,0xbb,0xbb,0x9b,0x08,0x52,0x34,0x34,
+0x24,0x11,0x80,0xb9,0xbd,0xac,0x9b,0x88,0x00,0x00,0x21,0x56,0x34,0x34,0x01,0xb8,
+0xcc,0xbb,0xaa,0x99,0x89,0x18,0x31,0x44,0x34,0x43,0x22,0x02,0xc9,0xdd,0xcb,0xab,
+0x89,0x11,0x43,0x23,0x33,0x32,0x02,0xb8,0xcd,0xbb,0x99,0x98,0xdb,0xbe,0xbb,0x30,
+0x67,0x33,0x14,0x81,0xba,0xcc,0xbb,0x99,0x08,0x21,0x32,0x43,0x34,0x33,0x33,0xa0,
+0xdd,0xcc,0xab,0xaa,0x18,0x42,0x44,0x33,0x12,0xa8,0xbc,0xac,0x09,0x31,0x23,0xc8,
+0xcd,0x9b,0x28,0x55,0x23,0x81,0xca,0xbc,0x8a,0x30,0x33,0x03,0xc9,0xad,0x9b,0x21,
+0x44,0x22,0x81,0xa9,0xaa,0x38,0x54,0x23,0xa0,0xcd,0xac,0x89,0x42,0x35,0x22,0x00,
+0xa9,0x89,0x00,0xa8,0xdd,0xbc,0x9b,0x31,0x47,0x33,0x13,0xb9,0xbe,0xad,0x8a,0x20,
+0x53,0x23,0x81,0xba,0xbc,0x8a,0x11,0x13,0xa1,0xeb,0xaa,0x20,0x56,0x23,0x12,0xba,
+0xbe,0xbb,0x09,0x32,0x35,0x12,0x81,0x99,0xbb,0xdb,0x9a,0x19,0x62,0x43,0x33,0x82,
+0xc8,0xbc,0xad,0x8a,0x41,0x44,0x23,0x80,0xcb,0xab,0x28,0x43,0x12,0xc9,0xbc,0x09,
+0x52,0x25,0x12,0xa8,0xdb,0xbb,0x9b,0x10,0x44,0x24,0x02,0xa8,0xcc,0xab,0x9a,0x08,
+0x32,0x35,0x23,0xa0,0xdd,0xbc,0x9a,0x20,0x34,0x23,0x90,0xcb,0xab,0x18,0x54,0x34,
+0x33,0x81,0xca,0xbc,0xac,0x09,0x21,0x44,0x32,0x22,0x80,0x9a,0x08,0x44,0x24,0xb8,
+0xdf,0xbb,0x8a,0x52,0x35,0x12,0xa0,0xdb,0xbb,0x0a,0x42,0x34,0x14,0x80,0xcb,0xcc,
+0xaa,0x09,0x31,0x44,0x23,0x82,0xc9,0xcc,0xab,0x89,0x20,0x23,0x02,0x98,0x89,0x30,
+0x33,0xb0,0xff,0xac,0x9a,0x20,0x44,0x43,0x11,0xa9,0xcc,0xbb,0x09,0x41,0x34,0x13,
+0xa8,0xdb,0x9a,0x18,0x43,0x33,0x91,0xca,0xbc,0x99,0x42,0x44,0x23,0xb8,0xde,0xbb,
+0x09,0x52,0x34,0x01,0xa9,0xad,0x9a,0x20,0x21,0x81,0xaa,0x09,0x63,0x34,0x02,0xda,
+0xcc,0x9b,0x19,0x43,0x34,0x11,0xc9,0xdb,0x9a,0x18,0x43,0x25,0x02,0xa8,0xcb,0xab,
+0x18,0x42,0x23,0x81,0xca,0xab,0x18,0x45,0x34,0x02,0x90,0xda,0xdb,0xab,0x9a,0x41,
+0x46,0x33,0x02,0xc9,0xcc,0x9b,0x09,0x31,0x34,0x12,0xa8,0xcb,0xac,0x09,0x21,0x34,
+0x43,0x11,0x90,0xaa,0xaa,0x08,0x80,0xea,0xbd,0x9c,0x41,0x47,0x24,0x11,0xb9,0xbd,
+0x9c,0x89,0x10,0x22,0x22,0x12,0x00,0xa8,0xba,0xac,0x99,0x98,0xca,0xbb,0x29,0x55,
+0x34,0x82,0xeb,0xac,0x09,0x62,0x43,0x12,0xa8,0xcd,0xbb,0x9b,0x20,0x34,0x34,0x12,
+0x00,0x89,0x99,0xa9,0xa9,0xaa,0x09,0x21,0x33,0x13,0x91,0xa0,0xb8,0xa9,0x30,0x77,
+0x33,0x91,0xed,0xbb,0x38,0x67,0x24,0x13,0x98,0xbc,0xbb,0x10,0x35,0x14,0xa8,0xcc,
+0xab,0x28,0x54,0x32,0x02,0x80,0x08,0x08,0xca,0xdd,0xcb,0x8a,0x20,0x44,0x22,0x80,
+0xb9,0xbc,0x89,0x41,0x35,0x24,0x98,0xeb,0xab,0x09,0x53,0x24,0x81,0xb9,0xac,0x8a,
+0x21,0x13,0x90,0xbb,0x8b,0x41,0x43,0x81,0xca,0xbc,0x8a,0x18,0x00,0xca,0xbb,0x0a,
+0x31,0xa0,0xdf,0xac,0x20,0x46,0x23,0x91,0xca,0x8b,0x41,0x34,0x81,0xeb,0xab,0x18,
+0x45,0x23,0x02,0xa8,0xcb,0xcc,0xbc,0xaa,0x28,0x36,0x25,0x11,0x98,0x89,0x10,0x34,
+0x33,0x32,0x32,0x22,0xc8,0xdd,0xab,0x18,0x45,0x33,0x01,0xa9,0xab,0x89,0xb8,0xdd,
+0xcc,0x9a,0x20,0x34,0x22,0xa8,0xdc,0xab,0x18,0x53,0x34,0x12,0xb8,0xce,0xac,0xab,
+0x08,0x31,0x34,0x13,0x90,0xbb,0x8a,0x72,0x34,0x03,0xe9,0xbc,0x9a,0x40,0x44,0x22,
+0x80,0xaa,0x9a,0x10,0x01,0xd9,0xdc,0xaa,0x19,0x62,0x33,0x13,0xa8,0xbc,0x9c,0x18,
+0x53,0x32,0x81,0xaa,0xbc,0xab,0x09,0x21,0x44,0x33,0x12,0xc9,0xbd,0xbc,0x9a,0x08,
+0x18,0x43,0x54,0x24,0x81,0xdb,0xcd,0xaa,0x88,0x22,0x24,0x12,0x88,0xba,0xab,0x1a,
+0x64,0x34,0x24,0x22,0x12,0x32,0x02,0xe9,0xdd,0xbb,0x8a,0x31,0x34,0x02,0xc9,0xbb,
+0x8a,0x31,0x45,0x33,0x13,0xb8,0xce,0xcb,0x89,0x52,0x34,0x13,0xc9,0xcd,0xab,0x09,
+0x11,0x12,0x80,0xba,0xab,0x28,0x54,0x34,0x22,0x90,0xdc,0xbb,0x8b,0x42,0x44,0x02,
+0x98,0xbb,0x9a,0x18,0x22,0x11,0x21,0x43,0x13,0xda,0xbd,0x09,0x65,0x44,0x23,0x00,
+0xca,0xbb,0x9b,0x18,0x43,0x12,0xc9,0xce,0xbc,0xaa,0x10,0x34,0x25,0x01,0xb9,0xcb,
+0x8a,0x42,0x34,0x13,0xb8,0xbe,0xab,0x08,0x22,0x24,0x23,0x13,0x90,0xce,0xad,0x8b,
+0x30,0x35,0x02,0xb9,0xbd,0x8a,0x42,0x34,0x24,0x01,0x80,0x88,0xb9,0xbb,0xab,0x28,
+0x43,0x33,0x01,0x80,0xa9,0xda,0xcd,0xcc,0xbb,0xac,0x99,0x42,0x46,0x33,0x02,0xd9,
+0xbd,0xac,0x09,0x41,0x44,0x22,0x80,0xb9,0xac,0x8a,0x10,0x11,0x90,0xdb,0x9a,0x30,
+0x35,0x14,0xa8,0xcb,0x8b,0x72,0x34,0x23,0xc9,0xbe,0xac,0x08,0x44,0x43,0x11,0xa8,
+0xcb,0x8a,0x20,0x44,0x12,0xa0,0xdb,0xaa,0x10,0x44,0x02,0xc9,0xcd,0xab,0x09,0x43,
+0x24,0x12,0xa8,0xa9,0x18,0x43,0x33,0x90,0xce,0xac,0x0a,0x41,0x34,0x12,0xc9,0xbd,
+0xac,0x09,0x42,0x24,0x13,0xa8,0xbc,0xab,0x30,0x37,0x14,0x91,0xdb,0xbb,0x8a,0x42,
+0x35,0x23,0x91,0xba,0xbc,0x8a,0x31,0x35,0x13,0x90,0xdb,0xab,0x18,0x34,0x24,0x01,
+0xba,0xcb,0x9a,0x99,0xea,0xdc,0xbc,0x9a,0x20,0x36,0x34,0x11,0xb9,0xdb,0xab,0x89,
+0x11,0x33,0x43,0x22,0x11,0x88,0xa9,0xba,0xcc,0xcb,0xbb,0x08,0x63,0x44,0x32,0x01,
+0x98,0xaa,0xba,0xdb,0xba,0x0a,0x73,0x45,0x32,0x01,0xba,0xbc,0xaa,0x88,0x88,0x98,
+0x18,0x74,0x34,0x24,0x91,0xda,0xbc,0x9b,0x08,0x53,0x33,0x80,0xec,0xcb,0x9a,0x21,
+0x44,0x23,0xa0,0xdb,0xac,0x0a,0x41,0x53,0x13,0x81,0xb9,0xab,0x18,0x73,0x33,0x13,
+0x90,0xca,0xaa,0x09,0x31,0x43,0x03,0xe9,0xdc,0xbb,0x89,0x42,0x24,0x03,0x98,0xab,
+0x8a,0x21,0x01,0xfb,0xbc,0xbb,0x08,0x22,0x11,0xba,0xae,0x1a,0x73,0x44,0x33,0x12,
+0x90,0xdb,0xbc,0xab,0x19,0x54,0x33,0x91,0xeb,0xbc,0x9b,0x09,0x10,0x12,0x10,0x11,
+0x01,0x89,0x28,0x67,0x44,0x22,0x90,0xdb,0xbb,0x09,0x52,0x43,0x12,0x80,0xb9,0xbc,
+0xab,0x8a,0x31,0x34,0x13,0x88,0x28,0x56,0x24,0x82,0xdc,0xad,0x8b,0x30,0x45,0x33,
+0x80,0xdb,0xbc,0x9b,0x28,0x53,0x33,0x01,0xb9,0xbc,0x9b,0x40,0x44,0x33,0x12,0xba,
+0xbf,0xbb,0x8a,0x30,0x34,0x24,0x01,0x99,0xbb,0xbb,0x9a,0x41,0x57,0x53,0x22,0x80,
+0xda,0xac,0x9b,0x20,0x53,0x22,0x98,0xcd,0xbb,0x0a,0x51,0x33,0x13,0xb8,0xbc,0x8b,
+0x30,0x35,0x23,0x91,0xc9,0xca,0xba,0x9a,0x21,0x36,0x24,0xa0,0xcd,0xbc,0x99,0x31,
+0x43,0x23,0x90,0xba,0xbb,0x09,0x73,0x53,0x12,0x90,0xba,0x9b,0x51,0x45,0x13,0x91,
+0xeb,0xcb,0xbb,0x9a,0x88,0x11,0x02,0x80,0xba,0x0a,0x74,0x44,0x23,0x81,0xda,0xcb,
+0xaa,0x89,0x21,0x24,0x01,0xc9,0xcc,0xaa,0x09,0x21,0x33,0x35,0x35,0x24,0x81,0xba,
+0xbd,0x89,0x52,0x33,0x82,0xda,0xab,0x89,0x31,0x33,0x81,0x99,0xaa,0xa9,0xdb,0xbb,
+0x28,0x47,0x33,0xa1,0xce,0xab,0x20,0x37,0x25,0x12,0x99,0xcb,0xab,0x08,0x22,0x23,
+0xb0,0xcf,0xbc,0x8a,0x10,0x12,0xa8,0xbb,0x48,0x47,0x24,0x81,0xca,0xbb,0x89,0x32,
+0x23,0xc9,0xcd,0xbb,0x89,0x41,0x44,0x22,0x98,0xcd,0x9b,0x38,0x46,0x33,0x91,0xcc,
+0xbb,0x9a,0x22,0x25,0x23,0x81,0xa9,0xdb,0xab,0x09,0x54,0x34,0x22,0x90,0xdb,0xbb,
+0xac,0x9a,0x09,0x10,0x34,0x35,0x22,0x80,0xca,0xbc,0x9b,0x18,0x54,0x33,0x81,0xcb,
+0xbb,0x09,0x43,0x01,0xfb,0xbb,0x19,0x44,0x25,0x12,0x98,0xba,0xbb,0x9b,0x40,0x56,
+0x34,0x12,0xc9,0xcd,0x9b,0x19,0x43,0x24,0x81,0xb9,0xbb,0x8b,0x10,0x23,0x02,0xc9,
+0xcd,0xab,0x89,0x32,0x14,0xa1,0xda,0x9a,0x20,0x44,0x13,0x01,0x99,0x99,0xda,0xdd,
+0xcb,0x9a,0x18,0x21,0x22,0x01,0x32,0x43,0x90,0xdd,0xbc,0x09,0x54,0x34,0x14,0x80,
+0xba,0xad,0x8a,0x31,0x45,0x24,0x11,0xb9,0xcc,0xab,0x8a,0x10,0x32,0x22,0x81,0xa9,
+0x99,0x31,0x54,0x12,0xda,0xce,0xac,0x9a,0x30,0x44,0x14,0x81,0xbb,0xad,0x19,0x42,
+0x34,0x02,0xb8,0xdb,0x9a,0x18,0x32,0x33,0x02,0xb9,0xbd,0x8a,0x63,0x34,0x91,0xdd,
+0xbc,0x8b,0x30,0x35,0x13,0xa0,0xdb,0x9b,0x19,0x42,0x34,0x22,0x91,0xdb,0xbb,0x29,
+0x55,0x24,0x82,0xc9,0xbc,0x8a,0x20,0x32,0x80,0xdb,0x9b,0x10,0x34,0x92,0xec,0xcb,
+0x9a,0x00,0x12,0x00,0x89,0x31,0x36,0x23,0xb8,0xad,0x1a,0x54,0x35,0x12,0x80,0xbb,
+0xbe,0xbb,0x9a,0x41,0x45,0x22,0x90,0xcb,0xab,0x30,0x45,0x22,0x90,0xcb,0xab,0x08,
+0x63,0x44,0x32,0x01,0xba,0xac,0x0a,0x53,0x24,0x82,0xba,0xbd,0x8a,0x20,0x22,0xa0,
+0xdb,0xab,0x40,0x55,0x43,0x01,0xb8,0xbd,0x9b,0x20,0x53,0x03,0xb0,0xbe,0xbb,0x0a,
+0x31,0x44,0x23,0x02,0xa8,0xbc,0x9b,0x40,0x45,0x23,0x90,0xcc,0xad,0x9a,0x31,0x46,
+0x33,0x81,0xda,0xcb,0x99,0x31,0x43,0x02,0xc9,0xcb,0x99,0x20,0x42,0x21,0x81,0x98,
+0xb9,0xba,0x9a,0x31,0x25,0x92,0xdb,0xac,0x19,0x43,0x82,0xeb,0xbd,0x89,0x51,0x34,
+0x14,0x81,0xa9,0xbb,0xab,0x9a,0xaa,0xbc,0x9a,0x62,0x36,0x24,0x91,0xdb,0xac,0x09,
+0x32,0x34,0x82,0xdb,0xbb,0x0a,0x62,0x34,0x12,0xa0,0xbd,0xac,0x09,0x31,0x35,0x23,
+0x01,0x99,0xba,0xcb,0x99,0x20,0x53,0x02,0xe9,0xbc,0x9b,0x31,0x45,0x02,0xa0,0xba,
+0x89,0x00,0x00,0x09,0x73,0x47,0x24,0x01,0xca,0xbd,0xaa,0x08,0x22,0x23,0x81,0x88,
+0x00,0x21,0x81,0xdc,0xbd,0x0b
+};
@@ -0,0 +1,2591 @@
+// This file was generated by executing this statement: wav2c -a pacmanDeath.wav
+
+#include <stdint.h>
+
+const uint8_t pacmanDeath_wav_adpcm[41356] = {
+0x1b,0x47,0x01,0xa0,0xc0,0x8a,0x0b,0x2b,0x3a,0x99,0xab,0x8d,0x3b,0x79,0x52,0x11,
+0x90,0x90,0x10,0x11,0xd2,0xa8,0x3a,0x7a,0x20,0x98,0xd9,0xb9,0x9b,0x1d,0x2a,0x58,
+0x31,0x10,0x80,0x98,0x9c,0x0e,0x1c,0x08,0x92,0xf9,0xba,0x09,0x35,0x26,0x11,0xaa,
+0x9c,0x2b,0x49,0x21,0x23,0x22,0x19,0x0b,0xad,0xb8,0xb2,0xb9,0xb1,0x92,0x13,0xb2,
+0xb1,0xb3,0x15,0x22,0xb9,0xbd,0x9b,0x10,0x25,0x21,0x99,0x8c,0x1b,0x9b,0xbb,0x9b,
+0x5a,0x44,0x34,0x23,0x09,0xbd,0xdb,0xa9,0x10,0x32,0x92,0xd1,0x9b,0x2d,0x4a,0x30,
+0x53,0x21,0x8b,0x9f,0x9b,0x08,0x11,0x08,0x1b,0x51,0x42,0x80,0x90,0x23,0x17,0x91,
+0xac,0x0b,0x32,0x91,0xbf,0x9d,0x1a,0x10,0x12,0x31,0x30,0x31,0x23,0x27,0x16,0x91,
+0xba,0xad,0x9a,0xa9,0xba,0x18,0x25,0x85,0xb9,0xbd,0xaa,0xa0,0x99,0x29,0x35,0x17,
+0x02,0x2a,0x2b,0x19,0x39,0x4a,0x10,0xca,0xcc,0x08,0x44,0x82,0xfa,0xa8,0x43,0x35,
+0x22,0x09,0x00,0x03,0xc9,0xcd,0xaa,0x09,0x99,0x9d,0x8a,0x32,0x35,0x14,0x01,0x09,
+0x8b,0x2a,0x52,0x82,0xdd,0xae,0x9a,0x10,0x10,0x38,0x73,0x34,0x13,0xa9,0xad,0x9a,
+0x81,0x02,0x21,0x40,0x11,0xd1,0xfa,0xdb,0xa9,0x18,0x33,0x24,0x81,0xaa,0x9a,0x08,
+0x9a,0x3a,0x74,0x37,0x02,0xb9,0xac,0x99,0x01,0x91,0x28,0x73,0x12,0xc8,0xbe,0x9b,
+0x10,0x23,0x00,0x0a,0x48,0x32,0xb1,0xcf,0xab,0x19,0x34,0x24,0x80,0xbb,0x8b,0x58,
+0x73,0x31,0x11,0xaa,0x9c,0x39,0x74,0x22,0x90,0xcb,0xad,0x9b,0x0a,0x21,0x24,0x03,
+0xa0,0x9a,0x18,0x24,0xb2,0xf9,0x99,0x32,0x35,0x01,0xc9,0xca,0x88,0x11,0x03,0xb2,
+0x99,0x59,0x46,0x22,0xb8,0xbf,0x9b,0x19,0x33,0x13,0x03,0x00,0x09,0x8b,0xab,0xac,
+0x49,0x74,0x35,0x01,0xea,0xcb,0x9b,0x09,0x28,0x30,0x31,0x01,0xa9,0x00,0xb9,0xff,
+0x9b,0x50,0x25,0x92,0xcb,0x1a,0x45,0x93,0xec,0x8b,0x72,0x23,0xc8,0xbd,0x39,0x37,
+0x03,0xec,0xab,0x72,0x67,0x33,0x12,0x90,0xbb,0xac,0x09,0x32,0x35,0x43,0x22,0x11,
+0x88,0x98,0x20,0x54,0x34,0x12,0xca,0xcf,0xcc,0xab,0xab,0x0a,0x10,0x21,0x12,0x80,
+0x88,0x00,0x42,0x54,0x44,0x23,0x12,0xa0,0xdb,0xcb,0xab,0x89,0x31,0x45,0x33,0x14,
+0x02,0x88,0x88,0x21,0x44,0x34,0x12,0xc8,0xde,0xbc,0xbc,0xaa,0x0a,0x10,0x21,0x12,
+0x01,0x88,0x08,0x41,0x54,0x53,0x33,0x23,0x90,0xdb,0xbc,0x9c,0x0a,0x20,0x44,0x43,
+0x22,0x11,0x88,0x98,0x20,0x53,0x34,0x13,0xc8,0xde,0xcc,0xbb,0x9c,0x89,0x18,0x21,
+0x11,0x00,0x88,0x08,0x20,0x54,0x34,0x25,0x22,0x90,0xca,0xbc,0xac,0x99,0x20,0x53,
+0x53,0x22,0x11,0x88,0x89,0x18,0x44,0x34,0x22,0xb8,0xee,0xbc,0xbc,0xab,0x89,0x10,
+0x22,0x12,0x01,0x88,0x09,0x20,0x45,0x35,0x34,0x23,0x91,0xdb,0xbc,0xac,0x89,0x10,
+0x53,0x53,0x22,0x11,0x88,0x89,0x18,0x53,0x24,0x23,0xb0,0xde,0xbd,0xbd,0xba,0x8a,
+0x18,0x21,0x21,0x01,0x88,0x09,0x30,0x45,0x45,0x33,0x22,0x81,0xca,0xcc,0xba,0x99,
+0x20,0x53,0x44,0x22,0x02,0x80,0x88,0x00,0x43,0x44,0x23,0x90,0xdd,0xcd,0xac,0xbb,
+0x8a,0x08,0x22,0x12,0x11,0x88,0x09,0x20,0x45,0x35,0x25,0x23,0x00,0xba,0xcc,0xab,
+0x8b,0x28,0x44,0x35,0x32,0x12,0x88,0x98,0x00,0x53,0x44,0x22,0x81,0xec,0xdc,0xbb,
+0xac,0x9a,0x00,0x21,0x21,0x01,0x88,0x88,0x10,0x44,0x45,0x33,0x24,0x81,0xa9,0xbd,
+0xbc,0xa9,0x10,0x53,0x43,0x23,0x22,0x80,0x88,0x08,0x43,0x35,0x25,0x80,0xfb,0xcc,
+0xbc,0xac,0x99,0x08,0x20,0x11,0x11,0x88,0x88,0x10,0x63,0x53,0x24,0x23,0x01,0xb9,
+0xbd,0xbc,0xaa,0x10,0x43,0x35,0x33,0x13,0x81,0x88,0x08,0x52,0x35,0x43,0x81,0xdc,
+0xcd,0xbc,0xac,0x9a,0x08,0x20,0x21,0x11,0x80,0x88,0x10,0x53,0x35,0x35,0x23,0x02,
+0xb9,0xbd,0xbc,0x9b,0x18,0x43,0x35,0x34,0x12,0x01,0x89,0x08,0x41,0x44,0x33,0x82,
+0xfa,0xcd,0xbc,0xac,0x9a,0x08,0x11,0x22,0x11,0x80,0x80,0x10,0x52,0x44,0x34,0x33,
+0x12,0xb8,0xcd,0xbb,0x9b,0x19,0x53,0x44,0x32,0x23,0x00,0x98,0x88,0x41,0x44,0x24,
+0x82,0xea,0xcd,0xdb,0xab,0x9a,0x09,0x20,0x21,0x11,0x00,0x88,0x18,0x52,0x54,0x43,
+0x33,0x11,0xa9,0xdc,0xbb,0x9b,0x09,0x43,0x44,0x43,0x12,0x81,0x90,0x88,0x30,0x54,
+0x24,0x02,0xd9,0xcd,0xcc,0xba,0xaa,0x88,0x11,0x32,0x12,0x81,0x88,0x08,0x42,0x36,
+0x35,0x33,0x12,0xa8,0xdc,0xcb,0xaa,0x89,0x31,0x44,0x24,0x23,0x02,0x80,0x89,0x18,
+0x52,0x35,0x24,0x80,0xfb,0xbd,0xbd,0xab,0xaa,0x08,0x11,0x22,0x12,0x00,0x89,0x08,
+0x52,0x45,0x34,0x24,0x12,0x90,0xca,0xbc,0xbb,0x9a,0x30,0x54,0x34,0x33,0x12,0x80,
+0x88,0x18,0x52,0x34,0x34,0x01,0xeb,0xce,0xdb,0xbb,0xaa,0x88,0x11,0x32,0x11,0x81,
+0x80,0x08,0x32,0x46,0x35,0x43,0x23,0x00,0xca,0xcc,0xba,0x99,0x20,0x53,0x34,0x33,
+0x12,0x81,0x98,0x09,0x51,0x44,0x43,0x01,0xd9,0xec,0xcb,0xbb,0xaa,0x89,0x20,0x21,
+0x13,0x01,0x88,0x88,0x31,0x56,0x53,0x33,0x33,0x81,0xc9,0xcc,0xbb,0x9a,0x08,0x53,
+0x34,0x34,0x22,0x81,0x88,0x88,0x31,0x54,0x24,0x12,0xb8,0xdf,0xcc,0xbb,0xbb,0x8a,
+0x00,0x22,0x23,0x01,0x88,0x08,0x20,0x64,0x44,0x43,0x23,0x02,0xa9,0xbd,0xad,0x9b,
+0x09,0x42,0x53,0x33,0x22,0x11,0x88,0x09,0x20,0x54,0x34,0x13,0xb8,0xdf,0xcc,0xbb,
+0xac,0x89,0x18,0x11,0x12,0x11,0x88,0x08,0x10,0x63,0x44,0x43,0x23,0x12,0xa8,0xcc,
+0xcb,0xaa,0x09,0x31,0x45,0x43,0x22,0x02,0x80,0x89,0x20,0x53,0x34,0x23,0xa0,0xed,
+0xcd,0xcb,0xab,0x9a,0x18,0x11,0x22,0x02,0x00,0x98,0x10,0x52,0x45,0x53,0x23,0x12,
+0xa0,0xcb,0xbd,0xaa,0x0a,0x21,0x35,0x44,0x22,0x12,0x80,0x89,0x08,0x43,0x45,0x22,
+0x91,0xdc,0xcd,0xbc,0xbb,0x9b,0x09,0x11,0x32,0x12,0x80,0x98,0x88,0x52,0x55,0x43,
+0x33,0x12,0x90,0xcb,0xbd,0xac,0x99,0x20,0x53,0x53,0x32,0x12,0x00,0x88,0x08,0x42,
+0x34,0x34,0x01,0xea,0xcd,0xcc,0xbb,0xaa,0x09,0x20,0x22,0x11,0x80,0x98,0x88,0x41,
+0x54,0x44,0x43,0x12,0x81,0xba,0xbd,0xac,0x9a,0x10,0x53,0x43,0x33,0x22,0x00,0x89,
+0x08,0x41,0x35,0x34,0x12,0xd9,0xce,0xbd,0xcb,0xaa,0x89,0x18,0x22,0x21,0x00,0x88,
+0x08,0x21,0x55,0x34,0x34,0x23,0x82,0xb9,0xcd,0xbb,0xab,0x08,0x53,0x44,0x33,0x23,
+0x81,0x88,0x09,0x21,0x45,0x34,0x12,0xc0,0xed,0xdb,0xcb,0xaa,0x89,0x18,0x21,0x22,
+0x01,0x80,0x88,0x10,0x63,0x44,0x24,0x33,0x11,0xa9,0xcc,0xac,0x9b,0x09,0x42,0x34,
+0x25,0x22,0x01,0x88,0x88,0x10,0x44,0x43,0x13,0xb0,0xde,0xcc,0xbc,0xab,0x9a,0x08,
+0x21,0x22,0x02,0x80,0x88,0x10,0x63,0x35,0x35,0x33,0x12,0xa0,0xcc,0xbc,0xab,0x89,
+0x31,0x45,0x24,0x33,0x11,0x90,0x98,0x18,0x53,0x35,0x23,0x91,0xed,0xcc,0xbc,0xbb,
+0xaa,0x08,0x20,0x22,0x13,0x01,0x89,0x09,0x31,0x46,0x45,0x33,0x23,0x82,0xb9,0xcd,
+0xac,0x9b,0x89,0x32,0x35,0x35,0x23,0x11,0x80,0x98,0x00,0x53,0x44,0x23,0x82,0xfa,
+0xdc,0xbc,0xcb,0xaa,0x88,0x00,0x22,0x21,0x01,0x80,0x98,0x10,0x54,0x44,0x34,0x23,
+0x12,0x98,0xbc,0xbd,0xab,0x8a,0x30,0x54,0x43,0x23,0x13,0x81,0x88,0x09,0x41,0x44,
+0x34,0x12,0xc8,0xdd,0xcc,0xcb,0xab,0x99,0x00,0x21,0x21,0x11,0x00,0x88,0x08,0x43,
+0x45,0x44,0x33,0x13,0x81,0xcb,0xcc,0xbb,0x9b,0x18,0x53,0x34,0x34,0x22,0x01,0x98,
+0x88,0x20,0x54,0x43,0x23,0x90,0xfc,0xcc,0xbc,0xcb,0x99,0x09,0x10,0x12,0x11,0x00,
+0x98,0x08,0x20,0x64,0x53,0x43,0x23,0x11,0xa9,0xdb,0xcb,0xaa,0x09,0x31,0x36,0x34,
+0x33,0x11,0x80,0x99,0x00,0x43,0x35,0x24,0x81,0xea,0xcd,0xcc,0xbb,0xab,0x99,0x10,
+0x22,0x22,0x11,0x08,0x89,0x18,0x54,0x45,0x43,0x23,0x12,0x90,0xdb,0xbc,0xbb,0x9a,
+0x21,0x45,0x24,0x33,0x13,0x81,0x98,0x88,0x31,0x45,0x44,0x02,0xb0,0xed,0xcc,0xbb,
+0xac,0x99,0x18,0x20,0x21,0x11,0x81,0x88,0x08,0x42,0x45,0x44,0x23,0x13,0x81,0xc9,
+0xbc,0xbc,0xaa,0x18,0x43,0x44,0x33,0x33,0x02,0x90,0x89,0x10,0x45,0x34,0x33,0x91,
+0xed,0xcc,0xbc,0xac,0x9b,0x88,0x20,0x21,0x12,0x01,0x88,0x80,0x21,0x45,0x35,0x25,
+0x23,0x02,0xa9,0xcc,0xcb,0xaa,0x89,0x31,0x44,0x34,0x33,0x12,0x80,0x98,0x00,0x52,
+0x44,0x33,0x02,0xe9,0xdd,0xdb,0xbb,0xbb,0x89,0x18,0x22,0x22,0x11,0x80,0x89,0x10,
+0x54,0x45,0x43,0x33,0x12,0x98,0xcb,0xbd,0xbb,0x9a,0x20,0x44,0x44,0x32,0x12,0x81,
+0x98,0x88,0x20,0x45,0x34,0x22,0xb8,0xde,0xbd,0xcc,0xaa,0x9a,0x08,0x11,0x22,0x11,
+0x00,0x88,0x88,0x32,0x46,0x44,0x43,0x12,0x81,0xa9,0xcc,0xcb,0x9a,0x18,0x32,0x45,
+0x33,0x22,0x02,0x88,0x98,0x10,0x63,0x34,0x24,0x81,0xfb,0xbd,0xbd,0xac,0x9a,0x88,
+0x11,0x12,0x12,0x01,0x88,0x09,0x20,0x64,0x53,0x33,0x24,0x11,0xa8,0xdb,0xbc,0xaa,
+0x89,0x31,0x35,0x44,0x22,0x12,0x80,0x88,0x09,0x32,0x45,0x24,0x02,0xc9,0xce,0xbd,
+0xbc,0xaa,0x8a,0x18,0x21,0x22,0x02,0x90,0x88,0x18,0x62,0x44,0x34,0x24,0x13,0x90,
+0xcb,0xcc,0xab,0x9a,0x10,0x34,0x35,0x24,0x12,0x81,0x98,0x88,0x30,0x44,0x44,0x12,
+0x98,0xdd,0xcc,0xbc,0xab,0xaa,0x08,0x21,0x32,0x22,0x01,0x80,0x80,0x41,0x54,0x44,
+0x24,0x23,0x01,0xa9,0xcc,0xcb,0xab,0x89,0x20,0x44,0x53,0x32,0x12,0x01,0x98,0x89,
+0x20,0x44,0x44,0x32,0x80,0xfb,0xcd,0xdb,0xba,0xaa,0x89,0x10,0x22,0x12,0x11,0x90,
+0x88,0x18,0x62,0x44,0x34,0x34,0x22,0x80,0xb9,0xcd,0xbb,0xab,0x09,0x41,0x35,0x34,
+0x33,0x12,0x80,0x98,0x09,0x41,0x35,0x35,0x12,0xb8,0xde,0xbd,0xcc,0xaa,0x9a,0x08,
+0x10,0x22,0x12,0x01,0x80,0x88,0x20,0x54,0x44,0x34,0x23,0x22,0x98,0xda,0xbc,0xac,
+0x9a,0x10,0x43,0x44,0x33,0x23,0x12,0x88,0x99,0x18,0x63,0x34,0x34,0x01,0xda,0xce,
+0xcc,0xbb,0xab,0x99,0x00,0x22,0x22,0x12,0x01,0x98,0x80,0x42,0x55,0x34,0x25,0x22,
+0x82,0xa8,0xcc,0xac,0xab,0x89,0x31,0x44,0x34,0x33,0x22,0x81,0x98,0x89,0x20,0x55,
+0x34,0x13,0x90,0xed,0xcc,0xcb,0xbb,0xab,0x09,0x10,0x23,0x23,0x01,0x80,0x99,0x10,
+0x63,0x45,0x34,0x34,0x22,0x80,0xba,0xbe,0xac,0xaa,0x18,0x41,0x34,0x34,0x23,0x12,
+0x88,0x99,0x18,0x42,0x45,0x24,0x12,0xb9,0xcf,0xcc,0xbc,0xaa,0x9a,0x08,0x11,0x23,
+0x12,0x01,0x88,0x88,0x30,0x64,0x44,0x43,0x33,0x02,0xa0,0xeb,0xbb,0xac,0x99,0x20,
+0x53,0x34,0x24,0x22,0x01,0x98,0x88,0x18,0x53,0x44,0x32,0x81,0xeb,0xcd,0xcc,0xbb,
+0xab,0x89,0x18,0x22,0x23,0x02,0x80,0x98,0x08,0x52,0x45,0x44,0x33,0x23,0x81,0xc9,
+0xbc,0xbd,0xaa,0x09,0x31,0x44,0x34,0x23,0x22,0x00,0x99,0x89,0x31,0x55,0x24,0x13,
+0xa8,0xed,0xdc,0xbb,0xbc,0x9a,0x88,0x11,0x22,0x22,0x01,0x00,0x08,0x11,0x54,0x44,
+0x34,0x43,0x11,0x80,0xba,0xcc,0xab,0x9b,0x18,0x63,0x53,0x32,0x13,0x11,0x98,0x99,
+0x18,0x52,0x44,0x33,0x12,0xda,0xce,0xbd,0xbc,0xab,0x8a,0x08,0x22,0x22,0x12,0x80,
+0x98,0x08,0x31,0x47,0x44,0x33,0x24,0x01,0xa9,0xdb,0xcb,0xab,0x89,0x20,0x63,0x53,
+0x32,0x21,0x00,0x98,0x98,0x11,0x44,0x34,0x14,0x91,0xfb,0xdc,0xcb,0xbb,0xaa,0x89,
+0x20,0x22,0x22,0x02,0x80,0x89,0x18,0x63,0x54,0x34,0x43,0x12,0x81,0xb9,0xbd,0xac,
+0x9b,0x08,0x41,0x34,0x25,0x23,0x12,0x80,0x89,0x08,0x41,0x44,0x43,0x12,0xa8,0xcf,
+0xbd,0xbc,0xac,0x99,0x88,0x11,0x22,0x12,0x00,0x80,0x88,0x11,0x54,0x44,0x43,0x33,
+0x13,0x98,0xeb,0xcb,0xbb,0x99,0x10,0x53,0x34,0x34,0x22,0x01,0x88,0x99,0x18,0x44,
+0x44,0x23,0x82,0xeb,0xcd,0xcc,0xbb,0xaa,0x9a,0x00,0x12,0x23,0x22,0x00,0x88,0x88,
+0x31,0x55,0x44,0x34,0x24,0x12,0x90,0xba,0xcd,0xbb,0xaa,0x09,0x32,0x46,0x33,0x24,
+0x12,0x80,0xa8,0x98,0x30,0x54,0x34,0x22,0x91,0xfb,0xdc,0xbc,0xac,0xab,0x8a,0x08,
+0x22,0x23,0x12,0x01,0x89,0x88,0x30,0x55,0x44,0x34,0x33,0x22,0x80,0xdb,0xcc,0xbb,
+0xaa,0x18,0x42,0x35,0x43,0x23,0x12,0x80,0x99,0x89,0x20,0x45,0x44,0x22,0x81,0xea,
+0xcd,0xbc,0xac,0xab,0x89,0x00,0x22,0x22,0x12,0x00,0x98,0x88,0x30,0x55,0x35,0x34,
+0x24,0x11,0x90,0xda,0xcb,0xbb,0xaa,0x18,0x42,0x44,0x43,0x22,0x12,0x80,0x99,0x89,
+0x21,0x45,0x44,0x22,0x90,0xeb,0xcd,0xbc,0xbc,0xaa,0x89,0x00,0x12,0x22,0x12,0x08,
+0x99,0x88,0x31,0x65,0x53,0x24,0x33,0x12,0x91,0xca,0xcc,0xbb,0x9a,0x19,0x43,0x35,
+0x44,0x22,0x11,0x80,0x88,0x09,0x20,0x34,0x35,0x23,0x90,0xfc,0xcc,0xcc,0xbb,0xab,
+0x99,0x00,0x22,0x23,0x13,0x00,0x98,0x88,0x31,0x65,0x34,0x35,0x33,0x22,0x88,0xbc,
+0xbe,0xbb,0xaa,0x08,0x42,0x35,0x34,0x24,0x11,0x80,0x98,0x09,0x20,0x44,0x34,0x33,
+0x91,0xdd,0xcd,0xcc,0xab,0x9b,0x99,0x10,0x22,0x22,0x12,0x00,0x89,0x88,0x31,0x55,
+0x44,0x34,0x33,0x13,0x90,0xeb,0xcb,0xac,0x9a,0x00,0x42,0x43,0x24,0x23,0x02,0x80,
+0x98,0x88,0x31,0x55,0x43,0x13,0x90,0xdc,0xdd,0xbb,0xbc,0xaa,0x89,0x18,0x22,0x23,
+0x21,0x00,0x89,0x88,0x31,0x56,0x44,0x33,0x24,0x12,0x98,0xcb,0xcc,0xbb,0x9a,0x00,
+0x43,0x44,0x43,0x22,0x12,0x80,0x99,0x88,0x31,0x55,0x33,0x23,0x90,0xde,0xdc,0xcb,
+0xbb,0xab,0x8a,0x10,0x31,0x32,0x12,0x00,0x98,0x08,0x32,0x47,0x35,0x34,0x33,0x13,
+0xa8,0xeb,0xbc,0xbb,0x9b,0x19,0x52,0x44,0x33,0x24,0x02,0x00,0x99,0x09,0x30,0x54,
+0x43,0x13,0x91,0xec,0xdc,0xcb,0xac,0xaa,0x89,0x18,0x12,0x23,0x11,0x81,0x88,0x88,
+0x21,0x55,0x44,0x24,0x33,0x11,0xa0,0xdb,0xdb,0xab,0x9a,0x18,0x43,0x44,0x33,0x24,
+0x11,0x88,0x98,0x88,0x31,0x45,0x53,0x12,0x91,0xfb,0xcc,0xbc,0xbc,0x9a,0x89,0x10,
+0x31,0x22,0x11,0x80,0x98,0x09,0x41,0x64,0x43,0x34,0x23,0x02,0x98,0xcc,0xbc,0xbb,
+0x9a,0x18,0x53,0x44,0x32,0x33,0x02,0x80,0x99,0x89,0x41,0x45,0x24,0x13,0xa0,0xdd,
+0xcd,0xcb,0xcb,0xa9,0x89,0x10,0x21,0x22,0x01,0x80,0x99,0x88,0x32,0x46,0x35,0x43,
+0x33,0x12,0x98,0xdb,0xbc,0xcb,0x99,0x10,0x53,0x34,0x34,0x22,0x11,0x98,0x88,0x28,
+0x43,0x35,0x24,0x80,0xfa,0xcc,0xcc,0xbb,0xab,0x99,0x00,0x22,0x22,0x12,0x80,0x90,
+0x08,0x42,0x46,0x44,0x33,0x33,0x01,0xba,0xcd,0xbc,0xaa,0x89,0x31,0x45,0x43,0x32,
+0x11,0x81,0x89,0x89,0x21,0x45,0x34,0x22,0xa8,0xed,0xcc,0xbc,0xbb,0x9b,0x09,0x20,
+0x22,0x23,0x01,0x80,0x89,0x10,0x64,0x44,0x34,0x43,0x21,0x90,0xba,0xcd,0xab,0x9b,
+0x00,0x43,0x35,0x43,0x22,0x11,0x88,0x98,0x08,0x52,0x44,0x33,0x02,0xd9,0xdd,0xbc,
+0xad,0xab,0x99,0x08,0x12,0x22,0x12,0x01,0x88,0x88,0x20,0x55,0x44,0x43,0x23,0x11,
+0xa8,0xeb,0xbb,0xac,0x89,0x20,0x34,0x35,0x33,0x23,0x01,0x98,0x98,0x20,0x45,0x44,
+0x22,0x91,0xeb,0xdd,0xcb,0xcb,0x9a,0x89,0x00,0x22,0x12,0x11,0x80,0x89,0x08,0x42,
+0x55,0x43,0x24,0x22,0x81,0xb9,0xbd,0xbc,0xab,0x08,0x41,0x34,0x35,0x22,0x12,0x80,
+0x99,0x08,0x41,0x44,0x24,0x12,0xb0,0xde,0xbd,0xcc,0xba,0xa9,0x08,0x11,0x22,0x12,
+0x01,0x08,0x09,0x10,0x54,0x44,0x34,0x24,0x02,0x90,0xca,0xbc,0xbb,0x9b,0x10,0x44,
+0x44,0x23,0x23,0x01,0x90,0x89,0x18,0x62,0x53,0x33,0x01,0xe9,0xdc,0xcc,0xbb,0xbb,
+0x99,0x10,0x22,0x23,0x12,0x00,0x99,0x88,0x52,0x64,0x43,0x43,0x22,0x81,0xa8,0xcc,
+0xcb,0xaa,0x0a,0x20,0x44,0x34,0x33,0x23,0x00,0x99,0x99,0x21,0x46,0x43,0x23,0xa0,
+0xfc,0xcc,0xbc,0xbb,0xaa,0x89,0x11,0x22,0x23,0x01,0x90,0x99,0x18,0x54,0x54,0x53,
+0x32,0x12,0x91,0xba,0xce,0xba,0xaa,0x18,0x42,0x34,0x34,0x33,0x12,0x80,0x89,0x00,
+0x52,0x44,0x43,0x11,0xa8,0xde,0xcc,0xbb,0xac,0x9a,0x00,0x11,0x12,0x02,0x00,0x98,
+0x08,0x30,0x55,0x44,0x43,0x32,0x11,0xa8,0xdb,0xcc,0xaa,0x99,0x20,0x43,0x44,0x23,
+0x23,0x00,0x90,0x99,0x10,0x73,0x43,0x23,0x81,0xfb,0xbd,0xbd,0xbc,0xaa,0x99,0x10,
+0x22,0x22,0x02,0x80,0x98,0x18,0x42,0x46,0x44,0x32,0x23,0x81,0xa9,0xcd,0xcb,0xaa,
+0x88,0x31,0x44,0x34,0x32,0x21,0x80,0x98,0x88,0x32,0x55,0x43,0x12,0xa0,0xce,0xcd,
+0xcb,0xba,0x9a,0x09,0x11,0x22,0x22,0x01,0x80,0x88,0x28,0x73,0x44,0x43,0x24,0x11,
+0x80,0xba,0xcd,0xba,0x9a,0x00,0x43,0x44,0x33,0x33,0x11,0x90,0x99,0x18,0x63,0x34,
+0x34,0x01,0xca,0xde,0xbc,0xbc,0xbb,0x9a,0x00,0x31,0x32,0x12,0x81,0x98,0x88,0x31,
+0x47,0x35,0x34,0x23,0x01,0xb9,0xcd,0xbb,0xab,0x09,0x42,0x35,0x34,0x23,0x02,0x80,
+0x89,0x18,0x62,0x53,0x23,0x02,0xeb,0xbe,0xcd,0xab,0xab,0x89,0x01,0x22,0x22,0x01,
+0x80,0x89,0x20,0x54,0x54,0x33,0x24,0x12,0x98,0xdb,0xbc,0xab,0x8a,0x30,0x44,0x44,
+0x22,0x12,0x81,0x98,0x88,0x31,0x45,0x43,0x11,0xb8,0xde,0xcc,0xac,0xab,0x9a,0x00,
+0x21,0x12,0x02,0x00,0x88,0x10,0x43,0x46,0x43,0x43,0x12,0x00,0xba,0xbd,0xac,0x9a,
+0x18,0x42,0x44,0x33,0x23,0x02,0x88,0x89,0x20,0x54,0x34,0x23,0x90,0xed,0xbd,0xbd,
+0xbb,0x9b,0x88,0x21,0x22,0x12,0x81,0x88,0x88,0x41,0x54,0x44,0x24,0x23,0x01,0xb9,
+0xcc,0xbc,0xaa,0x88,0x32,0x44,0x34,0x23,0x12,0x88,0x98,0x18,0x52,0x35,0x24,0x82,
+0xda,0xdd,0xcc,0xab,0xab,0x89,0x10,0x32,0x22,0x02,0x80,0x98,0x10,0x54,0x54,0x43,
+0x23,0x13,0x98,0xcb,0xbc,0xac,0x8a,0x20,0x43,0x35,0x33,0x22,0x81,0x98,0x89,0x41,
+0x54,0x43,0x02,0xb8,0xde,0xcc,0xcb,0xab,0x9a,0x08,0x12,0x23,0x11,0x00,0x98,0x00,
+0x42,0x55,0x43,0x24,0x13,0x81,0xc9,0xdb,0xbb,0x9a,0x19,0x43,0x44,0x24,0x22,0x01,
+0x88,0x89,0x20,0x53,0x44,0x12,0x91,0xdc,0xcd,0xdb,0xab,0xaa,0x88,0x11,0x12,0x12,
+0x81,0x80,0x08,0x30,0x45,0x35,0x35,0x32,0x01,0xa8,0xcc,0xac,0x9b,0x09,0x21,0x35,
+0x44,0x22,0x02,0x00,0x89,0x18,0x42,0x44,0x33,0x02,0xda,0xde,0xbc,0xbc,0xaa,0x89,
+0x18,0x22,0x12,0x11,0x80,0x89,0x10,0x62,0x35,0x35,0x43,0x11,0x90,0xca,0xbc,0xbb,
+0x9a,0x20,0x54,0x43,0x33,0x12,0x81,0x88,0x89,0x31,0x46,0x33,0x23,0xb0,0xef,0xdb,
+0xac,0xab,0x9a,0x08,0x21,0x12,0x12,0x00,0x88,0x08,0x41,0x54,0x44,0x33,0x23,0x81,
+0xc9,0xcc,0xbb,0x9b,0x19,0x42,0x35,0x34,0x23,0x01,0x90,0x98,0x10,0x44,0x35,0x23,
+0x91,0xec,0xcd,0xdb,0xba,0xaa,0x09,0x10,0x22,0x22,0x01,0x88,0x88,0x11,0x45,0x35,
+0x35,0x23,0x02,0xa9,0xcc,0xac,0xab,0x09,0x21,0x35,0x35,0x23,0x12,0x00,0x98,0x00,
+0x43,0x54,0x23,0x02,0xd9,0xdd,0xcc,0xbb,0xab,0x99,0x00,0x22,0x22,0x02,0x00,0x09,
+0x28,0x73,0x44,0x34,0x33,0x12,0x90,0xdb,0xbc,0xac,0x9a,0x10,0x53,0x53,0x32,0x12,
+0x01,0x98,0x88,0x31,0x54,0x43,0x22,0xa8,0xde,0xdc,0xbb,0xbb,0x9b,0x08,0x21,0x22,
+0x12,0x81,0x98,0x08,0x42,0x46,0x34,0x44,0x12,0x81,0xb9,0xcc,0xac,0x9a,0x18,0x42,
+0x53,0x33,0x23,0x11,0x88,0x88,0x21,0x45,0x34,0x22,0xb8,0xcf,0xbd,0xbc,0x9c,0x8a,
+0x00,0x11,0x11,0x01,0x88,0x88,0x10,0x63,0x44,0x43,0x23,0x11,0xa9,0xcc,0xcb,0xaa,
+0x09,0x41,0x53,0x43,0x22,0x01,0x88,0x88,0x10,0x63,0x43,0x23,0x90,0xde,0xcc,0xbc,
+0xab,0x9a,0x00,0x21,0x22,0x11,0x08,0x89,0x10,0x53,0x45,0x44,0x22,0x02,0xa0,0xcb,
+0xbc,0xbb,0x89,0x31,0x45,0x34,0x23,0x12,0x80,0x89,0x10,0x63,0x53,0x12,0x90,0xdc,
+0xcd,0xbc,0xbb,0x9b,0x09,0x31,0x32,0x12,0x00,0x98,0x18,0x52,0x64,0x43,0x33,0x13,
+0x80,0xdb,0xbc,0xbb,0x9a,0x21,0x45,0x34,0x23,0x12,0x00,0x89,0x08,0x52,0x44,0x23,
+0x82,0xfb,0xcd,0xdb,0xba,0x9a,0x09,0x10,0x22,0x12,0x00,0x88,0x88,0x32,0x56,0x53,
+0x23,0x13,0x80,0xca,0xbc,0xac,0x9a,0x10,0x53,0x34,0x43,0x12,0x00,0x98,0x08,0x32,
+0x54,0x33,0x02,0xda,0xde,0xbc,0xbc,0xaa,0x89,0x10,0x21,0x12,0x01,0x88,0x80,0x21,
+0x64,0x63,0x33,0x23,0x01,0xc9,0xcc,0xbb,0xaa,0x18,0x53,0x34,0x34,0x12,0x01,0x98,
+0x09,0x30,0x45,0x34,0x02,0xc8,0xce,0xcc,0xbb,0xbb,0x99,0x10,0x22,0x22,0x11,0x88,
+0x88,0x31,0x55,0x44,0x34,0x22,0x02,0xb9,0xcc,0xcb,0x9a,0x08,0x41,0x34,0x34,0x23,
+0x01,0x90,0x88,0x21,0x45,0x34,0x12,0xb0,0xde,0xbd,0xad,0xab,0x9a,0x00,0x21,0x22,
+0x01,0x80,0x88,0x10,0x53,0x45,0x34,0x33,0x12,0xa8,0xcd,0xcb,0xaa,0x09,0x31,0x54,
+0x33,0x23,0x01,0x90,0x98,0x10,0x44,0x44,0x13,0x90,0xed,0xcc,0xac,0xbb,0x99,0x08,
+0x11,0x22,0x11,0x90,0x98,0x18,0x52,0x45,0x34,0x24,0x02,0x90,0xca,0xcb,0xab,0x89,
+0x30,0x45,0x24,0x33,0x22,0x00,0x09,0x18,0x53,0x44,0x32,0x80,0xfb,0xcd,0xbc,0xac,
+0x9a,0x88,0x11,0x22,0x11,0x80,0x98,0x08,0x41,0x44,0x35,0x34,0x12,0x80,0xcb,0xcc,
+0xaa,0x8a,0x11,0x34,0x35,0x23,0x12,0x81,0x98,0x18,0x52,0x44,0x33,0x01,0xfb,0xcd,
+0xbc,0xac,0x9a,0x09,0x10,0x21,0x12,0x00,0x88,0x08,0x32,0x46,0x34,0x34,0x13,0x81,
+0xca,0xbc,0xbc,0x9a,0x18,0x53,0x44,0x23,0x12,0x81,0x88,0x08,0x31,0x45,0x33,0x03,
+0xd9,0xde,0xbc,0xbc,0x9b,0x8a,0x11,0x21,0x22,0x01,0x80,0x88,0x20,0x54,0x45,0x43,
+0x22,0x01,0xb9,0xcc,0xbb,0x9b,0x18,0x43,0x45,0x32,0x13,0x01,0x98,0x88,0x31,0x45,
+0x34,0x12,0xb9,0xdf,0xbc,0xbc,0xbb,0x9a,0x00,0x22,0x22,0x11,0x88,0x08,0x32,0x56,
+0x53,0x33,0x23,0x81,0xca,0xbd,0xbb,0x9a,0x20,0x54,0x43,0x23,0x22,0x80,0x98,0x10,
+0x53,0x35,0x23,0x90,0xee,0xbc,0xbd,0xaa,0x9a,0x00,0x11,0x12,0x11,0x88,0x08,0x20,
+0x45,0x35,0x34,0x23,0x01,0xca,0xbc,0xbc,0x9a,0x20,0x53,0x44,0x32,0x11,0x00,0x89,
+0x18,0x42,0x44,0x23,0x91,0xfc,0xcc,0xbc,0xab,0x9a,0x18,0x21,0x22,0x01,0x80,0x08,
+0x20,0x54,0x44,0x34,0x32,0x81,0xb9,0xbd,0xbc,0x9a,0x28,0x53,0x44,0x32,0x12,0x80,
+0x88,0x08,0x42,0x44,0x23,0x91,0xdd,0xcd,0xcb,0xab,0x9a,0x08,0x21,0x22,0x01,0x80,
+0x88,0x10,0x44,0x36,0x34,0x23,0x82,0xc9,0xdb,0xbb,0xaa,0x18,0x34,0x45,0x23,0x13,
+0x00,0x89,0x19,0x42,0x35,0x24,0x80,0xdc,0xcd,0xbc,0xbb,0xaa,0x08,0x11,0x13,0x02,
+0x88,0x89,0x20,0x54,0x35,0x35,0x23,0x02,0xa8,0xcc,0xcb,0x9a,0x18,0x52,0x53,0x23,
+0x13,0x01,0x98,0x08,0x32,0x36,0x24,0x01,0xeb,0xdd,0xcb,0xbb,0x9b,0x08,0x20,0x22,
+0x01,0x80,0x98,0x10,0x63,0x54,0x43,0x23,0x11,0xa9,0xcc,0xbb,0xab,0x08,0x53,0x44,
+0x33,0x12,0x01,0x98,0x08,0x42,0x44,0x24,0x82,0xe9,0xdc,0xbc,0xac,0xaa,0x08,0x20,
+0x21,0x11,0x08,0x89,0x00,0x43,0x55,0x43,0x23,0x02,0xa8,0xeb,0xbb,0xab,0x08,0x52,
+0x53,0x33,0x22,0x01,0x98,0x08,0x32,0x36,0x25,0x02,0xda,0xdd,0xdb,0xab,0x9b,0x09,
+0x20,0x21,0x12,0x80,0x08,0x18,0x52,0x35,0x35,0x33,0x12,0xa8,0xcc,0xbc,0xaa,0x09,
+0x41,0x44,0x33,0x33,0x01,0x90,0x88,0x31,0x46,0x43,0x02,0xd9,0xdd,0xdb,0xab,0x9b,
+0x89,0x11,0x12,0x12,0x00,0x88,0x18,0x52,0x44,0x44,0x32,0x02,0xa0,0xdb,0xcb,0xab,
+0x09,0x41,0x34,0x25,0x22,0x01,0x88,0x88,0x21,0x44,0x34,0x12,0xd9,0xdd,0xcc,0xab,
+0xab,0x88,0x20,0x21,0x12,0x80,0x88,0x08,0x41,0x45,0x44,0x23,0x13,0x98,0xdb,0xcb,
+0xab,0x89,0x31,0x36,0x34,0x23,0x11,0x98,0x98,0x21,0x64,0x33,0x12,0xd8,0xdd,0xbc,
+0xbc,0xab,0x89,0x10,0x22,0x12,0x01,0x88,0x80,0x32,0x56,0x34,0x24,0x22,0x88,0xbb,
+0xcd,0xaa,0x89,0x21,0x35,0x34,0x33,0x02,0x80,0x09,0x20,0x54,0x34,0x13,0xc8,0xde,
+0xbc,0xac,0xab,0x89,0x00,0x22,0x21,0x81,0x88,0x08,0x31,0x37,0x45,0x23,0x13,0x90,
+0xca,0xcc,0xaa,0x8a,0x20,0x44,0x34,0x32,0x02,0x90,0x89,0x10,0x44,0x34,0x23,0xc8,
+0xce,0xcd,0xbb,0x9c,0x8a,0x00,0x12,0x12,0x00,0x98,0x88,0x31,0x46,0x34,0x24,0x12,
+0x98,0xcb,0xac,0xab,0x18,0x52,0x34,0x24,0x22,0x00,0x80,0x10,0x42,0x35,0x33,0x90,
+0xed,0xbd,0xbd,0xab,0x8a,0x18,0x21,0x21,0x00,0x90,0x80,0x31,0x46,0x44,0x33,0x12,
+0x98,0xbc,0xbd,0xab,0x08,0x42,0x44,0x33,0x22,0x81,0x90,0x00,0x42,0x35,0x24,0x91,
+0xdd,0xbd,0xbd,0xab,0x8a,0x08,0x12,0x22,0x01,0x88,0x08,0x31,0x65,0x43,0x24,0x12,
+0x98,0xca,0xbc,0xab,0x08,0x42,0x44,0x33,0x22,0x01,0x98,0x08,0x42,0x35,0x24,0x81,
+0xec,0xbd,0xbd,0xab,0x8a,0x18,0x21,0x21,0x01,0x88,0x08,0x31,0x55,0x44,0x33,0x12,
+0x90,0xdb,0xbc,0xaa,0x09,0x42,0x34,0x25,0x22,0x00,0x88,0x08,0x41,0x53,0x23,0x81,
+0xec,0xcd,0xcb,0xab,0x9a,0x18,0x21,0x21,0x01,0x08,0x88,0x31,0x55,0x44,0x23,0x13,
+0x98,0xcb,0xcc,0xaa,0x88,0x32,0x54,0x33,0x22,0x01,0x88,0x08,0x41,0x44,0x33,0x82,
+0xfc,0xcc,0xbc,0xac,0x99,0x00,0x11,0x11,0x01,0x88,0x08,0x30,0x54,0x44,0x33,0x12,
+0x90,0xdb,0xbc,0xab,0x09,0x41,0x44,0x33,0x23,0x01,0x88,0x88,0x32,0x46,0x33,0x82,
+0xec,0xdc,0xbc,0xbb,0x9a,0x00,0x21,0x12,0x11,0x88,0x08,0x31,0x55,0x44,0x33,0x22,
+0x90,0xcb,0xbd,0xab,0x09,0x31,0x36,0x34,0x22,0x01,0x88,0x08,0x32,0x36,0x34,0x81,
+0xfb,0xdc,0xcb,0xbb,0x8a,0x08,0x11,0x12,0x11,0x88,0x08,0x21,0x55,0x34,0x34,0x22,
+0x80,0xcb,0xcc,0xaa,0x0a,0x21,0x45,0x33,0x22,0x01,0x88,0x09,0x31,0x46,0x33,0x82,
+0xfb,0xcd,0xbc,0xac,0x8a,0x88,0x11,0x12,0x01,0x80,0x88,0x10,0x44,0x54,0x33,0x22,
+0x80,0xda,0xcb,0xbb,0x99,0x31,0x54,0x43,0x22,0x02,0x88,0x09,0x31,0x36,0x34,0x01,
+0xea,0xcd,0xbc,0xbb,0x9b,0x08,0x22,0x23,0x11,0x90,0x08,0x21,0x55,0x34,0x44,0x12,
+0x80,0xba,0xbd,0xac,0x89,0x21,0x44,0x43,0x22,0x01,0x88,0x08,0x21,0x54,0x33,0x02,
+0xfa,0xcd,0xbc,0xac,0x9a,0x08,0x20,0x21,0x01,0x80,0x88,0x20,0x54,0x34,0x25,0x13,
+0x81,0xca,0xdb,0xaa,0x8a,0x21,0x44,0x24,0x23,0x01,0x80,0x89,0x21,0x54,0x33,0x03,
+0xea,0xce,0xbc,0xac,0xaa,0x08,0x11,0x12,0x11,0x80,0x88,0x20,0x63,0x44,0x24,0x23,
+0x80,0xb9,0xbd,0xac,0x89,0x20,0x44,0x43,0x22,0x02,0x80,0x89,0x21,0x44,0x34,0x02,
+0xe9,0xcd,0xcc,0xba,0x9a,0x09,0x20,0x21,0x11,0x80,0x08,0x10,0x44,0x45,0x33,0x14,
+0x81,0xb9,0xcc,0xbb,0x8a,0x21,0x45,0x33,0x24,0x01,0x88,0x80,0x31,0x54,0x33,0x82,
+0xec,0xcd,0xbc,0xab,0x8a,0x00,0x21,0x12,0x81,0x80,0x08,0x42,0x45,0x44,0x22,0x11,
+0xb9,0xbc,0xad,0x99,0x20,0x43,0x34,0x14,0x02,0x80,0x88,0x20,0x44,0x24,0x82,0xea,
+0xcd,0xcc,0xaa,0x9a,0x00,0x11,0x12,0x00,0x88,0x18,0x41,0x44,0x44,0x22,0x02,0xa8,
+0xcc,0xbb,0x9a,0x20,0x44,0x34,0x23,0x02,0x80,0x08,0x31,0x45,0x33,0x02,0xfb,0xdd,
+0xdb,0xaa,0x9a,0x08,0x21,0x11,0x01,0x80,0x08,0x31,0x45,0x35,0x33,0x12,0xb8,0xcc,
+0xcb,0x9a,0x10,0x52,0x34,0x32,0x12,0x88,0x88,0x21,0x54,0x43,0x02,0xda,0xce,0xbc,
+0xbb,0x9b,0x08,0x21,0x12,0x01,0x88,0x88,0x42,0x55,0x43,0x33,0x12,0xa8,0xbd,0xbc,
+0x9b,0x28,0x53,0x44,0x22,0x11,0x88,0x88,0x28,0x53,0x34,0x03,0xe9,0xdd,0xcb,0xac,
+0x99,0x09,0x11,0x12,0x00,0x80,0x88,0x31,0x55,0x43,0x33,0x12,0xa0,0xdb,0xbc,0x9a,
+0x10,0x44,0x43,0x23,0x12,0x80,0x88,0x18,0x34,0x26,0x12,0xd9,0xdd,0xbc,0xcb,0x9a,
+0x88,0x11,0x21,0x01,0x80,0x88,0x21,0x54,0x44,0x33,0x12,0xa0,0xdb,0xbc,0xaa,0x18,
+0x42,0x35,0x43,0x11,0x81,0x88,0x18,0x53,0x34,0x02,0xd8,0xdd,0xbc,0xac,0xaa,0x88,
+0x11,0x12,0x01,0x00,0x08,0x20,0x45,0x44,0x33,0x12,0x90,0xdb,0xbc,0xaa,0x08,0x42,
+0x35,0x33,0x23,0x00,0x89,0x18,0x44,0x35,0x22,0xb9,0xef,0xcb,0xac,0x9a,0x08,0x10,
+0x21,0x10,0x08,0x88,0x21,0x63,0x44,0x33,0x12,0x90,0xda,0xac,0xab,0x08,0x43,0x34,
+0x24,0x13,0x00,0x88,0x10,0x52,0x35,0x13,0xb0,0xdf,0xcc,0xbb,0xaa,0x88,0x20,0x21,
+0x11,0x80,0x08,0x20,0x63,0x35,0x34,0x23,0x91,0xdb,0xbc,0xab,0x08,0x32,0x36,0x24,
+0x13,0x00,0x88,0x18,0x43,0x35,0x23,0xb0,0xdf,0xcc,0xbb,0x9c,0x89,0x10,0x21,0x01,
+0x80,0x08,0x10,0x63,0x53,0x43,0x12,0x91,0xba,0xbd,0xac,0x88,0x22,0x35,0x34,0x12,
+0x01,0x88,0x18,0x52,0x34,0x23,0xa1,0xcf,0xbe,0xbc,0xaa,0x89,0x10,0x21,0x11,0x80,
+0x88,0x10,0x44,0x35,0x25,0x23,0x80,0xba,0xbd,0xbb,0x89,0x32,0x46,0x33,0x22,0x01,
+0x80,0x08,0x43,0x35,0x24,0x90,0xdd,0xcd,0xbb,0xbb,0x99,0x20,0x21,0x12,0x00,0x89,
+0x10,0x54,0x45,0x33,0x23,0x00,0xca,0xbd,0xab,0x8a,0x41,0x53,0x24,0x22,0x00,0x88,
+0x08,0x41,0x34,0x24,0x90,0xdd,0xbd,0xbd,0xba,0x89,0x00,0x12,0x12,0x80,0x88,0x88,
+0x22,0x55,0x43,0x34,0x22,0x80,0xba,0xbe,0xbb,0x9b,0x08,0x43,0x45,0x33,0x33,0x01,
+0x88,0x89,0x30,0x54,0x44,0x22,0x91,0xfb,0xcc,0xcc,0xaa,0x9a,0x08,0x10,0x22,0x12,
+0x00,0x88,0x89,0x20,0x54,0x44,0x34,0x23,0x02,0xb9,0xcc,0xbc,0xaa,0x89,0x31,0x36,
+0x34,0x33,0x02,0x80,0x99,0x08,0x52,0x44,0x33,0x02,0xea,0xdd,0xbc,0xac,0xab,0x89,
+0x18,0x22,0x22,0x11,0x88,0x98,0x10,0x63,0x54,0x43,0x33,0x11,0x90,0xdb,0xbc,0xab,
+0x9a,0x20,0x54,0x43,0x33,0x22,0x81,0x98,0x89,0x41,0x44,0x24,0x12,0xa8,0xde,0xcc,
+0xbc,0xab,0x9a,0x08,0x20,0x22,0x12,0x81,0x80,0x08,0x41,0x55,0x34,0x34,0x22,0x00,
+0xba,0xcd,0xba,0xaa,0x18,0x42,0x35,0x24,0x23,0x01,0x90,0x98,0x20,0x44,0x44,0x22,
+0x80,0xdc,0xcd,0xbc,0xac,0x9a,0x09,0x10,0x22,0x21,0x00,0x08,0x09,0x20,0x45,0x44,
+0x34,0x23,0x02,0xb8,0xcc,0xbc,0xba,0x88,0x31,0x45,0x43,0x32,0x12,0x80,0x99,0x08,
+0x41,0x35,0x34,0x02,0xc9,0xcf,0xbc,0xad,0xaa,0x99,0x00,0x12,0x12,0x11,0x80,0x88,
+0x08,0x42,0x55,0x34,0x43,0x12,0x90,0xca,0xbc,0xbb,0x8a,0x28,0x44,0x44,0x32,0x12,
+0x81,0x88,0x88,0x21,0x54,0x43,0x13,0xa0,0xde,0xbd,0xbc,0xac,0x99,0x08,0x20,0x21,
+0x11,0x81,0x88,0x08,0x41,0x54,0x34,0x24,0x23,0x00,0xb9,0xcd,0xab,0xab,0x08,0x43,
+0x44,0x24,0x23,0x01,0x80,0x88,0x18,0x53,0x34,0x24,0x81,0xdc,0xcd,0xbc,0xac,0xaa,
+0x88,0x10,0x22,0x11,0x01,0x80,0x88,0x20,0x54,0x44,0x34,0x32,0x11,0xa8,0xcc,0xbc,
+0xba,0x89,0x31,0x54,0x33,0x24,0x12,0x80,0x89,0x08,0x32,0x46,0x23,0x12,0xda,0xed,
+0xdb,0xbb,0xab,0x99,0x18,0x21,0x22,0x11,0x08,0x88,0x18,0x44,0x45,0x44,0x23,0x13,
+0x91,0xca,0xbc,0xac,0x8a,0x10,0x34,0x35,0x24,0x12,0x01,0x88,0x09,0x28,0x53,0x34,
+0x23,0xa0,0xfd,0xcc,0xbc,0xbb,0x9a,0x09,0x21,0x22,0x12,0x00,0x88,0x88,0x31,0x56,
+0x44,0x33,0x33,0x01,0xba,0xcd,0xcb,0x9a,0x09,0x32,0x35,0x25,0x23,0x11,0x88,0x88,
+0x08,0x43,0x45,0x32,0x81,0xeb,0xdd,0xcb,0xac,0x9a,0x89,0x10,0x12,0x12,0x01,0x88,
+0x88,0x10,0x44,0x45,0x43,0x32,0x02,0x98,0xeb,0xbb,0xac,0x09,0x30,0x44,0x43,0x23,
+0x13,0x80,0x88,0x09,0x31,0x55,0x33,0x13,0xd8,0xed,0xdb,0xbb,0xab,0x8a,0x18,0x21,
+0x22,0x12,0x00,0x98,0x00,0x53,0x55,0x43,0x33,0x23,0x80,0xda,0xdb,0xab,0x9b,0x18,
+0x42,0x44,0x43,0x22,0x12,0x80,0x99,0x88,0x42,0x54,0x23,0x02,0xc9,0xde,0xdb,0xcb,
+0xaa,0x99,0x08,0x21,0x22,0x11,0x81,0x88,0x08,0x21,0x64,0x34,0x44,0x22,0x02,0x98,
+0xdb,0xcb,0xbb,0x99,0x20,0x44,0x34,0x24,0x13,0x01,0x98,0x88,0x28,0x44,0x44,0x22,
+0x91,0xfb,0xdc,0xcb,0xbb,0xbb,0x89,0x10,0x31,0x23,0x11,0x80,0x88,0x10,0x53,0x55,
+0x53,0x33,0x23,0x00,0xba,0xbe,0xbc,0xaa,0x09,0x32,0x36,0x34,0x23,0x12,0x81,0x89,
+0x09,0x41,0x44,0x34,0x13,0xb8,0xee,0xbc,0xbd,0xba,0x9a,0x09,0x11,0x32,0x22,0x01,
+0x88,0x88,0x20,0x45,0x45,0x34,0x32,0x13,0x98,0xea,0xcb,0xab,0x9a,0x10,0x53,0x53,
+0x23,0x23,0x01,0x90,0x98,0x18,0x63,0x34,0x24,0x01,0xda,0xdd,0xbc,0xbc,0xbb,0x99,
+0x18,0x22,0x22,0x12,0x00,0x89,0x88,0x31,0x56,0x44,0x33,0x24,0x01,0xa9,0xcc,0xcb,
+0xab,0x89,0x30,0x54,0x33,0x24,0x22,0x00,0x80,0x89,0x21,0x44,0x35,0x22,0x91,0xdc,
+0xbe,0xbd,0xbb,0xbb,0x09,0x20,0x32,0x23,0x01,0x98,0x99,0x08,0x44,0x46,0x34,0x34,
+0x12,0x91,0xba,0xcd,0xbb,0xaa,0x08,0x33,0x46,0x33,0x33,0x12,0x88,0x99,0x18,0x52,
+0x54,0x23,0x12,0xc9,0xed,0xdb,0xcb,0xab,0x8a,0x88,0x21,0x22,0x12,0x00,0x88,0x88,
+0x21,0x55,0x44,0x43,0x23,0x02,0x98,0xbc,0xbd,0xbb,0x99,0x20,0x44,0x44,0x32,0x22,
+0x00,0x90,0x89,0x28,0x63,0x34,0x33,0x81,0xfb,0xcd,0xcc,0xab,0xab,0x99,0x10,0x21,
+0x23,0x11,0x80,0x88,0x18,0x52,0x45,0x34,0x34,0x13,0x01,0xb9,0xdc,0xbb,0x9c,0x89,
+0x31,0x44,0x34,0x23,0x22,0x80,0x98,0x09,0x40,0x44,0x34,0x22,0xa8,0xde,0xdc,0xbb,
+0xac,0xaa,0x08,0x10,0x22,0x12,0x01,0x80,0x89,0x10,0x54,0x44,0x34,0x24,0x12,0x90,
+0xca,0xdb,0xba,0x9a,0x18,0x42,0x44,0x43,0x22,0x11,0x88,0x98,0x18,0x42,0x54,0x32,
+0x02,0xca,0xde,0xbc,0xbc,0xbb,0x99,0x08,0x11,0x23,0x22,0x00,0x88,0x09,0x31,0x47,
+0x44,0x43,0x22,0x02,0x98,0xcc,0xcb,0xab,0x89,0x20,0x44,0x34,0x33,0x23,0x81,0x88,
+0x99,0x20,0x55,0x43,0x23,0x91,0xec,0xdc,0xcb,0xbb,0xab,0x89,0x10,0x31,0x32,0x11,
+0x81,0x88,0x18,0x54,0x44,0x44,0x23,0x23,0x81,0xb9,0xbe,0xbc,0x9a,0x09,0x42,0x34,
+0x34,0x14,0x02,0x00,0x89,0x09,0x31,0x45,0x43,0x12,0xb8,0xde,0xcc,0xbc,0xba,0x9a,
+0x09,0x11,0x23,0x12,0x01,0x98,0x88,0x20,0x45,0x45,0x43,0x32,0x13,0x91,0xca,0xcc,
+0xac,0xaa,0x09,0x31,0x44,0x34,0x33,0x12,0x81,0x99,0x99,0x30,0x64,0x43,0x23,0x81,
+0xeb,0xcd,0xcc,0xbb,0xbb,0x9a,0x00,0x22,0x23,0x23,0x11,0x08,0x08,0x21,0x46,0x45,
+0x34,0x33,0x12,0x90,0xdb,0xbc,0xbc,0x9a,0x19,0x41,0x53,0x33,0x24,0x12,0x00,0x89,
+0x89,0x21,0x54,0x43,0x33,0x81,0xfb,0xcd,0xcc,0xbb,0xba,0x99,0x00,0x22,0x32,0x12,
+0x00,0x88,0x89,0x30,0x65,0x34,0x35,0x33,0x12,0x90,0xda,0xbc,0xac,0x9b,0x08,0x32,
+0x35,0x35,0x32,0x22,0x00,0x99,0x98,0x21,0x55,0x43,0x22,0x91,0xfb,0xdc,0xdb,0xab,
+0xab,0x8a,0x08,0x22,0x22,0x22,0x01,0x88,0x08,0x30,0x55,0x35,0x44,0x32,0x12,0x90,
+0xba,0xcd,0xbb,0xab,0x08,0x42,0x44,0x43,0x33,0x22,0x80,0x98,0x89,0x21,0x36,0x35,
+0x23,0x80,0xfb,0xcd,0xbc,0xbc,0xab,0x99,0x00,0x22,0x22,0x22,0x00,0x88,0x88,0x30,
+0x64,0x35,0x44,0x32,0x12,0x80,0xca,0xcc,0xbb,0xaa,0x08,0x43,0x44,0x43,0x22,0x11,
+0x80,0x98,0x88,0x30,0x54,0x34,0x33,0x81,0xdc,0xce,0xbc,0xac,0x9b,0x8a,0x10,0x21,
+0x22,0x11,0x80,0x88,0x88,0x21,0x64,0x44,0x43,0x33,0x13,0x90,0xdb,0xbc,0xac,0xaa,
+0x00,0x42,0x34,0x34,0x33,0x12,0x81,0x99,0x89,0x31,0x56,0x43,0x22,0x90,0xfb,0xcc,
+0xcc,0xab,0xab,0x99,0x10,0x21,0x32,0x12,0x80,0x88,0x08,0x41,0x45,0x35,0x34,0x33,
+0x12,0x98,0xcb,0xbd,0xbc,0x9a,0x08,0x42,0x44,0x43,0x22,0x12,0x80,0x88,0x89,0x21,
+0x45,0x24,0x23,0x90,0xdd,0xdc,0xdb,0xba,0xab,0x89,0x18,0x21,0x23,0x12,0x80,0x88,
+0x09,0x31,0x55,0x35,0x34,0x24,0x12,0x90,0xdb,0xcb,0xac,0x9a,0x08,0x32,0x44,0x34,
+0x32,0x12,0x80,0x98,0x88,0x20,0x54,0x34,0x24,0x80,0xdc,0xcd,0xbc,0xcb,0x9a,0x89,
+0x00,0x22,0x22,0x11,0x81,0x80,0x10,0x31,0x55,0x44,0x53,0x22,0x12,0x98,0xcb,0xbd,
+0xba,0xaa,0x18,0x43,0x44,0x43,0x22,0x11,0x80,0x98,0x08,0x30,0x45,0x34,0x23,0x90,
+0xed,0xcc,0xbc,0xcb,0xaa,0x89,0x10,0x21,0x22,0x02,0x00,0x98,0x08,0x32,0x46,0x35,
+0x34,0x24,0x11,0x88,0xcb,0xcc,0xba,0x9a,0x18,0x42,0x44,0x33,0x23,0x12,0x81,0x99,
+0x88,0x42,0x45,0x43,0x12,0xa0,0xec,0xdc,0xcb,0xbb,0xab,0x89,0x10,0x21,0x23,0x22,
+0x00,0x88,0x08,0x42,0x46,0x34,0x34,0x24,0x12,0x88,0xdb,0xcb,0xac,0x99,0x18,0x32,
+0x44,0x34,0x32,0x12,0x00,0x99,0x89,0x20,0x55,0x43,0x23,0x00,0xeb,0xcd,0xbd,0xcb,
+0xaa,0x9a,0x08,0x21,0x22,0x23,0x11,0x88,0x89,0x18,0x42,0x46,0x44,0x33,0x24,0x01,
+0x98,0xda,0xcb,0xbb,0xab,0x08,0x42,0x44,0x24,0x33,0x22,0x01,0x99,0x99,0x28,0x54,
+0x34,0x24,0x02,0xb0,0xde,0xcc,0xbc,0xcb,0x9a,0x89,0x10,0x21,0x22,0x02,0x80,0x98,
+0x80,0x31,0x44,0x36,0x35,0x24,0x12,0x81,0xa9,0xcc,0xbc,0xab,0x8a,0x21,0x44,0x34,
+0x43,0x22,0x02,0x80,0xa9,0x88,0x41,0x44,0x43,0x22,0x81,0xec,0xdc,0xbc,0xbb,0xbb,
+0x9a,0x09,0x22,0x43,0x23,0x01,0x80,0x89,0x00,0x52,0x45,0x44,0x24,0x22,0x01,0xa0,
+0xca,0xcc,0xab,0x9b,0x08,0x43,0x34,0x25,0x33,0x12,0x81,0x99,0x89,0x30,0x54,0x43,
+0x24,0x11,0xb9,0xcf,0xbd,0xcc,0xba,0x9a,0x89,0x20,0x31,0x22,0x11,0x80,0x98,0x88,
+0x31,0x55,0x54,0x33,0x24,0x12,0x91,0xb9,0xbe,0xac,0xab,0x89,0x21,0x44,0x43,0x24,
+0x22,0x01,0x98,0x99,0x08,0x32,0x46,0x43,0x23,0x91,0xec,0xdc,0xcb,0xbb,0xba,0x89,
+0x18,0x32,0x33,0x22,0x01,0x80,0x89,0x00,0x53,0x55,0x44,0x33,0x33,0x02,0xa9,0xcd,
+0xdb,0xba,0x99,0x18,0x42,0x53,0x43,0x32,0x21,0x80,0x98,0x89,0x20,0x54,0x53,0x22,
+0x82,0xc9,0xce,0xbd,0xbc,0xbb,0xaa,0x09,0x20,0x22,0x23,0x13,0x00,0x98,0x88,0x42,
+0x46,0x44,0x24,0x33,0x22,0x90,0xca,0xbd,0xcb,0x9b,0x89,0x31,0x35,0x35,0x23,0x23,
+0x01,0x98,0x99,0x09,0x53,0x45,0x33,0x22,0xa0,0xed,0xbd,0xbd,0xac,0xaa,0x89,0x00,
+0x12,0x22,0x22,0x01,0x98,0x88,0x10,0x44,0x45,0x53,0x33,0x33,0x01,0xb9,0xdc,0xcb,
+0xab,0x9a,0x28,0x53,0x34,0x34,0x23,0x12,0x00,0x89,0x99,0x31,0x55,0x43,0x23,0x81,
+0xea,0xcd,0xbd,0xbc,0xab,0xaa,0x08,0x20,0x32,0x23,0x12,0x90,0x89,0x18,0x62,0x44,
+0x34,0x35,0x33,0x22,0x98,0xdb,0xbc,0xbc,0xab,0x09,0x42,0x44,0x43,0x22,0x22,0x81,
+0x98,0x9a,0x18,0x44,0x44,0x32,0x12,0x98,0xce,0xce,0xcb,0xbb,0xab,0x89,0x10,0x21,
+0x33,0x22,0x80,0x98,0x89,0x31,0x55,0x44,0x34,0x34,0x23,0x80,0xc9,0xcb,0xbc,0xab,
+0x9a,0x21,0x45,0x43,0x33,0x33,0x12,0x80,0xa9,0x8a,0x52,0x54,0x33,0x23,0x80,0xfb,
+0xbe,0xcd,0xba,0xab,0x8a,0x09,0x11,0x33,0x33,0x11,0x88,0x98,0x20,0x63,0x44,0x44,
+0x24,0x23,0x02,0x98,0xcb,0xcc,0xbb,0xab,0x09,0x43,0x44,0x43,0x33,0x22,0x81,0xa8,
+0x9a,0x20,0x63,0x34,0x43,0x12,0x90,0xdd,0xbe,0xbd,0xac,0xaa,0x99,0x18,0x20,0x22,
+0x23,0x11,0x98,0x99,0x08,0x42,0x45,0x44,0x43,0x33,0x23,0x91,0xca,0xcc,0xcb,0xab,
+0x9a,0x28,0x45,0x33,0x34,0x32,0x22,0x01,0xa9,0xaa,0x20,0x56,0x33,0x24,0x11,0x80,
+0xdc,0xce,0xbc,0xcb,0xaa,0x99,0x08,0x11,0x23,0x23,0x11,0x98,0x99,0x88,0x22,0x56,
+0x44,0x43,0x33,0x13,0x81,0xba,0xcd,0xac,0xac,0x99,0x10,0x43,0x34,0x33,0x24,0x12,
+0x01,0x99,0xaa,0x18,0x54,0x34,0x43,0x12,0x90,0xec,0xdc,0xbc,0xac,0xaa,0x8a,0x09,
+0x21,0x32,0x23,0x11,0x98,0x89,0x08,0x32,0x55,0x45,0x43,0x33,0x13,0x81,0xba,0xdc,
+0xcb,0xbb,0x9a,0x28,0x63,0x43,0x33,0x33,0x23,0x81,0x98,0xaa,0x19,0x54,0x35,0x24,
+0x12,0xa8,0xec,0xbd,0xbd,0xac,0xab,0x99,0x08,0x11,0x33,0x23,0x01,0x88,0x89,0x10,
+0x33,0x55,0x54,0x34,0x34,0x11,0x80,0xb9,0xcb,0xbc,0xbc,0x9a,0x28,0x53,0x34,0x43,
+0x23,0x22,0x81,0x98,0x9a,0x18,0x63,0x44,0x33,0x13,0xa0,0xde,0xcd,0xcb,0xcb,0x9a,
+0x8a,0x88,0x11,0x23,0x23,0x12,0x98,0x89,0x18,0x32,0x45,0x54,0x44,0x33,0x22,0x80,
+0xca,0xcb,0xbc,0xbb,0x9b,0x20,0x44,0x34,0x24,0x33,0x23,0x01,0xa9,0xaa,0x18,0x54,
+0x34,0x34,0x13,0xa1,0xed,0xcc,0xcc,0xab,0xab,0x99,0x08,0x20,0x33,0x33,0x12,0x88,
+0x99,0x18,0x43,0x35,0x36,0x45,0x33,0x22,0x80,0xba,0xcc,0xcb,0xbb,0xaa,0x28,0x63,
+0x34,0x33,0x43,0x22,0x11,0x99,0x9a,0x18,0x44,0x44,0x32,0x23,0x90,0xfc,0xcd,0xbc,
+0xbb,0xbb,0xa9,0x08,0x21,0x33,0x24,0x11,0x90,0x98,0x18,0x42,0x54,0x34,0x35,0x43,
+0x22,0x80,0xb9,0xbd,0xcc,0xba,0xa9,0x10,0x52,0x43,0x33,0x43,0x22,0x01,0x99,0xaa,
+0x18,0x54,0x34,0x33,0x12,0x90,0xfd,0xcc,0xcc,0xab,0xab,0x9a,0x00,0x21,0x33,0x33,
+0x02,0x80,0x89,0x00,0x52,0x54,0x44,0x43,0x33,0x22,0x81,0xb9,0xdc,0xbc,0xbb,0x9a,
+0x10,0x53,0x34,0x24,0x23,0x23,0x01,0xa8,0xab,0x18,0x54,0x35,0x23,0x22,0x90,0xfb,
+0xbf,0xbd,0xac,0xab,0x99,0x08,0x11,0x32,0x23,0x02,0x88,0x89,0x08,0x42,0x44,0x45,
+0x34,0x24,0x12,0x81,0xaa,0xdb,0xbc,0xbb,0x9b,0x28,0x63,0x34,0x33,0x24,0x22,0x01,
+0xa8,0x9a,0x19,0x63,0x44,0x23,0x12,0x90,0xfb,0xcd,0xcc,0xbb,0x9c,0x8a,0x09,0x11,
+0x22,0x23,0x02,0x88,0x89,0x08,0x32,0x45,0x45,0x53,0x33,0x12,0x81,0xb9,0xdb,0xbc,
+0xac,0x9b,0x19,0x42,0x44,0x33,0x33,0x23,0x13,0x80,0xb9,0x9a,0x30,0x47,0x24,0x33,
+0x12,0x90,0xde,0xcd,0xcc,0xba,0xaa,0x99,0x09,0x10,0x32,0x24,0x12,0x90,0x98,0x08,
+0x20,0x43,0x45,0x44,0x34,0x33,0x12,0x90,0xcb,0xdb,0xcb,0xbb,0xab,0x10,0x44,0x34,
+0x24,0x33,0x22,0x02,0x98,0xba,0x89,0x52,0x45,0x33,0x23,0x11,0xc9,0xde,0xcd,0xcb,
+0xbb,0xaa,0x99,0x00,0x11,0x33,0x24,0x01,0x90,0x98,0x18,0x31,0x53,0x45,0x35,0x44,
+0x22,0x01,0xa8,0xca,0xcb,0xbb,0xac,0x99,0x11,0x44,0x34,0x33,0x24,0x22,0x01,0x99,
+0xab,0x09,0x53,0x35,0x34,0x23,0x81,0xea,0xdd,0xbc,0xbc,0xbb,0xab,0x89,0x18,0x42,
+0x32,0x23,0x01,0x99,0x99,0x00,0x43,0x45,0x44,0x34,0x34,0x12,0x81,0xb8,0xcb,0xbd,
+0xbc,0xaa,0x09,0x32,0x45,0x33,0x24,0x23,0x22,0x80,0xa9,0x9b,0x28,0x64,0x34,0x23,
+0x22,0x90,0xed,0xdc,0xbc,0xbc,0xaa,0x9a,0x89,0x10,0x22,0x43,0x12,0x81,0x98,0x89,
+0x18,0x32,0x46,0x45,0x43,0x33,0x22,0x80,0xba,0xcc,0xcb,0xcb,0x9a,0x08,0x52,0x43,
+0x34,0x32,0x23,0x12,0x88,0xa9,0x8a,0x31,0x55,0x43,0x32,0x11,0xb8,0xde,0xcd,0xcc,
+0xba,0xab,0x99,0x80,0x11,0x32,0x33,0x22,0x88,0x9a,0x08,0x41,0x53,0x44,0x35,0x35,
+0x32,0x12,0x98,0xcb,0xbc,0xbc,0xac,0x99,0x10,0x53,0x34,0x33,0x24,0x22,0x01,0x98,
+0xaa,0x0a,0x52,0x35,0x34,0x13,0x01,0xd9,0xdd,0xbd,0xcc,0xaa,0x9b,0x99,0x00,0x21,
+0x33,0x23,0x02,0x98,0x99,0x18,0x32,0x46,0x44,0x44,0x33,0x33,0x01,0xa9,0xdb,0xdb,
+0xcb,0xab,0x89,0x31,0x45,0x33,0x33,0x43,0x22,0x00,0xa9,0x9a,0x08,0x54,0x34,0x43,
+0x22,0x81,0xeb,0xce,0xcc,0xbb,0xbb,0x9a,0x89,0x00,0x32,0x34,0x22,0x81,0x98,0x09,
+0x10,0x43,0x54,0x44,0x34,0x34,0x12,0x80,0xb9,0xdb,0xbc,0xbb,0x9c,0x09,0x32,0x36,
+0x24,0x33,0x23,0x13,0x80,0xba,0xaa,0x40,0x45,0x34,0x32,0x12,0x98,0xed,0xcd,0xbc,
+0xbc,0xaa,0x9a,0x08,0x20,0x22,0x33,0x12,0x90,0x99,0x88,0x32,0x35,0x45,0x54,0x43,
+0x33,0x13,0x88,0xbb,0xcd,0xbb,0xbc,0x9a,0x10,0x52,0x34,0x24,0x33,0x23,0x12,0x88,
+0xba,0x9a,0x41,0x46,0x33,0x24,0x01,0xa9,0xcf,0xbd,0xbd,0xbb,0xab,0x8a,0x19,0x21,
+0x43,0x33,0x12,0x98,0x99,0x88,0x32,0x55,0x53,0x44,0x33,0x24,0x01,0x98,0xbb,0xcc,
+0xbc,0xbb,0x99,0x31,0x35,0x25,0x33,0x33,0x33,0x01,0xa9,0xab,0x19,0x55,0x34,0x24,
+0x13,0xa0,0xfc,0xcc,0xbc,0xbc,0xaa,0x8a,0x88,0x11,0x32,0x33,0x02,0x90,0x99,0x18,
+0x42,0x35,0x45,0x44,0x33,0x23,0x80,0xba,0xbd,0xbd,0xcb,0x9a,0x18,0x52,0x43,0x33,
+0x33,0x33,0x02,0xa8,0xaa,0x18,0x45,0x35,0x43,0x22,0x80,0xfb,0xcd,0xbc,0xbc,0xaa,
+0x8a,0x08,0x20,0x32,0x32,0x01,0x90,0x99,0x08,0x43,0x54,0x44,0x53,0x33,0x23,0x81,
+0xca,0xdb,0xbb,0xbc,0xaa,0x18,0x53,0x34,0x34,0x23,0x33,0x01,0xa8,0xab,0x28,0x55,
+0x43,0x32,0x12,0x91,0xfc,0xdc,0xbc,0xac,0x9b,0x9a,0x08,0x11,0x32,0x32,0x12,0x88,
+0x98,0x08,0x41,0x54,0x44,0x53,0x32,0x13,0x81,0xb9,0xdc,0xbb,0xcb,0x9a,0x10,0x53,
+0x34,0x33,0x33,0x32,0x02,0xa8,0xba,0x29,0x65,0x34,0x23,0x22,0x90,0xec,0xdd,0xdb,
+0xab,0xab,0x99,0x88,0x11,0x33,0x23,0x02,0x80,0x89,0x00,0x31,0x55,0x45,0x34,0x24,
+0x22,0x80,0xa9,0xcc,0xcb,0xbb,0x9a,0x10,0x34,0x35,0x24,0x23,0x23,0x01,0xa0,0xaa,
+0x09,0x54,0x44,0x23,0x22,0x90,0xfb,0xdd,0xdb,0xab,0xab,0x9a,0x08,0x11,0x33,0x33,
+0x11,0x98,0x8a,0x08,0x42,0x63,0x45,0x53,0x33,0x22,0x80,0xaa,0xbc,0xbd,0xac,0x9b,
+0x18,0x52,0x43,0x43,0x32,0x22,0x01,0x98,0xaa,0x08,0x63,0x44,0x23,0x13,0x98,0xdd,
+0xdc,0xbc,0xbc,0xab,0x9a,0x08,0x11,0x33,0x33,0x12,0x88,0x99,0x18,0x42,0x44,0x45,
+0x44,0x33,0x22,0x80,0xa9,0xbc,0xbd,0xbc,0x9a,0x08,0x53,0x34,0x33,0x34,0x22,0x81,
+0x98,0x9a,0x18,0x53,0x35,0x34,0x13,0x90,0xec,0xcd,0xbc,0xbc,0xaa,0x9a,0x08,0x11,
+0x32,0x33,0x12,0x90,0x99,0x08,0x42,0x44,0x54,0x34,0x34,0x13,0x81,0xba,0xbd,0xbc,
+0xcb,0x9a,0x18,0x52,0x43,0x33,0x43,0x22,0x01,0x98,0xaa,0x18,0x53,0x44,0x33,0x32,
+0x91,0xfc,0xcd,0xcc,0xba,0xab,0xaa,0x08,0x20,0x32,0x33,0x12,0x00,0x88,0x11,0x43,
+0x54,0x34,0x36,0x43,0x13,0x01,0xa9,0xdb,0xcb,0xbb,0xab,0x18,0x44,0x53,0x32,0x33,
+0x23,0x12,0xa9,0xba,0x18,0x45,0x35,0x23,0x23,0x91,0xfb,0xcf,0xbc,0xcb,0xaa,0x9a,
+0x08,0x10,0x23,0x33,0x21,0x90,0x98,0x88,0x32,0x46,0x44,0x34,0x34,0x13,0x01,0xb9,
+0xbd,0xcc,0xba,0x9a,0x08,0x53,0x43,0x43,0x32,0x22,0x02,0x98,0xaa,0x18,0x54,0x34,
+0x33,0x22,0x81,0xec,0xce,0xcc,0xab,0xab,0x9a,0x88,0x11,0x33,0x33,0x02,0x90,0x88,
+0x18,0x32,0x55,0x45,0x34,0x24,0x12,0x81,0xa9,0xcc,0xbc,0xab,0x8a,0x30,0x53,0x34,
+0x34,0x32,0x12,0x80,0x99,0x09,0x32,0x36,0x35,0x23,0x82,0xfb,0xcd,0xcc,0xbb,0xbb,
+0x9a,0x09,0x21,0x33,0x23,0x11,0x00,0x89,0x18,0x52,0x46,0x44,0x33,0x33,0x12,0x98,
+0xeb,0xbc,0xac,0x9a,0x19,0x32,0x45,0x33,0x33,0x23,0x00,0x99,0x9a,0x10,0x54,0x35,
+0x24,0x12,0xa8,0xde,0xbd,0xbd,0xab,0x9b,0x89,0x10,0x22,0x23,0x12,0x00,0x99,0x89,
+0x31,0x55,0x35,0x35,0x24,0x22,0x80,0xb9,0xbd,0xbc,0xab,0x8a,0x20,0x54,0x43,0x43,
+0x12,0x02,0x80,0x98,0x88,0x22,0x36,0x25,0x22,0x90,0xdc,0xdc,0xcc,0xba,0xab,0x9a,
+0x08,0x21,0x32,0x23,0x11,0x80,0x89,0x20,0x44,0x45,0x44,0x33,0x33,0x12,0xa8,0xcc,
+0xcc,0xba,0xaa,0x18,0x42,0x44,0x43,0x22,0x12,0x81,0xa8,0x89,0x28,0x44,0x44,0x23,
+0x11,0xb9,0xdf,0xcc,0xcb,0xbb,0x9a,0x89,0x10,0x32,0x32,0x12,0x88,0x99,0x08,0x31,
+0x55,0x44,0x44,0x32,0x12,0x91,0xba,0xbe,0xcb,0xab,0x89,0x31,0x44,0x34,0x33,0x33,
+0x02,0x90,0xaa,0x09,0x62,0x44,0x24,0x13,0x91,0xdc,0xcd,0xcc,0xba,0xaa,0x8a,0x08,
+0x22,0x33,0x23,0x02,0x89,0x89,0x30,0x54,0x44,0x34,0x34,0x23,0x82,0xa9,0xdc,0xcb,
+0xbb,0xaa,0x18,0x53,0x34,0x34,0x33,0x22,0x80,0xa8,0x8a,0x31,0x55,0x24,0x23,0x02,
+0xd9,0xdd,0xcc,0xbc,0xba,0x9a,0x09,0x10,0x23,0x23,0x11,0x88,0x89,0x08,0x32,0x56,
+0x34,0x35,0x24,0x12,0x90,0xba,0xbe,0xcb,0x9a,0x09,0x22,0x35,0x53,0x32,0x22,0x02,
+0x98,0x99,0x08,0x52,0x44,0x43,0x12,0xa0,0xdd,0xcd,0xcb,0xbb,0xaa,0x89,0x18,0x22,
+0x32,0x22,0x01,0x88,0x88,0x21,0x64,0x44,0x44,0x32,0x13,0x01,0xb9,0xcc,0xbc,0xbb,
+0x8b,0x28,0x63,0x53,0x33,0x23,0x12,0x90,0x99,0x89,0x41,0x44,0x34,0x33,0x01,0xeb,
+0xdd,0xcc,0xbb,0xbb,0x9b,0x08,0x11,0x33,0x23,0x12,0x88,0x99,0x18,0x52,0x55,0x53,
+0x43,0x23,0x12,0x80,0xdb,0xbc,0xbc,0x9a,0x19,0x41,0x53,0x33,0x24,0x22,0x81,0x98,
+0x99,0x18,0x52,0x44,0x24,0x12,0xb8,0xde,0xcc,0xcb,0xbb,0xaa,0x88,0x18,0x22,0x32,
+0x22,0x01,0x98,0x98,0x21,0x46,0x45,0x24,0x24,0x12,0x80,0xa9,0xcc,0xbb,0xac,0x99,
+0x10,0x53,0x34,0x34,0x22,0x11,0x80,0x89,0x09,0x31,0x46,0x24,0x13,0x91,0xeb,0xcd,
+0xcc,0xbb,0xbb,0x9a,0x08,0x21,0x33,0x23,0x02,0x80,0x99,0x10,0x54,0x54,0x53,0x33,
+0x43,0x11,0x98,0xdb,0xbc,0xbb,0x9a,0x10,0x52,0x44,0x23,0x23,0x12,0x80,0x98,0x89,
+0x31,0x37,0x35,0x12,0xa0,0xce,0xbd,0xbd,0xcb,0x9a,0x89,0x10,0x21,0x12,0x02,0x81,
+0x98,0x88,0x30,0x46,0x35,0x34,0x23,0x12,0x98,0xcc,0xcc,0xba,0x99,0x18,0x42,0x44,
+0x33,0x23,0x22,0x80,0x88,0x08,0x42,0x35,0x25,0x13,0x90,0xdd,0xcd,0xcb,0xcb,0x9a,
+0x89,0x00,0x12,0x22,0x11,0x88,0x88,0x88,0x32,0x56,0x53,0x33,0x24,0x11,0x98,0xdb,
+0xbc,0xbb,0x9a,0x18,0x34,0x45,0x23,0x14,0x02,0x80,0x98,0x08,0x31,0x45,0x43,0x12,
+0xa0,0xfc,0xeb,0xbb,0xbc,0x9b,0x89,0x10,0x22,0x22,0x11,0x80,0x98,0x80,0x42,0x55,
+0x53,0x43,0x23,0x11,0xa8,0xdb,0xbc,0xbb,0x9a,0x10,0x34,0x36,0x33,0x33,0x02,0x80,
+0x99,0x09,0x42,0x46,0x33,0x23,0xb8,0xcf,0xcd,0xcb,0xbb,0xaa,0x88,0x10,0x32,0x22,
+0x12,0x80,0x98,0x08,0x52,0x64,0x53,0x33,0x23,0x02,0xa8,0xbd,0xbd,0xab,0x9a,0x10,
+0x34,0x45,0x23,0x33,0x11,0x88,0x98,0x08,0x52,0x44,0x33,0x23,0xb8,0xdf,0xdc,0xbb,
+0xac,0xaa,0x88,0x00,0x22,0x22,0x12,0x80,0x88,0x09,0x42,0x55,0x53,0x33,0x24,0x01,
+0x98,0xdb,0xcb,0xab,0x9a,0x28,0x53,0x34,0x34,0x23,0x02,0x88,0x89,0x08,0x52,0x44,
+0x33,0x13,0xb0,0xdf,0xcc,0xbc,0xac,0xaa,0x88,0x10,0x12,0x22,0x11,0x80,0x88,0x08,
+0x32,0x47,0x53,0x43,0x32,0x01,0xa8,0xdb,0xbc,0xbb,0x99,0x20,0x44,0x34,0x34,0x22,
+0x01,0x88,0x99,0x18,0x52,0x34,0x25,0x12,0xa0,0xed,0xcc,0xbc,0xba,0xaa,0x09,0x10,
+0x32,0x22,0x12,0x80,0x89,0x08,0x63,0x54,0x43,0x24,0x23,0x01,0xa8,0xcc,0xdb,0xaa,
+0x89,0x10,0x52,0x43,0x33,0x33,0x11,0x88,0x9a,0x08,0x52,0x45,0x33,0x12,0xb8,0xdf,
+0xcc,0xac,0xbb,0xaa,0x88,0x10,0x22,0x22,0x02,0x80,0x98,0x18,0x52,0x45,0x44,0x33,
+0x23,0x02,0xa9,0xdc,0xbc,0xab,0x9a,0x28,0x63,0x43,0x24,0x22,0x01,0x80,0x88,0x18,
+0x52,0x53,0x33,0x12,0xc8,0xdd,0xcc,0xbc,0xbb,0xaa,0x88,0x20,0x32,0x13,0x02,0x88,
+0x99,0x18,0x63,0x54,0x34,0x34,0x23,0x11,0xb9,0xdc,0xcb,0xba,0x99,0x10,0x34,0x35,
+0x34,0x32,0x01,0x88,0x89,0x19,0x42,0x35,0x25,0x12,0xb8,0xde,0xcc,0xbc,0xbb,0x9a,
+0x09,0x11,0x32,0x22,0x11,0x80,0x89,0x00,0x53,0x45,0x35,0x24,0x23,0x02,0xa9,0xdc,
+0xbb,0xac,0x89,0x20,0x53,0x43,0x33,0x33,0x11,0x88,0xa9,0x18,0x73,0x53,0x23,0x02,
+0xb9,0xdf,0xbc,0xbd,0xba,0x9a,0x08,0x21,0x22,0x12,0x01,0x88,0x08,0x30,0x45,0x45,
+0x34,0x33,0x12,0xa8,0xeb,0xcb,0xab,0x8a,0x20,0x53,0x34,0x43,0x22,0x01,0x88,0x89,
+0x10,0x63,0x53,0x22,0x81,0xeb,0xcd,0xbc,0xbc,0xab,0x89,0x00,0x22,0x22,0x02,0x00,
+0x98,0x18,0x52,0x45,0x34,0x34,0x23,0x01,0xba,0xdc,0xcb,0xaa,0x88,0x21,0x44,0x34,
+0x33,0x12,0x81,0x99,0x89,0x32,0x55,0x43,0x22,0xa0,0xdd,0xcd,0xbc,0xbb,0xaa,0x88,
+0x21,0x22,0x22,0x01,0x88,0x89,0x20,0x45,0x36,0x34,0x24,0x12,0x88,0xca,0xbc,0xac,
+0x9a,0x08,0x33,0x36,0x34,0x23,0x11,0x90,0x98,0x08,0x43,0x45,0x33,0x02,0xda,0xce,
+0xcc,0xcb,0xaa,0x8a,0x08,0x12,0x22,0x12,0x81,0x88,0x08,0x30,0x46,0x44,0x43,0x22,
+0x02,0xa8,0xdb,0xbc,0xba,0x99,0x21,0x54,0x43,0x23,0x22,0x81,0x98,0x89,0x30,0x54,
+0x53,0x22,0x91,0xfb,0xbd,0xbd,0xac,0xaa,0x89,0x10,0x21,0x22,0x11,0x08,0x89,0x18,
+0x51,0x44,0x35,0x24,0x13,0x81,0xb9,0xbe,0xac,0xaa,0x08,0x41,0x43,0x34,0x32,0x12,
+0x88,0xa9,0x08,0x42,0x45,0x43,0x11,0xb8,0xdd,0xbd,0xad,0xbb,0x9a,0x08,0x11,0x22,
+0x23,0x11,0x80,0x08,0x30,0x55,0x44,0x43,0x33,0x02,0x90,0xcc,0xdb,0xba,0x99,0x10,
+0x43,0x44,0x23,0x23,0x01,0x88,0x99,0x10,0x44,0x35,0x33,0x01,0xfb,0xcd,0xbc,0xbc,
+0xbb,0x99,0x10,0x21,0x32,0x12,0x00,0x98,0x08,0x41,0x46,0x34,0x34,0x33,0x01,0xb8,
+0xcd,0xcb,0xab,0x88,0x21,0x44,0x34,0x33,0x22,0x81,0x98,0x88,0x21,0x36,0x35,0x22,
+0xa0,0xdd,0xcd,0xbc,0xac,0xaa,0x88,0x10,0x22,0x12,0x01,0x80,0x88,0x20,0x53,0x45,
+0x34,0x24,0x22,0x80,0xca,0xdb,0xbb,0x9a,0x08,0x43,0x44,0x33,0x24,0x11,0x80,0x89,
+0x09,0x42,0x35,0x34,0x11,0xd9,0xec,0xbc,0xbc,0xbb,0xa9,0x00,0x21,0x22,0x22,0x01,
+0x88,0x09,0x30,0x46,0x45,0x43,0x32,0x01,0x98,0xbc,0xbd,0xba,0x89,0x20,0x63,0x43,
+0x24,0x12,0x81,0x90,0x98,0x10,0x53,0x34,0x24,0x81,0xeb,0xcd,0xcc,0xab,0xab,0x99,
+0x10,0x22,0x22,0x02,0x80,0x98,0x00,0x52,0x54,0x34,0x34,0x23,0x81,0xb9,0xcd,0xbb,
+0x9c,0x89,0x31,0x54,0x33,0x24,0x12,0x80,0x98,0x09,0x31,0x54,0x24,0x13,0xa8,0xde,
+0xcc,0xac,0xac,0x99,0x88,0x11,0x21,0x12,0x10,0x88,0x88,0x10,0x63,0x44,0x43,0x33,
+0x13,0x80,0xdb,0xbc,0xac,0x9a,0x10,0x43,0x44,0x33,0x23,0x02,0x88,0x99,0x28,0x54,
+0x34,0x33,0x80,0xec,0xcd,0xbc,0xac,0xaa,0x88,0x11,0x21,0x12,0x81,0x80,0x89,0x20,
+0x54,0x44,0x34,0x32,0x11,0xa9,0xcc,0xcb,0xab,0x89,0x31,0x54,0x43,0x22,0x12,0x00,
+0x98,0x08,0x31,0x36,0x25,0x02,0xd9,0xcd,0xbd,0xbc,0xaa,0x99,0x18,0x21,0x12,0x02,
+0x80,0x88,0x10,0x54,0x54,0x33,0x24,0x22,0x88,0xda,0xcb,0xaa,0x8a,0x20,0x34,0x35,
+0x34,0x12,0x81,0x88,0x89,0x20,0x54,0x43,0x22,0xa8,0xed,0xcc,0xbc,0xab,0x9b,0x08,
+0x21,0x22,0x12,0x80,0x88,0x08,0x41,0x45,0x35,0x34,0x22,0x01,0xba,0xdc,0xbb,0x9b,
+0x09,0x43,0x44,0x24,0x23,0x11,0x88,0x98,0x00,0x53,0x34,0x24,0x82,0xeb,0xdd,0xdb,
+0xab,0xaa,0x89,0x10,0x22,0x12,0x01,0x88,0x08,0x20,0x64,0x53,0x24,0x23,0x02,0x98,
+0xdb,0xbc,0xab,0x99,0x31,0x44,0x25,0x33,0x12,0x00,0x99,0x88,0x32,0x46,0x43,0x11,
+0xb9,0xde,0xcc,0xcb,0xaa,0x99,0x00,0x21,0x21,0x11,0x08,0x88,0x18,0x42,0x45,0x35,
+0x33,0x13,0x91,0xda,0xbc,0xac,0x9a,0x10,0x53,0x34,0x33,0x23,0x81,0x90,0x88,0x30,
+0x64,0x43,0x22,0x90,0xce,0xcd,0xbc,0xab,0x9b,0x08,0x20,0x22,0x13,0x81,0x88,0x09,
+0x31,0x56,0x34,0x34,0x33,0x01,0xb9,0xcd,0xcb,0xaa,0x08,0x31,0x54,0x33,0x33,0x12,
+0x88,0x98,0x18,0x63,0x34,0x24,0x01,0xea,0xcd,0xcc,0xbb,0xab,0x89,0x20,0x21,0x22,
+0x01,0x80,0x80,0x20,0x54,0x35,0x35,0x33,0x02,0x98,0xcc,0xdb,0xaa,0x89,0x20,0x34,
+0x35,0x33,0x13,0x01,0x98,0x08,0x41,0x44,0x34,0x02,0xc8,0xde,0xbc,0xbc,0xab,0x9a,
+0x08,0x22,0x22,0x12,0x81,0x80,0x18,0x53,0x36,0x35,0x24,0x22,0x80,0xba,0xcd,0xab,
+0x9b,0x18,0x53,0x53,0x33,0x22,0x02,0x98,0x98,0x20,0x54,0x34,0x23,0x90,0xce,0xbe,
+0xbd,0xbb,0x9a,0x09,0x20,0x22,0x21,0x00,0x90,0x88,0x31,0x55,0x35,0x34,0x23,0x01,
+0xb8,0xcd,0xac,0xaa,0x09,0x32,0x54,0x33,0x32,0x12,0x88,0x98,0x28,0x63,0x44,0x33,
+0x82,0xda,0xce,0xbd,0xbb,0xab,0x89,0x20,0x22,0x23,0x02,0x80,0x98,0x10,0x54,0x54,
+0x43,0x33,0x12,0x98,0xdb,0xcc,0xaa,0x8a,0x20,0x43,0x35,0x24,0x12,0x80,0x88,0x09,
+0x21,0x35,0x25,0x13,0xb8,0xde,0xbd,0xcc,0xaa,0x99,0x08,0x11,0x22,0x01,0x81,0x88,
+0x18,0x41,0x54,0x53,0x33,0x23,0x80,0xca,0xcc,0xab,0xaa,0x00,0x53,0x34,0x34,0x22,
+0x01,0x88,0x98,0x11,0x44,0x25,0x23,0x90,0xfc,0xcc,0xcb,0xbb,0x9b,0x09,0x21,0x22,
+0x12,0x80,0x90,0x10,0x53,0x45,0x34,0x24,0x12,0x80,0xca,0xbc,0xac,0x99,0x20,0x44,
+0x43,0x23,0x12,0x81,0x88,0x08,0x52,0x53,0x33,0x01,0xfb,0xcd,0xbc,0xac,0xaa,0x88,
+0x20,0x21,0x12,0x80,0x80,0x08,0x31,0x46,0x44,0x33,0x22,0x80,0xda,0xcb,0xbb,0x9a,
+0x20,0x44,0x44,0x22,0x12,0x81,0x88,0x08,0x32,0x36,0x24,0x02,0xda,0xce,0xcc,0xba,
+0xab,0x89,0x10,0x12,0x22,0x00,0x88,0x08,0x31,0x55,0x44,0x33,0x24,0x81,0xb9,0xcc,
+0xac,0x9a,0x18,0x42,0x44,0x32,0x13,0x01,0x98,0x88,0x30,0x45,0x34,0x12,0xc8,0xce,
+0xbd,0xbc,0xab,0x89,0x00,0x22,0x22,0x01,0x88,0x09,0x10,0x45,0x45,0x33,0x24,0x81,
+0xb8,0xbc,0xad,0xaa,0x18,0x42,0x53,0x33,0x33,0x01,0x80,0x09,0x20,0x54,0x34,0x23,
+0xb8,0xdf,0xcc,0xcb,0xaa,0x8a,0x08,0x12,0x12,0x11,0x08,0x88,0x10,0x62,0x44,0x53,
+0x22,0x02,0x98,0xbc,0xbc,0xbb,0x09,0x32,0x36,0x25,0x13,0x02,0x90,0x88,0x10,0x53,
+0x44,0x22,0x90,0xdd,0xcd,0xcb,0xba,0x9a,0x80,0x21,0x21,0x11,0x00,0x98,0x10,0x52,
+0x45,0x43,0x33,0x12,0xa0,0xcc,0xbc,0xaa,0x89,0x31,0x45,0x43,0x23,0x12,0x80,0x88,
+0x10,0x44,0x35,0x32,0x90,0xec,0xcc,0xbc,0xcb,0x9a,0x88,0x20,0x21,0x11,0x80,0x90,
+0x00,0x42,0x54,0x34,0x24,0x13,0x80,0xcb,0xcc,0xba,0x99,0x11,0x44,0x43,0x23,0x22,
+0x80,0x98,0x08,0x52,0x44,0x23,0x02,0xeb,0xce,0xdb,0xba,0x9a,0x89,0x20,0x21,0x21,
+0x00,0x88,0x08,0x31,0x65,0x53,0x33,0x22,0x80,0xca,0xbc,0xac,0x9a,0x10,0x52,0x53,
+0x23,0x22,0x81,0x88,0x08,0x41,0x63,0x32,0x02,0xca,0xcf,0xcc,0xbb,0xaa,0x8a,0x10,
+0x22,0x22,0x00,0x80,0x08,0x30,0x55,0x44,0x24,0x23,0x01,0xb9,0xbd,0xbc,0xaa,0x00,
+0x53,0x53,0x32,0x22,0x00,0x88,0x09,0x30,0x54,0x34,0x12,0xc8,0xed,0xdb,0xbb,0xab,
+0x99,0x10,0x12,0x13,0x01,0x80,0x89,0x21,0x55,0x34,0x35,0x23,0x02,0xa9,0xbd,0xbc,
+0xab,0x88,0x42,0x44,0x24,0x23,0x01,0x88,0x88,0x10,0x44,0x34,0x23,0xb0,0xee,0xcc,
+0xcb,0xba,0x99,0x18,0x11,0x12,0x02,0x80,0x89,0x10,0x53,0x45,0x34,0x33,0x12,0xa8,
+0xcc,0xbc,0xbb,0x09,0x42,0x44,0x33,0x33,0x11,0x88,0x98,0x11,0x45,0x34,0x14,0x90,
+0xec,0xcc,0xbc,0xbb,0x9a,0x08,0x21,0x22,0x02,0x00,0x89,0x18,0x63,0x54,0x43,0x23,
+0x13,0x90,0xda,0xbc,0xab,0x8a,0x10,0x34,0x35,0x24,0x23,0x02,0x80,0x99,0x08,0x52,
+0x44,0x24,0x12,0xa9,0xcf,0xbc,0xbd,0xab,0x9b,0x89,0x11,0x32,0x23,0x11,0x90,0x98,
+0x18,0x53,0x46,0x43,0x24,0x23,0x01,0xa9,0xcc,0xcb,0xbb,0x8a,0x10,0x44,0x34,0x34,
+0x22,0x01,0x88,0x99,0x08,0x52,0x44,0x33,0x13,0xb9,0xef,0xbc,0xcc,0xba,0x9a,0x88,
+0x11,0x21,0x13,0x12,0x80,0x80,0x10,0x43,0x46,0x53,0x33,0x33,0x02,0xa8,0xdc,0xcb,
+0xba,0x89,0x10,0x53,0x53,0x32,0x23,0x02,0x90,0x98,0x08,0x43,0x36,0x34,0x12,0xc8,
+0xed,0xdb,0xac,0xbb,0x9a,0x88,0x11,0x22,0x13,0x02,0x90,0x88,0x18,0x53,0x45,0x44,
+0x33,0x23,0x02,0xb9,0xcd,0xbc,0xba,0x99,0x21,0x63,0x43,0x33,0x33,0x01,0x90,0x89,
+0x08,0x63,0x34,0x25,0x11,0xb9,0xcf,0xcc,0xcb,0xab,0xaa,0x08,0x10,0x32,0x22,0x11,
+0x80,0x99,0x00,0x63,0x35,0x45,0x23,0x23,0x01,0xa9,0xcd,0xbb,0xbb,0x8a,0x21,0x45,
+0x53,0x23,0x13,0x11,0x98,0x98,0x18,0x53,0x35,0x24,0x02,0xc9,0xdd,0xcc,0xbb,0xac,
+0xaa,0x08,0x20,0x31,0x21,0x01,0x80,0x88,0x10,0x63,0x54,0x43,0x33,0x23,0x02,0xb9,
+0xcd,0xbc,0xbb,0x89,0x20,0x35,0x35,0x33,0x33,0x11,0x98,0x99,0x18,0x73,0x53,0x23,
+0x02,0xc8,0xdd,0xbd,0xbc,0xac,0x9a,0x08,0x10,0x22,0x21,0x01,0x80,0x88,0x00,0x43,
+0x46,0x53,0x33,0x32,0x01,0xc9,0xeb,0xbb,0xab,0x99,0x31,0x54,0x43,0x33,0x22,0x01,
+0x88,0x8a,0x18,0x44,0x35,0x34,0x11,0xc8,0xdd,0xbd,0xbc,0xbb,0x9a,0x88,0x21,0x23,
+0x22,0x01,0x80,0x89,0x10,0x54,0x45,0x53,0x32,0x22,0x01,0xb9,0xbd,0xcc,0x9a,0x89,
+0x20,0x53,0x34,0x33,0x33,0x01,0x90,0x99,0x18,0x54,0x34,0x34,0x02,0xc9,0xde,0xdb,
+0xcb,0xab,0x9a,0x08,0x20,0x22,0x21,0x01,0x80,0x89,0x10,0x63,0x54,0x43,0x43,0x12,
+0x00,0xb9,0xeb,0xbb,0xbb,0x8a,0x31,0x45,0x43,0x43,0x12,0x01,0x88,0x99,0x08,0x43,
+0x35,0x24,0x02,0xc9,0xde,0xbc,0xad,0xbb,0x9a,0x08,0x20,0x22,0x23,0x01,0x80,0x80,
+0x11,0x54,0x44,0x34,0x43,0x23,0x01,0xa9,0xcc,0xbc,0xaa,0x8a,0x31,0x44,0x34,0x24,
+0x12,0x01,0x98,0x98,0x10,0x53,0x35,0x43,0x01,0xc9,0xce,0xbd,0xbc,0xab,0x9a,0x08,
+0x11,0x32,0x22,0x01,0x80,0x99,0x28,0x73,0x54,0x43,0x33,0x32,0x81,0xb9,0xbe,0xad,
+0xaa,0x09,0x21,0x34,0x35,0x33,0x13,0x01,0x98,0x89,0x20,0x54,0x44,0x23,0x02,0xea,
+0xdc,0xcc,0xbb,0xbb,0x9a,0x09,0x11,0x23,0x33,0x12,0x81,0x98,0x08,0x42,0x47,0x44,
+0x33,0x24,0x11,0x98,0xba,0xcd,0xbb,0xaa,0x89,0x32,0x45,0x34,0x33,0x23,0x01,0x98,
+0x89,0x18,0x54,0x34,0x24,0x12,0xa0,0xde,0xcc,0xbc,0xac,0xaa,0x89,0x18,0x21,0x22,
+0x22,0x00,0x88,0x88,0x20,0x54,0x44,0x44,0x33,0x23,0x81,0xb9,0xcd,0xbb,0xac,0x8a,
+0x10,0x34,0x35,0x43,0x32,0x11,0x80,0x99,0x89,0x31,0x45,0x34,0x24,0x81,0xea,0xcd,
+0xcc,0xbb,0xab,0x9a,0x08,0x11,0x33,0x23,0x11,0x88,0x98,0x00,0x42,0x55,0x44,0x34,
+0x33,0x12,0xa8,0xdb,0xbc,0xbc,0xaa,0x08,0x42,0x34,0x34,0x43,0x22,0x01,0x98,0x99,
+0x28,0x44,0x34,0x24,0x12,0xb9,0xee,0xbc,0xbd,0xbb,0xaa,0x99,0x10,0x32,0x23,0x12,
+0x81,0x88,0x18,0x31,0x55,0x45,0x34,0x43,0x12,0x80,0xa9,0xbc,0xbd,0xab,0x8a,0x31,
+0x54,0x33,0x34,0x32,0x11,0x88,0xaa,0x88,0x42,0x45,0x43,0x22,0x81,0xfa,0xcd,0xbc,
+0xac,0xab,0x8a,0x08,0x21,0x23,0x12,0x01,0x98,0x88,0x08,0x43,0x46,0x44,0x24,0x23,
+0x01,0xa8,0xdb,0xdb,0xba,0x9a,0x00,0x42,0x53,0x33,0x24,0x22,0x00,0x98,0x89,0x20,
+0x63,0x53,0x32,0x02,0xc9,0xde,0xcc,0xcb,0xba,0x9a,0x88,0x10,0x32,0x22,0x22,0x00,
+0x88,0x00,0x41,0x55,0x53,0x43,0x23,0x13,0x81,0xca,0xbd,0xbc,0xaa,0x89,0x21,0x44,
+0x34,0x33,0x23,0x01,0x88,0xa9,0x08,0x52,0x45,0x33,0x13,0x90,0xec,0xcd,0xcc,0xbb,
+0xbb,0x99,0x18,0x21,0x23,0x13,0x02,0x88,0x89,0x10,0x44,0x36,0x45,0x33,0x23,0x02,
+0xb8,0xdc,0xcb,0xab,0x9a,0x18,0x53,0x34,0x24,0x33,0x12,0x01,0x99,0x99,0x28,0x55,
+0x53,0x22,0x81,0xd9,0xdc,0xcc,0xcb,0xba,0x9a,0x88,0x11,0x31,0x22,0x22,0x80,0x88,
+0x08,0x42,0x45,0x44,0x43,0x33,0x13,0x90,0xcb,0xbd,0xac,0x9b,0x0a,0x30,0x45,0x43,
+0x33,0x22,0x01,0x98,0x99,0x08,0x53,0x35,0x24,0x13,0xa0,0xdd,0xcd,0xbc,0xac,0xaa,
+0x99,0x00,0x21,0x32,0x12,0x81,0x98,0x09,0x20,0x54,0x44,0x34,0x34,0x33,0x81,0xb9,
+0xcd,0xcb,0xaa,0x8a,0x28,0x53,0x53,0x23,0x23,0x22,0x00,0x99,0x99,0x31,0x65,0x33,
+0x14,0x81,0xda,0xce,0xbc,0xbc,0xbb,0x9a,0x09,0x10,0x33,0x23,0x03,0x80,0x89,0x18,
+0x63,0x44,0x35,0x44,0x32,0x11,0x98,0xbb,0xcd,0xbb,0xab,0x09,0x42,0x44,0x43,0x32,
+0x23,0x11,0x99,0xa9,0x18,0x54,0x53,0x22,0x12,0xa0,0xed,0xdc,0xcb,0xab,0x9b,0x8a,
+0x18,0x31,0x33,0x23,0x81,0x98,0x89,0x20,0x63,0x44,0x35,0x25,0x33,0x11,0x98,0xca,
+0xbc,0xac,0xab,0x8a,0x30,0x54,0x43,0x33,0x33,0x12,0x00,0xaa,0x9a,0x38,0x56,0x43,
+0x23,0x02,0xc9,0xce,0xcd,0xcb,0xba,0x9a,0x89,0x18,0x21,0x42,0x12,0x80,0x98,0x88,
+0x21,0x32,0x45,0x45,0x53,0x32,0x01,0xa0,0xba,0xcc,0xbc,0xba,0x8a,0x30,0x44,0x34,
+0x24,0x23,0x22,0x80,0x99,0x88,0x31,0x55,0x43,0x32,0x11,0xa9,0xdf,0xcc,0xcb,0xbb,
+0xaa,0x89,0x00,0x22,0x32,0x23,0x00,0x99,0x89,0x30,0x54,0x54,0x43,0x34,0x33,0x12,
+0xa0,0xcb,0xdc,0xbb,0xbb,0x89,0x31,0x35,0x35,0x33,0x24,0x13,0x80,0x9a,0x8a,0x41,
+0x44,0x43,0x23,0x12,0xc8,0xde,0xcc,0xbc,0xbb,0xaa,0x8a,0x00,0x22,0x33,0x23,0x02,
+0x98,0x99,0x20,0x54,0x44,0x35,0x44,0x22,0x12,0x98,0xca,0xcb,0xbc,0xab,0x8a,0x41,
+0x53,0x33,0x33,0x24,0x13,0x81,0xa9,0x9a,0x41,0x54,0x43,0x22,0x12,0xb8,0xee,0xcc,
+0xcb,0xbb,0xab,0x89,0x18,0x31,0x33,0x23,0x01,0x98,0x98,0x10,0x53,0x36,0x36,0x44,
+0x22,0x12,0x90,0xca,0xcb,0xac,0xbb,0x89,0x30,0x45,0x33,0x33,0x24,0x13,0x81,0xa9,
+0xaa,0x30,0x56,0x33,0x23,0x02,0xb8,0xdf,0xcd,0xcb,0xbb,0xab,0x99,0x10,0x21,0x43,
+0x21,0x00,0x88,0x09,0x18,0x42,0x45,0x35,0x34,0x24,0x11,0x98,0xba,0xcc,0xcb,0xab,
+0x8a,0x20,0x35,0x35,0x32,0x33,0x22,0x01,0xa9,0x9b,0x30,0x56,0x43,0x22,0x02,0xb9,
+0xde,0xcd,0xbc,0xba,0xab,0x99,0x08,0x22,0x24,0x13,0x81,0x88,0x89,0x11,0x42,0x54,
+0x54,0x33,0x24,0x02,0x90,0xba,0xbd,0xbc,0xab,0x9a,0x31,0x54,0x43,0x43,0x22,0x12,
+0x00,0xa9,0x99,0x28,0x45,0x34,0x24,0x01,0xa8,0xde,0xcc,0xbc,0xab,0x9b,0x99,0x00,
+0x21,0x33,0x24,0x81,0x88,0x09,0x00,0x42,0x63,0x54,0x43,0x33,0x11,0x98,0xca,0xcb,
+0xbc,0xac,0x89,0x20,0x43,0x34,0x34,0x32,0x12,0x81,0x99,0x9a,0x20,0x45,0x44,0x32,
+0x11,0xb8,0xdf,0xcc,0xbc,0xbb,0xaa,0x8a,0x08,0x31,0x33,0x24,0x00,0x88,0x08,0x21,
+0x34,0x35,0x55,0x43,0x33,0x12,0x88,0xba,0xcc,0xbc,0xab,0x8a,0x31,0x45,0x33,0x43,
+0x33,0x22,0x80,0xba,0x8a,0x41,0x36,0x24,0x33,0x12,0xb8,0xdf,0xcd,0xbc,0xbb,0xab,
+0x99,0x00,0x21,0x43,0x22,0x01,0x88,0x89,0x10,0x53,0x44,0x44,0x34,0x33,0x13,0x98,
+0xca,0xcc,0xcb,0xab,0x8a,0x21,0x35,0x34,0x33,0x43,0x12,0x81,0xa8,0x9b,0x28,0x54,
+0x34,0x33,0x23,0x91,0xfb,0xbf,0xcd,0xbb,0xbb,0x9a,0x89,0x11,0x22,0x24,0x13,0x01,
+0x98,0x88,0x21,0x43,0x54,0x63,0x43,0x43,0x12,0x80,0xa9,0xbc,0xbc,0xac,0x9b,0x08,
+0x42,0x34,0x44,0x32,0x32,0x12,0x80,0xaa,0x9b,0x20,0x37,0x25,0x23,0x02,0xa8,0xed,
+0xcc,0xcc,0xba,0xab,0x99,0x09,0x11,0x42,0x22,0x12,0x80,0x99,0x88,0x20,0x53,0x35,
+0x45,0x34,0x32,0x12,0x98,0xca,0xdb,0xcb,0xbb,0x8a,0x28,0x44,0x43,0x43,0x22,0x23,
+0x02,0x90,0xaa,0x89,0x41,0x45,0x43,0x32,0x11,0xb9,0xef,0xbc,0xbd,0xbb,0xaa,0x99,
+0x08,0x21,0x42,0x23,0x02,0x90,0x99,0x08,0x31,0x54,0x35,0x45,0x33,0x23,0x02,0xa8,
+0xbc,0xbd,0xbc,0xab,0x9a,0x21,0x45,0x34,0x32,0x33,0x23,0x02,0xb8,0xbb,0x18,0x64,
+0x34,0x24,0x12,0x01,0xda,0xce,0xbd,0xbc,0xbb,0x9b,0x89,0x18,0x22,0x24,0x23,0x01,
+0x88,0x89,0x10,0x42,0x44,0x44,0x44,0x24,0x13,0x81,0xa9,0xdb,0xcb,0xbb,0xab,0x08,
+0x42,0x44,0x33,0x34,0x33,0x12,0x80,0xaa,0x9b,0x28,0x55,0x34,0x24,0x11,0x90,0xec,
+0xdc,0xcb,0xac,0xab,0x9a,0x88,0x10,0x22,0x24,0x11,0x80,0x89,0x89,0x20,0x52,0x44,
+0x53,0x34,0x33,0x22,0x80,0xca,0xcc,0xcb,0xbb,0x9a,0x10,0x44,0x34,0x43,0x32,0x32,
+0x12,0x80,0x99,0x89,0x41,0x45,0x34,0x23,0x12,0xb9,0xdf,0xdc,0xcb,0xba,0xaa,0x8a,
+0x88,0x11,0x32,0x24,0x11,0x88,0x89,0x08,0x11,0x34,0x46,0x34,0x35,0x23,0x02,0x90,
+0xbb,0xcd,0xcb,0xbb,0x9a,0x20,0x44,0x34,0x33,0x24,0x23,0x11,0x98,0xab,0x0a,0x63,
+0x44,0x32,0x22,0x02,0xd9,0xdd,0xcd,0xcb,0xab,0xaa,0x89,0x00,0x21,0x32,0x33,0x11,
+0x98,0x9a,0x00,0x53,0x44,0x34,0x45,0x43,0x23,0x81,0xa8,0xcb,0xdb,0xbb,0xab,0x8a,
+0x32,0x45,0x43,0x43,0x32,0x22,0x00,0x99,0x9b,0x19,0x73,0x43,0x24,0x12,0x80,0xeb,
+0xdc,0xcc,0xbb,0xbb,0xab,0x89,0x10,0x32,0x34,0x22,0x81,0x98,0x89,0x20,0x52,0x44,
+0x35,0x35,0x43,0x12,0x80,0xa9,0xdb,0xbc,0xcb,0x9a,0x19,0x42,0x34,0x24,0x33,0x33,
+0x22,0x90,0xaa,0x8b,0x40,0x45,0x34,0x23,0x22,0x98,0xde,0xdd,0xcb,0xbb,0xab,0xaa,
+0x88,0x11,0x32,0x34,0x22,0x80,0x99,0x89,0x11,0x53,0x54,0x44,0x34,0x33,0x12,0x90,
+0xcb,0xdb,0xcb,0xbb,0x9a,0x28,0x53,0x44,0x32,0x33,0x23,0x12,0x90,0xba,0x9a,0x52,
+0x36,0x24,0x23,0x11,0xa9,0xdf,0xdc,0xbb,0xbc,0xaa,0x99,0x88,0x11,0x33,0x33,0x23,
+0x81,0x98,0x89,0x20,0x54,0x44,0x53,0x34,0x34,0x22,0x02,0xa8,0xdb,0xcb,0xbc,0xab,
+0x8a,0x20,0x54,0x33,0x34,0x32,0x33,0x12,0x90,0xba,0x9c,0x30,0x46,0x34,0x22,0x12,
+0x90,0xfb,0xdd,0xdb,0xcb,0xaa,0x9a,0x89,0x08,0x21,0x33,0x24,0x01,0x98,0x99,0x08,
+0x31,0x53,0x44,0x35,0x34,0x24,0x02,0x80,0xb9,0xcc,0xdb,0xba,0xab,0x89,0x41,0x63,
+0x33,0x33,0x33,0x32,0x22,0xa8,0xca,0x8a,0x62,0x44,0x33,0x22,0x12,0xa1,0xfd,0xdc,
+0xcb,0xbb,0xba,0xa9,0x89,0x10,0x33,0x34,0x22,0x00,0x99,0x98,0x00,0x31,0x55,0x44,
+0x44,0x43,0x22,0x01,0x98,0xbb,0xcd,0xbb,0xbb,0xab,0x10,0x54,0x53,0x23,0x33,0x33,
+0x22,0x80,0xba,0x9c,0x29,0x54,0x34,0x24,0x22,0x80,0xe9,0xcd,0xbd,0xad,0xab,0x9a,
+0x99,0x08,0x21,0x33,0x24,0x02,0x90,0x89,0x08,0x11,0x42,0x54,0x54,0x43,0x33,0x12,
+0x80,0xa9,0xcc,0xbc,0xbb,0xac,0x09,0x21,0x35,0x25,0x33,0x33,0x23,0x11,0x98,0xca,
+0x99,0x41,0x45,0x43,0x22,0x11,0xa8,0xec,0xcd,0xbc,0xac,0xbb,0xa9,0x89,0x10,0x32,
+0x34,0x22,0x81,0x98,0x89,0x08,0x31,0x45,0x54,0x34,0x34,0x14,0x11,0x98,0xba,0xdb,
+0xac,0xac,0x9a,0x18,0x32,0x45,0x33,0x43,0x22,0x12,0x81,0xaa,0xaa,0x18,0x54,0x44,
+0x23,0x22,0x81,0xd9,0xdd,0xdc,0xbb,0xac,0xaa,0x8a,0x08,0x20,0x32,0x24,0x12,0x80,
+0x98,0x89,0x18,0x31,0x55,0x54,0x43,0x24,0x22,0x00,0x99,0xcb,0xbc,0xbc,0xbb,0x8a,
+0x21,0x35,0x35,0x24,0x32,0x22,0x11,0x88,0xaa,0x8b,0x31,0x47,0x33,0x24,0x12,0x88,
+0xdc,0xce,0xbc,0xbc,0xab,0x9b,0x99,0x10,0x31,0x43,0x32,0x11,0x08,0x89,0x00,0x31,
+0x44,0x45,0x44,0x34,0x33,0x12,0x88,0xca,0xdb,0xcb,0xbb,0x9b,0x09,0x43,0x35,0x34,
+0x32,0x33,0x22,0x01,0xb9,0xab,0x09,0x64,0x34,0x43,0x32,0x11,0xc9,0xed,0xdc,0xbb,
+0xac,0xab,0x99,0x88,0x11,0x32,0x33,0x22,0x80,0xa8,0x89,0x20,0x43,0x36,0x45,0x44,
+0x33,0x33,0x01,0xa9,0xbc,0xcd,0xbb,0xbc,0x9a,0x10,0x44,0x43,0x33,0x43,0x22,0x12,
+0x81,0x9a,0x9a,0x20,0x55,0x43,0x33,0x23,0x01,0xfb,0xcd,0xbd,0xbc,0xab,0xab,0x89,
+0x08,0x31,0x33,0x24,0x02,0x80,0x89,0x89,0x10,0x53,0x45,0x54,0x33,0x34,0x22,0x80,
+0xaa,0xbd,0xbc,0xbc,0xab,0x09,0x31,0x45,0x34,0x23,0x33,0x22,0x02,0xa8,0xca,0x89,
+0x51,0x44,0x43,0x22,0x01,0xa0,0xec,0xcd,0xbc,0xbc,0xab,0xaa,0x89,0x00,0x21,0x34,
+0x33,0x12,0x80,0x99,0x89,0x00,0x42,0x54,0x35,0x45,0x33,0x32,0x11,0x98,0xca,0xbc,
+0xcc,0xba,0xab,0x09,0x41,0x44,0x43,0x23,0x33,0x32,0x12,0x98,0xba,0xab,0x20,0x47,
+0x53,0x32,0x22,0x01,0xc9,0xcf,0xcc,0xbc,0xbb,0xab,0xaa,0x88,0x11,0x33,0x25,0x23,
+0x81,0x88,0x99,0x88,0x21,0x44,0x35,0x36,0x34,0x24,0x13,0x01,0xa9,0xdb,0xbc,0xcb,
+0xab,0xaa,0x00,0x53,0x34,0x34,0x24,0x22,0x22,0x01,0xa8,0xba,0x8a,0x52,0x45,0x33,
+0x32,0x12,0x81,0xfb,0xcf,0xdb,0xcb,0xaa,0xaa,0x98,0x08,0x20,0x42,0x22,0x12,0x80,
+0x89,0x89,0x00,0x22,0x45,0x54,0x53,0x43,0x32,0x11,0x80,0xb9,0xdc,0xbb,0xbc,0xaa,
+0x0a,0x20,0x35,0x35,0x33,0x24,0x23,0x12,0x80,0xaa,0xbb,0x09,0x55,0x34,0x24,0x22,
+0x01,0xa8,0xed,0xbd,0xbe,0xbb,0xba,0x9a,0x89,0x18,0x31,0x34,0x33,0x12,0x98,0x89,
+0x18,0x31,0x53,0x44,0x45,0x34,0x34,0x23,0x01,0xa8,0xca,0xbc,0xbd,0xbb,0xab,0x08,
+0x43,0x35,0x34,0x33,0x24,0x22,0x11,0xa8,0xba,0x9b,0x40,0x45,0x34,0x23,0x22,0x81,
+0xeb,0xed,0xdb,0xcb,0xab,0xab,0x99,0x88,0x10,0x23,0x34,0x12,0x01,0x98,0x99,0x00,
+0x21,0x44,0x44,0x45,0x34,0x43,0x12,0x00,0xaa,0xca,0xbc,0xcb,0xbb,0x8a,0x20,0x35,
+0x35,0x34,0x33,0x33,0x22,0x81,0xa9,0xab,0x09,0x62,0x44,0x43,0x32,0x11,0xa8,0xdd,
+0xce,0xdb,0xbb,0xbb,0xab,0x89,0x08,0x22,0x34,0x33,0x22,0x88,0xa9,0x88,0x10,0x34,
+0x55,0x63,0x43,0x43,0x23,0x11,0x98,0xc9,0xcb,0xbc,0xbc,0xaa,0x09,0x32,0x45,0x43,
+0x32,0x32,0x33,0x12,0x90,0xca,0xaa,0x28,0x55,0x43,0x33,0x12,0x01,0xca,0xcf,0xcd,
+0xcb,0xbb,0xaa,0xaa,0x88,0x20,0x42,0x33,0x22,0x01,0x98,0x99,0x08,0x32,0x64,0x53,
+0x53,0x43,0x24,0x22,0x01,0x99,0xdb,0xcb,0xbb,0xac,0xaa,0x00,0x53,0x34,0x34,0x33,
+0x22,0x23,0x01,0xa8,0xcb,0x8a,0x51,0x44,0x43,0x22,0x12,0x80,0xec,0xec,0xcb,0xcb,
+0xba,0x9a,0x99,0x08,0x20,0x33,0x34,0x12,0x91,0x98,0x89,0x10,0x33,0x45,0x54,0x34,
+0x44,0x22,0x22,0x80,0xaa,0xbd,0xbc,0xbc,0xab,0x89,0x20,0x35,0x44,0x33,0x33,0x23,
+0x22,0x80,0xba,0xac,0x09,0x54,0x44,0x23,0x23,0x01,0xa8,0xee,0xcc,0xbd,0xbb,0xab,
+0xaa,0x89,0x00,0x22,0x44,0x22,0x11,0x88,0x98,0x08,0x20,0x42,0x54,0x44,0x53,0x33,
+0x22,0x01,0xa8,0xdb,0xcb,0xdb,0xba,0x8a,0x28,0x53,0x34,0x33,0x24,0x23,0x12,0x80,
+0xaa,0x9a,0x38,0x46,0x34,0x24,0x12,0x80,0xeb,0xec,0xcb,0xbc,0xbb,0xaa,0x99,0x00,
+0x31,0x43,0x23,0x12,0x88,0x8a,0x89,0x21,0x63,0x44,0x35,0x35,0x32,0x13,0x80,0xb9,
+0xbd,0xbd,0xcb,0xaa,0x09,0x21,0x35,0x34,0x24,0x23,0x22,0x01,0xa8,0xba,0x8a,0x62,
+0x44,0x33,0x33,0x11,0xb9,0xdf,0xcd,0xdb,0xba,0xab,0x9a,0x89,0x00,0x22,0x43,0x22,
+0x01,0x98,0x09,0x10,0x34,0x45,0x53,0x34,0x25,0x23,0x01,0x98,0xba,0xbc,0xbd,0xbb,
+0x9b,0x28,0x54,0x43,0x33,0x33,0x33,0x22,0x80,0xba,0xab,0x38,0x47,0x34,0x33,0x33,
+0x01,0xeb,0xcf,0xcc,0xbc,0xba,0xaa,0x9a,0x08,0x21,0x43,0x23,0x02,0x80,0x89,0x08,
+0x20,0x42,0x45,0x45,0x43,0x43,0x12,0x80,0xa8,0xcb,0xbc,0xbc,0xbb,0x89,0x21,0x45,
+0x43,0x33,0x33,0x23,0x02,0xa0,0xca,0x99,0x32,0x37,0x34,0x23,0x12,0xa0,0xed,0xcd,
+0xbc,0xbc,0xab,0xaa,0x89,0x10,0x31,0x34,0x22,0x11,0x88,0x98,0x08,0x21,0x54,0x45,
+0x53,0x33,0x24,0x12,0x98,0xba,0xbd,0xbc,0xac,0xaa,0x18,0x42,0x35,0x33,0x24,0x33,
+0x22,0x00,0xaa,0xab,0x19,0x54,0x44,0x33,0x23,0x12,0xda,0xde,0xbc,0xbd,0xbb,0xab,
+0x9a,0x88,0x21,0x43,0x33,0x12,0x80,0x89,0x89,0x20,0x43,0x45,0x45,0x34,0x43,0x22,
+0x81,0xa9,0xcb,0xbc,0xbc,0xbb,0x8a,0x20,0x45,0x53,0x32,0x32,0x32,0x11,0x80,0xba,
+0x9b,0x48,0x45,0x34,0x33,0x12,0x91,0xec,0xdd,0xbc,0xbc,0xbb,0xaa,0x99,0x10,0x31,
+0x34,0x23,0x01,0x88,0x89,0x88,0x21,0x54,0x44,0x35,0x34,0x24,0x12,0x90,0xb9,0xbc,
+0xbd,0xbb,0xac,0x88,0x32,0x45,0x43,0x32,0x22,0x23,0x00,0xa8,0xbb,0x1a,0x73,0x34,
+0x24,0x22,0x11,0xb8,0xde,0xcd,0xdb,0xab,0xab,0x99,0x09,0x10,0x32,0x24,0x13,0x81,
+0x99,0x89,0x10,0x42,0x63,0x44,0x53,0x43,0x22,0x01,0x99,0xca,0xdb,0xbb,0xbb,0x9b,
+0x28,0x54,0x43,0x33,0x24,0x22,0x11,0x80,0xaa,0xab,0x28,0x46,0x34,0x33,0x12,0x80,
+0xfa,0xdd,0xcc,0xbb,0xcb,0x9a,0x99,0x08,0x11,0x33,0x24,0x01,0x88,0x98,0x00,0x31,
+0x44,0x35,0x35,0x44,0x32,0x12,0x01,0xa9,0xbc,0xcc,0xbb,0xbb,0x89,0x32,0x36,0x25,
+0x33,0x33,0x23,0x02,0xa8,0xcb,0x8a,0x52,0x54,0x33,0x23,0x11,0xa8,0xfd,0xcc,0xcc,
+0xbb,0xba,0x9a,0x88,0x10,0x31,0x34,0x13,0x01,0x98,0x89,0x10,0x32,0x54,0x45,0x44,
+0x33,0x23,0x01,0xa9,0xdb,0xdb,0xbb,0xbb,0x8a,0x31,0x36,0x25,0x33,0x43,0x12,0x81,
+0xa9,0x9a,0x18,0x44,0x44,0x23,0x22,0x81,0xfb,0xdc,0xbd,0xcb,0xbb,0x9a,0x88,0x10,
+0x21,0x24,0x22,0x01,0x89,0x99,0x10,0x33,0x36,0x45,0x35,0x43,0x12,0x00,0xaa,0xdb,
+0xcb,0xba,0xab,0x08,0x43,0x44,0x43,0x23,0x33,0x21,0x88,0xaa,0x9a,0x30,0x46,0x44,
+0x22,0x12,0xa0,0xec,0xcd,0xdb,0xba,0xab,0x9a,0x88,0x11,0x33,0x33,0x13,0x80,0xa8,
+0x89,0x21,0x64,0x53,0x44,0x43,0x33,0x12,0x88,0xca,0xdb,0xcb,0xbb,0xaa,0x20,0x53,
+0x34,0x43,0x33,0x33,0x12,0xa8,0xab,0x8a,0x62,0x44,0x33,0x33,0x12,0xc9,0xcf,0xcd,
+0xbc,0xbb,0xaa,0x99,0x88,0x21,0x42,0x23,0x12,0x88,0x99,0x18,0x31,0x54,0x44,0x44,
+0x43,0x13,0x02,0xa8,0xca,0xbc,0xbc,0xab,0x9a,0x30,0x54,0x43,0x33,0x33,0x23,0x12,
+0xa9,0xab,0x1a,0x64,0x34,0x33,0x33,0x01,0xea,0xde,0xbc,0xbd,0xab,0xaa,0x89,0x00,
+0x22,0x33,0x33,0x02,0xa8,0x99,0x18,0x63,0x53,0x44,0x44,0x33,0x23,0x00,0xb9,0xbc,
+0xbd,0xbc,0xab,0x09,0x41,0x53,0x43,0x32,0x33,0x12,0x81,0xaa,0xab,0x28,0x55,0x44,
+0x22,0x12,0x90,0xfb,0xcd,0xbc,0xbc,0xba,0xaa,0x89,0x10,0x32,0x24,0x22,0x80,0x98,
+0x89,0x10,0x32,0x46,0x45,0x43,0x43,0x11,0x91,0xb8,0xcb,0xdb,0xbb,0xaa,0x18,0x63,
+0x43,0x33,0x43,0x23,0x22,0x80,0xa9,0x99,0x31,0x46,0x33,0x33,0x12,0xc0,0xde,0xcd,
+0xbc,0xac,0xaa,0x8a,0x09,0x10,0x32,0x33,0x12,0x80,0x99,0x88,0x31,0x54,0x44,0x54,
+0x33,0x33,0x12,0x98,0xcb,0xbc,0xbd,0xbb,0xaa,0x20,0x44,0x44,0x32,0x23,0x33,0x11,
+0x98,0xab,0x8a,0x63,0x35,0x33,0x33,0x11,0xc9,0xdf,0xcd,0xcb,0xab,0xaa,0x89,0x08,
+0x21,0x32,0x33,0x11,0x88,0x99,0x18,0x43,0x44,0x54,0x53,0x43,0x23,0x11,0xa9,0xcb,
+0xcb,0xbc,0xab,0x8a,0x31,0x45,0x43,0x33,0x23,0x23,0x01,0xa9,0xbb,0x18,0x55,0x34,
+0x34,0x12,0x90,0xea,0xdd,0xdb,0xbb,0xcb,0xa9,0x98,0x10,0x21,0x33,0x23,0x00,0x89,
+0x89,0x28,0x43,0x45,0x35,0x35,0x43,0x12,0x80,0xa9,0xdb,0xcb,0xcb,0xaa,0x08,0x32,
+0x36,0x33,0x24,0x33,0x12,0x81,0xaa,0x9a,0x38,0x45,0x35,0x33,0x23,0xa1,0xde,0xdd,
+0xcb,0xbb,0xbb,0x9a,0x09,0x20,0x32,0x24,0x22,0x88,0xa8,0x88,0x21,0x53,0x54,0x44,
+0x34,0x33,0x12,0x90,0xba,0xdc,0xcb,0xcb,0x99,0x10,0x43,0x34,0x43,0x32,0x22,0x01,
+0xa8,0x9a,0x18,0x54,0x34,0x24,0x12,0x80,0xdc,0xdd,0xbc,0xbc,0xaa,0x8a,0x88,0x11,
+0x32,0x33,0x12,0x88,0x89,0x18,0x32,0x46,0x44,0x44,0x24,0x12,0x00,0xa9,0xbc,0xdb,
+0xab,0x9a,0x18,0x34,0x35,0x33,0x24,0x13,0x01,0xa8,0xa9,0x18,0x63,0x34,0x34,0x13,
+0x91,0xec,0xcd,0xcc,0xbb,0xba,0x9a,0x08,0x11,0x23,0x24,0x11,0x98,0x99,0x08,0x31,
+0x45,0x54,0x43,0x43,0x12,0x80,0xaa,0xdb,0xbb,0xad,0xaa,0x00,0x43,0x34,0x24,0x33,
+0x23,0x02,0x98,0x9b,0x18,0x64,0x34,0x33,0x23,0xa0,0xed,0xdc,0xcb,0xbb,0xac,0x99,
+0x88,0x21,0x32,0x22,0x02,0x98,0x99,0x88,0x31,0x46,0x54,0x43,0x43,0x12,0x80,0xa9,
+0xdb,0xcb,0xbb,0xaa,0x18,0x53,0x34,0x34,0x33,0x23,0x02,0xa8,0xaa,0x18,0x54,0x34,
+0x34,0x22,0x91,0xfc,0xdc,0xcb,0xac,0xaa,0x99,0x88,0x11,0x32,0x32,0x01,0x80,0x89,
+0x08,0x31,0x54,0x45,0x34,0x34,0x22,0x80,0xa9,0xcc,0xcb,0xbb,0xab,0x10,0x53,0x44,
+0x23,0x24,0x22,0x01,0x99,0xaa,0x08,0x63,0x34,0x33,0x23,0x81,0xdd,0xce,0xbc,0xac,
+0xab,0x99,0x08,0x20,0x32,0x32,0x02,0x88,0x88,0x10,0x32,0x45,0x45,0x34,0x34,0x23,
+0x00,0xb9,0xcc,0xbc,0xbb,0xab,0x18,0x53,0x35,0x43,0x33,0x22,0x11,0x98,0xaa,0x19,
+0x63,0x44,0x23,0x22,0x80,0xfb,0xdd,0xbc,0xac,0xab,0x99,0x88,0x20,0x31,0x33,0x12,
+0x80,0x99,0x18,0x32,0x45,0x45,0x35,0x33,0x23,0x01,0xba,0xdc,0xbc,0xbb,0x9a,0x18,
+0x52,0x34,0x34,0x33,0x32,0x01,0x98,0xaa,0x18,0x54,0x44,0x33,0x12,0x80,0xfb,0xdd,
+0xbc,0xbc,0xba,0x99,0x88,0x11,0x22,0x24,0x11,0x90,0x89,0x08,0x32,0x54,0x44,0x53,
+0x33,0x23,0x00,0xaa,0xcc,0xdb,0xbb,0xaa,0x28,0x43,0x44,0x33,0x43,0x22,0x02,0x98,
+0xa9,0x18,0x52,0x35,0x43,0x22,0x81,0xfb,0xdc,0xcc,0xbb,0xab,0x9a,0x88,0x11,0x23,
+0x24,0x02,0x90,0x99,0x08,0x32,0x45,0x44,0x34,0x25,0x12,0x81,0xa9,0xcb,0xbc,0xbc,
+0xaa,0x08,0x53,0x43,0x43,0x32,0x22,0x11,0x99,0xaa,0x08,0x44,0x44,0x33,0x22,0x90,
+0xfb,0xce,0xbc,0xbc,0xbb,0xaa,0x88,0x11,0x32,0x32,0x12,0x80,0x99,0x08,0x53,0x54,
+0x53,0x34,0x25,0x22,0x80,0xa9,0xca,0xbb,0xbc,0xab,0x19,0x44,0x44,0x33,0x32,0x23,
+0x02,0xa8,0xbb,0x19,0x73,0x34,0x33,0x24,0x80,0xec,0xcd,0xbc,0xcb,0xaa,0x9a,0x09,
+0x20,0x32,0x23,0x11,0x80,0x88,0x00,0x21,0x65,0x44,0x34,0x33,0x13,0x00,0xca,0xcc,
+0xcb,0xab,0x09,0x21,0x44,0x43,0x43,0x22,0x01,0x88,0x99,0x08,0x32,0x45,0x43,0x23,
+0x90,0xdd,0xdd,0xcb,0xba,0xab,0x9a,0x00,0x22,0x33,0x22,0x11,0x88,0x89,0x10,0x63,
+0x45,0x44,0x33,0x33,0x11,0xa9,0xbd,0xbd,0xbb,0x9a,0x28,0x53,0x34,0x25,0x23,0x21,
+0x00,0x98,0x89,0x20,0x54,0x34,0x33,0x01,0xda,0xce,0xbd,0xbc,0xbb,0x9b,0x89,0x11,
+0x32,0x32,0x12,0x00,0x98,0x18,0x52,0x45,0x44,0x24,0x33,0x13,0x90,0xca,0xbd,0xac,
+0xab,0x09,0x31,0x45,0x43,0x32,0x22,0x01,0x88,0x99,0x09,0x52,0x35,0x34,0x12,0x90,
+0xed,0xcc,0xcc,0xba,0xaa,0x89,0x00,0x12,0x23,0x12,0x81,0x98,0x88,0x10,0x63,0x44,
+0x44,0x24,0x23,0x81,0xa9,0xcc,0xcb,0xba,0x99,0x28,0x63,0x43,0x32,0x33,0x22,0x00,
+0x99,0x99,0x31,0x47,0x33,0x14,0x81,0xda,0xdd,0xcc,0xbb,0xbb,0x9a,0x09,0x20,0x32,
+0x24,0x11,0x88,0x89,0x18,0x43,0x45,0x44,0x43,0x23,0x12,0x98,0xda,0xcb,0xbb,0x9c,
+0x09,0x42,0x53,0x33,0x33,0x22,0x02,0x99,0x99,0x28,0x64,0x43,0x33,0x12,0xb0,0xee,
+0xcc,0xcc,0xba,0x9a,0x89,0x00,0x12,0x23,0x11,0x80,0x98,0x08,0x20,0x54,0x44,0x44,
+0x23,0x23,0x80,0xba,0xdc,0xbb,0xac,0x8a,0x11,0x34,0x35,0x33,0x24,0x12,0x80,0xa9,
+0x89,0x32,0x46,0x43,0x22,0x91,0xfb,0xdc,0xbc,0xac,0xab,0x99,0x80,0x21,0x23,0x23,
+0x01,0x08,0x88,0x21,0x44,0x45,0x44,0x33,0x33,0x02,0xb8,0xcc,0xcc,0xab,0xaa,0x08,
+0x42,0x34,0x34,0x24,0x12,0x00,0x89,0x89,0x10,0x44,0x53,0x23,0x12,0xb8,0xdf,0xcc,
+0xbc,0xbb,0xaa,0x99,0x11,0x22,0x33,0x12,0x80,0x89,0x08,0x31,0x65,0x44,0x43,0x24,
+0x12,0x80,0xb9,0xcc,0xac,0xab,0x09,0x30,0x63,0x33,0x34,0x23,0x12,0x88,0xa9,0x88,
+0x41,0x54,0x34,0x22,0x91,0xec,0xdc,0xcb,0xcb,0xaa,0x89,0x08,0x11,0x22,0x13,0x11,
+0x80,0x89,0x18,0x62,0x44,0x44,0x33,0x23,0x02,0xa8,0xcc,0xcc,0xba,0x8a,0x08,0x42,
+0x44,0x33,0x33,0x22,0x80,0xa8,0x99,0x21,0x46,0x34,0x23,0x02,0xda,0xdd,0xcc,0xbc,
+0xab,0x9b,0x88,0x11,0x22,0x23,0x11,0x80,0x89,0x09,0x42,0x55,0x53,0x43,0x33,0x23,
+0x80,0xdb,0xbc,0xbc,0xaa,0x09,0x31,0x35,0x25,0x33,0x23,0x11,0x88,0x99,0x09,0x52,
+0x54,0x33,0x22,0xa8,0xed,0xbd,0xbd,0xac,0xab,0x89,0x00,0x11,0x32,0x22,0x01,0x88,
+0x8a,0x10,0x64,0x44,0x43,0x24,0x13,0x81,0xb9,0xbd,0xbc,0x9b,0x89,0x30,0x45,0x43,
+0x33,0x22,0x01,0x98,0x98,0x10,0x73,0x43,0x33,0x02,0xda,0xce,0xcc,0xcb,0xab,0x9a,
+0x08,0x21,0x22,0x12,0x02,0x80,0x88,0x18,0x73,0x44,0x53,0x23,0x13,0x81,0xb9,0xcd,
+0xbb,0xab,0x89,0x32,0x45,0x34,0x33,0x22,0x81,0x98,0x89,0x10,0x54,0x34,0x24,0x02,
+0xda,0xdd,0xbc,0xad,0xab,0x99,0x08,0x11,0x22,0x12,0x00,0x90,0x88,0x28,0x73,0x44,
+0x43,0x43,0x12,0x80,0xc9,0xcb,0xbc,0x9a,0x89,0x31,0x44,0x34,0x23,0x23,0x00,0x98,
+0x99,0x20,0x55,0x43,0x33,0x82,0xea,0xcd,0xcc,0xbb,0xac,0x8a,0x08,0x21,0x22,0x13,
+0x01,0x88,0x08,0x20,0x44,0x45,0x53,0x32,0x22,0x80,0xba,0xcd,0xcb,0xaa,0x09,0x21,
+0x44,0x34,0x33,0x13,0x01,0x98,0x99,0x21,0x64,0x43,0x23,0x82,0xea,0xcd,0xbd,0xbc,
+0xab,0x9a,0x08,0x12,0x23,0x22,0x01,0x88,0x89,0x20,0x64,0x44,0x43,0x24,0x12,0x81,
+0xb9,0xbd,0xbc,0xab,0x09,0x31,0x45,0x24,0x33,0x12,0x01,0x99,0x98,0x20,0x44,0x35,
+0x24,0x01,0xda,0xdd,0xbc,0xbc,0xba,0x99,0x18,0x21,0x22,0x22,0x00,0x80,0x09,0x10,
+0x45,0x45,0x34,0x33,0x23,0x80,0xcb,0xbd,0xac,0x9b,0x88,0x32,0x35,0x35,0x23,0x13,
+0x81,0x88,0x89,0x30,0x64,0x34,0x32,0x81,0xfb,0xdc,0xbc,0xcb,0xab,0x99,0x00,0x11,
+0x32,0x21,0x81,0x88,0x88,0x20,0x46,0x44,0x43,0x33,0x13,0x80,0xca,0xbd,0xcb,0xaa,
+0x88,0x22,0x45,0x43,0x23,0x22,0x00,0x98,0x88,0x30,0x44,0x35,0x23,0x81,0xfb,0xcd,
+0xbc,0xbc,0xbb,0x9a,0x08,0x22,0x32,0x12,0x01,0x98,0x89,0x21,0x55,0x35,0x35,0x33,
+0x23,0x80,0xca,0xbd,0xbc,0xaa,0x09,0x31,0x45,0x43,0x33,0x22,0x81,0x98,0x89,0x20,
+0x45,0x53,0x22,0x01,0xeb,0xcd,0xcc,0xbb,0xbb,0x99,0x00,0x31,0x32,0x22,0x11,0x88,
+0x88,0x10,0x45,0x36,0x35,0x43,0x12,0x80,0xba,0xbd,0xbc,0xaa,0x08,0x41,0x53,0x24,
+0x33,0x21,0x80,0x98,0x89,0x21,0x54,0x34,0x14,0x81,0xeb,0xcd,0xbc,0xcb,0xab,0x99,
+0x00,0x21,0x32,0x21,0x00,0x98,0x89,0x20,0x64,0x44,0x34,0x33,0x22,0x90,0xcb,0xcd,
+0xab,0xab,0x08,0x41,0x34,0x25,0x33,0x12,0x80,0x99,0x88,0x31,0x45,0x34,0x23,0x91,
+0xfb,0xcd,0xbc,0xbc,0xab,0x9a,0x00,0x31,0x23,0x23,0x01,0x88,0x88,0x31,0x46,0x35,
+0x44,0x32,0x11,0x80,0xbb,0xbe,0xac,0x9b,0x09,0x31,0x36,0x34,0x33,0x12,0x81,0x99,
+0x09,0x41,0x54,0x24,0x12,0xa0,0xed,0xeb,0xbb,0xac,0x9a,0x09,0x10,0x22,0x12,0x01,
+0x88,0x88,0x28,0x54,0x44,0x34,0x24,0x12,0x90,0xba,0xcd,0xab,0x9a,0x18,0x42,0x35,
+0x43,0x22,0x11,0x80,0x89,0x19,0x42,0x45,0x33,0x02,0xd9,0xce,0xbc,0xad,0xab,0x8a,
+0x08,0x21,0x22,0x12,0x00,0x88,0x08,0x30,0x55,0x44,0x43,0x23,0x02,0xa8,0xeb,0xcb,
+0xaa,0x89,0x21,0x53,0x34,0x43,0x21,0x00,0x88,0x89,0x21,0x63,0x43,0x23,0x80,0xec,
+0xdc,0xcb,0xcb,0x9a,0x89,0x00,0x22,0x21,0x01,0x80,0x88,0x10,0x42,0x55,0x43,0x24,
+0x22,0x00,0xba,0xcc,0xac,0x9b,0x09,0x32,0x35,0x25,0x23,0x12,0x80,0x88,0x09,0x31,
+0x46,0x43,0x12,0xb8,0xde,0xcc,0xcb,0xab,0x9a,0x88,0x11,0x32,0x21,0x00,0x88,0x88,
+0x20,0x54,0x45,0x43,0x33,0x12,0x98,0xdb,0xbc,0xbb,0x9a,0x10,0x63,0x34,0x43,0x22,
+0x01,0x90,0x89,0x18,0x53,0x44,0x23,0x02,0xea,0xcd,0xcc,0xcb,0xaa,0x89,0x00,0x21,
+0x21,0x02,0x00,0x98,0x08,0x32,0x37,0x45,0x33,0x22,0x82,0xb8,0xbd,0xad,0xab,0x09,
+0x21,0x44,0x34,0x33,0x13,0x01,0x98,0x89,0x30,0x46,0x34,0x13,0x90,0xed,0xcc,0xbc,
+0xbb,0x9b,0x89,0x11,0x23,0x22,0x01,0x80,0x89,0x18,0x54,0x35,0x45,0x32,0x12,0x91,
+0xba,0xcd,0xbb,0xab,0x18,0x52,0x34,0x34,0x22,0x02,0x80,0x99,0x18,0x42,0x45,0x24,
+0x11,0xb9,0xcf,0xbd,0xbc,0xab,0xaa,0x08,0x12,0x32,0x22,0x11,0x80,0x08,0x31,0x55,
+0x35,0x35,0x33,0x02,0xa0,0xdb,0xbc,0xab,0x8a,0x20,0x44,0x34,0x24,0x22,0x81,0x88,
+0x99,0x20,0x44,0x35,0x23,0x91,0xfb,0xcd,0xbc,0xbc,0xaa,0x89,0x18,0x21,0x22,0x02,
+0x00,0x89,0x08,0x43,0x46,0x44,0x33,0x23,0x81,0xc9,0xdb,0xac,0xaa,0x88,0x31,0x35,
+0x34,0x33,0x12,0x80,0x99,0x08,0x41,0x45,0x24,0x12,0xb0,0xed,0xcc,0xcb,0xab,0x9b,
+0x09,0x20,0x22,0x22,0x11,0x88,0x88,0x20,0x54,0x54,0x43,0x33,0x12,0x80,0xcb,0xcc,
+0xbb,0x9a,0x18,0x43,0x35,0x34,0x23,0x02,0x90,0x98,0x18,0x63,0x53,0x32,0x01,0xd9,
+0xdd,0xbc,0xad,0xab,0x99,0x00,0x21,0x21,0x12,0x80,0x98,0x80,0x32,0x46,0x35,0x34,
+0x23,0x02,0xa9,0xdc,0xbb,0xbb,0x8a,0x21,0x45,0x34,0x33,0x13,0x01,0x98,0x89,0x31,
+0x55,0x43,0x13,0x91,0xec,0xcd,0xcb,0xac,0x9a,0x89,0x10,0x21,0x12,0x01,0x00,0x88,
+0x18,0x41,0x55,0x34,0x43,0x12,0x81,0xba,0xcc,0xbc,0xaa,0x89,0x31,0x53,0x34,0x33,
+0x24,0x11,0x88,0x99,0x88,0x32,0x45,0x34,0x33,0x11,0xea,0xdd,0xcc,0xbb,0xac,0x9a,
+0x89,0x10,0x31,0x32,0x22,0x00,0x98,0x09,0x30,0x63,0x44,0x44,0x34,0x23,0x02,0x98,
+0xbc,0xcc,0xba,0xab,0x89,0x42,0x44,0x33,0x34,0x32,0x22,0x90,0x9a,0x09,0x62,0x34,
+0x43,0x32,0x01,0xd9,0xde,0xcc,0xbb,0xbb,0xab,0x89,0x10,0x32,0x33,0x23,0x81,0x98,
+0x89,0x21,0x46,0x45,0x53,0x33,0x33,0x02,0xb8,0xcc,0xbc,0xcb,0xab,0x09,0x41,0x34,
+0x34,0x33,0x33,0x13,0x90,0xba,0x8a,0x63,0x54,0x32,0x23,0x01,0xd9,0xde,0xcc,0xbb,
+0xac,0x9a,0x89,0x10,0x31,0x33,0x12,0x81,0x88,0x88,0x10,0x44,0x45,0x35,0x34,0x33,
+0x11,0x98,0xdb,0xcb,0xac,0xab,0x89,0x31,0x35,0x44,0x22,0x23,0x11,0x80,0xa9,0x8a,
+0x41,0x45,0x43,0x12,0x01,0xc8,0xdd,0xcd,0xbb,0xac,0xaa,0x98,0x10,0x21,0x33,0x12,
+0x00,0x98,0x88,0x10,0x43,0x56,0x34,0x25,0x23,0x01,0x98,0xba,0xcd,0xbb,0xbb,0x89,
+0x32,0x36,0x25,0x33,0x23,0x12,0x80,0xa9,0x9a,0x40,0x55,0x33,0x23,0x81,0xea,0xcd,
+0xbd,0xbc,0xac,0x9a,0x99,0x00,0x22,0x33,0x12,0x81,0x89,0x08,0x21,0x43,0x55,0x54,
+0x33,0x33,0x01,0xa8,0xcb,0xcc,0xbb,0xac,0x09,0x31,0x54,0x33,0x24,0x23,0x11,0x90,
+0x99,0x09,0x31,0x46,0x43,0x32,0x81,0xda,0xdd,0xcc,0xcb,0xba,0x9a,0x89,0x18,0x31,
+0x32,0x23,0x81,0x89,0x89,0x31,0x44,0x54,0x44,0x53,0x22,0x01,0x98,0xbb,0xcc,0xcb,
+0xaa,0x09,0x31,0x35,0x34,0x24,0x23,0x12,0x90,0xa9,0x89,0x41,0x44,0x34,0x33,0x11,
+0xda,0xde,0xbc,0xcc,0xba,0xa9,0x89,0x00,0x22,0x23,0x22,0x81,0x98,0x08,0x20,0x34,
+0x46,0x44,0x53,0x22,0x02,0x98,0xca,0xcb,0xcb,0xaa,0x0a,0x21,0x35,0x44,0x32,0x32,
+0x22,0x88,0xaa,0x09,0x42,0x45,0x33,0x23,0x12,0xda,0xcf,0xcc,0xbc,0xba,0x9a,0x89,
+0x00,0x22,0x32,0x23,0x01,0x99,0x88,0x21,0x55,0x53,0x34,0x34,0x24,0x11,0x98,0xcb,
+0xdb,0xbb,0xab,0x0a,0x42,0x44,0x33,0x43,0x32,0x22,0x80,0xaa,0x8a,0x42,0x36,0x24,
+0x23,0x01,0xc9,0xee,0xbc,0xbd,0xba,0xaa,0x89,0x00,0x22,0x33,0x12,0x81,0x98,0x98,
+0x10,0x63,0x54,0x44,0x43,0x22,0x02,0xa0,0xca,0xcc,0xbb,0xab,0x09,0x31,0x45,0x34,
+0x32,0x33,0x12,0x80,0x99,0x8a,0x51,0x54,0x33,0x33,0x02,0xc8,0xde,0xdc,0xbb,0xac,
+0xaa,0x89,0x08,0x22,0x32,0x13,0x81,0x99,0x88,0x10,0x43,0x45,0x45,0x43,0x33,0x13,
+0x90,0xca,0xcb,0xbc,0xcb,0xaa,0x08,0x43,0x35,0x43,0x32,0x22,0x12,0x80,0xaa,0x9a,
+0x42,0x45,0x43,0x22,0x12,0xa8,0xde,0xcd,0xbc,0xcb,0xaa,0x89,0x88,0x11,0x22,0x33,
+0x12,0x88,0x99,0x08,0x31,0x35,0x55,0x34,0x35,0x23,0x12,0x98,0xbb,0xcd,0xcb,0xba,
+0x99,0x20,0x53,0x34,0x43,0x23,0x23,0x02,0x98,0xaa,0x89,0x52,0x45,0x33,0x33,0x01,
+0xea,0xdd,0xcc,0xbb,0xac,0x9b,0x8a,0x08,0x21,0x43,0x22,0x01,0x88,0x99,0x18,0x31,
+0x45,0x54,0x43,0x43,0x22,0x01,0xa8,0xcb,0xbc,0xbc,0xac,0x88,0x31,0x44,0x33,0x33,
+0x34,0x32,0x01,0xa9,0xaa,0x08,0x54,0x44,0x33,0x23,0x91,0xfb,0xdd,0xbc,0xbc,0xba,
+0x9a,0x89,0x00,0x22,0x43,0x22,0x01,0x89,0x89,0x18,0x42,0x44,0x45,0x53,0x33,0x12,
+0x80,0xaa,0xbc,0xbd,0xcb,0xaa,0x09,0x42,0x34,0x25,0x23,0x23,0x13,0x80,0xa9,0xaa,
+0x30,0x55,0x34,0x23,0x22,0x90,0xed,0xcd,0xbc,0xbc,0xab,0x9a,0x08,0x10,0x32,0x33,
+0x22,0x81,0x99,0x88,0x21,0x44,0x45,0x44,0x34,0x34,0x11,0x90,0xba,0xbc,0xad,0xbb,
+0x9a,0x28,0x53,0x34,0x34,0x33,0x33,0x12,0x98,0xba,0x8a,0x61,0x44,0x34,0x22,0x01,
+0xc9,0xdd,0xcc,0xcc,0xba,0xaa,0x99,0x08,0x21,0x32,0x33,0x02,0x90,0xa9,0x08,0x31,
+0x46,0x63,0x43,0x34,0x32,0x11,0x99,0xcb,0xbc,0xbd,0xbb,0x8a,0x30,0x54,0x33,0x34,
+0x32,0x23,0x82,0xa8,0xab,0x19,0x73,0x34,0x43,0x32,0x11,0xda,0xce,0xbd,0xad,0xab,
+0xaa,0x89,0x00,0x22,0x33,0x33,0x02,0x90,0x89,0x18,0x42,0x44,0x45,0x44,0x33,0x23,
+0x81,0xa9,0xbc,0xcd,0xbb,0xab,0x0a,0x41,0x44,0x43,0x23,0x23,0x13,0x81,0xa9,0xaa,
+0x20,0x55,0x34,0x33,0x22,0x91,0xec,0xdd,0xbc,0xbc,0xab,0xaa,0x88,0x10,0x31,0x33,
+0x23,0x81,0x98,0x89,0x30,0x44,0x54,0x34,0x36,0x33,0x23,0x90,0xba,0xbd,0xad,0xac,
+0x9a,0x08,0x32,0x35,0x34,0x24,0x23,0x11,0x90,0xa9,0x8a,0x40,0x44,0x34,0x33,0x12,
+0xb8,0xee,0xcc,0xbc,0xbc,0xaa,0x99,0x09,0x20,0x32,0x24,0x02,0x90,0x98,0x08,0x21,
+0x53,0x35,0x45,0x43,0x23,0x02,0x90,0xca,0xdb,0xcb,0xab,0x9a,0x20,0x63,0x33,0x43,
+0x33,0x33,0x12,0xa8,0xca,0x09,0x43,0x45,0x32,0x23,0x02,0xd8,0xce,0xcd,0xcb,0xab,
+0x9b,0x8a,0x08,0x21,0x33,0x33,0x02,0x90,0x98,0x08,0x32,0x55,0x44,0x35,0x34,0x33,
+0x01,0xa9,0xcb,0xcc,0xbb,0xac,0x8a,0x20,0x53,0x34,0x33,0x34,0x22,0x12,0x90,0xba,
+0x8a,0x41,0x36,0x34,0x33,0x22,0x91,0xec,0xce,0xcc,0xbb,0xbb,0x9b,0x8a,0x00,0x32,
+0x43,0x33,0x11,0x98,0x98,0x08,0x31,0x54,0x54,0x53,0x43,0x33,0x12,0x80,0xba,0xcc,
+0xbc,0xbc,0x9a,0x19,0x41,0x34,0x34,0x33,0x24,0x22,0x00,0x98,0xa9,0x08,0x53,0x35,
+0x34,0x32,0x11,0xb9,0xef,0xcc,0xcb,0xcb,0x9a,0x9a,0x88,0x11,0x31,0x33,0x22,0x81,
+0x98,0x89,0x18,0x43,0x45,0x44,0x53,0x43,0x23,0x01,0xa8,0xcb,0xbc,0xbc,0xbb,0xab,
+0x10,0x54,0x34,0x33,0x33,0x23,0x13,0x80,0xbb,0xac,0x30,0x46,0x34,0x32,0x22,0x80,
+0xfb,0xdd,0xbc,0xcc,0xaa,0x9a,0x89,0x00,0x21,0x32,0x23,0x12,0x81,0x88,0x08,0x31,
+0x54,0x44,0x44,0x34,0x33,0x13,0x80,0xca,0xdb,0xcb,0xbb,0xbb,0x89,0x41,0x44,0x24,
+0x33,0x33,0x23,0x11,0xa9,0xbb,0x0a,0x72,0x44,0x33,0x33,0x11,0xb8,0xdf,0xdc,0xdb,
+0xba,0xba,0xa9,0x88,0x00,0x32,0x24,0x22,0x81,0x88,0x89,0x00,0x32,0x54,0x54,0x53,
+0x43,0x22,0x11,0x98,0xbb,0xcc,0xcb,0xbb,0xaa,0x18,0x53,0x44,0x33,0x32,0x33,0x32,
+0x81,0xba,0xbc,0x28,0x55,0x24,0x23,0x22,0x01,0xd8,0xed,0xcc,0xcb,0xab,0x9b,0x8a,
+0x88,0x21,0x33,0x24,0x11,0x80,0x98,0x88,0x20,0x53,0x44,0x35,0x44,0x33,0x13,0x01,
+0xaa,0xcc,0xcb,0xac,0xab,0x8a,0x21,0x35,0x44,0x32,0x23,0x23,0x12,0x98,0xba,0x8b,
+0x61,0x44,0x24,0x22,0x11,0x90,0xfb,0xdd,0xbc,0xbc,0xba,0xa9,0x88,0x18,0x31,0x43,
+0x22,0x01,0x98,0x89,0x00,0x31,0x54,0x54,0x43,0x34,0x32,0x02,0x90,0xba,0xcd,0xcb,
+0xbb,0xba,0x08,0x52,0x44,0x33,0x32,0x32,0x23,0x02,0xb9,0xcb,0x19,0x54,0x44,0x22,
+0x22,0x11,0xb8,0xef,0xcc,0xcb,0xab,0xab,0x99,0x09,0x20,0x42,0x23,0x22,0x80,0x99,
+0x88,0x20,0x52,0x63,0x34,0x45,0x23,0x23,0x00,0x99,0xbc,0xcc,0xbb,0xac,0x89,0x20,
+0x53,0x43,0x33,0x34,0x32,0x12,0x91,0xa9,0xaa,0x30,0x55,0x34,0x33,0x23,0x91,0xfb,
+0xde,0xdb,0xbb,0xbb,0xaa,0x99,0x00,0x21,0x34,0x33,0x01,0x90,0x89,0x00,0x21,0x53,
+0x45,0x35,0x35,0x33,0x12,0x80,0xba,0xcd,0xcb,0xcb,0x9a,0x09,0x31,0x44,0x43,0x23,
+0x33,0x32,0x01,0xa8,0xbb,0x8a,0x73,0x44,0x23,0x23,0x02,0xb8,0xdf,0xcd,0xbc,0xbb,
+0xba,0xa9,0x88,0x20,0x42,0x33,0x33,0x81,0x88,0x09,0x20,0x43,0x44,0x45,0x44,0x33,
+0x23,0x02,0xa8,0xcb,0xcc,0xcb,0xbb,0xab,0x88,0x42,0x44,0x24,0x33,0x33,0x23,0x12,
+0x90,0xcb,0xab,0x30,0x47,0x43,0x22,0x11,0x01,0xb9,0xef,0xcc,0xcb,0xab,0xab,0xa9,
+0x88,0x11,0x32,0x34,0x22,0x02,0x98,0x99,0x08,0x21,0x45,0x54,0x53,0x43,0x23,0x13,
+0x81,0xb8,0xdb,0xcc,0xba,0xac,0x99,0x18,0x42,0x44,0x33,0x33,0x33,0x23,0x11,0xa9,
+0xbc,0x8a,0x52,0x45,0x33,0x23,0x12,0x90,0xfc,0xdc,0xbc,0xbc,0xbb,0xab,0x99,0x08,
+0x22,0x43,0x33,0x23,0x80,0x99,0x89,0x20,0x43,0x35,0x36,0x45,0x43,0x23,0x02,0x90,
+0xba,0xcc,0xcb,0xcb,0xaa,0x89,0x31,0x44,0x34,0x33,0x43,0x22,0x12,0x90,0xb9,0xba,
+0x18,0x64,0x44,0x32,0x12,0x01,0xb9,0xee,0xcc,0xbc,0xcb,0xaa,0x9a,0x09,0x18,0x22,
+0x33,0x24,0x11,0x88,0x89,0x09,0x10,0x53,0x63,0x34,0x36,0x33,0x33,0x01,0xa9,0xcc,
+0xcb,0xbc,0xbb,0xab,0x18,0x34,0x36,0x33,0x34,0x32,0x23,0x02,0xa8,0xca,0x8a,0x31,
+0x37,0x25,0x23,0x12,0x90,0xeb,0xdd,0xcc,0xcb,0xba,0xaa,0x99,0x08,0x20,0x42,0x23,
+0x13,0x00,0x98,0x89,0x08,0x32,0x64,0x34,0x45,0x43,0x32,0x12,0x80,0xba,0xcc,0xcb,
+0xca,0xaa,0x99,0x20,0x44,0x34,0x43,0x22,0x32,0x22,0x00,0xaa,0xbb,0x19,0x64,0x34,
+0x33,0x33,0x13,0xc8,0xde,0xcd,0xbc,0xcb,0xba,0x9a,0x89,0x00,0x22,0x43,0x22,0x02,
+0x80,0x99,0x89,0x00,0x33,0x47,0x34,0x36,0x33,0x24,0x01,0x98,0xcb,0xbc,0xbc,0xbb,
+0xab,0x0a,0x41,0x35,0x35,0x33,0x32,0x33,0x12,0x90,0xba,0xaa,0x51,0x55,0x33,0x33,
+0x22,0x02,0xc9,0xdf,0xbd,0xbd,0xbb,0xaa,0x9a,0x88,0x10,0x32,0x34,0x22,0x01,0xa8,
+0x99,0x00,0x22,0x35,0x46,0x44,0x53,0x32,0x12,0x81,0xa8,0xbc,0xbd,0xac,0xbb,0x99,
+0x18,0x53,0x34,0x34,0x33,0x24,0x12,0x01,0x99,0xbb,0x89,0x53,0x45,0x33,0x23,0x11,
+0x90,0xec,0xdd,0xbc,0xbc,0xac,0x9a,0x99,0x80,0x21,0x32,0x33,0x13,0x00,0x99,0x89,
+0x10,0x33,0x46,0x54,0x34,0x25,0x23,0x12,0x90,0xaa,0xcc,0xbc,0xbc,0xaa,0x09,0x31,
+0x44,0x34,0x33,0x24,0x23,0x21,0x88,0xa9,0xab,0x28,0x55,0x34,0x24,0x22,0x01,0xb9,
+0xde,0xcd,0xbc,0xcb,0xba,0xa9,0x88,0x18,0x22,0x43,0x22,0x11,0x98,0x98,0x08,0x21,
+0x43,0x45,0x44,0x44,0x33,0x23,0x01,0xa8,0xbc,0xcc,0xbb,0xbc,0xaa,0x08,0x43,0x44,
+0x24,0x23,0x33,0x32,0x11,0x98,0xcb,0x8a,0x30,0x46,0x34,0x23,0x12,0x81,0xd9,0xce,
+0xcd,0xbc,0xbb,0xaa,0xaa,0x88,0x10,0x31,0x34,0x33,0x11,0x90,0x99,0x89,0x20,0x43,
+0x54,0x54,0x53,0x33,0x24,0x13,0x81,0xb8,0xdb,0xbc,0xbc,0xbb,0xaa,0x09,0x42,0x45,
+0x33,0x34,0x23,0x23,0x22,0x80,0xba,0xbb,0x09,0x64,0x44,0x23,0x33,0x12,0x80,0xec,
+0xcd,0xcc,0xbc,0xba,0xab,0x99,0x09,0x10,0x32,0x34,0x33,0x02,0x80,0x99,0x08,0x11,
+0x43,0x54,0x54,0x53,0x43,0x23,0x12,0x88,0xb9,0xcc,0xcb,0xcb,0xba,0x9a,0x18,0x52,
+0x34,0x24,0x33,0x33,0x33,0x13,0x90,0xdb,0xaa,0x18,0x54,0x34,0x33,0x32,0x11,0x90,
+0xde,0xdd,0xbc,0xbc,0xbb,0xab,0x99,0x09,0x20,0x33,0x35,0x22,0x01,0x99,0xa9,0x88,
+0x21,0x53,0x44,0x44,0x35,0x34,0x33,0x02,0x90,0xba,0xbd,0xbc,0xbc,0xba,0x99,0x20,
+0x44,0x44,0x33,0x24,0x22,0x22,0x11,0x99,0xbb,0x9c,0x30,0x55,0x43,0x22,0x12,0x01,
+0xa8,0xed,0xcd,0xbc,0xbc,0xbb,0x9b,0x8a,0x88,0x31,0x43,0x43,0x12,0x81,0x98,0x99,
+0x08,0x30,0x53,0x44,0x44,0x34,0x34,0x33,0x11,0x98,0xdb,0xcb,0xac,0xbb,0xbb,0x9b,
+0x30,0x64,0x43,0x33,0x24,0x32,0x22,0x01,0xa8,0xcb,0x9a,0x31,0x45,0x34,0x33,0x22,
+0x02,0xc8,0xee,0xcc,0xdb,0xbb,0xba,0x9a,0x99,0x00,0x22,0x43,0x24,0x12,0x80,0x98,
+0x89,0x08,0x31,0x53,0x35,0x45,0x34,0x43,0x22,0x01,0x98,0xbb,0xbd,0xbc,0xbc,0xab,
+0x8a,0x30,0x45,0x34,0x43,0x32,0x22,0x12,0x01,0xa9,0xca,0x89,0x31,0x46,0x24,0x23,
+0x13,0x82,0xd9,0xde,0xbc,0xbd,0xac,0xaa,0x9a,0x88,0x18,0x21,0x33,0x34,0x21,0x80,
+0x99,0x88,0x00,0x32,0x44,0x45,0x45,0x43,0x23,0x22,0x00,0xb9,0xdb,0xcb,0xcb,0xbb,
+0xab,0x09,0x41,0x44,0x34,0x33,0x43,0x22,0x22,0x80,0xba,0xbb,0x0a,0x73,0x34,0x34,
+0x23,0x13,0x81,0xeb,0xce,0xcd,0xbb,0xbc,0xaa,0x9a,0x88,0x10,0x31,0x34,0x23,0x12,
+0x80,0xa9,0x89,0x20,0x42,0x35,0x55,0x53,0x43,0x23,0x22,0x80,0xa9,0xbc,0xbc,0xbd,
+0xbb,0xaa,0x09,0x52,0x44,0x33,0x34,0x22,0x23,0x11,0x80,0xba,0xab,0x1a,0x54,0x45,
+0x33,0x32,0x11,0x90,0xec,0xcd,0xbd,0xbc,0xbb,0xab,0xa9,0x88,0x10,0x33,0x44,0x22,
+0x02,0x90,0x98,0x09,0x00,0x42,0x63,0x44,0x44,0x33,0x24,0x11,0x80,0xb9,0xdb,0xdb,
+0xbb,0xac,0x9a,0x08,0x52,0x43,0x43,0x23,0x23,0x23,0x02,0x90,0xbb,0xac,0x18,0x45,
+0x35,0x43,0x22,0x11,0x98,0xec,0xcd,0xdb,0xbb,0xac,0x9a,0x89,0x88,0x10,0x32,0x34,
+0x23,0x11,0x98,0x99,0x89,0x00,0x31,0x54,0x45,0x53,0x24,0x24,0x23,0x11,0x90,0xba,
+0xcd,0xcb,0xba,0xac,0x9a,0x08,0x32,0x45,0x24,0x33,0x23,0x33,0x32,0x01,0xb9,0xbc,
+0x9b,0x40,0x55,0x33,0x24,0x22,0x01,0xa0,0xdd,0xbe,0xcd,0xbb,0xcb,0xaa,0x9a,0x88,
+0x10,0x22,0x34,0x33,0x22,0x80,0xa8,0x99,0x18,0x31,0x44,0x54,0x44,0x34,0x34,0x33,
+0x22,0x80,0xaa,0xbd,0xbd,0xcb,0xab,0xab,0x89,0x31,0x46,0x33,0x34,0x33,0x33,0x23,
+0x02,0xa8,0xcb,0xab,0x28,0x55,0x34,0x34,0x22,0x12,0x90,0xfa,0xdc,0xcc,0xbc,0xbb,
+0xac,0x99,0x89,0x08,0x21,0x43,0x23,0x23,0x01,0x98,0x99,0x88,0x11,0x33,0x55,0x45,
+0x34,0x35,0x23,0x22,0x81,0xa8,0xdb,0xdb,0xcb,0xbb,0xba,0x89,0x20,0x44,0x44,0x33,
+0x33,0x33,0x33,0x22,0x98,0xca,0xac,0x89,0x53,0x44,0x24,0x23,0x22,0x00,0xd9,0xdd,
+0xbd,0xbd,0xac,0xab,0xa9,0x89,0x88,0x11,0x43,0x33,0x33,0x01,0x90,0x9a,0x09,0x10,
+0x42,0x44,0x45,0x63,0x33,0x34,0x22,0x11,0x98,0xcb,0xbc,0xcc,0xbb,0xbb,0xaa,0x20,
+0x44,0x35,0x43,0x32,0x32,0x32,0x22,0x80,0xb9,0xad,0x8a,0x41,0x35,0x25,0x23,0x13,
+0x01,0xa8,0xde,0xcd,0xcc,0xbb,0xac,0x9a,0x99,0x88,0x10,0x32,0x53,0x32,0x11,0x88,
+0x99,0x99,0x10,0x31,0x53,0x54,0x53,0x34,0x34,0x23,0x12,0x98,0xba,0xbd,0xcc,0xcb,
+0xba,0xaa,0x08,0x32,0x36,0x34,0x24,0x23,0x23,0x22,0x00,0xa9,0xbc,0xab,0x20,0x56,
+0x43,0x32,0x12,0x01,0x98,0xdc,0xdd,0xcc,0xbc,0xab,0xab,0x8a,0x09,0x00,0x32,0x53,
+0x33,0x22,0x01,0x89,0x88,0x18,0x21,0x34,0x46,0x44,0x34,0x24,0x23,0x22,0x00,0xaa,
+0xbd,0xbd,0xcb,0xbb,0xbb,0x8a,0x31,0x36,0x35,0x24,0x32,0x22,0x22,0x12,0x98,0xcb,
+0xaa,0x19,0x54,0x34,0x34,0x32,0x12,0x90,0xfb,0xcd,0xcc,0xbc,0xbb,0xac,0xa9,0x89,
+0x00,0x21,0x33,0x34,0x13,0x11,0x98,0x99,0x08,0x10,0x43,0x54,0x44,0x35,0x34,0x33,
+0x23,0x01,0xa9,0xeb,0xcb,0xbc,0xbb,0xbb,0x8a,0x20,0x54,0x34,0x34,0x32,0x33,0x33,
+0x12,0x90,0xca,0xbb,0x09,0x63,0x35,0x34,0x32,0x13,0x82,0xd9,0xce,0xbd,0xbd,0xbc,
+0xba,0xaa,0x99,0x08,0x20,0x32,0x25,0x33,0x11,0x90,0x99,0x89,0x10,0x22,0x45,0x54,
+0x34,0x35,0x43,0x12,0x02,0x88,0xba,0xbd,0xbd,0xcb,0xba,0x99,0x18,0x43,0x44,0x43,
+0x32,0x33,0x32,0x22,0x80,0xb9,0xbc,0x8a,0x42,0x46,0x33,0x24,0x21,0x00,0xca,0xde,
+0xdc,0xbb,0xbc,0xba,0x99,0x89,0x10,0x31,0x43,0x33,0x02,0x90,0x99,0x89,0x10,0x41,
+0x63,0x44,0x44,0x34,0x33,0x22,0x81,0xb9,0xdb,0xbc,0xdb,0xbb,0xba,0x09,0x42,0x44,
+0x24,0x33,0x33,0x33,0x13,0x80,0xba,0xac,0x09,0x63,0x44,0x33,0x33,0x13,0x91,0xec,
+0xcd,0xcd,0xbb,0xac,0x9b,0x9a,0x88,0x10,0x32,0x43,0x23,0x12,0x80,0x98,0x88,0x20,
+0x42,0x54,0x63,0x53,0x43,0x32,0x12,0x90,0xb9,0xdb,0xac,0xac,0xbb,0xaa,0x19,0x42,
+0x35,0x25,0x33,0x23,0x23,0x12,0x90,0xca,0xab,0x09,0x73,0x34,0x43,0x22,0x02,0x90,
+0xec,0xdc,0xcc,0xcb,0xaa,0x9b,0x8a,0x09,0x10,0x33,0x43,0x23,0x01,0x99,0xa9,0x09,
+0x10,0x53,0x44,0x35,0x45,0x33,0x33,0x22,0x80,0xba,0xbd,0xbd,0xcb,0xab,0x9a,0x10,
+0x34,0x36,0x43,0x32,0x33,0x22,0x02,0xa9,0xcb,0x9b,0x18,0x64,0x43,0x33,0x23,0x12,
+0xb8,0xee,0xcc,0xbd,0xcb,0xab,0xaa,0x99,0x08,0x10,0x33,0x34,0x33,0x01,0x90,0x99,
+0x09,0x20,0x44,0x45,0x44,0x53,0x33,0x32,0x11,0x98,0xbb,0xbd,0xbd,0xbc,0xab,0x9a,
+0x20,0x63,0x34,0x43,0x23,0x23,0x13,0x11,0x99,0xbb,0xab,0x38,0x56,0x34,0x24,0x22,
+0x01,0xa9,0xde,0xcd,0xdb,0xbb,0xba,0x9a,0x99,0x80,0x21,0x43,0x24,0x22,0x00,0x89,
+0x89,0x08,0x22,0x53,0x54,0x53,0x34,0x24,0x23,0x01,0x98,0xca,0xdb,0xbb,0xad,0xaa,
+0x8a,0x21,0x44,0x53,0x32,0x32,0x23,0x23,0x01,0xa9,0xbc,0x99,0x41,0x45,0x43,0x23,
+0x22,0x02,0xca,0xcf,0xcd,0xcb,0xbb,0xab,0xaa,0x89,0x08,0x22,0x34,0x34,0x12,0x80,
+0x98,0x88,0x00,0x21,0x63,0x54,0x34,0x35,0x32,0x23,0x01,0xa8,0xbc,0xcd,0xbb,0xcb,
+0xaa,0x89,0x31,0x54,0x24,0x33,0x33,0x23,0x13,0x01,0xb9,0xac,0x9a,0x52,0x45,0x43,
+0x22,0x12,0x00,0xdb,0xce,0xcd,0xcb,0xba,0xaa,0x9a,0x89,0x10,0x22,0x34,0x33,0x12,
+0x08,0x99,0x88,0x00,0x42,0x44,0x45,0x44,0x43,0x23,0x22,0x00,0xa9,0xbc,0xcc,0xac,
+0xbb,0x9a,0x09,0x42,0x44,0x24,0x33,0x33,0x23,0x13,0x80,0xba,0xbc,0x09,0x63,0x44,
+0x33,0x23,0x22,0x90,0xec,0xce,0xbc,0xbd,0xba,0x9b,0x9a,0x88,0x10,0x32,0x25,0x23,
+0x01,0x88,0x99,0x88,0x10,0x32,0x55,0x44,0x44,0x33,0x24,0x12,0x80,0xb9,0xbc,0xbd,
+0xbc,0xbb,0x9b,0x18,0x52,0x44,0x33,0x24,0x22,0x23,0x11,0x98,0xba,0xac,0x18,0x54,
+0x34,0x34,0x22,0x12,0xa8,0xde,0xcd,0xdb,0xab,0xab,0x9a,0x99,0x00,0x31,0x53,0x23,
+0x02,0x98,0x99,0x89,0x10,0x32,0x37,0x45,0x34,0x43,0x32,0x11,0x90,0xcb,0xcc,0xbb,
+0xac,0xab,0x88,0x31,0x45,0x34,0x33,0x23,0x33,0x12,0x90,0xca,0xaa,0x38,0x55,0x34,
+0x33,0x22,0x10,0xd9,0xed,0xdc,0xbb,0xac,0xaa,0x99,0x89,0x10,0x22,0x24,0x23,0x01,
+0x90,0x99,0x08,0x21,0x44,0x45,0x44,0x33,0x34,0x22,0x01,0x99,0xbc,0xbd,0xbc,0xbb,
+0x9b,0x18,0x63,0x53,0x32,0x24,0x22,0x22,0x01,0x99,0xbb,0x8a,0x52,0x45,0x33,0x23,
+0x12,0x90,0xec,0xdd,0xdb,0xcb,0xba,0x9a,0x8a,0x08,0x21,0x32,0x24,0x22,0x80,0x89,
+0x89,0x11,0x31,0x45,0x44,0x35,0x35,0x32,0x11,0x90,0xc9,0xbb,0xbd,0xac,0xab,0x8a,
+0x31,0x44,0x34,0x24,0x23,0x33,0x12,0x80,0xba,0xab,0x28,0x46,0x44,0x23,0x22,0x01,
+0xb8,0xdf,0xdc,0xcb,0xbb,0xbb,0xaa,0x89,0x00,0x32,0x34,0x33,0x12,0x90,0x99,0x89,
+0x21,0x53,0x54,0x44,0x35,0x43,0x22,0x01,0x99,0xca,0xdb,0xbb,0xac,0x9b,0x08,0x42,
+0x44,0x33,0x24,0x23,0x22,0x02,0xa8,0xba,0x9a,0x41,0x46,0x43,0x32,0x12,0x80,0xeb,
+0xdd,0xbc,0xbd,0xab,0xab,0x8a,0x09,0x11,0x33,0x34,0x23,0x01,0x98,0x89,0x08,0x32,
+0x45,0x35,0x45,0x34,0x33,0x22,0x80,0xba,0xcc,0xcb,0xbc,0xba,0x9b,0x20,0x54,0x34,
+0x33,0x23,0x33,0x33,0x81,0xba,0xad,0x1a,0x53,0x35,0x24,0x22,0x02,0xa0,0xde,0xcd,
+0xbc,0xcb,0xba,0x9a,0x99,0x00,0x31,0x43,0x23,0x12,0x98,0x99,0x89,0x10,0x43,0x54,
+0x44,0x44,0x33,0x32,0x02,0x98,0xcb,0xbd,0xbc,0xbb,0xab,0x09,0x42,0x45,0x43,0x23,
+0x33,0x22,0x12,0x00,0xa9,0x9a,0x30,0x47,0x34,0x23,0x22,0x01,0xca,0xdf,0xdc,0xbb,
+0xac,0xaa,0x99,0x89,0x10,0x22,0x24,0x13,0x01,0x88,0x89,0x08,0x21,0x53,0x45,0x44,
+0x34,0x33,0x23,0x01,0xa9,0xbd,0xcc,0xcb,0xab,0x9a,0x00,0x43,0x44,0x43,0x23,0x23,
+0x22,0x01,0xa9,0xba,0x9a,0x52,0x45,0x24,0x23,0x11,0x90,0xeb,0xce,0xcc,0xcb,0xab,
+0xaa,0x89,0x88,0x11,0x33,0x43,0x22,0x80,0x88,0x89,0x10,0x31,0x45,0x54,0x34,0x25,
+0x33,0x12,0x88,0xc9,0xcb,0xcb,0xac,0xba,0x89,0x21,0x44,0x34,0x43,0x22,0x23,0x12,
+0x81,0xaa,0xbb,0x09,0x54,0x45,0x32,0x22,0x01,0xb8,0xde,0xcd,0xbc,0xcb,0xaa,0x9a,
+0x89,0x18,0x31,0x33,0x24,0x11,0x88,0x99,0x08,0x20,0x42,0x54,0x44,0x44,0x33,0x23,
+0x82,0xa8,0xbc,0xbd,0xbc,0xbb,0x9a,0x38,0x54,0x43,0x33,0x33,0x33,0x13,0x90,0xba,
+0x9b,0x41,0x46,0x43,0x23,0x13,0x81,0xfb,0xce,0xcc,0xbb,0xbb,0x9b,0x8a,0x18,0x31,
+0x43,0x33,0x11,0x88,0x8a,0x19,0x31,0x45,0x63,0x34,0x35,0x24,0x12,0x80,0xb9,0xdb,
+0xbc,0xbb,0xbb,0x09,0x42,0x44,0x34,0x42,0x22,0x22,0x01,0x99,0xaa,0x0a,0x42,0x36,
+0x34,0x23,0x02,0xb0,0xee,0xcc,0xbc,0xac,0xab,0x99,0x89,0x11,0x22,0x34,0x12,0x01,
+0x89,0x89,0x18,0x32,0x55,0x53,0x34,0x34,0x24,0x01,0x98,0xbb,0xbd,0xbc,0xbb,0x9a,
+0x18,0x63,0x34,0x43,0x32,0x23,0x13,0x80,0xba,0x9c,0x18,0x54,0x53,0x32,0x12,0x81,
+0xeb,0xcd,0xbd,0xbc,0xcb,0x9a,0x99,0x08,0x11,0x32,0x33,0x12,0x80,0xa9,0x88,0x21,
+0x44,0x44,0x45,0x53,0x23,0x13,0x81,0xa8,0xbc,0xcc,0xbb,0xbb,0x89,0x31,0x37,0x34,
+0x33,0x33,0x32,0x12,0x90,0xcb,0x9b,0x40,0x45,0x43,0x22,0x02,0x90,0xec,0xdd,0xdb,
+0xba,0xab,0x9a,0x89,0x10,0x22,0x24,0x22,0x81,0x98,0x98,0x18,0x31,0x54,0x35,0x45,
+0x33,0x24,0x11,0x98,0xba,0xbd,0xbc,0xcb,0x9a,0x19,0x52,0x43,0x43,0x22,0x22,0x22,
+0x01,0xa9,0xab,0x19,0x64,0x53,0x23,0x22,0x01,0xc9,0xcf,0xcc,0xbc,0xbb,0xab,0x8a,
+0x09,0x21,0x33,0x34,0x12,0x80,0x89,0x09,0x20,0x34,0x46,0x44,0x43,0x24,0x12,0x81,
+0xa8,0xca,0xbc,0xbc,0xbb,0x99,0x20,0x44,0x44,0x23,0x33,0x33,0x12,0x80,0xca,0x9a,
+0x48,0x54,0x43,0x12,0x12,0x80,0xeb,0xce,0xcc,0xbb,0xbb,0x9a,0x99,0x00,0x22,0x34,
+0x33,0x01,0x98,0x98,0x00,0x22,0x63,0x44,0x45,0x43,0x23,0x03,0x80,0xca,0xcb,0xcb,
+0xcb,0xaa,0x88,0x32,0x45,0x33,0x24,0x33,0x22,0x01,0xa8,0xbb,0x0a,0x73,0x53,0x33,
+0x32,0x11,0xc8,0xed,0xbd,0xbd,0xcb,0x9a,0x99,0x09,0x10,0x22,0x24,0x12,0x80,0x99,
+0x08,0x20,0x22,0x44,0x54,0x44,0x24,0x22,0x01,0x99,0xca,0xcb,0xbc,0xab,0x9a,0x20,
+0x44,0x53,0x33,0x23,0x33,0x22,0x80,0xb9,0xab,0x28,0x47,0x34,0x23,0x13,0x81,0xfa,
+0xdd,0xcc,0xbb,0xbb,0xaa,0x99,0x18,0x31,0x34,0x24,0x01,0x98,0x98,0x08,0x11,0x43,
+0x45,0x44,0x34,0x33,0x22,0x90,0xb9,0xbd,0xbd,0xbb,0xac,0x09,0x30,0x35,0x25,0x33,
+0x23,0x23,0x12,0xa8,0xbb,0x8a,0x61,0x35,0x34,0x23,0x01,0xa8,0xde,0xcd,0xbd,0xbb,
+0xbb,0x9b,0x89,0x10,0x32,0x44,0x22,0x00,0x99,0x99,0x08,0x32,0x54,0x54,0x43,0x24,
+0x23,0x01,0x99,0xca,0xbc,0xbc,0xbb,0x89,0x42,0x44,0x24,0x33,0x23,0x23,0x01,0xa9,
+0xab,0x18,0x44,0x35,0x43,0x22,0x01,0xdc,0xce,0xcc,0xbb,0xbb,0xaa,0x89,0x10,0x22,
+0x34,0x22,0x81,0x98,0x99,0x20,0x43,0x45,0x54,0x43,0x33,0x13,0x81,0xba,0xcc,0xdb,
+0xbb,0xaa,0x09,0x42,0x35,0x24,0x33,0x33,0x22,0x80,0xaa,0x9b,0x41,0x55,0x33,0x33,
+0x12,0xa0,0xde,0xdd,0xdb,0xab,0xab,0x9a,0x88,0x11,0x32,0x33,0x13,0x00,0x99,0x08,
+0x21,0x44,0x45,0x54,0x33,0x34,0x12,0x88,0xca,0xcb,0xbc,0xba,0x9a,0x18,0x44,0x53,
+0x32,0x33,0x14,0x02,0x90,0xa9,0x89,0x41,0x54,0x43,0x22,0x01,0xb9,0xcf,0xdc,0xbb,
+0xbc,0xba,0x99,0x08,0x21,0x33,0x24,0x11,0x88,0x99,0x00,0x21,0x45,0x63,0x53,0x33,
+0x23,0x02,0x98,0xdb,0xbc,0xbc,0xac,0x89,0x20,0x44,0x43,0x32,0x32,0x23,0x11,0xa8,
+0xab,0x1a,0x54,0x44,0x23,0x23,0x01,0xea,0xce,0xbd,0xbc,0xab,0xaa,0x89,0x08,0x22,
+0x33,0x33,0x01,0x88,0x99,0x10,0x53,0x44,0x45,0x34,0x25,0x22,0x80,0xa8,0xcb,0xdb,
+0xbb,0xab,0x0a,0x32,0x46,0x33,0x33,0x43,0x12,0x81,0x99,0x9a,0x20,0x45,0x44,0x22,
+0x12,0x80,0xfb,0xcd,0xcc,0xcb,0xaa,0x99,0x88,0x10,0x31,0x32,0x22,0x80,0x99,0x88,
+0x11,0x44,0x63,0x34,0x35,0x33,0x23,0x80,0xca,0xbc,0xcc,0xba,0xaa,0x18,0x42,0x44,
+0x33,0x43,0x23,0x13,0x90,0xba,0x9a,0x40,0x45,0x43,0x22,0x12,0xa9,0xde,0xcd,0xcb,
+0xcb,0xaa,0x99,0x08,0x20,0x31,0x23,0x12,0x80,0x99,0x88,0x20,0x63,0x54,0x34,0x44,
+0x22,0x02,0x88,0xca,0xcb,0xbc,0xbb,0x9a,0x20,0x44,0x44,0x32,0x33,0x32,0x02,0x90,
+0xba,0x09,0x63,0x44,0x33,0x33,0x12,0xd8,0xde,0xcc,0xcb,0xab,0xaa,0x99,0x08,0x21,
+0x33,0x23,0x02,0x90,0x99,0x88,0x32,0x55,0x45,0x34,0x34,0x23,0x01,0x99,0xdb,0xcb,
+0xbc,0xab,0x8a,0x41,0x53,0x33,0x34,0x32,0x22,0x01,0xa8,0xab,0x28,0x55,0x34,0x33,
+0x22,0x80,0xeb,0xde,0xcc,0xcb,0xaa,0x9a,0x88,0x18,0x21,0x32,0x23,0x81,0x98,0x89,
+0x20,0x53,0x53,0x45,0x53,0x33,0x22,0x00,0xaa,0xcc,0xcb,0xbb,0xbb,0x09,0x43,0x35,
+0x34,0x24,0x32,0x21,0x80,0xaa,0xa9,0x30,0x55,0x24,0x33,0x12,0xa8,0xed,0xdc,0xcb,
+0xbb,0xac,0x99,0x09,0x10,0x32,0x32,0x22,0x80,0x99,0x89,0x11,0x44,0x45,0x34,0x35,
+0x33,0x12,0x80,0xba,0xcd,0xbc,0xbb,0x9b,0x20,0x53,0x44,0x42,0x22,0x22,0x01,0x98,
+0x9a,0x08,0x53,0x35,0x43,0x12,0x90,0xec,0xdc,0xbc,0xcb,0xaa,0x89,0x88,0x11,0x22,
+0x23,0x02,0x90,0x89,0x10,0x42,0x44,0x44,0x44,0x43,0x12,0x80,0xb9,0xcb,0xcc,0xba,
+0x8a,0x18,0x43,0x34,0x34,0x24,0x22,0x01,0x98,0x8a,0x28,0x63,0x34,0x33,0x23,0xa0,
+0xfd,0xcc,0xcc,0xba,0xab,0x9a,0x08,0x11,0x32,0x23,0x12,0x80,0x98,0x18,0x53,0x44,
+0x44,0x34,0x34,0x22,0x81,0xa9,0xcc,0xdb,0xba,0x9a,0x10,0x53,0x24,0x24,0x32,0x22,
+0x82,0xa8,0xaa,0x10,0x45,0x34,0x43,0x12,0x90,0xec,0xdc,0xdb,0xba,0xab,0x9a,0x08,
+0x11,0x32,0x23,0x02,0x80,0x99,0x08,0x41,0x45,0x44,0x44,0x33,0x22,0x80,0xc9,0xcb,
+0xbc,0xbb,0x9b,0x18,0x44,0x34,0x43,0x32,0x32,0x01,0xa8,0xaa,0x18,0x45,0x34,0x33,
+0x33,0x81,0xed,0xdd,0xdb,0xab,0xab,0x9a,0x08,0x11,0x33,0x23,0x02,0x80,0x88,0x10,
+0x32,0x47,0x44,0x53,0x33,0x12,0x81,0xba,0xcc,0xdb,0xba,0x9a,0x18,0x52,0x53,0x32,
+0x23,0x23,0x11,0x98,0xaa,0x09,0x54,0x34,0x24,0x12,0x90,0xec,0xcd,0xbc,0xbc,0xba,
+0xa9,0x88,0x21,0x32,0x33,0x02,0x80,0x89,0x18,0x41,0x63,0x45,0x53,0x33,0x22,0x00,
+0xb9,0xdb,0xbc,0xbc,0x9a,0x19,0x52,0x43,0x24,0x33,0x22,0x01,0x98,0x9a,0x09,0x62,
+0x44,0x33,0x22,0xa0,0xec,0xcd,0xcc,0xab,0xab,0x99,0x88,0x11,0x32,0x24,0x01,0x80,
+0x89,0x00,0x22,0x44,0x45,0x44,0x33,0x22,0x80,0xb9,0xdb,0xbc,0xac,0xaa,0x10,0x42,
+0x35,0x33,0x34,0x22,0x01,0xa8,0xa9,0x09,0x53,0x45,0x33,0x22,0x90,0xec,0xcd,0xbc,
+0xbc,0xaa,0x9a,0x88,0x11,0x32,0x33,0x12,0x80,0x99,0x18,0x33,0x55,0x44,0x44,0x33,
+0x33,0x00,0xb9,0xbd,0xbd,0xbb,0x9b,0x18,0x53,0x44,0x33,0x33,0x33,0x01,0xa8,0x9a,
+0x18,0x54,0x34,0x34,0x23,0x90,0xec,0xdd,0xdb,0xab,0xab,0x9a,0x88,0x20,0x22,0x33,
+0x13,0x90,0x99,0x18,0x52,0x44,0x44,0x34,0x34,0x23,0x00,0xb9,0xcc,0xcb,0xac,0x9a,
+0x08,0x43,0x53,0x32,0x24,0x22,0x02,0x98,0x9a,0x10,0x53,0x44,0x23,0x23,0x81,0xfb,
+0xce,0xcc,0xba,0xab,0x9a,0x88,0x11,0x23,0x33,0x12,0x90,0x99,0x08,0x42,0x45,0x44,
+0x34,0x34,0x23,0x00,0xaa,0xcc,0xdb,0xab,0x9b,0x10,0x53,0x43,0x23,0x43,0x22,0x02,
+0xa8,0xaa,0x19,0x54,0x53,0x22,0x22,0x81,0xfb,0xdd,0xdb,0xab,0xab,0xaa,0x08,0x20,
+0x22,0x33,0x11,0x88,0x99,0x08,0x32,0x47,0x35,0x25,0x33,0x12,0x90,0xba,0xbe,0xbc,
+0xab,0x09,0x31,0x44,0x44,0x23,0x23,0x02,0x80,0x88,0x18,0x43,0x45,0x24,0x13,0x90,
+0xec,0xcc,0xcc,0xba,0xab,0x9a,0x00,0x22,0x22,0x22,0x00,0x89,0x88,0x10,0x44,0x36,
+0x35,0x34,0x23,0x02,0xa8,0xcc,0xcc,0xba,0x99,0x10,0x42,0x44,0x32,0x33,0x12,0x01,
+0x99,0x99,0x20,0x45,0x35,0x23,0x82,0xea,0xdd,0xdb,0xbb,0xac,0x9a,0x88,0x11,0x22,
+0x22,0x12,0x80,0x99,0x08,0x41,0x55,0x34,0x34,0x24,0x11,0x98,0xba,0xcc,0xcb,0xaa,
+0x89,0x31,0x44,0x34,0x24,0x22,0x11,0x98,0x89,0x19,0x52,0x35,0x33,0x13,0xa8,0xde,
+0xcd,0xdb,0xba,0xab,0x89,0x18,0x21,0x32,0x22,0x81,0x88,0x89,0x21,0x45,0x35,0x35,
+0x34,0x23,0x01,0xb9,0xcc,0xdb,0xaa,0x9a,0x10,0x43,0x44,0x33,0x33,0x22,0x80,0xa9,
+0x99,0x40,0x45,0x34,0x23,0x81,0xfa,0xdc,0xbc,0xbc,0xab,0x9a,0x08,0x10,0x32,0x23,
+0x12,0x88,0x99,0x18,0x52,0x45,0x44,0x24,0x33,0x02,0x98,0xda,0xcb,0xcb,0xaa,0x09,
+0x41,0x53,0x33,0x43,0x22,0x11,0x98,0x9a,0x10,0x44,0x35,0x32,0x12,0xb8,0xdf,0xdc,
+0xbb,0xac,0x9b,0x8a,0x00,0x21,0x33,0x12,0x00,0x98,0x00,0x31,0x64,0x34,0x45,0x33,
+0x22,0x81,0xa9,0xbd,0xbd,0xab,0x8a,0x20,0x35,0x44,0x32,0x32,0x11,0x80,0x9a,0x09,
+0x51,0x63,0x33,0x33,0x81,0xfb,0xdd,0xbc,0xcb,0xaa,0x9a,0x80,0x21,0x22,0x22,0x01,
+0x88,0x09,0x18,0x42,0x55,0x34,0x35,0x32,0x01,0x98,0xdb,0xdb,0xba,0xaa,0x18,0x42,
+0x34,0x34,0x24,0x22,0x00,0x98,0x89,0x20,0x44,0x34,0x24,0x02,0xc9,0xde,0xdb,0xac,
+0xbb,0xaa,0x89,0x10,0x31,0x32,0x11,0x80,0x88,0x08,0x32,0x47,0x35,0x44,0x32,0x11,
+0x81,0xb9,0xcc,0xcb,0x9b,0x89,0x31,0x54,0x33,0x34,0x22,0x02,0x98,0x9a,0x09,0x42,
+0x35,0x35,0x22,0x91,0xfb,0xcd,0xcc,0xbb,0xba,0x99,0x18,0x21,0x22,0x22,0x10,0x88,
+0x88,0x18,0x53,0x46,0x53,0x33,0x33,0x02,0xa8,0xcc,0xad,0xbb,0xaa,0x00,0x53,0x53,
+0x43,0x32,0x21,0x80,0x98,0x89,0x20,0x54,0x34,0x33,0x01,0xda,0xce,0xbd,0xbc,0xbb,
+0xaa,0x09,0x10,0x32,0x23,0x13,0x00,0x98,0x08,0x51,0x54,0x44,0x43,0x33,0x22,0x90,
+0xca,0xbd,0xbb,0xac,0x89,0x30,0x54,0x43,0x33,0x22,0x01,0x88,0xa9,0x08,0x53,0x44,
+0x24,0x12,0xa0,0xfb,0xcd,0xdb,0xba,0xab,0x89,0x08,0x21,0x32,0x12,0x01,0x99,0x88,
+0x30,0x44,0x44,0x53,0x34,0x24,0x12,0x90,0xb9,0xcb,0xbc,0xbc,0xbb,0x09,0x41,0x44,
+0x24,0x23,0x33,0x22,0x02,0xa8,0xab,0x8a,0x63,0x44,0x43,0x22,0x02,0xa8,0xde,0xcd,
+0xcb,0xcb,0xaa,0x9a,0x88,0x10,0x22,0x33,0x13,0x01,0x99,0x99,0x08,0x42,0x54,0x44,
+0x44,0x24,0x23,0x01,0x98,0xca,0xcb,0xbc,0xbb,0x9a,0x28,0x63,0x43,0x33,0x34,0x32,
+0x12,0x81,0xb9,0xaa,0x29,0x55,0x34,0x33,0x23,0x80,0xfb,0xcd,0xbd,0xad,0xab,0x9b,
+0x8a,0x09,0x21,0x33,0x34,0x12,0x08,0x89,0x80,0x21,0x43,0x55,0x44,0x43,0x33,0x13,
+0x01,0xb9,0xcc,0xdb,0xbb,0xba,0x89,0x30,0x54,0x34,0x33,0x33,0x33,0x02,0x98,0xbc,
+0x9a,0x51,0x54,0x23,0x23,0x12,0xa0,0xfc,0xcd,0xbc,0xbc,0xba,0x9a,0x89,0x00,0x22,
+0x43,0x22,0x01,0x88,0x99,0x08,0x31,0x44,0x45,0x35,0x34,0x33,0x11,0x98,0xcb,0xcc,
+0xcb,0xbb,0xaa,0x08,0x53,0x44,0x32,0x33,0x33,0x23,0x82,0xa8,0xbb,0x29,0x65,0x34,
+0x24,0x12,0x01,0xb9,0xde,0xcd,0xcb,0xbb,0xaa,0x9a,0x88,0x11,0x33,0x24,0x12,0x80,
+0x99,0x89,0x10,0x33,0x47,0x44,0x34,0x33,0x23,0x01,0xb8,0xcc,0xcc,0xbb,0xab,0x9a,
+0x10,0x35,0x45,0x32,0x32,0x32,0x21,0x90,0xba,0x9a,0x51,0x45,0x33,0x23,0x12,0x81,
+0xfc,0xcd,0xcc,0xcb,0xaa,0x9a,0x89,0x08,0x21,0x33,0x14,0x02,0x88,0x89,0x00,0x21,
+0x53,0x44,0x54,0x43,0x32,0x12,0x88,0xba,0xbc,0xbd,0xbb,0xab,0x09,0x42,0x54,0x33,
+0x43,0x33,0x23,0x11,0x99,0xbb,0x89,0x54,0x44,0x33,0x23,0x11,0xb8,0xef,0xcc,0xbc,
+0xbb,0xab,0x9a,0x89,0x11,0x42,0x33,0x23,0x80,0x98,0x88,0x10,0x33,0x55,0x45,0x44,
+0x32,0x23,0x01,0xa8,0xcb,0xcc,0xcb,0xaa,0x9a,0x10,0x53,0x53,0x33,0x23,0x33,0x22,
+0x01,0xba,0xbb,0x38,0x56,0x34,0x33,0x12,0x81,0xfb,0xdd,0xcc,0xbb,0xbb,0xab,0x99,
+0x18,0x31,0x43,0x33,0x11,0x98,0x8a,0x09,0x31,0x44,0x45,0x54,0x33,0x34,0x02,0x91,
+0xa9,0xdb,0xdb,0xbb,0xab,0x0a,0x41,0x44,0x43,0x32,0x33,0x22,0x11,0x98,0xaa,0x89,
+0x61,0x44,0x24,0x13,0x02,0xa8,0xed,0xdc,0xcb,0xac,0xab,0x99,0x09,0x18,0x32,0x33,
+0x33,0x81,0x98,0x99,0x00,0x32,0x46,0x45,0x44,0x33,0x32,0x11,0x99,0xca,0xbc,0xcc,
+0xba,0x9a,0x18,0x43,0x35,0x43,0x32,0x23,0x22,0x80,0xb9,0xab,0x28,0x55,0x44,0x32,
+0x22,0x00,0xda,0xce,0xbd,0xcc,0xba,0x9a,0x8a,0x88,0x11,0x32,0x33,0x13,0x91,0xa9,
+0x9a,0x18,0x53,0x35,0x45,0x34,0x25,0x23,0x02,0x90,0xbb,0xcd,0xcb,0xbb,0xba,0x09,
+0x41,0x44,0x34,0x33,0x23,0x23,0x12,0x81,0xaa,0xab,0x31,0x57,0x24,0x23,0x12,0x01,
+0xb8,0xef,0xcc,0xcb,0xbb,0xab,0x99,0x89,0x10,0x32,0x43,0x22,0x01,0x90,0x98,0x08,
+0x11,0x44,0x55,0x53,0x43,0x33,0x22,0x81,0xa8,0xdb,0xbc,0xbc,0xac,0x9a,0x18,0x33,
+0x36,0x43,0x33,0x33,0x22,0x02,0xa9,0xbb,0x9b,0x51,0x46,0x33,0x24,0x11,0x80,0xdb,
+0xde,0xbc,0xbd,0xba,0xaa,0x89,0x88,0x11,0x33,0x34,0x22,0x81,0x98,0x89,0x10,0x42,
+0x53,0x54,0x53,0x43,0x33,0x22,0x90,0xc9,0xbb,0xbd,0xbc,0xab,0x8a,0x21,0x45,0x43,
+0x33,0x33,0x23,0x23,0x00,0xba,0xbb,0x29,0x65,0x34,0x43,0x22,0x02,0xa8,0xde,0xcd,
+0xbc,0xcb,0xba,0x9a,0x89,0x00,0x22,0x24,0x23,0x02,0x90,0x98,0x88,0x20,0x42,0x54,
+0x44,0x44,0x33,0x33,0x01,0xa8,0xcb,0xbd,0xdb,0xba,0xaa,0x08,0x42,0x44,0x33,0x43,
+0x32,0x22,0x02,0x90,0xbb,0x9b,0x40,0x55,0x43,0x23,0x12,0x80,0xea,0xdd,0xbc,0xbd,
+0xbb,0xab,0x9a,0x08,0x10,0x33,0x34,0x23,0x01,0x98,0x89,0x08,0x31,0x45,0x45,0x34,
+0x35,0x33,0x22,0x00,0xba,0xcc,0xbc,0xbc,0xab,0x9b,0x28,0x45,0x53,0x32,0x23,0x32,
+0x32,0x01,0xa9,0xcb,0x09,0x62,0x34,0x24,0x23,0x11,0x90,0xdd,0xce,0xbc,0xac,0xab,
+0xaa,0x89,0x08,0x22,0x43,0x23,0x12,0x80,0x99,0x89,0x10,0x43,0x45,0x35,0x44,0x43,
+0x22,0x12,0x98,0xca,0xdb,0xbb,0xbc,0xaa,0x89,0x31,0x45,0x43,0x33,0x33,0x23,0x22,
+0x90,0xba,0xac,0x20,0x55,0x43,0x23,0x23,0x11,0xc9,0xee,0xdc,0xbb,0xac,0xab,0x99,
+0x89,0x10,0x22,0x43,0x22,0x81,0x98,0x89,0x08,0x11,0x53,0x45,0x45,0x43,0x33,0x22,
+0x81,0x98,0xcb,0xcc,0xbb,0xbb,0x9a,0x10,0x63,0x34,0x34,0x33,0x33,0x23,0x01,0xb9,
+0xcb,0x8a,0x51,0x35,0x25,0x23,0x11,0x88,0xeb,0xdd,0xcc,0xcb,0xab,0xab,0x99,0x88,
+0x21,0x42,0x32,0x22,0x00,0x89,0x88,0x08,0x22,0x44,0x55,0x44,0x43,0x32,0x12,0x90,
+0xa9,0xcc,0xcb,0xac,0xab,0x89,0x20,0x34,0x35,0x24,0x33,0x22,0x13,0x80,0xa9,0xbb,
+0x19,0x55,0x44,0x32,0x22,0x11,0xa9,0xed,0xcd,0xbc,0xac,0xab,0xaa,0x89,0x08,0x32,
+0x43,0x33,0x11,0x98,0x89,0x09,0x21,0x53,0x44,0x44,0x44,0x33,0x23,0x02,0x98,0xca,
+0xcc,0xbb,0xbc,0xab,0x09,0x41,0x44,0x24,0x33,0x33,0x32,0x12,0x90,0xbb,0xac,0x28,
+0x55,0x53,0x32,0x12,0x02,0x90,0xec,0xcd,0xcc,0xcb,0xba,0xaa,0x99,0x08,0x20,0x32,
+0x34,0x22,0x01,0x88,0x9a,0x88,0x21,0x53,0x44,0x35,0x35,0x34,0x24,0x11,0x88,0xba,
+0xdb,0xbc,0xcb,0xba,0x99,0x10,0x53,0x34,0x34,0x33,0x33,0x23,0x02,0x98,0xcb,0x9b,
+0x20,0x47,0x43,0x23,0x22,0x01,0xa0,0xde,0xdd,0xcb,0xac,0xab,0xa9,0x99,0x08,0x11,
+0x43,0x32,0x13,0x00,0x98,0x98,0x10,0x21,0x43,0x55,0x44,0x34,0x34,0x23,0x02,0x98,
+0xca,0xcc,0xbb,0xac,0xab,0x09,0x30,0x44,0x44,0x32,0x33,0x33,0x22,0x12,0xa8,0xbb,
+0x9b,0x51,0x46,0x43,0x23,0x21,0x00,0xb9,0xdf,0xdc,0xcb,0xcb,0xaa,0x9a,0x98,0x00,
+0x21,0x42,0x32,0x02,0x80,0x98,0x99,0x08,0x21,0x44,0x54,0x44,0x43,0x33,0x23,0x01,
+0xa8,0xbc,0xcd,0xbb,0xcb,0xab,0x89,0x21,0x45,0x43,0x33,0x33,0x33,0x23,0x81,0xca,
+0xbb,0x0a,0x62,0x44,0x43,0x22,0x22,0x81,0xc9,0xde,0xcc,0xbc,0xac,0xaa,0x9a,0x88,
+0x10,0x22,0x24,0x23,0x12,0x80,0x89,0x99,0x09,0x20,0x54,0x54,0x34,0x35,0x33,0x22,
+0x00,0xb9,0xbc,0xcd,0xbb,0xcb,0xaa,0x09,0x41,0x53,0x24,0x33,0x33,0x43,0x21,0x00,
+0xaa,0xbb,0x09,0x73,0x34,0x24,0x23,0x11,0x91,0xfa,0xcd,0xdc,0xbb,0xcb,0xaa,0x99,
+0x09,0x00,0x32,0x43,0x32,0x11,0x90,0xa8,0x88,0x10,0x42,0x44,0x35,0x45,0x43,0x32,
+0x22,0x80,0xb9,0xdb,0xbc,0xac,0xbb,0xab,0x09,0x53,0x44,0x24,0x23,0x23,0x23,0x12,
+0x88,0xba,0x9c,0x18,0x64,0x43,0x32,0x22,0x12,0x90,0xec,0xdd,0xdb,0xcb,0xba,0xaa,
+0x99,0x88,0x11,0x32,0x34,0x23,0x02,0x98,0x99,0x89,0x10,0x43,0x55,0x44,0x43,0x34,
+0x32,0x11,0x80,0xba,0xbd,0xcc,0xbb,0xab,0x9b,0x28,0x63,0x34,0x34,0x33,0x23,0x33,
+0x12,0x88,0xbb,0xab,0x38,0x56,0x34,0x34,0x23,0x11,0xa8,0xde,0xcd,0xbc,0xcc,0xaa,
+0xa9,0x89,0x08,0x11,0x22,0x33,0x23,0x81,0x98,0x9a,0x08,0x32,0x54,0x44,0x44,0x44,
+0x33,0x23,0x12,0x90,0xcb,0xdb,0xbc,0xcb,0xaa,0x9a,0x20,0x53,0x34,0x34,0x43,0x22,
+0x22,0x01,0xa8,0xaa,0x9a,0x30,0x46,0x34,0x24,0x22,0x01,0xa9,0xde,0xcd,0xbc,0xac,
+0xab,0x9a,0x89,0x08,0x11,0x33,0x34,0x23,0x01,0x98,0x89,0x09,0x21,0x54,0x44,0x44,
+0x34,0x24,0x23,0x01,0x98,0xcb,0xdb,0xbb,0xbc,0xab,0x9a,0x21,0x45,0x34,0x33,0x33,
+0x24,0x22,0x81,0xb8,0xbb,0x9b,0x51,0x35,0x35,0x23,0x13,0x01,0xa8,0xde,0xdd,0xbc,
+0xbc,0xac,0x9a,0x99,0x88,0x18,0x31,0x43,0x32,0x02,0x90,0x99,0x89,0x00,0x21,0x44,
+0x45,0x35,0x35,0x43,0x22,0x12,0x80,0xb9,0xcc,0xbb,0xbc,0xbb,0xaa,0x89,0x53,0x35,
+0x25,0x33,0x22,0x23,0x32,0x01,0xa8,0xbc,0xab,0x30,0x46,0x34,0x24,0x22,0x12,0x90,
+0xdd,0xec,0xdb,0xbb,0xbc,0xaa,0x9a,0x89,0x00,0x22,0x43,0x43,0x21,0x00,0x98,0x88,
+0x88,0x11,0x43,0x54,0x34,0x45,0x33,0x24,0x22,0x00,0xa9,0xbc,0xcc,0xcb,0xba,0xab,
+0x89,0x30,0x45,0x34,0x33,0x24,0x23,0x23,0x11,0x98,0xbb,0xac,0x18,0x54,0x34,0x34,
+0x23,0x22,0x80,0xfa,0xdc,0xcc,0xbc,0xbb,0xac,0x9a,0x89,0x08,0x21,0x32,0x34,0x33,
+0x01,0x90,0x9a,0x08,0x21,0x43,0x45,0x54,0x53,0x33,0x43,0x22,0x00,0x98,0xca,0xbc,
+0xbd,0xbb,0xbb,0x9a,0x20,0x44,0x35,0x34,0x32,0x24,0x22,0x12,0x90,0xb9,0xac,0x8a,
+0x42,0x45,0x43,0x22,0x12,0x01,0xb9,0xee,0xcc,0xcc,0xab,0xbb,0xaa,0x99,0x08,0x10,
+0x33,0x35,0x33,0x11,0x88,0x9a,0x89,0x18,0x32,0x44,0x55,0x53,0x34,0x24,0x23,0x01,
+0x90,0xbb,0xcd,0xbb,0xbc,0xbb,0xab,0x08,0x63,0x34,0x34,0x33,0x43,0x32,0x12,0x81,
+0xa9,0xbc,0x9a,0x30,0x46,0x53,0x22,0x22,0x01,0xa8,0xec,0xcd,0xcc,0xcb,0xba,0xaa,
+0x99,0x09,0x10,0x31,0x34,0x33,0x13,0x80,0x99,0x88,0x10,0x32,0x35,0x45,0x35,0x35,
+0x34,0x33,0x13,0x91,0xb9,0xcd,0xcb,0xbb,0xbc,0x9a,0x09,0x31,0x45,0x43,0x43,0x32,
+0x22,0x12,0x11,0x98,0xcb,0xaa,0x19,0x45,0x35,0x33,0x23,0x01,0x90,0xdc,0xce,0xbd,
+0xbd,0xbb,0xba,0xa9,0x89,0x18,0x21,0x34,0x43,0x22,0x81,0xa8,0xa9,0x88,0x20,0x53,
+0x44,0x44,0x34,0x25,0x33,0x22,0x80,0xb8,0xcc,0xbc,0xac,0xbb,0x9b,0x0a,0x31,0x45,
+0x44,0x23,0x33,0x33,0x33,0x23,0x01,0xca,0xab,0x19,0x54,0x44,0x23,0x32,0x11,0x91,
+0xfa,0xcd,0xbd,0xbd,0xcb,0xaa,0xaa,0x99,0x00,0x20,0x33,0x34,0x23,0x11,0x98,0x98,
+0x99,0x10,0x32,0x37,0x36,0x35,0x35,0x33,0x32,0x01,0xa8,0xdb,0xbc,0xbc,0xac,0xab,
+0x9a,0x10,0x53,0x44,0x33,0x24,0x23,0x22,0x12,0x81,0xaa,0xcb,0x89,0x41,0x45,0x43,
+0x33,0x22,0x81,0xc9,0xed,0xcc,0xbc,0xbc,0xbb,0xaa,0x8a,0x09,0x20,0x32,0x44,0x32,
+0x12,0x80,0x99,0x99,0x10,0x42,0x43,0x45,0x44,0x34,0x24,0x23,0x01,0x90,0xba,0xcc,
+0xbc,0xac,0xbb,0x9a,0x09,0x32,0x45,0x34,0x34,0x32,0x23,0x23,0x11,0x98,0xca,0xbb,
+0x89,0x53,0x45,0x24,0x23,0x22,0x12,0x98,0xec,0xdd,0xbc,0xcc,0xba,0xaa,0x9a,0x99,
+0x00,0x20,0x43,0x43,0x23,0x11,0x90,0x98,0x99,0x08,0x20,0x43,0x46,0x44,0x53,0x33,
+0x33,0x23,0x01,0xa9,0xcc,0xcc,0xbb,0xcb,0xbb,0xab,0x08,0x42,0x45,0x43,0x23,0x33,
+0x23,0x23,0x13,0x98,0xcb,0xbc,0x09,0x42,0x36,0x34,0x33,0x23,0x02,0xb8,0xde,0xcd,
+0xcc,0xcb,0xbb,0xba,0xaa,0x98,0x00,0x11,0x43,0x34,0x33,0x11,0x80,0x99,0x98,0x18,
+0x21,0x63,0x54,0x34,0x35,0x34,0x33,0x23,0x01,0xa9,0xdb,0xbc,0xbc,0xcb,0xbb,0x9a,
+0x08,0x52,0x34,0x44,0x23,0x33,0x24,0x12,0x11,0x88,0xbb,0xac,0x0a,0x42,0x45,0x43,
+0x23,0x22,0x02,0xb8,0xdd,0xdd,0xdb,0xcb,0xbb,0xab,0xaa,0x89,0x18,0x11,0x34,0x43,
+0x23,0x01,0x90,0x99,0x88,0x08,0x20,0x42,0x55,0x44,0x34,0x44,0x32,0x12,0x81,0xa9,
+0xdb,0xcb,0xbc,0xbb,0xcb,0x9a,0x00,0x53,0x34,0x25,0x23,0x23,0x23,0x32,0x22,0x80,
+0xba,0xac,0x1a,0x73,0x44,0x33,0x23,0x21,0x00,0xc8,0xdd,0xcd,0xbc,0xbc,0xac,0xab,
+0xa9,0x89,0x08,0x21,0x33,0x35,0x23,0x11,0x90,0x99,0x9a,0x00,0x31,0x35,0x36,0x45,
+0x53,0x33,0x24,0x12,0x01,0xa9,0xcb,0xcc,0xbb,0xbc,0xbb,0x9a,0x08,0x43,0x45,0x43,
+0x33,0x33,0x32,0x23,0x12,0xa0,0xcb,0xbb,0x0a,0x63,0x54,0x33,0x33,0x23,0x02,0xb9,
+0xdf,0xdc,0xdb,0xcb,0xbb,0xab,0xaa,0x89,0x00,0x21,0x53,0x43,0x22,0x02,0x98,0x89,
+0x89,0x10,0x22,0x43,0x45,0x35,0x44,0x43,0x32,0x22,0x01,0xa9,0xdb,0xdb,0xbb,0xbc,
+0xab,0x9b,0x10,0x53,0x44,0x24,0x33,0x32,0x32,0x32,0x11,0xa8,0xcb,0xbb,0x09,0x73,
+0x34,0x34,0x24,0x22,0x01,0xa8,0xce,0xcd,0xcc,0xac,0xbb,0xba,0x99,0x89,0x08,0x21,
+0x34,0x34,0x23,0x01,0x98,0x99,0x98,0x00,0x21,0x54,0x44,0x44,0x34,0x43,0x33,0x22,
+0x00,0xb9,0xdb,0xbc,0xcc,0xbb,0xbb,0x9b,0x18,0x34,0x36,0x24,0x24,0x22,0x23,0x22,
+0x01,0xa8,0xbb,0xac,0x19,0x54,0x34,0x24,0x23,0x22,0x11,0xc9,0xdd,0xcd,0xbc,0xbc,
+0xac,0xab,0x9a,0x98,0x00,0x21,0x43,0x43,0x22,0x11,0x80,0x99,0x89,0x00,0x42,0x34,
+0x45,0x34,0x44,0x24,0x23,0x13,0x80,0xa8,0xcb,0xcc,0xbb,0xad,0xab,0xaa,0x00,0x43,
+0x45,0x33,0x24,0x32,0x22,0x22,0x11,0x98,0xdb,0xba,0x09,0x52,0x35,0x34,0x23,0x22,
+0x01,0xb8,0xde,0xdc,0xbc,0xbd,0xbb,0xbb,0xab,0x99,0x09,0x10,0x43,0x53,0x33,0x12,
+0x81,0x98,0x9a,0x89,0x08,0x21,0x44,0x45,0x34,0x35,0x34,0x34,0x23,0x02,0xa0,0xcb,
+0xbc,0xcb,0xcb,0xbb,0xac,0x9a,0x10,0x53,0x44,0x43,0x33,0x43,0x22,0x22,0x11,0x80,
+0xa9,0xbc,0xbb,0x18,0x73,0x34,0x43,0x23,0x22,0x01,0xb9,0xdf,0xcc,0xcc,0xcb,0xba,
+0xab,0x9b,0x99,0x08,0x10,0x32,0x35,0x34,0x22,0x81,0x98,0x98,0x09,0x00,0x12,0x34,
+0x46,0x44,0x53,0x43,0x23,0x33,0x11,0x98,0xca,0xdb,0xcb,0xac,0xac,0xaa,0x99,0x10,
+0x33,0x45,0x43,0x43,0x32,0x22,0x22,0x11,0x91,0xb9,0xbc,0x9b,0x30,0x46,0x44,0x32,
+0x32,0x12,0x01,0xb9,0xde,0xdc,0xbc,0xbd,0xbb,0xbb,0xaa,0x99,0x88,0x11,0x34,0x44,
+0x32,0x11,0x81,0x88,0x89,0x88,0x08,0x22,0x63,0x44,0x44,0x53,0x43,0x23,0x23,0x01,
+0x98,0xba,0xbd,0xbd,0xcb,0xac,0xab,0x99,0x10,0x43,0x44,0x34,0x33,0x33,0x23,0x33,
+0x22,0x80,0xca,0xbc,0xab,0x28,0x46,0x53,0x32,0x32,0x32,0x11,0xc9,0xde,0xcc,0xcc,
+0xbb,0xbc,0xba,0x9a,0x99,0x80,0x11,0x32,0x35,0x43,0x12,0x01,0x98,0x89,0x89,0x08,
+0x20,0x43,0x46,0x63,0x43,0x34,0x33,0x33,0x11,0x99,0xcb,0xcc,0xcb,0xbc,0xbb,0xbb,
+0x99,0x20,0x53,0x35,0x44,0x32,0x23,0x22,0x23,0x13,0x91,0xda,0xbb,0x9a,0x41,0x44,
+0x34,0x43,0x22,0x13,0x81,0xb9,0xcf,0xcd,0xcc,0xcb,0xab,0xab,0xaa,0x98,0x08,0x21,
+0x42,0x43,0x33,0x23,0x01,0x98,0xa9,0x89,0x10,0x31,0x54,0x45,0x44,0x43,0x24,0x33,
+0x23,0x02,0x98,0xdb,0xbc,0xbc,0xbc,0xbb,0xbb,0x8a,0x10,0x54,0x53,0x43,0x32,0x23,
+0x23,0x22,0x12,0x98,0xda,0xcb,0x99,0x20,0x44,0x35,0x33,0x33,0x22,0x80,0xeb,0xdd,
+0xeb,0xcb,0xcb,0xbb,0xbb,0xab,0x8a,0x08,0x11,0x34,0x53,0x33,0x23,0x02,0x90,0x99,
+0x98,0x10,0x33,0x46,0x44,0x44,0x43,0x24,0x33,0x23,0x01,0xa8,0xcb,0xbd,0xbc,0xcb,
+0xbb,0xab,0x8a,0x20,0x53,0x35,0x34,0x24,0x23,0x22,0x22,0x12,0x80,0xca,0xbb,0x9b,
+0x31,0x56,0x43,0x33,0x33,0x22,0x81,0xda,0xed,0xbc,0xbe,0xdb,0xba,0xaa,0x9a,0x89,
+0x08,0x10,0x42,0x43,0x33,0x22,0x00,0x98,0x99,0x89,0x00,0x31,0x55,0x44,0x34,0x35,
+0x43,0x33,0x23,0x01,0x99,0xbc,0xcc,0xbc,0xbb,0xbc,0xab,0x9a,0x20,0x45,0x34,0x34,
+0x23,0x33,0x32,0x23,0x13,0x90,0xdb,0xcb,0x8a,0x31,0x55,0x33,0x34,0x32,0x12,0x80,
+0xfb,0xdc,0xcc,0xbc,0xcb,0xbb,0xaa,0x99,0x88,0x10,0x32,0x44,0x23,0x22,0x80,0x88,
+0x89,0x88,0x21,0x42,0x54,0x63,0x43,0x34,0x34,0x22,0x02,0x90,0xba,0xdc,0xcb,0xbb,
+0xac,0xab,0x89,0x21,0x54,0x43,0x43,0x23,0x23,0x32,0x12,0x00,0xba,0xbc,0x9b,0x30,
+0x56,0x43,0x23,0x23,0x12,0x81,0xeb,0xed,0xdb,0xbc,0xcb,0xba,0x9a,0x8a,0x88,0x10,
+0x33,0x34,0x24,0x12,0x80,0x98,0x89,0x88,0x20,0x42,0x44,0x44,0x44,0x34,0x24,0x23,
+0x02,0x98,0xca,0xcb,0xdb,0xba,0xac,0xaa,0x09,0x21,0x44,0x34,0x34,0x33,0x32,0x32,
+0x22,0x81,0xc9,0xcb,0x9a,0x30,0x46,0x34,0x33,0x22,0x22,0x80,0xfb,0xcd,0xdc,0xbb,
+0xbc,0xbb,0xba,0x99,0x08,0x20,0x42,0x43,0x33,0x22,0x00,0x99,0x99,0x09,0x11,0x43,
+0x45,0x54,0x53,0x43,0x32,0x23,0x01,0x98,0xca,0xbc,0xbc,0xad,0xbb,0xab,0x89,0x21,
+0x45,0x34,0x43,0x23,0x33,0x23,0x22,0x88,0xca,0xac,0x9a,0x20,0x45,0x44,0x32,0x22,
+0x11,0x90,0xeb,0xdd,0xcc,0xdb,0xba,0xab,0xaa,0x89,0x08,0x10,0x33,0x35,0x43,0x12,
+0x01,0x88,0x89,0x00,0x10,0x32,0x54,0x44,0x44,0x43,0x33,0x33,0x12,0x98,0xdb,0xbc,
+0xcc,0xbb,0xac,0xaa,0x09,0x30,0x54,0x43,0x33,0x33,0x33,0x33,0x22,0x81,0xdb,0xcb,
+0x9a,0x41,0x44,0x43,0x23,0x23,0x22,0x90,0xec,0xcd,0xcc,0xbc,0xcb,0xba,0xa9,0x99,
+0x80,0x20,0x32,0x34,0x24,0x22,0x80,0x98,0x9a,0x88,0x11,0x42,0x54,0x44,0x44,0x33,
+0x43,0x22,0x11,0x98,0xca,0xbc,0xbc,0xbc,0xbb,0xab,0x09,0x41,0x54,0x33,0x25,0x23,
+0x32,0x22,0x22,0x80,0xb9,0xbc,0x8b,0x40,0x54,0x34,0x33,0x23,0x13,0xa0,0xec,0xec,
+0xdb,0xbc,0xbb,0xac,0x9a,0x89,0x88,0x11,0x32,0x34,0x24,0x12,0x80,0x89,0x99,0x00,
+0x20,0x33,0x36,0x36,0x35,0x35,0x33,0x33,0x02,0x98,0xcb,0xcc,0xbc,0xcb,0xbb,0xaa,
+0x09,0x42,0x44,0x34,0x33,0x33,0x33,0x33,0x13,0x80,0xca,0xbc,0x9b,0x40,0x45,0x34,
+0x24,0x12,0x02,0x80,0xdb,0xde,0xcc,0xcb,0xbb,0xbb,0xaa,0x99,0x08,0x11,0x43,0x34,
+0x23,0x22,0x88,0x98,0x99,0x88,0x20,0x53,0x45,0x44,0x44,0x33,0x34,0x22,0x01,0x98,
+0xcb,0xcc,0xbb,0xbc,0xbb,0xaa,0x09,0x42,0x45,0x43,0x23,0x33,0x33,0x33,0x12,0x80,
+0xbb,0xad,0x0a,0x41,0x45,0x34,0x32,0x33,0x12,0x90,0xdd,0xce,0xbc,0xbd,0xbb,0xbb,
+0xaa,0x8a,0x08,0x20,0x43,0x34,0x33,0x22,0x80,0x99,0x89,0x08,0x31,0x54,0x54,0x53,
+0x34,0x24,0x33,0x12,0x80,0xca,0xcc,0xbb,0xbc,0xcb,0xaa,0x88,0x41,0x53,0x43,0x33,
+0x32,0x23,0x23,0x01,0xb9,0xdb,0x9a,0x28,0x45,0x44,0x32,0x22,0x11,0x90,0xec,0xcd,
+0xbd,0xbc,0xbb,0xba,0x9a,0x89,0x10,0x31,0x35,0x24,0x22,0x01,0x90,0x88,0x00,0x21,
+0x32,0x45,0x44,0x35,0x34,0x24,0x12,0x81,0xa9,0xdb,0xdb,0xbb,0xac,0xab,0x89,0x31,
+0x54,0x33,0x34,0x33,0x24,0x22,0x02,0x98,0xba,0xac,0x18,0x44,0x44,0x33,0x32,0x23,
+0x01,0xeb,0xde,0xbc,0xbd,0xcb,0xba,0x9a,0x99,0x08,0x21,0x43,0x33,0x23,0x01,0x98,
+0x89,0x88,0x11,0x32,0x56,0x44,0x44,0x43,0x32,0x22,0x01,0xa8,0xca,0xcc,0xbb,0xbc,
+0xbb,0x9a,0x20,0x63,0x34,0x34,0x33,0x33,0x24,0x11,0x90,0xb9,0xab,0x0a,0x63,0x35,
+0x34,0x33,0x12,0x01,0xc9,0xde,0xdc,0xbc,0xcb,0xba,0xa9,0x99,0x88,0x10,0x43,0x43,
+0x22,0x01,0x90,0x89,0x89,0x00,0x22,0x35,0x55,0x43,0x44,0x32,0x23,0x02,0x90,0xbb,
+0xcd,0xcb,0xcb,0xba,0x9a,0x08,0x43,0x35,0x34,0x32,0x33,0x33,0x33,0x81,0xb9,0xbd,
+0x9a,0x30,0x46,0x34,0x33,0x23,0x12,0xa8,0xfd,0xdc,0xbc,0xbc,0xbb,0xaa,0xaa,0x89,
+0x00,0x32,0x34,0x34,0x22,0x80,0xa8,0x99,0x08,0x22,0x44,0x44,0x54,0x53,0x33,0x33,
+0x13,0x80,0xba,0xbd,0xbd,0xac,0xac,0xaa,0x88,0x31,0x54,0x33,0x24,0x23,0x33,0x23,
+0x02,0x98,0xbc,0xab,0x18,0x46,0x44,0x32,0x22,0x11,0x88,0xdb,0xde,0xcc,0xcb,0xcb,
+0x9a,0x8a,0x89,0x00,0x21,0x33,0x43,0x12,0x01,0x98,0x89,0x08,0x21,0x42,0x45,0x44,
+0x44,0x33,0x43,0x12,0x01,0xa9,0xbc,0xbd,0xcb,0xcb,0x9a,0x8a,0x20,0x53,0x34,0x34,
+0x32,0x23,0x23,0x12,0xa0,0xda,0xaa,0x09,0x63,0x34,0x24,0x23,0x12,0x81,0xeb,0xdd,
+0xcc,0xbc,0xbb,0xac,0xaa,0x9a,0x08,0x21,0x42,0x43,0x12,0x02,0x80,0x80,0x18,0x10,
+0x32,0x45,0x44,0x44,0x43,0x24,0x13,0x02,0x98,0xba,0xcc,0xcb,0xcb,0xba,0x9a,0x18,
+0x52,0x34,0x53,0x32,0x22,0x23,0x11,0x90,0xb9,0xac,0x89,0x42,0x45,0x24,0x33,0x22,
+0x01,0xb9,0xdf,0xdc,0xdb,0xab,0xac,0x9a,0x99,0x08,0x10,0x22,0x43,0x23,0x12,0x88,
+0xa9,0x89,0x10,0x22,0x54,0x44,0x44,0x44,0x32,0x22,0x02,0x90,0xba,0xcc,0xbc,0xbc,
+0xbb,0x9b,0x08,0x52,0x34,0x44,0x32,0x23,0x33,0x12,0x01,0xa9,0xcb,0x9a,0x31,0x37,
+0x35,0x32,0x22,0x01,0xa0,0xed,0xdc,0xcc,0xcb,0xba,0x9a,0x8a,0x09,0x20,0x32,0x34,
+0x22,0x01,0x89,0x99,0x08,0x11,0x43,0x54,0x45,0x53,0x33,0x23,0x12,0x90,0xba,0xcd,
+0xcb,0xac,0xab,0x89,0x10,0x34,0x35,0x43,0x23,0x33,0x33,0x11,0x98,0xbb,0xab,0x40,
+0x46,0x34,0x24,0x21,0x01,0xa8,0xdd,0xdd,0xdb,0xbb,0xba,0xab,0x99,0x08,0x20,0x53,
+0x32,0x22,0x81,0x98,0x89,0x09,0x11,0x44,0x44,0x35,0x35,0x43,0x23,0x01,0xa0,0xca,
+0xbc,0xbc,0xbc,0xba,0x99,0x20,0x54,0x43,0x33,0x24,0x23,0x23,0x01,0xa8,0xba,0x9b,
+0x40,0x46,0x43,0x32,0x12,0x01,0xb8,0xdf,0xdc,0xdb,0xba,0xab,0x9a,0x89,0x08,0x21,
+0x43,0x33,0x12,0x81,0x98,0x88,0x01,0x32,0x54,0x44,0x35,0x44,0x33,0x32,0x11,0xa8,
+0xdb,0xbc,0xac,0xac,0x9a,0x89,0x21,0x44,0x34,0x33,0x43,0x22,0x23,0x01,0xa9,0xcb,
+0x99,0x42,0x45,0x43,0x22,0x11,0x81,0xd9,0xdd,0xdc,0xbb,0xbc,0xba,0x9a,0x89,0x18,
+0x31,0x43,0x33,0x11,0x80,0x99,0x89,0x09,0x21,0x45,0x55,0x53,0x43,0x23,0x22,0x00,
+0xb9,0xdb,0xbc,0xbc,0xcb,0x9a,0x08,0x41,0x44,0x33,0x24,0x23,0x23,0x22,0x00,0xa9,
+0xaa,0x29,0x64,0x34,0x43,0x22,0x12,0x91,0xeb,0xce,0xbd,0xbc,0xac,0xaa,0x9a,0x88,
+0x10,0x21,0x43,0x32,0x11,0x88,0x99,0x09,0x10,0x41,0x63,0x44,0x44,0x43,0x23,0x22,
+0x80,0xaa,0xcc,0xdb,0xba,0xbb,0x9b,0x09,0x53,0x44,0x43,0x32,0x32,0x32,0x12,0x81,
+0xba,0xac,0x19,0x73,0x34,0x33,0x32,0x21,0xa0,0xfc,0xec,0xdb,0xbb,0xbb,0xbb,0x9a,
+0x88,0x20,0x43,0x43,0x13,0x02,0x88,0x89,0x09,0x10,0x42,0x45,0x54,0x43,0x43,0x22,
+0x12,0x80,0xaa,0xcc,0xcb,0xbb,0xac,0x9a,0x08,0x43,0x35,0x34,0x43,0x22,0x23,0x01,
+0x90,0xba,0x9b,0x28,0x46,0x44,0x22,0x22,0x01,0x98,0xdd,0xcd,0xbd,0xac,0xbb,0x9a,
+0x8a,0x09,0x11,0x43,0x33,0x22,0x01,0x98,0x98,0x08,0x20,0x52,0x45,0x54,0x43,0x33,
+0x24,0x11,0x90,0xba,0xbd,0xbc,0xac,0xab,0x8a,0x28,0x63,0x53,0x33,0x32,0x23,0x23,
+0x02,0x98,0xbb,0xab,0x40,0x46,0x34,0x23,0x23,0x02,0xb8,0xef,0xdc,0xcb,0xcb,0xaa,
+0xaa,0x89,0x08,0x21,0x33,0x34,0x12,0x81,0x99,0x98,0x18,0x21,0x44,0x54,0x34,0x45,
+0x32,0x23,0x01,0xa8,0xca,0xcb,0xbc,0xcb,0xbb,0x99,0x21,0x54,0x43,0x33,0x24,0x23,
+0x22,0x01,0xa9,0xba,0x8b,0x41,0x46,0x43,0x32,0x22,0x01,0xc9,0xde,0xcc,0xbc,0xac,
+0xab,0xa9,0x98,0x00,0x21,0x24,0x23,0x12,0x80,0x89,0x09,0x10,0x43,0x45,0x35,0x35,
+0x34,0x22,0x11,0xa8,0xca,0xbc,0xbd,0xcb,0x9a,0x88,0x22,0x44,0x43,0x33,0x33,0x33,
+0x01,0xa8,0xcb,0x9b,0x20,0x46,0x34,0x33,0x22,0x01,0xea,0xdd,0xbd,0xcc,0xba,0xaa,
+0x9a,0x08,0x20,0x32,0x34,0x23,0x01,0x98,0x98,0x00,0x32,0x45,0x44,0x44,0x43,0x33,
+0x13,0x81,0xb9,0xcc,0xdb,0xbb,0xbb,0x9a,0x28,0x63,0x43,0x24,0x23,0x33,0x22,0x01,
+0xa9,0xac,0x0a,0x52,0x44,0x24,0x22,0x12,0x90,0xfb,0xbe,0xbe,0xcb,0xba,0x9a,0x99,
+0x80,0x21,0x33,0x24,0x22,0x80,0x99,0x88,0x10,0x33,0x45,0x54,0x34,0x35,0x23,0x02,
+0x90,0xba,0xcc,0xdb,0xca,0x9a,0x0a,0x30,0x34,0x35,0x23,0x24,0x22,0x12,0x91,0xa9,
+0xab,0x28,0x64,0x34,0x33,0x23,0x01,0xd9,0xdd,0xcd,0xcb,0xcb,0x9a,0x9a,0x88,0x00,
+0x22,0x33,0x33,0x01,0x90,0x89,0x09,0x31,0x54,0x44,0x44,0x34,0x24,0x23,0x00,0xa8,
+0xcb,0xbc,0xcc,0xba,0x9a,0x08,0x43,0x44,0x43,0x23,0x32,0x22,0x11,0x98,0xbb,0x8b,
+0x41,0x36,0x35,0x32,0x22,0x80,0xfb,0xdd,0xbc,0xbc,0xac,0x9a,0x99,0x08,0x11,0x32,
+0x33,0x22,0x00,0x89,0x89,0x00,0x42,0x44,0x45,0x34,0x35,0x32,0x13,0x81,0xba,0xcd,
+0xcb,0xcb,0xaa,0x8a,0x28,0x53,0x44,0x32,0x33,0x22,0x13,0x81,0xb9,0xbb,0x19,0x55,
+0x44,0x23,0x12,0x11,0x98,0xed,0xcd,0xcc,0xba,0xab,0xaa,0x98,0x08,0x22,0x34,0x23,
+0x02,0x80,0x89,0x88,0x11,0x42,0x45,0x45,0x43,0x24,0x23,0x02,0x88,0xcb,0xdb,0xbb,
+0xbc,0xaa,0x09,0x42,0x44,0x43,0x23,0x23,0x23,0x11,0x90,0xba,0xab,0x30,0x57,0x33,
+0x33,0x23,0x81,0xe9,0xdd,0xbd,0xbd,0xbb,0xab,0x9a,0x89,0x10,0x32,0x34,0x23,0x01,
+0x89,0x89,0x18,0x21,0x53,0x45,0x45,0x34,0x43,0x21,0x00,0x99,0xbc,0xcc,0xbb,0xbb,
+0x9a,0x10,0x44,0x53,0x33,0x33,0x33,0x33,0x01,0xb8,0xcb,0x0a,0x62,0x45,0x33,0x33,
+0x12,0x90,0xec,0xcd,0xcc,0xbb,0xac,0xa9,0x89,0x08,0x20,0x33,0x24,0x02,0x90,0x99,
+0x99,0x10,0x42,0x44,0x44,0x44,0x43,0x32,0x02,0x90,0xba,0xcc,0xcb,0xac,0xab,0x89,
+0x21,0x35,0x35,0x32,0x43,0x22,0x02,0x80,0xb9,0xaa,0x28,0x55,0x43,0x33,0x23,0x02,
+0xc9,0xde,0xcd,0xbc,0xbb,0xbb,0xaa,0x98,0x10,0x33,0x34,0x33,0x02,0x88,0x99,0x09,
+0x11,0x44,0x45,0x44,0x44,0x32,0x22,0x01,0xa8,0xcb,0xbc,0xbc,0xac,0xaa,0x08,0x43,
+0x54,0x33,0x33,0x32,0x12,0x01,0xa9,0xba,0x19,0x64,0x44,0x23,0x23,0x81,0xca,0xde,
+0xcc,0xbc,0xbb,0xba,0x9a,0x08,0x21,0x42,0x23,0x12,0x80,0x98,0x88,0x10,0x42,0x55,
+0x44,0x53,0x23,0x13,0x01,0xa9,0xcb,0xcc,0xbb,0xac,0x8a,0x20,0x44,0x43,0x33,0x33,
+0x33,0x22,0x98,0xba,0xab,0x51,0x45,0x34,0x33,0x12,0xa0,0xec,0xdd,0xdb,0xbb,0xbb,
+0xaa,0x89,0x08,0x32,0x43,0x23,0x02,0x98,0x99,0x00,0x22,0x44,0x54,0x35,0x35,0x33,
+0x12,0x90,0xba,0xdc,0xcb,0xbb,0xab,0x08,0x41,0x35,0x34,0x33,0x33,0x23,0x00,0xa9,
+0xab,0x09,0x45,0x35,0x24,0x23,0x12,0xb8,0xdf,0xcd,0xcb,0xbb,0xab,0x9a,0x08,0x20,
+0x32,0x43,0x12,0x01,0x88,0x09,0x20,0x52,0x63,0x53,0x44,0x42,0x12,0x01,0x98,0xba,
+0xcc,0xbb,0xac,0x9a,0x10,0x34,0x35,0x43,0x32,0x23,0x12,0x80,0xba,0x9a,0x20,0x37,
+0x35,0x32,0x22,0x80,0xdc,0xce,0xcc,0xac,0xab,0xaa,0x89,0x08,0x21,0x32,0x33,0x12,
+0x98,0xa9,0x08,0x32,0x36,0x45,0x44,0x43,0x33,0x22,0x80,0xba,0xbd,0xcc,0xcb,0xab,
+0x89,0x31,0x54,0x33,0x24,0x23,0x22,0x12,0x98,0xaa,0x08,0x63,0x44,0x33,0x23,0x12,
+0xa0,0xee,0xdc,0xdb,0xba,0xaa,0x9a,0x89,0x10,0x31,0x33,0x23,0x81,0x98,0x89,0x18,
+0x32,0x56,0x44,0x34,0x35,0x22,0x02,0xa0,0xca,0xbc,0xbc,0xac,0x9b,0x18,0x53,0x34,
+0x43,0x22,0x23,0x12,0x81,0xb9,0xaa,0x28,0x55,0x34,0x33,0x23,0x00,0xfb,0xdd,0xbc,
+0xbc,0xac,0xaa,0x99,0x08,0x11,0x33,0x33,0x12,0x80,0x99,0x09,0x21,0x44,0x54,0x44,
+0x34,0x24,0x12,0x81,0xa9,0xcb,0xbc,0xbc,0xbb,0x8a,0x31,0x45,0x34,0x33,0x24,0x22,
+0x11,0x98,0xaa,0x8a,0x41,0x36,0x34,0x32,0x11,0xa0,0xed,0xcd,0xbc,0xac,0xab,0xa9,
+0x89,0x18,0x22,0x24,0x13,0x01,0x88,0x88,0x18,0x21,0x45,0x54,0x43,0x34,0x23,0x12,
+0x80,0xbb,0xbe,0xbc,0xbb,0xab,0x09,0x52,0x44,0x24,0x23,0x23,0x22,0x01,0xa9,0xac,
+0x18,0x63,0x34,0x32,0x23,0x02,0xc8,0xdf,0xcc,0xbc,0xbb,0xab,0x9a,0x88,0x11,0x33,
+0x34,0x22,0x80,0x99,0x98,0x10,0x43,0x54,0x35,0x45,0x33,0x13,0x01,0xa9,0xbc,0xcc,
+0xcb,0xba,0x99,0x21,0x63,0x43,0x32,0x33,0x23,0x13,0x90,0xba,0x9b,0x50,0x45,0x24,
+0x23,0x12,0x90,0xfb,0xdd,0xbc,0xbc,0xab,0xaa,0x89,0x18,0x31,0x43,0x22,0x02,0x88,
+0x88,0x10,0x22,0x44,0x45,0x44,0x43,0x23,0x12,0x80,0xaa,0xcc,0xcc,0xba,0x9a,0x08,
+0x43,0x44,0x32,0x43,0x22,0x11,0x80,0xa9,0x8a,0x30,0x46,0x43,0x22,0x02,0xb0,0xde,
+0xcd,0xbc,0xbb,0xbb,0x9a,0x09,0x20,0x42,0x32,0x02,0x80,0x98,0x08,0x21,0x63,0x54,
+0x34,0x25,0x23,0x02,0x98,0xba,0xbd,0xcc,0xbb,0x9a,0x18,0x53,0x34,0x43,0x33,0x23,
+0x02,0x90,0x9a,0x08,0x44,0x45,0x23,0x23,0x01,0xc9,0xde,0xcc,0xdb,0xba,0x9a,0x89,
+0x08,0x21,0x32,0x22,0x81,0x98,0x89,0x10,0x32,0x45,0x45,0x44,0x33,0x14,0x01,0x98,
+0xbb,0xcd,0xbb,0xbb,0x8a,0x31,0x45,0x34,0x33,0x33,0x33,0x11,0xa9,0xbb,0x19,0x65,
+0x34,0x33,0x22,0x91,0xfb,0xcd,0xbd,0xbc,0xbb,0xaa,0x99,0x10,0x32,0x43,0x22,0x81,
+0x88,0x89,0x00,0x43,0x35,0x36,0x35,0x43,0x22,0x00,0xa9,0xdb,0xcb,0xac,0xab,0x08,
+0x42,0x34,0x43,0x33,0x33,0x22,0x81,0xa9,0x9a,0x30,0x46,0x34,0x33,0x23,0x90,0xde,
+0xdd,0xbc,0xbb,0xac,0x99,0x09,0x10,0x31,0x33,0x13,0x00,0x99,0x88,0x21,0x44,0x54,
+0x44,0x43,0x33,0x12,0x98,0xc9,0xcb,0xbc,0xbb,0xab,0x18,0x44,0x44,0x33,0x33,0x23,
+0x13,0x98,0xba,0x9a,0x62,0x44,0x24,0x23,0x01,0xa8,0xcf,0xcd,0xbc,0xbb,0xbb,0x99,
+0x88,0x21,0x32,0x24,0x12,0x80,0x98,0x18,0x31,0x63,0x44,0x54,0x43,0x23,0x11,0x98,
+0xcb,0xdb,0xbb,0xac,0x99,0x20,0x53,0x34,0x33,0x24,0x22,0x01,0x98,0xaa,0x0a,0x63,
+0x44,0x33,0x22,0x81,0xda,0xce,0xcd,0xbb,0xac,0xaa,0x89,0x18,0x21,0x32,0x33,0x01,
+0x90,0x99,0x08,0x52,0x44,0x35,0x44,0x33,0x33,0x01,0xa9,0xdb,0xbc,0xbc,0xbb,0x89,
+0x32,0x36,0x34,0x24,0x33,0x22,0x00,0xa9,0x9a,0x18,0x44,0x35,0x24,0x23,0x80,0xdc,
+0xce,0xbc,0xbc,0xba,0x9a,0x98,0x10,0x31,0x33,0x23,0x81,0x98,0x88,0x10,0x63,0x63,
+0x44,0x53,0x23,0x12,0x91,0xb9,0xbc,0xbd,0xac,0x9b,0x19,0x41,0x34,0x34,0x33,0x33,
+0x22,0x80,0xaa,0x8b,0x40,0x36,0x25,0x23,0x13,0xa0,0xee,0xcc,0xcc,0xba,0xaa,0x9a,
+0x08,0x20,0x32,0x42,0x21,0x00,0x80,0x00,0x21,0x53,0x44,0x45,0x43,0x32,0x01,0xa0,
+0xca,0xbc,0xcb,0xab,0x9b,0x28,0x53,0x44,0x33,0x33,0x23,0x12,0x90,0xab,0x8a,0x52,
+0x36,0x25,0x22,0x01,0xc8,0xdd,0xdc,0xbb,0xac,0x9b,0x9a,0x08,0x21,0x33,0x33,0x11,
+0x88,0x89,0x08,0x22,0x55,0x54,0x53,0x33,0x22,0x02,0xa8,0xda,0xdb,0xbb,0xac,0x89,
+0x21,0x34,0x35,0x33,0x33,0x33,0x01,0xa9,0xbc,0x8a,0x41,0x54,0x33,0x33,0x12,0x01,
+0xda,0xce,0xcd,0xbc,0xbc,0xba,0x9a,0x99,0x00,0x31,0x43,0x33,0x13,0x88,0xa8,0x88,
+0x10,0x32,0x45,0x44,0x35,0x44,0x33,0x22,0x02,0x98,0xdb,0xbc,0xcc,0xaa,0xaa,0x88,
+0x31,0x44,0x34,0x43,0x32,0x23,0x12,0x01,0xa9,0xbb,0x8a,0x63,0x45,0x33,0x33,0x12,
+0x81,0xea,0xce,0xcd,0xbb,0xbc,0xab,0xaa,0x98,0x10,0x32,0x34,0x23,0x02,0x80,0x99,
+0x08,0x00,0x42,0x53,0x45,0x35,0x44,0x23,0x22,0x81,0xa9,0xcb,0xbd,0xbc,0xbb,0x9a,
+0x19,0x42,0x44,0x43,0x33,0x43,0x22,0x12,0x80,0xa9,0xbb,0x19,0x73,0x44,0x33,0x22,
+0x22,0x80,0xfb,0xcd,0xbd,0xad,0xbb,0xab,0x9a,0x09,0x10,0x32,0x53,0x22,0x02,0x90,
+0x98,0x89,0x20,0x43,0x54,0x34,0x45,0x33,0x34,0x21,0x80,0xb9,0xdb,0xcb,0xcb,0xba,
+0xaa,0x18,0x52,0x34,0x34,0x43,0x32,0x22,0x12,0x88,0xab,0xab,0x28,0x46,0x34,0x24,
+0x22,0x11,0x98,0xec,0xcd,0xbd,0xbc,0xab,0xab,0x9a,0x88,0x20,0x42,0x33,0x23,0x02,
+0x98,0xa9,0x88,0x11,0x44,0x54,0x53,0x34,0x44,0x22,0x02,0x80,0xaa,0xcc,0xbc,0xcb,
+0xab,0x8a,0x18,0x53,0x34,0x43,0x33,0x24,0x22,0x02,0x90,0xb9,0x9a,0x30,0x46,0x44,
+0x32,0x22,0x01,0xa0,0xec,0xcd,0xcc,0xbb,0xcb,0x9a,0x99,0x08,0x10,0x33,0x24,0x22,
+0x80,0x98,0x89,0x09,0x11,0x53,0x44,0x45,0x34,0x43,0x22,0x02,0x90,0xba,0xcd,0xcb,
+0xbb,0xab,0x9a,0x11,0x35,0x35,0x34,0x33,0x33,0x22,0x11,0x99,0xbb,0x9b,0x41,0x47,
+0x33,0x24,0x12,0x01,0xc8,0xdd,0xcd,0xdb,0xba,0xab,0x9b,0x8a,0x08,0x21,0x43,0x33,
+0x23,0x00,0x89,0x99,0x18,0x21,0x44,0x45,0x35,0x35,0x24,0x23,0x01,0x98,0xca,0xbc,
+0xbc,0xbc,0xaa,0x09,0x21,0x54,0x33,0x34,0x43,0x22,0x21,0x00,0xa8,0xaa,0x8a,0x52,
+0x45,0x33,0x33,0x12,0x81,0xca,0xdf,0xdc,0xcb,0xbb,0xba,0x9a,0x99,0x00,0x32,0x34,
+0x33,0x12,0x80,0x99,0x99,0x10,0x41,0x54,0x34,0x36,0x44,0x32,0x22,0x81,0xa8,0xbc,
+0xcc,0xbb,0xcb,0xaa,0x0a,0x41,0x44,0x43,0x32,0x33,0x32,0x23,0x80,0xba,0xac,0x09,
+0x44,0x45,0x32,0x22,0x22,0x80,0xea,0xce,0xbd,0xbd,0xba,0xab,0x9a,0x89,0x10,0x32,
+0x34,0x33,0x11,0x90,0x98,0x89,0x10,0x32,0x46,0x54,0x44,0x33,0x34,0x12,0x00,0xb9,
+0xdb,0xcb,0xcb,0xbb,0xaa,0x09,0x42,0x54,0x33,0x34,0x32,0x22,0x11,0x80,0xaa,0xab,
+0x18,0x54,0x35,0x34,0x32,0x21,0x81,0xea,0xdd,0xcc,0xbc,0xbb,0xbb,0x9a,0x99,0x08,
+0x22,0x34,0x34,0x23,0x81,0x98,0x9a,0x08,0x10,0x43,0x54,0x44,0x44,0x33,0x34,0x12,
+0x01,0xa9,0xdb,0xbc,0xcb,0xbb,0xac,0x99,0x10,0x63,0x43,0x33,0x33,0x33,0x43,0x21,
+0x90,0xca,0xbb,0x0a,0x63,0x44,0x33,0x32,0x12,0x01,0xd9,0xde,0xcc,0xbc,0xbc,0xba,
+0xaa,0x99,0x08,0x21,0x43,0x43,0x32,0x01,0x80,0x89,0x09,0x20,0x42,0x34,0x45,0x44,
+0x34,0x43,0x22,0x01,0xa8,0xca,0xcb,0xac,0xac,0xab,0x9a,0x19,0x52,0x53,0x43,0x32,
+0x32,0x23,0x22,0x81,0xb9,0xbc,0x9a,0x40,0x36,0x35,0x23,0x13,0x01,0xb8,0xed,0xcd,
+0xbc,0xad,0xbb,0xaa,0x99,0x88,0x00,0x22,0x34,0x24,0x12,0x80,0x99,0x09,0x18,0x21,
+0x43,0x55,0x44,0x53,0x23,0x33,0x12,0x90,0xc9,0xdb,0xcb,0xbb,0xac,0xaa,0x88,0x42,
+0x44,0x43,0x32,0x32,0x32,0x33,0x11,0xa8,0xbc,0x9b,0x30,0x46,0x34,0x43,0x22,0x02,
+0x90,0xcd,0xce,0xcc,0xbb,0xbc,0xba,0xa9,0x88,0x10,0x31,0x43,0x33,0x23,0x01,0x98,
+0x99,0x08,0x21,0x63,0x44,0x44,0x44,0x43,0x32,0x12,0x81,0xa9,0xdb,0xbc,0xcb,0xcb,
+0xaa,0x89,0x21,0x44,0x34,0x43,0x32,0x32,0x23,0x02,0x98,0xbb,0xbb,0x18,0x46,0x44,
+0x43,0x22,0x12,0x90,0xea,0xdc,0xcc,0xbc,0xac,0xab,0x9b,0x89,0x08,0x20,0x43,0x33,
+0x23,0x01,0x98,0x9a,0x09,0x20,0x53,0x63,0x44,0x44,0x43,0x33,0x22,0x00,0xa8,0xca,
+0xcc,0xcb,0xcb,0xaa,0x8a,0x10,0x43,0x44,0x33,0x34,0x33,0x32,0x21,0x90,0xb9,0xac,
+0x0a,0x52,0x54,0x33,0x24,0x21,0x81,0xc8,0xdd,0xbd,0xbd,0xbc,0xba,0x9a,0x9a,0x08,
+0x10,0x33,0x35,0x32,0x12,0x88,0x99,0x98,0x10,0x42,0x53,0x44,0x44,0x34,0x24,0x23,
+0x02,0x98,0xca,0xcb,0xdb,0xbb,0xcb,0x9a,0x08,0x43,0x44,0x33,0x43,0x32,0x32,0x22,
+0x00,0xaa,0xbc,0x9a,0x30,0x37,0x35,0x33,0x22,0x02,0xb8,0xfd,0xdc,0xdb,0xbb,0xbb,
+0xab,0x9a,0x89,0x18,0x32,0x44,0x23,0x22,0x80,0x99,0x9a,0x08,0x31,0x55,0x44,0x53,
+0x43,0x43,0x23,0x22,0x80,0xa9,0xbc,0xbc,0xcc,0xba,0xab,0x88,0x32,0x36,0x34,0x33,
+0x34,0x32,0x23,0x01,0xa8,0xcb,0xab,0x28,0x55,0x44,0x23,0x22,0x02,0x90,0xeb,0xce,
+0xdc,0xbb,0xac,0xab,0x99,0x89,0x08,0x21,0x43,0x33,0x23,0x81,0x88,0x99,0x08,0x20,
+0x52,0x45,0x35,0x35,0x24,0x33,0x22,0x01,0xa9,0xcc,0xcc,0xba,0xac,0x9b,0x8a,0x20,
+0x44,0x34,0x24,0x23,0x23,0x33,0x12,0x81,0xb9,0xbc,0x9b,0x48,0x45,0x44,0x32,0x12,
+0x12,0x00,0xd9,0xdd,0xcd,0xcb,0xac,0xaa,0x9a,0x99,0x08,0x18,0x32,0x53,0x32,0x12,
+0x80,0x99,0x98,0x08,0x10,0x32,0x46,0x35,0x45,0x33,0x24,0x23,0x12,0x98,0xca,0xbc,
+0xbc,0xcc,0xba,0x9a,0x89,0x21,0x54,0x43,0x33,0x33,0x33,0x33,0x23,0x81,0xca,0xac,
+0x9a,0x41,0x45,0x43,0x32,0x23,0x12,0x80,0xdc,0xce,0xcc,0xdb,0xab,0xbb,0xaa,0x99,
+0x09,0x10,0x42,0x43,0x32,0x12,0x00,0x98,0x89,0x08,0x20,0x42,0x44,0x45,0x44,0x43,
+0x43,0x22,0x01,0x98,0xaa,0xcc,0xcb,0xcb,0xbb,0xab,0x09,0x31,0x45,0x34,0x43,0x23,
+0x33,0x23,0x12,0x91,0xb9,0xad,0x9a,0x31,0x46,0x34,0x33,0x32,0x12,0x80,0xdc,0xdd,
+0xdc,0xbb,0xad,0xaa,0x9a,0x99,0x08,0x20,0x22,0x34,0x24,0x12,0x80,0x88,0x89,0x08,
+0x11,0x43,0x53,0x44,0x35,0x34,0x34,0x33,0x11,0x98,0xcb,0xbc,0xcc,0xbb,0xbb,0xab,
+0x89,0x32,0x46,0x34,0x43,0x22,0x32,0x22,0x12,0x81,0xc9,0xcb,0x9a,0x31,0x46,0x33,
+0x24,0x22,0x11,0x80,0xeb,0xce,0xbd,0xcc,0xbb,0xba,0xaa,0x99,0x88,0x10,0x33,0x35,
+0x23,0x12,0x80,0x99,0x99,0x88,0x21,0x45,0x35,0x45,0x43,0x43,0x33,0x23,0x02,0x90,
+0xba,0xcc,0xbc,0xcc,0xba,0xaa,0x89,0x22,0x35,0x35,0x33,0x34,0x33,0x33,0x22,0x80,
+0xbb,0xbd,0x9a,0x30,0x56,0x33,0x34,0x22,0x11,0x90,0xfb,0xcd,0xcc,0xbc,0xac,0xab,
+0x9b,0x99,0x08,0x10,0x31,0x35,0x33,0x12,0x00,0x99,0x89,0x08,0x11,0x43,0x54,0x45,
+0x53,0x43,0x23,0x23,0x11,0xa8,0xca,0xbc,0xbd,0xcb,0xba,0x9b,0x89,0x32,0x45,0x34,
+0x43,0x23,0x32,0x32,0x12,0x90,0xc9,0xab,0x8b,0x42,0x46,0x43,0x23,0x22,0x02,0x90,
+0xdc,0xce,0xcc,0xcb,0xbb,0xbb,0xaa,0x99,0x08,0x20,0x42,0x34,0x43,0x11,0x80,0x98,
+0x89,0x00,0x20,0x32,0x46,0x44,0x34,0x44,0x23,0x23,0x01,0x99,0xbb,0xcd,0xbb,0xcc,
+0xba,0xaa,0x88,0x32,0x45,0x43,0x43,0x32,0x32,0x32,0x22,0x88,0xca,0xbb,0x89,0x52,
+0x44,0x34,0x33,0x23,0x12,0xa0,0xed,0xdc,0xcc,0xcb,0xbb,0xbb,0xaa,0x8a,0x09,0x11,
+0x43,0x34,0x33,0x22,0x80,0xa9,0xa9,0x09,0x21,0x63,0x44,0x44,0x34,0x44,0x33,0x22,
+0x02,0x98,0xcb,0xcc,0xbb,0xad,0xbb,0x9b,0x08,0x41,0x44,0x43,0x33,0x24,0x22,0x22,
+0x02,0x80,0xb9,0xbc,0x9a,0x41,0x45,0x34,0x33,0x23,0x12,0x90,0xec,0xcd,0xbd,0xbc,
+0xbc,0xab,0xaa,0x99,0x09,0x00,0x32,0x53,0x34,0x22,0x02,0x80,0x99,0x98,0x08,0x10,
+0x43,0x55,0x34,0x35,0x34,0x34,0x32,0x11,0x80,0xba,0xcc,0xbc,0xbc,0xbc,0xba,0x9a,
+0x19,0x32,0x46,0x43,0x23,0x33,0x32,0x23,0x23,0x01,0xca,0xbc,0xbb,0x18,0x54,0x34,
+0x25,0x32,0x12,0x01,0xa9,0xcd,0xce,0xbc,0xcd,0xba,0xbb,0xab,0x9a,0x88,0x10,0x31,
+0x35,0x34,0x32,0x11,0x88,0x98,0x88,0x08,0x11,0x53,0x45,0x44,0x53,0x33,0x34,0x33,
+0x12,0x90,0xca,0xbc,0xcc,0xba,0xbc,0xba,0x9a,0x18,0x42,0x44,0x43,0x43,0x32,0x23,
+0x22,0x21,0x00,0xb9,0xcc,0xab,0x18,0x73,0x53,0x32,0x32,0x22,0x11,0xa8,0xdd,0xbe,
+0xcd,0xcb,0xbb,0xbb,0xab,0x99,0x88,0x10,0x32,0x54,0x33,0x23,0x01,0x98,0x89,0x89,
+0x00,0x11,0x44,0x54,0x34,0x35,0x34,0x24,0x33,0x21,0x90,0xb9,0xbd,0xbd,0xbb,0xad,
+0xbb,0x9a,0x18,0x43,0x54,0x33,0x43,0x23,0x23,0x23,0x23,0x00,0xb9,0xbd,0xab,0x28,
+0x64,0x53,0x23,0x33,0x22,0x01,0xa0,0xed,0xdc,0xbc,0xbd,0xcb,0xaa,0xaa,0x99,0x08,
+0x00,0x32,0x34,0x24,0x23,0x01,0x88,0xa9,0x98,0x00,0x21,0x53,0x54,0x34,0x45,0x43,
+0x33,0x23,0x12,0x90,0xcb,0xdb,0xbb,0xbd,0xcb,0xab,0x9a,0x18,0x43,0x44,0x34,0x43,
+0x22,0x22,0x23,0x21,0x81,0xc9,0xbb,0x9c,0x18,0x53,0x35,0x34,0x33,0x22,0x02,0xb8,
+0xde,0xcd,0xbd,0xbc,0xcb,0xaa,0x9a,0x99,0x08,0x00,0x32,0x34,0x34,0x22,0x01,0x90,
+0xa9,0x88,0x18,0x21,0x63,0x44,0x44,0x53,0x43,0x33,0x33,0x11,0x90,0xca,0xdb,0xcb,
+0xbc,0xbb,0xac,0x89,0x18,0x33,0x45,0x53,0x32,0x23,0x33,0x33,0x22,0x81,0xca,0xcc,
+0x8a,0x28,0x63,0x43,0x33,0x33,0x23,0x11,0xb8,0xee,0xdc,0xdb,0xcb,0xbb,0xab,0xab,
+0x99,0x88,0x11,0x32,0x35,0x34,0x22,0x01,0x98,0x99,0x98,0x00,0x20,0x53,0x54,0x44,
+0x34,0x34,0x24,0x23,0x11,0x98,0xbb,0xcc,0xbc,0xcb,0xbc,0xaa,0x9a,0x08,0x42,0x44,
+0x34,0x43,0x22,0x23,0x22,0x11,0x80,0xba,0xbc,0xbb,0x28,0x55,0x44,0x33,0x14,0x12,
+0x01,0xa0,0xec,0xcd,0xbc,0xbc,0xac,0xaa,0x9a,0x99,0x88,0x11,0x42,0x33,0x34,0x22,
+0x00,0x99,0x99,0x89,0x00,0x32,0x53,0x54,0x44,0x44,0x43,0x33,0x33,0x11,0x98,0xca,
+0xcc,0xcb,0xcb,0xab,0xab,0x8a,0x18,0x43,0x45,0x43,0x33,0x33,0x33,0x33,0x22,0x80,
+0xcb,0xbc,0x9a,0x30,0x55,0x43,0x43,0x22,0x12,0x01,0xa9,0xdd,0xdc,0xcc,0xbc,0xcb,
+0xba,0xa9,0x9a,0x88,0x08,0x22,0x43,0x43,0x33,0x23,0x02,0x99,0xaa,0x89,0x18,0x22,
+0x53,0x55,0x34,0x35,0x34,0x34,0x43,0x22,0x81,0xa8,0xca,0xcb,0xbc,0xdb,0xbb,0xab,
+0x9a,0x10,0x42,0x44,0x34,0x43,0x33,0x32,0x22,0x23,0x12,0x90,0xdb,0xbb,0x9b,0x20,
+0x55,0x34,0x34,0x33,0x13,0x02,0x98,0xdc,0xce,0xcc,0xcc,0xbb,0xcb,0x9a,0x9a,0x89,
+0x08,0x10,0x33,0x35,0x33,0x32,0x11,0x80,0xa9,0x99,0x09,0x20,0x42,0x54,0x44,0x35,
+0x35,0x43,0x33,0x32,0x12,0x98,0xda,0xcb,0xcb,0xcb,0xbc,0xab,0xab,0x09,0x21,0x45,
+0x34,0x34,0x33,0x33,0x23,0x23,0x22,0x81,0xca,0xbc,0xab,0x29,0x63,0x35,0x34,0x24,
+0x23,0x01,0x90,0xc9,0xdd,0xcd,0xbc,0xcc,0xba,0xba,0xa9,0x99,0x88,0x11,0x31,0x44,
+0x33,0x33,0x12,0x90,0x89,0x89,0x18,0x21,0x43,0x63,0x63,0x53,0x34,0x34,0x43,0x23,
+0x13,0x00,0xba,0xcc,0xcb,0xac,0xac,0xbb,0xba,0x89,0x10,0x44,0x34,0x35,0x32,0x24,
+0x22,0x32,0x21,0x81,0xa8,0xbc,0xac,0x89,0x31,0x45,0x44,0x32,0x33,0x22,0x80,0xc9,
+0xcd,0xbe,0xcd,0xbc,0xbb,0xbb,0xbb,0xaa,0x89,0x08,0x32,0x44,0x43,0x33,0x13,0x81,
+0xa9,0xab,0x89,0x10,0x31,0x53,0x46,0x44,0x34,0x34,0x43,0x33,0x23,0x01,0xa8,0xbc,
+0xad,0xac,0xcb,0xbb,0xbb,0x9a,0x28,0x53,0x44,0x43,0x43,0x32,0x32,0x22,0x23,0x12,
+0x90,0xcc,0xbc,0x8a,0x20,0x45,0x53,0x32,0x32,0x22,0x11,0x98,0xcd,0xce,0xcc,0xbc,
+0xbc,0xbb,0xab,0x9a,0x99,0x80,0x21,0x52,0x33,0x34,0x23,0x02,0x88,0x9a,0x8a,0x18,
+0x21,0x52,0x63,0x44,0x44,0x43,0x33,0x24,0x33,0x11,0x98,0xcb,0xbc,0xbc,0xbc,0xbc,
+0xcb,0x9a,0x08,0x21,0x44,0x53,0x33,0x24,0x23,0x12,0x22,0x22,0x81,0xc9,0xdb,0xaa,
+0x18,0x53,0x44,0x33,0x43,0x22,0x01,0x80,0xca,0xed,0xcc,0xbc,0xbc,0xac,0xba,0xa9,
+0x99,0x88,0x11,0x31,0x34,0x34,0x33,0x12,0x80,0xa8,0xa9,0x88,0x11,0x43,0x54,0x63,
+0x43,0x44,0x33,0x34,0x32,0x02,0x80,0xba,0xcc,0xcb,0xdb,0xbb,0xac,0xab,0x89,0x20,
+0x53,0x44,0x43,0x23,0x33,0x23,0x23,0x23,0x02,0xb8,0xcd,0xbb,0x89,0x43,0x45,0x33,
+0x24,0x23,0x13,0x01,0xc9,0xce,0xcd,0xcc,0xcb,0xba,0xbb,0xaa,0x9a,0x89,0x18,0x21,
+0x34,0x35,0x33,0x22,0x01,0x98,0xa9,0x89,0x00,0x22,0x63,0x44,0x45,0x53,0x43,0x23,
+0x24,0x21,0x00,0xa9,0xbb,0xbd,0xbc,0xbc,0xbc,0xab,0x9a,0x08,0x31,0x44,0x35,0x44,
+0x23,0x32,0x22,0x22,0x23,0x02,0xa8,0xcb,0xbc,0xaa,0x10,0x73,0x53,0x43,0x32,0x22,
+0x11,0x81,0xb8,0xcf,0xdc,0xbc,0xbd,0xcb,0xab,0xab,0x9a,0x99,0x08,0x10,0x32,0x54,
+0x42,0x22,0x11,0x81,0x98,0x9a,0x8a,0x18,0x21,0x33,0x63,0x54,0x44,0x53,0x23,0x24,
+0x23,0x23,0x00,0xba,0xbd,0xbc,0xcb,0xbc,0xbc,0xbb,0xaa,0x89,0x21,0x63,0x44,0x43,
+0x23,0x33,0x23,0x43,0x22,0x11,0x80,0xca,0xcb,0xaa,0x28,0x73,0x53,0x33,0x33,0x22,
+0x22,0x01,0xc8,0xec,0xcd,0xdb,0xbc,0xcb,0xbb,0xab,0x9a,0x99,0x88,0x10,0x41,0x53,
+0x33,0x33,0x22,0x11,0xa8,0xba,0xaa,0x19,0x41,0x43,0x53,0x35,0x36,0x34,0x44,0x32,
+0x33,0x22,0x01,0xa9,0xcc,0xbc,0xcb,0xcb,0xcb,0xbb,0x9a,0x09,0x21,0x34,0x45,0x34,
+0x33,0x33,0x33,0x23,0x24,0x12,0x90,0xcb,0xbc,0x9c,0x19,0x52,0x44,0x33,0x24,0x12,
+0x12,0x01,0xa8,0xec,0xcd,0xcc,0xdb,0xba,0xcb,0xaa,0x99,0x8a,0x88,0x10,0x31,0x53,
+0x43,0x32,0x22,0x01,0x98,0xa9,0x99,0x18,0x31,0x43,0x53,0x44,0x45,0x34,0x43,0x33,
+0x24,0x23,0x01,0xa9,0xcc,0xbb,0xbc,0xbc,0xcc,0xaa,0x9a,0x09,0x20,0x53,0x53,0x24,
+0x24,0x22,0x12,0x32,0x22,0x12,0x90,0xcb,0xbc,0xab,0x08,0x43,0x36,0x35,0x33,0x33,
+0x12,0x00,0xa9,0xdd,0xdd,0xbc,0xbd,0xbc,0xcb,0xaa,0x9a,0x99,0x88,0x10,0x21,0x34,
+0x34,0x33,0x23,0x01,0xa0,0xaa,0x9b,0x19,0x32,0x34,0x34,0x37,0x46,0x43,0x43,0x33,
+0x33,0x23,0x01,0xb8,0xcc,0xdb,0xbb,0xcc,0xbb,0xac,0xaa,0x88,0x20,0x52,0x44,0x33,
+0x34,0x33,0x32,0x32,0x24,0x12,0x90,0xcb,0xcb,0x9b,0x09,0x53,0x44,0x24,0x33,0x32,
+0x22,0x12,0xa8,0xdd,0xdd,0xdb,0xbc,0xdb,0xab,0xab,0x9a,0x8a,0x89,0x00,0x32,0x34,
+0x44,0x32,0x22,0x11,0x88,0x9a,0x9a,0x18,0x11,0x22,0x53,0x55,0x44,0x34,0x34,0x24,
+0x33,0x23,0x02,0xa8,0xcc,0xbc,0xcb,0xcb,0xcb,0xab,0xaa,0x89,0x00,0x43,0x54,0x43,
+0x24,0x22,0x22,0x23,0x32,0x11,0xa8,0xbb,0xbd,0xab,0x0a,0x52,0x45,0x34,0x43,0x22,
+0x22,0x11,0x90,0xfb,0xcc,0xcc,0xbc,0xbc,0xac,0xbb,0xaa,0x89,0x09,0x18,0x11,0x53,
+0x43,0x33,0x32,0x01,0x90,0xa9,0x9a,0x89,0x10,0x22,0x54,0x54,0x44,0x34,0x44,0x32,
+0x33,0x23,0x11,0x98,0xbc,0xbd,0xbc,0xdb,0xbb,0xcb,0xaa,0x89,0x28,0x42,0x35,0x44,
+0x33,0x33,0x33,0x33,0x22,0x13,0x90,0xcc,0xdb,0x9a,0x20,0x53,0x35,0x33,0x33,0x33,
+0x22,0x98,0xed,0xdc,0xcc,0xcb,0xbc,0xbb,0xab,0x9b,0x89,0x08,0x10,0x42,0x34,0x34,
+0x22,0x02,0x80,0x99,0x98,0x08,0x10,0x42,0x54,0x53,0x34,0x44,0x34,0x33,0x33,0x11,
+0x98,0xca,0xdb,0xcb,0xbc,0xbb,0xac,0x9b,0x89,0x21,0x35,0x45,0x33,0x33,0x33,0x33,
+0x33,0x23,0x81,0xda,0xcb,0xab,0x09,0x63,0x44,0x33,0x34,0x22,0x12,0x81,0xca,0xde,
+0xcc,0xbc,0xbd,0xbb,0xbb,0xab,0x99,0x09,0x00,0x32,0x35,0x44,0x22,0x12,0x80,0x99,
+0x98,0x08,0x00,0x21,0x53,0x44,0x44,0x44,0x43,0x24,0x32,0x11,0x80,0xa9,0xcb,0xcc,
+0xcb,0xbb,0xac,0xba,0x89,0x18,0x53,0x44,0x34,0x32,0x33,0x32,0x23,0x33,0x11,0xb9,
+0xdc,0xab,0x89,0x42,0x54,0x43,0x32,0x22,0x23,0x11,0xb9,0xde,0xcd,0xcc,0xcb,0xcb,
+0xba,0xaa,0x99,0x89,0x00,0x21,0x43,0x34,0x24,0x12,0x81,0x88,0x99,0x08,0x18,0x22,
+0x43,0x54,0x34,0x36,0x53,0x32,0x33,0x23,0x01,0xa8,0xbc,0xbd,0xbd,0xcb,0xbb,0xab,
+0xaa,0x00,0x52,0x63,0x33,0x25,0x32,0x22,0x22,0x23,0x01,0xa0,0xdb,0xbb,0x8a,0x20,
+0x54,0x34,0x35,0x32,0x23,0x02,0x98,0xdd,0xdc,0xcc,0xdb,0xbb,0xcb,0xaa,0xa9,0x98,
+0x08,0x00,0x32,0x53,0x24,0x23,0x11,0x88,0x99,0x88,0x01,0x11,0x42,0x63,0x44,0x44,
+0x43,0x43,0x33,0x23,0x12,0x88,0xbb,0xcc,0xcc,0xbb,0xbc,0xac,0x9a,0x09,0x20,0x53,
+0x34,0x25,0x33,0x32,0x22,0x23,0x13,0x80,0xda,0xbb,0x9c,0x18,0x43,0x45,0x43,0x32,
+0x32,0x11,0x90,0xda,0xdd,0xcc,0xcc,0xcb,0xba,0xbb,0xaa,0x9a,0x88,0x10,0x22,0x35,
+0x34,0x33,0x12,0x80,0xa9,0xa9,0x88,0x20,0x31,0x54,0x54,0x44,0x43,0x24,0x43,0x22,
+0x12,0x80,0xb9,0xcc,0xbb,0xcc,0xca,0xba,0xaa,0x8a,0x10,0x44,0x34,0x34,0x24,0x23,
+0x32,0x32,0x22,0x02,0xa9,0xcc,0xab,0x0a,0x42,0x45,0x34,0x33,0x33,0x22,0x80,0xb9,
+0xcf,0xce,0xdb,0xbc,0xbb,0xbb,0xab,0x9a,0x99,0x00,0x31,0x63,0x43,0x33,0x22,0x01,
+0x98,0x99,0x89,0x00,0x21,0x53,0x54,0x44,0x43,0x34,0x34,0x33,0x33,0x01,0xb9,0xcc,
+0xcb,0xbc,0xcb,0xcb,0xba,0x99,0x18,0x41,0x44,0x43,0x43,0x32,0x22,0x22,0x23,0x02,
+0xa0,0xcb,0xbc,0x99,0x30,0x54,0x44,0x32,0x33,0x22,0x01,0xa0,0xdc,0xce,0xcd,0xcb,
+0xac,0xbb,0xaa,0xa9,0x89,0x88,0x21,0x42,0x53,0x32,0x33,0x01,0x90,0xa9,0x89,0x08,
+0x21,0x42,0x45,0x54,0x53,0x43,0x33,0x33,0x13,0x81,0xaa,0xbd,0xcc,0xbc,0xcb,0xaa,
+0x9a,0x09,0x32,0x45,0x34,0x43,0x32,0x32,0x32,0x22,0x02,0xa9,0xbc,0xbb,0x09,0x63,
+0x44,0x34,0x33,0x23,0x02,0xa0,0xec,0xcd,0xbd,0xbd,0xcb,0xba,0x9a,0x8a,0x89,0x00,
+0x21,0x43,0x34,0x32,0x02,0x80,0x9a,0x89,0x08,0x20,0x52,0x44,0x35,0x35,0x44,0x33,
+0x32,0x12,0x91,0xb9,0xbd,0xbd,0xcc,0xba,0xab,0x9a,0x09,0x31,0x45,0x34,0x34,0x23,
+0x33,0x32,0x32,0x02,0xa0,0xdb,0xbb,0x19,0x54,0x44,0x43,0x32,0x22,0x11,0x90,0xcc,
+0xce,0xcc,0xbc,0xbc,0xab,0xab,0xaa,0x88,0x00,0x32,0x44,0x33,0x23,0x01,0x98,0x99,
+0x89,0x18,0x21,0x53,0x45,0x44,0x44,0x43,0x33,0x23,0x13,0x90,0xba,0xdc,0xcb,0xcb,
+0xbb,0xac,0x9a,0x08,0x32,0x45,0x53,0x32,0x33,0x23,0x33,0x22,0x01,0xb9,0xcc,0xbb,
+0x08,0x63,0x44,0x33,0x24,0x22,0x12,0x98,0xec,0xcd,0xbc,0xbd,0xcb,0xba,0x9a,0x99,
+0x88,0x10,0x31,0x43,0x34,0x22,0x12,0x88,0x98,0x88,0x08,0x11,0x53,0x54,0x44,0x34,
+0x34,0x24,0x23,0x22,0x90,0xb9,0xcc,0xbc,0xbc,0xbb,0xac,0x9b,0x08,0x42,0x44,0x34,
+0x43,0x22,0x23,0x22,0x22,0x01,0xb8,0xcc,0xaa,0x19,0x53,0x35,0x34,0x33,0x22,0x01,
+0xa8,0xec,0xcd,0xbd,0xbd,0xcb,0xba,0x9a,0x8a,0x09,0x00,0x22,0x34,0x34,0x23,0x01,
+0x90,0xa9,0x99,0x88,0x22,0x44,0x44,0x54,0x43,0x43,0x24,0x22,0x11,0x90,0xb9,0xdb,
+0xdb,0xbb,0xbc,0xbb,0x9b,0x09,0x43,0x45,0x43,0x33,0x43,0x22,0x22,0x22,0x00,0xaa,
+0xcc,0x9a,0x08,0x53,0x44,0x33,0x33,0x33,0x11,0xa8,0xde,0xbe,0xbe,0xbc,0xbb,0xac,
+0xaa,0x99,0x08,0x10,0x32,0x53,0x33,0x33,0x01,0x90,0x99,0x89,0x10,0x32,0x35,0x45,
+0x44,0x34,0x44,0x33,0x33,0x13,0x80,0xba,0xcd,0xcb,0xbc,0xcb,0xaa,0x99,0x00,0x32,
+0x35,0x35,0x34,0x23,0x33,0x22,0x23,0x00,0xba,0xbd,0xab,0x28,0x45,0x35,0x33,0x33,
+0x22,0x12,0xb8,0xdf,0xcd,0xbc,0xbd,0xcb,0xaa,0xaa,0x99,0x08,0x00,0x22,0x53,0x33,
+0x23,0x01,0x98,0xa9,0x89,0x88,0x10,0x52,0x45,0x45,0x43,0x34,0x43,0x32,0x11,0x90,
+0xa9,0xbc,0xbd,0xbc,0xcb,0xaa,0x8a,0x10,0x43,0x35,0x25,0x43,0x22,0x12,0x22,0x12,
+0x80,0xb9,0xcc,0xaa,0x18,0x44,0x44,0x32,0x32,0x12,0x02,0xa8,0xde,0xcd,0xcc,0xac,
+0xbb,0xbb,0xaa,0x99,0x09,0x10,0x42,0x43,0x33,0x24,0x01,0xa8,0xcc,0xbc,0xab,0x99,
+0x88,0x90,0x88,0x10,0x42,0x33,0x33,0x33,0x33,0x24,0x21,0x31,0x63,0x34,0x44,0x32,
+0x43,0x44,0x33,0x33,0x23,0x32,0x34,0x35,0x33,0x23,0x42,0x63,0x53,0x33,0x24,0x24,
+0x43,0x32,0x33,0x33,0x33,0x23,0x23,0x31,0x53,0x34,0x44,0x23,0x33,0x22,0x22,0x22,
+0x43,0x43,0x24,0x13,0x91,0xba,0xbd,0xaa,0x10,0x43,0x34,0x23,0x01,0xa8,0xcb,0xcd,
+0xdb,0xaa,0x9a,0xb8,0xec,0xcd,0xcb,0x9a,0x89,0x88,0x99,0xca,0xbb,0xbc,0xbd,0xbc,
+0xbc,0xbb,0xbb,0xdb,0xcb,0xcb,0xbb,0xcb,0xba,0xbb,0xbb,0xdc,0xeb,0xcb,0xcb,0xba,
+0xcb,0xcb,0xbb,0xbb,0x9b,0x9a,0xaa,0xba,0xbb,0xaa,0xbb,0xbe,0xcd,0xbb,0xbc,0xba,
+0xbb,0xbb,0x9a,0x89,0x11,0x43,0x23,0x90,0xed,0xbc,0xab,0x0a,0x20,0x32,0x42,0x42,
+0x34,0x24,0x23,0x54,0x54,0x44,0x23,0x13,0x00,0x10,0x31,0x34,0x43,0x43,0x44,0x43,
+0x33,0x23,0x24,0x43,0x33,0x34,0x43,0x23,0x23,0x13,0x33,0x46,0x45,0x33,0x24,0x32,
+0x33,0x34,0x34,0x22,0x11,0x11,0x21,0x43,0x32,0x23,0x53,0x42,0x22,0x12,0x00,0x31,
+0x44,0x34,0x23,0x82,0xc9,0xbc,0xac,0x89,0x20,0x22,0x11,0x98,0xc9,0xea,0xdb,0xbb,
+0xaa,0x99,0xca,0xdd,0xcc,0xbc,0xbb,0xbb,0xaa,0x8a,0xa9,0xda,0xdb,0xbc,0xcb,0xcb,
+0xba,0xbc,0xbb,0xdb,0xcb,0xcb,0xbb,0xaa,0x9a,0x98,0xca,0xcc,0xcc,0xba,0xbb,0xbd,
+0xbc,0xcc,0xaa,0xaa,0x99,0x99,0xa9,0xaa,0xab,0xba,0xbd,0xcc,0xbb,0xbb,0xbb,0xbb,
+0xbd,0xbc,0xac,0x9a,0x20,0x45,0x24,0x02,0xb9,0xbe,0xac,0x8a,0x18,0x31,0x32,0x22,
+0x22,0x41,0x52,0x44,0x54,0x43,0x33,0x33,0x12,0x10,0x00,0x42,0x44,0x34,0x33,0x34,
+0x53,0x34,0x34,0x33,0x13,0x21,0x21,0x34,0x33,0x33,0x53,0x54,0x44,0x43,0x23,0x32,
+0x33,0x35,0x34,0x32,0x11,0x00,0x00,0x22,0x43,0x33,0x32,0x32,0x24,0x23,0x32,0x32,
+0x53,0x33,0x33,0x13,0xc9,0xde,0xbc,0x9b,0x08,0x32,0x22,0x90,0xb9,0xcc,0xbd,0xbe,
+0xab,0xaa,0x99,0xcc,0xce,0xbc,0xcb,0xab,0x99,0x88,0x98,0xba,0xcd,0xcb,0xbb,0xba,
+0xbb,0xcc,0xbc,0xcc,0xab,0xac,0xba,0xba,0xbb,0xbb,0xbb,0xdd,0xdb,0xbc,0xbb,0xbc,
+0xcb,0xcc,0xbb,0xba,0x99,0x89,0xa8,0xaa,0xab,0x88,0x11,0x90,0xdd,0xcc,0xba,0x9a,
+0xaa,0xaa,0x89,0x28,0x53,0x34,0x26,0x23,0xa1,0xce,0xbb,0x0a,0x42,0x33,0x11,0x10,
+0x42,0x34,0x23,0x53,0x55,0x44,0x23,0x23,0x21,0x32,0x54,0x44,0x53,0x33,0x33,0x33,
+0x34,0x45,0x53,0x32,0x43,0x22,0x23,0x33,0x32,0x32,0x24,0x43,0x22,0x11,0x00,0x80,
+0x08,0x00,0x80,0xea,0xdc,0xcc,0xcb,0xcb,0xba,0xcb,0xcb,0xcb,0xbc,0xcb,0xac,0xcb,
+0xba,0xbb,0xbd,0xcc,0xbb,0xcb,0xba,0xab,0xab,0xcb,0xcb,0xca,0xaa,0x9a,0x9a,0xa9,
+0xbb,0xac,0xab,0x88,0x21,0x44,0x53,0x43,0x33,0x33,0x34,0x36,0x35,0x24,0x33,0x33,
+0x53,0x34,0x35,0x43,0x33,0x33,0x34,0x33,0x43,0x33,0x24,0x23,0x33,0x24,0x33,0x32,
+0x32,0x42,0x43,0x23,0x11,0x99,0xba,0xcb,0xbb,0xcb,0xcb,0xdb,0xcc,0xbc,0xbd,0xbb,
+0xcb,0xcb,0xcc,0xcb,0xbc,0xbb,0xac,0xaa,0xaa,0xba,0xbc,0xcb,0xba,0xab,0xaa,0x99,
+0xaa,0xba,0xcb,0x8a,0x20,0x64,0x44,0x33,0x33,0x33,0x45,0x44,0x43,0x43,0x22,0x33,
+0x33,0x45,0x53,0x33,0x43,0x32,0x33,0x42,0x32,0x33,0x43,0x23,0x22,0x12,0x12,0x10,
+0x00,0x00,0x00,0xb8,0xed,0xcc,0xcc,0xba,0xbb,0xcc,0xcb,0xcb,0xcb,0xbb,0xbc,0xcc,
+0xba,0xac,0xbc,0xdb,0xbb,0xcb,0xba,0xba,0xca,0xba,0xcb,0xbb,0xbb,0xaa,0xaa,0xba,
+0xbb,0xcc,0xba,0x9a,0x18,0x63,0x34,0x34,0x33,0x43,0x43,0x44,0x34,0x34,0x33,0x33,
+0x44,0x43,0x44,0x33,0x43,0x33,0x33,0x24,0x33,0x34,0x33,0x24,0x33,0x22,0x23,0x23,
+0x33,0x43,0x33,0x23,0x01,0xca,0xbc,0xcb,0xba,0xdb,0xbc,0xbd,0xbd,0xbc,0xbc,0xbb,
+0xbc,0xbc,0xbd,0xdb,0xbb,0xbc,0xab,0xab,0xab,0xcb,0xbc,0xac,0xab,0x99,0x98,0xaa,
+0xba,0xbb,0x9b,0x8a,0x38,0x65,0x44,0x43,0x22,0x23,0x53,0x44,0x43,0x24,0x33,0x32,
+0x34,0x53,0x43,0x34,0x43,0x33,0x23,0x33,0x33,0x44,0x32,0x33,0x22,0x12,0x12,0x21,
+0x21,0x22,0x12,0xb8,0xde,0xbc,0xbc,0xcb,0xcb,0xbc,0xcb,0xbc,0xbc,0xbc,0xbc,0xac,
+0xbb,0xdb,0xcb,0xcb,0xac,0xbb,0xac,0xba,0xab,0xbb,0xbc,0xcb,0xbb,0xab,0xaa,0xaa,
+0xcb,0xbc,0xba,0x99,0x11,0x42,0x43,0x43,0x34,0x33,0x35,0x44,0x53,0x43,0x23,0x23,
+0x43,0x53,0x34,0x34,0x43,0x23,0x33,0x24,0x33,0x43,0x33,0x33,0x43,0x22,0x21,0x22,
+0x33,0x24,0x23,0x12,0x98,0xda,0xbb,0xad,0xac,0xbc,0xcb,0xcb,0xcc,0xcb,0xcb,0xab,
+0xbb,0xcc,0xdb,0xcb,0xbc,0xbb,0xbb,0xbb,0xaa,0xbb,0xcc,0xac,0xbb,0xba,0xa9,0xaa,
+0xbb,0xbc,0xaa,0x8a,0x10,0x54,0x54,0x43,0x32,0x24,0x33,0x54,0x43,0x24,0x33,0x33,
+0x33,0x45,0x53,0x43,0x43,0x33,0x34,0x32,0x33,0x33,0x23,0x22,0x23,0x33,0x02,0xb9,
+0xce,0xcb,0xbb,0xbd,0xcd,0xcb,0xbb,0xbc,0xbd,0xbc,0xcb,0xba,0xbb,0xcb,0xbb,0xab,
+0xba,0xba,0xac,0x9a,0x09,0x21,0x33,0x35,0x35,0x45,0x42,0x32,0x34,0x44,0x53,0x32,
+0x32,0x32,0x43,0x32,0x23,0x13,0x12,0x32,0x12,0x91,0xca,0xcc,0xca,0xcb,0xdb,0xbc,
+0xdb,0xbb,0xcc,0xbb,0xbd,0xba,0xbb,0xbc,0xbb,0xbb,0xbb,0xbb,0xcb,0xaa,0x89,0x21,
+0x43,0x43,0x54,0x34,0x35,0x33,0x43,0x34,0x35,0x34,0x43,0x22,0x33,0x33,0x43,0x23,
+0x22,0x23,0x23,0x22,0x80,0xaa,0xbb,0xcc,0xcd,0xdb,0xac,0xcb,0xbb,0xcd,0xcb,0xbb,
+0xbb,0xcb,0xcb,0xba,0xaa,0xab,0xbb,0xba,0x9a,0x18,0x31,0x44,0x43,0x44,0x44,0x33,
+0x34,0x44,0x43,0x43,0x43,0x32,0x33,0x33,0x34,0x32,0x23,0x23,0x22,0x23,0x11,0x98,
+0xdb,0xdb,0xcb,0xbc,0xbd,0xbc,0xbc,0xdb,0xcb,0xbc,0xcb,0xba,0xbb,0xbb,0xbc,0xba,
+0xab,0xcb,0xba,0x99,0x18,0x31,0x33,0x44,0x44,0x35,0x43,0x43,0x42,0x43,0x34,0x34,
+0x32,0x23,0x33,0x34,0x23,0x23,0x22,0x22,0x13,0x91,0xca,0xcb,0xbc,0xeb,0xcc,0xcb,
+0xba,0xbc,0xdb,0xdb,0xbb,0xac,0xbb,0xca,0xaa,0xbb,0xaa,0xbb,0xca,0xba,0x8a,0x10,
+0x33,0x35,0x43,0x54,0x43,0x43,0x33,0x34,0x35,0x34,0x24,0x33,0x42,0x32,0x33,0x33,
+0x22,0x22,0x32,0x22,0x01,0xb9,0xbc,0xbc,0xcc,0xcc,0xbc,0xad,0xcb,0xdb,0xbb,0xbc,
+0xac,0xba,0xab,0xac,0xba,0xaa,0xab,0xab,0xab,0x8a,0x20,0x53,0x44,0x34,0x44,0x43,
+0x33,0x44,0x43,0x53,0x33,0x43,0x32,0x33,0x43,0x32,0x23,0x22,0x22,0x23,0x02,0x90,
+0xbb,0xcd,0xbb,0xcd,0xdb,0xbc,0xcb,0xcb,0xbc,0xbc,0xac,0xbb,0xcb,0xba,0xbb,0xac,
+0xaa,0xba,0xba,0xaa,0x0a,0x21,0x43,0x44,0x43,0x44,0x43,0x33,0x44,0x43,0x34,0x34,
+0x23,0x33,0x33,0x34,0x33,0x32,0x22,0x21,0x22,0x01,0xa9,0xbd,0xbc,0xeb,0xdb,0xbc,
+0xcb,0xcb,0xcb,0xcc,0xbb,0xbb,0xbc,0xba,0xbc,0xab,0xbb,0xab,0xbb,0xab,0x9b,0x18,
+0x43,0x44,0x33,0x36,0x44,0x43,0x33,0x34,0x35,0x34,0x24,0x33,0x33,0x43,0x33,0x23,
+0x33,0x32,0x33,0x22,0x81,0xba,0xbc,0xcb,0xcc,0xcd,0xbc,0xac,0xbb,0xcc,0xbc,0xad,
+0xbb,0xba,0xba,0xbc,0xba,0xab,0xaa,0xbb,0xbb,0x0a,0x30,0x44,0x34,0x44,0x34,0x44,
+0x32,0x34,0x44,0x43,0x43,0x32,0x33,0x43,0x33,0x23,0x23,0x23,0x32,0x43,0x12,0x80,
+0xca,0xbc,0xbd,0xbd,0xbd,0xcc,0xcb,0xcb,0xbb,0xbc,0xbb,0xca,0xaa,0xba,0x9a,0x99,
+0x10,0x42,0x53,0x43,0x53,0x43,0x34,0x34,0x34,0x23,0x33,0x33,0x33,0x33,0x22,0x01,
+0xa8,0xdb,0xbc,0xbd,0xbd,0xbc,0xbd,0xbc,0xcb,0xbb,0xbb,0xbb,0xbc,0xba,0xaa,0x89,
+0x00,0x32,0x35,0x35,0x35,0x44,0x43,0x43,0x43,0x32,0x22,0x23,0x33,0x32,0x22,0x01,
+0x98,0xdb,0xdb,0xdb,0xcb,0xcb,0xbc,0xad,0xac,0xbb,0xba,0xbb,0xbb,0xcb,0x9a,0x99,
+0x10,0x32,0x44,0x53,0x43,0x44,0x34,0x43,0x43,0x32,0x32,0x23,0x33,0x33,0x22,0x11,
+0x98,0xba,0xcc,0xcc,0xdb,0xbc,0xcc,0xcb,0xbb,0xcb,0xbb,0xba,0xab,0xab,0xaa,0x99,
+0x10,0x34,0x36,0x43,0x34,0x34,0x45,0x43,0x33,0x33,0x43,0x32,0x32,0x23,0x12,0x11,
+0x98,0xba,0xdc,0xcb,0xbc,0xcd,0xcb,0xcb,0xbb,0xbc,0xca,0xaa,0xab,0xaa,0x9a,0x99,
+0x08,0x32,0x44,0x34,0x44,0x34,0x35,0x43,0x43,0x32,0x32,0x33,0x33,0x23,0x22,0x11,
+0x90,0xc9,0xcc,0xbc,0xcc,0xbc,0xcc,0xbb,0xbc,0xbb,0xbc,0xba,0xbb,0xbb,0xaa,0x9a,
+0x18,0x31,0x45,0x44,0x43,0x53,0x43,0x43,0x43,0x32,0x23,0x33,0x23,0x23,0x23,0x02,
+0x90,0xba,0xcd,0xdb,0xdb,0xbc,0xbc,0xbc,0xbc,0xcb,0xba,0xbb,0xba,0xab,0xab,0x9a,
+0x19,0x41,0x35,0x44,0x43,0x53,0x43,0x43,0x43,0x32,0x23,0x33,0x24,0x12,0x12,0x02,
+0x81,0xa9,0xdb,0xbc,0xcc,0xbc,0xcc,0xcb,0xcb,0xba,0xab,0xbb,0xac,0xaa,0xaa,0x89,
+0x08,0x31,0x44,0x34,0x44,0x34,0x34,0x25,0x24,0x33,0x32,0x33,0x33,0x23,0x33,0x12,
+0x80,0xca,0xcc,0xbc,0xbc,0xcc,0xbc,0xcc,0xbb,0xbb,0xac,0xbb,0xcb,0xaa,0xaa,0x89,
+0x08,0x31,0x63,0x43,0x43,0x44,0x43,0x43,0x33,0x34,0x33,0x33,0x33,0x23,0x23,0x02,
+0x80,0xba,0xcd,0xdb,0xdb,0xdb,0xcb,0xcb,0xcb,0xba,0xbb,0xcb,0xaa,0xaa,0xaa,0x9a,
+0x09,0x21,0x54,0x43,0x34,0x34,0x44,0x43,0x43,0x32,0x33,0x32,0x33,0x23,0x23,0x11,
+0x80,0xba,0xbd,0xcd,0xcb,0xcc,0xdb,0xbb,0xbc,0xcb,0xab,0xbb,0xbb,0xbb,0xab,0x9a,
+0x08,0x31,0x54,0x34,0x44,0x43,0x34,0x25,0x24,0x33,0x32,0x33,0x32,0x33,0x22,0x12,
+0x81,0xba,0xcc,0xcc,0xdb,0xbc,0xcc,0xcb,0xcb,0xab,0xbb,0xcb,0xaa,0xab,0x9a,0x89,
+0x08,0x22,0x44,0x34,0x35,0x44,0x43,0x34,0x43,0x32,0x33,0x24,0x22,0x32,0x21,0x01,
+0x80,0xb9,0xdb,0xdb,0xcb,0xbc,0xcc,0xbc,0xbc,0xca,0xaa,0xab,0xbb,0xbb,0xaa,0x99,
+0x20,0x53,0x54,0x53,0x43,0x43,0x24,0x33,0x33,0x33,0x33,0x22,0x00,0xa8,0xbc,0xdc,
+0xdb,0xdb,0xcb,0xbb,0xac,0xab,0xbb,0xbb,0x9b,0x88,0x22,0x53,0x44,0x53,0x34,0x34,
+0x33,0x34,0x32,0x23,0x23,0x11,0x88,0xb9,0xdb,0xcc,0xcc,0xbc,0xbc,0xbb,0xcb,0xbb,
+0xba,0xab,0x99,0x08,0x32,0x54,0x34,0x35,0x44,0x33,0x24,0x33,0x23,0x23,0x22,0x11,
+0x98,0xca,0xbc,0xbd,0xcd,0xcb,0xac,0xbb,0xbb,0xbb,0xac,0xaa,0x89,0x10,0x43,0x53,
+0x34,0x44,0x34,0x43,0x23,0x33,0x23,0x33,0x12,0x81,0xa8,0xcb,0xcc,0xcc,0xcc,0xcb,
+0xbb,0xcb,0xba,0xba,0xab,0x9a,0x08,0x31,0x63,0x43,0x44,0x53,0x33,0x34,0x23,0x33,
+0x33,0x22,0x12,0x81,0xaa,0xbd,0xcd,0xcc,0xcb,0xcb,0xab,0xac,0xba,0xba,0xaa,0x99,
+0x18,0x32,0x45,0x43,0x44,0x43,0x34,0x33,0x33,0x33,0x32,0x13,0x02,0x98,0xcb,0xcc,
+0xcc,0xdb,0xdb,0xbb,0xbb,0xac,0xab,0xab,0x9a,0x89,0x11,0x43,0x44,0x44,0x53,0x33,
+0x34,0x23,0x24,0x22,0x13,0x12,0x80,0xa8,0xca,0xcc,0xcc,0xcb,0xcb,0xcb,0xba,0xbb,
+0xba,0xab,0x9a,0x09,0x21,0x54,0x53,0x53,0x43,0x43,0x33,0x33,0x43,0x22,0x12,0x01,
+0x80,0xb9,0xdb,0xcc,0xbc,0xbd,0xbc,0xcb,0xba,0xba,0xab,0xab,0x89,0x18,0x42,0x63,
+0x43,0x53,0x43,0x24,0x33,0x33,0x32,0x33,0x22,0x81,0xa8,0xbb,0xce,0xbc,0xcd,0xcb,
+0xbb,0xcb,0xbb,0xba,0xbb,0x9a,0x88,0x21,0x63,0x53,0x53,0x43,0x24,0x33,0x24,0x23,
+0x23,0x32,0x11,0x01,0x99,0xcb,0xdc,0xdb,0xbc,0xcb,0xac,0xbb,0xba,0xac,0x9a,0x99,
+0x00,0x21,0x53,0x43,0x35,0x34,0x25,0x24,0x32,0x22,0x22,0x22,0x01,0x88,0xba,0xcc,
+0xbc,0xcd,0xcb,0xac,0xbb,0xbb,0xac,0xab,0x9b,0x89,0x10,0x33,0x35,0x45,0x53,0x43,
+0x33,0x24,0x23,0x33,0x32,0x12,0x81,0xa8,0xda,0xdb,0xdb,0xbc,0xcc,0xba,0xbb,0xac,
+0xab,0xab,0x99,0x09,0x11,0x43,0x35,0x45,0x43,0x43,0x33,0x33,0x24,0x23,0x22,0x11,
+0x88,0xa8,0xdb,0xbc,0xcd,0xdb,0xbb,0xac,0xbb,0xac,0xaa,0xaa,0x89,0x18,0x31,0x34,
+0x45,0x53,0x43,0x24,0x33,0x33,0x33,0x33,0x23,0x02,0xa8,0xbb,0xcd,0xcc,0xcc,0xdb,
+0xba,0xbb,0xcb,0xba,0xab,0xaa,0x09,0x10,0x42,0x44,0x34,0x35,0x25,0x43,0x22,0x23,
+0x23,0x23,0x11,0x01,0x99,0xca,0xcc,0xcc,0xbc,0xbc,0xac,0xac,0xba,0xba,0xaa,0x99,
+0x08,0x21,0x53,0x53,0x34,0x35,0x53,0x42,0x22,0x22,0x22,0x21,0x00,0x98,0xcb,0xdc,
+0xdb,0xcb,0xbb,0xbc,0xba,0xba,0x99,0x08,0x21,0x44,0x44,0x53,0x43,0x32,0x33,0x32,
+0x22,0x02,0x80,0xb9,0xdd,0xdb,0xdb,0xba,0xac,0xab,0xba,0xa9,0x89,0x10,0x42,0x54,
+0x43,0x34,0x43,0x33,0x23,0x22,0x12,0x80,0xa8,0xeb,0xbc,0xcd,0xca,0xba,0xbb,0xbb,
+0xba,0x99,0x00,0x32,0x36,0x45,0x43,0x24,0x33,0x33,0x32,0x12,0x11,0x98,0xca,0xcd,
+0xcc,0xcb,0xbb,0xac,0xbb,0xba,0x99,0x88,0x21,0x53,0x44,0x44,0x33,0x24,0x33,0x23,
+0x22,0x12,0x88,0xba,0xcd,0xcc,0xbc,0xdb,0xba,0xbb,0xab,0xab,0x99,0x18,0x43,0x45,
+0x34,0x44,0x32,0x24,0x23,0x22,0x11,0x00,0x98,0xcb,0xbd,0xbd,0xbc,0xcb,0xbb,0xab,
+0xbb,0x99,0x08,0x32,0x45,0x44,0x53,0x33,0x34,0x32,0x32,0x12,0x02,0x88,0xca,0xdc,
+0xdb,0xbb,0xad,0xcb,0xaa,0xaa,0x99,0x09,0x20,0x52,0x53,0x34,0x34,0x43,0x32,0x23,
+0x22,0x02,0x80,0xa9,0xcc,0xbd,0xbd,0xbc,0xcb,0xab,0xab,0xaa,0x99,0x00,0x43,0x44,
+0x34,0x35,0x43,0x33,0x33,0x32,0x11,0x01,0xa8,0xcb,0xcd,0xcc,0xcb,0xbb,0xac,0xab,
+0xab,0x99,0x08,0x22,0x44,0x44,0x34,0x34,0x43,0x23,0x22,0x22,0x10,0x88,0xba,0xdc,
+0xcc,0xcb,0xbc,0xca,0xaa,0xaa,0x99,0x09,0x10,0x43,0x44,0x34,0x34,0x34,0x33,0x33,
+0x23,0x21,0x80,0xb9,0xdc,0xcc,0xcb,0xbc,0xbb,0xbc,0xba,0x9a,0x8a,0x08,0x42,0x44,
+0x53,0x34,0x43,0x23,0x24,0x21,0x11,0x00,0x88,0xba,0xcd,0xbd,0xcb,0xcb,0xba,0xbb,
+0xab,0x9a,0x08,0x21,0x35,0x45,0x34,0x53,0x32,0x33,0x32,0x22,0x11,0x88,0xba,0xbe,
+0xcd,0xcb,0xcb,0xbb,0xcb,0xaa,0xa9,0x88,0x10,0x43,0x44,0x53,0x43,0x33,0x24,0x23,
+0x22,0x11,0x00,0xa9,0xeb,0xdb,0xcb,0xbc,0xcb,0xab,0xbb,0xaa,0x8a,0x08,0x41,0x44,
+0x34,0x35,0x43,0x33,0x33,0x23,0x22,0x01,0x99,0xda,0xcc,0xbc,0xcc,0xbb,0xac,0xbb,
+0xaa,0x9a,0x08,0x20,0x44,0x44,0x53,0x33,0x34,0x32,0x33,0x22,0x11,0x80,0xaa,0xcd,
+0xbd,0xbc,0xad,0xbb,0xac,0xaa,0x9a,0x89,0x10,0x32,0x45,0x44,0x43,0x33,0x43,0x22,
+0x22,0x12,0x00,0xa8,0xeb,0xdb,0xcb,0xac,0xac,0xbb,0xab,0xab,0x99,0x08,0x31,0x54,
+0x53,0x34,0x34,0x24,0x23,0x22,0x12,0x01,0x98,0xba,0xdd,0xcb,0xbc,0xbc,0xbb,0xbb,
+0xbb,0x9b,0x09,0x21,0x45,0x44,0x34,0x34,0x24,0x33,0x32,0x22,0x11,0x80,0xba,0xdc,
+0xcc,0xcb,0xcb,0xbb,0xcb,0xaa,0x9a,0x09,0x20,0x53,0x35,0x35,0x43,0x33,0x32,0x12,
+0x11,0x98,0xcb,0xcd,0xbc,0xbc,0xcb,0xaa,0xaa,0x89,0x18,0x32,0x36,0x35,0x34,0x43,
+0x32,0x12,0x11,0x88,0xb9,0xdc,0xbc,0xbc,0xbc,0xbb,0xab,0x9a,0x08,0x31,0x55,0x43,
+0x34,0x43,0x23,0x22,0x12,0x00,0xa9,0xeb,0xcc,0xcb,0xbb,0xbb,0xac,0x9a,0x89,0x21,
+0x53,0x44,0x43,0x34,0x32,0x23,0x12,0x01,0x98,0xcb,0xcd,0xbc,0xbc,0xbb,0xbb,0xab,
+0x99,0x18,0x53,0x35,0x35,0x34,0x33,0x24,0x12,0x11,0x88,0xba,0xcd,0xbc,0xbc,0xbc,
+0xab,0xab,0x9a,0x00,0x32,0x45,0x44,0x43,0x33,0x43,0x12,0x11,0x80,0xa8,0xdb,0xcc,
+0xbc,0xcb,0xab,0xab,0x9a,0x89,0x21,0x44,0x44,0x34,0x43,0x23,0x23,0x12,0x01,0xa8,
+0xcb,0xcd,0xbc,0xbc,0xbb,0xac,0x9a,0x89,0x10,0x42,0x44,0x53,0x33,0x34,0x22,0x22,
+0x11,0x90,0xba,0xce,0xdb,0xbb,0xbc,0xba,0xab,0x99,0x08,0x32,0x36,0x45,0x33,0x34,
+0x23,0x23,0x02,0x81,0xa9,0xcd,0xbc,0xbd,0xcb,0xbb,0xaa,0x9a,0x09,0x30,0x63,0x44,
+0x43,0x43,0x32,0x22,0x11,0x01,0x99,0xcb,0xbd,0xbd,0xbc,0xbb,0xbb,0xab,0x89,0x21,
+0x63,0x44,0x43,0x43,0x33,0x23,0x22,0x01,0x88,0xcb,0xdc,0xdb,0xbb,0xac,0xbb,0xaa,
+0x8a,0x08,0x42,0x54,0x43,0x43,0x32,0x33,0x23,0x12,0x88,0xb9,0xbe,0xcd,0xcb,0xbb,
+0xac,0xaa,0x99,0x09,0x21,0x44,0x44,0x43,0x33,0x33,0x23,0x13,0x00,0xa9,0xdc,0xcc,
+0xdb,0xbb,0xbb,0xbb,0x9b,0x89,0x20,0x54,0x34,0x35,0x43,0x33,0x32,0x22,0x11,0x98,
+0xcb,0xcd,0xcb,0xbc,0xbb,0xbb,0xab,0x9a,0x10,0x42,0x45,0x44,0x33,0x24,0x23,0x22,
+0x02,0x80,0xba,0xcd,0xcc,0xcb,0xbb,0xbb,0xbb,0xaa,0x08,0x31,0x36,0x36,0x34,0x43,
+0x32,0x22,0x12,0x00,0xa8,0xcc,0xcc,0xcb,0xbc,0xca,0x9a,0x9a,0x88,0x20,0x42,0x44,
+0x34,0x43,0x33,0x32,0x12,0x01,0x98,0xdb,0xcc,0xbc,0xdb,0xba,0xbb,0xaa,0x89,0x10,
+0x52,0x53,0x34,0x53,0x32,0x23,0x13,0x02,0x80,0xba,0xbe,0xbd,0xcc,0xba,0xbb,0xaa,
+0x9a,0x08,0x31,0x45,0x44,0x24,0x24,0x22,0x22,0x11,0x00,0xa9,0xdb,0xcc,0xbc,0xbb,
+0xbc,0xba,0x9a,0x09,0x20,0x44,0x44,0x34,0x43,0x32,0x23,0x12,0x01,0xa8,0xcb,0xcd,
+0xbc,0xbc,0xbb,0xbb,0xab,0x8a,0x10,0x44,0x44,0x34,0x34,0x33,0x33,0x23,0x11,0x88,
+0xda,0xcc,0xdb,0xcb,0xbb,0xbb,0xab,0x9a,0x08,0x32,0x46,0x34,0x35,0x33,0x33,0x22,
+0x12,0x81,0xba,0xce,0xcc,0xcb,0xbb,0xab,0x9b,0x89,0x21,0x45,0x53,0x43,0x33,0x32,
+0x12,0x01,0xa9,0xcc,0xbd,0xbc,0xbc,0xba,0x9a,0x89,0x21,0x54,0x53,0x33,0x43,0x32,
+0x21,0x81,0xa8,0xeb,0xdb,0xcb,0xbb,0xab,0x9b,0x89,0x21,0x54,0x53,0x43,0x33,0x32,
+0x22,0x81,0xa8,0xcc,0xcc,0xbc,0xcb,0xaa,0x9a,0x88,0x20,0x34,0x36,0x53,0x32,0x22,
+0x12,0x01,0xa8,0xdb,0xcc,0xbc,0xcb,0xaa,0x9a,0x89,0x20,0x53,0x44,0x43,0x23,0x33,
+0x12,0x01,0xa8,0xdc,0xdb,0xcb,0xbb,0xba,0xaa,0x89,0x20,0x63,0x44,0x43,0x33,0x32,
+0x12,0x01,0x99,0xcc,0xcc,0xbc,0xcb,0xaa,0x9a,0x89,0x20,0x52,0x44,0x43,0x33,0x32,
+0x22,0x10,0x99,0xeb,0xbc,0xbd,0xbb,0xbb,0xab,0x89,0x20,0x45,0x44,0x43,0x33,0x33,
+0x22,0x01,0xa8,0xcc,0xcc,0xbc,0xcb,0xaa,0xaa,0x89,0x20,0x53,0x44,0x43,0x32,0x33,
+0x12,0x02,0xa8,0xeb,0xbc,0xbd,0xbb,0xac,0xaa,0x09,0x10,0x53,0x44,0x43,0x33,0x32,
+0x22,0x01,0x98,0xcc,0xcc,0xcb,0xac,0xab,0xaa,0x89,0x11,0x53,0x44,0x43,0x32,0x33,
+0x13,0x02,0xa8,0xeb,0xbc,0xbd,0xbb,0xac,0xaa,0x89,0x10,0x34,0x45,0x43,0x33,0x33,
+0x22,0x01,0x98,0xcc,0xcc,0xcb,0xac,0xba,0x9a,0x89,0x10,0x52,0x34,0x35,0x33,0x24,
+0x12,0x01,0xa0,0xda,0xdb,0xcb,0xcb,0xba,0xaa,0x89,0x20,0x43,0x45,0x33,0x34,0x33,
+0x22,0x11,0x98,0xcc,0xcc,0xcb,0xcb,0xaa,0x9b,0x99,0x20,0x43,0x45,0x33,0x34,0x33,
+0x22,0x11,0xa8,0xdb,0xcc,0xbc,0xac,0xbb,0xaa,0x8a,0x10,0x53,0x44,0x34,0x33,0x43,
+0x12,0x01,0x98,0xca,0xcc,0xbc,0xbc,0xab,0xab,0x89,0x10,0x43,0x45,0x34,0x33,0x24,
+0x22,0x10,0x98,0xda,0xdb,0xcb,0xac,0xab,0x9b,0x8a,0x00,0x53,0x63,0x33,0x34,0x32,
+0x22,0x01,0x90,0xdb,0xcc,0xcb,0xcb,0xab,0xaa,0x8a,0x10,0x43,0x35,0x35,0x43,0x32,
+0x12,0x11,0x98,0xca,0xbd,0xcc,0xbb,0xbb,0xab,0x9a,0x10,0x44,0x44,0x43,0x24,0x23,
+0x22,0x01,0x98,0xca,0xcc,0xdb,0xbb,0xbb,0xba,0x99,0x18,0x53,0x54,0x43,0x33,0x32,
+0x23,0x11,0x98,0xda,0xcc,0xbc,0xbc,0xba,0xab,0x89,0x18,0x42,0x45,0x43,0x24,0x23,
+0x12,0x11,0x88,0xba,0xce,0xcb,0xac,0xab,0x9b,0x8a,0x18,0x42,0x54,0x33,0x34,0x33,
+0x23,0x12,0x98,0xcb,0xcd,0xbc,0xbc,0xbb,0xba,0x99,0x18,0x43,0x45,0x53,0x23,0x33,
+0x23,0x11,0x90,0xca,0xdc,0xcb,0xcb,0xba,0x9a,0x8a,0x18,0x42,0x54,0x43,0x33,0x33,
+0x22,0x01,0xb9,0xdc,0xbc,0xbd,0xba,0xab,0x8a,0x20,0x44,0x44,0x33,0x24,0x13,0x11,
+0x98,0xca,0xbd,0xbd,0xbb,0xab,0x9a,0x18,0x53,0x44,0x34,0x33,0x32,0x12,0x88,0xca,
+0xcc,0xcc,0xbb,0xbb,0x9a,0x08,0x42,0x44,0x34,0x43,0x32,0x21,0x80,0xb8,0xdc,0xbc,
+0xcb,0xab,0xaa,0x09,0x21,0x54,0x34,0x43,0x23,0x22,0x00,0xa8,0xeb,0xbc,0xbc,0xac,
+0x9a,0x89,0x10,0x53,0x34,0x34,0x24,0x12,0x01,0x90,0xcb,0xcc,0xcb,0xbb,0xab,0x9a,
+0x10,0x53,0x44,0x43,0x33,0x23,0x12,0x90,0xda,0xbc,0xbd,0xac,0xba,0x99,0x08,0x41,
+0x53,0x34,0x43,0x32,0x11,0x81,0xb9,0xdc,0xdb,0xba,0xbb,0xaa,0x89,0x22,0x55,0x43,
+0x33,0x24,0x12,0x00,0xa8,0xbc,0xbe,0xcb,0xab,0x9b,0x99,0x11,0x44,0x44,0x43,0x32,
+0x12,0x01,0x98,0xcb,0xdc,0xcb,0xba,0xab,0x89,0x28,0x43,0x35,0x25,0x33,0x23,0x12,
+0x88,0xcb,0xcd,0xcb,0xcb,0xaa,0x99,0x18,0x31,0x45,0x43,0x33,0x24,0x11,0x80,0xa9,
+0xcc,0xcc,0xbb,0xab,0x9b,0x09,0x31,0x45,0x44,0x33,0x23,0x13,0x01,0xa9,0xbd,0xbe,
+0xcb,0xbb,0xaa,0x89,0x21,0x44,0x44,0x43,0x32,0x12,0x01,0xa0,0xda,0xbc,0xcc,0xba,
+0xaa,0x99,0x10,0x43,0x35,0x25,0x33,0x23,0x12,0x98,0xda,0xcc,0xcb,0xbb,0xba,0x9a,
+0x19,0x42,0x45,0x43,0x33,0x33,0x12,0x80,0xba,0xce,0xbc,0xcb,0xab,0x9a,0x08,0x21,
+0x45,0x53,0x23,0x33,0x22,0x00,0xa9,0xcd,0xcc,0xab,0xac,0xa9,0x09,0x20,0x53,0x34,
+0x34,0x33,0x22,0x01,0xa0,0xcc,0xbd,0xbc,0xac,0x9a,0x89,0x28,0x52,0x53,0x43,0x32,
+0x22,0x11,0x90,0xca,0xcc,0xbc,0xcb,0xaa,0x8a,0x08,0x42,0x44,0x43,0x33,0x23,0x12,
+0x80,0xca,0xdc,0xcb,0xbb,0xac,0x9a,0x08,0x31,0x35,0x35,0x24,0x23,0x12,0x00,0xa9,
+0xcc,0xbd,0xcb,0xbb,0xaa,0x89,0x21,0x45,0x43,0x34,0x32,0x22,0x01,0x99,0xcc,0xcc,
+0xbb,0xac,0xab,0x99,0x20,0x53,0x44,0x43,0x32,0x22,0x01,0x90,0xca,0xbd,0xcc,0xab,
+0xab,0x9a,0x18,0x43,0x54,0x33,0x34,0x32,0x11,0x80,0xca,0xcc,0xbc,0xbb,0xac,0x9a,
+0x88,0x32,0x45,0x34,0x43,0x32,0x21,0x00,0xa9,0xbd,0xcd,0xbb,0xab,0x9b,0x89,0x21,
+0x45,0x44,0x32,0x33,0x13,0x11,0x99,0xdc,0xbc,0xbc,0xbb,0xab,0x8a,0x20,0x44,0x35,
+0x34,0x24,0x12,0x11,0x98,0xca,0xcc,0xcb,0xbb,0xab,0x9a,0x18,0x43,0x45,0x34,0x42,
+0x12,0x02,0x80,0xba,0xdc,0xcb,0xbb,0xbb,0xaa,0x08,0x42,0x45,0x34,0x33,0x33,0x11,
+0xa8,0xcc,0xcc,0xcb,0xba,0x9a,0x08,0x41,0x53,0x34,0x33,0x32,0x01,0xa8,0xdc,0xdb,
+0xbb,0xbb,0x9b,0x18,0x53,0x44,0x43,0x23,0x22,0x81,0xb8,0xdc,0xcb,0xac,0xab,0x89,
+0x28,0x52,0x53,0x33,0x33,0x23,0x80,0xca,0xdc,0xcb,0xba,0xab,0x8a,0x21,0x44,0x44,
+0x33,0x23,0x13,0x90,0xcb,0xbd,0xbd,0xbb,0xab,0x09,0x31,0x45,0x34,0x34,0x22,0x02,
+0xa0,0xda,0xdb,0xcb,0xba,0xaa,0x08,0x41,0x53,0x24,0x24,0x12,0x01,0xa0,0xda,0xdb,
+0xbb,0xbb,0xaa,0x18,0x42,0x35,0x25,0x24,0x21,0x81,0xa8,0xdb,0xbc,0xac,0xab,0x9a,
+0x00,0x53,0x53,0x43,0x32,0x12,0x00,0xaa,0xbd,0xbd,0xbc,0xaa,0x8a,0x10,0x53,0x34,
+0x25,0x23,0x12,0x80,0xba,0xdc,0xcb,0xbb,0xbb,0x89,0x31,0x54,0x34,0x34,0x23,0x12,
+0x98,0xca,0xcc,0xbc,0xbb,0x9b,0x89,0x32,0x45,0x34,0x24,0x13,0x02,0x98,0xcb,0xbd,
+0xcc,0xaa,0x9a,0x09,0x32,0x45,0x43,0x32,0x13,0x02,0xa9,0xcc,0xbc,0xad,0xab,0x8a,
+0x18,0x42,0x44,0x33,0x34,0x22,0x00,0xb9,0xcc,0xbd,0xbb,0xbb,0x9a,0x10,0x44,0x35,
+0x34,0x23,0x13,0x80,0xba,0xbe,0xbd,0xbb,0xab,0x8a,0x30,0x54,0x34,0x34,0x32,0x02,
+0x80,0xbb,0xce,0xcb,0xab,0xab,0x88,0x31,0x45,0x43,0x43,0x22,0x01,0x90,0xcb,0xbc,
+0xbd,0xab,0xab,0x08,0x32,0x36,0x35,0x33,0x23,0x11,0xa8,0xcc,0xbd,0xbc,0xba,0x9a,
+0x18,0x42,0x44,0x34,0x23,0x23,0x01,0xa9,0xcd,0xbc,0xcb,0xab,0x8a,0x18,0x43,0x35,
+0x44,0x22,0x12,0x00,0xaa,0xcc,0xbc,0xac,0xab,0x89,0x10,0x34,0x35,0x25,0x23,0x12,
+0x90,0xba,0xcd,0xcb,0xac,0x9a,0x89,0x20,0x44,0x43,0x43,0x22,0x11,0x88,0xbb,0xcd,
+0xbc,0xbb,0xab,0x88,0x32,0x55,0x43,0x32,0x23,0x02,0x98,0xcc,0xdb,0xac,0xab,0xaa,
+0x08,0x42,0x63,0x33,0x43,0x22,0x01,0x99,0xcc,0xdb,0xbb,0xbb,0x9a,0x18,0x52,0x44,
+0x43,0x23,0x13,0x81,0xa9,0xdc,0xcb,0xcb,0xaa,0x8a,0x10,0x43,0x35,0x34,0x32,0x22,
+0x80,0xba,0xbe,0xbd,0xbb,0xab,0x8a,0x30,0x45,0x53,0x33,0x23,0x12,0x90,0xca,0xdc,
+0xcb,0xab,0xab,0x08,0x21,0x45,0x43,0x33,0x33,0x02,0xa0,0xeb,0xbc,0xbc,0xac,0x9a,
+0x08,0x31,0x54,0x33,0x34,0x22,0x02,0x99,0xcc,0xbc,0xcc,0xaa,0x8a,0x08,0x32,0x35,
+0x35,0x33,0x22,0x01,0xb9,0xdc,0xbc,0xbc,0xab,0x9a,0x10,0x53,0x34,0x25,0x33,0x12,
+0x81,0xb9,0xdc,0xcb,0xcb,0xaa,0x89,0x21,0x63,0x43,0x33,0x33,0x01,0xa9,0xcd,0xdb,
+0xab,0xab,0x88,0x31,0x45,0x43,0x33,0x12,0x81,0xca,0xcc,0xcb,0xbb,0x9a,0x18,0x43,
+0x44,0x24,0x23,0x02,0x90,0xcb,0xbd,0xbc,0xbb,0x8a,0x21,0x44,0x34,0x34,0x22,0x01,
+0xa8,0xbd,0xbd,0xcb,0xaa,0x88,0x22,0x45,0x33,0x24,0x12,0x80,0xb9,0xcd,0xbc,0xab,
+0x9a,0x18,0x43,0x35,0x34,0x23,0x02,0xa0,0xdb,0xcc,0xbb,0xab,0x8a,0x20,0x45,0x43,
+0x24,0x22,0x00,0xa9,0xeb,0xcb,0xbb,0xaa,0x09,0x41,0x44,0x43,0x33,0x12,0x90,0xba,
+0xce,0xbb,0xbb,0x9b,0x28,0x53,0x35,0x34,0x32,0x11,0xa8,0xdb,0xcc,0xbb,0xbb,0x89,
+0x30,0x54,0x34,0x33,0x23,0x82,0xb9,0xce,0xcb,0xab,0x9b,0x09,0x42,0x44,0x43,0x23,
+0x12,0x80,0xca,0xcc,0xac,0xab,0x9a,0x10,0x52,0x34,0x34,0x22,0x02,0xa0,0xeb,0xdb,
+0xbb,0xaa,0x89,0x21,0x44,0x34,0x34,0x12,0x01,0xb9,0xdc,0xcb,0xbb,0xaa,0x08,0x42,
+0x44,0x43,0x23,0x12,0x90,0xca,0xcc,0xac,0xbb,0x99,0x10,0x53,0x34,0x34,0x32,0x11,
+0x99,0xcc,0xcc,0xba,0xab,0x09,0x30,0x54,0x43,0x33,0x22,0x00,0xba,0xdc,0xbc,0xbb,
+0xab,0x08,0x53,0x34,0x44,0x22,0x02,0x80,0xca,0xbc,0xcc,0xaa,0x99,0x10,0x53,0x53,
+0x32,0x23,0x01,0xa8,0xcc,0xbc,0xbc,0xaa,0x89,0x31,0x54,0x43,0x33,0x12,0x81,0xc9,
+0xdb,0xbc,0xbb,0x9b,0x19,0x52,0x34,0x25,0x23,0x12,0x98,0xda,0xdb,0xbb,0xbb,0x9a,
+0x20,0x44,0x35,0x33,0x33,0x01,0xb8,0xdc,0xcc,0xba,0x9b,0x89,0x31,0x35,0x35,0x33,
+0x23,0x80,0xca,0xdc,0xbb,0xac,0xaa,0x00,0x42,0x44,0x33,0x24,0x11,0x88,0xcb,0xbc,
+0xad,0xab,0x89,0x11,0x44,0x43,0x43,0x22,0x01,0xb8,0xeb,0xcb,0xbb,0xab,0x09,0x41,
+0x44,0x43,0x32,0x12,0x80,0xb9,0xbe,0xcc,0xba,0x9a,0x18,0x42,0x44,0x33,0x33,0x12,
+0xa0,0xeb,0xbc,0xbc,0xab,0x8a,0x20,0x54,0x43,0x33,0x22,0x01,0xa9,0xcd,0xdb,0xab,
+0x9b,0x09,0x41,0x53,0x24,0x33,0x12,0x80,0xc9,0xcc,0xac,0xbb,0x9a,0x00,0x53,0x53,
+0x33,0x14,0x02,0x98,0xca,0xcc,0xbb,0x9c,0x8a,0x20,0x53,0x34,0x43,0x12,0x01,0xa9,
+0xcc,0xdb,0xba,0xaa,0x08,0x31,0x45,0x43,0x33,0x12,0x90,0xca,0xcc,0xcb,0xba,0x99,
+0x18,0x43,0x44,0x24,0x23,0x01,0xa0,0xdb,0xbc,0xac,0xab,0x89,0x21,0x63,0x34,0x33,
+0x23,0x01,0xb9,0xbe,0xbd,0xbb,0xab,0x19,0x51,0x53,0x43,0x23,0x12,0x80,0xda,0xdb,
+0xbb,0xbb,0x9a,0x88,0x00,0x88,0x98,0x08,0x18,0x00,0x00,0x08,0x10,0x11,0x01,0x10,
+0x11,0x32,0x34,0x33,0x23,0x33,0x33,0x35,0x33,0x34,0x33,0x34,0x44,0x43,0x33,0x23,
+0x22,0x22,0x64,0x43,0x23,0x02,0x88,0x00,0x43,0x35,0x23,0x23,0x11,0xa9,0xcb,0x18,
+0x57,0x24,0x02,0x88,0x19,0x53,0x33,0x03,0xa8,0x8a,0x0a,0x0a,0x3a,0x66,0x35,0x12,
+0x90,0xaa,0x09,0x10,0x90,0xb9,0x88,0x12,0x00,0x20,0x77,0x27,0x12,0x80,0x9a,0x09,
+0x10,0x02,0x13,0x33,0x18,0xbf,0x9c,0x30,0x47,0x23,0x11,0x88,0x08,0x11,0x01,0x11,
+0x55,0x45,0x13,0xa1,0xda,0x99,0x42,0x44,0x11,0x88,0x08,0x43,0x34,0x12,0x08,0x41,
+0x44,0x22,0x88,0x08,0x63,0x44,0x32,0x33,0x25,0x24,0x01,0x98,0x19,0x62,0x53,0x22,
+0x21,0x21,0x34,0x34,0x12,0x90,0x08,0x51,0x73,0x32,0x23,0x23,0x33,0x34,0x34,0x22,
+0x01,0x88,0x40,0x55,0x25,0x13,0x81,0x88,0x31,0x35,0x13,0x98,0x8a,0x52,0x25,0x03,
+0x08,0x51,0x45,0x23,0x81,0xca,0x99,0x31,0x35,0x23,0x80,0x88,0x88,0xa0,0xc9,0x89,
+0x63,0x35,0x24,0x01,0x88,0x10,0x12,0x82,0xb9,0xcb,0xa8,0xa2,0xa0,0x89,0x31,0x43,
+0x91,0xb9,0x10,0x14,0xb2,0xea,0xba,0x9b,0x1b,0x31,0x37,0x17,0x13,0x80,0xba,0xba,
+0x81,0x25,0x99,0xff,0xbd,0xab,0x88,0x12,0x12,0x81,0x88,0x10,0x00,0x8a,0x8e,0x9a,
+0x90,0x12,0x30,0x2b,0x9f,0x0c,0x58,0x32,0x02,0xab,0x1c,0x52,0x03,0xf9,0xba,0x35,
+0x47,0x22,0x80,0x99,0x89,0x80,0x90,0x09,0x73,0x35,0x33,0x00,0xaa,0x0a,0x51,0x54,
+0x43,0x22,0x81,0xaa,0x8a,0x71,0x43,0x12,0x88,0x09,0x62,0x34,0x23,0x98,0xbb,0x8a,
+0x53,0x35,0x23,0x01,0x89,0x19,0x62,0x44,0x23,0x12,0x99,0x9b,0x1a,0x54,0x35,0x14,
+0x11,0x99,0x99,0x08,0x21,0x82,0x99,0x9b,0x29,0x52,0x11,0x08,0x59,0x61,0x01,0xc9,
+0xca,0x09,0x38,0x01,0x99,0x8d,0x19,0x30,0x2a,0x0d,0x0b,0x3a,0x59,0x61,0x21,0xcb,
+0xef,0xcb,0x8a,0x18,0x21,0x91,0xb9,0x9b,0x20,0x14,0xc0,0xce,0xbc,0xab,0x98,0x90,
+0x99,0x10,0x33,0xb1,0xff,0xbc,0xa9,0x00,0x02,0x98,0x9a,0x28,0x44,0x81,0xfb,0xcc,
+0xaa,0x88,0x00,0x10,0x09,0x19,0x89,0x00,0x11,0x43,0x13,0x13,0x21,0x0c,0xdb,0xd0,
+0x91,0x01,0x32,0x73,0x33,0x92,0xfb,0xbd,0x80,0x23,0x13,0xda,0x8a,0x65,0x44,0x13,
+0x90,0xa9,0x89,0x22,0x12,0xa8,0x9b,0x0a,0x0a,0x1a,0x77,0x45,0x23,0x90,0x9c,0x72,
+0x77,0x44,0x32,0x23,0x32,0x22,0x43,0x32,0x53,0x43,0x34,0x34,0x33,0x43,0x43,0x33,
+0x23,0x12,0x12,0x32,0x43,0x43,0x33,0x34,0x33,0x23,0x33,0x53,0x43,0x43,0x33,0x24,
+0x23,0x81,0xcb,0xbc,0xab,0x08,0x52,0x43,0x33,0x81,0xc9,0xbc,0xaa,0x9a,0xa9,0xdc,
+0xcc,0xcb,0xcc,0xcb,0xbb,0xac,0x99,0x99,0xa9,0xbc,0xcd,0xcb,0xba,0xac,0xbb,0xdb,
+0xba,0xcb,0xbb,0xbd,0xbc,0xab,0xbb,0xba,0xbc,0xcd,0xcb,0xbb,0xcb,0xcb,0xdb,0xcb,
+0xbb,0xaa,0x99,0xa9,0xba,0xba,0xab,0xbb,0xdc,0xbb,0xac,0xcb,0xcb,0xba,0xab,0xbb,
+0xcb,0xab,0x09,0x53,0x22,0xc8,0xdc,0xcb,0x9a,0x99,0x99,0x00,0x20,0x22,0x80,0x99,
+0x30,0x77,0x35,0x34,0x23,0x12,0x11,0x00,0x20,0x31,0x35,0x45,0x43,0x33,0x34,0x43,
+0x43,0x33,0x24,0x21,0x22,0x33,0x34,0x33,0x53,0x35,0x45,0x43,0x32,0x23,0x24,0x34,
+0x23,0x23,0x11,0x11,0x22,0x43,0x24,0x43,0x32,0x32,0x22,0x23,0x34,0x34,0x34,0x22,
+0x22,0x02,0x90,0xdc,0xcb,0x9a,0x31,0x45,0x22,0x81,0xa9,0xbb,0xcb,0xbb,0xab,0x9a,
+0xca,0xef,0xdc,0xbc,0xab,0x9a,0x00,0x80,0xb8,0xdb,0xcc,0xca,0xca,0xaa,0xab,0xba,
+0xca,0xdb,0xdb,0xab,0xac,0xaa,0x99,0xaa,0xcb,0xbd,0xbc,0xbb,0xbc,0xeb,0xcb,0xbc,
+0xbb,0xaa,0x99,0x98,0xaa,0xcb,0xbb,0xa9,0x98,0xca,0xdc,0xcb,0xab,0x99,0xaa,0xbc,
+0xbc,0x0a,0x41,0x34,0x22,0xa8,0xcc,0xac,0xab,0x8a,0x08,0x00,0x21,0x32,0x53,0x22,
+0x21,0x64,0x46,0x35,0x33,0x22,0x80,0x88,0x00,0x32,0x34,0x44,0x33,0x45,0x43,0x43,
+0x32,0x22,0x21,0x31,0x34,0x34,0x23,0x22,0x53,0x55,0x34,0x44,0x22,0x32,0x32,0x25,
+0x24,0x22,0x12,0x11,0x11,0x22,0x24,0x32,0x23,0x23,0x12,0x01,0x80,0x10,0x73,0x44,
+0x13,0x91,0xdc,0xcb,0x9a,0x09,0x10,0x21,0x22,0x12,0xb9,0xce,0xcb,0xaa,0x99,0xbb,
+0xcd,0xcc,0xcb,0xbc,0xbc,0xbb,0xaa,0x88,0x00,0xb9,0xdd,0xbc,0xac,0xab,0xab,0xbb,
+0xcd,0xbb,0xbc,0xbc,0xbb,0xbc,0xaa,0x9a,0xaa,0xcd,0xcc,0xcb,0xbb,0xbc,0xbc,0xbc,
+0xac,0xab,0xaa,0x99,0x98,0x98,0x99,0x9a,0xb9,0xdb,0xcb,0xac,0xaa,0xa9,0xa9,0xcb,
+0xab,0x19,0x64,0x44,0x32,0x01,0x98,0xba,0xab,0xaa,0x00,0x44,0x54,0x33,0x23,0x21,
+0x51,0x55,0x44,0x34,0x43,0x12,0x01,0x08,0x10,0x32,0x34,0x43,0x32,0x44,0x34,0x34,
+0x24,0x23,0x33,0x33,0x33,0x32,0x33,0x44,0x33,0x34,0x46,0x54,0x53,0x33,0x33,0x43,
+0x32,0x24,0x43,0x32,0x24,0x22,0x22,0x11,0x81,0x80,0x89,0x80,0x80,0xdb,0xcf,0xbc,
+0xcc,0xba,0xbb,0xbc,0xcc,0xcb,0xcb,0xcb,0xbb,0xac,0xcb,0xcb,0xcb,0xbc,0xcb,0xba,
+0xbb,0xba,0xbb,0xbc,0xcb,0xab,0x9b,0xaa,0xa9,0xba,0xcb,0xaa,0x89,0x21,0x54,0x45,
+0x43,0x33,0x43,0x43,0x34,0x44,0x43,0x33,0x33,0x34,0x34,0x53,0x53,0x42,0x22,0x33,
+0x33,0x33,0x34,0x33,0x43,0x23,0x24,0x32,0x32,0x23,0x43,0x22,0x23,0x22,0x01,0xb9,
+0xdc,0xbb,0xac,0xaa,0xcb,0xdd,0xdb,0xbb,0xbc,0xba,0xbc,0xbc,0xbd,0xbc,0xbc,0xcb,
+0xaa,0xab,0xba,0xbc,0xcb,0xac,0xaa,0x9a,0xaa,0xaa,0xba,0xbb,0xbc,0xaa,0x10,0x53,
+0x43,0x43,0x22,0x33,0x35,0x35,0x45,0x42,0x22,0x23,0x33,0x45,0x53,0x33,0x43,0x32,
+0x33,0x33,0x33,0x34,0x43,0x33,0x32,0x22,0x11,0x01,0x01,0x12,0x01,0xb8,0xed,0xcc,
+0xcc,0xbb,0xcb,0xbb,0xcc,0xdb,0xcb,0xac,0xbb,0xbb,0xbc,0xbc,0xcc,0xcb,0xbb,0xbc,
+0xba,0xba,0xab,0xcb,0xcb,0xbb,0xbb,0xaa,0xaa,0xaa,0xbb,0xbb,0xaa,0x89,0x42,0x56,
+0x44,0x33,0x43,0x32,0x34,0x45,0x43,0x33,0x33,0x43,0x34,0x44,0x43,0x43,0x33,0x33,
+0x24,0x33,0x32,0x34,0x33,0x34,0x33,0x32,0x32,0x33,0x34,0x24,0x22,0x12,0x00,0xa9,
+0xeb,0xbb,0xbc,0xcb,0xcb,0xbc,0xbd,0xbc,0xbc,0xcb,0xbb,0xbc,0xcc,0xbc,0xbc,0xbb,
+0xcb,0xaa,0xba,0xca,0xbb,0xbc,0xab,0xab,0x9a,0xa9,0xb9,0xbc,0xbb,0x99,0x28,0x63,
+0x35,0x35,0x32,0x33,0x43,0x35,0x36,0x43,0x33,0x32,0x43,0x34,0x35,0x34,0x34,0x32,
+0x32,0x32,0x43,0x33,0x33,0x24,0x22,0x32,0x12,0x11,0x18,0x10,0x12,0xb8,0xed,0xcc,
+0xbc,0xbc,0xbb,0xbc,0xcb,0xbc,0xbd,0xbc,0xcb,0xbb,0xcb,0xbc,0xcb,0xbc,0xbc,0xcb,
+0xab,0xab,0xba,0xca,0xbb,0xbc,0xbb,0xab,0x9a,0xab,0xac,0xbb,0xab,0x8a,0x30,0x55,
+0x34,0x34,0x33,0x43,0x34,0x45,0x43,0x33,0x43,0x33,0x53,0x53,0x33,0x25,0x43,0x22,
+0x33,0x32,0x24,0x33,0x24,0x33,0x33,0x32,0x33,0x32,0x34,0x33,0x34,0x13,0x80,0xbb,
+0xae,0xab,0xbb,0xcc,0xcc,0xbc,0xcb,0xdb,0xbb,0xbc,0xbc,0xac,0xcb,0xbc,0xbc,0xbc,
+0xab,0xbb,0xba,0xcb,0xbb,0xbc,0xba,0xbb,0xab,0xab,0xcb,0xba,0xaa,0x99,0x20,0x54,
+0x54,0x43,0x33,0x32,0x43,0x44,0x44,0x43,0x22,0x23,0x43,0x34,0x44,0x43,0x32,0x24,
+0x23,0x22,0x23,0x43,0x33,0x43,0x22,0x12,0x11,0x12,0x23,0x22,0xa0,0xdc,0xdc,0xbb,
+0xcc,0xcb,0xcc,0xcb,0xcb,0xcb,0xdb,0xca,0xba,0xba,0xbb,0xcb,0xab,0xcb,0xaa,0xba,
+0xba,0xaa,0x89,0x21,0x43,0x44,0x43,0x35,0x34,0x43,0x43,0x44,0x43,0x33,0x23,0x33,
+0x34,0x33,0x24,0x12,0x22,0x22,0x22,0x01,0xa9,0xcb,0xcb,0xcc,0xcc,0xbc,0xcb,0xcb,
+0xdb,0xcb,0xbb,0xcb,0xbb,0xbb,0xcb,0xab,0xba,0xaa,0xbb,0xab,0x0a,0x31,0x36,0x34,
+0x44,0x53,0x43,0x43,0x33,0x44,0x43,0x34,0x42,0x22,0x32,0x32,0x24,0x23,0x12,0x22,
+0x22,0x22,0x00,0xa9,0xbb,0xcc,0xcc,0xbd,0xcc,0xab,0xbc,0xdb,0xbc,0xcb,0xbb,0xbb,
+0xcb,0xba,0xac,0xaa,0xb9,0xaa,0xaa,0x0a,0x20,0x53,0x43,0x53,0x53,0x43,0x43,0x33,
+0x44,0x34,0x43,0x33,0x23,0x43,0x32,0x24,0x22,0x11,0x12,0x21,0x00,0xb9,0xcb,0xbc,
+0xdb,0xbc,0xcd,0xbb,0xbc,0xbc,0xcc,0xcb,0xca,0xaa,0xab,0xbb,0xbc,0xaa,0xab,0xba,
+0xbb,0x9b,0x19,0x32,0x34,0x34,0x35,0x45,0x43,0x33,0x44,0x43,0x34,0x34,0x32,0x23,
+0x43,0x33,0x33,0x22,0x22,0x32,0x23,0x81,0xba,0xbc,0xcb,0xcc,0xcd,0xbc,0xcb,0xbb,
+0xbd,0xcc,0xcb,0xba,0xbb,0xbb,0xbc,0xbb,0xba,0xba,0xba,0xbb,0x9a,0x20,0x44,0x44,
+0x43,0x44,0x33,0x34,0x34,0x35,0x53,0x43,0x32,0x33,0x33,0x43,0x33,0x33,0x33,0x33,
+0x32,0x13,0x81,0xb9,0xbc,0xbc,0xcd,0xcc,0xcb,0xbb,0xcc,0xbc,0xbc,0xbc,0xbb,0xac,
+0xcb,0xaa,0xab,0xaa,0xaa,0xbb,0xab,0x09,0x20,0x43,0x34,0x44,0x54,0x43,0x33,0x34,
+0x53,0x43,0x34,0x32,0x33,0x24,0x33,0x24,0x12,0x21,0x21,0x22,0x02,0xa8,0xbc,0xcb,
+0xcb,0xbd,0xbd,0xcc,0xba,0xcc,0xbb,0xbd,0xcb,0xba,0xba,0xbb,0xac,0xbb,0xaa,0xba,
+0xbb,0xab,0x09,0x43,0x53,0x42,0x43,0x44,0x43,0x43,0x42,0x43,0x43,0x43,0x23,0x33,
+0x43,0x42,0x22,0x12,0x12,0x22,0x22,0x81,0xa9,0xcb,0xcb,0xdb,0xcc,0xbc,0xcb,0xbb,
+0xcc,0xcc,0xbb,0xbb,0xac,0xcb,0xba,0xab,0xbb,0xab,0xcb,0xaa,0x89,0x20,0x32,0x53,
+0x53,0x34,0x35,0x34,0x43,0x43,0x34,0x44,0x32,0x33,0x33,0x34,0x33,0x23,0x23,0x23,
+0x33,0x23,0x81,0xa8,0xcb,0xbc,0xcd,0xcc,0xcb,0xcb,0xbb,0xbd,0xbd,0xcb,0xbb,0xbb,
+0xcb,0xcb,0xaa,0xab,0xa9,0xab,0xaa,0x89,0x21,0x34,0x44,0x43,0x34,0x35,0x53,0x33,
+0x34,0x44,0x43,0x32,0x33,0x33,0x24,0x33,0x33,0x22,0x32,0x24,0x11,0xa8,0xba,0xac,
+0xcb,0xcd,0xcc,0xcb,0xba,0xbc,0xcd,0xcb,0xbb,0xac,0xbb,0xba,0xac,0xba,0x9a,0x99,
+0x10,0x31,0x44,0x34,0x35,0x44,0x43,0x43,0x33,0x43,0x23,0x33,0x33,0x22,0x22,0x01,
+0x90,0xcb,0xcc,0xbc,0xcc,0xdb,0xcb,0xcb,0xcb,0xba,0xbb,0xcb,0xaa,0xab,0xa9,0x99,
+0x00,0x32,0x44,0x44,0x43,0x53,0x43,0x34,0x33,0x34,0x23,0x33,0x33,0x33,0x22,0x11,
+0x98,0xca,0xdb,0xbc,0xcc,0xbc,0xcc,0xcb,0xcb,0xba,0xbb,0xca,0xaa,0xaa,0x9a,0x99,
+0x10,0x41,0x53,0x34,0x34,0x44,0x43,0x43,0x43,0x32,0x33,0x33,0x33,0x33,0x32,0x11,
+0x98,0xba,0xcd,0xcb,0xcc,0xdb,0xdb,0xbb,0xbc,0xbb,0xac,0xbb,0xbb,0xab,0xab,0x8a,
+0x08,0x42,0x44,0x43,0x34,0x35,0x34,0x34,0x34,0x33,0x24,0x23,0x23,0x23,0x12,0x01,
+0x88,0xb9,0xcc,0xcc,0xbc,0xbd,0xbc,0xad,0xcb,0xba,0xbb,0xac,0xab,0xab,0xab,0x99,
+0x18,0x21,0x34,0x36,0x44,0x53,0x33,0x44,0x33,0x33,0x24,0x33,0x32,0x23,0x23,0x11,
+0x90,0xba,0xcc,0xbc,0xcd,0xdb,0xcb,0xcb,0xcb,0xab,0xbb,0xbb,0xac,0xba,0xaa,0x9a,
+0x08,0x21,0x35,0x44,0x53,0x43,0x43,0x34,0x34,0x33,0x33,0x33,0x24,0x23,0x22,0x11,
+0x90,0xa9,0xcc,0xdb,0xcb,0xcc,0xbc,0xdb,0xbb,0xbb,0xcb,0xbb,0xbb,0xbb,0xba,0x99,
+0x08,0x32,0x45,0x44,0x43,0x34,0x44,0x33,0x25,0x33,0x23,0x24,0x22,0x32,0x12,0x11,
+0x80,0xb9,0xdb,0xcb,0xcc,0xbc,0xcc,0xcb,0xbb,0xcb,0xab,0xac,0xab,0xba,0x9a,0x8a,
+0x08,0x31,0x54,0x43,0x34,0x53,0x43,0x34,0x34,0x33,0x33,0x33,0x24,0x23,0x21,0x11,
+0x80,0xa8,0xcc,0xbc,0xbd,0xdb,0xdb,0xcb,0xcb,0xba,0xbb,0xbb,0xcb,0xab,0xaa,0x8a,
+0x08,0x21,0x43,0x35,0x35,0x44,0x34,0x53,0x32,0x24,0x23,0x32,0x23,0x23,0x13,0x12,
+0x88,0xa9,0xcc,0xbc,0xbd,0xbd,0xcc,0xac,0xac,0xab,0xbb,0xcb,0xba,0xbb,0xaa,0x99,
+0x88,0x31,0x63,0x43,0x34,0x53,0x34,0x44,0x33,0x43,0x32,0x23,0x23,0x33,0x23,0x11,
+0x80,0xb9,0xbc,0xcd,0xbc,0xcc,0xbc,0xcc,0xbb,0xbb,0xbc,0xbb,0xbb,0xbb,0xbb,0x9a,
+0x08,0x32,0x35,0x45,0x43,0x44,0x43,0x24,0x43,0x23,0x33,0x24,0x22,0x23,0x22,0x21,
+0x80,0x99,0xdb,0xcb,0xcc,0xcb,0xbc,0xbd,0xcb,0xbb,0xcb,0xba,0xba,0xba,0xab,0x9a,
+0x08,0x21,0x44,0x53,0x34,0x44,0x34,0x43,0x34,0x33,0x33,0x33,0x24,0x23,0x13,0x02,
+0x00,0xa9,0xcb,0xbd,0xbd,0xbd,0xbc,0xbd,0xcb,0xcb,0xba,0xba,0xba,0xbb,0xab,0xaa,
+0x09,0x30,0x44,0x35,0x45,0x43,0x34,0x34,0x33,0x33,0x24,0x23,0x12,0x01,0x90,0xaa,
+0xcc,0xbd,0xbd,0xbd,0xcb,0xba,0xbb,0xbb,0xbb,0xaa,0x88,0x11,0x34,0x36,0x44,0x34,
+0x34,0x43,0x33,0x33,0x24,0x12,0x02,0x00,0xa9,0xca,0xcc,0xdb,0xbc,0xbc,0xbc,0xbb,
+0xac,0xaa,0xab,0x9a,0x08,0x21,0x44,0x53,0x43,0x44,0x33,0x34,0x23,0x33,0x33,0x23,
+0x12,0x98,0xc9,0xcb,0xdc,0xdb,0xcb,0xac,0xbb,0xcb,0xaa,0xbb,0x9a,0x8a,0x10,0x32,
+0x45,0x53,0x34,0x44,0x32,0x24,0x32,0x22,0x32,0x21,0x10,0x98,0xca,0xdb,0xbc,0xbd,
+0xbd,0xcb,0xbb,0xba,0xbb,0xab,0xaa,0x09,0x20,0x44,0x44,0x53,0x43,0x34,0x43,0x32,
+0x23,0x23,0x23,0x12,0x00,0xa9,0xcc,0xdb,0xbc,0xbd,0xad,0xcb,0xaa,0xab,0xab,0xab,
+0x99,0x18,0x31,0x53,0x44,0x44,0x43,0x34,0x32,0x33,0x33,0x43,0x12,0x01,0x88,0xaa,
+0xdb,0xcc,0xcc,0xbc,0xbb,0xbc,0xbb,0xac,0xba,0xa9,0x89,0x00,0x32,0x45,0x53,0x43,
+0x34,0x34,0x43,0x22,0x23,0x22,0x11,0x01,0xa8,0xca,0xcc,0xdb,0xdb,0xbb,0xad,0xbb,
+0xac,0xaa,0xaa,0xa9,0x08,0x20,0x43,0x44,0x53,0x43,0x34,0x24,0x33,0x32,0x32,0x32,
+0x11,0x91,0xa9,0xdb,0xcc,0xeb,0xcb,0xac,0xbb,0xcb,0xba,0xab,0xab,0x99,0x10,0x32,
+0x44,0x44,0x34,0x35,0x43,0x33,0x33,0x33,0x33,0x23,0x12,0x88,0xca,0xcc,0xcc,0xdb,
+0xcb,0xcb,0xbb,0xba,0xac,0xaa,0xaa,0x88,0x10,0x43,0x53,0x34,0x35,0x34,0x34,0x33,
+0x33,0x33,0x23,0x23,0x00,0xa9,0xbd,0xcc,0xbc,0xcd,0xcb,0xbb,0xac,0xba,0xba,0xbb,
+0x9a,0x08,0x31,0x34,0x45,0x53,0x34,0x53,0x32,0x23,0x33,0x33,0x22,0x12,0x88,0xb9,
+0xbd,0xcd,0xcc,0xcb,0xcb,0xbb,0xac,0xba,0xaa,0xaa,0x89,0x18,0x32,0x45,0x53,0x53,
+0x33,0x25,0x33,0x43,0x22,0x22,0x22,0x00,0x88,0xba,0xbd,0xbd,0xcd,0xcb,0xbb,0xac,
+0xbb,0xba,0xbb,0xaa,0x09,0x20,0x43,0x35,0x35,0x35,0x34,0x34,0x33,0x33,0x43,0x12,
+0x12,0x80,0x99,0xca,0xdb,0xbd,0xbd,0xbc,0xbb,0xac,0xcb,0xaa,0x9b,0x8a,0x00,0x21,
+0x43,0x44,0x44,0x43,0x34,0x42,0x22,0x22,0x23,0x12,0x11,0x80,0xb9,0xeb,0xdb,0xdb,
+0xcb,0xcb,0xbb,0xcb,0xba,0xaa,0x9a,0x89,0x18,0x32,0x35,0x45,0x53,0x43,0x33,0x34,
+0x32,0x32,0x22,0x22,0x01,0x98,0xca,0xcc,0xbc,0xbd,0xbd,0xbb,0xbc,0xbb,0xbb,0xbb,
+0xaa,0x08,0x21,0x44,0x53,0x44,0x43,0x34,0x43,0x23,0x23,0x23,0x23,0x02,0x81,0xa9,
+0xcc,0xcd,0xcc,0xcb,0xbb,0xac,0xab,0xab,0x9a,0x08,0x21,0x63,0x53,0x34,0x34,0x43,
+0x32,0x22,0x12,0x12,0x80,0xba,0xdc,0xcc,0xcb,0xcb,0xbb,0xbb,0xbb,0xaa,0x89,0x10,
+0x43,0x36,0x35,0x34,0x34,0x33,0x33,0x23,0x12,0x80,0xa9,0xcc,0xcd,0xcb,0xcb,0xac,
+0xbb,0xab,0xab,0x8a,0x08,0x32,0x45,0x44,0x43,0x34,0x33,0x33,0x32,0x12,0x11,0x98,
+0xda,0xcc,0xbc,0xcc,0xbb,0xbc,0xba,0xab,0xa9,0x08,0x21,0x63,0x53,0x34,0x34,0x43,
+0x32,0x23,0x22,0x11,0x80,0xaa,0xbd,0xbe,0xbc,0xcc,0xba,0xbb,0xba,0x9a,0x89,0x00,
+0x43,0x45,0x53,0x33,0x25,0x33,0x33,0x22,0x21,0x00,0xa8,0xeb,0xbc,0xbd,0xbc,0xbc,
+0xbb,0xbb,0xab,0x9a,0x08,0x31,0x55,0x53,0x43,0x43,0x33,0x33,0x23,0x22,0x01,0x88,
+0xcb,0xdc,0xbc,0xbd,0xcb,0xab,0xac,0xaa,0x99,0x88,0x10,0x43,0x44,0x53,0x43,0x33,
+0x43,0x22,0x22,0x11,0x80,0xa9,0xdb,0xcc,0xbc,0xcc,0xba,0xbb,0xab,0xaa,0x88,0x28,
+0x42,0x54,0x53,0x43,0x33,0x24,0x32,0x12,0x12,0x81,0x98,0xcb,0xcd,0xdb,0xcb,0xbb,
+0xac,0xbb,0xaa,0x99,0x88,0x31,0x44,0x35,0x44,0x33,0x34,0x23,0x23,0x13,0x11,0x88,
+0xba,0xdd,0xbc,0xbd,0xcb,0xbb,0xbb,0xbb,0x9a,0x89,0x21,0x63,0x53,0x34,0x44,0x33,
+0x33,0x33,0x22,0x12,0x00,0xa9,0xcd,0xcc,0xcb,0xbc,0xcb,0xba,0xbb,0xaa,0x89,0x00,
+0x42,0x44,0x34,0x35,0x43,0x33,0x32,0x23,0x13,0x01,0xa8,0xda,0xcc,0xbc,0xbd,0xcb,
+0xba,0xbb,0xab,0x9a,0x08,0x21,0x35,0x36,0x34,0x44,0x32,0x33,0x23,0x13,0x11,0x90,
+0xc9,0xcc,0xbc,0xbd,0xbc,0xbb,0xac,0xba,0xa9,0x88,0x10,0x52,0x53,0x34,0x34,0x34,
+0x33,0x33,0x32,0x11,0x81,0xa9,0xdc,0xbc,0xbd,0xbc,0xbc,0xbb,0xbb,0xba,0x89,0x18,
+0x41,0x44,0x44,0x43,0x24,0x33,0x33,0x32,0x12,0x01,0x98,0xca,0xcd,0xbc,0xbd,0xbb,
+0xbc,0xbb,0xbb,0x9a,0x09,0x20,0x44,0x54,0x43,0x43,0x43,0x22,0x22,0x22,0x11,0x88,
+0xb9,0xcc,0xbd,0xbc,0xcc,0xba,0xbb,0xbb,0xaa,0x98,0x10,0x43,0x45,0x53,0x43,0x43,
+0x32,0x32,0x22,0x11,0x81,0xa8,0xdb,0xbc,0xcd,0xcb,0xcb,0xba,0xaa,0xaa,0x99,0x00,
+0x31,0x54,0x34,0x44,0x33,0x24,0x33,0x23,0x12,0x01,0x98,0xc9,0xcc,0xcc,0xcb,0xac,
+0xbb,0xbb,0xab,0xaa,0x09,0x20,0x63,0x44,0x34,0x53,0x32,0x33,0x33,0x22,0x11,0x80,
+0xba,0xdc,0xcc,0xdb,0xbb,0xbc,0xbb,0xba,0xaa,0x99,0x10,0x52,0x44,0x44,0x43,0x33,
+0x33,0x23,0x12,0x01,0xa9,0xcd,0xcc,0xbc,0xac,0xbb,0xab,0x9a,0x09,0x20,0x44,0x44,
+0x34,0x24,0x33,0x23,0x22,0x01,0x98,0xdb,0xcc,0xcb,0xbc,0xbb,0xbb,0xab,0x99,0x20,
+0x52,0x44,0x44,0x33,0x24,0x23,0x22,0x11,0x88,0xca,0xcc,0xbc,0xcc,0xba,0xbb,0xba,
+0x99,0x08,0x32,0x55,0x43,0x34,0x43,0x23,0x22,0x02,0x80,0xb8,0xeb,0xbc,0xbd,0xcb,
+0xbb,0xba,0xa9,0x88,0x21,0x54,0x53,0x43,0x33,0x43,0x22,0x12,0x01,0xa8,0xda,0xcc,
+0xcb,0xac,0xbb,0xbb,0xaa,0x8a,0x20,0x53,0x54,0x33,0x35,0x32,0x33,0x22,0x01,0x90,
+0xca,0xdc,0xdb,0xbb,0xac,0xbb,0xaa,0x9a,0x18,0x32,0x46,0x53,0x33,0x34,0x32,0x22,
+0x02,0x80,0xa9,0xcd,0xbc,0xbd,0xcb,0xab,0xba,0xa9,0x08,0x30,0x63,0x44,0x43,0x33,
+0x33,0x33,0x22,0x01,0xa9,0xdc,0xbc,0xbd,0xbc,0xbb,0xbb,0xaa,0x99,0x20,0x63,0x34,
+0x45,0x42,0x22,0x22,0x21,0x01,0x98,0xc9,0xbc,0xbd,0xbc,0xbc,0xab,0xab,0x89,0x08,
+0x42,0x44,0x34,0x35,0x32,0x33,0x23,0x12,0x80,0xca,0xcc,0xbc,0xbd,0xcb,0xab,0xab,
+0x9a,0x08,0x21,0x35,0x36,0x53,0x23,0x33,0x23,0x12,0x01,0xa9,0xcc,0xdc,0xcb,0xbb,
+0xac,0xab,0x9a,0x88,0x10,0x43,0x45,0x34,0x24,0x33,0x32,0x21,0x11,0x98,0xda,0xcc,
+0xdb,0xbb,0xac,0xbb,0xaa,0x99,0x10,0x52,0x53,0x34,0x34,0x43,0x22,0x22,0x11,0x90,
+0xb9,0xdc,0xbc,0xbc,0xbc,0xab,0xab,0x9a,0x08,0x32,0x45,0x44,0x43,0x33,0x33,0x23,
+0x22,0x00,0xb9,0xcd,0xcc,0xcb,0xac,0xbb,0xab,0xaa,0x88,0x21,0x63,0x53,0x34,0x33,
+0x34,0x22,0x22,0x01,0x98,0xdb,0xcc,0xbc,0xbc,0xbb,0xbb,0xab,0x9a,0x10,0x53,0x54,
+0x43,0x43,0x33,0x23,0x23,0x11,0x88,0xca,0xcc,0xcc,0xcb,0xbb,0xbb,0xab,0x9a,0x08,
+0x32,0x46,0x44,0x33,0x34,0x33,0x22,0x12,0x00,0xa9,0xcd,0xbc,0xbd,0xcb,0xab,0xbb,
+0xa9,0x88,0x21,0x44,0x44,0x43,0x43,0x33,0x32,0x21,0x00,0xa8,0xcb,0xcd,0xbc,0xbc,
+0xac,0xaa,0x9a,0x89,0x18,0x42,0x44,0x44,0x42,0x22,0x22,0x12,0x11,0x88,0xba,0xcd,
+0xbc,0xcc,0xba,0xbb,0xab,0x99,0x08,0x42,0x44,0x44,0x33,0x24,0x33,0x22,0x12,0x80,
+0xa9,0xcd,0xcc,0xcb,0xbb,0xcb,0xaa,0xa9,0x08,0x20,0x44,0x44,0x43,0x33,0x43,0x22,
+0x12,0x00,0xa8,0xdb,0xbc,0xbd,0xbc,0xbb,0xbb,0xaa,0x89,0x10,0x44,0x44,0x34,0x34,
+0x43,0x22,0x21,0x00,0x90,0xba,0xdc,0xbc,0xad,0xcb,0xaa,0x9a,0x89,0x21,0x53,0x44,
+0x43,0x33,0x32,0x12,0x01,0x99,0xcc,0xcc,0xcb,0xac,0xba,0xa9,0x88,0x10,0x53,0x44,
+0x43,0x33,0x23,0x22,0x00,0x98,0xcc,0xcc,0xbc,0xbb,0xbb,0xab,0x8a,0x21,0x54,0x44,
+0x43,0x32,0x33,0x12,0x01,0x98,0xcc,0xcc,0xbc,0xbb,0xac,0x9a,0x89,0x10,0x53,0x44,
+0x43,0x33,0x32,0x22,0x01,0x98,0xcc,0xcc,0xdb,0xba,0xbb,0xaa,0x89,0x11,0x44,0x34,
+0x35,0x33,0x24,0x12,0x01,0x98,0xcb,0xbd,0xbd,0xbb,0xac,0xaa,0x89,0x20,0x53,0x44,
+0x43,0x32,0x33,0x22,0x01,0x98,0xeb,0xdb,0xcb,0xcb,0xba,0x9a,0x89,0x10,0x53,0x34,
+0x35,0x33,0x43,0x12,0x81,0xa0,0xca,0xbd,0xcc,0xbb,0xbb,0x9b,0x8a,0x20,0x63,0x34,
+0x35,0x33,0x33,0x32,0x01,0x98,0xcc,0xbd,0xbd,0xbb,0xac,0xaa,0x89,0x10,0x43,0x45,
+0x33,0x34,0x33,0x22,0x01,0xa8,0xdb,0xbd,0xcc,0xbb,0xbb,0xaa,0x8a,0x10,0x53,0x54,
+0x43,0x33,0x33,0x22,0x11,0x98,0xdb,0xcc,0xbc,0xbc,0xba,0xaa,0x89,0x10,0x53,0x44,
+0x34,0x43,0x22,0x22,0x10,0x98,0xcb,0xcc,0xcc,0xba,0xab,0x9b,0x8a,0x18,0x53,0x44,
+0x53,0x32,0x23,0x13,0x02,0x98,0xda,0xcc,0xcb,0xac,0xab,0xab,0x89,0x10,0x52,0x44,
+0x43,0x33,0x23,0x23,0x11,0x98,0xda,0xdc,0xcb,0xbb,0xbb,0xab,0x9a,0x10,0x44,0x44,
+0x34,0x33,0x24,0x22,0x01,0x90,0xca,0xbd,0xcc,0xbb,0xbb,0xab,0x99,0x10,0x62,0x53,
+0x34,0x43,0x22,0x13,0x11,0x88,0xcb,0xcc,0xbc,0xac,0xbb,0xab,0x99,0x10,0x52,0x44,
+0x43,0x24,0x23,0x22,0x01,0x90,0xca,0xcc,0xbc,0xac,0xbb,0xba,0x99,0x10,0x52,0x44,
+0x53,0x32,0x23,0x13,0x02,0x90,0xca,0xbd,0xbd,0xbc,0xab,0xab,0x99,0x00,0x43,0x45,
+0x53,0x32,0x23,0x22,0x02,0x90,0xca,0xbd,0xbd,0xbc,0xba,0xab,0x99,0x18,0x43,0x35,
+0x35,0x34,0x23,0x22,0x11,0x90,0xca,0xcc,0xcc,0xbb,0xbb,0xbb,0x9a,0x00,0x53,0x44,
+0x34,0x34,0x23,0x23,0x11,0x98,0xca,0xdc,0xcb,0xcb,0xab,0xab,0x99,0x18,0x42,0x54,
+0x43,0x33,0x33,0x32,0x02,0x80,0xdb,0xcc,0xdb,0xbb,0xcb,0xaa,0x89,0x08,0x42,0x53,
+0x34,0x34,0x33,0x22,0x11,0x80,0xca,0xcc,0xbd,0xcb,0xba,0xaa,0x8a,0x18,0x42,0x44,
+0x34,0x24,0x33,0x23,0x11,0x90,0xc9,0xcc,0xbc,0xad,0xbb,0xaa,0x8a,0x08,0x42,0x44,
+0x34,0x24,0x33,0x32,0x11,0x80,0xca,0xcc,0xcc,0xbb,0xbb,0x9c,0x8a,0x08,0x31,0x45,
+0x34,0x34,0x23,0x23,0x01,0x90,0xdb,0xdc,0xbb,0xbc,0xab,0x8a,0x08,0x42,0x44,0x34,
+0x43,0x22,0x02,0x00,0xba,0xdc,0xbc,0xcb,0xab,0x9b,0x08,0x31,0x45,0x34,0x43,0x32,
+0x22,0x00,0xb8,0xeb,0xbc,0xbc,0xbb,0xab,0x89,0x31,0x45,0x44,0x42,0x22,0x12,0x01,
+0xa8,0xcb,0xcc,0xac,0xbb,0xbb,0x99,0x20,0x53,0x35,0x34,0x33,0x33,0x11,0x90,0xdb,
+0xbd,0xcc,0xab,0xab,0x9a,0x08,0x42,0x35,0x35,0x33,0x23,0x12,0x91,0xc9,0xcc,0xbd,
+0xbb,0xbb,0xaa,0x09,0x41,0x54,0x43,0x24,0x22,0x12,0x00,0xa9,0xcc,0xbc,0xbc,0xbb,
+0xab,0x89,0x31,0x54,0x34,0x34,0x24,0x12,0x01,0xa8,0xcb,0xbd,0xbc,0xbb,0xbb,0x99,
+0x10,0x54,0x34,0x34,0x33,0x33,0x02,0x90,0xeb,0xbc,0xcc,0xab,0xab,0x99,0x08,0x43,
+0x35,0x25,0x33,0x23,0x12,0x91,0xc9,0xdc,0xcb,0xbb,0xbb,0x9b,0x09,0x42,0x44,0x35,
+0x33,0x33,0x12,0x81,0xb9,0xcd,0xcc,0xcb,0xba,0xa9,0x88,0x21,0x44,0x34,0x34,0x33,
+0x22,0x01,0xa8,0xdc,0xdb,0xcb,0xba,0xaa,0x89,0x10,0x34,0x45,0x43,0x32,0x22,0x01,
+0x98,0xda,0xdb,0xcb,0xbb,0xbb,0x8a,0x18,0x52,0x44,0x43,0x33,0x23,0x12,0x91,0xba,
+0xbf,0xcc,0xbb,0xba,0x9a,0x19,0x41,0x44,0x34,0x24,0x23,0x11,0x81,0xa9,0xcc,0xbd,
+0xac,0xbb,0xaa,0x88,0x21,0x45,0x53,0x33,0x33,0x22,0x01,0xa9,0xdc,0xbc,0xbc,0xbb,
+0xab,0x99,0x21,0x44,0x35,0x34,0x43,0x12,0x02,0x98,0xca,0xcc,0xac,0xbb,0xab,0x9a,
+0x10,0x53,0x44,0x43,0x33,0x23,0x12,0x90,0xca,0xbd,0xbd,0xac,0xab,0x8a,0x19,0x41,
+0x53,0x34,0x24,0x23,0x11,0x81,0xb9,0xdc,0xdb,0xbb,0xab,0x9b,0x09,0x21,0x45,0x34,
+0x34,0x33,0x12,0x01,0xa8,0xdc,0xdb,0xcb,0xba,0xaa,0x89,0x20,0x63,0x43,0x24,0x33,
+0x22,0x01,0xa0,0xdb,0xcc,0xbc,0xca,0x9a,0x8a,0x00,0x33,0x36,0x44,0x22,0x23,0x11,
+0x88,0xba,0xcd,0xbc,0xbb,0xbb,0xab,0x18,0x52,0x54,0x33,0x24,0x23,0x12,0x81,0xba,
+0xcd,0xcc,0xab,0xbb,0x9b,0x09,0x31,0x45,0x44,0x32,0x33,0x22,0x01,0xa9,0xcd,0xbc,
+0xbc,0xbb,0xab,0x99,0x21,0x44,0x45,0x42,0x22,0x22,0x10,0x98,0xcb,0xbd,0xbc,0xcb,
+0xaa,0x99,0x10,0x42,0x35,0x34,0x24,0x22,0x11,0x90,0xba,0xbe,0xbd,0xbb,0xab,0xaa,
+0x18,0x42,0x45,0x43,0x43,0x22,0x11,0x80,0xa9,0xbd,0xbd,0xac,0xab,0xaa,0x08,0x31,
+0x45,0x34,0x43,0x22,0x22,0x81,0xa8,0xcc,0xbd,0xcb,0xab,0x9b,0x89,0x20,0x44,0x44,
+0x43,0x32,0x21,0x81,0xb8,0xcc,0xbd,0xbb,0xac,0x89,0x10,0x52,0x43,0x34,0x32,0x22,
+0x00,0xba,0xcd,0xcc,0xba,0xaa,0x89,0x20,0x53,0x44,0x32,0x24,0x11,0x90,0xb9,0xcd,
+0xbb,0xbc,0xaa,0x09,0x21,0x54,0x43,0x43,0x22,0x01,0x90,0xca,0xcc,0xcb,0xba,0xaa,
+0x08,0x31,0x45,0x43,0x43,0x12,0x01,0xa0,0xda,0xdb,0xbb,0xbb,0x9b,0x08,0x52,0x44,
+0x43,0x23,0x13,0x01,0xa9,0xcc,0xcc,0xbb,0xbb,0x9a,0x10,0x53,0x44,0x43,0x23,0x22,
+0x00,0xb9,0xbd,0xbd,0xbc,0xba,0x89,0x10,0x34,0x45,0x33,0x33,0x22,0x80,0xcb,0xdc,
+0xcb,0xab,0xab,0x09,0x20,0x35,0x35,0x34,0x22,0x12,0x90,0xbb,0xce,0xbb,0xbc,0xaa,
+0x09,0x31,0x35,0x35,0x34,0x22,0x11,0xa8,0xcb,0xbd,0xbc,0xac,0x9a,0x08,0x32,0x44,
+0x34,0x24,0x22,0x01,0xa8,0xdb,0xcc,0xbb,0xbb,0x9a,0x18,0x43,0x35,0x35,0x32,0x23,
+0x01,0xb9,0xcd,0xbc,0xbc,0xba,0x99,0x10,0x53,0x34,0x34,0x24,0x12,0x80,0xaa,0xbd,
+0xbd,0xbb,0xbb,0x8a,0x30,0x54,0x34,0x34,0x33,0x11,0x80,0xca,0xcc,0xbc,0xba,0xab,
+0x09,0x31,0x45,0x34,0x43,0x23,0x11,0x98,0xdb,0xbc,0xbc,0xac,0x9a,0x09,0x22,0x35,
+0x35,0x33,0x23,0x11,0xa8,0xcc,0xcc,0xac,0xbb,0x99,0x08,0x42,0x44,0x43,0x32,0x13,
+0x01,0xb8,0xcc,0xcc,0xbb,0xbb,0x9a,0x10,0x34,0x36,0x43,0x33,0x22,0x81,0xc9,0xeb,
+0xcb,0xba,0xab,0x8a,0x10,0x44,0x44,0x33,0x33,0x12,0x80,0xca,0xdc,0xcb,0xab,0xab,
+0x89,0x21,0x54,0x43,0x24,0x32,0x01,0x90,0xba,0xbe,0xbc,0xac,0xaa,0x88,0x31,0x54,
+0x33,0x34,0x23,0x02,0x98,0xdb,0xcc,0xcb,0xab,0x9a,0x19,0x41,0x34,0x35,0x33,0x23,
+0x01,0xb8,0xcc,0xbd,0xac,0xbb,0x8a,0x18,0x42,0x35,0x34,0x24,0x12,0x81,0xa9,0xcc,
+0xbc,0xcb,0xab,0x89,0x18,0x53,0x34,0x44,0x22,0x12,0x80,0xb9,0xdc,0xbb,0xbc,0xab,
+0x89,0x20,0x44,0x44,0x42,0x22,0x11,0x88,0xba,0xbd,0xbd,0xbb,0xba,0x89,0x41,0x63,
+0x43,0x33,0x22,0x02,0x90,0xdb,0xcc,0xcb,0xab,0x9b,0x08,0x41,0x53,0x53,0x32,0x22,
+0x01,0xa8,0xdb,0xbc,0xcc,0xaa,0x9a,0x00,0x32,0x45,0x43,0x32,0x13,0x01,0xa9,0xcc,
+0xcc,0xbb,0xbb,0x99,0x18,0x53,0x35,0x34,0x32,0x22,0x80,0xb9,0xcd,0xdb,0xbb,0xba,
+0x89,0x28,0x44,0x34,0x25,0x23,0x12,0x80,0xba,0xcd,0xbc,0xbb,0xab,0x89,0x31,0x45,
+0x34,0x43,0x23,0x11,0x98,0xca,0xcc,0xbc,0xbb,0xaa,0x09,0x41,0x44,0x43,0x24,0x12,
+0x81,0xb8,0xdb,0xcc,0xba,0xaa,0x08,0x31,0x45,0x43,0x23,0x12,0x80,0xca,0xcc,0xcb,
+0xab,0x9a,0x18,0x53,0x34,0x34,0x23,0x01,0x98,0xcc,0xbc,0xbc,0xab,0x89,0x20,0x35,
+0x35,0x24,0x22,0x81,0xa9,0xcc,0xcb,0xcb,0xa9,0x08,0x32,0x54,0x33,0x24,0x12,0x90,
+0xca,0xbc,0xad,0xbb,0x8a,0x18,0x53,0x34,0x34,0x32,0x01,0x98,0xcc,0xbc,0xbc,0xab,
+0x09,0x30,0x44,0x44,0x32,0x22,0x81,0xb9,0xbd,0xbd,0xac,0x9a,0x08,0x32,0x54,0x33,
+0x24,0x11,0x80,0xca,0xbc,0xbd,0xba,0x8a,0x28,0x53,0x34,0x34,0x23,0x01,0x98,0xcc,
+0xcc,0xba,0xab,0x09,0x30,0x35,0x35,0x33,0x23,0x81,0xba,0xce,0xcb,0xbb,0x9a,0x19,
+0x42,0x44,0x43,0x23,0x12,0x90,0xca,0xcc,0xac,0xbb,0x99,0x20,0x53,0x44,0x32,0x22,
+0x01,0xa8,0xeb,0xdb,0xba,0xab,0x09,0x31,0x54,0x43,0x23,0x13,0x81,0xba,0xcd,0xbc,
+0xbb,0xaa,0x08,0x43,0x45,0x33,0x24,0x11,0x98,0xca,0xcc,0xbb,0xbb,0x8a,0x20,0x73,
+0x43,0x33,0x23,0x01,0xa9,0xbd,0xbd,0xbc,0xaa,0x88,0x31,0x35,0x35,0x33,0x13,0x91,
+0xca,0xcc,0xbc,0xbb,0x9a,0x08,0x43,0x45,0x33,0x33,0x12,0x98,0xcc,0xbc,0xad,0xab,
+0x99,0x20,0x34,0x45,0x32,0x23,0x01,0xb9,0xcc,0xcc,0xba,0x9b,0x09,0x31,0x45,0x43,
+0x33,0x12,0x80,0xba,0xbe,0xbd,0xba,0x9a,0x18,0x43,0x35,0x34,0x23,0x12,0xa0,0xdb,
+0xcc,0xbb,0x9c,0x8a,0x11,0x53,0x34,0x43,0x12,0x01,0xa8,0xcc,0xdb,0xab,0x9b,0x09,
+0x32,0x45,0x43,0x23,0x22,0x80,0xca,0xcc,0xcb,0xab,0x9a,0x18,0x43,0x35,0x34,0x32,
+0x11,0xa8,0xdb,0xcc,0xbb,0xbb,0x8a,0x31,0x45,0x53,0x32,0x22,0x81,0xa9,0xbd,0xbd,
+0xbb,0xab,0x09,0x41,0x35,0x35,0x32,0x12,0x90,0xca,0xcc,0xcb,0xab,0xaa,0x10,0x43,
+0x35,0x34,0x23,0x02,0xa8,0xeb,0xdb,0xab,0xab,0x99,0x31,0x54,0x43,0x33,0x23,0x81,
+0xc9,0xdb,0xbc,0xbb,0xaa,0x08,0x33,0x46,0x43,0x23,0x22,0x88,0xcb,0xbd,0xbc,0xba,
+0x9a,0x10,0x53,0x44,0x33,0x33,0x11,0xa9,0xfb,0xcb,0xbb,0xab,0x0a,0x21,0x45,0x34,
+0x33,0x23,0x81,0xc9,0xcc,0xbc,0xac,0x9a,0x18,0x31,0x35,0x35,0x32,0x12,0x90,0xcb,
+0xbd,0xbc,0xbb,0x99,0x10,0x44,0x34,0x34,0x22,0x02,0xa8,0xcc,0xcc,0xba,0xab,0x89,
+0x31,0x45,0x43,0x23,0x13,0x01,0xba,0xcd,0xbc,0xac,0x99,0x08,0x41,0x53,0x33,0x24,
+0x11,0x88,0xbb,0xcd,0xcb,0xbb,0x99,0x21,0x34,0x23,0x90,0xcb,0xbb,0x9a,0x88,0x89,
+0xa9,0x89,0x00,0x01,0x99,0x99,0x20,0x43,0x02,0x98,0x10,0x44,0x23,0x90,0x89,0x52,
+0x35,0x13,0x88,0x10,0x44,0x22,0x90,0x99,0x41,0x35,0x23,0x11,0x20,0x53,0x34,0x23,
+0x23,0x22,0x80,0x99,0x38,0x67,0x43,0x23,0x21,0x21,0x34,0x32,0x00,0xaa,0x8a,0x43,
+0x26,0x12,0x80,0x18,0x54,0x34,0x03,0xb9,0xad,0x29,0x64,0x33,0x12,0x00,0x21,0x34,
+0x23,0xa8,0xbb,0x0a,0x18,0x90,0x00,0x77,0x34,0x23,0x08,0x08,0x44,0x34,0x00,0xdb,
+0xab,0x29,0x54,0x34,0x23,0x81,0x99,0x8a,0x43,0x26,0x82,0xd9,0xaa,0x20,0x36,0x33,
+0x01,0x21,0x43,0x12,0x98,0x19,0x64,0x33,0x81,0x9a,0x40,0x37,0x14,0x91,0x08,0x31,
+0x25,0x82,0x99,0x39,0x57,0x24,0x02,0x98,0x89,0x32,0x35,0x13,0x98,0x9b,0x50,0x45,
+0x12,0x90,0xab,0x0a,0x53,0x43,0x11,0x08,0x10,0x32,0x22,0x10,0x49,0x46,0x34,0x02,
+0x99,0x89,0x63,0x25,0x03,0x90,0x98,0x42,0x34,0x03,0x80,0x1a,0x60,0x53,0x33,0x22,
+0x02,0x91,0xb9,0xac,0x38,0x67,0x33,0x12,0x98,0x99,0x88,0xb8,0xbb,0x4a,0x67,0x33,
+0x01,0xa9,0x9b,0x30,0x53,0x11,0x90,0x08,0x00,0xa0,0xca,0xa9,0x29,0x40,0x31,0x43,
+0x12,0xb1,0xc9,0x09,0x5a,0x38,0x8b,0xbf,0x9c,0x2a,0x62,0x32,0x82,0xb1,0xd9,0xcb,
+0xcc,0xba,0x1a,0x61,0x53,0x33,0x11,0xaa,0x9b,0x73,0x36,0x13,0x98,0xbb,0xab,0x10,
+0x42,0x33,0x14,0xa1,0xd9,0x31,0x77,0x32,0x81,0x98,0x28,0x54,0x23,0x80,0xaa,0x18,
+0x32,0x14,0xa8,0xba,0x9b,0x89,0x32,0x57,0x44,0x12,0x01,0x00,0x11,0x81,0xa8,0x19,
+0x57,0x25,0x13,0x90,0xaa,0x89,0x00,0x89,0x2a,0x74,0x36,0x23,0x01,0x08,0x10,0x12,
+0xb1,0xdd,0xbb,0x19,0x45,0x34,0x13,0x80,0x88,0x20,0x31,0x01,0xb9,0x99,0x23,0x85,
+0xfb,0xac,0x19,0x64,0x24,0x23,0x01,0x80,0x98,0x89,0xa9,0x91,0x05,0x03,0xc1,0xea,
+0xa9,0x00,0x32,0x33,0x82,0xa0,0xba,0xba,0x23,0x17,0xe1,0xfd,0xca,0xaa,0x88,0x11,
+0x01,0x00,0x21,0x43,0x02,0xd8,0xb9,0x00,0x13,0xc0,0xef,0xdb,0x9a,0x08,0x21,0x21,
+0x01,0x00,0x89,0xab,0xab,0x08,0x83,0xf9,0xdf,0xba,0x89,0x00,0x81,0xa0,0x90,0x80,
+0x91,0x99,0x0c,0x3b,0x41,0x33,0x84,0x90,0xbd,0xeb,0xb9,0x90,0x12,0x63,0x32,0x22,
+0xa0,0xfb,0xb0,0x13,0x25,0x21,0x19,0x1a,0x03,0xf2,0xdc,0xaa,0x62,0x36,0x24,0x81,
+0xa9,0x99,0x11,0x22,0x00,0x98,0x00,0x02,0x92,0xd1,0xc0,0xda,0x8a,0x71,0x37,0x34,
+0x02,0x90,0xa9,0x88,0x11,0x12,0x00,0x09,0x18,0x99,0xec,0xbb,0x39,0x77,0x43,0x02,
+0x90,0x99,0x18,0x31,0x00,0xca,0xaa,0x19,0x31,0x11,0x90,0xbb,0xbc,0x92,0x47,0x23,
+0xba,0x9f,0x38,0x47,0x33,0x03,0x80,0x11,0x11,0xf9,0xdc,0xaa,0x89,0x21,0x01,0xa9,
+0xac,0x89,0x22,0x14,0x03,0x22,0x21,0xa9,0xdd,0xab,0x38,0x24,0xd8,0xcf,0xac,0x8a,
+0x11,0x12,0x91,0x99,0x89,0x01,0x91,0xb9,0x9c,0x0a,0x20,0x12,0x04,0x94,0x29,0x5d,
+0x40,0x82,0xfc,0xbe,0xbc,0x89,0x10,0x12,0x00,0x98,0x88,0x00,0x88,0xa8,0xa2,0x93,
+0x83,0x92,0x93,0x01,0x9b,0xbb,0x01,0x03,0x91,0x8f,0xab,0x00,0x33,0x73,0x20,0x09,
+0x92,0x12,0x2e,0x1e,0x29,0x53,0x11,0x9f,0x9d,0x30,0x46,0x23,0xa1,0xcc,0xab,0x08,
+0x11,0x02,0xa8,0x98,0x00,0x12,0x00,0x09,0x19,0x3b,0x2c,0x2b,0x00,0xb1,0x1b,0x3d,
+0x49,0x28,0x09,0x99,0x11,0x11,0xb1,0xd2,0x91,0x90,0xbb,0x0a,0x31,0x15,0x03,0x1a,
+0x1e,0x1b,0x3b,0x1b,0xb1,0x93,0x32,0x24,0x13,0xb9,0x9f,0x99,0x20,0x13,0xa1,0xb9,
+0xb9,0xb1,0xb1,0x19,0x79,0x20,0xa0,0xd2,0x91,0x21,0x19,0x8f,0x3a,0x73,0x12,0xfa,
+0xcd,0xbb,0x89,0x10,0x02,0x90,0x99,0x00,0x13,0x80,0xba,0xcb,0xa1,0x03,0x30,0x49,
+0x19,0xbb,0xc9,0xb2,0x15,0x12,0x01,0x10,0x2c,0x0c,0xa9,0xb3,0x10,0x0a,0xb1,0x02,
+0x29,0x20,0x49,0x3c,0x1b,0x1b,0x59,0x48,0x0a,0x9c,0x5a,0x76,0x53,0x23,0x01,0xcb,
+0xbd,0xaa,0x09,0x01,0x02,0x08,0x09,0x08,0x10,0x09,0xa9,0xb1,0xd3,0xa3,0x03,0x93,
+0xd1,0xb9,0x93,0x27,0xb2,0xfb,0xba,0x55,0x45,0x23,0x81,0x88,0x1a,0x28,0x01,0xa8,
+0xb9,0x98,0x13,0x43,0x38,0x2d,0x0d,0x0a,0x89,0x00,0x93,0x94,0xb2,0xc3,0xa1,0x93,
+0x13,0x92,0xb3,0xb1,0xb2,0xa3,0xa5,0xb1,0xc9,0xb0,0x05,0x04,0x92,0x88,0x19,0x92,
+0xb1,0xcb,0x91,0x87,0x92,0x9b,0x1b,0x27,0x94,0xfb,0xbf,0xac,0x09,0x10,0x01,0x90,
+0x89,0x09,0x11,0x81,0xa9,0x89,0x14,0x85,0xd0,0xb8,0x21,0x34,0xc0,0xef,0xac,0x9a,
+0x18,0x11,0x80,0x99,0x09,0x28,0x21,0xa8,0xd9,0xa2,0x05,0x81,0xaa,0x1b,0x36,0x06,
+0xd8,0xbe,0xbc,0x89,0x10,0x01,0x98,0x89,0x00,0x82,0xa2,0xb0,0x18,0x31,0xc3,0xe1,
+0xa9,0x1a,0x28,0x79,0x39,0x28,0x19,0x00,0x39,0x3a,0x99,0x9a,0x19,0x52,0x20,0x9a,
+0xbd,0x0d,0x19,0x31,0x93,0xd2,0x99,0x38,0x35,0x92,0xd0,0x0a,0x22,0xb3,0xfb,0xac,
+0x54,0x37,0x24,0x11,0x99,0x98,0x08,0x01,0x91,0x90,0x10,0x39,0x29,0x3b,0x3b,0xab,
+0xbb,0x9a,0x24,0x14,0x91,0x9a,0x2d,0x09,0xf1,0xc1,0xa2,0xa3,0xa1,0x98,0x31,0x37,
+0x02,0xca,0x8d,0x72,0x46,0x33,0x11,0xc9,0xbc,0xac,0x89,0x18,0x00,0x00,0x09,0x09,
+0x00,0x80,0xb1,0xc3,0xa3,0x93,0xa2,0x90,0x09,0x31,0x91,0xdb,0x9a,0x20,0x43,0xa0,
+0xbc,0x19,0x35,0x11,0xbb,0x1b,0x74,0x21,0xbf,0xcf,0xaa,0x89,0x11,0x01,0x90,0x99,
+0x00,0x01,0x90,0xa8,0x91,0x03,0x92,0xb9,0xaa,0x30,0x33,0x93,0xc2,0xa8,0x99,0x19,
+0x31,0x10,0x99,0xa0,0x11,0x21,0x09,0x19,0x3a,0x19,0xb1,0xb0,0x2b,0x39,0x13,0x21,
+0x2d,0x2b,0x18,0x91,0x99,0x11,0x33,0x00,0xad,0xb9,0x05,0x95,0xb0,0x9c,0x58,0x34,
+0xb1,0xff,0xcb,0x9a,0x00,0x11,0x00,0x89,0x1a,0x10,0x01,0x98,0x99,0x00,0xa3,0xb5,
+0xb1,0x09,0x29,0x91,0xd3,0xb3,0x81,0x01,0x91,0x10,0x00,0xa1,0xb3,0xd4,0xa4,0xa3,
+0x92,0x29,0x2c,0x2a,0x99,0xb2,0xb9,0x99,0x00,0x03,0x13,0xb3,0xb2,0xb0,0x19,0x10,
+0x92,0x11,0x2b,0x0b,0x00,0x11,0x31,0x39,0x0b,0xa9,0xa0,0x11,0x20,0x99,0xb1,0xb3,
+0x11,0x39,0x3c,0x3a,0x90,0x11,0x19,0x2b,0x09,0x20,0x4b,0x2a,0x9b,0x99,0x1a,0x29,
+0x29,0x09,0x10,0x29,0x3a,0x3b,0x9b,0xb1,0x04,0x30,0x2c,0x0c,0x08,0x12,0x29,0x2d,
+0x3b,0x3a,0xb1,0xb1,0x21,0x34,0xb1,0xbf,0x0c,0x72,0x47,0x32,0x01,0xa8,0xa9,0x11,
+0x33,0xa1,0xdf,0xcb,0x9a,0x08,0x10,0x00,0x09,0x19,0x09,0x88,0x80,0x32,0x91,0xfb,
+0xab,0x66,0x54,0x22,0x01,0xa8,0x98,0x20,0x28,0x09,0x8a,0x08,0x01,0x91,0xb0,0xb1,
+0x93,0x01,0x09,0x09,0x91,0xb3,0xb3,0x01,0x11,0x01,0xa2,0x91,0x09,0x00,0x91,0xb2,
+0xd4,0xb4,0xb3,0xa3,0x01,0x29,0x3a,0x19,0x29,0x1b,0x0b,0x91,0xa1,0xb3,0xb3,0x13,
+0x01,0xba,0x99,0x33,0x23,0xc0,0x9b,0x59,0x43,0x99,0x9f,0x3b,0x44,0x83,0xfc,0xbe,
+0x9a,0x00,0x80,0xdb,0xbc,0x8b,0x10,0x21,0x90,0x99,0x19,0x30,0x18,0x9a,0x1a,0x30,
+0x10,0xa9,0x0b,0x5b,0x4a,0x09,0x09,0x3a,0x5b,0x1a,0x98,0x19,0x3b,0x2a,0x3a,0x2b,
+0x29,0x39,0x2b,0x1a,0x19,0x19,0xa1,0xc4,0xb3,0xa3,0x93,0xa2,0xb2,0xb3,0xa3,0x93,
+0x19,0x1a,0x09,0x19,0xa1,0xb3,0xb2,0xb2,0xb3,0xb5,0xb3,0x91,0x19,0x39,0x3a,0x1b,
+0xa9,0xc4,0xa3,0x82,0x19,0x00,0xa1,0x01,0x10,0x92,0xb3,0x92,0x3b,0x3c,0x3a,0x09,
+0x00,0x19,0x99,0xa3,0x11,0x90,0xb1,0xb3,0xa2,0x11,0x29,0x1b,0x10,0x29,0x09,0x10,
+0x3b,0x1b,0x1a,0x19,0x91,0xb3,0x21,0x3b,0x2a,0x19,0x1a,0x19,0x29,0x29,0x3b,0x9a,
+0x91,0x10,0x19,0x00,0x19,0x19,0x3b,0x3b,0x19,0x19,0x19,0x3a,0x19,0x90,0xb2,0x01,
+0x5b,0x3b,0x2b,0x99,0xb2,0xb3,0xa3,0x91,0x00,0x91,0x10,0x19,0x99,0xb1,0xb3,0xb5,
+0x93,0x10,0x0a,0x90,0xb2,0x02,0x19,0xb1,0xb4,0xc2,0xa2,0x02,0x91,0xa2,0xa1,0xb2,
+0x11,0x39,0x3a,0x3b,0x3c,0x3c,0x2b,0x19,0x19,0x90,0xd3,0xb4,0xb2,0xa3,0x11,0x09,
+0xb0,0xb3,0x92,0x39,0x3b,0x3b,0x3c,0x3a,0x19,0x00,0x90,0xd2,0xb3,0x13,0x4d,0x1b,
+0x09,0xa0,0xb4,0xa2,0x11,0x4b,0x3b,0x1b,0x19,0x99,0xb3,0x21,0x4d,0x2c,0x2a,0x19,
+0xa0,0xc3,0x01,0x3b,0x2b,0x00,0x90,0x90,0x01,0x39,0x2b,0x99,0xb1,0xa3,0xb3,0xa3,
+0x11,0x19,0x90,0xa1,0x93,0x10,0x19,0x90,0xb1,0xb3,0x02,0x00,0x91,0x01,0x19,0x19,
+0x10,0x29,0x3b,0x1b,0xa1,0x11,0x19,0xb1,0xb4,0xb2,0x01,0x91,0xa1,0xa3,0xb3,0xb3,
+0xb3,0xb3,0xb3,0x11,0x19,0x09,0x10,0x19,0xb0,0xb4,0xb3,0x91,0x10,0x19,0x09,0x91,
+0x91,0x01,0x19,0xa1,0xb3,0x91,0x91,0x91,0x91,0xb2,0xa2,0xa2,0x92,0x39,0x3b,0x2b,
+0x2a,0x99,0x91,0x91,0x90,0x92,0x90,0xa1,0xb3,0x93,0x29,0x3b,0x3d,0x3a,0x4b,0x3c,
+0x09,0xa0,0x92,0xa1,0x93,0x19,0x19,0x19,0x19,0x90,0x01,0x3a,0x2b,0xb0,0xb5,0xb3,
+0xb2,0x01,0x19,0x19,0x00,0x19,0x29,0x1a,0x19,0xa1,0xb3,0xb3,0xa3,0x91,0x92,0x3a,
+0x3b,0x99,0x91,0x00,0x91,0x10,0x29,0x3b,0x3b,0x9a,0xb3,0xb3,0xb3,0x92,0x19,0x19,
+0x99,0xb2,0xb3,0x21,0x3b,0x3b,0x3b,0x2b,0x19,0x3a,0x1a,0xa1,0xb3,0xa3,0x11,0x4b,
+0x2b,0x99,0x20,0x3c,0x3b,0x90,0xc3,0xb3,0x03,0x19,0x19,0xb1,0xa3,0x92,0x29,0x1a,
+0xa1,0xb3,0xb3,0x92,0x29,0x2b,0x99,0xb2,0xa3,0x11,0x5b,0x3b,0x1b,0x19,0x09,0xa1,
+0xb3,0xb3,0xa3,0x11,0x3a,0x3b,0x1a,0xa1,0x93,0x19,0x2a,0x99,0x01,0x19,0x29,0x2b,
+0x99,0xb2,0x92,0x00,0x19,0x19,0x90,0xb2,0xb3,0xb3,0xb3,0xb3,0xb3,0x92,0x29,0x2b,
+0x09,0x00,0x91,0x91,0x91,0x10,0x19,0x2a,0x09,0x91,0x91,0x10,0x19,0x99,0x01,0x19,
+0x90,0xd3,0xb3,0x93,0x01,0x00,0x00,0x00,0xa1,0x93,0x19,0x99,0xb3,0x92,0x19,0x3a,
+0x1a,0x91,0x91,0x39,0x3c,0x2a,0x09,0x90,0xb2,0xb3,0x11,0x29,0x3b,0x0a,0xb2,0xa3,
+0x10,0x19,0xb1,0xa3,0xb3,0xb3,0xb3,0x92,0x91,0x90,0x11,0x99,0xb2,0xb3,0x92,0x29,
+0x2b,0x99,0xb2,0xb3,0xb3,0xa3,0x91,0x11,0x3a,0x1a,0x00,0x29,0x3b,0x3b,0x3b,0x2b,
+0x99,0x91,0x01,0x90,0x01,0x29,0x3b,0x0a,0xb2,0xb3,0xa3,0x20,0x3b,0x3b,0x3b,0x9a,
+0xc3,0xb4,0xa2,0x01,0x3a,0x3b,0x1a,0x00,0x00,0x10,0x4b,0x3b,0x0b,0x00,0x29,0x1a,
+0x00,0x00,0x00,0x10,0x3a,0x1a,0x39,0x2b,0xa9,0xb3,0xa3,0x91,0x91,0x01,0xa1,0xb3,
+0xb3,0x92,0x90,0xb2,0xb3,0xb3,0xb3,0xb3,0x02,0x4b,0x4c,0x1b,0x90,0xc3,0xb3,0x92,
+0x19,0x2a,0x99,0xa2,0x20,0x3b,0x3b,0x3b,0x2b,0x99,0x11,0x09,0xa1,0xb3,0xb3,0xb3,
+0xa3,0x30,0x3c,0x4b,0x0a,0xb2,0x31,0x3d,0x1a,0xb1,0xb3,0x91,0xb2,0x92,0x29,0x0a,
+0xb2,0xb3,0x92,0x90,0x91,0xb2,0x92,0x91,0x19,0x29,0x3b,0x3b,0x0a,0xc3,0xb3,0xb5,
+0xc3,0xb4,0xa2,0x01,0x39,0x3b,0x1a,0x29,0x3b,0x3b,0x0a,0xb2,0xb3,0x92,0x39,0x1b,
+0x00,0x91,0xa1,0xb3,0x11,0x19,0x90,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x01,
+0x39,0x3b,0x1b,0x10,0x19,0x3a,0x1a,0x00,0x91,0x39,0x3c,0x3b,0xa1,0xb3,0xb3,0xa3,
+0x01,0x00,0x00,0x29,0x1a,0x00,0x91,0xa1,0xb3,0x92,0x39,0x1b,0x19,0x39,0x2b,0x3b,
+0x3b,0x3b,0x1a,0x00,0xa1,0xb3,0xa3,0x11,0x19,0x19,0x99,0x91,0x01,0x19,0x90,0xb2,
+0xb3,0xb3,0x02,0x3a,0x1a,0x00,0x00,0x90,0xb2,0xb3,0xb3,0x92,0x00,0x00,0x00,0xa1,
+0xb3,0xa3,0x91,0x11,0x3a,0x1b,0xb2,0xc4,0xa3,0x92,0x11,0x3a,0x3b,0x3b,0x3b,0x3b,
+0x1a,0x29,0x2b,0x90,0x10,0x3a,0x1a,0x19,0x19,0x91,0x91,0x10,0x09,0xa1,0xb3,0xa3,
+0x91,0xb2,0xb3,0x02,0x3a,0x3b,0x3b,0x1a,0xa1,0xb3,0xb3,0xa3,0x01,0xa1,0xb3,0xb3,
+0xa3,0x91,0xb2,0xa3,0x11,0x3a,0x3b,0x3b,0x99,0x91,0x91,0xb1,0xa3,0x92,0x91,0x91,
+0x91,0x91,0x91,0xb1,0x93,0x19,0x90,0xb3,0x11,0x3a,0xa9,0xb3,0x12,0x4b,0x3c,0x2a,
+0x19,0x91,0x10,0x19,0x19,0x19,0x19,0x3a,0x4c,0x1b,0x18,0x1a,0xb1,0x93,0x29,0x1b,
+0x91,0x91,0x91,0xb3,0xb2,0xa3,0x91,0x01,0x91,0x91,0x10,0x19,0x09,0xa1,0xb3,0xb3,
+0x93,0x19,0x3b,0x2a,0x99,0xb3,0xb3,0x91,0xb3,0x01,0x00,0x00,0x39,0x1b,0xa1,0xb3,
+0xb3,0xb3,0xb3,0xb3,0xa3,0x30,0x3c,0x3b,0x00,0x00,0x00,0x29,0x2b,0xa0,0x92,0x29,
+0x2b,0x09,0x90,0x01,0x00,0x29,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x1a,0xa1,
+0xb3,0x02,0x09,0xa1,0xb3,0x02,0x3a,0x3b,0x3b,0x1a,0xa1,0xa3,0x01,0x00,0x00,0x29,
+0x3b,0x3b,0x2b,0x99,0x91,0xb2,0x92,0x91,0x90,0x01,0x00,0x19,0x00,0x90,0x11,0x3a,
+0x2b,0xa0,0x02,0x3a,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x0a,0xa2,0x30,0x3c,
+0x3b,0xa1,0xb3,0xa3,0x91,0xb2,0xb3,0xa3,0x91,0xb3,0x92,0x3a,0x99,0x10,0x5b,0x2b,
+0x89,0x91,0x91,0xb2,0xb3,0x92,0x19,0x00,0x19,0x19,0x19,0x19,0xa1,0xa3,0x01,0x00,
+0x10,0x3a,0x3b,0x3b,0x3b,0xa9,0xc3,0x93,0x11,0x99,0x91,0x11,0x3a,0x2b,0x09,0x00,
+0x29,0x3b,0x2b,0x19,0x2a,0x19,0x3b,0x3b,0x99,0x91,0x91,0xb3,0xb3,0xb3,0xa2,0x91,
+0x91,0x11,0x09,0xb1,0xb5,0xa2,0x91,0x91,0x29,0x2b,0x99,0x01,0x29,0x3b,0x3b,0x2b,
+0x19,0x09,0x19,0x29,0x3b,0x3b,0x3b,0x1a,0xa1,0xb3,0xa3,0x01,0x29,0x2b,0x09,0x00,
+0x29,0x2b,0x99,0xb2,0x92,0xb1,0xa3,0x92,0x19,0x90,0x01,0x00,0x19,0x10,0x4b,0x3b,
+0x2c,0x19,0x00,0xb1,0xa3,0xa3,0x20,0x3b,0x3b,0x2b,0x19,0x19,0x19,0x19,0x09,0x10,
+0x19,0x2a,0xa0,0xb3,0xa3,0x11,0x99,0x91,0x11,0x2a,0x99,0xb2,0x92,0x19,0x19,0x90,
+0x91,0x01,0x29,0x3b,0x4c,0x3b,0x3c,0x1a,0x90,0x91,0x19,0x90,0x91,0x01,0x19,0x19,
+0xa1,0xb3,0x02,0x4b,0x2b,0x1a,0x39,0x4c,0x3c,0x1a,0x00,0x19,0x29,0x1a,0x90,0xa2,
+0x91,0x91,0x92,0x19,0x3a,0x2a,0x2b,0x3a,0x3b,0x1b,0x01,0x29,0x3b,0x1a,0x00,0x00,
+0x90,0xb2,0xb3,0xa3,0x01,0x00,0x91,0x00,0xa1,0xb3,0xb3,0xa3,0x91,0xb3,0x92,0x3a,
+0x1b,0xb2,0xb3,0x92,0x90,0x01,0x00,0x00,0xa1,0xb3,0xb3,0xb3,0x02,0x3a,0x3b,0x3b,
+0x3b,0x1a,0xa1,0xb3,0xa3,0x01,0x39,0x3b,0x1b,0x91,0x10,0x3a,0x3b,0x3b,0x0a,0xc3,
+0xb3,0xb5,0xb3,0xd3,0xb3,0x93,0x19,0x19,0xb1,0xb5,0xb3,0xb2,0x91,0x11,0x19,0x09,
+0xa1,0xb3,0xa3,0x30,0x3b,0x1b,0xb1,0xc4,0x93,0x91,0x10,0x90,0xb2,0xc3,0xb4,0xa2,
+0x91,0x91,0xb1,0xa3,0x92,0x00,0x00,0x00,0xa1,0xb3,0x02,0x3a,0x3b,0xb9,0xc4,0x93,
+0x91,0x10,0x90,0xb2,0x92,0x90,0x91,0x01,0x19,0x29,0x2b,0x99,0xd3,0xc4,0xb3,0x92,
+0x91,0xc2,0xb3,0xb3,0xb2,0x93,0x09,0x00,0x10,0x99,0xb2,0x02,0x3a,0x3b,0x3b,0x3b,
+0x1b,0xb2,0xb3,0xb3,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x1a,0x00,0x39,
+0x3c,0x3b,0xb1,0xa3,0x92,0x19,0x91,0x91,0x91,0x91,0xa1,0x92,0x19,0xb1,0xb4,0x92,
+0x19,0x09,0x00,0x29,0x1a,0x39,0x3c,0x1a,0x91,0xa2,0x91,0x01,0x91,0x91,0x00,0x91,
+0xb1,0xa3,0xb3,0xb3,0x02,0x09,0xa1,0xa3,0x91,0x91,0xb3,0xb3,0x11,0x19,0x99,0xa2,
+0x91,0x91,0xa2,0x91,0x91,0xb3,0xb3,0x11,0x19,0x99,0xb3,0xa2,0x11,0x09,0x10,0x3a,
+0x3b,0x99,0x91,0x91,0xb1,0xb3,0x93,0x10,0x09,0x10,0x3a,0x3b,0x1a,0x00,0x10,0x19,
+0x3a,0x3b,0xa9,0xc3,0xb4,0xa2,0x10,0x00,0x00,0x00,0x10,0x3a,0x3b,0x1a,0x10,0x09,
+0xa1,0xb3,0x11,0x19,0x00,0x19,0x19,0x00,0x19,0x19,0x90,0x91,0x01,0x90,0xb2,0xb3,
+0x92,0x00,0x19,0x29,0x3b,0x3b,0x99,0x91,0x00,0xb1,0x93,0x39,0x1b,0xb1,0x93,0x19,
+0x90,0xb2,0x92,0x90,0xd3,0xb3,0x93,0x10,0x19,0x39,0x1b,0x19,0x91,0x19,0x19,0x00,
+0x00,0x29,0x3b,0x0a,0xb2,0x92,0x00,0x19,0x19,0x19,0xb1,0xa3,0xa3,0x91,0xa2,0x11,
+0x2a,0xa0,0xb3,0xb3,0xb3,0x02,0x4b,0x3b,0x9b,0xc3,0xa3,0x21,0x2b,0x09,0x90,0x91,
+0x01,0x29,0x3b,0x99,0xb1,0xb3,0xa3,0x92,0x29,0x3b,0x3b,0x3b,0x2b,0x19,0x19,0x99,
+0x91,0x11,0x99,0x91,0x11,0x19,0x19,0x19,0x3b,0x2a,0x09,0x29,0x2b,0x19,0x19,0x99,
+0xb2,0xa3,0x01,0x00,0x00,0x00,0x00,0x29,0x3b,0x1a,0x39,0x4c,0x3c,0x2a,0x09,0xa0,
+0x01,0xa1,0xb3,0xa3,0x91,0xb2,0xa3,0x20,0x2b,0xa0,0xb3,0xb3,0xa3,0x01,0x00,0x00,
+0x00,0xa1,0xb3,0x02,0x3a,0x3b,0x3b,0x3b,0x0a,0xb3,0x11,0x3a,0x1a,0x00,0x00,0x00,
+0x00,0x90,0xa2,0x01,0x19,0x00,0x90,0x01,0x00,0x90,0xc3,0xb3,0x13,0x3a,0x3b,0x3b,
+0x0a,0xb2,0x02,0x3b,0x99,0xb2,0xb3,0xa3,0x20,0x0a,0xa2,0x30,0x2b,0x1a,0x19,0x19,
+0xb1,0xb4,0x92,0x99,0xb2,0xb3,0x92,0xb1,0xa3,0x92,0x90,0xb2,0x92,0x29,0x3b,0x3b,
+0x3b,0x2b,0x09,0x10,0x3a,0x2b,0x09,0x00,0x19,0x29,0x3b,0x3b,0x2a,0x3b,0x3b,0x3b,
+0x1b,0xc3,0xc4,0xa3,0x92,0x00,0x1a,0x10,0x19,0x3a,0x3b,0x2b,0xa0,0xa3,0x30,0x3c,
+0x3b,0x29,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x0a,0xd3,0xc4,0xb3,0x01,0x19,0x08,
+0x99,0x01,0x00,0x90,0xb2,0xb3,0xb3,0xb3,0xb3,0x92,0x90,0x91,0xb2,0xb3,0x92,0x91,
+0x91,0x39,0x3b,0x3b,0x1b,0x91,0xa1,0x92,0x91,0x19,0x19,0x90,0x11,0x3a,0x1b,0x91,
+0x91,0x91,0x01,0x19,0x19,0x90,0x91,0x01,0x19,0x39,0x2b,0x3b,0x1a,0x90,0xa2,0x01,
+0x29,0x0a,0xb2,0xb3,0xb3,0xb3,0xb3,0xb3,0x92,0x90,0xb3,0x11,0x4b,0x3b,0x2c,0x09,
+0xb2,0xa3,0x20,0x3b,0x2b,0x99,0xb3,0xb2,0xa3,0x91,0xb3,0xb3,0xa2,0x01,0x19,0x19,
+0x90,0xb2,0xb3,0xb3,0x92,0x10,0x19,0x99,0x01,0x29,0x2b,0x99,0xb2,0x92,0x29,0x2b,
+0xa0,0xb3,0xb3,0xb3,0xa3,0x01,0x00,0xa1,0xb3,0xc4,0xb3,0xb4,0x01,0x29,0x19,0x3a,
+0x3b,0x99,0x91,0x10,0x3b,0x3b,0x99,0x91,0x11,0x19,0x09,0x91,0x10,0x3a,0x4c,0x2b,
+0x1a,0x3a,0x3b,0x3b,0x3b,0x1b,0x91,0x11,0x4b,0x2b,0x1a,0x39,0x2b,0x3b,0x4b,0x3c,
+0x3a,0x3b,0x1a,0xb2,0xb3,0x21,0x3b,0x2b,0x09,0x00,0x00,0x91,0x29,0x3b,0x0a,0xb3,
+0x01,0x39,0x1b,0x90,0xb2,0xb3,0xb3,0xb3,0xa3,0x01,0xa1,0xa3,0x11,0x3a,0x3b,0x1a,
+0x00,0x91,0xa1,0x93,0x19,0x3a,0x2a,0x3b,0x3b,0x3b,0x3b,0x3b,0x2b,0x09,0x29,0x3b,
+0x2b,0x09,0x00,0x29,0x3b,0x3b,0x2b,0x99,0x11,0x3b,0x1a,0x91,0x01,0x19,0x19,0x90,
+0x91,0x01,0x19,0x29,0x3b,0x3b,0x2b,0x09,0x29,0x3b,0x3b,0x0a,0xd3,0xa3,0x92,0x20,
+0x3b,0x2b,0x09,0x00,0x00,0x00,0x90,0xb2,0xb3,0xb3,0xb3,0xb3,0x92,0x90,0xb2,0x92,
+0x19,0xb1,0xb3,0xa3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0x92,0x00,0x19,0x29,0x2b,0x19,
+0x09,0x19,0x90,0xb2,0xb3,0x92,0xa1,0xb3,0xb3,0xa3,0x11,0x3a,0x0a,0xa2,0x91,0x91,
+0xd3,0xb3,0xb4,0x81,0xa1,0x01,0x29,0x2b,0x99,0xb2,0xb3,0x92,0x00,0x00,0x91,0x10,
+0x3a,0x1b,0x91,0xa2,0x91,0x11,0x3a,0x1a,0xa1,0x02,0x3a,0x2b,0xa0,0xb3,0x92,0x00,
+0x90,0x01,0x00,0x29,0x3b,0x3b,0x1a,0x90,0xb2,0xa3,0x20,0x0a,0xc3,0xb3,0x93,0xb2,
+0xb3,0xc4,0x93,0x00,0x1a,0x10,0x09,0xa1,0xb3,0xa3,0x91,0x91,0x11,0x09,0x10,0x19,
+0x09,0x10,0x19,0x09,0x91,0xa1,0x93,0x19,0x09,0x91,0x91,0x91,0x91,0x39,0x1b,0x19,
+0x29,0x1b,0x91,0x01,0x19,0x19,0x19,0x19,0x19,0x19,0x91,0x10,0x3a,0x1b,0x91,0xb3,
+0x91,0x11,0x4b,0x3c,0x19,0x19,0x00,0x19,0x90,0xd3,0xb3,0xb4,0x01,0x29,0x09,0x10,
+0x19,0x3a,0x3b,0x1a,0x00,0x00,0x91,0x00,0x00,0x91,0x00,0x00,0x91,0x00,0x91,0x91,
+0x91,0x91,0x91,0x19,0x19,0x91,0x91,0x00,0xa1,0xb3,0xa3,0x01,0x91,0x00,0x90,0xd3,
+0xa3,0x11,0x4c,0x1b,0x98,0x93,0x29,0x3b,0x9a,0xb3,0x92,0x19,0x00,0x00,0x00,0x00,
+0xa1,0xb3,0xb3,0x92,0xa1,0x92,0x10,0x99,0x91,0x91,0x01,0x29,0x3b,0x0a,0xd3,0xb4,
+0xa2,0x91,0xb2,0xb2,0xb3,0xa3,0x01,0x10,0x3a,0x3b,0x3b,0x3b,0x2b,0x99,0xc3,0xa3,
+0x21,0x2b,0xa0,0x92,0x19,0x19,0x19,0x19,0xb1,0xb5,0xc3,0xa3,0xb3,0xa3,0xb3,0xb3,
+0x93,0x09,0x90,0x11,0x3a,0x3b,0x1a,0x00,0x10,0x3a,0x0a,0xc3,0xa3,0x11,0x90,0xb2,
+0xb3,0x02,0x3a,0x3b,0x1a,0x10,0x3a,0x3b,0x3b,0x3b,0x4b,0x4d,0x1a,0x08,0x29,0x2b,
+0xa9,0xa3,0x11,0x09,0xa1,0x93,0x4b,0x3b,0x2c,0x3a,0x2a,0x90,0x91,0x29,0x1a,0xa1,
+0xa3,0x91,0xa2,0x91,0x20,0x1a,0x19,0xa1,0xb3,0xb3,0xa3,0x91,0x91,0x91,0x91,0x01,
+0x19,0x19,0x19,0x19,0x19,0x19,0x91,0x91,0x29,0x3b,0x2b,0x09,0x91,0x91,0x91,0x91,
+0x10,0x09,0xa1,0xa3,0x11,0x3a,0x3b,0x1a,0x00,0x00,0x90,0xa2,0x20,0x3b,0x3b,0x3b,
+0x2b,0x09,0x00,0x19,0x00,0x19,0x19,0x90,0x01,0x29,0x3b,0x2b,0x99,0xb2,0xb3,0x92,
+0x91,0x19,0x19,0x91,0x91,0x10,0x19,0x99,0xb2,0x92,0x10,0x09,0x00,0x91,0x00,0x91,
+0xa1,0x93,0x19,0x3a,0x3b,0x1a,0x19,0x39,0x1b,0x19,0x19,0x90,0x91,0x01,0x29,0x4b,
+0x3c,0x2a,0x3a,0x19,0x19,0x2a,0x19,0x19,0x4b,0x3b,0x3d,0x3b,0x1a,0xb3,0xa2,0x30,
+0x2b,0x1a,0x10,0x3a,0x2b,0xa0,0xa3,0x20,0x3b,0x2b,0xa0,0xa3,0x20,0xa9,0xb3,0xa3,
+0x01,0x90,0xb2,0xb3,0x92,0x91,0x91,0x91,0x91,0x10,0x3b,0x1a,0xb2,0xb3,0x92,0x91,
+0x91,0xb1,0xc5,0xb4,0xa3,0x81,0x18,0x19,0x90,0x91,0x91,0x91,0x91,0xa2,0x91,0x01,
+0x91,0x00,0x10,0x09,0x10,0x09,0x91,0x91,0x29,0x1a,0x91,0x10,0x3a,0x1a,0x91,0x39,
+0x2b,0x1a,0x91,0x00,0x91,0xa1,0xa3,0x91,0xa2,0x11,0x3a,0x1a,0x10,0x3a,0x1a,0x10,
+0x5b,0x3b,0x2b,0x1b,0x91,0x10,0x4b,0x2b,0x1a,0x29,0x1a,0x00,0x10,0x3a,0x2b,0x99,
+0xc3,0xa3,0x21,0x2b,0x99,0xc3,0xa3,0x92,0xa1,0x92,0x29,0x2b,0x09,0x00,0x10,0x4b,
+0x3b,0x2c,0x09,0x01,0x00,0x90,0x11,0x4b,0x2b,0xa9,0xb3,0xb3,0xa3,0x30,0x2b,0x2b,
+0x19,0x3a,0x2b,0x90,0x91,0xa1,0xb3,0xb3,0x11,0x19,0x91,0x10,0x3a,0x2b,0x09,0x91,
+0x29,0x3b,0x1a,0xa1,0xa3,0x11,0x3b,0x19,0x19,0x3b,0x3b,0x99,0xb3,0xa2,0x91,0xb3,
+0xb3,0xa2,0x91,0x01,0xa1,0xb3,0xa3,0x01,0x39,0x2b,0x0a,0xb3,0xb2,0x02,0x09,0x19,
+0x10,0x3a,0x3b,0x1a,0x91,0x91,0x91,0x91,0x39,0x2b,0x1a,0x19,0x29,0x1a,0xa1,0xa3,
+0x91,0xb2,0x93,0x09,0xa1,0xb3,0xa3,0x01,0xa1,0x02,0x4b,0x3b,0x1b,0x99,0x01,0x39,
+0x1b,0x90,0x91,0xb2,0xb3,0xb3,0xb3,0xa3,0x01,0x91,0x10,0x3a,0x3b,0x3b,0x1a,0x90,
+0xb2,0xb3,0x02,0x4b,0x2b,0x99,0x39,0x3c,0x2a,0x99,0x01,0x19,0x19,0x90,0x01,0x29,
+0x2b,0x99,0x01,0x29,0x3b,0x2b,0x19,0x3b,0x1a,0xb2,0xb3,0xb3,0x92,0x29,0x2b,0x99,
+0xb2,0xb3,0xb3,0xb3,0xb3,0xa3,0x30,0x4d,0x2b,0x1a,0x08,0x3a,0x3b,0x3b,0x3b,0x3b,
+0xa9,0xa3,0x11,0x4b,0x3b,0x3c,0x3b,0x99,0x11,0x3b,0x2a,0x19,0x19,0x99,0x91,0xb3,
+0x01,0x19,0x29,0x3b,0x2b,0x09,0x10,0x3a,0x3b,0x1a,0xa1,0xb3,0xa3,0x11,0x3a,0x3b,
+0x4b,0x3d,0x2a,0x09,0xb1,0x11,0x3a,0x1a,0x00,0x10,0x09,0x10,0x3a,0x3b,0x3b,0x1a,
+0x29,0x3b,0x3b,0x3b,0x9a,0xb3,0xb3,0xb3,0xb3,0x92,0x91,0x10,0x19,0x19,0x19,0x19,
+0x19,0x19,0x99,0x91,0x01,0x90,0xb2,0xb3,0xb3,0xb3,0xb3,0xc3,0xb4,0xa2,0x91,0x29,
+0x3b,0x3b,0x3b,0x1b,0xb3,0xa2,0x30,0x3b,0x3c,0x1a,0xc3,0xa3,0x92,0x00,0x29,0x3b,
+0x3b,0x3b,0x3b,0x3b,0x1a,0x19,0xa1,0xb3,0xb3,0xb3,0x93,0x3a,0x4c,0x3b,0x3c,0x2a,
+0x19,0x29,0x3b,0x1a,0x00,0x10,0x09,0x00,0x91,0xa1,0xa3,0x91,0x01,0x10,0x09,0xa1,
+0xb3,0xb3,0xb3,0xc4,0xa3,0x11,0x3c,0x1a,0x01,0x10,0x09,0x00,0x00,0xa1,0xa3,0x20,
+0x1a,0xb1,0xb4,0xd4,0xa3,0xa2,0x91,0x91,0x29,0x2b,0x09,0x00,0x00,0x00,0x00,0x90,
+0xb2,0xb3,0x93,0x19,0x3b,0x3b,0x2a,0x19,0x3a,0x2b,0xa0,0xb3,0x92,0x00,0x29,0x2b,
+0x99,0xb2,0x92,0x19,0x90,0xb2,0x92,0x29,0x3b,0x2b,0x99,0xa2,0x11,0x2a,0x99,0xb2,
+0xb3,0xb3,0x93,0x19,0x19,0x19,0x2a,0x99,0xb2,0x92,0x19,0x00,0x19,0x19,0x90,0x91,
+0x91,0xb3,0xb3,0xa2,0x91,0x91,0x11,0x09,0xa1,0xb3,0xa3,0x11,0x09,0x91,0x91,0x10,
+0x19,0x19,0x3a,0x3b,0x1a,0x91,0x19,0x10,0x2a,0x09,0xb1,0xb3,0x93,0x91,0x00,0x10,
+0x09,0x00,0x91,0x00,0x10,0x09,0x00,0x10,0x09,0x00,0x10,0x2a,0x09,0x00,0x00,0xa1,
+0xa3,0x91,0x91,0x11,0x09,0xa1,0xb3,0xb3,0xb3,0x92,0x29,0x3b,0x2b,0x09,0x00,0x00,
+0x00,0x00,0x90,0xb2,0x92,0x90,0x01,0x29,0x2b,0x09,0x39,0x3c,0x2a,0x09,0x29,0x2b,
+0x99,0xb2,0xa3,0x20,0x3b,0x1a,0x90,0x01,0x00,0x19,0x00,0x19,0x00,0x29,0x4b,0x3c,
+0x3b,0x19,0xa1,0xb3,0xa3,0x11,0x3a,0x3b,0x1b,0x91,0xb2,0x92,0x39,0x1b,0x90,0x11,
+0x3a,0x2b,0x2a,0x19,0x09,0x00,0x10,0x3a,0x1a,0xa1,0xa3,0x01,0x00,0x00,0x39,0x1b,
+0xb1,0xb5,0x01,0x19,0xa1,0xb5,0xc3,0xa3,0x92,0x30,0x3c,0x3b,0x19,0xa1,0xb3,0xb3,
+0xa3,0x91,0x01,0x10,0x09,0x00,0x00,0x91,0x10,0x3a,0x1a,0x10,0x2a,0xa0,0xb3,0x92,
+0x91,0xa1,0xa3,0x11,0x09,0xa1,0xb3,0x92,0x10,0x99,0xb2,0xb3,0x21,0x3b,0x1a,0x29,
+0x3b,0x2b,0x99,0x01,0x29,0x3b,0x2b,0x99,0x01,0x29,0x3b,0x4c,0x2b,0x0a,0x01,0x00,
+0x19,0x00,0x90,0xb2,0xb3,0x02,0x4b,0x3b,0x3d,0x3b,0x2a,0x99,0x01,0x29,0x2b,0x99,
+0xb2,0xb3,0xb3,0x92,0x90,0xd3,0xa3,0x92,0x10,0x19,0x19,0x00,0x00,0xa1,0xb3,0x92,
+0xa1,0xb3,0x12,0x4b,0x3c,0x2a,0x19,0x91,0x00,0x10,0x09,0xa1,0xc3,0xb4,0xb2,0xb3,
+0xa2,0x91,0x91,0xa2,0xb2,0x92,0x91,0x91,0x91,0xa1,0xa3,0x11,0x3a,0x1a,0x00,0x00,
+0x91,0xa1,0xa3,0x01,0x19,0x10,0x19,0x09,0x91,0x91,0x19,0x19,0x90,0x91,0x91,0x91,
+0x91,0xb3,0xb3,0x01,0x10,0x5b,0x3b,0x1b,0x19,0x99,0x91,0x01,0x90,0xb2,0xa3,0x01,
+0x00,0x91,0x91,0x10,0x5b,0x3c,0x89,0xb2,0x11,0x3b,0x99,0xd3,0xa3,0x11,0x3b,0x1b,
+0x90,0xb2,0xb3,0x21,0x4b,0x3c,0x2a,0x19,0xa1,0xa3,0x01,0x00,0x91,0x00,0x91,0x10,
+0x3a,0x1a,0x00,0x29,0x3b,0x3b,0x3b,0x3b,0x2b,0x19,0x3b,0x3b,0x3b,0x2a,0x99,0x01,
+0x29,0x2b,0x19,0x3a,0x2b,0xa0,0x92,0x00,0x90,0x01,0x29,0x3b,0x99,0x91,0x10,0x19,
+0x19,0x19,0x3b,0x2a,0x09,0x19,0x90,0xb2,0xb3,0xb3,0xb3,0xb3,0xb3,0x92,0x90,0xb2,
+0x92,0x19,0x00,0x39,0x3b,0x1b,0x19,0x90,0xb2,0xb3,0xb3,0xb3,0xb3,0x92,0x91,0x91,
+0x29,0x3b,0x3b,0x2b,0x90,0x00,0x39,0x3b,0x1b,0xa1,0xa3,0x01,0x00,0xa1,0xb3,0xb3,
+0xb3,0x93,0x09,0x91,0x91,0x91,0x91,0x10,0x3a,0x3b,0x2b,0x09,0x10,0x3a,0x3b,0x3b,
+0x3b,0x3b,0x0a,0xb2,0xa3,0x20,0x2b,0xa0,0x02,0x3b,0x2a,0x09,0x29,0x2b,0xa0,0x92,
+0x29,0x3b,0x3b,0x2b,0x09,0x19,0x90,0x91,0x91,0x91,0x91,0x91,0xd3,0xb3,0xa3,0xa3,
+0x92,0x29,0x2b,0x99,0xb2,0x92,0x91,0x39,0x2b,0xa9,0xb3,0xb3,0xa3,0x11,0x09,0x10,
+0x19,0x09,0x91,0x91,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x90,0x91,
+0x91,0xb2,0xb3,0x92,0x29,0x3b,0x3b,0x3b,0x3b,0x2b,0x09,0x90,0x91,0x01,0x90,0x01,
+0x29,0x3b,0x2b,0x99,0xb3,0x01,0x19,0x90,0xb2,0x92,0x19,0x00,0x29,0x3b,0x3b,0x3b,
+0x3b,0x3b,0x3b,0x3b,0x1a,0xa1,0xa3,0x11,0x3a,0x3b,0x3b,0x1a,0x19,0x91,0x91,0x10,
+0x19,0x09,0x91,0x91,0x10,0x19,0x3a,0x3b,0x1a,0x00,0x29,0x1a,0xb1,0xb4,0xc3,0xa2,
+0x93,0x00,0x00,0x91,0x00,0x10,0x3a,0x3b,0x3b,0x3b,0x1a,0x91,0x10,0x3a,0x3b,0x2b,
+0x09,0x91,0x19,0x00,0x90,0x91,0xb2,0x92,0x10,0x99,0x91,0xb3,0xb3,0x92,0x19,0x3b,
+0x19,0x19,0x3a,0x1a,0x19,0x19,0x90,0xb2,0xb3,0x92,0x19,0x90,0xb2,0xb3,0xb3,0xb3,
+0xb3,0xa3,0x39,0x4c,0x2b,0x1a,0x09,0x91,0x10,0x19,0x19,0x19,0x19,0x19,0x3b,0x2a,
+0x99,0xb2,0xb3,0x92,0x29,0x2b,0x99,0xb2,0xb3,0xb3,0xa3,0x30,0x1b,0xb1,0xb4,0xc3,
+0xb3,0x93,0x91,0x91,0xa1,0xb3,0xc4,0xb3,0xc4,0xb4,0xa3,0x91,0x91,0xa1,0xa3,0x11,
+0x3b,0x09,0x91,0x90,0x91,0x11,0x3b,0x1a,0x91,0xb3,0xb3,0xa2,0x01,0x10,0x3a,0x3b,
+0x1a,0xa1,0xb3,0xa3,0x11,0x2a,0x19,0x3a,0x2b,0xa0,0x02,0x3a,0x1a,0x10,0x3a,0x0a,
+0xc3,0xc4,0x93,0x18,0x2a,0x99,0x91,0x90,0xb2,0xb3,0x92,0x00,0x00,0x29,0x1a,0xa1,
+0xb3,0xb3,0xa3,0x01,0xa1,0xb3,0x92,0x10,0x09,0x00,0x91,0x91,0x91,0x10,0x19,0x09,
+0x91,0x10,0x3a,0x3b,0x1a,0xa1,0xb3,0xa3,0x01,0x00,0x10,0x2a,0xa0,0xb3,0x92,0x91,
+0x91,0x00,0x91,0xa1,0xb3,0xa3,0x01,0xa1,0xa3,0x20,0x1a,0x90,0x91,0xb2,0x92,0x91,
+0xa1,0x92,0x29,0x3b,0x2b,0x09,0x29,0x3b,0x2b,0x99,0x01,0x39,0x3c,0x3a,0x3b,0x1a,
+0x90,0xb2,0xb3,0xb3,0x92,0x39,0x1b,0xb1,0xa3,0x21,0x4b,0x3c,0x99,0x92,0x19,0x99,
+0xc3,0xa3,0x21,0x3b,0x0a,0xb2,0xb3,0xb3,0xa3,0x49,0x3c,0x1a,0x00,0x19,0x3b,0x99,
+0xc3,0x93,0x3a,0x3a,0x3b,0x2b,0x09,0x00,0x00,0x00,0x10,0x3a,0x3b,0x1a,0x90,0xc3,
+0xb3,0xa4,0xb2,0x01,0x39,0x1b,0xb1,0x93,0x00,0xb1,0x93,0x39,0x1b,0x19,0x91,0x91,
+0x10,0x3a,0x3b,0x1a,0xa1,0xb3,0xb3,0xb3,0x21,0x4b,0x3c,0x09,0x18,0x09,0x91,0x39,
+0x4d,0x2c,0x09,0x18,0x3a,0x3b,0x90,0x91,0xc3,0xa3,0x21,0x3b,0x1a,0x00,0x19,0x90,
+0x01,0x00,0x90,0xb3,0xb2,0x92,0x91,0x19,0x90,0xb2,0xb3,0xb3,0xb3,0xb3,0xa3,0x91,
+0x91,0x11,0x19,0x99,0xb3,0xb3,0x01,0x29,0x2b,0x99,0xb2,0xb3,0xb3,0x21,0x3b,0x2b,
+0x99,0xb2,0xa3,0x20,0x3b,0x3b,0x3b,0x3b,0x3b,0x1a,0x10,0x19,0x19,0x19,0x09,0x91,
+0x19,0x29,0x99,0xa1,0xa3,0x11,0x3a,0x3b,0x3b,0x1a,0x00,0x10,0x09,0x10,0x19,0x09,
+0xa1,0xb3,0xb3,0xb3,0xb3,0x92,0x19,0x90,0xb2,0xa3,0xb2,0xb3,0xa3,0xb2,0xb3,0x93,
+0x99,0x91,0x01,0x19,0x19,0x90,0x91,0x91,0x91,0xb2,0x21,0x3b,0x3b,0x3b,0x3b,0x1a,
+0x10,0x19,0x3a,0x1a,0xb1,0x93,0x39,0x3c,0x5b,0x4b,0x3c,0x0a,0x91,0x00,0x99,0x01,
+0x39,0x3d,0x3b,0x09,0xb2,0xb3,0xb3,0x92,0x00,0x00,0xa1,0xb3,0xa3,0x01,0x00,0x00,
+0x00,0x00,0x10,0x3a,0x1a,0x19,0x19,0x19,0x90,0x91,0xb3,0xd3,0xa3,0xb3,0x93,0x29,
+0x2b,0x09,0x00,0x00,0x00,0x39,0x3c,0x3b,0xa1,0xa3,0x11,0x3a,0x1a,0x19,0x10,0x3b,
+0x3b,0x99,0x01,0x00,0x19,0x29,0x2b,0x19,0x09,0x90,0x01,0x00,0x90,0xb2,0x92,0x90,
+0xb2,0xb3,0x21,0x2b,0x99,0xc3,0xa3,0x92,0x19,0x19,0x90,0xb3,0xa2,0x01,0x91,0x39,
+0x3c,0x3b,0x19,0x00,0x10,0x2a,0x09,0x00,0x29,0x3b,0x2b,0x09,0x00,0x29,0x3b,0x2b,
+0x09,0x90,0x01,0x00,0x19,0x00,0x00,0x19,0x90,0xb2,0x21,0x3b,0x3b,0x99,0x00,0x39,
+0x3c,0x4b,0x2a,0x1b,0x29,0x3b,0x9a,0xb3,0xb3,0xb3,0x92,0x00,0x00,0x00,0x00,0x00,
+0x29,0x3b,0x2b,0xa0,0xb3,0x92,0x00,0x00,0x00,0x90,0xa2,0x11,0x2a,0xa0,0xb3,0xa3,
+0x11,0x19,0x09,0x91,0x91,0x10,0x19,0x19,0x19,0x09,0xb1,0xb4,0x92,0x4b,0x3b,0x9b,
+0xb2,0xb3,0x92,0x29,0x3b,0x3b,0x3b,0x3b,0x2b,0x99,0x11,0x19,0x19,0x19,0x3a,0x3b,
+0x3b,0xa9,0xb3,0x93,0x09,0xa1,0xc3,0xb4,0xa2,0x91,0x10,0x3b,0x3b,0x09,0x90,0x91,
+0xb2,0x92,0x10,0x19,0x19,0x3a,0x1a,0x90,0xa2,0x11,0x3a,0x3b,0x3b,0x3b,0x2b,0xa0,
+0xb3,0xa3,0x01,0x10,0x99,0xa2,0x11,0x3b,0x3b,0x09,0xa1,0xb3,0xb3,0x92,0x19,0x29,
+0x3b,0x3b,0x99,0x29,0x3b,0x1a,0x29,0x3b,0x2b,0x99,0x11,0x4b,0x3b,0x9b,0xb2,0xb3,
+0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0x02,0x4b,0x4c,0x3c,0x3b,0x3b,0x09,0x39,
+0x3b,0x3b,0xa9,0xb3,0xb3,0xb3,0x92,0x29,0x3b,0x2b,0xa0,0xb3,0xb3,0xb3,0xb3,0xb3,
+0xa3,0x11,0x3a,0x1a,0x19,0x91,0x91,0x10,0x5b,0x3b,0x3c,0x1a,0xb1,0x11,0x2a,0x99,
+0xb3,0x01,0x29,0x3b,0x3b,0x3b,0x3b,0x2b,0x19,0x1a,0xb2,0xa3,0x20,0x2b,0x99,0xb2,
+0x92,0x29,0x2b,0x99,0xb2,0x92,0x91,0x00,0x19,0x10,0x19,0x3a,0x1a,0x19,0x29,0x1a,
+0xa1,0xa3,0x91,0x91,0x11,0x19,0x09,0x00,0xb1,0xc5,0xa3,0x11,0x5b,0x2b,0x09,0x90,
+0x00,0x19,0x90,0xb2,0x92,0x00,0x10,0x3a,0x1b,0x91,0x01,0x19,0x29,0x3b,0x1b,0xb2,
+0x93,0x19,0x19,0x3a,0x2b,0x99,0x91,0xb2,0x92,0x00,0x00,0x00,0x91,0x91,0x10,0x09,
+0xa1,0xb3,0xb3,0xb3,0x92,0x29,0x2b,0x19,0x19,0x3b,0x3b,0x99,0x91,0x11,0x19,0x09,
+0xa1,0xb3,0xa3,0x11,0x3a,0x3b,0x3b,0x1a,0x10,0x3a,0x1a,0xa1,0xb3,0xc4,0xa3,0x92,
+0x10,0x19,0x90,0x91,0x01,0x19,0x19,0x00,0x00,0x29,0x2b,0x99,0xb2,0x92,0xa1,0xb3,
+0xb3,0xa3,0x01,0x90,0xb3,0xa2,0x01,0x91,0x10,0x19,0x19,0x3a,0x1a,0x00,0x00,0x19,
+0x29,0x2b,0x19,0x09,0x29,0x3b,0x0a,0xc3,0x93,0x90,0xb2,0x93,0x09,0x91,0x91,0x10,
+0x19,0x3a,0x3b,0x1a,0xb1,0xb3,0xb4,0xa2,0x91,0x91,0x11,0x3b,0x4b,0x3b,0x2c,0x3a,
+0x19,0x09,0xa1,0xb3,0xb3,0xa3,0x01,0x19,0x91,0x91,0x39,0x3b,0x1b,0x19,0x90,0xb2,
+0x93,0x3a,0x3b,0x1a,0x00,0x00,0xa1,0xb3,0xb3,0xb3,0xb3,0xa3,0x91,0xa2,0x91,0x01,
+0x91,0x91,0x10,0x19,0x3a,0x3b,0x1b,0x91,0x11,0x19,0x19,0x3a,0x1a,0x90,0x11,0x19,
+0x09,0x91,0xa1,0xa3,0x11,0x5b,0x3b,0x2b,0x1b,0x19,0x00,0x91
+};
@@ -0,0 +1,6332 @@
+// This file was generated by executing this statement: wav2c -a pacman_beginning_48k.wav
+
+#include <stdint.h>
+
+const uint8_t pacman_beginning_48k_wav_adpcm[101203] = {
+0xff,0xdf,0x10,0x11,0x00,0xaa,0x89,0x30,0x22,0xb0,0xdb,0x88,0x24,0x02,0xba,0x8d,
+0x20,0x24,0xa0,0xdb,0x88,0x33,0x84,0xb9,0x9c,0x48,0x32,0x90,0xbd,0x09,0x43,0x12,
+0xbb,0x9d,0x21,0x25,0x19,0x8e,0x2b,0x21,0x94,0xd0,0x99,0x20,0x23,0xb1,0x9d,0x1b,
+0x43,0x03,0xac,0x9c,0x31,0x25,0x98,0xad,0x29,0x71,0x18,0xaa,0x9a,0x21,0x16,0xa0,
+0xbb,0x3b,0x73,0x92,0xd8,0xa9,0x21,0x15,0xa1,0xac,0x1a,0x34,0x83,0xea,0x9b,0x40,
+0x43,0x98,0xad,0x89,0x34,0x12,0xda,0xab,0x50,0x42,0x88,0xbc,0x0a,0x63,0x12,0xba,
+0x9d,0x38,0x34,0x80,0xbd,0x0b,0x63,0x12,0xb9,0x9e,0x28,0x34,0x80,0xcc,0x8a,0x43,
+0x14,0xc9,0xbb,0x40,0x34,0xa1,0xbe,0x1a,0x45,0x82,0xfb,0xac,0x31,0x36,0xa1,0xdd,
+0x1a,0x67,0x45,0x23,0x01,0x99,0x9b,0x29,0x53,0x24,0x13,0x11,0x12,0x43,0x33,0x24,
+0x33,0x34,0x34,0x33,0x34,0x23,0x12,0x01,0x80,0x10,0x00,0xca,0xcc,0x9c,0x9a,0xb9,
+0xec,0xbc,0xbc,0xbb,0xcc,0xdb,0xcb,0xba,0xaa,0xbb,0xbd,0xab,0xab,0xaa,0xba,0xcb,
+0x9a,0x10,0x22,0x82,0xca,0x9a,0x50,0x54,0x43,0x33,0x35,0x44,0x43,0x33,0x22,0x81,
+0x99,0xab,0x08,0x42,0x43,0x02,0x01,0x21,0x13,0xfc,0xff,0xcb,0xbb,0xab,0x9a,0xaa,
+0xba,0xcc,0xbc,0xcb,0xaa,0x18,0x43,0x25,0x12,0x90,0x9a,0x89,0x08,0x98,0x9a,0x50,
+0x57,0x44,0x33,0x23,0x22,0x22,0x22,0x43,0x53,0x33,0x33,0x91,0xda,0xcb,0x9b,0x09,
+0x11,0x12,0x11,0x10,0x00,0xc9,0xdd,0xcd,0xdb,0xba,0xbb,0xba,0xba,0xcc,0xbc,0xbc,
+0xbb,0xbb,0xbd,0xdb,0xba,0xaa,0x99,0x98,0x99,0x8a,0x18,0x33,0x25,0x02,0x21,0x53,
+0x45,0x43,0x24,0x33,0x35,0x44,0x32,0x23,0x32,0x31,0x22,0x23,0x33,0x43,0x32,0x13,
+0x81,0xca,0xbb,0x9a,0x99,0xfb,0xcd,0xcc,0xcb,0xbb,0xbd,0xbd,0xcb,0xba,0xaa,0xaa,
+0xaa,0xbb,0xca,0xba,0xbb,0xac,0x9a,0x08,0x42,0x45,0x54,0x34,0x34,0x23,0x32,0x43,
+0x44,0x43,0x43,0x22,0x33,0x35,0x34,0x33,0x12,0x00,0x10,0x11,0x00,0xa9,0xbc,0x8a,
+0x10,0x23,0xa8,0xde,0xdb,0xbb,0xcc,0xcc,0xcb,0xab,0xab,0x99,0x99,0x99,0xa9,0xca,
+0xbb,0xac,0x9b,0x89,0x20,0x53,0x44,0x44,0x53,0x32,0x33,0x24,0x34,0x44,0x43,0x33,
+0x42,0x32,0x33,0x34,0x22,0x12,0x21,0x11,0x22,0x00,0xa8,0xcc,0xdb,0xcc,0xbc,0xbc,
+0xcb,0xbb,0xcc,0xcb,0xbc,0xcb,0xbb,0xbb,0xbc,0xcb,0xba,0x9a,0x9a,0x9a,0xaa,0x89,
+0x20,0x24,0x12,0x90,0x99,0x52,0x46,0x53,0x32,0x44,0x43,0x34,0x24,0x21,0x00,0x88,
+0x00,0x22,0x32,0x22,0x22,0x12,0x12,0x90,0xef,0xcd,0xcc,0xac,0xab,0xaa,0xaa,0xcb,
+0xdb,0xbb,0xcb,0xba,0xbc,0xbc,0xac,0xaa,0x8a,0x99,0x99,0x99,0x08,0x32,0x43,0x12,
+0x11,0x63,0x44,0x44,0x33,0x43,0x35,0x34,0x43,0x33,0x42,0x32,0x34,0x33,0x12,0x11,
+0x21,0x22,0x12,0xa8,0xbb,0x8b,0x43,0x24,0xb0,0xdf,0xbc,0xcb,0xca,0xbc,0xbc,0xac,
+0x9a,0x00,0x11,0x01,0xa9,0xcb,0xab,0x9b,0x99,0x9a,0x18,0x66,0x55,0x44,0x32,0x23,
+0x23,0x32,0x63,0x43,0x33,0x33,0x43,0x53,0x43,0x23,0x13,0x11,0x10,0x11,0x12,0x98,
+0xcb,0xcb,0xa9,0xa8,0xdb,0xcd,0xbc,0xcb,0xac,0xbc,0xbc,0xac,0xba,0xba,0xcc,0xbb,
+0xab,0xaa,0x9a,0xaa,0xab,0x89,0x31,0x24,0x82,0xa9,0x18,0x74,0x34,0x34,0x34,0x35,
+0x44,0x24,0x23,0x12,0x80,0xa9,0x89,0x20,0x33,0x23,0x02,0x10,0x32,0xb2,0xff,0xff,
+0xbb,0xab,0xab,0xaa,0xaa,0xbb,0xcc,0xcb,0xab,0x9a,0x31,0x35,0x25,0x11,0x88,0x89,
+0x80,0x01,0x88,0x18,0x64,0x46,0x53,0x32,0x22,0x21,0x21,0x22,0x43,0x53,0x33,0x22,
+0x90,0xcb,0xcb,0x99,0x00,0x01,0x01,0x00,0x10,0x00,0xda,0xce,0xbd,0xcc,0xaa,0xab,
+0xaa,0xbb,0xdc,0xbb,0xbc,0xbb,0xcb,0xcb,0xbc,0xbb,0x9a,0x98,0x99,0xaa,0x8a,0x20,
+0x35,0x23,0x12,0x31,0x47,0x53,0x33,0x34,0x53,0x34,0x25,0x23,0x13,0x22,0x22,0x32,
+0x22,0x32,0x32,0x34,0x23,0x91,0xcb,0xab,0x8a,0x99,0xdd,0xdc,0xcb,0xbb,0xcd,0xdb,
+0xbb,0xbc,0xab,0x9a,0xaa,0xab,0xba,0xbb,0xbc,0xcb,0xab,0x8a,0x20,0x53,0x45,0x35,
+0x45,0x32,0x23,0x32,0x53,0x44,0x33,0x34,0x32,0x34,0x44,0x33,0x33,0x11,0x10,0x11,
+0x21,0x80,0xbb,0xac,0x19,0x42,0x02,0xe9,0xcc,0xbb,0xbc,0xcc,0xbc,0xbd,0xaa,0x9a,
+0x99,0x98,0xaa,0xba,0xbb,0xbc,0xcb,0x9a,0x00,0x32,0x44,0x34,0x45,0x34,0x34,0x32,
+0x33,0x45,0x34,0x34,0x33,0x23,0x24,0x43,0x33,0x22,0x12,0x11,0x22,0x21,0x80,0xc9,
+0xdb,0xcb,0xcc,0xcc,0xbb,0xbc,0xbb,0xdc,0xcb,0xac,0xbb,0xbb,0xcb,0xbb,0xac,0xab,
+0x9a,0x9a,0xb9,0x9a,0x09,0x42,0x33,0x01,0xa9,0x08,0x65,0x44,0x43,0x33,0x44,0x34,
+0x34,0x24,0x11,0x00,0x00,0x10,0x11,0x32,0x22,0x23,0x13,0x01,0xd9,0xde,0xcd,0xcc,
+0xbb,0xbb,0xaa,0xba,0xcc,0xdb,0xab,0xbb,0xcb,0xdb,0xbb,0xac,0x9a,0x89,0x98,0xa9,
+0x99,0x10,0x43,0x23,0x22,0x21,0x45,0x35,0x44,0x33,0x44,0x53,0x33,0x24,0x33,0x33,
+0x44,0x33,0x22,0x02,0x11,0x22,0x22,0x01,0xb9,0xbb,0x18,0x43,0x92,0xdd,0xbd,0xbc,
+0xcb,0xcc,0xcc,0xbb,0xab,0x89,0x18,0x11,0x88,0xb9,0xdb,0xba,0x9a,0x9a,0x88,0x31,
+0x77,0x44,0x44,0x33,0x22,0x22,0x42,0x43,0x34,0x43,0x32,0x33,0x44,0x33,0x33,0x22,
+0x11,0x11,0x12,0x01,0xa9,0xcb,0xac,0xaa,0xda,0xeb,0xbc,0xbc,0xdb,0xbb,0xcd,0xca,
+0xaa,0xab,0xbb,0xbc,0xac,0xaa,0x99,0x9a,0xaa,0xaa,0x08,0x31,0x33,0x81,0x99,0x50,
+0x55,0x35,0x43,0x34,0x44,0x43,0x33,0x33,0x01,0x98,0x99,0x08,0x22,0x24,0x13,0x11,
+0x22,0x13,0xf9,0xff,0xbd,0xbc,0xbb,0xab,0xaa,0xaa,0xcb,0xcc,0xbb,0xaa,0x19,0x43,
+0x25,0x13,0x80,0x99,0x88,0x08,0x81,0x88,0x40,0x66,0x44,0x34,0x23,0x33,0x22,0x22,
+0x32,0x35,0x44,0x22,0x02,0xa9,0xbb,0x9c,0x09,0x21,0x21,0x11,0x80,0x80,0x98,0xdd,
+0xcd,0xbd,0xbc,0xbb,0xab,0xbb,0xcc,0xbc,0xbc,0xbb,0xbb,0xcc,0xcb,0xbb,0xab,0xaa,
+0x99,0xa9,0x99,0x08,0x33,0x25,0x22,0x21,0x44,0x55,0x33,0x34,0x53,0x43,0x34,0x34,
+0x32,0x22,0x22,0x32,0x43,0x22,0x22,0x23,0x24,0x01,0xa9,0xbb,0x9c,0x88,0xa8,0xde,
+0xcc,0xac,0xbb,0xbd,0xbc,0xbd,0xba,0xab,0xaa,0xaa,0xbb,0xbc,0xba,0xcb,0xbb,0x9b,
+0x09,0x42,0x44,0x45,0x34,0x35,0x33,0x24,0x42,0x43,0x34,0x43,0x23,0x33,0x44,0x34,
+0x43,0x12,0x10,0x00,0x10,0x01,0x90,0xb9,0xbb,0x08,0x31,0x91,0xdd,0xbd,0xbc,0xbc,
+0xcc,0xbc,0xcb,0xab,0xa9,0x99,0x99,0xba,0xba,0xbb,0xcb,0xab,0x99,0x10,0x53,0x44,
+0x44,0x44,0x43,0x23,0x33,0x53,0x53,0x43,0x33,0x24,0x32,0x43,0x33,0x33,0x22,0x01,
+0x21,0x32,0x12,0x90,0xdb,0xdb,0xcb,0xcd,0xdb,0xab,0xac,0xba,0xcc,0xdb,0xbb,0xcb,
+0xaa,0xbb,0xbc,0xac,0x9b,0x99,0x99,0xaa,0x9a,0x18,0x42,0x13,0x91,0x99,0x38,0x47,
+0x35,0x33,0x35,0x34,0x35,0x34,0x22,0x11,0x01,0x10,0x10,0x22,0x23,0x33,0x33,0x12,
+0x90,0xfd,0xec,0xbc,0xbd,0xba,0xab,0xaa,0xcb,0xcc,0xac,0xbb,0xbb,0xbc,0xdb,0xbb,
+0xab,0x9b,0x99,0xa9,0xaa,0x09,0x31,0x44,0x22,0x12,0x32,0x47,0x53,0x33,0x34,0x44,
+0x53,0x33,0x24,0x32,0x32,0x34,0x33,0x23,0x11,0x12,0x32,0x12,0x90,0xca,0x8a,0x30,
+0x25,0xa0,0xde,0xbc,0xbb,0xcc,0xdb,0xdb,0xba,0xaa,0x09,0x00,0x01,0x88,0xba,0xbb,
+0xcb,0xaa,0xaa,0x18,0x65,0x55,0x34,0x44,0x22,0x22,0x21,0x43,0x34,0x44,0x22,0x23,
+0x33,0x44,0x33,0x33,0x21,0x00,0x11,0x21,0x00,0xca,0xac,0xab,0x99,0xca,0xdd,0xbc,
+0xac,0xac,0xcc,0xbb,0xad,0xab,0xaa,0xcb,0xbb,0xac,0xaa,0x99,0xaa,0xaa,0x9a,0x28,
+0x32,0x12,0x88,0x10,0x74,0x44,0x34,0x34,0x34,0x35,0x34,0x43,0x21,0x00,0x89,0x89,
+0x28,0x32,0x33,0x13,0x11,0x33,0x92,0xff,0xcf,0xbc,0xac,0xab,0xaa,0xaa,0xaa,0xbc,
+0xbc,0xbc,0x9b,0x18,0x53,0x24,0x12,0x90,0x99,0x88,0x00,0x80,0x88,0x62,0x56,0x34,
+0x44,0x22,0x22,0x11,0x22,0x22,0x44,0x33,0x14,0x81,0xb9,0xcb,0x9a,0x00,0x12,0x12,
+0x01,0x00,0x08,0xca,0xdd,0xcd,0xdb,0xba,0xbb,0xba,0xbb,0xcd,0xcb,0xbb,0xac,0xbb,
+0xbc,0xbc,0xcb,0x9a,0x99,0x89,0x9a,0x89,0x18,0x33,0x43,0x22,0x33,0x46,0x44,0x33,
+0x34,0x44,0x53,0x33,0x34,0x32,0x22,0x22,0x32,0x32,0x33,0x33,0x43,0x23,0x81,0xba,
+0xac,0xab,0xaa,0xcd,0xbe,0xbd,0xcb,0xbc,0xcc,0xbc,0xbb,0xac,0xaa,0xba,0xba,0xba,
+0xaa,0xcb,0xbb,0xbc,0x9a,0x00,0x43,0x54,0x35,0x35,0x34,0x33,0x33,0x53,0x44,0x43,
+0x32,0x33,0x34,0x44,0x33,0x33,0x12,0x10,0x10,0x11,0x01,0xa9,0xbc,0x9a,0x10,0x11,
+0xd9,0xdd,0xcb,0xcb,0xcb,0xcc,0xbb,0xbc,0xaa,0x9a,0x99,0xaa,0xaa,0xbb,0xbc,0xcb,
+0xaa,0x88,0x31,0x54,0x43,0x53,0x43,0x34,0x33,0x25,0x34,0x53,0x43,0x32,0x23,0x33,
+0x34,0x24,0x23,0x12,0x11,0x12,0x21,0x00,0xa9,0xdb,0xbc,0xcc,0xbc,0xbd,0xbc,0xbb,
+0xbc,0xbd,0xcc,0xbb,0xbb,0xac,0xbb,0xbc,0xbb,0xaa,0xaa,0xa9,0xab,0x89,0x30,0x35,
+0x22,0x88,0x09,0x72,0x54,0x43,0x33,0x53,0x34,0x44,0x32,0x12,0x01,0x10,0x11,0x22,
+0x23,0x23,0x32,0x32,0x22,0xb9,0xff,0xcc,0xcc,0xbb,0xbb,0xbb,0xcb,0xdb,0xcb,0xcb,
+0xbb,0xbb,0xbc,0xad,0xbb,0xab,0x9a,0x99,0xaa,0x99,0x18,0x42,0x33,0x23,0x32,0x55,
+0x44,0x34,0x43,0x43,0x44,0x43,0x23,0x33,0x43,0x33,0x34,0x32,0x22,0x11,0x21,0x32,
+0x11,0xa9,0xbc,0x8a,0x11,0x13,0xfa,0xcd,0xbc,0xbc,0xcb,0xcc,0xcb,0xbb,0x9a,0x88,
+0x00,0x81,0xa9,0xca,0xbb,0xaa,0xa9,0x98,0x31,0x67,0x54,0x43,0x34,0x32,0x22,0x33,
+0x44,0x53,0x33,0x33,0x24,0x43,0x43,0x32,0x22,0x11,0x11,0x11,0x11,0x98,0xdb,0xab,
+0x9a,0xa9,0xec,0xcc,0xcb,0xba,0xbc,0xcc,0xbc,0xcb,0xaa,0xab,0xcb,0xbb,0xbb,0xaa,
+0xaa,0xca,0xba,0x09,0x32,0x33,0x82,0x88,0x50,0x55,0x44,0x32,0x34,0x44,0x44,0x23,
+0x33,0x12,0x81,0x88,0x08,0x10,0x33,0x33,0x22,0x22,0x23,0xf8,0xdf,0xbe,0xbd,0xcb,
+0x9a,0x9a,0xaa,0xbb,0xcc,0xcb,0xba,0x9a,0x20,0x53,0x23,0x01,0x98,0x8a,0x88,0x81,
+0x80,0x38,0x67,0x54,0x43,0x33,0x23,0x23,0x22,0x33,0x44,0x34,0x43,0x22,0x90,0xb9,
+0xac,0x99,0x10,0x12,0x22,0x01,0x00,0xa8,0xdc,0xdd,0xdb,0xbb,0xbc,0xab,0xbb,0xbc,
+0xbd,0xcc,0xba,0xab,0xbc,0xcb,0xcb,0xba,0x9a,0xa9,0xa9,0xaa,0x0a,0x30,0x43,0x22,
+0x11,0x44,0x45,0x34,0x43,0x43,0x34,0x35,0x43,0x23,0x23,0x22,0x23,0x22,0x23,0x33,
+0x43,0x23,0x22,0x10,0x10,0x41,0x43,0x24,0x11,0x00,0x80,0x00,0x88,0xa9,0xcb,0xbb,
+0x09,0x63,0x44,0x23,0x01,0x88,0x09,0x11,0x01,0xba,0x9e,0x71,0x47,0x44,0x23,0x12,
+0x00,0x88,0x00,0x80,0xa9,0xbc,0x19,0x57,0x45,0x33,0x22,0x80,0xa8,0x98,0x08,0x99,
+0xbb,0x8b,0x73,0x37,0x34,0x12,0x80,0x99,0x89,0x89,0x99,0xba,0x9b,0x50,0x56,0x43,
+0x13,0x01,0x99,0xaa,0x9a,0x98,0xa9,0xbb,0xab,0x31,0x47,0x22,0x81,0x99,0xaa,0xbb,
+0xcd,0xbc,0xab,0x28,0x44,0x24,0x13,0x80,0x99,0xba,0xbc,0xbb,0x9c,0x9a,0xdc,0xdd,
+0xbc,0xad,0xab,0x89,0x08,0x00,0x99,0xbb,0xab,0xa9,0xfb,0xdd,0xbc,0xab,0x8a,0x08,
+0x80,0xaa,0x89,0x11,0xc0,0xff,0xcd,0xbb,0xaa,0x89,0x88,0x98,0xaa,0x99,0x01,0x90,
+0xdf,0xcd,0xac,0xaa,0x89,0x88,0x88,0x99,0x89,0x20,0x81,0xfc,0xce,0xbc,0xaa,0x8a,
+0x88,0x90,0x98,0x89,0x10,0x11,0xb9,0xdf,0xcb,0xaa,0x89,0x08,0x00,0x88,0x88,0x00,
+0x00,0x99,0xcc,0xcb,0xbb,0x9b,0x9a,0x88,0x11,0x32,0x23,0x22,0x73,0x56,0x54,0x33,
+0x22,0x01,0x08,0x20,0x33,0x13,0xa8,0x39,0x77,0x47,0x23,0x13,0x00,0x08,0x18,0x11,
+0x81,0xba,0x19,0x77,0x45,0x33,0x22,0x81,0x88,0x00,0x11,0x80,0xa9,0x0a,0x73,0x47,
+0x33,0x23,0x11,0x08,0x08,0x08,0x90,0xa9,0x9a,0x31,0x47,0x34,0x23,0x01,0x98,0x9a,
+0x89,0x89,0xa9,0xaa,0x08,0x63,0x34,0x24,0x01,0x90,0x88,0xaa,0xbc,0xbb,0xbb,0xed,
+0xcd,0xbd,0xac,0x99,0x88,0x90,0xa8,0x99,0x18,0x81,0xfb,0xcf,0xcb,0xbb,0xaa,0x98,
+0x98,0x99,0x9a,0x89,0x01,0xf9,0xdf,0xcc,0xac,0x9a,0x88,0x01,0x98,0xa9,0x08,0x32,
+0xa2,0xff,0xbe,0xbb,0xab,0x99,0x88,0x80,0x80,0x80,0x88,0x10,0x57,0x45,0x34,0x22,
+0x01,0x88,0x00,0x21,0x80,0xa9,0x89,0x73,0x46,0x33,0x32,0x11,0x00,0x00,0x88,0x80,
+0x11,0x80,0xfb,0xcf,0xac,0xab,0x8a,0x08,0x88,0x98,0x89,0x00,0x02,0xb0,0xdd,0xbc,
+0xbb,0x9a,0x88,0x08,0x08,0x08,0x11,0x10,0xc9,0xdd,0xcc,0xab,0x9a,0x09,0x08,0x80,
+0x08,0x10,0x21,0x01,0xda,0xbd,0xac,0x9a,0x08,0x11,0x12,0x32,0x33,0x23,0xa1,0xee,
+0xcc,0xbb,0xab,0x9a,0x10,0x31,0x34,0x23,0x02,0x30,0x75,0x45,0x44,0x22,0x12,0x01,
+0x01,0x11,0x00,0x89,0x09,0x64,0x45,0x24,0x22,0x01,0x08,0x11,0x23,0x12,0xb8,0x8b,
+0x73,0x77,0x43,0x22,0x01,0x88,0x08,0x21,0x21,0x90,0xaa,0x48,0x67,0x34,0x24,0x11,
+0x80,0x80,0x10,0x00,0x99,0x9a,0x28,0x65,0x44,0x32,0x21,0x00,0x80,0x00,0x08,0x98,
+0xa9,0x88,0x73,0x45,0x34,0x22,0x00,0x98,0x89,0x00,0x81,0xa9,0xab,0x40,0x46,0x33,
+0x02,0xa8,0x9b,0x09,0x11,0xa8,0xcd,0xaa,0x28,0x45,0x33,0x12,0x81,0x88,0x08,0x89,
+0xbb,0xce,0xeb,0xdb,0xbc,0xbd,0xbb,0xaa,0x99,0x99,0xa9,0x99,0x20,0x11,0xfc,0xce,
+0xbc,0xab,0x99,0x88,0xa8,0x9a,0x0a,0x32,0x02,0xfd,0xce,0xbc,0xba,0x9a,0x88,0x88,
+0x99,0xa9,0x08,0x11,0xc0,0xef,0xcc,0xbb,0x9a,0x09,0x80,0x88,0x99,0x10,0x22,0xc0,
+0xff,0xdb,0xab,0xaa,0x88,0x08,0x88,0x08,0x10,0x22,0x80,0xeb,0xbd,0xbc,0x9b,0x99,
+0x08,0x88,0x88,0x21,0x43,0x13,0xc9,0xce,0xab,0x8a,0x10,0x11,0x00,0x08,0x21,0x22,
+0x22,0x65,0x46,0x44,0x13,0x02,0x80,0x10,0x32,0x13,0x90,0x8a,0x73,0x57,0x24,0x23,
+0x12,0x00,0x18,0x10,0x01,0x98,0x89,0x72,0x57,0x34,0x33,0x22,0x00,0x08,0x10,0x01,
+0x98,0xaa,0x48,0x67,0x53,0x22,0x12,0x08,0x08,0x08,0x00,0x88,0x98,0x00,0x53,0x44,
+0x23,0x12,0x01,0x88,0x00,0x80,0x98,0xaa,0x8b,0x51,0x45,0x23,0x02,0x90,0x80,0x08,
+0xba,0xcd,0xbb,0xaa,0xec,0xcd,0xcc,0xaa,0x99,0x80,0xa9,0xbb,0xab,0x00,0x82,0xfc,
+0xce,0xac,0xbb,0x9a,0x99,0x88,0x89,0x89,0x08,0x98,0xfc,0xcf,0xcc,0xab,0x9a,0x00,
+0x80,0xa8,0x9a,0x28,0x33,0xe8,0xff,0xcb,0xab,0xaa,0x88,0x08,0x80,0x08,0x88,0x88,
+0x41,0x47,0x45,0x33,0x12,0x81,0x08,0x10,0x21,0x90,0xaa,0x2a,0x66,0x44,0x33,0x22,
+0x01,0x10,0x08,0x80,0x80,0x01,0xa8,0xee,0xcd,0xbb,0xbb,0x89,0x00,0x88,0x99,0x89,
+0x11,0x01,0xca,0xce,0xac,0x9b,0x8a,0x08,0x80,0x08,0x00,0x11,0x81,0xea,0xdc,0xcb,
+0xaa,0x09,0x08,0x00,0x88,0x08,0x20,0x12,0x81,0xdb,0xbc,0xbb,0x8a,0x08,0x01,0x32,
+0x55,0x44,0x22,0xa0,0xdd,0xac,0xaa,0x08,0x11,0x11,0x08,0x00,0x21,0x42,0x63,0x44,
+0x45,0x33,0x33,0x21,0x10,0x10,0x11,0x00,0x00,0x42,0x47,0x44,0x33,0x32,0x01,0x80,
+0x00,0x21,0x22,0x00,0x20,0x77,0x46,0x43,0x22,0x02,0x80,0x00,0x22,0x01,0x98,0x19,
+0x74,0x37,0x43,0x23,0x11,0x00,0x00,0x00,0x80,0x99,0x09,0x72,0x45,0x34,0x23,0x02,
+0x00,0x88,0x00,0x80,0xa9,0x9a,0x50,0x47,0x34,0x23,0x01,0x80,0x80,0x01,0x88,0xca,
+0xab,0x09,0x63,0x24,0x23,0x01,0x80,0x90,0xa8,0xcb,0xac,0x9a,0x89,0x00,0x00,0x88,
+0x08,0x11,0xb8,0xef,0xcb,0xbb,0xaa,0xda,0xce,0xbd,0xbc,0xaa,0x99,0x88,0xa8,0x9a,
+0x89,0x00,0xc0,0xee,0xbc,0xac,0xaa,0x88,0x88,0xa9,0x9a,0x09,0x21,0xc1,0xef,0xcd,
+0xbb,0xbb,0x99,0x88,0x88,0x9a,0x89,0x31,0x02,0xfc,0xcf,0xbb,0xbb,0x89,0x88,0x98,
+0xa9,0x08,0x42,0x12,0xfb,0xcf,0xdb,0xaa,0x8a,0x09,0x80,0x80,0x80,0x00,0x11,0x80,
+0xeb,0xcd,0xbb,0x9a,0x09,0x11,0x01,0x88,0x18,0x21,0x01,0xda,0xcd,0xab,0x89,0x08,
+0x08,0x00,0x42,0x34,0x12,0x10,0x73,0x55,0x34,0x23,0x01,0x00,0x21,0x43,0x12,0x98,
+0x19,0x76,0x44,0x24,0x13,0x01,0x10,0x10,0x22,0x01,0x98,0x19,0x75,0x45,0x34,0x33,
+0x13,0x00,0x00,0x10,0x80,0xa9,0x99,0x73,0x47,0x43,0x22,0x11,0x08,0x08,0x11,0x00,
+0xa8,0xaa,0x18,0x64,0x43,0x23,0x02,0x80,0x80,0x88,0x98,0xa9,0x9a,0x28,0x54,0x44,
+0x22,0x81,0x98,0xa9,0x99,0x98,0x88,0xaa,0xfc,0xdc,0xcc,0xba,0xab,0x99,0x99,0xab,
+0x9b,0x18,0x12,0xfb,0xdf,0xcc,0xba,0x9a,0x99,0x08,0x89,0x99,0x89,0x00,0xa0,0xfe,
+0xce,0xbc,0xbb,0x89,0x08,0x80,0xa9,0x09,0x31,0x93,0xff,0xcd,0xac,0x9b,0x99,0x08,
+0x88,0x88,0x80,0x80,0x80,0x52,0x47,0x35,0x33,0x02,0x00,0x08,0x20,0x01,0x98,0x8a,
+0x61,0x46,0x34,0x23,0x11,0x01,0x01,0x08,0x88,0x08,0x01,0xd9,0xde,0xbd,0xcb,0x9a,
+0x88,0x80,0x98,0x89,0x08,0x11,0x80,0xcc,0xbd,0xbb,0x9b,0x89,0x00,0x88,0x80,0x00,
+0x01,0x90,0xed,0xcc,0xac,0x9a,0x09,0x80,0x80,0x88,0x18,0x22,0x02,0xc9,0xcc,0xab,
+0x99,0x00,0x88,0x08,0x32,0x37,0x24,0x80,0xca,0xdc,0xba,0xab,0x9a,0x08,0x32,0x24,
+0x02,0x90,0x28,0x67,0x54,0x43,0x22,0x11,0x10,0x11,0x33,0x33,0x80,0x99,0x51,0x47,
+0x34,0x23,0x12,0x00,0x11,0x31,0x11,0x90,0x09,0x75,0x55,0x44,0x23,0x13,0x01,0x00,
+0x10,0x11,0x80,0x9a,0x48,0x57,0x45,0x33,0x13,0x00,0x88,0x18,0x11,0x01,0xa9,0x09,
+0x73,0x37,0x43,0x12,0x01,0x08,0x08,0x00,0x90,0xa8,0x08,0x73,0x45,0x43,0x22,0x81,
+0x88,0x89,0x08,0x08,0x98,0xaa,0x19,0x54,0x35,0x23,0x80,0xa9,0x8a,0x08,0x80,0xba,
+0xbd,0x0a,0x73,0x44,0x23,0x02,0xa9,0xbc,0xbb,0x89,0x11,0xa0,0xee,0xcc,0xbc,0xaa,
+0x9a,0x8a,0x99,0xa9,0xba,0xbb,0xbb,0xcc,0xdd,0xbd,0xbc,0xab,0x88,0x08,0xa9,0xbb,
+0x89,0x42,0x91,0xff,0xcd,0xab,0x9b,0x89,0x88,0xba,0xcb,0x9b,0x09,0x98,0xec,0xcc,
+0xbc,0xaa,0x89,0x08,0x80,0x88,0x88,0x21,0x91,0xfd,0xdd,0xbb,0xbb,0x8a,0x88,0x88,
+0x99,0x09,0x32,0x14,0xc8,0xce,0xac,0x9a,0x88,0x81,0x90,0x89,0x18,0x32,0x12,0xa8,
+0xcd,0xbb,0xaa,0xaa,0x88,0x11,0x25,0x23,0x81,0x08,0x73,0x47,0x34,0x24,0x12,0x01,
+0x11,0x21,0x22,0x81,0x99,0x61,0x57,0x44,0x23,0x22,0x00,0x10,0x21,0x13,0x90,0xaa,
+0x58,0x67,0x44,0x33,0x22,0x00,0x00,0x00,0x01,0x90,0x99,0x29,0x75,0x44,0x24,0x13,
+0x11,0x80,0x80,0x80,0x00,0x88,0x08,0x31,0x36,0x25,0x23,0x01,0x88,0x88,0x00,0x10,
+0x88,0x99,0x08,0x53,0x44,0x23,0x13,0x10,0x10,0x11,0x90,0xec,0xcc,0xbd,0xbc,0xcb,
+0xba,0xba,0xbb,0xac,0x8a,0x10,0x12,0xd8,0xee,0xbc,0xad,0xbb,0x9a,0x8a,0x98,0x88,
+0x88,0x08,0x90,0xfd,0xdd,0xbd,0xcb,0x8a,0x09,0x80,0x98,0x99,0x18,0x32,0xc1,0xff,
+0xcc,0xab,0xab,0x89,0x88,0x80,0x08,0x88,0x08,0x31,0x57,0x45,0x33,0x23,0x01,0x80,
+0x10,0x21,0x80,0xb9,0x09,0x65,0x45,0x33,0x23,0x12,0x11,0x80,0x88,0x88,0x18,0x01,
+0xfa,0xde,0xdb,0xba,0x99,0x09,0x88,0x90,0x88,0x00,0x00,0xb8,0xdd,0xcb,0xaa,0x99,
+0x88,0x98,0x89,0x89,0x11,0x11,0xa0,0xde,0xbc,0xbc,0x9a,0x89,0x00,0x80,0x08,0x08,
+0x00,0x90,0xea,0xbc,0xad,0x89,0x10,0x32,0x01,0x88,0x18,0x44,0x14,0xc8,0xce,0xcb,
+0x8a,0x00,0x12,0x00,0x00,0x28,0x22,0x43,0x44,0x46,0x44,0x32,0x11,0x88,0x88,0x21,
+0x22,0x81,0x88,0x51,0x56,0x24,0x23,0x01,0x01,0x21,0x32,0x11,0x99,0x19,0x67,0x45,
+0x53,0x22,0x11,0x08,0x00,0x10,0x01,0x81,0x09,0x62,0x47,0x34,0x24,0x11,0x80,0x80,
+0x11,0x02,0x90,0xaa,0x38,0x57,0x44,0x22,0x02,0x01,0x18,0x10,0x80,0xa9,0xaa,0x31,
+0x57,0x34,0x23,0x22,0x00,0x80,0x08,0x80,0x80,0x88,0x19,0x71,0x53,0x33,0x13,0x80,
+0x09,0x10,0x12,0xc8,0xdc,0x9a,0x28,0x43,0x34,0x32,0x23,0x82,0xda,0xbd,0x9a,0x10,
+0xa1,0xfe,0xcc,0xab,0xaa,0x98,0xa8,0xba,0x9c,0x89,0x10,0xa8,0xfb,0xeb,0xcb,0xbb,
+0x9c,0x99,0x00,0x00,0xa9,0xaa,0xba,0xed,0xcd,0xbd,0xac,0x9a,0x88,0x80,0x98,0x99,
+0x11,0x23,0xd8,0xcf,0xbd,0xab,0x9a,0x80,0x80,0x99,0x89,0x20,0x23,0xd8,0xef,0xbc,
+0xbc,0x9a,0x88,0x00,0x01,0x08,0x11,0x21,0x81,0xea,0xcc,0xbb,0xaa,0x80,0x11,0x80,
+0x99,0x98,0x11,0x22,0xb8,0xdf,0xcd,0xec,0xcc,0xdc,0xdb,0xbb,0xbc,0xac,0xab,0xaa,
+0x99,0x18,0x21,0x53,0x44,0x53,0x43,0x43,0x33,0x32,0x33,0x32,0x12,0x01,0xb9,0xcd,
+0xbc,0xbd,0xbc,0xbc,0xba,0xaa,0x89,0x18,0x22,0x53,0x53,0x53,0x43,0x34,0x33,0x33,
+0x33,0x32,0x33,0x12,0x90,0xcc,0xcd,0xdb,0xbb,0xbc,0xbb,0xac,0xa9,0x88,0x08,0x22,
+0x34,0x45,0x34,0x44,0x33,0x43,0x32,0x22,0x21,0x10,0x98,0xcb,0xcd,0xbc,0xcc,0xba,
+0xcb,0xaa,0x9a,0x9a,0x89,0x00,0x42,0x44,0x44,0x43,0x43,0x32,0x33,0x22,0x11,0x80,
+0xa8,0xcb,0xcc,0xbd,0xbc,0xbc,0xac,0xab,0xbb,0xaa,0x9b,0x89,0x31,0x64,0x53,0x33,
+0x35,0x43,0x32,0x12,0x01,0x99,0xba,0xcb,0xdb,0xbc,0xcc,0xcb,0xab,0xbb,0xab,0x89,
+0x21,0x43,0x24,0x24,0x44,0x53,0x33,0x34,0x32,0x33,0x33,0x34,0x22,0x80,0xba,0xdd,
+0xdb,0xbb,0xbc,0xbb,0xcb,0xba,0xbb,0xab,0x88,0x42,0x35,0x35,0x34,0x34,0x43,0x23,
+0x12,0x01,0x98,0x99,0xcb,0xcc,0xcc,0xcb,0xcb,0xba,0xab,0xab,0xab,0x99,0x18,0x41,
+0x44,0x35,0x34,0x44,0x32,0x33,0x22,0x12,0x00,0x98,0xba,0xcd,0xcc,0xdb,0xbb,0xcb,
+0xab,0xab,0xab,0x99,0x08,0x32,0x45,0x35,0x34,0x25,0x43,0x22,0x23,0x21,0x11,0x81,
+0xa8,0xdb,0xcc,0xdb,0xcb,0xca,0xaa,0xaa,0xaa,0x98,0x08,0x21,0x53,0x44,0x34,0x25,
+0x24,0x32,0x22,0x13,0x22,0x01,0x90,0xda,0xdb,0xbc,0xcc,0xba,0xac,0xab,0x9a,0x89,
+0x00,0x31,0x43,0x54,0x53,0x43,0x33,0x43,0x32,0x22,0x22,0x11,0x80,0xba,0xcd,0xcc,
+0xbc,0xcb,0xbb,0xcb,0xaa,0x99,0x08,0x20,0x32,0x45,0x34,0x35,0x43,0x43,0x22,0x23,
+0x21,0x01,0x90,0xa9,0xeb,0xbc,0xbd,0xbc,0xac,0xbb,0xbb,0xaa,0x89,0x18,0x31,0x45,
+0x34,0x35,0x34,0x43,0x33,0x32,0x21,0x01,0x80,0xb9,0xeb,0xdb,0xbc,0xbd,0xcb,0xba,
+0xbb,0xaa,0x9a,0x89,0x10,0x53,0x44,0x44,0x33,0x34,0x24,0x22,0x22,0x00,0x80,0xa8,
+0xba,0xcd,0xbd,0xcc,0xbb,0xac,0xbb,0xaa,0xab,0x9a,0x08,0x41,0x44,0x44,0x43,0x43,
+0x42,0x22,0x21,0x00,0x90,0x98,0xba,0xcc,0xcc,0xbc,0xbc,0xac,0xab,0xba,0xaa,0xaa,
+0x09,0x31,0x54,0x44,0x43,0x43,0x43,0x22,0x13,0x12,0x10,0x88,0xa9,0xcb,0xcd,0xbc,
+0xcc,0xba,0xbb,0xbb,0xab,0x99,0x00,0x42,0x53,0x44,0x34,0x53,0x32,0x33,0x33,0x33,
+0x12,0x02,0x90,0xda,0xcc,0xbc,0xbd,0xcb,0xcb,0xaa,0x9a,0x89,0x10,0x31,0x43,0x44,
+0x44,0x43,0x33,0x33,0x33,0x24,0x22,0x22,0x00,0xba,0xcd,0xcc,0xdb,0xca,0xba,0xbb,
+0xba,0xa9,0x88,0x10,0x42,0x63,0x53,0x43,0x24,0x33,0x33,0x23,0x22,0x12,0x80,0xaa,
+0xcd,0xbd,0xcc,0xcb,0xbb,0xcb,0xaa,0xaa,0x99,0x09,0x20,0x63,0x53,0x43,0x24,0x24,
+0x23,0x23,0x11,0x01,0x88,0x9a,0xdb,0xcc,0xbc,0xcc,0xbb,0xcb,0xba,0xba,0xba,0xa9,
+0x18,0x52,0x44,0x53,0x33,0x34,0x24,0x23,0x02,0x80,0xa8,0xaa,0xcb,0xbd,0xbd,0xbd,
+0xcb,0xbb,0xbb,0x9b,0x09,0x30,0x43,0x43,0x34,0x45,0x43,0x33,0x24,0x23,0x33,0x33,
+0x24,0x01,0x98,0xcb,0xbd,0xcd,0xbb,0xbc,0xbb,0xbb,0xcb,0xba,0x99,0x10,0x53,0x44,
+0x34,0x43,0x24,0x23,0x23,0x11,0x81,0x90,0xb9,0xcc,0xcc,0xbc,0xcc,0xba,0xac,0xaa,
+0xaa,0xa9,0x88,0x10,0x42,0x35,0x35,0x34,0x34,0x24,0x22,0x22,0x01,0x80,0xa8,0xba,
+0xdd,0xcb,0xcc,0xba,0xac,0xab,0xba,0x9a,0x89,0x10,0x42,0x44,0x44,0x43,0x43,0x23,
+0x33,0x32,0x21,0x01,0x80,0xb9,0xcd,0xcc,0xbc,0xbc,0xac,0xab,0xab,0xa9,0x88,0x00,
+0x42,0x53,0x44,0x43,0x34,0x33,0x33,0x33,0x22,0x12,0x01,0x99,0xcd,0xcc,0xdb,0xcb,
+0xbb,0xac,0xaa,0x9a,0x89,0x10,0x22,0x44,0x44,0x34,0x34,0x43,0x32,0x22,0x22,0x22,
+0x01,0x98,0xcb,0xcd,0xbc,0xad,0xac,0xbb,0xbb,0xaa,0x8a,0x08,0x21,0x34,0x45,0x44,
+0x43,0x33,0x33,0x43,0x12,0x12,0x01,0x88,0xca,0xcc,0xbc,0xbd,0xbc,0xbb,0xac,0xaa,
+0x9a,0x88,0x00,0x42,0x53,0x44,0x33,0x35,0x33,0x33,0x33,0x22,0x01,0x88,0xbb,0xce,
+0xcc,0xdb,0xbb,0xbc,0xba,0xbb,0xba,0x99,0x09,0x32,0x54,0x44,0x43,0x43,0x24,0x23,
+0x22,0x12,0x01,0x88,0xa9,0xbc,0xbe,0xbd,0xcc,0xba,0xac,0xaa,0xab,0xa9,0x89,0x20,
+0x52,0x53,0x34,0x34,0x34,0x33,0x23,0x13,0x01,0x88,0xba,0xdb,0xbd,0xcd,0xcb,0xbb,
+0xbc,0xba,0xba,0xaa,0x8a,0x18,0x42,0x54,0x53,0x43,0x43,0x32,0x33,0x22,0x11,0x01,
+0x98,0xc9,0xeb,0xdb,0xcb,0xcb,0xbb,0xbb,0xbb,0x9b,0x89,0x10,0x43,0x44,0x35,0x44,
+0x43,0x33,0x32,0x23,0x22,0x12,0x01,0xa8,0xdc,0xbc,0xbd,0xbc,0xbc,0xca,0x9a,0x8a,
+0x09,0x10,0x22,0x53,0x34,0x45,0x33,0x34,0x33,0x23,0x33,0x22,0x12,0x98,0xda,0xcd,
+0xdb,0xbb,0xcc,0xba,0xba,0x9a,0x8a,0x08,0x20,0x53,0x34,0x45,0x33,0x44,0x32,0x32,
+0x22,0x12,0x01,0x98,0xba,0xdd,0xdb,0xbc,0xcb,0xbb,0xbb,0xab,0xab,0x9a,0x08,0x22,
+0x55,0x53,0x34,0x53,0x32,0x23,0x32,0x11,0x81,0x98,0xba,0xdc,0xdb,0xcc,0xbb,0xbc,
+0xbb,0xbb,0xba,0xaa,0x8a,0x20,0x54,0x44,0x34,0x43,0x24,0x33,0x22,0x11,0x88,0x99,
+0xba,0xcc,0xcc,0xcc,0xbb,0xbc,0xbb,0xbb,0x9b,0x08,0x21,0x43,0x44,0x53,0x53,0x33,
+0x34,0x33,0x24,0x22,0x23,0x22,0x00,0xb9,0xcd,0xcc,0xbc,0xcb,0xbb,0xbb,0xbb,0xcb,
+0x9a,0x89,0x30,0x54,0x34,0x44,0x33,0x24,0x33,0x23,0x11,0x80,0xa8,0xba,0xdd,0xdb,
+0xcb,0xbc,0xbb,0xbb,0xbb,0xba,0x9a,0x09,0x31,0x46,0x53,0x34,0x34,0x24,0x33,0x22,
+0x12,0x11,0x88,0xb8,0xeb,0xbc,0xbd,0xcc,0xbb,0xbb,0xbb,0xbb,0x9a,0x88,0x21,0x45,
+0x44,0x53,0x43,0x42,0x22,0x22,0x22,0x11,0x01,0x98,0xca,0xcc,0xbc,0xbd,0xcb,0xbb,
+0xbb,0xaa,0xaa,0x88,0x20,0x63,0x53,0x34,0x44,0x33,0x43,0x22,0x22,0x12,0x11,0x80,
+0xb9,0xcd,0xcc,0xcb,0xcb,0xbb,0xbb,0x9c,0x8a,0x88,0x10,0x32,0x45,0x53,0x34,0x24,
+0x33,0x24,0x22,0x21,0x11,0x00,0xa9,0xdb,0xbd,0xcc,0xcb,0xcb,0xba,0xaa,0x9a,0x89,
+0x00,0x22,0x44,0x44,0x34,0x34,0x43,0x32,0x22,0x22,0x11,0x01,0x99,0xbc,0xbe,0xbd,
+0xbc,0xbc,0xcb,0xaa,0xaa,0x99,0x08,0x10,0x53,0x34,0x35,0x34,0x34,0x33,0x33,0x22,
+0x12,0x00,0x99,0xda,0xcc,0xbd,0xbc,0xbc,0xac,0xab,0xab,0x9a,0x99,0x10,0x42,0x44,
+0x53,0x43,0x24,0x33,0x33,0x32,0x11,0x81,0x98,0xca,0xcc,0xcc,0xbc,0xbc,0xcb,0xab,
+0xab,0xab,0x9a,0x08,0x31,0x54,0x34,0x44,0x43,0x33,0x24,0x22,0x11,0x00,0x98,0xb9,
+0xdb,0xcc,0xcc,0xbb,0xbc,0xbb,0xbb,0xbb,0xaa,0x89,0x21,0x44,0x45,0x43,0x34,0x34,
+0x32,0x33,0x22,0x01,0x81,0xa8,0xda,0xcc,0xcc,0xbb,0xad,0xbb,0xbb,0xbb,0xa9,0x08,
+0x21,0x53,0x44,0x44,0x43,0x43,0x32,0x23,0x32,0x22,0x11,0x80,0xba,0xcd,0xbd,0xcc,
+0xbb,0xac,0xbb,0xaa,0x9a,0x08,0x11,0x43,0x44,0x44,0x43,0x34,0x33,0x33,0x33,0x32,
+0x22,0x02,0xa9,0xcd,0xcc,0xbc,0xcc,0xba,0xcb,0xaa,0x99,0x89,0x00,0x21,0x43,0x45,
+0x53,0x33,0x34,0x33,0x23,0x23,0x12,0x01,0x99,0xdc,0xdb,0xbc,0xbd,0xbb,0xac,0xab,
+0xab,0x9a,0x88,0x10,0x43,0x45,0x43,0x34,0x34,0x33,0x24,0x12,0x01,0x80,0x98,0xca,
+0xeb,0xcb,0xbc,0xbc,0xac,0xba,0xba,0xaa,0x9a,0x09,0x32,0x45,0x44,0x43,0x43,0x33,
+0x24,0x12,0x81,0x88,0xa9,0xbb,0xcc,0xcc,0xbc,0xcc,0xba,0xba,0xaa,0x89,0x08,0x21,
+0x42,0x53,0x44,0x43,0x34,0x33,0x24,0x32,0x22,0x12,0x02,0x90,0xcb,0xcd,0xbc,0xbd,
+0xbb,0xac,0xab,0xab,0xab,0x8a,0x18,0x43,0x45,0x34,0x34,0x34,0x24,0x23,0x21,0x01,
+0x80,0x98,0xcb,0xdc,0xcb,0xbc,0xcb,0xbb,0xbb,0xba,0xaa,0x8a,0x18,0x42,0x45,0x34,
+0x35,0x24,0x24,0x22,0x22,0x11,0x01,0x98,0xb9,0xdc,0xbc,0xcc,0xbb,0xbc,0xbb,0xab,
+0x9b,0x8a,0x18,0x41,0x63,0x53,0x53,0x33,0x43,0x23,0x23,0x22,0x11,0x80,0xa8,0xcc,
+0xcd,0xcb,0xcb,0xbb,0xac,0xab,0x9a,0x8a,0x08,0x31,0x53,0x54,0x43,0x43,0x24,0x23,
+0x32,0x22,0x21,0x00,0x98,0xda,0xbc,0xcd,0xcb,0xcb,0xba,0xab,0xaa,0x99,0x08,0x21,
+0x43,0x45,0x53,0x43,0x24,0x23,0x23,0x23,0x22,0x11,0x88,0xca,0xcc,0xcc,0xcb,0xbc,
+0xbb,0xcb,0x9a,0x9a,0x88,0x10,0x32,0x54,0x34,0x44,0x43,0x23,0x33,0x23,0x12,0x11,
+0x90,0xb9,0xdc,0xcc,0xbc,0xbc,0xcb,0xab,0xbb,0x9a,0x99,0x08,0x31,0x44,0x45,0x43,
+0x24,0x24,0x32,0x22,0x12,0x01,0x80,0xa8,0xcb,0xcd,0xcc,0xbb,0xbc,0xac,0xaa,0x9b,
+0x9a,0x88,0x20,0x43,0x35,0x35,0x34,0x34,0x33,0x24,0x12,0x11,0x80,0x98,0xba,0xbe,
+0xcd,0xcb,0xcb,0xab,0xab,0xbb,0xaa,0x99,0x18,0x42,0x35,0x45,0x43,0x33,0x34,0x32,
+0x22,0x12,0x80,0xa8,0xca,0xeb,0xdb,0xcb,0xbc,0xbb,0xcb,0xaa,0xaa,0x9a,0x08,0x31,
+0x45,0x53,0x34,0x43,0x33,0x43,0x22,0x12,0x01,0x08,0xa9,0xbc,0xcd,0xcc,0xbb,0xbc,
+0xcb,0xaa,0x9a,0x99,0x08,0x21,0x53,0x44,0x34,0x34,0x24,0x33,0x33,0x22,0x12,0x01,
+0x98,0xcb,0xcd,0xcc,0xbb,0xad,0xac,0xaa,0x9a,0x99,0x00,0x20,0x42,0x44,0x34,0x44,
+0x33,0x33,0x24,0x22,0x22,0x01,0x80,0xb9,0xcd,0xcc,0xbc,0xcb,0xbb,0xbb,0xac,0x99,
+0x89,0x10,0x32,0x45,0x53,0x34,0x43,0x33,0x43,0x22,0x21,0x01,0x80,0xa9,0xcc,0xcc,
+0xbc,0xbc,0xac,0xbb,0xbb,0xaa,0x99,0x08,0x21,0x35,0x36,0x44,0x33,0x34,0x33,0x23,
+0x23,0x11,0x88,0xb9,0xcc,0xbd,0xbd,0xbc,0xbc,0xac,0xab,0xaa,0xaa,0x89,0x10,0x42,
+0x45,0x43,0x34,0x43,0x33,0x23,0x13,0x01,0x98,0xb9,0xdb,0xcc,0xcc,0xcb,0xbb,0xbc,
+0xbb,0xab,0x8a,0x00,0x23,0x44,0x53,0x53,0x53,0x32,0x24,0x32,0x22,0x23,0x12,0x81,
+0xb8,0xcc,0xdc,0xcb,0xcb,0xbb,0xcb,0xaa,0xab,0x9b,0x89,0x21,0x35,0x35,0x35,0x43,
+0x34,0x32,0x32,0x11,0x01,0x90,0xb9,0xbd,0xcb,0xaa,0x9a,0x88,0x98,0x98,0x98,0x99,
+0x99,0x9a,0x8a,0x89,0x80,0x88,0x99,0x98,0xb9,0xdb,0xbc,0xaa,0x8a,0x88,0x99,0xcb,
+0xcb,0x9a,0x99,0xb9,0xdb,0xdc,0xcb,0xcb,0xab,0xaa,0x89,0x98,0xb9,0xbd,0xbd,0x9a,
+0x30,0x36,0x25,0x01,0xa8,0x8a,0x28,0x43,0xa1,0xec,0xbb,0x0a,0x52,0x33,0x02,0xa0,
+0x98,0x00,0xc9,0xcf,0xcb,0x09,0x62,0x34,0x33,0x01,0x99,0x8a,0x10,0x13,0xa0,0xcb,
+0x1b,0x56,0x36,0x24,0x12,0x01,0x81,0x80,0xc9,0xcb,0xab,0x29,0x55,0x43,0x24,0x21,
+0x01,0x81,0xa8,0xc9,0xbb,0xaa,0x00,0x43,0x36,0x34,0x14,0x81,0xba,0xbc,0x8a,0x10,
+0x22,0x80,0xaa,0x8a,0x38,0x42,0x01,0xd8,0xfb,0xdb,0xac,0xaa,0x18,0x22,0x02,0xc8,
+0xb9,0x29,0x53,0x12,0xb9,0xbf,0xcc,0xba,0xaa,0x99,0xa9,0xce,0xbe,0xac,0x8a,0x20,
+0x21,0x98,0xbc,0xbb,0xbb,0xdd,0xbd,0xbb,0x8a,0x00,0xa0,0xcd,0xaa,0x08,0x01,0xfb,
+0xbf,0xac,0x8a,0x08,0x80,0xa9,0xaa,0x8a,0x10,0xa8,0xdf,0xdb,0xab,0x9b,0x88,0x08,
+0x98,0xca,0xba,0x98,0x91,0xfa,0xce,0xcc,0xba,0x99,0x89,0x99,0x9a,0x08,0x31,0x82,
+0xeb,0xcd,0xbb,0x9a,0x89,0x88,0x08,0x00,0x80,0x90,0x98,0x21,0x31,0xcd,0xce,0xac,
+0x09,0x11,0x02,0xa8,0xaa,0x18,0x46,0x34,0x44,0x32,0x12,0x81,0xa8,0x98,0x01,0x02,
+0x89,0x51,0x67,0x34,0x22,0x80,0x89,0x31,0x36,0x12,0xd9,0xbb,0x28,0x67,0x24,0x23,
+0x02,0x80,0x88,0x08,0x00,0x88,0x08,0x20,0x56,0x44,0x34,0x23,0x12,0x88,0x88,0x00,
+0x01,0xa0,0xa9,0x10,0x46,0x34,0x01,0x98,0x8a,0x10,0x22,0x90,0xbc,0x8a,0x64,0x44,
+0x12,0x02,0x00,0x01,0xa8,0xec,0xbb,0xab,0x89,0xb8,0xec,0xbb,0x9b,0x08,0xa9,0xcf,
+0xcb,0x09,0x32,0x13,0xfa,0xcd,0xbb,0x9b,0x09,0x88,0x98,0x89,0x20,0x24,0xa1,0xee,
+0xbd,0xbd,0xba,0x9a,0x9a,0xa8,0xa8,0x08,0x31,0x02,0xfc,0xcf,0xbc,0xac,0xaa,0x99,
+0x88,0x80,0x00,0x00,0x89,0x20,0x75,0x45,0x24,0x23,0x01,0x88,0x00,0x11,0x01,0x88,
+0x18,0x56,0x44,0x23,0x22,0x00,0x10,0x11,0x01,0x81,0x08,0xa9,0xed,0xcd,0xbc,0xac,
+0x89,0x08,0x80,0x80,0x88,0x00,0x88,0xca,0xbc,0xac,0xaa,0x99,0xab,0xbb,0x9b,0x09,
+0x11,0x01,0x98,0xcd,0xbe,0xbc,0xab,0x89,0x08,0x08,0x08,0x28,0x01,0xe8,0xcd,0xbc,
+0x8a,0x18,0x11,0x81,0xa8,0x89,0x28,0x28,0x01,0x92,0xfa,0xdf,0xdb,0x9a,0x18,0x31,
+0x01,0xcb,0x9c,0x72,0x37,0x35,0x23,0x11,0x08,0x08,0x21,0x22,0x12,0x81,0x90,0x88,
+0x8a,0x19,0x71,0x53,0x33,0x13,0x81,0x99,0x99,0x89,0x39,0x74,0x44,0x24,0x11,0x98,
+0x99,0x88,0x01,0x01,0x62,0x64,0x34,0x24,0x02,0x80,0x89,0x08,0x11,0x80,0xa8,0xa9,
+0x11,0x46,0x55,0x43,0x43,0x12,0x80,0x98,0x89,0x11,0x02,0xa8,0x9c,0x3a,0x65,0x34,
+0x14,0x81,0x98,0x98,0x00,0x01,0x81,0xa8,0x88,0x01,0x21,0x19,0xab,0x99,0x31,0x41,
+0x0a,0xbb,0x2a,0x61,0x29,0x0b,0x8c,0x38,0x32,0xc4,0xe0,0x09,0x41,0x14,0xe1,0xdd,
+0xbc,0xaa,0x18,0x21,0x81,0xa9,0x9a,0x41,0x33,0xc9,0xef,0xbb,0x9a,0x10,0x21,0x90,
+0xba,0x88,0x53,0x13,0xfa,0xbd,0xbc,0x89,0x10,0x10,0x09,0x19,0x19,0xc8,0xee,0xbc,
+0xac,0x9a,0x08,0x80,0x88,0x08,0x52,0x45,0x23,0x82,0xeb,0xdc,0xbb,0xaa,0x89,0x08,
+0x08,0x98,0x00,0x21,0x80,0xfb,0xbc,0xac,0x09,0x10,0x11,0x98,0x99,0x18,0x21,0x80,
+0xb9,0x99,0x22,0x04,0xc8,0x8b,0x7a,0x41,0x89,0xad,0x3b,0x76,0x34,0x23,0x81,0xaa,
+0x09,0x30,0x12,0xb8,0xbd,0x20,0x57,0x34,0x34,0x23,0x23,0x00,0x99,0x8a,0x10,0x21,
+0x00,0x68,0x67,0x54,0x23,0x12,0x90,0x99,0x00,0x11,0x90,0x99,0x51,0x46,0x24,0x02,
+0x98,0x18,0x52,0x23,0x91,0xcb,0xab,0x31,0x36,0x13,0x90,0xaa,0x09,0x21,0x22,0xb8,
+0xba,0x89,0x14,0x05,0xa0,0xcb,0x89,0x73,0x32,0xc8,0xed,0xbb,0xab,0x80,0x98,0xcd,
+0xcc,0x99,0x00,0x12,0x81,0xaa,0x0a,0x32,0x05,0xe9,0xcd,0xab,0x0a,0x30,0x21,0xa8,
+0xde,0xba,0x9a,0x00,0x90,0xfb,0xcc,0xab,0x99,0x08,0x90,0x90,0x00,0x22,0x92,0xdf,
+0xbe,0xbd,0xba,0xbb,0xab,0x8a,0x09,0x80,0x99,0x29,0x75,0x37,0x34,0x22,0x00,0x88,
+0x00,0x22,0x23,0x02,0x99,0x19,0x74,0x54,0x34,0x22,0x00,0xa9,0x99,0x21,0x44,0x02,
+0xba,0xbf,0xcb,0xaa,0xaa,0xaa,0x99,0x08,0x10,0x88,0x88,0x00,0x10,0xeb,0xce,0xcb,
+0xaa,0x89,0x08,0x08,0x08,0x00,0x00,0x99,0x1b,0x48,0x32,0x99,0xbf,0x1a,0x56,0x44,
+0x12,0x81,0x88,0x00,0x98,0xfb,0xdb,0xba,0x08,0x43,0x44,0x22,0x00,0xaa,0xbd,0xab,
+0x8a,0x18,0x10,0x00,0x08,0x89,0xa9,0x98,0x46,0x47,0x24,0x02,0x98,0x8b,0x29,0x41,
+0x80,0xbb,0x1c,0x72,0x35,0x23,0x81,0x99,0x89,0x11,0x11,0x99,0xab,0x19,0x57,0x54,
+0x43,0x24,0x12,0x80,0x88,0x09,0x10,0x88,0x98,0x61,0x55,0x34,0x33,0x01,0x80,0x00,
+0x01,0xb0,0xce,0xbc,0x9a,0x18,0x11,0x00,0x99,0x89,0x20,0x10,0x90,0xaa,0x19,0x51,
+0x38,0xab,0xb9,0x20,0x23,0xa3,0xba,0xaa,0x23,0x33,0xb0,0xe9,0x00,0x31,0x92,0xc0,
+0x8b,0x5b,0x32,0x01,0x9f,0x1d,0x30,0x34,0xb8,0xff,0x9d,0x9a,0x19,0x10,0x00,0x88,
+0x0a,0x18,0x01,0x00,0x99,0x89,0x11,0x11,0xc0,0xe2,0x92,0x82,0xb2,0x91,0x3d,0x3b,
+0xb1,0xa3,0x99,0x99,0xb3,0xa5,0xa1,0xc2,0xb3,0xb6,0xb4,0x81,0x19,0x00,0x19,0x2b,
+0x99,0xb2,0x03,0x3b,0x1b,0xb2,0xa3,0x92,0x99,0x00,0x92,0x90,0x00,0x2a,0x39,0x09,
+0x99,0x99,0x30,0x4b,0x0a,0xa9,0x39,0x39,0x90,0xb1,0x99,0x20,0x02,0xb2,0xaa,0x29,
+0x31,0xa3,0xc0,0x99,0x13,0x87,0x91,0x8b,0x3c,0x51,0x82,0xf8,0xab,0x31,0x77,0x24,
+0x12,0x88,0x89,0x09,0x10,0x10,0xa8,0xa0,0x00,0x21,0x10,0x0b,0x1d,0x10,0x82,0xc3,
+0xc1,0x01,0x48,0x19,0xb9,0x09,0x19,0x93,0xb3,0x99,0x2a,0x29,0x91,0x91,0x99,0x00,
+0x11,0x39,0x3c,0x3d,0x1a,0x91,0xb2,0x91,0xb1,0xb5,0xa3,0x10,0x2b,0x90,0x11,0x3a,
+0x3b,0x1b,0x91,0x01,0x29,0x2a,0x2b,0x19,0x19,0x3a,0x1a,0x19,0x29,0x3b,0x99,0x91,
+0x90,0x91,0x11,0x29,0x1b,0x2a,0x29,0x19,0x2a,0x9a,0xa1,0x94,0x20,0x1b,0x3c,0x3a,
+0x30,0x99,0xba,0x92,0x22,0x10,0x9a,0x9b,0x30,0x13,0xc3,0xb8,0xa0,0x87,0x94,0xc0,
+0xa9,0x41,0x72,0x08,0xbe,0xbe,0xab,0x89,0x21,0x01,0x98,0x8a,0x08,0x12,0x01,0xaa,
+0x8a,0x31,0x33,0xb2,0x8c,0x4b,0x48,0x28,0x9b,0x9b,0x39,0x12,0xc3,0xe2,0x91,0x02,
+0x82,0x99,0x9b,0x29,0x03,0xb3,0xc1,0x90,0x13,0x94,0xa0,0x9b,0xb1,0x97,0xb3,0xd2,
+0xb2,0x02,0x21,0x2b,0x0e,0x88,0x02,0xa2,0xd0,0xb1,0x83,0x14,0xb8,0xd9,0x91,0x32,
+0x20,0xbb,0xab,0x11,0x86,0xb2,0xa9,0x09,0x33,0x14,0xba,0xbb,0x19,0x16,0x91,0xba,
+0x1b,0x71,0x21,0x99,0xeb,0x91,0x34,0x21,0xac,0xae,0x10,0x47,0x34,0x33,0x02,0x90,
+0x9a,0x89,0x11,0x04,0xb2,0xe8,0x89,0x31,0x53,0x89,0xbe,0x99,0x54,0x26,0x13,0x81,
+0x18,0x63,0x33,0x93,0xfa,0xab,0x8a,0x20,0x22,0x98,0x9b,0x2a,0x50,0x01,0xb9,0xa9,
+0x11,0x14,0x91,0x8c,0x1c,0x20,0x84,0xb0,0xb9,0x28,0x33,0xb4,0xf1,0xa8,0x22,0x30,
+0xa9,0xf9,0x91,0x12,0x92,0xd0,0x98,0x92,0x85,0xa1,0xd0,0x10,0x30,0xb1,0xe3,0x90,
+0x49,0x28,0x98,0x99,0x1b,0x30,0x23,0x0b,0x1d,0x3a,0x20,0xb3,0xf1,0xa1,0x83,0x11,
+0x0a,0xab,0x20,0x41,0x19,0xbb,0xa9,0x13,0x32,0x3b,0x0f,0x29,0x28,0x90,0xc0,0x98,
+0x32,0x41,0x0a,0x1d,0x4c,0x4a,0x08,0xa8,0x1a,0x49,0x31,0x99,0x9e,0x09,0x33,0x04,
+0xcb,0x9d,0x40,0x73,0x90,0xfc,0xbc,0xab,0x09,0x11,0x82,0xa0,0xa8,0x81,0x12,0x00,
+0x8a,0x2b,0x6a,0x00,0xb1,0xb1,0x11,0x31,0x20,0x1b,0x9b,0xb2,0x95,0x00,0x1a,0x19,
+0x39,0x90,0xb1,0x91,0x30,0x4b,0x2b,0x1b,0x09,0x91,0xa3,0x91,0x19,0x90,0xb3,0x01,
+0xa0,0xb3,0x13,0x2a,0x2b,0x1a,0x91,0xb3,0xb2,0xb2,0xa3,0xa3,0xb3,0xa1,0x92,0x21,
+0x1a,0x99,0x19,0x01,0xa3,0xa1,0x19,0x3a,0x39,0x09,0xaa,0x91,0x13,0x12,0x9b,0x9b,
+0x21,0x23,0x99,0xbb,0x2b,0x61,0x10,0x9b,0xbb,0x33,0x27,0x80,0xae,0x8b,0x65,0x45,
+0x23,0x02,0x89,0x8a,0x08,0x21,0x18,0x8b,0x0a,0x21,0x21,0xa9,0xab,0x09,0x95,0xa4,
+0xc1,0xa1,0x21,0x48,0x2b,0xbb,0xb1,0x95,0x01,0xa8,0xb1,0xa3,0xa4,0xc3,0xb1,0xa3,
+0x93,0xb3,0xb3,0xa1,0x11,0x92,0x91,0x19,0x4c,0x3b,0x2a,0x1b,0x99,0x10,0x10,0xa1,
+0x01,0x3a,0x2a,0xa1,0xc3,0x92,0x11,0x91,0xc3,0xa2,0x02,0x39,0x3b,0x3c,0x3c,0x2a,
+0xa0,0xb3,0x91,0x39,0x3a,0xa9,0xb2,0x91,0x02,0x01,0x1a,0x3b,0x3a,0x39,0x2b,0x9b,
+0x19,0x12,0x91,0x99,0x3c,0x6a,0x19,0x89,0x0b,0x39,0x43,0xb0,0xfb,0x08,0x63,0x12,
+0xdd,0xbe,0xbc,0x89,0x21,0x20,0x99,0x9b,0x29,0x44,0x01,0xce,0xcc,0xaa,0x88,0x11,
+0x81,0x98,0x88,0x00,0x01,0xa1,0xa0,0x10,0x39,0x18,0xc0,0xb2,0x23,0x49,0x3c,0x1b,
+0x19,0x12,0x00,0x1b,0x19,0x01,0xb3,0x91,0x2b,0x29,0x30,0x0b,0x9a,0x01,0x03,0xb2,
+0xb0,0x19,0x31,0xa2,0xb1,0x9a,0x11,0xa6,0xb3,0xa9,0x18,0x15,0xb2,0xf0,0x09,0x41,
+0x31,0xbb,0xbf,0x30,0x77,0x24,0x12,0x90,0x99,0x08,0x11,0x01,0x9a,0x99,0x01,0x04,
+0xa0,0xaa,0x19,0x43,0x11,0xac,0x9b,0x32,0x17,0xa0,0xba,0x09,0x24,0x03,0xba,0x9f,
+0x18,0x23,0x94,0xd8,0xbb,0x2a,0x75,0x45,0x43,0x13,0x81,0xa9,0xa9,0x00,0x32,0x63,
+0x44,0x34,0x24,0x90,0xba,0x9a,0x42,0x23,0xb0,0xbd,0x89,0x35,0x03,0xda,0xab,0x30,
+0x26,0x91,0xbc,0x8b,0x73,0x22,0xb9,0xae,0x28,0x34,0x83,0xec,0xcb,0x18,0x32,0x02,
+0xba,0x9d,0x20,0x15,0xa1,0xca,0x0a,0x43,0x03,0xc9,0xac,0x20,0x35,0x90,0xdb,0x8a,
+0x53,0x12,0xc9,0xac,0x31,0x25,0xd9,0xbd,0x60,0x67,0x43,0x02,0xca,0xbd,0xad,0xab,
+0xaa,0xab,0xbb,0x9a,0x18,0x32,0x44,0x34,0x54,0x53,0x33,0x44,0x32,0x43,0x22,0x22,
+0x22,0x12,0x01,0x90,0xb9,0xcc,0xcb,0xcc,0xbc,0xcc,0xcb,0xbb,0xbb,0xab,0xcb,0xaa,
+0xaa,0x99,0x00,0x22,0x45,0x43,0x34,0x35,0x34,0x34,0x43,0x32,0x22,0x23,0x23,0x22,
+0x00,0x98,0xbb,0xbe,0xcc,0xbc,0xcc,0xbc,0xbc,0xbb,0xbb,0xbb,0xbb,0xac,0xaa,0x88,
+0x10,0x43,0x44,0x53,0x43,0x34,0x44,0x32,0x24,0x23,0x22,0x23,0x22,0x11,0x81,0xa9,
+0xcb,0xcc,0xdb,0xdb,0xbc,0xbc,0xcb,0xab,0xcb,0xaa,0xba,0x9a,0x9a,0x88,0x21,0x53,
+0x34,0x35,0x34,0x44,0x43,0x43,0x32,0x32,0x22,0x23,0x22,0x11,0x80,0xaa,0xcc,0xbc,
+0xbd,0xcc,0xbc,0xbc,0xcb,0xba,0xbb,0xbb,0xbb,0xab,0x9a,0x00,0x43,0x44,0x34,0x34,
+0x35,0x44,0x33,0x34,0x33,0x33,0x33,0x32,0x22,0x12,0x88,0xcb,0xcc,0xbc,0xbd,0xcc,
+0xcb,0xbc,0xbb,0xbb,0xac,0xba,0xba,0x9a,0x99,0x20,0x42,0x44,0x43,0x34,0x35,0x34,
+0x34,0x24,0x23,0x23,0x22,0x23,0x12,0x01,0xa9,0xcb,0xcc,0xcb,0xcc,0xbc,0xbc,0xbc,
+0xac,0xbb,0xaa,0xab,0xaa,0x9b,0x89,0x20,0x44,0x53,0x53,0x33,0x35,0x44,0x42,0x22,
+0x23,0x22,0x22,0x13,0x12,0x81,0xa9,0xdb,0xbc,0xbd,0xcc,0xcb,0xbc,0xac,0xbb,0xbb,
+0xbb,0xbb,0xba,0x9a,0x19,0x41,0x34,0x35,0x44,0x34,0x44,0x33,0x34,0x33,0x33,0x33,
+0x33,0x22,0x11,0x88,0xba,0xcd,0xbd,0xbc,0xbd,0xbc,0xbd,0xbb,0xcb,0xba,0xba,0xba,
+0xaa,0x8a,0x10,0x42,0x53,0x53,0x53,0x43,0x53,0x32,0x24,0x23,0x33,0x32,0x22,0x12,
+0x01,0x90,0xca,0xcc,0xdb,0xdb,0xcb,0xcb,0xcb,0xbb,0xcb,0xaa,0xab,0xab,0xaa,0x09,
+0x20,0x43,0x44,0x53,0x43,0x34,0x34,0x34,0x24,0x23,0x23,0x22,0x22,0x12,0x81,0xa8,
+0xdb,0xbc,0xbc,0xbd,0xbd,0xcc,0xca,0xba,0xaa,0xab,0xba,0xaa,0x9a,0x89,0x21,0x34,
+0x36,0x34,0x35,0x34,0x35,0x33,0x43,0x32,0x32,0x22,0x23,0x12,0x90,0xb9,0xbd,0xbd,
+0xdb,0xbc,0xcc,0xcb,0xcb,0xba,0xba,0xba,0xba,0xaa,0x9a,0x18,0x42,0x34,0x35,0x44,
+0x43,0x53,0x43,0x33,0x33,0x23,0x33,0x32,0x23,0x11,0x98,0xca,0xcc,0xcb,0xcc,0xbc,
+0xcc,0xcb,0xbb,0xba,0xbb,0xbb,0xbb,0xab,0x8a,0x10,0x43,0x45,0x43,0x44,0x43,0x34,
+0x43,0x33,0x24,0x22,0x22,0x22,0x21,0x81,0xa8,0xca,0xbc,0xcc,0xdb,0xbc,0xcc,0xbb,
+0xbb,0xac,0xba,0xab,0xab,0xaa,0x98,0x11,0x42,0x44,0x34,0x45,0x43,0x43,0x43,0x23,
+0x23,0x23,0x32,0x32,0x12,0x80,0xb8,0xdb,0xbc,0xcd,0xcb,0xcc,0xbb,0xbc,0xbb,0xac,
+0xab,0xab,0xaa,0x9a,0x08,0x21,0x44,0x44,0x43,0x53,0x43,0x43,0x43,0x32,0x23,0x23,
+0x22,0x22,0x11,0x80,0xb9,0xdc,0xcb,0xbc,0xcc,0xbc,0xbc,0xbc,0xba,0xab,0xbb,0xbb,
+0xab,0x8a,0x18,0x43,0x44,0x34,0x44,0x43,0x34,0x34,0x34,0x32,0x23,0x33,0x22,0x22,
+0x01,0x88,0xba,0xbe,0xdc,0xcb,0xcb,0xbc,0xbc,0xac,0xbb,0xab,0xab,0xab,0xab,0x89,
+0x10,0x34,0x35,0x35,0x34,0x35,0x35,0x33,0x34,0x23,0x33,0x23,0x22,0x12,0x01,0xa8,
+0xcb,0xcd,0xcb,0xcc,0xcb,0xdb,0xbb,0xcb,0xba,0xba,0xaa,0xab,0xaa,0x09,0x21,0x44,
+0x34,0x44,0x43,0x44,0x43,0x33,0x33,0x43,0x22,0x32,0x22,0x11,0x88,0xb9,0xdb,0xbc,
+0xcc,0xbc,0xcc,0xac,0xac,0xab,0xab,0xab,0xbb,0xaa,0x8a,0x08,0x32,0x35,0x35,0x35,
+0x44,0x53,0x33,0x43,0x32,0x33,0x32,0x23,0x22,0x11,0x90,0xc9,0xbc,0xbd,0xcc,0xbc,
+0xcc,0xcb,0xab,0xbb,0xbb,0xcb,0xba,0xaa,0x09,0x10,0x42,0x43,0x44,0x53,0x43,0x34,
+0x24,0x43,0x22,0x32,0x22,0x22,0x21,0x00,0x90,0xbb,0xcd,0xdb,0xdb,0xcb,0xbc,0xcb,
+0xbb,0xbb,0xac,0xba,0xaa,0xaa,0x89,0x21,0x34,0x35,0x34,0x35,0x44,0x24,0x24,0x23,
+0x33,0x32,0x23,0x23,0x11,0x81,0xa9,0xdb,0xbc,0xcd,0xcb,0xbc,0xcc,0xca,0xba,0xaa,
+0xab,0xab,0xab,0x9a,0x88,0x22,0x44,0x53,0x34,0x34,0x35,0x34,0x43,0x33,0x33,0x32,
+0x32,0x22,0x12,0x81,0xba,0xcd,0xdb,0xcb,0xbc,0xbd,0xbc,0xbc,0xba,0xbb,0xbb,0xab,
+0xab,0x8a,0x18,0x42,0x44,0x34,0x44,0x43,0x34,0x34,0x34,0x23,0x23,0x23,0x32,0x12,
+0x02,0x90,0xca,0xcc,0xcb,0xdb,0xbc,0xbd,0xcb,0xcb,0xba,0xaa,0xab,0xba,0xaa,0x98,
+0x11,0x53,0x43,0x34,0x44,0x34,0x34,0x25,0x33,0x33,0x32,0x23,0x22,0x22,0x81,0xa8,
+0xcb,0xcc,0xcc,0xdb,0xdb,0xbb,0xbc,0xcb,0xaa,0xab,0xab,0xbb,0x9a,0x09,0x30,0x44,
+0x34,0x44,0x43,0x34,0x35,0x43,0x32,0x23,0x32,0x32,0x22,0x22,0x80,0xa9,0xdb,0xcc,
+0xdb,0xcb,0xcc,0xbb,0xbc,0xcb,0xaa,0xab,0xab,0xab,0x99,0x08,0x32,0x44,0x44,0x43,
+0x34,0x44,0x43,0x33,0x33,0x23,0x33,0x33,0x22,0x12,0x88,0xca,0xcc,0xcb,0xcc,0xbc,
+0xcc,0xcb,0xbb,0xab,0xbb,0xcb,0xaa,0xaa,0x99,0x00,0x42,0x53,0x53,0x43,0x34,0x34,
+0x34,0x43,0x32,0x32,0x23,0x32,0x21,0x81,0x98,0xca,0xbc,0xcd,0xbc,0xbc,0xbd,0xcb,
+0xbb,0xac,0xab,0xab,0xaa,0xaa,0x89,0x21,0x43,0x35,0x44,0x43,0x34,0x44,0x33,0x43,
+0x32,0x32,0x22,0x22,0x12,0x81,0xa8,0xcb,0xbd,0xcc,0xbc,0xcc,0xcb,0xcb,0xbb,0xba,
+0xab,0xbb,0xab,0xaa,0x09,0x31,0x54,0x43,0x34,0x44,0x34,0x34,0x34,0x33,0x23,0x33,
+0x23,0x23,0x11,0x80,0xba,0xcc,0xcc,0xbc,0xcc,0xbc,0xbc,0xbc,0xab,0xbb,0xbb,0xab,
+0xbb,0x99,0x18,0x32,0x36,0x35,0x44,0x53,0x43,0x43,0x42,0x22,0x22,0x22,0x22,0x21,
+0x02,0x90,0xba,0xbd,0xcc,0xdb,0xcb,0xcc,0xbb,0xcb,0xab,0xab,0xbb,0xbb,0xab,0x89,
+0x20,0x52,0x53,0x53,0x43,0x44,0x33,0x34,0x43,0x32,0x32,0x23,0x23,0x12,0x01,0x99,
+0xbb,0xbe,0xcc,0xcc,0xbc,0xbc,0xcb,0xbb,0xbb,0xcb,0xaa,0xab,0xa9,0x09,0x20,0x43,
+0x35,0x35,0x34,0x35,0x34,0x43,0x33,0x33,0x33,0x43,0x12,0x12,0x80,0xa9,0xcb,0xbc,
+0xcd,0xdb,0xcb,0xbc,0xbb,0xac,0xbb,0xba,0xbb,0xaa,0xaa,0x08,0x31,0x54,0x34,0x44,
+0x43,0x34,0x34,0x34,0x33,0x32,0x33,0x22,0x23,0x02,0x80,0xba,0xcd,0xbc,0xcc,0xbc,
+0xcc,0xbb,0xbc,0xac,0xaa,0xab,0xaa,0xaa,0x99,0x00,0x33,0x35,0x35,0x44,0x53,0x43,
+0x43,0x23,0x33,0x33,0x33,0x32,0x22,0x11,0x88,0xda,0xdb,0xdb,0xdb,0xcb,0xcb,0xbc,
+0xbb,0xac,0xba,0xba,0xaa,0x9b,0x89,0x20,0x43,0x44,0x34,0x34,0x35,0x35,0x43,0x32,
+0x23,0x33,0x23,0x23,0x12,0x81,0xb9,0xdb,0xdb,0xbc,0xbd,0xcc,0xac,0xac,0xbb,0xbb,
+0xab,0xab,0xab,0xaa,0x89,0x21,0x45,0x53,0x33,0x35,0x35,0x34,0x34,0x33,0x23,0x33,
+0x23,0x23,0x12,0x80,0xb9,0xcc,0xcc,0xbc,0xcc,0xbc,0xbc,0xbc,0xba,0xbb,0xbb,0xcb,
+0xaa,0x89,0x00,0x32,0x34,0x35,0x35,0x44,0x34,0x43,0x24,0x32,0x22,0x23,0x23,0x22,
+0x01,0x90,0xba,0xcc,0xcc,0xdb,0xdb,0xcb,0xbb,0xbc,0xbb,0xcb,0xaa,0xaa,0xaa,0x99,
+0x10,0x42,0x44,0x43,0x53,0x43,0x34,0x43,0x43,0x22,0x32,0x22,0x32,0x21,0x10,0x98,
+0xcb,0xbc,0xcd,0xcb,0xdb,0xcb,0xbb,0xbc,0xbb,0xbb,0xba,0xbb,0xaa,0x89,0x31,0x44,
+0x44,0x53,0x43,0x53,0x33,0x34,0x24,0x23,0x32,0x22,0x22,0x21,0x80,0xa8,0xbc,0xbd,
+0xcc,0xdb,0xdb,0xcb,0xbb,0xbb,0xac,0xab,0xab,0xaa,0x9a,0x88,0x31,0x44,0x44,0x43,
+0x34,0x34,0x44,0x33,0x43,0x22,0x23,0x12,0x22,0x01,0x90,0xa9,0xdb,0xdb,0xbc,0xcd,
+0xcb,0xcb,0xbb,0xac,0xba,0xba,0xaa,0xaa,0x89,0x00,0x32,0x44,0x44,0x43,0x44,0x43,
+0x43,0x33,0x43,0x22,0x22,0x12,0x12,0x01,0x80,0xba,0xcc,0xbc,0xbd,0xcc,0xbc,0xbc,
+0xbb,0xcb,0xba,0xba,0xab,0xaa,0x89,0x11,0x43,0x34,0x35,0x35,0x35,0x34,0x34,0x33,
+0x24,0x22,0x22,0x22,0x12,0x00,0x99,0xca,0xdb,0xdb,0xbc,0xbd,0xbc,0xbc,0xbb,0xbb,
+0xbb,0xcb,0xaa,0x9a,0x89,0x21,0x53,0x34,0x35,0x34,0x35,0x34,0x34,0x33,0x33,0x32,
+0x33,0x23,0x22,0x90,0xb9,0xcc,0xbc,0xcd,0xdb,0xcb,0xbc,0xbb,0xbc,0xba,0xbb,0xbb,
+0xaa,0x9a,0x18,0x31,0x45,0x53,0x43,0x44,0x33,0x35,0x43,0x32,0x23,0x23,0x22,0x22,
+0x11,0x88,0xaa,0xcc,0xcc,0xbc,0xcc,0xbc,0xcb,0xac,0xba,0xba,0xab,0xab,0xaa,0x99,
+0x10,0x33,0x36,0x44,0x53,0x43,0x34,0x43,0x24,0x23,0x32,0x22,0x22,0x12,0x01,0x90,
+0xca,0xdb,0xdb,0xdb,0xcb,0xdb,0xbb,0xcb,0xbb,0xba,0xab,0xab,0x9b,0x89,0x20,0x63,
+0x43,0x34,0x44,0x53,0x43,0x33,0x43,0x32,0x22,0x23,0x23,0x11,0x81,0x99,0xdb,0xdb,
+0xdb,0xbc,0xbc,0xcc,0xbb,0xcb,0xab,0xab,0xba,0xaa,0xaa,0x08,0x31,0x44,0x34,0x35,
+0x44,0x43,0x34,0x43,0x32,0x32,0x32,0x23,0x22,0x11,0x80,0xaa,0xcc,0xdb,0xbc,0xbd,
+0xcc,0xcb,0xbb,0xcb,0xaa,0xab,0xab,0xaa,0x89,0x00,0x32,0x63,0x43,0x44,0x34,0x25,
+0x24,0x33,0x33,0x24,0x22,0x22,0x21,0x10,0x98,0xb9,0xcc,0xdb,0xdb,0xdb,0xcb,0xac,
+0xbb,0xcb,0xaa,0xba,0xaa,0xa9,0x89,0x10,0x41,0x53,0x34,0x44,0x53,0x33,0x34,0x24,
+0x23,0x23,0x33,0x32,0x11,0x81,0xa8,0xca,0xbc,0xcd,0xbc,0xcc,0xcb,0xcb,0xbb,0xbb,
+0xbb,0xba,0xbb,0xaa,0x09,0x30,0x54,0x43,0x34,0x35,0x44,0x43,0x33,0x33,0x43,0x22,
+0x23,0x13,0x12,0x80,0xb9,0xcb,0xcc,0xdb,0xbc,0xbd,0xcc,0xba,0xbb,0xcb,0xaa,0xba,
+0x9a,0x9a,0x00,0x21,0x34,0x45,0x53,0x43,0x43,0x34,0x33,0x34,0x32,0x32,0x22,0x12,
+0x12,0x80,0xba,0xcc,0xcc,0xdb,0xcb,0xbc,0xcc,0xba,0xbb,0xab,0xbb,0xbb,0xab,0x99,
+0x10,0x53,0x53,0x34,0x53,0x34,0x34,0x34,0x34,0x33,0x32,0x32,0x22,0x22,0x01,0x90,
+0xba,0xcd,0xbc,0xbd,0xbd,0xcc,0xbb,0xcb,0xab,0xbb,0xba,0xba,0xaa,0x88,0x20,0x53,
+0x34,0x44,0x34,0x44,0x43,0x24,0x33,0x32,0x32,0x23,0x32,0x21,0x00,0xa9,0xcb,0xcc,
+0xcc,0xdb,0xbc,0xbc,0xbc,0xba,0xbb,0xcb,0xaa,0xab,0xa9,0x08,0x10,0x11,0x10,0x00,
+0x18,0x10,0x22,0x22,0x12,0x11,0x11,0x32,0x36,0x53,0x22,0x21,0x21,0x21,0x43,0x33,
+0x33,0x24,0x34,0x43,0x33,0x33,0x35,0x33,0x25,0x33,0x43,0x43,0x33,0x43,0x33,0x44,
+0x32,0x33,0x34,0x43,0x24,0x33,0x43,0x43,0x42,0x33,0x32,0x43,0x34,0x44,0x22,0x10,
+0x09,0x10,0x44,0x53,0x32,0x33,0x53,0x32,0x11,0x98,0x10,0x64,0x44,0x22,0x01,0x89,
+0x00,0x34,0x34,0x24,0x23,0x34,0x34,0x11,0x90,0x19,0x63,0x45,0x32,0x01,0x88,0x80,
+0x42,0x63,0x32,0x23,0x12,0x80,0x88,0x73,0x73,0x22,0x01,0x88,0x08,0x52,0x23,0x02,
+0x98,0x28,0x55,0x33,0x80,0x9a,0x48,0x56,0x32,0x01,0x89,0x18,0x52,0x23,0x81,0x88,
+0x31,0x36,0x23,0x90,0x10,0x54,0x33,0x83,0x90,0x42,0x45,0x23,0x80,0x19,0x62,0x34,
+0x02,0x98,0x39,0x55,0x24,0x80,0xbb,0x0a,0x63,0x43,0x01,0x89,0x28,0x44,0x23,0x00,
+0x09,0x51,0x34,0x13,0x88,0x18,0x45,0x24,0x11,0x89,0x30,0x36,0x15,0x91,0xba,0x09,
+0x52,0x34,0x13,0x81,0x98,0x99,0x10,0x45,0x35,0x23,0x91,0xca,0x0a,0x53,0x35,0x22,
+0x00,0x88,0x00,0x98,0xa9,0x18,0x47,0x35,0x22,0x81,0x98,0x88,0x88,0x09,0x30,0x67,
+0x33,0x33,0x80,0xa9,0x89,0x18,0x18,0x42,0x57,0x53,0x12,0x98,0x9a,0x09,0x22,0x83,
+0xf8,0x99,0x31,0x47,0x23,0x81,0xa8,0x99,0x12,0x03,0xb0,0xbc,0x19,0x47,0x34,0x23,
+0x01,0x88,0x98,0x90,0x91,0x93,0x93,0xc2,0xd9,0x0a,0x74,0x45,0x33,0x01,0xa8,0x9a,
+0x38,0x52,0x90,0xdd,0xcb,0x9b,0x08,0x11,0x80,0x90,0x98,0x00,0x01,0x80,0x88,0x99,
+0x98,0x93,0x15,0x92,0xfb,0x9b,0x71,0x47,0x43,0x12,0x98,0x99,0x19,0x11,0x82,0xa9,
+0x9a,0x40,0x31,0x99,0x9e,0x08,0x24,0x92,0xdc,0x8a,0x73,0x37,0x23,0x80,0xa8,0x09,
+0x20,0x20,0x9a,0xb9,0x02,0x14,0xb1,0xda,0x08,0x62,0x11,0xbb,0x9e,0x40,0x46,0x34,
+0x12,0x90,0x98,0x09,0x10,0x00,0xa1,0x90,0x98,0xa2,0xa6,0x92,0xb0,0xd1,0x93,0x33,
+0x81,0xdd,0x9a,0x71,0x47,0x33,0x12,0xa0,0xa9,0x00,0x21,0x10,0xaa,0xa9,0x12,0x05,
+0x90,0x9c,0x19,0x53,0xa2,0xfb,0x0a,0x73,0x37,0x14,0x01,0xa9,0x9a,0x31,0x36,0x34,
+0x11,0x88,0x89,0x09,0x01,0x00,0x90,0x09,0x19,0x28,0x28,0x2c,0x1c,0x08,0x02,0x11,
+0x0b,0x0b,0x92,0x13,0x91,0x9b,0x2b,0x12,0x93,0xb0,0xba,0x03,0x05,0x90,0x9b,0x2d,
+0x41,0x21,0xdb,0xac,0x31,0x57,0x91,0xdf,0xbd,0xbc,0x9b,0x09,0x08,0x80,0x88,0x08,
+0x00,0x81,0xa0,0x88,0x00,0x02,0xa1,0xb9,0x09,0x15,0x93,0xb8,0x0e,0x49,0x38,0x98,
+0xba,0x1b,0x53,0x12,0x8b,0x0f,0x4b,0x30,0x90,0xd9,0x99,0x42,0x22,0xb9,0x9f,0x29,
+0x34,0x92,0xfb,0xbb,0x62,0x46,0x32,0x02,0x91,0x00,0x08,0xda,0xec,0xba,0x89,0x10,
+0x11,0x90,0xa8,0x09,0x12,0x02,0xd0,0xb0,0x92,0x84,0xa2,0xa8,0x2a,0x7a,0x28,0x89,
+0x9a,0x00,0xa4,0xa5,0x90,0x3b,0x2b,0xa3,0xb4,0xb0,0x10,0x31,0x29,0x1b,0x2c,0x19,
+0x13,0x3a,0x2d,0x1a,0x10,0x10,0x1a,0x99,0x01,0x92,0xa1,0x91,0x39,0x3b,0x99,0x90,
+0x91,0x11,0x19,0xa0,0x01,0x01,0x91,0xb2,0x91,0x10,0x20,0x1a,0x99,0x3a,0x5a,0x89,
+0xa0,0x91,0x11,0xa3,0xb3,0xa9,0x10,0x13,0x92,0xba,0xb9,0x33,0x43,0x0b,0x8f,0x29,
+0x42,0x81,0xbd,0x8d,0x71,0x45,0x24,0x11,0x88,0x8a,0x08,0x11,0x00,0x99,0x0a,0x38,
+0x30,0x09,0x0d,0x2a,0x39,0x92,0xc1,0xa8,0x12,0x23,0x20,0x0d,0x0a,0x92,0x23,0x9a,
+0xd9,0xa2,0x94,0x92,0x99,0xa9,0x03,0x41,0x3b,0x8e,0xa1,0x93,0x12,0x0b,0x9b,0x31,
+0x39,0x99,0xd0,0xa2,0x83,0x12,0x0a,0x0b,0x39,0x59,0x3b,0x2d,0x1a,0x28,0x10,0x1a,
+0x0b,0x3a,0x30,0x39,0x1d,0x3b,0x5a,0x29,0x99,0xc0,0xa3,0x33,0x01,0xaa,0x99,0x11,
+0xa5,0xd3,0xc2,0x92,0x12,0x91,0xb8,0x1b,0x5b,0x11,0xb1,0xba,0x1a,0x43,0x83,0xbb,
+0x0f,0x4a,0x40,0x88,0xcb,0x0a,0x44,0x14,0xe9,0xdd,0xbb,0xa9,0x00,0x82,0x01,0x09,
+0x0a,0x88,0x80,0x31,0x52,0xca,0xff,0xbb,0xab,0x18,0x22,0x81,0xba,0x9b,0x43,0x16,
+0xc8,0xbe,0xad,0x89,0x00,0x01,0x80,0x89,0x19,0x10,0x00,0x99,0xa8,0x83,0x83,0xb0,
+0x9b,0x09,0x33,0x91,0xab,0x09,0x31,0x92,0xb1,0xb9,0x11,0x13,0x01,0x0b,0x2b,0x20,
+0xb3,0xe3,0xa2,0x01,0x92,0xb3,0xb1,0x2a,0x30,0x01,0xc1,0xb1,0x23,0x49,0x09,0xab,
+0x19,0x31,0x11,0xc0,0xc1,0x02,0x22,0x99,0xbb,0xa0,0x04,0xb3,0xe3,0x98,0x10,0x32,
+0x3b,0xbd,0xc1,0x14,0x12,0xa9,0xad,0x28,0x25,0x93,0xfa,0xcb,0x42,0x47,0x43,0x22,
+0x80,0x99,0x88,0x18,0x20,0x80,0xa8,0x99,0x29,0x52,0x30,0x9c,0xae,0x19,0x47,0x35,
+0x24,0x02,0x89,0x8a,0x19,0x11,0x01,0x99,0xa9,0x01,0x04,0xb2,0xd1,0xa0,0x02,0x04,
+0xa1,0xc9,0x0a,0x71,0x20,0x99,0xcb,0x19,0x54,0x23,0xec,0xbf,0xbc,0x99,0x10,0x11,
+0x80,0x8a,0x19,0x91,0xfd,0xcf,0xcb,0xaa,0x89,0x10,0x00,0x80,0x98,0x80,0x81,0x81,
+0x98,0x09,0x10,0x10,0x90,0x8a,0x4b,0x39,0x10,0x1b,0x1d,0x29,0x92,0xb2,0x1b,0x1b,
+0x93,0x13,0x3b,0x1d,0x08,0x30,0x3b,0x2c,0x3b,0x39,0x29,0x1b,0xa9,0x01,0x12,0x19,
+0x3b,0x3c,0x4b,0x88,0xc3,0xa2,0x30,0x3a,0x19,0x3b,0x3c,0x2a,0x01,0x00,0x2a,0x1a,
+0x91,0x92,0x09,0xa0,0xa3,0x93,0x19,0x09,0x99,0xa3,0x11,0x19,0x99,0xb2,0xc4,0xa3,
+0x92,0x91,0x91,0xa2,0x01,0x10,0x3a,0x3b,0x3b,0x3b,0x3b,0x3b,0x99,0x00,0x10,0x09,
+0x19,0x19,0x19,0x10,0x19,0x5b,0x3c,0x3a,0x2a,0x2a,0x2a,0x2a,0x90,0xb2,0xb3,0xa1,
+0xb3,0xb5,0xb3,0xa1,0xa2,0xb3,0xb4,0x91,0x19,0x10,0x4a,0x2b,0x0b,0x19,0x21,0x1a,
+0xa9,0xb3,0x12,0x39,0x1b,0x1b,0x91,0x03,0x91,0x1b,0x1a,0x11,0x93,0xb1,0xa0,0x30,
+0x30,0x90,0xb9,0x2b,0x49,0x10,0x0b,0x8d,0x28,0x41,0x08,0xeb,0x89,0x41,0x32,0xd8,
+0xfb,0x08,0x46,0x35,0x24,0x00,0x99,0x09,0x18,0x20,0x88,0xa9,0x90,0x83,0x93,0xd2,
+0x98,0x29,0x02,0xa3,0xb9,0xaa,0x32,0x41,0x2b,0x9d,0x00,0x30,0x21,0xab,0xb9,0x93,
+0x84,0x10,0x0c,0x99,0x33,0x39,0x0b,0x9b,0x19,0x03,0xc4,0xb2,0x00,0x39,0x21,0x1a,
+0x1c,0x3a,0x21,0xb3,0xb1,0xb9,0x03,0x94,0xa1,0x1b,0x3c,0x10,0x93,0xb9,0x9a,0x11,
+0x33,0xb1,0xc9,0x00,0x50,0x18,0xc0,0xb8,0x93,0x05,0x81,0x8c,0x1b,0x32,0x05,0xb8,
+0xab,0x39,0x25,0xa2,0xea,0x0a,0x50,0x41,0x99,0xad,0x2a,0x54,0x12,0xfb,0xcd,0xba,
+0x99,0x18,0x18,0x18,0x20,0x88,0xfb,0xbe,0xac,0x99,0x20,0x11,0x90,0xa9,0x08,0x21,
+0x20,0x0b,0x0d,0x29,0x21,0x91,0xd8,0x90,0x31,0x30,0x1b,0x0d,0x3a,0x30,0x11,0xab,
+0xa9,0x13,0x12,0xb1,0xb1,0x10,0x30,0x39,0x0b,0x3c,0x5b,0x00,0x89,0xb0,0x02,0x59,
+0x3b,0x0b,0x2a,0x3a,0x10,0x90,0x0a,0x91,0x93,0x91,0x99,0x3a,0x39,0x99,0x90,0x99,
+0xa2,0x03,0x19,0x1b,0x5b,0x5b,0x1a,0x1a,0x2a,0x49,0x29,0xaa,0xc1,0xa3,0x05,0x08,
+0x9a,0x2b,0x31,0x21,0x9b,0x0c,0x20,0x32,0x19,0x9d,0x19,0x41,0xa3,0xe0,0x1b,0x7a,
+0x21,0xa9,0xdc,0x10,0x47,0x35,0x22,0x90,0x9a,0x19,0x31,0x01,0xba,0x8e,0x48,0x45,
+0x24,0x13,0x90,0x98,0x98,0x01,0x11,0x80,0x99,0x0a,0x49,0x30,0x91,0xcb,0x1b,0x60,
+0x13,0xc1,0xcb,0x19,0x35,0x84,0xda,0x8d,0x48,0x34,0x90,0xdf,0x9c,0x19,0x43,0x82,
+0xfb,0xbf,0xac,0xab,0xaa,0xaa,0x89,0x08,0x10,0x81,0xa8,0x99,0x31,0x36,0x33,0x81,
+0x98,0x88,0x10,0x08,0x1a,0x19,0x82,0xc0,0x8d,0x79,0x45,0x24,0x12,0x99,0x99,0x18,
+0x12,0x91,0xc9,0x90,0x22,0x12,0xba,0x8d,0x59,0x41,0x88,0xbd,0x09,0x56,0x44,0x22,
+0x00,0x99,0x09,0x18,0x11,0x89,0x99,0x00,0x20,0x81,0xa9,0x9a,0x13,0x23,0x19,0xab,
+0x1b,0x50,0x28,0x9a,0x0a,0x3b,0x31,0xa3,0xb1,0x9b,0x39,0x52,0x19,0xcb,0xa8,0x33,
+0x17,0xa0,0xbd,0x2b,0x74,0x37,0x33,0x02,0x98,0x9a,0x18,0x11,0x82,0xa9,0xa9,0x11,
+0x23,0xd3,0xa9,0x3c,0x7a,0x28,0x99,0xa9,0x08,0x23,0x84,0xb9,0x8f,0x29,0x42,0x92,
+0xfa,0x9b,0x60,0x55,0x24,0x13,0x00,0x9a,0x89,0x11,0x11,0x90,0xaa,0x88,0x13,0x94,
+0xc1,0xa9,0x38,0x32,0xb4,0xf0,0x98,0x21,0x32,0x2c,0x8e,0x19,0x51,0x28,0xab,0xbb,
+0x22,0x36,0x81,0xbf,0xaa,0x54,0x46,0x33,0x03,0x80,0x99,0x09,0x18,0x11,0x81,0x0a,
+0x1d,0x3a,0x31,0x12,0xfb,0xca,0x11,0x57,0x35,0x22,0x82,0x99,0x8a,0x10,0x11,0x91,
+0xa9,0x98,0x22,0x31,0x9a,0x9d,0x18,0x31,0x31,0xcb,0xd1,0x93,0x83,0xc2,0x88,0x3d,
+0x4a,0x91,0xb1,0x1a,0x19,0x13,0x21,0x2e,0x3b,0x3a,0x00,0x90,0x9b,0x00,0x93,0xc4,
+0xb3,0x00,0x3a,0x11,0xb2,0x99,0x1a,0x31,0x39,0x2d,0x8a,0x11,0x21,0x99,0xb9,0x91,
+0x12,0x92,0x99,0x2b,0x3b,0x20,0x19,0x9a,0x2b,0x39,0x11,0x99,0xb9,0x91,0x84,0xc2,
+0xb1,0x91,0x40,0x28,0x9b,0x9b,0x3a,0x12,0x93,0xba,0x1b,0x69,0x28,0xa9,0xc9,0x11,
+0x72,0x18,0x8c,0x0c,0x40,0x24,0xf1,0xfb,0xbb,0x9b,0x19,0x11,0x01,0x99,0x99,0x20,
+0x11,0x90,0xaa,0xa0,0x87,0xb4,0xc2,0xa1,0x11,0x11,0xb1,0xd0,0x91,0x03,0x93,0x9b,
+0x0b,0x30,0x31,0x99,0x9b,0x2b,0x22,0x11,0x9b,0x9b,0x31,0x93,0xd3,0xa0,0x28,0x31,
+0x93,0xab,0xab,0x33,0x43,0x1b,0x8f,0x19,0x41,0x39,0x9d,0xb9,0x13,0x07,0xa0,0xba,
+0x2b,0x73,0x13,0xea,0xac,0x40,0x46,0x14,0x91,0xdb,0x99,0x21,0x26,0x02,0xa0,0x9a,
+0x19,0x22,0x02,0xba,0xab,0x31,0x25,0xa1,0xdb,0x1a,0x42,0x22,0xba,0xad,0x10,0x35,
+0x00,0xac,0x8c,0x31,0x25,0xa0,0xbd,0x0a,0x72,0x34,0x24,0x22,0x02,0xa8,0xab,0x48,
+0x57,0x24,0x01,0xaa,0x8b,0x40,0x24,0xa0,0xbf,0x9b,0x30,0x34,0x90,0xdb,0x8a,0x51,
+0x22,0xa8,0xad,0x19,0x53,0x02,0xd9,0xab,0x30,0x36,0x90,0xbd,0x49,0x77,0x36,0x33,
+0x13,0x10,0x31,0x56,0x34,0x34,0x13,0x01,0x89,0x99,0x10,0x32,0x24,0x91,0xda,0xbd,
+0xad,0xbb,0xac,0xbb,0xcc,0xdb,0xdb,0xbb,0xcb,0xba,0xaa,0xaa,0xba,0x99,0x09,0x10,
+0x21,0x32,0x54,0x44,0x34,0x35,0x34,0x34,0x33,0x43,0x32,0x43,0x34,0x34,0x33,0x22,
+0x02,0x80,0x08,0x10,0x22,0x22,0xb0,0xde,0xbd,0xcc,0xba,0xab,0xab,0xbb,0xdb,0xbb,
+0xbb,0xbb,0x99,0x08,0x22,0x44,0x34,0x35,0x33,0x34,0x44,0x43,0x34,0x43,0x33,0x33,
+0x33,0x02,0x80,0x99,0x99,0x89,0xdb,0xed,0xbc,0xcd,0xcb,0xbb,0xac,0xba,0xba,0xcd,
+0xdb,0xcb,0xab,0xaa,0xa9,0x99,0x88,0x30,0x46,0x35,0x32,0x22,0x01,0x22,0x54,0x44,
+0x43,0x22,0x12,0x12,0x11,0x01,0x98,0xcc,0xbc,0xba,0x99,0x89,0xaa,0xbd,0xbd,0xcc,
+0xbb,0xbb,0xac,0xab,0xbb,0xbc,0xcc,0xaa,0x9b,0x89,0x08,0x10,0x22,0x33,0x44,0x43,
+0x44,0x44,0x33,0x24,0x23,0x32,0x32,0x33,0x24,0x22,0x12,0x22,0x22,0x01,0xca,0xbe,
+0xbd,0xbc,0xbc,0xbd,0xbc,0xac,0xcb,0xba,0xbb,0xbb,0x9a,0x08,0x22,0x43,0x22,0x43,
+0x45,0x54,0x53,0x33,0x34,0x24,0x32,0x32,0x34,0x43,0x24,0x33,0x23,0x11,0x01,0x80,
+0x00,0x00,0x98,0xda,0xdc,0xcc,0xcb,0xac,0xbb,0xbb,0xcb,0xba,0xbb,0xbc,0xaa,0x9a,
+0x09,0x22,0x43,0x34,0x34,0x34,0x44,0x43,0x43,0x34,0x43,0x43,0x22,0x23,0x22,0x11,
+0x01,0x88,0x88,0xa9,0xdc,0xdc,0xcc,0xcb,0xbb,0xcb,0xcb,0xbb,0xbc,0xbc,0xbc,0xbb,
+0xbb,0xbb,0xa9,0x99,0xaa,0xbc,0xbc,0x8a,0x41,0x45,0x34,0x33,0x43,0x33,0x43,0x43,
+0x32,0x43,0x22,0x12,0x00,0x89,0xa9,0xb9,0xdc,0xcb,0xcb,0xbb,0xdb,0xcc,0xbc,0xcc,
+0xba,0xab,0xaa,0x99,0x80,0x88,0xa9,0xaa,0x28,0x67,0x44,0x34,0x33,0x24,0x23,0x33,
+0x54,0x43,0x43,0x33,0x23,0x12,0x21,0x11,0x22,0x22,0x01,0x98,0xcb,0xbd,0xbd,0xbc,
+0xbc,0xcc,0xbb,0xbc,0xbb,0xbb,0xcb,0xbb,0xbc,0xab,0xaa,0x88,0x21,0x34,0x34,0x22,
+0x21,0x73,0x54,0x44,0x33,0x24,0x11,0x08,0x99,0x89,0x20,0x43,0x82,0xfb,0xbf,0xad,
+0xbb,0xaa,0xaa,0xaa,0xab,0x09,0x21,0x24,0x02,0xcb,0xcd,0x9a,0x20,0x54,0x34,0x23,
+0x13,0x32,0x33,0x23,0x90,0xdb,0x9b,0x40,0x46,0x33,0x23,0x00,0x88,0x89,0x89,0x88,
+0x08,0xa9,0xed,0xcd,0xbc,0xac,0xbb,0xcb,0xdb,0xbb,0xcb,0xba,0xbb,0xcb,0xaa,0xa9,
+0x89,0x98,0x08,0x31,0x45,0x34,0x34,0x43,0x35,0x44,0x34,0x33,0x33,0x32,0x32,0x33,
+0x33,0x43,0x32,0x12,0x80,0xca,0xcc,0xbb,0xbb,0xbb,0xdc,0xdc,0xdb,0xcb,0xaa,0x9a,
+0x88,0x00,0x80,0x99,0x99,0x09,0x63,0x55,0x53,0x32,0x33,0x33,0x34,0x35,0x44,0x42,
+0x32,0x32,0x32,0x22,0x22,0x21,0x12,0x01,0xa8,0xcc,0xdc,0xcb,0xbb,0xbc,0xcc,0xbb,
+0xbc,0xcb,0xaa,0xab,0xba,0xbc,0xbb,0xaa,0x89,0x10,0x33,0x44,0x33,0x53,0x43,0x44,
+0x44,0x34,0x33,0x22,0x12,0x01,0x21,0x22,0x23,0x01,0xc9,0xed,0xdb,0xcb,0xba,0xba,
+0xca,0xcc,0xcc,0xcb,0xac,0xba,0x9a,0x9a,0xa9,0xab,0xcb,0xaa,0x89,0x20,0x43,0x44,
+0x33,0x34,0x43,0x53,0x43,0x24,0x23,0x33,0x32,0x34,0x42,0x22,0x11,0x80,0x88,0x99,
+0x88,0x08,0xa9,0xde,0xcd,0xcc,0xab,0xaa,0x89,0x08,0x88,0xba,0xcc,0xaa,0x28,0x54,
+0x35,0x43,0x23,0x22,0x33,0x44,0x44,0x34,0x43,0x23,0x23,0x23,0x33,0x43,0x33,0x23,
+0x22,0x00,0xa8,0xdb,0xdc,0xcc,0xbb,0xcc,0xcb,0xcb,0xbb,0xbb,0xcb,0xcb,0xbb,0xbb,
+0xab,0x89,0x88,0x88,0xa9,0xba,0xab,0x48,0x67,0x44,0x33,0x11,0x98,0xab,0x8a,0x21,
+0x43,0x43,0x63,0x54,0x43,0x23,0x01,0xa8,0xbb,0x9b,0x08,0x22,0x82,0xda,0xbd,0xbc,
+0xca,0xdb,0xbd,0xcd,0xaa,0x8a,0x08,0x10,0x00,0x08,0x08,0x11,0x53,0x34,0x36,0x43,
+0x22,0x11,0x01,0x11,0x33,0x23,0x12,0x90,0xba,0xcc,0xcd,0xcb,0xac,0xbb,0xcc,0xcc,
+0xcb,0xbb,0xbb,0xba,0xbb,0xac,0xaa,0x89,0x11,0x32,0x34,0x35,0x34,0x44,0x43,0x34,
+0x34,0x34,0x33,0x24,0x23,0x43,0x33,0x24,0x33,0x22,0x10,0x88,0x89,0x08,0x20,0x00,
+0xfa,0xcd,0xcd,0xbb,0xab,0x9b,0xa9,0xa9,0xcb,0xbc,0xaa,0x8a,0x21,0x54,0x53,0x33,
+0x33,0x33,0x45,0x53,0x44,0x33,0x43,0x32,0x22,0x23,0x43,0x32,0x33,0x12,0x80,0xb9,
+0xdc,0xbc,0xcc,0xcb,0xbc,0xcb,0xbb,0xbc,0xcb,0xba,0xbb,0xbb,0xcb,0xaa,0xaa,0x89,
+0x88,0x80,0x80,0x11,0x54,0x45,0x44,0x33,0x24,0x23,0x22,0x32,0x53,0x33,0x33,0x02,
+0xd9,0xcc,0xbc,0xab,0xab,0xba,0xeb,0xeb,0xcb,0xbc,0xcb,0xbb,0xba,0xba,0xbb,0xbc,
+0xbc,0xaa,0x9a,0x08,0x21,0x44,0x44,0x34,0x43,0x34,0x33,0x44,0x32,0x24,0x24,0x33,
+0x33,0x23,0x22,0x01,0x21,0x42,0x43,0x23,0x01,0xda,0xbd,0xbc,0xac,0xa9,0x99,0xba,
+0xbc,0xbd,0xcb,0xaa,0x89,0x10,0x21,0x33,0x33,0x35,0x45,0x44,0x33,0x35,0x43,0x34,
+0x33,0x24,0x23,0x22,0x22,0x22,0x22,0x11,0x00,0xc9,0xdd,0xbd,0xcc,0xba,0xbb,0xdb,
+0xcb,0xdb,0xbb,0xbc,0xac,0xab,0x99,0x89,0xa9,0xbd,0xbd,0x9b,0x89,0x10,0x22,0x42,
+0x55,0x44,0x44,0x32,0x12,0x11,0x01,0x22,0x53,0x33,0x24,0x11,0x00,0x88,0xb9,0xcc,
+0xcd,0xcb,0xbb,0xab,0xbb,0xbb,0xcc,0xbb,0xbc,0xbb,0xbb,0xaa,0x89,0x80,0x80,0x88,
+0x10,0x54,0x44,0x34,0x35,0x33,0x44,0x22,0x23,0x33,0x33,0x24,0x23,0x11,0x88,0xa9,
+0xcb,0xcb,0xbc,0xcc,0xcb,0xbc,0xdb,0xcb,0xcb,0xbb,0xbc,0xba,0xaa,0xaa,0xa9,0xa9,
+0x88,0x21,0x55,0x44,0x44,0x33,0x34,0x43,0x33,0x53,0x33,0x44,0x33,0x33,0x33,0x22,
+0x12,0x21,0x32,0x33,0x13,0xa9,0xce,0xcc,0xbc,0xbc,0xbb,0xbc,0xbb,0xdb,0xbb,0xac,
+0xbb,0x9a,0x99,0x08,0x10,0x41,0x43,0x44,0x53,0x53,0x43,0x43,0x43,0x33,0x43,0x33,
+0x32,0x12,0x22,0x21,0x12,0x00,0xc9,0xcc,0xbd,0xbc,0xcc,0xca,0xba,0xbc,0xcb,0xbc,
+0xbc,0xbb,0xbb,0xaa,0xba,0xba,0xcb,0xbb,0xab,0x08,0x53,0x44,0x34,0x33,0x22,0x32,
+0x63,0x53,0x43,0x33,0x32,0x11,0x00,0x88,0x89,0x99,0xa8,0xdb,0xdd,0xbc,0xcc,0xbb,
+0xdb,0xcb,0xac,0xbb,0xab,0xaa,0xab,0xbb,0xac,0xaa,0x08,0x31,0x47,0x34,0x44,0x32,
+0x22,0x24,0x35,0x44,0x24,0x33,0x23,0x12,0x12,0x21,0x33,0x35,0x32,0x12,0xa8,0xca,
+0xbc,0xbb,0xbc,0xbc,0xcc,0xcb,0xac,0xcb,0xaa,0xaa,0xaa,0xa9,0xa9,0x99,0x08,0x21,
+0x43,0x53,0x43,0x53,0x34,0x45,0x43,0x33,0x33,0x22,0x21,0x33,0x34,0x34,0x01,0xb8,
+0xde,0xdb,0xab,0xab,0x9a,0xba,0xce,0xcd,0xcb,0xbb,0xab,0xa9,0x9a,0xaa,0x08,0x41,
+0x44,0x23,0x12,0x01,0x21,0x55,0x44,0x43,0x33,0x33,0x33,0x24,0x22,0x81,0xa9,0xac,
+0xaa,0x18,0x11,0x90,0xeb,0xcc,0xbc,0xcb,0xab,0xcb,0xba,0xbd,0xbc,0xcc,0xba,0xaa,
+0xaa,0xaa,0xaa,0x9a,0x89,0x08,0x11,0x54,0x53,0x43,0x33,0x24,0x34,0x34,0x34,0x24,
+0x23,0x32,0x33,0x34,0x33,0x23,0x02,0x90,0xba,0xcc,0xcb,0xca,0xda,0xdb,0xcc,0xbc,
+0xba,0xaa,0x9a,0x98,0xaa,0xbb,0xcb,0x8a,0x41,0x55,0x34,0x24,0x33,0x32,0x43,0x44,
+0x53,0x43,0x33,0x33,0x32,0x22,0x22,0x43,0x43,0x32,0x11,0x98,0xcb,0xdb,0xca,0xca,
+0xcb,0xdb,0xbb,0xbc,0xac,0xab,0xab,0x9a,0xaa,0xaa,0xaa,0x09,0x20,0x43,0x43,0x53,
+0x53,0x53,0x34,0x44,0x33,0x24,0x23,0x32,0x32,0x32,0x33,0x23,0x80,0xeb,0xcc,0xbc,
+0xbb,0xac,0xcb,0xeb,0xdb,0xcb,0xcb,0xba,0xaa,0x9a,0xba,0xcb,0xbc,0xbc,0xba,0x88,
+0x20,0x42,0x32,0x22,0x33,0x54,0x63,0x43,0x43,0x32,0x32,0x21,0x21,0x21,0x33,0x22,
+0x81,0x98,0x99,0xaa,0xdc,0xdc,0xcc,0xcb,0xbc,0xbb,0xcb,0xaa,0xbb,0xdb,0xcb,0xaa,
+0x88,0x32,0x44,0x24,0x33,0x33,0x34,0x44,0x44,0x44,0x43,0x23,0x23,0x22,0x23,0x43,
+0x43,0x32,0x22,0x11,0x08,0xa9,0xaa,0xac,0xcc,0xdb,0xdb,0xbc,0xbc,0xac,0xac,0xab,
+0xbb,0xbb,0xba,0xbb,0xa9,0xa9,0x89,0x89,0x21,0x46,0x35,0x44,0x33,0x43,0x23,0x23,
+0x33,0x35,0x45,0x22,0x91,0xda,0xbc,0xac,0x9a,0xaa,0xaa,0xaa,0x09,0x42,0x23,0xb1,
+0xdf,0xbc,0xbb,0x09,0x30,0x32,0x12,0x88,0x89,0x21,0x02,0xfb,0xce,0xaa,0x19,0x44,
+0x35,0x43,0x22,0x12,0x12,0x22,0x32,0x43,0x33,0x02,0xc9,0xcc,0xcb,0xba,0xcb,0xcb,
+0xbc,0xbd,0xcc,0xcb,0xbb,0xab,0xab,0xba,0xcb,0xcb,0xaa,0x8a,0x18,0x22,0x34,0x45,
+0x43,0x34,0x34,0x43,0x43,0x33,0x24,0x33,0x33,0x24,0x23,0x32,0x11,0x01,0x00,0x00,
+0x01,0x98,0xec,0xcc,0xcc,0xcb,0xba,0xba,0xaa,0xbb,0xcc,0xbb,0xbc,0x99,0x18,0x42,
+0x43,0x33,0x24,0x43,0x53,0x44,0x34,0x34,0x34,0x33,0x33,0x33,0x34,0x33,0x24,0x23,
+0x12,0x81,0xa9,0xdb,0xcb,0xcb,0xcb,0xcc,0xbc,0xbc,0xcb,0xbb,0xac,0xbb,0xbb,0xbb,
+0xbb,0xab,0xaa,0x89,0x18,0x42,0x44,0x44,0x34,0x44,0x42,0x22,0x33,0x24,0x43,0x32,
+0x23,0x23,0x00,0xa9,0xcb,0xbb,0xcb,0xca,0xdc,0xcc,0xcc,0xbc,0xcb,0xba,0xab,0xac,
+0xbb,0xbc,0xbb,0xcb,0xaa,0x99,0x09,0x20,0x32,0x53,0x43,0x34,0x35,0x35,0x43,0x33,
+0x25,0x33,0x33,0x23,0x23,0x32,0x32,0x33,0x43,0x12,0x98,0xcc,0xbd,0xbc,0xab,0xbb,
+0xcb,0xcc,0xcc,0xbb,0xac,0x9b,0x09,0x11,0x22,0x12,0x10,0x41,0x55,0x34,0x44,0x33,
+0x43,0x34,0x34,0x33,0x34,0x33,0x34,0x32,0x23,0x23,0x12,0x01,0xa9,0xdc,0xbc,0xbd,
+0xcb,0xcb,0xcb,0xcc,0xcb,0xbb,0xbb,0xbb,0xaa,0xbb,0xbc,0xbc,0xcb,0xab,0x8a,0x20,
+0x35,0x24,0x01,0xa9,0x9a,0x40,0x45,0x34,0x24,0x44,0x53,0x43,0x32,0x12,0x81,0x88,
+0x09,0x10,0x33,0x14,0x91,0xcc,0xcc,0xcb,0xbc,0xcc,0xbc,0xbb,0xba,0x99,0x89,0x9a,
+0xba,0xaa,0x88,0x22,0x44,0x34,0x35,0x34,0x33,0x34,0x43,0x43,0x33,0x33,0x33,0x32,
+0x12,0x01,0x98,0xbb,0xcd,0xbc,0xcd,0xcb,0xcc,0xbb,0xcc,0xbb,0xcb,0xba,0xaa,0xa9,
+0x99,0x89,0x09,0x88,0x10,0x20,0x32,0x44,0x32,0x12,0x11,0x00,0x52,0x55,0x34,0x34,
+0x12,0x80,0x88,0x21,0x46,0x35,0x24,0x23,0x11,0x80,0x00,0x32,0x46,0x43,0x23,0x11,
+0x81,0x00,0x20,0x63,0x53,0x33,0x23,0x00,0x88,0x08,0x22,0x44,0x22,0x22,0x12,0x12,
+0x08,0x00,0x44,0x45,0x24,0x11,0x80,0x80,0x80,0xc9,0xdc,0xcb,0x9a,0x09,0x08,0x98,
+0xbb,0xcd,0xdb,0xbb,0xab,0x18,0x22,0xb1,0xff,0xcc,0xab,0xaa,0x88,0x08,0x80,0xca,
+0xec,0xdb,0xba,0x9a,0x18,0x11,0xa8,0xde,0xcc,0xba,0x9a,0x88,0x01,0x00,0xb9,0xbc,
+0xad,0x9b,0x89,0x00,0x21,0x80,0xb9,0xbc,0xbb,0x99,0x10,0x21,0x62,0x45,0x45,0x33,
+0x33,0x01,0x00,0x20,0x64,0x54,0x43,0x23,0x13,0x81,0x80,0x20,0x46,0x45,0x24,0x23,
+0x11,0x88,0x88,0x42,0x45,0x43,0x22,0x11,0x08,0x08,0x11,0x31,0x53,0x33,0x23,0x81,
+0x99,0x89,0x41,0x44,0x22,0x01,0x80,0x00,0x88,0xca,0xcc,0xcb,0xcb,0xbb,0xaa,0x10,
+0x81,0xfc,0xce,0xac,0x9a,0x88,0x81,0x90,0xdb,0xdc,0xcc,0xcb,0x9a,0x08,0x11,0xa0,
+0xde,0xbd,0xbb,0x9a,0x89,0x88,0x88,0x42,0x55,0x34,0x33,0x13,0x80,0x88,0x20,0x45,
+0x35,0x33,0x22,0x01,0x00,0x00,0xc8,0xdd,0xbc,0xac,0x89,0x08,0x80,0xa8,0xba,0xcb,
+0xaa,0x9a,0x89,0x18,0x01,0xc9,0xbe,0xbc,0x9a,0x08,0x80,0x80,0x89,0x98,0xb9,0xeb,
+0xaa,0x28,0x53,0x02,0xd8,0xdb,0xaa,0x89,0x80,0x88,0x18,0x54,0x45,0x33,0x33,0x11,
+0x81,0x01,0x32,0x55,0x43,0x24,0x22,0x11,0x00,0x21,0x55,0x44,0x34,0x24,0x02,0x00,
+0x09,0x20,0x46,0x35,0x43,0x12,0x81,0x88,0x08,0x42,0x44,0x34,0x22,0x02,0x80,0x88,
+0x20,0x54,0x43,0x33,0x02,0x80,0x99,0x88,0x22,0x43,0x32,0x22,0x01,0x80,0x9a,0x19,
+0x62,0x35,0x24,0x12,0x01,0xa8,0xfa,0xcc,0xbc,0xbc,0x9a,0x99,0x98,0xaa,0xbd,0xbd,
+0xbc,0xbb,0xaa,0x80,0x90,0xfb,0xdd,0xdb,0xba,0x9a,0x89,0x88,0x99,0xdc,0xcc,0xbb,
+0xac,0x8a,0x08,0x81,0xc9,0xce,0xbc,0xbc,0xa9,0x08,0x00,0x88,0xaa,0xcc,0xbb,0xba,
+0x99,0x08,0x11,0x88,0xcb,0xad,0x9b,0x08,0x10,0x00,0x20,0x56,0x54,0x33,0x22,0x81,
+0x80,0x10,0x45,0x45,0x34,0x33,0x13,0x81,0x89,0x41,0x56,0x44,0x33,0x22,0x01,0x98,
+0x00,0x44,0x45,0x33,0x22,0x01,0x80,0x08,0x10,0x33,0x35,0x33,0x22,0x80,0x98,0x00,
+0x53,0x43,0x22,0x00,0x10,0x10,0xa8,0xdd,0xbd,0xac,0xab,0xbb,0xbc,0xbc,0xbc,0xbd,
+0xcd,0xba,0xaa,0x8a,0x08,0x98,0xeb,0xdd,0xbc,0xbc,0x9a,0x10,0x11,0xd9,0xce,0xbc,
+0xab,0x9a,0x89,0x89,0x18,0x52,0x36,0x35,0x32,0x01,0x80,0x88,0x31,0x45,0x44,0x22,
+0x21,0x10,0x00,0x90,0xda,0xcd,0xcb,0x9a,0x89,0x00,0x88,0xa9,0xbb,0xcb,0xba,0xaa,
+0x8a,0x18,0x81,0xd9,0xcd,0xac,0x89,0x08,0x81,0x90,0xaa,0xaa,0x9a,0x9a,0x99,0x18,
+0x20,0x98,0xde,0xbc,0xac,0x89,0x00,0x01,0x12,0x44,0x36,0x35,0x24,0x02,0x81,0x08,
+0x30,0x44,0x35,0x23,0x13,0x81,0x00,0x31,0x47,0x45,0x43,0x22,0x01,0x90,0x08,0x42,
+0x55,0x34,0x33,0x22,0x80,0x88,0x30,0x45,0x25,0x14,0x12,0x01,0x08,0x88,0x21,0x63,
+0x43,0x33,0x02,0x98,0x89,0x28,0x43,0x23,0x13,0x01,0x00,0x88,0x99,0x38,0x56,0x34,
+0x23,0x80,0xa9,0x9a,0xcc,0xce,0xbd,0xbb,0x99,0x08,0x90,0xb8,0xdc,0xdb,0xcb,0xbb,
+0xaa,0x08,0x00,0xe9,0xdd,0xbc,0xac,0x9a,0x08,0x00,0xa8,0xdc,0xcc,0xbb,0xab,0x88,
+0x10,0x80,0xea,0xcd,0xbc,0xac,0x99,0x08,0x10,0x98,0xc9,0xdb,0xaa,0x9a,0x08,0x00,
+0x00,0xb9,0xcb,0xbb,0x89,0x11,0x80,0x89,0x48,0x57,0x44,0x23,0x12,0x00,0x88,0x31,
+0x45,0x45,0x34,0x33,0x01,0x88,0x09,0x72,0x45,0x43,0x32,0x11,0x00,0x88,0x20,0x63,
+0x44,0x33,0x23,0x01,0x88,0x08,0x21,0x43,0x34,0x33,0x22,0x90,0xa9,0x0a,0x62,0x43,
+0x22,0x88,0x89,0x08,0x90,0xec,0xcc,0xbb,0xba,0xa9,0x99,0x99,0xca,0xcf,0xbd,0xbc,
+0xaa,0x08,0x00,0xc9,0xdd,0xbc,0xbd,0xba,0x99,0x10,0x01,0xfa,0xcd,0xbc,0xab,0x9a,
+0x88,0x88,0x00,0x63,0x45,0x43,0x12,0x01,0x88,0x08,0x42,0x35,0x34,0x22,0x11,0x10,
+0x00,0xa8,0xec,0xcc,0xbb,0x9a,0x89,0x00,0x90,0xb9,0xbc,0xcb,0xaa,0xaa,0x88,0x00,
+0x90,0xcc,0xbd,0xac,0x89,0x08,0x00,0x88,0x89,0xaa,0xca,0xab,0x09,0x41,0x23,0xa1,
+0xec,0xac,0xab,0x99,0x89,0x18,0x41,0x54,0x53,0x43,0x23,0x13,0x01,0x00,0x31,0x55,
+0x43,0x23,0x12,0x01,0x00,0x43,0x46,0x35,0x34,0x23,0x02,0x89,0x18,0x73,0x45,0x33,
+0x33,0x21,0x08,0x88,0x31,0x45,0x35,0x43,0x12,0x80,0x98,0x18,0x42,0x35,0x34,0x22,
+0x01,0x98,0x98,0x18,0x31,0x53,0x33,0x22,0x90,0xba,0xaa,0x51,0x45,0x34,0x11,0x80,
+0xa9,0xa9,0xbc,0xbf,0xcc,0xaa,0x8a,0x89,0x99,0xcb,0xdb,0xcb,0xbb,0xac,0x9a,0x08,
+0x90,0xec,0xdd,0xcb,0xbb,0x99,0x00,0x80,0xc9,0xcd,0xcc,0xbb,0xaa,0x88,0x00,0x90,
+0xeb,0xcd,0xcb,0xaa,0x99,0x00,0x80,0xa9,0xcb,0xac,0xab,0xaa,0x88,0x11,0x10,0xa9,
+0xbd,0xac,0x8a,0x08,0x00,0x00,0x62,0x45,0x34,0x23,0x11,0x00,0x30,0x73,0x44,0x34,
+0x34,0x23,0x81,0x98,0x18,0x55,0x45,0x43,0x23,0x02,0x80,0x88,0x20,0x45,0x35,0x33,
+0x22,0x01,0x88,0x00,0x22,0x53,0x33,0x23,0x01,0x88,0x89,0x20,0x44,0x32,0x11,0x11,
+0x11,0x91,0xec,0xcc,0xbc,0xba,0xac,0xaa,0x89,0x80,0xea,0xce,0xcc,0xaa,0x89,0x08,
+0x98,0xdb,0xcc,0xbd,0xbc,0xbb,0x89,0x20,0x80,0xfc,0xcd,0xbb,0xab,0x99,0x89,0x09,
+0x28,0x55,0x44,0x43,0x12,0x00,0x88,0x18,0x43,0x45,0x32,0x22,0x11,0x10,0x80,0xb8,
+0xce,0xcc,0xbb,0x99,0x09,0x00,0x98,0xba,0xcb,0xcb,0xba,0x99,0x08,0x00,0xb8,0xdd,
+0xcb,0x9a,0x88,0x01,0x08,0x99,0x9a,0xaa,0xbc,0xbb,0x08,0x53,0x14,0xb0,0xcd,0xac,
+0x9a,0x08,0x00,0x10,0x40,0x73,0x43,0x43,0x12,0x11,0x00,0x11,0x43,0x34,0x25,0x33,
+0x22,0x00,0x00,0x42,0x47,0x35,0x34,0x13,0x81,0x88,0x30,0x65,0x53,0x33,0x22,0x01,
+0x88,0x18,0x41,0x44,0x53,0x32,0x12,0x00,0x88,0x00,0x43,0x54,0x32,0x13,0x11,0x80,
+0x80,0x10,0x31,0x53,0x22,0x82,0xb8,0xbb,0x89,0x73,0x34,0x33,0x12,0x00,0x80,0xa9,
+0xcf,0xdc,0xcb,0xab,0x9a,0x09,0x89,0xdb,0xcd,0xbb,0xac,0x89,0x08,0x88,0xca,0xec,
+0xdb,0xcb,0xaa,0x8a,0x88,0x80,0xba,0xcf,0xcb,0xbb,0xaa,0x08,0x00,0xa8,0xde,0xcc,
+0xac,0xaa,0x88,0x00,0x80,0xa9,0xbc,0xbc,0xab,0x99,0x00,0x10,0x90,0xca,0xbd,0xab,
+0x09,0x00,0x08,0x10,0x73,0x45,0x24,0x23,0x01,0x00,0x10,0x52,0x54,0x44,0x33,0x22,
+0x80,0x88,0x20,0x56,0x44,0x43,0x22,0x01,0x88,0x88,0x31,0x46,0x43,0x23,0x12,0x00,
+0x08,0x10,0x22,0x43,0x24,0x23,0x11,0x98,0x88,0x20,0x43,0x13,0x01,0x10,0x32,0x91,
+0xee,0xbc,0xad,0xab,0xaa,0x9a,0x88,0xa0,0xfd,0xdc,0xcb,0x9a,0x89,0x08,0x98,0xda,
+0xcc,0xcd,0xbb,0xab,0x08,0x12,0xa1,0xee,0xcc,0xbb,0x9b,0x8a,0x89,0x08,0x41,0x55,
+0x43,0x33,0x12,0x90,0x88,0x20,0x64,0x43,0x33,0x12,0x01,0x01,0x81,0xc8,0xdd,0xbc,
+0xbb,0x99,0x80,0x00,0xa9,0xbb,0xbd,0xba,0xaa,0x99,0x00,0x00,0xca,0xcd,0xbb,0x9b,
+0x88,0x00,0x88,0x99,0xaa,0xdb,0xbb,0x8a,0x20,0x24,0xa0,0xed,0xab,0x9a,0x10,0x02,
+0x80,0x00,0x54,0x36,0x35,0x33,0x33,0x22,0x21,0x22,0x44,0x53,0x33,0x33,0x22,0x08,
+0x30,0x56,0x36,0x35,0x23,0x01,0x80,0x19,0x42,0x55,0x43,0x33,0x23,0x02,0x80,0x88,
+0x41,0x55,0x43,0x32,0x01,0x88,0x09,0x21,0x44,0x34,0x23,0x22,0x00,0x08,0x08,0x32,
+0x44,0x33,0x11,0xa8,0xba,0x9b,0x41,0x46,0x24,0x13,0x01,0x98,0x99,0xbb,0xcf,0xcc,
+0xbb,0xab,0x89,0x00,0x88,0xdb,0xcc,0xbc,0xac,0x9a,0x89,0x98,0xea,0xdc,0xdb,0xab,
+0xab,0x89,0x00,0x80,0xea,0xcc,0xbc,0xbb,0x99,0x00,0x80,0xeb,0xcd,0xdb,0xba,0x99,
+0x09,0x08,0x98,0xca,0xbb,0xbc,0xaa,0x99,0x08,0x00,0x88,0xcb,0xdb,0xaa,0x99,0x01,
+0x01,0x32,0x64,0x44,0x34,0x22,0x01,0x10,0x41,0x45,0x44,0x24,0x33,0x12,0x00,0x08,
+0x31,0x57,0x44,0x24,0x22,0x01,0x80,0x00,0x52,0x34,0x25,0x13,0x02,0x80,0x08,0x00,
+0x22,0x34,0x24,0x13,0x00,0x99,0x08,0x42,0x43,0x12,0x80,0x88,0x00,0x90,0xfa,0xcc,
+0xbc,0xcb,0x9a,0x08,0x01,0xb8,0xdf,0xbd,0xbb,0x9a,0x89,0x90,0xa9,0xcc,0xce,0xcc,
+0xcb,0x9a,0x18,0x11,0xc8,0xed,0xcb,0xab,0x9a,0x88,0x89,0x08,0x42,0x46,0x34,0x22,
+0x11,0x88,0x08,0x21,0x55,0x43,0x23,0x12,0x01,0x00,0x80,0xc9,0xdd,0xdb,0xaa,0x89,
+0x00,0x80,0xa9,0xbb,0xcb,0xaa,0xa9,0x99,0x08,0x88,0xc9,0xcd,0xab,0x9b,0x89,0x88,
+0x88,0x88,0x90,0xca,0xbd,0xab,0x28,0x34,0x82,0xeb,0xbc,0x9b,0x88,0x88,0x08,0x30,
+0x56,0x53,0x32,0x32,0x32,0x22,0x12,0x31,0x64,0x44,0x24,0x02,0x80,0x09,0x42,0x55,
+0x34,0x33,0x14,0x02,0x80,0x18,0x52,0x36,0x35,0x23,0x12,0x81,0x80,0x00,0x53,0x54,
+0x43,0x22,0x01,0x98,0x88,0x31,0x36,0x34,0x22,0x01,0x88,0x08,0x00,0x21,0x53,0x23,
+0x03,0xa8,0xcb,0x9a,0x30,0x53,0x23,0x23,0x33,0x04,0xd9,0xce,0xbd,0xbb,0xab,0xaa,
+0xaa,0xaa,0xdb,0xeb,0xcb,0xbc,0xaa,0x8a,0x08,0x98,0xdc,0xcd,0xbc,0xcb,0x9a,0x99,
+0x88,0xa9,0xdc,0xcc,0xac,0xab,0x89,0x00,0x80,0xda,0xce,0xcb,0xab,0x99,0x88,0x00,
+0x98,0xca,0xdb,0xbb,0xba,0x89,0x20,0x11,0x90,0xcc,0xbc,0x9a,0x08,0x21,0x11,0x42,
+0x54,0x63,0x32,0x22,0x81,0x88,0x10,0x64,0x54,0x43,0x23,0x12,0x80,0x89,0x41,0x46,
+0x44,0x33,0x12,0x01,0x88,0x28,0x73,0x43,0x33,0x22,0x11,0x08,0x08,0x10,0x43,0x34,
+0x43,0x12,0x80,0xa9,0x89,0x20,0x32,0x34,0x21,0x00,0x88,0xa9,0xdb,0xce,0xcd,0xbb,
+0x30,0x77,0x45,0x33,0x22,0x01,0x08,0x31,0x56,0x34,0x44,0x22,0x23,0x21,0x12,0x81,
+0xb9,0xce,0xbd,0xbc,0xbb,0xbb,0xbd,0xac,0xbb,0x99,0x89,0xb9,0xcc,0xab,0x0a,0x52,
+0x44,0x33,0x24,0x23,0x22,0x01,0x22,0x44,0x34,0x12,0xca,0xcd,0xbb,0xbb,0xbb,0xdb,
+0xaa,0x08,0x54,0x34,0x34,0x33,0x43,0x33,0x24,0x32,0x22,0x22,0x01,0xea,0xdc,0xdb,
+0xba,0xba,0xca,0xba,0xac,0xaa,0x89,0x89,0x99,0x8a,0x28,0x44,0x36,0x34,0x43,0x32,
+0x32,0x12,0x11,0x99,0xdb,0xbd,0xcc,0xcb,0xbb,0xbc,0xbb,0xab,0x9b,0x8a,0x09,0x10,
+0x43,0x55,0x53,0x43,0x33,0x33,0x33,0x32,0x12,0x81,0xba,0xcd,0xcd,0xcb,0xbc,0xbc,
+0xba,0xac,0x9a,0x8a,0x88,0x22,0x34,0x36,0x34,0x34,0x24,0x33,0x33,0x22,0x11,0x01,
+0x88,0xa8,0xcc,0xcd,0xbc,0xbc,0xac,0xab,0xba,0xaa,0x89,0x31,0x64,0x43,0x43,0x43,
+0x32,0x24,0x23,0x23,0x01,0x01,0x10,0x10,0x98,0xec,0xcc,0xbc,0xbb,0xcb,0xba,0xaa,
+0x8a,0x20,0x54,0x53,0x33,0x34,0x43,0x33,0x24,0x22,0x12,0x00,0x01,0x08,0xa9,0xdc,
+0xdc,0xcb,0xcb,0xba,0xab,0xab,0x9a,0x88,0x31,0x45,0x53,0x33,0x35,0x43,0x32,0x33,
+0x12,0x02,0x01,0x80,0xba,0xce,0xcc,0xbc,0xcb,0xcb,0xba,0xaa,0xa9,0x98,0x80,0x21,
+0x53,0x44,0x44,0x33,0x24,0x33,0x22,0x12,0x81,0x98,0xdb,0xbd,0xcc,0xcb,0xcb,0xbb,
+0xcb,0xaa,0x99,0x99,0x88,0x88,0x31,0x64,0x53,0x43,0x33,0x33,0x33,0x23,0x11,0xa8,
+0xcd,0xbd,0xbc,0xcc,0xba,0xcb,0xba,0xab,0x9a,0x99,0x99,0xaa,0x89,0x51,0x46,0x34,
+0x24,0x33,0x23,0x23,0x12,0x90,0xda,0xcc,0xbc,0xdb,0xbb,0xbc,0xbb,0xbb,0xaa,0xaa,
+0x89,0x18,0x42,0x45,0x44,0x53,0x32,0x24,0x23,0x22,0x12,0x01,0x80,0xa8,0xda,0xcd,
+0xcb,0xbc,0xba,0xbb,0xbb,0xab,0x0a,0x31,0x37,0x35,0x43,0x34,0x43,0x33,0x33,0x23,
+0x21,0x10,0x22,0x22,0x82,0xfa,0xcd,0xbc,0xcb,0xba,0xab,0xbb,0x8a,0x20,0x46,0x34,
+0x34,0x24,0x24,0x33,0x33,0x33,0x12,0x11,0x10,0x88,0xb9,0xce,0xbd,0xbd,0xcb,0xbb,
+0xbb,0xba,0xa9,0x88,0x31,0x54,0x34,0x35,0x43,0x24,0x33,0x23,0x22,0x12,0x80,0xb9,
+0xcd,0xdb,0xbc,0xcb,0xac,0xac,0xba,0x9a,0x9a,0x89,0x08,0x18,0x42,0x54,0x34,0x44,
+0x32,0x22,0x22,0x22,0x00,0xba,0xbf,0xbd,0xbc,0xbb,0xcb,0xcb,0xcb,0x9a,0x89,0x88,
+0xb9,0xbc,0xab,0x28,0x45,0x44,0x33,0x33,0x24,0x11,0x12,0x32,0x45,0x23,0x81,0xeb,
+0xbc,0xac,0xaa,0xaa,0xbb,0x9b,0x40,0x55,0x53,0x32,0x33,0x33,0x34,0x32,0x33,0x23,
+0x12,0xa8,0xde,0xcc,0xbb,0xbb,0xcb,0xca,0xba,0xab,0x9b,0x99,0x98,0x98,0x08,0x42,
+0x55,0x53,0x33,0x43,0x23,0x23,0x13,0x01,0xaa,0xcd,0xcc,0xbb,0xcc,0xba,0xac,0xab,
+0xab,0x99,0x89,0x18,0x21,0x44,0x44,0x44,0x43,0x33,0x33,0x32,0x22,0x11,0x88,0xcb,
+0xcd,0xdb,0xbb,0xcc,0xbb,0xbb,0xbb,0xba,0x99,0x00,0x52,0x44,0x44,0x43,0x33,0x34,
+0x33,0x23,0x23,0x11,0x00,0x90,0xc9,0xdc,0xbc,0xbd,0xcb,0xbb,0xbb,0xab,0x9b,0x08,
+0x43,0x45,0x53,0x43,0x33,0x34,0x33,0x24,0x12,0x11,0x11,0x01,0x01,0xc9,0xec,0xdb,
+0xbb,0xcb,0xba,0xba,0xaa,0x89,0x31,0x36,0x45,0x33,0x34,0x43,0x43,0x22,0x22,0x01,
+0x01,0x00,0x80,0xc9,0xdc,0xbc,0xbd,0xbb,0xbb,0xac,0xaa,0x9a,0x00,0x33,0x46,0x43,
+0x34,0x43,0x43,0x22,0x13,0x12,0x01,0x00,0x98,0xca,0xcd,0xcc,0xcb,0xbb,0xcb,0xba,
+0xaa,0x99,0x88,0x10,0x31,0x45,0x44,0x34,0x43,0x23,0x33,0x22,0x21,0x00,0xb9,0xcd,
+0xcc,0xcb,0xcb,0xac,0xbb,0xab,0xab,0x99,0x89,0x88,0x10,0x53,0x45,0x53,0x43,0x23,
+0x33,0x22,0x22,0x81,0xa9,0xbe,0xcd,0xbb,0xbc,0xbc,0xcb,0xab,0x9b,0x9a,0x98,0x99,
+0x99,0x18,0x55,0x44,0x34,0x33,0x33,0x33,0x33,0x11,0xa0,0xdc,0xcc,0xcb,0xbc,0xcb,
+0xbb,0xbb,0xcb,0xa9,0x89,0x09,0x10,0x42,0x45,0x44,0x33,0x34,0x33,0x33,0x23,0x12,
+0x00,0x80,0xaa,0xdd,0xcc,0xbc,0xac,0xbb,0xab,0xbb,0x9a,0x08,0x53,0x44,0x34,0x34,
+0x34,0x43,0x33,0x32,0x22,0x21,0x11,0x21,0x12,0xa8,0xde,0xcc,0xbc,0xba,0xbb,0xbb,
+0xbb,0x09,0x52,0x45,0x34,0x43,0x42,0x42,0x32,0x23,0x23,0x11,0x11,0x80,0x90,0xda,
+0xcc,0xbd,0xbc,0xbc,0xba,0xba,0xaa,0x8a,0x08,0x43,0x44,0x53,0x43,0x43,0x33,0x24,
+0x32,0x21,0x10,0x88,0xba,0xdc,0xbc,0xbd,0xcb,0xcb,0xbb,0xba,0xaa,0x9a,0x98,0x10,
+0x42,0x45,0x34,0x44,0x32,0x32,0x22,0x22,0x01,0xb8,0xce,0xcc,0xbb,0xcb,0xbb,0xbc,
+0xac,0x9b,0x99,0x98,0xb9,0xbd,0xaa,0x28,0x45,0x44,0x32,0x43,0x22,0x11,0x11,0x21,
+0x44,0x23,0x82,0xea,0xcc,0xab,0xab,0xab,0xac,0x9a,0x30,0x46,0x34,0x34,0x32,0x43,
+0x33,0x33,0x33,0x32,0x12,0xb0,0xed,0xbc,0xbd,0xba,0xbb,0xcb,0xbb,0xbb,0xaa,0x99,
+0x98,0x99,0x89,0x41,0x55,0x35,0x43,0x43,0x22,0x32,0x21,0x81,0xa8,0xdb,0xcc,0xbc,
+0xcb,0xcb,0xba,0xbb,0xbb,0xaa,0x89,0x08,0x31,0x63,0x35,0x45,0x33,0x34,0x33,0x32,
+0x22,0x11,0x90,0xba,0xbe,0xbd,0xbd,0xbc,0xcb,0xab,0xab,0x9b,0x9a,0x00,0x42,0x44,
+0x34,0x35,0x43,0x43,0x23,0x23,0x12,0x12,0x00,0x80,0xaa,0xcd,0xcc,0xbc,0xbc,0xbb,
+0xbb,0xbb,0x9a,0x09,0x32,0x46,0x44,0x43,0x33,0x44,0x32,0x32,0x12,0x11,0x10,0x10,
+0x01,0xb8,0xcf,0xbc,0xad,0xbb,0xab,0xbb,0xbb,0x89,0x21,0x46,0x53,0x43,0x33,0x25,
+0x33,0x33,0x22,0x12,0x01,0x01,0x80,0xca,0xdd,0xbc,0xbd,0xbb,0xbb,0xac,0xaa,0x9a,
+0x18,0x41,0x63,0x43,0x43,0x43,0x43,0x32,0x22,0x12,0x01,0x00,0x98,0xba,0xde,0xdb,
+0xcb,0xbb,0xbb,0xac,0xaa,0x9a,0x89,0x00,0x32,0x45,0x35,0x34,0x34,0x33,0x23,0x33,
+0x12,0x81,0xb9,0xdc,0xcc,0xcb,0xdb,0xbb,0xbc,0xba,0xaa,0xa9,0x98,0x88,0x10,0x43,
+0x45,0x44,0x43,0x33,0x32,0x23,0x22,0x01,0xb9,0xcd,0xcc,0xcb,0xcb,0xbb,0xbc,0xbb,
+0xbb,0xa9,0x99,0x99,0x9a,0x10,0x74,0x44,0x43,0x33,0x33,0x33,0x23,0x12,0x98,0xcc,
+0xbd,0xbd,0xcb,0xcb,0xcb,0xba,0xab,0x9a,0x99,0x88,0x20,0x52,0x44,0x53,0x34,0x43,
+0x32,0x23,0x13,0x11,0x01,0x80,0xa9,0xdc,0xcc,0xdb,0xbb,0xac,0xab,0xab,0x9a,0x08,
+0x41,0x44,0x44,0x33,0x34,0x43,0x33,0x23,0x23,0x12,0x11,0x22,0x12,0xb0,0xde,0xbd,
+0xbc,0xac,0xab,0xab,0xab,0x09,0x31,0x46,0x34,0x34,0x34,0x33,0x34,0x33,0x32,0x21,
+0x01,0x00,0x90,0xc9,0xdd,0xbc,0xbd,0xbb,0xac,0xab,0xaa,0x99,0x08,0x32,0x35,0x45,
+0x43,0x34,0x33,0x33,0x24,0x21,0x11,0x90,0xb9,0xcd,0xbc,0xbc,0xcc,0xbb,0xcb,0xab,
+0xaa,0x9a,0x88,0x08,0x20,0x44,0x35,0x35,0x34,0x33,0x33,0x32,0x21,0x80,0xda,0xcd,
+0xbc,0xac,0xcb,0xba,0xbc,0xbb,0xaa,0x89,0x99,0xcb,0xac,0x8a,0x41,0x45,0x43,0x33,
+0x33,0x33,0x21,0x11,0x43,0x44,0x23,0xa0,0xec,0xbc,0xbb,0xbb,0xca,0xaa,0x0a,0x52,
+0x45,0x43,0x32,0x33,0x34,0x33,0x43,0x22,0x21,0x01,0xb8,0xdd,0xcc,0xbb,0xac,0xab,
+0xac,0xbb,0xaa,0x9a,0x89,0x99,0x99,0x18,0x44,0x36,0x44,0x33,0x33,0x24,0x32,0x11,
+0x81,0xba,0xdd,0xcb,0xcb,0xcb,0xbb,0xcb,0xab,0xaa,0x99,0x09,0x18,0x31,0x64,0x34,
+0x35,0x43,0x33,0x33,0x32,0x22,0x81,0x98,0xbc,0xcd,0xcc,0xcb,0xcb,0xba,0xab,0xab,
+0xaa,0x99,0x20,0x63,0x34,0x44,0x43,0x24,0x43,0x22,0x23,0x11,0x11,0x80,0x88,0xca,
+0xcc,0xcc,0xcb,0xbb,0xcb,0xaa,0x9b,0x9a,0x00,0x53,0x34,0x35,0x34,0x43,0x43,0x23,
+0x33,0x21,0x10,0x00,0x11,0x90,0xea,0xdc,0xbc,0xcb,0xab,0xbb,0xab,0x9b,0x19,0x52,
+0x44,0x43,0x34,0x43,0x43,0x33,0x32,0x22,0x01,0x01,0x00,0x98,0xfb,0xbc,0xbd,0xcc,
+0xba,0xba,0xba,0x9a,0x89,0x10,0x52,0x34,0x45,0x33,0x34,0x43,0x32,0x22,0x12,0x01,
+0x08,0xa9,0xcc,0xdc,0xcb,0xbc,0xbb,0xac,0xab,0x9b,0x9a,0x08,0x10,0x43,0x45,0x34,
+0x35,0x33,0x33,0x33,0x23,0x12,0x80,0xca,0xcd,0xdb,0xcb,0xbc,0xcb,0xab,0xbb,0xaa,
+0x99,0x89,0x08,0x30,0x54,0x44,0x34,0x34,0x33,0x33,0x23,0x13,0x81,0xcb,0xcd,0xbc,
+0xbc,0xbc,0xbc,0xbb,0xcb,0x9a,0x99,0x99,0x98,0x89,0x31,0x37,0x36,0x43,0x33,0x33,
+0x33,0x23,0x81,0xb8,0xcd,0xcc,0xcb,0xcb,0xcb,0xbb,0xbb,0xbb,0x9a,0x99,0x18,0x31,
+0x54,0x44,0x44,0x33,0x34,0x33,0x32,0x12,0x11,0x00,0x88,0xcb,0xdc,0xcc,0xcb,0xbb,
+0xac,0xba,0x9a,0x9a,0x00,0x43,0x45,0x43,0x43,0x43,0x33,0x43,0x22,0x12,0x01,0x01,
+0x21,0x81,0xc9,0xdd,0xbc,0xbc,0xba,0xcb,0xaa,0x9a,0x08,0x42,0x35,0x35,0x43,0x24,
+0x43,0x32,0x23,0x12,0x11,0x01,0x00,0x98,0xeb,0xdc,0xcb,0xcb,0xbb,0xba,0xbb,0xaa,
+0x89,0x28,0x53,0x44,0x53,0x43,0x33,0x34,0x33,0x32,0x12,0x01,0x98,0xcb,0xcd,0xdb,
+0xcb,0xcb,0xbb,0xbb,0xac,0xa9,0x99,0x98,0x00,0x32,0x55,0x34,0x35,0x33,0x33,0x32,
+0x32,0x11,0xa0,0xdc,0xbd,0xad,0xcb,0xba,0xbc,0xcb,0xba,0x99,0x89,0xa9,0xba,0xac,
+0x18,0x54,0x44,0x43,0x32,0x32,0x22,0x12,0x22,0x53,0x33,0x01,0xea,0xcd,0xbb,0xbb,
+0xbb,0xcb,0xab,0x08,0x54,0x44,0x43,0x23,0x43,0x23,0x33,0x24,0x22,0x12,0x80,0xda,
+0xdc,0xcb,0xab,0xcb,0xba,0xcb,0xab,0xaa,0x9a,0x89,0x89,0x09,0x20,0x55,0x44,0x43,
+0x43,0x22,0x23,0x21,0x11,0x98,0xca,0xbd,0xcc,0xcb,0xbb,0xbc,0xbb,0xbb,0x9b,0x8a,
+0x88,0x11,0x53,0x45,0x53,0x24,0x24,0x23,0x23,0x23,0x11,0x80,0xa9,0xcc,0xbc,0xcd,
+0xbb,0xcc,0xaa,0xab,0xaa,0x9a,0x88,0x31,0x44,0x44,0x34,0x43,0x43,0x33,0x33,0x23,
+0x21,0x00,0x80,0xa9,0xdc,0xcc,0xbc,0xbc,0xbb,0xbb,0xac,0xaa,0x09,0x20,0x54,0x43,
+0x34,0x34,0x43,0x24,0x23,0x22,0x12,0x11,0x11,0x00,0xa9,0xce,0xcc,0xcb,0xcb,0xaa,
+0xba,0xaa,0x99,0x10,0x42,0x44,0x33,0x43,0x34,0x53,0x33,0x43,0x22,0x22,0x33,0x24,
+0x23,0x11,0x98,0xca,0xdb,0xcb,0xbc,0xbd,0xbc,0xbc,0xba,0xab,0xab,0xbb,0xab,0xab,
+0x08,0x41,0x53,0x53,0x53,0x53,0x43,0x34,0x42,0x22,0x22,0x22,0x22,0x11,0x01,0x98,
+0xbc,0xbd,0xbc,0xbc,0xcc,0xcb,0xbc,0xbb,0xac,0xab,0xba,0xbb,0xac,0x9a,0x08,0x21,
+0x43,0x44,0x53,0x34,0x44,0x33,0x33,0x23,0x12,0x12,0x22,0x13,0x81,0xb9,0xcc,0xbc,
+0xdc,0xdb,0xcc,0xbc,0xbb,0xac,0xaa,0xab,0xab,0xab,0x9a,0x98,0x98,0xa9,0xaa,0x30,
+0x67,0x44,0x34,0x43,0x33,0x33,0x33,0x23,0x01,0x88,0x9a,0xbb,0xbc,0xcc,0xcc,0xbc,
+0xbd,0xdb,0xbb,0xcb,0xab,0xbb,0xaa,0xaa,0x99,0x08,0x21,0x44,0x34,0x35,0x35,0x44,
+0x43,0x32,0x24,0x22,0x22,0x22,0x22,0x01,0x01,0x08,0x08,0xa9,0xdd,0xcd,0xbc,0xbc,
+0xac,0xbb,0xbb,0xba,0x99,0x10,0x33,0x25,0x33,0x43,0x44,0x53,0x33,0x34,0x35,0x34,
+0x25,0x33,0x22,0x12,0x12,0x10,0x00,0x99,0xcb,0xbc,0xcb,0xbc,0xcc,0xbc,0xcb,0xcb,
+0xaa,0xab,0xab,0xba,0x99,0x20,0x53,0x44,0x33,0x44,0x43,0x34,0x43,0x33,0x33,0x23,
+0x23,0x22,0x01,0x88,0xba,0xdb,0xcc,0xbc,0xbd,0xbc,0xcc,0xcb,0xac,0xbb,0xba,0xab,
+0xaa,0x9a,0x09,0x10,0x43,0x34,0x34,0x24,0x23,0x44,0x53,0x34,0x33,0x22,0x22,0x23,
+0x23,0xa1,0xee,0xcc,0xcb,0xba,0xaa,0xbb,0xad,0xac,0xba,0xab,0xab,0x09,0x31,0x36,
+0x33,0x22,0x32,0x63,0x53,0x33,0x53,0x43,0x35,0x34,0x24,0x22,0x21,0x10,0x00,0x88,
+0x99,0x9a,0xbb,0xde,0xdc,0xcb,0xbb,0xbb,0xaa,0xaa,0xab,0xab,0x9a,0x09,0x88,0x88,
+0x88,0x31,0x57,0x44,0x43,0x34,0x32,0x24,0x22,0x22,0x02,0x00,0x98,0xa9,0xba,0xdb,
+0xcc,0xcc,0xdb,0xcb,0xbb,0xbc,0xbb,0xbb,0xac,0xaa,0x99,0x89,0x10,0x32,0x54,0x43,
+0x34,0x44,0x43,0x33,0x34,0x24,0x32,0x22,0x23,0x21,0x01,0x80,0xaa,0xdb,0xcc,0xcc,
+0xdb,0xbc,0xcb,0xbb,0xba,0xab,0xab,0x99,0x09,0x20,0x42,0x53,0x53,0x53,0x33,0x35,
+0x34,0x43,0x34,0x33,0x33,0x22,0x22,0x12,0x01,0x99,0xdb,0xbc,0xbb,0xdb,0xcb,0xcc,
+0xbc,0xbc,0xba,0xba,0xba,0xba,0x9a,0x18,0x54,0x44,0x24,0x24,0x33,0x53,0x33,0x34,
+0x33,0x33,0x32,0x24,0x24,0x22,0x01,0xa8,0xbb,0xbd,0xdc,0xcb,0xcc,0xbb,0xac,0xbb,
+0xaa,0xab,0xbb,0xaa,0x9a,0x10,0x43,0x35,0x44,0x53,0x53,0x43,0x33,0x34,0x32,0x22,
+0x12,0x12,0x01,0x81,0xb9,0xeb,0xbc,0xbc,0xcc,0xcb,0xdb,0xbb,0xbc,0xba,0xaa,0xbb,
+0xcb,0xba,0x99,0x10,0x33,0x45,0x33,0x35,0x45,0x43,0x33,0x33,0x22,0x12,0x22,0x22,
+0x02,0x80,0xbb,0xcd,0xdb,0xdb,0xcc,0xbc,0xad,0xbb,0xba,0xab,0xbb,0xbb,0xbb,0x99,
+0x89,0x99,0xa9,0x08,0x74,0x45,0x34,0x34,0x34,0x33,0x43,0x22,0x12,0x00,0x88,0x99,
+0xb9,0xcb,0xdc,0xcb,0xbc,0xcc,0xcb,0xbb,0xcb,0xba,0xba,0xaa,0xaa,0x89,0x10,0x32,
+0x45,0x43,0x44,0x34,0x44,0x33,0x24,0x23,0x23,0x32,0x23,0x22,0x11,0x08,0x88,0x98,
+0xeb,0xcd,0xcc,0xbc,0xcb,0xbb,0xac,0xbb,0x9a,0x88,0x11,0x23,0x33,0x43,0x44,0x44,
+0x33,0x35,0x43,0x34,0x35,0x33,0x24,0x22,0x12,0x11,0x00,0x88,0xa9,0xcb,0xbc,0xbc,
+0xbd,0xbc,0xbd,0xcb,0xbb,0xba,0xbb,0xab,0xab,0x09,0x31,0x45,0x34,0x44,0x33,0x35,
+0x34,0x34,0x32,0x33,0x32,0x22,0x02,0x81,0x98,0xba,0xcc,0xcc,0xcc,0xcb,0xcb,0xbc,
+0xbc,0xbc,0xbb,0xab,0xab,0x9a,0x99,0x09,0x20,0x53,0x34,0x34,0x24,0x32,0x44,0x34,
+0x25,0x23,0x13,0x22,0x32,0x12,0xc8,0xde,0xdb,0xab,0xab,0xbb,0xcc,0xbb,0xcb,0xba,
+0xba,0xab,0x09,0x42,0x44,0x23,0x22,0x21,0x44,0x34,0x34,0x34,0x44,0x34,0x34,0x33,
+0x23,0x21,0x01,0x81,0x88,0xaa,0xca,0xdb,0xdc,0xcc,0xbc,0xbb,0xbb,0xab,0xaa,0xbb,
+0xba,0xa9,0x88,0x88,0x88,0x20,0x64,0x44,0x44,0x43,0x43,0x32,0x33,0x32,0x22,0x11,
+0x00,0x99,0xbb,0xdb,0xdb,0xdb,0xbc,0xcc,0xcb,0xac,0xbb,0xbb,0xba,0xab,0xab,0x9b,
+0x89,0x21,0x35,0x35,0x35,0x43,0x44,0x33,0x35,0x33,0x33,0x33,0x43,0x22,0x11,0x81,
+0x98,0xaa,0xcc,0xcc,0xbd,0xbd,0xbc,0xac,0xab,0xab,0xab,0xab,0x99,0x00,0x21,0x42,
+0x44,0x34,0x44,0x43,0x34,0x43,0x34,0x33,0x34,0x22,0x12,0x12,0x01,0x00,0xa9,0xcc,
+0xbb,0xbc,0xdb,0xcb,0xbd,0xcb,0xac,0xaa,0xab,0xaa,0xaa,0x89,0x31,0x46,0x43,0x43,
+0x32,0x34,0x34,0x25,0x43,0x12,0x22,0x21,0x33,0x33,0x23,0x80,0xba,0xcc,0xbc,0xbd,
+0xcd,0xcb,0xbb,0xac,0xab,0xba,0xba,0xba,0xaa,0x88,0x20,0x53,0x34,0x35,0x45,0x43,
+0x34,0x33,0x33,0x24,0x22,0x22,0x12,0x11,0x98,0xca,0xbc,0xbd,0xcb,0xcc,0xcb,0xbc,
+0xcb,0xba,0xba,0xab,0xcb,0xba,0xaa,0x89,0x20,0x43,0x34,0x35,0x45,0x43,0x24,0x33,
+0x22,0x22,0x21,0x22,0x22,0x02,0x99,0xbc,0xbc,0xbd,0xbe,0xcd,0xdb,0xba,0xbb,0xab,
+0xbb,0xbb,0xac,0xaa,0x88,0x88,0x98,0x98,0x20,0x56,0x45,0x53,0x33,0x33,0x34,0x23,
+0x33,0x21,0x80,0x98,0xaa,0xca,0xdb,0xdb,0xdb,0xcb,0xbc,0xbc,0xcb,0xba,0xbb,0xba,
+0xaa,0x9a,0x08,0x20,0x43,0x44,0x34,0x45,0x43,0x34,0x43,0x32,0x23,0x33,0x32,0x23,
+0x11,0x01,0x88,0x88,0xb9,0xdd,0xcd,0xbc,0xbd,0xbb,0xbc,0xbb,0xbb,0x9a,0x88,0x21,
+0x33,0x53,0x33,0x45,0x53,0x43,0x33,0x44,0x53,0x42,0x32,0x22,0x22,0x21,0x01,0x81,
+0x88,0xbb,0xcc,0xcb,0xcb,0xbc,0xbd,0xbc,0xbc,0xba,0xab,0xab,0xba,0xa9,0x08,0x32,
+0x36,0x35,0x44,0x33,0x35,0x34,0x33,0x43,0x22,0x23,0x21,0x11,0x80,0x99,0xca,0xdb,
+0xdb,0xdb,0xbb,0xcd,0xbb,0xcc,0xba,0xba,0xab,0xba,0xa9,0x89,0x10,0x32,0x44,0x43,
+0x43,0x32,0x44,0x53,0x43,0x33,0x33,0x22,0x22,0x33,0x02,0xfa,0xcd,0xbc,0xbb,0xbb,
+0xbc,0xdb,0xbb,0xac,0xbb,0xaa,0x9a,0x10,0x53,0x33,0x32,0x22,0x63,0x53,0x24,0x24,
+0x43,0x34,0x44,0x33,0x33,0x23,0x11,0x01,0x80,0x99,0xaa,0xbb,0xcf,0xcd,0xdb,0xbb,
+0xbb,0xab,0xba,0xba,0xbb,0xab,0x99,0x88,0x00,0x00,0x32,0x47,0x35,0x45,0x42,0x32,
+0x23,0x33,0x23,0x23,0x01,0x90,0xa8,0xba,0xcc,0xcc,0xbc,0xbd,0xbd,0xcb,0xcb,0xab,
+0xbb,0xbb,0xab,0xaa,0x99,0x18,0x32,0x36,0x35,0x53,0x33,0x35,0x35,0x43,0x32,0x33,
+0x23,0x32,0x12,0x11,0x80,0xa9,0xca,0xcc,0xcd,0xdb,0xbc,0xcb,0xbb,0xcb,0xaa,0xaa,
+0x9a,0x89,0x00,0x21,0x34,0x35,0x34,0x44,0x53,0x33,0x44,0x33,0x24,0x23,0x23,0x12,
+0x12,0x01,0x80,0xba,0xcd,0xcb,0xbb,0xdb,0xdb,0xcb,0xcb,0xbb,0xaa,0xab,0xab,0xaa,
+0x09,0x53,0x35,0x25,0x24,0x33,0x44,0x43,0x33,0x24,0x22,0x32,0x32,0x24,0x22,0x01,
+0x88,0xba,0xbc,0xbe,0xdc,0xcb,0xcb,0xcb,0xba,0xaa,0xaa,0xba,0xaa,0x9a,0x08,0x32,
+0x53,0x34,0x45,0x44,0x43,0x43,0x23,0x33,0x32,0x22,0x23,0x12,0x01,0xa0,0xdb,0xcc,
+0xbc,0xbc,0xcc,0xcb,0xcb,0xbb,0xbb,0xac,0xba,0xab,0xab,0xaa,0x08,0x22,0x44,0x44,
+0x53,0x34,0x44,0x32,0x33,0x22,0x22,0x31,0x22,0x13,0x81,0xba,0xcc,0xcb,0xcc,0xbd,
+0xcd,0xcb,0xab,0xbb,0xbb,0xac,0xba,0xaa,0x99,0x89,0x98,0x98,0x09,0x52,0x56,0x34,
+0x44,0x32,0x43,0x22,0x23,0x23,0x01,0x80,0x98,0xa9,0xcb,0xcc,0xcc,0xcb,0xbc,0xcb,
+0xbc,0xcb,0xab,0xab,0xab,0xa9,0x99,0x00,0x31,0x35,0x35,0x44,0x53,0x43,0x43,0x33,
+0x33,0x24,0x23,0x22,0x22,0x11,0x80,0x80,0x99,0xca,0xce,0xcc,0xbc,0xdb,0xba,0xcb,
+0xaa,0xaa,0x99,0x88,0x01,0x22,0x33,0x45,0x43,0x34,0x44,0x43,0x43,0x43,0x33,0x24,
+0x32,0x12,0x12,0x10,0x80,0xa9,0xca,0xcc,0xbb,0xbd,0xbd,0xdb,0xbb,0xbc,0xba,0xaa,
+0xab,0xab,0x8a,0x10,0x44,0x53,0x33,0x35,0x44,0x43,0x43,0x32,0x23,0x23,0x23,0x12,
+0x11,0x80,0x99,0xcb,0xcc,0xcc,0xdb,0xcb,0xbc,0xbc,0xcb,0xba,0xab,0xab,0xab,0xa9,
+0x88,0x10,0x43,0x44,0x43,0x43,0x33,0x35,0x44,0x33,0x33,0x33,0x32,0x32,0x23,0x91,
+0xdd,0xcd,0xbb,0xbc,0xcb,0xbb,0xcc,0xab,0xbb,0xbb,0xbb,0x9a,0x28,0x42,0x33,0x24,
+0x42,0x53,0x44,0x43,0x43,0x43,0x34,0x34,0x33,0x33,0x13,0x12,0x01,0x80,0x9a,0xbb,
+0xcd,0xdc,0xcc,0xbc,0xcb,0xba,0xaa,0xaa,0xab,0xab,0xaa,0x98,0x80,0x10,0x21,0x63,
+0x54,0x53,0x53,0x42,0x22,0x33,0x22,0x23,0x12,0x11,0x88,0xa9,0xca,0xcb,0xcc,0xbc,
+0xcd,0xbb,0xad,0xbb,0xac,0xab,0xab,0xab,0x9a,0x89,0x11,0x43,0x44,0x33,0x35,0x35,
+0x44,0x43,0x32,0x33,0x33,0x33,0x32,0x12,0x01,0x88,0xba,0xcd,0xcc,0xbc,0xbd,0xcc,
+0xbb,0xcb,0xba,0xaa,0xaa,0x9a,0x8a,0x18,0x32,0x45,0x33,0x35,0x35,0x34,0x35,0x43,
+0x32,0x24,0x32,0x22,0x12,0x11,0x00,0x99,0xba,0xbd,0xbd,0xcb,0xcc,0xdb,0xbb,0xac,
+0xab,0xba,0xaa,0xab,0x9a,0x18,0x63,0x34,0x44,0x33,0x34,0x35,0x43,0x33,0x43,0x22,
+0x22,0x23,0x24,0x12,0x81,0xa9,0xcb,0xbc,0xcc,0xcc,0xdb,0xbb,0xac,0xab,0xab,0xbb,
+0xba,0x9b,0x8a,0x10,0x43,0x34,0x45,0x53,0x53,0x43,0x33,0x43,0x32,0x22,0x22,0x22,
+0x21,0x00,0xa9,0xdb,0xbc,0xcc,0xbc,0xcc,0xcb,0xbb,0xbc,0xbb,0xba,0xbb,0xac,0xab,
+0x89,0x10,0x42,0x43,0x44,0x34,0x35,0x25,0x33,0x32,0x22,0x23,0x32,0x23,0x11,0x90,
+0xbb,0xcc,0xcc,0xbc,0xbe,0xbd,0xbc,0xbb,0xbb,0xbb,0xac,0xbb,0xaa,0x8a,0x09,0x08,
+0x08,0x20,0x56,0x44,0x44,0x43,0x42,0x22,0x23,0x22,0x22,0x01,0x00,0x99,0xb9,0xbc,
+0xbd,0xbd,0xbd,0xcc,0xbb,0xad,0xbb,0xba,0xab,0xab,0x9a,0x99,0x10,0x43,0x44,0x43,
+0x44,0x53,0x33,0x44,0x32,0x32,0x23,0x23,0x23,0x12,0x01,0x80,0x99,0xb9,0xcd,0xcd,
+0xbc,0xbd,0xcb,0xbb,0xbb,0xac,0x9b,0x8a,0x08,0x21,0x32,0x34,0x44,0x34,0x44,0x43,
+0x43,0x34,0x43,0x33,0x24,0x21,0x10,0x00,0x08,0x80,0x00,0x08,0x08,0x11,0x22,0x23,
+0x12,0x80,0xb9,0xcb,0xab,0xa9,0xba,0xbb,0x9c,0x20,0x34,0x15,0x90,0xb9,0xbc,0xbb,
+0xdb,0xcb,0xdb,0xcc,0xcc,0xbb,0xaa,0x98,0x90,0xb9,0xbc,0xab,0x98,0xeb,0xed,0xdb,
+0xab,0xbb,0xaa,0xaa,0xab,0x9a,0x08,0x10,0x91,0xfe,0xcd,0xbd,0xbb,0x9a,0x88,0x00,
+0xa9,0x89,0x30,0x13,0xfc,0xef,0xcb,0xaa,0x99,0x88,0x88,0x89,0x80,0x88,0x99,0x20,
+0x66,0x35,0x34,0x12,0x00,0x88,0x10,0x10,0x98,0xab,0x28,0x67,0x43,0x23,0x12,0x00,
+0x81,0x80,0x98,0x88,0x00,0xa0,0xdf,0xcd,0xac,0xab,0x89,0x88,0x98,0x88,0x09,0x80,
+0xa0,0xda,0xcc,0xbb,0xac,0x9a,0x88,0x80,0x80,0x99,0x89,0x88,0xb9,0xdf,0xcc,0xab,
+0x9a,0x00,0x01,0x99,0x9a,0x89,0x10,0x90,0xeb,0xbc,0xaa,0x9a,0xa9,0xba,0xac,0x09,
+0x11,0x13,0xc8,0xce,0xcd,0xbb,0xbb,0xa9,0x00,0x10,0x08,0x18,0x51,0x44,0x35,0x34,
+0x34,0x23,0x12,0x80,0x99,0x88,0x80,0x81,0x31,0x57,0x45,0x24,0x13,0x81,0x98,0x08,
+0x01,0x90,0x9a,0x68,0x57,0x35,0x24,0x02,0x00,0x08,0x10,0x11,0x90,0xaa,0x19,0x57,
+0x35,0x35,0x22,0x02,0x80,0x88,0x00,0x10,0x88,0x89,0x52,0x47,0x44,0x22,0x00,0x98,
+0x89,0x00,0x11,0x88,0x8a,0x30,0x57,0x33,0x14,0x02,0x10,0x08,0x98,0x99,0x9a,0x9a,
+0x88,0x21,0x64,0x53,0x12,0x80,0xba,0xaa,0x00,0xa8,0xcd,0x9c,0x40,0x35,0x24,0x81,
+0xa9,0xbb,0xbb,0xbc,0xaa,0x09,0x91,0xfd,0xce,0xbb,0x9b,0x98,0x98,0xca,0xab,0x09,
+0x11,0xa0,0xdf,0xbc,0xab,0xab,0xa9,0xaa,0x89,0x80,0xa0,0xc9,0xeb,0xcc,0xcd,0xcc,
+0xbb,0x9a,0x89,0x90,0x98,0xa9,0x80,0x90,0xfc,0xcd,0xbc,0xaa,0x99,0x08,0x89,0xa9,
+0x99,0x10,0x91,0xfc,0xdd,0xbc,0xac,0x9a,0x88,0x00,0x08,0x88,0x88,0x00,0xb8,0xfc,
+0xcb,0xab,0x9a,0x80,0x00,0x88,0x08,0x32,0x24,0x80,0xcb,0xcc,0xba,0xba,0x9a,0x89,
+0x11,0x11,0x99,0x8a,0x74,0x37,0x35,0x22,0x12,0x01,0x12,0x22,0x02,0x90,0x88,0x72,
+0x56,0x44,0x34,0x23,0x12,0x88,0x80,0x21,0x11,0x88,0x1a,0x75,0x47,0x43,0x13,0x02,
+0x88,0x80,0x11,0x00,0x99,0x8a,0x72,0x45,0x34,0x23,0x11,0x00,0x00,0x00,0x88,0xa9,
+0x99,0x32,0x47,0x33,0x33,0x01,0x80,0x08,0x08,0x88,0xbb,0xac,0x29,0x64,0x43,0x02,
+0x80,0x89,0x11,0x11,0xc9,0xdc,0xaa,0x99,0xea,0xdc,0xbc,0xab,0x09,0x10,0x88,0xb9,
+0xaa,0xba,0xee,0xdd,0xcb,0xbb,0x9a,0x88,0x80,0xa8,0x99,0x09,0x20,0xb8,0xff,0xbe,
+0xcb,0x9a,0x09,0x00,0x88,0x89,0x08,0x31,0x81,0xef,0xcd,0xcb,0xab,0x99,0x88,0x00,
+0x00,0x80,0x89,0x19,0x74,0x45,0x43,0x23,0x01,0x00,0x18,0x11,0x11,0x99,0x9a,0x72,
+0x45,0x43,0x23,0x12,0x01,0x00,0x80,0x80,0x00,0x81,0xfa,0xdd,0xbc,0xbb,0x9a,0x88,
+0x80,0x99,0x99,0x00,0x11,0xa0,0xdd,0xbc,0xac,0x99,0x88,0x98,0xa8,0x89,0x10,0x32,
+0x13,0xfb,0xcd,0xbc,0x9a,0x88,0x11,0x01,0x98,0x99,0x18,0x32,0x90,0xdd,0xad,0x9a,
+0x18,0x32,0x12,0x00,0x00,0x22,0x83,0xfa,0xcd,0xbb,0x99,0x09,0x08,0x10,0x42,0x43,
+0x02,0x88,0x62,0x37,0x36,0x22,0x11,0x00,0x20,0x22,0x82,0x98,0x28,0x47,0x35,0x33,
+0x11,0x11,0x32,0x34,0x22,0xa8,0xcb,0x09,0x74,0x45,0x44,0x32,0x12,0x01,0x10,0x22,
+0x22,0x98,0xbc,0x2a,0x77,0x35,0x23,0x12,0x88,0x00,0x10,0x02,0xa8,0xaa,0x20,0x67,
+0x43,0x23,0x13,0x01,0x10,0x00,0x90,0xa9,0xaa,0x1a,0x74,0x54,0x33,0x23,0x81,0x99,
+0x89,0x10,0x12,0xa8,0xca,0x18,0x46,0x43,0x12,0x00,0x88,0x08,0x88,0xcb,0xbc,0x9a,
+0x08,0x43,0x35,0x44,0x23,0x81,0xbb,0xbd,0x89,0x11,0xa0,0xde,0xcc,0xab,0x9b,0xaa,
+0xaa,0xbb,0xac,0x89,0x31,0x42,0xb9,0xff,0xbc,0x9c,0x89,0x10,0x00,0xb9,0xab,0x09,
+0x12,0xe0,0xde,0xbc,0xba,0x99,0x89,0x99,0x9a,0x89,0x22,0x13,0xf9,0xdd,0xbc,0xbc,
+0xaa,0x9a,0x89,0x88,0x08,0x10,0x00,0xd8,0xee,0xbc,0xad,0x9b,0x8a,0x08,0x98,0x99,
+0x08,0x30,0x12,0xd8,0xdd,0xcb,0x9a,0x09,0x00,0x08,0x88,0x01,0x23,0x03,0xc9,0xcd,
+0xac,0xaa,0x89,0x01,0x32,0x33,0x23,0xa8,0x9a,0x73,0x57,0x43,0x22,0x11,0x11,0x11,
+0x13,0x01,0x88,0x20,0x57,0x45,0x34,0x24,0x12,0x00,0x09,0x18,0x21,0x02,0x90,0x41,
+0x77,0x34,0x34,0x12,0x00,0x09,0x00,0x12,0x80,0x99,0x18,0x57,0x44,0x23,0x22,0x01,
+0x00,0x01,0x81,0xa0,0xb9,0x8a,0x40,0x54,0x43,0x12,0x01,0x08,0x08,0x00,0x99,0xcb,
+0xab,0x28,0x55,0x33,0x13,0x11,0x88,0xb9,0xcd,0xbb,0x09,0x11,0xb0,0xef,0xbc,0xbb,
+0x9a,0xaa,0xcb,0xab,0x0a,0x00,0xb0,0xdf,0xbc,0xbd,0xcb,0xab,0x9b,0x99,0x00,0x00,
+0x00,0xa8,0xfd,0xce,0xcc,0xcb,0x99,0x88,0x80,0x98,0x89,0x10,0x14,0xc1,0xee,0xcc,
+0xab,0xaa,0x89,0x98,0x80,0x88,0x80,0x00,0x31,0x57,0x54,0x33,0x23,0x11,0x80,0x10,
+0x20,0x80,0xa8,0x09,0x64,0x45,0x43,0x22,0x11,0x00,0x00,0x88,0x00,0x10,0x80,0xfb,
+0xce,0xcb,0xaa,0x8a,0x09,0x88,0x89,0x09,0x10,0x11,0xb9,0xce,0xbc,0x9a,0x89,0x00,
+0x08,0x88,0x08,0x10,0x80,0xda,0xcd,0xbc,0xac,0x9a,0x08,0x10,0x00,0x88,0x8a,0x18,
+0x23,0xa1,0xdf,0xcc,0xaa,0x18,0x32,0x23,0x81,0x88,0x21,0x23,0xe9,0xce,0xac,0x8a,
+0x08,0x01,0x80,0x00,0x43,0x35,0x23,0x43,0x44,0x44,0x23,0x02,0x98,0x08,0x32,0x44,
+0x01,0x88,0x38,0x56,0x53,0x22,0x01,0x10,0x32,0x33,0x81,0xcc,0x9a,0x73,0x37,0x34,
+0x22,0x01,0x10,0x21,0x12,0x90,0xcb,0x09,0x74,0x45,0x33,0x32,0x12,0x11,0x10,0x00,
+0x80,0x98,0x09,0x52,0x56,0x34,0x33,0x12,0x08,0x08,0x30,0x32,0xa0,0xbd,0x0a,0x74,
+0x44,0x23,0x02,0x80,0x80,0x00,0x98,0xaa,0xab,0x19,0x63,0x34,0x33,0x22,0x90,0xba,
+0xae,0x9b,0x8a,0x89,0x88,0x32,0x36,0x25,0x13,0x02,0x01,0xa0,0xfb,0xdb,0xaa,0x88,
+0xb8,0xfc,0xcc,0xab,0xab,0x99,0xaa,0xba,0x99,0x08,0xc9,0xec,0xcb,0xab,0x9a,0xba,
+0xcc,0xac,0x9b,0x08,0x32,0x23,0xfb,0xdf,0xdb,0xaa,0x8a,0x08,0x00,0xa8,0xaa,0x89,
+0x11,0xb8,0xff,0xbc,0xbb,0x9b,0x08,0x08,0x90,0x08,0x10,0x12,0xea,0xdf,0xbc,0xbc,
+0x9a,0x09,0x08,0x90,0x99,0x88,0x21,0x13,0xd9,0xce,0xac,0x9a,0x08,0x00,0x88,0x08,
+0x30,0x33,0x02,0xeb,0xcb,0x9b,0x8a,0x09,0x19,0x42,0x45,0x12,0x98,0xaa,0x62,0x46,
+0x25,0x12,0x80,0x88,0x20,0x31,0x02,0x98,0x18,0x57,0x54,0x33,0x23,0x01,0x00,0x11,
+0x32,0x12,0xb8,0xab,0x71,0x77,0x43,0x32,0x11,0x81,0x00,0x21,0x01,0xa8,0xab,0x38,
+0x77,0x34,0x23,0x12,0x80,0x08,0x00,0x08,0x88,0x89,0x10,0x43,0x54,0x42,0x22,0x12,
+0x80,0xa9,0xab,0x9b,0x89,0x00,0x43,0x46,0x43,0x12,0x98,0xcb,0xaa,0x09,0x11,0x22,
+0xb9,0xff,0xbc,0xbc,0x9a,0x09,0x80,0x98,0xbb,0xab,0x08,0x80,0xde,0xce,0xcb,0xab,
+0x9a,0x89,0x99,0xba,0xaa,0x00,0x82,0xfc,0xef,0xcb,0xba,0x89,0x08,0x88,0x99,0x88,
+0x31,0x92,0xfd,0xbf,0xac,0xab,0x99,0x98,0x88,0x88,0x08,0x80,0x88,0x41,0x67,0x53,
+0x33,0x12,0x00,0x10,0x20,0x00,0xa8,0x9a,0x51,0x47,0x43,0x32,0x11,0x10,0x10,0x80,
+0x88,0x00,0x11,0xb8,0xef,0xcc,0xcb,0xa9,0x88,0x80,0x98,0x89,0x88,0x01,0x90,0xba,
+0xce,0xba,0xab,0x99,0x99,0x89,0x89,0x10,0x32,0x24,0x90,0xcc,0xbc,0x9a,0x08,0x80,
+0xa8,0x8a,0x52,0x35,0x13,0xb9,0xcd,0x9a,0x10,0x11,0x80,0x89,0x89,0x10,0x00,0x91,
+0xa4,0xf3,0xfa,0xcb,0xab,0x29,0x53,0x34,0x12,0x80,0x89,0x41,0x47,0x45,0x33,0x33,
+0x10,0x88,0x08,0x10,0x91,0xb9,0x8a,0x72,0x36,0x34,0x01,0x88,0x08,0x43,0x24,0x81,
+0xca,0x8b,0x72,0x45,0x33,0x12,0x80,0x10,0x43,0x22,0xa8,0xcb,0x1a,0x75,0x53,0x22,
+0x12,0x00,0x10,0x11,0x11,0x00,0x9a,0x89,0x51,0x55,0x34,0x33,0x11,0x08,0x00,0x42,
+0x12,0xa0,0xbc,0x1b,0x66,0x34,0x33,0x01,0x88,0x80,0x01,0x90,0xcb,0xac,0x1a,0x53,
+0x26,0x22,0x80,0xbb,0xac,0x09,0x21,0x82,0xb8,0xab,0x40,0x46,0x23,0x02,0x00,0x11,
+0x81,0xdc,0xcc,0x9a,0x18,0xa8,0xde,0xbc,0x9b,0x09,0x00,0xba,0xbc,0x9b,0x10,0x98,
+0xcf,0xbc,0xab,0xa9,0xc9,0xba,0x99,0x41,0x31,0xb9,0xce,0xac,0xac,0xcc,0xbc,0xbb,
+0x8a,0x10,0x01,0x90,0xa9,0xb9,0xde,0xcd,0xbc,0xab,0x08,0x11,0x90,0xcb,0xaa,0x10,
+0x11,0xfb,0xce,0xbc,0xaa,0x99,0x98,0xa9,0x99,0x18,0x21,0x81,0xea,0xcc,0xbb,0xab,
+0x99,0x88,0x00,0x01,0x88,0x89,0x88,0x32,0x02,0xfb,0xbf,0xac,0x89,0x10,0x03,0xa0,
+0xbb,0x2a,0x77,0x34,0x25,0x12,0x00,0x89,0x10,0x43,0x23,0x81,0x98,0x62,0x46,0x34,
+0x23,0x21,0x21,0x32,0x43,0x02,0x80,0x08,0x53,0x56,0x44,0x43,0x33,0x12,0x01,0x80,
+0x08,0x00,0x90,0x88,0x73,0x47,0x53,0x22,0x02,0x80,0x08,0x00,0x00,0x98,0x89,0x28,
+0x44,0x44,0x22,0x12,0x01,0x80,0x99,0xcb,0xcb,0xa9,0x21,0x35,0x34,0x01,0x98,0x99,
+0x28,0x22,0x91,0xdc,0xbd,0xac,0xbc,0xbc,0xbb,0x9c,0x0a,0x09,0x08,0x08,0x22,0x82,
+0xfc,0xce,0xbc,0xbc,0xbb,0xab,0x99,0x0a,0x09,0x10,0x11,0xe9,0xdf,0xbd,0xad,0xaa,
+0x88,0x81,0x98,0x99,0x19,0x32,0x92,0xff,0xbe,0xac,0x9b,0x8a,0x89,0x08,0x08,0x00,
+0x88,0x80,0x63,0x56,0x43,0x33,0x12,0x01,0x00,0x01,0x80,0xa9,0x09,0x73,0x36,0x34,
+0x33,0x21,0x11,0x00,0x88,0x89,0x00,0x00,0xfb,0xce,0xbd,0xbb,0xaa,0x98,0x88,0x99,
+0x88,0x10,0x21,0xa0,0xdd,0xbd,0xbb,0x9a,0x88,0x08,0x80,0x88,0x00,0x11,0xa8,0xec,
+0xcc,0xab,0x9a,0x08,0x00,0x88,0x99,0x10,0x12,0xa0,0xde,0xac,0x8b,0x20,0x12,0xa0,
+0xbb,0x1b,0x56,0x53,0x11,0xa9,0xcc,0xbb,0xbb,0x9b,0x28,0x44,0x24,0x03,0x91,0x11,
+0x63,0x63,0x32,0x32,0x33,0x24,0x24,0x43,0x44,0x53,0x33,0x22,0x11,0x22,0x53,0x43,
+0x12,0x81,0x80,0x88,0x80,0x18,0x64,0x55,0x43,0x22,0x00,0x88,0x10,0x43,0x14,0x91,
+0xbb,0x8a,0x74,0x45,0x33,0x12,0x90,0x88,0x10,0x33,0x23,0x88,0x09,0x75,0x54,0x23,
+0x13,0x80,0x89,0x00,0x10,0x80,0x99,0x89,0x42,0x46,0x32,0x23,0x12,0x01,0x80,0x99,
+0x98,0x11,0x31,0x88,0xbb,0x8a,0x42,0x24,0xb8,0xae,0x2a,0x53,0x04,0xd9,0xac,0x38,
+0x67,0x32,0x81,0xda,0xac,0x89,0x21,0x22,0xb9,0xce,0xaa,0x09,0x00,0xb9,0xcd,0x9c,
+0x09,0x21,0x11,0xb9,0xcd,0xac,0xac,0x9b,0x8b,0x19,0x11,0x01,0xa9,0x99,0x00,0xfa,
+0xef,0xbc,0xbb,0x89,0x10,0x90,0xeb,0xbb,0x08,0x43,0x03,0xfa,0xcd,0xab,0x89,0x00,
+0x80,0xb9,0xac,0x09,0x32,0x13,0xfa,0xbe,0xbd,0xaa,0x9a,0x08,0x88,0x80,0x00,0x01,
+0x91,0xea,0xdc,0xbb,0xbb,0x99,0x08,0x01,0x00,0x99,0x89,0x20,0x32,0x92,0xee,0xdb,
+0xaa,0x89,0x80,0x90,0x01,0x54,0x35,0x22,0x80,0x88,0x72,0x44,0x33,0x02,0x88,0x08,
+0x10,0x08,0x18,0x75,0x54,0x43,0x11,0x80,0x09,0x31,0x43,0x01,0x99,0x38,0x77,0x34,
+0x32,0x01,0x80,0x18,0x31,0x11,0xb8,0xbc,0x29,0x67,0x34,0x23,0x01,0x88,0x08,0x31,
+0x33,0x81,0xaa,0x9b,0x51,0x34,0x23,0x81,0x18,0x53,0x25,0x03,0xca,0xbd,0x9a,0x30,
+0x54,0x13,0x82,0x98,0x8a,0x10,0x33,0x91,0xce,0xbc,0xaa,0x88,0xa8,0xeb,0xbc,0xaa,
+0x08,0x20,0x01,0x00,0x99,0xda,0xcd,0xbe,0xcb,0xab,0xac,0xba,0xaa,0x09,0x32,0x05,
+0xfa,0xde,0xcb,0xab,0x89,0x00,0x80,0xaa,0xab,0x38,0x44,0xa1,0xef,0xcc,0xba,0xaa,
+0x89,0x98,0x80,0x80,0x00,0x88,0x10,0x56,0x55,0x33,0x23,0x11,0x08,0x10,0x11,0x91,
+0xba,0x1a,0x66,0x35,0x24,0x13,0x01,0x08,0x80,0x80,0x11,0x12,0x82,0xfb,0xcf,0xac,
+0xab,0x89,0x88,0x08,0x08,0x08,0x08,0x88,0xcb,0xdb,0xbb,0xbb,0xaa,0x9a,0x08,0x21,
+0x01,0xba,0xdd,0xbb,0xbc,0xbc,0xbc,0xab,0x9a,0x88,0x80,0x01,0x01,0x01,0xd9,0xce,
+0xbc,0x9b,0x19,0x31,0x10,0xa9,0xab,0x21,0x44,0xa0,0xff,0xcb,0xab,0x9a,0x89,0x88,
+0x99,0x10,0x44,0x34,0x24,0x01,0x00,0x32,0x37,0x36,0x23,0x01,0x98,0xaa,0x10,0x44,
+0x53,0x21,0x00,0x20,0x52,0x52,0x12,0x01,0xa9,0xa9,0x20,0x47,0x55,0x32,0x13,0x01,
+0x00,0x20,0x33,0x15,0x81,0x88,0x51,0x46,0x34,0x33,0x12,0x01,0x01,0x81,0x98,0x89,
+0x40,0x55,0x34,0x23,0x80,0xbb,0xbc,0x8a,0x10,0x12,0x90,0xba,0x99,0x47,0x45,0x22,
+0x80,0xa9,0x89,0x11,0x13,0xb0,0xbd,0x39,0x66,0x33,0x22,0x98,0x99,0x00,0x02,0xb1,
+0xb8,0x08,0x24,0x93,0xdb,0x9b,0x52,0x24,0xa8,0x9f,0x1b,0x73,0x34,0x23,0x11,0x00,
+0x01,0xb8,0xed,0xbb,0xbb,0x89,0x08,0x10,0x23,0x12,0xbd,0xdf,0xbb,0xaa,0x88,0x81,
+0x11,0x21,0x11,0xce,0xbe,0xbb,0x89,0x80,0xda,0xcd,0xaa,0x08,0x12,0x01,0x9a,0x09,
+0x81,0xfb,0xcf,0xbb,0x8b,0x19,0x08,0x8a,0x1a,0x53,0x02,0xfb,0xbf,0xab,0x99,0x01,
+0x01,0x08,0x80,0x90,0xca,0xbd,0xac,0x88,0x80,0xda,0xcc,0x9a,0x18,0x13,0x81,0xab,
+0x0a,0x22,0x04,0xc0,0xaa,0x20,0x43,0xa0,0xe9,0x88,0x33,0x03,0xcd,0x9b,0x64,0x36,
+0x33,0x00,0x9a,0x09,0x20,0x00,0x99,0x70,0x65,0x43,0x22,0x01,0x88,0x00,0x11,0xb8,
+0xdd,0xcb,0x88,0x44,0x45,0x32,0x11,0x00,0x89,0x88,0x00,0x80,0x00,0x42,0x55,0x43,
+0x22,0x11,0x98,0x88,0x80,0x82,0x92,0xb9,0x9a,0x42,0x57,0x24,0x13,0x81,0x9a,0x89,
+0x01,0x13,0x90,0xab,0x89,0x05,0x93,0xc8,0xaa,0x32,0x24,0xb9,0xbd,0x30,0x47,0xa9,
+0xff,0xab,0x8a,0x20,0x12,0x98,0x9c,0x19,0x53,0x82,0xeb,0xcc,0x99,0x08,0x90,0xca,
+0xbd,0xa9,0x18,0x11,0x01,0xc9,0xdc,0xcc,0xba,0xaa,0x08,0x80,0x90,0x08,0x51,0x02,
+0xfd,0xdd,0xcb,0xaa,0x89,0x08,0x08,0x08,0x08,0x80,0x88,0x20,0x67,0x44,0x23,0x03,
+0x00,0x08,0x20,0x32,0x00,0x80,0x51,0x55,0x43,0x33,0x22,0x21,0x11,0x81,0x80,0x00,
+0x98,0xec,0xcd,0xbc,0xbb,0xba,0xa9,0xa9,0x98,0x10,0x12,0xa1,0xec,0xcb,0xbb,0x9c,
+0x9a,0x09,0x20,0x81,0xa0,0xa9,0x10,0x44,0x90,0xdf,0xcb,0x9a,0x18,0x12,0xa1,0xb8,
+0x89,0x52,0x12,0xd9,0xcd,0xac,0x99,0x00,0x01,0x80,0x90,0x09,0x29,0x29,0x28,0x0a,
+0x0b,0x4b,0x49,0x00,0xc9,0xc0,0x21,0x53,0x00,0xcd,0xba,0x54,0x47,0x43,0x12,0x98,
+0x99,0x19,0x20,0x02,0xc9,0xab,0x61,0x65,0x32,0x02,0xa8,0x9a,0x20,0x32,0xa0,0xeb,
+0x8a,0x54,0x25,0x23,0x00,0x88,0x10,0x90,0xfc,0xcb,0x89,0x42,0x35,0x24,0x00,0x80,
+0x80,0x80,0x00,0x88,0x90,0x80,0x08,0x60,0x55,0x35,0x33,0x12,0x90,0x80,0x01,0x90,
+0xb9,0x19,0x66,0x34,0x13,0x81,0x99,0x09,0x10,0x11,0x89,0x8a,0x29,0x11,0x91,0xd8,
+0xa1,0x23,0x29,0xbb,0xa0,0x13,0x12,0x9a,0x1b,0x59,0x29,0x8b,0x0a,0x43,0xc0,0xff,
+0xdf,0xbb,0xac,0xaa,0xaa,0xaa,0xbb,0xaa,0x08,0x20,0x10,0x88,0x98,0x8a,0x2b,0x70,
+0x55,0x34,0x23,0x80,0xa9,0x8a,0x38,0x22,0xa1,0xda,0xa8,0x23,0x05,0xb1,0xbb,0x3b,
+0x72,0x02,0xc9,0xab,0x48,0x34,0xa3,0xdc,0x8c,0x50,0x45,0x32,0x01,0x00,0x31,0x36,
+0x14,0x02,0x90,0x90,0x98,0xdc,0xbc,0xac,0x08,0x21,0x11,0x99,0xaa,0x00,0x23,0x92,
+0xd9,0xa8,0x03,0x14,0xa0,0xba,0x18,0x52,0x11,0x0b,0x0f,0x29,0x30,0x09,0xb9,0x9a,
+0x31,0x23,0xa9,0xbb,0xb3,0x05,0x00,0x0a,0x1b,0x39,0xb3,0xc4,0xb2,0xa2,0x13,0x02,
+0x99,0x0a,0x39,0x4a,0x1a,0x9a,0x19,0x39,0x3a,0x2a,0x1b,0x1a,0x11,0x01,0xb1,0xd3,
+0xa3,0x02,0x09,0xb1,0xb3,0x01,0x20,0x19,0x99,0x99,0xb2,0x93,0x92,0x99,0x1a,0x10,
+0xa3,0xb3,0xa1,0x19,0x11,0x93,0xa0,0x1b,0x5a,0x39,0x2a,0x0d,0x2b,0x20,0x23,0xba,
+0xcb,0x01,0x15,0xa3,0xf8,0x9a,0x32,0x27,0xb0,0xef,0xac,0x9b,0x08,0x11,0x81,0x98,
+0x89,0x18,0x21,0x88,0x9a,0x1a,0x40,0x28,0x9a,0x9b,0x3a,0x31,0xb2,0xd1,0xb2,0x03,
+0x11,0xa0,0xb0,0x30,0x5a,0x89,0xb1,0x20,0x5b,0x19,0x1a,0x3b,0x3d,0x4a,0x2b,0x8a,
+0xa1,0x93,0xa3,0x91,0x99,0x10,0x11,0x91,0x1a,0x09,0xa3,0xb3,0xb3,0x19,0x4a,0x3a,
+0x0b,0x9a,0x30,0x5a,0x3b,0x0b,0x1b,0x59,0x29,0x0b,0xd9,0xa3,0x04,0x80,0x9b,0x1b,
+0x32,0x23,0xb9,0x9e,0x38,0x72,0x08,0xbc,0x9b,0x74,0x46,0x32,0x01,0x98,0xa8,0x00,
+0x11,0x81,0x99,0x8a,0x11,0x03,0xa0,0xb9,0x3b,0x60,0x19,0x99,0x0a,0x39,0x12,0xb3,
+0x0b,0x3c,0x39,0x03,0x09,0x2f,0x2a,0x28,0x19,0x9b,0x2a,0x20,0x21,0x3b,0x1f,0x09,
+0x11,0x08,0x0a,0x3b,0x5a,0x3a,0xa9,0xb2,0x39,0x39,0xb1,0xc2,0xc2,0x93,0x03,0x99,
+0x1b,0x3b,0x39,0x20,0xab,0xb1,0x03,0x32,0x1b,0x1c,0x09,0x13,0x93,0xe0,0xa2,0x11,
+0x11,0xb9,0xd0,0x81,0x12,0x11,0xb9,0xba,0x12,0x04,0xe2,0xc1,0x81,0x31,0x39,0x0c,
+0x0c,0x38,0x41,0x88,0x9d,0x2b,0x31,0x87,0xb0,0xaa,0x20,0x44,0x91,0xcc,0x8b,0x71,
+0x33,0xd0,0xfd,0xba,0xaa,0x08,0x81,0x82,0x00,0x09,0x8a,0x98,0x13,0x16,0xb1,0xef,
+0xdb,0x9a,0x09,0x11,0x10,0x89,0x8a,0x00,0x31,0x09,0x9b,0x09,0x13,0x12,0x9c,0x2d,
+0x59,0x81,0xf1,0xa0,0x21,0x22,0xb0,0xdd,0x88,0x47,0x35,0x23,0x81,0xa8,0x99,0x11,
+0x02,0x08,0x8b,0x2a,0x30,0x10,0xb9,0xd9,0x92,0x13,0x3a,0xbb,0xb0,0x13,0x12,0xa0,
+0xb1,0x11,0x39,0x19,0x3a,0x0b,0xb1,0x93,0x93,0x19,0x1b,0xb0,0xb5,0x03,0x39,0x1d,
+0x1a,0x11,0x12,0xb9,0xb9,0x10,0x33,0x31,0x1f,0x2d,0x29,0x11,0xa8,0xbb,0x29,0x73,
+0x32,0xad,0xad,0x31,0x67,0x33,0x22,0x80,0x88,0x09,0x89,0x89,0x42,0x57,0x43,0x12,
+0x88,0x9a,0x19,0x20,0x01,0xa8,0x9a,0x18,0x43,0x18,0x9c,0x0b,0x21,0x14,0x89,0x0e,
+0x09,0x13,0x93,0xba,0xbb,0x13,0x15,0x09,0x9c,0x29,0x51,0x28,0x0c,0x9a,0x92,0x97,
+0xc3,0xb1,0x91,0x03,0xa3,0xd1,0xb0,0x13,0x32,0xb0,0xbb,0x3b,0x52,0x10,0xab,0x0d,
+0x30,0x24,0xc0,0xad,0x19,0x45,0x03,0xfc,0xbe,0xbb,0x0a,0x28,0x11,0xa0,0xa8,0x18,
+0x20,0x11,0x9a,0x2d,0x3a,0x01,0xa2,0x9b,0x1c,0x02,0xa5,0xb1,0xa8,0x02,0x23,0x01,
+0x0c,0x3b,0x31,0x93,0x99,0x1c,0x4a,0x10,0xa1,0xb0,0x3b,0x5a,0x18,0x89,0x9b,0x39,
+0x50,0x19,0xab,0xa1,0x33,0x60,0x0b,0xb9,0xb3,0x07,0x81,0x9a,0x1b,0x60,0x21,0xa9,
+0x9e,0x29,0x54,0x93,0xfb,0xcf,0xaa,0x09,0x10,0x10,0x88,0x99,0x08,0x11,0x10,0x8a,
+0x8a,0x38,0x30,0xb9,0xaa,0x3b,0x59,0x00,0x0a,0x1c,0x29,0x13,0x01,0xab,0x09,0x03,
+0xb3,0xd3,0x91,0x59,0x3a,0x19,0x9b,0x19,0x41,0x5b,0x1c,0x99,0x93,0x03,0x1a,0x2c,
+0x2c,0x01,0x93,0xba,0xa9,0x22,0x31,0xb1,0xb9,0x3b,0x50,0x10,0x1c,0x0c,0x20,0x13,
+0xb1,0xbd,0x09,0x35,0x13,0xfb,0xac,0x68,0x55,0x43,0x12,0x90,0xa8,0x08,0x10,0x01,
+0xa0,0x89,0x39,0x49,0x19,0xa9,0xa8,0x93,0x13,0x91,0xb9,0x09,0x11,0x93,0xa1,0x99,
+0x19,0x11,0x92,0x19,0x4d,0x3c,0x1a,0x90,0xa1,0x90,0x20,0x19,0x10,0x99,0x99,0x11,
+0x30,0x1b,0xa9,0x91,0x12,0x01,0x90,0xa9,0x91,0x03,0x92,0x1b,0x3b,0x4b,0x29,0x99,
+0x9b,0x3b,0x59,0x19,0x0a,0x9b,0x10,0x94,0xc3,0x88,0x3d,0x5a,0x08,0xb0,0xa0,0x5a,
+0x48,0x19,0x1c,0x2d,0x39,0x10,0xb0,0xaa,0x4b,0x41,0x00,0xbb,0x1f,0x39,0x31,0x99,
+0xbc,0x29,0x73,0x01,0xc9,0xa9,0x30,0x25,0xb1,0xeb,0x09,0x53,0x31,0xab,0x9f,0x39,
+0x63,0x01,0xcc,0xbe,0xba,0x89,0x08,0x00,0x01,0x01,0x89,0x9c,0x19,0x63,0x03,0xfa,
+0xbe,0xbb,0x8a,0x10,0x10,0x98,0x90,0x92,0xb3,0xb0,0x80,0x15,0xa3,0xca,0x1c,0x51,
+0x84,0xe8,0x8b,0x70,0x46,0x22,0x90,0x9a,0x09,0x32,0x83,0xea,0x9a,0x41,0x33,0xc8,
+0xad,0x19,0x45,0x82,0xeb,0x9b,0x52,0x15,0xfb,0xff,0xcb,0xba,0x99,0x89,0x98,0xa9,
+0xbb,0xbb,0xdb,0xcc,0xdb,0xac,0xbb,0xab,0xab,0xcb,0xaa,0xab,0xaa,0x89,0x10,0x53,
+0x34,0x45,0x33,0x44,0x33,0x35,0x44,0x42,0x32,0x32,0x22,0x32,0x42,0x22,0x22,0x01,
+0x88,0x98,0xaa,0xcc,0xbd,0xbd,0xcb,0xbc,0xdb,0xbb,0xcb,0xab,0xbb,0xaa,0xab,0xab,
+0x9b,0x09,0x31,0x46,0x53,0x42,0x42,0x33,0x35,0x35,0x43,0x43,0x32,0x32,0x33,0x32,
+0x33,0x43,0x12,0x01,0xa8,0xbc,0xcc,0xcb,0xbc,0xbd,0xcc,0xcb,0xbb,0xcb,0xbb,0xab,
+0xbb,0xbb,0xbb,0xaa,0x8a,0x20,0x53,0x45,0x43,0x34,0x53,0x43,0x53,0x33,0x34,0x33,
+0x43,0x32,0x32,0x24,0x22,0x12,0x01,0x90,0xa9,0xbd,0xcd,0xcb,0xcb,0xcb,0xbc,0xbc,
+0xac,0xbb,0xbb,0xbb,0xbb,0xbb,0x9c,0x9a,0x18,0x31,0x45,0x53,0x43,0x43,0x53,0x43,
+0x43,0x33,0x43,0x33,0x33,0x24,0x33,0x32,0x12,0x11,0x90,0xb9,0xcc,0xbc,0xbd,0xcc,
+0xcb,0xbc,0xbc,0xbc,0xbb,0xab,0xbb,0xcb,0xba,0xab,0x9a,0x09,0x21,0x44,0x44,0x43,
+0x43,0x43,0x34,0x34,0x44,0x32,0x33,0x33,0x33,0x24,0x23,0x13,0x02,0x81,0x99,0xcb,
+0xcc,0xbc,0xbd,0xdb,0xdb,0xbb,0xcc,0xba,0xab,0xbb,0xab,0xac,0xba,0x9a,0x8a,0x20,
+0x42,0x34,0x35,0x53,0x43,0x34,0x34,0x44,0x32,0x43,0x32,0x22,0x23,0x23,0x22,0x12,
+0x01,0x98,0xba,0xdc,0xbc,0xcc,0xbc,0xcc,0xcb,0xcb,0xbb,0xbb,0xac,0xab,0xbb,0xba,
+0xab,0x9a,0x09,0x32,0x45,0x44,0x43,0x33,0x35,0x44,0x43,0x33,0x24,0x33,0x33,0x42,
+0x22,0x22,0x21,0x11,0x08,0xaa,0xbd,0xcc,0xcb,0xcb,0xcc,0xcb,0xbc,0xcb,0xab,0xac,
+0xaa,0xaa,0xba,0xaa,0x9a,0x99,0x11,0x53,0x53,0x43,0x53,0x43,0x34,0x53,0x42,0x32,
+0x33,0x33,0x33,0x24,0x23,0x22,0x11,0x80,0xa9,0xdb,0xdb,0xcb,0xbc,0xcc,0xdb,0xbb,
+0xad,0xbb,0xcb,0xaa,0xba,0xba,0xab,0xba,0x99,0x18,0x32,0x46,0x43,0x34,0x43,0x53,
+0x43,0x53,0x42,0x22,0x32,0x22,0x23,0x23,0x32,0x12,0x11,0x98,0xca,0xcc,0xbc,0xcc,
+0xcb,0xcb,0xbc,0xbc,0xbc,0xbb,0xcb,0xaa,0xab,0xba,0xaa,0x9a,0x08,0x30,0x53,0x34,
+0x35,0x34,0x35,0x44,0x33,0x25,0x33,0x33,0x33,0x33,0x24,0x32,0x21,0x01,0x90,0xb9,
+0xcc,0xdb,0xbc,0xcc,0xcb,0xbc,0xbc,0xbc,0xca,0xaa,0xbb,0xba,0xbb,0xba,0xaa,0x99,
+0x10,0x63,0x53,0x43,0x43,0x33,0x45,0x43,0x43,0x43,0x22,0x32,0x22,0x32,0x32,0x22,
+0x22,0x00,0xa9,0xcc,0xdb,0xcb,0xbc,0xdb,0xcb,0xbc,0xbc,0xbc,0xbb,0xbb,0xcb,0xaa,
+0xab,0xaa,0x8a,0x08,0x22,0x44,0x44,0x34,0x34,0x34,0x34,0x35,0x43,0x23,0x33,0x33,
+0x33,0x43,0x22,0x12,0x00,0xa8,0xba,0xdc,0xbc,0xbc,0xcc,0xcb,0xbc,0xbc,0xbc,0xbb,
+0xbb,0xbb,0xbc,0xba,0xab,0x9a,0x89,0x20,0x44,0x44,0x43,0x53,0x33,0x35,0x34,0x34,
+0x33,0x24,0x32,0x22,0x33,0x32,0x23,0x02,0x90,0xba,0xcd,0xdb,0xbb,0xbd,0xcc,0xbc,
+0xdb,0xbb,0xac,0xbb,0xbb,0xbb,0xbb,0xac,0x9a,0x89,0x18,0x32,0x45,0x44,0x43,0x33,
+0x44,0x43,0x43,0x24,0x33,0x32,0x32,0x33,0x33,0x23,0x12,0x00,0x99,0xdb,0xcc,0xbc,
+0xcc,0xcb,0xdb,0xcb,0xac,0xbb,0xcb,0xaa,0xbb,0xba,0xac,0xa9,0x99,0x00,0x21,0x53,
+0x34,0x34,0x35,0x53,0x43,0x34,0x43,0x32,0x33,0x33,0x33,0x43,0x22,0x11,0x01,0x90,
+0xb9,0xdc,0xdb,0xcb,0xbc,0xdb,0xcb,0xcb,0xac,0xbb,0xbb,0xbb,0xbb,0xbc,0xaa,0xaa,
+0x88,0x20,0x52,0x34,0x35,0x34,0x34,0x44,0x43,0x24,0x33,0x43,0x22,0x23,0x32,0x22,
+0x22,0x11,0x80,0xb9,0xcc,0xcc,0xcb,0xdb,0xcb,0xdb,0xbb,0xcc,0xba,0xbb,0xba,0xbb,
+0xbb,0xcb,0xaa,0x99,0x18,0x32,0x45,0x34,0x34,0x44,0x43,0x34,0x34,0x33,0x34,0x32,
+0x23,0x43,0x22,0x22,0x12,0x81,0x98,0xda,0xdb,0xcb,0xbc,0xdb,0xcb,0xbc,0xbc,0xbb,
+0xac,0xbb,0xbb,0xbb,0xbb,0xab,0xaa,0x88,0x32,0x55,0x53,0x33,0x44,0x43,0x34,0x34,
+0x34,0x33,0x43,0x23,0x23,0x23,0x22,0x23,0x11,0x90,0xca,0xcc,0xdb,0xcb,0xdb,0xcb,
+0xcb,0xac,0xac,0xbb,0xbb,0xbb,0xbb,0xac,0xab,0xaa,0x88,0x21,0x53,0x53,0x43,0x43,
+0x34,0x35,0x34,0x34,0x43,0x32,0x32,0x32,0x33,0x23,0x23,0x11,0x81,0xa8,0xbd,0xbe,
+0xbc,0xcc,0xbb,0xbd,0xcc,0xcb,0xba,0xbb,0xbb,0xbb,0xbb,0xac,0xaa,0x8a,0x18,0x42,
+0x53,0x53,0x33,0x35,0x44,0x43,0x43,0x33,0x43,0x23,0x33,0x32,0x32,0x32,0x12,0x01,
+0xa9,0xeb,0xcb,0xdb,0xcb,0xdb,0xcb,0xbc,0xdb,0xba,0xcb,0xba,0xaa,0xab,0xba,0xaa,
+0x9a,0x88,0x31,0x44,0x34,0x35,0x34,0x44,0x43,0x34,0x43,0x42,0x22,0x22,0x23,0x32,
+0x32,0x21,0x01,0x98,0xb9,0xbd,0xcd,0xcb,0xbc,0xdb,0xdb,0xbb,0xbc,0xcb,0xaa,0xab,
+0xbb,0xab,0xab,0x9a,0x89,0x18,0x42,0x45,0x34,0x34,0x34,0x44,0x43,0x43,0x33,0x24,
+0x32,0x32,0x32,0x22,0x22,0x12,0x00,0x98,0xeb,0xdb,0xbc,0xbc,0xbc,0xcc,0xcb,0xcb,
+0xbb,0xbb,0xac,0xab,0xab,0xbb,0xab,0x99,0x18,0x42,0x44,0x53,0x43,0x43,0x53,0x43,
+0x43,0x33,0x24,0x23,0x23,0x33,0x24,0x12,0x12,0x10,0x88,0xba,0xcd,0xbc,0xcc,0xca,
+0xca,0xdb,0xbb,0xbc,0xac,0xab,0xaa,0xab,0xbb,0xba,0xaa,0x88,0x21,0x54,0x43,0x44,
+0x33,0x34,0x35,0x53,0x33,0x34,0x33,0x23,0x33,0x43,0x32,0x12,0x11,0x88,0xa9,0xdb,
+0xbc,0xcd,0xcb,0xbc,0xdb,0xcb,0xbb,0xbc,0xba,0xbb,0xbb,0xbb,0xbb,0xaa,0x8a,0x28,
+0x43,0x45,0x34,0x34,0x44,0x34,0x34,0x34,0x33,0x34,0x32,0x43,0x22,0x22,0x12,0x11,
+0x81,0x98,0xdb,0xbc,0xbd,0xcb,0xbc,0xcc,0xbc,0xcb,0xbb,0xbb,0xac,0xbb,0xba,0xbb,
+0xaa,0x99,0x08,0x31,0x45,0x44,0x43,0x43,0x43,0x34,0x34,0x34,0x24,0x23,0x23,0x22,
+0x23,0x23,0x12,0x02,0x98,0xba,0xdd,0xdb,0xcb,0xdb,0xbb,0xcc,0xbb,0xbd,0xba,0xbb,
+0xac,0xaa,0xab,0xab,0x99,0x88,0x21,0x43,0x44,0x34,0x35,0x53,0x43,0x34,0x43,0x33,
+0x33,0x33,0x24,0x23,0x23,0x22,0x11,0x81,0xb9,0xcd,0xbc,0xbc,0xcc,0xcb,0xbc,0xbd,
+0xbb,0xac,0xab,0xbb,0xbb,0xbc,0xaa,0xaa,0x98,0x00,0x42,0x63,0x43,0x43,0x34,0x43,
+0x44,0x33,0x34,0x33,0x24,0x32,0x32,0x32,0x12,0x02,0x00,0xa8,0xca,0xcc,0xcc,0xbc,
+0xcb,0xbc,0xbc,0xbd,0xbb,0xcb,0xba,0xba,0xab,0xbb,0xaa,0xaa,0x88,0x31,0x45,0x44,
+0x43,0x43,0x43,0x34,0x44,0x23,0x24,0x23,0x23,0x33,0x23,0x23,0x12,0x01,0x98,0xca,
+0xcc,0xbc,0xcc,0xcb,0xcb,0xbc,0xbd,0xbb,0xcb,0xab,0xba,0xbb,0xcb,0xaa,0x9a,0x88,
+0x11,0x43,0x63,0x43,0x34,0x53,0x43,0x43,0x24,0x24,0x32,0x22,0x23,0x23,0x33,0x22,
+0x11,0x88,0x99,0xbc,0xbe,0xbd,0xcc,0xbb,0xcc,0xbc,0xcb,0xbb,0xcb,0xba,0xaa,0xab,
+0xab,0xaa,0x99,0x18,0x42,0x44,0x34,0x34,0x34,0x35,0x44,0x33,0x34,0x33,0x24,0x23,
+0x23,0x22,0x22,0x11,0x01,0x98,0xda,0xdb,0xdb,0xbb,0xbd,0xbd,0xbc,0xbc,0xac,0xab,
+0xbb,0xbb,0xbb,0xbb,0xac,0x99,0x08,0x21,0x44,0x34,0x25,0x34,0x34,0x35,0x53,0x32,
+0x24,0x32,0x23,0x23,0x23,0x23,0x12,0x02,0x80,0xca,0xcc,0xbc,0xbc,0xcc,0xdb,0xcb,
+0xcb,0xbb,0xbc,0xba,0xbb,0xbb,0xbb,0xbb,0xaa,0x9a,0x10,0x44,0x44,0x53,0x33,0x35,
+0x44,0x33,0x44,0x32,0x33,0x33,0x24,0x32,0x22,0x12,0x11,0x81,0xa9,0xeb,0xcb,0xbc,
+0xcc,0xcb,0xdb,0xcb,0xbb,0xbc,0xba,0xbb,0xcb,0xba,0xaa,0x9a,0x99,0x08,0x31,0x45,
+0x44,0x43,0x43,0x33,0x35,0x44,0x33,0x24,0x32,0x22,0x33,0x32,0x23,0x21,0x00,0x90,
+0xca,0xdc,0xcb,0xbc,0xbc,0xcc,0xcb,0xac,0xac,0xba,0xab,0xbb,0xbb,0xbb,0xbb,0x9a,
+0x08,0x21,0x45,0x44,0x33,0x35,0x34,0x44,0x33,0x35,0x42,0x32,0x22,0x32,0x32,0x32,
+0x22,0x11,0x98,0xb9,0xcc,0xbd,0xbc,0xbd,0xcc,0xbb,0xbd,0xcb,0xbb,0xbb,0xbb,0xcb,
+0xbb,0xaa,0xaa,0x89,0x00,0x43,0x54,0x53,0x42,0x42,0x43,0x53,0x33,0x43,0x23,0x23,
+0x33,0x43,0x22,0x12,0x11,0x00,0x98,0xbc,0xcd,0xcb,0xcb,0xbc,0xbc,0xcc,0xcb,0xba,
+0xbb,0xac,0xaa,0xab,0xab,0xaa,0x9a,0x08,0x22,0x45,0x53,0x43,0x34,0x53,0x43,0x43,
+0x33,0x24,0x33,0x32,0x33,0x24,0x32,0x11,0x00,0x98,0xbb,0xbe,0xbc,0xcc,0xcb,0xbc,
+0xbd,0xcb,0xbb,0xcb,0xba,0xba,0xcb,0xaa,0xaa,0x9a,0x88,0x20,0x53,0x44,0x43,0x33,
+0x44,0x53,0x43,0x33,0x34,0x33,0x33,0x43,0x22,0x13,0x22,0x01,0x80,0xa9,0xcc,0xcc,
+0xdb,0xbb,0xcc,0xcb,0xbc,0xcb,0xbb,0xbb,0xcb,0xba,0xbb,0xbb,0xaa,0x88,0x11,0x43,
+0x63,0x43,0x34,0x44,0x43,0x43,0x43,0x33,0x24,0x33,0x32,0x23,0x33,0x23,0x21,0x80,
+0xa8,0xeb,0xdb,0xdb,0xca,0xcb,0xcb,0xcc,0xbb,0xbb,0xbc,0xba,0xcb,0xba,0xba,0xa9,
+0x99,0x88,0x31,0x45,0x34,0x34,0x43,0x34,0x35,0x34,0x24,0x33,0x33,0x33,0x43,0x32,
+0x22,0x12,0x01,0x80,0xba,0xbe,0xbd,0xcc,0xbb,0xcc,0xdb,0xbb,0xbc,0xac,0xab,0xaa,
+0xbb,0xbb,0xba,0x9a,0x09,0x20,0x53,0x44,0x44,0x43,0x43,0x43,0x43,0x43,0x43,0x22,
+0x23,0x23,0x33,0x32,0x22,0x01,0x90,0xa9,0xcc,0xcc,0xbc,0xbc,0xcc,0xdb,0xbb,0xbc,
+0xbb,0xac,0xbb,0xba,0xac,0x9a,0xaa,0x89,0x08,0x32,0x45,0x34,0x34,0x34,0x35,0x53,
+0x33,0x34,0x33,0x43,0x22,0x23,0x33,0x32,0x11,0x00,0xa9,0xca,0xcc,0xbd,0xbc,0xbd,
+0xcb,0xcb,0xbc,0xac,0xbb,0xbb,0xab,0xac,0xab,0xaa,0x99,0x08,0x31,0x44,0x34,0x35,
+0x34,0x34,0x44,0x33,0x35,0x33,0x33,0x24,0x32,0x22,0x22,0x22,0x01,0x90,0xb9,0xcd,
+0xbc,0xcc,0xcb,0xbc,0xcc,0xbb,0xbc,0xbb,0xac,0xbb,0xba,0xbb,0xab,0xaa,0x88,0x20,
+0x44,0x44,0x43,0x43,0x34,0x53,0x53,0x42,0x32,0x23,0x23,0x33,0x33,0x23,0x23,0x12,
+0x80,0xb9,0xcd,0xbc,0xbd,0xbc,0xcc,0xcb,0xdb,0xbb,0xbb,0xbc,0xba,0xab,0xac,0xaa,
+0xaa,0x99,0x00,0x32,0x35,0x45,0x43,0x43,0x34,0x43,0x34,0x43,0x33,0x33,0x24,0x32,
+0x22,0x22,0x12,0x00,0x98,0xca,0xbc,0xbe,0xbc,0xcc,0xcb,0xcb,0xcb,0xbb,0xac,0xbb,
+0xba,0xbb,0xbb,0xab,0xaa,0x08,0x21,0x45,0x44,0x43,0x43,0x34,0x34,0x34,0x34,0x24,
+0x23,0x23,0x23,0x33,0x33,0x23,0x12,0x98,0xca,0xcd,0xcb,0xcb,0xbc,0xbc,0xbd,0xbc,
+0xac,0xbb,0xbb,0xbb,0xcb,0xba,0xab,0x9b,0x89,0x11,0x63,0x53,0x43,0x43,0x43,0x53,
+0x33,0x44,0x33,0x33,0x33,0x33,0x24,0x23,0x23,0x11,0x80,0xa9,0xbc,0xcd,0xdb,0xcb,
+0xcb,0xbc,0xcc,0xba,0xac,0xab,0xbb,0xbb,0xcb,0xba,0x9a,0x89,0x00,0x32,0x44,0x44,
+0x43,0x53,0x33,0x35,0x34,0x43,0x33,0x32,0x43,0x22,0x33,0x22,0x12,0x81,0x98,0xcb,
+0xcc,0xbc,0xbc,0xcc,0xcb,0xbc,0xbc,0xbc,0xba,0xab,0xbb,0xbc,0xba,0xab,0x9a,0x08,
+0x21,0x34,0x45,0x34,0x34,0x34,0x44,0x43,0x33,0x34,0x33,0x33,0x33,0x43,0x32,0x21,
+0x00,0x90,0xb9,0xcc,0xcc,0xcb,0xbc,0xdb,0xdb,0xbb,0xcc,0xaa,0xbb,0xba,0xba,0xbb,
+0xab,0xab,0x89,0x18,0x53,0x44,0x53,0x43,0x43,0x34,0x34,0x34,0x43,0x32,0x33,0x33,
+0x24,0x22,0x13,0x12,0x80,0xa9,0xbc,0xcd,0xcb,0xcb,0xdb,0xcb,0xbc,0xcb,0xbb,0xcb,
+0xba,0xba,0xbb,0xbb,0xaa,0x9a,0x00,0x32,0x55,0x43,0x34,0x34,0x44,0x43,0x43,0x33,
+0x34,0x32,0x23,0x33,0x43,0x22,0x12,0x01,0x98,0xba,0xcd,0xbc,0xbc,0xbd,0xbc,0xcc,
+0xbb,0xac,0xac,0xba,0xba,0xbb,0xbb,0xba,0x9a,0x89,0x31,0x54,0x34,0x34,0x44,0x42,
+0x43,0x34,0x43,0x33,0x24,0x32,0x32,0x32,0x33,0x22,0x02,0x80,0xba,0xdc,0xdb,0xcb,
+0xbc,0xbc,0xcc,0xcb,0xbb,0xbc,0xba,0xbb,0xcb,0xba,0xab,0x9a,0x89,0x10,0x42,0x44,
+0x34,0x34,0x34,0x35,0x53,0x33,0x34,0x33,0x24,0x32,0x32,0x23,0x23,0x02,0x81,0xa9,
+0xcb,0xcd,0xcb,0xbc,0xbd,0xdb,0xcb,0xbb,0xbc,0xab,0xac,0xba,0xab,0xbb,0xaa,0x99,
+0x08,0x31,0x45,0x34,0x44,0x33,0x35,0x44,0x33,0x34,0x33,0x43,0x23,0x33,0x33,0x22,
+0x22,0x01,0x90,0xcb,0xcd,0xcb,0xcb,0xbc,0xcc,0xdb,0xca,0xaa,0xbb,0xbb,0xbb,0xac,
+0xab,0xab,0xaa,0x88,0x20,0x44,0x44,0x33,0x35,0x53,0x43,0x43,0x34,0x33,0x33,0x24,
+0x23,0x23,0x23,0x13,0x12,0x80,0xaa,0xdc,0xbc,0xbd,0xbc,0xbc,0xcc,0xcb,0xbb,0xbc,
+0xab,0xac,0xaa,0xab,0xbb,0x9a,0x89,0x20,0x42,0x44,0x43,0x34,0x44,0x33,0x35,0x34,
+0x43,0x33,0x23,0x33,0x33,0x43,0x22,0x13,0x01,0x90,0xcb,0xcc,0xbc,0xbc,0xbd,0xbc,
+0xbd,0xcb,0xbb,0xac,0xab,0xbb,0xbb,0xbb,0xbb,0x9a,0x88,0x32,0x46,0x53,0x33,0x44,
+0x33,0x35,0x44,0x42,0x32,0x32,0x23,0x33,0x32,0x23,0x23,0x11,0x98,0xcb,0xcc,0xcc,
+0xcb,0xcb,0xbc,0xdb,0xcb,0xbb,0xbc,0xbb,0xba,0xcb,0xaa,0xab,0xa9,0x88,0x10,0x43,
+0x54,0x43,0x43,0x24,0x34,0x34,0x34,0x43,0x23,0x33,0x33,0x24,0x23,0x12,0x11,0x00,
+0xa8,0xcc,0xbc,0xbd,0xcb,0xdb,0xcb,0xbc,0xbc,0xca,0xaa,0xba,0xba,0xbb,0xbb,0xaa,
+0x9a,0x18,0x42,0x54,0x34,0x43,0x34,0x43,0x44,0x33,0x34,0x33,0x24,0x23,0x23,0x33,
+0x32,0x22,0x00,0xa9,0xcb,0xbd,0xbd,0xcc,0xdb,0xbb,0xbc,0xcc,0xab,0xac,0xba,0xba,
+0xba,0xbb,0xab,0x9a,0x08,0x32,0x54,0x43,0x34,0x44,0x43,0x53,0x33,0x34,0x43,0x32,
+0x23,0x33,0x33,0x23,0x22,0x02,0x80,0xca,0xcc,0xcc,0xbb,0xbd,0xbc,0xbd,0xbc,0xac,
+0xbb,0xbb,0xbb,0xbc,0xbb,0xab,0xaa,0x89,0x21,0x43,0x45,0x43,0x34,0x53,0x43,0x34,
+0x43,0x33,0x24,0x23,0x32,0x23,0x33,0x23,0x12,0x81,0xb9,0xcd,0xdb,0xac,0xbc,0xdb,
+0xcb,0xbc,0xcb,0xbb,0xcb,0xba,0xba,0xbb,0xba,0xab,0x9a,0x08,0x42,0x35,0x35,0x34,
+0x53,0x43,0x34,0x34,0x43,0x33,0x33,0x24,0x32,0x22,0x23,0x11,0x01,0xa8,0xca,0xcc,
+0xcb,0xcc,0xcb,0xdb,0xcb,0xbb,0xbc,0xbb,0xbb,0xcb,0xba,0xac,0xaa,0x99,0x88,0x21,
+0x43,0x44,0x34,0x34,0x34,0x44,0x33,0x35,0x33,0x24,0x32,0x32,0x32,0x33,0x22,0x01,
+0x98,0xb9,0xcd,0xdb,0xcb,0xbc,0xcc,0xcb,0xbb,0xad,0xcb,0xba,0xaa,0xab,0xab,0xbb,
+0xaa,0x89,0x20,0x53,0x34,0x35,0x34,0x35,0x53,0x33,0x44,0x32,0x24,0x32,0x22,0x23,
+0x32,0x32,0x12,0x81,0xb8,0xcc,0xbc,0xbd,0xcb,0xcc,0xcb,0xbc,0xac,0xcb,0xba,0xaa,
+0xbb,0xbb,0xbb,0xaa,0x9a,0x18,0x42,0x44,0x44,0x42,0x33,0x35,0x44,0x43,0x42,0x22,
+0x23,0x32,0x23,0x33,0x32,0x12,0x01,0x99,0xda,0xdb,0xbc,0xbc,0xcc,0xcb,0xbc,0xbc,
+0xac,0xbb,0xbb,0xbb,0xcb,0xba,0xaa,0x9a,0x89,0x20,0x53,0x35,0x44,0x33,0x35,0x53,
+0x43,0x33,0x43,0x33,0x24,0x32,0x32,0x22,0x12,0x02,0x80,0xb9,0xcd,0xdb,0xbb,0xbd,
+0xbc,0xbd,0xbc,0xcb,0xbb,0xbb,0xbb,0xbc,0xba,0xac,0x9a,0x99,0x10,0x33,0x45,0x43,
+0x43,0x53,0x43,0x43,0x43,0x43,0x32,0x32,0x23,0x33,0x33,0x23,0x22,0x81,0xb8,0xcc,
+0xbd,0xcc,0xbb,0xbd,0xbc,0xbc,0xbc,0xbc,0xbb,0xbb,0xbc,0xba,0xbb,0xaa,0x9a,0x00,
+0x32,0x35,0x45,0x43,0x34,0x53,0x43,0x43,0x43,0x32,0x33,0x33,0x33,0x33,0x23,0x23,
+0x11,0x98,0xda,0xcc,0xdb,0xcb,0xcb,0xbc,0xbd,0xcb,0xbb,0xcb,0xbb,0xbb,0xbb,0xac,
+0xaa,0x9a,0x89,0x20,0x63,0x53,0x33,0x34,0x34,0x35,0x44,0x33,0x43,0x32,0x23,0x43,
+0x22,0x23,0x12,0x11,0x88,0xb8,0xdb,0xbc,0xbd,0xcc,0xcb,0xcb,0xdb,0xca,0xaa,0xbb,
+0xba,0xba,0xac,0xba,0xaa,0x89,0x18,0x32,0x45,0x34,0x34,0x44,0x43,0x43,0x24,0x24,
+0x32,0x23,0x33,0x33,0x33,0x23,0x12,0x81,0xa9,0xcc,0xcc,0xcb,0xbc,0xcc,0xcb,0xcb,
+0xbc,0xbb,0xbb,0xac,0xbb,0xbb,0xbb,0xbb,0x9b,0x09,0x32,0x55,0x53,0x33,0x44,0x43,
+0x34,0x34,0x43,0x33,0x33,0x33,0x24,0x23,0x23,0x13,0x12,0x88,0xca,0xcc,0xbc,0xbc,
+0xbd,0xdb,0xcb,0xcb,0xbb,0xbc,0xba,0xbb,0xac,0xba,0xaa,0x9a,0x89,0x11,0x43,0x35,
+0x35,0x34,0x43,0x44,0x33,0x35,0x33,0x24,0x23,0x32,0x23,0x33,0x22,0x12,0x81,0xa9,
+0xcd,0xdb,0xbc,0xcb,0xbc,0xcc,0xcb,0xcb,0xba,0xbb,0xcb,0xba,0xba,0xab,0x9a,0x8a,
+0x00,0x43,0x44,0x53,0x42,0x33,0x35,0x44,0x43,0x42,0x22,0x23,0x32,0x23,0x33,0x32,
+0x12,0x01,0x99,0xdb,0xcc,0xdb,0xbb,0xbd,0xdb,0xcb,0xbc,0xbb,0xac,0xab,0xab,0xcb,
+0xba,0xaa,0x9a,0x08,0x21,0x34,0x45,0x53,0x33,0x34,0x44,0x43,0x43,0x23,0x33,0x33,
+0x33,0x43,0x22,0x22,0x01,0x88,0xba,0xcd,0xcb,0xbc,0xcc,0xcb,0xdb,0xbb,0xbc,0xcb,
+0xba,0xbb,0xba,0xbb,0xba,0xaa,0x99,0x10,0x63,0x53,0x53,0x33,0x44,0x53,0x33,0x34,
+0x43,0x32,0x33,0x33,0x33,0x43,0x22,0x11,0x80,0xa8,0xbc,0xcd,0xcb,0xdb,0xbb,0xbd,
+0xcc,0xbb,0xcb,0xba,0xab,0xbb,0xac,0xba,0x9a,0x89,0x08,0x32,0x44,0x35,0x34,0x44,
+0x33,0x35,0x34,0x43,0x23,0x24,0x32,0x22,0x23,0x22,0x21,0x11,0x88,0xcb,0xcc,0xbc,
+0xbd,0xdb,0xcb,0xcb,0xac,0xcb,0xba,0xba,0xbb,0xbb,0xbb,0xbb,0x9b,0x09,0x42,0x44,
+0x43,0x34,0x44,0x33,0x35,0x25,0x24,0x33,0x33,0x32,0x33,0x24,0x23,0x22,0x11,0x88,
+0xca,0xcb,0xcc,0xcb,0xbc,0xdb,0xdb,0xbb,0xbc,0xac,0xab,0xbb,0xba,0xac,0xba,0x9a,
+0x99,0x10,0x43,0x44,0x43,0x34,0x53,0x43,0x43,0x34,0x33,0x33,0x24,0x33,0x32,0x33,
+0x22,0x12,0x81,0xa9,0xcc,0xcc,0xdb,0xbb,0xcc,0xbc,0xbc,0xbc,0xac,0xab,0xbb,0xcb,
+0xaa,0xaa,0x9a,0x89,0x08,0x22,0x35,0x35,0x35,0x43,0x34,0x35,0x43,0x43,0x32,0x23,
+0x43,0x22,0x23,0x23,0x21,0x01,0x98,0xca,0xcc,0xdb,0xca,0xbb,0xcd,0xcb,0xcb,0xab,
+0xac,0xba,0xba,0xbb,0xbb,0xab,0xaa,0x89,0x21,0x54,0x53,0x43,0x43,0x43,0x44,0x33,
+0x34,0x43,0x32,0x33,0x33,0x33,0x33,0x23,0x11,0x00,0xaa,0xcd,0xcc,0xdb,0xbb,0xbd,
+0xbc,0xcc,0xca,0xba,0xba,0xbb,0xca,0xaa,0xab,0x9a,0x89,0x10,0x43,0x34,0x35,0x44,
+0x33,0x35,0x34,0x34,0x43,0x23,0x33,0x43,0x32,0x22,0x22,0x12,0x00,0x98,0xcb,0xbd,
+0xbd,0xbc,0xbc,0xbd,0xbc,0xbc,0xac,0xbb,0xbb,0xcb,0xba,0xba,0xaa,0x8a,0x09,0x31,
+0x54,0x53,0x43,0x43,0x43,0x43,0x34,0x43,0x43,0x22,0x23,0x32,0x32,0x23,0x22,0x81,
+0x98,0xca,0xbc,0xbd,0xcc,0xcb,0xbc,0xbd,0xcb,0xcb,0xba,0xab,0xbb,0xac,0xba,0xaa,
+0xaa,0x88,0x10,0x53,0x44,0x43,0x43,0x43,0x53,0x43,0x43,0x33,0x32,0x43,0x32,0x33,
+0x22,0x22,0x01,0x00,0xa9,0xcc,0xcc,0xbc,0xdb,0xcb,0xdb,0xbb,0xbc,0xcb,0xab,0xbb,
+0xbb,0xbb,0xcb,0xaa,0x99,0x10,0x42,0x44,0x43,0x43,0x34,0x53,0x43,0x43,0x43,0x23,
+0x33,0x23,0x33,0x33,0x33,0x12,0x01,0xa8,0xbc,0xbe,0xcc,0xdb,0xbb,0xbd,0xdb,0xbb,
+0xbc,0xac,0xab,0xba,0xab,0xbb,0xba,0x9a,0x08,0x32,0x35,0x45,0x43,0x43,0x34,0x34,
+0x44,0x33,0x43,0x32,0x32,0x32,0x33,0x43,0x12,0x01,0x90,0xb9,0xcc,0xbc,0xbd,0xbc,
+0xbd,0xdb,0xbb,0xbc,0xcb,0xba,0xba,0xbb,0xbb,0xbb,0xab,0x89,0x21,0x44,0x44,0x43,
+0x34,0x34,0x25,0x34,0x43,0x33,0x34,0x32,0x33,0x32,0x33,0x22,0x12,0x00,0xb9,0xdc,
+0xbc,0xcc,0xcb,0xcb,0xbc,0xbc,0xbc,0xbc,0xba,0xab,0xbb,0xbb,0xcb,0xaa,0x99,0x08,
+0x32,0x45,0x53,0x33,0x35,0x53,0x34,0x43,0x43,0x32,0x23,0x33,0x33,0x24,0x22,0x11,
+0x01,0x99,0xca,0xcc,0xcb,0xbc,0xdb,0xbc,0xbc,0xcc,0xba,0xba,0xbb,0xcb,0xba,0xaa,
+0x9b,0x9a,0x09,0x20,0x44,0x44,0x43,0x43,0x43,0x34,0x44,0x33,0x43,0x33,0x32,0x33,
+0x32,0x24,0x12,0x11,0x88,0xba,0xcc,0xbc,0xcc,0xbc,0xbc,0xbc,0xcc,0xca,0xba,0xba,
+0xba,0xbb,0xbb,0xab,0xab,0x09,0x20,0x34,0x45,0x53,0x33,0x35,0x34,0x44,0x43,0x33,
+0x24,0x32,0x32,0x32,0x33,0x22,0x12,0x80,0xa8,0xcc,0xcc,0xdb,0xbb,0xbd,0xcc,0xcb,
+0xbb,0xac,0xbb,0xbb,0xbb,0xbb,0xbc,0xaa,0x8a,0x18,0x42,0x34,0x44,0x32,0x43,0x12,
+0x12,0x01,0x00,0x08,0x20,0x54,0x35,0x25,0x13,0x81,0x98,0x18,0x73,0x35,0x25,0x23,
+0x02,0x90,0x08,0x40,0x54,0x43,0x23,0x11,0x08,0x88,0x10,0x31,0x43,0x33,0x24,0x01,
+0x98,0x9a,0x18,0x52,0x23,0x01,0x00,0x18,0x00,0xeb,0xcd,0xbc,0xac,0xab,0x9a,0x09,
+0x90,0xfb,0xdd,0xac,0xab,0x89,0x00,0x80,0xca,0xdd,0xcc,0xbc,0xaa,0x09,0x11,0x91,
+0xed,0xbd,0xac,0x9b,0x98,0x88,0x08,0x30,0x64,0x44,0x32,0x12,0x80,0x88,0x18,0x62,
+0x53,0x23,0x23,0x10,0x00,0x80,0xa8,0xdd,0xbd,0xcb,0x99,0x08,0x00,0x98,0xba,0xcb,
+0xba,0xaa,0x8a,0x08,0x00,0xa8,0xce,0xcb,0x9b,0x89,0x80,0x88,0x98,0x99,0xa9,0xdb,
+0xab,0x0a,0x32,0x23,0xda,0xce,0xab,0x8a,0x88,0x08,0x08,0x62,0x54,0x43,0x33,0x23,
+0x12,0x00,0x00,0x32,0x47,0x53,0x22,0x02,0x80,0x08,0x63,0x45,0x34,0x33,0x12,0x88,
+0x88,0x30,0x47,0x35,0x24,0x22,0x01,0x98,0x08,0x31,0x36,0x35,0x23,0x02,0x80,0x88,
+0x20,0x44,0x35,0x23,0x12,0x80,0x89,0x00,0x31,0x42,0x32,0x22,0x11,0xa8,0xca,0x09,
+0x73,0x34,0x23,0x81,0x99,0x9a,0xb9,0xfd,0xcc,0xcb,0xab,0x89,0x89,0xa8,0xda,0xbc,
+0xbd,0xcb,0x9a,0x89,0x00,0xb8,0xed,0xdc,0xbb,0xaa,0x89,0x00,0x90,0xeb,0xdc,0xbb,
+0xac,0x89,0x08,0x81,0xb8,0xcf,0xbc,0xac,0xaa,0x88,0x10,0x88,0xa9,0xbc,0xbc,0xab,
+0x9a,0x00,0x00,0x90,0xbc,0xbd,0x9a,0x08,0x10,0x80,0x20,0x55,0x45,0x33,0x32,0x21,
+0x10,0x21,0x53,0x46,0x35,0x34,0x12,0x81,0x99,0x28,0x65,0x44,0x43,0x12,0x01,0x90,
+0x08,0x41,0x44,0x34,0x23,0x02,0x80,0x80,0x00,0x22,0x44,0x23,0x33,0x81,0x99,0x9a,
+0x21,0x44,0x22,0x02,0x11,0x21,0x80,0xfb,0xbd,0xbc,0xac,0xba,0x9a,0x09,0x99,0xed,
+0xcd,0xac,0xaa,0x88,0x80,0x98,0xdb,0xcd,0xcc,0xac,0x9b,0x08,0x11,0xa8,0xcf,0xbd,
+0xac,0x9a,0x88,0x88,0x88,0x31,0x46,0x44,0x32,0x11,0x90,0x88,0x28,0x44,0x44,0x32,
+0x12,0x01,0x00,0x80,0xca,0xdd,0xcb,0xab,0x89,0x00,0x00,0xa9,0xca,0xbb,0xbb,0xab,
+0x89,0x18,0x81,0xd9,0xdc,0xbb,0x9b,0x89,0x00,0x00,0x99,0xb9,0xdb,0xcb,0x8a,0x20,
+0x33,0x02,0xeb,0xbd,0xab,0x99,0x80,0x08,0x10,0x73,0x44,0x34,0x24,0x22,0x01,0x00,
+0x21,0x63,0x44,0x33,0x12,0x81,0x99,0x20,0x65,0x35,0x25,0x23,0x02,0x90,0x88,0x40,
+0x64,0x34,0x24,0x22,0x80,0x88,0x00,0x53,0x44,0x32,0x12,0x00,0x88,0x88,0x20,0x63,
+0x34,0x24,0x13,0x80,0x98,0x88,0x21,0x32,0x24,0x23,0x01,0xb8,0xbb,0x1a,0x66,0x34,
+0x23,0x80,0x99,0x99,0xa8,0xce,0xbe,0xac,0x9a,0x08,0x80,0xb8,0xdb,0xbc,0xbc,0xbb,
+0xac,0x09,0x18,0xb9,0xef,0xbc,0xbc,0x9a,0x88,0x00,0x98,0xdc,0xcc,0xcb,0xaa,0x89,
+0x00,0x81,0xc9,0xdd,0xbc,0xbb,0xaa,0x08,0x00,0x80,0xca,0xdb,0xac,0xaa,0x89,0x10,
+0x01,0x98,0xbc,0xac,0x89,0x00,0x00,0x88,0x28,0x56,0x35,0x24,0x13,0x11,0x00,0x11,
+0x63,0x45,0x34,0x24,0x02,0x80,0x09,0x41,0x46,0x34,0x43,0x21,0x00,0x98,0x00,0x52,
+0x35,0x34,0x23,0x01,0x88,0x08,0x21,0x42,0x33,0x24,0x12,0x91,0x98,0x19,0x42,0x34,
+0x12,0x80,0x89,0x09,0x98,0xdc,0xcc,0xbc,0xac,0xab,0x9a,0x09,0xa9,0xdf,0xbd,0xad,
+0x9a,0x08,0x00,0xa9,0xdc,0xcd,0xcb,0xab,0x8b,0x18,0x12,0xd9,0xde,0xdb,0xaa,0x9a,
+0x88,0x88,0x08,0x32,0x47,0x53,0x22,0x01,0x88,0x88,0x31,0x45,0x43,0x22,0x11,0x01,
+0x00,0x90,0xeb,0xdc,0xab,0xab,0x09,0x18,0x88,0xa9,0xcb,0xac,0xbb,0x9a,0x89,0x10,
+0x90,0xdb,0xcd,0xba,0x89,0x08,0x01,0x88,0xa9,0xaa,0xbb,0xcb,0x89,0x30,0x43,0x91,
+0xec,0xbc,0xab,0x88,0x00,0x00,0x10,0x73,0x45,0x34,0x32,0x02,0x81,0x00,0x31,0x54,
+0x34,0x24,0x22,0x00,0x88,0x30,0x47,0x35,0x25,0x23,0x81,0x90,0x08,0x42,0x46,0x34,
+0x24,0x11,0x08,0x89,0x20,0x53,0x34,0x24,0x22,0x01,0x88,0x08,0x30,0x54,0x34,0x33,
+0x01,0x90,0x89,0x18,0x33,0x35,0x33,0x12,0x88,0xab,0x0a,0x61,0x35,0x24,0x11,0x98,
+0x88,0x98,0xea,0xcd,0xcc,0xba,0x99,0x89,0x89,0xa9,0xbc,0xdc,0xcb,0xba,0x9a,0x88,
+0x90,0xfb,0xcd,0xbc,0xbb,0x9b,0x08,0x11,0xa8,0xde,0xcc,0xbb,0xaa,0x89,0x11,0x80,
+0xfb,0xcc,0xcc,0xaa,0x89,0x08,0x00,0xa8,0xca,0xcb,0xaa,0x8a,0x09,0x10,0x00,0xa9,
+0xeb,0xab,0x9a,0x18,0x10,0x80,0x30,0x66,0x44,0x33,0x12,0x80,0x08,0x41,0x45,0x44,
+0x43,0x22,0x02,0x88,0x00,0x73,0x44,0x34,0x33,0x22,0x80,0x88,0x10,0x64,0x34,0x34,
+0x22,0x81,0x80,0x08,0x21,0x43,0x33,0x24,0x11,0x88,0x99,0x08,0x41,0x43,0x12,0x00,
+0x88,0x11,0x90,0xde,0xcc,0xac,0xab,0x99,0x89,0x80,0xb8,0xdf,0xcc,0xac,0x9a,0x08,
+0x08,0xb9,0xdd,0xcc,0xcb,0xab,0x8a,0x10,0x01,0xfa,0xcd,0xbc,0xab,0x99,0x09,0x89,
+0x00,0x63,0x45,0x33,0x14,0x01,0x89,0x08,0x32,0x36,0x34,0x22,0x12,0x00,0x00,0xa8,
+0xdc,0xcd,0xab,0xab,0x88,0x00,0x80,0xaa,0xcc,0xba,0xaa,0x9a,0x08,0x80,0xa0,0xcc,
+0xcc,0xab,0x99,0x00,0x00,0x80,0xa9,0xba,0xcb,0xab,0x09,0x41,0x23,0xb0,0xcf,0xcb,
+0x9a,0x09,0x80,0x00,0x21,0x56,0x44,0x43,0x12,0x00,0x08,0x18,0x42,0x63,0x33,0x33,
+0x12,0x80,0x88,0x51,0x56,0x44,0x33,0x22,0x00,0x88,0x20,0x55,0x34,0x25,0x13,0x02,
+0x80,0x88,0x21,0x54,0x44,0x32,0x12,0x00,0x99,0x08,0x42,0x35,0x25,0x22,0x00,0x80,
+0x88,0x11,0x32,0x33,0x23,0x01,0xb9,0xcb,0x09,0x63,0x35,0x24,0x01,0x88,0x89,0x99,
+0xdb,0xbe,0xcd,0xaa,0x9a,0x89,0x89,0xba,0xbe,0xbd,0xcb,0xa9,0x08,0x08,0xa9,0xce,
+0xcd,0xac,0xbb,0x99,0x08,0x01,0xb8,0xce,0xbd,0xac,0x9a,0x08,0x10,0x98,0xfb,0xcc,
+0xcb,0xaa,0x89,0x08,0x00,0x99,0xdb,0xcb,0xaa,0x8a,0x08,0x11,0x81,0xb9,0xbd,0x9c,
+0x89,0x00,0x00,0x08,0x41,0x55,0x34,0x24,0x01,0x00,0x10,0x42,0x45,0x44,0x43,0x12,
+0x01,0x88,0x18,0x73,0x35,0x44,0x22,0x02,0x80,0x88,0x20,0x54,0x34,0x24,0x12,0x00,
+0x88,0x00,0x21,0x43,0x43,0x12,0x81,0x99,0x99,0x10,0x43,0x43,0x12,0x01,0x00,0x99,
+0xeb,0xbc,0xbd,0xca,0xba,0xaa,0x8a,0x98,0xfa,0xdd,0xdb,0xaa,0x8a,0x80,0x80,0xc9,
+0xdd,0xdb,0xac,0xab,0x88,0x11,0x81,0xfb,0xbe,0xbc,0xab,0x99,0x89,0x80,0x21,0x46,
+0x34,0x34,0x22,0x00,0x89,0x18,0x53,0x45,0x32,0x22,0x01,0x01,0x80,0xa8,0xce,0xcc,
+0xab,0x9a,0x08,0x80,0x98,0xcb,0xbb,0xbb,0xab,0x99,0x00,0x01,0xc9,0xcd,0xbc,0xab,
+0x88,0x08,0x00,0x88,0x99,0xba,0xbd,0xbb,0x19,0x33,0x13,0xfb,0xbd,0xaa,0x89,0x88,
+0x98,0x18,0x64,0x45,0x33,0x24,0x12,0x11,0x11,0x11,0x43,0x45,0x34,0x23,0x01,0x88,
+0x18,0x64,0x54,0x43,0x23,0x12,0x80,0x88,0x30,0x65,0x34,0x34,0x23,0x01,0x90,0x08,
+0x31,0x46,0x43,0x23,0x12,0x80,0x89,0x10,0x44,0x44,0x33,0x12,0x00,0x89,0x88,0x21,
+0x34,0x34,0x12,0x81,0xa9,0xab,0x89,0x53,0x45,0x32,0x01,0x88,0xa9,0xa9,0xcd,0xcd,
+0xbc,0xbb,0xaa,0x99,0x9a,0xcb,0xcc,0xcc,0xbb,0xbb,0x89,0x00,0xc9,0xde,0xbd,0xac,
+0xab,0x99,0x08,0x88,0xca,0xdd,0xdb,0xaa,0x9a,0x08,0x81,0xb9,0xcf,0xbc,0xac,0x9a,
+0x89,0x00,0x80,0xa9,0xdb,0xcb,0xab,0x9a,0x80,0x11,0x80,0xba,0xcc,0xab,0x8a,0x88,
+0x88,0x31,0x47,0x35,0x34,0x22,0x01,0x80,0x20,0x53,0x45,0x35,0x43,0x12,0x81,0x88,
+0x10,0x55,0x54,0x33,0x22,0x02,0x88,0x88,0x42,0x36,0x35,0x22,0x02,0x00,0x88,0x10,
+0x21,0x24,0x24,0x22,0x01,0x98,0x89,0x30,0x34,0x24,0x01,0x88,0x00,0x80,0xd9,0xcd,
+0xbc,0xcb,0xaa,0x9a,0x89,0xb9,0xde,0xbd,0xad,0x9b,0x89,0x88,0x98,0xdb,0xdd,0xcc,
+0xbb,0x9b,0x19,0x21,0xb8,0xff,0xcb,0xab,0x9a,0x98,0x88,0x08,0x31,0x56,0x53,0x32,
+0x11,0x80,0x88,0x20,0x63,0x34,0x33,0x13,0x02,0x01,0x00,0xc9,0xce,0xbc,0xac,0x99,
+0x80,0x80,0xa8,0xba,0xcb,0xbb,0xaa,0x8a,0x18,0x01,0xb9,0xcf,0xac,0xaa,0x08,0x00,
+0x00,0x88,0x99,0xbb,0xbc,0xab,0x28,0x33,0x82,0xfc,0xcb,0xab,0x89,0x88,0x80,0x20,
+0x45,0x36,0x34,0x43,0x21,0x10,0x00,0x10,0x53,0x44,0x33,0x23,0x01,0x88,0x30,0x66,
+0x44,0x34,0x23,0x02,0x88,0x89,0x42,0x46,0x34,0x33,0x23,0x00,0x80,0x00,0x53,0x45,
+0x43,0x22,0x01,0x88,0x88,0x21,0x45,0x33,0x24,0x01,0x00,0x88,0x08,0x20,0x33,0x35,
+0x33,0x01,0x99,0xaa,0x09,0x63,0x34,0x33,0x12,0x90,0xa8,0xdc,0xdd,0xcc,0xba,0xab,
+0x09,0x88,0xa9,0xeb,0xbc,0xbc,0xbb,0xbb,0x99,0x88,0xe9,0xdd,0xbd,0xbc,0x9a,0x08,
+0x00,0xa8,0xfb,0xbc,0xbc,0xab,0x99,0x00,0x01,0xd9,0xdd,0xbc,0xbb,0x9a,0x08,0x00,
+0x98,0xbb,0xcd,0xbb,0xab,0x89,0x10,0x12,0xa0,0xdc,0xbb,0xaa,0x08,0x01,0x08,0x31,
+0x57,0x34,0x34,0x12,0x81,0x80,0x20,0x54,0x54,0x34,0x33,0x12,0x88,0x88,0x51,0x55,
+0x44,0x23,0x13,0x81,0x88,0x18,0x53,0x45,0x33,0x23,0x02,0x08,0x88,0x10,0x32,0x35,
+0x34,0x22,0x80,0x9a,0x89,0x41,0x33,0x12,0x01,0x10,0x13,0xa0,0xdf,0xcc,0xab,0xbb,
+0xbb,0x99,0x00,0x98,0xef,0xcc,0xcb,0xa9,0x08,0x08,0x98,0xeb,0xdc,0xcc,0xbb,0x9a,
+0x18,0x02,0xc8,0xcf,0xbc,0xac,0x99,0x88,0x88,0x08,0x41,0x45,0x34,0x23,0x02,0x80,
+0x09,0x30,0x55,0x43,0x23,0x13,0x01,0x00,0x98,0xdb,0xbe,0xbc,0xbb,0x89,0x00,0x80,
+0xb9,0xdb,0xbb,0xab,0xab,0x89,0x00,0x81,0xda,0xcd,0xba,0xaa,0x88,0x08,0x98,0x98,
+0xa8,0xbb,0xae,0x9a,0x30,0x33,0x91,0xde,0xbc,0xaa,0x09,0x08,0x00,0x31,0x45,0x45,
+0x33,0x24,0x12,0x00,0x80,0x21,0x54,0x44,0x32,0x02,0x81,0x08,0x42,0x55,0x34,0x34,
+0x23,0x01,0x80,0x08,0x53,0x55,0x34,0x33,0x22,0x00,0x89,0x21,0x54,0x44,0x32,0x12,
+0x88,0x98,0x08,0x31,0x54,0x43,0x23,0x12,0x80,0x89,0x09,0x42,0x34,0x33,0x02,0x98,
+0xaa,0x89,0x51,0x53,0x33,0x13,0x80,0x98,0xa8,0xdc,0xdd,0xcc,0xab,0xaa,0x89,0x99,
+0xb9,0xcc,0xbc,0xbd,0xab,0x9b,0x08,0x81,0xfa,0xce,0xcb,0xbb,0x9a,0x09,0x88,0xa9,
+0xdd,0xcc,0xbb,0xbb,0x89,0x11,0x01,0xfb,0xcd,0xbc,0xab,0x8a,0x08,0x00,0x88,0xca,
+0xbc,0xcb,0x9a,0x08,0x10,0x80,0xaa,0xcc,0xaa,0x89,0x01,0x80,0x88,0x21,0x47,0x35,
+0x34,0x22,0x01,0x80,0x20,0x64,0x45,0x43,0x23,0x11,0x88,0x08,0x63,0x45,0x34,0x33,
+0x12,0x80,0x88,0x10,0x54,0x35,0x43,0x12,0x01,0x88,0x08,0x20,0x33,0x35,0x32,0x11,
+0x88,0x9a,0x09,0x41,0x43,0x13,0x02,0x11,0x81,0xc8,0xce,0xcc,0xbb,0xab,0xaa,0x89,
+0x08,0xc9,0xde,0xbd,0xbc,0xaa,0x08,0x80,0xb9,0xde,0xcc,0xbc,0xaa,0x8a,0x01,0x81,
+0xfa,0xcd,0xac,0xab,0x9a,0x89,0x88,0x10,0x53,0x36,0x35,0x22,0x01,0x88,0x08,0x42,
+0x45,0x33,0x22,0x02,0x01,0x81,0x98,0xdd,0xcc,0xbb,0xaa,0x09,0x08,0x90,0xb9,0xdb,
+0xbb,0xbb,0x9a,0x88,0x01,0xa8,0xce,0xdb,0xaa,0x89,0x08,0x08,0x98,0x88,0x99,0xbb,
+0xad,0x89,0x21,0x13,0xc0,0xce,0xbb,0x9a,0x09,0x08,0x09,0x30,0x47,0x35,0x24,0x23,
+0x11,0x01,0x11,0x41,0x34,0x45,0x32,0x12,0x01,0x00,0x51,0x45,0x45,0x33,0x32,0x01,
+0x88,0x09,0x63,0x45,0x34,0x24,0x01,0x88,0x88,0x11,0x35,0x44,0x23,0x12,0x00,0x89,
+0x08,0x41,0x54,0x33,0x23,0x81,0x98,0x09,0x20,0x32,0x33,0x24,0x22,0x80,0xba,0x9a,
+0x73,0x36,0x23,0x82,0x98,0x08,0x00,0xfa,0xcd,0xbd,0xaa,0x9a,0x98,0x98,0xb9,0xcb,
+0xbd,0xad,0xbb,0x8a,0x89,0xb8,0xdf,0xbc,0xad,0xab,0x89,0x80,0x80,0xca,0xcd,0xcc,
+0xab,0x9b,0x88,0x11,0x90,0xfb,0xdc,0xcb,0xaa,0x99,0x00,0x81,0x98,0xbc,0xbc,0xab,
+0x99,0x08,0x00,0x80,0xa9,0xbc,0xbc,0x9a,0x89,0x00,0x10,0x64,0x54,0x53,0x22,0x01,
+0x08,0x08,0x42,0x55,0x53,0x32,0x13,0x01,0x88,0x20,0x64,0x54,0x43,0x22,0x02,0x80,
+0x88,0x20,0x45,0x35,0x23,0x22,0x80,0x08,0x10,0x31,0x34,0x43,0x22,0x11,0x98,0x99,
+0x09,0x43,0x34,0x13,0x11,0x88,0xa9,0xeb,0xcc,0xcb,0xbb,0xbc,0xab,0x9b,0x99,0xea,
+0xdd,0xcc,0xab,0x9a,0x08,0x90,0xdb,0xdd,0xdb,0xbb,0xab,0x89,0x11,0x90,0xed,0xcd,
+0xcb,0xaa,0x89,0x89,0x08,0x28,0x63,0x44,0x24,0x13,0x81,0x88,0x18,0x42,0x35,0x24,
+0x22,0x10,0x00,0x00,0xa8,0xdd,0xcc,0xab,0x9a,0x08,0x08,0x98,0xba,0xcb,0xcb,0xaa,
+0x8a,0x08,0x01,0xb8,0xdd,0xbb,0xab,0x08,0x00,0x80,0x99,0xaa,0xbb,0xdb,0xaa,0x18,
+0x33,0x13,0xfa,0xbd,0xac,0x9a,0x98,0x88,0x18,0x53,0x55,0x33,0x34,0x23,0x12,0x11,
+0x21,0x63,0x44,0x33,0x14,0x11,0x88,0x19,0x52,0x55,0x34,0x24,0x22,0x81,0x80,0x21,
+0x46,0x44,0x33,0x23,0x00,0x88,0x18,0x52,0x44,0x43,0x23,0x02,0x00,0x89,0x18,0x52,
+0x44,0x34,0x12,0x01,0x98,0x08,0x10,0x33,0x24,0x23,0x01,0x98,0xaa,0x28,0x56,0x44,
+0x12,0x81,0x99,0x98,0x98,0xcb,0xce,0xbc,0xaa,0x8a,0x99,0xa9,0xca,0xcc,0xcc,0xcb,
+0xaa,0x88,0x01,0xa9,0xcf,0xcc,0xab,0xab,0x89,0x08,0x98,0xc9,0xcd,0xbd,0xbc,0x9a,
+0x88,0x01,0xb8,0xce,0xbd,0xac,0x9a,0x09,0x00,0x80,0xb9,0xcc,0xbb,0xbb,0x09,0x10,
+0x01,0x90,0xea,0xcb,0xaa,0x99,0x01,0x11,0x21,0x43,0x46,0x44,0x32,0x11,0x81,0x18,
+0x42,0x56,0x43,0x33,0x13,0x80,0x88,0x30,0x66,0x34,0x34,0x23,0x11,0x08,0x88,0x42,
+0x54,0x34,0x33,0x12,0x01,0x88,0x11,0x42,0x33,0x24,0x22,0x00,0x98,0x89,0x21,0x34,
+0x24,0x01,0x88,0x88,0x00,0xb9,0xdf,0xcc,0xac,0xbb,0x89,0x08,0x80,0xdd,0xdd,0xbb,
+0xaa,0x88,0x00,0x98,0xeb,0xdc,0xbc,0xbc,0xab,0x88,0x21,0xa0,0xee,0xcc,0xbb,0xaa,
+0x99,0x88,0x08,0x31,0x47,0x34,0x24,0x11,0x80,0x09,0x10,0x44,0x34,0x24,0x12,0x01,
+0x01,0x00,0xc9,0xdc,0xbc,0xac,0x89,0x08,0x08,0x99,0xbb,0xac,0xbb,0x9a,0x8a,0x10,
+0x00,0xc9,0xdd,0xbb,0x9a,0x88,0x10,0x88,0x98,0xaa,0xba,0xbc,0xaa,0x30,0x44,0x02,
+0xda,0xbd,0xac,0x99,0x89,0x08,0x20,0x63,0x44,0x34,0x33,0x23,0x12,0x00,0x21,0x73,
+0x44,0x33,0x12,0x01,0x08,0x31,0x47,0x35,0x35,0x32,0x11,0x88,0x88,0x40,0x64,0x34,
+0x43,0x12,0x81,0x98,0x18,0x41,0x35,0x25,0x22,0x11,0x88,0x88,0x10,0x52,0x44,0x33,
+0x22,0x00,0x99,0x08,0x21,0x34,0x23,0x11,0x08,0x89,0x89,0x18,0x73,0x44,0x23,0x81,
+0x99,0x8a,0xa9,0xed,0xcd,0xcb,0xaa,0x88,0x08,0xb9,0xdb,0xac,0xcb,0xaa,0x9b,0x0a,
+0x88,0xd9,0xde,0xbd,0xac,0x9a,0x89,0x80,0x98,0xcb,0xcd,0xbc,0xbb,0x9b,0x08,0x00,
+0xc9,0xcf,0xbc,0xac,0x99,0x08,0x08,0x90,0xa9,0xbc,0xad,0xaa,0x8a,0x10,0x10,0x99,
+0xbc,0xbc,0x99,0x88,0x98,0x99,0x20,0x56,0x35,0x24,0x22,0x11,0x00,0x00,0x53,0x55,
+0x53,0x23,0x02,0x80,0x09,0x41,0x55,0x34,0x34,0x22,0x01,0x98,0x18,0x42,0x46,0x33,
+0x23,0x01,0x80,0x00,0x20,0x42,0x43,0x33,0x13,0x01,0xa9,0x9a,0x31,0x45,0x22,0x12,
+0x01,0x81,0xc9,0xec,0xcb,0xba,0xbb,0xbb,0xaa,0x08,0x90,0xfe,0xcd,0xbb,0xab,0x09,
+0x00,0xa8,0xcd,0xcd,0xbd,0xbb,0x9b,0x18,0x12,0xd9,0xde,0xbc,0xac,0x99,0x88,0x88,
+0x00,0x41,0x45,0x43,0x23,0x02,0x80,0x08,0x30,0x55,0x43,0x23,0x12,0x01,0x00,0x80,
+0xd9,0xdc,0xbc,0xab,0x89,0x08,0x80,0xa9,0xcb,0xbb,0xbb,0xab,0x99,0x21,0x02,0xd9,
+0xce,0xbb,0x9a,0x08,0x01,0x98,0xaa,0x99,0x99,0xbc,0xac,0x18,0x43,0x02,0xfb,0xcc,
+0xaa,0x08,0x00,0x81,0x10,0x63,0x44,0x43,0x22,0x12,0x00,0x80,0x11,0x44,0x34,0x34,
+0x23,0x11,0x11,0x43,0x46,0x44,0x43,0x33,0x12,0x98,0x89,0x51,0x55,0x34,0x23,0x12,
+0x80,0x00,0x20,0x53,0x34,0x44,0x22,0x11,0x88,0x09,0x40,0x44,0x34,0x22,0x01,0x88,
+0x08,0x08,0x21,0x43,0x43,0x22,0x80,0xa9,0xaa,0x30,0x55,0x33,0x14,0x01,0x98,0xba,
+0xbe,0xbd,0xbc,0xbb,0xbb,0xaa,0xa9,0xca,0xdc,0xcc,0xbc,0xab,0xab,0x88,0x08,0xc9,
+0xcf,0xbd,0xac,0x9a,0x09,0x00,0xb8,0xcd,0xbd,0xcb,0x9a,0x89,0x00,0x80,0xda,0xcd,
+0xbc,0xac,0x99,0x08,0x01,0x98,0xba,0xbd,0xac,0x9a,0x89,0x00,0x01,0x98,0xca,0xcb,
+0xa9,0x08,0x00,0x11,0x42,0x55,0x53,0x32,0x12,0x00,0x00,0x42,0x45,0x45,0x43,0x22,
+0x01,0x88,0x08,0x63,0x55,0x33,0x24,0x02,0x80,0x08,0x20,0x54,0x34,0x33,0x23,0x01,
+0x08,0x00,0x21,0x34,0x34,0x33,0x12,0x80,0x88,0x18,0x32,0x43,0x33,0x34,0x13,0xb1,
+0xce,0xcc,0xba,0xcb,0xbc,0xbb,0x8a,0x11,0xb0,0xff,0xcc,0xaa,0x99,0x00,0x08,0xb9,
+0xcc,0xdd,0xcb,0xac,0x99,0x10,0x01,0xe9,0xcd,0xcb,0xab,0x99,0x88,0x88,0x18,0x53,
+0x45,0x34,0x22,0x01,0x88,0x08,0x42,0x44,0x34,0x32,0x21,0x01,0x00,0xa0,0xcd,0xcd,
+0xbb,0x9a,0x09,0x00,0x88,0xba,0xbc,0xbc,0xaa,0x9a,0x09,0x01,0x90,0xcc,0xbd,0xab,
+0x9a,0x08,0x89,0x88,0x89,0x99,0xcb,0xbc,0x89,0x32,0x25,0xb0,0xdd,0xac,0x9a,0x88,
+0x10,0x00,0x31,0x44,0x35,0x24,0x33,0x23,0x12,0x32,0x54,0x53,0x43,0x22,0x11,0x80,
+0x10,0x53,0x55,0x34,0x34,0x23,0x02,0x80,0x18,0x44,0x55,0x43,0x32,0x12,0x80,0x88,
+0x10,0x54,0x44,0x22,0x82,0xa9,0xbb,0xab,0x10,0x44,0x34,0x12,0x01,0x99,0x98,0x10,
+0x33,0x25,0x12,0x81,0x88,0x18,0x31,0x35,0x34,0x12,0x80,0x80,0x21,0x01,0xfc,0xde,
+0xcb,0xaa,0x99,0x00,0x80,0xb9,0xbd,0xbd,0xbc,0xbb,0x8a,0x08,0x90,0xfc,0xcd,0xcb,
+0xaa,0x99,0x00,0x80,0xa9,0xce,0xcc,0xbb,0xaa,0x09,0x10,0x90,0xfb,0xbd,0xad,0xab,
+0x89,0x08,0x80,0xa8,0xcb,0xbc,0xac,0x9a,0x88,0x10,0x08,0xb9,0xcb,0xab,0x9a,0x08,
+0x01,0x22,0x45,0x45,0x53,0x33,0x23,0x12,0x11,0x43,0x55,0x44,0x24,0x23,0x01,0x88,
+0x18,0x64,0x44,0x34,0x32,0x12,0x80,0x09,0x30,0x55,0x44,0x22,0x12,0x00,0x00,0x10,
+0x22,0x32,0x32,0x34,0x22,0x81,0xaa,0x89,0x52,0x34,0x23,0x02,0x00,0x80,0xc9,0xdd,
+0xbc,0xbc,0xab,0x9b,0x89,0x88,0xd9,0xde,0xbc,0xac,0x99,0x08,0x98,0xdb,0xcd,0xbc,
+0xcc,0xaa,0x09,0x10,0x81,0xfb,0xcd,0xcb,0xaa,0x99,0x98,0x88,0x10,0x54,0x44,0x43,
+0x12,0x80,0x08,0x18,0x43,0x35,0x24,0x22,0x01,0x00,0x00,0xa8,0xcd,0xcd,0xba,0x9a,
+0x88,0x00,0x90,0xba,0xdb,0xba,0xaa,0x9a,0x08,0x08,0xb8,0xdd,0xbc,0xaa,0x88,0x11,
+0x80,0xa9,0xaa,0x9b,0xaa,0xbb,0x9b,0x38,0x35,0x91,0xfd,0xdb,0x9a,0x09,0x10,0x08,
+0x88,0x52,0x55,0x43,0x22,0x00,0x88,0x20,0x63,0x33,0x33,0x22,0x11,0x12,0x33,0x65,
+0x44,0x35,0x24,0x13,0x80,0x88,0x10,0x54,0x35,0x34,0x23,0x12,0x81,0x18,0x31,0x46,
+0x34,0x33,0x12,0x80,0x88,0x10,0x42,0x35,0x35,0x32,0x11,0x80,0x99,0x88,0x21,0x34,
+0x24,0x12,0x99,0xaa,0x10,0x45,0x35,0x12,0x00,0x99,0x08,0x80,0xeb,0xce,0xbc,0xbb,
+0xaa,0x89,0x99,0xaa,0xcc,0xbd,0xbd,0xac,0x89,0x01,0x80,0xdc,0xcd,0xac,0xab,0x89,
+0x08,0x80,0xca,0xcd,0xcc,0xaa,0x8a,0x18,0x01,0xa8,0xdd,0xcc,0xbb,0xab,0x99,0x00,
+0x80,0xa9,0xcd,0xcb,0x9a,0x09,0x10,0x00,0x88,0xba,0xbc,0xab,0x9a,0x09,0x11,0x32,
+0x44,0x46,0x44,0x33,0x22,0x80,0x88,0x41,0x47,0x44,0x32,0x12,0x81,0x88,0x10,0x55,
+0x35,0x25,0x22,0x11,0x88,0x08,0x31,0x36,0x44,0x32,0x12,0x00,0x80,0x18,0x32,0x44,
+0x33,0x12,0x90,0x98,0x00,0x31,0x32,0x22,0x21,0x32,0x23,0xb8,0xcf,0xbd,0xbc,0xcc,
+0xac,0xab,0x99,0xa9,0xdd,0xbd,0xad,0xaa,0x88,0x01,0x90,0xda,0xdc,0xcc,0xbb,0xaa,
+0x08,0x11,0xa0,0xee,0xdb,0xbb,0xab,0x99,0x89,0x88,0x31,0x56,0x53,0x33,0x22,0x80,
+0x88,0x31,0x67,0x44,0x43,0x43,0x22,0x21,0x01,0x21,0x21,0x22,0x01,0xb9,0xce,0xbc,
+0xaa,0x9a,0x98,0x99,0xbb,0xcb,0xba,0xdc,0xcc,0xcc,0xbb,0xac,0xaa,0xaa,0xab,0xbb,
+0xaa,0xba,0xda,0xcb,0xac,0xaa,0x08,0x21,0x12,0x32,0x44,0x35,0x43,0x32,0x32,0x54,
+0x34,0x34,0x23,0x32,0x42,0x32,0x14,0x02,0x00,0x80,0x00,0x80,0xa9,0xcb,0xdb,0xdb,
+0xcc,0xcb,0xab,0xbb,0xeb,0xdb,0xbc,0xbb,0xbb,0xbb,0xbc,0xbb,0xab,0x99,0x98,0x08,
+0x10,0x53,0x44,0x43,0x43,0x53,0x43,0x44,0x34,0x44,0x32,0x33,0x23,0x23,0x32,0x23,
+0x32,0x32,0x45,0x44,0x22,0x01,0x98,0xa9,0x99,0xcb,0xcc,0xac,0x9a,0x88,0xa8,0xcd,
+0xbd,0xbb,0xbb,0xcb,0xcb,0xcb,0xa9,0x08,0x00,0x01,0x21,0x22,0x32,0x33,0x45,0x45,
+0x43,0x43,0x43,0x34,0x44,0x33,0x23,0x23,0x33,0x33,0x43,0x12,0x22,0x43,0x33,0x12,
+0xa9,0xbc,0xbc,0xcb,0xcc,0xcc,0xcb,0xbc,0xcc,0xdb,0xab,0xbb,0xab,0xbb,0xbc,0xbb,
+0xaa,0xab,0xcb,0xbc,0xab,0x18,0x31,0x33,0x43,0x45,0x53,0x23,0x12,0x11,0x53,0x45,
+0x43,0x23,0x22,0x33,0x34,0x32,0x81,0xaa,0xac,0xaa,0xa9,0xba,0xcc,0xcb,0xcb,0xbc,
+0xce,0xcc,0xcc,0xcb,0xab,0xab,0xaa,0xba,0xca,0xaa,0xaa,0xaa,0xcc,0xcb,0xaa,0x09,
+0x21,0x23,0x33,0x44,0x44,0x24,0x33,0x32,0x63,0x53,0x33,0x33,0x33,0x24,0x33,0x33,
+0x32,0x53,0x33,0x24,0x00,0xa9,0xa9,0x9a,0xdb,0xcd,0xcb,0x9a,0x98,0xb9,0xce,0xcc,
+0xba,0x9a,0xba,0xdb,0xba,0x89,0x21,0x44,0x22,0x12,0x12,0x22,0x34,0x34,0x43,0x34,
+0x46,0x54,0x43,0x33,0x33,0x22,0x32,0x33,0x43,0x12,0x12,0x42,0x53,0x23,0x01,0xa8,
+0xba,0xaa,0xdb,0xdc,0xcb,0xbb,0xbb,0xbc,0xcd,0xcb,0xbb,0xbb,0xab,0xcb,0xba,0xba,
+0xbb,0xbc,0xac,0xaa,0x00,0x31,0x33,0x44,0x44,0x43,0x33,0x23,0x22,0x45,0x35,0x34,
+0x33,0x22,0x33,0x35,0x32,0x90,0xeb,0xcb,0x9a,0x98,0xa8,0xca,0xbb,0xaa,0xcb,0xdf,
+0xcd,0xbc,0xbc,0xba,0xaa,0x99,0xa9,0xa9,0xab,0x9a,0x41,0x55,0x43,0x22,0x11,0x10,
+0x21,0x22,0x13,0x32,0x64,0x45,0x44,0x33,0x23,0x22,0x12,0x12,0x32,0x33,0x13,0xa0,
+0xdd,0xbc,0xac,0x9a,0x89,0x99,0xaa,0xbb,0xbb,0xcd,0xcc,0xbd,0xbc,0xac,0xab,0xaa,
+0xaa,0xab,0xaa,0xaa,0xca,0xdb,0xcb,0xab,0x89,0x10,0x22,0x32,0x53,0x44,0x43,0x33,
+0x43,0x43,0x35,0x34,0x33,0x24,0x33,0x33,0x24,0x12,0x00,0x10,0x00,0x80,0xaa,0xba,
+0xcb,0xcd,0xcd,0xbc,0xab,0xab,0xcb,0xcd,0xbc,0xcb,0xab,0xba,0xba,0xac,0xab,0xa9,
+0x98,0x80,0x10,0x21,0x53,0x53,0x53,0x43,0x53,0x53,0x53,0x34,0x34,0x33,0x23,0x33,
+0x43,0x23,0x23,0x22,0x34,0x45,0x33,0x11,0x90,0x9a,0x9a,0xba,0xdc,0xbc,0xbb,0x99,
+0xb9,0xdc,0xcc,0xcb,0xba,0xba,0xac,0xbb,0xab,0x8a,0x08,0x10,0x22,0x33,0x34,0x43,
+0x35,0x45,0x34,0x43,0x53,0x43,0x44,0x33,0x33,0x32,0x33,0x43,0x23,0x23,0x22,0x42,
+0x33,0x23,0x90,0xbc,0xbc,0xdb,0xcb,0xbd,0xbc,0xbc,0xbd,0xcc,0xbb,0xac,0xba,0xba,
+0xbb,0xbb,0xbb,0xba,0xbc,0xbc,0x9b,0x18,0x33,0x23,0x33,0x56,0x44,0x23,0x22,0x10,
+0x42,0x45,0x34,0x33,0x23,0x33,0x44,0x32,0x01,0x99,0xab,0x9a,0x99,0xca,0xdb,0xac,
+0xbb,0xbc,0xcd,0xdd,0xdb,0xcb,0xba,0xab,0xba,0xaa,0xbb,0xbb,0xba,0xba,0xcd,0xcb,
+0xab,0x89,0x11,0x33,0x32,0x44,0x44,0x34,0x32,0x33,0x44,0x35,0x34,0x33,0x23,0x43,
+0x33,0x33,0x32,0x32,0x34,0x34,0x22,0x98,0xb9,0xbb,0xeb,0xbc,0xbd,0xab,0x99,0xca,
+0xcd,0xbd,0xbb,0xab,0xbb,0xcc,0xbb,0x9a,0x28,0x43,0x34,0x22,0x22,0x22,0x34,0x34,
+0x34,0x44,0x54,0x44,0x53,0x33,0x33,0x23,0x33,0x33,0x34,0x22,0x21,0x31,0x35,0x34,
+0x12,0x98,0xb9,0xab,0xbc,0xcd,0xbc,0xbc,0xba,0xbc,0xbd,0xcc,0xba,0xab,0xab,0xac,
+0xab,0xab,0xbb,0xcb,0xcb,0xaa,0x08,0x21,0x33,0x43,0x45,0x53,0x23,0x23,0x21,0x52,
+0x45,0x43,0x33,0x32,0x22,0x24,0x33,0x01,0xca,0xbd,0xab,0x99,0xa9,0xca,0xac,0xab,
+0xbb,0xdf,0xcd,0xcc,0xcb,0xba,0xaa,0xa9,0x99,0x9a,0xab,0xaa,0x20,0x46,0x34,0x23,
+0x12,0x01,0x22,0x42,0x22,0x21,0x63,0x45,0x35,0x34,0x24,0x12,0x12,0x21,0x21,0x22,
+0x12,0x81,0xda,0xcc,0xbb,0xab,0x89,0x99,0xb9,0xbc,0xcb,0xcb,0xcc,0xbd,0xbd,0xbb,
+0xbb,0xab,0xbb,0xbb,0xac,0xaa,0xab,0xcc,0xdb,0xba,0x99,0x18,0x21,0x22,0x33,0x46,
+0x43,0x24,0x23,0x34,0x44,0x34,0x33,0x24,0x32,0x42,0x32,0x12,0x11,0x01,0x00,0x90,
+0xba,0xbb,0xac,0xdb,0xcd,0xbd,0xbb,0xba,0xcb,0xcd,0xbc,0xbc,0xaa,0xba,0xba,0xbc,
+0xba,0x9a,0x88,0x89,0x88,0x10,0x34,0x35,0x35,0x34,0x35,0x44,0x44,0x43,0x34,0x33,
+0x43,0x22,0x23,0x33,0x23,0x22,0x42,0x54,0x33,0x22,0x91,0x99,0xaa,0xa9,0xcc,0xbd,
+0xac,0x9a,0x98,0xca,0xcd,0xcb,0xab,0xbb,0xbb,0xbd,0xab,0x9a,0x08,0x18,0x10,0x11,
+0x32,0x44,0x34,0x54,0x43,0x43,0x43,0x34,0x35,0x34,0x33,0x24,0x22,0x32,0x32,0x22,
+0x22,0x43,0x43,0x22,0x90,0xbb,0xcb,0xaa,0xcc,0xcd,0xbc,0xcb,0xdb,0xcb,0xbc,0xcb,
+0xaa,0xab,0xba,0xbb,0xbb,0xba,0xcb,0xcb,0xab,0x09,0x31,0x33,0x32,0x45,0x35,0x25,
+0x13,0x11,0x32,0x46,0x34,0x33,0x33,0x42,0x33,0x34,0x02,0x80,0xa9,0x9a,0xaa,0xbb,
+0xcd,0xbb,0xbc,0xcc,0xdb,0xcc,0xcc,0xcc,0xbb,0xbb,0xab,0xab,0xbb,0xac,0xaa,0xaa,
+0xcb,0xbc,0xac,0x8a,0x10,0x22,0x22,0x34,0x36,0x44,0x32,0x32,0x43,0x54,0x33,0x24,
+0x23,0x33,0x24,0x33,0x22,0x22,0x34,0x34,0x12,0x98,0xaa,0x9a,0xaa,0xdd,0xbc,0xac,
+0x9a,0xa9,0xeb,0xcc,0xac,0xab,0xaa,0xca,0xca,0xaa,0x88,0x31,0x43,0x32,0x22,0x31,
+0x53,0x43,0x34,0x43,0x44,0x54,0x34,0x34,0x24,0x13,0x22,0x22,0x33,0x23,0x22,0x32,
+0x44,0x33,0x23,0x91,0xaa,0xac,0xac,0xcc,0xbc,0xbc,0xac,0xcb,0xcb,0xbc,0xcb,0xbb,
+0xcb,0xba,0xbb,0xaa,0xba,0xdb,0xab,0xab,0x09,0x21,0x32,0x42,0x54,0x34,0x25,0x13,
+0x22,0x42,0x35,0x35,0x24,0x12,0x22,0x33,0x24,0x02,0xc9,0xcb,0xaa,0x99,0x99,0xbb,
+0xbd,0xba,0xba,0xdf,0xcd,0xcc,0xac,0xbb,0xab,0xaa,0x9a,0xaa,0xba,0xbb,0x09,0x63,
+0x35,0x34,0x22,0x11,0x11,0x32,0x33,0x33,0x54,0x54,0x44,0x34,0x43,0x22,0x12,0x21,
+0x21,0x22,0x23,0x02,0xca,0xdc,0xbb,0xab,0x99,0x99,0xb9,0xcb,0xbb,0xbc,0xbe,0xbe,
+0xbd,0xbb,0xac,0xaa,0xba,0xba,0xba,0xab,0xaa,0xdb,0xbc,0xbc,0x9a,0x08,0x21,0x22,
+0x42,0x44,0x44,0x23,0x33,0x42,0x35,0x35,0x34,0x32,0x32,0x33,0x24,0x13,0x02,0x01,
+0x11,0x80,0xa9,0xcb,0xab,0xdb,0xdc,0xbc,0xbc,0xba,0xcb,0xdc,0xdb,0xab,0xab,0xba,
+0xbb,0xbc,0xbb,0x9a,0x8a,0x99,0x09,0x21,0x44,0x43,0x43,0x34,0x36,0x34,0x44,0x34,
+0x44,0x33,0x24,0x22,0x23,0x23,0x23,0x22,0x32,0x45,0x34,0x22,0x80,0x99,0xaa,0xa8,
+0xda,0xcc,0xac,0x9a,0x88,0xb9,0xce,0xbc,0xab,0xbb,0xca,0xbb,0xac,0x9a,0x08,0x00,
+0x01,0x11,0x31,0x34,0x34,0x35,0x35,0x35,0x34,0x44,0x53,0x33,0x43,0x23,0x32,0x23,
+0x33,0x23,0x33,0x43,0x43,0x22,0x81,0xa9,0xcb,0xca,0xcc,0xdb,0xbc,0xbb,0xcd,0xcb,
+0xcc,0xba,0xab,0xab,0xbb,0xcb,0xab,0xab,0xba,0xcb,0xac,0x99,0x20,0x22,0x32,0x53,
+0x45,0x43,0x23,0x12,0x22,0x44,0x35,0x34,0x32,0x33,0x43,0x33,0x23,0x81,0xa8,0xa9,
+0xba,0xcb,0xbc,0xcc,0xbb,0xcc,0xdb,0xcc,0xcc,0xbd,0xcb,0xbb,0xbb,0xaa,0xbb,0xbb,
+0xac,0xaa,0xba,0xcc,0xcb,0x99,0x08,0x22,0x22,0x33,0x36,0x36,0x33,0x33,0x53,0x53,
+0x34,0x33,0x34,0x32,0x24,0x23,0x13,0x22,0x42,0x33,0x23,0x91,0xaa,0xab,0xaa,0xdd,
+0xcd,0xbb,0xaa,0x99,0xda,0xcd,0xbc,0xba,0xba,0xca,0xbb,0xac,0x89,0x20,0x24,0x23,
+0x12,0x21,0x43,0x34,0x44,0x33,0x45,0x44,0x44,0x34,0x33,0x33,0x32,0x32,0x43,0x23,
+0x23,0x21,0x43,0x34,0x14,0x01,0x99,0xab,0xbb,0xcc,0xdc,0xbb,0xcb,0xab,0xcc,0xbc,
+0xbc,0xac,0xaa,0xab,0xab,0xcb,0xaa,0xba,0xbb,0xcb,0x8a,0x28,0x32,0x35,0x43,0x35,
+0x44,0x22,0x13,0x33,0x45,0x35,0x33,0x32,0x32,0x43,0x43,0x13,0xa0,0xcb,0xbb,0x9a,
+0x99,0xdb,0xbc,0xac,0x9a,0xcb,0xcf,0xcd,0xdb,0xba,0xbb,0xaa,0x9a,0xaa,0xaa,0xab,
+0x8b,0x31,0x47,0x33,0x33,0x12,0x21,0x32,0x34,0x33,0x53,0x45,0x35,0x45,0x32,0x23,
+0x22,0x22,0x22,0x32,0x33,0x12,0xb8,0xce,0xac,0xaa,0x99,0x98,0xaa,0xcb,0xab,0xbc,
+0xeb,0xcc,0xcc,0xbb,0xcb,0xaa,0xba,0xaa,0xab,0xab,0xab,0xdb,0xcb,0xcb,0x9a,0x09,
+0x21,0x21,0x32,0x44,0x35,0x44,0x22,0x32,0x54,0x43,0x24,0x23,0x32,0x32,0x34,0x32,
+0x11,0x01,0x00,0x10,0x88,0xba,0xbc,0xcb,0xcd,0xcc,0xcb,0xab,0xbb,0xcc,0xcc,0xac,
+0xbb,0xab,0xcb,0xba,0xbb,0x9a,0x99,0x9a,0x99,0x18,0x52,0x43,0x43,0x44,0x53,0x43,
+0x34,0x44,0x34,0x34,0x43,0x22,0x12,0x23,0x23,0x23,0x32,0x34,0x35,0x33,0x02,0x98,
+0xaa,0xba,0xeb,0xcc,0xcb,0x9a,0x99,0xa9,0xcd,0xbd,0xbb,0xbb,0xbc,0xcb,0xba,0xaa,
+0x89,0x08,0x00,0x11,0x33,0x34,0x43,0x54,0x53,0x43,0x24,0x34,0x34,0x35,0x43,0x32,
+0x22,0x32,0x24,0x23,0x12,0x21,0x33,0x24,0x02,0xa9,0xdb,0xba,0xca,0xcc,0xbc,0xcc,
+0xbb,0xcd,0xbc,0xcb,0xab,0xaa,0xba,0xcb,0xab,0xaa,0xaa,0xcb,0xcb,0x9a,0x18,0x23,
+0x33,0x42,0x44,0x35,0x43,0x12,0x21,0x53,0x35,0x34,0x33,0x32,0x43,0x33,0x23,0x02,
+0xa8,0xa9,0xaa,0xba,0xbc,0xbd,0xcb,0xbc,0xdc,0xcc,0xcc,0xcc,0xcb,0xba,0xab,0xbb,
+0xca,0xba,0xaa,0xaa,0xab,0xbd,0xcb,0xab,0x08,0x21,0x33,0x53,0x53,0x53,0x33,0x42,
+0x32,0x44,0x34,0x34,0x32,0x33,0x43,0x33,0x32,0x33,0x43,0x24,0x23,0x00,0x99,0xab,
+0xba,0xcd,0xcc,0xac,0x9b,0x00,0x21,0x12,0x00,0x80,0x11,0x80,0xc9,0xaa,0x72,0x56,
+0x53,0x22,0x02,0x00,0x88,0x01,0x01,0x88,0x89,0x61,0x46,0x34,0x23,0x11,0x80,0x80,
+0x00,0x98,0xaa,0x0a,0x62,0x35,0x33,0x02,0x80,0x88,0x88,0xa9,0xca,0xaa,0x10,0x53,
+0x34,0x23,0x02,0xb9,0xbd,0xab,0x08,0xa8,0xee,0xbd,0xad,0xaa,0x9a,0x99,0x99,0x9a,
+0xa9,0x98,0x9a,0xdd,0xdd,0xbd,0xbc,0xaa,0x88,0x80,0xa8,0x9b,0x09,0x81,0xfd,0xcf,
+0xcb,0xaa,0x88,0x80,0x98,0x99,0x20,0x22,0xe8,0xcf,0xbd,0xbb,0x9b,0x89,0x00,0x80,
+0x80,0x98,0x18,0x74,0x54,0x34,0x22,0x01,0x00,0x18,0x00,0x80,0x98,0x30,0x57,0x34,
+0x24,0x12,0x00,0x08,0x08,0x08,0x00,0x88,0xd9,0xce,0xbd,0xbb,0xaa,0x08,0x00,0x89,
+0x99,0x00,0x81,0xd9,0xbe,0xbc,0x9a,0x88,0x80,0x98,0x88,0x10,0x02,0xb8,0xdf,0xcb,
+0xaa,0x89,0x88,0x00,0x88,0x10,0x10,0x01,0xc8,0xdc,0xbb,0x8a,0x18,0x11,0x01,0x00,
+0x30,0x32,0xb0,0xff,0xac,0xab,0x8a,0x08,0x11,0x11,0x11,0x08,0x28,0x76,0x44,0x34,
+0x23,0x02,0x80,0x11,0x32,0x12,0x00,0x38,0x57,0x44,0x23,0x02,0x80,0x20,0x42,0x13,
+0xa0,0x9a,0x72,0x67,0x33,0x33,0x11,0x88,0x00,0x21,0x00,0x98,0x28,0x77,0x44,0x33,
+0x22,0x00,0x00,0x00,0x00,0x90,0x99,0x30,0x67,0x43,0x33,0x12,0x80,0x80,0x00,0x90,
+0x99,0x8a,0x73,0x45,0x24,0x13,0x81,0x80,0x08,0x88,0xa8,0xab,0x09,0x73,0x24,0x22,
+0x88,0x89,0x08,0x81,0xc9,0xcc,0x9a,0x30,0x45,0x22,0x11,0x00,0x10,0x80,0xc9,0xbc,
+0xbc,0xdb,0xdc,0xbc,0xbc,0x9b,0x8a,0x99,0xa9,0x9b,0x0a,0x88,0xfb,0xdd,0xbc,0xba,
+0x99,0x88,0x99,0xa9,0x88,0x11,0xc8,0xff,0xbc,0xad,0xaa,0x89,0x08,0x98,0x98,0x08,
+0x00,0xd9,0xcf,0xcc,0xba,0x99,0x00,0x80,0x88,0x89,0x10,0x82,0xfb,0xdf,0xbb,0x9c,
+0x89,0x00,0x08,0x89,0x08,0x10,0x80,0xeb,0xcc,0xab,0x89,0x08,0x08,0x89,0x00,0x32,
+0x23,0xa0,0xcd,0xbc,0xab,0x98,0x11,0x32,0x24,0x01,0x09,0x61,0x56,0x34,0x33,0x12,
+0x00,0x21,0x42,0x11,0x99,0x1a,0x76,0x54,0x33,0x23,0x11,0x08,0x00,0x12,0x00,0xa9,
+0x48,0x77,0x44,0x33,0x23,0x81,0x80,0x18,0x10,0x88,0x99,0x40,0x67,0x43,0x23,0x11,
+0x08,0x08,0x10,0x80,0xa9,0x8a,0x52,0x45,0x32,0x01,0x08,0x18,0x10,0x98,0xba,0x9c,
+0x18,0x44,0x33,0x22,0x10,0x80,0xa8,0xba,0xaa,0x99,0xec,0xce,0xbc,0xac,0xab,0xcb,
+0xcb,0xcb,0xab,0x99,0x80,0xa8,0xed,0xcc,0xac,0xaa,0x08,0x88,0xa8,0x9b,0x19,0x23,
+0xf9,0xff,0xbb,0xab,0x89,0x08,0x98,0x99,0x18,0x33,0xd1,0xef,0xcc,0xba,0xaa,0x88,
+0x08,0x80,0x80,0x98,0x08,0x62,0x46,0x34,0x24,0x11,0x08,0x08,0x10,0x01,0x98,0x09,
+0x73,0x54,0x33,0x33,0x01,0x00,0x88,0x08,0x11,0x01,0xd9,0xcf,0xbc,0xbc,0x9a,0x88,
+0x80,0x98,0x88,0x00,0x01,0xb9,0xcf,0xbb,0x9b,0x89,0x80,0x98,0x89,0x10,0x21,0x91,
+0xed,0xdb,0xbb,0xaa,0x88,0x10,0x00,0x00,0x08,0x21,0x02,0xc8,0xbf,0xac,0x8a,0x20,
+0x21,0x11,0x21,0x31,0x82,0xfc,0xcc,0xbb,0x9a,0x10,0x21,0x22,0x11,0x88,0x28,0x75,
+0x55,0x43,0x23,0x12,0x00,0x20,0x42,0x11,0x80,0x18,0x64,0x45,0x23,0x13,0x00,0x10,
+0x21,0x12,0x90,0x99,0x61,0x57,0x34,0x24,0x22,0x10,0x00,0x10,0x00,0x98,0x08,0x74,
+0x45,0x34,0x23,0x02,0x00,0x18,0x00,0x80,0x99,0x28,0x57,0x44,0x32,0x02,0x00,0x08,
+0x00,0x00,0x89,0x8a,0x51,0x55,0x43,0x22,0x02,0x80,0x08,0x88,0x98,0x99,0x09,0x52,
+0x54,0x23,0x02,0x90,0x99,0x9a,0xaa,0xca,0xaa,0x10,0x46,0x34,0x33,0x01,0x88,0xa9,
+0xca,0xbc,0xab,0xbb,0xdc,0xce,0xcc,0xab,0x9a,0x88,0x90,0xa9,0xbb,0x9a,0xb9,0xcf,
+0xbe,0xbc,0x9a,0x88,0x80,0x98,0x99,0x09,0xb9,0xff,0xcc,0xac,0xab,0x89,0x88,0x88,
+0x89,0x08,0x12,0xb0,0xff,0xbc,0xcb,0x99,0x89,0x90,0x88,0x09,0x31,0x02,0xfb,0xcf,
+0xac,0xab,0x89,0x80,0x80,0x89,0x08,0x11,0x91,0xeb,0xbd,0xbb,0x9a,0x08,0x88,0x08,
+0x18,0x22,0x01,0xd9,0xbc,0xbc,0x9a,0x99,0x00,0x21,0x43,0x11,0x99,0x30,0x77,0x36,
+0x33,0x13,0x10,0x10,0x32,0x24,0x01,0x99,0x61,0x56,0x35,0x33,0x22,0x00,0x10,0x10,
+0x01,0x88,0x18,0x67,0x45,0x34,0x23,0x01,0x00,0x00,0x01,0x81,0x99,0x28,0x57,0x35,
+0x24,0x12,0x00,0x08,0x00,0x00,0x99,0x89,0x41,0x45,0x23,0x12,0x00,0x08,0x10,0x98,
+0xb9,0x8a,0x38,0x34,0x25,0x32,0x53,0x22,0x91,0xcb,0xac,0x89,0x88,0xfb,0xcc,0xbc,
+0xab,0xaa,0xa9,0xaa,0xba,0xba,0x99,0xc9,0xdf,0xdd,0xcb,0xaa,0x89,0x00,0x88,0xaa,
+0x89,0x10,0xf9,0xdf,0xcc,0xaa,0x89,0x00,0x88,0xa9,0x88,0x32,0x02,0xee,0xbe,0xbc,
+0xbb,0x9a,0x88,0x80,0x00,0x88,0x89,0x30,0x77,0x53,0x33,0x22,0x00,0x80,0x01,0x01,
+0x98,0x09,0x62,0x46,0x43,0x22,0x02,0x00,0x80,0x00,0x00,0x81,0xb9,0xdf,0xcc,0xcb,
+0x9a,0x88,0x80,0x88,0x89,0x18,0x10,0x98,0xcd,0xbc,0xaa,0x09,0x08,0x88,0x9a,0x08,
+0x22,0x02,0xfa,0xcc,0xcb,0x9a,0x99,0x08,0x00,0x00,0x01,0x01,0xa8,0xcb,0xbd,0xac,
+0x89,0x01,0x11,0x00,0x11,0x32,0x23,0xe9,0xce,0xbc,0xaa,0x89,0x10,0x21,0x01,0x10,
+0x31,0x47,0x45,0x34,0x34,0x22,0x12,0x12,0x01,0x81,0x89,0x30,0x56,0x54,0x32,0x12,
+0x01,0x10,0x20,0x21,0x01,0x99,0x50,0x57,0x45,0x43,0x12,0x01,0x08,0x00,0x11,0x80,
+0x88,0x72,0x55,0x34,0x23,0x02,0x80,0x00,0x10,0x80,0x99,0x19,0x74,0x45,0x23,0x13,
+0x80,0x80,0x08,0x00,0x89,0x89,0x51,0x45,0x25,0x23,0x01,0x00,0x08,0x08,0x80,0x99,
+0x9a,0x09,0x63,0x44,0x33,0x01,0xa8,0xaa,0x89,0x10,0x00,0x89,0x40,0x57,0x34,0x24,
+0x01,0x99,0xaa,0xaa,0xaa,0xcc,0xeb,0xcb,0xcb,0xbb,0xab,0x9a,0x9a,0xab,0xab,0xbb,
+0xcc,0xce,0xbd,0xbc,0x9b,0x89,0x88,0xa9,0xb9,0x88,0x02,0xfb,0xff,0xbb,0xab,0x9a,
+0x80,0x98,0xaa,0x9a,0x21,0x03,0xfc,0xcf,0xbb,0xaa,0x89,0x88,0x98,0x89,0x10,0x23,
+0xe8,0xdf,0xdb,0xaa,0x9a,0x88,0x80,0x88,0x08,0x01,0x01,0xda,0xcd,0xab,0x9b,0x88,
+0x80,0x80,0x08,0x12,0x23,0xa1,0xdc,0xbc,0xbb,0xa9,0x88,0x21,0x43,0x24,0x02,0x08,
+0x61,0x46,0x35,0x23,0x12,0x10,0x10,0x21,0x00,0x98,0x61,0x66,0x34,0x24,0x13,0x10,
+0x08,0x01,0x01,0x90,0x18,0x65,0x46,0x53,0x22,0x11,0x00,0x00,0x00,0x08,0x99,0x18,
+0x65,0x44,0x24,0x12,0x01,0x08,0x08,0x00,0x98,0x99,0x18,0x45,0x24,0x13,0x01,0x80,
+0x00,0x01,0x89,0xba,0x99,0x30,0x44,0x43,0x43,0x12,0x80,0xaa,0xab,0x8a,0xb9,0xee,
+0xdc,0xcb,0xba,0xbb,0xaa,0x99,0x88,0x88,0x99,0xdb,0xed,0xcd,0xbc,0xac,0x09,0x18,
+0x88,0xaa,0x9a,0x32,0x03,0xff,0xcd,0xbb,0x9b,0x88,0x80,0xa9,0x8a,0x31,0x14,0xfa,
+0xcf,0xcb,0xab,0x9a,0x88,0x08,0x00,0x88,0x88,0x28,0x75,0x44,0x24,0x13,0x81,0x80,
+0x10,0x01,0x80,0x98,0x41,0x65,0x43,0x23,0x12,0x01,0x08,0x08,0x00,0x00,0xa0,0xed,
+0xcd,0xcb,0xaa,0x88,0x08,0x88,0x99,0x88,0x11,0x80,0xeb,0xbc,0xac,0x89,0x88,0x89,
+0x89,0x18,0x21,0x01,0xdb,0xcd,0xcb,0xaa,0x99,0x88,0x08,0x00,0x11,0x01,0x80,0xc9,
+0xbc,0xbc,0x99,0x00,0x00,0x88,0x20,0x63,0x12,0xd8,0xdd,0xbb,0xaa,0x89,0x18,0x21,
+0x32,0x11,0x08,0x60,0x57,0x44,0x33,0x21,0x11,0x52,0x44,0x32,0x01,0x88,0x18,0x52,
+0x34,0x22,0x01,0x10,0x31,0x24,0x02,0x99,0x0a,0x74,0x46,0x34,0x32,0x11,0x08,0x88,
+0x80,0x00,0x88,0x52,0x56,0x44,0x33,0x21,0x80,0x88,0x00,0x01,0x98,0x89,0x63,0x46,
+0x24,0x13,0x81,0x80,0x10,0x01,0x80,0xba,0x09,0x64,0x45,0x23,0x12,0x81,0x00,0x00,
+0x88,0xaa,0xaa,0x28,0x54,0x34,0x32,0x12,0x80,0xa9,0xad,0xab,0x19,0x32,0x24,0x43,
+0x43,0x25,0x13,0xa8,0xcc,0x9b,0x08,0x81,0xfa,0xdd,0xbb,0xac,0xaa,0x99,0x99,0x89,
+0x88,0x90,0xb9,0xcf,0xcd,0xbb,0x9c,0x99,0x00,0x88,0xb9,0x9a,0x09,0xd9,0xdf,0xcc,
+0xac,0x99,0x08,0x08,0xa9,0x99,0x10,0x12,0xfa,0xce,0xbc,0xaa,0x09,0x00,0x98,0x99,
+0x00,0x22,0xb0,0xff,0xbd,0xbb,0xaa,0x88,0x08,0x88,0x80,0x01,0x12,0x90,0xec,0xbc,
+0xac,0x9a,0x89,0x08,0x80,0x00,0x21,0x12,0x90,0xfb,0xdb,0xaa,0x99,0x10,0x22,0x22,
+0x01,0x80,0x31,0x77,0x35,0x43,0x12,0x01,0x10,0x21,0x22,0x01,0x10,0x75,0x45,0x34,
+0x23,0x01,0x80,0x18,0x11,0x10,0x88,0x61,0x66,0x53,0x33,0x12,0x00,0x08,0x10,0x11,
+0x88,0x9a,0x40,0x67,0x24,0x23,0x02,0x88,0x08,0x10,0x00,0x98,0x8a,0x41,0x36,0x24,
+0x12,0x80,0x88,0x08,0x88,0xa9,0x9a,0x28,0x53,0x43,0x12,0x01,0x88,0x88,0x00,0xa0,
+0xfb,0xcc,0xbc,0xbd,0xbc,0xbc,0xac,0x89,0x00,0x01,0x99,0xca,0xcb,0xdd,0xcc,0xcb,
+0xaa,0x88,0x88,0xa8,0xab,0x18,0x01,0xfd,0xcf,0xbb,0xbb,0x88,0x88,0x99,0x9a,0x20,
+0x24,0xd8,0xef,0xbc,0xbb,0x9a,0x89,0x80,0x08,0x98,0x98,0x18,0x74,0x45,0x24,0x23,
+0x11,0x80,0x10,0x01,0x80,0x99,0x38,0x66,0x44,0x32,0x21,0x00,0x00,0x80,0x80,0x80,
+0x80,0xda,0xce,0xbd,0xbb,0xaa,0x08,0x80,0x98,0x89,0x00,0x01,0xea,0xdc,0xab,0x9a,
+0x88,0x88,0x98,0x08,0x10,0x11,0xc8,0xcc,0xad,0xbb,0x9b,0x8a,0x08,0x00,0x01,0x00,
+0x12,0x02,0xfa,0xdc,0x9b,0x09,0x31,0x23,0x80,0x9a,0x28,0x23,0xe8,0xcf,0xbb,0x8a,
+0x18,0x21,0x11,0x32,0x45,0x43,0x33,0x54,0x34,0x34,0x23,0x00,0x88,0x11,0x22,0x22,
+0x11,0x73,0x45,0x43,0x13,0x02,0x01,0x22,0x22,0x80,0x89,0x75,0x46,0x44,0x22,0x01,
+0x80,0x08,0x00,0x11,0x88,0x10,0x65,0x45,0x33,0x14,0x81,0x00,0x10,0x11,0x80,0x99,
+0x30,0x57,0x34,0x33,0x11,0x08,0x08,0x01,0x90,0xaa,0x1a,0x74,0x34,0x24,0x22,0x21,
+0x11,0x00,0xa9,0x8a,0x30,0xb2,0xff,0xff,0xbf,0xbb,0xbc,0xba,0xaa,0x99,0x08,0x22,
+0x45,0x44,0x34,0x43,0x33,0x33,0x33,0x12,0x11,0x98,0xdb,0xdc,0xcb,0xbc,0xac,0xbb,
+0xab,0xab,0x99,0x08,0x21,0x54,0x53,0x43,0x43,0x43,0x32,0x22,0x11,0x01,0x98,0xba,
+0xce,0xbc,0xbd,0xca,0xaa,0xaa,0xaa,0x99,0x08,0x21,0x53,0x43,0x44,0x43,0x33,0x24,
+0x22,0x12,0x01,0x88,0xba,0xce,0xcc,0xcb,0xcb,0xba,0xaa,0xaa,0x99,0x08,0x21,0x34,
+0x35,0x44,0x43,0x33,0x24,0x23,0x21,0x01,0x88,0xba,0xcd,0xcc,0xbc,0xcb,0xbb,0xbb,
+0xaa,0x8a,0x08,0x21,0x45,0x63,0x43,0x43,0x33,0x32,0x23,0x13,0x01,0x90,0xca,0xdb,
+0xbc,0xcc,0xcb,0xbb,0xbb,0xab,0x9a,0x08,0x31,0x54,0x35,0x45,0x33,0x24,0x23,0x13,
+0x22,0x10,0x88,0xba,0xcc,0xdb,0xcb,0xbb,0xbd,0xab,0xab,0x9a,0x08,0x21,0x44,0x45,
+0x53,0x33,0x34,0x32,0x33,0x12,0x02,0x98,0xca,0xcc,0xbc,0xcc,0xbb,0xbc,0xba,0xba,
+0x99,0x88,0x21,0x34,0x45,0x34,0x53,0x33,0x33,0x33,0x22,0x12,0x88,0xca,0xcd,0xcc,
+0xcb,0xac,0xbb,0xbb,0xab,0xaa,0x09,0x21,0x44,0x34,0x44,0x32,0x34,0x24,0x23,0x12,
+0x01,0x88,0xa9,0xcd,0xdd,0xcb,0xcb,0xba,0xaa,0x9b,0x9a,0x08,0x10,0x43,0x54,0x34,
+0x35,0x43,0x22,0x22,0x11,0x11,0x80,0xb9,0xcb,0xbc,0xbc,0xbb,0xcc,0xbb,0xbb,0xaa,
+0x88,0x31,0x54,0x34,0x43,0x43,0x33,0x34,0x33,0x33,0x01,0x90,0xca,0xcd,0xcc,0xcc,
+0xbb,0xac,0xba,0xaa,0x99,0x89,0x20,0x43,0x44,0x34,0x53,0x32,0x24,0x23,0x22,0x01,
+0x80,0xb9,0xdc,0xbc,0xbd,0xbc,0xac,0xab,0xaa,0x9a,0x09,0x20,0x53,0x44,0x43,0x43,
+0x33,0x43,0x32,0x12,0x11,0x80,0xaa,0xdc,0xcb,0xcc,0xca,0xba,0xbb,0xab,0x9a,0x09,
+0x20,0x63,0x53,0x34,0x44,0x32,0x33,0x23,0x13,0x12,0x80,0xa9,0xbd,0xbe,0xbc,0xbc,
+0xcb,0xba,0xab,0x9a,0x89,0x11,0x53,0x44,0x44,0x43,0x24,0x23,0x23,0x12,0x11,0x80,
+0xa9,0xdb,0xbd,0xdb,0xbb,0xcb,0xbb,0xab,0x9b,0x89,0x20,0x53,0x44,0x44,0x34,0x43,
+0x33,0x22,0x22,0x01,0x81,0xa9,0xcc,0xcc,0xbc,0xcb,0xbb,0xac,0xab,0x9a,0x89,0x10,
+0x32,0x46,0x53,0x43,0x43,0x32,0x32,0x21,0x11,0x80,0xa9,0xeb,0xbc,0xbd,0xbc,0xbc,
+0xba,0xab,0x9a,0x89,0x10,0x42,0x44,0x34,0x44,0x33,0x33,0x33,0x23,0x11,0x00,0xb9,
+0xdc,0xbd,0xcd,0xbb,0xbc,0xab,0xab,0xaa,0x89,0x00,0x42,0x44,0x44,0x43,0x32,0x33,
+0x32,0x32,0x11,0x80,0xb9,0xdc,0xdc,0xcb,0xbc,0xbc,0xbb,0xab,0xaa,0x89,0x10,0x32,
+0x36,0x45,0x33,0x43,0x33,0x23,0x23,0x12,0x01,0xa9,0xdc,0xcc,0xbc,0xbc,0xbc,0xca,
+0xaa,0xa9,0x89,0x10,0x41,0x53,0x53,0x33,0x25,0x33,0x33,0x22,0x11,0x81,0xa8,0xdb,
+0xdc,0xcb,0xbb,0xbc,0xbb,0xbb,0xba,0x99,0x20,0x53,0x54,0x43,0x34,0x44,0x32,0x23,
+0x22,0x11,0x00,0x98,0xcb,0xcd,0xcb,0xbb,0xcb,0xba,0xbb,0xba,0x99,0x10,0x53,0x44,
+0x34,0x35,0x34,0x43,0x22,0x22,0x12,0x00,0x99,0xdb,0xcc,0xcb,0xac,0xcb,0xaa,0xab,
+0x9a,0x99,0x00,0x32,0x54,0x44,0x33,0x34,0x24,0x23,0x23,0x11,0x00,0x99,0xdb,0xcc,
+0xcc,0xbb,0xad,0xbb,0xbb,0xaa,0x89,0x18,0x31,0x45,0x44,0x43,0x23,0x33,0x23,0x33,
+0x12,0x81,0xa9,0xcd,0xdb,0xcc,0xbc,0xcc,0xba,0xab,0xaa,0x89,0x18,0x21,0x44,0x53,
+0x43,0x34,0x34,0x33,0x23,0x11,0x00,0x90,0xba,0xdd,0xcb,0xcb,0xaa,0xaa,0xaa,0xab,
+0x99,0x19,0x42,0x45,0x44,0x43,0x33,0x22,0x22,0x22,0x22,0x01,0xb8,0xcd,0xcc,0xcc,
+0xbb,0xbd,0xbb,0xbb,0xaa,0x99,0x08,0x21,0x45,0x44,0x43,0x33,0x24,0x23,0x13,0x22,
+0x10,0xa8,0xda,0xdc,0xcb,0xbc,0xcb,0xba,0xbb,0xaa,0x9a,0x08,0x32,0x45,0x35,0x34,
+0x24,0x33,0x33,0x23,0x13,0x01,0x98,0xdb,0xdc,0xdb,0xbb,0xbc,0xbb,0xbb,0xab,0x9a,
+0x08,0x42,0x45,0x53,0x43,0x43,0x33,0x33,0x23,0x12,0x11,0x98,0xcb,0xcd,0xcc,0xbb,
+0xbc,0xba,0xbb,0xaa,0x9a,0x08,0x32,0x46,0x44,0x43,0x33,0x25,0x33,0x22,0x22,0x10,
+0x98,0xb9,0xbe,0xcd,0xbb,0xbc,0xab,0xab,0xba,0x9a,0x08,0x41,0x54,0x43,0x34,0x34,
+0x34,0x23,0x23,0x12,0x01,0x90,0xba,0xce,0xbc,0xcc,0xbb,0xbb,0xbb,0xab,0x9a,0x88,
+0x32,0x45,0x44,0x34,0x34,0x24,0x33,0x22,0x22,0x00,0x90,0xba,0xce,0xdb,0xcb,0xac,
+0xbb,0xba,0xab,0xa9,0x08,0x20,0x44,0x44,0x34,0x34,0x43,0x23,0x22,0x12,0x10,0x98,
+0xca,0xcc,0xcc,0xcb,0xbb,0xbc,0xcb,0xaa,0x99,0x08,0x20,0x43,0x44,0x34,0x34,0x43,
+0x22,0x22,0x11,0x10,0x88,0xca,0xcc,0xbc,0xbd,0xdb,0xca,0xaa,0xaa,0x9a,0x08,0x20,
+0x42,0x44,0x53,0x33,0x43,0x22,0x22,0x21,0x10,0x88,0xca,0xcc,0xbc,0xbd,0xcb,0xcb,
+0xba,0xaa,0x99,0x88,0x21,0x43,0x45,0x34,0x34,0x33,0x24,0x23,0x22,0x10,0x88,0xaa,
+0xcd,0xdb,0xbc,0xcb,0xbb,0xba,0xaa,0x9a,0x88,0x22,0x45,0x44,0x43,0x43,0x43,0x33,
+0x33,0x32,0x11,0x88,0xb9,0xdc,0xcc,0xcb,0xcb,0xba,0xaa,0xaa,0x99,0x08,0x21,0x63,
+0x44,0x43,0x43,0x33,0x34,0x23,0x23,0x01,0x80,0xba,0xcd,0xcc,0xcb,0xcb,0xba,0xbb,
+0xba,0xa9,0x88,0x21,0x53,0x44,0x44,0x33,0x34,0x33,0x32,0x22,0x11,0x88,0xca,0xdc,
+0xcb,0xbc,0xbc,0xbc,0xbb,0xba,0xaa,0x89,0x11,0x34,0x45,0x34,0x34,0x34,0x32,0x12,
+0x11,0x01,0x88,0xb9,0xbe,0xcd,0xbb,0xad,0xac,0xac,0xba,0x9a,0x99,0x10,0x32,0x35,
+0x35,0x34,0x34,0x43,0x32,0x33,0x12,0x80,0xa9,0xdb,0xbc,0xbd,0xcc,0xaa,0x9b,0x9a,
+0x98,0x00,0x20,0x53,0x44,0x53,0x43,0x33,0x23,0x22,0x01,0x00,0x98,0xc9,0xcc,0xbd,
+0xbc,0xbc,0xac,0xbb,0xbb,0xab,0x89,0x10,0x43,0x45,0x53,0x43,0x33,0x33,0x33,0x22,
+0x11,0x88,0xca,0xcc,0xcc,0xdb,0xbb,0xcb,0xbb,0xba,0xaa,0x89,0x11,0x34,0x45,0x34,
+0x44,0x32,0x33,0x23,0x22,0x11,0x80,0xb9,0xdc,0xcc,0xbc,0xcb,0xcb,0xba,0xaa,0x99,
+0x88,0x10,0x43,0x54,0x43,0x34,0x33,0x34,0x32,0x32,0x11,0x80,0xa9,0xcc,0xcc,0xbc,
+0xbc,0xbc,0xab,0xaa,0x9a,0x88,0x11,0x43,0x45,0x53,0x33,0x34,0x24,0x23,0x23,0x21,
+0x00,0xa8,0xeb,0xdb,0xdb,0xbb,0xcb,0xab,0xba,0x99,0x88,0x11,0x52,0x53,0x44,0x33,
+0x34,0x43,0x32,0x22,0x11,0x81,0x99,0xdb,0xcc,0xbc,0xcc,0xba,0xab,0xab,0x9a,0x99,
+0x10,0x43,0x35,0x45,0x33,0x34,0x43,0x22,0x22,0x11,0x81,0x99,0xcc,0xcc,0xcb,0xbc,
+0xbb,0xcb,0xba,0xaa,0x89,0x18,0x42,0x44,0x53,0x43,0x43,0x23,0x23,0x12,0x11,0x80,
+0x99,0xcc,0xcc,0xbc,0xcc,0xba,0xab,0xbb,0xba,0x99,0x18,0x32,0x46,0x53,0x43,0x43,
+0x23,0x23,0x22,0x10,0x88,0xa9,0xcc,0xcc,0xdb,0xbb,0xbc,0xac,0xab,0xab,0x99,0x08,
+0x31,0x45,0x53,0x43,0x43,0x33,0x23,0x22,0x01,0x88,0xa8,0xdb,0xdc,0xcb,0xbc,0xbb,
+0xbc,0xba,0xaa,0x99,0x18,0x42,0x44,0x34,0x44,0x33,0x43,0x23,0x13,0x12,0x81,0x98,
+0xcb,0xdc,0xdb,0xbb,0xad,0xbb,0xaa,0x9a,0x88,0x10,0x43,0x44,0x53,0x43,0x43,0x23,
+0x33,0x33,0x32,0x01,0xa0,0xda,0xcc,0xbc,0xbd,0xbb,0xbc,0xaa,0x8a,0x09,0x11,0x42,
+0x53,0x44,0x43,0x43,0x23,0x33,0x23,0x22,0x01,0x98,0xbc,0xbe,0xbd,0xbc,0xbc,0xbb,
+0xab,0xaa,0x99,0x10,0x32,0x36,0x35,0x35,0x43,0x43,0x22,0x22,0x01,0x00,0x99,0xcb,
+0xcc,0xcc,0xcb,0xbb,0xbb,0xac,0xaa,0x8a,0x88,0x22,0x44,0x44,0x43,0x43,0x33,0x33,
+0x23,0x12,0x88,0xa9,0xcc,0xcc,0xcc,0xcb,0xbb,0xbb,0xac,0xab,0xab,0x89,0x21,0x44,
+0x44,0x34,0x34,0x33,0x43,0x32,0x22,0x12,0x80,0xb9,0xce,0xcb,0xbc,0xbc,0xbb,0xbb,
+0xaa,0x09,0x20,0x42,0x35,0x44,0x34,0x34,0x43,0x22,0x13,0x11,0x88,0xb9,0xcb,0xbd,
+0xcc,0xbc,0xcb,0xab,0xbb,0xaa,0x9a,0x89,0x21,0x45,0x34,0x35,0x43,0x43,0x32,0x22,
+0x11,0x81,0x98,0xca,0xcc,0xcc,0xcb,0xbb,0xbb,0xac,0xaa,0x9a,0x08,0x22,0x44,0x44,
+0x34,0x43,0x24,0x23,0x22,0x12,0x00,0x98,0xca,0xbc,0xbe,0xbc,0xbc,0xbb,0xbb,0xab,
+0x99,0x08,0x42,0x44,0x34,0x35,0x43,0x24,0x23,0x22,0x12,0x01,0x80,0xba,0xdd,0xcb,
+0xbc,0xbc,0xbb,0xbb,0xab,0x8a,0x18,0x31,0x55,0x43,0x44,0x33,0x24,0x33,0x32,0x12,
+0x12,0x80,0xc9,0xcc,0xcc,0xcb,0xcb,0xab,0xbb,0xab,0x99,0x00,0x32,0x45,0x53,0x34,
+0x53,0x32,0x33,0x22,0x22,0x01,0x80,0xb9,0xce,0xbc,0xbd,0xbb,0xbc,0xab,0xab,0x9a,
+0x08,0x21,0x54,0x53,0x34,0x53,0x32,0x23,0x23,0x22,0x01,0x90,0xc9,0xdc,0xcb,0xbc,
+0xbc,0xbb,0xbb,0xbb,0xaa,0x08,0x20,0x54,0x34,0x35,0x25,0x33,0x33,0x33,0x22,0x01,
+0x90,0xcb,0xdc,0xbc,0xbd,0xcb,0xba,0xbb,0xba,0x9a,0x89,0x20,0x63,0x34,0x35,0x44,
+0x32,0x33,0x32,0x12,0x01,0x98,0xcb,0xdc,0xcb,0xbc,0xbc,0xbb,0xbb,0xbb,0xaa,0x8a,
+0x10,0x53,0x45,0x34,0x44,0x32,0x33,0x32,0x12,0x01,0x90,0xcb,0xcc,0xbc,0xbd,0xbc,
+0xbb,0xac,0xaa,0x9a,0x88,0x20,0x43,0x45,0x53,0x33,0x43,0x33,0x23,0x22,0x12,0x88,
+0xb9,0xcd,0xcc,0xbc,0xbc,0xbb,0xcb,0xaa,0x99,0x88,0x21,0x44,0x53,0x34,0x43,0x24,
+0x23,0x23,0x22,0x11,0x00,0x99,0xdc,0xdb,0xbc,0xac,0xac,0xba,0xaa,0x99,0x09,0x31,
+0x53,0x44,0x34,0x43,0x24,0x23,0x23,0x22,0x11,0x80,0xa9,0xdc,0xcc,0xcb,0xcb,0xbb,
+0xbb,0xba,0xaa,0x88,0x21,0x44,0x44,0x34,0x34,0x24,0x33,0x33,0x13,0x02,0x80,0xba,
+0xce,0xdb,0xcb,0xac,0xbb,0xcb,0xaa,0x99,0x89,0x10,0x33,0x45,0x44,0x43,0x33,0x33,
+0x33,0x23,0x02,0x90,0xdb,0xcc,0xdb,0xcb,0xcb,0xbb,0xbb,0xba,0xaa,0xa9,0x08,0x32,
+0x56,0x43,0x34,0x24,0x33,0x23,0x22,0x11,0x01,0x88,0xda,0xcc,0xbd,0xbc,0xbb,0xac,
+0xab,0x9a,0x09,0x31,0x35,0x45,0x33,0x44,0x32,0x33,0x33,0x22,0x02,0x98,0xda,0xcc,
+0xdb,0xcb,0xbb,0xbc,0xab,0xab,0xaa,0x89,0x09,0x88,0x00,0x08,0x88,0x80,0x10,0x10,
+0x01,0x01,0x00,0x80,0x98,0x08,0x41,0x44,0x34,0x12,0x11,0x20,0x42,0x33,0x43,0x22,
+0x33,0x13,0x01,0x08,0x63,0x36,0x34,0x22,0x22,0x33,0x24,0x91,0xca,0x8a,0x63,0x35,
+0x22,0x21,0x62,0x54,0x23,0x13,0x01,0x00,0x10,0x80,0x99,0x19,0x55,0x35,0x23,0x80,
+0x98,0x31,0x37,0x35,0x22,0x22,0x33,0x45,0x24,0x24,0x33,0x33,0x24,0x23,0x13,0x11,
+0x33,0x57,0x34,0x34,0x22,0x01,0x10,0x43,0x34,0x13,0x80,0x08,0x63,0x45,0x24,0x12,
+0x10,0x10,0x22,0x22,0x11,0x21,0x73,0x43,0x42,0x21,0x21,0x21,0x32,0x32,0x43,0x34,
+0x33,0x33,0x43,0x54,0x33,0x22,0x80,0x08,0x32,0x37,0x22,0x90,0x00,0x52,0x35,0x24,
+0x23,0x43,0x33,0x22,0x80,0x9a,0x89,0x12,0x11,0x9a,0x99,0x11,0x92,0xc9,0x76,0x56,
+0x23,0x81,0xbc,0xad,0x19,0x41,0x22,0x80,0x18,0x52,0x43,0x91,0xea,0xab,0x09,0x21,
+0x12,0xa9,0xaa,0x29,0x53,0x81,0xec,0xbd,0xac,0xaa,0x98,0x89,0x88,0x18,0x41,0x13,
+0xf9,0xcf,0xcc,0xaa,0x8a,0x80,0x81,0x00,0x20,0x34,0x23,0xc8,0xbf,0xac,0x89,0x10,
+0x81,0x98,0x08,0x44,0x34,0x01,0xcb,0xac,0x09,0x31,0x23,0x02,0x08,0x33,0x27,0x34,
+0x43,0x34,0x23,0x03,0x80,0x20,0x73,0x33,0x11,0x88,0x51,0x47,0x34,0x33,0x23,0x22,
+0x12,0x02,0x88,0x09,0x74,0x45,0x43,0x33,0x22,0x32,0x22,0x12,0x80,0x09,0x28,0x65,
+0x44,0x53,0x23,0x23,0x11,0x80,0x98,0x88,0x11,0x42,0x43,0x42,0x33,0x43,0x32,0x13,
+0x81,0xa8,0x8a,0x28,0x13,0xb3,0xfa,0x09,0x74,0x44,0x22,0x98,0xcb,0xbb,0x99,0x80,
+0xb9,0xdc,0xca,0xa9,0x08,0x10,0x21,0x00,0xb9,0xdc,0xeb,0xcb,0xbc,0xac,0xbb,0xa9,
+0xa9,0x89,0x10,0x04,0xf1,0xed,0xbc,0xad,0x99,0x88,0x80,0x08,0x18,0x21,0xa0,0xee,
+0xcd,0xcb,0xaa,0x9a,0x89,0x88,0x80,0x80,0x08,0x51,0x55,0x44,0x33,0x23,0x01,0x01,
+0x11,0x00,0x98,0x8a,0x73,0x55,0x43,0x22,0x01,0x80,0x88,0x00,0x21,0x12,0xa8,0xdf,
+0xbc,0xbc,0x9a,0x88,0x80,0x98,0xa9,0x88,0x01,0x90,0xfb,0xcb,0xab,0x99,0x99,0x9a,
+0x09,0x61,0x42,0x81,0xb9,0xbd,0x9b,0x89,0x88,0x89,0x09,0x11,0x04,0xa0,0xcd,0xbc,
+0xaa,0x88,0x08,0x18,0x21,0x08,0xba,0xab,0x60,0x44,0x91,0xde,0xbc,0x0a,0x51,0x43,
+0x01,0x98,0xaa,0x10,0x44,0x24,0x24,0x24,0x22,0x81,0xb9,0x9a,0x42,0x36,0x14,0x81,
+0x08,0x41,0x63,0x12,0x81,0xa9,0x89,0x30,0x55,0x43,0x43,0x12,0x11,0x88,0x88,0x90,
+0x90,0x08,0x60,0x73,0x43,0x33,0x33,0x44,0x32,0x21,0x90,0xb9,0x88,0x43,0x46,0x43,
+0x33,0x23,0x02,0xa8,0x99,0x18,0x33,0x90,0xbd,0x1c,0x73,0x35,0x14,0x00,0x88,0x18,
+0x90,0xeb,0xcc,0xaa,0x08,0x12,0x82,0xa9,0x89,0x20,0x12,0xa0,0xbb,0x18,0x24,0x83,
+0x8e,0x2d,0x49,0x01,0xd0,0xa8,0x21,0x25,0xd1,0xed,0xbb,0xab,0x28,0x31,0x08,0xba,
+0x8a,0x23,0x07,0xc0,0xdd,0xbb,0x9a,0x18,0x12,0x91,0xba,0x99,0x25,0x04,0xf8,0xbc,
+0xac,0x89,0x81,0xc8,0xdc,0xba,0x08,0x32,0x12,0xdb,0xbd,0xab,0x08,0x00,0x88,0x88,
+0x32,0x02,0xef,0xbe,0xad,0xaa,0x88,0x00,0x88,0x98,0x00,0x12,0x91,0xfb,0xbc,0xaa,
+0x80,0x21,0x80,0x99,0x88,0x01,0x03,0x99,0xab,0x40,0x70,0x09,0x8c,0x1a,0x32,0x04,
+0xea,0xbb,0x51,0x47,0x33,0x01,0x80,0x11,0x37,0x43,0x00,0x89,0x48,0x45,0x34,0x12,
+0x98,0x09,0x52,0x43,0x81,0xca,0xac,0x28,0x46,0x43,0x12,0x81,0x80,0x08,0x08,0x98,
+0x08,0x31,0x45,0x43,0x33,0x34,0x43,0x33,0x11,0x88,0x8a,0x08,0x01,0x81,0xa8,0x90,
+0x01,0x02,0xa8,0x99,0x29,0x03,0x91,0x1c,0x4b,0x20,0x91,0xbb,0x2c,0x78,0x01,0xb9,
+0xbb,0x41,0x36,0xa2,0xff,0xbc,0xab,0x09,0x11,0x01,0x09,0x1a,0x88,0xfb,0xde,0xcb,
+0xab,0x09,0x08,0x80,0x89,0x10,0x23,0xc0,0xff,0xbc,0xbb,0x8a,0x08,0x08,0x88,0x09,
+0x00,0xc8,0xdf,0xcd,0xba,0x9b,0x89,0x08,0x80,0x89,0x08,0x50,0x44,0x44,0x33,0x32,
+0x22,0x11,0x02,0x81,0xa9,0x9a,0x73,0x55,0x34,0x32,0x12,0x01,0x08,0x89,0x88,0x18,
+0x12,0xd9,0xef,0xdb,0xab,0x9a,0x89,0x00,0x00,0x18,0x10,0xa8,0xec,0xcb,0x9b,0x09,
+0x10,0x10,0x08,0x88,0xa9,0xdc,0xbb,0xaa,0x90,0xc0,0xdc,0xcb,0x89,0x11,0x03,0xa0,
+0xb9,0x29,0x41,0x82,0xba,0x9b,0x61,0x31,0xaa,0xac,0x21,0x36,0xb8,0xff,0xbb,0x9a,
+0x20,0x22,0x89,0x9c,0x1a,0x63,0x35,0x23,0x01,0xa0,0x99,0x00,0x22,0x80,0xdb,0x89,
+0x74,0x35,0x33,0x82,0xb9,0x99,0x21,0x23,0x99,0x9e,0x2a,0x64,0x44,0x43,0x23,0x23,
+0x02,0xa9,0x9b,0x30,0x37,0x26,0x23,0x33,0x44,0x33,0x13,0x80,0x98,0x80,0x81,0xb8,
+0x18,0x76,0x53,0x12,0x80,0x9a,0x09,0x31,0x02,0xca,0x8c,0x58,0x54,0x23,0x11,0x88,
+0x88,0x08,0x88,0x88,0x12,0x12,0xea,0xcb,0x31,0x77,0x23,0x90,0xdb,0xab,0x08,0x82,
+0xfa,0xcf,0xbc,0xab,0x9a,0x89,0x80,0x80,0x08,0x00,0x08,0x88,0x08,0x80,0x81,0x88,
+0x88,0x29,0x39,0x08,0xa9,0x09,0x50,0x49,0x2b,0x1d,0x2a,0x30,0x19,0xbb,0xba,0x23,
+0x23,0x90,0x0e,0x2a,0x83,0xa4,0xa9,0xab,0x33,0x07,0xb0,0xca,0x28,0x64,0x82,0xfc,
+0xbd,0xbb,0x0a,0x21,0x02,0xa8,0xab,0x30,0x44,0x91,0xcf,0xbc,0x9c,0x09,0x20,0x00,
+0x09,0x8a,0x00,0x11,0x80,0xb8,0xb0,0x03,0x32,0x1a,0x8c,0x2a,0x22,0x13,0x1b,0x9d,
+0x81,0x04,0xa2,0xc0,0x1a,0x5a,0x12,0xa0,0xac,0x3b,0x73,0x12,0xaa,0xaf,0x39,0x66,
+0x34,0x33,0x01,0x9a,0x99,0x10,0x21,0x91,0xb9,0xb8,0x85,0x03,0xb1,0xb9,0x19,0x14,
+0x94,0xb0,0x8c,0x49,0x22,0x91,0xbb,0x0d,0x11,0x85,0xb1,0xba,0x19,0x44,0x11,0xac,
+0x8c,0x58,0x33,0xb1,0xbf,0x1c,0x64,0x45,0x22,0x01,0x89,0x99,0x10,0x11,0x88,0x9a,
+0x80,0x22,0x91,0xf0,0xa0,0x13,0x13,0xd9,0xad,0x59,0x65,0x43,0x22,0x90,0xa8,0x88,
+0x10,0x21,0x89,0xaa,0x90,0x13,0x13,0xc8,0xba,0x20,0x72,0x20,0xbb,0xba,0x13,0x27,
+0x00,0xbc,0x9b,0x71,0x43,0x98,0xcf,0xbc,0xac,0x98,0x10,0x10,0x00,0x90,0x99,0x9b,
+0x30,0x77,0x43,0x23,0x01,0xa8,0xa9,0x10,0x21,0x01,0xa9,0xba,0x10,0x15,0x03,0x9b,
+0x8f,0x3a,0x62,0x11,0xeb,0xdd,0xbb,0x9b,0x08,0x12,0x01,0xb8,0xa8,0x28,0x12,0xa3,
+0xaa,0xab,0x04,0x15,0x09,0x8e,0x88,0x83,0x94,0xb0,0x8b,0x39,0x15,0xb2,0xd9,0x09,
+0x41,0x21,0xba,0xbd,0x11,0x34,0xb3,0xfa,0x8b,0x70,0x42,0x9a,0xcf,0xbc,0xaa,0x00,
+0x20,0x00,0x99,0x89,0x10,0x82,0xb2,0x98,0x3b,0x38,0x32,0x0b,0x0c,0x39,0x21,0xb3,
+0xc1,0x91,0x21,0x11,0x00,0x0b,0x90,0x03,0x11,0x1b,0x1a,0x91,0xb3,0xb5,0xe3,0xa2,
+0x02,0x29,0x3b,0x1f,0x19,0x00,0x80,0x09,0x19,0x10,0x30,0x2b,0x2c,0x2a,0x01,0xb3,
+0xb2,0x00,0x39,0x4b,0x0a,0x99,0x29,0x3b,0x10,0xb0,0xd3,0xa3,0x22,0x2c,0x9a,0xa1,
+0x93,0x93,0x09,0x1b,0x91,0x93,0x01,0xa9,0x09,0x31,0x39,0x0b,0xb9,0x92,0x13,0x10,
+0x1b,0x3d,0x3a,0x91,0x99,0xab,0x20,0x32,0x19,0xab,0x2c,0x30,0x84,0xc0,0xab,0x59,
+0x33,0xc3,0xfa,0x9b,0x74,0x36,0x14,0x82,0x98,0x99,0x10,0x11,0x90,0xa9,0x88,0x23,
+0x03,0xeb,0x9a,0x71,0x22,0xd0,0xed,0xca,0x89,0x08,0x11,0x80,0x99,0x88,0x01,0x11,
+0x89,0x99,0x00,0x03,0x91,0xb9,0x9b,0x22,0x32,0x0b,0xbb,0xb3,0x95,0x92,0x99,0x0a,
+0x11,0x13,0x90,0x9a,0x99,0x93,0xb5,0x91,0x99,0x93,0xa5,0xb2,0xc1,0x91,0x13,0x12,
+0x9a,0xb9,0x93,0x13,0x90,0xd0,0xa2,0x03,0x11,0x9a,0x1b,0x10,0x93,0xc4,0x91,0x3a,
+0x5b,0x00,0xa9,0xb9,0x93,0x05,0xa1,0x0b,0x3c,0x60,0x81,0xd9,0xa9,0x32,0x27,0xc0,
+0xdf,0xac,0x9b,0x10,0x11,0x91,0xa9,0x8a,0x52,0x22,0xd9,0xce,0xbb,0x8a,0x18,0x11,
+0x08,0x99,0x88,0x01,0x92,0xb1,0x90,0x3a,0x39,0x92,0xb9,0x1a,0x39,0x49,0x1a,0x0b,
+0x1b,0x31,0x29,0xa9,0x99,0x19,0x11,0x93,0x99,0x0b,0x11,0x12,0x09,0xb9,0x01,0x39,
+0x10,0xb1,0xb1,0x92,0x31,0x3a,0xc9,0xc2,0x03,0x38,0xa9,0xc1,0x92,0x22,0x11,0x99,
+0x2d,0x5b,0x3a,0x09,0xaa,0x90,0x13,0x04,0xb8,0xda,0x01,0x32,0x91,0xf9,0xa0,0x21,
+0x32,0x9a,0xbd,0x1a,0x54,0x83,0xf8,0xbb,0x30,0x77,0x33,0x13,0x01,0x99,0x99,0x00,
+0x21,0x38,0x1b,0x0c,0x0a,0x31,0x33,0xf1,0xea,0x98,0x44,0x37,0x24,0x02,0x98,0xa8,
+0x00,0x11,0x00,0x0a,0x8a,0x01,0x93,0xb2,0xd8,0xa2,0x94,0xa2,0xc1,0x18,0x39,0x39,
+0x1c,0x9a,0x94,0x93,0xb9,0xab,0x22,0x15,0xa8,0x8e,0x4b,0x62,0x01,0xfc,0xcc,0xab,
+0x0a,0x20,0x01,0x90,0xa9,0x18,0x30,0x00,0x9a,0x9b,0x93,0x07,0xa1,0x99,0x09,0x13,
+0x12,0xba,0xd1,0x93,0x83,0xb2,0xb9,0xb1,0x95,0x02,0x1b,0x9a,0x92,0x32,0x4c,0x2d,
+0x2b,0x39,0x19,0x1a,0x99,0x01,0x02,0x00,0x1b,0x3b,0x20,0x00,0xb9,0xb2,0xa4,0x92,
+0x09,0x2b,0x4b,0x4b,0x09,0x1a,0x3b,0x39,0x10,0x2b,0x2c,0x4a,0x28,0x1b,0x1c,0x99,
+0x95,0x92,0xa8,0x9a,0x21,0x23,0x1a,0x0d,0x09,0x13,0x13,0xbb,0x0f,0x30,0x12,0xa8,
+0x9f,0x08,0x26,0x03,0xed,0xbd,0xac,0x89,0x10,0x11,0x98,0x99,0x00,0x30,0x19,0xa9,
+0x09,0x59,0x39,0x0b,0xaa,0x12,0x23,0xb1,0xd1,0xb2,0x94,0x92,0xb0,0x1a,0x39,0x31,
+0x1a,0x1c,0x3a,0x21,0xb3,0xb1,0x0b,0x12,0x13,0xb1,0xc9,0x11,0x31,0xb3,0xba,0x9a,
+0x33,0x23,0xba,0xbb,0x39,0x53,0x90,0xba,0xa9,0x53,0x31,0x1c,0x8d,0x29,0x23,0x91,
+0xbc,0x0b,0x53,0x23,0xe0,0xaa,0x49,0x60,0x18,0xab,0x9b,0x42,0x05,0xc1,0xca,0x80,
+0x25,0x83,0xfa,0x9a,0x40,0x55,0x33,0x11,0x00,0x88,0x98,0x90,0x08,0x31,0x11,0xaa,
+0x9f,0x39,0x44,0x80,0x9e,0x0b,0x53,0x05,0xe9,0xbc,0x9a,0x43,0x24,0xa8,0xcc,0x09,
+0x53,0x12,0xc9,0x9d,0x28,0x44,0x91,0xdb,0x2a,0x77,0x47,0x24,0x23,0x23,0x43,0x33,
+0x35,0x32,0x22,0x21,0x23,0x12,0x00,0xba,0xcc,0xbc,0xcc,0xcc,0xcb,0xbb,0xbc,0xac,
+0xba,0xaa,0xba,0x9a,0x99,0x00,0x42,0x53,0x42,0x43,0x34,0x35,0x43,0x33,0x22,0x23,
+0x22,0x12,0x80,0xa8,0xbc,0xcc,0xcc,0xdb,0xbc,0xcb,0xcb,0xab,0xbb,0xab,0xbb,0xaa,
+0x8a,0x08,0x32,0x45,0x34,0x35,0x44,0x34,0x43,0x23,0x33,0x33,0x32,0x23,0x01,0xa8,
+0xcb,0xcd,0xcb,0xcc,0xcb,0xbc,0xcb,0xbb,0xab,0xbb,0xba,0xba,0xa9,0x00,0x42,0x44,
+0x53,0x43,0x44,0x43,0x33,0x34,0x32,0x32,0x23,0x22,0x01,0xa8,0xca,0xbc,0xcd,0xdb,
+0xcb,0xcb,0xac,0xbb,0xbb,0xbb,0xbb,0xaa,0x9a,0x19,0x41,0x53,0x34,0x44,0x34,0x35,
+0x43,0x33,0x33,0x23,0x33,0x22,0x11,0x90,0xbb,0xbe,0xbd,0xcc,0xcc,0xbb,0xad,0xbb,
+0xab,0xbb,0xab,0xbb,0x99,0x18,0x32,0x54,0x43,0x44,0x34,0x44,0x33,0x33,0x24,0x23,
+0x22,0x22,0x01,0x88,0xb9,0xdc,0xcb,0xcc,0xdb,0xbb,0xbc,0xcb,0xba,0xab,0xab,0xab,
+0xaa,0x08,0x21,0x54,0x43,0x34,0x35,0x44,0x33,0x43,0x23,0x23,0x32,0x21,0x02,0x80,
+0xaa,0xcc,0xbc,0xbd,0xbd,0xcc,0xbb,0xbc,0xba,0xbb,0xba,0xbb,0xa9,0x18,0x31,0x44,
+0x44,0x43,0x44,0x43,0x24,0x33,0x33,0x23,0x23,0x23,0x11,0x81,0xba,0xdc,0xdb,0xcb,
+0xcc,0xcb,0xac,0xbb,0xbb,0xbb,0xac,0xaa,0x9a,0x08,0x21,0x53,0x43,0x44,0x34,0x34,
+0x34,0x24,0x33,0x23,0x23,0x22,0x12,0x00,0xa9,0xcc,0xdb,0xdb,0xcb,0xbc,0xad,0xcb,
+0xaa,0xba,0xaa,0xaa,0xaa,0x08,0x30,0x53,0x43,0x34,0x35,0x35,0x34,0x33,0x43,0x22,
+0x23,0x22,0x12,0x00,0xa9,0xbc,0xcc,0xcc,0xcb,0xbc,0xad,0xcb,0xaa,0xba,0xaa,0xaa,
+0x9a,0x09,0x21,0x43,0x44,0x53,0x53,0x43,0x43,0x32,0x33,0x33,0x33,0x23,0x22,0x01,
+0xa8,0xcc,0xdb,0xbc,0xcc,0xbc,0xcc,0xba,0xbb,0xbb,0xbb,0xba,0xab,0x89,0x20,0x44,
+0x53,0x34,0x44,0x43,0x34,0x33,0x24,0x33,0x32,0x22,0x21,0x00,0x99,0xca,0xbc,0xcd,
+0xbc,0xcc,0xcb,0xbb,0xbb,0xac,0xba,0xba,0x9a,0x89,0x20,0x43,0x44,0x43,0x44,0x43,
+0x34,0x43,0x32,0x23,0x23,0x22,0x12,0x01,0x99,0xba,0xbd,0xcd,0xcc,0xcb,0xcb,0xac,
+0xab,0xbb,0xba,0xbb,0xaa,0x99,0x10,0x53,0x34,0x44,0x53,0x43,0x34,0x33,0x34,0x32,
+0x32,0x22,0x22,0x00,0x98,0xba,0xdc,0xdb,0xbc,0xcc,0xac,0xac,0xbb,0xab,0xbb,0xab,
+0xab,0x89,0x18,0x43,0x44,0x53,0x43,0x44,0x33,0x25,0x33,0x32,0x23,0x23,0x22,0x01,
+0x98,0xca,0xbc,0xcc,0xcc,0xdb,0xcb,0xbb,0xcb,0xba,0xaa,0xab,0xab,0x9a,0x00,0x43,
+0x53,0x53,0x43,0x44,0x43,0x33,0x24,0x23,0x23,0x22,0x22,0x01,0x80,0xaa,0xcc,0xdb,
+0xbc,0xbd,0xcc,0xbb,0xbc,0xba,0xba,0xba,0xab,0x9a,0x18,0x32,0x45,0x53,0x43,0x34,
+0x35,0x43,0x33,0x32,0x23,0x32,0x22,0x02,0x80,0xba,0xcd,0xcb,0xcc,0xdb,0xcb,0xbc,
+0xbb,0xbb,0xba,0xbb,0xba,0x9a,0x08,0x42,0x34,0x45,0x43,0x34,0x44,0x33,0x43,0x23,
+0x23,0x32,0x22,0x21,0x80,0xb9,0xcc,0xdb,0xcb,0xcc,0xbc,0xbc,0xbb,0xac,0xab,0xba,
+0xaa,0xaa,0x08,0x31,0x44,0x34,0x35,0x44,0x43,0x24,0x33,0x33,0x33,0x32,0x32,0x21,
+0x80,0xa9,0xcc,0xcc,0xcb,0xcc,0xbc,0xbc,0xcb,0xaa,0xab,0xab,0xaa,0xaa,0x88,0x31,
+0x44,0x53,0x34,0x44,0x43,0x24,0x33,0x33,0x33,0x23,0x23,0x12,0x01,0xa9,0xcc,0xdb,
+0xbc,0xbd,0xbd,0xbc,0xbb,0xac,0xab,0xab,0xbb,0x9a,0x89,0x22,0x54,0x33,0x45,0x43,
+0x53,0x33,0x34,0x32,0x33,0x32,0x32,0x11,0x81,0xa8,0xcb,0xbd,0xdc,0xcb,0xcc,0xbb,
+0xbc,0xab,0xbb,0xbb,0xab,0xab,0x88,0x31,0x44,0x34,0x35,0x44,0x34,0x34,0x33,0x24,
+0x33,0x22,0x23,0x11,0x00,0x99,0xbb,0xbe,0xbd,0xbd,0xcc,0xcb,0xca,0xaa,0xab,0xab,
+0xaa,0xaa,0x89,0x10,0x43,0x44,0x53,0x43,0x34,0x35,0x33,0x43,0x22,0x22,0x22,0x11,
+0x01,0x98,0xba,0xbd,0xcd,0xcb,0xcc,0xcb,0xbb,0xac,0xab,0xba,0xaa,0x9a,0x99,0x11,
+0x42,0x44,0x43,0x44,0x34,0x34,0x43,0x32,0x32,0x22,0x23,0x22,0x00,0x98,0xca,0xdb,
+0xbc,0xcd,0xcb,0xbc,0xcb,0xab,0xbb,0xab,0xab,0xaa,0x8a,0x18,0x43,0x35,0x35,0x34,
+0x35,0x44,0x32,0x24,0x22,0x22,0x22,0x21,0x10,0x98,0xaa,0xcc,0xdb,0xbc,0xbd,0xbc,
+0xbc,0xbb,0xcb,0xaa,0xba,0xa9,0x99,0x18,0x42,0x53,0x34,0x34,0x35,0x34,0x34,0x43,
+0x22,0x22,0x21,0x22,0x01,0x88,0xaa,0xcc,0xdb,0xbc,0xbd,0xbc,0xbc,0xbb,0xbb,0xac,
+0xba,0x9a,0x8a,0x10,0x32,0x35,0x35,0x44,0x34,0x34,0x34,0x33,0x33,0x33,0x33,0x22,
+0x12,0x88,0xba,0xcd,0xbc,0xcd,0xcb,0xbc,0xbc,0xbb,0xac,0xba,0xaa,0xab,0x99,0x10,
+0x22,0x35,0x44,0x53,0x34,0x34,0x34,0x33,0x43,0x22,0x22,0x22,0x11,0x80,0xa9,0xcc,
+0xbc,0xbd,0xbc,0xbd,0xbc,0xcb,0xaa,0xab,0xba,0xaa,0x9a,0x00,0x32,0x44,0x34,0x35,
+0x44,0x34,0x43,0x32,0x33,0x33,0x32,0x22,0x12,0x80,0xb9,0xeb,0xbc,0xbd,0xcc,0xbc,
+0xbc,0xcb,0xba,0xba,0xba,0xba,0xa9,0x08,0x31,0x63,0x43,0x44,0x53,0x43,0x33,0x24,
+0x33,0x23,0x33,0x22,0x11,0x80,0xa8,0xdb,0xeb,0xcb,0xcc,0xdb,0xca,0xaa,0xab,0xbb,
+0xba,0xaa,0xaa,0x08,0x21,0x44,0x34,0x35,0x44,0x43,0x24,0x43,0x22,0x23,0x21,0x12,
+0x11,0x81,0xa8,0xcb,0xcc,0xbc,0xcc,0xbc,0xbc,0xcb,0xba,0xba,0xba,0xba,0x9a,0x89,
+0x21,0x34,0x35,0x45,0x43,0x34,0x34,0x33,0x24,0x23,0x23,0x23,0x21,0x00,0x99,0xdb,
+0xdb,0xcb,0xcc,0xdb,0xbb,0xbc,0xbb,0xba,0xbb,0xab,0xab,0x89,0x21,0x44,0x34,0x35,
+0x44,0x34,0x34,0x43,0x23,0x23,0x23,0x22,0x12,0x01,0xa8,0xca,0xdc,0xcb,0xdb,0xbc,
+0xdb,0xba,0xbb,0xbb,0xbb,0xbb,0x9b,0x89,0x31,0x44,0x34,0x34,0x45,0x43,0x34,0x24,
+0x33,0x32,0x32,0x32,0x12,0x11,0xa8,0xca,0xbc,0xcd,0xdb,0xcb,0xbc,0xcb,0xab,0xbb,
+0xab,0xbb,0xab,0x89,0x11,0x53,0x53,0x53,0x53,0x43,0x43,0x43,0x32,0x22,0x23,0x22,
+0x22,0x01,0x98,0xca,0xdb,0xdb,0xdb,0xdb,0xbb,0xbc,0xbb,0xbb,0xbb,0xcb,0xaa,0x89,
+0x10,0x33,0x36,0x44,0x43,0x34,0x44,0x32,0x24,0x22,0x22,0x12,0x12,0x01,0x90,0xb9,
+0xcc,0xbc,0xbd,0xcc,0xbc,0xcb,0xbb,0xab,0xbb,0xbb,0xab,0x99,0x10,0x43,0x44,0x53,
+0x53,0x43,0x34,0x24,0x33,0x23,0x23,0x23,0x23,0x11,0x98,0xca,0xdb,0xbc,0xdc,0xcb,
+0xdb,0xba,0xcb,0xaa,0xab,0xba,0x9a,0x8a,0x00,0x32,0x45,0x43,0x34,0x35,0x34,0x34,
+0x33,0x24,0x22,0x22,0x22,0x01,0x90,0xba,0xcc,0xdb,0xcb,0xcc,0xcb,0xac,0xbb,0xbb,
+0xac,0xaa,0xaa,0x8a,0x08,0x22,0x44,0x34,0x44,0x53,0x33,0x25,0x33,0x33,0x33,0x33,
+0x22,0x12,0x80,0xb9,0xbd,0xcd,0xdb,0xdb,0xbb,0xad,0xcb,0xaa,0xaa,0xab,0x9a,0x9a,
+0x08,0x31,0x44,0x34,0x44,0x53,0x43,0x33,0x24,0x33,0x32,0x22,0x23,0x11,0x80,0xaa,
+0xbd,0xcc,0xdb,0xbc,0xbd,0xcb,0xbb,0xbb,0xbb,0xbb,0xab,0xaa,0x18,0x31,0x45,0x53,
+0x53,0x43,0x34,0x34,0x43,0x32,0x32,0x22,0x22,0x02,0x81,0x99,0xdb,0xdb,0xbc,0xbd,
+0xcc,0xbb,0xac,0xbb,0xbb,0xbb,0xba,0xaa,0x08,0x31,0x35,0x35,0x44,0x34,0x44,0x33,
+0x34,0x23,0x33,0x32,0x22,0x12,0x01,0xa8,0xbc,0xbe,0xcc,0xdb,0xcb,0xcb,0xbb,0xac,
+0xba,0xaa,0xaa,0x9a,0x88,0x21,0x34,0x35,0x44,0x34,0x44,0x33,0x34,0x32,0x23,0x33,
+0x32,0x21,0x80,0xa8,0xda,0xdb,0xbc,0xcd,0xcb,0xac,0xac,0xba,0xaa,0xab,0xab,0xaa,
+0x89,0x21,0x43,0x35,0x44,0x53,0x43,0x24,0x24,0x32,0x22,0x23,0x22,0x12,0x81,0x98,
+0xcb,0xdb,0xbc,0xbd,0xbd,0xbc,0xcb,0xbb,0xba,0xbb,0xba,0xaa,0x89,0x20,0x44,0x53,
+0x43,0x34,0x35,0x34,0x43,0x33,0x32,0x23,0x32,0x21,0x01,0xa8,0xca,0xcc,0xdb,0xbc,
+0xcc,0xcb,0xcb,0xba,0xba,0xab,0xab,0xab,0x89,0x20,0x43,0x34,0x35,0x35,0x44,0x34,
+0x33,0x43,0x32,0x22,0x23,0x12,0x01,0x98,0xba,0xbd,0xcd,0xdb,0xdb,0xbb,0xbc,0xbb,
+0xbb,0xcb,0xba,0x9a,0x89,0x10,0x42,0x34,0x44,0x53,0x53,0x43,0x42,0x22,0x22,0x22,
+0x22,0x12,0x01,0x90,0xba,0xcc,0xbc,0xcd,0xcb,0xbc,0xcb,0xab,0xbb,0xbb,0xab,0xab,
+0x9a,0x00,0x43,0x44,0x34,0x35,0x44,0x43,0x43,0x32,0x32,0x32,0x32,0x22,0x11,0x88,
+0xba,0xbd,0xcd,0xcb,0xcc,0xcb,0xbb,0xac,0xbb,0xba,0xab,0xab,0x9a,0x00,0x33,0x36,
+0x44,0x34,0x34,0x35,0x34,0x32,0x33,0x33,0x32,0x23,0x11,0x80,0xca,0xdb,0xdb,0xcb,
+0xbd,0xbc,0xad,0xbb,0xba,0xab,0xbb,0xba,0x99,0x18,0x42,0x53,0x53,0x43,0x44,0x43,
+0x33,0x34,0x32,0x32,0x32,0x23,0x11,0x80,0xb9,0xcc,0xbc,0xcd,0xcb,0xcc,0xbb,0xbb,
+0xac,0xab,0xba,0xba,0xa9,0x18,0x31,0x35,0x44,0x53,0x53,0x43,0x43,0x32,0x23,0x23,
+0x33,0x22,0x12,0x80,0xb9,0xcc,0xdb,0xcc,0xdb,0xbb,0xad,0xcb,0xaa,0xaa,0xab,0xaa,
+0x9a,0x08,0x21,0x44,0x53,0x43,0x34,0x35,0x43,0x33,0x33,0x33,0x23,0x33,0x12,0x81,
+0xa9,0xbd,0xcc,0xcc,0xdb,0xcb,0xbc,0xbb,0xbb,0xcb,0xba,0xba,0x9a,0x08,0x21,0x53,
+0x53,0x53,0x43,0x34,0x34,0x24,0x23,0x33,0x22,0x23,0x11,0x00,0x99,0xdb,0xdb,0xbc,
+0xbd,0xcc,0xbb,0xbc,0xbb,0xca,0xaa,0xaa,0x9a,0x88,0x11,0x43,0x44,0x34,0x44,0x43,
+0x34,0x33,0x33,0x33,0x33,0x33,0x22,0x01,0xa9,0xcc,0xcc,0xdb,0xcb,0xbc,0xcc,0xbb,
+0xbb,0xbb,0xbb,0xbb,0xaa,0x89,0x21,0x44,0x34,0x35,0x44,0x34,0x34,0x43,0x23,0x23,
+0x33,0x22,0x22,0x81,0xa8,0xca,0xcc,0xbc,0xbd,0xbd,0xbc,0xcb,0xba,0xbb,0xbb,0xba,
+0xaa,0x89,0x21,0x34,0x35,0x35,0x44,0x34,0x34,0x43,0x23,0x23,0x23,0x23,0x12,0x81,
+0x98,0xda,0xdb,0xcb,0xbc,0xbd,0xbc,0xbc,0xbb,0xac,0xaa,0xaa,0xaa,0x89,0x10,0x43,
+0x34,0x35,0x34,0x35,0x35,0x33,0x43,0x22,0x23,0x23,0x22,0x01,0x98,0xa9,0xaa,0x99,
+0x99,0x98,0x98,0x98,0x98,0x9a,0xaa,0xaa,0xa9,0xdb,0xeb,0xbb,0xbb,0x9b,0xaa,0xca,
+0xcb,0xab,0xac,0xba,0xcb,0xac,0x9c,0xab,0xcb,0xbb,0xbc,0xbb,0xdb,0xca,0xab,0xac,
+0xba,0xbc,0xcb,0xbb,0xbb,0xcc,0xcb,0xbb,0x9a,0x08,0x80,0xea,0xcc,0xcb,0x9a,0xa9,
+0xcb,0xbc,0xac,0x89,0x10,0x98,0xea,0xcb,0xab,0xba,0xca,0xdb,0xba,0xbb,0xca,0xda,
+0xba,0xbb,0xbb,0xdb,0xdb,0xcb,0x9a,0x08,0x80,0xa9,0xbd,0xad,0xbb,0xbb,0xad,0xab,
+0x09,0x00,0xb8,0xdf,0xbb,0x9b,0x09,0x10,0xb9,0xbe,0xac,0x08,0x10,0xa9,0xcf,0xcb,
+0x8a,0x18,0x80,0xb9,0xbd,0x9b,0x18,0x81,0xeb,0xbd,0x8a,0x20,0x33,0xb0,0xce,0xba,
+0x88,0x81,0xb9,0xbe,0x9b,0x09,0x88,0xeb,0xbc,0x8a,0x08,0xa0,0xec,0xbb,0x8a,0x32,
+0x23,0xd8,0xec,0xaa,0x09,0x00,0x02,0x90,0xcb,0xcc,0xab,0x8a,0x11,0x04,0xb1,0xdd,
+0xac,0x9a,0x20,0x21,0x80,0xcc,0xad,0xaa,0x88,0x18,0x18,0x00,0x01,0xa8,0xcf,0xcc,
+0xaa,0x19,0x20,0x11,0x99,0x9a,0x19,0x33,0x91,0xf9,0x98,0x22,0x12,0xb8,0x9e,0x38,
+0x25,0xd1,0xcf,0xbc,0x99,0x21,0x13,0x98,0xaf,0xbb,0x8a,0x89,0x88,0x00,0x22,0x03,
+0xfa,0xbd,0xad,0x9a,0x80,0x00,0x10,0x11,0x80,0xdc,0xcd,0xab,0x8a,0x08,0x10,0x10,
+0x11,0xa8,0xce,0xbe,0xbb,0x99,0x11,0x21,0x88,0xa9,0xa0,0x10,0x21,0x23,0xc4,0xfc,
+0xbf,0xbb,0x8a,0x21,0x12,0xb0,0xca,0x10,0x34,0xa3,0xfd,0xbc,0xaa,0x08,0x01,0x81,
+0x88,0x09,0x18,0x89,0x00,0x23,0xa4,0xfe,0xbd,0xac,0x89,0x11,0x12,0x99,0xaa,0x10,
+0x23,0x92,0xbc,0x9a,0x35,0x15,0xfa,0xcd,0xab,0x89,0x01,0x03,0xa8,0x9a,0x29,0x53,
+0x82,0xec,0xbd,0xab,0x0a,0x20,0x10,0x98,0x99,0x18,0x22,0x90,0xdb,0x19,0x63,0x22,
+0xfb,0xce,0xbb,0x99,0x00,0x12,0x91,0x99,0x0a,0x30,0x30,0x0a,0x0d,0x0a,0x22,0x93,
+0xd0,0x9a,0x39,0x52,0x01,0xbb,0xbb,0x79,0x40,0x09,0xab,0x1d,0x68,0x22,0xc0,0xed,
+0xcb,0xab,0x08,0x10,0x01,0x90,0x99,0x08,0x11,0x81,0xa0,0x99,0x39,0x32,0xb3,0xf3,
+0x80,0x18,0x10,0x80,0x0b,0x2b,0x3a,0x49,0x3b,0x0d,0x98,0x92,0x93,0xb2,0xb9,0x91,
+0x31,0x21,0xb0,0xc9,0xa2,0x86,0x11,0x0b,0x2e,0x3a,0x30,0x90,0xfb,0xb0,0x05,0x22,
+0xaa,0xae,0x2a,0x75,0x25,0x33,0x01,0x98,0x99,0x08,0x02,0x82,0x88,0x9b,0x19,0x32,
+0x51,0x0b,0x9e,0x19,0x70,0x41,0xaa,0xdf,0xcb,0x9a,0x08,0x11,0x81,0x98,0x89,0x29,
+0x30,0x29,0x0c,0x1b,0x49,0x28,0x99,0x9a,0x3a,0x51,0x08,0x99,0x2b,0x5b,0x18,0x90,
+0x1b,0x3b,0x5a,0x19,0xc0,0xb2,0xa2,0xa4,0xc4,0xa1,0x20,0x5a,0x19,0x1a,0x1b,0x3a,
+0x11,0xb1,0xa1,0x01,0x93,0xb3,0xb1,0x19,0x39,0x01,0xc1,0xc3,0x11,0x30,0x99,0x9b,
+0x2a,0x30,0x92,0xb0,0x9b,0x31,0x32,0x2a,0x0f,0x1a,0x22,0x11,0x9d,0x0d,0x58,0x33,
+0xd0,0xdf,0xcb,0x9a,0x19,0x11,0x81,0x99,0x89,0x20,0x11,0x88,0x0c,0x1a,0x31,0x01,
+0xd9,0x99,0x11,0x84,0xb2,0xbb,0x2b,0x51,0x18,0x9a,0x9b,0x92,0x96,0xb2,0x89,0x5b,
+0x59,0x29,0x8b,0x8a,0x11,0x85,0xc2,0xb0,0xa1,0x86,0xb3,0xd2,0xa0,0x02,0x13,0x91,
+0x9d,0x3b,0x78,0x10,0xc8,0xc0,0x02,0x23,0x90,0xbc,0x0b,0x73,0x23,0xbb,0xbf,0x5a,
+0x74,0x33,0x23,0x80,0x89,0x0a,0x00,0x82,0xa1,0x90,0x88,0x10,0x18,0x99,0x90,0x90,
+0x09,0x11,0x12,0x99,0x9b,0x3a,0x60,0x19,0x9b,0x1b,0x71,0x30,0xbb,0x9f,0x60,0x46,
+0x43,0x01,0xa8,0xa9,0x11,0x33,0xa0,0xbd,0x1b,0x65,0x43,0x02,0x90,0x10,0x35,0x24,
+0xa1,0xcc,0xbb,0x08,0x22,0x82,0xb8,0xa9,0x11,0x23,0x90,0xbb,0x1a,0x62,0x20,0x9b,
+0xbb,0x12,0x06,0xb2,0xc9,0x00,0x12,0x03,0xc9,0x09,0x49,0x10,0xb9,0xab,0x31,0x13,
+0xb1,0x9c,0x11,0x17,0xb1,0xcc,0x2a,0x67,0x44,0x22,0x80,0xa8,0x98,0x11,0x02,0x98,
+0xa9,0x80,0x23,0x01,0xba,0x1b,0x7a,0x20,0xa8,0xc8,0x01,0x31,0x91,0xe9,0xa0,0x12,
+0x02,0xb2,0x9b,0x3e,0x49,0x29,0x8b,0x0b,0x91,0x97,0xb3,0xa0,0x29,0x69,0x18,0x9a,
+0x0a,0x39,0x13,0xa3,0xbb,0x3b,0x79,0x39,0x9a,0xaa,0x82,0x17,0x81,0xbb,0x0d,0x52,
+0x14,0xd0,0xce,0xad,0xaa,0x80,0x02,0x01,0x99,0x89,0x00,0x12,0xa1,0xb8,0x89,0x12,
+0x04,0xb1,0xbc,0xb1,0x86,0xa3,0xe2,0xa0,0x01,0x13,0x01,0x9e,0x1a,0x30,0x85,0xc1,
+0xaa,0x5b,0x41,0x02,0xcb,0x9f,0x40,0x55,0x34,0x12,0x80,0x99,0x88,0x10,0x01,0x90,
+0xa8,0x10,0x38,0x28,0xba,0xb1,0x21,0x5a,0x09,0x89,0x19,0x3a,0x39,0x1a,0x99,0xc2,
+0xa3,0x03,0x00,0xa0,0xa2,0x20,0x3a,0x09,0xb1,0x10,0x3a,0x39,0x09,0xb0,0x90,0x59,
+0x4a,0x2b,0x1c,0x3b,0x30,0x11,0xcb,0x9b,0x33,0x27,0xc1,0xda,0x0a,0x56,0x35,0x24,
+0x01,0x99,0x89,0x00,0x11,0x00,0x8b,0x89,0x31,0x30,0x9a,0x9b,0x19,0x23,0x93,0xc9,
+0xb0,0x95,0x03,0xb0,0x9b,0x19,0x31,0x01,0xb0,0xa9,0x12,0x03,0x91,0x2c,0x3c,0x49,
+0x09,0xb9,0xa1,0x03,0x03,0xb1,0xb0,0x01,0x13,0x01,0xb9,0xb1,0x03,0x23,0x9b,0xc9,
+0xb3,0x87,0x81,0x1a,0x2c,0x49,0x39,0x8a,0x9b,0x00,0x87,0x92,0xba,0x89,0x63,0x22,
+0xca,0xae,0x49,0x66,0x43,0x22,0x80,0x99,0x89,0x11,0x01,0x98,0xa9,0x00,0x13,0x11,
+0xac,0x99,0x14,0x03,0xab,0x1f,0x4a,0x38,0x99,0xdb,0x01,0x26,0xb3,0xfc,0xbf,0xaa,
+0x09,0x21,0x01,0xa9,0x9a,0x30,0x16,0xb1,0xed,0xcb,0x99,0x08,0x01,0x81,0x89,0x09,
+0x10,0x10,0x89,0x99,0xa2,0x95,0x00,0x0b,0x2a,0x31,0x92,0xab,0x1b,0x51,0x38,0x2d,
+0x1d,0x08,0x03,0x01,0x0f,0x1b,0x22,0x96,0xb8,0x9d,0x58,0x65,0x33,0x13,0x90,0x99,
+0x09,0x11,0x92,0xb0,0x09,0x39,0x31,0x99,0xbb,0x3b,0x13,0x03,0xaa,0x1b,0x59,0x00,
+0xb0,0xb9,0x31,0x51,0x1a,0x9b,0x19,0x51,0xa1,0xf3,0x80,0x20,0x21,0xb9,0xbb,0x39,
+0x27,0xa1,0xdc,0x1b,0x66,0x44,0x13,0x81,0xa9,0x09,0x30,0x10,0xa9,0x9a,0x20,0x43,
+0x98,0xbd,0x19,0x63,0x83,0xfa,0x9a,0x41,0x46,0x33,0x01,0x09,0x31,0x37,0x14,0x01,
+0xa9,0x89,0x10,0x02,0xa1,0xb9,0x80,0x32,0x82,0xc9,0xa9,0x21,0x52,0x08,0x9c,0x99,
+0x04,0x03,0xaa,0xdb,0xa3,0x14,0x00,0x9b,0x0b,0x31,0x41,0x2b,0x0e,0x29,0x38,0x08,
+0xb9,0xa9,0x31,0x31,0x3b,0x8c,0xb0,0x33,0x21,0x9b,0xaa,0x21,0x50,0x3b,0x9b,0xa0,
+0x13,0xb4,0xc4,0xa1,0x10,0x30,0x19,0x0b,0x0b,0x11,0x94,0xa1,0x0b,0x3b,0x30,0x11,
+0x99,0x1d,0x08,0x13,0x19,0xbb,0x99,0x41,0x20,0x9b,0x0e,0x18,0x31,0x10,0x9d,0x0b,
+0x31,0x07,0xb1,0xbb,0x4c,0x71,0x02,0xeb,0xcd,0xcb,0x89,0x00,0x11,0x08,0x99,0x88,
+0x01,0x11,0x09,0xaa,0x92,0x03,0x93,0xc9,0x90,0x11,0x13,0xb3,0xb0,0x19,0x39,0x11,
+0x99,0x1b,0x19,0x02,0x01,0x99,0x1a,0x39,0x39,0x2b,0xaa,0xb3,0x93,0xa2,0xa1,0xb3,
+0x92,0x29,0x99,0xb2,0xa1,0x92,0xa2,0xa3,0x19,0x99,0xb3,0x93,0x19,0x2a,0x3b,0x3b,
+0x19,0xb1,0xd3,0xc4,0xa3,0x81,0x90,0xb1,0x13,0x20,0x99,0x99,0x09,0x92,0x92,0xa0,
+0xb1,0xb3,0xa5,0xb3,0xb1,0xb1,0x93,0x94,0x90,0x9b,0x19,0x12,0x93,0xb9,0x1b,0x39,
+0x41,0x09,0xbb,0x9a,0x33,0x33,0xd9,0xc9,0x01,0x15,0x83,0xfb,0xba,0x52,0x47,0x43,
+0x22,0x80,0x99,0x89,0x10,0x02,0x80,0xa9,0x99,0x12,0x33,0xb1,0xfb,0x99,0x48,0x43,
+0x92,0xfd,0xbd,0xbc,0x99,0x00,0x02,0x92,0x99,0x0a,0x38,0x21,0x88,0xbb,0xaa,0x07,
+0x83,0xd2,0xc0,0x00,0x31,0x92,0xc0,0x9c,0x20,0x25,0xa3,0xfa,0xbb,0x63,0x56,0x23,
+0x13,0x90,0x99,0x09,0x01,0x82,0xa0,0xa8,0x81,0x03,0xb2,0xd3,0x90,0x01,0x03,0x90,
+0x9a,0x90,0x12,0x10,0x99,0x09,0x39,0x3a,0x2b,0x1b,0x29,0x19,0x09,0x09,0x10,0x01,
+0xa1,0x09,0x01,0x93,0xd3,0xd2,0x92,0xa3,0xb5,0xc1,0xa8,0x14,0x16,0xc9,0xdf,0xcb,
+0x99,0x10,0x21,0x88,0xaa,0x09,0x42,0x13,0xfb,0xcd,0xba,0x89,0x01,0x01,0x88,0x89,
+0x18,0x20,0x09,0x99,0xa0,0x94,0xb3,0xd3,0x91,0x01,0x11,0x1a,0x2c,0x6b,0x29,0x89,
+0xa9,0x01,0x23,0x93,0xba,0x1b,0x59,0x11,0xb0,0xfb,0x91,0x05,0x82,0xda,0xab,0x71,
+0x46,0x43,0x12,0x98,0x99,0x90,0x02,0x92,0xb1,0x98,0x28,0x11,0x92,0x0b,0x0d,0x30,
+0x30,0xb0,0xba,0x4b,0x7b,0x19,0x89,0x0a,0x29,0x31,0x39,0x0e,0x2a,0x39,0x11,0x90,
+0x0f,0x2a,0x31,0x10,0xcb,0xba,0x63,0x42,0x99,0xcd,0x1a,0x75,0x44,0x22,0x01,0xa9,
+0x98,0x01,0x12,0xb0,0xb9,0x00,0x15,0xa3,0xea,0x9a,0x73,0x36,0x33,0x02,0xa8,0x99,
+0x10,0x11,0xa1,0xb0,0x80,0x30,0x21,0x9a,0x1d,0x19,0x11,0x92,0x1b,0x2c,0x39,0x30,
+0x1a,0x0b,0x29,0x29,0x91,0xa0,0x19,0x19,0xb3,0xa3,0x19,0x3b,0x39,0x1a,0x90,0x19,
+0x3a,0x39,0x2b,0x1b,0x90,0xb3,0xb3,0x91,0xb2,0x02,0x4a,0x3c,0x1a,0x90,0x91,0x10,
+0x99,0x91,0xb3,0xb3,0x91,0x39,0x3b,0x3b,0x1a,0x2a,0x09,0xb3,0xb3,0x00,0x90,0xb3,
+0xb4,0xb2,0xb1,0xb4,0xa5,0x91,0xa0,0x11,0x02,0xb3,0xd2,0xa1,0xa4,0x83,0x98,0x9b,
+0x4a,0x6a,0x09,0x9a,0xb0,0x95,0x13,0x0a,0xad,0x91,0x07,0xa2,0xc9,0x1b,0x70,0x32,
+0xd9,0xde,0xac,0x9a,0x00,0x11,0x80,0x99,0x88,0x10,0x02,0xb0,0xb8,0x11,0x41,0x19,
+0xbb,0x1b,0x32,0x13,0x9a,0x9b,0x3b,0x23,0xc3,0xb0,0x29,0x59,0x28,0x9b,0x9a,0x30,
+0x41,0x19,0x0e,0x3a,0x49,0x18,0xc9,0xb0,0x93,0x15,0xa0,0xaa,0x3b,0x70,0x28,0x0b,
+0x0c,0x10,0x23,0xb0,0xeb,0x88,0x23,0x12,0x9c,0x0e,0x28,0x33,0xa0,0xbd,0x1a,0x53,
+0x03,0xf8,0x99,0x20,0x24,0x91,0xad,0xa9,0x06,0x13,0xaa,0xbc,0x12,0x17,0x91,0xdb,
+0x88,0x33,0x14,0xda,0xbb,0x41,0x25,0xb1,0xcd,0x1a,0x56,0x14,0x91,0xcb,0x8b,0x41,
+0x34,0x82,0xaa,0x8a,0x32,0x03,0xbb,0x3c,0x67,0x13,0xeb,0xbd,0x50,0x67,0x34,0x24,
+0x00,0xa9,0xcb,0xcb,0xbb,0xdb,0xbb,0xbc,0xbb,0xbc,0xab,0xab,0x89,0x10,0x21,0x42,
+0x44,0x34,0x34,0x33,0x35,0x45,0x34,0x43,0x22,0x11,0x01,0x10,0x10,0x11,0x80,0xc9,
+0xdd,0xcc,0xcb,0xba,0xa9,0xba,0xdc,0xcc,0xbc,0xab,0xab,0xa9,0x99,0x88,0x31,0x46,
+0x43,0x23,0x11,0x01,0x43,0x45,0x34,0x43,0x32,0x21,0x22,0x01,0x90,0xcb,0xbb,0xaa,
+0x09,0x88,0xda,0xdc,0xcb,0xcb,0xba,0xba,0xcb,0xcb,0xac,0xcb,0xaa,0x9b,0x9a,0x98,
+0x88,0x00,0x21,0x42,0x34,0x45,0x43,0x43,0x24,0x33,0x32,0x24,0x33,0x43,0x32,0x32,
+0x43,0x22,0x01,0xba,0xcd,0xcb,0xba,0xdb,0xdb,0xdb,0xcb,0xab,0xab,0x9a,0x98,0x80,
+0x00,0x08,0x18,0x73,0x54,0x44,0x43,0x32,0x32,0x43,0x43,0x34,0x43,0x33,0x23,0x33,
+0x12,0x12,0x22,0x33,0x22,0xa8,0xec,0xbc,0xcc,0xbb,0xcc,0xcb,0xba,0xbb,0xac,0xab,
+0xab,0x9a,0x88,0x00,0x21,0x53,0x34,0x35,0x43,0x43,0x34,0x35,0x25,0x33,0x23,0x22,
+0x21,0x21,0x21,0x12,0x98,0xdc,0xdd,0xbb,0xbc,0xbb,0xbc,0xcc,0xdb,0xbb,0xbc,0xba,
+0xab,0xa9,0x9a,0xcb,0xcb,0xbb,0x8a,0x30,0x45,0x33,0x33,0x43,0x53,0x43,0x34,0x23,
+0x33,0x22,0x22,0x12,0x01,0x80,0xa9,0xcb,0xbc,0xcb,0xdb,0xcd,0xcc,0xcb,0xbb,0xab,
+0x9a,0x99,0xa9,0xca,0xbb,0x8a,0x62,0x55,0x34,0x43,0x22,0x22,0x42,0x44,0x44,0x33,
+0x23,0x13,0x12,0x22,0x32,0x24,0x22,0x02,0x90,0xbb,0xbd,0xcc,0xbb,0xbc,0xcd,0xcb,
+0xcb,0xbb,0xba,0xbb,0xcb,0xbb,0xaa,0x08,0x11,0x23,0x11,0x21,0x73,0x45,0x35,0x25,
+0x23,0x02,0x80,0x09,0x20,0x44,0x22,0xc8,0xdd,0xcc,0xba,0xaa,0xaa,0xa9,0xa9,0x08,
+0x32,0x22,0xb8,0xcf,0xac,0x09,0x42,0x34,0x32,0x22,0x32,0x24,0x02,0xb8,0xbd,0x9b,
+0x52,0x36,0x34,0x13,0x81,0x80,0x08,0x10,0x21,0x81,0xd9,0xdd,0xdb,0xab,0xbb,0xbc,
+0xbc,0xbd,0xbc,0xba,0xbb,0xbb,0xbb,0xaa,0xaa,0x99,0x08,0x41,0x45,0x53,0x33,0x35,
+0x34,0x35,0x43,0x23,0x33,0x33,0x42,0x22,0x33,0x32,0x12,0x90,0xb9,0xbc,0x9a,0x98,
+0xea,0xce,0xbd,0xbc,0xab,0x8a,0x09,0x88,0xa9,0xbb,0xba,0x28,0x56,0x35,0x34,0x33,
+0x23,0x34,0x44,0x35,0x34,0x33,0x32,0x32,0x22,0x32,0x23,0x23,0x11,0xa9,0xcc,0xbd,
+0xbc,0xdb,0xcb,0xdb,0xbb,0xbc,0xbb,0xcb,0xbb,0xcb,0xba,0x9a,0x99,0x00,0x21,0x43,
+0x43,0x33,0x45,0x44,0x44,0x33,0x33,0x11,0x01,0x21,0x32,0x24,0x01,0xb9,0xce,0xcc,
+0xbb,0xba,0xbb,0xcd,0xcc,0xbd,0xcb,0xba,0xaa,0xa9,0xaa,0xbb,0xcb,0xaa,0x8a,0x20,
+0x43,0x43,0x33,0x44,0x53,0x53,0x43,0x32,0x23,0x43,0x33,0x33,0x33,0x12,0x01,0x00,
+0x80,0x80,0x98,0xeb,0xed,0xdb,0xcb,0xaa,0x99,0x88,0x99,0xcb,0xbc,0x9a,0x28,0x45,
+0x53,0x32,0x32,0x32,0x53,0x35,0x44,0x33,0x24,0x23,0x23,0x33,0x43,0x33,0x33,0x22,
+0x01,0xa9,0xcc,0xbc,0xbd,0xcc,0xbc,0xdb,0xbb,0xcb,0xbb,0xbc,0xbb,0xbb,0xab,0xaa,
+0x99,0xaa,0xbc,0xbc,0x09,0x73,0x35,0x33,0x02,0xa8,0x9a,0x18,0x34,0x35,0x43,0x45,
+0x44,0x43,0x12,0x80,0xaa,0x9a,0x10,0x32,0x82,0xea,0xdb,0xaa,0xbb,0xdc,0xbd,0xad,
+0xab,0x9a,0x08,0x00,0x00,0x88,0x80,0x21,0x54,0x35,0x44,0x22,0x12,0x02,0x11,0x32,
+0x32,0x13,0x81,0xb9,0xbd,0xcc,0xcb,0xbc,0xdb,0xdb,0xbc,0xcb,0xbb,0xbb,0xbb,0xba,
+0xaa,0x8a,0x10,0x42,0x43,0x43,0x44,0x43,0x34,0x34,0x53,0x33,0x43,0x33,0x43,0x32,
+0x34,0x33,0x22,0x81,0x80,0x00,0x11,0x13,0xa0,0xde,0xbd,0xbd,0xbb,0xba,0xaa,0xbb,
+0xdb,0xcb,0xba,0x89,0x21,0x34,0x35,0x33,0x53,0x33,0x45,0x53,0x53,0x32,0x33,0x32,
+0x32,0x42,0x32,0x33,0x12,0x80,0xa8,0xdb,0xcc,0xcc,0xcb,0xcb,0xbb,0xbc,0xbc,0xac,
+0xbb,0xab,0xbb,0xac,0xaa,0x99,0x88,0x98,0x98,0x10,0x54,0x45,0x34,0x24,0x23,0x22,
+0x32,0x53,0x43,0x23,0x01,0xb9,0xdc,0xbb,0xab,0xba,0xbb,0xce,0xcc,0xdb,0xbb,0xbc,
+0xab,0xbb,0xbb,0xbc,0xbb,0xac,0xa9,0x89,0x10,0x43,0x45,0x53,0x33,0x43,0x43,0x43,
+0x43,0x24,0x33,0x24,0x22,0x12,0x10,0x11,0x42,0x33,0x22,0xa0,0xeb,0xbc,0xac,0xab,
+0xaa,0xba,0xdb,0xdb,0xcb,0xaa,0x99,0x08,0x01,0x12,0x32,0x45,0x53,0x43,0x43,0x34,
+0x34,0x34,0x33,0x24,0x22,0x22,0x21,0x21,0x12,0x01,0xb8,0xde,0xdb,0xcb,0xcb,0xba,
+0xbc,0xdb,0xdb,0xcb,0xbb,0xab,0x9a,0x89,0xba,0xdc,0xbc,0xab,0x89,0x10,0x32,0x63,
+0x44,0x45,0x33,0x33,0x22,0x01,0x32,0x44,0x43,0x23,0x02,0x01,0x88,0xb8,0xdd,0xcc,
+0xbb,0xbb,0xab,0xbb,0xdb,0xbc,0xbb,0xac,0xab,0x9a,0x99,0x88,0x88,0x98,0x18,0x42,
+0x46,0x53,0x43,0x33,0x33,0x24,0x33,0x43,0x32,0x33,0x12,0x80,0xa9,0xca,0xcb,0xbc,
+0xbd,0xcb,0xcb,0xbc,0xcc,0xcb,0xbb,0xbb,0xaa,0xab,0x9a,0x9a,0x09,0x20,0x44,0x45,
+0x35,0x35,0x43,0x33,0x24,0x43,0x43,0x43,0x33,0x33,0x22,0x12,0x11,0x22,0x32,0x13,
+0x90,0xdc,0xcc,0xbc,0xcb,0xcb,0xbb,0xcb,0xbb,0xbc,0xbb,0xab,0xaa,0x88,0x10,0x31,
+0x44,0x44,0x44,0x43,0x34,0x34,0x34,0x24,0x33,0x23,0x22,0x12,0x21,0x11,0x01,0xa9,
+0xcc,0xcd,0xcb,0xdb,0xca,0xba,0xcc,0xbb,0xbc,0xbc,0xab,0xab,0xab,0xaa,0xba,0xbb,
+0xac,0x8a,0x42,0x45,0x33,0x23,0x22,0x43,0x44,0x44,0x32,0x33,0x22,0x10,0x88,0x98,
+0x98,0xa9,0xcc,0xdc,0xbc,0xbd,0xbc,0xcb,0xbc,0xcb,0xba,0xba,0xaa,0xaa,0xba,0xbb,
+0x9b,0x30,0x57,0x34,0x34,0x32,0x32,0x44,0x35,0x35,0x34,0x23,0x22,0x12,0x11,0x22,
+0x43,0x23,0x23,0x80,0xbb,0xbe,0xab,0xbb,0xbd,0xdc,0xcb,0xbb,0xbc,0xaa,0xab,0x9a,
+0x9a,0x99,0x88,0x11,0x34,0x34,0x44,0x43,0x44,0x44,0x43,0x32,0x22,0x21,0x21,0x33,
+0x33,0x14,0x80,0xdc,0xcd,0xcb,0xab,0x9a,0xaa,0xec,0xcc,0xcb,0xbb,0xab,0xaa,0xa9,
+0x99,0x20,0x53,0x34,0x23,0x11,0x10,0x54,0x54,0x43,0x33,0x33,0x33,0x24,0x12,0x80,
+0xb9,0xcb,0x99,0x00,0x00,0xc9,0xdc,0xcb,0xac,0xba,0xcb,0xcb,0xcb,0xbc,0xcb,0xba,
+0xab,0xaa,0xaa,0xa9,0x9a,0x88,0x21,0x44,0x35,0x34,0x34,0x43,0x43,0x43,0x24,0x33,
+0x33,0x32,0x43,0x33,0x33,0x12,0x80,0xca,0xbb,0xbc,0xcc,0xcc,0xbc,0xbd,0xbc,0xbb,
+0xaa,0x9a,0x99,0xb9,0xbb,0xab,0x20,0x57,0x44,0x43,0x32,0x22,0x33,0x35,0x45,0x33,
+0x34,0x32,0x12,0x22,0x31,0x32,0x24,0x13,0x81,0xba,0xbe,0xbc,0xcb,0xbc,0xbc,0xbc,
+0xcc,0xba,0xba,0xaa,0xaa,0x9a,0xa9,0x89,0x10,0x42,0x43,0x43,0x53,0x63,0x53,0x43,
+0x33,0x33,0x32,0x23,0x33,0x43,0x22,0x01,0xb8,0xce,0xbc,0xbc,0xcb,0xba,0xdb,0xcc,
+0xdb,0xbb,0xcb,0xaa,0xa9,0xa9,0xcb,0xdb,0xaa,0x9a,0x10,0x31,0x23,0x33,0x33,0x36,
+0x45,0x34,0x33,0x24,0x22,0x22,0x22,0x12,0x12,0x01,0x88,0xaa,0xcb,0xcc,0xbc,0xcd,
+0xbc,0xbd,0xcb,0xaa,0x9a,0xa9,0xba,0xbd,0xaa,0x19,0x73,0x53,0x32,0x22,0x22,0x53,
+0x54,0x43,0x34,0x32,0x23,0x22,0x32,0x32,0x34,0x33,0x13,0x01,0xa8,0xca,0xca,0xca,
+0xdb,0xcc,0xcc,0xbb,0xcb,0xbb,0xcb,0xab,0xbb,0xab,0x9a,0x99,0x88,0x00,0x20,0x53,
+0x45,0x44,0x34,0x43,0x22,0x01,0x11,0x42,0x44,0x22,0x90,0xcd,0xcc,0xaa,0x9b,0x9a,
+0xaa,0x99,0x08,0x32,0x02,0xfa,0xcd,0xab,0x89,0x21,0x33,0x23,0x12,0x32,0x34,0x01,
+0xfa,0xbc,0xab,0x31,0x57,0x33,0x33,0x13,0x11,0x21,0x22,0x24,0x22,0x90,0xdb,0xdc,
+0xbb,0xbc,0xcb,0xdb,0xcb,0xbc,0xcb,0xbb,0xac,0xab,0xaa,0xba,0xba,0xaa,0x88,0x32,
+0x45,0x34,0x34,0x44,0x43,0x34,0x24,0x33,0x33,0x33,0x34,0x33,0x33,0x22,0x02,0x80,
+0x98,0x99,0xa9,0xfb,0xcc,0xbd,0xbd,0xcb,0xba,0x9a,0x9a,0xba,0xbc,0xab,0x8a,0x30,
+0x46,0x33,0x34,0x33,0x44,0x53,0x44,0x43,0x23,0x24,0x12,0x22,0x33,0x33,0x33,0x22,
+0x00,0xa9,0xcc,0xdb,0xbb,0xbc,0xcc,0xbc,0xbd,0xbb,0xbc,0xbb,0xbb,0xbc,0xab,0xaa,
+0x99,0x88,0x00,0x22,0x44,0x44,0x34,0x35,0x34,0x43,0x22,0x23,0x42,0x32,0x24,0x12,
+0x80,0xaa,0xbd,0xcb,0xbb,0xcb,0xeb,0xcc,0xcc,0xcb,0xab,0xab,0xaa,0xbb,0xdb,0xba,
+0xbb,0x9a,0x89,0x20,0x32,0x35,0x43,0x34,0x44,0x43,0x34,0x34,0x43,0x33,0x33,0x32,
+0x22,0x12,0x21,0x12,0x12,0x01,0xba,0xdf,0xdb,0xcb,0xab,0xaa,0xaa,0xcb,0xcc,0xcb,
+0xaa,0x08,0x30,0x42,0x33,0x33,0x53,0x53,0x34,0x35,0x34,0x34,0x43,0x23,0x33,0x33,
+0x24,0x43,0x22,0x21,0x00,0x98,0xba,0xdc,0xcc,0xcb,0xcb,0xbb,0xbd,0xbc,0xbc,0xbb,
+0xbb,0xab,0xaa,0xab,0xcb,0xbc,0xab,0x09,0x62,0x34,0x23,0x02,0x88,0x18,0x53,0x35,
+0x43,0x53,0x53,0x44,0x23,0x23,0x80,0x99,0x9a,0x10,0x32,0x12,0xca,0xdd,0xbb,0xcc,
+0xcb,0xcc,0xcb,0xaa,0x9a,0x89,0x98,0x88,0x99,0x08,0x20,0x44,0x44,0x34,0x34,0x32,
+0x22,0x22,0x24,0x43,0x22,0x12,0x00,0x98,0xba,0xbd,0xad,0xbc,0xdb,0xcc,0xbc,0xdb,
+0xba,0xaa,0xba,0x9a,0xaa,0x89,0x09,0x08,0x31,0x63,0x44,0x43,0x34,0x53,0x33,0x34,
+0x43,0x43,0x33,0x34,0x32,0x22,0x11,0x11,0x12,0x23,0x22,0x81,0xeb,0xcd,0xdb,0xbb,
+0xbb,0xac,0xbb,0xcc,0xca,0xaa,0x9a,0x09,0x00,0x21,0x32,0x44,0x34,0x35,0x34,0x44,
+0x43,0x24,0x33,0x24,0x32,0x33,0x33,0x32,0x12,0x00,0xa8,0xdb,0xdc,0xdb,0xca,0xba,
+0xbc,0xdb,0xbb,0xbc,0xbb,0xac,0xaa,0xab,0xaa,0xaa,0xba,0x9a,0x19,0x63,0x44,0x43,
+0x32,0x43,0x43,0x43,0x34,0x33,0x43,0x11,0x80,0xaa,0xab,0xab,0xa9,0xdb,0xdc,0xcc,
+0xbc,0xbc,0xbc,0xbb,0xbc,0xcb,0xca,0xba,0xba,0xab,0xaa,0x9a,0x09,0x42,0x54,0x43,
+0x33,0x34,0x35,0x44,0x24,0x24,0x23,0x23,0x22,0x21,0x22,0x53,0x33,0x23,0x81,0xca,
+0xcc,0xab,0x9a,0xaa,0xda,0xcc,0xdb,0xab,0xab,0x99,0x99,0x99,0x98,0x00,0x31,0x44,
+0x33,0x24,0x22,0x12,0x11,0x00,0x98,0xb9,0xeb,0xbb,0x9b,0x28,0x22,0xb0,0xef,0xcc,
+0xaa,0x9a,0x08,0x00,0xa8,0xee,0xcc,0xcb,0x9a,0x08,0x01,0xb0,0xde,0xcc,0xab,0x9a,
+0x88,0x88,0x18,0x63,0x35,0x25,0x13,0x00,0x88,0x10,0x44,0x34,0x23,0x13,0x21,0x01,
+0x90,0xdc,0xbd,0xbc,0x9a,0x88,0x00,0x98,0xba,0xbc,0xbb,0xaa,0x88,0x10,0x90,0xda,
+0xcd,0xba,0x9a,0x18,0x11,0x00,0x99,0xbb,0xbb,0x9a,0x20,0x34,0x14,0xb9,0xbf,0xbc,
+0x99,0x10,0x32,0x43,0x54,0x44,0x34,0x32,0x12,0x01,0x10,0x52,0x44,0x34,0x23,0x01,
+0x08,0x20,0x65,0x44,0x33,0x32,0x01,0x00,0x30,0x54,0x45,0x43,0x23,0x02,0x80,0x08,
+0x41,0x54,0x33,0x23,0x01,0x90,0x00,0x43,0x45,0x33,0x23,0x02,0x88,0x08,0x30,0x53,
+0x24,0x23,0x01,0x99,0xaa,0x28,0x64,0x43,0x32,0x01,0x88,0xb9,0xdb,0xcc,0xcb,0xba,
+0x9a,0x99,0xa9,0xeb,0xcc,0xcb,0xab,0x89,0x10,0x90,0xed,0xcd,0xbb,0xaa,0x89,0x80,
+0x90,0xeb,0xdc,0xbb,0xac,0x99,0x10,0x80,0xda,0xdd,0xbb,0x9c,0x8a,0x00,0x80,0x99,
+0xbc,0xbc,0xba,0x89,0x10,0x10,0xa8,0xcb,0x9c,0x89,0x18,0x80,0x18,0x62,0x55,0x43,
+0x13,0x11,0x08,0x31,0x45,0x35,0x34,0x24,0x12,0x00,0x08,0x62,0x64,0x43,0x32,0x11,
+0x80,0x08,0x21,0x45,0x34,0x33,0x12,0x01,0x88,0x10,0x42,0x34,0x33,0x12,0x80,0x88,
+0x10,0x42,0x43,0x23,0x11,0x88,0xb9,0xfb,0xdb,0xbc,0xbb,0xaa,0x89,0x98,0xfb,0xdc,
+0xdb,0xba,0xa9,0x88,0x88,0xca,0xcf,0xcc,0xbb,0x9a,0x00,0x01,0xe9,0xcd,0xcc,0xaa,
+0x9a,0x88,0x08,0x11,0x44,0x45,0x23,0x22,0x88,0x88,0x30,0x36,0x25,0x23,0x11,0x11,
+0x10,0xa8,0xec,0xbc,0xbb,0x9b,0x88,0x00,0x99,0xdb,0xbb,0xac,0xa9,0x88,0x00,0x98,
+0xcb,0xcc,0xab,0x8a,0x08,0x00,0x98,0xba,0xcc,0x9a,0x8a,0x00,0x12,0x80,0xdb,0xcd,
+0xbb,0x9a,0x09,0x21,0x53,0x54,0x34,0x24,0x13,0x11,0x10,0x31,0x35,0x44,0x32,0x12,
+0x02,0x11,0x63,0x45,0x35,0x24,0x13,0x00,0x88,0x30,0x46,0x35,0x24,0x12,0x00,0x88,
+0x18,0x52,0x53,0x33,0x23,0x01,0x88,0x00,0x53,0x44,0x43,0x12,0x81,0x80,0x08,0x21,
+0x32,0x43,0x21,0x88,0xab,0x9a,0x42,0x46,0x23,0x02,0x90,0x99,0x9a,0xdc,0xcd,0xbc,
+0xbb,0x99,0x88,0x98,0xdb,0xcc,0xcb,0xba,0x99,0x80,0xb9,0xde,0xcd,0xbb,0xaa,0x89,
+0x88,0xb8,0xec,0xdb,0xbb,0xab,0x89,0x00,0xa8,0xdd,0xcd,0xcb,0x9a,0x89,0x80,0x80,
+0xa9,0xbc,0xbb,0xab,0x89,0x00,0x01,0xa8,0xcb,0xbc,0xab,0x98,0x80,0x22,0x56,0x44,
+0x43,0x13,0x11,0x08,0x20,0x55,0x35,0x25,0x23,0x11,0x88,0x00,0x54,0x45,0x34,0x22,
+0x01,0x98,0x00,0x53,0x44,0x24,0x13,0x01,0x88,0x08,0x20,0x43,0x33,0x23,0x01,0x88,
+0x89,0x11,0x44,0x33,0x23,0x88,0xba,0xbc,0xbc,0xcd,0xbc,0xbb,0xaa,0x80,0x98,0xce,
+0xbe,0xbd,0xbb,0x9a,0x09,0x80,0xea,0xce,0xbd,0xbb,0x8a,0x10,0x01,0xfb,0xcd,0xcb,
+0xab,0x99,0x88,0x00,0x30,0x45,0x35,0x43,0x11,0x88,0x88,0x32,0x55,0x33,0x22,0x11,
+0x10,0x00,0xc9,0xdc,0xbc,0xbb,0x9a,0x08,0x08,0xb9,0xdb,0xbb,0xab,0xaa,0x98,0x88,
+0xb8,0xdc,0xcb,0xab,0x9a,0x00,0x80,0x99,0xbb,0xcb,0xaa,0x8a,0x18,0x10,0xc8,0xdd,
+0xdb,0x9a,0x09,0x18,0x10,0x31,0x56,0x44,0x33,0x13,0x01,0x00,0x32,0x45,0x34,0x24,
+0x11,0x08,0x09,0x63,0x45,0x44,0x22,0x11,0x88,0x08,0x41,0x54,0x34,0x33,0x22,0x00,
+0x88,0x30,0x55,0x53,0x32,0x11,0x08,0x88,0x11,0x44,0x43,0x23,0x11,0x80,0x88,0x20,
+0x43,0x34,0x22,0x01,0x98,0x9a,0x09,0x42,0x45,0x23,0x12,0x90,0xa9,0xdb,0xcd,0xcc,
+0xcb,0xaa,0x89,0x88,0xa8,0xcc,0xbc,0xbc,0x9a,0x89,0x88,0xc9,0xce,0xbd,0xac,0x9b,
+0x99,0x88,0xb9,0xdd,0xcc,0xbb,0xaa,0x09,0x11,0xa8,0xde,0xcc,0xbb,0xaa,0x08,0x08,
+0x98,0xcb,0xcb,0xbb,0x9a,0x89,0x08,0x88,0xaa,0xcc,0xaa,0x9a,0x80,0x80,0x31,0x65,
+0x35,0x34,0x12,0x01,0x00,0x32,0x47,0x44,0x43,0x22,0x81,0x90,0x20,0x74,0x34,0x34,
+0x22,0x80,0x08,0x20,0x44,0x35,0x33,0x23,0x01,0x08,0x00,0x42,0x43,0x33,0x12,0x01,
+0x80,0x10,0x22,0x43,0x32,0x12,0x98,0xa9,0xca,0xdc,0xcd,0xbd,0xab,0x8a,0x08,0xb8,
+0xcf,0xcc,0xbb,0x9a,0x89,0x90,0xb9,0xdf,0xcc,0xac,0xab,0x88,0x01,0xa0,0xde,0xcc,
+0xbb,0xaa,0x89,0x88,0x00,0x43,0x46,0x34,0x22,0x01,0x98,0x08,0x53,0x44,0x33,0x22,
+0x12,0x10,0x80,0xd9,0xcd,0xbc,0xaa,0x99,0x80,0x80,0xb9,0xcb,0xcb,0xaa,0x99,0x08,
+0x80,0xa9,0xbd,0xad,0x9b,0x89,0x00,0x88,0x99,0xbb,0xbb,0xbb,0x8a,0x20,0x23,0xc1,
+0xee,0xdb,0xaa,0x89,0x01,0x22,0x34,0x44,0x53,0x23,0x23,0x11,0x21,0x41,0x63,0x34,
+0x43,0x12,0x80,0x80,0x52,0x46,0x34,0x33,0x02,0x80,0x08,0x63,0x45,0x24,0x23,0x02,
+0x00,0x00,0x31,0x45,0x34,0x23,0x12,0x80,0x89,0x28,0x53,0x34,0x24,0x10,0x88,0x08,
+0x21,0x43,0x23,0x13,0x01,0x90,0x80,0x52,0x44,0x43,0x12,0x80,0x88,0x99,0xfb,0xdc,
+0xcb,0xbb,0x99,0x89,0x98,0xcb,0xcc,0xcb,0xac,0x9a,0x89,0xa9,0xdc,0xbe,0xcc,0xaa,
+0x89,0x88,0x98,0xca,0xcd,0xdb,0xaa,0x8a,0x08,0x81,0xd9,0xdd,0xbb,0xac,0x89,0x08,
+0x80,0x99,0xca,0xbb,0xbb,0xab,0x98,0x00,0x80,0xca,0xcc,0xaa,0x89,0x08,0x80,0x21,
+0x55,0x36,0x34,0x12,0x81,0x88,0x42,0x56,0x43,0x33,0x12,0x80,0x08,0x51,0x46,0x53,
+0x32,0x11,0x81,0x08,0x31,0x54,0x53,0x32,0x12,0x01,0x88,0x10,0x31,0x53,0x23,0x12,
+0x80,0x08,0x18,0x11,0x32,0x32,0x32,0x21,0xa8,0xde,0xcd,0xcc,0xba,0x9a,0x08,0x88,
+0xda,0xdd,0xcb,0xab,0x9b,0x88,0x88,0xc9,0xce,0xcd,0xac,0x9a,0x88,0x01,0xb8,0xcf,
+0xcc,0xba,0x99,0x89,0x88,0x10,0x53,0x45,0x24,0x13,0x80,0x88,0x20,0x63,0x24,0x23,
+0x22,0x11,0x01,0xa8,0xcd,0xbd,0xac,0x9a,0x88,0x08,0x98,0xaa,0xbc,0xac,0x9a,0x09,
+0x08,0x90,0xcb,0xcc,0xba,0x99,0x88,0x08,0x98,0xa8,0xbb,0xac,0x9b,0x18,0x23,0x02,
+0xec,0xcc,0xaa,0x8a,0x88,0x00,0x21,0x54,0x45,0x43,0x33,0x12,0x11,0x12,0x53,0x53,
+0x43,0x23,0x11,0x08,0x28,0x74,0x44,0x34,0x23,0x02,0x88,0x10,0x73,0x45,0x23,0x23,
+0x00,0x88,0x18,0x52,0x53,0x43,0x22,0x01,0x88,0x88,0x32,0x46,0x33,0x23,0x80,0x88,
+0x80,0x21,0x22,0x43,0x33,0x12,0xa9,0xac,0x29,0x47,0x43,0x11,0x99,0xaa,0x99,0xd9,
+0xcc,0xbd,0xaa,0x8a,0x89,0xb9,0xcc,0xbc,0xcb,0xba,0x9a,0x89,0xb9,0xee,0xdc,0xbb,
+0xab,0x89,0x00,0xa0,0xeb,0xdc,0xbb,0xbb,0x8a,0x18,0x90,0xfb,0xbe,0xbc,0x9b,0x89,
+0x08,0x80,0xb9,0xcc,0xcb,0xaa,0x99,0x10,0x11,0xa8,0xdb,0xbb,0x9b,0x80,0x00,0x10,
+0x73,0x44,0x34,0x13,0x01,0x08,0x31,0x56,0x53,0x43,0x22,0x02,0x88,0x08,0x61,0x54,
+0x34,0x24,0x11,0x80,0x88,0x21,0x45,0x34,0x23,0x02,0x80,0x80,0x11,0x34,0x43,0x12,
+0x10,0x08,0x10,0x11,0x33,0x33,0x23,0x80,0xba,0xbc,0xcc,0xdc,0xcc,0xac,0x9b,0x00,
+0x00,0xda,0xdd,0xcb,0xab,0x9a,0x88,0x99,0xea,0xdd,0xbc,0xac,0x8a,0x18,0x01,0xd9,
+0xce,0xcb,0xab,0x9a,0x88,0x08,0x10,0x54,0x35,0x34,0x02,0x80,0x09,0x31,0x36,0x34,
+0x23,0x11,0x21,0x00,0xb8,0xed,0xdb,0xaa,0x8a,0x09,0x88,0xa8,0xaa,0xbc,0xab,0xaa,
+0x08,0x00,0xa9,0xec,0xbb,0xab,0x89,0x00,0x90,0x99,0xaa,0x9a,0xa9,0x98,0x00,0x33,
+0xa2,0xdf,0xbc,0x9b,0x19,0x01,0x00,0x38,0x67,0x44,0x23,0x02,0x00,0x10,0x33,0x36,
+0x33,0x23,0x23,0x01,0x18,0x61,0x56,0x44,0x23,0x13,0x80,0x88,0x31,0x46,0x35,0x24,
+0x12,0x81,0x90,0x10,0x52,0x44,0x33,0x22,0x00,0x88,0x11,0x53,0x53,0x23,0x23,0x11,
+0x80,0x88,0x10,0x44,0x33,0x13,0x98,0xac,0x09,0x52,0x34,0x24,0x01,0x81,0x80,0xb8,
+0xdd,0xcc,0xcb,0xaa,0x9a,0x88,0x98,0xba,0xce,0xac,0xab,0x89,0x88,0xba,0xdf,0xcc,
+0xba,0xab,0x8a,0x88,0x98,0xcc,0xbe,0xbc,0xab,0x89,0x00,0x98,0xed,0xdb,0xcb,0xaa,
+0x89,0x80,0x80,0xb9,0xcc,0xbb,0xaa,0x08,0x00,0x00,0xaa,0xbc,0xbb,0x9a,0x9a,0x08,
+0x31,0x56,0x34,0x35,0x33,0x22,0x12,0x21,0x55,0x45,0x43,0x23,0x01,0x00,0x30,0x55,
+0x54,0x33,0x23,0x01,0x80,0x18,0x44,0x35,0x34,0x22,0x81,0x00,0x18,0x32,0x24,0x33,
+0x23,0x12,0x01,0x88,0x08,0x32,0x35,0x33,0x01,0x88,0x90,0xfb,0xce,0xcc,0xaa,0x09,
+0x00,0x98,0xdc,0xcc,0xac,0xaa,0x8a,0x88,0x90,0xdc,0xce,0xbc,0xbb,0x89,0x00,0x91,
+0xec,0xcd,0xbb,0xbb,0x9a,0x99,0x00,0x41,0x55,0x34,0x33,0x12,0x88,0x08,0x42,0x36,
+0x34,0x22,0x11,0x10,0x00,0xb8,0xce,0xcc,0xaa,0x99,0x08,0x80,0xa8,0xbb,0xbc,0xbb,
+0x99,0x89,0x88,0xba,0xcd,0xbc,0xaa,0x09,0x08,0x80,0xaa,0xac,0xba,0x99,0x88,0x18,
+0x08,0xca,0xce,0xcb,0x9a,0x09,0x08,0x10,0x62,0x45,0x44,0x22,0x01,0x80,0x18,0x42,
+0x44,0x33,0x32,0x22,0x11,0x22,0x55,0x55,0x43,0x23,0x12,0x88,0x08,0x42,0x46,0x34,
+0x33,0x12,0x80,0x08,0x41,0x44,0x34,0x33,0x01,0x90,0x09,0x31,0x46,0x34,0x22,0x11,
+0x88,0x08,0x10,0x32,0x34,0x22,0x01,0xa9,0xac,0x8a,0x73,0x34,0x14,0x81,0xa9,0x9a,
+0x9a,0xeb,0xcc,0xac,0x9b,0x89,0x80,0xa9,0xcd,0xbc,0xcb,0x9b,0x8a,0x98,0xda,0xdd,
+0xcc,0xab,0x9a,0x08,0x80,0xa9,0xbf,0xbd,0xbb,0x9a,0x88,0x81,0xc9,0xce,0xcc,0xab,
+0x9a,0x89,0x80,0x98,0xba,0xcc,0xbb,0xaa,0x88,0x10,0x88,0xdb,0xac,0x9b,0x08,0x11,
+0x80,0x18,0x73,0x36,0x34,0x12,0x80,0x09,0x30,0x56,0x44,0x43,0x21,0x80,0x88,0x20,
+0x46,0x35,0x43,0x12,0x00,0x88,0x20,0x53,0x34,0x34,0x22,0x81,0x80,0x10,0x42,0x24,
+0x22,0x00,0x00,0x10,0x01,0x81,0x10,0x53,0x34,0x12,0x98,0xbb,0xbb,0xde,0xcd,0xbc,
+0x29,0x76,0x54,0x34,0x43,0x32,0x32,0x32,0x24,0x23,0x01,0x90,0xaa,0xeb,0xdc,0xdc,
+0xcb,0xcb,0x9a,0x9a,0x99,0x99,0x08,0x31,0x43,0x22,0x00,0x08,0x31,0x54,0x23,0x23,
+0x00,0xca,0xdc,0xab,0x9b,0x08,0x98,0xdc,0xbc,0xbb,0x09,0x10,0x21,0x64,0x46,0x35,
+0x25,0x23,0x22,0x11,0x00,0x81,0x88,0xa8,0xcc,0xdc,0xcc,0xcb,0xaa,0xaa,0x89,0x89,
+0x88,0x10,0x33,0x35,0x33,0x33,0x34,0x34,0x33,0x12,0x80,0x99,0xdb,0xcd,0xcd,0xdb,
+0xba,0xbb,0xba,0xa9,0x89,0x08,0x31,0x44,0x44,0x43,0x33,0x43,0x32,0x23,0x21,0x00,
+0x88,0xcb,0xcd,0xdc,0xcb,0xbb,0xbc,0xab,0xab,0x99,0x00,0x22,0x35,0x45,0x53,0x33,
+0x34,0x23,0x12,0x11,0x81,0x90,0xba,0xcd,0xbc,0xcc,0xba,0xcb,0xaa,0xaa,0x89,0x18,
+0x31,0x44,0x35,0x45,0x33,0x34,0x23,0x12,0x11,0x00,0x90,0xc9,0xdb,0xbc,0xba,0xbb,
+0xdb,0xca,0xaa,0x99,0x10,0x31,0x53,0x44,0x35,0x35,0x24,0x23,0x12,0x01,0x00,0x88,
+0xba,0xcc,0xcc,0xab,0xac,0xba,0xba,0xbb,0x9a,0x09,0x31,0x36,0x45,0x34,0x44,0x32,
+0x23,0x22,0x11,0x01,0x90,0xcb,0xdc,0xcb,0xac,0xcb,0xba,0xbb,0xaa,0x9a,0x08,0x21,
+0x44,0x35,0x44,0x33,0x43,0x22,0x23,0x12,0x01,0xa8,0xcc,0xeb,0xcb,0xbc,0xbc,0xcb,
+0xaa,0xaa,0x99,0x08,0x10,0x34,0x45,0x33,0x24,0x23,0x33,0x23,0x23,0x01,0xb8,0xcc,
+0xdc,0xdb,0xcc,0xcb,0xbb,0xba,0x9a,0x9a,0x88,0x10,0x63,0x53,0x23,0x23,0x22,0x22,
+0x43,0x22,0x01,0xa8,0xbc,0xbe,0xcd,0xdb,0xbc,0xbb,0xac,0xaa,0x99,0x88,0x21,0x43,
+0x35,0x25,0x43,0x32,0x32,0x22,0x13,0x11,0x88,0xca,0xdc,0xcb,0xbc,0xcb,0xab,0xbb,
+0xaa,0xaa,0x18,0x41,0x44,0x44,0x53,0x43,0x33,0x34,0x22,0x02,0x01,0x80,0xa9,0xeb,
+0xdb,0xbb,0xba,0x9a,0x9a,0xaa,0xba,0x09,0x42,0x45,0x44,0x44,0x53,0x43,0x33,0x22,
+0x22,0x10,0x80,0xa9,0xcc,0xcc,0xbb,0xbb,0xac,0xab,0xab,0x9a,0x89,0x21,0x44,0x54,
+0x34,0x44,0x33,0x33,0x23,0x23,0x11,0x98,0xcb,0xdc,0xcb,0xcc,0xbb,0xbc,0xba,0xaa,
+0x9a,0x89,0x10,0x43,0x35,0x35,0x34,0x32,0x22,0x22,0x11,0x12,0x88,0xdb,0xcc,0xcc,
+0xcb,0xcc,0xbc,0xab,0xab,0x89,0x89,0x00,0x31,0x55,0x43,0x22,0x81,0x88,0x89,0x18,
+0x10,0x80,0xc9,0xcd,0xbd,0xbc,0x9a,0x18,0x11,0x80,0xa9,0x9a,0x52,0x45,0x34,0x43,
+0x44,0x35,0x34,0x23,0x22,0x01,0x80,0x99,0xca,0xcb,0xcc,0xdb,0xcb,0xcb,0xaa,0x99,
+0x08,0x18,0x10,0x42,0x53,0x33,0x33,0x12,0x12,0x22,0x21,0x88,0xeb,0xdb,0xdb,0xdb,
+0xbb,0xad,0xbb,0xab,0x99,0x89,0x10,0x42,0x44,0x53,0x43,0x33,0x33,0x32,0x22,0x11,
+0x00,0xba,0xdd,0xdb,0xdb,0xbb,0xbc,0xbc,0xaa,0x9a,0x88,0x11,0x42,0x34,0x45,0x43,
+0x33,0x43,0x23,0x23,0x11,0x80,0xa9,0xcb,0xcd,0xdb,0xbb,0xcb,0xaa,0xaa,0x9a,0x89,
+0x20,0x63,0x53,0x43,0x34,0x34,0x34,0x32,0x23,0x01,0x80,0x98,0xbb,0xce,0xcc,0xbb,
+0xba,0x9a,0x99,0x89,0x89,0x10,0x54,0x44,0x43,0x53,0x33,0x35,0x23,0x23,0x11,0x80,
+0x98,0xbb,0xce,0xbc,0xbc,0xbb,0xaa,0x9a,0x9a,0x89,0x10,0x53,0x35,0x35,0x44,0x33,
+0x34,0x33,0x22,0x02,0x81,0xa9,0xcc,0xdc,0xcb,0xcb,0xab,0xab,0xaa,0xaa,0x89,0x00,
+0x33,0x46,0x44,0x43,0x33,0x33,0x23,0x12,0x11,0x88,0xb9,0xdd,0xcc,0xcb,0xcb,0xcb,
+0xba,0xba,0x9a,0x99,0x10,0x22,0x35,0x45,0x43,0x33,0x33,0x22,0x11,0x10,0x88,0xb9,
+0xce,0xdb,0xdb,0xbb,0xbc,0xad,0xbb,0x9a,0x99,0x10,0x21,0x43,0x45,0x43,0x24,0x12,
+0x11,0x08,0x88,0x80,0xa9,0xdb,0xdc,0xbb,0xbd,0xcb,0xbc,0xba,0xab,0x99,0x00,0x32,
+0x44,0x35,0x44,0x32,0x33,0x32,0x21,0x11,0x81,0xa8,0xdb,0xbd,0xbd,0xad,0xcb,0xaa,
+0xa9,0x99,0x88,0x10,0x42,0x54,0x43,0x43,0x33,0x34,0x24,0x33,0x12,0x81,0x88,0xba,
+0xbd,0xcd,0xac,0xbb,0xaa,0x89,0x00,0x00,0x01,0x43,0x45,0x44,0x33,0x34,0x44,0x33,
+0x43,0x12,0x01,0x88,0xba,0xdb,0xbc,0xbd,0xcb,0xaa,0xa9,0x98,0x98,0x10,0x41,0x53,
+0x34,0x35,0x43,0x24,0x33,0x32,0x12,0x00,0xa9,0xcc,0xbc,0xbd,0xcb,0xac,0xbb,0xbb,
+0xab,0x9a,0x08,0x22,0x45,0x34,0x35,0x43,0x33,0x22,0x11,0x80,0x88,0x99,0xdb,0xdc,
+0xbc,0xbc,0xac,0xcb,0xbc,0xba,0xaa,0x08,0x21,0x32,0x45,0x53,0x24,0x13,0x81,0xa8,
+0xba,0xa9,0xa9,0xcb,0xcc,0xbd,0xbc,0xbc,0x9a,0x19,0x32,0x33,0x23,0x32,0x46,0x44,
+0x33,0x34,0x43,0x44,0x33,0x33,0x02,0x80,0xa9,0xdb,0xdb,0xbb,0xbc,0xbc,0xcc,0xab,
+0xab,0x89,0x10,0x32,0x53,0x43,0x44,0x32,0x22,0x00,0x98,0x98,0x98,0xca,0xbd,0xcd,
+0xba,0xbc,0xca,0xba,0xab,0x9b,0x89,0x21,0x63,0x53,0x43,0x34,0x33,0x33,0x22,0x01,
+0x00,0x99,0xca,0xcd,0xcc,0xcb,0xbb,0xbc,0xbb,0xab,0x9b,0x08,0x41,0x53,0x44,0x43,
+0x24,0x33,0x33,0x24,0x12,0x02,0x90,0xc9,0xdb,0xcb,0xbc,0xbc,0xcb,0xaa,0x99,0x88,
+0x00,0x31,0x44,0x35,0x44,0x33,0x43,0x32,0x43,0x22,0x02,0x80,0xb9,0xeb,0xcb,0xbc,
+0xad,0xbb,0xaa,0x88,0x00,0x21,0x22,0x54,0x53,0x34,0x43,0x33,0x34,0x33,0x33,0x22,
+0x80,0xba,0xcd,0xbc,0xbd,0xbc,0xcb,0x9a,0x8a,0x88,0x01,0x22,0x34,0x35,0x35,0x44,
+0x32,0x23,0x23,0x23,0x02,0x80,0xca,0xbd,0xbd,0xbd,0xcb,0xcb,0xaa,0x99,0x89,0x00,
+0x20,0x43,0x44,0x34,0x34,0x34,0x23,0x23,0x11,0x88,0xa9,0xcb,0xdc,0xcb,0xbc,0xbc,
+0xbb,0xac,0xab,0x9a,0x89,0x11,0x34,0x44,0x44,0x33,0x34,0x33,0x22,0x00,0x98,0xa9,
+0xcb,0xbd,0xcd,0xcb,0xcb,0xba,0xbb,0xcb,0xba,0x99,0x10,0x42,0x34,0x35,0x44,0x33,
+0x24,0x11,0x90,0x99,0xab,0xba,0xbd,0xcd,0xcb,0xcb,0xba,0xcb,0xba,0xaa,0x99,0x10,
+0x43,0x44,0x44,0x33,0x34,0x33,0x22,0x12,0x00,0x98,0xba,0xdd,0xcb,0xcc,0xca,0xba,
+0xba,0xaa,0x89,0x10,0x32,0x35,0x54,0x43,0x43,0x33,0x33,0x33,0x43,0x22,0x01,0x98,
+0xcc,0xbc,0xbd,0xbc,0xcb,0xaa,0x9a,0x10,0x22,0x34,0x43,0x53,0x53,0x33,0x34,0x33,
+0x43,0x33,0x43,0x02,0x90,0xcb,0xcc,0xbc,0xcb,0xcb,0xaa,0xaa,0x09,0x00,0x22,0x53,
+0x53,0x34,0x34,0x34,0x33,0x33,0x32,0x12,0x90,0xc9,0xdc,0xdb,0xcb,0xbb,0xcb,0xbb,
+0xab,0xaa,0x8a,0x10,0x42,0x45,0x53,0x33,0x34,0x24,0x12,0x11,0x88,0xa8,0xbb,0xcc,
+0xcc,0xdb,0xbb,0xac,0xab,0xbb,0xbc,0xab,0x8a,0x32,0x45,0x43,0x34,0x43,0x24,0x22,
+0x80,0xba,0xbd,0xbb,0xbc,0xcb,0xbc,0xcb,0xcb,0xab,0x9a,0x20,0x63,0x33,0x24,0x33,
+0x44,0x43,0x33,0x32,0x32,0x34,0x34,0x24,0x01,0xa9,0xdb,0xdb,0xbb,0xcb,0xab,0xbb,
+0xcc,0xbb,0xab,0x08,0x53,0x34,0x43,0x43,0x33,0x33,0x13,0x98,0xca,0xcb,0xcb,0xdb,
+0xbc,0xbc,0xba,0xbb,0xbb,0xba,0xab,0x0a,0x41,0x54,0x44,0x43,0x43,0x23,0x33,0x12,
+0x01,0x98,0xba,0xcc,0xcc,0xbc,0xbc,0xbc,0xab,0xbb,0xaa,0x9a,0x18,0x42,0x45,0x44,
+0x33,0x34,0x33,0x33,0x23,0x22,0x11,0x98,0xdb,0xcd,0xcc,0xbb,0xcb,0xbb,0xaa,0x9a,
+0x08,0x31,0x44,0x34,0x35,0x44,0x32,0x33,0x33,0x22,0x32,0x12,0x01,0xda,0xcd,0xbc,
+0xbc,0xac,0xbb,0xab,0x8a,0x20,0x53,0x43,0x43,0x53,0x33,0x25,0x33,0x22,0x32,0x22,
+0x32,0x00,0xda,0xdc,0xdb,0xbb,0xcb,0xbb,0xab,0x9a,0x18,0x32,0x44,0x34,0x35,0x34,
+0x34,0x33,0x32,0x22,0x12,0x02,0xa8,0xdc,0xcc,0xbc,0xbc,0xac,0xbb,0xba,0x9a,0x89,
+0x11,0x42,0x54,0x43,0x53,0x32,0x33,0x24,0x21,0x01,0x90,0xb9,0xcc,0xcc,0xcb,0xcb,
+0xbb,0xbb,0xac,0x9a,0x99,0x08,0x21,0x54,0x53,0x43,0x33,0x34,0x32,0x13,0x11,0x99,
+0xcb,0xcc,0xdb,0xbb,0xbd,0xcb,0xba,0xaa,0xaa,0xaa,0x9a,0x18,0x63,0x35,0x44,0x33,
+0x43,0x32,0x22,0x01,0xa9,0xcc,0xbc,0xcb,0xbc,0xcb,0xac,0xbb,0xab,0xaa,0x9a,0x8a,
+0x20,0x54,0x44,0x34,0x24,0x33,0x33,0x23,0x11,0x91,0xa9,0xdc,0xdb,0xdb,0xbb,0xbc,
+0xbb,0xbb,0xaa,0x89,0x21,0x54,0x43,0x44,0x33,0x34,0x43,0x22,0x22,0x21,0x11,0x00,
+0xa8,0xcd,0xcc,0xcb,0xcb,0xba,0xba,0xaa,0x08,0x42,0x44,0x43,0x43,0x33,0x25,0x33,
+0x14,0x12,0x11,0x21,0x21,0x80,0xdb,0xcd,0xbc,0xcb,0xba,0xba,0xaa,0x8a,0x20,0x53,
+0x44,0x43,0x34,0x43,0x33,0x33,0x23,0x13,0x01,0xa8,0xdb,0xbd,0xcd,0xbb,0xad,0xab,
+0xaa,0xaa,0x9a,0x88,0x20,0x63,0x34,0x35,0x24,0x24,0x22,0x12,0x11,0x80,0xa9,0xbd,
+0xbd,0xbc,0xbc,0xbc,0xbb,0xac,0xa9,0x89,0x9a,0x99,0x20,0x55,0x44,0x33,0x33,0x24,
+0x33,0x12,0xa0,0xdd,0xdb,0xbb,0xac,0xbb,0xac,0xbb,0xbb,0xab,0x89,0x52,0x45,0x34,
+0x33,0x24,0x33,0x34,0x23,0x13,0x11,0x31,0x33,0x14,0xa0,0xdd,0xbc,0xbc,0xab,0xbb,
+0xab,0xa9,0xba,0xac,0x8b,0x51,0x36,0x35,0x33,0x33,0x33,0x23,0x82,0xda,0xbd,0xbd,
+0xac,0xac,0xcb,0xba,0xaa,0x9a,0x99,0x98,0x00,0x41,0x45,0x53,0x43,0x33,0x33,0x23,
+0x13,0x11,0x99,0xcc,0xcd,0xcb,0xcb,0xbb,0xcb,0xab,0xab,0x99,0x88,0x21,0x53,0x35,
+0x45,0x33,0x24,0x33,0x22,0x12,0x01,0x80,0xa9,0xcc,0xcd,0xcb,0xac,0xbb,0xab,0xab,
+0x9a,0x08,0x43,0x54,0x53,0x33,0x34,0x43,0x23,0x23,0x11,0x01,0x00,0x98,0xda,0xdc,
+0xbc,0xbc,0xbb,0xbb,0xab,0xaa,0x10,0x73,0x53,0x43,0x43,0x32,0x43,0x23,0x23,0x11,
+0x10,0x80,0x80,0xca,0xcd,0xcc,0xac,0xbb,0xbb,0xaa,0xaa,0x08,0x41,0x45,0x53,0x33,
+0x34,0x43,0x32,0x22,0x12,0x00,0x88,0xb9,0xeb,0xcc,0xbc,0xbc,0xac,0xab,0x9a,0x9a,
+0x08,0x30,0x63,0x34,0x34,0x44,0x32,0x33,0x23,0x12,0x01,0x98,0xdb,0xcc,0xcc,0xbb,
+0xbc,0xcb,0xba,0xaa,0x89,0x09,0x01,0x42,0x53,0x44,0x43,0x43,0x22,0x22,0x21,0x10,
+0x98,0xdb,0xcc,0xbc,0xdb,0xba,0xac,0xab,0xab,0x99,0x80,0x00,0x12,0x44,0x54,0x43,
+0x43,0x22,0x22,0x22,0x01,0x98,0xdb,0xbc,0xbc,0xbc,0xcb,0xcb,0xcb,0xba,0xaa,0xba,
+0xba,0xcb,0x9a,0x08,0x31,0x35,0x44,0x43,0x44,0x43,0x23,0x33,0x32,0x22,0x23,0x22,
+0x01,0x98,0xca,0xcc,0xbc,0xbd,0xbc,0xbc,0xbc,0xcb,0xba,0xba,0xaa,0xaa,0x89,0x20,
+0x45,0x35,0x25,0x24,0x33,0x44,0x32,0x24,0x22,0x21,0x32,0x43,0x33,0x13,0x80,0xbb,
+0xcd,0xcb,0xcc,0xcc,0xba,0xaa,0x89,0x98,0x99,0x9a,0x8a,0x20,0x44,0x43,0x43,0x35,
+0x36,0x34,0x33,0x33,0x33,0x32,0x22,0x22,0x80,0x98,0xba,0xbc,0xcd,0xcc,0xcc,0xdb,
+0xbb,0xbb,0xbb,0xbb,0xac,0xbb,0x9a,0x09,0x31,0x44,0x34,0x35,0x35,0x44,0x32,0x33,
+0x23,0x22,0x21,0x21,0x12,0x98,0xeb,0xdb,0xbb,0xdc,0xcc,0xcc,0xbb,0xbb,0xaa,0xaa,
+0xbb,0xba,0x09,0x10,0x90,0xda,0xac,0x09,0x73,0x44,0x43,0x23,0x33,0x22,0x33,0x45,
+0x43,0x33,0x02,0xa0,0xba,0xbc,0xcc,0xcc,0xcb,0xaa,0x89,0x10,0x10,0x80,0x89,0x18,
+0x32,0x36,0x44,0x43,0x32,0x11,0x11,0x31,0x45,0x43,0x23,0x11,0x01,0x00,0xb9,0xcf,
+0xbc,0xbd,0xcb,0xbb,0xcc,0xba,0xab,0xab,0xba,0xcb,0xab,0x9a,0x18,0x43,0x44,0x34,
+0x35,0x34,0x34,0x33,0x24,0x12,0x12,0x12,0x11,0x81,0xa9,0xcb,0xcc,0xdb,0xcc,0xcb,
+0xbc,0xab,0xbb,0xba,0xba,0xaa,0x9a,0x18,0x42,0x44,0x44,0x43,0x34,0x43,0x34,0x33,
+0x33,0x33,0x33,0x23,0x33,0x12,0x98,0xeb,0xdb,0xcb,0xcc,0xbc,0xbc,0xbb,0xab,0xaa,
+0x9a,0xa9,0x9a,0x08,0x32,0x46,0x43,0x53,0x53,0x44,0x43,0x33,0x33,0x22,0x22,0x22,
+0x12,0x81,0xb9,0xaa,0xaa,0xba,0xef,0xcc,0xcb,0xbb,0xbb,0xcb,0xba,0x9b,0x0a,0x20,
+0x34,0x34,0x43,0x53,0x34,0x44,0x33,0x43,0x23,0x33,0x33,0x23,0x12,0x81,0xa8,0xdb,
+0xbc,0xcd,0xdb,0xbb,0xad,0xbb,0xac,0xab,0xbb,0xbb,0xaa,0x89,0x21,0x43,0x43,0x44,
+0x34,0x45,0x43,0x33,0x23,0x33,0x23,0x23,0x02,0x90,0xbb,0xbe,0xdb,0xcb,0xbd,0xbc,
+0xbc,0xac,0xcb,0xba,0xcb,0xba,0x9a,0x09,0x00,0x22,0x53,0x53,0x53,0x33,0x33,0x34,
+0x42,0x23,0x43,0x21,0x11,0x01,0x90,0xca,0xce,0xcc,0xbc,0xbb,0xbc,0xbb,0xcb,0xba,
+0xaa,0x9a,0xaa,0xaa,0x8a,0x18,0x53,0x54,0x53,0x43,0x34,0x24,0x33,0x23,0x22,0x22,
+0x22,0x01,0x90,0xca,0xcc,0xbc,0xcc,0xbc,0xcb,0xbb,0xac,0xab,0xbb,0xba,0x9a,0x09,
+0x20,0x63,0x34,0x45,0x34,0x34,0x34,0x33,0x43,0x32,0x22,0x13,0x32,0x42,0x32,0x12,
+0xa8,0xdc,0xcc,0xcb,0xbc,0xbc,0xac,0xaa,0x89,0x88,0x88,0x88,0x10,0x42,0x44,0x33,
+0x35,0x35,0x35,0x34,0x33,0x32,0x22,0x32,0x12,0x02,0x98,0xbb,0xdb,0xdb,0xdb,0xdb,
+0xbc,0xbc,0xcb,0xab,0xab,0xba,0xaa,0x9b,0x89,0x21,0x53,0x34,0x45,0x34,0x35,0x43,
+0x23,0x23,0x22,0x12,0x01,0x00,0x88,0xba,0xdd,0xcb,0xbc,0xcc,0xbc,0xbd,0xac,0xab,
+0xaa,0xa9,0xaa,0x99,0x18,0x32,0x23,0x98,0xab,0x38,0x77,0x34,0x34,0x32,0x23,0x22,
+0x22,0x33,0x45,0x43,0x02,0xa0,0xcb,0xcc,0xcb,0xdb,0xbb,0xab,0x89,0x10,0x11,0x11,
+0x11,0x42,0x43,0x44,0x34,0x35,0x33,0x23,0x01,0x10,0x32,0x35,0x23,0x01,0x98,0x9a,
+0xcc,0xce,0xcd,0xcb,0xca,0xba,0xbb,0xcb,0xba,0x9a,0xaa,0x9a,0x9a,0x08,0x31,0x55,
+0x53,0x43,0x34,0x34,0x43,0x22,0x23,0x12,0x12,0x00,0x80,0xa8,0xcb,0xcc,0xcc,0xcb,
+0xbc,0xbc,0xbc,0xbb,0xba,0xaa,0xaa,0x9a,0x09,0x21,0x35,0x45,0x43,0x34,0x35,0x43,
+0x33,0x33,0x23,0x33,0x32,0x22,0x01,0x80,0xba,0xcd,0xdc,0xdb,0xcb,0xcb,0xcb,0xaa,
+0xaa,0x9a,0x99,0x88,0x10,0x31,0x53,0x44,0x43,0x53,0x43,0x34,0x34,0x24,0x23,0x21,
+0x21,0x11,0x00,0x98,0xba,0xbc,0xbb,0xcc,0xdc,0xbc,0xbc,0xbb,0xab,0xbb,0xac,0x9a,
+0x08,0x52,0x43,0x43,0x33,0x35,0x34,0x44,0x23,0x33,0x32,0x33,0x43,0x12,0x01,0x98,
+0xca,0xbb,0xcd,0xcc,0xbc,0xbc,0xcb,0xba,0xba,0xab,0xab,0xab,0x89,0x11,0x53,0x53,
+0x43,0x53,0x53,0x43,0x33,0x33,0x33,0x32,0x32,0x12,0x81,0xb9,0xce,0xcb,0xcb,0xbc,
+0xcc,0xcb,0xbb,0xac,0xba,0xbb,0xbc,0xba,0x9a,0x00,0x32,0x34,0x44,0x44,0x53,0x33,
+0x24,0x21,0x12,0x22,0x33,0x12,0x01,0x99,0xb9,0xec,0xdc,0xcc,0xbc,0xcb,0xba,0xba,
+0xba,0xab,0xab,0xaa,0x99,0x88,0x18,0x41,0x44,0x45,0x34,0x44,0x33,0x43,0x32,0x22,
+0x21,0x21,0x00,0x88,0xba,0xcc,0xcc,0xdb,0xdb,0xbb,0xac,0xbb,0xaa,0xba,0xba,0xab,
+0x89,0x21,0x53,0x53,0x44,0x44,0x34,0x34,0x33,0x33,0x43,0x32,0x22,0x12,0x11,0x11,
+0x21,0x81,0xd9,0xdd,0xbc,0xcc,0xbb,0xbc,0xba,0xab,0x89,0x18,0x10,0x22,0x32,0x45,
+0x34,0x35,0x34,0x35,0x43,0x24,0x23,0x32,0x12,0x12,0x11,0x80,0xaa,0xbc,0xcc,0xcb,
+0xcc,0xdb,0xbb,0xac,0xcb,0xaa,0xaa,0x9a,0x99,0x88,0x20,0x32,0x45,0x44,0x34,0x34,
+0x34,0x24,0x23,0x32,0x12,0x01,0x80,0xa9,0xaa,0xcc,0xcc,0xcc,0xcb,0xcb,0xbc,0xbc,
+0xac,0xab,0x9a,0x9a,0x99,0x89,0x20,0x34,0x34,0x11,0x01,0x32,0x46,0x44,0x33,0x33,
+0x33,0x23,0x11,0x21,0x53,0x34,0x13,0xc8,0xce,0xbc,0xac,0xcb,0xab,0xab,0x8a,0x20,
+0x32,0x24,0x32,0x43,0x34,0x45,0x43,0x34,0x23,0x13,0x01,0x08,0x10,0x32,0x23,0xa0,
+0xda,0xcb,0xdb,0xcd,0xdc,0xbb,0xbc,0xbb,0xbb,0xbb,0xbb,0xab,0x9a,0x89,0x10,0x22,
+0x45,0x35,0x45,0x53,0x42,0x22,0x23,0x32,0x22,0x22,0x11,0x88,0xa9,0xca,0xcc,0xdb,
+0xbc,0xcc,0xbb,0xbc,0xac,0xab,0xaa,0xaa,0xa9,0x88,0x11,0x53,0x53,0x43,0x44,0x53,
+0x33,0x43,0x32,0x32,0x32,0x22,0x22,0x00,0x99,0xaa,0xbc,0xdd,0xdb,0xbc,0xbc,0xac,
+0xbb,0xab,0xab,0xa9,0x08,0x10,0x33,0x44,0x34,0x44,0x34,0x35,0x43,0x43,0x33,0x24,
+0x23,0x22,0x11,0x00,0x88,0xaa,0xcc,0xbb,0xcc,0xdb,0xcb,0xcb,0xbb,0xac,0xaa,0xba,
+0xaa,0x99,0x20,0x45,0x53,0x33,0x34,0x35,0x43,0x43,0x32,0x22,0x22,0x32,0x22,0x12,
+0x90,0xca,0xbc,0xbd,0xbd,0xbd,0xbc,0xbc,0xba,0xab,0xbb,0xab,0xab,0x8a,0x10,0x43,
+0x35,0x35,0x44,0x43,0x34,0x33,0x24,0x33,0x22,0x13,0x12,0x01,0x99,0xcc,0xdb,0xbc,
+0xcc,0xcb,0xcb,0xac,0xab,0xba,0xba,0xca,0xba,0xba,0x88,0x21,0x34,0x35,0x44,0x34,
+0x44,0x33,0x23,0x12,0x22,0x21,0x23,0x01,0x98,0xcb,0xbc,0xcd,0xdc,0xeb,0xbb,0xcb,
+0xba,0xaa,0xaa,0xaa,0xaa,0x89,0x00,0x21,0x21,0x44,0x54,0x44,0x43,0x24,0x33,0x42,
+0x22,0x12,0x02,0x00,0x98,0xaa,0xbc,0xbd,0xcc,0xbc,0xcc,0xca,0xaa,0xaa,0xa9,0xa9,
+0xa9,0x89,0x10,0x42,0x53,0x43,0x34,0x45,0x34,0x43,0x33,0x32,0x32,0x32,0x12,0x02,
+0x80,0x88,0x00,0x98,0xed,0xdc,0xcb,0xac,0xbb,0xac,0xba,0xba,0x89,0x20,0x42,0x43,
+0x33,0x53,0x34,0x44,0x43,0x33,0x24,0x24,0x32,0x22,0x21,0x01,0x80,0xa8,0xbb,0xcd,
+0xdb,0xbc,0xcc,0xbb,0xbc,0xba,0xbb,0xac,0xaa,0x9a,0x18,0x11,0x43,0x53,0x53,0x44,
+0x43,0x43,0x33,0x32,0x33,0x23,0x22,0x80,0xb9,0xcc,0xbb,0xcc,0xbc,0xcd,0xbb,0xbc,
+0xbc,0xcb,0xcb,0xab,0x9b,0x99,0x88,0x10,0x31,0x35,0x44,0x22,0x21,0x31,0x53,0x43,
+0x24,0x23,0x23,0x11,0x80,0x89,0x31,0x44,0x02,0xfb,0xcd,0xbc,0xba,0xac,0xab,0xbb,
+0x8a,0x31,0x54,0x33,0x43,0x32,0x53,0x53,0x43,0x33,0x24,0x12,0x00,0x99,0x88,0x00,
+0x80,0xb9,0xcd,0xbb,0xbc,0xce,0xeb,0xbb,0xac,0xab,0xaa,0xab,0xba,0x9a,0x09,0x20,
+0x32,0x44,0x53,0x44,0x53,0x33,0x34,0x33,0x33,0x32,0x23,0x12,0x81,0xaa,0xbc,0xbc,
+0xcd,0xcc,0xdb,0xbb,0xcb,0xab,0xbb,0xac,0xab,0x9a,0x09,0x20,0x42,0x53,0x34,0x44,
+0x34,0x34,0x34,0x23,0x33,0x32,0x32,0x22,0x01,0x99,0xbb,0xcc,0xbc,0xbe,0xbd,0xcc,
+0xba,0xbb,0xab,0xbb,0xbb,0x99,0x10,0x42,0x34,0x34,0x44,0x34,0x35,0x43,0x43,0x33,
+0x33,0x34,0x32,0x12,0x01,0x88,0xa9,0xcb,0xbd,0xcd,0xcb,0xbb,0xcb,0xcb,0xba,0xba,
+0xbb,0xaa,0x99,0x10,0x53,0x44,0x44,0x43,0x43,0x43,0x33,0x24,0x23,0x22,0x22,0x21,
+0x11,0x80,0xaa,0xbd,0xbd,0xbd,0xcc,0xbc,0xcb,0xbb,0xba,0xab,0xbb,0xaa,0x89,0x10,
+0x42,0x34,0x45,0x53,0x43,0x24,0x43,0x22,0x23,0x23,0x32,0x21,0x01,0x98,0xca,0xeb,
+0xdb,0xcb,0xbc,0xbc,0xbc,0xcb,0xaa,0xab,0xaa,0xab,0xaa,0x99,0x10,0x43,0x45,0x34,
+0x44,0x34,0x43,0x33,0x22,0x22,0x11,0x11,0x01,0x98,0xba,0xcd,0xcb,0xeb,0xbc,0xbd,
+0xbc,0xac,0xaa,0xaa,0xaa,0xaa,0x89,0x10,0x31,0x33,0x53,0x63,0x53,0x34,0x34,0x33,
+0x43,0x32,0x22,0x13,0x01,0x98,0xba,0xcc,0xdb,0xdb,0xcb,0xbc,0xbc,0xbb,0xbb,0xab,
+0xab,0xaa,0x99,0x10,0x42,0x44,0x53,0x43,0x44,0x34,0x34,0x24,0x23,0x22,0x22,0x22,
+0x02,0x91,0xa9,0xba,0xbb,0xbc,0xcf,0xcc,0xcb,0xcb,0xaa,0xab,0xab,0x9b,0x0a,0x31,
+0x35,0x44,0x32,0x34,0x35,0x34,0x24,0x33,0x24,0x23,0x33,0x23,0x12,0x81,0xa9,0xcb,
+0xcc,0xcc,0xdb,0xcb,0xbb,0xbc,0xab,0xac,0xba,0xab,0x9a,0x09,0x21,0x34,0x53,0x34,
+0x45,0x43,0x24,0x33,0x33,0x24,0x22,0x22,0x11,0x90,0xcb,0xcb,0xbc,0xdb,0xbc,0xbd,
+0xbc,0xba,0xac,0xbb,0xbc,0xbb,0xaa,0x88,0x11,0x31,0x53,0x35,0x35,0x24,0x32,0x21,
+0x32,0x42,0x33,0x33,0x22,0x81,0xc9,0xbb,0xaa,0x88,0xea,0xde,0xbd,0xbc,0xab,0xab,
+0xcb,0xba,0x99,0x31,0x45,0x24,0x43,0x32,0x43,0x34,0x25,0x33,0x33,0x22,0x81,0x88,
+0x99,0x89,0xa9,0xdb,0xbd,0xcc,0xcb,0xeb,0xcb,0xcb,0xba,0xaa,0x9b,0xab,0x9a,0x89,
+0x20,0x43,0x43,0x33,0x36,0x44,0x34,0x43,0x32,0x23,0x23,0x32,0x12,0x01,0xa9,0xbc,
+0xcd,0xbb,0xbd,0xcc,0xbc,0xbb,0xcb,0xba,0xba,0xbb,0xba,0x89,0x20,0x53,0x43,0x44,
+0x34,0x44,0x43,0x43,0x32,0x22,0x23,0x22,0x22,0x01,0x88,0xba,0xbd,0xdb,0xdb,0xcc,
+0xdb,0xba,0xcb,0xaa,0xba,0xba,0xaa,0x89,0x10,0x12,0x11,0x01,0x10,0x11,0x21,0x00,
+0x80,0x41,0x56,0x34,0x34,0x12,0x11,0x01,0x10,0x80,0x98,0x08,0x63,0x46,0x43,0x23,
+0x11,0x11,0x11,0x11,0x00,0x80,0x20,0x46,0x45,0x33,0x23,0x12,0x11,0x11,0x21,0x10,
+0x21,0x43,0x45,0x43,0x33,0x22,0x11,0x21,0x22,0x02,0x80,0x10,0x56,0x44,0x24,0x12,
+0x11,0x21,0x32,0x23,0x11,0x80,0x99,0xcc,0xbd,0xbc,0x8a,0x00,0x88,0xa9,0x29,0x65,
+0x33,0xa0,0xde,0xbb,0xab,0x09,0x08,0x08,0x31,0x54,0x12,0xe9,0xdd,0xcb,0xbb,0xaa,
+0x89,0x88,0x10,0x11,0x33,0x02,0xfb,0xde,0xdb,0xaa,0x9a,0x80,0x80,0x80,0x18,0x33,
+0x03,0xfe,0xcd,0xcb,0x9a,0x89,0x00,0x88,0x00,0x11,0x23,0x91,0xec,0xcb,0xab,0x89,
+0x00,0x01,0x11,0x31,0x32,0x02,0xc8,0xcc,0xab,0x89,0x10,0x43,0x34,0x33,0x22,0x33,
+0x56,0x54,0x34,0x33,0x33,0x11,0x12,0x22,0x32,0x11,0x32,0x77,0x44,0x34,0x23,0x22,
+0x20,0x22,0x33,0x81,0xa9,0x48,0x77,0x35,0x24,0x12,0x01,0x00,0x11,0x01,0x88,0x89,
+0x63,0x46,0x43,0x13,0x11,0x80,0x10,0x10,0x80,0x88,0x18,0x63,0x53,0x32,0x11,0x11,
+0x00,0x08,0x89,0x88,0x20,0x33,0x43,0x22,0x44,0x34,0x14,0xa0,0xca,0x9b,0x08,0x01,
+0xc9,0xce,0xac,0xac,0xaa,0xa9,0x99,0x00,0x22,0x82,0xfc,0xce,0xbc,0xbb,0x9b,0x89,
+0x99,0xa9,0x09,0x53,0x03,0xfd,0xce,0xac,0xaa,0x88,0x88,0x98,0x88,0x30,0x23,0xf9,
+0xde,0xbc,0xbb,0x9b,0x89,0x08,0x80,0x00,0x88,0x18,0x73,0x47,0x53,0x22,0x11,0x00,
+0x08,0x11,0x00,0x98,0x18,0x73,0x36,0x43,0x12,0x01,0x08,0x00,0x00,0x00,0x98,0xda,
+0xce,0xbc,0xcb,0x99,0x88,0x80,0x88,0x89,0x18,0x10,0xc8,0xdc,0xac,0x9a,0x08,0x80,
+0x98,0x89,0x18,0x21,0x91,0xdd,0xbc,0x9c,0x8a,0x80,0x80,0x88,0x08,0x21,0x23,0xa1,
+0xfb,0xad,0x9b,0x18,0x21,0x12,0x80,0x00,0x20,0x91,0xed,0xbc,0x9c,0x09,0x00,0x01,
+0x08,0x21,0x35,0x24,0x43,0x44,0x45,0x43,0x22,0x02,0x11,0x11,0x11,0x88,0x89,0x72,
+0x45,0x24,0x13,0x00,0x01,0x22,0x23,0x88,0x8a,0x72,0x57,0x43,0x22,0x02,0x01,0x11,
+0x11,0x90,0xba,0x19,0x77,0x34,0x34,0x22,0x01,0x00,0x00,0x00,0x89,0x0a,0x50,0x45,
+0x44,0x22,0x12,0x01,0x01,0x01,0x88,0x99,0x09,0x72,0x44,0x43,0x12,0x01,0x08,0x08,
+0x00,0x80,0x99,0x09,0x72,0x34,0x22,0x81,0x99,0x09,0x01,0xb8,0xce,0xac,0x10,0x45,
+0x33,0x81,0xec,0xbc,0xbc,0xab,0x99,0x88,0x98,0xb9,0xbc,0xac,0xab,0xaa,0xba,0xba,
+0xab,0x89,0x00,0xba,0xef,0xbc,0xbc,0xbb,0x99,0x89,0x88,0x00,0x11,0xb0,0xff,0xaf,
+0xac,0xab,0x89,0x98,0x99,0x9a,0x18,0x33,0xb2,0xff,0xbd,0xab,0x8a,0x08,0x80,0x98,
+0x18,0x31,0x82,0xfc,0xbf,0xbc,0x9b,0x89,0x08,0x80,0x88,0x08,0x00,0xa0,0xcd,0xbd,
+0xab,0x8a,0x00,0x80,0x98,0x98,0x11,0x23,0xa8,0xcf,0xcb,0x9a,0x08,0x80,0x80,0x11,
+0x43,0x33,0x43,0x54,0x45,0x53,0x22,0x11,0x00,0x21,0x12,0x81,0x08,0x73,0x37,0x35,
+0x33,0x11,0x10,0x20,0x21,0x01,0x99,0x58,0x66,0x35,0x25,0x13,0x02,0x00,0x08,0x80,
+0x98,0x88,0x41,0x56,0x34,0x24,0x11,0x00,0x18,0x10,0x80,0xb9,0xaa,0x31,0x47,0x33,
+0x12,0x88,0x09,0x00,0x01,0x98,0x99,0x28,0x53,0x23,0x11,0x11,0x11,0x80,0xcc,0xad,
+0xba,0xda,0xdc,0xcc,0xbc,0xbb,0xaa,0xa9,0x98,0x9a,0xa9,0x99,0xca,0xee,0xdc,0xdb,
+0xaa,0x89,0x88,0x80,0x89,0x18,0x11,0xfb,0xdf,0xcb,0xab,0x88,0x08,0x98,0xa9,0x08,
+0x33,0x92,0xff,0xcc,0xac,0x9b,0x8a,0x88,0x00,0x08,0x98,0x89,0x51,0x55,0x44,0x23,
+0x12,0x01,0x00,0x01,0x00,0x98,0x08,0x64,0x54,0x33,0x23,0x02,0x80,0x88,0x00,0x11,
+0x01,0xd9,0xcf,0xbc,0xbc,0x99,0x89,0x08,0x99,0x98,0x18,0x00,0xb8,0xdd,0xbc,0xaa,
+0x89,0x88,0x90,0x88,0x00,0x01,0x80,0xeb,0xcc,0xac,0xab,0x8a,0x09,0x00,0x10,0x21,
+0x12,0x91,0xdc,0xbc,0xaa,0x08,0x01,0xa8,0x99,0x52,0x54,0x12,0xa9,0xdc,0xba,0xa9,
+0x89,0x18,0x32,0x45,0x21,0x08,0x18,0x65,0x44,0x24,0x22,0x11,0x11,0x01,0x81,0x90,
+0x41,0x45,0x35,0x32,0x11,0x11,0x32,0x34,0x12,0xb8,0xab,0x72,0x67,0x33,0x24,0x11,
+0x80,0x00,0x21,0x11,0x88,0x0a,0x73,0x47,0x43,0x22,0x02,0x00,0x11,0x01,0xa0,0xaa,
+0x18,0x57,0x35,0x32,0x11,0x88,0x08,0x11,0x02,0xa8,0xbb,0x29,0x67,0x43,0x33,0x01,
+0x80,0x88,0x80,0x90,0xb9,0xba,0x10,0x55,0x43,0x11,0x88,0x88,0x10,0x02,0xc9,0xdc,
+0xaa,0x21,0x37,0x23,0x81,0xb9,0xba,0x99,0x08,0xa9,0xdc,0xdc,0xdb,0xbc,0xbb,0x9b,
+0x89,0x00,0xa9,0xcb,0xac,0xcb,0xcb,0xbd,0xac,0x9b,0xa9,0xa9,0xbb,0x9b,0x10,0x91,
+0xff,0xbf,0xbc,0x9b,0x89,0x88,0x98,0xa9,0x89,0x10,0xb8,0xff,0xbc,0xbb,0x9a,0x88,
+0x98,0x9a,0x8a,0x32,0x23,0xfa,0xef,0xcb,0xaa,0x89,0x88,0x88,0x89,0x08,0x11,0x81,
+0xeb,0xcc,0xab,0x89,0x18,0x80,0x98,0x89,0x21,0x25,0x82,0xdb,0xbd,0xab,0x08,0x22,
+0x02,0x01,0x00,0x31,0x52,0x53,0x45,0x34,0x24,0x21,0x08,0x08,0x21,0x23,0x22,0x52,
+0x46,0x45,0x43,0x12,0x01,0x10,0x11,0x11,0x98,0x89,0x73,0x57,0x33,0x24,0x01,0x00,
+0x00,0x01,0x01,0x88,0x10,0x55,0x45,0x33,0x23,0x11,0x00,0x18,0x08,0x80,0x89,0x18,
+0x54,0x44,0x23,0x12,0x01,0x88,0x89,0xa9,0xaa,0x9a,0x18,0x64,0x44,0x32,0x01,0xa9,
+0xbb,0x9c,0x09,0x98,0xeb,0xcd,0xbb,0xcb,0xba,0xaa,0xa9,0xa9,0x89,0x89,0xdb,0xde,
+0xcd,0xbc,0xab,0x89,0x00,0x90,0xba,0xab,0x10,0xc8,0xff,0xbe,0xbb,0xaa,0x88,0x89,
+0x99,0x08,0x32,0x02,0xfe,0xcd,0xbc,0xba,0x9a,0x88,0x00,0x80,0x98,0x8a,0x40,0x47,
+0x35,0x24,0x12,0x00,0x00,0x01,0x01,0x89,0x09,0x73,0x45,0x33,0x32,0x11,0x00,0x01,
+0x08,0x08,0x00,0xa8,0xee,0xcd,0xcb,0x9b,0x99,0x80,0x80,0x89,0x88,0x10,0x98,0xcd,
+0xdb,0xaa,0x89,0x98,0x98,0x89,0x08,0x11,0x01,0xd9,0xcc,0xbc,0xab,0x9a,0x88,0x80,
+0x80,0x00,0x00,0x91,0xc9,0xbd,0xab,0x09,0x10,0x88,0x08,0x46,0x35,0x82,0xfb,0xcb,
+0x9a,0x08,0x80,0x98,0x09,0x21,0x11,0xba,0x0b,0x77,0x37,0x33,0x03,0x00,0x08,0x12,
+0x23,0x00,0x10,0x64,0x44,0x33,0x22,0x11,0x21,0x23,0x02,0x91,0x21,0x57,0x36,0x26,
+0x24,0x12,0x01,0x80,0x10,0x11,0x01,0x88,0x51,0x57,0x34,0x33,0x22,0x00,0x10,0x21,
+0x81,0xba,0xab,0x73,0x57,0x32,0x12,0x81,0x88,0x00,0x11,0x12,0x00,0x22,0x45,0x35,
+0x33,0x13,0x81,0x80,0x08,0x00,0x80,0x99,0x09,0x73,0x24,0x13,0x81,0x98,0x00,0xa0,
+0xfc,0xcb,0x09,0x63,0x34,0x13,0x98,0xbb,0xac,0x19,0x21,0x11,0xd8,0xcd,0xbd,0xbb,
+0x9b,0x98,0xc9,0xdb,0xbb,0x89,0x11,0xa0,0xde,0xbc,0xab,0x89,0x99,0xbb,0xad,0x09,
+0x43,0x03,0xfa,0xce,0xbb,0x9c,0x8a,0x89,0x99,0x8a,0x19,0x20,0xa8,0xdf,0xcd,0xbb,
+0xaa,0x09,0x08,0x80,0x89,0x08,0x12,0xb0,0xff,0xbe,0xbb,0xaa,0x89,0x00,0x08,0x88,
+0x88,0x81,0xb8,0xdd,0xbc,0xba,0x99,0x88,0x88,0x80,0x00,0x00,0xb9,0xbe,0xad,0xba,
+0x98,0x80,0x08,0x10,0x08,0xa9,0x19,0x77,0x45,0x34,0x22,0x00,0x88,0x20,0x32,0x12,
+0x98,0x48,0x77,0x34,0x34,0x12,0x80,0x88,0x11,0x12,0x01,0x99,0x40,0x77,0x34,0x24,
+0x12,0x00,0x88,0x10,0x11,0x90,0x89,0x51,0x47,0x34,0x12,0xa0,0xbb,0xbb,0x89,0x89,
+0xba,0xab,0x40,0x55,0x22,0x01,0x99,0x89,0x20,0x01,0x90,0xaa,0x29,0x72,0x32,0x12,
+0x10,0x89,0x89,0x08,0x21,0x10,0xdd,0xce,0xac,0x9b,0x09,0x08,0xa9,0xcc,0xab,0x0b,
+0x19,0x98,0xde,0xcd,0xac,0x9b,0x9a,0x98,0x88,0x18,0x22,0xb0,0xff,0xbf,0xab,0x9a,
+0x08,0x80,0x99,0x9b,0x28,0x22,0xfa,0xef,0xcb,0xaa,0x9a,0x88,0x00,0x08,0x99,0x99,
+0x20,0x47,0x45,0x33,0x22,0x11,0x00,0x00,0x11,0x90,0x99,0x50,0x55,0x44,0x23,0x12,
+0x01,0x01,0x00,0x00,0x00,0x99,0xfb,0xcd,0xbc,0xbb,0x9a,0x08,0x88,0x98,0x99,0x00,
+0x88,0xdb,0xcd,0xbb,0xaa,0x98,0x88,0x99,0x08,0x21,0x81,0xfb,0xbe,0xcb,0x9a,0x89,
+0x88,0x88,0x18,0x21,0x43,0x13,0xa8,0xcd,0xbc,0xab,0x9a,0x10,0x42,0x34,0x33,0x01,
+0xa9,0xdc,0xcc,0xcb,0x9a,0x28,0x53,0x23,0x91,0xcb,0x89,0x73,0x44,0x22,0x81,0x08,
+0x10,0x33,0x24,0x81,0xba,0x9a,0x42,0x46,0x33,0x33,0x22,0x20,0x20,0x98,0xba,0x2b,
+0x77,0x37,0x34,0x13,0x81,0x80,0x10,0x32,0x12,0x80,0x30,0x77,0x53,0x33,0x22,0x01,
+0x10,0x00,0x80,0x98,0x09,0x62,0x46,0x34,0x33,0x12,0x80,0x98,0x88,0x80,0x81,0x10,
+0x73,0x36,0x25,0x23,0x81,0x88,0x80,0x10,0xa8,0xeb,0xaa,0x20,0x45,0x23,0x12,0x00,
+0x80,0xa8,0xdc,0xcb,0x89,0x42,0x43,0x12,0x90,0x08,0x10,0x00,0xaa,0x1b,0x73,0x13,
+0xec,0xce,0xaa,0x09,0x01,0x90,0xcc,0x9b,0x28,0x24,0xa2,0xec,0xbb,0x9a,0x00,0x98,
+0xcb,0xaa,0x31,0x35,0xb1,0xee,0xcb,0x9b,0x0a,0x08,0x00,0x88,0x08,0x18,0x80,0xfa,
+0xdd,0xdb,0xab,0x8a,0x08,0x80,0xa8,0xbb,0x09,0x01,0xfa,0xcf,0xbc,0x9c,0x89,0x00,
+0x08,0x88,0x00,0x01,0xa8,0xdd,0xbc,0x9b,0x09,0x00,0x88,0x98,0x08,0x21,0x01,0xca,
+0xbd,0xbb,0x09,0x18,0x18,0x00,0x98,0xa0,0x48,0x77,0x44,0x24,0x13,0x01,0x88,0x20,
+0x53,0x22,0x90,0xa9,0x61,0x46,0x44,0x22,0x11,0x80,0x00,0x00,0x98,0x88,0x71,0x55,
+0x43,0x33,0x12,0x11,0x21,0x21,0x81,0xba,0x8b,0x73,0x47,0x33,0x23,0x11,0x01,0x10,
+0x01,0x90,0x98,0x09,0x41,0x54,0x34,0x23,0x02,0xb9,0xbc,0x8a,0x21,0x14,0xa0,0xcb,
+0x19,0x46,0x24,0x90,0xbc,0x9c,0x18,0x32,0x82,0xdc,0xcc,0x9a,0x09,0x88,0x99,0xba,
+0xab,0x88,0x80,0xdb,0xcf,0xcc,0xaa,0x9a,0x99,0xa9,0xac,0x9b,0x20,0x82,0xfc,0xcf,
+0xbc,0xaa,0x98,0x08,0x88,0x80,0x11,0x91,0xfc,0xcd,0xbc,0xab,0x9a,0x89,0x09,0x08,
+0x00,0x88,0x88,0x61,0x55,0x34,0x24,0x11,0x10,0x00,0x01,0x80,0x99,0x09,0x73,0x45,
+0x33,0x23,0x12,0x00,0x08,0x00,0x11,0x01,0xea,0xce,0xbd,0xbb,0x99,0x08,0x00,0x90,
+0x88,0x88,0x88,0xda,0xcc,0xab,0x9b,0x88,0x88,0x98,0x89,0x11,0x14,0xa2,0xfc,0xdb,
+0xba,0x89,0x18,0x11,0x80,0x98,0x89,0x18,0x20,0x00,0xa9,0xaa,0x02,0x25,0x91,0xbb,
+0x0e,0x30,0x44,0xa1,0xdf,0xbc,0x9c,0x89,0x11,0x02,0x99,0x9b,0x38,0x57,0x43,0x33,
+0x43,0x24,0x24,0x12,0x81,0x98,0x89,0x18,0x73,0x44,0x33,0x14,0x01,0x80,0x08,0x00,
+0xa8,0xaa,0x61,0x57,0x34,0x32,0x11,0x10,0x42,0x33,0x81,0xdb,0x9a,0x72,0x54,0x23,
+0x13,0x01,0x08,0x08,0x08,0x08,0x10,0x62,0x53,0x34,0x34,0x13,0x02,0x80,0x08,0x01,
+0x80,0xba,0x0b,0x75,0x45,0x23,0x81,0x99,0x89,0x10,0x12,0xa0,0xba,0x10,0x24,0x91,
+0xdb,0x0a,0x62,0x13,0xe9,0xbd,0xaa,0x21,0x35,0x12,0x90,0x80,0x80,0xd8,0xcc,0xab,
+0x0a,0x08,0xda,0xbd,0x9b,0x18,0x90,0xfb,0xbc,0x8a,0x22,0x14,0xb8,0xce,0x9a,0x08,
+0x01,0xb9,0xbe,0xab,0x18,0x32,0x02,0xdc,0xcd,0xbc,0xba,0x9a,0x88,0x01,0x00,0x88,
+0xaa,0xcc,0xdd,0xbc,0xad,0xaa,0x88,0x08,0x88,0x88,0x00,0x81,0xfb,0xdd,0xbc,0xbb,
+0xaa,0x88,0x88,0x00,0x00,0x88,0xb9,0xdc,0xbc,0xbb,0x9a,0x88,0x81,0x00,0x08,0x01,
+0xb1,0xee,0xbc,0xac,0x08,0x22,0x11,0xba,0xbb,0x70,0x73,0x32,0x22,0x23,0x35,0x34,
+0x11,0x88,0x9a,0x29,0x42,0x43,0x73,0x63,0x53,0x23,0x22,0x12,0x33,0x32,0x90,0xcc,
+0x8a,0x73,0x36,0x34,0x21,0x00,0x01,0x02,0x81,0xb9,0x9a,0x62,0x37,0x34,0x23,0x01,
+0x10,0x00,0x00,0x80,0x99,0x88,0x10,0x33,0x44,0x53,0x34,0x34,0x01,0xa9,0xbd,0xab,
+0x20,0x34,0x24,0x01,0x99,0x89,0x08,0x11,0x00,0x18,0x1a,0xcf,0xce,0xbd,0xaa,0x89,
+0x00,0x98,0xbd,0xbc,0x98,0x01,0xa8,0xbf,0xad,0xab,0x9a,0xab,0xad,0x9a,0x31,0x34,
+0xd0,0xde,0xcc,0xaa,0x99,0x98,0xb9,0x9a,0x18,0x32,0xa1,0xff,0xbd,0xbb,0xab,0x9a,
+0x88,0x89,0x99,0x88,0x18,0x73,0x45,0x44,0x33,0x22,0x01,0x01,0x00,0x01,0x00,0x21,
+0x64,0x54,0x33,0x23,0x22,0x11,0x00,0x00,0x80,0x98,0xfa,0xcd,0xbd,0xbc,0xaa,0x88,
+0x08,0x88,0x88,0x00,0x01,0xb8,0xde,0xbb,0xab,0x88,0x00,0xb9,0xbb,0x0a,0x53,0x13,
+0xd9,0xdd,0xab,0x9a,0x08,0x10,0x88,0x98,0x88,0x02,0x01,0x89,0x8b,0x18,0x22,0x01,
+0xbb,0x8c,0x41,0x32,0xc1,0xea,0x08,0x42,0x12,0xca,0xac,0x30,0x45,0x90,0xcc,0x0b,
+0x73,0x27,0x03,0x81,0x88,0x32,0x37,0x13,0x90,0xab,0x1a,0x73,0x33,0x23,0x01,0x88,
+0x88,0x98,0x90,0x01,0x46,0x55,0x53,0x32,0x22,0x80,0x9a,0x8a,0x32,0x36,0x34,0x53,
+0x43,0x43,0x32,0x00,0x08,0x30,0x35,0x24,0x01,0x08,0x42,0x54,0x22,0x00,0xaa,0x99,
+0x22,0x12,0xb8,0xcb,0x28,0x67,0x34,0x33,0x33,0x21,0x08,0x98,0x98,0x80,0x11,0x81,
+0x99,0x99,0x10,0x22,0x91,0xab,0x0a,0x31,0x31,0x0a,0xb9,0x10,0x11,0x11,0x29,0x3c,
+0x2c,0x1a,0x10,0x93,0xd3,0xd1,0xa1,0x24,0x14,0xf9,0xce,0xbc,0x9a,0x18,0x21,0x81,
+0xb9,0x8a,0x51,0x32,0xca,0xdf,0xbb,0x9a,0x30,0x22,0xa0,0xdd,0xcb,0x9a,0x88,0x00,
+0x10,0x18,0x08,0xa9,0xec,0xcd,0xbc,0xbb,0x9a,0x00,0x11,0x81,0xd8,0xeb,0xcb,0xcb,
+0xab,0xbb,0xac,0xbc,0xbc,0xaa,0x08,0x12,0x02,0xc9,0xbe,0xac,0x8a,0x18,0x11,0x80,
+0x8a,0x1b,0x31,0x14,0xf9,0xdd,0xbb,0x99,0x21,0x21,0xa0,0xdb,0x19,0x64,0x43,0x02,
+0x80,0x08,0x34,0x36,0x11,0x98,0x9b,0x18,0x53,0x35,0x43,0x33,0x14,0x01,0x99,0x99,
+0x11,0x02,0x90,0x19,0x77,0x37,0x33,0x12,0x80,0x98,0x00,0x80,0x98,0x2a,0x66,0x44,
+0x33,0x02,0x80,0x08,0x01,0x81,0xa9,0x9a,0x41,0x46,0x22,0x02,0x08,0x88,0x88,0x98,
+0x00,0x32,0x02,0xcc,0x9e,0x50,0x45,0x23,0xa0,0xcc,0xab,0x19,0x21,0x01,0xa9,0x99,
+0x11,0x30,0x19,0xaa,0x90,0x29,0x5b,0x61,0x11,0xfd,0xcd,0xaa,0x30,0x55,0x12,0x98,
+0xbc,0x9b,0x9a,0xd9,0xcc,0xab,0x08,0x11,0xb8,0xdd,0x8a,0x31,0x24,0xb8,0xff,0xab,
+0x9a,0x08,0x00,0x98,0xaa,0x99,0x10,0x43,0x35,0x44,0x33,0x24,0x12,0x23,0x12,0x81,
+0xb9,0xab,0x71,0x55,0x43,0x22,0x02,0x00,0x98,0x08,0x08,0x21,0x02,0xfa,0xdd,0xcb,
+0x9b,0x8a,0x00,0x00,0x80,0x88,0x99,0xca,0xea,0xba,0xbb,0xcb,0xaa,0x99,0x89,0x81,
+0x12,0x01,0xa0,0xdc,0xcd,0xbb,0x9b,0x10,0x22,0x00,0xaa,0x0b,0x48,0x21,0x99,0xab,
+0x39,0x52,0xa1,0xda,0x18,0x45,0xa2,0xef,0xbd,0x9b,0x19,0x21,0x01,0xa9,0x9b,0x31,
+0x24,0xb1,0xcd,0x09,0x37,0x36,0x12,0x90,0x99,0x08,0x21,0x11,0xbb,0x9d,0x40,0x46,
+0x33,0x12,0x01,0x88,0x09,0x8b,0x8a,0x63,0x37,0x34,0x21,0x08,0x8a,0x89,0x18,0x10,
+0x21,0x00,0xfb,0xcf,0xcb,0x8a,0x00,0x12,0x80,0x9a,0x1a,0x31,0x13,0xdb,0xcb,0x52,
+0x47,0x23,0x02,0x98,0x8a,0x18,0x11,0x81,0x9a,0x0a,0x21,0x12,0x89,0x0e,0x19,0x03,
+0xb3,0xf3,0x88,0x10,0x02,0xb2,0xb9,0x3d,0x7b,0x29,0x98,0x9a,0x39,0x7a,0x39,0x9b,
+0xba,0x11,0x26,0x92,0xfb,0xba,0x62,0x46,0x24,0x03,0x91,0x99,0x88,0x01,0x02,0xa0,
+0x99,0x18,0x21,0x91,0xf2,0xb0,0x93,0xa4,0x92,0x0a,0x3b,0x40,0x80,0xb1,0xa9,0x39,
+0x49,0x98,0xb1,0x3a,0x3a,0x11,0xa1,0xa9,0x92,0x12,0x29,0x9b,0x19,0x39,0x7b,0x3b,
+0x0b,0x91,0x82,0x91,0xb0,0xa2,0x02,0x21,0x1b,0x0a,0x01,0x21,0x09,0x3b,0x3c,0x3a,
+0x10,0xb0,0xb2,0x21,0x29,0x99,0x09,0x2b,0x10,0x92,0x2a,0x1b,0x29,0x39,0x3b,0x1c,
+0x3a,0x49,0x5b,0x1c,0x09,0x10,0x00,0xb1,0xb1,0x01,0x31,0x90,0xc0,0xb2,0x95,0xa4,
+0xb1,0x19,0x7b,0x10,0x99,0x8f,0x48,0x57,0x43,0x12,0x98,0xbd,0xab,0x8b,0x08,0x10,
+0x08,0x18,0x88,0xa8,0x89,0x31,0x26,0xc1,0xdf,0xbc,0x9b,0x08,0x21,0x00,0x99,0x99,
+0x20,0x20,0xa0,0xc8,0x80,0x12,0x93,0xb1,0xab,0x39,0x32,0x00,0xbb,0x09,0x31,0x92,
+0xd2,0xa0,0x82,0x13,0xb2,0xc1,0xb2,0x04,0x11,0x3c,0x1d,0x08,0x02,0xa0,0xb0,0x29,
+0x39,0x91,0xb1,0x99,0x91,0x04,0x19,0x9b,0x99,0x13,0x93,0xb0,0x9b,0x30,0x32,0x3a,
+0x0f,0x3b,0x30,0x01,0xba,0x8f,0x30,0x42,0x98,0xbe,0x0b,0x75,0x44,0x33,0x12,0x99,
+0x99,0x08,0x21,0x10,0x8a,0x9a,0x10,0x32,0x10,0xbb,0x0e,0x38,0x31,0xa0,0xdb,0xa9,
+0x23,0x17,0x90,0xcc,0x9a,0x74,0x35,0x35,0x12,0x98,0xaa,0x09,0x54,0x44,0x23,0x81,
+0xca,0xac,0x9c,0x89,0x00,0x01,0x80,0x98,0x08,0x29,0x18,0x08,0x0a,0x2a,0x4a,0x18,
+0x99,0xb9,0x11,0x50,0x3b,0x3c,0x2b,0x3a,0x01,0x91,0xb1,0x91,0x11,0x11,0x09,0x1a,
+0x90,0xb3,0x93,0x19,0x3b,0x3b,0x19,0x91,0x09,0x99,0x11,0x11,0x2a,0x2b,0xa9,0x93,
+0x11,0x1a,0x90,0x39,0x3b,0x19,0x1a,0x2a,0x09,0x92,0xa1,0x01,0x3b,0x3a,0x91,0xa1,
+0xb1,0x93,0x21,0x2a,0x9a,0x19,0x5a,0x4b,0x1a,0x0a,0x90,0x92,0x12,0x2b,0x2e,0x29,
+0x18,0xb0,0xa9,0xb1,0xa5,0x94,0x98,0xc0,0x83,0x21,0xb2,0xd0,0x90,0x41,0x39,0xb9,
+0x8c,0x7b,0x30,0x80,0xda,0x8a,0x70,0x32,0xc0,0xdf,0xcb,0x9a,0x88,0x11,0x01,0xa8,
+0x98,0x10,0x11,0x80,0x9a,0x89,0x31,0x30,0xaa,0xb9,0x10,0x31,0x01,0xb9,0x99,0x02,
+0x03,0x09,0x0b,0x19,0xa3,0xb3,0xb3,0xb1,0x13,0x39,0x1b,0xa9,0x92,0x92,0x91,0xa0,
+0xb2,0xb3,0xa4,0x10,0x3b,0x1a,0x11,0x19,0xa9,0xb3,0x03,0x29,0x1b,0x99,0x02,0x19,
+0x09,0x99,0x11,0xb2,0x93,0x3b,0x3d,0x4a,0x2b,0x1a,0x0b,0x10,0x93,0xc2,0xa1,0x39,
+0x11,0xb3,0x90,0x1b,0x10,0x95,0xc2,0xb0,0x10,0x33,0x03,0xeb,0xa8,0x13,0x17,0xa8,
+0xcc,0x19,0x47,0x45,0x22,0x00,0xa8,0x98,0x01,0x01,0x91,0x99,0x98,0x83,0x94,0xa0,
+0x99,0x18,0x23,0xb3,0xc0,0x90,0x32,0x31,0x1b,0xab,0x91,0x94,0x92,0x1b,0x3c,0x5b,
+0x18,0x09,0x1b,0x3b,0x49,0x1a,0xb9,0xb1,0x93,0xa4,0x20,0x3e,0x2b,0x80,0xb2,0xa0,
+0x91,0x11,0x11,0x99,0xa0,0x01,0x02,0xb2,0xb1,0x01,0x01,0x93,0xb1,0xb1,0xa3,0x03,
+0x91,0x99,0x99,0x93,0x93,0xa9,0x99,0x20,0x11,0x91,0xc9,0xb2,0x87,0xa2,0xb0,0x08,
+0x30,0x04,0xd0,0xbb,0x30,0x47,0xa2,0xee,0xbd,0xbb,0x08,0x21,0x11,0xb9,0xab,0x22,
+0x17,0xa1,0xce,0xbc,0xaa,0x80,0x02,0x81,0x89,0x1a,0x28,0x18,0x88,0x9a,0x18,0x31,
+0x90,0x99,0x1b,0x5a,0x29,0x99,0xa0,0x39,0x39,0x09,0x99,0xa9,0xa3,0x13,0x3a,0x2c,
+0x3a,0x39,0x2a,0x9a,0x19,0x10,0x01,0xa1,0x91,0x10,0x39,0x2a,0x1b,0x99,0xb3,0x93,
+0x91,0x99,0x19,0xa2,0xb3,0x91,0x19,0x91,0xa3,0x01,0x2b,0x3a,0x29,0x2a,0x9b,0x91,
+0x11,0x30,0x1b,0x2b,0x3b,0x39,0x3b,0x1b,0x0a,0x93,0x93,0x2a,0x1d,0x29,0x91,0xc3,
+0xb1,0x01,0x13,0x21,0xb9,0xb9,0x30,0x23,0xb1,0xdb,0x00,0x33,0x85,0xfa,0x9b,0x71,
+0x46,0x24,0x02,0x90,0x9a,0x18,0x22,0x81,0xdb,0x9a,0x73,0x44,0x33,0x01,0x98,0x99,
+0x10,0x10,0x00,0x8a,0x09,0x11,0x92,0xc1,0xb0,0x93,0x31,0x00,0xb9,0xb1,0x32,0x39,
+0x0b,0xb9,0xa2,0x13,0x11,0x1b,0x9a,0x93,0x31,0x2b,0x9b,0xa1,0x03,0xa3,0x90,0xb0,
+0xa3,0x03,0x01,0x1b,0x3b,0x39,0x19,0x99,0xb0,0x02,0x30,0x2a,0xaa,0x01,0x20,0x01,
+0xb1,0xb1,0x11,0x31,0x90,0xa0,0x2a,0x19,0x93,0xb2,0xa0,0x3a,0x39,0x01,0xa9,0xc1,
+0xb3,0x87,0x81,0x1a,0x2b,0x39,0x13,0xb2,0xbb,0xb0,0x86,0xa4,0xe3,0xa8,0x10,0x43,
+0x83,0xfc,0xbe,0xbc,0x9a,0x10,0x21,0x00,0x9a,0x9a,0x11,0x13,0xa2,0xe9,0x09,0x50,
+0x30,0x0a,0x9d,0x09,0x33,0x04,0xd9,0xab,0x49,0x44,0x93,0xfa,0xbe,0xbb,0xaa,0x80,
+0x10,0x20,0x11,0xb9,0xbc,0x2b,0x47,0x14,0xf9,0xce,0xbc,0x9a,0x52,0x46,0x54,0x43,
+0x53,0x43,0x34,0x43,0x24,0x33,0x33,0x33,0x23,0x23,0x22,0x12,0xa0,0xda,0xbc,0xbd,
+0xcb,0xcc,0xbc,0xbd,0xcb,0xbb,0xbb,0xcb,0xab,0xbb,0xbb,0xaa,0x99,0x18,0x31,0x45,
+0x34,0x34,0x35,0x43,0x34,0x34,0x43,0x33,0x32,0x23,0x22,0x22,0x12,0x00,0xa9,0xcc,
+0xcc,0xcb,0xcb,0xcc,0xdb,0xbb,0xbc,0xbb,0xbb,0xac,0xcb,0xaa,0xaa,0x99,0x88,0x20,
+0x43,0x35,0x35,0x43,0x53,0x43,0x43,0x24,0x33,0x22,0x23,0x22,0x23,0x13,0x01,0xa9,
+0xcb,0xcc,0xdb,0xcb,0xbc,0xcc,0xbb,0xbd,0xbb,0xbc,0xab,0xbb,0xbb,0xba,0xba,0x99,
+0x10,0x53,0x44,0x43,0x43,0x44,0x53,0x43,0x42,0x22,0x22,0x23,0x32,0x23,0x12,0x01,
+0x88,0xa9,0xcc,0xcc,0xbc,0xbc,0xcc,0xbb,0xbd,0xcb,0xbb,0xbb,0xbb,0xbb,0xac,0x9b,
+0x8a,0x08,0x42,0x53,0x43,0x34,0x34,0x35,0x34,0x34,0x24,0x23,0x23,0x33,0x32,0x22,
+0x12,0x81,0x98,0xbc,0xcd,0xdb,0xcb,0xcb,0xbc,0xbd,0xbb,0xbc,0xba,0xbb,0xbb,0xac,
+0xaa,0x9a,0x88,0x11,0x53,0x53,0x53,0x43,0x43,0x34,0x34,0x43,0x32,0x33,0x33,0x32,
+0x23,0x22,0x11,0x90,0xda,0xdb,0xcb,0xbc,0xcc,0xdb,0xcb,0xac,0xbb,0xbb,0xba,0xac,
+0xbb,0xba,0x9a,0x89,0x11,0x53,0x53,0x43,0x34,0x53,0x43,0x34,0x43,0x43,0x22,0x23,
+0x22,0x22,0x12,0x02,0x80,0xa9,0xcc,0xcb,0xbc,0xcc,0xcc,0xcb,0xbb,0xbc,0xbb,0xbb,
+0xac,0xbb,0xab,0x9b,0x8a,0x18,0x42,0x44,0x43,0x34,0x34,0x44,0x34,0x43,0x43,0x32,
+0x22,0x32,0x32,0x22,0x12,0x00,0xa9,0xca,0xcc,0xdb,0xcb,0xcc,0xbb,0xbd,0xcb,0xbb,
+0xcb,0xba,0xaa,0xab,0xaa,0xa9,0x08,0x21,0x44,0x34,0x44,0x43,0x44,0x43,0x43,0x23,
+0x33,0x43,0x22,0x23,0x22,0x22,0x01,0x80,0xba,0xdc,0xbc,0xcc,0xbb,0xcc,0xbc,0xcc,
+0xba,0xbb,0xab,0xbb,0xbb,0xbb,0xaa,0x89,0x20,0x53,0x44,0x34,0x34,0x35,0x34,0x44,
+0x33,0x43,0x22,0x23,0x23,0x23,0x23,0x11,0x88,0xa9,0xcc,0xdb,0xcb,0xbc,0xcc,0xbc,
+0xbc,0xbc,0xbb,0xbb,0xba,0xbb,0xac,0xaa,0x9a,0x00,0x31,0x45,0x53,0x43,0x43,0x34,
+0x34,0x34,0x43,0x32,0x33,0x32,0x33,0x32,0x11,0x01,0x99,0xcb,0xbd,0xcc,0xcb,0xcc,
+0xdb,0xcb,0xbb,0xbb,0xac,0xab,0xbb,0xbb,0xab,0x9a,0x88,0x21,0x54,0x34,0x35,0x43,
+0x43,0x53,0x43,0x24,0x33,0x23,0x23,0x23,0x23,0x12,0x11,0x88,0xba,0xbd,0xbd,0xbd,
+0xcc,0xbc,0xcc,0xbb,0xcb,0xba,0xba,0xbb,0xbb,0xbb,0xaa,0x99,0x11,0x44,0x44,0x43,
+0x34,0x53,0x43,0x34,0x34,0x33,0x43,0x22,0x22,0x32,0x22,0x12,0x00,0xa9,0xcb,0xcd,
+0xcb,0xbc,0xcc,0xcb,0xcb,0xcb,0xab,0xbb,0xba,0xbb,0xbb,0xab,0x9a,0x00,0x33,0x36,
+0x35,0x34,0x35,0x44,0x43,0x24,0x33,0x33,0x32,0x43,0x22,0x23,0x21,0x10,0x98,0xba,
+0xcd,0xcc,0xcb,0xcb,0xdb,0xcb,0xcb,0xbb,0xbb,0xba,0xbb,0xac,0xaa,0x9a,0x08,0x21,
+0x53,0x53,0x53,0x43,0x34,0x34,0x34,0x24,0x33,0x33,0x33,0x33,0x33,0x22,0x12,0x88,
+0xba,0xce,0xbc,0xbc,0xbc,0xbd,0xcc,0xcb,0xbb,0xbb,0xcb,0xaa,0xab,0xab,0x9b,0x99,
+0x10,0x42,0x35,0x35,0x34,0x34,0x44,0x43,0x43,0x23,0x33,0x33,0x33,0x23,0x33,0x21,
+0x80,0xb8,0xcc,0xcc,0xdb,0xbb,0xcd,0xcb,0xbc,0xbb,0xac,0xbb,0xba,0xcb,0xaa,0xaa,
+0x89,0x08,0x31,0x54,0x43,0x43,0x34,0x34,0x44,0x43,0x33,0x33,0x33,0x33,0x33,0x33,
+0x22,0x01,0x98,0xca,0xdc,0xcb,0xcc,0xbc,0xcc,0xbb,0xbc,0xbb,0xac,0xbb,0xcb,0xaa,
+0xaa,0x9a,0x08,0x21,0x53,0x53,0x33,0x35,0x34,0x35,0x44,0x32,0x33,0x23,0x33,0x33,
+0x33,0x23,0x11,0x80,0xb9,0xdc,0xcc,0xbc,0xbc,0xbd,0xcb,0xbc,0xbc,0xca,0xaa,0xaa,
+0xab,0xaa,0xa9,0x89,0x00,0x43,0x34,0x35,0x34,0x44,0x34,0x34,0x34,0x23,0x24,0x32,
+0x22,0x23,0x22,0x11,0x00,0x98,0xdb,0xcc,0xcb,0xcb,0xbc,0xcc,0xbc,0xcb,0xba,0xbb,
+0xba,0xbb,0xba,0xbb,0x9a,0x18,0x32,0x46,0x43,0x53,0x43,0x34,0x44,0x33,0x43,0x23,
+0x33,0x23,0x33,0x23,0x13,0x02,0x98,0xdb,0xcc,0xcb,0xac,0xbc,0xbd,0xbd,0xbb,0xbc,
+0xab,0xbb,0xcb,0xaa,0xab,0xa9,0x88,0x20,0x53,0x44,0x34,0x43,0x34,0x34,0x44,0x33,
+0x43,0x32,0x23,0x23,0x22,0x12,0x02,0x00,0xba,0xdc,0xcb,0xcb,0xbc,0xcd,0xcb,0xac,
+0xbb,0xbb,0xbb,0xbb,0xbc,0xba,0xaa,0x89,0x10,0x42,0x44,0x34,0x44,0x33,0x44,0x34,
+0x34,0x33,0x24,0x32,0x22,0x32,0x22,0x11,0x81,0x99,0xcb,0xcc,0xdb,0xbc,0xcc,0xcb,
+0xbc,0xbb,0xac,0xbb,0xbb,0xbb,0xab,0xbb,0x9a,0x08,0x42,0x54,0x43,0x43,0x43,0x44,
+0x43,0x43,0x33,0x33,0x42,0x22,0x32,0x22,0x12,0x01,0x88,0xba,0xdc,0xbc,0xbd,0xdb,
+0xcb,0xcb,0xbc,0xbb,0xcb,0xab,0xbb,0xba,0xaa,0x9a,0x89,0x21,0x63,0x53,0x33,0x35,
+0x44,0x43,0x34,0x33,0x24,0x33,0x32,0x23,0x33,0x22,0x11,0x81,0xb9,0xcd,0xbc,0xbd,
+0xdb,0xcb,0xdb,0xcb,0xbb,0xbb,0xbb,0xac,0xab,0xab,0x9b,0x8a,0x10,0x42,0x44,0x43,
+0x44,0x43,0x34,0x34,0x24,0x43,0x22,0x23,0x23,0x32,0x22,0x21,0x00,0xa8,0xeb,0xcb,
+0xbc,0xdb,0xcb,0xcc,0xcb,0xbb,0xcb,0xba,0xba,0xba,0xbb,0xba,0x9a,0x08,0x31,0x54,
+0x34,0x35,0x34,0x44,0x33,0x44,0x42,0x22,0x33,0x32,0x22,0x22,0x12,0x00,0x90,0xba,
+0xcd,0xcb,0xbc,0xcc,0xcc,0xbb,0xad,0xbb,0xab,0xcb,0xba,0xba,0xaa,0x9a,0x09,0x10,
+0x43,0x45,0x34,0x34,0x43,0x34,0x35,0x43,0x23,0x33,0x23,0x33,0x33,0x22,0x11,0x90,
+0xb9,0xcc,0xcc,0xdb,0xcb,0xcc,0xcb,0xcb,0xbb,0xbb,0xbb,0xbc,0xba,0xab,0xaa,0x89,
+0x18,0x43,0x54,0x33,0x35,0x43,0x44,0x43,0x24,0x33,0x33,0x33,0x33,0x33,0x32,0x22,
+0x11,0xa8,0xdb,0xdc,0xcb,0xbc,0xcc,0xbb,0xbd,0xbc,0xbb,0xbb,0xac,0xab,0xab,0xab,
+0x99,0x09,0x32,0x54,0x43,0x53,0x43,0x53,0x43,0x43,0x33,0x33,0x43,0x22,0x23,0x22,
+0x22,0x11,0x88,0xca,0xbc,0xbd,0xcc,0xbb,0xcd,0xcb,0xcb,0xbb,0xbb,0xcb,0xaa,0xab,
+0xab,0x9a,0x89,0x11,0x43,0x35,0x34,0x35,0x44,0x53,0x42,0x32,0x33,0x33,0x43,0x32,
+0x22,0x12,0x02,0x80,0xb9,0xeb,0xcb,0xbc,0xbc,0xbd,0xcc,0xcb,0xbb,0xac,0xba,0xaa,
+0xbb,0xba,0xaa,0x89,0x18,0x32,0x36,0x44,0x34,0x34,0x35,0x43,0x34,0x33,0x34,0x32,
+0x22,0x32,0x22,0x12,0x01,0x99,0xdb,0xbc,0xbc,0xbd,0xcc,0xdb,0xcb,0xbb,0xac,0xba,
+0xab,0xbb,0xbb,0xab,0xa9,0x08,0x30,0x45,0x35,0x53,0x42,0x33,0x35,0x44,0x32,0x33,
+0x33,0x23,0x33,0x33,0x23,0x11,0x98,0xca,0xcc,0xbc,0xbd,0xbc,0xbd,0xcc,0xbb,0xcb,
+0xab,0xbb,0xcb,0xaa,0xaa,0x9a,0x88,0x11,0x43,0x35,0x44,0x33,0x35,0x44,0x43,0x33,
+0x24,0x23,0x22,0x23,0x33,0x22,0x02,0x80,0xa9,0xcc,0xdb,0xbc,0xbd,0xdb,0xcb,0xcb,
+0xac,0xbb,0xbb,0xba,0xab,0xbb,0xab,0x8a,0x18,0x43,0x44,0x53,0x43,0x44,0x43,0x43,
+0x24,0x33,0x33,0x23,0x33,0x24,0x22,0x12,0x00,0x99,0xba,0xbe,0xbd,0xbc,0xbd,0xdb,
+0xcb,0xcb,0xbb,0xbb,0xbb,0xab,0xac,0xaa,0x9a,0x08,0x21,0x34,0x45,0x53,0x43,0x43,
+0x43,0x43,0x43,0x32,0x23,0x33,0x23,0x23,0x22,0x11,0x80,0xba,0xce,0xbc,0xac,0xbc,
+0xcc,0xbc,0xbc,0xcb,0xaa,0xab,0xab,0xcb,0xaa,0x99,0x88,0x10,0x32,0x45,0x34,0x34,
+0x34,0x44,0x43,0x24,0x33,0x33,0x32,0x33,0x33,0x32,0x11,0x00,0xb9,0xcc,0xcc,0xcb,
+0xbc,0xcc,0xcc,0xbb,0xbc,0xab,0xbb,0xcb,0xba,0xab,0xaa,0x89,0x08,0x41,0x53,0x44,
+0x33,0x35,0x43,0x44,0x33,0x34,0x32,0x33,0x32,0x33,0x23,0x13,0x01,0x98,0xcb,0xdc,
+0xdb,0xcb,0xbc,0xbc,0xcc,0xbb,0xac,0xbb,0xba,0xbb,0xbb,0xba,0x9a,0x89,0x30,0x45,
+0x34,0x35,0x43,0x34,0x44,0x24,0x24,0x22,0x23,0x22,0x33,0x32,0x22,0x01,0x90,0xb9,
+0xcd,0xbc,0xbd,0xcb,0xbc,0xbd,0xcb,0xcb,0xba,0xbb,0xba,0xbb,0xbb,0xa9,0x89,0x10,
+0x52,0x44,0x53,0x43,0x43,0x34,0x44,0x32,0x33,0x33,0x24,0x23,0x23,0x22,0x11,0x00,
+0x98,0xeb,0xbc,0xbd,0xcb,0xcb,0xcc,0xcb,0xbb,0xac,0xba,0xba,0xbb,0xab,0xab,0x99,
+0x00,0x32,0x45,0x44,0x43,0x34,0x53,0x43,0x43,0x33,0x33,0x33,0x24,0x32,0x12,0x12,
+0x01,0x90,0xca,0xdc,0xbb,0xcc,0xcb,0xbc,0xbd,0xcb,0xbb,0xba,0xbb,0xcb,0xba,0xaa,
+0x9a,0x09,0x20,0x53,0x44,0x34,0x34,0x34,0x44,0x33,0x34,0x24,0x33,0x32,0x32,0x22,
+0x12,0x02,0x80,0xb9,0xcc,0xcc,0xbc,0xbc,0xcd,0xbb,0xbc,0xbc,0xba,0xbb,0xcb,0xba,
+0xaa,0x9b,0x89,0x00,0x43,0x44,0x34,0x34,0x44,0x33,0x35,0x34,0x33,0x24,0x32,0x32,
+0x22,0x22,0x12,0x80,0xa9,0xdb,0xcc,0xcb,0xdb,0xdb,0xbb,0xad,0xac,0xbb,0xbb,0xbb,
+0xca,0xaa,0xa9,0x8a,0x08,0x31,0x54,0x43,0x34,0x53,0x43,0x34,0x34,0x33,0x24,0x23,
+0x33,0x32,0x32,0x22,0x10,0x98,0xcb,0xbd,0xbd,0xbc,0xbd,0xdb,0xcb,0xcb,0xbb,0xbb,
+0xcb,0xaa,0xab,0xaa,0x9a,0x09,0x20,0x44,0x34,0x44,0x43,0x53,0x43,0x43,0x32,0x24,
+0x32,0x32,0x33,0x23,0x22,0x01,0x80,0xb9,0xcd,0xdb,0xcb,0xbc,0xdb,0xdb,0xbb,0xbc,
+0xca,0xaa,0xaa,0xaa,0xba,0x9a,0x89,0x10,0x42,0x44,0x53,0x43,0x43,0x34,0x34,0x34,
+0x42,0x22,0x23,0x33,0x22,0x22,0x02,0x81,0x99,0xbc,0xbd,0xbd,0xbc,0xbd,0xcc,0xcb,
+0xbb,0xac,0xab,0xba,0xbb,0xbb,0xba,0x99,0x08,0x32,0x45,0x44,0x43,0x34,0x43,0x44,
+0x33,0x43,0x33,0x33,0x33,0x33,0x33,0x12,0x01,0xa8,0xcb,0xcc,0xcc,0xcb,0xcc,0xcb,
+0xbc,0xbb,0xbc,0xba,0xac,0xba,0xab,0xba,0x99,0x89,0x21,0x53,0x44,0x34,0x43,0x34,
+0x44,0x43,0x33,0x24,0x23,0x32,0x32,0x22,0x13,0x02,0x80,0xa9,0xdc,0xdb,0xdb,0xbb,
+0xbd,0xbc,0xbc,0xac,0xbb,0xac,0xaa,0xab,0xaa,0xaa,0x99,0x10,0x42,0x44,0x34,0x34,
+0x53,0x34,0x34,0x34,0x33,0x33,0x24,0x32,0x32,0x22,0x21,0x00,0x98,0xcb,0xcc,0xcc,
+0xcb,0xbc,0xbc,0xbd,0xcb,0xab,0xbb,0xac,0xba,0xaa,0xaa,0x99,0x18,0x21,0x44,0x34,
+0x35,0x34,0x44,0x43,0x24,0x33,0x33,0x43,0x32,0x32,0x23,0x22,0x00,0x90,0xca,0xcc,
+0xdb,0xcb,0xbc,0xdb,0xcb,0xcb,0xbb,0xbb,0xac,0xba,0xba,0xaa,0xaa,0x88,0x20,0x44,
+0x34,0x44,0x43,0x53,0x43,0x33,0x34,0x24,0x23,0x23,0x33,0x23,0x22,0x11,0x80,0xaa,
+0xcd,0xdb,0xcb,0xcb,0xbc,0xbd,0xbc,0xcb,0xba,0xba,0xab,0xcb,0xaa,0xaa,0x99,0x10,
+0x42,0x34,0x35,0x34,0x44,0x43,0x43,0x43,0x33,0x33,0x33,0x43,0x22,0x13,0x12,0x80,
+0xa8,0xcb,0xcc,0xdb,0xcb,0xbc,0xbd,0xcb,0xcb,0xba,0xbb,0xbb,0xac,0xab,0xaa,0x9a,
+0x08,0x32,0x44,0x35,0x53,0x33,0x44,0x34,0x53,0x32,0x33,0x33,0x33,0x33,0x33,0x22,
+0x02,0x98,0xcb,0xbd,0xbd,0xcc,0xdb,0xcb,0xcb,0xcb,0xbb,0xca,0xaa,0xbb,0xba,0xaa,
+0x9a,0x89,0x20,0x53,0x44,0x43,0x53,0x43,0x43,0x34,0x43,0x32,0x23,0x33,0x43,0x22,
+0x22,0x01,0x00,0xa9,0xcc,0xbc,0xbd,0xcb,0xbc,0xcc,0xcb,0xbb,0xac,0xab,0xab,0xbb,
+0xba,0xaa,0x8a,0x18,0x42,0x44,0x34,0x44,0x43,0x53,0x33,0x25,0x33,0x33,0x33,0x33,
+0x24,0x22,0x12,0x81,0xa8,0xcb,0xbd,0xbd,0xcb,0xcc,0xcb,0xdb,0xba,0xac,0xaa,0xab,
+0xab,0xbb,0xaa,0x8a,0x08,0x21,0x35,0x35,0x35,0x34,0x44,0x43,0x43,0x33,0x33,0x24,
+0x23,0x32,0x32,0x21,0x01,0x90,0xca,0xdb,0xbc,0xcc,0xcb,0xbc,0xcc,0xbb,0xbc,0xba,
+0xab,0xcb,0xaa,0xab,0x9a,0x89,0x11,0x43,0x35,0x35,0x34,0x53,0x43,0x43,0x43,0x33,
+0x33,0x33,0x23,0x33,0x23,0x22,0x80,0xba,0xdc,0xbc,0xcc,0xbc,0xcc,0xcb,0xbb,0xad,
+0xab,0xbb,0xab,0xac,0xaa,0xaa,0x89,0x10,0x42,0x34,0x35,0x34,0x34,0x44,0x43,0x43,
+0x33,0x24,0x22,0x22,0x23,0x32,0x21,0x80,0xa8,0xdb,0xcb,0xbc,0xbd,0xcc,0xcb,0xcb,
+0xcb,0xbb,0xbb,0xbb,0xbb,0xcb,0xaa,0x9a,0x09,0x32,0x54,0x43,0x43,0x43,0x44,0x43,
+0x24,0x33,0x33,0x43,0x32,0x23,0x23,0x22,0x10,0x80,0xba,0xcd,0xcc,0xcb,0xcb,0xbc,
+0xbc,0xcc,0xba,0xbb,0xbb,0xbb,0xbb,0xbb,0xab,0x89,0x20,0x44,0x35,0x44,0x43,0x53,
+0x43,0x43,0x33,0x33,0x43,0x32,0x33,0x32,0x22,0x12,0x81,0xb9,0xcd,0xbc,0xbc,0xdb,
+0xbc,0xcc,0xbc,0xbb,0xbb,0xac,0xab,0xbb,0xab,0xab,0x89,0x10,0x43,0x34,0x45,0x43,
+0x34,0x34,0x25,0x24,0x33,0x33,0x33,0x33,0x24,0x23,0x22,0x01,0x98,0xdb,0xbc,0xbc,
+0xcc,0xbc,0xcc,0xcb,0xbb,0xcb,0xab,0xbb,0xba,0xac,0xaa,0x9a,0x08,0x21,0x44,0x53,
+0x43,0x43,0x34,0x34,0x34,0x24,0x24,0x22,0x23,0x22,0x32,0x21,0x11,0x90,0xca,0xbc,
+0xbc,0xcc,0xbc,0xbd,0xbc,0xbc,0xbb,0xbb,0xbc,0xbb,0xcb,0x9a,0x9a,0x88,0x10,0x42,
+0x44,0x34,0x43,0x53,0x43,0x43,0x34,0x23,0x33,0x33,0x33,0x33,0x23,0x11,0x80,0xb9,
+0xdb,0xbd,0xcd,0xcb,0xbc,0xbc,0xbc,0xcb,0xcb,0xaa,0xab,0xba,0xaa,0x9b,0x8a,0x18,
+0x41,0x53,0x34,0x44,0x43,0x53,0x43,0x33,0x24,0x23,0x33,0x33,0x33,0x24,0x11,0x80,
+0x88,0xba,0xcd,0xcc,0xbb,0xbd,0xbc,0xcc,0xbb,0xbc,0xba,0xbb,0xba,0xbb,0xab,0xaa,
+0x08,0x21,0x35,0x45,0x43,0x44,0x33,0x35,0x34,0x33,0x24,0x33,0x33,0x32,0x33,0x22,
+0x02,0x90,0xca,0xcc,0xbc,0xcc,0xcb,0xdb,0xcb,0xac,0xbb,0xac,0xaa,0xba,0xbb,0xbb,
+0x9a,0x89,0x11,0x43,0x44,0x44,0x43,0x34,0x53,0x33,0x34,0x34,0x32,0x23,0x33,0x32,
+0x23,0x21,0x90,0xb9,0xcc,0xbc,0xbd,0xcc,0xdb,0xcb,0xcb,0xbb,0xbb,0xac,0xbb,0xbb,
+0xbb,0xab,0x9a,0x00,0x42,0x54,0x43,0x43,0x43,0x34,0x34,0x25,0x43,0x22,0x23,0x32,
+0x22,0x22,0x22,0x00,0x98,0xcb,0xbc,0xbd,0xbd,0xcc,0xdb,0xbb,0xac,0xbb,0xac,0xba,
+0xbb,0xab,0xab,0x9a,0x09,0x21,0x45,0x53,0x43,0x33,0x44,0x44,0x33,0x34,0x33,0x33,
+0x33,0x33,0x24,0x22,0x11,0x88,0xb9,0xdc,0xdb,0xcb,0xcb,0xbc,0xcc,0xca,0xba,0xba,
+0xac,0xba,0xba,0xaa,0x9a,0x89,0x20,0x52,0x53,0x43,0x43,0x34,0x44,0x43,0x33,0x43,
+0x32,0x23,0x33,0x33,0x22,0x22,0x01,0xa9,0xcc,0xbd,0xad,0xbc,0xcb,0xcc,0xcb,0xbb,
+0xbc,0xba,0xba,0xab,0xab,0xab,0x9a,0x18,0x32,0x46,0x43,0x34,0x44,0x43,0x34,0x43,
+0x32,0x33,0x43,0x32,0x32,0x22,0x21,0x10,0x98,0xcb,0xcc,0xbc,0xbc,0xcc,0xdb,0xcb,
+0xbb,0xac,0xbb,0xba,0xbb,0xcb,0xaa,0x99,0x88,0x21,0x53,0x53,0x53,0x43,0x43,0x43,
+0x34,0x33,0x34,0x42,0x22,0x22,0x21,0x21,0x01,0x80,0xb8,0xbc,0xcd,0xcb,0xcb,0xcc,
+0xbc,0xcb,0xbb,0xbb,0xbb,0xcb,0xcb,0x9a,0x9a,0x88,0x10,0x32,0x54,0x43,0x34,0x43,
+0x34,0x44,0x33,0x34,0x33,0x32,0x32,0x23,0x23,0x12,0x81,0xa9,0xeb,0xdb,0xcb,0xcc,
+0xcb,0xbc,0xdb,0xba,0xbb,0xbb,0xbb,0xac,0xbb,0xba,0x99,0x18,0x42,0x34,0x35,0x34,
+0x34,0x35,0x44,0x33,0x34,0x32,0x43,0x22,0x22,0x23,0x12,0x01,0x98,0xbb,0xcd,0xdb,
+0xcb,0xdb,0xcb,0xbc,0xbb,0xbc,0xbb,0xac,0xab,0xba,0xaa,0x9a,0x88,0x21,0x53,0x44,
+0x33,0x35,0x35,0x44,0x33,0x34,0x33,0x33,0x33,0x24,0x32,0x12,0x11,0x00,0xb9,0xdc,
+0xbc,0xbc,0xcc,0xbb,0xbd,0xad,0xac,0xba,0xab,0xba,0xba,0xab,0xaa,0x89,0x10,0x52,
+0x53,0x53,0x33,0x35,0x44,0x43,0x33,0x24,0x23,0x33,0x33,0x33,0x22,0x12,0x00,0xa8,
+0xeb,0xcc,0xcb,0xcb,0xdb,0xcb,0xbc,0xcb,0xbb,0xba,0xbb,0xbb,0xbc,0xaa,0x99,0x00,
+0x31,0x63,0x53,0x34,0x34,0x44,0x33,0x34,0x43,0x33,0x33,0x33,0x33,0x33,0x22,0x11,
+0xa8,0xbc,0xcd,0xcb,0xcb,0xcc,0xbc,0xcc,0xca,0xaa,0xab,0xba,0xba,0xbb,0xbb,0xaa,
+0x88,0x21,0x35,0x45,0x43,0x43,0x43,0x34,0x34,0x34,0x33,0x24,0x32,0x22,0x22,0x22,
+0x11,0x80,0xaa,0xcc,0xbc,0xbd,0xbc,0xbd,0xcc,0xbb,0xbc,0xba,0xbb,0xcb,0xab,0xbb,
+0xa9,0x89,0x10,0x43,0x44,0x53,0x33,0x44,0x34,0x34,0x34,0x24,0x32,0x22,0x23,0x23,
+0x23,0x12,0x01,0xa8,0xdb,0xbd,0xcc,0xbb,0xbd,0xcc,0xcb,0xbb,0xcb,0xab,0xbb,0xbb,
+0xbb,0xba,0x9a,0x09,0x42,0x44,0x53,0x33,0x35,0x44,0x53,0x32,0x24,0x23,0x23,0x23,
+0x33,0x33,0x22,0x01,0x90,0xdb,0xdb,0xbc,0xdb,0xcb,0xbc,0xbd,0xcb,0xbb,0xbb,0xbb,
+0xcb,0xba,0xab,0xaa,0x09,0x21,0x44,0x53,0x43,0x53,0x43,0x34,0x34,0x33,0x43,0x33,
+0x33,0x33,0x33,0x32,0x11,0x81,0xb9,0xdd,0xdb,0xbb,0xbd,0xdb,0xdb,0xbb,0xbc,0xbb,
+0xab,0xcb,0xba,0xba,0xaa,0x89,0x18,0x42,0x63,0x43,0x53,0x33,0x44,0x43,0x43,0x33,
+0x24,0x22,0x23,0x22,0x22,0x12,0x00,0x98,0xbb,0xce,0xcb,0xbc,0xbd,0xdb,0xcb,0xbb,
+0xac,0xab,0xbb,0xbb,0xbb,0xab,0x8a,0x08,0x42,0x44,0x34,0x35,0x43,0x34,0x34,0x34,
+0x34,0x33,0x33,0x33,0x33,0x23,0x23,0x02,0x90,0xcb,0xbd,0xbd,0xbd,0xbc,0xbd,0xbc,
+0xbc,0xbb,0xcb,0xba,0xbb,0xbb,0xba,0xaa,0x89,0x31,0x54,0x34,0x53,0x33,0x44,0x34,
+0x44,0x33,0x33,0x33,0x33,0x33,0x24,0x22,0x12,0x00,0xb9,0xdc,0xcb,0xbc,0xcc,0xbb,
+0xbd,0xbc,0xbc,0xbb,0xcb,0xba,0xba,0xaa,0xaa,0x99,0x00,0x43,0x44,0x34,0x43,0x34,
+0x35,0x34,0x34,0x43,0x22,0x23,0x32,0x33,0x22,0x12,0x81,0x98,0xbc,0xbd,0xbd,0xbd,
+0xcb,0xcc,0xbb,0xad,0xbb,0xbb,0xbb,0xbb,0xac,0xab,0x9a,0x00,0x31,0x35,0x34,0x35,
+0x44,0x34,0x34,0x34,0x24,0x32,0x33,0x33,0x33,0x33,0x22,0x01,0x90,0xca,0xbd,0xbd,
+0xbc,0xcc,0xdb,0xcb,0xcb,0xba,0xab,0xbb,0xbb,0xbc,0xaa,0x9a,0x89,0x10,0x42,0x44,
+0x44,0x33,0x35,0x34,0x34,0x34,0x33,0x43,0x32,0x32,0x23,0x12,0x02,0x81,0xa9,0xcc,
+0xcc,0xcb,0xcb,0xbc,0xbd,0xbc,0xac,0xab,0xbb,0xca,0xba,0xba,0x9a,0x89,0x18,0x31,
+0x54,0x53,0x43,0x33,0x35,0x44,0x33,0x34,0x33,0x32,0x33,0x43,0x22,0x12,0x00,0x99,
+0xbb,0xcd,0xcb,0xcc,0xdb,0xcb,0xcb,0xbb,0xcb,0xba,0xab,0xac,0xba,0xaa,0x8a,0x08,
+0x31,0x44,0x53,0x43,0x43,0x53,0x43,0x24,0x24,0x32,0x22,0x23,0x32,0x23,0x22,0x02,
+0x80,0xba,0xbe,0xcc,0xbc,0xbc,0xcc,0xcb,0xcb,0xbb,0xcb,0xba,0xab,0xab,0xab,0xaa,
+0x89,0x20,0x53,0x44,0x43,0x43,0x34,0x44,0x24,0x24,0x32,0x32,0x32,0x33,0x33,0x23,
+0x11,0x80,0xa9,0xcc,0xcc,0xbc,0xcc,0xcb,0xcb,0xbc,0xcb,0xba,0xbb,0xbb,0xcb,0xaa,
+0xaa,0x99,0x18,0x41,0x53,0x43,0x34,0x34,0x35,0x44,0x32,0x24,0x32,0x32,0x33,0x32,
+0x23,0x12,0x00,0x98,0xdb,0xbc,0xbd,0xbc,0xcc,0xbc,0xcc,0xbb,0xbb,0xbb,0xac,0xbb,
+0xbb,0xab,0x9a,0x89,0x11,0x44,0x35,0x35,0x43,0x34,0x53,0x43,0x33,0x43,0x23,0x23,
+0x23,0x23,0x22,0x02,0x90,0xca,0xdb,0xbc,0xbc,0xcc,0xcc,0xcb,0xbb,0xcb,0xbb,0xbb,
+0xcb,0xaa,0xab,0xaa,0x89,0x10,0x53,0x34,0x35,0x43,0x34,0x34,0x35,0x43,0x33,0x33,
+0x33,0x43,0x22,0x22,0x11,0x80,0xa9,0xca,0xcc,0xbc,0xbd,0xcc,0xcb,0xcb,0xbb,0xbb,
+0xbc,0xba,0xbb,0xbb,0xab,0x9a,0x00,0x43,0x35,0x35,0x43,0x34,0x44,0x53,0x33,0x33,
+0x24,0x33,0x32,0x23,0x33,0x12,0x01,0x98,0xcb,0xdc,0xcb,0xbc,0xcc,0xcb,0xcb,0xcb,
+0xbb,0xbb,0xac,0xab,0xab,0xaa,0x9a,0x08,0x30,0x44,0x44,0x43,0x43,0x34,0x44,0x33,
+0x34,0x32,0x43,0x22,0x23,0x23,0x21,0x01,0x80,0xb9,0xdc,0xbc,0xbc,0xcc,0xcb,0xdb,
+0xbb,0xbc,0xbb,0xbb,0xbb,0xac,0xab,0x9a,0x88,0x10,0x42,0x53,0x44,0x43,0x34,0x34,
+0x34,0x34,0x33,0x33,0x24,0x33,0x32,0x22,0x12,0x00,0xa9,0xeb,0xdb,0xcb,0xcb,0xbc,
+0xcc,0xac,0xac,0xba,0xaa,0xab,0xbb,0xbb,0xab,0x9a,0x18,0x42,0x44,0x34,0x34,0x44,
+0x43,0x34,0x43,0x24,0x23,0x33,0x23,0x33,0x23,0x12,0x11,0x98,0xca,0xbc,0xcd,0xdb,
+0xdb,0xcb,0xcb,0xbb,0xbc,0xba,0xbb,0xcb,0xba,0xba,0x99,0x19,0x21,0x33,0x12,0x80,
+0x99,0x08,0x11,0x12,0x42,0x55,0x44,0x33,0x12,0x90,0x8a,0x51,0x56,0x43,0x33,0x13,
+0x80,0x88,0x41,0x56,0x34,0x24,0x12,0x80,0x08,0x10,0x54,0x43,0x33,0x13,0x01,0x88,
+0x10,0x32,0x44,0x23,0x12,0x80,0x88,0x00,0x21,0x34,0x33,0x11,0x88,0xaa,0xba,0xde,
+0xcd,0xbc,0xaa,0x88,0x01,0xb9,0xdf,0xbc,0xbb,0x9b,0x89,0x80,0xa9,0xdf,0xcd,0xcb,
+0xaa,0x88,0x11,0xa0,0xdd,0xcd,0xba,0x9b,0x99,0x80,0x00,0x52,0x45,0x43,0x13,0x01,
+0x98,0x18,0x62,0x53,0x32,0x11,0x11,0x00,0x80,0xda,0xdc,0xbb,0xab,0x89,0x00,0x80,
+0xba,0xbd,0xbb,0xaa,0x88,0x00,0x90,0xd9,0xcc,0xbb,0xaa,0x88,0x00,0x80,0x99,0xba,
+0xbb,0xbb,0x9a,0x21,0x14,0xc8,0xcf,0xbc,0x9a,0x08,0x10,0x21,0x73,0x44,0x24,0x23,
+0x01,0x88,0x20,0x53,0x44,0x23,0x23,0x11,0x80,0x20,0x65,0x45,0x43,0x22,0x00,0x88,
+0x10,0x54,0x44,0x24,0x12,0x01,0x80,0x10,0x32,0x45,0x34,0x22,0x01,0x98,0x08,0x32,
+0x37,0x24,0x13,0x01,0x90,0x08,0x10,0x32,0x43,0x13,0x81,0xa9,0x09,0x42,0x36,0x23,
+0x02,0x88,0x80,0xb8,0xee,0xdc,0xbb,0xaa,0x89,0x88,0xb8,0xeb,0xbc,0xcc,0xba,0xaa,
+0x88,0x90,0xeb,0xce,0xcb,0xbb,0x9a,0x08,0x88,0xd9,0xcc,0xbd,0xab,0x9a,0x00,0x01,
+0xda,0xdd,0xcb,0xab,0x99,0x08,0x08,0xa8,0xcb,0xdb,0xaa,0x8a,0x18,0x00,0x90,0xbb,
+0xbd,0xaa,0x88,0x00,0x10,0x42,0x46,0x44,0x32,0x02,0x81,0x10,0x62,0x45,0x34,0x33,
+0x12,0x80,0x88,0x63,0x55,0x34,0x32,0x12,0x08,0x88,0x31,0x46,0x34,0x23,0x12,0x00,
+0x88,0x10,0x43,0x43,0x22,0x02,0x80,0x09,0x08,0x32,0x34,0x33,0x12,0x80,0xa9,0xcc,
+0xdd,0xcc,0xab,0x9a,0x00,0x88,0xdc,0xcd,0xbb,0xac,0x9a,0x88,0x80,0xda,0xce,0xcd,
+0xba,0x8a,0x00,0x02,0xca,0xcf,0xac,0xbb,0x99,0x89,0x80,0x21,0x45,0x35,0x34,0x12,
+0x90,0x88,0x30,0x45,0x34,0x22,0x12,0x10,0x00,0x90,0xdc,0xbd,0xbc,0x9a,0x09,0x80,
+0x88,0xba,0xbc,0xac,0x9a,0x88,0x80,0x90,0xba,0xce,0xba,0x99,0x08,0x01,0x88,0xba,
+0xbb,0xbb,0xaa,0x18,0x32,0x12,0xec,0xcd,0xbb,0x99,0x00,0x10,0x30,0x55,0x45,0x33,
+0x22,0x01,0x00,0x22,0x44,0x34,0x43,0x33,0x11,0x80,0x30,0x57,0x45,0x43,0x12,0x80,
+0x98,0x20,0x54,0x44,0x23,0x13,0x01,0x80,0x28,0x53,0x35,0x34,0x12,0x00,0x98,0x10,
+0x52,0x34,0x34,0x12,0x80,0x98,0x88,0x21,0x34,0x14,0x81,0xca,0xbb,0x9b,0x11,0x34,
+0x24,0x11,0x88,0x89,0xaa,0xdd,0xbd,0xbd,0xac,0x99,0x08,0x98,0xcb,0xcd,0xcb,0xaa,
+0x88,0x80,0xa8,0xdd,0xcd,0xbb,0xaa,0x89,0x80,0xa0,0xdc,0xcd,0xbb,0xab,0x09,0x10,
+0x98,0xed,0xcc,0xbb,0xaa,0x88,0x10,0x88,0xba,0xcd,0xba,0x9a,0x09,0x00,0x01,0xa8,
+0xdb,0xba,0xaa,0x88,0x80,0x10,0x52,0x46,0x34,0x24,0x01,0x00,0x28,0x54,0x54,0x43,
+0x32,0x01,0x80,0x08,0x62,0x45,0x34,0x14,0x02,0x88,0x08,0x31,0x45,0x34,0x22,0x11,
+0x88,0x08,0x21,0x43,0x24,0x22,0x01,0x98,0x88,0x10,0x32,0x35,0x32,0x01,0x99,0xcb,
+0xcb,0xcc,0xdb,0xab,0x9a,0x18,0x98,0xed,0xdc,0xcb,0xaa,0x89,0x08,0x90,0xeb,0xcd,
+0xcc,0xaa,0x8a,0x10,0x80,0xeb,0xdd,0xbb,0xab,0x8a,0x89,0x08,0x31,0x47,0x34,0x24,
+0x11,0x98,0x08,0x31,0x36,0x34,0x22,0x11,0x01,0x81,0xc9,0xdc,0xbc,0xbb,0x9a,0x80,
+0x00,0xa9,0xdb,0xbb,0xab,0x9a,0x08,0x08,0xaa,0xcd,0xbc,0xab,0x89,0x08,0x00,0xa8,
+0xba,0xbc,0xab,0x08,0x31,0x03,0xf9,0xcc,0xbb,0x9b,0x08,0x80,0x00,0x62,0x45,0x44,
+0x22,0x12,0x11,0x10,0x31,0x44,0x34,0x34,0x23,0x81,0x89,0x51,0x56,0x34,0x33,0x03,
+0x80,0x09,0x41,0x55,0x34,0x24,0x12,0x81,0x88,0x11,0x63,0x34,0x43,0x11,0x80,0x88,
+0x10,0x63,0x43,0x23,0x11,0x80,0x88,0x10,0x31,0x33,0x33,0x13,0x80,0xb9,0x99,0x63,
+0x45,0x24,0x12,0x80,0xa9,0xcb,0xbe,0xcd,0xba,0x9a,0x89,0x88,0xba,0xce,0xcb,0xbb,
+0xaa,0x89,0x98,0xea,0xcd,0xbd,0xac,0x9b,0x88,0x00,0xa9,0xdd,0xbc,0xac,0x9a,0x08,
+0x00,0xa8,0xde,0xbc,0xcb,0xa9,0x08,0x80,0x88,0xba,0xbd,0xbb,0x9a,0x09,0x00,0x00,
+0xb9,0xcc,0xab,0x9b,0x08,0x28,0x51,0x54,0x53,0x33,0x23,0x11,0x00,0x42,0x46,0x35,
+0x25,0x22,0x00,0x88,0x20,0x46,0x35,0x34,0x22,0x00,0x88,0x10,0x53,0x35,0x34,0x23,
+0x01,0x88,0x88,0x21,0x44,0x23,0x13,0x00,0x98,0x08,0x11,0x33,0x25,0x13,0x01,0x98,
+0xbb,0xcd,0xcd,0xdb,0xab,0x8a,0x10,0x88,0xec,0xdc,0xab,0xab,0x89,0x80,0xa9,0xdd,
+0xcd,0xbc,0xab,0x89,0x11,0x90,0xed,0xcc,0xac,0xaa,0x89,0x88,0x00,0x31,0x46,0x44,
+0x22,0x01,0x98,0x08,0x42,0x35,0x33,0x23,0x11,0x01,0x80,0xea,0xdc,0xbb,0xbb,0x99,
+0x00,0x80,0xba,0xcc,0xac,0x9a,0x89,0x00,0x88,0xa9,0xcc,0xbb,0xbb,0x89,0x08,0x80,
+0xa8,0xcb,0xbc,0xaa,0x09,0x31,0x22,0xb8,0xdf,0xbb,0xab,0x89,0x00,0x21,0x55,0x54,
+0x33,0x14,0x01,0x80,0x10,0x43,0x34,0x34,0x23,0x23,0x12,0x20,0x64,0x55,0x43,0x33,
+0x02,0x90,0x08,0x63,0x45,0x43,0x22,0x11,0x88,0x08,0x21,0x54,0x34,0x33,0x12,0x80,
+0x89,0x20,0x54,0x34,0x14,0x11,0x88,0x08,0x10,0x21,0x32,0x33,0x12,0x98,0xbb,0x09,
+0x55,0x35,0x22,0x81,0x89,0x9a,0xeb,0xcc,0xbd,0xbb,0x9a,0x89,0x98,0xca,0xcc,0xcc,
+0xba,0xab,0x09,0x80,0xea,0xdd,0xcc,0xaa,0x9a,0x08,0x88,0xb9,0xdd,0xbc,0xbb,0xaa,
+0x18,0x10,0xc9,0xde,0xbc,0xbb,0x9a,0x08,0x00,0x98,0xdb,0xbc,0xba,0x9a,0x88,0x11,
+0x80,0xb9,0xbd,0xbb,0x89,0x00,0x11,0x41,0x56,0x34,0x34,0x11,0x80,0x09,0x52,0x55,
+0x43,0x33,0x22,0x80,0x88,0x31,0x67,0x34,0x33,0x12,0x80,0x88,0x30,0x46,0x34,0x33,
+0x12,0x80,0x88,0x18,0x33,0x36,0x32,0x01,0x80,0x89,0x18,0x31,0x43,0x23,0x12,0x80,
+0xa9,0xdb,0xdc,0xbc,0xbd,0xba,0x89,0x80,0xd9,0xdd,0xbc,0xac,0x99,0x08,0x88,0xb9,
+0xde,0xcc,0xac,0x9b,0x09,0x10,0xb0,0xde,0xbd,0xac,0x9a,0x89,0x08,0x00,0x42,0x45,
+0x34,0x23,0x00,0x98,0x10,0x44,0x35,0x23,0x22,0x01,0x01,0x90,0xeb,0xbd,0xad,0xaa,
+0x89,0x00,0x88,0xaa,0xdb,0xba,0x9a,0x89,0x80,0x88,0xba,0xbd,0xbc,0xbb,0x89,0x08,
+0x00,0xa0,0xca,0xbc,0xaa,0x00,0x33,0x02,0xfb,0xcc,0xab,0x99,0x08,0x10,0x20,0x55,
+0x44,0x43,0x22,0x01,0x00,0x11,0x43,0x44,0x43,0x32,0x11,0x80,0x10,0x65,0x45,0x33,
+0x23,0x01,0x89,0x20,0x55,0x44,0x33,0x23,0x11,0x88,0x10,0x52,0x54,0x33,0x23,0x01,
+0x88,0x19,0x52,0x44,0x33,0x12,0x01,0x08,0x00,0x31,0x33,0x24,0x13,0x80,0xaa,0x9b,
+0x52,0x46,0x24,0x02,0x80,0x99,0xa9,0xdb,0xcd,0xbc,0xab,0x9a,0x80,0xa9,0xcc,0xbd,
+0xcb,0xbb,0xa9,0x88,0x90,0xec,0xcd,0xbc,0xbb,0x8a,0x00,0x00,0xda,0xdc,0xbc,0xab,
+0x9a,0x08,0x80,0xea,0xcd,0xbc,0xbb,0x89,0x08,0x81,0xa9,0xcc,0xbb,0xac,0x89,0x08,
+0x00,0x88,0xba,0xbc,0xba,0x89,0x08,0x11,0x44,0x46,0x34,0x33,0x12,0x00,0x18,0x54,
+0x45,0x44,0x32,0x11,0x00,0x09,0x51,0x55,0x53,0x22,0x02,0x80,0x88,0x21,0x45,0x34,
+0x23,0x12,0x80,0x08,0x10,0x43,0x34,0x23,0x81,0x88,0x89,0x11,0x32,0x24,0x22,0x01,
+0x80,0xa8,0xec,0xcc,0xbc,0xac,0x99,0x08,0x98,0xdc,0xcd,0xcb,0xaa,0x9a,0x89,0x90,
+0xda,0xde,0xbc,0xbc,0x9a,0x00,0x81,0xd9,0xdd,0xcb,0xaa,0x8a,0x89,0x80,0x21,0x54,
+0x44,0x33,0x12,0x88,0x88,0x31,0x46,0x24,0x22,0x11,0x01,0x01,0xa8,0xdc,0xcc,0xbb,
+0x9a,0x09,0x00,0x98,0xbb,0xbd,0xbb,0x9a,0x09,0x08,0x90,0xdb,0xcc,0xbb,0x9a,0x09,
+0x11,0x80,0xa9,0xcc,0xaa,0x8a,0x11,0x13,0x91,0xec,0xcb,0xab,0x99,0x00,0x00,0x31,
+0x65,0x44,0x43,0x12,0x01,0x08,0x10,0x53,0x53,0x33,0x22,0x01,0x88,0x41,0x65,0x44,
+0x33,0x23,0x01,0x88,0x10,0x46,0x35,0x24,0x22,0x00,0x08,0x10,0x63,0x43,0x24,0x12,
+0x81,0x88,0x08,0x43,0x45,0x32,0x12,0x88,0x98,0x18,0x21,0x24,0x32,0x11,0x01,0x88,
+0x89,0x32,0x47,0x33,0x23,0x01,0xa8,0xca,0xcd,0xcd,0xbb,0xbb,0x9a,0x98,0xba,0xcc,
+0xbd,0xbc,0xab,0x9a,0x80,0xc9,0xde,0xbd,0xac,0xaa,0x88,0x08,0xa9,0xdc,0xbc,0xad,
+0x9b,0x89,0x10,0x98,0xec,0xcc,0xbb,0x9b,0x89,0x00,0x80,0xb9,0xcd,0xbb,0xab,0x8a,
+0x10,0x01,0xa9,0xcc,0xab,0x99,0x08,0x80,0x10,0x45,0x46,0x33,0x22,0x00,0x08,0x32,
+0x47,0x44,0x33,0x24,0x12,0x80,0x08,0x63,0x36,0x35,0x23,0x01,0x80,0x08,0x52,0x44,
+0x43,0x22,0x11,0x08,0x08,0x11,0x43,0x24,0x12,0x01,0x88,0x88,0x10,0x22,0x23,0x12,
+0x80,0xa8,0xcb,0xce,0xcc,0xcb,0xbb,0x99,0x98,0xb9,0xee,0xdb,0xbb,0xbb,0x99,0x08,
+0x90,0xdd,0xce,0xbc,0xbb,0x89,0x10,0x81,0xec,0xcd,0xbb,0xbb,0x99,0x89,0x08,0x42,
+0x55,0x34,0x33,0x02,0x88,0x09,0x52,0x44,0x24,0x12,0x11,0x10,0x80,0xb9,0xdd,0xbc,
+0xab,0x8a,0x08,0x88,0xa9,0xcb,0xac,0xab,0x89,0x88,0x88,0xa8,0xcc,0xbc,0xbb,0x8a,
+0x08,0x01,0x90,0xba,0xbd,0xaa,0x09,0x21,0x12,0xc9,0xce,0xcb,0x99,0x08,0x00,0x08,
+0x21,0x47,0x35,0x24,0x12,0x08,0x00,0x32,0x36,0x43,0x22,0x12,0x11,0x21,0x44,0x55,
+0x34,0x34,0x22,0x00,0x88,0x31,0x47,0x44,0x32,0x02,0x81,0x80,0x21,0x44,0x34,0x24,
+0x12,0x80,0x88,0x10,0x63,0x43,0x33,0x11,0x80,0x88,0x10,0x32,0x34,0x33,0x01,0x99,
+0xab,0x28,0x46,0x24,0x12,0x88,0x88,0x80,0xc8,0xdf,0xbc,0xbb,0x8a,0x08,0x90,0xdb,
+0xcc,0xbc,0xba,0x9a,0x89,0x90,0xfb,0xcd,0xbc,0xbb,0x9a,0x89,0x88,0xba,0xcf,0xbc,
+0xbc,0x9a,0x88,0x01,0xb8,0xcf,0xcc,0xba,0x99,0x88,0x80,0xa8,0xca,0xcb,0xab,0xaa,
+0x88,0x10,0x00,0xba,0xcc,0xab,0x89,0x00,0x80,0x20,0x65,0x54,0x23,0x22,0x00,0x80,
+0x32,0x47,0x44,0x33,0x22,0x00,0x88,0x40,0x55,0x44,0x33,0x22,0x81,0x88,0x10,0x53,
+0x45,0x33,0x23,0x02,0x88,0x88,0x31,0x44,0x33,0x13,0x00,0x98,0x08,0x21,0x44,0x33,
+0x12,0x88,0x9a,0xa9,0xca,0xcf,0xcc,0xab,0x89,0x80,0xa8,0xde,0xbc,0xac,0x9b,0x89,
+0x88,0xa8,0xdd,0xcd,0xbc,0xab,0x89,0x01,0x90,0xde,0xcc,0xcb,0x9a,0x89,0x88,0x08,
+0x41,0x54,0x34,0x23,0x01,0x98,0x18,0x53,0x44,0x33,0x12,0x02,0x11,0x90,0xda,0xcd,
+0xac,0xab,0x88,0x08,0x88,0xaa,0xcb,0xcb,0x9a,0x99,0x80,0x88,0xa9,0xbd,0xbc,0xab,
+0x88,0x00,0x80,0xb9,0xcb,0xac,0x9a,0x08,0x20,0x12,0xb9,0xcf,0xbb,0x8a,0x08,0x80,
+0x00,0x64,0x55,0x43,0x22,0x01,0x00,0x20,0x42,0x34,0x24,0x23,0x12,0x80,0x20,0x65,
+0x45,0x34,0x23,0x01,0x88,0x18,0x54,0x44,0x24,0x22,0x01,0x80,0x88,0x32,0x45,0x34,
+0x23,0x02,0x80,0x08,0x32,0x36,0x35,0x22,0x02,0x80,0x08,0x10,0x33,0x34,0x22,0x81,
+0x99,0x99,0x20,0x45,0x34,0x23,0x11,0x98,0xba,0xdc,0xcd,0xcc,0xbb,0xba,0x99,0x98,
+0xba,0xce,0xbc,0xbb,0x9b,0x89,0x98,0xec,0xcd,0xbc,0xac,0x99,0x08,0x88,0xb9,0xde,
+0xcb,0xab,0x9a,0x08,0x80,0xc9,0xce,0xbc,0xbb,0x9a,0x08,0x00,0xa9,0xcc,0xcb,0xab,
+0x9a,0x88,0x00,0x90,0xba,0xbd,0xba,0x88,0x00,0x11,0x42,0x45,0x45,0x32,0x12,0x80,
+0x18,0x63,0x45,0x44,0x22,0x12,0x80,0x08,0x41,0x46,0x34,0x24,0x12,0x80,0x08,0x30,
+0x45,0x34,0x33,0x12,0x00,0x88,0x28,0x52,0x43,0x22,0x01,0x88,0x88,0x10,0x32,0x33,
+0x22,0x12,0x01,0x98,0xec,0xdc,0xbc,0xac,0x9a,0x08,0x00,0xc9,0xce,0xbd,0xbb,0xaa,
+0x89,0x08,0xba,0xef,0xbc,0xad,0x9b,0x08,0x01,0xb8,0xcf,0xbd,0xab,0x9b,0x99,0x88,
+0x18,0x44,0x36,0x25,0x13,0x80,0x88,0x10,0x63,0x43,0x23,0x12,0x11,0x10,0x88,0xcc,
+0xcd,0xbb,0xab,0x88,0x08,0x88,0xca,0xbb,0xbc,0x9a,0x89,0x08,0x80,0xba,0xcd,0xbc,
+0xaa,0x89,0x00,0x80,0xa8,0xca,0xba,0x9a,0x00,0x12,0x90,0xdd,0xcc,0xaa,0x89,0x08,
+0x18,0x21,0x56,0x34,0x34,0x12,0x01,0x08,0x21,0x44,0x35,0x24,0x13,0x01,0x88,0x20,
+0x66,0x53,0x43,0x12,0x00,0x88,0x20,0x45,0x44,0x33,0x12,0x01,0x88,0x20,0x63,0x34,
+0x34,0x22,0x00,0x88,0x18,0x43,0x45,0x23,0x22,0x00,0x89,0x00,0x32,0x53,0x32,0x11,
+0x80,0xa9,0x99,0x30,0x55,0x23,0x12,0x00,0x88,0x98,0xec,0xde,0xbc,0xbc,0xaa,0x99,
+0x88,0xa9,0xcc,0xbc,0xba,0x89,0x00,0x90,0xec,0xcd,0xcb,0xaa,0x99,0x80,0x88,0xba,
+0xce,0xbc,0xac,0x89,0x08,0x80,0xdb,0xdd,0xbb,0xbb,0x89,0x08,0x81,0xa9,0xcc,0xac,
+0xaa,0x99,0x80,0x00,0x99,0xbb,0xad,0x9a,0x99,0x88,0x10,0x73,0x54,0x33,0x33,0x12,
+0x00,0x11,0x64,0x45,0x53,0x32,0x02,0x80,0x08,0x52,0x55,0x34,0x32,0x01,0x80,0x08,
+0x41,0x54,0x33,0x24,0x11,0x00,0x88,0x10,0x33,0x44,0x22,0x11,0x90,0x98,0x00,0x42,
+0x43,0x13,0x80,0xaa,0x9a,0x9a,0xeb,0xdd,0xcb,0x9a,0x08,0x88,0xdb,0xcd,0xbc,0xaa,
+0x8a,0x09,0x98,0xcc,0xcf,0xdb,0xab,0x8a,0x18,0x81,0xeb,0xdd,0xbb,0xab,0x9a,0x88,
+0x88,0x31,0x56,0x34,0x24,0x02,0x80,0x09,0x31,0x36,0x34,0x23,0x11,0x10,0x00,0xa8,
+0xdd,0xbc,0xbc,0x9a,0x88,0x80,0x98,0xbb,0xcc,0xaa,0x99,0x88,0x88,0xa8,0xca,0xbc,
+0xbc,0x9a,0x08,0x80,0x90,0xba,0xcb,0xaa,0x9a,0x08,0x01,0xa0,0xcd,0xcd,0xab,0x99,
+0x00,0x01,0x22,0x55,0x45,0x24,0x23,0x01,0x00,0x10,0x44,0x34,0x24,0x12,0x00,0x88,
+0x41,0x46,0x35,0x34,0x11,0x81,0x09,0x20,0x55,0x34,0x34,0x12,0x01,0x08,0x18,0x63,
+0x34,0x34,0x12,0x80,0x08,0x28,0x43,0x35,0x33,0x12,0x01,0x88,0x00,0x21,0x34,0x33,
+0x01,0xba,0x9c,0x28,0x46,0x33,0x12,0x88,0x00,0x10,0xc9,0xef,0xbc,0xac,0x9a,0x88,
+0x98,0xa9,0xeb,0xdb,0xba,0xaa,0x88,0x80,0xc9,0xde,0xbc,0xac,0xaa,0x89,0x08,0xa8,
+0xdc,0xdc,0xab,0x9b,0x09,0x10,0xa8,0xde,0xbc,0xac,0x9a,0x09,0x08,0x88,0xaa,0xcb,
+0xbc,0xba,0x8a,0x18,0x00,0xa9,0xcc,0xab,0x89,0x08,0x88,0x09,0x73,0x46,0x43,0x22,
+0x00,0x08,0x20,0x54,0x35,0x25,0x22,0x01,0x88,0x20,0x64,0x44,0x24,0x13,0x01,0x80,
+0x00,0x43,0x45,0x33,0x24,0x01,0x88,0x80,0x21,0x43,0x43,0x12,0x00,0x98,0x88,0x20,
+0x32,0x34,0x23,0x01,0x99,0xb9,0xdb,0xdd,0xcc,0xba,0x89,0x10,0x81,0xfa,0xdc,0xbb,
+0xbb,0x8a,0x89,0xa8,0xce,0xce,0xcb,0xab,0x09,0x10,0x90,0xdd,0xcd,0xbb,0xab,0x89,
+0x09,0x08,0x31,0x47,0x44,0x22,0x01,0x88,0x08,0x42,0x44,0x33,0x13,0x12,0x11,0x80,
+0xca,0xbf,0xbc,0xbb,0x89,0x08,0x80,0xaa,0xcc,0xba,0xab,0x99,0x88,0x90,0xa9,0xcd,
+0xbb,0x9c,0x89,0x08,0x80,0xa9,0xba,0xbb,0xab,0x1a,0x31,0x23,0xf9,0xcd,0xac,0xaa,
+0x08,0x00,0x80,0x41,0x55,0x35,0x23,0x12,0x08,0x00,0x42,0x44,0x33,0x43,0x22,0x12,
+0x11,0x52,0x45,0x35,0x34,0x12,0x80,0x08,0x41,0x55,0x43,0x33,0x12,0x08,0x08,0x31,
+0x45,0x34,0x33,0x12,0x81,0x08,0x30,0x45,0x44,0x22,0x01,0x08,0x09,0x20,0x32,0x43,
+0x22,0x80,0xa9,0x9a,0x38,0x55,0x24,0x22,0x80,0x88,0x88,0xca,0xde,0xbc,0xac,0xa9,
+0x88,0x98,0xaa,0xcc,0xdb,0xca,0xaa,0x99,0x98,0xb9,0xdf,0xbc,0xbc,0x9a,0x89,0x88,
+0xa9,0xce,0xbc,0xbc,0x9a,0x18,0x00,0xb8,0xdf,0xcb,0xbb,0x99,0x08,0x80,0xa8,0xcb,
+0xcb,0xba,0xaa,0x89,0x01,0x01,0xc9,0xbd,0xbb,0x8a,0x21,0x22,0x32,0x55,0x54,0x32,
+0x12,0x81,0x00,0x53,0x36,0x35,0x33,0x23,0x01,0x00,0x52,0x55,0x35,0x43,0x12,0x00,
+0x88,0x10,0x63,0x34,0x24,0x22,0x01,0x08,0x18,0x31,0x34,0x24,0x11,0x80,0x89,0x88,
+0x11,0x42,0x33,0x14,0x11,0x99,0xca,0xeb,0xcb,0xbc,0xaa,0x8a,0x80,0xc9,0xde,0xbc,
+0xbc,0xaa,0x89,0x80,0xb8,0xde,0xcd,0xcb,0xaa,0x08,0x10,0xa8,0xde,0xbc,0xac,0xaa,
+0x98,0x88,0x08,0x43,0x46,0x43,0x22,0x81,0x88,0x00,0x34,0x36,0x23,0x13,0x11,0x01,
+0x90,0xdb,0xbe,0xbc,0xab,0x89,0x80,0x90,0xaa,0xbd,0xbb,0xaa,0x8a,0x08,0x88,0xb9,
+0xce,0xcb,0xaa,0x08,0x00,0x81,0xa8,0xbb,0xcb,0xaa,0x8a,0x18,0x10,0xa8,0xce,0xbd,
+0xac,0x99,0x08,0x22,0x63,0x34,0x25,0x23,0x01,0x00,0x10,0x43,0x35,0x34,0x33,0x22,
+0x01,0x30,0x75,0x44,0x34,0x22,0x01,0x98,0x10,0x64,0x34,0x25,0x22,0x01,0x88,0x80,
+0x22,0x45,0x34,0x32,0x02,0x80,0x09,0x31,0x55,0x33,0x32,0x11,0x00,0x01,0x00,0x21,
+0x34,0x34,0x13,0xa9,0xbb,0x18,0x47,0x33,0x13,0x88,0x08,0x80,0xfb,0xcd,0xbc,0xaa,
+0x89,0x88,0xa8,0xcc,0xdb,0xcb,0xbb,0x9b,0x08,0x01,0xfb,0xdd,0xac,0xab,0x89,0x08,
+0x88,0xba,0xbf,0xbd,0xbb,0x9a,0x88,0x81,0xd9,0xce,0xbc,0xbb,0x99,0x00,0x80,0xa9,
+0xeb,0xbb,0xba,0x89,0x00,0x01,0x98,0xca,0xac,0x9b,0x89,0x10,0x32,0x54,0x35,0x35,
+0x32,0x12,0x01,0x11,0x54,0x54,0x34,0x43,0x12,0x80,0x88,0x51,0x55,0x43,0x33,0x12,
+0x80,0x08,0x41,0x44,0x34,0x33,0x12,0x80,0x08,0x10,0x53,0x24,0x23,0x01,0x88,0x88,
+0x11,0x32,0x34,0x12,0x80,0xa9,0xb9,0xca,0xec,0xcc,0xac,0x9b,0x09,0x01,0xc9,0xcf,
+0xbc,0xbb,0x9a,0x08,0x08,0xc9,0xde,0xbd,0xac,0x9b,0x18,0x00,0xc8,0xdd,0xcc,0xba,
+0xa9,0x98,0x88,0x10,0x63,0x44,0x33,0x12,0x80,0x89,0x20,0x54,0x43,0x32,0x12,0x11,
+0x01,0xa0,0xcc,0xcd,0xab,0x9b,0x89,0x80,0x98,0xca,0xac,0xbb,0xaa,0x88,0x00,0x98,
+0xcb,0xbd,0xbc,0x9a,0x09,0x10,0x88,0xb9,0xcb,0xab,0x8a,0x10,0x23,0x82,0xfb,0xcd,
+0xbb,0x9a,0x20,0x32,0x43,0x53,0x44,0x43,0x22,0x10,0x10,0x41,0x44,0x43,0x22,0x12,
+0x11,0x11,0x53,0x46,0x44,0x33,0x12,0x01,0x08,0x31,0x47,0x43,0x24,0x22,0x02,0x00,
+0x18,0x42,0x45,0x24,0x22,0x80,0x88,0x10,0x52,0x34,0x23,0x22,0x00,0x88,0x80,0x11,
+0x42,0x53,0x22,0x01,0x88,0x09,0x30,0x44,0x23,0x22,0x21,0x11,0xb0,0xfe,0xcc,0xac,
+0xab,0x88,0x08,0x98,0xdb,0xbd,0xbc,0xab,0x89,0x88,0xb9,0xde,0xbd,0xbc,0xba,0x89,
+0x80,0x90,0xdb,0xcd,0xbc,0xbb,0x8a,0x08,0x80,0xdc,0xcd,0xac,0xab,0x89,0x88,0x90,
+0xb8,0xcb,0xcb,0xbb,0x9a,0x08,0x11,0x90,0xdb,0xad,0x9b,0x00,0x11,0x11,0x22,0x46,
+0x34,0x24,0x01,0x00,0x30,0x64,0x35,0x34,0x24,0x01,0x80,0x08,0x63,0x45,0x34,0x22,
+0x01,0x80,0x08,0x43,0x45,0x33,0x14,0x02,0x08,0x88,0x20,0x43,0x33,0x23,0x01,0x98,
+0x08,0x20,0x34,0x34,0x23,0x82,0xa9,0xac,0xbc,0xdc,0xeb,0xba,0x9b,0x18,0x01,0xda,
+0xcf,0xcb,0xab,0x89,0x10,0x88,0xeb,0xcd,0xad,0xbb,0x99,0x10,0x90,0xdc,0xce,0xbb,
+0xab,0x9a,0x98,0x00,0x31,0x56,0x34,0x33,0x12,0x88,0x09,0x42,0x55,0x23,0x23,0x01,
+0x01,0x01,0xa8,0xdd,0xbc,0xac,0x9a,0x88,0x80,0x99,0xca,0xbb,0xbb,0x9b,0x88,0x00,
+0xb8,0xcd,0xcc,0xaa,0x89,0x08,0x00,0x98,0x99,0xaa,0xbb,0xbc,0x89,0x31,0x14,0xd8,
+0xcd,0xbb,0x9a,0x00,0x11,0x22,0x64,0x35,0x34,0x23,0x01,0x00,0x21,0x35,0x35,0x33,
+0x13,0x00,0x09,0x62,0x56,0x34,0x33,0x13,0x90,0x88,0x41,0x55,0x43,0x24,0x12,0x00,
+0x08,0x10,0x53,0x44,0x23,0x22,0x80,0x88,0x21,0x53,0x34,0x23,0x13,0x12,0x10,0x00,
+0x21,0x53,0x34,0x22,0x90,0xaa,0x18,0x64,0x43,0x13,0x11,0x20,0x21,0xb0,0xdf,0xcc,
+0xab,0x99,0x88,0x98,0xaa,0xac,0xcc,0xbc,0xbc,0x99,0x08,0xb0,0xee,0xbc,0xac,0x89,
+0x88,0x90,0xc9,0xbc,0xbd,0xbb,0xbb,0x99,0x08,0xb9,0xef,0xdb,0xbb,0x9a,0x09,0x08,
+0x88,0xaa,0xbc,0xbb,0x9a,0x28,0x53,0x22,0x90,0xcb,0xab,0x09,0x12,0x12,0x32,0x57,
+0x34,0x24,0x11,0x00,0x80,0x11,0x44,0x55,0x53,0x22,0x81,0x99,0x20,0x56,0x34,0x22,
+0x11,0x32,0x47,0x43,0x23,0x33,0x55,0x34,0x35,0x32,0x12,0x11,0x12,0x32,0x12,0x01,
+0x10,0x42,0x34,0x24,0x00,0xaa,0xcb,0xbb,0xbc,0xbd,0xbd,0xcb,0xbb,0xbb,0xcd,0xcb,
+0xcb,0xab,0xbb,0xbb,0xbc,0xbb,0xba,0xba,0xbd,0xcb,0x9a,0x18,0x22,0x33,0x32,0x45,
+0x45,0x32,0x23,0x21,0x42,0x44,0x34,0x32,0x33,0x43,0x34,0x33,0x23,0x80,0xdb,0xbd,
+0xbc,0xab,0x89,0x99,0xbc,0xbd,0xab,0xba,0xfd,0xdc,0xbd,0xcb,0xab,0xa9,0x99,0x9a,
+0xaa,0xaa,0x9a,0x19,0x62,0x54,0x33,0x33,0x01,0x01,0x22,0x34,0x23,0x12,0x62,0x45,
+0x45,0x43,0x22,0x22,0x11,0x11,0x12,0x22,0x22,0x01,0xb9,0xcf,0xcb,0xab,0x9a,0x89,
+0x99,0xb9,0xbc,0xcb,0xcb,0xeb,0xdb,0xbc,0xac,0xab,0xaa,0xa9,0xab,0xab,0xab,0xa9,
+0xca,0xcc,0xcb,0xaa,0x08,0x21,0x32,0x43,0x53,0x34,0x34,0x33,0x43,0x43,0x35,0x43,
+0x33,0x33,0x24,0x33,0x24,0x22,0x12,0x01,0x00,0x88,0xba,0xbc,0xbc,0xbb,0xcd,0xcc,
+0xbc,0xbc,0xba,0xcb,0xbc,0xbd,0xbc,0xba,0xbb,0xbb,0xbc,0xac,0x9a,0x89,0x89,0x08,
+0x11,0x33,0x34,0x34,0x45,0x34,0x35,0x34,0x44,0x44,0x53,0x33,0x32,0x21,0x12,0x33,
+0x33,0x22,0x21,0x52,0x44,0x24,0x12,0x90,0xaa,0x9a,0x9a,0xcc,0xcc,0xbb,0xab,0x99,
+0xa9,0xdc,0xcc,0xbb,0xbb,0xbb,0xbc,0xcb,0xab,0x9a,0x09,0x21,0x42,0x33,0x24,0x33,
+0x53,0x44,0x53,0x33,0x34,0x44,0x34,0x35,0x43,0x22,0x12,0x22,0x32,0x23,0x13,0x12,
+0x33,0x44,0x23,0x80,0xca,0xcb,0xba,0xcb,0xcd,0xcb,0xbc,0xbc,0xbd,0xcc,0xbb,0xac,
+0x9a,0xaa,0xbb,0xbb,0xbb,0xaa,0xba,0xbd,0xac,0x8a,0x10,0x33,0x24,0x33,0x45,0x34,
+0x34,0x22,0x22,0x43,0x44,0x43,0x33,0x24,0x33,0x43,0x33,0x23,0x11,0xa9,0xcc,0xcb,
+0xab,0xaa,0xbb,0xcc,0xcc,0xca,0xba,0xcd,0xcd,0xbc,0xbc,0xab,0xaa,0xa9,0xaa,0xbb,
+0xab,0x9a,0xb9,0xeb,0xbc,0xab,0x09,0x21,0x33,0x53,0x43,0x44,0x43,0x33,0x32,0x43,
+0x35,0x35,0x43,0x22,0x32,0x32,0x24,0x23,0x22,0x22,0x44,0x23,0x12,0x99,0xba,0x9a,
+0xba,0xde,0xcc,0xbb,0x9a,0x98,0xb9,0xce,0xbc,0xbb,0xbb,0xbb,0xcc,0xbb,0xab,0x08,
+0x43,0x35,0x34,0x32,0x21,0x21,0x53,0x53,0x33,0x34,0x45,0x54,0x53,0x33,0x23,0x22,
+0x12,0x22,0x33,0x23,0x11,0x12,0x44,0x34,0x23,0x80,0xba,0xbc,0xba,0xdb,0xbd,0xbd,
+0xab,0xbb,0xcc,0xcc,0xcb,0xbb,0xba,0xba,0xcb,0xbb,0xaa,0x9a,0xca,0xbc,0xac,0x8a,
+0x10,0x22,0x22,0x42,0x45,0x44,0x22,0x12,0x31,0x44,0x44,0x33,0x23,0x33,0x33,0x44,
+0x22,0x22,0x90,0xdb,0xcc,0xbb,0x9b,0x99,0xb9,0xcc,0xcb,0xaa,0xdb,0xce,0xbe,0xcc,
+0xba,0xaa,0x99,0x99,0xa9,0x99,0x9a,0x8a,0x28,0x64,0x44,0x33,0x22,0x10,0x10,0x22,
+0x24,0x23,0x31,0x55,0x45,0x53,0x23,0x23,0x12,0x21,0x11,0x22,0x23,0x22,0x81,0xeb,
+0xbd,0xbc,0xab,0x8a,0x99,0xa9,0xcb,0xcb,0xbb,0xcb,0xcd,0xcc,0xbc,0xbb,0xab,0xaa,
+0xaa,0xbb,0xbb,0xba,0xba,0xcc,0xbd,0xac,0x99,0x00,0x22,0x22,0x33,0x46,0x43,0x24,
+0x33,0x33,0x45,0x43,0x33,0x24,0x23,0x33,0x34,0x23,0x23,0x11,0x12,0x00,0xa9,0xdb,
+0xab,0xab,0xdb,0xcd,0xcc,0xbb,0xbb,0xcb,0xcc,0xdb,0xbb,0xbb,0xbb,0xbc,0xbc,0xab,
+0xab,0xa9,0xa9,0x89,0x18,0x32,0x34,0x43,0x44,0x54,0x43,0x24,0x53,0x53,0x34,0x35,
+0x33,0x23,0x23,0x23,0x24,0x23,0x21,0x21,0x53,0x44,0x23,0x02,0x98,0xaa,0xaa,0xba,
+0xdd,0xdb,0xab,0xaa,0x98,0xba,0xdc,0xbc,0xcb,0xab,0xcb,0xca,0xaa,0x9a,0x89,0x00,
+0x11,0x22,0x34,0x43,0x33,0x44,0x44,0x43,0x43,0x43,0x34,0x35,0x34,0x33,0x32,0x32,
+0x43,0x33,0x32,0x11,0x21,0x53,0x33,0x13,0xa8,0xbc,0xcb,0xca,0xeb,0xcb,0xbc,0xcb,
+0xdb,0xdb,0xcb,0xbb,0xbb,0xab,0xbb,0xbc,0xbb,0xaa,0xba,0xbb,0xbd,0xab,0x09,0x32,
+0x34,0x24,0x34,0x54,0x43,0x22,0x22,0x21,0x53,0x44,0x43,0x23,0x23,0x43,0x32,0x24,
+0x21,0x90,0xa9,0xbc,0xbb,0xab,0xab,0xcc,0xcc,0xcb,0xcb,0xcb,0xcd,0xdc,0xcb,0xbb,
+0xab,0xaa,0xb9,0xba,0xbb,0xaa,0xa8,0xba,0xbf,0xbc,0x8a,0x28,0x32,0x32,0x32,0x54,
+0x44,0x43,0x32,0x32,0x44,0x34,0x34,0x33,0x33,0x33,0x34,0x33,0x23,0x33,0x34,0x25,
+0x13,0x80,0xa9,0xaa,0xba,0xeb,0xcd,0xcb,0xab,0x9a,0x9a,0xcc,0xcc,0xcb,0xab,0xba,
+0xba,0xbc,0xbc,0x9a,0x20,0x44,0x43,0x22,0x21,0x11,0x43,0x34,0x34,0x33,0x35,0x46,
+0x45,0x33,0x34,0x22,0x12,0x22,0x32,0x32,0x12,0x11,0x32,0x35,0x25,0x12,0x98,0xaa,
+0xbb,0xcb,0xcc,0xcc,0xbb,0xbc,0xbb,0xcd,0xbb,0xad,0xbb,0xba,0xca,0xab,0xbb,0xab,
+0xaa,0xcb,0xbc,0xab,0x08,0x22,0x24,0x32,0x45,0x54,0x23,0x33,0x22,0x42,0x44,0x53,
+0x32,0x32,0x23,0x43,0x33,0x23,0x12,0xa8,0xdd,0xdb,0xba,0x99,0x99,0xba,0xbd,0xbb,
+0xbb,0xdd,0xde,0xcc,0xbb,0xac,0xa9,0x98,0x9a,0x99,0x9a,0x8a,0x89,0x31,0x46,0x44,
+0x32,0x11,0x01,0x21,0x32,0x24,0x12,0x42,0x45,0x36,0x34,0x33,0x23,0x12,0x22,0x31,
+0x32,0x32,0x13,0xa1,0xdd,0xcc,0xbb,0xab,0xa9,0xa8,0xaa,0xbc,0xbc,0xbb,0xcd,0xcc,
+0xbc,0xbc,0xac,0x9a,0x9a,0xaa,0xba,0xaa,0x9b,0xba,0xcc,0xbc,0xbb,0x09,0x20,0x32,
+0x42,0x53,0x35,0x35,0x32,0x32,0x43,0x54,0x43,0x23,0x33,0x32,0x34,0x33,0x23,0x21,
+0x10,0x12,0x01,0xa8,0xbd,0xac,0xab,0xdc,0xcc,0xcb,0xbb,0xab,0xcb,0xbd,0xbd,0xbc,
+0xba,0xba,0xcb,0xbb,0xbb,0xab,0xa9,0xaa,0x9a,0x28,0x63,0x43,0x43,0x33,0x35,0x35,
+0x34,0x44,0x35,0x35,0x34,0x33,0x22,0x22,0x33,0x33,0x33,0x11,0x32,0x45,0x35,0x22,
+0x81,0xa8,0xab,0xaa,0xcb,0xcd,0xcb,0xab,0xaa,0xa9,0xcc,0xcc,0xbc,0xba,0xab,0xbb,
+0xbc,0xbb,0xab,0x09,0x10,0x33,0x34,0x43,0x43,0x53,0x53,0x43,0x43,0x43,0x43,0x44,
+0x34,0x43,0x32,0x22,0x22,0x33,0x23,0x13,0x12,0x33,0x35,0x24,0x81,0xb9,0xbc,0xba,
+0xba,0xce,0xcc,0xbc,0xcb,0xdb,0xdb,0xbb,0xac,0xab,0xaa,0xba,0xbb,0xac,0x9a,0xaa,
+0xca,0xbb,0x9b,0x28,0x43,0x33,0x42,0x63,0x34,0x35,0x32,0x21,0x32,0x45,0x43,0x33,
+0x24,0x23,0x34,0x33,0x23,0x11,0x98,0xb9,0xdb,0xcb,0xab,0xab,0xdb,0xdb,0xbc,0xcb,
+0xbc,0xce,0xcc,0xbc,0xbb,0xaa,0xa9,0xaa,0xba,0xab,0xaa,0x99,0xdb,0xcc,0xab,0x8a,
+0x11,0x22,0x33,0x63,0x53,0x34,0x33,0x43,0x33,0x45,0x43,0x33,0x32,0x33,0x34,0x33,
+0x24,0x22,0x32,0x43,0x24,0x12,0x98,0xaa,0xba,0xb9,0xcd,0xcd,0xbb,0xac,0x9a,0xba,
+0xdc,0xcb,0xcb,0xba,0xbb,0xcb,0xbb,0xab,0x8a,0x31,0x45,0x43,0x32,0x12,0x12,0x34,
+0x35,0x34,0x43,0x34,0x46,0x44,0x33,0x24,0x22,0x21,0x22,0x32,0x22,0x12,0x20,0x42,
+0x34,0x23,0x81,0xa9,0xbb,0xcb,0xcc,0xdc,0xcb,0xbb,0xbb,0xdb,0xdb,0xcb,0xac,0xaa,
+0xba,0xbb,0xbb,0xac,0xa9,0xaa,0xcb,0xac,0x8a,0x10,0x22,0x33,0x53,0x54,0x34,0x24,
+0x23,0x21,0x43,0x44,0x34,0x32,0x33,0x43,0x42,0x32,0x12,0x81,0xba,0xbe,0xbc,0xaa,
+0x99,0xa8,0xbc,0xbd,0xac,0xca,0xfb,0xdc,0xbc,0xbc,0xba,0xa9,0x99,0xa9,0xa9,0xba,
+0xa9,0x10,0x73,0x44,0x33,0x23,0x01,0x01,0x32,0x34,0x24,0x21,0x52,0x45,0x35,0x34,
+0x33,0x22,0x12,0x22,0x31,0x32,0x23,0x82,0xca,0xce,0xcb,0xab,0x99,0x99,0xa9,0xca,
+0xbb,0xcb,0xcb,0xcc,0xbd,0xbd,0xbb,0xac,0xa9,0x9a,0xab,0xbb,0xba,0xa9,0xca,0xcc,
+0xcb,0x9a,0x18,0x31,0x32,0x32,0x35,0x36,0x34,0x33,0x43,0x53,0x34,0x43,0x33,0x33,
+0x33,0x34,0x33,0x33,0x21,0x22,0x11,0x80,0xcb,0xcc,0xaa,0xba,0xcd,0xbd,0xad,0xbb,
+0xab,0xcc,0xdb,0xcb,0xbb,0xab,0xcb,0xba,0xac,0xab,0xaa,0xa9,0x9a,0x09,0x21,0x44,
+0x32,0x43,0x44,0x44,0x43,0x43,0x34,0x45,0x53,0x32,0x23,0x13,0x32,0x32,0x33,0x22,
+0x12,0x43,0x45,0x33,0x12,0x98,0xaa,0xab,0xba,0xdd,0xbc,0xbc,0xaa,0x9a,0xca,0xcc,
+0xdb,0xba,0xbb,0xca,0xbb,0xbb,0xac,0x99,0x88,0x08,0x22,0x53,0x23,0x43,0x33,0x46,
+0x53,0x42,0x32,0x34,0x35,0x35,0x33,0x32,0x22,0x33,0x24,0x33,0x12,0x22,0x32,0x25,
+0x13,0x98,0xca,0xbb,0xac,0xcc,0xcc,0xcb,0xcb,0xcb,0xcc,0xcb,0xcb,0xba,0xaa,0xab,
+0xcb,0xba,0xaa,0xaa,0xba,0xbc,0xab,0x89,0x31,0x53,0x42,0x42,0x53,0x34,0x33,0x23,
+0x23,0x54,0x53,0x43,0x32,0x33,0x33,0x34,0x43,0x22,0x01,0x98,0xaa,0xbc,0xbb,0xbb,
+0xbc,0xcc,0xbc,0xbd,0xbc,0xcc,0xbd,0xbe,0xcb,0xab,0xaa,0x9a,0xba,0xba,0xab,0xa9,
+0xa9,0xbc,0xbe,0xaa,0x08,0x31,0x32,0x43,0x63,0x53,0x33,0x33,0x24,0x34,0x45,0x33,
+0x33,0x24,0x33,0x43,0x23,0x22,0x21,0x32,0x44,0x32,0x00,0xa9,0xbb,0xa9,0xcb,0xce,
+0xbc,0xac,0xaa,0xaa,0xeb,0xdb,0xbb,0xcb,0xaa,0xbb,0xcb,0xbb,0xab,0x09,0x31,0x45,
+0x33,0x23,0x23,0x43,0x44,0x43,0x43,0x43,0x54,0x44,0x53,0x23,0x33,0x22,0x21,0x32,
+0x32,0x23,0x11,0x22,0x63,0x33,0x13,0x90,0xca,0xbb,0xcb,0xdb,0xcc,0xdb,0xba,0xbb,
+0xdb,0xbc,0xcc,0xba,0xaa,0xab,0xbb,0xbc,0xaa,0xaa,0xba,0xbc,0xac,0x09,0x21,0x33,
+0x33,0x45,0x44,0x34,0x24,0x21,0x32,0x54,0x43,0x33,0x33,0x23,0x34,0x33,0x33,0x13,
+0x98,0xdb,0xbd,0xac,0xaa,0x99,0xb9,0xdc,0xcb,0xab,0xcb,0xed,0xcc,0xbc,0xac,0x9b,
+0x9a,0x99,0x9a,0x9a,0xaa,0x99,0x10,0x54,0x35,0x43,0x12,0x11,0x10,0x32,0x43,0x22,
+0x32,0x64,0x54,0x34,0x43,0x22,0x22,0x11,0x21,0x21,0x23,0x13,0x81,0xda,0xbd,0xbc,
+0xaa,0x9a,0x99,0xaa,0xbc,0xcb,0xac,0xbc,0xcd,0xbc,0xcc,0xba,0xaa,0x9a,0xaa,0xbb,
+0xcb,0x9a,0xaa,0xbc,0xbd,0xbc,0x99,0x00,0x22,0x22,0x32,0x55,0x53,0x32,0x43,0x32,
+0x44,0x34,0x33,0x24,0x33,0x33,0x24,0x33,0x22,0x12,0x12,0x01,0x99,0xdb,0xab,0xcb,
+0xcb,0xdc,0xbc,0xad,0x9a,0x09,0x10,0x11,0x80,0x88,0x08,0x11,0x11,0x88,0x99,0x30,
+0x56,0x43,0x22,0x01,0x80,0x11,0x22,0x11,0xa8,0x9b,0x71,0x57,0x44,0x33,0x22,0x80,
+0x88,0x10,0x12,0x91,0xaa,0x49,0x77,0x53,0x33,0x12,0x00,0x88,0x18,0x00,0x98,0xaa,
+0x09,0x65,0x35,0x34,0x23,0x01,0x98,0x98,0x80,0x80,0x98,0x8a,0x61,0x56,0x33,0x33,
+0x00,0x99,0x89,0x00,0x90,0xca,0xbb,0x09,0x44,0x34,0x22,0x00,0x88,0x88,0xb9,0xdd,
+0xdb,0xa9,0x10,0x43,0x34,0x12,0x80,0xba,0xbb,0xac,0xaa,0xbb,0xdb,0xdc,0xdc,0xcc,
+0xbb,0xbb,0x89,0x88,0x99,0xbb,0xaa,0xa9,0xea,0xdd,0xbd,0xbb,0xaa,0x89,0x98,0xaa,
+0x99,0x10,0x12,0xfa,0xdf,0xcc,0xbb,0xba,0x99,0x98,0x88,0x88,0x00,0x00,0xd9,0xde,
+0xcc,0xbb,0x9b,0x89,0x80,0xa8,0xaa,0x08,0x43,0x02,0xfd,0xce,0xbb,0xab,0x89,0x00,
+0x88,0x98,0x08,0x21,0x12,0xc9,0xcf,0xcb,0xaa,0x09,0x08,0x80,0x88,0x18,0x22,0x33,
+0xa8,0xcf,0xcb,0x9a,0x08,0x01,0x01,0x80,0x00,0x11,0x32,0x55,0x54,0x34,0x24,0x12,
+0x01,0x10,0x31,0x23,0x01,0x89,0x61,0x57,0x44,0x33,0x13,0x11,0x08,0x01,0x12,0x80,
+0xa9,0x48,0x77,0x44,0x24,0x22,0x00,0x80,0x18,0x00,0x80,0x9a,0x19,0x65,0x35,0x34,
+0x22,0x01,0x80,0x00,0x88,0x88,0x99,0x09,0x41,0x54,0x43,0x22,0x02,0x98,0x99,0x08,
+0x00,0x98,0xba,0x8a,0x73,0x35,0x12,0xa0,0x9a,0x0a,0x10,0xa0,0xbd,0xbd,0xcb,0xcc,
+0xcd,0xcb,0xaa,0x99,0x88,0x88,0x99,0x89,0xb9,0xde,0xdc,0xcb,0xbb,0xaa,0x8a,0x89,
+0x99,0x99,0x88,0x01,0xf9,0xdf,0xcd,0xbb,0x9a,0x09,0x00,0x99,0xa9,0x10,0x43,0xd0,
+0xdf,0xcc,0xbb,0x9a,0x88,0x88,0x88,0x08,0x80,0x80,0x28,0x74,0x46,0x43,0x22,0x01,
+0x88,0x00,0x11,0x00,0xa9,0x09,0x74,0x44,0x33,0x22,0x01,0x01,0x08,0x08,0x88,0x10,
+0x81,0xfa,0xcf,0xbc,0xab,0x99,0x08,0x08,0x89,0x09,0x18,0x11,0xb9,0xce,0xbc,0xbb,
+0x89,0x08,0x08,0x89,0x89,0x00,0x12,0xa0,0xed,0xcc,0xbb,0xab,0x88,0x00,0x01,0x10,
+0x11,0x22,0x81,0xda,0xbe,0xbb,0x89,0x21,0x12,0x80,0x88,0x53,0x36,0x13,0xda,0xcd,
+0xbb,0x8a,0x10,0x12,0x81,0x80,0x00,0x33,0x46,0x54,0x34,0x35,0x32,0x11,0x80,0x18,
+0x21,0x32,0x12,0x22,0x54,0x36,0x35,0x23,0x22,0x11,0x11,0x22,0x00,0x89,0x39,0x77,
+0x37,0x43,0x23,0x12,0x00,0x18,0x10,0x80,0xb9,0xab,0x73,0x67,0x33,0x33,0x12,0x80,
+0x80,0x80,0x80,0xa9,0x8a,0x51,0x47,0x43,0x32,0x11,0x80,0x08,0x00,0x80,0x98,0x89,
+0x30,0x47,0x35,0x24,0x12,0x00,0x88,0x80,0x00,0x90,0xb9,0x9a,0x41,0x46,0x33,0x02,
+0xa8,0xa9,0x00,0x00,0xdb,0xbd,0x9b,0x41,0x45,0x22,0x00,0x98,0x00,0x88,0xba,0xae,
+0xab,0x99,0xeb,0xcd,0xcc,0xab,0xaa,0x9a,0xa9,0x8a,0x09,0x00,0xb8,0xdf,0xbd,0xcb,
+0xaa,0x99,0x88,0x98,0xa9,0x9a,0x18,0x12,0xf9,0xff,0xcb,0xab,0x9a,0x09,0x08,0x99,
+0x99,0x00,0x22,0xd9,0xdf,0xdb,0xaa,0x8a,0x88,0x80,0x99,0x98,0x10,0x22,0xb8,0xff,
+0xbd,0xac,0xaa,0x89,0x00,0x08,0x88,0x08,0x21,0x01,0xea,0xdc,0xbb,0xab,0x88,0x01,
+0x01,0x88,0x00,0x21,0x11,0xb8,0xcd,0xbc,0xab,0x99,0x08,0x11,0x23,0x14,0x23,0x44,
+0x56,0x63,0x33,0x23,0x02,0x01,0x21,0x33,0x24,0x91,0x88,0x72,0x67,0x43,0x32,0x11,
+0x80,0x08,0x21,0x12,0x80,0x89,0x73,0x57,0x43,0x23,0x11,0x80,0x00,0x10,0x11,0x98,
+0xa9,0x38,0x67,0x44,0x23,0x22,0x00,0x88,0x00,0x00,0x88,0x98,0x00,0x44,0x44,0x33,
+0x02,0x00,0x98,0x80,0x80,0x99,0xbb,0x0a,0x61,0x44,0x23,0x12,0x00,0x99,0xc9,0xca,
+0xbb,0x9a,0xb9,0xec,0xdd,0xcb,0xba,0xa9,0x98,0xa9,0xbb,0x09,0x21,0xa1,0xff,0xbe,
+0xbc,0xab,0x99,0x88,0x98,0x99,0x89,0x10,0x92,0xfe,0xce,0xbc,0xbb,0x99,0x80,0x80,
+0x98,0x89,0x31,0x14,0xfa,0xdf,0xcb,0xab,0x9a,0x88,0x08,0x80,0x80,0x98,0x08,0x52,
+0x56,0x44,0x23,0x12,0x00,0x08,0x10,0x11,0x98,0xaa,0x38,0x67,0x53,0x32,0x12,0x10,
+0x08,0x80,0x08,0x08,0x01,0xb0,0xdf,0xcd,0xba,0x9b,0x89,0x80,0x88,0x89,0x09,0x11,
+0x80,0xea,0xcc,0xbb,0xaa,0x89,0x08,0x80,0x88,0x08,0x20,0x81,0xe9,0xcd,0xad,0xab,
+0x99,0x80,0x00,0x08,0x10,0x32,0x23,0xb9,0xde,0xba,0x9a,0x08,0x80,0x08,0x18,0x43,
+0x34,0x23,0xa0,0xec,0xcc,0xbc,0x9a,0x08,0x32,0x24,0x01,0x99,0x88,0x64,0x54,0x53,
+0x22,0x12,0x10,0x10,0x21,0x33,0x12,0x98,0x09,0x74,0x54,0x33,0x12,0x10,0x10,0x32,
+0x25,0x81,0x98,0x30,0x77,0x34,0x24,0x13,0x01,0x01,0x20,0x21,0x01,0x98,0x19,0x75,
+0x45,0x34,0x23,0x02,0x80,0x80,0x00,0x00,0x98,0x08,0x73,0x45,0x34,0x23,0x01,0x88,
+0x80,0x10,0x81,0x99,0x9b,0x51,0x56,0x43,0x23,0x02,0x80,0x88,0x00,0x81,0x90,0xab,
+0x9a,0x61,0x44,0x33,0x12,0x98,0xa9,0xa9,0xbb,0xbd,0x9c,0x19,0x32,0x04,0xb8,0xbc,
+0x8b,0x18,0x98,0xdd,0xcb,0xab,0xcb,0xce,0xbd,0xac,0xaa,0x89,0x99,0xa9,0xaa,0x08,
+0x81,0xd9,0xce,0xbd,0xbb,0xaa,0x99,0x99,0xa9,0xab,0x89,0x01,0xd0,0xff,0xdc,0xbb,
+0xab,0x99,0x00,0x80,0xa9,0x99,0x10,0x00,0xfb,0xcf,0xbc,0xbb,0x99,0x88,0x98,0x98,
+0x88,0x32,0x12,0xfb,0xff,0xba,0xab,0x8a,0x08,0x00,0x88,0x89,0x00,0x12,0xa1,0xdd,
+0xbd,0xab,0x9a,0x80,0x08,0x88,0x10,0x32,0x24,0x80,0xeb,0xcb,0x9b,0x9a,0x88,0x00,
+0x11,0x22,0x23,0x43,0x64,0x54,0x53,0x33,0x23,0x11,0x01,0x11,0x23,0x13,0x11,0x62,
+0x57,0x54,0x33,0x23,0x01,0x80,0x00,0x22,0x02,0xa9,0x1a,0x77,0x45,0x34,0x22,0x01,
+0x80,0x18,0x11,0x81,0x98,0x0a,0x72,0x46,0x43,0x22,0x01,0x80,0x08,0x00,0x00,0x98,
+0x89,0x20,0x54,0x34,0x33,0x11,0x80,0x08,0x00,0x88,0xba,0xbc,0x0a,0x55,0x34,0x23,
+0x81,0x98,0x80,0x80,0xa8,0xcc,0xaa,0xba,0xed,0xcd,0xac,0x9b,0x88,0x01,0x98,0xaa,
+0x8a,0x00,0xd9,0xee,0xbd,0xac,0x9b,0x89,0x00,0x88,0x98,0x89,0x88,0xb8,0xff,0xcd,
+0xcb,0xaa,0x89,0x00,0x88,0xa9,0x88,0x32,0x03,0xef,0xbe,0xbd,0xaa,0x8a,0x88,0x80,
+0x80,0x80,0x88,0x18,0x73,0x46,0x34,0x23,0x12,0x88,0x00,0x10,0x02,0xa8,0x9a,0x61,
+0x46,0x34,0x33,0x12,0x00,0x00,0x08,0x08,0x00,0x81,0xeb,0xde,0xbc,0xcb,0x99,0x09,
+0x08,0x89,0x88,0x08,0x11,0x90,0xeb,0xcc,0xba,0x9a,0x88,0x88,0x98,0x98,0x00,0x11,
+0x90,0xec,0xcc,0xac,0xaa,0x89,0x88,0x00,0x00,0x01,0x11,0x01,0xb8,0xdc,0xdb,0xaa,
+0x9a,0x10,0x21,0x33,0x43,0x12,0x90,0xec,0xcc,0xac,0x9b,0x18,0x21,0x12,0x01,0x98,
+0x19,0x72,0x55,0x53,0x33,0x32,0x22,0x11,0x11,0x21,0x22,0x22,0x53,0x44,0x35,0x35,
+0x33,0x23,0x11,0x00,0x01,0x80,0x99,0x0a,0x67,0x46,0x44,0x23,0x11,0x01,0x18,0x21,
+0x11,0x98,0x99,0x61,0x47,0x34,0x24,0x12,0x00,0x00,0x10,0x10,0x98,0x9a,0x29,0x56,
+0x45,0x33,0x22,0x00,0x80,0x08,0x08,0x98,0x9a,0x18,0x65,0x35,0x34,0x22,0x01,0x98,
+0x89,0x09,0x08,0x80,0x88,0x18,0x63,0x44,0x22,0x00,0x98,0x00,0x22,0x91,0xfb,0xbb,
+0x20,0x47,0x33,0x02,0x98,0x89,0x08,0x90,0xca,0xbc,0xbb,0xdb,0xdd,0xbc,0xad,0x9a,
+0x89,0x99,0x99,0x9a,0x8a,0xaa,0xcd,0xcc,0xbc,0xac,0xab,0xa9,0x88,0x88,0x80,0x90,
+0xba,0xdf,0xcd,0xbd,0xbb,0x9b,0x89,0x98,0xb9,0xcc,0xba,0xa9,0xb9,0xec,0xcc,0xbc,
+0xba,0x89,0x88,0x00,0x98,0x08,0x10,0xa8,0xef,0xdc,0xbb,0xab,0x89,0x08,0x88,0x89,
+0x09,0x22,0x12,0xd9,0xdd,0xbb,0xab,0x9a,0x98,0x80,0x18,0x21,0x33,0x11,0xa9,0xcd,
+0xbd,0xac,0x9a,0x10,0x32,0x23,0x80,0x99,0x40,0x46,0x45,0x43,0x24,0x33,0x22,0x11,
+0x81,0x80,0x88,0x20,0x75,0x45,0x44,0x23,0x12,0x00,0x00,0x22,0x21,0xa8,0xac,0x49,
+0x67,0x34,0x34,0x21,0x00,0x00,0x10,0x10,0x98,0x9a,0x38,0x67,0x53,0x32,0x22,0x10,
+0x08,0x08,0x08,0x08,0x08,0x08,0x32,0x46,0x34,0x22,0x82,0x98,0x98,0x01,0x90,0xba,
+0xad,0x40,0x45,0x24,0x00,0xa9,0x99,0x08,0x00,0xaa,0xad,0x9a,0xb9,0xde,0xcc,0xab,
+0x8a,0x88,0x99,0xbb,0x8a,0x21,0xa1,0xff,0xcc,0xbb,0xac,0x99,0x99,0x98,0x98,0x99,
+0x00,0x12,0xe8,0xef,0xbd,0xbc,0x9a,0x88,0x81,0x98,0x9a,0x10,0x24,0xc0,0xff,0xcb,
+0xbb,0xa9,0x88,0x08,0x08,0x08,0x00,0x90,0x10,0x65,0x46,0x43,0x22,0x01,0x88,0x10,
+0x11,0x80,0x99,0x1a,0x74,0x44,0x33,0x22,0x01,0x00,0x00,0x80,0x88,0x00,0x80,0xec,
+0xce,0xbc,0xbb,0x99,0x08,0x88,0x88,0x89,0x00,0x81,0xc9,0xcd,0xbc,0xba,0x99,0x88,
+0x88,0x88,0x10,0x22,0x11,0xd9,0xce,0xbc,0xbb,0x9a,0x08,0x00,0x00,0x08,0x11,0x23,
+0x12,0xca,0xce,0xac,0x9a,0x08,0x21,0x02,0x00,0x28,0x53,0x33,0xc8,0xdf,0xbc,0x9a,
+0x18,0x22,0x21,0x08,0x89,0x18,0x73,0x54,0x53,0x43,0x12,0x00,0x88,0x18,0x21,0x22,
+0x80,0x89,0x41,0x56,0x33,0x23,0x22,0x22,0x32,0x01,0xb9,0xac,0x48,0x77,0x34,0x35,
+0x33,0x11,0x88,0x88,0x11,0x22,0x00,0x99,0x71,0x57,0x53,0x22,0x02,0x88,0x80,0x00,
+0x01,0x88,0x9a,0x31,0x67,0x33,0x24,0x01,0x00,0x00,0x11,0x00,0xa8,0xaa,0x38,0x47,
+0x35,0x33,0x12,0x01,0x08,0x08,0x98,0xa9,0xab,0x8b,0x41,0x55,0x43,0x23,0x01,0xa9,
+0xaa,0x8b,0x08,0x80,0x89,0x60,0x56,0x43,0x11,0x98,0xac,0x9a,0x08,0x10,0xa9,0xdb,
+0xcc,0xcd,0xbc,0xbb,0x9a,0x10,0x80,0xc9,0xba,0x19,0x20,0xd9,0xdf,0xcb,0x9a,0x09,
+0x08,0x88,0xaa,0x8a,0x00,0x80,0xde,0xce,0xbc,0xbb,0x8a,0x08,0x10,0x88,0x89,0x10,
+0x11,0xfa,0xcf,0xcc,0xab,0x9a,0x08,0x80,0x88,0x88,0x18,0x11,0xd9,0xcf,0xbd,0xac,
+0x9b,0x89,0x00,0x08,0x89,0x08,0x10,0x80,0xfb,0xbd,0xac,0x9a,0x08,0x81,0x00,0x08,
+0x21,0x11,0xa9,0xab,0x09,0xd8,0xff,0xff,0xbc,0xbc,0xbc,0xba,0xaa,0x99,0x08,0x31,
+0x54,0x34,0x35,0x53,0x33,0x33,0x24,0x12,0x12,0x01,0x00,0x99,0xcc,0xdc,0xcb,0xbb,
+0xac,0xbb,0xab,0xaa,0x08,0x31,0x45,0x34,0x44,0x33,0x44,0x32,0x23,0x22,0x12,0x11,
+0x10,0x88,0xca,0xcd,0xcc,0xcb,0xbb,0xcb,0xaa,0xaa,0x89,0x18,0x32,0x54,0x53,0x34,
+0x34,0x33,0x34,0x32,0x12,0x02,0x81,0xa8,0xdb,0xdc,0xcb,0xbc,0xac,0xab,0xab,0xab,
+0xa9,0x88,0x11,0x53,0x34,0x45,0x43,0x24,0x33,0x23,0x22,0x12,0x81,0xb9,0xcc,0xbd,
+0xbc,0xcc,0xbb,0xbc,0xba,0xaa,0xa9,0x98,0x09,0x10,0x54,0x44,0x53,0x33,0x43,0x32,
+0x23,0x22,0x80,0xca,0xcc,0xbc,0xbc,0xbc,0xcb,0xbb,0xbb,0xab,0xaa,0x09,0x41,0x45,
+0x34,0x24,0x24,0x33,0x34,0x43,0x12,0x11,0x11,0x11,0x02,0x98,0xdc,0xcc,0xcb,0xac,
+0xbb,0xaa,0xaa,0x99,0x99,0x99,0x18,0x64,0x44,0x43,0x43,0x32,0x32,0x22,0x11,0x90,
+0xc9,0xdb,0xbc,0xcc,0xcb,0xca,0xaa,0xab,0xaa,0x99,0x89,0x08,0x22,0x45,0x44,0x34,
+0x34,0x43,0x22,0x22,0x12,0x01,0x99,0xca,0xcc,0xbc,0xbd,0xcb,0xbb,0xbb,0xba,0x9a,
+0x89,0x08,0x42,0x44,0x35,0x44,0x33,0x34,0x23,0x23,0x22,0x01,0x00,0xa9,0xeb,0xcc,
+0xbc,0xcc,0xba,0xba,0xab,0xab,0x99,0x18,0x42,0x44,0x53,0x34,0x34,0x43,0x23,0x23,
+0x22,0x11,0x00,0x98,0xca,0xdc,0xdb,0xcb,0xcb,0xba,0xab,0xab,0x9a,0x08,0x32,0x46,
+0x43,0x53,0x33,0x34,0x33,0x33,0x22,0x12,0x00,0x80,0xb9,0xdd,0xcc,0xbc,0xcb,0xcb,
+0xaa,0xaa,0x9a,0x89,0x11,0x53,0x53,0x34,0x34,0x34,0x33,0x33,0x23,0x12,0x11,0x88,
+0xba,0xce,0xbc,0xbd,0xbc,0xbc,0xba,0xbb,0xaa,0x89,0x18,0x42,0x44,0x34,0x35,0x43,
+0x24,0x32,0x12,0x12,0x11,0x80,0xaa,0xbd,0xcd,0xcb,0xbc,0xbb,0xbc,0xab,0xaa,0x8a,
+0x09,0x10,0x34,0x36,0x35,0x34,0x43,0x23,0x33,0x23,0x11,0x80,0xaa,0xcd,0xbc,0xbd,
+0xbc,0xbc,0xbb,0xac,0xaa,0x99,0x88,0x08,0x31,0x54,0x44,0x43,0x43,0x32,0x23,0x23,
+0x12,0x81,0xba,0xcc,0xbd,0xbc,0xcc,0xbb,0xbc,0xbb,0xba,0xa9,0x89,0x08,0x21,0x45,
+0x44,0x34,0x34,0x33,0x43,0x32,0x21,0x01,0x98,0xb9,0xcc,0xcc,0xbc,0xcc,0xba,0xbb,
+0xbb,0xaa,0x99,0x18,0x41,0x44,0x44,0x53,0x32,0x34,0x32,0x32,0x21,0x11,0x81,0x90,
+0xc9,0xdc,0xdb,0xcb,0xbb,0xbc,0xba,0xab,0x9a,0x18,0x42,0x44,0x34,0x25,0x24,0x24,
+0x23,0x23,0x21,0x11,0x10,0x80,0x99,0xdc,0xcc,0xdb,0xbb,0xcb,0xab,0xab,0x9a,0x89,
+0x10,0x43,0x45,0x34,0x34,0x34,0x33,0x24,0x22,0x21,0x00,0x80,0xa9,0xcc,0xbd,0xbd,
+0xbc,0xac,0xab,0xab,0x9a,0x8a,0x08,0x21,0x44,0x44,0x44,0x33,0x43,0x32,0x32,0x22,
+0x01,0x90,0xba,0xcd,0xcc,0xcb,0xdb,0xba,0xcb,0xaa,0x9a,0x9a,0x88,0x00,0x31,0x54,
+0x44,0x34,0x43,0x32,0x32,0x22,0x11,0x90,0xcb,0xcd,0xcb,0xcb,0xcb,0xbb,0xbc,0xba,
+0xab,0x8a,0x08,0x53,0x44,0x33,0x25,0x43,0x43,0x32,0x33,0x22,0x11,0x21,0x11,0x81,
+0xda,0xdc,0xbc,0xcc,0xba,0xbb,0xab,0xaa,0x99,0x99,0x88,0x42,0x46,0x34,0x34,0x34,
+0x32,0x23,0x22,0x01,0x98,0xca,0xdc,0xcb,0xbc,0xbc,0xac,0xbb,0xaa,0xaa,0x8a,0x09,
+0x20,0x43,0x45,0x44,0x43,0x33,0x24,0x23,0x12,0x02,0x81,0xa8,0xdb,0xcc,0xbc,0xad,
+0xac,0xbb,0xaa,0x9b,0x9a,0x98,0x10,0x43,0x45,0x34,0x35,0x33,0x24,0x23,0x22,0x12,
+0x01,0x88,0xb9,0xcd,0xbd,0xcc,0xbb,0xac,0xbb,0xba,0x9a,0x89,0x10,0x53,0x34,0x45,
+0x43,0x33,0x34,0x33,0x22,0x12,0x11,0x08,0x99,0xcc,0xcd,0xcb,0xbc,0xbb,0xac,0xab,
+0x9b,0x8a,0x10,0x53,0x53,0x43,0x34,0x34,0x43,0x23,0x23,0x21,0x01,0x01,0x98,0xda,
+0xcc,0xbc,0xbd,0xbb,0xbc,0xba,0xba,0x99,0x08,0x32,0x54,0x34,0x44,0x33,0x44,0x22,
+0x23,0x22,0x11,0x00,0x98,0xca,0xcc,0xcc,0xcb,0xac,0xbb,0xbb,0xab,0xaa,0x88,0x20,
+0x53,0x44,0x34,0x35,0x33,0x34,0x32,0x23,0x21,0x01,0x88,0xcb,0xdc,0xbc,0xbd,0xcb,
+0xbb,0xbb,0xbb,0xaa,0x99,0x08,0x32,0x45,0x35,0x44,0x43,0x33,0x23,0x33,0x22,0x01,
+0x80,0xca,0xcd,0xdb,0xcb,0xcb,0xbb,0xac,0xab,0xa9,0x89,0x09,0x00,0x42,0x54,0x34,
+0x34,0x34,0x32,0x33,0x23,0x11,0x90,0xca,0xcc,0xbc,0xbd,0xbc,0xcb,0xbb,0xba,0xaa,
+0x9a,0x89,0x18,0x42,0x54,0x44,0x43,0x33,0x24,0x23,0x22,0x12,0x81,0x98,0xda,0xeb,
+0xcb,0xcb,0xcb,0xbb,0xbb,0xba,0xaa,0x99,0x11,0x44,0x44,0x53,0x43,0x33,0x34,0x32,
+0x23,0x12,0x11,0x80,0x99,0xeb,0xbc,0xbe,0xdb,0xba,0xbb,0xba,0xaa,0x8a,0x10,0x44,
+0x34,0x35,0x34,0x53,0x23,0x24,0x22,0x11,0x01,0x01,0x08,0xb9,0xdc,0xcc,0xbc,0xbb,
+0xbc,0xab,0xab,0x99,0x09,0x31,0x44,0x35,0x35,0x34,0x43,0x23,0x23,0x23,0x11,0x00,
+0x98,0xda,0xeb,0xdb,0xcb,0xbb,0xbc,0xba,0xaa,0x9a,0x89,0x00,0x42,0x44,0x34,0x35,
+0x43,0x33,0x23,0x33,0x12,0x01,0x98,0xeb,0xdb,0xbc,0xcc,0xbb,0xbc,0xba,0xbb,0xaa,
+0x99,0x88,0x20,0x63,0x54,0x43,0x43,0x33,0x42,0x22,0x12,0x01,0xa8,0xcb,0xcc,0xbc,
+0xcc,0xca,0xba,0xab,0xbb,0xaa,0x99,0x10,0x44,0x44,0x43,0x43,0x33,0x34,0x43,0x22,
+0x12,0x11,0x11,0x00,0x98,0xcc,0xbd,0xbd,0xbc,0xac,0xab,0xaa,0xa9,0x89,0x88,0x10,
+0x44,0x35,0x35,0x34,0x33,0x33,0x33,0x22,0x00,0xa9,0xcd,0xdb,0xdb,0xbb,0xad,0xcb,
+0xaa,0xaa,0x9a,0x98,0x08,0x21,0x63,0x34,0x35,0x34,0x24,0x23,0x23,0x12,0x11,0x88,
+0xba,0xcd,0xbc,0xbd,0xbc,0xcb,0xab,0xab,0x9b,0x8a,0x09,0x21,0x54,0x34,0x35,0x34,
+0x24,0x33,0x23,0x22,0x11,0x80,0x98,0xdb,0xcc,0xbc,0xbd,0xcb,0xbb,0xab,0xab,0xa9,
+0x08,0x20,0x44,0x35,0x35,0x34,0x24,0x33,0x23,0x23,0x21,0x01,0x88,0xca,0xcc,0xbd,
+0xcc,0xbb,0xac,0xbb,0xba,0x9a,0x88,0x21,0x63,0x53,0x53,0x33,0x34,0x43,0x32,0x12,
+0x12,0x10,0x80,0x99,0xcc,0xcc,0xbc,0xad,0xbb,0xac,0xab,0x9a,0x89,0x00,0x33,0x45,
+0x34,0x35,0x33,0x25,0x23,0x23,0x12,0x11,0x08,0xa9,0xcc,0xcc,0xbc,0xcc,0xba,0xbb,
+0xcb,0x9a,0x8a,0x08,0x21,0x53,0x34,0x35,0x44,0x32,0x43,0x22,0x21,0x01,0x00,0xa8,
+0xca,0xbd,0xbd,0xbc,0xbc,0xac,0xab,0x9a,0x9a,0x88,0x18,0x32,0x45,0x44,0x34,0x43,
+0x23,0x33,0x23,0x12,0x00,0x99,0xcb,0xcd,0xbc,0xbd,0xcb,0xbb,0xac,0xaa,0xa9,0x88,
+0x08,0x20,0x63,0x53,0x34,0x34,0x33,0x43,0x22,0x22,0x01,0x98,0xcb,0xcc,0xdb,0xcb,
+0xbc,0xbb,0xac,0xab,0xa9,0x99,0x88,0x11,0x53,0x44,0x34,0x25,0x24,0x32,0x22,0x22,
+0x11,0x80,0xa9,0xdb,0xcc,0xbc,0xbc,0xbc,0xcb,0xaa,0xaa,0x99,0x08,0x20,0x53,0x44,
+0x43,0x34,0x34,0x23,0x33,0x22,0x12,0x11,0x88,0xba,0xce,0xcc,0xcb,0xcb,0xab,0xbb,
+0xbb,0xaa,0x88,0x31,0x44,0x35,0x44,0x33,0x35,0x33,0x33,0x23,0x22,0x11,0x00,0xa8,
+0xcc,0xdd,0xcb,0xcb,0xbb,0xbb,0xbb,0xab,0x99,0x00,0x43,0x35,0x45,0x43,0x43,0x43,
+0x32,0x22,0x21,0x01,0x00,0x99,0xdb,0xcc,0xcc,0xbb,0xbc,0xbb,0xbb,0xab,0x9a,0x09,
+0x20,0x44,0x35,0x35,0x34,0x34,0x33,0x33,0x32,0x11,0x81,0xa9,0xcc,0xbd,0xbd,0xcc,
+0xbb,0xbb,0xcb,0xaa,0x99,0x89,0x08,0x21,0x44,0x45,0x43,0x24,0x33,0x33,0x32,0x12,
+0x81,0xb9,0xbe,0xbd,0xbc,0xad,0xac,0xbb,0xab,0xbb,0x9a,0x09,0x30,0x54,0x53,0x43,
+0x43,0x33,0x44,0x22,0x22,0x11,0x01,0x01,0x90,0xc9,0xcc,0xbd,0xdb,0xba,0xac,0xaa,
+0x9a,0x8a,0x89,0x00,0x32,0x45,0x35,0x44,0x23,0x24,0x22,0x12,0x11,0x80,0xa9,0xdb,
+0xcc,0xdb,0xbb,0xbc,0xbb,0xac,0xaa,0x99,0x09,0x10,0x32,0x45,0x35,0x44,0x42,0x22,
+0x23,0x22,0x12,0x00,0x98,0xbb,0xdd,0xcb,0xcc,0xbb,0xcb,0xba,0xaa,0xaa,0x89,0x00,
+0x33,0x45,0x44,0x34,0x43,0x43,0x22,0x22,0x12,0x10,0x08,0xa9,0xcc,0xcc,0xbc,0xbc,
+0xcb,0xab,0xab,0xaa,0x99,0x18,0x31,0x45,0x63,0x33,0x35,0x33,0x34,0x22,0x12,0x01,
+0x81,0x98,0xca,0xcd,0xbc,0xcc,0xba,0xac,0xaa,0xaa,0x99,0x88,0x31,0x53,0x44,0x34,
+0x34,0x34,0x23,0x33,0x22,0x11,0x01,0x80,0xca,0xdc,0xcc,0xcb,0xbb,0xbc,0xba,0xba,
+0x9a,0x88,0x10,0x53,0x34,0x36,0x53,0x33,0x33,0x24,0x13,0x12,0x10,0x88,0xb9,0xdc,
+0xcc,0xdb,0xbb,0xbb,0xbc,0xaa,0x9b,0x8a,0x18,0x42,0x63,0x43,0x34,0x34,0x24,0x23,
+0x23,0x12,0x11,0x80,0xb9,0xdc,0xdb,0xbc,0xdb,0xbb,0xbb,0xbb,0xab,0x9a,0x88,0x31,
+0x54,0x34,0x45,0x33,0x34,0x33,0x23,0x23,0x02,0x81,0xb9,0xcc,0xdc,0xcb,0xbc,0xac,
+0xcb,0xaa,0xaa,0x99,0x88,0x00,0x32,0x54,0x44,0x43,0x43,0x32,0x32,0x22,0x12,0x01,
+0xa9,0xdb,0xcc,0xdb,0xcb,0xbb,0xbc,0xbb,0xab,0xaa,0x89,0x08,0x32,0x55,0x53,0x34,
+0x43,0x33,0x24,0x22,0x21,0x10,0x88,0xb9,0xcc,0xcc,0xbc,0xbc,0xac,0xbb,0xba,0xaa,
+0x99,0x18,0x31,0x45,0x44,0x53,0x42,0x32,0x33,0x22,0x22,0x11,0x00,0x98,0xda,0xcc,
+0xbd,0xdb,0xbb,0xbb,0xbb,0xbb,0xa9,0x08,0x32,0x55,0x53,0x43,0x43,0x43,0x32,0x23,
+0x22,0x12,0x10,0x88,0xba,0xdd,0xdb,0xcb,0xac,0xcb,0xaa,0xaa,0x9a,0x88,0x10,0x42,
+0x44,0x53,0x43,0x43,0x23,0x33,0x22,0x22,0x00,0x90,0xb9,0xcd,0xcc,0xbc,0xbc,0xbc,
+0xba,0xba,0xaa,0x99,0x00,0x22,0x45,0x53,0x34,0x34,0x43,0x32,0x23,0x12,0x11,0x90,
+0xb9,0xdc,0xbc,0xbd,0xbc,0xcb,0xab,0xbb,0xab,0x99,0x09,0x10,0x43,0x45,0x44,0x43,
+0x43,0x32,0x32,0x22,0x11,0x88,0xba,0xbd,0xcd,0xcb,0xcb,0xac,0xbb,0xba,0xab,0x9a,
+0x08,0x42,0x44,0x53,0x33,0x44,0x33,0x43,0x32,0x12,0x22,0x11,0x00,0xa9,0xeb,0xcc,
+0xbc,0xbc,0xbc,0xba,0xba,0xa9,0x99,0x88,0x20,0x63,0x44,0x34,0x44,0x32,0x32,0x32,
+0x12,0x11,0x98,0xca,0xcc,0xdb,0xbc,0xbc,0xbb,0xaa,0x99,0x88,0x89,0x89,0x89,0x08,
+0x88,0x80,0x88,0x10,0x11,0x02,0x01,0x00,0x11,0x02,0x80,0x10,0x53,0x35,0x23,0x01,
+0x21,0x34,0x26,0x23,0x11,0x01,0x11,0x12,0x33,0x64,0x53,0x33,0x32,0x21,0x33,0x37,
+0x34,0x34,0x43,0x32,0x21,0x22,0x42,0x43,0x33,0x23,0x33,0x47,0x34,0x24,0x12,0x80,
+0x80,0x10,0x22,0x44,0x44,0x34,0x34,0x33,0x22,0x22,0x33,0x34,0x02,0x91,0x18,0x74,
+0x54,0x34,0x33,0x22,0x01,0x21,0x32,0x32,0x80,0xaa,0x30,0x77,0x34,0x24,0x12,0x01,
+0x11,0x12,0x02,0x81,0x08,0x31,0x56,0x53,0x33,0x32,0x01,0x08,0x18,0x31,0x25,0x13,
+0x81,0x00,0x43,0x46,0x43,0x22,0x81,0x98,0x8a,0x28,0x73,0x33,0x12,0x80,0x20,0x45,
+0x43,0x11,0x88,0x30,0x55,0x33,0x81,0xeb,0xbb,0x8b,0x18,0x00,0x90,0x98,0x10,0x11,
+0x98,0xa9,0x18,0x32,0x10,0x9e,0x0a,0x03,0x85,0x8b,0x1e,0x40,0x92,0xfb,0xff,0xab,
+0x9b,0x8a,0x88,0x80,0x00,0x10,0x10,0xaa,0xfc,0xdb,0xbc,0xbb,0x9a,0x18,0x21,0x80,
+0xba,0x0c,0x61,0x33,0xe0,0xde,0xcc,0xaa,0x9a,0x00,0x00,0x88,0x88,0x08,0x10,0x01,
+0xdb,0xcd,0xcb,0x8a,0x18,0x32,0x33,0x12,0x89,0xab,0x09,0x21,0x33,0x91,0xae,0x9c,
+0x21,0x57,0x33,0x23,0x02,0x01,0x44,0x45,0x43,0x24,0x22,0x32,0x22,0x01,0xa8,0xbb,
+0x50,0x67,0x44,0x23,0x12,0x80,0x08,0x31,0x32,0x01,0x09,0x71,0x46,0x34,0x33,0x21,
+0x10,0x31,0x12,0x90,0xca,0x0a,0x74,0x44,0x33,0x22,0x22,0x12,0x22,0x01,0x98,0x99,
+0x00,0x33,0x27,0x34,0x24,0x22,0x00,0x99,0x88,0x10,0x10,0x98,0x89,0x19,0x21,0x91,
+0x0a,0x1c,0x20,0x01,0x09,0x31,0x91,0xff,0xcf,0xcb,0xab,0x89,0x00,0x08,0x98,0x01,
+0x12,0xc0,0xec,0xbc,0xac,0xbb,0xdb,0xbb,0xaa,0x08,0x11,0x00,0x89,0xdb,0xdf,0xbd,
+0xae,0x9b,0x89,0x88,0xa9,0xbb,0x0b,0x52,0x14,0xd8,0xde,0xbc,0xab,0x9a,0x88,0x80,
+0x00,0x80,0x88,0x89,0x30,0x67,0x35,0x34,0x13,0x11,0x00,0x11,0x11,0x80,0xba,0x1a,
+0x74,0x45,0x33,0x33,0x11,0x01,0x80,0x08,0x08,0x00,0x98,0xed,0xcd,0xcb,0xab,0x99,
+0x88,0x98,0xa8,0x88,0x31,0x33,0xb0,0xdf,0xbc,0xaa,0x88,0x01,0x00,0x98,0x80,0x10,
+0x98,0xcc,0xbd,0xab,0x89,0x80,0x98,0x89,0x30,0x36,0x25,0x12,0x80,0x80,0x80,0xba,
+0xbf,0xbd,0x9a,0x20,0x35,0x25,0x12,0x98,0xcb,0xac,0x9a,0x89,0x10,0x18,0x10,0x19,
+0xaa,0xac,0x40,0x77,0x35,0x24,0x13,0x80,0x89,0x10,0x53,0x23,0x82,0xa8,0x9a,0x28,
+0x45,0x34,0x12,0x00,0x98,0x98,0x00,0x08,0x20,0x74,0x45,0x34,0x23,0x01,0x98,0x88,
+0x01,0x80,0x89,0x3a,0x75,0x35,0x34,0x21,0x01,0x08,0x88,0x80,0x98,0x88,0x41,0x46,
+0x35,0x34,0x22,0x11,0x89,0x99,0x00,0x22,0x08,0xbb,0x8d,0x62,0x36,0x24,0x02,0x88,
+0x99,0x08,0x11,0x91,0xa0,0x98,0x11,0x11,0xa1,0x99,0x2b,0x5b,0x00,0x90,0x9a,0x99,
+0x12,0x22,0x1b,0x1d,0x3a,0x59,0x01,0xa9,0xbc,0x11,0x47,0x92,0xfd,0xcc,0xab,0x0a,
+0x21,0x02,0xb8,0xaa,0x28,0x35,0xa2,0xfd,0xbc,0xaa,0x08,0x11,0x81,0x99,0x89,0x20,
+0x23,0xa8,0xef,0xbc,0xae,0x9c,0x8a,0x08,0x00,0x80,0x88,0x00,0x00,0xea,0xce,0xac,
+0x9b,0x89,0x80,0x88,0x08,0x10,0x21,0xb9,0xdf,0xcb,0xbb,0xcb,0xbc,0xbb,0xaa,0x80,
+0x00,0x00,0x29,0x20,0xb0,0xff,0xbb,0x9c,0x18,0x11,0x81,0x99,0x0a,0x21,0x12,0xa9,
+0x9c,0x38,0x24,0xc2,0xda,0x19,0x53,0x82,0xeb,0x9b,0x72,0x35,0x14,0x81,0x88,0x31,
+0x37,0x22,0x91,0xaa,0x0a,0x42,0x54,0x33,0x34,0x43,0x11,0x89,0x99,0x18,0x11,0x80,
+0x89,0x73,0x77,0x33,0x23,0x01,0x88,0x09,0x08,0x08,0x08,0x38,0x55,0x35,0x23,0x13,
+0x00,0x88,0x09,0x39,0x28,0x09,0x9c,0x1b,0x73,0x47,0x22,0x01,0x99,0x99,0x10,0x11,
+0x91,0x8b,0x3b,0x68,0x28,0x9b,0x0b,0x30,0x43,0xb9,0xbd,0x38,0x46,0x91,0xee,0xac,
+0x9b,0x19,0x11,0x80,0x89,0x19,0x20,0xbe,0xef,0xba,0xaa,0x98,0x91,0x91,0x08,0x10,
+0x02,0xc8,0xce,0xbc,0xcb,0xca,0xca,0xaa,0x9a,0x88,0x01,0x01,0x98,0xcc,0xcf,0xdc,
+0xdb,0xba,0xa9,0x89,0x00,0x00,0x80,0x98,0x09,0x30,0x46,0x45,0x33,0x23,0x23,0x22,
+0x11,0x81,0xa9,0x8a,0x60,0x55,0x34,0x34,0x22,0x01,0x80,0x99,0x80,0x11,0x12,0xdb,
+0xcf,0xcb,0xbb,0xbb,0xab,0xaa,0x8a,0x18,0x12,0x91,0xda,0xcc,0xdb,0xba,0xab,0x0a,
+0x10,0x12,0x88,0x9c,0x09,0x34,0x12,0xdd,0xcd,0xaa,0x08,0x11,0x08,0xa8,0x80,0x11,
+0x10,0x9b,0x0a,0x31,0x24,0x9a,0x9f,0x29,0x43,0x82,0xdc,0x9a,0x51,0x24,0xb1,0xee,
+0xab,0x0a,0x42,0x43,0x12,0x80,0xa9,0x99,0x88,0x32,0x46,0x34,0x32,0x22,0x00,0xaa,
+0x9c,0x0a,0x54,0x35,0x24,0x11,0x10,0x43,0x63,0x12,0x11,0x20,0x53,0x43,0x12,0x01,
+0x22,0x36,0x25,0x01,0x99,0x9a,0x08,0x21,0x32,0x73,0x35,0x36,0x33,0x02,0xa8,0xca,
+0xbb,0xcc,0xbc,0xcb,0xab,0xaa,0x9a,0x80,0x11,0x01,0x90,0x9a,0x19,0x31,0x30,0x9b,
+0xcb,0x01,0x73,0x18,0x9a,0x1b,0x39,0x05,0xb1,0xc9,0x80,0x53,0x28,0x8b,0x0d,0x39,
+0x50,0x09,0x9b,0x1a,0x22,0x23,0x9a,0x0d,0x19,0x93,0xb4,0xb0,0x1b,0x6a,0x28,0x99,
+0x0b,0x3b,0x51,0x39,0x1e,0x1b,0x18,0x83,0xb1,0xbb,0x2b,0x13,0xa6,0xb1,0x0a,0x59,
+0x31,0x09,0xad,0x3b,0x70,0x11,0x8a,0x8f,0x3a,0x53,0x92,0xfc,0xcc,0xab,0x89,0x10,
+0x11,0x88,0x8a,0x19,0x10,0x01,0x89,0x0b,0x19,0x04,0xa1,0xaa,0x1b,0x31,0x12,0xa0,
+0xb9,0x91,0x94,0x12,0x2d,0x1c,0x10,0x00,0xc1,0xe3,0xa3,0x11,0x28,0x1b,0x1a,0x19,
+0x93,0xd3,0xd3,0xb3,0xa3,0xa3,0xd2,0x91,0x10,0x29,0x19,0x1b,0x1b,0x31,0x5a,0x3b,
+0x2e,0x1a,0x20,0x3a,0x2d,0x3c,0x3a,0x39,0x3b,0x9b,0x19,0x31,0x10,0x1b,0x1b,0x19,
+0x03,0xd3,0xc2,0x01,0x20,0x18,0x0a,0x1c,0x18,0x84,0xa1,0x9b,0x3c,0x38,0xb5,0xe3,
+0x90,0x81,0x03,0xa2,0xcb,0x09,0x53,0x12,0xab,0x8f,0x39,0x43,0xb2,0xfb,0x9b,0x73,
+0x37,0x24,0x01,0x98,0x89,0x08,0x11,0x80,0x89,0x1a,0x38,0x39,0x1b,0x9b,0xb3,0x85,
+0x10,0x2d,0x2b,0x00,0x10,0x1b,0x2b,0x20,0xa2,0xb0,0x3b,0x5a,0x10,0xa9,0xba,0x11,
+0x35,0x18,0x9f,0x1a,0x62,0x13,0xf9,0xdd,0xbb,0x9a,0x00,0x12,0x91,0x99,0x09,0x38,
+0x20,0x8a,0x9b,0x29,0x51,0x18,0x0b,0x0c,0x91,0xa6,0xa2,0xa8,0xa1,0x94,0xc3,0xe3,
+0xa2,0x92,0x01,0xb1,0x99,0x19,0x20,0x19,0x1a,0x3b,0x3a,0x09,0x91,0x09,0x01,0xb2,
+0x91,0x19,0x49,0x2a,0xab,0xa9,0x13,0x85,0xb0,0xbb,0x39,0x47,0x91,0xee,0xbd,0xbb,
+0x88,0x22,0x02,0xb9,0x9b,0x40,0x34,0xb0,0xdf,0xbc,0x9a,0x18,0x01,0x91,0xa0,0x90,
+0x01,0x82,0x90,0x9a,0x10,0x93,0x93,0xab,0x99,0x13,0x13,0x9a,0x9b,0x01,0x13,0xa2,
+0xb9,0x90,0x12,0x93,0xf3,0xb1,0x02,0x30,0x1b,0xab,0x09,0x31,0x31,0x9b,0xd9,0x93,
+0x12,0x19,0xab,0x3b,0x6b,0x18,0x99,0xa9,0x11,0x33,0xa3,0xb0,0x2f,0x4b,0x10,0xb1,
+0xb9,0x2a,0x73,0x12,0xba,0xaf,0x28,0x57,0x34,0x23,0x82,0xa9,0x98,0x00,0x12,0x91,
+0xa8,0x9a,0x82,0x86,0x92,0x9b,0x1b,0x50,0x13,0xc0,0xba,0x39,0x73,0x82,0xc9,0xaa,
+0x30,0x36,0xa1,0xfc,0x99,0x53,0x46,0x22,0x81,0x80,0x31,0x37,0x23,0x81,0xab,0x8a,
+0x32,0x15,0xb9,0xcf,0xbb,0x89,0x00,0x82,0x90,0x88,0x18,0x10,0x90,0xa0,0x18,0x39,
+0xa1,0xd3,0xb1,0xa3,0x04,0x90,0x9a,0x19,0x10,0x11,0x19,0x2b,0x2b,0x01,0x00,0x3a,
+0x3b,0x3b,0x3b,0x1a,0x90,0xa2,0xb2,0xb3,0xa3,0x21,0x1b,0xa0,0xb3,0x93,0xb3,0xa1,
+0xa1,0x93,0x93,0x91,0xaa,0x10,0x31,0x93,0xf1,0x90,0x10,0x12,0xc3,0xca,0x99,0x64,
+0x32,0xea,0xcf,0xbb,0xab,0x00,0x21,0x81,0xa8,0x8a,0x28,0x12,0xb2,0xb9,0x2b,0x50,
+0x12,0xb0,0xdb,0xa1,0x97,0x93,0xb1,0xb9,0x21,0x52,0x00,0x8d,0x1c,0x21,0x23,0xd0,
+0xda,0x88,0x26,0x13,0xfb,0xce,0xab,0x9a,0x00,0x12,0x80,0x99,0x09,0x10,0x81,0xb1,
+0xc1,0xa2,0x95,0xb2,0xd3,0x81,0x01,0x91,0xb1,0x09,0x3a,0x01,0xb2,0x99,0x39,0x10,
+0xa1,0xb0,0x91,0x33,0x39,0x8d,0x99,0x23,0x23,0xda,0xaa,0x22,0x17,0xd3,0xea,0x19,
+0x55,0x35,0x12,0xda,0xbc,0x8b,0x41,0x34,0x03,0xb8,0xad,0xaa,0x00,0x11,0x91,0x98,
+0x88,0x00,0x02,0x90,0x99,0x09,0x02,0x12,0xb9,0xe0,0xa2,0x94,0xa3,0xa1,0x9a,0x09,
+0x15,0x11,0x0d,0x0c,0x38,0x43,0xb1,0xfc,0x99,0x73,0x36,0x24,0x02,0x98,0x89,0x08,
+0x11,0x00,0x99,0x0a,0x28,0x21,0x90,0xab,0x3b,0x31,0x13,0x9a,0xbb,0xa3,0x05,0x80,
+0x1b,0x3b,0x20,0x92,0xa0,0x0a,0x39,0x49,0x0a,0xb9,0x91,0x93,0x12,0x1b,0x1b,0x39,
+0x10,0xb1,0xf3,0xa2,0x93,0x81,0x98,0x19,0x39,0x20,0xa9,0xa9,0x01,0x03,0xa3,0x99,
+0x1b,0x49,0x28,0xab,0xb9,0xa2,0x96,0xa2,0x89,0x2a,0x69,0x18,0x8a,0x9b,0x12,0x15,
+0x91,0xbb,0x9b,0x15,0x96,0xc0,0xaa,0x21,0x27,0xb2,0xfe,0xcb,0xa9,0x08,0x11,0x00,
+0x89,0x0a,0x20,0x10,0x98,0x9a,0x20,0x31,0xb1,0xbd,0x19,0x05,0xa5,0xe1,0xa8,0x22,
+0x15,0xd2,0xfc,0xbb,0x9b,0x09,0x11,0x01,0x98,0x99,0x00,0x11,0x01,0x0a,0x9b,0x30,
+0x61,0x2a,0x9a,0x99,0x31,0x22,0x11,0xbb,0xaa,0x13,0x05,0xb1,0xa9,0x2b,0x31,0x05,
+0xa9,0x0c,0x29,0x63,0x00,0xab,0x1c,0x40,0x13,0xc0,0xbb,0x39,0x35,0x94,0xd9,0x8b,
+0x40,0x33,0xb0,0xfc,0x90,0x14,0x13,0xbb,0x9d,0x48,0x52,0x90,0xdb,0x99,0x53,0x13,
+0xc8,0x9e,0x2a,0x55,0x33,0x90,0xda,0x9a,0x30,0x44,0x12,0x90,0x99,0x09,0x10,0x01,
+0x80,0x0a,0x09,0x19,0x48,0x29,0x99,0xab,0x1b,0x34,0x05,0xc9,0x9c,0x49,0x52,0x91,
+0xdb,0x0a,0x52,0x13,0xea,0xab,0x72,0x37,0x23,0x98,0xab,0x29,0x43,0x92,0xea,0x9a,
+0x42,0x14,0xc0,0xac,0x28,0x44,0xb0,0xdf,0x19,0x77,0x35,0x25,0x02,0x90,0xaa,0x89,
+0x10,0x32,0x33,0x44,0x54,0x43,0x34,0x43,0x33,0x33,0x42,0x22,0x21,0x12,0x80,0xa9,
+0xbc,0xbd,0xbc,0xcd,0xdb,0xbb,0xbc,0xcb,0xba,0xbb,0xba,0xab,0x9a,0x89,0x08,0x32,
+0x45,0x44,0x43,0x43,0x43,0x34,0x33,0x33,0x33,0x23,0x23,0x12,0x81,0xba,0xdd,0xcb,
+0xbc,0xbd,0xdb,0xcb,0xcb,0xba,0xbb,0xbb,0xab,0xbb,0x9a,0x89,0x21,0x44,0x53,0x34,
+0x35,0x44,0x43,0x33,0x24,0x23,0x32,0x22,0x22,0x11,0x90,0xba,0xcd,0xdb,0xcb,0xbc,
+0xbd,0xdb,0xba,0xbb,0xbb,0xbb,0xbb,0xba,0x9b,0x09,0x42,0x44,0x53,0x33,0x45,0x34,
+0x34,0x34,0x32,0x32,0x22,0x23,0x21,0x01,0x99,0xca,0xcc,0xdb,0xdb,0xcb,0xbc,0xdb,
+0xba,0xbb,0xab,0xbb,0xba,0xaa,0x8a,0x28,0x42,0x44,0x53,0x43,0x44,0x34,0x43,0x33,
+0x32,0x33,0x33,0x32,0x11,0x81,0xa9,0xbc,0xcd,0xdb,0xbc,0xcc,0xcb,0xbb,0xbc,0xab,
+0xbb,0xbb,0xba,0xaa,0x09,0x20,0x34,0x54,0x43,0x44,0x53,0x33,0x34,0x33,0x24,0x22,
+0x22,0x12,0x02,0x00,0xa9,0xdb,0xcc,0xcb,0xbc,0xbd,0xbc,0xcb,0xbb,0xab,0xcb,0xaa,
+0xaa,0x9a,0x00,0x31,0x53,0x34,0x35,0x44,0x43,0x43,0x33,0x33,0x24,0x32,0x22,0x22,
+0x11,0x88,0xba,0xbd,0xcd,0xcb,0xdb,0xcb,0xac,0xac,0xab,0xab,0xab,0xab,0xaa,0x8a,
+0x18,0x33,0x45,0x34,0x44,0x53,0x43,0x33,0x24,0x33,0x23,0x33,0x32,0x12,0x01,0xa0,
+0xda,0xbc,0xbd,0xcc,0xdb,0xcb,0xbb,0xbc,0xbb,0xba,0xbb,0xbb,0xaa,0x8a,0x20,0x53,
+0x44,0x44,0x33,0x35,0x34,0x34,0x33,0x34,0x22,0x22,0x22,0x21,0x00,0xa9,0xdb,0xcc,
+0xbb,0xbd,0xbd,0xbd,0xbb,0xac,0xbb,0xba,0xbb,0xba,0x9a,0x08,0x31,0x44,0x53,0x53,
+0x53,0x43,0x43,0x43,0x32,0x22,0x23,0x22,0x22,0x02,0x80,0xb9,0xeb,0xdb,0xcb,0xcc,
+0xcb,0xcb,0xcb,0xba,0xba,0xba,0xba,0xaa,0x9a,0x18,0x31,0x45,0x34,0x44,0x43,0x34,
+0x34,0x24,0x33,0x32,0x32,0x22,0x12,0x11,0x88,0xbb,0xdc,0xcb,0xbd,0xcc,0xbc,0xcb,
+0xcb,0xaa,0xaa,0xab,0xab,0xaa,0x89,0x28,0x42,0x44,0x53,0x43,0x53,0x33,0x25,0x24,
+0x22,0x23,0x12,0x22,0x21,0x00,0x98,0xca,0xdb,0xcb,0xcc,0xbc,0xcc,0xbb,0xbb,0xac,
+0xab,0xab,0xab,0x9a,0x09,0x20,0x53,0x44,0x53,0x43,0x43,0x34,0x43,0x33,0x33,0x33,
+0x32,0x32,0x11,0x80,0xb9,0xcb,0xcd,0xdb,0xbc,0xbd,0xcb,0xac,0xbb,0xbb,0xbb,0xab,
+0xbb,0x9a,0x08,0x32,0x45,0x34,0x44,0x43,0x34,0x44,0x32,0x24,0x32,0x22,0x12,0x12,
+0x11,0x80,0xa9,0xcc,0xbc,0xbd,0xbc,0xcc,0xcb,0xcb,0xba,0xab,0xab,0xab,0x9b,0x8a,
+0x10,0x32,0x36,0x44,0x53,0x43,0x43,0x34,0x33,0x43,0x22,0x32,0x12,0x12,0x01,0x98,
+0xca,0xdb,0xcb,0xbc,0xbd,0xbd,0xbc,0xbb,0xbb,0xac,0xba,0xaa,0x9a,0x89,0x10,0x43,
+0x44,0x34,0x44,0x43,0x34,0x34,0x42,0x22,0x22,0x22,0x12,0x12,0x00,0x99,0xbb,0xcd,
+0xdb,0xdb,0xcb,0xbc,0xac,0xac,0xaa,0xaa,0xab,0xaa,0x99,0x09,0x21,0x34,0x44,0x34,
+0x44,0x34,0x34,0x43,0x33,0x33,0x23,0x32,0x22,0x12,0x00,0xaa,0xbd,0xbd,0xcc,0xbc,
+0xbd,0xbc,0xac,0xbb,0xbb,0xba,0xbb,0xbb,0x99,0x18,0x42,0x53,0x34,0x35,0x44,0x34,
+0x43,0x43,0x32,0x22,0x32,0x22,0x12,0x01,0x90,0xaa,0xcc,0xbc,0xbd,0xbd,0xbd,0xcb,
+0xbb,0xac,0xab,0xba,0xab,0xaa,0x89,0x10,0x43,0x34,0x35,0x44,0x34,0x34,0x34,0x24,
+0x33,0x32,0x22,0x22,0x12,0x00,0x90,0xba,0xcd,0xbc,0xcd,0xcb,0xcb,0xbc,0xca,0xaa,
+0xab,0xba,0xaa,0x9a,0x89,0x20,0x53,0x53,0x34,0x34,0x44,0x43,0x43,0x32,0x33,0x32,
+0x32,0x22,0x12,0x00,0xa9,0xdb,0xdb,0xdb,0xbc,0xcc,0xbc,0xbb,0xac,0xbb,0xba,0xab,
+0xab,0x9a,0x19,0x31,0x35,0x45,0x43,0x53,0x43,0x43,0x43,0x32,0x23,0x32,0x22,0x12,
+0x02,0x81,0xa9,0xcc,0xcc,0xdb,0xcb,0xdb,0xbb,0xcc,0xaa,0xaa,0xaa,0xab,0xba,0x99,
+0x00,0x43,0x53,0x43,0x53,0x53,0x43,0x43,0x23,0x24,0x22,0x12,0x22,0x11,0x01,0x90,
+0xba,0xcc,0xdb,0xcb,0xbd,0xbc,0xad,0xbb,0xba,0xbb,0xbb,0xcb,0xa9,0x88,0x10,0x33,
+0x35,0x45,0x43,0x34,0x25,0x24,0x23,0x33,0x23,0x23,0x23,0x12,0x01,0xa9,0xda,0xbc,
+0xdc,0xcb,0xbc,0xcc,0xca,0xba,0xba,0xba,0xba,0xba,0x9a,0x09,0x30,0x44,0x34,0x44,
+0x53,0x43,0x34,0x33,0x24,0x23,0x32,0x23,0x13,0x12,0x88,0xa9,0xdb,0xbc,0xcd,0xcb,
+0xcc,0xbb,0xbc,0xac,0xaa,0xab,0xaa,0xab,0x8a,0x08,0x42,0x43,0x34,0x44,0x53,0x53,
+0x33,0x43,0x23,0x33,0x23,0x23,0x13,0x02,0x80,0xba,0xcd,0xdb,0xbc,0xcc,0xcb,0xcb,
+0xac,0xba,0xba,0xba,0xaa,0xab,0x89,0x28,0x42,0x35,0x34,0x44,0x53,0x43,0x33,0x34,
+0x33,0x33,0x23,0x23,0x12,0x11,0x99,0xca,0xcc,0xbc,0xbd,0xcc,0xbc,0xbc,0xbb,0xbb,
+0xbb,0xcb,0xaa,0x9a,0x89,0x20,0x53,0x34,0x44,0x43,0x44,0x33,0x25,0x33,0x32,0x32,
+0x32,0x32,0x21,0x80,0xaa,0xbc,0xbd,0xbd,0xbd,0xbd,0xbc,0xbc,0xca,0xaa,0xba,0xaa,
+0xaa,0x99,0x08,0x22,0x53,0x43,0x44,0x34,0x44,0x43,0x33,0x33,0x24,0x22,0x22,0x22,
+0x11,0x80,0xa9,0xcc,0xcb,0xcc,0xdb,0xcb,0xdb,0xba,0xbb,0xbb,0xba,0xbb,0xab,0x9a,
+0x10,0x42,0x34,0x45,0x53,0x43,0x34,0x43,0x33,0x43,0x23,0x32,0x22,0x21,0x01,0x90,
+0xba,0xbd,0xbd,0xbd,0xcc,0xbc,0xcb,0xcb,0xaa,0xab,0xba,0xab,0xaa,0x89,0x20,0x42,
+0x44,0x53,0x43,0x34,0x44,0x33,0x43,0x32,0x32,0x22,0x22,0x22,0x81,0x98,0xca,0xcc,
+0xbc,0xbd,0xcc,0xcb,0xcb,0xba,0xbb,0xbb,0xbb,0xab,0xaa,0x88,0x21,0x44,0x34,0x35,
+0x35,0x44,0x33,0x34,0x24,0x23,0x32,0x22,0x22,0x11,0x80,0xa9,0xdb,0xbc,0xcc,0xbc,
+0xbd,0xdb,0xbb,0xbb,0xac,0xab,0xab,0xba,0x99,0x08,0x32,0x45,0x43,0x43,0x44,0x43,
+0x34,0x43,0x32,0x32,0x22,0x22,0x22,0x02,0x80,0xb9,0xcc,0xbc,0xbd,0xbd,0xbd,0xcb,
+0xcb,0xba,0xab,0xab,0xab,0xaa,0x99,0x10,0x42,0x34,0x35,0x35,0x34,0x35,0x34,0x33,
+0x43,0x22,0x23,0x22,0x21,0x00,0x98,0xaa,0xbd,0xbd,0xcd,0xcb,0xbc,0xac,0xcb,0xaa,
+0xaa,0xab,0xab,0x9b,0x09,0x20,0x43,0x44,0x34,0x44,0x34,0x53,0x42,0x32,0x32,0x32,
+0x22,0x22,0x12,0x00,0xa8,0xdb,0xdb,0xcb,0xcc,0xbc,0xbc,0xcb,0xbb,0xbb,0xbb,0xcb,
+0xaa,0x9a,0x08,0x21,0x53,0x34,0x54,0x33,0x35,0x34,0x24,0x33,0x33,0x33,0x32,0x22,
+0x12,0x80,0xb9,0xdc,0xdb,0xcb,0xcc,0xcb,0xcb,0xcb,0xba,0xab,0xab,0xbb,0xba,0x99,
+0x18,0x32,0x45,0x53,0x43,0x44,0x43,0x24,0x33,0x23,0x33,0x33,0x24,0x12,0x01,0x98,
+0xb9,0xcc,0xdb,0xbc,0xbd,0xbc,0xbc,0xcb,0xbb,0xba,0xbb,0xab,0xab,0x89,0x10,0x43,
+0x35,0x44,0x34,0x34,0x35,0x24,0x43,0x22,0x23,0x22,0x22,0x02,0x01,0x99,0xca,0xbc,
+0xbd,0xcc,0xbc,0xbc,0xcc,0xba,0xba,0xab,0xba,0xaa,0xaa,0x89,0x11,0x53,0x44,0x43,
+0x34,0x35,0x34,0x34,0x33,0x33,0x33,0x23,0x23,0x22,0x80,0xba,0xcc,0xbc,0xbd,0xbd,
+0xbd,0xbc,0xbc,0xbb,0xba,0xbb,0xac,0xaa,0x89,0x08,0x21,0x34,0x35,0x44,0x34,0x35,
+0x53,0x32,0x33,0x23,0x23,0x23,0x23,0x02,0x80,0xba,0xbd,0xbd,0xbd,0xcd,0xbb,0xbd,
+0xbb,0xcb,0xba,0xab,0xab,0x9b,0x8a,0x18,0x41,0x34,0x45,0x43,0x53,0x43,0x43,0x23,
+0x33,0x33,0x33,0x33,0x22,0x01,0x98,0xcb,0xcc,0xdb,0xbc,0xcc,0xdb,0xbb,0xcb,0xab,
+0xbb,0xbb,0xcb,0x9a,0x89,0x10,0x42,0x53,0x43,0x34,0x35,0x34,0x34,0x33,0x33,0x33,
+0x33,0x33,0x22,0x00,0xa8,0xdb,0xcc,0xbc,0xbd,0xbd,0xbc,0xcb,0xcb,0xaa,0xab,0xba,
+0xaa,0x9a,0x08,0x20,0x34,0x35,0x35,0x44,0x43,0x34,0x33,0x34,0x23,0x33,0x22,0x22,
+0x12,0x80,0xa9,0xcc,0xbc,0xcc,0xcc,0xcb,0xbc,0xbb,0xbc,0xba,0xab,0xbb,0xab,0x99,
+0x08,0x32,0x45,0x53,0x43,0x34,0x35,0x34,0x33,0x34,0x32,0x22,0x22,0x22,0x01,0x90,
+0xb9,0xcc,0xcc,0xbc,0xcc,0xcb,0xbc,0xbb,0xbc,0xba,0xba,0xab,0xaa,0x89,0x10,0x43,
+0x34,0x35,0x44,0x34,0x35,0x43,0x23,0x33,0x33,0x32,0x23,0x22,0x00,0x98,0xbb,0xcd,
+0xcc,0xcc,0xdb,0xbb,0xcc,0xba,0xba,0xab,0xab,0xab,0xaa,0x89,0x20,0x63,0x43,0x44,
+0x33,0x45,0x33,0x44,0x32,0x32,0x22,0x23,0x22,0x21,0x80,0x99,0xdb,0xdb,0xdb,0xcb,
+0xcc,0xcb,0xbb,0xcb,0xaa,0xab,0xab,0xab,0x9a,0x09,0x32,0x44,0x34,0x44,0x34,0x44,
+0x43,0x33,0x24,0x32,0x22,0x22,0x12,0x02,0x80,0xaa,0xdb,0xbc,0xcd,0xcb,0xbc,0xbc,
+0xbc,0xab,0xbb,0xbb,0xbb,0xba,0x8a,0x18,0x42,0x44,0x53,0x53,0x43,0x34,0x34,0x33,
+0x24,0x23,0x23,0x22,0x22,0x10,0x98,0xb9,0xdc,0xdb,0xdb,0xcb,0xcb,0xbc,0xbb,0xac,
+0xab,0xab,0xab,0xaa,0x89,0x10,0x33,0x36,0x44,0x34,0x35,0x34,0x34,0x33,0x33,0x24,
+0x22,0x12,0x12,0x01,0x98,0xca,0xcc,0xdb,0xcb,0xdb,0xcb,0xac,0xbb,0xbb,0xbb,0xbb,
+0xba,0x9a,0x89,0x21,0x44,0x44,0x34,0x44,0x33,0x35,0x34,0x33,0x43,0x22,0x12,0x22,
+0x11,0x80,0xa9,0xcb,0xcc,0xdb,0xdb,0xcb,0xbc,0xbb,0xbc,0xab,0xbb,0xab,0xab,0x9a,
+0x18,0x32,0x45,0x53,0x43,0x34,0x44,0x43,0x33,0x43,0x22,0x22,0x13,0x12,0x11,0x88,
+0xaa,0xcc,0xbc,0xcc,0xbc,0xbd,0xdb,0xba,0xbb,0xab,0xbb,0xbb,0xab,0x99,0x10,0x43,
+0x34,0x45,0x53,0x34,0x34,0x24,0x24,0x32,0x22,0x23,0x22,0x11,0x81,0x90,0xca,0xcb,
+0xcc,0xbc,0xbd,0xcc,0xbb,0xbc,0xba,0xba,0xba,0xab,0xaa,0x89,0x20,0x53,0x44,0x43,
+0x34,0x35,0x34,0x34,0x33,0x33,0x33,0x33,0x23,0x12,0x01,0xa9,0xdb,0xcc,0xeb,0xcb,
+0xbc,0xbc,0xbc,0xbb,0xbb,0xbb,0xbb,0xac,0x9a,0x08,0x21,0x44,0x34,0x34,0x35,0x44,
+0x43,0x33,0x43,0x32,0x22,0x22,0x22,0x11,0x80,0xa9,0xbc,0xcd,0xdb,0xcb,0xbc,0xbc,
+0xbc,0xba,0xbb,0xbb,0xac,0xaa,0x89,0x18,0x31,0x35,0x45,0x33,0x24,0x22,0x01,0x00,
+0x00,0x01,0x00,0x80,0x80,0x18,0x10,0x11,0x00,0x98,0x09,0x18,0x32,0x34,0x12,0x91,
+0xa9,0x89,0x61,0x73,0x22,0x01,0x98,0x9a,0x29,0x73,0x34,0x21,0x88,0xaa,0x09,0x62,
+0x43,0x23,0x11,0x08,0x88,0xa9,0xa8,0x30,0x47,0x44,0x32,0x10,0x88,0x89,0xa9,0x88,
+0x42,0x56,0x33,0x23,0x01,0x98,0x99,0x8a,0x3a,0x72,0x46,0x32,0x22,0x80,0x99,0x99,
+0x90,0x10,0x73,0x36,0x25,0x01,0x98,0x9a,0x00,0x23,0xa1,0xdb,0x0a,0x55,0x35,0x22,
+0x81,0x99,0x09,0x00,0x01,0x80,0x09,0x1a,0x2a,0x39,0x12,0xc3,0xfb,0x8a,0x72,0x47,
+0x42,0x11,0x88,0x99,0x88,0x01,0x01,0x90,0x99,0x09,0x20,0x12,0x82,0xac,0x9f,0x5a,
+0x74,0x34,0x13,0x81,0x99,0x0a,0x28,0x12,0xa8,0x9b,0x39,0x44,0xb1,0xfb,0x89,0x55,
+0x44,0x23,0x81,0x98,0x99,0x01,0x01,0x91,0x90,0x89,0x09,0x13,0x32,0xb9,0xed,0x0a,
+0x71,0x55,0x33,0x23,0x88,0x9a,0x89,0x20,0x02,0xb2,0xc8,0xa8,0x94,0x05,0x91,0xa9,
+0x9d,0x48,0x46,0x36,0x32,0x00,0x99,0x99,0x10,0x21,0x00,0x8c,0x1b,0x40,0x10,0xb9,
+0x9a,0x79,0x21,0xc8,0xcb,0x40,0x67,0x33,0x03,0xa0,0x9a,0x19,0x33,0xa2,0xf8,0x9a,
+0x42,0x46,0x23,0x01,0x98,0x98,0x00,0x01,0x90,0x98,0x00,0x11,0x80,0x1b,0x2c,0x92,
+0x97,0xb0,0xa0,0x12,0x23,0xc1,0xca,0x29,0x73,0x21,0xac,0x8f,0x38,0x47,0x34,0x22,
+0x88,0x99,0x09,0x10,0x01,0x90,0xa9,0x10,0x30,0x10,0xc9,0xb0,0x13,0x42,0x5b,0x2d,
+0x2b,0x08,0x92,0xa1,0x99,0x19,0x30,0xa1,0xe3,0xc3,0xa3,0x92,0xa2,0xb1,0xb1,0x93,
+0x31,0x2b,0x9b,0xb1,0x94,0x92,0x99,0xb9,0x92,0x31,0x19,0xb9,0xb1,0x93,0xb4,0xb5,
+0xb1,0xb2,0x97,0x02,0x2a,0x0c,0x80,0x13,0x91,0xd9,0x09,0x7a,0x10,0xb0,0xca,0x18,
+0x54,0x22,0xdd,0xce,0xba,0x9a,0x10,0x21,0x90,0xa9,0x08,0x11,0x11,0x09,0x1e,0x2a,
+0x20,0x00,0xb9,0x09,0x50,0x38,0x2b,0x0f,0x19,0x20,0x80,0xb9,0x1a,0x20,0x13,0xa1,
+0xbb,0xb3,0x05,0x10,0xba,0xb9,0x13,0x23,0x90,0x0d,0x19,0x50,0x29,0xab,0x9a,0x40,
+0x22,0x99,0x9f,0x19,0x32,0x85,0xd9,0xac,0x40,0x66,0x43,0x12,0x91,0x98,0x89,0x10,
+0x02,0x90,0x8a,0x09,0x31,0x01,0xe1,0xa0,0x00,0x13,0xb2,0xc9,0x1b,0x39,0x24,0xb0,
+0xdb,0x19,0x31,0x13,0xd9,0xaa,0x11,0x16,0xb2,0xd9,0x8a,0x33,0x17,0xb8,0xcd,0x80,
+0x47,0x25,0x13,0x81,0x89,0x08,0x08,0xfb,0xdc,0xbb,0xab,0x89,0x00,0x80,0x91,0x80,
+0x80,0xa1,0xa2,0x11,0x18,0xb8,0xb1,0x31,0x31,0xa1,0xdb,0x80,0x53,0x11,0xeb,0x9c,
+0x78,0x64,0x33,0x22,0x90,0x9a,0x19,0x20,0x11,0x99,0x0b,0x3a,0x40,0x00,0x9b,0x9b,
+0x13,0x25,0x2b,0xac,0xa2,0x43,0x81,0xf2,0xb1,0x01,0x02,0xb2,0xc1,0x90,0x31,0x13,
+0xb1,0xb9,0x19,0x32,0x21,0x1c,0x0c,0x91,0x85,0xb2,0xb0,0x2b,0x39,0x93,0xe3,0xa1,
+0x10,0x11,0xb3,0xe1,0x90,0x02,0x12,0x99,0xac,0xb1,0x86,0xa3,0xb0,0xb9,0x30,0x53,
+0x90,0xba,0x2b,0x70,0x10,0xb8,0xd8,0x11,0x42,0x90,0xd9,0x0a,0x60,0x21,0x99,0xbd,
+0x18,0x35,0x04,0xfb,0xbe,0xbb,0x99,0x10,0x01,0x80,0x98,0x90,0x92,0x91,0x91,0x11,
+0x08,0xb9,0x1b,0x50,0x11,0x99,0x0e,0x3a,0x23,0xb2,0xfb,0x89,0x31,0x33,0xd9,0xbb,
+0x39,0x74,0x10,0x9c,0x8c,0x31,0x24,0xb0,0xec,0x08,0x24,0x03,0xfa,0xba,0x40,0x46,
+0x22,0xa8,0xac,0x0a,0x43,0x13,0xc8,0xbc,0x08,0x35,0x24,0x91,0xb9,0x0a,0x21,0x13,
+0xa8,0xcb,0x00,0x33,0x12,0xbc,0x9b,0x32,0x34,0xb0,0xdb,0x09,0x33,0x84,0xc9,0xb9,
+0x21,0x05,0xb2,0xaa,0x99,0x23,0x13,0xb9,0xb9,0x93,0x93,0xb9,0x11,0x05,0xc1,0xf9,
+0x18,0x74,0x36,0x32,0x00,0xa9,0x99,0x11,0x03,0xa1,0xaa,0x3b,0x41,0x02,0xb9,0x9c,
+0x30,0x61,0x08,0xab,0x2b,0x79,0x11,0xb0,0xc9,0x81,0x43,0x39,0x8d,0x9b,0x21,0x05,
+0xb2,0xe9,0x88,0x32,0x13,0xf0,0xca,0x00,0x07,0x94,0xd9,0xae,0xac,0x89,0x00,0x11,
+0x80,0x99,0x88,0x11,0x10,0x98,0x9a,0x28,0x40,0x09,0xd9,0x90,0x21,0x31,0xb9,0xd9,
+0xa2,0x85,0x81,0x1b,0x1c,0x20,0x31,0x99,0x0d,0x2a,0x22,0xa3,0xc9,0x0a,0x31,0x05,
+0xa0,0xbb,0x29,0x73,0x00,0xaa,0x9b,0x41,0x14,0xb1,0xae,0x3b,0x73,0x13,0xfa,0xcd,
+0xbb,0x9a,0x08,0x01,0x01,0x90,0x89,0x89,0x29,0x70,0x21,0xca,0xdf,0xbb,0x9c,0x18,
+0x11,0x00,0x99,0x98,0x00,0x03,0x91,0x8b,0x1b,0x21,0x93,0xc2,0x89,0x4a,0x59,0x1a,
+0x1a,0x4b,0x4b,0x98,0xb2,0x19,0x3a,0x90,0x91,0x19,0x29,0x90,0xb0,0x39,0x5b,0x00,
+0xb9,0xd1,0x03,0x53,0x89,0xaf,0x0a,0x74,0x36,0x33,0x11,0x99,0x9a,0x00,0x13,0x00,
+0xab,0xa8,0x23,0x23,0xd9,0xc9,0x81,0x04,0x93,0x8b,0x0d,0x01,0x85,0xb1,0xa9,0x3a,
+0x51,0x01,0xb9,0xd9,0x12,0x13,0xb1,0xda,0x09,0x32,0x32,0xbb,0x8f,0x28,0x41,0x80,
+0xcb,0x0b,0x78,0x43,0xb0,0xef,0xcb,0xaa,0x08,0x10,0x01,0x90,0xa9,0x00,0x12,0x10,
+0x8a,0x0c,0x39,0x12,0xc2,0xc0,0x2a,0x59,0x21,0x98,0xbc,0x00,0x53,0x12,0x9b,0x8f,
+0x29,0x53,0x80,0xcc,0x9b,0x72,0x46,0x33,0x13,0x90,0x99,0x09,0x01,0x93,0xa1,0x0a,
+0x3a,0x30,0x91,0xbb,0x0b,0x11,0x23,0x00,0xca,0xd3,0x94,0x92,0x91,0x0a,0x3a,0x11,
+0x92,0x99,0x0b,0x01,0xa3,0xb4,0xb1,0x19,0x10,0x93,0xd3,0x91,0x18,0x4a,0x3a,0x1c,
+0x2b,0x29,0x21,0x3a,0x1d,0x2a,0x59,0x4a,0x1b,0x99,0x90,0x13,0xb4,0xc1,0xa0,0x93,
+0x15,0x19,0x0d,0x0a,0x22,0x96,0xd1,0xb9,0x30,0x54,0xa3,0xfc,0xbe,0xbb,0x89,0x20,
+0x11,0x98,0x99,0x09,0x21,0x11,0xb9,0xb9,0x92,0x34,0x19,0xbb,0x9a,0x41,0x20,0xba,
+0xc9,0x01,0x32,0x91,0xb9,0xa9,0x21,0x13,0xa1,0x9b,0x19,0x31,0x30,0x1c,0x0b,0x31,
+0x59,0x1a,0x9a,0x39,0x6b,0x08,0xa8,0x19,0x3b,0x03,0xb3,0xd1,0x91,0x21,0x39,0x1b,
+0xbb,0x01,0x33,0x39,0x1e,0x0a,0x01,0x93,0xb1,0x9b,0x0a,0x95,0xa4,0xa0,0x8a,0x13,
+0x05,0xb1,0xd9,0x91,0x04,0x93,0xd0,0x9b,0x30,0x15,0xb3,0xbc,0x0b,0x73,0x23,0xc9,
+0xfb,0x88,0x45,0x35,0x24,0x11,0x88,0x99,0x88,0x10,0x11,0x81,0xa9,0x8c,0x38,0x44,
+0x92,0xdc,0x8c,0x60,0x35,0x24,0x90,0xeb,0xba,0x08,0x20,0x11,0xa8,0x99,0x19,0x22,
+0x92,0xb9,0x9b,0x32,0x33,0xd1,0xb9,0x3b,0x79,0x10,0xa9,0xa9,0x21,0x61,0x19,0x1c,
+0x2b,0x39,0x11,0xb1,0xbb,0x01,0x33,0x21,0x0c,0x9a,0x02,0x33,0x1b,0x0b,0x1b,0x93,
+0xb5,0xc3,0xa1,0x11,0x30,0x4b,0x3d,0x2c,0x19,0x81,0x90,0xa0,0x10,0x30,0x29,0x9b,
+0xb1,0x93,0x02,0x10,0x3d,0x3d,0x3a,0x19,0x09,0x0b,0x19,0x21,0x91,0xb0,0x90,0x11,
+0x93,0x91,0x0b,0x3b,0x30,0x11,0xb9,0x0b,0x39,0x14,0xe1,0xd8,0x81,0x34,0x93,0xfd,
+0xbe,0xac,0x09,0x20,0x11,0xa8,0x9a,0x39,0x43,0xb3,0xfd,0xbc,0xaa,0x08,0x11,0x00,
+0x89,0x09,0x10,0x00,0xb0,0xa0,0x93,0x94,0x18,0x1d,0x19,0x02,0x01,0x0c,0x3b,0x12,
+0x85,0x0a,0x0d,0x11,0x23,0xb9,0x9d,0x5b,0x59,0x00,0x8b,0x0e,0x20,0x23,0xb1,0xde,
+0x09,0x64,0x44,0x23,0x01,0x89,0x89,0x18,0x00,0x91,0x90,0x90,0x91,0x92,0x28,0x2b,
+0x99,0xb0,0x91,0x12,0x11,0xb1,0xd0,0xa2,0x86,0x91,0x99,0x0a,0x41,0x03,0xf1,0xd0,
+0x81,0x13,0x01,0xbb,0x1e,0x79,0x20,0x89,0x9c,0x2a,0x53,0x93,0xf9,0xaa,0x40,0x35,
+0xa2,0xff,0xcc,0xbb,0xab,0x8a,0x88,0x01,0x12,0x22,0x11,0x00,0x20,0x44,0x24,0x02,
+0x99,0xaa,0x18,0x32,0x01,0xba,0x8c,0x38,0x42,0x91,0xcb,0x9a,0x51,0x32,0x90,0xae,
+0x8c,0x51,0x36,0x26,0x12,0x00,0x99,0x09,0x18,0x01,0x91,0x99,0x88,0x82,0x03,0x8a,
+0x9b,0x30,0x21,0xb9,0x1b,0x7b,0x48,0x9a,0xac,0x58,0x47,0x35,0x12,0x90,0x99,0x09,
+0x30,0x10,0x99,0xaa,0x28,0x23,0xb4,0xf0,0x98,0x21,0x31,0x1a,0x8f,0x09,0x12,0x83,
+0xb9,0x9c,0x30,0x53,0x00,0xad,0x9a,0x51,0x33,0xd1,0xea,0x89,0x72,0x44,0x43,0x02,
+0x91,0xa8,0x88,0x10,0x11,0x91,0xa9,0x8b,0x31,0x43,0xb1,0xfb,0x98,0x33,0x15,0x99,
+0xaf,0x18,0x34,0x85,0xea,0xbd,0x8c,0x38,0x53,0x13,0x80,0x9a,0x89,0x21,0x11,0xb8,
+0xc8,0x01,0x22,0x91,0xe0,0xa0,0x02,0x83,0xe3,0xc1,0x81,0x02,0x11,0xaa,0xb9,0x23,
+0x52,0x09,0xab,0x2b,0x32,0x95,0x09,0x2f,0x3a,0x20,0x19,0x9c,0x19,0x30,0x96,0xc1,
+0xa8,0x30,0x41,0x99,0xd9,0x1a,0x51,0x11,0xb9,0x8f,0x10,0x25,0x90,0xbd,0x0b,0x74,
+0x36,0x14,0x01,0x98,0x89,0x00,0x11,0x88,0x99,0x90,0x93,0xa3,0xb1,0xa0,0x13,0x95,
+0xb1,0xb8,0x93,0x33,0x19,0x8d,0x4a,0x59,0x09,0xc9,0xa0,0x33,0x06,0xc8,0xbc,0x28,
+0x77,0x34,0x22,0x80,0x99,0x89,0x20,0x10,0x98,0x99,0x19,0x03,0x93,0xa9,0xab,0x31,
+0x33,0xa1,0x9b,0x2b,0x11,0x95,0xa0,0x1a,0x39,0x21,0xb2,0x99,0x1b,0x59,0x19,0x98,
+0xb0,0x91,0x94,0xb3,0xb9,0xa0,0x93,0x93,0xc3,0xa1,0x10,0x31,0x20,0x9b,0xb9,0x02,
+0x93,0xa3,0x1a,0x1b,0x11,0xa4,0xb2,0x0b,0x2a,0x93,0xb3,0xf3,0xa1,0x02,0x20,0x8a,
+0xa9,0x3a,0x21,0xa3,0xc1,0x90,0x59,0x49,0x1a,0x0b,0x3b,0x50,0x10,0x9a,0x9b,0x39,
+0x33,0x10,0xbc,0xb0,0x15,0x03,0xe8,0xa9,0x20,0x53,0x00,0xbd,0x9b,0x54,0x24,0xd9,
+0xde,0xbb,0x9a,0x18,0x01,0x81,0x89,0x88,0x00,0x88,0x10,0x13,0xe3,0xef,0xcc,0xab,
+0x08,0x53,0x43,0x12,0x00,0x89,0x88,0x00,0x00,0x08,0x88,0x80,0x80,0x00,0x28,0x4b,
+0x0b,0xc0,0xa5,0x93,0x88,0x1b,0x19,0x94,0xa4,0xb0,0x9a,0x32,0x94,0xd2,0xb9,0x92,
+0x25,0x11,0x0e,0x1b,0x49,0x11,0xc1,0xc9,0x00,0x05,0xa4,0xb0,0x0c,0x48,0x32,0xb8,
+0xcc,0x88,0x25,0x93,0xd9,0xab,0x41,0x34,0xa0,0xbd,0x0a,0x34,0x87,0xb8,0x9c,0x20,
+0x25,0xb2,0xfb,0x89,0x33,0x16,0xc9,0xac,0x49,0x45,0x03,0xca,0x9c,0x74,0x57,0x34,
+0x43,0x22,0x43,0x33,0x25,0x12,0x90,0xca,0xcb,0xaa,0x89,0x9a,0xcb,0xcd,0xbc,0xbd,
+0xcb,0xcb,0xba,0xab,0xcb,0xba,0xcb,0xaa,0x9a,0x99,0x88,0x11,0x44,0x44,0x24,0x33,
+0x24,0x33,0x44,0x43,0x34,0x43,0x33,0x32,0x21,0x21,0x31,0x53,0x33,0x24,0x02,0x98,
+0xdb,0xcb,0xaa,0x89,0x99,0xdb,0xdc,0xbb,0xac,0x9b,0x9a,0x89,0x88,0x08,0x08,0x10,
+0x52,0x45,0x34,0x34,0x24,0x34,0x53,0x33,0x33,0x33,0x32,0x33,0x33,0x43,0x23,0x02,
+0xc9,0xdd,0xbd,0xbb,0xcb,0xba,0xcc,0xcc,0xcb,0xbc,0xac,0xab,0x9a,0x99,0xa9,0xcd,
+0xbc,0xbb,0x9a,0x08,0x10,0x22,0x73,0x44,0x44,0x33,0x23,0x22,0x11,0x32,0x35,0x35,
+0x23,0x23,0x11,0x00,0x99,0xda,0xdc,0xbc,0xbb,0xab,0xaa,0xca,0xdb,0xcb,0xbb,0xcb,
+0xaa,0xaa,0xa9,0x99,0x99,0xab,0xaa,0x28,0x73,0x43,0x43,0x43,0x34,0x43,0x33,0x43,
+0x42,0x32,0x32,0x12,0x11,0x08,0x80,0xa8,0xda,0xdb,0xba,0xab,0xbc,0xdd,0xbc,0xbd,
+0xcb,0xba,0xba,0xaa,0xba,0xba,0xab,0x9b,0x18,0x64,0x54,0x53,0x32,0x33,0x32,0x34,
+0x44,0x44,0x43,0x32,0x22,0x22,0x11,0x22,0x33,0x34,0x22,0x11,0xa8,0xdb,0xbd,0xbb,
+0xcb,0xba,0xcc,0xcc,0xcb,0xab,0xab,0xaa,0xaa,0x9a,0x99,0x08,0x00,0x32,0x55,0x35,
+0x44,0x33,0x34,0x44,0x43,0x32,0x33,0x22,0x22,0x23,0x23,0x23,0x12,0xa8,0xdc,0xcd,
+0xac,0xac,0xba,0xcb,0xcc,0xdb,0xcb,0xab,0xbb,0xaa,0xba,0xba,0xdb,0xcb,0xab,0x9b,
+0x08,0x42,0x43,0x13,0x01,0x80,0x31,0x47,0x44,0x33,0x23,0x12,0x11,0x00,0x00,0x10,
+0x11,0x80,0xeb,0xdc,0xbc,0xcb,0xbb,0xcc,0xcb,0xbc,0xbb,0xbb,0xbb,0xcb,0xca,0xba,
+0xaa,0x89,0x30,0x46,0x34,0x34,0x22,0x43,0x53,0x35,0x35,0x43,0x23,0x22,0x21,0x31,
+0x42,0x34,0x33,0x23,0x00,0xa9,0xab,0xbb,0xba,0xcb,0xbd,0xbe,0xcd,0xbb,0xbb,0xbb,
+0xba,0xba,0xbc,0xab,0x9b,0x99,0x80,0x00,0x32,0x46,0x44,0x43,0x44,0x33,0x25,0x33,
+0x32,0x32,0x34,0x43,0x23,0x80,0xca,0xbe,0xbc,0xab,0xaa,0xa9,0xdd,0xcd,0xbc,0xbc,
+0xab,0xaa,0xaa,0xaa,0x09,0x31,0x44,0x33,0x12,0x98,0x18,0x64,0x45,0x43,0x23,0x23,
+0x33,0x43,0x33,0x11,0xa9,0xac,0x9b,0x10,0x32,0x13,0xb8,0xce,0xbc,0xbc,0xcb,0xba,
+0xba,0xbd,0xcd,0xcb,0xcb,0xaa,0xaa,0xaa,0xaa,0xbb,0xba,0xaa,0x99,0x20,0x45,0x34,
+0x33,0x24,0x43,0x34,0x45,0x33,0x34,0x32,0x24,0x33,0x43,0x32,0x22,0x11,0x00,0x98,
+0xa9,0xb9,0xcc,0xdc,0xdb,0xdb,0xbb,0xac,0xab,0xaa,0xa9,0xba,0xbc,0xbb,0x8a,0x41,
+0x36,0x35,0x33,0x43,0x32,0x44,0x44,0x43,0x34,0x33,0x23,0x23,0x33,0x34,0x34,0x24,
+0x22,0x01,0x90,0xb9,0xca,0xcb,0xcb,0xbc,0xcc,0xdb,0xbb,0xbc,0xab,0xaa,0xba,0xba,
+0xbb,0xbb,0x9a,0x88,0x08,0x21,0x54,0x44,0x44,0x34,0x53,0x43,0x33,0x33,0x24,0x23,
+0x24,0x23,0x12,0x88,0xcb,0xcb,0xbb,0xac,0xcb,0xcc,0xcc,0xbc,0xcc,0xab,0xbb,0xbb,
+0xbb,0xcc,0xdb,0xbb,0xac,0x9a,0x08,0x00,0x11,0x01,0x21,0x32,0x45,0x35,0x44,0x33,
+0x24,0x32,0x22,0x22,0x23,0x23,0x23,0x22,0x12,0x12,0xa0,0xdc,0xbd,0xbd,0xbc,0xbc,
+0xbc,0xba,0xbc,0xdb,0xcb,0xab,0x9a,0x18,0x33,0x35,0x32,0x22,0x42,0x44,0x54,0x34,
+0x35,0x33,0x43,0x22,0x33,0x43,0x33,0x34,0x32,0x23,0x11,0x01,0x08,0x88,0xa9,0xcd,
+0xbc,0xcd,0xcb,0xdb,0xcb,0xac,0xbb,0xba,0xab,0xba,0xaa,0xbb,0xbc,0xbb,0x8b,0x30,
+0x45,0x34,0x24,0x22,0x12,0x22,0x53,0x45,0x35,0x33,0x01,0xca,0xcc,0xab,0x9a,0x98,
+0x99,0x89,0x40,0x54,0x33,0x81,0xda,0xcd,0xaa,0x8a,0x11,0x22,0x02,0x98,0xa9,0x99,
+0xba,0xde,0xcd,0xab,0x8a,0x21,0x44,0x33,0x33,0x33,0x24,0x23,0x43,0x43,0x34,0x22,
+0x80,0xb9,0xbb,0xab,0xcb,0xcd,0xdb,0xcb,0xbc,0xbc,0xcc,0xbb,0xbb,0xcb,0xba,0xbc,
+0xab,0xab,0xaa,0x88,0x10,0x44,0x54,0x43,0x33,0x43,0x33,0x35,0x43,0x43,0x33,0x33,
+0x24,0x22,0x12,0x12,0x22,0x32,0x32,0x22,0xa8,0xec,0xbc,0xbc,0xac,0xba,0xba,0xbd,
+0xbd,0xcb,0xbb,0xaa,0x89,0x10,0x21,0x23,0x24,0x43,0x44,0x44,0x44,0x34,0x43,0x33,
+0x34,0x33,0x34,0x33,0x34,0x32,0x23,0x22,0x80,0x98,0xa9,0xca,0xcc,0xcc,0xbc,0xbc,
+0xbc,0xcc,0xbb,0xbc,0xbb,0xaa,0xab,0xba,0xbb,0xbb,0xab,0x8a,0x20,0x54,0x44,0x33,
+0x24,0x32,0x34,0x45,0x43,0x43,0x22,0x22,0x11,0x88,0x98,0x99,0x88,0xa8,0xdc,0xce,
+0xcc,0xac,0xbb,0xcb,0xba,0xcb,0xbc,0xcb,0xbb,0xac,0xab,0xa9,0x99,0x99,0x88,0x18,
+0x32,0x36,0x35,0x53,0x33,0x45,0x43,0x33,0x24,0x32,0x12,0x32,0x32,0x33,0x34,0x24,
+0x02,0x98,0xcb,0xbb,0x9b,0x08,0x98,0xfb,0xbe,0xbd,0xac,0x9b,0x89,0x00,0x01,0x81,
+0x88,0x89,0x21,0x56,0x34,0x35,0x33,0x34,0x43,0x43,0x34,0x34,0x33,0x33,0x33,0x33,
+0x34,0x12,0x01,0x99,0xcb,0xcc,0xdb,0xbb,0xbd,0xcc,0xdb,0xcb,0xbb,0xab,0xab,0xab,
+0xac,0xbc,0xbc,0xcb,0xaa,0x08,0x21,0x33,0x91,0xea,0xbb,0x8a,0x53,0x35,0x35,0x43,
+0x44,0x43,0x24,0x22,0x10,0x88,0x00,0x21,0x42,0x32,0x01,0x99,0xcb,0xcc,0xcc,0xdc,
+0xbb,0xbc,0xab,0x9a,0x99,0xa9,0xbb,0xac,0xaa,0x89,0x20,0x52,0x43,0x43,0x22,0x33,
+0x44,0x44,0x33,0x24,0x22,0x22,0x12,0x12,0x01,0x01,0x00,0xb9,0xdd,0xbd,0xbc,0xbc,
+0xcb,0xbc,0xcc,0xba,0xba,0xaa,0xba,0xba,0xbb,0xbb,0x9b,0x18,0x63,0x45,0x43,0x33,
+0x34,0x53,0x34,0x44,0x43,0x33,0x32,0x23,0x22,0x23,0x34,0x34,0x24,0x12,0x80,0xb9,
+0xbb,0xac,0x9a,0xbb,0xdd,0xdc,0xcb,0xbb,0xba,0x9a,0x99,0x99,0xaa,0xaa,0x99,0x18,
+0x44,0x54,0x34,0x34,0x43,0x43,0x43,0x34,0x25,0x24,0x32,0x22,0x22,0x22,0x12,0x11,
+0xa9,0xcb,0xcc,0xbb,0xcc,0xcb,0xcb,0xbc,0xcc,0xbb,0xbb,0xbb,0xbb,0xcb,0xdb,0xca,
+0xaa,0xaa,0x09,0x10,0x32,0x23,0x22,0x22,0x63,0x55,0x34,0x44,0x22,0x11,0x08,0x88,
+0x18,0x21,0x23,0x11,0xb9,0xde,0xcb,0xbc,0xbb,0xbb,0xcc,0xcc,0xdb,0xbb,0xcb,0xaa,
+0xab,0xbb,0xba,0xaa,0x09,0x11,0x33,0x45,0x34,0x44,0x43,0x34,0x44,0x43,0x33,0x23,
+0x33,0x33,0x44,0x53,0x32,0x32,0x11,0x80,0x99,0x98,0x10,0x11,0x90,0xde,0xcc,0xcb,
+0xbb,0xab,0xba,0xba,0xba,0xcb,0xac,0xaa,0x89,0x21,0x34,0x35,0x43,0x34,0x34,0x53,
+0x33,0x35,0x33,0x34,0x24,0x33,0x23,0x22,0x00,0x99,0xaa,0xa9,0xda,0xdc,0xcc,0xcc,
+0xbc,0xbc,0xbc,0xaa,0x9b,0xbb,0xcd,0xcc,0xba,0xaa,0x99,0x89,0x09,0x30,0x45,0x35,
+0x24,0x23,0x21,0x21,0x53,0x44,0x43,0x33,0x22,0x22,0x11,0x11,0x98,0xdb,0xbd,0xbb,
+0xaa,0x99,0xba,0xcc,0xcc,0xcb,0xcb,0xbb,0xbb,0xab,0xab,0xcb,0xbc,0xbb,0xab,0x89,
+0x10,0x32,0x53,0x43,0x34,0x43,0x44,0x53,0x43,0x23,0x23,0x12,0x22,0x33,0x33,0x23,
+0x12,0x12,0x01,0xa8,0xcd,0xbd,0xbd,0xcc,0xcc,0xcb,0xba,0xbb,0xcb,0xca,0xba,0xab,
+0xaa,0x18,0x32,0x44,0x33,0x43,0x43,0x35,0x45,0x43,0x34,0x42,0x22,0x32,0x32,0x43,
+0x33,0x25,0x23,0x12,0x00,0x98,0x98,0x88,0x99,0xdb,0xcd,0xbc,0xcc,0xcb,0xba,0xbb,
+0xbb,0xab,0xcb,0xba,0xbb,0x9a,0x10,0x42,0x34,0x35,0x43,0x34,0x34,0x35,0x43,0x24,
+0x33,0x24,0x33,0x33,0x23,0x12,0x00,0x89,0xaa,0xcb,0xcd,0xcc,0xdb,0xdb,0xbb,0xad,
+0xbb,0xcb,0xba,0xdb,0xbb,0xbc,0xab,0x9b,0x8a,0x88,0x88,0x99,0x9a,0x09,0x63,0x55,
+0x43,0x43,0x33,0x32,0x33,0x33,0x34,0x24,0x33,0x12,0x01,0x98,0xa9,0xdb,0xbc,0xcd,
+0xbb,0xbc,0xbc,0xcc,0xcb,0xcb,0xbb,0xba,0xbb,0xaa,0x89,0x08,0x01,0x08,0x41,0x56,
+0x54,0x53,0x32,0x43,0x22,0x33,0x34,0x44,0x33,0x34,0x32,0x22,0x11,0x10,0x11,0x10,
+0x80,0xa8,0xdb,0xdc,0xcb,0xbc,0xcb,0xcb,0xcb,0xba,0xbb,0xba,0xcb,0xbb,0xbb,0xac,
+0x99,0x18,0x41,0x53,0x43,0x32,0x42,0x43,0x44,0x44,0x33,0x33,0x22,0x11,0x88,0xa9,
+0x88,0x31,0x03,0xfb,0xff,0xbb,0xcb,0xaa,0xaa,0xba,0xcb,0xaa,0x08,0x21,0x12,0xa8,
+0xcc,0xac,0x09,0x52,0x35,0x34,0x24,0x22,0x22,0x23,0x22,0x80,0x88,0x30,0x65,0x43,
+0x23,0x22,0x80,0x98,0xa9,0xba,0xba,0xdb,0xeb,0xcc,0xdb,0xcb,0xbb,0xcc,0xca,0xaa,
+0xbb,0xba,0xac,0xbb,0xab,0x8a,0x88,0x00,0x21,0x42,0x54,0x43,0x34,0x43,0x34,0x35,
+0x34,0x43,0x32,0x22,0x22,0x22,0x32,0x22,0x22,0x01,0xa8,0xda,0xcc,0xcb,0xcb,0xba,
+0xdb,0xdb,0xcb,0xac,0xbb,0xaa,0x89,0x88,0x00,0x01,0x18,0x20,0x45,0x45,0x44,0x33,
+0x34,0x33,0x34,0x34,0x34,0x34,0x43,0x32,0x22,0x22,0x11,0x11,0x01,0x80,0xca,0xdb,
+0xbc,0xcc,0xcb,0xbc,0xcb,0xbb,0xac,0xbb,0xcb,0xba,0xba,0xbb,0xbb,0x9b,0x0a,0x31,
+0x55,0x33,0x25,0x33,0x35,0x44,0x53,0x33,0x43,0x12,0x11,0x01,0x01,0x11,0x12,0x01,
+0xb9,0xcf,0xcc,0xbc,0xba,0xcb,0xba,0xcc,0xbc,0xbd,0xac,0xbb,0xaa,0xaa,0x9a,0xaa,
+0xaa,0xab,0x89,0x21,0x45,0x44,0x43,0x43,0x33,0x53,0x33,0x34,0x33,0x33,0x33,0x34,
+0x24,0x22,0x11,0x80,0xa9,0xba,0xcb,0xab,0xcb,0xcd,0xbe,0xcd,0xba,0xab,0x89,0x08,
+0x88,0xa9,0xcb,0xaa,0x19,0x54,0x45,0x34,0x23,0x33,0x43,0x43,0x34,0x35,0x43,0x33,
+0x33,0x23,0x23,0x33,0x43,0x23,0x11,0x98,0xc9,0xdb,0xcc,0xdb,0xdb,0xbb,0xcc,0xca,
+0xaa,0xab,0xba,0xcb,0xbb,0xac,0xaa,0x88,0x00,0x01,0x80,0x88,0x89,0x30,0x67,0x35,
+0x25,0x13,0x81,0xa9,0x99,0x18,0x21,0x23,0x32,0x55,0x45,0x33,0x13,0xa0,0xbc,0xac,
+0x9a,0x88,0x80,0xb9,0xdc,0xcb,0xba,0xcc,0xbc,0xcd,0xab,0xaa,0x08,0x11,0x22,0x12,
+0x11,0x22,0x45,0x44,0x34,0x34,0x22,0x12,0x01,0x11,0x21,0x32,0x01,0x90,0xdb,0xcc,
+0xbc,0xbc,0xbc,0xdb,0xcb,0xdb,0xcb,0xbb,0xba,0xbb,0xba,0xba,0xab,0x9a,0x18,0x34,
+0x35,0x33,0x12,0x11,0x11,0x43,0x34,0x33,0x22,0x01,0x80,0x20,0x56,0x45,0x43,0x22,
+0x01,0x88,0x18,0x63,0x35,0x34,0x33,0x12,0x11,0x00,0x21,0x45,0x44,0x32,0x22,0x01,
+0x00,0x18,0x42,0x44,0x34,0x32,0x11,0x80,0x08,0x20,0x34,0x25,0x22,0x02,0x81,0x80,
+0x10,0x32,0x37,0x34,0x23,0x12,0x01,0x88,0xba,0xdd,0xcc,0xba,0xaa,0x88,0x08,0x98,
+0xdc,0xcc,0xac,0xaa,0x88,0x01,0xa8,0xde,0xcc,0xbc,0xba,0x99,0x08,0x11,0x98,0xed,
+0xbc,0xbc,0x9b,0x08,0x11,0x80,0xeb,0xdd,0xbb,0xbb,0x99,0x08,0x01,0x98,0xdb,0xac,
+0xab,0x9a,0x09,0x10,0x01,0xa8,0xeb,0xab,0x9a,0x20,0x22,0x11,0x52,0x65,0x34,0x34,
+0x12,0x00,0x10,0x52,0x54,0x43,0x24,0x23,0x11,0x88,0x10,0x73,0x35,0x35,0x23,0x12,
+0x00,0x88,0x20,0x64,0x53,0x33,0x22,0x00,0x80,0x08,0x31,0x53,0x33,0x23,0x11,0x88,
+0x89,0x20,0x52,0x24,0x23,0x02,0x80,0x98,0xa9,0xbc,0xbe,0xbd,0xbc,0xab,0x08,0x10,
+0xfa,0xdd,0xbc,0xaa,0x8a,0x10,0x80,0xc9,0xdd,0xcc,0xac,0xab,0x89,0x11,0x81,0xfb,
+0xbe,0xbc,0xab,0x9a,0x89,0x88,0x20,0x55,0x35,0x43,0x12,0x81,0x88,0x00,0x52,0x44,
+0x33,0x22,0x02,0x10,0x00,0x98,0xdd,0xcc,0xbb,0x9b,0x88,0x00,0x90,0xba,0xbc,0xac,
+0xab,0x9a,0x08,0x00,0xa8,0xdc,0xdb,0x9a,0x89,0x00,0x80,0x88,0x9a,0xaa,0xba,0xab,
+0x28,0x34,0x15,0xa1,0xcc,0xac,0xab,0x9a,0x9a,0x10,0x73,0x45,0x53,0x23,0x23,0x11,
+0x80,0x10,0x52,0x44,0x34,0x23,0x11,0x80,0x18,0x53,0x56,0x43,0x24,0x12,0x00,0x88,
+0x28,0x54,0x44,0x24,0x23,0x01,0x08,0x88,0x31,0x45,0x34,0x33,0x12,0x00,0x88,0x18,
+0x53,0x45,0x23,0x23,0x81,0x98,0x98,0x11,0x34,0x34,0x12,0x81,0xa8,0xaa,0x18,0x73,
+0x44,0x22,0x02,0x88,0x99,0xa8,0xfb,0xcc,0xcb,0xab,0x9a,0x98,0xa8,0xda,0xdb,0xcb,
+0xbb,0xab,0x8a,0x08,0xb0,0xdf,0xcd,0xac,0xab,0x99,0x00,0x08,0xba,0xbf,0xbd,0xac,
+0x9a,0x88,0x00,0xa9,0xdd,0xcc,0xbb,0xaa,0x89,0x18,0x88,0xb9,0xcc,0xcb,0xbb,0xa9,
+0x08,0x11,0x01,0xb8,0xeb,0xab,0x9a,0x89,0x08,0x21,0x55,0x35,0x34,0x23,0x11,0x10,
+0x30,0x54,0x54,0x34,0x24,0x13,0x81,0x88,0x20,0x46,0x45,0x43,0x22,0x01,0x80,0x80,
+0x21,0x55,0x43,0x33,0x12,0x00,0x88,0x00,0x32,0x44,0x32,0x13,0x81,0x98,0x9a,0x10,
+0x34,0x34,0x12,0x01,0x01,0x90,0xda,0xcd,0xcc,0xab,0xbb,0xaa,0xba,0xcc,0xce,0xcc,
+0xbb,0xab,0x88,0x08,0x98,0xda,0xcd,0xcc,0xbc,0xab,0x88,0x21,0x81,0xed,0xcc,0xac,
+0x9b,0x89,0x09,0x88,0x21,0x45,0x35,0x24,0x12,0x80,0x88,0x10,0x63,0x53,0x32,0x12,
+0x11,0x10,0x80,0xa9,0xce,0xcc,0xab,0x9a,0x08,0x80,0x98,0xca,0xbb,0xbb,0xab,0x89,
+0x00,0x00,0xca,0xcd,0xac,0xaa,0x88,0x08,0x88,0x98,0x98,0xba,0xcc,0x9b,0x18,0x32,
+0x83,0xfc,0xcb,0xab,0x89,0x08,0x88,0x18,0x62,0x45,0x43,0x33,0x22,0x11,0x01,0x21,
+0x63,0x44,0x43,0x12,0x81,0x88,0x18,0x54,0x55,0x43,0x23,0x11,0x88,0x89,0x30,0x47,
+0x53,0x32,0x12,0x81,0x80,0x18,0x52,0x34,0x25,0x23,0x01,0x80,0x08,0x20,0x54,0x43,
+0x33,0x22,0x80,0x99,0x88,0x31,0x44,0x22,0x02,0xa0,0xb9,0xaa,0x18,0x56,0x53,0x12,
+0x80,0xa9,0xa9,0x98,0xfb,0xcc,0xbc,0xab,0x88,0x00,0xa8,0xdc,0xcb,0xbb,0xac,0xaa,
+0x99,0x08,0xc9,0xed,0xbc,0xad,0xaa,0x89,0x00,0x88,0xca,0xcd,0xcc,0xba,0x99,0x08,
+0x01,0xb8,0xde,0xbc,0xcb,0x9a,0x88,0x00,0x88,0xa9,0xbc,0xbc,0xbb,0x9a,0x18,0x21,
+0x00,0xba,0xbe,0xab,0x8a,0x80,0x01,0x30,0x65,0x44,0x24,0x13,0x81,0x80,0x21,0x73,
+0x44,0x43,0x43,0x12,0x00,0x98,0x20,0x65,0x44,0x33,0x23,0x01,0x88,0x08,0x53,0x45,
+0x33,0x14,0x11,0x08,0x88,0x10,0x42,0x32,0x24,0x21,0x80,0x88,0x08,0x31,0x34,0x22,
+0x00,0x88,0x11,0x12,0xd9,0xcf,0xcc,0xba,0xaa,0x89,0x88,0xb8,0xed,0xcc,0xac,0xab,
+0x09,0x08,0x90,0xfa,0xcc,0xbd,0xcb,0x8a,0x08,0x11,0xb9,0xee,0xdb,0xba,0xa9,0x98,
+0x88,0x80,0x32,0x37,0x35,0x24,0x11,0x88,0x88,0x20,0x44,0x44,0x22,0x12,0x11,0x00,
+0x90,0xca,0xce,0xbb,0x9c,0x89,0x08,0x80,0xa8,0xcb,0xbb,0xab,0x9b,0x89,0x80,0x91,
+0xca,0xcd,0xac,0xaa,0x89,0x80,0x80,0x99,0xb9,0xbb,0xac,0x89,0x22,0x33,0xb0,0xde,
+0xbc,0xab,0x9a,0x89,0x08,0x31,0x56,0x44,0x43,0x23,0x12,0x81,0x88,0x10,0x54,0x34,
+0x34,0x21,0x80,0x88,0x20,0x65,0x54,0x33,0x33,0x02,0x90,0x08,0x62,0x54,0x43,0x33,
+0x22,0x01,0x80,0x00,0x52,0x54,0x43,0x22,0x01,0x90,0x88,0x30,0x44,0x34,0x33,0x11,
+0x80,0x89,0x00,0x32,0x44,0x33,0x12,0x80,0xba,0xac,0x19,0x54,0x44,0x22,0x01,0x98,
+0xa9,0xba,0xdd,0xbc,0xad,0xaa,0x99,0x88,0xa9,0xdc,0xdb,0xbb,0xbb,0xab,0x08,0x80,
+0xfa,0xec,0xdb,0xba,0x9a,0x88,0x80,0xb8,0xdc,0xcc,0xbc,0xab,0x99,0x10,0x81,0xc9,
+0xce,0xbc,0x9c,0x99,0x00,0x80,0x90,0xaa,0xbc,0xcb,0xaa,0x89,0x08,0x81,0xa9,0xcb,
+0xbb,0x89,0x08,0x80,0x10,0x73,0x36,0x35,0x33,0x33,0x22,0x01,0x21,0x65,0x54,0x53,
+0x22,0x01,0x88,0x88,0x52,0x45,0x43,0x33,0x23,0x00,0x90,0x10,0x63,0x35,0x34,0x23,
+0x01,0x80,0x80,0x11,0x32,0x44,0x32,0x13,0x80,0x89,0x08,0x32,0x25,0x13,0x11,0x21,
+0x01,0xc8,0xce,0xbc,0xbc,0xbb,0xac,0x9a,0x08,0xa8,0xde,0xcd,0xac,0x9a,0x89,0x80,
+0x98,0xeb,0xcd,0xcc,0xba,0x9a,0x10,0x01,0xd9,0xce,0xbc,0xab,0xaa,0x98,0x88,0x18,
+0x52,0x36,0x35,0x23,0x11,0x88,0x88,0x21,0x46,0x43,0x23,0x22,0x00,0x81,0xa0,0xea,
+0xdc,0xbb,0xab,0x88,0x08,0x80,0xb9,0xcb,0xac,0xab,0x9a,0x8a,0x80,0x90,0xdb,0xcc,
+0xab,0x9a,0x89,0x80,0x98,0x9a,0xbb,0xbc,0xac,0x09,0x51,0x22,0xa1,0xce,0xbb,0x9b,
+0x08,0x00,0xa9,0x89,0x64,0x45,0x43,0x13,0x12,0x11,0x10,0x32,0x53,0x44,0x43,0x22,
+0x01,0x80,0x30,0x65,0x44,0x43,0x22,0x11,0x08,0x18,0x52,0x45,0x43,0x33,0x12,0x00,
+0x08,0x31,0x45,0x44,0x32,0x12,0x00,0x89,0x08,0x52,0x44,0x24,0x12,0x00,0x88,0x08,
+0x10,0x22,0x32,0x33,0x22,0x90,0xcb,0x9a,0x63,0x35,0x33,0x81,0x88,0x18,0x90,0xed,
+0xcd,0xcb,0xaa,0x89,0x88,0x99,0x99,0xbc,0xcd,0xcc,0xab,0x99,0x18,0x90,0xea,0xcd,
+0xbc,0xab,0x99,0x00,0x80,0xc9,0xcd,0xcc,0xbb,0xaa,0x89,0x00,0x90,0xeb,0xdd,0xbb,
+0xac,0x8a,0x08,0x80,0xa8,0xdb,0xbb,0xac,0x99,0x08,0x10,0x00,0xa8,0xcc,0xbb,0xab,
+0x00,0x22,0x32,0x32,0x37,0x36,0x34,0x22,0x01,0x80,0x31,0x56,0x45,0x33,0x23,0x01,
+0x88,0x18,0x74,0x44,0x43,0x23,0x12,0x80,0x89,0x10,0x54,0x44,0x33,0x22,0x81,0x88,
+0x08,0x21,0x43,0x34,0x23,0x11,0x98,0x89,0x20,0x34,0x24,0x01,0x08,0x20,0x22,0xc8,
+0xde,0xcb,0xab,0xab,0xba,0xbb,0xaa,0xeb,0xdd,0xcc,0xbb,0x9a,0x88,0x90,0xeb,0xbd,
+0xcd,0xbb,0xac,0x89,0x00,0x81,0xfb,0xcd,0xcb,0xaa,0x8a,0x89,0x88,0x18,0x62,0x35,
+0x25,0x13,0x81,0x88,0x18,0x43,0x45,0x32,0x22,0x01,0x01,0x01,0xa8,0xec,0xcc,0xbb,
+0xaa,0x08,0x08,0x90,0xaa,0xbc,0xac,0xab,0x9a,0x08,0x00,0x98,0xcc,0xad,0xab,0x8a,
+0x08,0x08,0x88,0x99,0xca,0xcb,0xaa,0x18,0x22,0x02,0xea,0xcc,0xba,0xa9,0x99,0xa9,
+0x08,0x63,0x45,0x34,0x34,0x33,0x22,0x11,0x21,0x63,0x34,0x23,0x13,0x12,0x31,0x42,
+0x42,0x73,0x44,0x53,0x32,0x01,0x98,0x10,0x54,0x44,0x33,0x23,0x01,0x00,0x18,0x31,
+0x46,0x34,0x33,0x12,0x00,0x88,0x21,0x44,0x44,0x33,0x43,0x11,0x80,0x98,0x08,0x31,
+0x34,0x23,0x02,0x88,0x99,0x88,0x21,0x46,0x34,0x33,0x01,0xa9,0xdb,0xcc,0xdc,0xca,
+0x9a,0x89,0x88,0xa8,0xcb,0xcc,0xbb,0xbc,0xbc,0xaa,0x09,0x98,0xdd,0xbe,0xad,0x9b,
+0x89,0x00,0x98,0xcb,0xcd,0xcb,0xbb,0xaa,0x09,0x10,0x90,0xed,0xdc,0xbb,0xab,0x89,
+0x00,0x81,0xb9,0xbd,0xad,0xab,0x89,0x00,0x01,0x90,0xb9,0xbc,0xaa,0x08,0x10,0x08,
+0x18,0x73,0x45,0x43,0x32,0x12,0x11,0x21,0x53,0x46,0x44,0x43,0x22,0x81,0x98,0x18,
+0x54,0x45,0x43,0x22,0x11,0x88,0x08,0x21,0x45,0x34,0x24,0x22,0x00,0x88,0x00,0x22,
+0x53,0x33,0x22,0x00,0x99,0x99,0x20,0x44,0x23,0x11,0x88,0x88,0x10,0xa9,0xde,0xbd,
+0xbc,0x9c,0x89,0x18,0x80,0xfa,0xdc,0xcb,0xba,0x89,0x08,0x80,0xda,0xdc,0xcc,0xcb,
+0x9a,0x09,0x01,0xa1,0xec,0xbd,0xbc,0xab,0x99,0x89,0x88,0x31,0x65,0x53,0x32,0x12,
+0x00,0x98,0x20,0x63,0x34,0x24,0x22,0x01,0x00,0x80,0xa9,0xdd,0xbc,0xac,0x9a,0x08,
+0x80,0xa0,0xba,0xbc,0xbb,0xab,0x89,0x88,0x80,0xc9,0xdc,0xac,0xab,0x89,0x09,0x89,
+0x88,0x88,0x98,0xca,0xba,0x8a,0x20,0x02,0xea,0xcd,0xbb,0x9a,0x89,0x09,0x18,0x64,
+0x54,0x43,0x43,0x21,0x01,0x01,0x11,0x33,0x45,0x43,0x32,0x23,0x02,0x01,0x43,0x57,
+0x34,0x24,0x12,0x80,0x09,0x40,0x54,0x44,0x32,0x12,0x81,0x80,0x08,0x42,0x44,0x34,
+0x24,0x01,0x80,0x88,0x10,0x53,0x34,0x23,0x22,0x80,0x88,0x10,0x42,0x33,0x14,0x02,
+0x01,0x88,0x89,0x09,0x71,0x44,0x33,0x02,0xb9,0xcb,0x9a,0xca,0xdd,0xcc,0xab,0x8a,
+0x18,0x90,0xd9,0xdb,0xac,0xab,0x9a,0x89,0x08,0xb9,0xdf,0xbd,0xbc,0xab,0x89,0x00,
+0x90,0xeb,0xcc,0xbb,0xac,0x9a,0x08,0x80,0xb9,0xdf,0xbc,0xac,0x9a,0x09,0x18,0x88,
+0xb9,0xcc,0xcb,0xaa,0x8a,0x01,0x11,0xa8,0xcc,0xab,0x8a,0x10,0x00,0x09,0x20,0x56,
+0x34,0x32,0x12,0x11,0x32,0x33,0x36,0x46,0x35,0x24,0x12,0x90,0x88,0x30,0x56,0x34,
+0x34,0x32,0x01,0x80,0x18,0x42,0x45,0x34,0x22,0x11,0x80,0x80,0x01,0x21,0x43,0x34,
+0x23,0x80,0xa8,0x88,0x32,0x24,0x02,0x10,0x53,0x23,0xc8,0xbf,0xbb,0x89,0xd9,0xbe,
+0x9d,0x72,0x46,0x44,0x33,0x23,0x23,0x34,0x34,0x24,0x12,0x00,0x80,0x98,0xb9,0xcf,
+0xdc,0xcb,0xbb,0xba,0xab,0xbb,0xba,0x9a,0x10,0x22,0x01,0xb9,0xab,0x61,0x55,0x34,
+0x33,0x22,0x11,0x90,0x99,0x9a,0x20,0x34,0xb0,0xff,0xbc,0xbb,0x8a,0x89,0x99,0x89,
+0x73,0x55,0x34,0x43,0x23,0x22,0x22,0x11,0x11,0x11,0x00,0xd9,0xec,0xcc,0xcb,0xba,
+0xaa,0xa9,0xaa,0xaa,0x89,0x10,0x22,0x23,0x43,0x44,0x44,0x43,0x32,0x32,0x21,0x01,
+0x81,0xca,0xec,0xbc,0xbd,0xbb,0xac,0xab,0xab,0x9a,0x8a,0x08,0x32,0x34,0x45,0x43,
+0x34,0x34,0x33,0x23,0x23,0x11,0x01,0xa8,0xcd,0xdc,0xbc,0xcc,0xba,0xbb,0xbb,0xab,
+0xa9,0x08,0x21,0x54,0x44,0x34,0x34,0x24,0x33,0x22,0x13,0x11,0x00,0x98,0xbb,0xdc,
+0xbc,0xcc,0xcb,0xbb,0xbb,0xbb,0x9a,0x99,0x10,0x63,0x54,0x34,0x34,0x34,0x32,0x22,
+0x22,0x11,0x81,0x98,0xba,0xba,0xcc,0xeb,0xdb,0xcb,0xba,0xab,0x9a,0x99,0x09,0x41,
+0x54,0x35,0x44,0x33,0x32,0x23,0x22,0x22,0x00,0x88,0xba,0xcb,0xcc,0xdb,0xbc,0xbc,
+0xbc,0xba,0x9a,0x9a,0x88,0x11,0x63,0x44,0x34,0x34,0x24,0x32,0x22,0x12,0x11,0x88,
+0x99,0xcb,0xcc,0xcc,0xcb,0xbc,0xbb,0xbb,0xab,0x9b,0x89,0x10,0x43,0x44,0x34,0x35,
+0x34,0x24,0x33,0x12,0x11,0x01,0x88,0xcb,0xcd,0xcc,0xbc,0xbb,0xbc,0xba,0xab,0xaa,
+0x89,0x10,0x32,0x43,0x44,0x53,0x53,0x33,0x43,0x22,0x12,0x01,0x80,0xa9,0xce,0xdc,
+0xcb,0xbb,0xac,0xba,0xaa,0xaa,0x89,0x10,0x22,0x32,0x22,0x53,0x45,0x44,0x33,0x33,
+0x22,0x11,0x00,0xa8,0xcd,0xdd,0xcb,0xcb,0xbb,0xbb,0xba,0xab,0x99,0x08,0x21,0x34,
+0x45,0x34,0x44,0x33,0x43,0x32,0x22,0x11,0x01,0x99,0xba,0xbd,0xbd,0xbd,0xbc,0xac,
+0xbb,0xba,0x99,0x89,0x10,0x53,0x45,0x44,0x24,0x43,0x22,0x22,0x21,0x12,0x10,0x98,
+0xa9,0xaa,0xba,0xeb,0xdc,0xcb,0xac,0xaa,0xa9,0x98,0x89,0x21,0x56,0x54,0x33,0x43,
+0x32,0x22,0x32,0x21,0x11,0x98,0xaa,0xcb,0xbc,0xbd,0xbd,0xbc,0xac,0xab,0xaa,0x99,
+0x09,0x20,0x53,0x45,0x53,0x33,0x24,0x33,0x23,0x22,0x11,0x80,0xa9,0xcc,0xbd,0xcd,
+0xbb,0xbc,0xbb,0xac,0xaa,0x99,0x09,0x10,0x31,0x34,0x35,0x44,0x43,0x43,0x22,0x22,
+0x01,0x01,0x88,0xca,0xce,0xcc,0xbc,0xbb,0xbb,0xbb,0xba,0xab,0x09,0x21,0x22,0x91,
+0xbb,0x2a,0x76,0x34,0x34,0x22,0x22,0x01,0x88,0xaa,0x89,0x31,0x24,0xe8,0xce,0xbc,
+0xab,0x89,0x89,0x89,0x30,0x57,0x54,0x33,0x33,0x33,0x33,0x32,0x21,0x11,0x00,0xa8,
+0xfc,0xdc,0xcb,0xac,0xaa,0xaa,0xa9,0x9a,0x89,0x08,0x11,0x21,0x22,0x34,0x36,0x44,
+0x33,0x33,0x23,0x22,0x01,0x90,0xeb,0xdc,0xbc,0xcc,0xba,0xab,0xbb,0xaa,0x9a,0x09,
+0x20,0x42,0x34,0x35,0x35,0x25,0x24,0x22,0x22,0x12,0x10,0x80,0xaa,0xdc,0xcc,0xdb,
+0xbb,0xcb,0xba,0xaa,0x9a,0x99,0x00,0x31,0x46,0x53,0x34,0x43,0x32,0x33,0x23,0x23,
+0x02,0x80,0xb9,0xdb,0xdb,0xbc,0xbd,0xbc,0xbb,0xac,0x9a,0x99,0x88,0x11,0x44,0x54,
+0x34,0x34,0x43,0x22,0x22,0x22,0x11,0x00,0xa9,0xaa,0xac,0xcb,0xdc,0xcb,0xbc,0xbb,
+0xaa,0x99,0x99,0x00,0x52,0x55,0x34,0x25,0x33,0x33,0x23,0x23,0x11,0x81,0x98,0xab,
+0xbc,0xcd,0xdb,0xbc,0xbc,0xbb,0xab,0xaa,0x89,0x08,0x41,0x54,0x34,0x35,0x34,0x32,
+0x33,0x23,0x22,0x01,0x98,0xba,0xdc,0xbc,0xbd,0xcc,0xbb,0xcb,0xaa,0xaa,0x98,0x08,
+0x11,0x43,0x44,0x53,0x43,0x43,0x23,0x23,0x22,0x11,0x80,0xa8,0xeb,0xdc,0xcb,0xbc,
+0xbb,0xcb,0xaa,0xab,0x99,0x09,0x11,0x33,0x35,0x53,0x53,0x43,0x33,0x24,0x12,0x12,
+0x10,0x88,0xda,0xcd,0xcc,0xbb,0xbc,0xab,0xab,0xab,0xaa,0x88,0x21,0x32,0x24,0x33,
+0x54,0x44,0x34,0x43,0x22,0x11,0x01,0x80,0xb9,0xdd,0xcc,0xbc,0xbb,0xbc,0xba,0xaa,
+0xaa,0x09,0x18,0x32,0x44,0x44,0x43,0x34,0x34,0x33,0x23,0x23,0x11,0x80,0xa8,0xca,
+0xcd,0xdb,0xcb,0xcb,0xab,0xbb,0xaa,0x99,0x09,0x20,0x55,0x44,0x34,0x34,0x33,0x33,
+0x33,0x23,0x12,0x80,0xa8,0xaa,0xba,0xcc,0xdc,0xcc,0xbc,0xba,0xaa,0x99,0x89,0x08,
+0x52,0x46,0x44,0x43,0x23,0x33,0x22,0x22,0x12,0x81,0x98,0xba,0xbc,0xcd,0xdb,0xcb,
+0xbb,0xac,0xab,0xaa,0x89,0x08,0x31,0x45,0x44,0x34,0x34,0x24,0x23,0x22,0x11,0x01,
+0x90,0xa9,0xbd,0xbe,0xbd,0xac,0xcb,0xaa,0xaa,0x9b,0x8a,0x09,0x21,0x33,0x45,0x43,
+0x34,0x34,0x24,0x23,0x12,0x11,0x80,0xa8,0xfb,0xcd,0xdb,0xbb,0xcb,0x9a,0xaa,0xba,
+0x99,0x08,0x21,0x12,0x90,0x99,0x40,0x56,0x34,0x33,0x33,0x12,0x81,0xa8,0xbb,0x89,
+0x32,0x82,0xfe,0xcd,0xbb,0x9a,0x89,0x98,0x88,0x61,0x55,0x44,0x33,0x33,0x23,0x33,
+0x12,0x12,0x01,0x00,0xb9,0xdf,0xcc,0xbc,0xbb,0xbb,0xaa,0xba,0x9a,0x8a,0x10,0x22,
+0x32,0x43,0x44,0x44,0x34,0x24,0x23,0x12,0x11,0x00,0x99,0xcc,0xcd,0xcc,0xbb,0xbb,
+0xbb,0xbb,0xba,0x9a,0x08,0x31,0x54,0x43,0x44,0x43,0x34,0x33,0x33,0x22,0x12,0x01,
+0x90,0xda,0xcd,0xcc,0xcb,0xbb,0xbb,0xac,0xaa,0xa9,0x88,0x20,0x52,0x63,0x43,0x34,
+0x34,0x32,0x33,0x32,0x12,0x01,0x90,0xaa,0xcc,0xcc,0xbc,0xbc,0xbc,0xbb,0xba,0xba,
+0x99,0x08,0x42,0x55,0x34,0x35,0x43,0x33,0x32,0x32,0x12,0x11,0x88,0xaa,0xbb,0xbc,
+0xcd,0xdb,0xbc,0xbc,0xab,0xaa,0x9a,0x89,0x20,0x55,0x44,0x34,0x34,0x33,0x32,0x23,
+0x23,0x11,0x88,0xa9,0xcb,0xbc,0xbd,0xbd,0xcc,0xbb,0xbb,0xab,0x9a,0x89,0x10,0x53,
+0x45,0x34,0x44,0x33,0x33,0x32,0x22,0x12,0x00,0x98,0xcb,0xcc,0xcc,0xdb,0xbb,0xbc,
+0xbb,0xbb,0xaa,0x99,0x00,0x42,0x53,0x44,0x43,0x43,0x43,0x32,0x22,0x21,0x00,0x80,
+0xa9,0xdc,0xbd,0xbd,0xbc,0xca,0xaa,0xba,0xa9,0x89,0x08,0x21,0x33,0x35,0x35,0x44,
+0x33,0x34,0x23,0x22,0x11,0x00,0x99,0xdc,0xcd,0xbc,0xad,0xbb,0xba,0xab,0xab,0x99,
+0x18,0x31,0x32,0x33,0x44,0x45,0x34,0x25,0x23,0x22,0x11,0x01,0x88,0xda,0xcd,0xbc,
+0xcc,0xba,0xbb,0xab,0xbb,0x9a,0x09,0x20,0x53,0x53,0x53,0x43,0x43,0x33,0x24,0x22,
+0x11,0x01,0x80,0xaa,0xdb,0xbc,0xcc,0xcb,0xac,0xbb,0xbb,0x9a,0x8a,0x00,0x42,0x45,
+0x44,0x34,0x43,0x23,0x33,0x32,0x22,0x01,0x88,0xa9,0xba,0xbb,0xdc,0xdc,0xcb,0xbc,
+0xaa,0xaa,0x99,0x88,0x10,0x64,0x44,0x44,0x33,0x33,0x24,0x12,0x12,0x11,0x80,0xa9,
+0xaa,0xbc,0xcd,0xdb,0xcb,0xbb,0xba,0xab,0x9a,0x99,0x20,0x52,0x45,0x53,0x43,0x33,
+0x24,0x32,0x12,0x12,0x00,0x90,0xca,0xcd,0xdb,0xcb,0xac,0xab,0xbb,0xba,0xaa,0x89,
+0x00,0x32,0x44,0x53,0x53,0x33,0x44,0x22,0x22,0x11,0x01,0x80,0xb8,0xdd,0xcd,0xcb,
+0xac,0xba,0xaa,0xaa,0xaa,0x8a,0x10,0x22,0x02,0x90,0x18,0x64,0x44,0x34,0x23,0x23,
+0x12,0x80,0xa9,0x9a,0x10,0x22,0xfa,0xcf,0xdb,0xaa,0x89,0x89,0x88,0x08,0x54,0x45,
+0x34,0x24,0x23,0x23,0x22,0x12,0x11,0x01,0x90,0xea,0xcd,0xcc,0xbb,0xbb,0xab,0xab,
+0xba,0x9a,0x09,0x11,0x23,0x33,0x44,0x44,0x44,0x43,0x32,0x23,0x12,0x11,0x88,0xba,
+0xce,0xbd,0xbd,0xcb,0xba,0xaa,0xaa,0x9a,0x99,0x00,0x42,0x43,0x44,0x43,0x53,0x33,
+0x43,0x22,0x21,0x01,0x81,0xa8,0xcc,0xcc,0xcc,0xbb,0xbc,0xab,0xab,0x9b,0x9a,0x08,
+0x20,0x45,0x44,0x44,0x33,0x43,0x32,0x33,0x32,0x11,0x01,0x99,0xbb,0xcd,0xcc,0xcb,
+0xbc,0xbb,0xbb,0xbb,0xaa,0x89,0x10,0x44,0x45,0x35,0x34,0x43,0x33,0x22,0x13,0x12,
+0x01,0x98,0xba,0xcb,0xdb,0xbc,0xbd,0xad,0xbb,0xab,0xaa,0x99,0x08,0x41,0x55,0x34,
+0x35,0x33,0x43,0x32,0x22,0x22,0x00,0x98,0xb9,0xcb,0xdb,0xbc,0xbd,0xcc,0xba,0xba,
+0xa9,0x99,0x88,0x11,0x44,0x45,0x43,0x34,0x42,0x22,0x22,0x21,0x01,0x80,0x99,0xcb,
+0xcc,0xbc,0xbd,0xcb,0xbb,0xbb,0xbb,0x9a,0x09,0x20,0x43,0x35,0x45,0x43,0x43,0x32,
+0x33,0x22,0x12,0x01,0x98,0xcb,0xbe,0xcd,0xcb,0xac,0xbb,0xba,0xba,0xa9,0x88,0x10,
+0x22,0x44,0x43,0x44,0x53,0x42,0x22,0x12,0x12,0x10,0x80,0xa9,0xcd,0xcd,0xdb,0xba,
+0xbb,0xab,0xab,0xab,0x89,0x18,0x32,0x43,0x33,0x45,0x44,0x53,0x23,0x23,0x12,0x11,
+0x01,0xa8,0xfb,0xdc,0xcb,0xbb,0xbc,0xab,0xab,0xab,0x99,0x08,0x21,0x63,0x53,0x43,
+0x34,0x43,0x33,0x33,0x23,0x12,0x81,0x98,0xbb,0xce,0xdb,0xdb,0xbb,0xcb,0xab,0xab,
+0xa9,0x89,0x10,0x63,0x44,0x44,0x43,0x23,0x33,0x33,0x32,0x12,0x01,0x98,0xba,0xbb,
+0xbc,0xcd,0xbd,0xbd,0xbb,0xbb,0xaa,0x99,0x88,0x41,0x56,0x34,0x35,0x33,0x43,0x22,
+0x12,0x12,0x01,0x90,0xa9,0xcb,0xbc,0xbd,0xbd,0xbc,0xbb,0xac,0x9a,0x99,0x08,0x20,
+0x53,0x35,0x35,0x34,0x43,0x23,0x23,0x22,0x11,0x00,0xa9,0xcc,0xdc,0xcb,0xbc,0xbb,
+0xac,0xbb,0xaa,0x9a,0x09,0x10,0x43,0x53,0x53,0x43,0x43,0x33,0x24,0x12,0x11,0x00,
+0x88,0xca,0xdd,0xcc,0xcb,0xba,0xab,0xbb,0xba,0xab,0x88,0x21,0x22,0x01,0x08,0x51,
+0x46,0x44,0x23,0x33,0x22,0x11,0x98,0xaa,0x8a,0x00,0xa1,0xfe,0xcc,0xcb,0xaa,0x89,
+0x99,0x88,0x31,0x47,0x35,0x34,0x24,0x22,0x23,0x21,0x21,0x10,0x00,0x98,0xdc,0xcd,
+0xcc,0xba,0xab,0xaa,0xaa,0x9b,0x8a,0x08,0x21,0x22,0x43,0x44,0x53,0x34,0x43,0x23,
+0x22,0x11,0x01,0x98,0xdb,0xdc,0xbc,0xcc,0xba,0xab,0xbb,0xaa,0x9a,0x09,0x11,0x43,
+0x44,0x53,0x53,0x33,0x34,0x23,0x23,0x11,0x11,0x90,0xc9,0xcc,0xbd,0xbd,0xcb,0xbb,
+0xbb,0xbb,0xaa,0x99,0x10,0x42,0x54,0x34,0x35,0x34,0x33,0x24,0x22,0x12,0x11,0x88,
+0x99,0xcb,0xcc,0xdb,0xcb,0xcb,0xab,0xbb,0xaa,0x89,0x09,0x21,0x54,0x54,0x53,0x33,
+0x33,0x24,0x32,0x22,0x11,0x80,0x99,0xba,0xbc,0xcc,0xcc,0xbc,0xac,0xab,0xaa,0xa9,
+0x88,0x10,0x53,0x45,0x34,0x34,0x43,0x32,0x22,0x22,0x32,0x12,0x02,0x01,0x00,0x80,
+0xa9,0xce,0xcd,0xbc,0xbc,0xac,0xac,0xba,0xaa,0xaa,0x9a,0x8a,0x09,0x21,0x34,0x35,
+0x34,0x35,0x35,0x34,0x34,0x33,0x33,0x33,0x23,0x23,0x11,0x80,0xba,0xcd,0xcc,0xcb,
+0xbc,0xbd,0xbc,0xac,0xbb,0xba,0xba,0xbb,0xba,0x99,0x09,0x11,0x43,0x44,0x54,0x53,
+0x33,0x35,0x33,0x24,0x23,0x12,0x11,0x88,0xa8,0xa9,0xcb,0xdb,0xcb,0xcc,0xcb,0xbc,
+0xbc,0xbc,0xbc,0xbb,0xba,0xaa,0x9a,0x8a,0x09,0x32,0x35,0x25,0x22,0x22,0x44,0x54,
+0x43,0x33,0x23,0x22,0x23,0x23,0x02,0xca,0xbd,0xbd,0xbb,0xcc,0xcb,0xbc,0xbc,0xbb,
+0xba,0xbb,0xac,0xbb,0xaa,0x89,0x20,0x43,0x35,0x44,0x43,0x53,0x53,0x42,0x32,0x33,
+0x32,0x23,0x22,0x11,0x01,0x98,0xbb,0xbe,0xdb,0xca,0xbb,0xcd,0xcb,0xcb,0xba,0x9a,
+0xaa,0xab,0x99,0x20,0x55,0x44,0x23,0x33,0x33,0x35,0x35,0x43,0x22,0x23,0x32,0x53,
+0x33,0x33,0x02,0x88,0xba,0xcb,0xcc,0xcc,0xcc,0xbb,0xbb,0xab,0xbb,0xcb,0xcb,0xaa,
+0x8a,0x18,0x22,0x34,0x45,0x53,0x34,0x34,0x34,0x33,0x33,0x32,0x32,0x22,0x22,0x02,
+0xa9,0xcd,0xdb,0xcb,0xcb,0xdb,0xbc,0xdb,0xba,0xaa,0xbb,0xca,0xbb,0xba,0x9a,0x18,
+0x32,0x53,0x43,0x34,0x36,0x44,0x23,0x22,0x01,0x10,0x21,0x33,0x13,0x90,0xaa,0xab,
+0xec,0xed,0xcc,0xbc,0xbc,0xaa,0xab,0xba,0xaa,0xaa,0xba,0xaa,0x18,0x55,0x45,0x33,
+0x33,0x33,0x34,0x44,0x33,0x33,0x22,0x43,0x34,0x35,0x23,0x11,0x88,0x99,0xba,0xcc,
+0xcb,0xcb,0xcc,0xdb,0xcb,0xbb,0xbb,0x9a,0x9a,0x89,0x89,0x20,0x43,0x43,0x32,0x32,
+0x54,0x53,0x43,0x33,0x23,0x23,0x23,0x33,0x12,0xa8,0xcd,0xcc,0xbb,0xbc,0xcc,0xcb,
+0xbc,0xbb,0xac,0xba,0xaa,0xab,0xbb,0x9a,0x18,0x42,0x53,0x53,0x43,0x44,0x43,0x33,
+0x34,0x33,0x23,0x23,0x23,0x13,0x12,0x88,0xcb,0xcc,0xbc,0xcc,0xcb,0xbc,0xbd,0xbb,
+0xac,0xaa,0xaa,0xaa,0x8a,0x08,0x32,0x36,0x34,0x34,0x34,0x35,0x34,0x34,0x33,0x33,
+0x33,0x34,0x43,0x22,0x12,0x90,0xb9,0xcb,0xbc,0xcd,0xbd,0xbc,0xbb,0xab,0x9a,0xa9,
+0xbb,0xbc,0x9a,0x18,0x32,0x53,0x44,0x54,0x53,0x34,0x33,0x24,0x23,0x32,0x32,0x23,
+0x12,0x02,0x01,0x00,0x88,0xda,0xdc,0xbd,0xcd,0xbb,0xbc,0xba,0xac,0xaa,0xaa,0x99,
+0x88,0x18,0x21,0x34,0x45,0x53,0x33,0x35,0x34,0x34,0x23,0x33,0x23,0x22,0x22,0x01,
+0xa8,0xdb,0xbc,0xbd,0xcc,0xdb,0xcb,0xcb,0xba,0xab,0xbb,0xcb,0xaa,0xa9,0x89,0x88,
+0x11,0x43,0x35,0x45,0x43,0x34,0x53,0x32,0x33,0x32,0x21,0x00,0x90,0x98,0xba,0xcb,
+0xcc,0xcc,0xcb,0xbc,0xbc,0xcc,0xbb,0xac,0xbb,0xaa,0x9a,0x9a,0x8a,0x10,0x43,0x34,
+0x24,0x22,0x43,0x45,0x53,0x33,0x24,0x22,0x22,0x23,0x12,0x00,0xca,0xdc,0xcb,0xbb,
+0xdb,0xbb,0xbd,0xbc,0xbb,0xbb,0xab,0xbb,0xac,0x9b,0x09,0x31,0x35,0x44,0x33,0x45,
+0x53,0x43,0x42,0x22,0x23,0x23,0x32,0x12,0x02,0x81,0xa8,0xbc,0xbd,0xbc,0xcb,0xcc,
+0xcb,0xbc,0xbb,0xbb,0xbb,0xba,0xbb,0x89,0x52,0x36,0x35,0x33,0x43,0x43,0x53,0x33,
+0x24,0x23,0x22,0x43,0x43,0x33,0x22,0x81,0x98,0xba,0xbc,0xcd,0xcc,0xbc,0xbb,0xac,
+0xba,0xaa,0xbb,0xbb,0xab,0x89,0x11,0x34,0x44,0x44,0x44,0x34,0x34,0x43,0x23,0x23,
+0x22,0x22,0x22,0x12,0x00,0xc9,0xdb,0xbc,0xbc,0xbc,0xbd,0xbd,0xcb,0xba,0xab,0xbb,
+0xcb,0xbb,0xbb,0x89,0x10,0x43,0x53,0x43,0x44,0x53,0x33,0x33,0x23,0x11,0x21,0x43,
+0x33,0x02,0xa9,0xba,0xcb,0xec,0xdd,0xcc,0xdb,0xba,0xaa,0xba,0xa9,0xaa,0xab,0xaa,
+0x9a,0x41,0x55,0x34,0x24,0x22,0x23,0x34,0x44,0x32,0x22,0x22,0x43,0x44,0x32,0x22,
+0x01,0x98,0xa9,0xcb,0xcb,0xbc,0xbd,0xcc,0xcc,0xca,0xaa,0xa9,0x99,0x98,0x89,0x08,
+0x11,0x33,0x34,0x32,0x34,0x35,0x35,0x34,0x33,0x33,0x33,0x33,0x32,0x01,0xca,0xcd,
+0xdb,0xba,0xbc,0xbc,0xbd,0xbc,0xbb,0xbb,0xbb,0xac,0xbb,0xba,0x09,0x20,0x44,0x43,
+0x43,0x44,0x34,0x34,0x34,0x33,0x23,0x33,0x33,0x32,0x13,0x01,0xa9,0xcc,0xcc,0xcb,
+0xdb,0xdb,0xcb,0xcb,0xab,0xbb,0xaa,0xab,0xaa,0x9a,0x18,0x53,0x44,0x43,0x43,0x34,
+0x34,0x25,0x43,0x22,0x23,0x32,0x33,0x43,0x32,0x01,0x99,0xbb,0xbd,0xcc,0xcc,0xbc,
+0xad,0xaa,0x9a,0xa9,0xa9,0xbb,0xba,0x09,0x20,0x43,0x53,0x44,0x44,0x44,0x43,0x23,
+0x24,0x22,0x22,0x22,0x12,0x12,0x01,0x10,0x80,0x98,0xeb,0xcd,0xcc,0xbc,0xbb,0xbc,
+0xcb,0xba,0xba,0x9a,0x99,0x08,0x20,0x32,0x45,0x53,0x43,0x34,0x34,0x34,0x34,0x23,
+0x33,0x22,0x22,0x11,0x80,0xa8,0xbc,0xbd,0xbd,0xbd,0xcc,0xac,0xac,0xab,0xab,0xab,
+0xcb,0xaa,0x99,0x88,0x01,0x21,0x43,0x54,0x34,0x35,0x34,0x34,0x33,0x43,0x12,0x11,
+0x00,0x98,0xa8,0xba,0xdb,0xbc,0xcc,0xcb,0xbc,0xcc,0xcb,0xbb,0xcb,0xba,0xaa,0x9a,
+0x9a,0x88,0x20,0x34,0x34,0x33,0x33,0x36,0x36,0x44,0x33,0x32,0x32,0x32,0x22,0x02,
+0xa0,0xcc,0xbd,0xdb,0xca,0xbb,0xbd,0xbc,0xcb,0xaa,0xab,0xba,0xba,0xab,0x9a,0x10,
+0x52,0x43,0x44,0x43,0x53,0x43,0x43,0x24,0x33,0x32,0x22,0x22,0x22,0x11,0x88,0xca,
+0xcb,0xcb,0xdb,0xcb,0xbc,0xbd,0xbb,0xbc,0xaa,0xab,0xaa,0xaa,0x18,0x53,0x45,0x34,
+0x33,0x43,0x53,0x33,0x35,0x32,0x32,0x32,0x53,0x33,0x24,0x11,0x88,0xa9,0xaa,0xbc,
+0xcd,0xcc,0xcb,0xbb,0xbb,0xab,0xbb,0xac,0xbb,0x9a,0x09,0x22,0x53,0x53,0x35,0x35,
+0x44,0x32,0x24,0x32,0x22,0x32,0x12,0x22,0x01,0x90,0xca,0xcc,0xdb,0xbb,0xdc,0xcb,
+0xcb,0xbb,0xbb,0xbb,0xbc,0xbb,0xbb,0xaa,0x09,0x21,0x34,0x45,0x53,0x53,0x43,0x33,
+0x23,0x22,0x21,0x31,0x34,0x22,0x81,0xa9,0xab,0xcc,0xed,0xcc,0xbd,0xcb,0xba,0xab,
+0xab,0xab,0xab,0xba,0xaa,0x0a,0x62,0x45,0x34,0x24,0x22,0x32,0x34,0x35,0x23,0x23,
+0x22,0x34,0x44,0x23,0x12,0x00,0x99,0xba,0xdb,0xcb,0xbc,0xbd,0xbd,0xbc,0xbc,0xba,
+0xaa,0x99,0x99,0x89,0x10,0x31,0x35,0x33,0x43,0x53,0x53,0x43,0x43,0x22,0x23,0x22,
+0x22,0x21,0x80,0xca,0xcc,0xbc,0xcb,0xbc,0xcc,0xcb,0xbb,0xbb,0xcb,0xba,0xba,0xbb,
+0x9a,0x09,0x32,0x34,0x45,0x53,0x53,0x43,0x43,0x33,0x33,0x43,0x22,0x22,0x22,0x12,
+0x90,0xb9,0xcc,0xbc,0xbc,0xcd,0xcb,0xbc,0xbb,0xac,0xba,0xaa,0xab,0xaa,0x89,0x21,
+0x44,0x44,0x33,0x35,0x34,0x44,0x33,0x34,0x23,0x23,0x33,0x34,0x33,0x22,0x81,0xa9,
+0xcb,0xdc,0xdb,0xbc,0xcc,0xba,0xaa,0xaa,0xaa,0xbb,0xbb,0xab,0x09,0x31,0x35,0x54,
+0x53,0x44,0x53,0x33,0x43,0x32,0x32,0x22,0x23,0x13,0x12,0x11,0x00,0x80,0xca,0xcd,
+0xcd,0xbc,0xbc,0xbc,0xbb,0xbc,0xba,0xaa,0xaa,0x89,0x00,0x21,0x53,0x43,0x35,0x44,
+0x43,0x34,0x43,0x33,0x32,0x23,0x23,0x22,0x01,0x88,0xba,0xcc,0xcc,0xdb,0xbc,0xbd,
+0xcb,0xbb,0xcb,0xba,0xab,0xab,0xab,0x9a,0x88,0x21,0x43,0x35,0x44,0x44,0x34,0x34,
+0x24,0x23,0x23,0x12,0x11,0x00,0x98,0xa9,0xcb,0xcc,0xcb,0xbc,0xcc,0xcb,0xbc,0xbc,
+0xac,0xab,0xaa,0xaa,0xa9,0x99,0x08,0x31,0x44,0x33,0x24,0x43,0x44,0x53,0x24,0x33,
+0x33,0x32,0x32,0x22,0x81,0xc9,0xbd,0xcc,0xbb,0xbc,0xcc,0xbc,0xbb,0xbc,0xbb,0xab,
+0xbb,0xbb,0xab,0x8a,0x21,0x63,0x53,0x43,0x44,0x43,0x44,0x33,0x33,0x24,0x23,0x22,
+0x23,0x12,0x81,0x98,0xcb,0xbc,0xbc,0xcc,0xdb,0xdb,0xbb,0xcb,0xba,0xaa,0xba,0xab,
+0x9a,0x28,0x54,0x44,0x33,0x43,0x34,0x53,0x33,0x24,0x33,0x33,0x43,0x33,0x34,0x22,
+0x81,0x98,0xaa,0xcb,0xdc,0xeb,0xcb,0xcb,0xab,0xab,0xab,0xbb,0xac,0x9b,0x8a,0x10,
+0x31,0x44,0x34,0x45,0x53,0x43,0x33,0x33,0x24,0x23,0x32,0x22,0x12,0x81,0x98,0xcb,
+0xbc,0xcd,0xdb,0xcb,0xbc,0xcb,0xba,0xac,0xba,0xbb,0xab,0xab,0x9a,0x18,0x32,0x36,
+0x34,0x44,0x44,0x33,0x34,0x33,0x22,0x21,0x32,0x33,0x23,0x80,0xb9,0xdb,0xcc,0xdd,
+0xcc,0xbc,0xbc,0xab,0xbb,0xba,0xab,0xab,0xbb,0xaa,0x18,0x64,0x44,0x24,0x33,0x32,
+0x34,0x35,0x24,0x33,0x22,0x33,0x53,0x43,0x22,0x01,0x88,0xa9,0xbb,0xcc,0xbc,0xbd,
+0xcc,0xcb,0xbc,0xab,0xbb,0xaa,0x9a,0x99,0x08,0x30,0x43,0x43,0x33,0x44,0x44,0x43,
+0x34,0x32,0x33,0x23,0x33,0x22,0x12,0xa0,0xdb,0xbd,0xcc,0xbb,0xbd,0xcc,0xcb,0xba,
+0xbb,0xbb,0xbb,0xcb,0xaa,0x8a,0x08,0x42,0x43,0x34,0x45,0x43,0x53,0x33,0x33,0x24,
+0x23,0x23,0x32,0x22,0x01,0x98,0xca,0xbc,0xcc,0xbc,0xbd,0xcc,0xcb,0xba,0xab,0xbb,
+0xab,0xbb,0xaa,0x08,0x41,0x44,0x43,0x34,0x34,0x44,0x43,0x24,0x23,0x33,0x32,0x33,
+0x34,0x32,0x11,0x98,0xca,0xcb,0xdb,0xcc,0xdb,0xcb,0xab,0xab,0xaa,0xba,0xbb,0xab,
+0x9b,0x18,0x32,0x45,0x53,0x54,0x43,0x34,0x34,0x33,0x32,0x33,0x33,0x33,0x23,0x12,
+0x01,0x80,0xb9,0xcd,0xcd,0xcc,0xbc,0xbc,0xdb,0xba,0xba,0xaa,0xaa,0xa9,0x89,0x18,
+0x22,0x35,0x35,0x34,0x35,0x35,0x43,0x43,0x22,0x23,0x23,0x22,0x12,0x81,0x98,0xba,
+0xbd,0xbd,0xcc,0xcc,0xcb,0xac,0xbb,0xcb,0xaa,0xaa,0xba,0x9a,0x99,0x00,0x21,0x34,
+0x36,0x44,0x34,0x34,0x34,0x24,0x33,0x22,0x22,0x11,0x80,0x88,0xb9,0xdb,0xbc,0xcc,
+0xdb,0xcb,0xcb,0xbc,0xcb,0xbb,0xba,0xbb,0xaa,0x9a,0x89,0x21,0x42,0x34,0x34,0x53,
+0x43,0x44,0x53,0x32,0x33,0x23,0x23,0x32,0x21,0x90,0xca,0xcd,0xbb,0xbd,0xcb,0xbc,
+0xbd,0xbb,0xac,0xab,0xba,0xba,0xac,0xa9,0x08,0x22,0x34,0x35,0x34,0x35,0x44,0x43,
+0x33,0x33,0x43,0x22,0x23,0x21,0x01,0x90,0xa9,0xcb,0xcc,0xdb,0xbb,0xcd,0xbb,0xbc,
+0xbb,0xac,0xba,0xba,0xaa,0x0a,0x31,0x46,0x34,0x43,0x33,0x34,0x44,0x43,0x23,0x33,
+0x32,0x43,0x33,0x24,0x12,0x00,0x99,0x98,0x98,0x80,0x89,0x89,0x00,0x32,0x24,0x11,
+0x89,0x9a,0xaa,0xba,0xcd,0xbb,0xab,0x09,0x10,0x10,0x00,0x08,0xb9,0xef,0xbc,0xad,
+0x8a,0x08,0x99,0xcd,0xcc,0xab,0x9a,0x08,0x99,0xca,0xba,0x99,0x9a,0xce,0xce,0xcb,
+0xbb,0xab,0xaa,0x99,0x98,0x98,0x10,0x10,0xe9,0xee,0xbd,0xbc,0x9b,0x89,0x88,0xa8,
+0x9a,0x09,0x43,0xa1,0xff,0xcd,0xbb,0xaa,0x8a,0x09,0x08,0x88,0x98,0x98,0x18,0x65,
+0x45,0x34,0x22,0x01,0x08,0x08,0x11,0x80,0xb9,0x8a,0x72,0x36,0x25,0x13,0x11,0x00,
+0x80,0x80,0x00,0x08,0x98,0xec,0xcd,0xbc,0xac,0x9a,0x98,0x90,0x88,0x99,0x80,0x01,
+0xa8,0xfb,0xbc,0xac,0x9a,0x88,0x88,0x98,0x98,0x88,0x11,0xa8,0xcf,0xbd,0xab,0x9a,
+0x08,0x88,0x99,0xa9,0x08,0x21,0x11,0xba,0xcf,0xbb,0xab,0x89,0x10,0x98,0xca,0xcb,
+0x99,0x10,0xb9,0xef,0xcb,0x9a,0x89,0x00,0x80,0x88,0x08,0x00,0x88,0x31,0x77,0x35,
+0x24,0x01,0x88,0x08,0x32,0x12,0xb0,0xbc,0x1a,0x47,0x44,0x22,0x01,0x80,0x88,0x00,
+0x80,0x88,0x09,0x72,0x56,0x44,0x33,0x13,0x81,0x89,0x09,0x80,0xa0,0xbb,0x58,0x67,
+0x34,0x34,0x21,0x00,0x88,0x00,0x80,0x99,0x9a,0x30,0x47,0x35,0x23,0x22,0x10,0x08,
+0x08,0x88,0x99,0xbb,0x09,0x74,0x54,0x23,0x23,0x00,0x80,0x08,0x80,0xb9,0xcb,0x9b,
+0x41,0x45,0x24,0x11,0x98,0xa9,0xba,0xba,0xbc,0xbb,0x8a,0x42,0x35,0x33,0x01,0x88,
+0x08,0x80,0xcb,0xcf,0xac,0xbb,0xda,0xdb,0xcc,0xbb,0xab,0x9a,0xaa,0xcb,0xab,0x09,
+0x01,0xd9,0xdf,0xbc,0xab,0x8a,0x00,0x80,0xaa,0xbb,0x09,0x11,0xf9,0xcf,0xcd,0xab,
+0xaa,0x88,0x81,0x80,0x9a,0x8a,0x18,0x90,0xfc,0xce,0xbb,0xab,0x8a,0x80,0x88,0x9a,
+0x8a,0x11,0xa8,0xff,0xbd,0xcc,0x9a,0x99,0x80,0x00,0x88,0x88,0x00,0x00,0xb8,0xdd,
+0xbc,0xac,0x9a,0x00,0x10,0x01,0x80,0x80,0x00,0x80,0xda,0xdc,0xbb,0x8a,0x28,0x22,
+0x13,0x00,0x09,0x30,0x47,0x45,0x34,0x34,0x12,0x81,0x08,0x10,0x31,0x22,0x12,0x55,
+0x46,0x35,0x24,0x11,0x81,0x10,0x21,0x22,0x90,0xaa,0x60,0x57,0x44,0x32,0x11,0x01,
+0x00,0x11,0x10,0xa8,0x9a,0x38,0x77,0x43,0x33,0x12,0x80,0x80,0x08,0x00,0x98,0x9a,
+0x0a,0x51,0x44,0x24,0x12,0x00,0x80,0x80,0x90,0xa8,0xba,0x8a,0x32,0x37,0x34,0x21,
+0x00,0xb9,0xda,0xaa,0x99,0x88,0xe9,0xec,0xbc,0xac,0x9a,0x99,0x99,0xcb,0xaa,0x88,
+0x12,0xd9,0xdf,0xdc,0xab,0xbb,0x9a,0x89,0x89,0x99,0x89,0x08,0x12,0xd0,0xef,0xcc,
+0xbb,0x9b,0x88,0x00,0x98,0x98,0x20,0x23,0xf0,0xcf,0xbd,0xbc,0xa9,0x98,0x00,0x08,
+0x80,0x80,0x88,0x20,0x57,0x44,0x24,0x13,0x01,0x08,0x10,0x11,0x80,0xa9,0x19,0x56,
+0x44,0x33,0x23,0x11,0x01,0x00,0x80,0x80,0x10,0xa8,0xde,0xce,0xbb,0xac,0x89,0x09,
+0x88,0x89,0x08,0x10,0x01,0xb9,0xcd,0xbc,0xbb,0x9a,0x09,0x80,0x80,0x88,0x08,0x10,
+0xa8,0xee,0xcc,0xbb,0xaa,0x88,0x80,0x80,0x10,0x23,0x13,0xc9,0xcd,0xbb,0x89,0x00,
+0x80,0x98,0x90,0x11,0x10,0x88,0xa8,0xc9,0xcf,0xbe,0xbc,0x9a,0x88,0x10,0x33,0x44,
+0x25,0x24,0x32,0x44,0x36,0x33,0x13,0x88,0x88,0x31,0x35,0x01,0xa8,0x20,0x67,0x43,
+0x23,0x81,0x88,0x11,0x32,0x03,0x98,0x18,0x77,0x34,0x35,0x22,0x11,0x01,0x11,0x00,
+0x90,0xa9,0x29,0x67,0x54,0x33,0x33,0x02,0x80,0x08,0x11,0x01,0xa0,0xab,0x48,0x67,
+0x53,0x32,0x11,0x00,0x80,0x00,0x80,0xa9,0xab,0x30,0x57,0x34,0x33,0x11,0x88,0x88,
+0x08,0x98,0xb9,0x9b,0x28,0x46,0x24,0x12,0x88,0x09,0x00,0x02,0xb9,0xbf,0xbc,0x89,
+0x43,0x45,0x33,0x13,0xa0,0xcb,0xbb,0x8a,0x10,0x91,0xfb,0xcd,0xcb,0xab,0xaa,0xaa,
+0xbb,0xba,0x9a,0x08,0x88,0xec,0xcd,0xbc,0xac,0x9a,0x98,0xaa,0xcb,0x9a,0x28,0x43,
+0x92,0xee,0xcc,0xbc,0xab,0x9b,0x99,0x89,0x89,0x08,0x21,0x81,0xfc,0xcd,0xcc,0xaa,
+0x9a,0x98,0x88,0x89,0x18,0x33,0x13,0xfb,0xdf,0xbb,0xac,0x99,0x89,0x80,0x08,0x08,
+0x80,0x80,0xa9,0xcc,0xbc,0xbc,0xab,0x9a,0x88,0x80,0x80,0x21,0x35,0x24,0x98,0xbf,
+0xac,0x09,0x31,0x32,0x90,0x89,0x31,0x37,0x24,0x11,0x31,0x56,0x43,0x22,0x80,0x08,
+0x10,0x23,0x22,0x28,0x74,0x46,0x34,0x23,0x01,0x00,0x10,0x13,0x82,0xba,0x0b,0x76,
+0x55,0x33,0x23,0x12,0x00,0x10,0x11,0x80,0xb9,0x8a,0x72,0x46,0x34,0x33,0x12,0x81,
+0x80,0x88,0x80,0x00,0x88,0x18,0x62,0x44,0x34,0x22,0x00,0x88,0x08,0x08,0xa8,0xcb,
+0x9a,0x32,0x37,0x14,0x11,0x88,0x80,0xb9,0xeb,0x9b,0x19,0x23,0xe8,0xde,0xbc,0x9a,
+0x08,0x00,0xa8,0xba,0x8b,0x11,0xa2,0xef,0xcc,0xcb,0x9a,0x99,0x88,0x99,0x99,0x99,
+0x00,0xa0,0xff,0xdc,0xcb,0xaa,0x89,0x08,0x99,0xaa,0x09,0x42,0x02,0xfc,0xbf,0xbc,
+0xab,0x89,0x88,0x90,0x08,0x08,0x08,0x88,0x51,0x57,0x34,0x24,0x12,0x08,0x08,0x11,
+0x01,0x98,0x9a,0x31,0x57,0x24,0x23,0x11,0x10,0x01,0x00,0x98,0x88,0x18,0xa8,0xdf,
+0xcd,0xbb,0x9b,0x89,0x08,0x89,0x99,0x08,0x22,0x81,0xfb,0xcc,0xab,0xaa,0x08,0x08,
+0x99,0x99,0x08,0x22,0x12,0xe9,0xcd,0xbc,0xab,0x09,0x10,0x00,0x88,0x99,0x00,0x12,
+0x82,0xdb,0xad,0x9b,0x09,0x80,0xa8,0x00,0x55,0x44,0x01,0xca,0xbd,0xab,0x09,0x00,
+0x99,0x99,0x30,0x36,0x34,0x12,0x44,0x46,0x34,0x24,0x12,0x10,0x10,0x22,0x11,0x80,
+0x19,0x62,0x45,0x43,0x32,0x11,0x01,0x00,0x00,0x88,0x98,0x28,0x57,0x46,0x53,0x32,
+0x12,0x01,0x08,0x88,0x08,0x00,0x10,0x53,0x46,0x35,0x35,0x32,0x11,0x80,0x88,0x88,
+0x00,0x88,0x18,0x73,0x45,0x24,0x13,0x02,0x11,0x11,0x01,0xaa,0xad,0x09,0x73,0x44,
+0x22,0x12,0x00,0x88,0x80,0x88,0x00,0x00,0x90,0x9a,0x38,0x77,0x43,0x12,0x98,0xbb,
+0x9a,0x09,0x80,0x99,0x0a,0x52,0x35,0x22,0x00,0x01,0x12,0xb8,0xcf,0xbb,0x8a,0x00,
+0xea,0xdd,0xcb,0xaa,0x9a,0xa9,0xaa,0xaa,0x88,0x80,0xfa,0xcc,0xcc,0xbb,0xaa,0x09,
+0x00,0x98,0xac,0x9d,0x08,0x81,0xfa,0xcf,0xbb,0xab,0x09,0x00,0x90,0xba,0x9b,0x10,
+0x01,0xed,0xce,0xcb,0xaa,0x99,0x00,0x08,0x88,0x08,0x11,0x81,0xfc,0xce,0xac,0xab,
+0x8a,0x08,0x88,0x98,0x89,0x11,0x12,0xc9,0xce,0xcb,0x9a,0x99,0x98,0x98,0x10,0x42,
+0x12,0x90,0xbc,0x9d,0x9a,0xa9,0xaa,0x8b,0x50,0x54,0x12,0x80,0x9a,0x28,0x56,0x35,
+0x33,0x12,0x80,0x08,0x22,0x23,0x03,0x88,0x61,0x57,0x35,0x43,0x11,0x00,0x08,0x12,
+0x13,0x80,0xaa,0x40,0x77,0x53,0x32,0x12,0x01,0x00,0x10,0x10,0x00,0x89,0x19,0x74,
+0x44,0x34,0x33,0x12,0x00,0x80,0x08,0x80,0x98,0x09,0x51,0x54,0x43,0x12,0x80,0x88,
+0x18,0x10,0x91,0xca,0xbb,0x8a,0x53,0x35,0x33,0x82,0xb9,0xbd,0x9b,0x28,0x43,0x91,
+0xfc,0xbc,0xac,0x99,0x99,0xaa,0xbb,0x8b,0x30,0x33,0x90,0xff,0xbd,0xcc,0xab,0x9a,
+0x08,0x01,0xa8,0xbb,0x8b,0x30,0xa2,0xff,0xcf,0xab,0x9a,0x08,0x00,0x99,0xab,0x08,
+0x32,0xb1,0xff,0xbe,0xbb,0xba,0x99,0x89,0x08,0x00,0x80,0x80,0x28,0x66,0x45,0x34,
+0x13,0x11,0x88,0x00,0x11,0x81,0xa8,0x89,0x64,0x45,0x43,0x12,0x11,0x10,0x80,0x80,
+0x88,0x09,0x88,0xd9,0xde,0xbc,0xac,0xaa,0x88,0x80,0x98,0x89,0x08,0x01,0xa8,0xdd,
+0xbc,0xab,0x99,0x80,0x08,0x89,0x00,0x21,0x80,0xea,0xbb,0x9c,0x99,0x00,0x08,0x10,
+0x32,0x25,0x13,0x01,0x08,0x88,0xda,0xbd,0xbc,0x8a,0x08,0x10,0x00,0x44,0x27,0x13,
+0xd9,0xbd,0x9d,0x19,0x31,0x22,0x01,0x89,0x89,0x00,0x31,0x55,0x55,0x43,0x22,0x80,
+0x89,0x20,0x44,0x22,0xa8,0xac,0x19,0x46,0x43,0x02,0x80,0x09,0x32,0x53,0x01,0x99,
+0x09,0x64,0x45,0x33,0x33,0x11,0x01,0x88,0x08,0x08,0x00,0x21,0x56,0x45,0x34,0x24,
+0x22,0x11,0x11,0x22,0x01,0xb9,0x9c,0x40,0x57,0x34,0x32,0x12,0x80,0x80,0x80,0x80,
+0x80,0x08,0x18,0x31,0x65,0x34,0x34,0x12,0x90,0xa9,0x80,0x22,0x01,0xca,0x8b,0x61,
+0x34,0x23,0x01,0x08,0x21,0x91,0xed,0xbc,0x0a,0x42,0x34,0x11,0xa8,0x99,0x18,0x20,
+0x80,0x90,0x91,0xf9,0xdd,0xbc,0xac,0xba,0xca,0xab,0x9b,0x18,0x33,0x91,0xec,0xbc,
+0xbb,0xac,0xcc,0xba,0xab,0x09,0x18,0x80,0x81,0xc0,0xfc,0xdd,0xdb,0xab,0x9a,0x88,
+0x81,0x80,0x88,0x08,0x90,0xfa,0xdc,0xbc,0xac,0x99,0x00,0x00,0xa8,0xba,0x9b,0x10,
+0x91,0xfe,0xcd,0xcb,0xaa,0x89,0x08,0x00,0x88,0x80,0x01,0x80,0xda,0xcd,0xbb,0xac,
+0x99,0x08,0x10,0x80,0x88,0x88,0x00,0x11,0xa1,0xdc,0xbd,0xbb,0x08,0x32,0x82,0xc9,
+0xbb,0x70,0x46,0x44,0x22,0x01,0x80,0x08,0x21,0x43,0x12,0x80,0x38,0x74,0x45,0x33,
+0x22,0x12,0x21,0x42,0x33,0x81,0xeb,0x9b,0x40,0x57,0x34,0x23,0x12,0x01,0x18,0x11,
+0x21,0x80,0x89,0x28,0x66,0x44,0x43,0x12,0x02,0x80,0x80,0x00,0x08,0x99,0x88,0x42,
+0x36,0x34,0x22,0x02,0x10,0x88,0xba,0xbd,0xcb,0x08,0x43,0x34,0x12,0x91,0x90,0x90,
+0x80,0x80,0x10,0x21,0xa0,0xfe,0xdb,0xbc,0xca,0xbb,0xbb,0xbb,0xaa,0x00,0x12,0x02,
+0xda,0xdf,0xdc,0xba,0x9b,0x09,0x80,0xa9,0xbc,0x9a,0x00,0xe9,0xef,0xbc,0xac,0x89,
+0x00,0x80,0xa9,0x99,0x20,0x24,0xe8,0xde,0xbc,0xac,0x99,0x88,0x08,0x98,0x88,0x09,
+0x08,0x32,0x57,0x44,0x24,0x22,0x00,0x08,0x18,0x11,0x00,0x89,0x19,0x54,0x36,0x34,
+0x23,0x11,0x00,0x80,0x08,0x01,0x13,0x90,0xef,0xcc,0xcb,0x9a,0x89,0x88,0x88,0x99,
+0x08,0x11,0x11,0xba,0xcf,0xcb,0xaa,0x89,0x88,0x80,0x80,0x80,0x00,0x00,0xb8,0xed,
+0xdb,0xbb,0x9a,0x09,0x08,0x08,0x09,0x32,0x35,0x03,0xd9,0xbd,0xac,0x89,0x18,0x08,
+0x98,0x08,0x01,0x82,0xe9,0xdc,0xbc,0xaa,0x9a,0x89,0x08,0x01,0x10,0x89,0x9a,0x41,
+0x77,0x35,0x43,0x12,0x81,0x90,0x10,0x44,0x35,0x24,0x13,0x11,0x12,0x33,0x25,0x23,
+0x12,0x00,0x80,0x90,0x89,0x50,0x66,0x53,0x33,0x11,0x08,0x18,0x31,0x34,0x02,0x98,
+0x29,0x56,0x35,0x24,0x23,0x11,0x11,0x00,0x98,0x98,0x00,0x54,0x44,0x34,0x34,0x33,
+0x23,0x00,0x98,0x08,0x10,0x80,0xa9,0x19,0x66,0x44,0x33,0x12,0x01,0x00,0x00,0x88,
+0xaa,0x09,0x54,0x45,0x32,0x12,0x80,0x99,0x8a,0x10,0x23,0x91,0xd9,0xaa,0x22,0x25,
+0x92,0xbd,0x9d,0x51,0x45,0x43,0x11,0x10,0x18,0x88,0xcb,0xbe,0xbb,0x9a,0x80,0xcb,
+0xbf,0xab,0x09,0x22,0x13,0xd9,0xbe,0xbd,0xaa,0x9a,0x8a,0x09,0x10,0x21,0xb9,0xff,
+0xbc,0xbc,0xaa,0x09,0x00,0x01,0x00,0x89,0x09,0xaa,0xed,0xcd,0xcb,0xbb,0xaa,0x88,
+0x88,0x08,0x08,0x10,0xa8,0xdf,0xbe,0xad,0xab,0x99,0x98,0x99,0xbb,0x99,0x30,0x43,
+0xa8,0xcf,0xbc,0x9a,0x00,0x11,0x80,0x99,0x09,0x21,0x22,0xc9,0xce,0xbb,0x9a,0x00,
+0x11,0x81,0x99,0x9a,0x31,0x77,0x34,0x24,0x03,0x81,0x08,0x31,0x36,0x33,0x82,0xca,
+0x9b,0x71,0x54,0x43,0x22,0x01,0x80,0x00,0x10,0x88,0xaa,0x0b,0x73,0x67,0x33,0x32,
+0x22,0x11,0x21,0x11,0x00,0x9a,0x8b,0x62,0x55,0x43,0x23,0x22,0x32,0x22,0x12,0xa8,
+0xdb,0xbb,0x09,0x52,0x44,0x33,0x22,0x80,0x99,0x09,0x20,0x12,0xb8,0xad,0x3a,0x75,
+0x33,0x13,0x00,0x18,0x10,0xa9,0xdf,0xab,0x8b,0x18,0xb8,0xce,0xbb,0x09,0x11,0xe9,
+0xcc,0x9b,0x30,0x43,0xa1,0xce,0xad,0x99,0x00,0x80,0xb9,0xcb,0x0a,0x30,0x32,0xb8,
+0xff,0xcb,0xac,0xaa,0x89,0x00,0x80,0x08,0x88,0x90,0xfa,0xde,0xdb,0xbb,0x9b,0x8a,
+0x08,0x00,0x00,0x88,0x9a,0x38,0x67,0x54,0x23,0x23,0x01,0x01,0x11,0x12,0x98,0xba,
+0x29,0x57,0x44,0x33,0x13,0x11,0x10,0x08,0x00,0x00,0x80,0xb9,0xdf,0xcc,0xac,0xaa,
+0x89,0x88,0x98,0xa9,0x99,0x00,0x11,0xa9,0xcf,0xbc,0xbb,0x89,0x00,0x01,0x80,0x98,
+0x00,0x98,0xcc,0xbd,0xac,0x9a,0xba,0xbc,0xab,0x38,0x46,0x13,0x90,0xbc,0xab,0x09,
+0x21,0x81,0xa0,0x98,0x00,0x10,0x19,0x03,0xb4,0xfc,0xdf,0xaa,0x08,0x10,0x11,0x99,
+0x99,0x00,0x12,0x88,0x31,0x77,0x27,0x13,0x01,0x89,0x10,0x53,0x23,0x82,0x89,0x40,
+0x54,0x23,0x91,0xca,0x89,0x42,0x35,0x12,0x80,0x88,0x42,0x54,0x43,0x22,0x01,0x00,
+0x09,0x09,0x88,0x18,0x10,0x44,0x57,0x63,0x33,0x23,0x12,0x01,0x00,0x08,0x98,0x08,
+0x72,0x54,0x33,0x02,0xb9,0xbb,0x9b,0x00,0xc8,0xec,0x9a,0x20,0x45,0x24,0x11,0x80,
+0x88,0x80,0x01,0x88,0x89,0x18,0x10,0x00,0x99,0x0a,0x30,0x12,0xb0,0xad,0x08,0x14,
+0x92,0xd0,0xa9,0x22,0x33,0x10,0x8e,0x3b,0x69,0x10,0xb8,0xbb,0x6a,0x71,0x01,0xeb,
+0xcd,0xcb,0x99,0x20,0x20,0x90,0xa9,0x1a,0x51,0x12,0xfa,0xbd,0xac,0x09,0x20,0x01,
+0x99,0x8b,0x38,0x34,0xa1,0xde,0xcc,0xa9,0x88,0x00,0x18,0x18,0x00,0xa8,0xcd,0xbe,
+0xbc,0xbc,0xab,0x88,0x33,0x27,0x12,0x81,0x81,0x11,0xb0,0xee,0xcc,0xab,0x09,0x21,
+0x11,0xa8,0x9b,0x28,0x24,0xa2,0xed,0xbb,0x9a,0x20,0x11,0x98,0xab,0x10,0x34,0x02,
+0xdc,0xbd,0xac,0xaa,0x89,0x00,0x22,0x12,0xba,0xbd,0x19,0x55,0x44,0x23,0x12,0x11,
+0x88,0xc9,0xb9,0x11,0x47,0x53,0x21,0x00,0x10,0x53,0x43,0x22,0x81,0x98,0x99,0xa9,
+0x29,0x75,0x45,0x25,0x33,0x11,0x88,0x88,0x00,0x10,0x88,0x9a,0x30,0x57,0x34,0x33,
+0x11,0x00,0x00,0x00,0x90,0xab,0x3a,0x74,0x35,0x33,0x00,0x99,0x1a,0x39,0x18,0x98,
+0x8a,0x11,0x13,0xc0,0xba,0x39,0x36,0xb3,0xfa,0x0b,0x78,0x23,0xc8,0xde,0xbb,0x99,
+0x80,0xb8,0xcd,0xac,0x99,0x10,0x11,0x00,0x89,0x98,0xfb,0xbd,0xad,0x89,0x31,0x13,
+0xc9,0xbe,0xac,0x88,0x02,0xa8,0xbe,0xae,0x9a,0x09,0x08,0x88,0x88,0x01,0xa8,0xff,
+0xcc,0xbb,0xab,0x8a,0x88,0x08,0x08,0x00,0x90,0xaa,0x48,0x77,0x44,0x32,0x11,0x80,
+0x80,0x10,0x80,0xb8,0x8a,0x71,0x45,0x33,0x22,0x11,0x20,0x31,0x12,0x00,0x89,0x08,
+0xa9,0xff,0xdb,0xbb,0xaa,0x9a,0x9a,0x9a,0x08,0x11,0x02,0xc9,0xbd,0xbd,0xba,0xab,
+0x9a,0x01,0x12,0x91,0xba,0x99,0x25,0x85,0xe9,0xbd,0xac,0x88,0x11,0x08,0x09,0x51,
+0x45,0x33,0x81,0xbc,0xad,0xaa,0x80,0x01,0x08,0x88,0x08,0x00,0x08,0x89,0x88,0x11,
+0x20,0x1a,0x8c,0x3b,0x52,0x12,0xc9,0xcd,0x00,0x67,0x25,0x23,0x81,0xa9,0x0a,0x30,
+0x12,0xc0,0xda,0x18,0x37,0x35,0x12,0x90,0x99,0x08,0x11,0x01,0xa9,0x9b,0x58,0x65,
+0x44,0x43,0x32,0x11,0x08,0x89,0x08,0x00,0x88,0x29,0x73,0x47,0x43,0x12,0x81,0x80,
+0x08,0x00,0x98,0xa9,0x41,0x46,0x24,0x02,0xa0,0x99,0x18,0x22,0x00,0xcb,0x9b,0x73,
+0x36,0x24,0x81,0xa0,0x98,0x00,0x02,0x80,0x99,0x1a,0x30,0x12,0xe9,0xa9,0x31,0x36,
+0xc1,0xcf,0xbd,0x9a,0x19,0x12,0x81,0x9a,0x1b,0x40,0x12,0xb9,0x9e,0x49,0x63,0x91,
+0xfd,0xcd,0xbb,0xab,0x9a,0x80,0x00,0x08,0x08,0x08,0x80,0x90,0x91,0x00,0x08,0x08,
+0x08,0x08,0x90,0x91,0x91,0x91,0xb3,0xb2,0x91,0x11,0x01,0xa1,0x19,0x5b,0x4b,0x1a,
+0x89,0x90,0x11,0x12,0x3b,0x1f,0x29,0x39,0x3a,0x8c,0x09,0x13,0x94,0xe1,0xa0,0x30,
+0x21,0xc3,0xab,0x2d,0x42,0x33,0x9f,0x9e,0x21,0x57,0x43,0x11,0x88,0x99,0x08,0x11,
+0x00,0x8a,0x1a,0x10,0x02,0xa8,0x0c,0x39,0x14,0x90,0x0f,0x3b,0x32,0xa3,0xea,0x0b,
+0x70,0x22,0xd8,0xda,0x28,0x46,0x34,0x12,0x88,0x10,0x64,0x33,0x11,0xa9,0x99,0x18,
+0x23,0x90,0xda,0x88,0x23,0x03,0xda,0xaa,0x51,0x43,0xb8,0xff,0xaa,0x9a,0x00,0x11,
+0x80,0x99,0x80,0x01,0x92,0xa0,0x99,0x11,0x03,0x19,0x0d,0x2a,0x31,0x10,0x0b,0x2c,
+0x5a,0x49,0x1b,0x1b,0x39,0x39,0xb2,0xb1,0x19,0x39,0x39,0x1a,0x0b,0x5b,0x29,0x2a,
+0x0b,0x1b,0x20,0x01,0xb1,0xb1,0x11,0x93,0x21,0x1d,0x89,0xa2,0x03,0xa1,0x99,0x19,
+0x93,0xa2,0x09,0x1b,0x21,0x11,0x99,0x9a,0x10,0x31,0x19,0x9a,0xa9,0x13,0x03,0xa9,
+0xb9,0x92,0x33,0x00,0xab,0x3c,0x49,0x02,0xc9,0xc9,0x82,0x15,0x92,0xeb,0x8a,0x71,
+0x32,0xc9,0xdf,0xcb,0x9a,0x08,0x11,0x00,0x98,0x89,0x28,0x20,0x08,0x8b,0x1b,0x11,
+0x95,0xb1,0xb9,0x11,0x13,0x93,0xb9,0xb9,0x13,0x41,0x2b,0x0d,0x29,0x39,0xa2,0xb3,
+0x1b,0x3a,0x11,0xb3,0xb1,0xb1,0x03,0x93,0x91,0x9a,0x09,0x93,0x93,0x1a,0x1b,0x29,
+0x21,0x3a,0x1d,0x2a,0x38,0x20,0x2b,0x2e,0x3a,0x29,0xb0,0xb1,0xa0,0x03,0x13,0x99,
+0xc9,0xa2,0x33,0x92,0xc0,0x90,0x59,0x49,0x1a,0xba,0x28,0x79,0x10,0xb9,0xc8,0x21,
+0x63,0x08,0xcc,0x8b,0x72,0x37,0x24,0x03,0x98,0xa8,0x80,0x11,0x92,0x98,0x0a,0x29,
+0x02,0xd3,0xb1,0xa1,0xa4,0x95,0xa1,0x99,0x38,0x5b,0x29,0x1c,0x2b,0xb1,0xa7,0xa2,
+0x90,0x80,0x30,0x19,0xa0,0x09,0x39,0x19,0xb2,0xc2,0x91,0x13,0x10,0x09,0x99,0x19,
+0x21,0x3a,0x2c,0x3b,0x29,0x29,0x99,0xb0,0x92,0x30,0x1a,0xa0,0xb2,0xb3,0xb5,0xb3,
+0xa1,0x01,0x39,0x2a,0x99,0x19,0x3a,0x19,0x91,0x90,0x19,0x19,0x91,0xb2,0x91,0x29,
+0x5b,0x3b,0x3c,0x2b,0xb0,0x94,0x90,0xa9,0x92,0x21,0x19,0x0b,0x09,0x30,0x5a,0x2b,
+0x1c,0x29,0x38,0x91,0xf1,0x91,0x30,0x39,0xba,0xfb,0x01,0x16,0xa2,0xfd,0xcc,0xaa,
+0x09,0x21,0x01,0xb8,0x9a,0x30,0x44,0x88,0xcf,0xbc,0x9a,0x18,0x01,0x81,0x99,0x19,
+0x28,0x00,0xc0,0xb1,0x02,0x03,0x88,0x1d,0x2b,0x83,0xa6,0xb8,0x1a,0x70,0x10,0x99,
+0x9c,0x10,0x26,0x80,0xae,0x8b,0x73,0x37,0x24,0x01,0x89,0x89,0x08,0x11,0x80,0x89,
+0x0a,0x01,0x02,0xa0,0xa9,0x93,0x13,0x03,0x2c,0x2d,0x29,0x00,0x1a,0x0b,0x00,0x12,
+0x4a,0x2c,0x3b,0x39,0x19,0x99,0xb0,0xb3,0x95,0x90,0x18,0x19,0x21,0x1a,0x0a,0x10,
+0x21,0x09,0xb9,0xa1,0x94,0x94,0xa9,0x0b,0x41,0x04,0xf1,0xba,0x48,0x67,0x53,0x12,
+0x90,0xa9,0x08,0x21,0x02,0xba,0xac,0x41,0x47,0x33,0x12,0x88,0x99,0x80,0x11,0x08,
+0xa9,0x91,0x01,0x01,0x98,0x99,0x39,0x39,0x0a,0xb9,0x92,0x21,0x91,0x0a,0x3a,0x29,
+0x10,0x1a,0x1b,0x39,0x11,0xa0,0xa9,0x20,0x31,0xa1,0xc0,0xa1,0x04,0x12,0xaa,0x1d,
+0x6b,0x38,0x90,0xbb,0x1c,0x73,0x23,0xf9,0xbf,0xbc,0x8a,0x18,0x02,0x91,0xa8,0x09,
+0x30,0x10,0xa8,0x9a,0x19,0x04,0xa3,0xb9,0x1d,0x59,0x28,0x1b,0xab,0xa2,0x15,0x91,
+0xa9,0xb9,0x03,0x05,0x19,0x1d,0x3b,0x49,0x18,0xaa,0x1b,0x6a,0x39,0x2b,0x8c,0x98,
+0x04,0x02,0xbb,0xab,0x02,0x97,0xb3,0x89,0x2b,0x32,0x33,0x8d,0x0d,0x10,0x05,0xa1,
+0xbb,0x1c,0x73,0x33,0xbd,0xef,0xba,0x89,0x18,0x11,0x90,0x98,0x19,0x28,0x10,0x0a,
+0x0b,0x00,0x03,0x91,0x9b,0x3b,0x5a,0x29,0x0b,0xb9,0x21,0x30,0x1a,0xb9,0x11,0x49,
+0x4b,0x0b,0x2a,0x01,0x93,0x90,0x9a,0xb2,0x33,0x3a,0x1d,0x09,0x01,0x92,0xb0,0x99,
+0x39,0x31,0x99,0x9b,0x1b,0x23,0x93,0xb9,0xaa,0x31,0x41,0x98,0xd9,0x90,0x13,0x13,
+0xb9,0x1e,0x5b,0x20,0xa1,0xb9,0x1d,0x50,0x41,0x8a,0xae,0x1a,0x74,0x34,0x24,0x02,
+0x90,0x99,0x88,0x01,0x02,0xa1,0xc8,0xa0,0x13,0x14,0xa1,0x9d,0x2d,0x50,0x21,0xb9,
+0xbe,0x29,0x57,0x43,0x01,0xca,0xac,0x8a,0x01,0x12,0x90,0xa9,0x08,0x21,0x11,0xa9,
+0xaa,0x02,0x85,0xb2,0x99,0x3b,0x7a,0x80,0xb0,0x09,0x59,0x39,0x99,0xf0,0xa2,0x83,
+0xa2,0xc0,0x91,0x32,0x21,0xbb,0xc9,0x03,0x33,0x1a,0x9d,0x29,0x41,0x00,0xdb,0x99,
+0x13,0x14,0xd8,0xb9,0x10,0x73,0x80,0xc9,0x09,0x40,0x21,0xc8,0xba,0x28,0x25,0xa3,
+0xf9,0x0a,0x40,0x32,0xa9,0x9f,0x29,0x42,0x81,0xf9,0x99,0x22,0x14,0xb8,0xdb,0x08,
+0x25,0x93,0xda,0x9b,0x51,0x33,0xc0,0xbd,0x19,0x36,0x83,0xec,0xac,0x09,0x43,0x12,
+0xc9,0xab,0x19,0x02,0xec,0xac,0x58,0x45,0xb1,0xff,0xbf,0xbb,0xac,0x9a,0xa9,0xbb,
+0xbc,0xac,0xaa,0x9a,0xba,0xbb,0xba,0x99,0x08,0x20,0x52,0x44,0x44,0x43,0x33,0x44,
+0x43,0x34,0x43,0x33,0x33,0x33,0x23,0x24,0x23,0x22,0x11,0x88,0xa9,0xdb,0xdb,0xcb,
+0xbc,0xcc,0xcb,0xbc,0xcb,0xbb,0xba,0xab,0xab,0xbb,0xaa,0x9b,0x08,0x32,0x37,0x35,
+0x43,0x34,0x53,0x53,0x43,0x43,0x23,0x33,0x24,0x32,0x32,0x22,0x23,0x21,0x00,0xa9,
+0xcc,0xbc,0xbc,0xbd,0xbd,0xbd,0xbc,0xbb,0xac,0xbb,0xbb,0xac,0xaa,0xaa,0xaa,0x09,
+0x20,0x63,0x34,0x34,0x34,0x34,0x35,0x34,0x35,0x33,0x24,0x33,0x32,0x33,0x33,0x23,
+0x13,0x11,0x98,0xda,0xcc,0xbc,0xcc,0xcb,0xdb,0xcb,0xcb,0xbb,0xbb,0xbb,0xbb,0xbb,
+0xbb,0xbb,0x99,0x10,0x53,0x35,0x35,0x34,0x44,0x43,0x43,0x34,0x43,0x33,0x33,0x43,
+0x32,0x23,0x33,0x22,0x11,0x88,0xba,0xcd,0xbc,0xcc,0xcb,0xcc,0xcb,0xbb,0xbc,0xbb,
+0xbb,0xac,0xbb,0xbb,0xab,0x99,0x08,0x31,0x54,0x53,0x53,0x33,0x34,0x44,0x43,0x43,
+0x33,0x43,0x22,0x23,0x23,0x33,0x22,0x11,0x90,0xb9,0xcc,0xdb,0xbc,0xbc,0xbd,0xdb,
+0xcb,0xcb,0xbb,0xbb,0xbb,0xcb,0xba,0xaa,0x9a,0x89,0x20,0x43,0x44,0x34,0x34,0x44,
+0x43,0x34,0x34,0x43,0x32,0x33,0x33,0x23,0x33,0x23,0x22,0x01,0xa9,0xdb,0xcc,0xcb,
+0xcc,0xcb,0xbc,0xbd,0xbb,0xbc,0xcb,0xba,0xba,0xba,0xba,0xaa,0x99,0x08,0x31,0x45,
+0x35,0x53,0x33,0x34,0x35,0x44,0x33,0x33,0x24,0x32,0x32,0x32,0x22,0x22,0x00,0x90,
+0xba,0xcd,0xdb,0xcb,0xbc,0xbd,0xbc,0xbc,0xbc,0xbb,0xcb,0xaa,0xba,0xaa,0xab,0xaa,
+0x09,0x30,0x63,0x43,0x34,0x44,0x43,0x34,0x53,0x33,0x34,0x42,0x22,0x22,0x22,0x23,
+0x22,0x01,0x88,0xa9,0xcb,0xbd,0xcc,0xbc,0xbc,0xbd,0xbc,0xbc,0xcb,0xaa,0xba,0xba,
+0xbb,0xab,0xaa,0x89,0x18,0x42,0x35,0x45,0x33,0x44,0x43,0x53,0x33,0x34,0x32,0x33,
+0x43,0x32,0x22,0x22,0x12,0x01,0x98,0xda,0xbc,0xbd,0xbc,0xcc,0xcb,0xdb,0xbb,0xcb,
+0xbb,0xbb,0xbb,0xcb,0xba,0xaa,0x9a,0x08,0x32,0x54,0x53,0x33,0x35,0x53,0x43,0x43,
+0x43,0x32,0x24,0x22,0x32,0x22,0x22,0x12,0x11,0x90,0xba,0xcd,0xdb,0xbb,0xbd,0xcc,
+0xcb,0xbc,0xcb,0xba,0xbb,0xbb,0xbb,0xac,0xba,0xa9,0x88,0x20,0x53,0x34,0x35,0x43,
+0x34,0x35,0x53,0x33,0x34,0x32,0x23,0x33,0x33,0x24,0x12,0x01,0x90,0xa9,0xdb,0xbc,
+0xbd,0xbc,0xbd,0xdb,0xcb,0xac,0xbb,0xbb,0xbb,0xbb,0xbc,0xab,0x9b,0x89,0x18,0x32,
+0x54,0x34,0x35,0x34,0x35,0x43,0x34,0x33,0x24,0x33,0x33,0x33,0x33,0x23,0x13,0x81,
+0xa8,0xcc,0xcc,0xcb,0xbc,0xdb,0xdb,0xcb,0xcb,0xbb,0xbb,0xbc,0xba,0xab,0xbb,0xba,
+0xa9,0x08,0x21,0x54,0x53,0x43,0x34,0x34,0x44,0x43,0x33,0x33,0x24,0x33,0x32,0x43,
+0x22,0x12,0x01,0x90,0xba,0xcc,0xbc,0xbd,0xdb,0xcb,0xbc,0xbc,0xbc,0xbb,0xcb,0xba,
+0xba,0xba,0xab,0xaa,0x09,0x10,0x53,0x44,0x53,0x43,0x33,0x35,0x34,0x34,0x34,0x33,
+0x23,0x33,0x43,0x22,0x22,0x11,0x81,0xa8,0xda,0xdb,0xbc,0xcc,0xbb,0xbd,0xbc,0xcc,
+0xba,0xbb,0xbb,0xbb,0xcb,0xaa,0x9b,0x8a,0x08,0x32,0x45,0x34,0x44,0x42,0x43,0x43,
+0x34,0x43,0x32,0x23,0x33,0x33,0x23,0x33,0x22,0x01,0x98,0xbc,0xcd,0xbc,0xbc,0xcc,
+0xdb,0xbb,0xbd,0xcb,0xab,0xbb,0xbb,0xcb,0xba,0xaa,0x99,0x09,0x11,0x34,0x45,0x43,
+0x34,0x34,0x34,0x35,0x33,0x34,0x33,0x43,0x22,0x32,0x22,0x12,0x02,0x90,0xb9,0xcd,
+0xdb,0xbb,0xbd,0xcc,0xcb,0xbc,0xbb,0xbc,0xbb,0xbb,0xcb,0xab,0xba,0x9a,0x99,0x10,
+0x52,0x34,0x35,0x34,0x34,0x44,0x43,0x43,0x33,0x42,0x22,0x33,0x23,0x23,0x22,0x11,
+0x01,0xa8,0xcc,0xdc,0xbb,0xcc,0xca,0xcb,0xbc,0xbc,0xac,0xba,0xba,0xba,0xcb,0xba,
+0x9a,0x89,0x18,0x21,0x44,0x34,0x35,0x53,0x33,0x35,0x34,0x34,0x43,0x22,0x23,0x32,
+0x22,0x32,0x21,0x01,0x88,0xca,0xcc,0xcc,0xcb,0xcb,0xbc,0xdb,0xbb,0xbc,0xac,0xbb,
+0xab,0xbb,0xbb,0xbb,0x9a,0x88,0x21,0x54,0x53,0x43,0x34,0x53,0x43,0x43,0x43,0x33,
+0x33,0x43,0x22,0x23,0x32,0x22,0x11,0x88,0xba,0xbd,0xbd,0xcc,0xcb,0xdb,0xcb,0xbc,
+0xcb,0xbb,0xbb,0xbb,0xbb,0xbc,0xba,0xaa,0x89,0x28,0x43,0x35,0x35,0x53,0x33,0x35,
+0x34,0x35,0x42,0x32,0x32,0x32,0x32,0x32,0x22,0x12,0x81,0xa9,0xbd,0xcc,0xcb,0xdb,
+0xdb,0xcb,0xcb,0xac,0xbb,0xac,0xab,0xab,0xab,0xab,0xab,0x9a,0x08,0x41,0x44,0x53,
+0x42,0x33,0x35,0x35,0x34,0x43,0x32,0x33,0x33,0x24,0x23,0x22,0x11,0x01,0x88,0xca,
+0xbc,0xcd,0xca,0xbb,0xbd,0xbd,0xbc,0xcb,0xab,0xbb,0xbb,0xac,0xab,0xaa,0x9a,0x09,
+0x11,0x34,0x45,0x43,0x43,0x34,0x53,0x43,0x34,0x42,0x22,0x22,0x23,0x23,0x23,0x23,
+0x01,0x80,0xb9,0xdb,0xdc,0xcb,0xbc,0xbc,0xbc,0xbd,0xcb,0xbb,0xbb,0xac,0xba,0xab,
+0xab,0xaa,0x09,0x18,0x33,0x55,0x43,0x34,0x53,0x43,0x34,0x34,0x43,0x32,0x33,0x23,
+0x43,0x22,0x22,0x11,0x01,0xa8,0xcb,0xbd,0xbc,0xcc,0xdb,0xcb,0xcb,0xac,0xbb,0xac,
+0xab,0xbb,0xba,0xab,0xbb,0x9a,0x08,0x31,0x45,0x44,0x43,0x43,0x43,0x34,0x34,0x34,
+0x43,0x32,0x23,0x32,0x32,0x32,0x22,0x01,0x98,0xca,0xbc,0xbd,0xbd,0xbc,0xbd,0xbc,
+0xcc,0xbb,0xbb,0xbb,0xac,0xab,0xab,0xbb,0xaa,0x89,0x11,0x34,0x36,0x34,0x44,0x43,
+0x53,0x43,0x33,0x24,0x33,0x33,0x24,0x23,0x23,0x21,0x01,0x81,0xa9,0xdb,0xbd,0xbc,
+0xcc,0xcb,0xdb,0xcb,0xbb,0xbc,0xab,0xbb,0xba,0xcb,0xba,0xaa,0x89,0x00,0x42,0x53,
+0x53,0x43,0x43,0x34,0x34,0x44,0x42,0x22,0x23,0x22,0x23,0x23,0x23,0x12,0x80,0xa8,
+0xba,0xce,0xdb,0xcb,0xdb,0xbb,0xbd,0xbc,0xcb,0xba,0xbb,0xcb,0xaa,0xab,0x9a,0x9a,
+0x08,0x30,0x44,0x34,0x44,0x33,0x35,0x44,0x43,0x33,0x34,0x23,0x33,0x33,0x23,0x33,
+0x22,0x12,0x90,0xca,0xcc,0xcc,0xcb,0xbc,0xcc,0xcb,0xcb,0xbb,0xcb,0xba,0xbb,0xbb,
+0xbb,0xac,0x9a,0x88,0x10,0x42,0x44,0x53,0x43,0x43,0x43,0x34,0x34,0x24,0x33,0x32,
+0x32,0x33,0x24,0x12,0x11,0x08,0xa9,0xcb,0xbd,0xbd,0xbc,0xcc,0xbb,0xbd,0xbc,0xcb,
+0xab,0xbb,0xbb,0xba,0xbb,0xbb,0x8a,0x18,0x42,0x54,0x43,0x53,0x33,0x35,0x44,0x33,
+0x24,0x24,0x22,0x23,0x33,0x32,0x23,0x11,0x81,0x98,0xcb,0xcc,0xbc,0xbd,0xdb,0xcb,
+0xbc,0xbc,0xcb,0xab,0xbb,0xbb,0xac,0xba,0x9a,0x9a,0x08,0x20,0x53,0x44,0x53,0x33,
+0x34,0x35,0x34,0x34,0x43,0x23,0x23,0x33,0x32,0x32,0x22,0x02,0x80,0xba,0xcd,0xdb,
+0xbc,0xcc,0xcb,0xcb,0xbc,0xcb,0xbb,0xbb,0xac,0xba,0xaa,0xab,0xaa,0x09,0x10,0x43,
+0x44,0x34,0x44,0x43,0x43,0x34,0x34,0x43,0x33,0x33,0x32,0x33,0x32,0x23,0x12,0x00,
+0xb9,0xeb,0xcb,0xcc,0xdb,0xcb,0xbc,0xcc,0xca,0xaa,0xbb,0xba,0xab,0xbb,0xac,0xaa,
+0x89,0x08,0x32,0x44,0x44,0x33,0x35,0x34,0x35,0x34,0x43,0x33,0x33,0x32,0x24,0x22,
+0x22,0x12,0x01,0x88,0xbb,0xbe,0xcc,0xcb,0xdb,0xcb,0xbc,0xbc,0xac,0xbb,0xbb,0xbb,
+0xab,0xac,0xaa,0xaa,0x09,0x20,0x44,0x34,0x44,0x43,0x43,0x34,0x34,0x34,0x33,0x24,
+0x33,0x32,0x33,0x23,0x23,0x01,0x80,0xba,0xcd,0xdb,0xdb,0xbb,0xbd,0xbd,0xbc,0xcb,
+0xbb,0xba,0xac,0xab,0xab,0xab,0xaa,0x89,0x18,0x42,0x35,0x35,0x34,0x43,0x34,0x35,
+0x44,0x32,0x33,0x33,0x23,0x33,0x33,0x33,0x12,0x01,0xa8,0xdc,0xbc,0xbd,0xbc,0xbc,
+0xbd,0xdb,0xbb,0xbc,0xbb,0xac,0xba,0xba,0xba,0xba,0x99,0x18,0x32,0x35,0x35,0x44,
+0x43,0x34,0x44,0x42,0x32,0x24,0x23,0x33,0x32,0x23,0x22,0x22,0x01,0x80,0xca,0xcc,
+0xbc,0xbd,0xdb,0xcb,0xbc,0xbc,0xcb,0xbb,0xbb,0xbb,0xac,0xab,0xaa,0xaa,0x09,0x10,
+0x44,0x34,0x44,0x43,0x43,0x53,0x43,0x43,0x32,0x33,0x33,0x33,0x43,0x32,0x12,0x02,
+0x00,0xb9,0xeb,0xbc,0xcc,0xcb,0xcb,0xdb,0xcb,0xbb,0xbc,0xab,0xbb,0xac,0xab,0xab,
+0x9a,0x99,0x00,0x42,0x44,0x34,0x44,0x33,0x34,0x35,0x34,0x34,0x32,0x33,0x33,0x33,
+0x43,0x22,0x11,0x80,0x99,0xca,0xcc,0xdb,0xcb,0xbc,0xbc,0xcc,0xbb,0xbc,0xbb,0xbb,
+0xcb,0xba,0xab,0xab,0xaa,0x88,0x31,0x45,0x34,0x25,0x24,0x34,0x34,0x25,0x24,0x32,
+0x23,0x33,0x33,0x24,0x22,0x12,0x01,0x98,0xb9,0xbd,0xcd,0xcb,0xcb,0xdb,0xbb,0xbd,
+0xcb,0xbb,0xcb,0xaa,0xab,0xba,0xba,0xa9,0x89,0x20,0x53,0x44,0x43,0x24,0x34,0x34,
+0x35,0x43,0x33,0x24,0x23,0x23,0x23,0x23,0x22,0x12,0x00,0xa9,0xbd,0xcd,0xcb,0xcb,
+0xbc,0xcc,0xcb,0xbb,0xbc,0xba,0xac,0xba,0xba,0xba,0xa9,0x99,0x00,0x32,0x36,0x44,
+0x43,0x43,0x34,0x34,0x35,0x33,0x34,0x32,0x32,0x32,0x33,0x33,0x12,0x81,0xa8,0xcb,
+0xcd,0xdb,0xcb,0xbc,0xdb,0xcb,0xcb,0xcb,0xab,0xab,0xab,0xbb,0xbb,0xac,0x99,0x18,
+0x21,0x43,0x54,0x43,0x43,0x34,0x53,0x33,0x35,0x33,0x43,0x22,0x23,0x32,0x32,0x12,
+0x01,0x90,0xba,0xdc,0xcb,0xcc,0xcb,0xbc,0xcc,0xbb,0xbc,0xbb,0xcb,0xba,0xbb,0xbb,
+0xba,0xaa,0x89,0x20,0x63,0x53,0x43,0x34,0x43,0x44,0x33,0x25,0x24,0x32,0x32,0x32,
+0x32,0x33,0x22,0x12,0x00,0xa9,0xcc,0xcc,0xbc,0xbc,0xcc,0xcb,0xdb,0xca,0xba,0xba,
+0xba,0xba,0xbb,0xbb,0xbb,0x9a,0x18,0x52,0x44,0x34,0x43,0x34,0x34,0x44,0x24,0x24,
+0x23,0x33,0x32,0x33,0x33,0x23,0x12,0x01,0x98,0xba,0xbf,0xbd,0xbd,0xdb,0xcb,0xcb,
+0xcb,0xbb,0xcb,0xba,0xbb,0xcb,0xaa,0x9a,0x8a,0x08,0x20,0x52,0x53,0x34,0x53,0x33,
+0x35,0x44,0x42,0x22,0x23,0x23,0x33,0x43,0x22,0x21,0x00,0x80,0xaa,0xeb,0xcb,0xbc,
+0xbc,0xcc,0xcb,0xbc,0xbc,0xba,0xcb,0xaa,0xab,0xbb,0xab,0xaa,0x99,0x20,0x52,0x34,
+0x35,0x44,0x33,0x44,0x43,0x24,0x43,0x32,0x32,0x32,0x23,0x33,0x33,0x22,0x00,0xb9,
+0xcc,0xbc,0xbd,0xbd,0xbc,0xbd,0xcb,0xcb,0xbb,0xac,0xbb,0xaa,0xbb,0xbb,0xbb,0x8a,
+0x18,0x32,0x36,0x44,0x53,0x43,0x53,0x33,0x44,0x42,0x22,0x32,0x32,0x32,0x33,0x33,
+0x12,0x01,0x90,0xcb,0xdc,0xdb,0xbb,0xcc,0xcb,0xbc,0xcc,0xba,0xba,0xab,0xac,0xba,
+0xab,0xba,0xa9,0x98,0x11,0x44,0x44,0x24,0x43,0x43,0x53,0x43,0x43,0x33,0x32,0x33,
+0x43,0x22,0x22,0x22,0x11,0x81,0xa9,0xcc,0xcc,0xdb,0xbb,0xcc,0xbc,0xcb,0xac,0xcb,
+0xaa,0xba,0xba,0xab,0xbb,0xaa,0x99,0x20,0x53,0x34,0x35,0x53,0x43,0x43,0x34,0x34,
+0x24,0x33,0x33,0x33,0x33,0x33,0x33,0x13,0x01,0xa8,0xdc,0xdb,0xcb,0xbc,0xdb,0xdb,
+0xcb,0xcb,0xba,0xcb,0xaa,0xba,0xba,0xbb,0xba,0x99,0x08,0x32,0x45,0x34,0x44,0x33,
+0x44,0x34,0x43,0x34,0x33,0x33,0x33,0x24,0x32,0x22,0x22,0x11,0x98,0xca,0xcc,0xbc,
+0xbc,0xbc,0xbd,0xcc,0xbb,0xbc,0xcb,0xba,0xba,0xab,0xab,0xbb,0xaa,0x89,0x31,0x44,
+0x44,0x33,0x35,0x35,0x53,0x43,0x33,0x34,0x33,0x33,0x43,0x22,0x23,0x13,0x02,0x80,
+0xb9,0xcc,0xcc,0xcb,0xcb,0xbc,0xbd,0xbc,0xcb,0xbb,0xbb,0xcb,0xba,0xbb,0xbb,0xaa,
+0x89,0x18,0x52,0x53,0x34,0x34,0x34,0x44,0x43,0x43,0x43,0x32,0x23,0x33,0x32,0x33,
+0x32,0x12,0x01,0xa8,0xcc,0xbc,0xcd,0xbb,0xbd,0xbc,0xcc,0xbb,0xbc,0xbb,0xcb,0xba,
+0xba,0xbb,0xaa,0x99,0x09,0x31,0x54,0x34,0x44,0x33,0x44,0x53,0x33,0x34,0x43,0x22,
+0x33,0x32,0x33,0x23,0x23,0x11,0x90,0xda,0xdb,0xcb,0xbc,0xbd,0xdb,0xcb,0xac,0xcb,
+0xba,0xab,0xbb,0xbb,0xbb,0xac,0xaa,0x89,0x20,0x53,0x44,0x43,0x43,0x43,0x43,0x34,
+0x34,0x24,0x33,0x33,0x23,0x33,0x33,0x23,0x12,0x80,0xa9,0xcd,0xbc,0xcd,0xca,0xbb,
+0xbd,0xbc,0xbc,0xcb,0xba,0xab,0xbb,0xac,0xba,0xa9,0x89,0x00,0x31,0x35,0x45,0x43,
+0x43,0x34,0x53,0x33,0x34,0x33,0x24,0x32,0x32,0x33,0x32,0x12,0x00,0xa9,0xdb,0xbc,
+0xbd,0xbc,0xcc,0xdb,0xcb,0xbb,0xbc,0xbb,0xbb,0xac,0xab,0xbb,0xab,0x9a,0x09,0x31,
+0x54,0x44,0x33,0x34,0x34,0x35,0x34,0x25,0x33,0x23,0x33,0x33,0x43,0x32,0x12,0x01,
+0x90,0xba,0xcc,0xcc,0xdb,0xbb,0xcc,0xbc,0xcb,0xbc,0xba,0xac,0xba,0xba,0xab,0xbb,
+0x9a,0x89,0x20,0x53,0x44,0x43,0x34,0x53,0x43,0x43,0x24,0x43,0x32,0x32,0x23,0x23,
+0x23,0x23,0x12,0x00,0xb9,0xcc,0xcc,0xcb,0xbc,0xdb,0xdb,0xcb,0xcb,0xba,0xbb,0xcb,
+0xaa,0xbb,0xbb,0xaa,0x99,0x18,0x32,0x45,0x44,0x43,0x33,0x44,0x34,0x34,0x34,0x32,
+0x33,0x33,0x24,0x33,0x12,0x12,0x00,0x90,0xca,0xdc,0xcb,0xcb,0xbc,0xdb,0xcb,0xcb,
+0xcb,0xba,0xba,0xbb,0xbb,0xbb,0xab,0xab,0x89,0x31,0x45,0x44,0x43,0x43,0x34,0x34,
+0x34,0x34,0x33,0x34,0x33,0x32,0x33,0x33,0x22,0x12,0x88,0xba,0xce,0xdb,0xbb,0xbd,
+0xdb,0xdb,0xbb,0xbc,0xac,0xab,0xba,0xbb,0xcb,0xaa,0x9a,0x89,0x10,0x33,0x36,0x35,
+0x43,0x43,0x34,0x44,0x43,0x33,0x33,0x33,0x24,0x33,0x32,0x22,0x12,0x00,0x98,0xdb,
+0xcc,0xbc,0xcc,0xbb,0xcc,0xcb,0xbc,0xbb,0xcb,0xba,0xba,0xba,0xac,0x9a,0x8a,0x08,
+0x31,0x44,0x53,0x43,0x34,0x53,0x43,0x43,0x43,0x32,0x33,0x23,0x43,0x22,0x12,0x12,
+0x11,0x88,0xca,0xbc,0xbd,0xbc,0xbd,0xbc,0xcc,0xcb,0xba,0xbb,0xac,0xbb,0xba,0xbb,
+0xab,0xaa,0x89,0x21,0x45,0x34,0x34,0x34,0x44,0x43,0x34,0x34,0x42,0x22,0x23,0x23,
+0x23,0x23,0x32,0x11,0x80,0xba,0xcd,0xcc,0xca,0xbb,0xbd,0xbd,0xdb,0xbb,0xbb,0xbc,
+0xba,0xbb,0xbb,0xab,0xab,0x8a,0x08,0x43,0x45,0x34,0x25,0x34,0x43,0x34,0x34,0x43,
+0x33,0x32,0x43,0x22,0x23,0x22,0x12,0x80,0xa8,0xbc,0xbd,0xbd,0xcb,0xbc,0xbd,0xcc,
+0xbb,0xcb,0xba,0xbb,0xba,0xac,0xab,0xab,0x99,0x08,0x22,0x35,0x35,0x34,0x35,0x53,
+0x33,0x35,0x43,0x43,0x22,0x23,0x22,0x32,0x23,0x23,0x01,0x98,0xca,0xcc,0xbc,0xcc,
+0xbb,0xcc,0xbc,0xbc,0xcb,0xbb,0xbb,0xbb,0xac,0xbb,0xaa,0xaa,0x09,0x20,0x34,0x36,
+0x53,0x33,0x35,0x44,0x24,0x43,0x32,0x33,0x43,0x22,0x23,0x32,0x12,0x12,0x81,0xa9,
+0xcc,0xcc,0xcb,0xdb,0xcb,0xcb,0xbc,0xcb,0xcb,0xaa,0xab,0xab,0xbb,0xbb,0xaa,0x89,
+0x10,0x42,0x44,0x44,0x43,0x43,0x43,0x34,0x34,0x34,0x32,0x33,0x33,0x33,0x24,0x23,
+0x12,0x81,0x98,0xcb,0xbd,0xbd,0xdb,0xcb,0xdb,0xbb,0xbd,0xbb,0xcb,0xab,0xab,0xbb,
+0xbb,0xbb,0xaa,0x09,0x31,0x46,0x34,0x34,0x34,0x34,0x44,0x43,0x43,0x32,0x33,0x33,
+0x33,0x33,0x24,0x21,0x00,0x90,0xba,0xdc,0xdb,0xcb,0xcb,0xbc,0xbc,0xad,0xac,0xab,
+0xbb,0xba,0xbb,0xac,0xab,0xaa,0x89,0x20,0x53,0x34,0x35,0x43,0x34,0x35,0x53,0x33,
+0x33,0x24,0x33,0x33,0x33,0x43,0x12,0x02,0x80,0xa9,0xcc,0xdb,0xcb,0xbc,0xdb,0xcb,
+0xcb,0xbc,0xbb,0xbb,0xac,0xab,0xbb,0xbb,0xaa,0x99,0x10,0x42,0x44,0x44,0x33,0x44,
+0x43,0x53,0x33,0x34,0x43,0x32,0x32,0x23,0x23,0x23,0x12,0x01,0xa8,0xdb,0xcc,0xcb,
+0xcb,0xbc,0xbd,0xcc,0xca,0xba,0xba,0xbb,0xcb,0xab,0xab,0xaa,0x8a,0x88,0x21,0x44,
+0x44,0x43,0x43,0x53,0x43,0x43,0x43,0x32,0x33,0x33,0x33,0x43,0x22,0x12,0x11,0x88,
+0xa9,0xbd,0xbe,0xcb,0xbc,0xdb,0xdb,0xcb,0xbb,0xbb,0xac,0xbb,0xca,0xaa,0xaa,0x9a,
+0x89,0x10,0x42,0x44,0x53,0x33,0x44,0x43,0x43,0x34,0x33,0x43,0x23,0x23,0x33,0x23,
+0x33,0x21,0x90,0xb9,0xcc,0xdb,0xbc,0xcc,0xdb,0xcb,0xcb,0xbb,0xbc,0xbb,0xbb,0xbb,
+0xac,0xbb,0xaa,0x99,0x18,0x42,0x44,0x53,0x43,0x43,0x43,0x34,0x34,0x24,0x33,0x23,
+0x43,0x32,0x32,0x32,0x21,0x01,0x90,0xcb,0xcd,0xcb,0xcb,0xcb,0xbc,0xcc,0xcb,0xbb,
+0xbb,0xbb,0xcb,0xbb,0xbb,0xab,0x9a,0x09,0x30,0x45,0x44,0x33,0x34,0x44,0x43,0x34,
+0x43,0x33,0x43,0x32,0x32,0x33,0x32,0x12,0x02,0x80,0xb9,0xcd,0xbc,0xbd,0xbc,0xcc,
+0xcb,0xcb,0xbb,0xac,0xbb,0xbb,0xac,0xab,0xab,0x9a,0x89,0x10,0x53,0x53,0x43,0x43,
+0x43,0x44,0x43,0x43,0x33,0x33,0x42,0x22,0x23,0x33,0x22,0x12,0x80,0xa8,0xcc,0xdb,
+0xbc,0xbc,0xbc,0xcc,0xdb,0xbb,0xcb,0xbb,0xba,0xbb,0xbc,0xba,0xaa,0x89,0x08,0x32,
+0x54,0x53,0x33,0x35,0x53,0x43,0x43,0x43,0x32,0x33,0x23,0x24,0x22,0x22,0x12,0x00,
+0x98,0xba,0xcd,0xdb,0xbb,0xbd,0xbd,0xbc,0xbc,0xcb,0xbb,0xbb,0xbb,0xcb,0xba,0xab,
+0xaa,0x88,0x21,0x44,0x34,0x35,0x34,0x34,0x44,0x33,0x35,0x33,0x33,0x43,0x32,0x33,
+0x33,0x22,0x12,0x88,0xb9,0xbe,0xcc,0xac,0xbc,0xbc,0xbd,0xbc,0xbc,0xba,0xbb,0xcb,
+0xab,0xbb,0xab,0xaa,0x99,0x00,0x43,0x45,0x34,0x43,0x34,0x43,0x44,0x33,0x34,0x24,
+0x23,0x32,0x32,0x23,0x32,0x11,0x81,0xa8,0xdb,0xcc,0xcb,0xcc,0xbb,0xbd,0xbc,0xcb,
+0xac,0xbb,0xbb,0xbb,0xbb,0xac,0xba,0x99,0x08,0x32,0x35,0x35,0x44,0x33,0x35,0x44,
+0x33,0x34,0x33,0x24,0x33,0x23,0x33,0x32,0x22,0x11,0x98,0xca,0xbd,0xcc,0xbc,0xdb,
+0xcb,0xbc,0xbc,0xbc,0xba,0xbb,0xbb,0xbc,0xbb,0xba,0x9a,0x09,0x21,0x34,0x36,0x34,
+0x44,0x33,0x35,0x34,0x34,0x24,0x33,0x32,0x33,0x33,0x33,0x23,0x11,0x91,0xb9,0xbe,
+0xcd,0xbb,0xcc,0xcb,0xbc,0xbc,0xbc,0xcb,0xba,0xbb,0xbb,0xbb,0xbb,0xba,0x9a,0x28,
+0x63,0x44,0x43,0x33,0x35,0x44,0x43,0x33,0x34,0x33,0x34,0x32,0x23,0x33,0x22,0x12,
+0x81,0xa8,0xcc,0xbc,0xcc,0xcb,0xdb,0xdb,0xbb,0xbc,0xac,0xbb,0xbb,0xbb,0xcb,0xab,
+0xab,0x9a,0x88,0x31,0x44,0x44,0x34,0x43,0x43,0x34,0x44,0x33,0x43,0x32,0x33,0x32,
+0x33,0x23,0x23,0x01,0x90,0xba,0xcd,0xbd,0xbc,0xbd,0xdb,0xcb,0xcb,0xcb,0xba,0xbb,
+0xbb,0xcb,0xba,0xba,0x9a,0x88,0x10,0x43,0x35,0x44,0x34,0x43,0x34,0x53,0x43,0x33,
+0x33,0x33,0x33,0x43,0x23,0x23,0x02,0x81,0xa9,0xdb,0xcc,0xbc,0xcc,0xcb,0xcb,0xbc,
+0xcb,0xbb,0xac,0xab,0xbb,0xbb,0xab,0xab,0x9a,0x08,0x42,0x45,0x43,0x34,0x43,0x34,
+0x44,0x33,0x34,0x24,0x23,0x23,0x33,0x23,0x33,0x22,0x11,0x99,0xdb,0xcc,0xdb,0xbb,
+0xbd,0xbc,0xcc,0xbb,0xbc,0xbb,0xac,0xbb,0xba,0xbb,0xba,0x9b,0x89,0x31,0x54,0x34,
+0x44,0x33,0x35,0x34,0x44,0x42,0x22,0x33,0x32,0x33,0x33,0x33,0x23,0x01,0x90,0xca,
+0xcc,0xbc,0xcc,0xcb,0xbc,0xbc,0xbd,0xbb,0xbc,0xba,0xbb,0xbb,0xac,0xbb,0x9a,0x89,
+0x10,0x43,0x35,0x44,0x43,0x43,0x43,0x34,0x44,0x32,0x33,0x32,0x33,0x24,0x23,0x22,
+0x11,0x00,0xa9,0xdb,0xcc,0xcb,0xcb,0xbc,0xcc,0xcb,0xcb,0xba,0xbb,0xcb,0xba,0xab,
+0xab,0xab,0x99,0x08,0x31,0x45,0x44,0x33,0x35,0x34,0x34,0x44,0x33,0x33,0x34,0x32,
+0x23,0x33,0x32,0x12,0x81,0x98,0xcb,0xcc,0xcc,0xcb,0xbc,0xbc,0xcc,0xbb,0xbc,0xac,
+0xaa,0xbb,0xca,0xaa,0xaa,0x99,0x09,0x20,0x52,0x53,0x43,0x24,0x34,0x34,0x44,0x33,
+0x43,0x23,0x33,0x32,0x24,0x22,0x21,0x01,0x80,0xa9,0xcc,0xbc,0xbd,0xdb,0xcb,0xcb,
+0xbc,0xbc,0xbb,0xbb,0xac,0xab,0xab,0xbb,0xaa,0x99,0x10,0x43,0x35,0x35,0x44,0x33,
+0x35,0x34,0x34,0x43,0x33,0x33,0x33,0x43,0x22,0x22,0x11,0x01,0xa8,0xdb,0xcc,0xcb,
+0xcb,0xbc,0xcc,0xcb,0xcb,0xab,0xbb,0xbb,0xcb,0xbb,0xab,0xab,0x8a,0x08,0x32,0x45,
+0x34,0x35,0x43,0x34,0x34,0x44,0x33,0x43,0x32,0x23,0x33,0x42,0x22,0x21,0x00,0x90,
+0xb9,0xbd,0xbd,0xbd,0xbc,0xbc,0xbc,0xcc,0xbb,0xcb,0xba,0xba,0xba,0xbb,0xbb,0xaa,
+0x89,0x21,0x35,0x35,0x44,0x33,0x35,0x35,0x53,0x33,0x34,0x23,0x33,0x24,0x22,0x22,
+0x22,0x01,0x80,0xba,0xcc,0xbc,0xcc,0xcb,0xbc,0xcc,0xbb,0xbc,0xbb,0xcb,0xab,0xbb,
+0xba,0xba,0xa9,0x98,0x10,0x43,0x45,0x34,0x43,0x43,0x34,0x44,0x43,0x32,0x21,0x00,
+0x88,0x80,0x80,0x80,0x10,0x42,0x44,0x33,0x01,0xa9,0x99,0x52,0x46,0x53,0x22,0x12,
+0x80,0x98,0x08,0x52,0x54,0x33,0x23,0x01,0x98,0x88,0x18,0x32,0x35,0x33,0x12,0xa9,
+0xcb,0x0a,0x31,0x24,0x01,0x99,0x89,0x00,0xd9,0xcf,0xbc,0xcb,0xbb,0xbb,0xbb,0x89,
+0xa0,0xee,0xcd,0xbb,0x9b,0x08,0x80,0xb9,0xcf,0xdb,0xbc,0xbb,0x9a,0x18,0x11,0xe9,
+0xdd,0xbc,0xac,0x99,0x89,0x88,0x08,0x42,0x45,0x34,0x23,0x01,0x90,0x88,0x42,0x45,
+0x34,0x22,0x02,0x01,0x10,0x90,0xeb,0xcd,0xcb,0x9a,0x89,0x00,0x88,0xa9,0xbb,0xbc,
+0xbb,0xab,0x8a,0x10,0x91,0xfb,0xbc,0xac,0x8a,0x88,0x80,0x98,0xa9,0xa9,0xba,0xbc,
+0xaa,0x10,0x22,0xb0,0xdf,0xcb,0x9a,0x89,0x80,0x88,0x20,0x55,0x34,0x25,0x22,0x11,
+0x80,0x80,0x10,0x54,0x34,0x34,0x12,0x80,0x99,0x28,0x66,0x44,0x33,0x23,0x11,0x89,
+0x09,0x53,0x46,0x43,0x33,0x12,0x81,0x88,0x10,0x54,0x34,0x24,0x22,0x80,0x88,0x89,
+0x31,0x55,0x33,0x24,0x10,0x98,0x99,0x00,0x32,0x43,0x23,0x01,0xa8,0xba,0x9a,0x41,
+0x55,0x33,0x02,0x90,0xa8,0xa9,0xdd,0xdd,0xbc,0xbb,0x9a,0x89,0x88,0xba,0xcc,0xcc,
+0xac,0xbb,0x9a,0x00,0x90,0xec,0xbe,0xad,0xab,0x99,0x00,0x88,0xb8,0xbe,0xcd,0xbb,
+0xab,0x09,0x10,0x80,0xfb,0xcd,0xbc,0xaa,0x8a,0x08,0x81,0xa8,0xcb,0xbc,0xbb,0x9a,
+0x09,0x10,0x00,0xb9,0xcd,0xbb,0x9a,0x08,0x81,0x80,0x30,0x66,0x44,0x33,0x12,0x00,
+0x88,0x31,0x56,0x44,0x43,0x22,0x81,0x88,0x19,0x73,0x44,0x34,0x33,0x12,0x08,0x89,
+0x10,0x54,0x35,0x24,0x22,0x81,0x88,0x08,0x20,0x42,0x43,0x23,0x11,0x98,0x99,0x19,
+0x32,0x34,0x13,0x81,0x10,0x10,0xd9,0xce,0xcc,0xbb,0xbb,0xab,0x8a,0x80,0xc8,0xdf,
+0xcc,0xbb,0x9a,0x18,0x80,0xc9,0xce,0xcc,0xcb,0xaa,0x89,0x10,0x01,0xfb,0xcd,0xcb,
+0xab,0x99,0x88,0x88,0x18,0x63,0x54,0x33,0x23,0x01,0x98,0x18,0x52,0x35,0x34,0x13,
+0x02,0x10,0x00,0xa8,0xcd,0xcd,0xbb,0xaa,0x08,0x00,0x88,0xba,0xdb,0xbb,0xab,0x9a,
+0x08,0x10,0x98,0xcd,0xbd,0xab,0x8a,0x10,0x00,0x98,0xaa,0xba,0xbb,0xbb,0x8a,0x32,
+0x24,0xd8,0xdd,0xbb,0xab,0x09,0x88,0x18,0x52,0x46,0x44,0x32,0x22,0x10,0x10,0x21,
+0x43,0x44,0x34,0x43,0x12,0x81,0x98,0x30,0x67,0x44,0x23,0x22,0x80,0x88,0x20,0x54,
+0x44,0x43,0x22,0x02,0x80,0x88,0x20,0x54,0x34,0x24,0x02,0x80,0x99,0x08,0x31,0x45,
+0x24,0x22,0x01,0x98,0x08,0x20,0x43,0x33,0x12,0x81,0xa8,0xaa,0x09,0x42,0x45,0x32,
+0x02,0x81,0x88,0xd9,0xdd,0xbd,0xbd,0xba,0xa9,0x88,0x98,0xb9,0xdc,0xbc,0xbc,0xab,
+0x09,0x10,0xa9,0xdf,0xcc,0xac,0x9b,0x99,0x00,0x80,0xb9,0xce,0xcc,0xba,0x9a,0x09,
+0x01,0x90,0xec,0xcc,0xac,0xab,0x89,0x00,0x80,0xb8,0xdb,0xac,0x9b,0x8a,0x08,0x01,
+0x80,0xb9,0xdb,0xbb,0xa9,0x08,0x10,0x31,0x64,0x54,0x33,0x33,0x12,0x01,0x21,0x64,
+0x44,0x44,0x43,0x12,0x81,0x99,0x18,0x54,0x45,0x24,0x23,0x01,0x80,0x08,0x20,0x54,
+0x34,0x34,0x12,0x00,0x88,0x18,0x21,0x24,0x24,0x22,0x01,0x90,0x99,0x19,0x42,0x43,
+0x13,0x80,0x88,0x80,0xb8,0xfc,0xbc,0xbc,0xab,0x89,0x00,0x91,0xfc,0xdc,0xcb,0xab,
+0x89,0x00,0x88,0xdb,0xcd,0xbd,0xbc,0xab,0x09,0x20,0x81,0xfc,0xbd,0xad,0xaa,0x99,
+0x88,0x80,0x21,0x64,0x53,0x32,0x12,0x80,0x88,0x18,0x44,0x44,0x23,0x13,0x11,0x00,
+0x80,0xb8,0xce,0xbd,0xcb,0x99,0x08,0x00,0x98,0xba,0xcb,0xab,0xaa,0x8a,0x08,0x00,
+0xb8,0xce,0xbc,0x9b,0x89,0x01,0x80,0x89,0x9a,0xa9,0xca,0xbc,0x89,0x31,0x14,0xb0,
+0xbf,0xad,0x99,0x08,0x00,0x10,0x51,0x54,0x43,0x23,0x22,0x00,0x11,0x31,0x63,0x43,
+0x34,0x33,0x22,0x88,0x88,0x61,0x46,0x44,0x33,0x12,0x00,0x09,0x20,0x46,0x35,0x34,
+0x22,0x81,0x90,0x08,0x41,0x44,0x34,0x23,0x12,0x80,0x99,0x10,0x53,0x45,0x33,0x22,
+0x00,0x99,0x88,0x21,0x43,0x33,0x11,0x81,0xa9,0x9a,0x18,0x46,0x44,0x22,0x01,0x99,
+0x89,0x99,0xdc,0xcd,0xbc,0xab,0x99,0x89,0xa9,0xcc,0xcc,0xcb,0xbb,0x9a,0x09,0x01,
+0xc8,0xde,0xbd,0xbc,0xaa,0x89,0x08,0x80,0xba,0xcf,0xbc,0xcb,0x99,0x08,0x01,0xb8,
+0xed,0xbc,0xcb,0x9a,0x08,0x00,0x80,0xb9,0xbc,0xad,0xab,0x89,0x10,0x11,0x81,0xca,
+0xbc,0x9b,0x89,0x10,0x10,0x21,0x55,0x35,0x34,0x23,0x11,0x18,0x30,0x45,0x45,0x34,
+0x24,0x13,0x00,0x88,0x30,0x56,0x44,0x33,0x33,0x01,0x80,0x08,0x52,0x45,0x43,0x23,
+0x01,0x80,0x08,0x10,0x22,0x34,0x43,0x22,0x81,0x98,0x99,0x20,0x34,0x14,0x01,0x00,
+0x11,0x80,0xfb,0xbe,0xac,0xab,0xaa,0x99,0x89,0xa9,0xed,0xdc,0xac,0xab,0x88,0x00,
+0x90,0xcc,0xdd,0xcb,0xac,0xaa,0x08,0x11,0x90,0xde,0xbd,0xac,0xaa,0x89,0x88,0x08,
+0x31,0x47,0x43,0x23,0x02,0x80,0x88,0x20,0x44,0x35,0x33,0x22,0x11,0x00,0x80,0xca,
+0xce,0xbc,0xac,0x99,0x00,0x80,0x98,0xbb,0xbc,0xba,0x9a,0x89,0x08,0x00,0xda,0xdc,
+0xbb,0x9a,0x08,0x00,0x80,0xa9,0xa9,0xcb,0xac,0x9b,0x28,0x44,0x01,0xdb,0xcc,0x9a,
+0x09,0x08,0x88,0x08,0x53,0x36,0x25,0x23,0x12,0x11,0x00,0x11,0x43,0x36,0x34,0x13,
+0x01,0x00,0x32,0x47,0x35,0x34,0x24,0x11,0x80,0x88,0x31,0x56,0x53,0x23,0x12,0x81,
+0x88,0x00,0x43,0x45,0x43,0x22,0x01,0x90,0x88,0x20,0x45,0x43,0x23,0x02,0x80,0x89,
+0x08,0x21,0x43,0x33,0x23,0x81,0xa9,0x8a,0x40,0x45,0x34,0x23,0x11,0x88,0xaa,0xdc,
+0xdc,0xdb,0xab,0x9b,0x99,0x88,0xb9,0xcd,0xbc,0xbc,0xbb,0x9a,0x88,0x88,0xda,0xcf,
+0xbc,0xad,0xaa,0x88,0x00,0x98,0xea,0xbc,0xbd,0xaa,0x88,0x00,0x81,0xda,0xce,0xdb,
+0xaa,0x9a,0x80,0x00,0x80,0xba,0xbd,0xcb,0x9a,0x89,0x10,0x00,0xa8,0xcb,0xac,0x99,
+0x00,0x08,0x88,0x20,0x65,0x44,0x33,0x23,0x01,0x00,0x21,0x55,0x45,0x53,0x22,0x12,
+0x88,0x08,0x40,0x45,0x35,0x34,0x22,0x01,0x98,0x00,0x53,0x45,0x33,0x22,0x01,0x88,
+0x08,0x11,0x33,0x44,0x32,0x13,0x00,0xa9,0x89,0x30,0x45,0x32,0x11,0x01,0x98,0xc9,
+0xcc,0xdb,0xbb,0xbc,0xbb,0x9a,0x09,0xb9,0xff,0xcb,0xac,0x9a,0x89,0x90,0xa8,0xeb,
+0xdc,0xcc,0xbb,0x9b,0x10,0x11,0xda,0xde,0xcb,0xab,0x9a,0x98,0x88,0x00,0x52,0x45,
+0x34,0x32,0x01,0x90,0x88,0x31,0x55,0x43,0x23,0x12,0x01,0x00,0x98,0xeb,0xdc,0xbb,
+0xaa,0x89,0x00,0x80,0xaa,0xcb,0xbc,0xba,0xaa,0x08,0x10,0x80,0xda,0xbd,0xac,0x9a,
+0x09,0x08,0x88,0x99,0xa9,0xcb,0xba,0x8a,0x21,0x25,0x92,0xeb,0xcc,0xaa,0x89,0x00,
+0x00,0x10,0x62,0x45,0x34,0x33,0x02,0x00,0x18,0x52,0x63,0x32,0x23,0x11,0x01,0x11,
+0x53,0x46,0x35,0x34,0x22,0x01,0x90,0x08,0x62,0x54,0x34,0x23,0x12,0x80,0x88,0x30,
+0x54,0x34,0x33,0x13,0x01,0x98,0x08,0x32,0x47,0x43,0x22,0x02,0x90,0x88,0x18,0x32,
+0x34,0x43,0x11,0x98,0xba,0x9a,0x51,0x35,0x24,0x01,0x88,0x08,0x81,0xda,0xce,0xbc,
+0x9c,0x8a,0x88,0x89,0xb9,0xdb,0xcc,0xbc,0xab,0x9a,0x08,0x91,0xeb,0xce,0xbc,0xbb,
+0x9a,0x88,0x00,0xa9,0xce,0xcc,0xac,0xaa,0x89,0x10,0x80,0xdb,0xcd,0xbc,0xac,0x89,
+0x08,0x08,0x90,0xba,0xcc,0xab,0x9b,0x89,0x10,0x00,0xb9,0xcc,0xab,0x8a,0x08,0x80,
+0x88,0x51,0x46,0x35,0x24,0x22,0x01,0x00,0x21,0x54,0x44,0x34,0x33,0x01,0x88,0x18,
+0x64,0x54,0x33,0x24,0x11,0x80,0x08,0x10,0x63,0x44,0x23,0x13,0x81,0x80,0x08,0x20,
+0x33,0x35,0x23,0x13,0x80,0x99,0x08,0x43,0x34,0x01,0x98,0x09,0x20,0x80,0xee,0xcc,
+0xcb,0xba,0x99,0x88,0x00,0xb9,0xef,0xdb,0xba,0x9a,0x08,0x00,0xb8,0xce,0xcd,0xbc,
+0xaa,0x0a,0x20,0x01,0xfb,0xcd,0xbc,0xaa,0x99,0x98,0x88,0x00,0x63,0x35,0x25,0x13,
+0x01,0x98,0x00,0x43,0x45,0x32,0x13,0x11,0x00,0x00,0x98,0xcd,0xcd,0xab,0x9b,0x09,
+0x08,0x80,0xaa,0xbc,0xbc,0xba,0x9a,0x18,0x10,0x91,0xdc,0xcc,0xaa,0x89,0x08,0x00,
+0x88,0x99,0xaa,0xba,0xbb,0x89,0x21,0x23,0xd0,0xdd,0xbc,0xaa,0x89,0x00,0x10,0x41,
+0x45,0x45,0x33,0x23,0x12,0x00,0x30,0x44,0x35,0x34,0x33,0x12,0x80,0x08,0x51,0x56,
+0x34,0x34,0x12,0x00,0x89,0x10,0x63,0x35,0x35,0x32,0x11,0x90,0x08,0x21,0x36,0x35,
+0x32,0x11,0x00,0x80,0x18,0x42,0x54,0x43,0x13,0x01,0x88,0x89,0x20,0x32,0x33,0x24,
+0x01,0x90,0xba,0x8a,0x72,0x35,0x14,0x81,0x98,0x99,0x80,0xd9,0xcd,0xbd,0xba,0xa9,
+0x98,0xaa,0xba,0xcc,0xcc,0xbc,0xbb,0x9a,0x18,0xa0,0xed,0xbd,0xbd,0xaa,0x99,0x00,
+0x88,0xc9,0xcd,0xcc,0xba,0x9a,0x08,0x11,0x98,0xfb,0xcd,0xcb,0xaa,0x89,0x00,0x00,
+0x99,0xdb,0xba,0xab,0x8a,0x09,0x01,0x80,0xc9,0xcc,0xab,0x8a,0x11,0x12,0x01,0x31,
+0x47,0x45,0x23,0x02,0x80,0x09,0x41,0x55,0x44,0x32,0x22,0x80,0x88,0x10,0x55,0x35,
+0x25,0x23,0x02,0x80,0x88,0x20,0x45,0x35,0x43,0x11,0x00,0x88,0x80,0x21,0x32,0x43,
+0x33,0x21,0x88,0x98,0x18,0x52,0x33,0x12,0x01,0x00,0x02,0xd9,0xde,0xbc,0xbb,0xbb,
+0x9a,0x88,0x99,0xfb,0xbf,0xbd,0xab,0x9a,0x00,0x80,0xdb,0xdd,0xcc,0xbb,0xba,0x09,
+0x20,0x80,0xed,0xcd,0xbb,0xbb,0x99,0x88,0x08,0x20,0x64,0x44,0x24,0x22,0x80,0x88,
+0x00,0x53,0x44,0x23,0x13,0x01,0x00,0x81,0xa9,0xce,0xbd,0xbb,0x9a,0x08,0x00,0x98,
+0xba,0xbc,0xbc,0xaa,0x9a,0x09,0x10,0xa9,0xcd,0xbd,0xaa,0x89,0x00,0x00,0x98,0xa9,
+0xcb,0xbb,0x9b,0x10,0x44,0x02,0xd8,0xcc,0xbb,0x9a,0x88,0x00,0x10,0x52,0x55,0x43,
+0x33,0x22,0x00,0x00,0x31,0x45,0x53,0x33,0x33,0x22,0x00,0x08,0x61,0x56,0x44,0x32,
+0x12,0x90,0x88,0x20,0x55,0x44,0x23,0x23,0x10,0x88,0x08,0x41,0x35,0x35,0x23,0x02,
+0x88,0xa9,0x08,0x42,0x45,0x24,0x12,0x80,0x98,0x18,0x31,0x32,0x23,0x11,0x11,0x81,
+0x99,0xab,0x42,0x57,0x24,0x11,0x90,0x98,0x99,0xcc,0xce,0xbc,0xaa,0x99,0x80,0xa8,
+0xeb,0xcb,0xbb,0xac,0xaa,0x89,0x88,0xba,0xdf,0xcc,0xcb,0x9b,0x89,0x00,0x80,0xda,
+0xcc,0xbc,0xac,0x99,0x80,0x81,0xa8,0xec,0xcc,0xbb,0xab,0x98,0x00,0x80,0xb9,0xcc,
+0xcb,0xab,0x99,0x08,0x11,0x80,0xc9,0xdb,0xaa,0x8a,0x00,0x01,0x21,0x54,0x45,0x33,
+0x14,0x02,0x00,0x11,0x63,0x44,0x44,0x33,0x22,0x01,0x89,0x31,0x47,0x35,0x34,0x23,
+0x02,0x88,0x08,0x41,0x54,0x53,0x22,0x12,0x00,0x88,0x10,0x31,0x43,0x24,0x13,0x81,
+0x98,0x8a,0x28,0x42,0x24,0x22,0x01,0x90,0xb9,0xbe,0xbc,0xbc,0xbb,0xbd,0xba,0x99,
+0x98,0xfb,0xce,0xbc,0xab,0x89,0x08,0x90,0xda,0xdd,0xbc,0xbd,0x9a,0x09,0x12,0x90,
+0xde,0xbd,0xbc,0x9a,0x99,0x88,0x08,0x32,0x56,0x43,0x23,0x12,0x88,0x88,0x20,0x45,
+0x34,0x24,0x12,0x10,0x00,0x80,0xc9,0xdc,0xbc,0xbb,0x8a,0x08,0x00,0xa9,0xdb,0xbb,
+0xac,0x99,0x88,0x00,0x00,0xba,0xbe,0xad,0xaa,0x88,0x00,0x00,0x80,0xa9,0xbb,0xbd,
+0x9a,0x18,0x33,0x82,0xec,0xbc,0xab,0x89,0x10,0x01,0x11,0x63,0x54,0x34,0x24,0x22,
+0x10,0x00,0x20,0x34,0x45,0x33,0x23,0x12,0x01,0x11,0x55,0x55,0x34,0x23,0x12,0x88,
+0x88,0x42,0x46,0x34,0x24,0x12,0x01,0x88,0x08,0x42,0x54,0x33,0x33,0x01,0x98,0x88,
+0x31,0x64,0x33,0x24,0x12,0x01,0x88,0x00,0x21,0x53,0x22,0x02,0x98,0xa9,0x89,0x42,
+0x45,0x33,0x11,0x98,0x88,0x21,0x98,0xff,0xbd,0xac,0x9a,0x09,0x80,0xa8,0xcb,0xcc,
+0xbb,0xbc,0x9b,0x89,0x81,0xd9,0xcf,0xbc,0xbc,0xa9,0x08,0x80,0x90,0xdb,0xcd,0xbc,
+0xab,0x9a,0x00,0x81,0xd9,0xdd,0xcb,0xab,0x9a,0x88,0x00,0x88,0xba,0xcc,0xcb,0xaa,
+0x89,0x00,0x00,0x90,0xca,0xbb,0xbb,0xa9,0x88,0x08,0x52,0x46,0x35,0x34,0x22,0x81,
+0x80,0x20,0x64,0x54,0x33,0x24,0x02,0x00,0x88,0x32,0x47,0x44,0x43,0x12,0x01,0x88,
+0x18,0x52,0x44,0x33,0x23,0x02,0x80,0x08,0x10,0x32,0x35,0x24,0x13,0x90,0x99,0x89,
+0x42,0x34,0x12,0x81,0x00,0x11,0xb0,0xde,0xcc,0xaa,0xab,0xa9,0x9a,0x88,0xa9,0xef,
+0xbd,0xbc,0x9a,0x08,0x10,0xa8,0xdd,0xcc,0xdb,0xab,0x9a,0x18,0x12,0xb8,0xef,0xbc,
+0xbb,0x9a,0x99,0x88,0x08,0x62,0x54,0x33,0x14,0x02,0x88,0x88,0x21,0x54,0x43,0x22,
+0x12,0x01,0x00,0x80,0xca,0xce,0xcb,0xab,0x8a,0x00,0x80,0xa9,0xcb,0xac,0xab,0x99,
+0x88,0x00,0x88,0xcb,0xbd,0xac,0x9a,0x88,0x08,0x88,0x98,0xba,0xbc,0xad,0x9a,0x20,
+0x33,0x90,0xcd,0xad,0x9b,0x99,0x98,0x09,0x30,0x46,0x35,0x33,0x33,0x12,0x12,0x22,
+0x63,0x53,0x44,0x23,0x12,0x81,0x08,0x41,0x55,0x44,0x33,0x33,0x11,0x80,0x10,0x63,
+0x45,0x53,0x23,0x22,0x00,0x88,0x10,0x62,0x53,0x33,0x23,0x11,0x88,0x08,0x32,0x46,
+0x43,0x32,0x11,0x80,0x88,0x18,0x31,0x42,0x22,0x11,0x80,0x99,0x89,0x51,0x54,0x33,
+0x13,0x01,0x00,0x80,0xfa,0xce,0xcc,0xaa,0x8a,0x00,0x08,0xb9,0xcc,0xbc,0xbc,0xcb,
+0x9a,0x09,0x00,0xb9,0xff,0xbb,0xbc,0x99,0x08,0x80,0xb8,0xcd,0xbd,0xbb,0xbb,0x99,
+0x00,0x80,0xfb,0xcd,0xbc,0xab,0x9a,0x08,0x01,0x88,0xcb,0xbc,0xad,0x9a,0x09,0x00,
+0x00,0xa8,0xca,0xab,0xaa,0x89,0x98,0x00,0x63,0x45,0x35,0x33,0x22,0x00,0x00,0x41,
+0x64,0x44,0x43,0x33,0x12,0x80,0x88,0x42,0x56,0x34,0x24,0x12,0x81,0x88,0x28,0x54,
+0x53,0x23,0x12,0x01,0x08,0x00,0x21,0x33,0x44,0x22,0x02,0x90,0x89,0x18,0x42,0x23,
+0x12,0x01,0x32,0x23,0xd8,0xde,0xbc,0xcb,0xaa,0x9a,0x99,0x98,0xda,0xdd,0xbd,0xcb,
+0x99,0x09,0x00,0x99,0xdd,0xdc,0xcb,0xab,0x99,0x11,0x01,0xfb,0xcd,0xac,0xab,0x89,
+0x89,0x88,0x00,0x63,0x44,0x34,0x22,0x01,0x88,0x09,0x41,0x54,0x33,0x23,0x12,0x01,
+0x00,0x98,0xdd,0xcc,0xbb,0xab,0x08,0x80,0x90,0xca,0xca,0xaa,0xab,0xaa,0x89,0x00,
+0x81,0xdb,0xcd,0xbb,0x9a,0x08,0x00,0x88,0xa9,0xb9,0xcb,0xbb,0x0a,0x43,0x24,0x90,
+0xce,0xbb,0x8b,0x88,0x90,0xa9,0x28,0x66,0x34,0x34,0x23,0x22,0x01,0x01,0x32,0x55,
+0x34,0x24,0x02,0x90,0x09,0x41,0x46,0x35,0x43,0x12,0x01,0x88,0x08,0x62,0x54,0x43,
+0x22,0x02,0x80,0x09,0x21,0x54,0x43,0x33,0x21,0x80,0x98,0x00,0x42,0x45,0x43,0x12,
+0x81,0x88,0x88,0x21,0x22,0x22,0x22,0x22,0x22,0x80,0x9a,0x20,0x57,0x34,0x22,0x01,
+0x80,0x98,0xdd,0xdc,0xcb,0xaa,0x89,0x98,0xa9,0xcb,0xcb,0xbc,0xcc,0xcb,0x9a,0x00,
+0x00,0xda,0xdd,0xbc,0xbb,0xa9,0x88,0x88,0xca,0xdc,0xbc,0xbc,0xaa,0x88,0x11,0x90,
+0xfb,0xbe,0xbc,0x9b,0x8a,0x00,0x00,0x99,0xcb,0xbc,0xbb,0xab,0x89,0x10,0x02,0xb9,
+0xcd,0xab,0x89,0x01,0x81,0x99,0x40,0x66,0x34,0x24,0x12,0x01,0x18,0x31,0x45,0x45,
+0x33,0x23,0x82,0x88,0x18,0x65,0x44,0x24,0x23,0x01,0x80,0x88,0x31,0x45,0x44,0x32,
+0x12,0x00,0x08,0x00,0x21,0x43,0x43,0x33,0x02,0xa0,0x99,0x08,0x42,0x33,0x81,0x98,
+0x88,0x11,0xd9,0xdf,0xcb,0xac,0xaa,0x8a,0x09,0x80,0xc9,0xde,0xbc,0xac,0x9a,0x80,
+0x80,0xca,0xdd,0xdb,0xcb,0xaa,0x09,0x20,0x80,0xec,0xcd,0xbb,0xab,0x8a,0x88,0x09,
+0x20,0x64,0x44,0x43,0x12,0x80,0x88,0x10,0x53,0x44,0x32,0x22,0x01,0x10,0x80,0xb9,
+0xed,0xcb,0xbb,0x9a,0x08,0x80,0x98,0xca,0xbb,0xcb,0xba,0xa9,0x08,0x10,0x90,0xcd,
+0xcc,0xab,0x89,0x00,0x81,0x98,0xaa,0xaa,0x99,0x9a,0x89,0x11,0x23,0xc9,0xdf,0xac,
+0x9a,0x08,0x10,0x00,0x20,0x73,0x45,0x43,0x12,0x11,0x08,0x21,0x63,0x53,0x23,0x23,
+0x12,0x00,0x18,0x52,0x46,0x44,0x33,0x23,0x01,0x80,0x30,0x74,0x53,0x43,0x22,0x01,
+0x98,0x08,0x31,0x46,0x33,0x23,0x02,0x88,0x89,0x30,0x54,0x44,0x22,0x02,0x00,0x88,
+0x80,0x11,0x21,0x43,0x34,0x22,0x98,0xcb,0x0a,0x61,0x34,0x22,0x90,0xa9,0x89,0xa9,
+0xdd,0xcd,0xab,0x9b,0x89,0x88,0x99,0xdb,0xcc,0xbd,0xbb,0xab,0x88,0x00,0xda,0xdd,
+0xcc,0xba,0xab,0x9a,0x08,0x88,0xdb,0xcd,0xbc,0xbb,0x9b,0x88,0x01,0xa9,0xde,0xdc,
+0xbb,0xba,0x09,0x18,0x80,0xca,0xdb,0xab,0x9b,0x8a,0x08,0x01,0x81,0xb9,0xdc,0xba,
+0x09,0x00,0x81,0x89,0x51,0x56,0x34,0x22,0x01,0x08,0x10,0x63,0x44,0x44,0x32,0x13,
+0x81,0x89,0x20,0x57,0x34,0x24,0x22,0x01,0x08,0x18,0x41,0x44,0x44,0x32,0x11,0x80,
+0x08,0x18,0x42,0x42,0x22,0x22,0x01,0x98,0x99,0x08,0x43,0x34,0x12,0x00,0x08,0x90,
+0xea,0xcd,0xbc,0xab,0x9a,0x88,0x99,0xca,0xcd,0xcd,0xbc,0xbb,0x99,0x00,0x90,0xfb,
+0xcd,0xdb,0xbb,0xaa,0x08,0x12,0xa0,0xdf,0xcc,0xbb,0xab,0x98,0x88,0x88,0x30,0x65,
+0x34,0x24,0x12,0x80,0x88,0x20,0x44,0x44,0x32,0x21,0x01,0x10,0x80,0xba,0xcf,0xbc,
+0xba,0x99,0x08,0x00,0x99,0xbb,0xbc,0xac,0xab,0x99,0x08,0x80,0xb9,0xdd,0xcb,0x9a,
+0x09,0x00,0x00,0x80,0x99,0xcb,0xcb,0x9a,0x28,0x33,0x02,0xfb,0xbc,0xab,0x09,0x88,
+0x99,0x09,0x72,0x45,0x53,0x22,0x22,0x10,0x00,0x11,0x53,0x34,0x25,0x22,0x00,0x08,
+0x28,0x55,0x54,0x34,0x23,0x12,0x80,0x89,0x40,0x64,0x34,0x43,0x12,0x00,0x88,0x10,
+0x42,0x44,0x43,0x22,0x01,0x98,0xa9,0x9a,0x20,0x44,0x34,0x12,0x80,0x98,0x10,0x43,
+0x33,0x22,0x11,0x11,0x80,0xa9,0x8a,0x72,0x36,0x34,0x81,0xb8,0xba,0xa9,0xda,0xcd,
+0xbd,0xac,0x99,0x00,0x88,0xb9,0xcd,0xbc,0xbb,0x9a,0x89,0xa8,0xdc,0xcd,0xcc,0xab,
+0xaa,0x89,0x88,0xa8,0xdc,0xbc,0xbd,0xba,0x9a,0x09,0x80,0xb9,0xdf,0xbc,0xac,0x9b,
+0x88,0x08,0x98,0xbb,0xbd,0xab,0xab,0x89,0x88,0x01,0x98,0xdb,0xbc,0xaa,0x08,0x00,
+0x99,0x0a,0x65,0x36,0x25,0x02,0x00,0x08,0x32,0x36,0x44,0x43,0x23,0x12,0x81,0x88,
+0x42,0x56,0x44,0x33,0x22,0x01,0x80,0x09,0x52,0x44,0x34,0x33,0x01,0x80,0x08,0x21,
+0x43,0x43,0x32,0x12,0x81,0x98,0x08,0x32,0x36,0x12,0x90,0x98,0x00,0x11,0xfb,0xcd,
+0xbc,0xaa,0x89,0x88,0x88,0xc9,0xec,0xcc,0xac,0xaa,0x88,0x00,0xa8,0xdc,0xdc,0xdb,
+0xab,0x9b,0x00,0x11,0xc0,0xed,0xbc,0xbb,0x9b,0x99,0x88,0x08,0x53,0x46,0x43,0x23,
+0x11,0x88,0x88,0x31,0x45,0x34,0x33,0x22,0x10,0x00,0x88,0xda,0xdd,0xcb,0x9b,0x8a,
+0x00,0x88,0xa9,0xbc,0xbb,0xaa,0x9b,0x99,0x88,0x90,0xdb,0xbd,0xbc,0xaa,0x88,0x88,
+0x08,0x09,0x99,0xda,0xdb,0x9a,0x10,0x33,0x83,0xdc,0xcd,0xaa,0x89,0x00,0x10,0x10,
+0x43,0x45,0x43,0x24,0x12,0x01,0x88,0x10,0x53,0x35,0x24,0x22,0x10,0x00,0x32,0x46,
+0x54,0x43,0x32,0x11,0x88,0x89,0x42,0x37,0x25,0x23,0x02,0x80,0x08,0x31,0x44,0x34,
+0x24,0x23,0x01,0x90,0x88,0x31,0x46,0x43,0x23,0x11,0x08,0x08,0x10,0x21,0x21,0x22,
+0x23,0x81,0xca,0x8b,0x71,0x44,0x33,0x01,0x88,0x80,0x81,0xfb,0xdd,0xcb,0xaa,0x89,
+0x98,0xa9,0xcb,0xdb,0xbb,0xbd,0xbb,0x99,0x00,0xa0,0xdd,0xcd,0xac,0xbb,0xaa,0x99,
+0x89,0xa8,0xcc,0xce,0xcb,0xab,0x8a,0x00,0x88,0xeb,0xcd,0xcb,0xba,0x99,0x08,0x00,
+0x98,0xcb,0xbc,0xac,0xaa,0x88,0x10,0x10,0x90,0xca,0xbb,0xbb,0x8a,0x88,0x21,0x55,
+0x35,0x35,0x33,0x23,0x01,0x80,0x10,0x56,0x55,0x33,0x24,0x11,0x88,0x09,0x42,0x55,
+0x34,0x24,0x12,0x81,0x88,0x10,0x44,0x35,0x33,0x23,0x01,0x80,0x08,0x20,0x53,0x44,
+0x32,0x11,0xa8,0x99,0x18,0x33,0x34,0x11,0x11,0x11,0x81,0xdc,0xcc,0xcb,0xbb,0xcb,
+0xaa,0x09,0x00,0xd9,0xcf,0xbc,0xbb,0x98,0x80,0x98,0xc9,0xdc,0xcd,0xbc,0xac,0x89,
+0x00,0x81,0xeb,0xcd,0xbb,0xbb,0x9a,0x89,0x88,0x21,0x54,0x44,0x34,0x33,0x12,0x99,
+0x89,0x74,0x46,0x43,0x23,0x22,0x01,0x11,0x01,0xca,0xcd,0xac,0x9b,0x8a,0x99,0xb9,
+0xbd,0xcc,0xbb,0xcb,0xab,0xaa,0x9a,0xba,0xcc,0xbb,0xab,0x9a,0x08,0x10,0x32,0x34,
+0x25,0x33,0x34,0x45,0x44,0x33,0x34,0x32,0x32,0x32,0x33,0x43,0x32,0x22,0x32,0x32,
+0x22,0x80,0xcc,0xbe,0xad,0xcb,0xba,0xcc,0xdb,0xcb,0xba,0xbb,0xba,0x99,0x09,0x00,
+0x80,0x98,0x99,0x51,0x47,0x35,0x35,0x33,0x33,0x33,0x44,0x53,0x53,0x33,0x33,0x33,
+0x22,0x21,0x32,0x34,0x43,0x22,0x01,0xa9,0xeb,0xbb,0xcc,0xca,0xbb,0xbd,0xbc,0xbc,
+0xbb,0xbb,0xba,0xaa,0xaa,0xbb,0xab,0x9a,0x10,0x32,0x43,0x53,0x54,0x44,0x34,0x44,
+0x33,0x43,0x33,0x24,0x33,0x32,0x24,0x32,0x01,0xa9,0xcc,0xcb,0xaa,0xba,0xcb,0xdd,
+0xdb,0xbc,0xcb,0xcb,0xaa,0xba,0xbb,0xbd,0xbd,0xbb,0xac,0x99,0x89,0x80,0x00,0x80,
+0x10,0x31,0x63,0x44,0x34,0x34,0x43,0x32,0x32,0x24,0x33,0x32,0x33,0x33,0x34,0x24,
+0x12,0x90,0xba,0xcc,0xba,0xa9,0xa9,0xeb,0xdc,0xbd,0xbc,0xac,0x8a,0x08,0x20,0x01,
+0x90,0xba,0xaa,0x40,0x57,0x34,0x34,0x32,0x22,0x32,0x44,0x34,0x35,0x43,0x32,0x22,
+0x22,0x22,0x33,0x33,0x23,0x12,0x80,0xa9,0xdc,0xcc,0xbc,0xbc,0xbd,0xdb,0xbb,0xbc,
+0xbb,0xbc,0xcb,0xcb,0xba,0xa9,0x9a,0x99,0x99,0xaa,0xdb,0xbb,0x9a,0x62,0x35,0x24,
+0x81,0xba,0xab,0x28,0x63,0x33,0x43,0x63,0x54,0x34,0x43,0x11,0x80,0x99,0x89,0x20,
+0x43,0x23,0x01,0xca,0xcc,0xdb,0xcb,0xbd,0xbc,0xac,0x9a,0x89,0x89,0x98,0x9a,0xaa,
+0x8a,0x08,0x32,0x36,0x44,0x32,0x33,0x43,0x43,0x43,0x43,0x32,0x22,0x23,0x11,0x01,
+0x08,0x00,0x88,0xeb,0xcd,0xbc,0xbc,0xac,0xcb,0xbc,0xbc,0xcb,0xaa,0xaa,0xa9,0xab,
+0xac,0xba,0x99,0x08,0x33,0x46,0x43,0x33,0x44,0x42,0x43,0x44,0x34,0x33,0x24,0x22,
+0x12,0x32,0x43,0x34,0x24,0x13,0x11,0x98,0x99,0x08,0x00,0x81,0xc9,0xdd,0xcc,0xcb,
+0xbb,0xbb,0xaa,0xa9,0xba,0xbd,0xcb,0xaa,0x09,0x00,0x32,0x34,0x44,0x43,0x24,0x34,
+0x44,0x44,0x33,0x34,0x33,0x33,0x33,0x33,0x12,0x12,0x12,0x12,0x80,0xdb,0xcd,0xcc,
+0xcb,0xcb,0xcb,0xbb,0xbc,0xbc,0xbd,0xdb,0xba,0xba,0xaa,0xa9,0xaa,0xca,0xbb,0xbc,
+0x99,0x28,0x53,0x24,0x23,0x01,0x00,0x31,0x65,0x53,0x43,0x22,0x11,0x81,0x80,0x00,
+0x10,0x11,0x00,0xc9,0xdc,0xdb,0xbb,0xcb,0xcb,0xbc,0xbd,0xcb,0xba,0xab,0xbb,0xcb,
+0xcb,0xab,0x9b,0x09,0x43,0x44,0x33,0x33,0x43,0x54,0x44,0x44,0x33,0x43,0x23,0x32,
+0x32,0x53,0x43,0x24,0x23,0x11,0x01,0x80,0x80,0x80,0x88,0xa9,0xdb,0xcc,0xbc,0xbd,
+0xbb,0xcc,0xba,0xbb,0xac,0xab,0xbb,0xcb,0xbb,0xba,0x9a,0x88,0x31,0x54,0x34,0x33,
+0x23,0x53,0x54,0x44,0x24,0x33,0x22,0x01,0x88,0x9a,0x08,0x41,0x33,0xc1,0xef,0xcc,
+0xbb,0xab,0xaa,0xaa,0xbb,0xaa,0x19,0x42,0x23,0xb0,0xdd,0xbb,0x0a,0x52,0x44,0x32,
+0x22,0x21,0x32,0x33,0x91,0xdc,0xbc,0x89,0x62,0x53,0x33,0x22,0x02,0x00,0x80,0x10,
+0x32,0x33,0x02,0xfb,0xdc,0xbb,0xcb,0xba,0xcb,0xdb,0xcb,0xbc,0xbc,0xbc,0xba,0xab,
+0xaa,0xbb,0xdb,0xba,0xaa,0x09,0x10,0x42,0x53,0x44,0x53,0x43,0x33,0x43,0x43,0x43,
+0x32,0x24,0x32,0x32,0x23,0x13,0x12,0x11,0x21,0x43,0x22,0x91,0xcc,0xbd,0xcc,0xba,
+0xba,0xac,0xbb,0xcc,0xcb,0xac,0xab,0x99,0x00,0x12,0x11,0x00,0x10,0x53,0x46,0x44,
+0x34,0x43,0x33,0x34,0x43,0x34,0x43,0x32,0x43,0x32,0x22,0x12,0x11,0x01,0x02,0x80,
+0xda,0xdc,0xbb,0xad,0xbc,0xdb,0xbc,0xcb,0xbb,0xbb,0xbb,0xbb,0xcb,0xbb,0xac,0xab,
+0x9a,0x08,0x31,0x32,0x23,0x12,0x52,0x55,0x54,0x43,0x24,0x23,0x11,0x11,0x10,0x32,
+0x53,0x32,0x80,0xea,0xcc,0xac,0xaa,0xaa,0xb9,0xdb,0xcc,0xbc,0xbc,0xbc,0xba,0xbb,
+0xab,0xbc,0xcb,0xbb,0xab,0x9a,0x09,0x10,0x53,0x54,0x43,0x24,0x33,0x34,0x43,0x34,
+0x34,0x53,0x32,0x23,0x23,0x11,0x21,0x32,0x44,0x43,0x22,0x02,0xa9,0xcb,0xbc,0x9a,
+0x89,0xa9,0xfb,0xcc,0xcb,0xba,0x9a,0x9a,0x98,0x99,0x99,0xa9,0x89,0x20,0x46,0x44,
+0x43,0x33,0x34,0x44,0x33,0x34,0x43,0x33,0x33,0x33,0x34,0x33,0x23,0x81,0xc9,0xbc,
+0xbc,0xca,0xca,0xcc,0xbc,0xcd,0xcb,0xbc,0xba,0xaa,0xa9,0xcb,0xdc,0xcb,0xba,0x9a,
+0x89,0x89,0x08,0x42,0x45,0x34,0x24,0x12,0x11,0x22,0x63,0x53,0x33,0x24,0x21,0x11,
+0x11,0x01,0xa0,0xdb,0xcb,0xbb,0x99,0x98,0xa9,0xdc,0xcb,0xbc,0xcb,0xcb,0xba,0xab,
+0xbb,0xbc,0xbc,0xac,0xaa,0x99,0x89,0x88,0x00,0x22,0x33,0x35,0x44,0x34,0x35,0x34,
+0x43,0x33,0x33,0x34,0x33,0x43,0x32,0x43,0x23,0x23,0x12,0x98,0xba,0xcd,0xbb,0xbc,
+0xcb,0xcc,0xcc,0xdb,0xbb,0xac,0xaa,0x99,0x88,0x99,0xa9,0xbb,0x8a,0x51,0x46,0x44,
+0x32,0x33,0x23,0x33,0x45,0x44,0x34,0x24,0x23,0x22,0x21,0x21,0x33,0x34,0x33,0x23,
+0x82,0xa9,0xbc,0xcc,0xba,0xbc,0xcc,0xcc,0xcb,0xcb,0xbb,0xba,0xab,0xba,0xbb,0xcb,
+0xbb,0x9a,0x99,0x80,0x00,0x22,0x46,0x44,0x43,0x34,0x34,0x34,0x24,0x24,0x23,0x33,
+0x33,0x13,0x01,0x88,0x9a,0xaa,0xa9,0xcc,0xdd,0xcc,0xbc,0xcc,0xca,0xaa,0xbb,0xbc,
+0xbc,0xbd,0xcb,0xbb,0xaa,0x9a,0x9a,0xa9,0xa9,0x9a,0x08,0x52,0x34,0x45,0x42,0x33,
+0x43,0x43,0x33,0x34,0x33,0x42,0x32,0x33,0x43,0x32,0x11,0x01,0x89,0xaa,0xaa,0xaa,
+0xb9,0xed,0xcd,0xcd,0xbb,0xbb,0x99,0x08,0x88,0xa9,0xbd,0xac,0x9a,0x31,0x46,0x34,
+0x33,0x33,0x33,0x34,0x36,0x44,0x43,0x43,0x32,0x32,0x22,0x33,0x43,0x32,0x23,0x11,
+0x11,0x00,0xb9,0xdd,0xcc,0xcb,0xcb,0xbb,0xbc,0xbc,0xbd,0xcb,0xcb,0xba,0xaa,0xa9,
+0xa9,0xab,0xcb,0xcb,0xbb,0xab,0x20,0x64,0x33,0x82,0xa9,0xac,0x19,0x63,0x43,0x43,
+0x43,0x44,0x35,0x43,0x22,0x10,0x88,0x09,0x10,0x43,0x33,0x02,0xa8,0xeb,0xcb,0xcc,
+0xcc,0xbc,0xbc,0xaa,0xa9,0x98,0xa9,0xbb,0xbb,0xab,0x89,0x10,0x43,0x35,0x43,0x22,
+0x33,0x54,0x44,0x43,0x23,0x23,0x32,0x22,0x12,0x12,0x22,0x22,0x81,0xda,0xcd,0xbc,
+0xac,0xbb,0xbd,0xdb,0xcb,0xca,0xba,0xba,0xbb,0xac,0xbb,0xbb,0xac,0x99,0x20,0x42,
+0x24,0x34,0x43,0x44,0x44,0x43,0x34,0x33,0x43,0x32,0x33,0x34,0x34,0x34,0x32,0x12,
+0x01,0x00,0x00,0x10,0x01,0x80,0xea,0xcc,0xbd,0xbc,0xcb,0xaa,0xab,0xac,0xcb,0xbb,
+0xbb,0xab,0xaa,0x89,0x00,0x32,0x44,0x53,0x53,0x53,0x53,0x33,0x35,0x43,0x33,0x34,
+0x32,0x23,0x21,0x22,0x32,0x32,0x11,0xa8,0xdc,0xcc,0xbc,0xbc,0xbb,0xbc,0xcc,0xbc,
+0xbd,0xbc,0xab,0xbb,0xaa,0xba,0xca,0xdb,0xba,0xbb,0x9a,0x20,0x33,0x25,0x01,0x88,
+0x09,0x73,0x54,0x34,0x33,0x33,0x21,0x11,0x11,0x22,0x33,0x34,0x02,0xa8,0xcd,0xcb,
+0xac,0xcb,0xcb,0xbc,0xbc,0xbc,0xcb,0xcb,0xbb,0xcb,0xbb,0xba,0x9a,0x09,0x21,0x22,
+0x22,0x33,0x57,0x54,0x53,0x24,0x43,0x22,0x23,0x43,0x43,0x34,0x43,0x23,0x13,0x12,
+0x11,0x11,0x11,0x11,0x01,0xa9,0xcd,0xcc,0xbb,0xbc,0xbc,0xbc,0xad,0xbb,0xac,0xba,
+0xbb,0xcb,0xbb,0xab,0xba,0x99,0x10,0x43,0x43,0x12,0x11,0x54,0x55,0x34,0x34,0x32,
+0x23,0x02,0x88,0x00,0x42,0x35,0x13,0xfa,0xcd,0xbb,0xbb,0xaa,0xaa,0xbb,0xab,0x10,
+0x34,0x13,0xd9,0xcd,0xbc,0x9a,0x08,0x32,0x34,0x12,0x10,0x10,0x32,0x13,0xea,0xdd,
+0xaa,0x18,0x54,0x34,0x33,0x22,0x22,0x12,0x32,0x42,0x43,0x33,0x02,0xba,0xcd,0xbb,
+0xbb,0xdb,0xbc,0xcc,0xcb,0xbc,0xbd,0xcb,0xbb,0xba,0xaa,0xcb,0xcb,0xba,0x9b,0x8a,
+0x88,0x21,0x53,0x44,0x34,0x34,0x34,0x42,0x33,0x44,0x33,0x34,0x33,0x33,0x32,0x23,
+0x23,0x33,0x43,0x24,0x22,0x80,0xdb,0xcc,0xba,0xa9,0xaa,0xcc,0xcc,0xbc,0xbc,0xcb,
+0x9a,0x99,0x88,0x08,0x89,0xaa,0x89,0x41,0x55,0x44,0x42,0x22,0x33,0x34,0x44,0x43,
+0x43,0x33,0x43,0x32,0x22,0x22,0x32,0x22,0x13,0x82,0xb8,0xdc,0xbc,0xbd,0xbc,0xcc,
+0xcb,0xcb,0xbb,0xac,0xab,0xbb,0xac,0xbb,0xac,0xaa,0x89,0x09,0x88,0x80,0x00,0x21,
+0x53,0x45,0x35,0x34,0x24,0x23,0x33,0x32,0x44,0x33,0x33,0x22,0x98,0xdb,0xbc,0xac,
+0xaa,0x99,0xda,0xcc,0xcc,0xbc,0xcb,0xbb,0xcb,0xac,0xbb,0xbb,0xbc,0xbb,0xab,0xab,
+0x9a,0x88,0x41,0x54,0x53,0x33,0x34,0x33,0x44,0x34,0x44,0x33,0x43,0x32,0x12,0x22,
+0x22,0x53,0x43,0x33,0x12,0x81,0xa9,0xbb,0xaa,0x88,0x98,0xfb,0xcd,0xcc,0xcb,0xaa,
+0xaa,0xa9,0xa9,0xa9,0xba,0xba,0x9b,0x09,0x43,0x46,0x43,0x33,0x34,0x43,0x34,0x44,
+0x43,0x33,0x33,0x43,0x33,0x23,0x13,0x11,0x88,0x99,0x99,0xbc,0xbe,0xbe,0xcd,0xbc,
+0xbc,0xac,0xab,0xba,0xdb,0xcc,0xcb,0xbb,0xaa,0x9a,0x9a,0x99,0x10,0x54,0x44,0x33,
+0x22,0x12,0x12,0x53,0x45,0x43,0x43,0x22,0x22,0x12,0x11,0x81,0xb8,0xcb,0xac,0x89,
+0x88,0xa0,0xdb,0xcc,0xcb,0xbb,0xbc,0xcb,0xbb,0xbc,0xbc,0xbc,0xac,0xab,0x9a,0x9a,
+0xaa,0x9a,0x89,0x00,0x32,0x54,0x53,0x43,0x33,0x44,0x42,0x42,0x33,0x34,0x33,0x33,
+0x43,0x33,0x43,0x32,0x11,0x00,0x99,0xa9,0xbb,0xcc,0xcc,0xcc,0xdb,0xcb,0xbc,0xba,
+0xbb,0xaa,0xba,0xcb,0xcb,0xab,0x9a,0x21,0x55,0x43,0x33,0x33,0x33,0x45,0x34,0x45,
+0x43,0x32,0x33,0x23,0x33,0x43,0x34,0x33,0x24,0x22,0x00,0x90,0xa9,0xba,0xbc,0xbd,
+0xcc,0xdb,0xcb,0xcb,0xcb,0xba,0xab,0xbb,0xbb,0xac,0xbb,0xba,0xab,0xab,0x89,0x21,
+0x54,0x44,0x43,0x33,0x44,0x33,0x35,0x34,0x34,0x24,0x22,0x11,0x81,0x00,0x11,0x11,
+0x00,0xba,0xce,0xcd,0xcb,0xbb,0xbc,0xba,0xbc,0xcd,0xbc,0xbc,0xcb,0xaa,0xa9,0xa9,
+0xaa,0xba,0xab,0xaa,0x08,0x31,0x46,0x43,0x33,0x24,0x34,0x44,0x43,0x33,0x33,0x43,
+0x32,0x34,0x32,0x23,0x22,0x12,0x80,0x90,0x98,0x88,0xca,0xde,0xcd,0xcb,0xbb,0xba,
+0xa9,0xaa,0xcb,0xcb,0xbc,0xaa,0x09,0x52,0x34,0x34,0x33,0x33,0x35,0x34,0x45,0x43,
+0x43,0x33,0x43,0x22,0x22,0x33,0x24,0x32,0x21,0x01,0x80,0xba,0xce,0xbc,0xbc,0xcc,
+0xbb,0xcc,0xbb,0xbb,0xbc,0xbc,0xbb,0xbb,0xab,0x9a,0x9a,0xba,0xba,0xba,0x89,0x72,
+0x46,0x53,0x22,0x01,0x80,0x08,0x22,0x44,0x23,0x34,0x44,0x54,0x32,0x23,0x81,0xb9,
+0xba,0x89,0x10,0x12,0xb8,0xdf,0xcb,0xcb,0xba,0xbd,0xcc,0xcb,0xaa,0x99,0x88,0x00,
+0x08,0x00,0x00,0x22,0x54,0x44,0x53,0x23,0x33,0x22,0x12,0x33,0x24,0x33,0x13,0x01,
+0x98,0xcb,0xbd,0xbd,0xbb,0xbd,0xbd,0xbd,0xbc,0xbc,0xbb,0xbb,0xbb,0xac,0xaa,0x9a,
+0x88,0x10,0x31,0x53,0x44,0x34,0x44,0x43,0x43,0x43,0x33,0x43,0x32,0x24,0x43,0x32,
+0x32,0x12,0x11,0x00,0x00,0x11,0x01,0xa9,0xdd,0xbd,0xbd,0xbc,0xbb,0xbb,0xac,0xbb,
+0xbc,0xcb,0xba,0x99,0x00,0x32,0x35,0x34,0x34,0x53,0x43,0x53,0x43,0x34,0x43,0x33,
+0x23,0x33,0x34,0x33,0x33,0x23,0x00,0x98,0xca,0xdc,0xbc,0xcc,0xcb,0xbb,0xbc,0xbc,
+0xbc,0xbb,0xbb,0xbc,0xbb,0xba,0xab,0x9a,0x9a,0x99,0x09,0x31,0x55,0x35,0x35,0x43,
+0x43,0x32,0x33,0x33,0x44,0x33,0x33,0x13,0xa8,0xcc,0xac,0xab,0xb9,0xca,0xdc,0xdb,
+0xcb,0xbc,0xcb,0xbb,0xac,0xbb,0xbb,0xdb,0xba,0xab,0xaa,0x89,0x00,0x33,0x46,0x34,
+0x34,0x34,0x33,0x44,0x43,0x43,0x43,0x32,0x32,0x12,0x12,0x22,0x22,0x34,0x33,0x13,
+0xa0,0xdc,0xdb,0xbb,0xac,0xba,0xca,0xcb,0xbc,0xbc,0xba,0xaa,0x9a,0x98,0x08,0x10,
+0x31,0x44,0x44,0x44,0x43,0x34,0x43,0x53,0x32,0x43,0x22,0x22,0x22,0x23,0x33,0x22,
+0x11,0x98,0xdc,0xcd,0xbc,0xbb,0xcb,0xcb,0xbc,0xcd,0xbb,0xbc,0xbb,0xba,0xa9,0xa9,
+0xcb,0xcd,0xbb,0xaa,0x09,0x11,0x32,0x44,0x54,0x44,0x43,0x33,0x23,0x12,0x22,0x34,
+0x44,0x23,0x23,0x11,0x00,0x90,0xb9,0xdd,0xcc,0xcb,0xaa,0xaa,0xab,0xbc,0xcb,0xac,
+0xbb,0xac,0xaa,0x9a,0x99,0x89,0x99,0x89,0x10,0x44,0x44,0x43,0x43,0x34,0x43,0x43,
+0x32,0x32,0x43,0x32,0x22,0x11,0x10,0x08,0x88,0xca,0xcc,0xcb,0xcb,0xca,0xcb,0xbd,
+0xcc,0xbb,0xcb,0xaa,0xaa,0xab,0xab,0xab,0x9a,0x18,0x52,0x54,0x44,0x43,0x33,0x43,
+0x33,0x34,0x45,0x33,0x24,0x23,0x13,0x22,0x21,0x23,0x33,0x23,0x02,0xa8,0xcd,0xcc,
+0xac,0xac,0xcb,0xbb,0xbd,0xcb,0xba,0xbb,0xab,0xab,0xaa,0x99,0x8a,0x18,0x42,0x55,
+0x43,0x34,0x34,0x44,0x43,0x33,0x34,0x33,0x32,0x43,0x22,0x23,0x12,0x11,0x88,0xcb,
+0xcd,0xbc,0xbc,0xbb,0xbc,0xcd,0xcb,0xbc,0xbb,0xcb,0xaa,0xba,0xaa,0xbb,0xcb,0xab,
+0xab,0x19,0x42,0x44,0x43,0x22,0x31,0x42,0x54,0x53,0x33,0x33,0x22,0x12,0x11,0x10,
+0x01,0x01,0x80,0xcb,0xdd,0xbc,0xcc,0xca,0xbb,0xbd,0xbc,0xcb,0xba,0xaa,0xbb,0xbb,
+0xbc,0xab,0x89,0x20,0x54,0x34,0x34,0x24,0x23,0x44,0x44,0x53,0x33,0x24,0x22,0x22,
+0x21,0x32,0x34,0x33,0x24,0x01,0x98,0xba,0xcb,0xbb,0xbc,0xbc,0xcd,0xdb,0xcb,0xab,
+0xbb,0xaa,0xba,0xba,0xcb,0x9a,0x89,0x10,0x21,0x34,0x44,0x53,0x34,0x34,0x35,0x34,
+0x33,0x33,0x33,0x34,0x34,0x23,0x12,0xa0,0xeb,0xcc,0xba,0xab,0xaa,0xeb,0xdc,0xbc,
+0xbd,0xab,0xbb,0xba,0xaa,0x9a,0x08,0x32,0x34,0x22,0x80,0x00,0x54,0x45,0x35,0x34,
+0x33,0x33,0x34,0x24,0x22,0x02,0x98,0x99,0x00,0x22,0x23,0xa0,0xdc,0xcc,0xcb,0xbb,
+0xbc,0xca,0xca,0xbc,0xbd,0xbc,0xbb,0xba,0xba,0xba,0xac,0xaa,0x9a,0x99,0x00,0x53,
+0x44,0x24,0x33,0x33,0x54,0x53,0x33,0x34,0x23,0x24,0x23,0x33,0x33,0x23,0x21,0x00,
+0xa8,0xca,0xbc,0xdb,0xdb,0xcc,0xdb,0xcb,0xbb,0xba,0xba,0xba,0xcb,0xcb,0xaa,0x8a,
+0x10,0x44,0x44,0x33,0x24,0x33,0x43,0x35,0x45,0x33,0x34,0x32,0x22,0x32,0x33,0x34,
+0x43,0x22,0x12,0x90,0xc9,0xbb,0xcc,0xbb,0xcc,0xcc,0xcb,0xcb,0xab,0xbb,0xbb,0xab,
+0xbb,0xcb,0xaa,0x9a,0x09,0x21,0x43,0x43,0x44,0x44,0x34,0x34,0x34,0x34,0x33,0x43,
+0x32,0x33,0x23,0x23,0x01,0xb9,0xcc,0xbc,0xcb,0xbc,0xcb,0xcc,0xdb,0xbc,0xbc,0xbb,
+0xbb,0xba,0xbc,0xbc,0xad,0xbb,0xaa,0x88,0x18,0x12,0x33,0x33,0x35,0x44,0x44,0x53,
+0x33,0x43,0x22,0x23,0x32,0x32,0x23,0x22,0x12,0x01,0x80,0xb9,0xdc,0xcc,0xbc,0xbd,
+0xcc,0xbb,0xcb,0xba,0xcb,0xbb,0xbc,0xab,0x8a,0x20,0x43,0x24,0x33,0x43,0x44,0x44,
+0x53,0x34,0x33,0x34,0x24,0x32,0x33,0x33,0x34,0x43,0x22,0x12,0x01,0x98,0xa8,0xba,
+0xdc,0xbc,0xbd,0xbc,0xbd,0xcb,0xbc,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0x8a,
+0x40,0x45,0x44,0x43,0x33,0x43,0x32,0x43,0x34,0x35,0x34,0x12,0x98,0xca,0xcb,0xa9,
+0x99,0xaa,0xbb,0x9a,0x41,0x53,0x81,0xeb,0xbe,0xad,0xaa,0x89,0x10,0x00,0x99,0xba,
+0xab,0x88,0x98,0xdc,0xad,0x9b,0x31,0x37,0x35,0x33,0x34,0x42,0x22,0x23,0x33,0x34,
+0x33,0x12,0x98,0xbb,0xcc,0xba,0xcc,0xbc,0xcc,0xcb,0xbc,0xbc,0xbc,0xac,0xab,0xba,
+0xbb,0xcb,0xba,0x9a,0x8a,0x18,0x42,0x54,0x43,0x34,0x43,0x43,0x43,0x33,0x34,0x33,
+0x34,0x23,0x33,0x32,0x22,0x22,0x12,0x12,0x00,0xba,0xce,0xdc,0xcb,0xcb,0xbb,0xcb,
+0xbb,0xbc,0xcb,0xcb,0xba,0xa9,0x09,0x00,0x22,0x32,0x44,0x34,0x45,0x43,0x34,0x34,
+0x53,0x42,0x22,0x23,0x33,0x33,0x34,0x23,0x13,0x01,0x88,0xba,0xcb,0xbd,0xcc,0xbc,
+0xcc,0xbb,0xbd,0xcb,0xcb,0xaa,0xab,0xba,0xba,0xaa,0x9b,0x9a,0x88,0x21,0x63,0x34,
+0x35,0x34,0x43,0x43,0x43,0x43,0x43,0x32,0x32,0x21,0x01,0x08,0x88,0x88,0x99,0xeb,
+0xcd,0xcc,0xdb,0xbb,0xbc,0xbb,0xbc,0xcb,0xac,0xcb,0xba,0xba,0xab,0xa9,0x89,0x08,
+0x21,0x42,0x44,0x34,0x44,0x43,0x43,0x34,0x43,0x23,0x33,0x33,0x22,0x33,0x33,0x34,
+0x23,0x12,0xa0,0xcc,0xbc,0xbb,0xbb,0xcb,0xcc,0xcd,0xbc,0xcb,0xab,0x9a,0x89,0x80,
+0x88,0x89,0x89,0x20,0x46,0x44,0x43,0x43,0x43,0x43,0x33,0x34,0x34,0x33,0x24,0x33,
+0x32,0x23,0x23,0x11,0x98,0xcb,0xbd,0xcc,0xbb,0xbd,0xbc,0xcd,0xcb,0xbb,0xbb,0xbb,
+0xbb,0xcb,0xbb,0xbd,0xbb,0xbb,0x89,0x30,0x35,0x22,0x88,0xba,0x18,0x56,0x35,0x34,
+0x34,0x43,0x44,0x43,0x22,0x12,0x00,0x88,0x00,0x21,0x22,0x01,0xb9,0xcd,0xdb,0xcc,
+0xbc,0xbd,0xbc,0xba,0xaa,0x99,0x9a,0xba,0xba,0xab,0x89,0x20,0x44,0x44,0x24,0x33,
+0x34,0x34,0x44,0x32,0x24,0x22,0x22,0x22,0x22,0x11,0x01,0x80,0xa9,0xcd,0xcd,0xcb,
+0xcb,0xcb,0xdb,0xbb,0xac,0xbb,0xab,0xab,0xbb,0xac,0xab,0x99,0x19,0x41,0x54,0x43,
+0x34,0x42,0x33,0x54,0x43,0x43,0x23,0x24,0x12,0x22,0x22,0x22,0x43,0x23,0x23,0x81,
+0xba,0xbd,0xbc,0xba,0xdb,0xdb,0xcc,0xcb,0xcb,0xaa,0x9b,0x9a,0x99,0xa9,0xa9,0x99,
+0x10,0x52,0x53,0x34,0x35,0x34,0x53,0x33,0x34,0x44,0x32,0x33,0x24,0x22,0x23,0x21,
+0x01,0x88,0xca,0xcb,0xbc,0xcc,0xbb,0xbd,0xbc,0xcc,0xbb,0xcb,0xba,0xba,0xab,0xcb,
+0xbb,0xcb,0xba,0x99,0x20,0x43,0x43,0x32,0x32,0x44,0x45,0x53,0x43,0x23,0x13,0x02,
+0x10,0x00,0x21,0x22,0x02,0xb8,0xec,0xbc,0xcc,0xbb,0xdb,0xca,0xbb,0xcd,0xbb,0xcb,
+0xab,0xbb,0xca,0xba,0xaa,0x89,0x11,0x32,0x34,0x35,0x44,0x43,0x34,0x44,0x33,0x25,
+0x33,0x23,0x33,0x43,0x43,0x33,0x23,0x12,0x81,0x99,0xba,0xab,0xbb,0xcc,0xcd,0xbd,
+0xbd,0xac,0xbb,0xab,0xbb,0xba,0xac,0xab,0xab,0x8a,0x20,0x44,0x34,0x34,0x34,0x53,
+0x53,0x33,0x35,0x33,0x43,0x32,0x43,0x32,0x32,0x21,0x00,0x98,0xba,0xdb,0xbc,0xbd,
+0xbd,0xbd,0xcc,0xcb,0xab,0xab,0xbb,0xdb,0xdb,0xbb,0xbb,0xaa,0x9a,0x88,0x20,0x63,
+0x44,0x34,0x43,0x22,0x23,0x34,0x44,0x43,0x43,0x22,0x12,0x12,0x21,0x00,0x98,0xbc,
+0xcc,0xab,0xab,0xbb,0xdb,0xcc,0xbc,0xbc,0xcb,0xba,0xab,0xab,0xbb,0xbc,0xcb,0xaa,
+0x89,0x10,0x32,0x34,0x44,0x43,0x53,0x33,0x35,0x34,0x24,0x23,0x23,0x32,0x32,0x33,
+0x33,0x22,0x00,0x98,0xca,0xcc,0xcc,0xbc,0xcc,0xbc,0xbc,0xbc,0xbb,0xac,0xbb,0xcb,
+0xba,0xaa,0x99,0x10,0x32,0x34,0x35,0x34,0x44,0x43,0x44,0x43,0x43,0x32,0x33,0x32,
+0x34,0x33,0x24,0x23,0x13,0x11,0x90,0xa9,0xcb,0xbc,0xcb,0xcc,0xcc,0xbc,0xbc,0xbb,
+0xcb,0xba,0xba,0xbb,0xbb,0xbb,0xaa,0x19,0x41,0x45,0x43,0x43,0x43,0x43,0x34,0x34,
+0x34,0x43,0x32,0x33,0x33,0x33,0x33,0x12,0x80,0xa9,0xdb,0xdb,0xbc,0xcd,0xcb,0xbc,
+0xbc,0xcb,0xbb,0xac,0xcb,0xba,0xcb,0xba,0xab,0x9a,0x09,0x00,0x10,0x10,0x21,0x55,
+0x44,0x34,0x44,0x32,0x24,0x32,0x22,0x32,0x33,0x43,0x22,0x11,0x98,0xaa,0xcc,0xcb,
+0xcb,0xcc,0xcb,0xcb,0xbc,0xcb,0xcb,0xbb,0xbb,0xcb,0x9a,0x9a,0x89,0x88,0x18,0x31,
+0x55,0x44,0x34,0x44,0x42,0x32,0x43,0x32,0x43,0x43,0x33,0x33,0x24,0x11,0x11,0x00,
+0x00,0x88,0xb9,0xdc,0xdb,0xcb,0xcb,0xbc,0xbc,0xbb,0xbc,0xba,0xbb,0xbb,0xbc,0xab,
+0xaa,0x8a,0x18,0x42,0x45,0x43,0x33,0x34,0x53,0x34,0x35,0x43,0x23,0x23,0x22,0x01,
+0x81,0x00,0x10,0x02,0xc8,0xdf,0xcc,0xcb,0xab,0xac,0xba,0xac,0xbb,0xaa,0x89,0x08,
+0xa9,0xcb,0xbc,0x9b,0x30,0x46,0x34,0x33,0x24,0x43,0x33,0x24,0x23,0x32,0x42,0x43,
+0x34,0x24,0x13,0x12,0x01,0x88,0xa9,0xba,0xcc,0xdb,0xbc,0xbd,0xcc,0xcb,0xbb,0xbc,
+0xbc,0xba,0xcb,0xba,0xba,0xbb,0xaa,0x89,0x00,0x32,0x44,0x53,0x34,0x53,0x43,0x43,
+0x34,0x24,0x24,0x23,0x33,0x32,0x22,0x32,0x22,0x22,0x00,0xa9,0xbd,0xbd,0xcc,0xcb,
+0xcb,0xcb,0xcb,0xac,0xbc,0xba,0xab,0xaa,0x89,0x89,0x98,0x80,0x21,0x54,0x35,0x35,
+0x34,0x34,0x34,0x43,0x43,0x33,0x33,0x34,0x24,0x23,0x23,0x21,0x00,0x80,0xa9,0xbc,
+0xcd,0xcb,0xbc,0xbd,0xdb,0xbb,0xcb,0xba,0xab,0xbb,0xbb,0xbb,0xab,0x99,0x00,0x32,
+0x46,0x44,0x43,0x34,0x34,0x53,0x42,0x32,0x33,0x33,0x32,0x22,0x11,0x80,0x99,0xca,
+0xcc,0xdb,0xcb,0xcc,0xdb,0xcb,0xbb,0xbb,0xcb,0xba,0xbc,0xbc,0xba,0x9b,0x99,0x18,
+0x20,0x42,0x43,0x34,0x34,0x35,0x35,0x34,0x33,0x33,0x33,0x43,0x32,0x12,0x02,0x81,
+0x80,0xa9,0xcc,0xcc,0xdb,0xbc,0xbd,0xbc,0xbb,0xcb,0xaa,0xbb,0xcb,0xbb,0x9b,0x09,
+0x32,0x54,0x34,0x43,0x33,0x34,0x44,0x35,0x34,0x24,0x23,0x23,0x22,0x23,0x33,0x23,
+0x12,0x01,0xa9,0xdc,0xcb,0xbc,0xbc,0xcc,0xbc,0xbc,0xbb,0xbc,0xbb,0xbb,0xac,0xab,
+0xa9,0x89,0x10,0x43,0x43,0x43,0x43,0x44,0x63,0x33,0x34,0x23,0x23,0x22,0x21,0x21,
+0x23,0x23,0x91,0xfc,0xbd,0xbd,0xbb,0xcb,0xbb,0xbc,0xbb,0xbb,0x9b,0xaa,0xcb,0xcc,
+0xbb,0x9a,0x20,0x44,0x35,0x43,0x32,0x34,0x43,0x24,0x23,0x23,0x33,0x44,0x34,0x33,
+0x22,0x11,0x88,0xa8,0xb9,0xbd,0xcc,0xcb,0xcc,0xdb,0xcb,0xbb,0xbc,0xac,0xab,0xbb,
+0xab,0xac,0xaa,0x99,0x08,0x31,0x53,0x24,0x34,0x34,0x35,0x34,0x34,0x34,0x32,0x24,
+0x23,0x33,0x22,0x22,0x01,0x00,0xa9,0xcb,0xbc,0xbd,0xcd,0xdb,0xbc,0xbb,0xac,0xab,
+0xaa,0xbb,0xcb,0xab,0x9a,0x10,0x52,0x34,0x35,0x33,0x34,0x34,0x35,0x44,0x33,0x34,
+0x22,0x23,0x23,0x33,0x33,0x23,0x12,0x90,0xda,0xcc,0xdb,0xbb,0xbd,0xcc,0xcb,0xab,
+0xcb,0xaa,0xab,0xbb,0xab,0x9a,0x99,0x08,0x31,0x36,0x35,0x34,0x43,0x53,0x34,0x44,
+0x32,0x23,0x32,0x22,0x23,0x23,0x12,0x81,0xb9,0xcd,0xcc,0xbc,0xbc,0xcb,0xcb,0xbc,
+0xbc,0xcb,0xbb,0xbb,0xac,0xaa,0x9a,0xaa,0x9a,0x89,0x28,0x52,0x44,0x34,0x35,0x34,
+0x24,0x24,0x32,0x32,0x23,0x24,0x22,0x11,0x00,0x88,0xaa,0xcc,0xcc,0xcb,0xcb,0xcb,
+0xbc,0xbc,0xbc,0xbb,0xac,0xaa,0x9a,0x9a,0x99,0x08,0x11,0x43,0x45,0x44,0x53,0x43,
+0x43,0x33,0x33,0x34,0x43,0x33,0x43,0x23,0x12,0x11,0x80,0x98,0xa9,0xcb,0xcc,0xdb,
+0xdb,0xcb,0xbc,0xbb,0xac,0xbb,0xba,0xba,0xbb,0xbb,0xa9,0x08,0x32,0x44,0x44,0x44,
+0x43,0x43,0x34,0x33,0x34,0x33,0x34,0x33,0x32,0x22,0x81,0xb9,0xcc,0xbc,0xba,0xdb,
+0xcc,0xcd,0xcb,0xac,0xbb,0xab,0xbb,0xba,0x9a,0x09,0x10,0x21,0x11,0x21,0x62,0x45,
+0x35,0x35,0x33,0x34,0x43,0x33,0x24,0x22,0x01,0x00,0x00,0x10,0x11,0x90,0xcb,0xcd,
+0xbc,0xbc,0xbc,0xcc,0xbb,0xbc,0xbc,0xbb,0xcb,0xba,0xab,0xba,0xa9,0x89,0x18,0x42,
+0x34,0x45,0x33,0x35,0x34,0x34,0x34,0x43,0x32,0x32,0x32,0x23,0x33,0x22,0x12,0x98,
+0xda,0xcc,0xcb,0xcc,0xcb,0xcb,0xbc,0xcb,0xbb,0xcb,0xaa,0xab,0x9a,0x99,0x88,0x01,
+0x42,0x34,0x45,0x53,0x43,0x43,0x43,0x43,0x32,0x32,0x33,0x34,0x43,0x22,0x21,0x00,
+0x88,0xa9,0xaa,0xcc,0xcc,0xbc,0xbd,0xbc,0xdb,0xba,0xab,0xbb,0xba,0xbb,0xbb,0xaa,
+0x09,0x31,0x45,0x34,0x44,0x43,0x34,0x34,0x34,0x43,0x23,0x33,0x24,0x32,0x22,0x12,
+0x01,0x98,0xcb,0xcc,0xdb,0xca,0xca,0xdb,0xcb,0xac,0xcb,0xaa,0xaa,0xaa,0xbb,0xac,
+0xab,0x99,0x00,0x22,0x44,0x33,0x34,0x53,0x53,0x53,0x33,0x34,0x33,0x23,0x23,0x22,
+0x12,0x22,0x01,0x99,0xcd,0xbc,0xbd,0xbc,0xcc,0xcb,0xbc,0xcb,0xba,0xaa,0xbb,0xbb,
+0xcb,0xaa,0x89,0x10,0x43,0x45,0x43,0x33,0x25,0x34,0x53,0x34,0x43,0x32,0x23,0x23,
+0x22,0x23,0x32,0x22,0x11,0xa8,0xdb,0xbd,0xbc,0xbd,0xbc,0xcc,0xbb,0xcb,0xab,0xbb,
+0xac,0xba,0xaa,0x99,0x08,0x21,0x53,0x34,0x34,0x34,0x44,0x34,0x34,0x34,0x33,0x24,
+0x22,0x21,0x22,0x21,0x01,0x90,0xc9,0xcc,0xcc,0xbc,0xbc,0xbc,0xcb,0xcb,0xcb,0xcb,
+0xcb,0xaa,0xaa,0xaa,0x9a,0x09,0x20,0x45,0x53,0x32,0x23,0x43,0x53,0x53,0x43,0x23,
+0x33,0x33,0x32,0x22,0x22,0x90,0xba,0xbe,0xcb,0xbb,0xbb,0xcd,0xbc,0xcc,0xbb,0xbc,
+0xac,0xba,0xaa,0xba,0xbb,0xcb,0x9a,0x09,0x21,0x53,0x43,0x43,0x34,0x35,0x34,0x34,
+0x33,0x34,0x32,0x32,0x33,0x32,0x22,0x02,0x90,0xca,0xcc,0xcb,0xbc,0xbd,0xbd,0xbc,
+0xad,0xbb,0xab,0xbb,0xbb,0xac,0xab,0x9a,0x08,0x32,0x55,0x43,0x43,0x43,0x43,0x43,
+0x34,0x43,0x43,0x32,0x32,0x22,0x22,0x32,0x22,0x12,0x90,0xca,0xcc,0xbc,0xcc,0xcb,
+0xbc,0xbc,0xbb,0xbc,0xba,0xac,0xba,0xab,0x9a,0x88,0x28,0x32,0x36,0x44,0x53,0x33,
+0x35,0x34,0x53,0x32,0x33,0x33,0x32,0x22,0x22,0x12,0x00,0xa9,0xdc,0xbc,0xcc,0xdb,
+0xcb,0xcb,0xcb,0xbb,0xcb,0xca,0xaa,0xbb,0xba,0xaa,0x99,0x88,0x20,0x31,0x44,0x44,
+0x53,0x34,0x34,0x34,0x33,0x23,0x33,0x43,0x33,0x23,0x22,0x80,0xba,0xbd,0xbd,0xcb,
+0xbc,0xbd,0xbd,0xbc,0xbc,0xcb,0xab,0xbb,0xba,0xab,0xab,0x99,0x09,0x31,0x54,0x53,
+0x43,0x53,0x43,0x34,0x34,0x24,0x32,0x32,0x33,0x34,0x33,0x33,0x21,0x80,0x9a,0xcb,
+0xbc,0xcb,0xdb,0xbc,0xcd,0xcb,0xbb,0xbb,0xab,0xbb,0xcb,0xba,0xaa,0x89,0x10,0x52,
+0x53,0x43,0x34,0x34,0x44,0x43,0x33,0x43,0x32,0x33,0x33,0x43,0x22,0x11,0x90,0xb9,
+0xcc,0xdb,0xbb,0xbc,0xcd,0xbc,0xcc,0xca,0xaa,0xaa,0xaa,0xba,0xbb,0xbc,0xac,0x99,
+0x08,0x21,0x34,0x44,0x44,0x44,0x33,0x34,0x32,0x33,0x33,0x34,0x24,0x33,0x22,0x11,
+0x80,0xa9,0xbd,0xcd,0xcb,0xbc,0xcb,0xcb,0xbb,0xbb,0xbc,0xac,0xbb,0xbb,0xab,0xaa,
+0x88,0x00,0x22,0x54,0x43,0x44,0x43,0x43,0x34,0x43,0x33,0x33,0x33,0x33,0x43,0x32,
+0x11,0x80,0xb9,0xdb,0xcc,0xcb,0xcc,0xcb,0xbc,0xcb,0xbb,0xbb,0xac,0xbb,0xac,0xab,
+0xa9,0x88,0x20,0x42,0x34,0x44,0x34,0x53,0x34,0x34,0x34,0x23,0x33,0x43,0x32,0x24,
+0x23,0x22,0x01,0x98,0xaa,0xdb,0xbb,0xbd,0xbd,0xbd,0xcc,0xbb,0xac,0xab,0xab,0xab,
+0xab,0xab,0x9a,0x88,0x32,0x55,0x53,0x33,0x44,0x43,0x53,0x33,0x34,0x33,0x33,0x24,
+0x23,0x23,0x22,0x01,0xa8,0xca,0xcc,0xdb,0xbb,0xcc,0xcb,0xbc,0xbc,0xac,0xbb,0xbb,
+0xba,0xbb,0xac,0xba,0x99,0x18,0x41,0x53,0x43,0x34,0x34,0x44,0x43,0x33,0x43,0x32,
+0x33,0x33,0x12,0x02,0x00,0x98,0xb9,0xec,0xdb,0xcb,0xbc,0xbc,0xcc,0xcb,0xba,0xbb,
+0xac,0xab,0xbb,0xbb,0xba,0x99,0x18,0x43,0x45,0x43,0x53,0x33,0x44,0x43,0x33,0x34,
+0x43,0x32,0x32,0x22,0x22,0x11,0x12,0x11,0x98,0xdb,0xcc,0xdb,0xdb,0xcb,0xcb,0xba,
+0xbb,0xbb,0xbc,0xac,0xab,0xaa,0x89,0x10,0x31,0x35,0x35,0x34,0x34,0x35,0x34,0x34,
+0x34,0x32,0x24,0x32,0x22,0x22,0x11,0x01,0x88,0xaa,0xbd,0xcd,0xbc,0xcc,0xcb,0xcb,
+0xbb,0xcb,0xbb,0xcb,0xbb,0xac,0xab,0x99,0x09,0x10,0x10,0x00,0x31,0x54,0x45,0x34,
+0x44,0x43,0x33,0x34,0x24,0x22,0x12,0x11,0x01,0x11,0x11,0x80,0xba,0xbe,0xcc,0xbc,
+0xcc,0xbc,0xbc,0xcb,0xaa,0xaa,0xaa,0xaa,0xab,0x9b,0x8a,0x20,0x53,0x44,0x33,0x35,
+0x34,0x44,0x33,0x34,0x33,0x33,0x33,0x24,0x22,0x11,0x81,0x90,0xca,0xcc,0xdb,0xcb,
+0xbc,0xcc,0xcb,0xcb,0xba,0xab,0xbb,0xba,0xba,0xaa,0xaa,0x88,0x32,0x46,0x34,0x34,
+0x34,0x35,0x34,0x34,0x33,0x34,0x43,0x32,0x23,0x22,0x21,0x11,0x11,0x88,0xba,0xcd,
+0xdb,0xcc,0xcb,0xbc,0xac,0xbb,0xca,0xba,0xbb,0xab,0xbb,0xab,0x9a,0x10,0x53,0x54,
+0x33,0x44,0x53,0x43,0x43,0x33,0x43,0x33,0x42,0x22,0x32,0x12,0x12,0x00,0xa9,0xcb,
+0xbd,0xbc,0xbd,0xcc,0xbc,0xcb,0xbb,0xac,0xab,0xbb,0xcb,0xba,0xaa,0x99,0x08,0x31,
+0x53,0x34,0x34,0x44,0x34,0x44,0x33,0x34,0x23,0x23,0x23,0x33,0x33,0x23,0x80,0xc9,
+0xcc,0xbc,0xcb,0xbc,0xcc,0xbc,0xbc,0xbc,0xba,0xac,0xba,0xbb,0xab,0xbb,0x9a,0x09,
+0x21,0x63,0x34,0x34,0x44,0x43,0x34,0x44,0x32,0x33,0x23,0x33,0x33,0x34,0x32,0x11,
+0x00,0xaa,0xcc,0xdb,0xbb,0xcc,0xbc,0xbc,0xad,0xac,0xab,0xab,0xab,0xab,0xab,0xa9,
+0x89,0x10,0x63,0x53,0x34,0x34,0x44,0x43,0x33,0x25,0x33,0x43,0x22,0x33,0x32,0x32,
+0x11,0x81,0xa9,0xeb,0xcb,0xbc,0xbd,0xcb,0xcc,0xbb,0xad,0xbb,0xbb,0xbb,0xbb,0xcb,
+0xaa,0xaa,0x99,0x10,0x52,0x63,0x43,0x24,0x24,0x33,0x34,0x34,0x43,0x32,0x33,0x43,
+0x33,0x43,0x12,0x00,0xba,0xbc,0xbc,0xbb,0xbc,0xbe,0xcd,0xbb,0xcb,0xab,0xbb,0xcc,
+0xba,0xbb,0x9a,0x88,0x10,0x32,0x53,0x53,0x43,0x53,0x53,0x33,0x34,0x24,0x22,0x22,
+0x23,0x32,0x22,0x11,0x80,0xaa,0xbd,0xbd,0xcc,0xdb,0xcb,0xdb,0xbb,0xcb,0xab,0xbb,
+0xcb,0xba,0xaa,0xaa,0x88,0x11,0x34,0x44,0x34,0x34,0x34,0x44,0x43,0x43,0x23,0x33,
+0x33,0x33,0x33,0x24,0x22,0x00,0xa0,0xba,0xcd,0xdb,0xcb,0xcb,0xcc,0xbb,0xbc,0xac,
+0xbb,0xba,0xba,0xab,0xaa,0x8a,0x08,0x32,0x37,0x35,0x34,0x34,0x34,0x44,0x33,0x34,
+0x33,0x33,0x43,0x22,0x23,0x12,0x01,0x90,0xb9,0xdc,0xbc,0xcc,0xcb,0xbc,0xbc,0xbc,
+0xcb,0xba,0xbb,0xbb,0xbb,0xbb,0x9a,0x89,0x20,0x53,0x34,0x35,0x35,0x44,0x43,0x33,
+0x34,0x33,0x43,0x23,0x33,0x23,0x12,0x00,0x98,0xca,0xcc,0xdb,0xcb,0xdb,0xcb,0xbc,
+0xbc,0xcb,0xba,0xba,0xbb,0xcb,0xaa,0xaa,0x89,0x18,0x32,0x35,0x34,0x35,0x35,0x34,
+0x25,0x24,0x32,0x33,0x33,0x33,0x33,0x23,0x13,0x01,0x98,0xcb,0xbd,0xcc,0xbc,0xcc,
+0xbc,0xcc,0xba,0xba,0xab,0xbb,0xcb,0xbb,0xab,0x99,0x20,0x53,0x44,0x33,0x35,0x43,
+0x34,0x44,0x43,0x33,0x43,0x22,0x23,0x32,0x23,0x22,0x11,0x90,0xb9,0xcd,0xdb,0xdb,
+0xcb,0xdb,0xcb,0xbb,0xac,0xab,0xab,0xac,0xab,0xab,0x9a,0x09,0x11,0x43,0x34,0x34,
+0x34,0x35,0x44,0x34,0x43,0x32,0x22,0x21,0x21,0x22,0x22,0x11,0x00,0x88,0x99,0xca,
+0xec,0xdc,0xbc,0xbd,0xbb,0xab,0xac,0xbb,0xcb,0xba,0x9a,0x9a,0x99,0xaa,0xaa,0x99,
+0x08,0x00,0x00,0x88,0x88,0x80,0x88,0x10,0x32,0x33,0x01,0xcc,0xbc,0x9a,0x11,0x36,
+0x35,0x22,0x02,0x88,0x21,0x55,0x34,0x23,0x01,0x18,0x21,0x34,0x13,0x10,0x20,0x46,
+0x53,0x43,0x42,0x43,0x33,0x14,0x23,0x53,0x43,0x33,0x12,0x11,0x31,0x35,0x33,0x34,
+0x54,0x53,0x33,0x23,0x11,0x31,0x44,0x44,0x33,0x44,0x43,0x33,0x23,0x01,0x11,0x52,
+0x34,0x35,0x32,0x22,0x11,0x00,0x31,0x55,0x34,0x24,0x11,0x88,0x88,0x20,0x21,0x23,
+0x42,0x43,0x33,0x33,0x23,0x44,0x35,0x24,0x00,0x98,0x21,0x44,0x13,0xb8,0xcc,0x89,
+0x53,0x33,0x01,0xba,0x9a,0x31,0x23,0xb0,0xad,0x29,0x53,0x02,0xdd,0xbd,0xaa,0x00,
+0x21,0x00,0xaa,0xcd,0xbc,0xcc,0xab,0x8a,0x10,0x81,0xfb,0xcd,0xcb,0x9a,0x89,0x01,
+0x00,0x80,0xb9,0xdc,0xdb,0xaa,0x00,0x33,0x24,0x81,0x99,0x0a,0x10,0x02,0xa8,0x20,
+0x77,0x36,0x33,0x23,0x13,0x33,0x23,0x34,0x45,0x54,0x33,0x13,0x81,0x88,0x42,0x46,
+0x34,0x33,0x32,0x43,0x12,0x12,0x21,0x44,0x35,0x34,0x12,0x11,0x21,0x21,0x32,0x32,
+0x35,0x36,0x33,0x02,0xa8,0x88,0x44,0x35,0x24,0x11,0x11,0x00,0xa0,0xca,0xcb,0x99,
+0x01,0x02,0x91,0xca,0xbd,0xbd,0xbc,0x9a,0x08,0x01,0xc9,0xdd,0xcb,0xcb,0xbc,0xbb,
+0xab,0x18,0x01,0xfc,0xdd,0xbc,0xab,0x9a,0x88,0x00,0x10,0x44,0x45,0x34,0x22,0x01,
+0x80,0x08,0x41,0x54,0x33,0x33,0x12,0x01,0x00,0xa8,0xeb,0xbd,0xbc,0xab,0x09,0x18,
+0x80,0xa9,0xbd,0xcb,0x9b,0x8a,0x88,0x88,0xa8,0xbc,0xbc,0x9c,0x09,0x10,0x02,0x98,
+0xcc,0xbb,0xab,0x99,0x08,0x10,0x32,0x13,0xfa,0xcf,0x9b,0x29,0x53,0x33,0x00,0x89,
+0x41,0x37,0x25,0x02,0x88,0x88,0x31,0x35,0x34,0x32,0x11,0x00,0x00,0x42,0x56,0x34,
+0x25,0x22,0x01,0x80,0x00,0x31,0x55,0x44,0x33,0x12,0x88,0x09,0x51,0x35,0x25,0x12,
+0x80,0x00,0x10,0x21,0x32,0x43,0x34,0x33,0x12,0x80,0x20,0x63,0x33,0x23,0x11,0x09,
+0xa9,0xab,0x09,0x46,0x36,0x43,0x20,0x18,0x80,0xa0,0xcd,0xbc,0x9b,0x88,0xa9,0xcd,
+0xac,0x8a,0x88,0xc8,0xcc,0x9c,0x09,0x01,0xd8,0xdd,0xcb,0xab,0x9a,0x99,0x89,0x08,
+0x80,0xeb,0xdd,0xab,0xaa,0x00,0x10,0xa9,0xdd,0xdb,0xac,0xbb,0x9b,0x89,0x00,0x90,
+0xc9,0xbc,0xab,0x89,0x80,0xa0,0xdb,0xbc,0x9a,0x00,0x22,0x81,0xca,0x9b,0x73,0x57,
+0x42,0x21,0x00,0x88,0x18,0x21,0x33,0x33,0x35,0x34,0x24,0x82,0x90,0x21,0x46,0x35,
+0x24,0x11,0x80,0x09,0x18,0x43,0x45,0x43,0x22,0x11,0x89,0x9a,0x18,0x53,0x34,0x12,
+0xa8,0xaa,0x19,0x44,0x25,0x12,0x01,0x00,0x10,0xa9,0xdd,0xcb,0x9a,0x88,0x00,0x00,
+0x11,0x01,0xda,0xbf,0xad,0x89,0x00,0xa8,0xec,0xcb,0xaa,0xaa,0xcb,0xca,0x89,0x11,
+0x81,0xde,0xcd,0xcb,0xa9,0x89,0x89,0x88,0x21,0x63,0x43,0x33,0x33,0x14,0x12,0x00,
+0x42,0x55,0x43,0x23,0x80,0x99,0x88,0x81,0xc8,0xce,0xac,0x9b,0x00,0x00,0xb9,0xcc,
+0xac,0x9a,0x88,0x80,0x08,0x9a,0xbc,0xbd,0xab,0x89,0x00,0x81,0x98,0x00,0x22,0xc8,
+0xee,0xbb,0x8b,0x20,0x12,0xa0,0xba,0x39,0x53,0x82,0xeb,0x8b,0x52,0x45,0x33,0x10,
+0x88,0x08,0x80,0xa9,0x89,0x54,0x37,0x33,0x02,0x99,0xaa,0x28,0x55,0x44,0x43,0x32,
+0x11,0x88,0x18,0x62,0x44,0x33,0x22,0x88,0x08,0x31,0x37,0x34,0x23,0x22,0x80,0xa8,
+0x99,0x31,0x47,0x43,0x12,0x90,0xab,0x19,0x73,0x34,0x13,0x00,0x8a,0x09,0x10,0x01,
+0x89,0x0b,0x38,0x22,0xa8,0xac,0x3a,0x72,0x02,0x9c,0x8d,0x31,0x35,0xb8,0xff,0xbb,
+0x9a,0x08,0x10,0x00,0x88,0x88,0x90,0x90,0x01,0x25,0xa1,0xff,0xbc,0xab,0x19,0x01,
+0xf9,0xdc,0xba,0x89,0x01,0x90,0xdc,0xcc,0xba,0x9a,0x88,0x08,0x00,0x10,0x99,0xcc,
+0xbc,0x9b,0x20,0x32,0x91,0xcd,0xbd,0x9b,0x19,0x11,0x01,0xb9,0xaa,0x51,0x55,0x43,
+0x21,0x80,0xa9,0x89,0x31,0x47,0x53,0x23,0x22,0x00,0x09,0x21,0x37,0x34,0x14,0x11,
+0x08,0x09,0x51,0x54,0x34,0x33,0x12,0x98,0xa9,0x08,0x53,0x24,0x13,0x00,0x99,0x90,
+0x81,0x01,0x09,0x08,0x19,0x2b,0x3b,0x61,0x21,0xfd,0xcd,0xcb,0x8a,0x20,0x23,0xa8,
+0xce,0xcb,0x99,0x01,0x90,0xeb,0xcc,0xaa,0x9a,0xaa,0xcc,0xac,0x9b,0x10,0x00,0xfb,
+0xce,0xcb,0xaa,0x98,0x00,0x88,0x00,0x43,0x36,0x34,0x22,0x88,0x99,0x10,0x46,0x53,
+0x22,0x11,0x01,0x00,0x80,0xaa,0xce,0xcb,0x9b,0x99,0x80,0x90,0xa9,0xbb,0xbc,0xbc,
+0xbb,0x9c,0x8a,0x08,0xa9,0xbd,0xbd,0x8a,0x21,0x23,0xb0,0xcf,0xac,0x89,0x20,0x10,
+0x98,0xaa,0x08,0x25,0x03,0xdc,0xae,0x8a,0x20,0x25,0x12,0x80,0x89,0x89,0x80,0x80,
+0x42,0x46,0x24,0x12,0x98,0x8a,0x09,0x11,0x01,0x30,0x77,0x34,0x24,0x01,0x90,0x08,
+0x33,0x37,0x32,0x23,0x22,0x81,0xba,0xab,0x74,0x46,0x23,0x02,0xa9,0x9a,0x20,0x34,
+0xa1,0xee,0xbc,0xbb,0x9a,0x88,0x00,0x88,0x80,0x08,0x00,0x80,0x98,0x80,0x00,0x81,
+0x90,0x98,0x91,0x12,0x29,0x9b,0xa9,0x21,0x30,0x09,0x9a,0x9a,0x93,0x33,0x3b,0x0f,
+0x88,0x02,0x11,0x8c,0xaa,0x04,0x05,0xa1,0xbc,0x89,0x36,0x87,0xe0,0xcc,0xbc,0x8a,
+0x18,0x11,0x80,0xa8,0x98,0x11,0x83,0x90,0x9b,0x19,0x23,0x13,0xbb,0x0c,0x59,0x21,
+0x98,0xbb,0x1a,0x33,0x22,0x9b,0x9d,0x92,0x85,0x91,0xaa,0x19,0x51,0x28,0x8b,0xbb,
+0x21,0x33,0x01,0xbb,0x2d,0x49,0x11,0xc0,0xba,0x11,0x17,0x81,0xbb,0x0d,0x70,0x22,
+0xc0,0xcf,0xbc,0xaa,0x00,0x11,0x00,0xa8,0x98,0x01,0x21,0x3a,0x0d,0x1a,0x30,0x00,
+0xb8,0xc2,0x01,0x31,0x91,0x99,0x2c,0x39,0x11,0xb2,0xd1,0x92,0x82,0x01,0xa0,0x99,
+0xa2,0xa4,0xb3,0x99,0x3b,0x39,0x3b,0x1a,0x1a,0x6b,0x3b,0x0a,0xc1,0xb3,0xb4,0xa4,
+0x00,0x1a,0x10,0x39,0xa0,0xc3,0xa2,0x12,0x11,0x09,0x99,0x90,0xb3,0xb4,0xc3,0xa1,
+0x93,0x92,0x10,0x1b,0x09,0x11,0x01,0xb1,0xb2,0x01,0x02,0x91,0xb1,0x91,0x39,0x39,
+0x1a,0x1b,0x1a,0x12,0x11,0xb9,0x99,0x21,0x41,0x0a,0x9c,0x39,0x52,0x02,0xdb,0xac,
+0x70,0x47,0x43,0x22,0x98,0xab,0x09,0x45,0x34,0x23,0x80,0xa8,0x90,0x01,0x82,0x90,
+0x99,0x18,0x30,0x18,0x1b,0x1c,0x39,0x13,0x91,0x0b,0x3c,0x59,0x39,0x2d,0x1b,0x18,
+0x21,0x3a,0x1e,0x4b,0x3a,0x19,0x1a,0x1d,0x29,0x30,0x90,0xd9,0x91,0x21,0x30,0xaa,
+0xba,0x91,0x97,0x93,0xa9,0xb8,0x95,0x95,0xb2,0xb9,0x91,0x87,0xb4,0xd1,0x98,0x31,
+0x34,0xd1,0xde,0xbc,0xaa,0x08,0x11,0x01,0x99,0x89,0x10,0x20,0x09,0x0b,0x4b,0x29,
+0x00,0x9b,0x0b,0x02,0xb4,0xf3,0x91,0x00,0x11,0x99,0x99,0x29,0x51,0x2a,0x9c,0x09,
+0x33,0x94,0xf0,0x9a,0x50,0x33,0xc1,0xef,0xbc,0x9b,0x09,0x21,0x81,0xa8,0x98,0x10,
+0x21,0x09,0x9b,0x99,0x23,0x04,0xb9,0xbb,0x21,0x32,0x91,0xb9,0x1b,0x30,0x93,0xe3,
+0xa1,0xa2,0x13,0x00,0xba,0xe3,0xa4,0x93,0xb1,0xb1,0x92,0x31,0x90,0xd1,0xc3,0xa3,
+0x93,0x00,0x0b,0x90,0x13,0x00,0x99,0x99,0x39,0x39,0x0a,0xb9,0x93,0x30,0x3b,0x9a,
+0xa0,0x22,0x29,0x9a,0xb0,0x92,0x93,0xc3,0xd3,0x01,0x39,0x18,0x99,0x1b,0x5b,0x18,
+0xc1,0xb1,0x00,0x33,0x13,0x9c,0x1e,0x40,0x24,0xd8,0xef,0xbb,0x9a,0x18,0x23,0x90,
+0xca,0x0a,0x72,0x44,0x22,0x01,0x98,0x09,0x18,0x10,0x19,0x8a,0x08,0x10,0x01,0x99,
+0x1a,0x39,0x11,0xb3,0xe2,0x81,0x20,0x3a,0x9b,0x9a,0x01,0x93,0x11,0x3b,0x2f,0x09,
+0xa2,0xa1,0xb1,0x11,0x39,0x19,0xb0,0xc2,0x93,0x22,0x3b,0x2d,0x1a,0x91,0x01,0x99,
+0xa9,0x02,0x12,0x19,0x9b,0x90,0x12,0x30,0x1b,0x2c,0x3a,0x31,0x09,0x9b,0x09,0x21,
+0x11,0xc1,0xc2,0x02,0x38,0x29,0x1c,0x3b,0x39,0x21,0x0a,0x9b,0x19,0x13,0x02,0x9b,
+0xbb,0x95,0x22,0x3b,0x9d,0xa1,0x85,0xa3,0xc0,0xa8,0x32,0x43,0x2a,0x8f,0x1a,0x31,
+0x21,0xfa,0xb8,0x82,0x07,0xa2,0xca,0xa8,0x34,0x15,0xe0,0xfb,0xbb,0x9a,0x09,0x10,
+0x00,0x38,0x29,0xdb,0xbf,0xbd,0x9a,0x00,0x12,0x81,0xa9,0x89,0x20,0x12,0xa0,0x9b,
+0x3b,0x51,0x92,0xc0,0x1a,0x6c,0x29,0x80,0x1b,0x2b,0x20,0x13,0x9a,0x9b,0x19,0x13,
+0xb3,0xa0,0x1b,0x11,0xa5,0x81,0x3b,0x3b,0x39,0x10,0x9a,0xb0,0x13,0x30,0x2b,0x9b,
+0x91,0x93,0xb2,0xb2,0x09,0x11,0x01,0x91,0xb9,0x93,0xa3,0x01,0x09,0x99,0x21,0x29,
+0x9b,0xb1,0x93,0x12,0x99,0x0b,0x01,0x13,0x29,0x0d,0x09,0x92,0xa6,0xb0,0x99,0x12,
+0x17,0xb1,0xbd,0x3a,0x76,0x35,0x14,0x81,0x99,0x09,0x28,0x10,0x90,0x9a,0x19,0x32,
+0x21,0x9e,0x0b,0x31,0x25,0xaa,0xaf,0x59,0x74,0x32,0x12,0x98,0x99,0x18,0x21,0x80,
+0x9b,0x1b,0x51,0x12,0xba,0x9e,0x30,0x54,0x90,0xdd,0xbc,0xaa,0x08,0x00,0x89,0x20,
+0x65,0x24,0x03,0x90,0x8a,0x2a,0x30,0x01,0xba,0x8a,0x40,0x32,0xaa,0x9e,0x4a,0x52,
+0x91,0xfc,0xbc,0x9c,0x08,0x01,0x01,0x99,0x88,0x10,0x10,0x08,0x0b,0x09,0x22,0x20,
+0x0f,0x2b,0x3a,0x21,0xa8,0xba,0xb0,0x86,0x92,0xb8,0xb0,0x21,0x23,0x19,0x8c,0xb0,
+0x23,0x12,0xb9,0xb9,0x39,0x41,0x19,0xbb,0x0a,0x31,0x31,0xc1,0xc0,0x11,0x31,0xb3,
+0xd0,0x09,0x20,0x33,0xb0,0x9d,0x19,0x43,0x12,0x9f,0x0c,0x69,0x41,0x98,0xce,0xbd,
+0x9b,0x09,0x11,0x81,0xa0,0x98,0x00,0x02,0x81,0x0b,0x1b,0x30,0x13,0xb1,0xba,0x39,
+0x31,0x91,0xb9,0xb0,0x13,0x13,0x99,0x0b,0x19,0x12,0x91,0xb0,0xa0,0x13,0x93,0xa0,
+0x2b,0x4b,0x4a,0x09,0x9a,0x3a,0x5a,0x19,0x09,0x1c,0x29,0x93,0xa3,0x0a,0x2b,0x49,
+0x18,0xba,0xa9,0x49,0x38,0x0a,0xbb,0x09,0x13,0x23,0x1b,0x1f,0x3a,0x20,0x19,0x0d,
+0x1a,0x11,0x95,0xc1,0xa9,0x92,0x07,0x81,0x0b,0x2d,0x20,0x12,0xa9,0x9d,0x5a,0x48,
+0x18,0x8c,0x0b,0x30,0x13,0xb3,0xd1,0xfb,0xdf,0xdb,0x9a,0x30,0x45,0x03,0x80,0x72,
+0x77,0x46,0x43,0x43,0x32,0x22,0x43,0x34,0x34,0x34,0x33,0x22,0x11,0x01,0x01,0x12,
+0x02,0x98,0xcd,0xcc,0xbb,0xbc,0xcb,0xbc,0xbc,0xac,0xbb,0xbb,0xcb,0xbb,0xbb,0x9a,
+0x08,0x11,0x11,0x08,0x21,0x66,0x44,0x34,0x24,0x12,0x80,0x98,0x18,0x43,0x23,0xc0,
+0xdf,0xcb,0xbb,0xab,0xaa,0xaa,0x89,0x31,0x33,0xa1,0xcf,0xbc,0x9a,0x31,0x34,0x33,
+0x22,0x33,0x23,0xa0,0xdf,0xbc,0x8a,0x40,0x44,0x33,0x23,0x11,0x01,0x22,0x43,0x43,
+0x11,0xb8,0xcc,0xbd,0xcb,0xba,0xcb,0xdb,0xdb,0xbc,0xbc,0xbb,0xab,0xcb,0xba,0xbc,
+0xaa,0x9a,0x09,0x21,0x43,0x45,0x43,0x34,0x42,0x32,0x43,0x43,0x24,0x33,0x32,0x22,
+0x12,0x12,0x32,0x43,0x22,0x81,0xeb,0xbc,0xbb,0xba,0xca,0xdc,0xdb,0xbb,0xac,0x9a,
+0x99,0x00,0x00,0x80,0x08,0x41,0x46,0x35,0x34,0x33,0x43,0x43,0x34,0x34,0x32,0x33,
+0x23,0x22,0x22,0x11,0x11,0x88,0xdb,0xdc,0xcb,0xdb,0xcb,0xdb,0xbb,0xac,0xbb,0xbb,
+0xbb,0xbc,0xac,0xaa,0x9a,0x08,0x00,0x11,0x10,0x00,0x63,0x55,0x44,0x33,0x23,0x12,
+0x10,0x21,0x53,0x23,0x82,0xda,0xcd,0xbb,0xac,0xaa,0xca,0xcb,0xbd,0xbd,0xbb,0xbb,
+0xbb,0xac,0xbb,0xac,0xbb,0xab,0x89,0x10,0x43,0x35,0x35,0x34,0x44,0x32,0x34,0x34,
+0x34,0x34,0x22,0x13,0x12,0x11,0x42,0x43,0x23,0x81,0xc9,0xcb,0x9b,0x89,0x90,0xea,
+0xcc,0xcb,0xab,0xaa,0x99,0x98,0x98,0x98,0x00,0x42,0x44,0x35,0x34,0x34,0x34,0x34,
+0x43,0x33,0x33,0x33,0x33,0x25,0x13,0x01,0xba,0xdc,0xcb,0xbb,0xcb,0xdb,0xdc,0xbc,
+0xad,0xab,0xaa,0x99,0xca,0xcc,0xac,0xab,0x9a,0x88,0x18,0x42,0x45,0x34,0x33,0x12,
+0x21,0x43,0x45,0x43,0x32,0x21,0x21,0x01,0x91,0xc9,0xcc,0xbb,0x9b,0x9a,0xa9,0xcc,
+0xcc,0xac,0xbb,0xba,0xaa,0xba,0xbc,0xbc,0xbb,0xaa,0x89,0x10,0x31,0x33,0x35,0x34,
+0x45,0x53,0x43,0x23,0x33,0x33,0x32,0x33,0x33,0x43,0x23,0x23,0x02,0xc9,0xdc,0xcb,
+0xbc,0xdb,0xcb,0xbc,0xbc,0xcb,0xba,0xaa,0x99,0x08,0x80,0x98,0x08,0x73,0x55,0x43,
+0x24,0x22,0x33,0x43,0x44,0x33,0x34,0x33,0x32,0x12,0x22,0x33,0x24,0x13,0x80,0xdb,
+0xbc,0xbc,0xac,0xbc,0xdb,0xcb,0xac,0xab,0xab,0x9a,0x9a,0xa9,0x99,0x89,0x20,0x32,
+0x44,0x33,0x46,0x44,0x53,0x43,0x22,0x22,0x23,0x42,0x32,0x22,0x01,0xba,0xcc,0xbb,
+0xbc,0xbc,0xcc,0xcc,0xbc,0xcc,0xba,0xbb,0xba,0xca,0xcb,0xbc,0xbb,0x9b,0x09,0x00,
+0x01,0x01,0x10,0x44,0x45,0x53,0x33,0x33,0x24,0x23,0x33,0x24,0x23,0x22,0x23,0x32,
+0x11,0xb9,0xdd,0xcb,0xab,0xbb,0xcc,0xbd,0xbd,0xbc,0xaa,0x8a,0x08,0x21,0x01,0x98,
+0x08,0x73,0x46,0x34,0x34,0x22,0x33,0x43,0x44,0x33,0x34,0x32,0x22,0x22,0x22,0x32,
+0x23,0x01,0xb8,0xdc,0xcb,0xbc,0xcd,0xdb,0xcb,0xbb,0xba,0xab,0xbc,0xbc,0xbb,0xab,
+0x9a,0x88,0x00,0x88,0xba,0xbb,0x60,0x56,0x34,0x23,0x81,0xba,0x9a,0x28,0x42,0x44,
+0x44,0x44,0x24,0x13,0x90,0xaa,0x8a,0x28,0x22,0x81,0xeb,0xcb,0xbc,0xdb,0xbd,0xcc,
+0xba,0x9a,0x89,0x80,0x80,0x98,0x88,0x10,0x54,0x44,0x33,0x24,0x12,0x22,0x31,0x33,
+0x34,0x22,0x00,0x98,0xba,0xdb,0xcc,0xdb,0xbc,0xcc,0xcb,0xcb,0xbb,0xac,0xab,0x9a,
+0x99,0x98,0x98,0x88,0x10,0x54,0x53,0x24,0x24,0x43,0x43,0x43,0x43,0x43,0x33,0x33,
+0x23,0x22,0x32,0x44,0x33,0x22,0x91,0xc9,0xbb,0xac,0xba,0xcb,0xdc,0xbc,0xbd,0xab,
+0x9b,0x8a,0x98,0x98,0x99,0x89,0x31,0x45,0x35,0x25,0x34,0x43,0x43,0x34,0x43,0x24,
+0x23,0x32,0x22,0x12,0x11,0x80,0xa9,0xbc,0xcc,0xbb,0xdc,0xcb,0xcc,0xcb,0xba,0xac,
+0xaa,0xbb,0xdb,0xab,0xbb,0x9b,0x89,0x00,0x00,0x08,0x10,0x63,0x45,0x44,0x23,0x13,
+0x02,0x11,0x32,0x35,0x33,0x02,0xb9,0xbc,0xad,0xba,0xca,0xdb,0xcc,0xdb,0xcb,0xcb,
+0xab,0xac,0xaa,0xaa,0x9a,0x9a,0x9a,0x99,0x08,0x63,0x45,0x34,0x24,0x33,0x42,0x53,
+0x53,0x34,0x33,0x33,0x12,0x11,0x22,0x53,0x23,0x23,0x80,0xaa,0xbc,0xab,0xbc,0xbc,
+0xbe,0xbc,0xbc,0xbb,0xab,0xbb,0xaa,0xaa,0xaa,0x99,0x10,0x43,0x53,0x43,0x44,0x45,
+0x43,0x24,0x23,0x22,0x22,0x43,0x43,0x12,0x90,0xdb,0xcc,0xab,0x99,0xa9,0xcd,0xbe,
+0xbd,0xac,0xaa,0xab,0xa9,0x8a,0x20,0x43,0x23,0x80,0xa9,0x20,0x57,0x34,0x24,0x32,
+0x22,0x43,0x22,0x01,0xa8,0x99,0x28,0x53,0x23,0x80,0xca,0xdb,0xba,0xba,0xca,0xdb,
+0xbc,0xcd,0xcb,0xbb,0xbb,0xac,0xbb,0xbb,0xbc,0xba,0xa9,0x88,0x10,0x22,0x43,0x53,
+0x34,0x35,0x35,0x43,0x34,0x34,0x33,0x33,0x33,0x32,0x33,0x34,0x22,0x01,0xb9,0xcc,
+0xcb,0xba,0xba,0xdc,0xcc,0xbc,0xcc,0x9a,0x99,0x08,0x80,0x88,0x99,0x09,0x51,0x45,
+0x34,0x34,0x33,0x42,0x43,0x53,0x34,0x33,0x24,0x22,0x12,0x22,0x22,0x22,0x01,0xa9,
+0xdb,0xdb,0xbb,0xcc,0xbc,0xcc,0xcb,0xba,0xab,0xac,0xbb,0xac,0xab,0x99,0x89,0x08,
+0x20,0x22,0x34,0x35,0x45,0x34,0x34,0x24,0x22,0x22,0x23,0x34,0x32,0x81,0xb8,0xbc,
+0xbc,0xba,0xcb,0xdd,0xcc,0xcc,0xbb,0xac,0xba,0xaa,0xac,0xcb,0xba,0xab,0xaa,0x99,
+0x80,0x11,0x31,0x34,0x44,0x44,0x53,0x53,0x33,0x34,0x33,0x32,0x33,0x32,0x43,0x33,
+0x34,0x11,0x98,0xcb,0xbb,0x9b,0x89,0xb8,0xde,0xcd,0xbc,0xaa,0x89,0x00,0x00,0xa8,
+0xb9,0x09,0x51,0x45,0x34,0x43,0x32,0x34,0x53,0x43,0x24,0x33,0x33,0x33,0x33,0x23,
+0x13,0x81,0xa9,0xcb,0xbc,0xdc,0xdb,0xcc,0xcb,0xbc,0xbb,0xac,0xbb,0xbc,0xbc,0xbc,
+0xaa,0x8a,0x08,0x98,0xdb,0xbc,0xaa,0x10,0x42,0x44,0x44,0x44,0x34,0x23,0x13,0x01,
+0x21,0x43,0x34,0x32,0x01,0x90,0x98,0xcb,0xdd,0xcc,0xbb,0xbb,0xaa,0xab,0xbc,0xcb,
+0xac,0xaa,0x9a,0x89,0x09,0x88,0x00,0x21,0x53,0x35,0x35,0x34,0x43,0x33,0x33,0x34,
+0x33,0x33,0x12,0x01,0x80,0x99,0xca,0xcc,0xdb,0xbb,0xbc,0xbd,0xbd,0xbd,0xbb,0xbb,
+0xab,0xaa,0xbb,0xbb,0xab,0x08,0x63,0x55,0x53,0x33,0x32,0x24,0x34,0x45,0x24,0x24,
+0x12,0x12,0x11,0x22,0x33,0x33,0x22,0x81,0xaa,0xcc,0xbb,0xcb,0xcb,0xdc,0xcb,0xbc,
+0xbb,0xbb,0xba,0xaa,0xba,0xab,0xaa,0x20,0x54,0x35,0x24,0x24,0x34,0x53,0x43,0x33,
+0x24,0x32,0x33,0x33,0x24,0x12,0x80,0x99,0xb9,0xbc,0xcd,0xcc,0xbc,0xbd,0xcb,0xcb,
+0xba,0xbb,0xbc,0xbc,0xac,0xab,0x99,0x88,0x88,0x99,0xba,0x99,0x41,0x55,0x44,0x32,
+0x33,0x32,0x42,0x42,0x32,0x33,0x22,0x11,0x88,0x9a,0xcb,0xbc,0xbc,0xbc,0xcc,0xdb,
+0xbc,0xcc,0xbb,0xab,0x9a,0x99,0xa9,0xca,0xab,0x89,0x73,0x35,0x35,0x43,0x22,0x23,
+0x44,0x53,0x34,0x33,0x33,0x22,0x21,0x32,0x43,0x32,0x11,0x80,0xaa,0xbc,0xdb,0xcb,
+0xcc,0xcc,0xbb,0xad,0xab,0xbb,0xcb,0xbb,0xbb,0xa9,0x89,0x88,0x89,0x18,0x52,0x45,
+0x34,0x44,0x32,0x22,0x11,0x32,0x45,0x33,0x12,0xdb,0xcd,0xbb,0xaa,0xa9,0x9a,0x8a,
+0x30,0x45,0x02,0xda,0xcd,0x9a,0x19,0x21,0x11,0x00,0x89,0x88,0xb9,0xcf,0xdb,0xaa,
+0x18,0x32,0x35,0x34,0x22,0x23,0x43,0x33,0x44,0x22,0x11,0x90,0xa9,0xab,0xbb,0xbd,
+0xcd,0xdb,0xbc,0xbc,0xbc,0xac,0xbb,0xbc,0xbb,0xac,0xaa,0x9a,0x89,0x00,0x32,0x46,
+0x43,0x33,0x43,0x43,0x53,0x43,0x24,0x23,0x22,0x32,0x22,0x43,0x42,0x22,0x13,0x80,
+0xba,0xac,0x9b,0x89,0xba,0xdf,0xcc,0xcb,0xba,0xa9,0x98,0x98,0xa9,0xaa,0x8a,0x31,
+0x55,0x34,0x34,0x43,0x33,0x35,0x35,0x43,0x43,0x22,0x23,0x22,0x23,0x33,0x33,0x11,
+0xa0,0xeb,0xdb,0xcb,0xdb,0xcb,0xcb,0xbc,0xbb,0xcb,0xba,0xbb,0xbc,0xba,0xaa,0x99,
+0x88,0x89,0x88,0x20,0x55,0x35,0x35,0x33,0x33,0x43,0x33,0x44,0x33,0x23,0x80,0xca,
+0xcb,0xaa,0xaa,0xba,0xce,0xbc,0xbd,0xbc,0xbc,0xcb,0xbb,0xbb,0xcb,0xcb,0xba,0xaa,
+0x99,0x88,0x11,0x63,0x53,0x33,0x43,0x43,0x53,0x44,0x33,0x34,0x22,0x22,0x22,0x33,
+0x35,0x23,0x13,0x80,0xba,0xac,0x8a,0x88,0xc8,0xdd,0xcc,0xbb,0xab,0xaa,0xaa,0xba,
+0xac,0xab,0x99,0x20,0x53,0x35,0x34,0x33,0x35,0x34,0x35,0x43,0x33,0x33,0x34,0x32,
+0x23,0x01,0x80,0xa9,0xaa,0xdb,0xdc,0xcc,0xcd,0xcb,0xab,0xbb,0xbb,0xcc,0xcc,0xcb,
+0xaa,0xaa,0x99,0x99,0x18,0x63,0x34,0x34,0x22,0x11,0x32,0x55,0x34,0x33,0x33,0x23,
+0x22,0x12,0x98,0xbc,0xbc,0xaa,0x9a,0xb9,0xdc,0xbc,0xcc,0xbb,0xcb,0xbb,0xbc,0xcb,
+0xbb,0xcb,0xaa,0xaa,0x99,0x88,0x00,0x21,0x42,0x44,0x34,0x35,0x53,0x33,0x43,0x23,
+0x24,0x32,0x33,0x43,0x32,0x23,0x01,0x98,0xba,0xbd,0xcb,0xdb,0xcc,0xbc,0xbd,0xcb,
+0xaa,0xaa,0x99,0x99,0xba,0xbb,0x8a,0x51,0x46,0x34,0x33,0x33,0x34,0x44,0x44,0x33,
+0x34,0x23,0x22,0x23,0x33,0x43,0x33,0x13,0x80,0xb9,0xcc,0xcb,0xca,0xdb,0xdb,0xdb,
+0xba,0xbb,0xba,0xba,0xbb,0xac,0xab,0xa9,0x98,0x08,0x21,0x45,0x35,0x34,0x43,0x34,
+0x44,0x33,0x34,0x32,0x32,0x23,0x02,0x80,0xb9,0xaa,0xbb,0xdc,0xec,0xbc,0xbd,0xbc,
+0xbb,0xcb,0xcb,0xcb,0xcb,0xbb,0xab,0xaa,0x99,0x98,0x98,0x08,0x31,0x45,0x53,0x42,
+0x43,0x43,0x24,0x33,0x33,0x32,0x43,0x33,0x43,0x22,0x01,0x98,0xba,0xcb,0xbb,0xba,
+0xce,0xdc,0xbc,0xbc,0xaa,0x89,0x88,0x99,0xb9,0xbc,0x89,0x62,0x54,0x43,0x32,0x22,
+0x33,0x45,0x53,0x33,0x24,0x32,0x22,0x22,0x33,0x43,0x22,0x11,0x80,0xa9,0xcc,0xcc,
+0xbc,0xcc,0xbb,0xcc,0xca,0xba,0xcb,0xba,0xbb,0xab,0x9a,0xa9,0xa9,0xcb,0xbb,0x09,
+0x73,0x35,0x23,0x01,0x98,0x18,0x43,0x45,0x42,0x33,0x46,0x43,0x33,0x01,0xa8,0xa9,
+0x00,0x42,0x11,0xa8,0xcc,0xcc,0xdb,0xcb,0xcc,0xba,0xaa,0x99,0x89,0xa9,0xa9,0x99,
+0x08,0x42,0x44,0x33,0x34,0x34,0x43,0x34,0x43,0x32,0x32,0x22,0x11,0x11,0x08,0x98,
+0xca,0xcd,0xcc,0xbc,0xad,0xac,0xac,0xbb,0xbb,0xab,0xaa,0xa9,0xaa,0x89,0x10,0x45,
+0x34,0x44,0x42,0x32,0x44,0x43,0x34,0x43,0x33,0x32,0x12,0x22,0x42,0x32,0x23,0x01,
+0xb9,0xdb,0xbc,0xcb,0xcb,0xdb,0xdb,0xbb,0xbc,0xba,0x99,0x99,0x88,0x08,0x18,0x42,
+0x44,0x35,0x34,0x34,0x34,0x34,0x34,0x43,0x32,0x23,0x22,0x12,0x11,0x80,0xb9,0xcc,
+0xbc,0xbc,0xbc,0xbd,0xcc,0xcb,0xbb,0xac,0xab,0xba,0xba,0xac,0xbb,0x9a,0x08,0x32,
+0x35,0x24,0x23,0x53,0x63,0x43,0x34,0x23,0x12,0x80,0x08,0x18,0x10,0x80,0xd9,0xcd,
+0xdb,0xbb,0xbc,0xdb,0xbb,0xcc,0xbb,0xbb,0xac,0xba,0xaa,0xa9,0x88,0x20,0x43,0x44,
+0x33,0x44,0x53,0x44,0x43,0x33,0x33,0x33,0x33,0x53,0x43,0x32,0x12,0x80,0xaa,0xab,
+0x9a,0x88,0xc9,0xde,0xdb,0xcb,0xba,0xa9,0x9a,0xaa,0xaa,0xa9,0x88,0x31,0x45,0x34,
+0x34,0x34,0x34,0x35,0x43,0x33,0x32,0x33,0x43,0x23,0x22,0x80,0xba,0xcc,0xcb,0xcb,
+0xcb,0xdc,0xbc,0xbd,0xbc,0xaa,0xaa,0xb9,0xcc,0xbc,0xbb,0xab,0x88,0x00,0x42,0x54,
+0x44,0x33,0x23,0x23,0x43,0x53,0x24,0x33,0x23,0x22,0x02,0x91,0xd9,0xbc,0xad,0xab,
+0xaa,0xba,0xcc,0xcc,0xbb,0xbb,0xbb,0xab,0xba,0xbb,0xbc,0xaa,0x09,0x31,0x45,0x33,
+0x34,0x44,0x53,0x43,0x33,0x24,0x23,0x22,0x22,0x21,0x12,0x00,0x98,0xcb,0xcb,0xbc,
+0xdc,0xcc,0xdb,0xbb,0xbb,0xbb,0xab,0xcb,0xbb,0xbb,0x09,0x41,0x45,0x43,0x32,0x43,
+0x34,0x45,0x53,0x42,0x22,0x22,0x21,0x21,0x32,0x24,0x22,0x01,0x98,0xbb,0xbb,0xcb,
+0xcc,0xcc,0xbd,0xbc,0xbb,0xbb,0xbb,0xba,0xbb,0xbb,0x9a,0x10,0x45,0x44,0x34,0x53,
+0x33,0x44,0x43,0x32,0x23,0x23,0x33,0x33,0x23,0x02,0xa8,0xcc,0xbc,0xcb,0xdb,0xcc,
+0xeb,0xbb,0xbc,0xbb,0xbb,0xbb,0xbc,0xcb,0xbb,0xab,0x89,0x20,0x32,0x12,0x11,0x41,
+0x56,0x44,0x34,0x33,0x23,0x21,0x21,0x32,0x23,0x13,0xa8,0xdc,0xdb,0xcb,0xcb,0xbc,
+0xbc,0xcc,0xba,0xab,0xbb,0xac,0xbb,0xba,0x89,0x21,0x53,0x43,0x42,0x43,0x45,0x44,
+0x43,0x33,0x33,0x33,0x42,0x42,0x42,0x22,0x22,0x81,0x90,0x99,0x9a,0xba,0xdb,0xcd,
+0xdb,0xbc,0xbb,0xbb,0xab,0xbb,0xac,0xab,0xaa,0x88,0x18,0x21,0x45,0x44,0x44,0x33,
+0x24,0x43,0x32,0x34,0x42,0x22,0x11,0x98,0xca,0xbb,0xab,0xba,0xec,0xdd,0xbc,0xbc,
+0xac,0xba,0xaa,0xa9,0x08,0x21,0x23,0x80,0xb9,0x09,0x65,0x35,0x34,0x24,0x33,0x43,
+0x23,0x13,0x00,0x08,0x10,0x33,0x24,0x01,0xca,0xcc,0xcb,0xca,0xba,0xdb,0xbc,0xbd,
+0xbc,0xac,0xba,0xaa,0xba,0xab,0xbb,0xaa,0x88,0x31,0x44,0x34,0x53,0x33,0x45,0x43,
+0x43,0x33,0x33,0x34,0x33,0x33,0x22,0x12,0x00,0x99,0xb9,0xeb,0xeb,0xbc,0xbd,0xbc,
+0xbb,0xbb,0xbb,0xbc,0xcb,0xba,0x89,0x20,0x44,0x43,0x33,0x34,0x34,0x36,0x44,0x43,
+0x32,0x23,0x23,0x33,0x43,0x43,0x12,0x11,0x98,0xa9,0xba,0xbc,0xdc,0xdb,0xdb,0xbb,
+0xbc,0xab,0xbb,0xbb,0xbb,0xbb,0xbb,0xa9,0x08,0x42,0x45,0x34,0x35,0x44,0x33,0x34,
+0x34,0x32,0x33,0x33,0x23,0x02,0x98,0xba,0xbd,0xcb,0xcc,0xcc,0xbc,0xbd,0xbc,0xcb,
+0xba,0xba,0xcb,0xcb,0xbb,0xba,0x99,0x08,0x11,0x11,0x22,0x44,0x54,0x53,0x43,0x33,
+0x33,0x33,0x43,0x32,0x32,0x22,0x22,0x00,0xa0,0xda,0xdc,0xbc,0xbc,0xbc,0xcb,0xbb,
+0xcc,0xba,0xac,0x9a,0x88,0x10,0x32,0x32,0x43,0x44,0x45,0x44,0x43,0x33,0x24,0x32,
+0x33,0x43,0x33,0x33,0x32,0x22,0x01,0x88,0xaa,0xcc,0xdb,0xcc,0xcc,0xcb,0xcb,0xbb,
+0xbc,0xba,0xba,0xaa,0xba,0xab,0xab,0x09,0x42,0x45,0x34,0x33,0x43,0x32,0x35,0x44,
+0x24,0x13,0x81,0xaa,0xac,0xab,0x9a,0xab,0x9a,0x28,0x44,0x03,0xfb,0xce,0xbb,0x9a,
+0x18,0x00,0x80,0x99,0xa9,0x99,0xbc,0xbe,0xac,0x08,0x44,0x44,0x43,0x22,0x32,0x33,
+0x43,0x43,0x22,0x22,0x00,0xa9,0xcb,0xbc,0xcb,0xcc,0xbc,0xbd,0xcc,0xab,0xbb,0xac,
+0xba,0xbb,0xcb,0x9a,0x89,0x10,0x31,0x44,0x34,0x35,0x34,0x34,0x43,0x24,0x33,0x24,
+0x23,0x32,0x22,0x12,0x12,0x11,0x01,0x90,0xeb,0xcd,0xdb,0xba,0xcb,0xba,0xbb,0xcc,
+0xbb,0xba,0x9a,0x08,0x21,0x43,0x33,0x44,0x44,0x44,0x34,0x34,0x43,0x33,0x33,0x33,
+0x24,0x32,0x22,0x22,0x00,0xa8,0xba,0xcc,0xcc,0xdb,0xbc,0xcc,0xbb,0xbc,0xac,0xbb,
+0xba,0xaa,0xba,0xaa,0x9a,0x08,0x41,0x44,0x34,0x44,0x43,0x33,0x34,0x43,0x33,0x43,
+0x22,0x01,0x88,0x89,0x99,0x99,0xeb,0xcd,0xbd,0xbd,0xcb,0xbb,0xcb,0xba,0xac,0xbb,
+0xbb,0xba,0xaa,0x89,0x18,0x20,0x33,0x36,0x35,0x45,0x53,0x33,0x34,0x24,0x23,0x22,
+0x22,0x32,0x32,0x24,0x11,0x98,0xda,0xcb,0xbb,0xac,0xcb,0xbc,0xbd,0xbc,0xbb,0xaa,
+0x08,0x10,0x80,0x80,0x20,0x45,0x45,0x53,0x33,0x35,0x33,0x34,0x34,0x33,0x33,0x24,
+0x22,0x22,0x11,0x80,0xc9,0xbc,0xbd,0xcb,0xdb,0xdb,0xbc,0xbc,0xbb,0xbb,0xbb,0xbb,
+0xac,0xbc,0xbb,0x9b,0x18,0x53,0x23,0x01,0x08,0x30,0x57,0x53,0x23,0x34,0x53,0x43,
+0x33,0x22,0x80,0x88,0x18,0x21,0x12,0xa0,0xcd,0xcc,0xcc,0xcb,0xbc,0xac,0xab,0xaa,
+0x99,0x99,0xaa,0xa9,0x08,0x21,0x35,0x44,0x43,0x34,0x34,0x43,0x33,0x33,0x33,0x32,
+0x12,0x11,0x80,0xa8,0xcc,0xcc,0xbd,0xcc,0xcb,0xbc,0xcb,0xcb,0xaa,0xa9,0x99,0xa9,
+0xa9,0x89,0x20,0x53,0x53,0x43,0x33,0x44,0x53,0x43,0x43,0x43,0x22,0x23,0x21,0x12,
+0x32,0x33,0x22,0x81,0xca,0xbc,0xbd,0xcb,0xbc,0xcc,0xcb,0xcb,0xba,0xaa,0x9a,0x8a,
+0x89,0x88,0x11,0x43,0x45,0x34,0x34,0x44,0x33,0x35,0x33,0x34,0x32,0x33,0x22,0x22,
+0x11,0x80,0xba,0xcd,0xbc,0xbc,0xbc,0xcc,0xdb,0xcb,0xbb,0xbb,0xbb,0xbb,0xbb,0xcb,
+0xab,0x9b,0x08,0x42,0x44,0x43,0x32,0x34,0x44,0x35,0x43,0x23,0x22,0x00,0x80,0x80,
+0x80,0x90,0xc9,0xdc,0xcc,0xcb,0xbb,0xbc,0xbc,0xcc,0xba,0xbb,0xbb,0xba,0xab,0xaa,
+0x89,0x22,0x45,0x43,0x33,0x35,0x44,0x44,0x43,0x33,0x24,0x22,0x22,0x22,0x24,0x33,
+0x13,0x80,0xb9,0xbb,0xbb,0xba,0xdc,0xcd,0xcc,0xcb,0xab,0xab,0xaa,0xa9,0xa9,0x99,
+0x89,0x31,0x45,0x44,0x33,0x44,0x43,0x43,0x24,0x33,0x33,0x23,0x43,0x22,0x12,0x80,
+0xa9,0xcc,0xcb,0xbb,0xbd,0xdc,0xeb,0xbb,0xbc,0xbb,0xaa,0xba,0xcc,0xbc,0xbb,0x9a,
+0x89,0x00,0x32,0x55,0x35,0x34,0x43,0x22,0x32,0x43,0x44,0x32,0x22,0x21,0x11,0x80,
+0xb9,0xcd,0xbc,0xba,0xbb,0xbb,0xcd,0xcb,0xbc,0xbb,0xab,0xab,0xaa,0xab,0xbb,0x9b,
+0x09,0x42,0x44,0x34,0x53,0x43,0x34,0x53,0x32,0x24,0x32,0x22,0x11,0x02,0x11,0x00,
+0x99,0xca,0xcb,0xbc,0xcd,0xbc,0xbd,0xbc,0xbb,0xcb,0xaa,0xba,0xaa,0xaa,0x89,0x31,
+0x45,0x34,0x34,0x34,0x53,0x43,0x44,0x33,0x24,0x23,0x22,0x22,0x23,0x24,0x22,0x81,
+0x99,0xcb,0xbb,0xcb,0xbd,0xcd,0xcb,0xcb,0xbb,0xbb,0xbb,0xba,0xab,0x9a,0x99,0x21,
+0x54,0x44,0x43,0x43,0x53,0x33,0x25,0x33,0x33,0x33,0x23,0x33,0x23,0x01,0x98,0xcc,
+0xbc,0xad,0xac,0xcc,0xdb,0xbc,0xdb,0xba,0xaa,0xaa,0xab,0xbc,0xbb,0xaa,0x89,0x31,
+0x34,0x32,0x21,0x41,0x45,0x45,0x34,0x23,0x23,0x12,0x22,0x22,0x23,0x02,0xa8,0xdc,
+0xdb,0xbb,0xcc,0xdb,0xcb,0xcb,0xab,0xbb,0xbb,0xac,0xbb,0xbb,0x99,0x21,0x63,0x33,
+0x34,0x43,0x54,0x53,0x34,0x34,0x33,0x33,0x23,0x43,0x43,0x32,0x22,0x01,0x98,0xaa,
+0xbb,0xbc,0xcd,0xbc,0xcd,0xbb,0xac,0xbb,0xab,0xbb,0xbb,0xbb,0x9a,0x08,0x21,0x43,
+0x45,0x44,0x53,0x33,0x25,0x43,0x32,0x33,0x32,0x43,0x12,0x01,0x99,0xcb,0xac,0xba,
+0xeb,0xdc,0xbc,0xbd,0xbb,0xcb,0xaa,0xab,0x99,0x08,0x10,0x00,0x98,0x18,0x64,0x35,
+0x35,0x33,0x24,0x34,0x33,0x24,0x11,0x00,0x01,0x22,0x33,0x12,0xb8,0xcd,0xbc,0xbb,
+0xcc,0xcb,0xbc,0xcd,0xca,0xba,0xba,0xaa,0xba,0xba,0xbb,0xab,0x08,0x31,0x35,0x35,
+0x43,0x34,0x35,0x34,0x34,0x24,0x33,0x33,0x33,0x43,0x22,0x11,0x00,0xa8,0xba,0xcc,
+0xcc,0xcc,0xdb,0xbb,0xbc,0xba,0xbb,0xbb,0xac,0xbb,0x9a,0x18,0x43,0x35,0x34,0x43,
+0x53,0x53,0x43,0x34,0x33,0x33,0x23,0x24,0x33,0x33,0x23,0x02,0x98,0xba,0xbd,0xbd,
+0xdb,0xcc,0xcb,0xbc,0xcb,0xba,0xba,0xaa,0xab,0xbb,0xab,0x8a,0x20,0x43,0x35,0x35,
+0x44,0x34,0x44,0x23,0x24,0x32,0x32,0x23,0x23,0x12,0x80,0xa9,0xcb,0xcc,0xcb,0xcc,
+0xbc,0xbd,0xbc,0xac,0xab,0xbb,0xbb,0xcc,0xba,0xab,0x8a,0x18,0x21,0x32,0x43,0x53,
+0x44,0x53,0x34,0x33,0x34,0x22,0x23,0x23,0x33,0x22,0x11,0x80,0xa9,0xcc,0xcc,0xcc,
+0xbc,0xdb,0xbb,0xcb,0xbb,0xac,0xbb,0xaa,0x9a,0x18,0x31,0x43,0x24,0x34,0x55,0x53,
+0x34,0x43,0x33,0x33,0x43,0x32,0x24,0x32,0x22,0x12,0x00,0x89,0xba,0xbc,0xbd,0xcd,
+0xbc,0xcc,0xcb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xab,0x9a,0x10,0x63,0x44,0x34,0x34,
+0x43,0x33,0x34,0x34,0x34,0x33,0x01,0x98,0xab,0xbb,0xab,0xcc,0xbb,0xab,0x08,0x98,
+0xef,0xcc,0xbc,0xaa,0x89,0x80,0x99,0xa9,0x9a,0x89,0x99,0xbb,0xac,0x30,0x77,0x43,
+0x24,0x24,0x32,0x32,0x32,0x33,0x43,0x22,0x01,0xa9,0xcb,0xbc,0xbc,0xcc,0xcc,0xcb,
+0xbc,0xcb,0xbb,0xbb,0xac,0xab,0xba,0xaa,0x9a,0x18,0x42,0x54,0x33,0x35,0x53,0x33,
+0x44,0x32,0x24,0x33,0x23,0x33,0x32,0x12,0x12,0x11,0x90,0xc9,0xcc,0xcd,0xcb,0xbc,
+0xbb,0xbc,0xbb,0xbc,0xbb,0xbb,0xaa,0x89,0x10,0x32,0x36,0x44,0x34,0x44,0x43,0x34,
+0x34,0x33,0x43,0x22,0x23,0x32,0x22,0x12,0x01,0xa8,0xba,0xbe,0xcc,0xbc,0xcc,0xbc,
+0xbc,0xcb,0xab,0xbb,0xbb,0xcb,0xaa,0xa9,0x88,0x10,0x32,0x45,0x44,0x43,0x43,0x43,
+0x33,0x43,0x33,0x33,0x33,0x13,0x01,0x88,0x9a,0xcb,0xdc,0xdc,0xdb,0xcb,0xcb,0xbb,
+0xac,0xbb,0xcb,0xba,0xbb,0xab,0x9a,0x88,0x21,0x42,0x43,0x44,0x44,0x53,0x43,0x33,
+0x24,0x33,0x23,0x23,0x13,0x12,0x10,0x80,0xa9,0xdc,0xcc,0xdb,0xac,0xac,0xab,0xbb,
+0xbb,0xcb,0xbb,0x9b,0x19,0x42,0x44,0x33,0x34,0x44,0x34,0x35,0x34,0x43,0x22,0x32,
+0x22,0x22,0x23,0x11,0x90,0xb9,0xdb,0xdb,0xcc,0xcc,0xcb,0xac,0xbb,0xbb,0xbc,0xba,
+0xbb,0xab,0x9a,0x00,0x32,0x33,0x34,0x45,0x45,0x44,0x33,0x23,0x11,0x00,0x10,0x22,
+0x22,0x01,0x20,0x42,0x23,0xc8,0xef,0xcb,0xbb,0xbb,0xab,0xbb,0xbc,0xbb,0xcb,0xbc,
+0xcb,0xaa,0x89,0x32,0x36,0x35,0x44,0x33,0x34,0x24,0x33,0x33,0x32,0x12,0x81,0x88,
+0xba,0xcc,0xdb,0xcc,0xbc,0xbd,0xbc,0xbb,0xac,0xab,0xbb,0xbb,0xba,0x99,0x08,0x42,
+0x53,0x34,0x44,0x43,0x34,0x34,0x43,0x23,0x24,0x22,0x22,0x12,0x11,0x80,0x98,0xa9,
+0xcb,0xdd,0xdb,0xbc,0xcb,0xba,0xbb,0xba,0xbb,0xbb,0xbb,0x0a,0x41,0x35,0x35,0x43,
+0x53,0x43,0x44,0x33,0x24,0x23,0x23,0x22,0x22,0x22,0x11,0x80,0xba,0xcc,0xcc,0xcb,
+0xbc,0xbd,0xbc,0xac,0xbb,0xab,0xbb,0xcb,0xaa,0x89,0x18,0x32,0x35,0x34,0x44,0x44,
+0x43,0x43,0x23,0x23,0x22,0x12,0x21,0x12,0x01,0xa9,0xdd,0xcb,0xbc,0xbc,0xcc,0xbb,
+0xbd,0xcb,0xba,0xbb,0xba,0x9a,0x99,0x89,0x00,0x20,0x53,0x54,0x53,0x43,0x43,0x33,
+0x43,0x32,0x23,0x23,0x23,0x22,0x02,0x90,0xcb,0xbd,0xcd,0xcb,0xcb,0xbc,0xcb,0xbb,
+0xbb,0xab,0x9b,0x99,0x10,0x21,0x32,0x45,0x45,0x44,0x34,0x34,0x24,0x33,0x32,0x43,
+0x32,0x22,0x22,0x11,0x80,0xa8,0xcb,0xdb,0xcc,0xcc,0xcb,0xbc,0xbb,0xcb,0xbb,0xba,
+0xbb,0xaa,0x99,0x08,0x21,0x43,0x35,0x36,0x35,0x34,0x43,0x22,0x22,0x23,0x43,0x12,
+0x91,0xca,0xcc,0xab,0xbb,0xcc,0xbb,0xbc,0xba,0xbb,0xcc,0xbc,0xbc,0x9a,0x89,0x11,
+0x22,0x43,0x34,0x34,0x33,0x33,0x53,0x35,0x36,0x24,0x33,0x22,0x11,0x01,0x01,0x00,
+0xb9,0xdc,0xdb,0xbc,0xcc,0xbb,0xbd,0xbb,0xac,0xbb,0xbb,0xab,0xaa,0x99,0x08,0x21,
+0x53,0x44,0x43,0x34,0x35,0x44,0x33,0x43,0x22,0x23,0x22,0x12,0x12,0x01,0x98,0xca,
+0xcc,0xbc,0xbd,0xbc,0xbc,0xac,0xbb,0xbb,0xbb,0xab,0xaa,0x00,0x42,0x44,0x42,0x42,
+0x53,0x34,0x35,0x43,0x23,0x23,0x33,0x42,0x32,0x22,0x01,0x88,0xb9,0xca,0xbc,0xdc,
+0xdb,0xbc,0xcb,0xac,0xba,0xaa,0xab,0xaa,0xaa,0x99,0x08,0x11,0x43,0x45,0x44,0x34,
+0x35,0x33,0x24,0x33,0x32,0x32,0x22,0x12,0x80,0xb9,0xbd,0xbd,0xcc,0xcb,0xcc,0xcb,
+0xac,0xbb,0xbb,0xbb,0xab,0xbb,0xbb,0xaa,0x08,0x41,0x44,0x34,0x35,0x34,0x44,0x33,
+0x24,0x33,0x33,0x32,0x12,0x12,0x80,0xa9,0xcc,0xbc,0xbc,0xcd,0xcb,0xbc,0xbc,0xab,
+0xbb,0xaa,0xaa,0xaa,0x9a,0x19,0x51,0x44,0x35,0x34,0x44,0x42,0x32,0x43,0x43,0x32,
+0x32,0x22,0x11,0x11,0x80,0x90,0xba,0xdc,0xdb,0xbc,0xcc,0xbb,0xbc,0xcb,0xba,0xaa,
+0xab,0xaa,0x8a,0x08,0x21,0x35,0x35,0x44,0x43,0x34,0x34,0x33,0x43,0x22,0x23,0x11,
+0x81,0x98,0xab,0xbb,0xdc,0xdc,0xcc,0xbc,0xbc,0xcb,0xba,0xba,0xa9,0x88,0x08,0x80,
+0x88,0x00,0x62,0x35,0x45,0x33,0x34,0x34,0x43,0x22,0x11,0x01,0x11,0x11,0x12,0x90,
+0xca,0xcc,0xbc,0xcb,0xbc,0xcc,0xcb,0xcb,0xba,0xbb,0xbb,0xba,0xaa,0x99,0x09,0x10,
+0x43,0x44,0x44,0x34,0x34,0x44,0x33,0x33,0x43,0x22,0x22,0x23,0x13,0x11,0x99,0xbc,
+0xcd,0xcb,0xdb,0xbc,0xbc,0xcb,0xbb,0xba,0xab,0xaa,0x9a,0x89,0x10,0x32,0x55,0x44,
+0x53,0x34,0x43,0x33,0x43,0x33,0x33,0x43,0x32,0x21,0x10,0x88,0x88,0xaa,0xeb,0xcc,
+0xcc,0xbc,0xbc,0xbb,0xbb,0xac,0xbb,0xba,0x9b,0x89,0x20,0x43,0x44,0x53,0x53,0x43,
+0x43,0x43,0x32,0x23,0x33,0x32,0x22,0x12,0x80,0xa9,0xdb,0xdb,0xbc,0xbd,0xcd,0xcb,
+0xbb,0xbb,0xac,0xba,0xab,0xbb,0xbb,0x99,0x20,0x53,0x43,0x43,0x33,0x45,0x34,0x35,
+0x33,0x33,0x32,0x22,0x22,0x12,0x80,0xa9,0xbd,0xcd,0xdb,0xdb,0xcb,0xcb,0xab,0xac,
+0xaa,0xaa,0xba,0xaa,0x99,0x08,0x43,0x44,0x34,0x43,0x34,0x35,0x44,0x33,0x24,0x23,
+0x12,0x12,0x12,0x22,0x21,0x80,0xc9,0xdb,0xbc,0xcc,0xdb,0xca,0xba,0xbb,0xcb,0xaa,
+0xab,0xa9,0x89,0x10,0x32,0x35,0x44,0x53,0x43,0x34,0x43,0x43,0x32,0x22,0x22,0x11,
+0x11,0x00,0x90,0xba,0xce,0xbd,0xcc,0xcb,0xbb,0xdb,0xbb,0xcc,0xba,0xba,0xaa,0x9a,
+0x89,0x20,0x45,0x34,0x33,0x34,0x43,0x34,0x35,0x34,0x32,0x22,0x22,0x22,0x01,0xa9,
+0xbc,0xcc,0xaa,0xcb,0xdb,0xbc,0xbc,0xbc,0xbb,0xba,0xbb,0xab,0xbb,0xab,0x9a,0x10,
+0x34,0x45,0x53,0x43,0x34,0x34,0x34,0x33,0x24,0x22,0x22,0x12,0x02,0x81,0x99,0xcb,
+0xcc,0xdb,0xbc,0xcc,0xcb,0xcb,0xba,0xba,0xaa,0xaa,0xaa,0x9a,0x00,0x42,0x54,0x43,
+0x34,0x34,0x34,0x44,0x33,0x43,0x32,0x32,0x12,0x12,0x01,0x01,0x88,0xba,0xbe,0xcd,
+0xcb,0xbc,0xdb,0xab,0xac,0xba,0xba,0xaa,0xaa,0x89,0x20,0x42,0x53,0x34,0x44,0x34,
+0x44,0x33,0x33,0x43,0x22,0x22,0x21,0x11,0x00,0x98,0xbb,0xbd,0xcd,0xdb,0xdb,0xcb,
+0xbb,0xac,0xbb,0xac,0xab,0xaa,0x9a,0x89,0x10,0x21,0x34,0x35,0x35,0x35,0x44,0x33,
+0x43,0x22,0x21,0x12,0x22,0x12,0x81,0xba,0xcd,0xcb,0xdb,0xcb,0xbc,0xbd,0xbb,0xac,
+0xab,0xab,0xbb,0xaa,0x99,0x00,0x42,0x43,0x34,0x44,0x44,0x53,0x33,0x34,0x33,0x23,
+0x33,0x42,0x22,0x13,0x01,0x99,0xcb,0xcb,0xcb,0xcc,0xbc,0xbd,0xcb,0xbb,0xab,0xab,
+0xab,0xaa,0x99,0x18,0x42,0x54,0x43,0x43,0x44,0x43,0x43,0x32,0x33,0x23,0x23,0x22,
+0x13,0x01,0xa8,0xbc,0xbd,0xcc,0xbc,0xbd,0xcc,0xcb,0xbb,0xac,0xab,0xaa,0xaa,0xba,
+0xba,0x9a,0x08,0x32,0x36,0x55,0x53,0x34,0x34,0x33,0x23,0x22,0x23,0x43,0x32,0x12,
+0x81,0x99,0xdb,0xcc,0xcc,0xbc,0xad,0xbb,0xab,0xbb,0xbb,0xbc,0xbb,0xaa,0x09,0x20,
+0x42,0x43,0x53,0x53,0x34,0x34,0x44,0x32,0x22,0x23,0x22,0x22,0x12,0x80,0xb9,0xeb,
+0xcb,0xbc,0xcc,0xbc,0xcc,0xba,0xbb,0xba,0xbb,0xba,0xab,0x99,0x10,0x43,0x44,0x53,
+0x43,0x34,0x35,0x44,0x32,0x33,0x23,0x33,0x32,0x23,0x23,0x11,0xa8,0xeb,0xbc,0xcc,
+0xcb,0xbc,0xbc,0xbc,0xac,0xab,0x9b,0xaa,0x99,0x89,0x10,0x33,0x45,0x53,0x53,0x43,
+0x34,0x43,0x33,0x23,0x24,0x22,0x22,0x12,0x00,0x98,0xba,0xcd,0xcb,0xcc,0xcb,0xdb,
+0xbb,0xbc,0xbb,0xac,0xaa,0x9a,0x9a,0x89,0x08,0x22,0x53,0x44,0x53,0x34,0x34,0x43,
+0x32,0x33,0x32,0x24,0x12,0x01,0xa8,0xba,0xbd,0xdb,0xcb,0xcc,0xbc,0xcc,0xba,0xbb,
+0xbb,0xba,0xbb,0xba,0xaa,0x09,0x21,0x44,0x44,0x53,0x53,0x43,0x34,0x33,0x24,0x32,
+0x33,0x33,0x23,0x12,0x80,0xa9,0xba,0xbc,0xcd,0xbd,0xcd,0xcb,0xbb,0xab,0xba,0xaa,
+0xbb,0xbb,0x9a,0x20,0x44,0x44,0x43,0x34,0x35,0x53,0x33,0x34,0x32,0x33,0x33,0x32,
+0x12,0x01,0x99,0xcb,0xdb,0xbc,0xdc,0xdb,0xcb,0xac,0xcb,0xaa,0xaa,0xba,0xba,0xbb,
+0xab,0x08,0x41,0x44,0x23,0x33,0x34,0x45,0x34,0x34,0x33,0x43,0x33,0x34,0x33,0x01,
+0x99,0xa9,0x99,0xa9,0xec,0xcc,0xbc,0xbc,0xdb,0xba,0xac,0xab,0xab,0x99,0x88,0x00,
+0x11,0x32,0x45,0x44,0x53,0x43,0x33,0x33,0x24,0x32,0x22,0x13,0x12,0x88,0xa9,0xcc,
+0xbc,0xcc,0xbc,0xcc,0xcb,0xbb,0xac,0xbb,0xba,0xab,0xaa,0x89,0x10,0x32,0x35,0x35,
+0x44,0x53,0x43,0x34,0x33,0x24,0x23,0x23,0x23,0x33,0x12,0x81,0xb9,0xbc,0xbd,0xbc,
+0xcd,0xdb,0xcb,0xcb,0xba,0xaa,0xaa,0xaa,0xaa,0x89,0x28,0x42,0x44,0x43,0x44,0x43,
+0x34,0x43,0x33,0x24,0x32,0x22,0x21,0x02,0x01,0x90,0xa9,0xcc,0xdb,0xbc,0xbd,0xcc,
+0xcb,0xba,0xbb,0xac,0xaa,0xaa,0xaa,0x98,0x10,0x32,0x35,0x35,0x44,0x53,0x33,0x44,
+0x32,0x32,0x32,0x22,0x22,0x11,0x80,0xa9,0xcb,0xcc,0xbd,0xcd,0xcb,0xcb,0xbb,0xbb,
+0xcb,0xba,0xbb,0xba,0xa9,0x88,0x21,0x43,0x44,0x53,0x53,0x34,0x53,0x33,0x33,0x43,
+0x32,0x22,0x22,0x11,0x81,0x98,0xba,0xcd,0xcc,0xbc,0xcc,0xbb,0xbc,0xbb,0xbb,0xcb,
+0xba,0xaa,0x89,0x20,0x34,0x34,0x44,0x34,0x44,0x34,0x34,0x33,0x43,0x22,0x23,0x23,
+0x22,0x11,0x88,0xb9,0xcc,0xbc,0xcd,0xdb,0xcb,0xcb,0xbb,0xcb,0xaa,0xab,0xbb,0xaa,
+0x99,0x10,0x32,0x53,0x43,0x44,0x44,0x34,0x34,0x23,0x23,0x22,0x12,0x22,0x11,0x01,
+0x80,0x89,0xba,0xdd,0xcd,0xbd,0xbc,0xcb,0xba,0xba,0xbb,0xbb,0xbb,0xbb,0xab,0x99,
+0x21,0x45,0x45,0x44,0x43,0x34,0x33,0x34,0x33,0x33,0x33,0x22,0x02,0x90,0xb9,0xbc,
+0xcd,0xcc,0xdb,0xdb,0xbb,0xac,0xbb,0xbb,0xbb,0xac,0xaa,0x99,0x08,0x21,0x34,0x45,
+0x43,0x34,0x35,0x43,0x33,0x24,0x33,0x32,0x23,0x13,0x02,0x80,0x99,0xcb,0xdb,0xcc,
+0xbd,0xcc,0xbb,0xac,0xab,0xab,0xbb,0xbb,0xba,0x89,0x21,0x44,0x53,0x43,0x34,0x35,
+0x34,0x34,0x43,0x23,0x33,0x22,0x23,0x12,0x02,0x90,0xb9,0xbd,0xcc,0xcc,0xdb,0xdb,
+0xca,0xba,0xaa,0xbb,0xba,0xbb,0xaa,0x9a,0x10,0x43,0x44,0x34,0x44,0x53,0x43,0x33,
+0x24,0x23,0x23,0x23,0x12,0x12,0x80,0xa8,0xdb,0xcc,0xbc,0xcc,0xbc,0xdb,0xbb,0xcb,
+0xba,0xbb,0xab,0xab,0x9a,0x89,0x10,0x42,0x63,0x43,0x44,0x43,0x34,0x43,0x32,0x33,
+0x33,0x32,0x32,0x21,0x01,0xa9,0xdb,0xcc,0xdb,0xbc,0xcc,0xbb,0xbc,0xcb,0xaa,0xbb,
+0xaa,0x9a,0x89,0x11,0x42,0x43,0x34,0x45,0x34,0x35,0x43,0x33,0x33,0x33,0x33,0x24,
+0x22,0x11,0x88,0xa9,0xdb,0xdb,0xdb,0xdb,0xcb,0xbc,0xbb,0xbc,0xba,0xab,0xab,0x9b,
+0x8a,0x00,0x32,0x44,0x34,0x45,0x53,0x43,0x33,0x33,0x33,0x43,0x32,0x23,0x12,0xa0,
+0xda,0xcb,0xcb,0xbc,0xbc,0xbd,0xcb,0xca,0xba,0xbb,0xcb,0xaa,0x9a,0x89,0x10,0x21,
+0x33,0x24,0x02,0x90,0xba,0xaa,0x88,0x00,0x90,0xa9,0x9a,0x89,0x18,0x00,0x80,0x99,
+0xcc,0xcd,0xbb,0x9a,0x38,0x45,0x43,0x12,0x80,0x80,0x30,0x44,0x23,0x01,0x99,0x31,
+0x57,0x24,0x02,0x00,0x41,0x55,0x34,0x22,0x02,0x01,0x33,0x36,0x24,0x22,0x11,0x22,
+0x42,0x53,0x34,0x35,0x32,0x02,0x81,0x31,0x46,0x44,0x23,0x12,0x01,0x10,0x42,0x34,
+0x34,0x33,0x12,0x01,0x10,0x52,0x45,0x33,0x23,0x11,0x10,0x31,0x43,0x23,0x23,0x42,
+0x43,0x24,0x23,0x23,0x34,0x25,0x14,0x02,0x80,0x88,0x08,0x00,0x18,0x1a,0x1a,0x29,
+0x18,0x90,0x98,0x2a,0x79,0x01,0xf8,0xde,0xeb,0xba,0x9a,0x09,0x00,0xa9,0xcd,0xbd,
+0xaa,0x89,0x18,0x98,0xde,0xcc,0xac,0x9a,0x09,0x08,0x88,0xba,0xcc,0xaa,0x99,0x88,
+0x01,0x10,0x98,0xa9,0x00,0x46,0x35,0x24,0x33,0x43,0x34,0x13,0x80,0x09,0x73,0x47,
+0x33,0x13,0x80,0x88,0x32,0x47,0x34,0x33,0x23,0x12,0x11,0x32,0x55,0x53,0x32,0x11,
+0x11,0x31,0x43,0x43,0x12,0x11,0x31,0x32,0x02,0x98,0x28,0x65,0x43,0x13,0x01,0x80,
+0x88,0xcb,0xcd,0x8a,0x20,0x33,0xb1,0xdf,0xac,0x9a,0x00,0x00,0xb8,0xdc,0xdc,0xca,
+0x9a,0x88,0x01,0xb8,0xcf,0xbd,0xab,0x8a,0x88,0x88,0x18,0x55,0x35,0x24,0x01,0x80,
+0x00,0x53,0x43,0x33,0x12,0x12,0x22,0x90,0xdc,0xbd,0xab,0x9a,0x89,0x98,0xb9,0xca,
+0xab,0xaa,0x09,0x00,0x98,0xdc,0xbd,0xbb,0x99,0x08,0x80,0x88,0x08,0x10,0x00,0xa9,
+0x09,0x40,0x21,0xb9,0xbd,0x38,0x57,0x53,0x32,0x34,0x34,0x24,0x02,0x00,0x00,0x33,
+0x45,0x43,0x24,0x33,0x14,0x12,0x43,0x45,0x34,0x23,0x81,0x80,0x32,0x47,0x43,0x33,
+0x22,0x21,0x10,0x31,0x45,0x45,0x33,0x02,0x90,0x89,0x31,0x46,0x33,0x02,0x80,0x98,
+0x08,0x10,0x33,0x26,0x13,0x90,0xba,0x0a,0x45,0x35,0x02,0x80,0x09,0x10,0xa0,0xfb,
+0xbd,0x99,0x00,0x81,0xdc,0xcc,0xaa,0x89,0x10,0x98,0xcb,0xbc,0xac,0xbb,0xcb,0xac,
+0xab,0xac,0xbc,0xbe,0xbc,0x9c,0x09,0x11,0x98,0xec,0xbc,0xbc,0x9a,0x99,0x99,0xba,
+0xaa,0xaa,0xc9,0xdb,0xbb,0x9a,0x08,0x90,0xca,0xbc,0xcb,0x89,0x21,0x35,0x36,0x33,
+0x12,0x88,0x10,0x55,0x35,0x24,0x22,0x11,0x21,0x33,0x46,0x44,0x43,0x33,0x01,0x90,
+0x11,0x46,0x35,0x23,0x02,0x90,0x08,0x20,0x43,0x22,0x11,0x00,0x00,0x31,0x34,0x34,
+0x82,0xa8,0x9b,0x28,0x15,0xa2,0xde,0xbc,0x8a,0x20,0x91,0xdf,0xce,0xcb,0xbb,0xaa,
+0x89,0x98,0xa8,0xcb,0xcb,0x8a,0x18,0x11,0xb9,0xde,0xac,0xab,0x9a,0x99,0x89,0x18,
+0x54,0x35,0x34,0x12,0x02,0x11,0x32,0x63,0x33,0x24,0x33,0x12,0x98,0xcb,0xcd,0xcb,
+0xba,0x9a,0x08,0x00,0xa8,0xdc,0xbb,0x8a,0x00,0x80,0xd9,0xcb,0xaa,0x00,0x11,0x00,
+0x99,0x89,0x12,0x01,0xa9,0x9a,0x31,0x14,0xb0,0xad,0x19,0x26,0x82,0xbc,0xad,0x61,
+0x55,0x33,0x14,0x90,0x99,0x8a,0x42,0x37,0x33,0x02,0xaa,0x9c,0x40,0x73,0x22,0x81,
+0x80,0x20,0x44,0x34,0x42,0x32,0x34,0x13,0x81,0x08,0x51,0x44,0x12,0x91,0x88,0x52,
+0x55,0x22,0x11,0x88,0x08,0x10,0x80,0x99,0x09,0x31,0x12,0xbc,0x9d,0x61,0x45,0x23,
+0x81,0x98,0x00,0x01,0xea,0xdc,0xba,0x08,0x22,0x83,0xe9,0xcb,0xab,0x89,0x08,0x11,
+0x10,0xca,0xcf,0xbc,0xab,0x8a,0x80,0x90,0xbc,0xbd,0xad,0xbb,0xbb,0xbc,0xbb,0xbd,
+0xbc,0xba,0xbb,0xbc,0xdc,0xbb,0x9a,0x08,0x08,0xbb,0xbe,0x9c,0x09,0x10,0x01,0x88,
+0x88,0x98,0x99,0x48,0x75,0x34,0x22,0x80,0x09,0x62,0x36,0x24,0x01,0x88,0x18,0x41,
+0x24,0x24,0x32,0x43,0x42,0x32,0x32,0x44,0x43,0x12,0x00,0x09,0x32,0x36,0x14,0x91,
+0xaa,0x0a,0x52,0x44,0x23,0x00,0x98,0x99,0x01,0x22,0xa1,0xfc,0xcc,0xaa,0x89,0x22,
+0x12,0xc9,0xcd,0xbb,0x8a,0x10,0x90,0xed,0xdc,0xbb,0xaa,0x88,0x11,0xa0,0xdd,0xbd,
+0xbc,0xaa,0x99,0x08,0x22,0x35,0x36,0x24,0x12,0x80,0x18,0x41,0x54,0x33,0x32,0x10,
+0x88,0x9a,0xdb,0xdb,0xbb,0xaa,0x09,0x80,0x90,0xcb,0xbb,0x9a,0x08,0xa8,0xec,0xcc,
+0xbb,0x9a,0x88,0x11,0x02,0xb8,0xcd,0xbc,0xaa,0x08,0x28,0x20,0x08,0x9a,0x99,0x10,
+0x42,0x11,0x9c,0x9f,0x28,0x75,0x42,0x23,0x00,0x89,0x8a,0x00,0x12,0x90,0xba,0x2a,
+0x75,0x36,0x35,0x23,0x02,0x80,0x08,0x33,0x57,0x33,0x22,0x08,0x08,0x30,0x73,0x34,
+0x32,0x22,0x00,0x99,0x9a,0x30,0x56,0x33,0x12,0x80,0x99,0x09,0x10,0x01,0x90,0xa0,
+0xa0,0x9a,0x61,0x67,0x34,0x24,0x81,0xdb,0xcb,0xaa,0x08,0x11,0x11,0xb9,0xdd,0xcb,
+0x9a,0x18,0x12,0x82,0xcb,0xbf,0xbb,0xcb,0xbb,0xbd,0xbb,0x89,0x20,0xa8,0xfd,0xcb,
+0xaa,0x08,0x01,0xa9,0xbf,0xbd,0xab,0x89,0x08,0x80,0xa9,0xcc,0x9b,0x09,0x31,0x02,
+0xd9,0xdc,0xaa,0x09,0x00,0x80,0x09,0x50,0x45,0x33,0x81,0xab,0x8c,0x51,0x34,0x13,
+0x91,0x80,0x42,0x35,0x34,0x24,0x43,0x33,0x12,0xc8,0xcd,0xbb,0x9a,0x08,0x18,0x19,
+0x09,0x08,0x00,0x80,0x09,0x19,0x10,0x39,0x3c,0x0b,0x18,0x21,0xa1,0xb2,0x91,0x19,
+0x11,0x00,0x19,0x1a,0x29,0x19,0x19,0x19,0x99,0x09,0xb3,0xb5,0xb3,0x08,0x3a,0x11,
+0x93,0x9b,0x1b,0x40,0x48,0x0b,0x9c,0x4a,0x41,0x93,0xfa,0x9c,0x51,0x37,0x26,0x02,
+0x90,0x98,0x88,0x11,0x10,0x99,0x99,0x00,0x22,0x28,0x1e,0x3c,0x3a,0x00,0x90,0x8b,
+0xb0,0x87,0x92,0xb0,0xb0,0x93,0x23,0x09,0x9b,0x0b,0x03,0xa5,0xa1,0x99,0x92,0x94,
+0x92,0x0c,0x2a,0x31,0x11,0xb0,0xd0,0xa3,0x84,0x10,0x0c,0x99,0x95,0x93,0xa0,0xaa,
+0xb2,0x97,0x01,0x09,0x1b,0x11,0x03,0xa0,0xb9,0x00,0x23,0xa2,0xb0,0x1b,0x5a,0x10,
+0xa0,0xb9,0x3a,0x50,0x18,0xaa,0xc0,0x83,0x05,0xd2,0xc1,0x91,0x13,0x12,0x1d,0x1e,
+0x29,0x31,0x98,0xda,0xa0,0x53,0x41,0x0b,0x8f,0x19,0x24,0x03,0xec,0xcd,0xab,0x89,
+0x08,0x10,0x18,0x10,0x90,0xfb,0xaf,0xab,0x8a,0x20,0x11,0x80,0x8b,0x1a,0x30,0x11,
+0xa9,0x9b,0x5a,0x30,0xa1,0xd0,0x1a,0x6a,0x28,0xb8,0xb0,0xb1,0x04,0x12,0x2c,0x2f,
+0x2a,0x01,0x91,0xa8,0x90,0x11,0x94,0xb1,0x99,0x3b,0x5a,0x19,0x89,0xb9,0xb3,0x95,
+0x92,0xc0,0xb1,0x93,0xa6,0xb3,0x90,0x3c,0x5b,0x10,0xb1,0xe8,0x80,0x22,0x14,0xd9,
+0xeb,0x18,0x56,0x35,0x14,0x82,0x98,0x99,0x00,0x02,0x81,0xa9,0x0a,0x38,0x31,0x90,
+0x8d,0x1b,0x32,0x33,0xab,0x8f,0x29,0x32,0x91,0xda,0xb9,0x23,0x17,0xa0,0xbb,0x0a,
+0x35,0x05,0xe9,0xca,0x20,0x57,0x33,0x14,0x81,0x99,0x88,0x18,0x01,0x80,0x99,0x08,
+0x20,0x00,0x88,0x1b,0x2a,0x39,0x3a,0x3b,0x1b,0x09,0xa1,0xb4,0xb3,0x91,0xa0,0x11,
+0x01,0xb3,0x01,0x3c,0x4b,0x00,0xb2,0xb9,0x3a,0x6a,0x29,0x0a,0x0c,0x29,0x53,0x29,
+0x8f,0x1b,0x79,0x21,0xa8,0xef,0xbb,0xab,0x08,0x12,0x01,0x99,0x99,0x00,0x83,0x92,
+0xaa,0x99,0x95,0x95,0x91,0x9a,0x90,0x05,0x01,0x0a,0x1b,0x4b,0x39,0x19,0x2c,0x3e,
+0x19,0x10,0x89,0xd0,0xa3,0x83,0x11,0x99,0x1b,0x19,0x22,0x09,0xaa,0xd3,0x93,0x02,
+0xa9,0xb1,0x10,0x21,0x30,0x3d,0x2d,0x1a,0x11,0x18,0x1d,0x2b,0x18,0x84,0x90,0x8c,
+0x19,0x33,0x13,0xba,0x9c,0x21,0x16,0x80,0x9d,0x1c,0x61,0x13,0xd9,0xcf,0xcb,0x9a,
+0x00,0x11,0x81,0x99,0x98,0x20,0x01,0xb1,0xb0,0x90,0x13,0x13,0x9a,0xab,0x30,0x21,
+0xb2,0xc1,0x90,0x13,0x93,0xb1,0xb1,0xa3,0x13,0x29,0xab,0xb2,0x93,0x12,0xa9,0xa1,
+0x11,0x30,0x19,0x1b,0x99,0xb3,0x03,0x19,0x3c,0x3b,0x11,0x91,0x99,0x09,0xb3,0xa4,
+0x90,0x1a,0x91,0x93,0x91,0x0a,0x00,0x12,0x39,0x1c,0x2b,0x31,0x11,0xa9,0x0b,0x4a,
+0x30,0x99,0xac,0xa9,0x16,0x04,0xb9,0xaf,0x20,0x57,0x25,0x13,0x91,0xa8,0x98,0x02,
+0x02,0xa0,0xa9,0x39,0x40,0x91,0xd0,0x89,0x31,0x13,0x9a,0xaf,0x30,0x35,0xc0,0xff,
+0xcb,0x9a,0x10,0x43,0x24,0x02,0x81,0x88,0x88,0x08,0x00,0x81,0x91,0xb8,0xa0,0x23,
+0x33,0xc9,0xfb,0x08,0x53,0x23,0xfa,0xbf,0xac,0x9a,0x18,0x11,0x80,0xa8,0x90,0x01,
+0x92,0xb2,0xb1,0x29,0x59,0xa1,0xd3,0xb2,0x81,0x92,0xa2,0xa1,0x19,0x19,0x11,0x91,
+0xa0,0xa2,0x01,0x11,0x00,0x90,0x00,0x3a,0x3a,0x19,0xb0,0xb2,0xa2,0x13,0x91,0xb0,
+0x09,0x39,0x13,0xb1,0xab,0x2a,0x52,0x11,0xdb,0xb9,0x32,0x47,0xa0,0xdf,0xbc,0x9c,
+0x09,0x11,0x01,0xa8,0x98,0x00,0x02,0xa2,0xb0,0x99,0x22,0x13,0xa9,0xac,0x91,0x43,
+0x10,0xac,0xa8,0x51,0x39,0xa8,0xd0,0x91,0x94,0xa3,0xb0,0x9b,0x30,0x13,0xd3,0xc1,
+0x10,0x40,0x08,0xb9,0xb9,0x12,0x87,0xb2,0xb8,0x09,0x52,0x12,0xda,0xca,0x31,0x45,
+0x01,0xee,0xcc,0xba,0x89,0x10,0x11,0x80,0x99,0x89,0x20,0x30,0x09,0xab,0x9b,0x43,
+0x24,0xa1,0xfb,0xab,0x70,0x55,0x34,0x23,0x00,0x99,0x0b,0x18,0x13,0x91,0xb9,0x8b,
+0x31,0x16,0x98,0x8d,0x2b,0x41,0x22,0xc9,0xcb,0x10,0x54,0x11,0xbc,0xac,0x31,0x67,
+0x24,0x12,0x00,0x08,0x89,0x89,0x89,0x42,0x46,0x34,0x22,0x80,0x9a,0x89,0x20,0x21,
+0x88,0xaa,0x99,0x12,0x86,0xb3,0xd9,0x98,0x50,0x51,0x08,0xdd,0xcd,0xba,0x99,0x11,
+0x11,0x80,0x9a,0x1a,0x30,0x11,0xa8,0x9c,0x18,0x05,0xa3,0xb9,0x9b,0x53,0x13,0xb0,
+0x9d,0x3a,0x32,0x85,0xba,0xba,0x33,0x16,0xa0,0xab,0x3a,0x73,0x01,0xaa,0x8b,0x59,
+0x22,0xa1,0x8e,0x3c,0x59,0x20,0x9b,0xab,0x30,0x73,0x19,0x8d,0x0b,0x22,0x04,0xb8,
+0xbc,0x10,0x54,0x00,0xda,0x8a,0x50,0x21,0xa0,0xdb,0x09,0x43,0x84,0xb8,0x9e,0x29,
+0x53,0x03,0xe9,0xcc,0xbb,0x88,0x43,0x24,0xa0,0xdc,0xac,0x09,0x32,0x13,0xc8,0xbb,
+0x29,0x44,0x02,0xda,0xab,0x31,0x26,0x91,0xad,0x1b,0x61,0x12,0xb9,0xad,0x28,0x35,
+0x82,0xcd,0x9a,0x52,0x25,0xa1,0xeb,0x8a,0x31,0x33,0xc8,0xbc,0x28,0x37,0x82,0xdd,
+0x8a,0x75,0x46,0x34,0x23,0x22,0x22,0x33,0x44,0x12,0x00,0x80,0x11,0x21,0x01,0xdb,
+0xdc,0xba,0xbb,0xdb,0xdb,0xcc,0xcb,0xab,0xab,0xaa,0xa9,0xbb,0xbb,0xab,0x09,0x21,
+0x32,0x43,0x44,0x34,0x35,0x34,0x34,0x43,0x33,0x32,0x12,0x22,0x21,0x22,0x11,0x98,
+0xcd,0xbd,0xbc,0xab,0xaa,0xda,0xbc,0xad,0x8a,0x28,0x22,0x13,0x11,0x42,0x55,0x34,
+0x35,0x33,0x35,0x33,0x34,0x32,0x43,0x22,0x12,0x81,0x98,0xaa,0xcc,0xdb,0xcb,0xcb,
+0xbc,0xdc,0xbb,0xac,0xaa,0xa9,0xca,0xcc,0xaa,0x89,0x00,0x81,0xba,0xbc,0x9a,0x38,
+0x54,0x54,0x34,0x35,0x23,0x13,0x10,0x10,0x42,0x33,0x23,0x80,0xb9,0xce,0xcd,0xdb,
+0xab,0x9b,0x9a,0xa9,0xca,0xbb,0xaa,0x09,0x10,0x10,0x00,0x21,0x63,0x54,0x43,0x24,
+0x23,0x22,0x22,0x32,0x32,0x01,0xb8,0xbd,0xbd,0xbc,0xcb,0xbc,0xcc,0xbb,0xcb,0xbb,
+0xcb,0x9a,0x99,0x98,0x80,0x10,0x43,0x45,0x44,0x34,0x24,0x43,0x33,0x35,0x53,0x22,
+0x13,0x11,0x11,0x11,0x23,0x01,0xa8,0xcd,0xbb,0xbc,0xcb,0xbc,0xbc,0xbc,0xba,0xba,
+0x9a,0x9a,0x88,0x20,0x53,0x44,0x44,0x43,0x43,0x43,0x33,0x33,0x23,0x22,0x22,0x22,
+0x02,0xb8,0xdc,0xbc,0xbb,0xcc,0xdc,0xcc,0xcb,0xbb,0xba,0xba,0xbb,0xbd,0xbb,0xab,
+0x89,0x11,0x01,0xa8,0x9a,0x51,0x46,0x35,0x33,0x22,0x21,0x31,0x33,0x24,0x02,0xb9,
+0xcc,0xbc,0xcb,0xcb,0xbc,0xbc,0xcc,0xbb,0xcb,0xbb,0xaa,0x89,0x00,0x00,0x08,0x52,
+0x56,0x44,0x43,0x32,0x32,0x53,0x53,0x33,0x24,0x22,0x01,0x11,0x11,0x02,0x81,0xa9,
+0xcb,0xcc,0xcb,0xbc,0xbc,0xdb,0xba,0xbb,0xbb,0xcb,0xba,0x9a,0x00,0x32,0x32,0x11,
+0x52,0x56,0x44,0x23,0x02,0x88,0x18,0x41,0x22,0xb0,0xcf,0xbc,0xcb,0xaa,0xab,0x99,
+0x20,0x22,0x91,0xcd,0xac,0x0a,0x32,0x35,0x23,0x11,0x01,0xa0,0xdc,0xbc,0x8a,0x53,
+0x45,0x22,0x01,0x00,0x21,0x33,0x23,0x90,0xcc,0xbc,0xbb,0xcb,0xcc,0xdb,0xbc,0xdb,
+0xba,0xab,0xaa,0xab,0xbb,0xbb,0xaa,0x10,0x53,0x44,0x43,0x34,0x34,0x34,0x34,0x34,
+0x43,0x23,0x13,0x12,0x22,0x32,0x33,0x02,0xb8,0xdc,0xbb,0xbb,0xbc,0xcd,0xcc,0xcb,
+0xaa,0x88,0x08,0x80,0x88,0x00,0x52,0x45,0x34,0x34,0x33,0x44,0x42,0x32,0x33,0x23,
+0x22,0x22,0x12,0x12,0x81,0xa9,0xcc,0xcc,0xcc,0xdb,0xbc,0xbc,0xbb,0xbb,0xac,0xbb,
+0xac,0xaa,0x89,0x10,0x10,0x00,0x20,0x55,0x45,0x43,0x23,0x12,0x11,0x31,0x43,0x22,
+0xa0,0xcd,0xad,0xab,0xba,0xca,0xdc,0xcb,0xbc,0xba,0xab,0xbb,0xbb,0xac,0xab,0xaa,
+0x09,0x20,0x44,0x44,0x43,0x43,0x43,0x44,0x43,0x33,0x33,0x32,0x12,0x32,0x53,0x33,
+0x22,0xa0,0xcb,0xbb,0x9a,0xa9,0xec,0xcc,0xcb,0xaa,0x99,0x99,0x89,0x99,0x18,0x42,
+0x44,0x34,0x35,0x43,0x43,0x33,0x34,0x33,0x23,0x22,0x22,0x21,0x98,0xfb,0xcb,0xaa,
+0xb9,0xdd,0xcd,0xbc,0xac,0x9a,0xaa,0xdb,0xcb,0xcb,0x9a,0x8a,0x08,0x42,0x44,0x24,
+0x23,0x21,0x42,0x53,0x53,0x22,0x22,0x11,0x01,0x90,0xca,0xbc,0xba,0xa9,0xb9,0xdc,
+0xdb,0xbb,0xbb,0xab,0xcb,0xbb,0xac,0xab,0xaa,0x88,0x10,0x22,0x42,0x43,0x54,0x53,
+0x33,0x34,0x32,0x33,0x43,0x32,0x22,0x23,0x13,0x82,0xb9,0xce,0xdb,0xca,0xcb,0xcc,
+0xbb,0xac,0xaa,0x89,0x89,0x98,0x99,0x08,0x62,0x45,0x34,0x34,0x32,0x43,0x44,0x43,
+0x33,0x32,0x21,0x21,0x32,0x33,0x12,0x90,0xba,0xbd,0xcc,0xdb,0xdb,0xcb,0xbb,0xcb,
+0xba,0xaa,0xaa,0xaa,0x9a,0x08,0x20,0x53,0x43,0x35,0x45,0x34,0x33,0x24,0x32,0x32,
+0x43,0x22,0x80,0xa9,0xbc,0xbb,0xdb,0xeb,0xcc,0xcc,0xbb,0xac,0xba,0xca,0xca,0xbb,
+0xbb,0x9a,0x88,0x00,0x80,0x00,0x32,0x55,0x53,0x43,0x33,0x34,0x33,0x33,0x33,0x24,
+0x33,0x23,0x01,0xc9,0xbc,0xad,0xab,0xcb,0xcc,0xbd,0xbc,0x9b,0x09,0x10,0x01,0x99,
+0x89,0x73,0x46,0x33,0x24,0x22,0x43,0x34,0x25,0x33,0x22,0x22,0x22,0x12,0x12,0x00,
+0x80,0xba,0xcd,0xbd,0xcc,0xcb,0xbc,0xac,0xcb,0xaa,0xbb,0xbc,0xaa,0x89,0x80,0x98,
+0xca,0x8a,0x51,0x45,0x23,0x01,0x98,0x88,0x11,0x43,0x45,0x44,0x25,0x23,0x01,0x99,
+0x89,0x10,0x23,0x80,0xfb,0xdb,0xdb,0xcb,0xbc,0xbb,0x9a,0x09,0x88,0x98,0xaa,0x18,
+0x63,0x44,0x33,0x33,0x33,0x34,0x43,0x23,0x23,0x11,0x90,0xaa,0xcb,0xcc,0xeb,0xbc,
+0xbd,0xbc,0xac,0xbb,0xaa,0x9a,0x99,0x99,0x99,0x08,0x42,0x45,0x43,0x43,0x42,0x53,
+0x53,0x33,0x34,0x22,0x22,0x22,0x32,0x34,0x33,0x01,0xa8,0xac,0x9a,0xaa,0xfb,0xcd,
+0xcb,0xab,0xaa,0x89,0xa9,0xaa,0x9a,0x08,0x53,0x44,0x43,0x43,0x43,0x34,0x44,0x33,
+0x33,0x23,0x23,0x22,0x12,0x80,0xb9,0xbb,0xcc,0xeb,0xeb,0xbc,0xbc,0xcb,0xbb,0xbc,
+0xcb,0xcb,0xaa,0x8a,0x89,0x88,0x89,0x88,0x30,0x54,0x44,0x33,0x22,0x21,0x32,0x35,
+0x34,0x12,0x90,0xba,0xba,0xbb,0xdc,0xcc,0xbd,0xcc,0xbb,0xcb,0xbb,0xab,0xab,0xaa,
+0xba,0xbb,0x89,0x52,0x55,0x33,0x34,0x43,0x34,0x36,0x44,0x33,0x23,0x12,0x21,0x32,
+0x44,0x22,0x81,0x98,0xaa,0x9a,0xca,0xeb,0xbc,0xcc,0xba,0xab,0xab,0xba,0xaa,0xaa,
+0x99,0x18,0x32,0x45,0x53,0x44,0x34,0x43,0x23,0x32,0x33,0x34,0x22,0xb8,0xcc,0xbb,
+0x99,0xa9,0xdf,0xdc,0xcb,0xbb,0xbb,0xbb,0x9b,0x18,0x33,0x12,0xa0,0x99,0x73,0x55,
+0x43,0x32,0x32,0x22,0x23,0x01,0x88,0x10,0x53,0x34,0x12,0xa8,0xcb,0xab,0xba,0xdb,
+0xcd,0xcc,0xcb,0xcb,0xab,0xac,0xaa,0xbb,0xba,0xab,0xaa,0x88,0x01,0x11,0x32,0x46,
+0x54,0x43,0x34,0x34,0x34,0x32,0x22,0x22,0x33,0x33,0x23,0x90,0xca,0xac,0x9a,0xba,
+0xdd,0xbd,0xbd,0xbb,0x9a,0x89,0x98,0xb9,0xab,0x09,0x64,0x44,0x43,0x32,0x33,0x45,
+0x53,0x33,0x43,0x12,0x12,0x12,0x12,0x22,0x01,0x98,0xbb,0xbc,0xcc,0xcb,0xcc,0xbc,
+0xbc,0xbc,0xbb,0xac,0xbb,0xaa,0x99,0x89,0x00,0x11,0x53,0x35,0x35,0x43,0x33,0x24,
+0x24,0x33,0x24,0x11,0x88,0x9a,0xaa,0xb9,0xdc,0xdd,0xdb,0xcb,0xbb,0xbb,0xcb,0xbb,
+0xbc,0xbb,0xaa,0xaa,0x98,0x89,0x10,0x31,0x35,0x45,0x53,0x44,0x43,0x33,0x33,0x33,
+0x33,0x53,0x33,0x13,0x81,0xb9,0xaa,0x19,0x11,0xd9,0xcf,0xbd,0xab,0x99,0x80,0x90,
+0xba,0xac,0x18,0x52,0x34,0x33,0x44,0x43,0x34,0x44,0x33,0x34,0x23,0x22,0x12,0x11,
+0x01,0x80,0xa9,0xcb,0xdc,0xbc,0xbe,0xdb,0xba,0xbb,0xdc,0xbb,0xbc,0x9b,0x99,0x99,
+0xbb,0xbd,0xab,0x9a,0x10,0x45,0x55,0x34,0x34,0x22,0x11,0x12,0x42,0x43,0x32,0x11,
+0x00,0xa9,0xdb,0xdc,0xcb,0xab,0xab,0xba,0xbc,0xbc,0xba,0xaa,0x99,0xa8,0x99,0x8a,
+0x18,0x43,0x44,0x44,0x43,0x24,0x43,0x32,0x23,0x23,0x23,0x11,0x01,0x88,0xaa,0xbc,
+0xcc,0xbc,0xcd,0xdb,0xbc,0xbb,0xab,0xab,0xba,0xcb,0x9a,0x19,0x53,0x44,0x33,0x24,
+0x43,0x44,0x44,0x43,0x33,0x22,0x22,0x32,0x43,0x33,0x12,0x88,0xa9,0x99,0x99,0xda,
+0xdd,0xdb,0xcb,0xab,0xab,0xbb,0xba,0xac,0xaa,0x88,0x31,0x44,0x34,0x43,0x43,0x34,
+0x34,0x34,0x24,0x23,0x23,0x22,0x11,0x00,0x80,0x98,0xdb,0xce,0xcc,0xcb,0xbb,0xcb,
+0xbc,0xbc,0xbc,0xab,0x9a,0x99,0xa9,0xba,0xac,0x89,0x31,0x54,0x33,0x43,0x43,0x53,
+0x33,0x33,0x33,0x22,0x22,0x11,0x88,0xca,0xbb,0xbc,0xcc,0xcd,0xcc,0xbc,0xbb,0xab,
+0xa9,0xa9,0xcb,0xab,0x29,0x64,0x34,0x33,0x23,0x53,0x44,0x45,0x33,0x33,0x23,0x23,
+0x33,0x24,0x23,0x02,0x00,0xa9,0xba,0xbc,0xcd,0xdb,0xcc,0xcb,0xcb,0xba,0xab,0xbb,
+0xba,0xaa,0xaa,0xa9,0x88,0x42,0x46,0x33,0x33,0x22,0x44,0x45,0x33,0x12,0xa8,0xdb,
+0xaa,0xaa,0xaa,0x89,0x41,0x35,0x13,0xda,0xcd,0xbb,0x89,0x18,0x01,0x98,0xca,0xbc,
+0xcd,0xcb,0xaa,0x18,0x33,0x25,0x23,0x33,0x54,0x53,0x32,0x22,0x01,0x01,0x80,0x80,
+0xa8,0xdb,0xbd,0xcd,0xbb,0xbc,0xbc,0xad,0xac,0xab,0xaa,0x99,0x99,0x09,0x20,0x43,
+0x34,0x34,0x43,0x44,0x34,0x34,0x33,0x24,0x23,0x33,0x34,0x23,0x22,0x80,0x98,0x89,
+0x88,0xb8,0xde,0xcd,0xcb,0xab,0xaa,0xa9,0xba,0xbc,0xaa,0x18,0x43,0x34,0x34,0x34,
+0x34,0x45,0x33,0x25,0x33,0x33,0x32,0x32,0x32,0x23,0x11,0x98,0xda,0xbc,0xbd,0xbd,
+0xbc,0xcc,0xcb,0xbb,0xbc,0xab,0xab,0x9a,0xab,0xab,0x9b,0x18,0x44,0x44,0x33,0x33,
+0x44,0x34,0x35,0x33,0x13,0x00,0x99,0x99,0x08,0xa9,0xce,0xbd,0xcc,0xba,0xbc,0xdb,
+0xbb,0xbc,0xba,0xba,0xba,0xaa,0x9a,0x00,0x33,0x35,0x34,0x44,0x35,0x45,0x43,0x32,
+0x23,0x33,0x43,0x43,0x33,0x12,0x80,0x88,0x08,0x11,0x91,0xdd,0xcc,0xbc,0xba,0xba,
+0xbb,0xbb,0xac,0xab,0x99,0x00,0x43,0x35,0x53,0x33,0x44,0x34,0x34,0x24,0x33,0x23,
+0x12,0x01,0x88,0x10,0x00,0xe9,0xed,0xcb,0xbb,0xbb,0xbc,0xbe,0xcc,0xcb,0xaa,0xaa,
+0x99,0x08,0x32,0x35,0x33,0x12,0x32,0x55,0x44,0x33,0x34,0x22,0x22,0x01,0x90,0xba,
+0x9a,0x89,0x90,0xdb,0xbe,0xcc,0xaa,0xbb,0xdb,0xbc,0xcb,0xba,0xaa,0xaa,0xaa,0xa9,
+0x89,0x08,0x32,0x54,0x43,0x34,0x53,0x33,0x35,0x43,0x33,0x33,0x33,0x24,0x22,0x81,
+0x88,0xaa,0xba,0xcd,0xdc,0xdb,0xbb,0xbc,0xaa,0xaa,0xab,0xbb,0xab,0x18,0x54,0x53,
+0x32,0x42,0x53,0x44,0x43,0x24,0x23,0x32,0x32,0x43,0x23,0x13,0x12,0x88,0xa8,0xb9,
+0xcb,0xcc,0xcc,0xcc,0xcb,0xba,0xbb,0xac,0xab,0xbb,0xba,0xaa,0x89,0x28,0x63,0x34,
+0x44,0x33,0x44,0x34,0x34,0x23,0x13,0x11,0x00,0x11,0x11,0xa0,0xec,0xcc,0xcb,0xcb,
+0xbb,0xcc,0xdb,0xcb,0xab,0xaa,0x9a,0x99,0xaa,0xab,0x89,0x20,0x43,0x24,0x43,0x44,
+0x44,0x33,0x34,0x32,0x43,0x23,0x33,0x22,0x00,0x80,0x88,0x88,0xda,0xcd,0xcd,0xbb,
+0xab,0x9a,0xa9,0xcb,0xbc,0x9a,0x21,0x54,0x33,0x32,0x43,0x44,0x44,0x34,0x43,0x23,
+0x33,0x32,0x33,0x24,0x22,0x02,0x90,0xba,0xbc,0xbd,0xcd,0xdb,0xbb,0xbd,0xbc,0xcb,
+0xab,0x9b,0x9a,0xba,0xcb,0xaa,0x28,0x53,0x33,0x12,0x11,0x42,0x44,0x34,0x53,0x34,
+0x35,0x43,0x11,0x90,0x88,0x08,0x11,0x81,0xdb,0xdc,0xdb,0xbb,0xbd,0xbb,0xab,0x89,
+0x88,0x98,0x99,0x18,0x63,0x44,0x33,0x34,0x33,0x43,0x33,0x33,0x23,0x13,0x88,0xbb,
+0xcd,0xdb,0xcb,0xbd,0xcc,0xbb,0xbc,0xaa,0xab,0xaa,0x9a,0x89,0x18,0x21,0x63,0x44,
+0x43,0x34,0x34,0x34,0x34,0x43,0x33,0x23,0x22,0x11,0x21,0x21,0x02,0xb0,0xdd,0xcc,
+0xac,0xab,0xbb,0xdb,0xbb,0xbb,0xaa,0x89,0x11,0x33,0x35,0x45,0x43,0x44,0x43,0x33,
+0x34,0x32,0x32,0x23,0x33,0x22,0x01,0xa9,0xdb,0xcc,0xdb,0xcb,0xcc,0xbb,0xbc,0xcb,
+0xbb,0xba,0xaa,0xaa,0xa9,0x99,0x08,0x42,0x45,0x34,0x34,0x33,0x44,0x43,0x32,0x13,
+0x81,0xa8,0xaa,0xba,0xca,0xdc,0xcc,0xbc,0xbc,0xbc,0xbb,0xcb,0xba,0xbb,0xba,0xaa,
+0x89,0x10,0x34,0x35,0x35,0x34,0x44,0x53,0x33,0x34,0x23,0x22,0x22,0x32,0x43,0x23,
+0x81,0xc9,0xcb,0xbb,0xca,0xdb,0xbc,0xbc,0xac,0x9a,0x99,0x89,0x89,0x10,0x33,0x36,
+0x35,0x44,0x43,0x24,0x33,0x33,0x32,0x32,0x22,0x22,0x01,0xa9,0xdd,0xbc,0xac,0xcb,
+0xbc,0xce,0xcb,0xbb,0xaa,0x9a,0xca,0xcb,0xac,0x9a,0x09,0x10,0x42,0x45,0x44,0x33,
+0x33,0x22,0x33,0x44,0x43,0x22,0x11,0x80,0xa9,0xcc,0xbc,0xbc,0xbb,0xbb,0xbc,0xbd,
+0xbb,0x9c,0x9a,0x99,0xa9,0x99,0x88,0x31,0x63,0x43,0x34,0x44,0x32,0x24,0x23,0x33,
+0x23,0x12,0x00,0x98,0xaa,0xcc,0xbc,0xdb,0xbc,0xdc,0xbb,0xbc,0xba,0xaa,0xa9,0xaa,
+0xaa,0x18,0x44,0x35,0x35,0x43,0x33,0x35,0x35,0x34,0x33,0x32,0x12,0x12,0x22,0x23,
+0x02,0xb8,0xdc,0xbc,0xbb,0xbd,0xcc,0xbb,0xbc,0xbb,0xaa,0x9b,0x9a,0x18,0x31,0x54,
+0x34,0x35,0x35,0x53,0x32,0x33,0x32,0x32,0x22,0x21,0x12,0x90,0xcb,0xbd,0xbd,0xdb,
+0xdb,0xbc,0xcc,0xba,0xbb,0xba,0xaa,0xbb,0xcb,0xaa,0x89,0x31,0x35,0x24,0x22,0x43,
+0x44,0x44,0x33,0x22,0x11,0x00,0x01,0x81,0xa8,0xdc,0xbc,0xbd,0xbc,0xcc,0xbb,0xac,
+0xaa,0xaa,0xba,0xba,0x9a,0x10,0x54,0x43,0x24,0x43,0x53,0x53,0x34,0x34,0x22,0x12,
+0x12,0x23,0x34,0x22,0x81,0xa9,0xac,0xba,0xdb,0xcc,0xbc,0xbc,0xab,0xab,0xab,0xab,
+0xaa,0x89,0x20,0x32,0x45,0x34,0x45,0x53,0x33,0x43,0x12,0x12,0x22,0x33,0x11,0xca,
+0xbe,0xac,0xaa,0xca,0xdc,0xbd,0xbc,0xac,0xab,0x9a,0x99,0x10,0x22,0x22,0x21,0x32,
+0x56,0x44,0x43,0x33,0x43,0x22,0x22,0x80,0x98,0x08,0x10,0x00,0xd9,0xcc,0xbc,0xbb,
+0xbb,0xbe,0xcc,0xcb,0xaa,0xab,0xa9,0x9a,0x9a,0x99,0x08,0x31,0x63,0x53,0x33,0x44,
+0x43,0x24,0x43,0x22,0x32,0x32,0x32,0x21,0x90,0xb9,0xbb,0xcd,0xeb,0xcc,0xcb,0xbb,
+0xba,0xaa,0xaa,0xba,0xbb,0x89,0x53,0x45,0x34,0x33,0x34,0x54,0x43,0x43,0x23,0x23,
+0x21,0x22,0x32,0x22,0x01,0xa9,0xbc,0xbc,0xcc,0xcc,0xdb,0xbb,0xcb,0xab,0xab,0xab,
+0xaa,0x99,0x00,0x32,0x44,0x53,0x44,0x34,0x34,0x24,0x33,0x22,0x23,0x23,0x23,0x00,
+0xcb,0xcc,0xbc,0xca,0xdb,0xbc,0xbd,0xbc,0xab,0xab,0xbb,0xcb,0xbb,0x9c,0x89,0x20,
+0x22,0x32,0x43,0x54,0x34,0x35,0x33,0x33,0x23,0x23,0x23,0x12,0x80,0xa8,0xca,0xcd,
+0xdc,0xcb,0xbc,0xbb,0xac,0xaa,0xbb,0xbb,0xab,0x20,0x64,0x33,0x43,0x42,0x63,0x34,
+0x35,0x33,0x23,0x33,0x42,0x32,0x23,0x02,0x80,0xa8,0xba,0xcc,0xcc,0xdb,0xbc,0xbc,
+0xac,0xbb,0xcb,0xaa,0xaa,0x9a,0x88,0x08,0x11,0x53,0x54,0x34,0x33,0x33,0x32,0x44,
+0x33,0x22,0xa8,0xdc,0xcb,0xba,0xab,0xbb,0x99,0x88,0xb8,0xee,0xbc,0xbb,0x89,0x10,
+0x21,0x12,0x11,0x02,0xa0,0xcc,0x0a,0x74,0x45,0x24,0x23,0x11,0x21,0x22,0x33,0x02,
+0xb8,0xdc,0xcb,0xbb,0xbd,0xbd,0xbd,0xcb,0xbb,0xab,0xab,0xab,0xab,0xab,0x89,0x31,
+0x54,0x53,0x43,0x44,0x43,0x43,0x23,0x33,0x33,0x24,0x23,0x11,0x81,0x80,0x88,0xa9,
+0xdc,0xcd,0xbc,0xac,0xab,0xaa,0xaa,0xbb,0xac,0x89,0x21,0x35,0x34,0x43,0x53,0x53,
+0x34,0x34,0x43,0x12,0x22,0x12,0x22,0x22,0x10,0x98,0xba,0xbc,0xbd,0xbd,0xdc,0xbb,
+0xcc,0xba,0xbb,0xbb,0xab,0x9b,0x89,0x18,0x21,0x63,0x44,0x44,0x43,0x33,0x33,0x33,
+0x24,0x33,0x23,0x81,0xc9,0xcb,0xbb,0xbc,0xce,0xcc,0xdb,0xbb,0xbb,0xba,0xbb,0xcb,
+0xbb,0xaa,0x99,0x10,0x22,0x43,0x44,0x53,0x34,0x35,0x43,0x43,0x32,0x22,0x22,0x12,
+0x12,0x01,0x80,0xb9,0xce,0xdb,0xcb,0xba,0xba,0xbc,0xdb,0xba,0x99,0x18,0x32,0x24,
+0x33,0x44,0x54,0x43,0x34,0x43,0x33,0x33,0x24,0x32,0x22,0x22,0x00,0xa8,0xca,0xbc,
+0xcc,0xcc,0xcb,0xbc,0xcb,0xcb,0xba,0xbb,0xaa,0xaa,0xbb,0xac,0x8a,0x32,0x36,0x24,
+0x21,0x11,0x43,0x43,0x34,0x53,0x44,0x43,0x22,0x01,0x98,0x88,0x00,0x81,0xc9,0xcd,
+0xcc,0xbb,0xcc,0xbb,0xac,0x9a,0x88,0x88,0x08,0x88,0x31,0x44,0x35,0x34,0x43,0x32,
+0x33,0x33,0x24,0x22,0x01,0x99,0xcb,0xbc,0xbc,0xbe,0xbd,0xbc,0xbc,0xba,0xba,0xba,
+0xaa,0x89,0x09,0x10,0x42,0x44,0x44,0x34,0x43,0x34,0x34,0x43,0x33,0x33,0x33,0x22,
+0x12,0x11,0x01,0x80,0xdb,0xce,0xcb,0xbc,0xba,0xac,0xbb,0xbc,0xba,0x9a,0x08,0x21,
+0x43,0x34,0x44,0x44,0x53,0x33,0x43,0x33,0x23,0x33,0x33,0x23,0x12,0x80,0xca,0xdb,
+0xbc,0xbd,0xbd,0xbc,0xbc,0xbc,0xbb,0xbb,0xab,0xab,0xab,0x9a,0x09,0x42,0x54,0x34,
+0x44,0x32,0x24,0x43,0x33,0x23,0x23,0x80,0xa9,0xbb,0xcb,0xdb,0xcc,0xbd,0xbd,0xbb,
+0xbc,0xac,0xbb,0xbb,0xba,0xab,0xaa,0x08,0x31,0x36,0x35,0x43,0x34,0x44,0x34,0x43,
+0x33,0x23,0x22,0x22,0x32,0x32,0x13,0xa0,0xdc,0xcb,0xbb,0xbc,0xcc,0xcb,0xac,0xab,
+0xa9,0x99,0x98,0x80,0x22,0x44,0x34,0x35,0x44,0x34,0x33,0x24,0x23,0x22,0x32,0x21,
+0x02,0x90,0xba,0xbf,0xbc,0xbc,0xdb,0xcc,0xbc,0xcc,0xaa,0x9a,0xa9,0xca,0xbb,0xbb,
+0x9a,0x18,0x41,0x45,0x54,0x33,0x34,0x22,0x22,0x33,0x35,0x33,0x22,0x02,0x98,0xca,
+0xdc,0xdb,0xba,0xbb,0xcb,0xcb,0xac,0xab,0x9b,0x9a,0x99,0x9a,0x88,0x10,0x42,0x34,
+0x36,0x44,0x33,0x34,0x33,0x33,0x24,0x12,0x11,0x88,0xa8,0xba,0xdc,0xcb,0xcc,0xcb,
+0xdb,0xbb,0xbb,0xbb,0xba,0xaa,0xaa,0x0a,0x31,0x56,0x43,0x34,0x43,0x53,0x43,0x34,
+0x33,0x33,0x23,0x22,0x22,0x22,0x12,0x80,0xdb,0xcc,0xcb,0xbc,0xdb,0xcb,0xbb,0xcb,
+0xaa,0xaa,0x9a,0x89,0x10,0x43,0x44,0x53,0x34,0x34,0x34,0x43,0x32,0x32,0x22,0x21,
+0x21,0x10,0xa8,0xdb,0xcc,0xcb,0xbc,0xcc,0xdb,0xcb,0xab,0xab,0xaa,0xba,0xba,0xab,
+0x8a,0x20,0x44,0x24,0x33,0x33,0x36,0x45,0x33,0x24,0x12,0x11,0x00,0x01,0x90,0xc9,
+0xcc,0xdb,0xcb,0xbc,0xbc,0xcb,0xab,0xab,0xaa,0xba,0xab,0x8a,0x41,0x54,0x33,0x34,
+0x53,0x53,0x44,0x33,0x34,0x22,0x21,0x31,0x33,0x43,0x11,0x98,0xbb,0xcb,0xdb,0xdb,
+0xdb,0xbb,0xac,0xab,0xab,0xab,0xaa,0x99,0x00,0x21,0x34,0x45,0x34,0x35,0x35,0x33,
+0x24,0x21,0x21,0x22,0x22,0x91,0xcc,0xbc,0xac,0xb9,0xcc,0xbe,0xbd,0xac,0xbb,0xaa,
+0xaa,0x09,0x20,0x32,0x22,0x22,0x63,0x54,0x44,0x43,0x32,0x23,0x23,0x12,0x88,0x88,
+0x08,0x11,0x90,0xfb,0xcc,0xbb,0xbb,0xbd,0xcc,0xcb,0xab,0xbb,0xab,0xab,0xab,0xaa,
+0x09,0x20,0x53,0x44,0x53,0x43,0x43,0x34,0x43,0x33,0x32,0x32,0x32,0x23,0x81,0xa8,
+0xbb,0xcd,0xbc,0xbe,0xbd,0xbc,0xba,0xba,0xaa,0xba,0xbb,0x9b,0x19,0x44,0x45,0x33,
+0x44,0x33,0x45,0x43,0x33,0x23,0x23,0x22,0x32,0x23,0x12,0x98,0xbb,0xcd,0xcb,0xcc,
+0xcc,0xcb,0xbb,0xbb,0xbb,0xbb,0xbb,0xaa,0x0a,0x30,0x44,0x34,0x35,0x35,0x35,0x34,
+0x33,0x33,0x23,0x33,0x32,0x12,0x90,0xeb,0xcb,0xcb,0xdb,0xdb,0xbc,0xbc,0xbc,0xba,
+0xaa,0xab,0xcb,0xba,0x9a,0x08,0x32,0x43,0x24,0x44,0x34,0x35,0x24,0x33,0x32,0x32,
+0x23,0x22,0x81,0x98,0xb9,0xeb,0xcc,0xdc,0xcb,0xbb,0xac,0xab,0xba,0xbb,0xac,0x89,
+0x20,0x34,0x44,0x32,0x34,0x45,0x34,0x25,0x33,0x33,0x32,0x32,0x33,0x33,0x02,0x90,
+0xbb,0xcd,0xcb,0xcc,0xdb,0xcb,0xac,0xbb,0xbb,0xbb,0xac,0x9a,0x89,0x18,0x20,0x32,
+0x55,0x44,0x24,0x33,0x23,0x32,0x34,0x24,0x02,0xa0,0xca,0xcb,0xcb,0xbb,0xab,0xab,
+0xbb,0xdd,0xcc,0xcb,0x9a,0x89,0x08,0x80,0x00,0x11,0x12,0x00,0x08,0x64,0x46,0x44,
+0x23,0x23,0x22,0x22,0x33,0x22,0x81,0xba,0xcd,0xbc,0xcc,0xcb,0xbc,0xcc,0xca,0xaa,
+0xaa,0xaa,0xaa,0xaa,0x9a,0x00,0x42,0x43,0x44,0x53,0x34,0x34,0x43,0x32,0x23,0x43,
+0x22,0x12,0x01,0x88,0x98,0xa9,0xdb,0xdc,0xdb,0xbc,0xba,0xbb,0xab,0xbb,0xbc,0xab,
+0x89,0x42,0x53,0x43,0x42,0x53,0x34,0x44,0x33,0x32,0x23,0x23,0x33,0x32,0x12,0x80,
+0xaa,0xcc,0xbc,0xbd,0xbd,0xcc,0xcb,0xbb,0xbb,0xcb,0xba,0xaa,0x9a,0x08,0x21,0x33,
+0x55,0x53,0x34,0x34,0x33,0x43,0x32,0x33,0x33,0x22,0x88,0xca,0xbb,0xbc,0xcd,0xdc,
+0xdb,0xcb,0xba,0xab,0xab,0xbb,0xcb,0xab,0x8a,0x08,0x21,0x32,0x35,0x44,0x44,0x34,
+0x53,0x32,0x24,0x22,0x13,0x22,0x11,0x10,0x80,0x99,0xeb,0xcc,0xdb,0xbb,0xbb,0xcb,
+0xbb,0xbc,0xbb,0x9a,0x10,0x32,0x43,0x44,0x53,0x44,0x43,0x34,0x33,0x34,0x32,0x33,
+0x32,0x23,0x12,0x80,0xb9,0xbd,0xcc,0xbc,0xcd,0xbb,0xbd,0xcb,0xbb,0xbb,0xbb,0xaa,
+0xaa,0xab,0x9a,0x20,0x46,0x44,0x22,0x32,0x32,0x34,0x44,0x42,0x42,0x43,0x32,0x12,
+0x80,0x99,0x99,0x88,0xba,0xde,0xbc,0xbd,0xcb,0xcb,0xbb,0xbb,0x9a,0x88,0x08,0x08,
+0x20,0x54,0x44,0x34,0x43,0x33,0x42,0x22,0x23,0x23,0x12,0x80,0xb9,0xcc,0xcb,0xcc,
+0xcc,0xcb,0xcb,0xbb,0xbb,0xba,0xab,0xaa,0x99,0x88,0x31,0x54,0x44,0x34,0x44,0x33,
+0x44,0x32,0x33,0x43,0x22,0x12,0x01,0x80,0x98,0xa9,0xcc,0xcd,0xbc,0xbc,0xbb,0xab,
+0xcb,0xab,0xbb,0x89,0x20,0x53,0x34,0x44,0x43,0x34,0x34,0x34,0x23,0x33,0x22,0x23,
+0x22,0x01,0xa8,0xdb,0xcc,0xcb,0xbd,0xcc,0xbb,0xac,0xab,0xab,0xbb,0xbb,0x9a,0x00,
+0x43,0x34,0x44,0x43,0x44,0x34,0x33,0x32,0x22,0x22,0x23,0x12,0x98,0xdc,0xcc,0xbc,
+0xcb,0xbc,0xcb,0xac,0xbb,0xac,0x9a,0xaa,0x99,0x88,0x10,0x32,0x44,0x44,0x34,0x44,
+0x43,0x32,0x23,0x23,0x23,0x23,0x22,0x81,0xb9,0xcd,0xcb,0xbc,0xdb,0xcb,0xcb,0xbb,
+0xab,0x9a,0x99,0x80,0x20,0x52,0x63,0x43,0x34,0x25,0x24,0x43,0x22,0x32,0x22,0x23,
+0x11,0x81,0xaa,0xdb,0xbc,0xbd,0xbd,0xbc,0xbc,0xcb,0xbb,0xbb,0xab,0xaa,0xa9,0x89,
+0x18,0x63,0x44,0x34,0x33,0x33,0x24,0x43,0x32,0x43,0x53,0x32,0x23,0x81,0xba,0xcc,
+0xbb,0xdb,0xcb,0xbc,0xbc,0xcb,0xcb,0xcb,0xaa,0x89,0x10,0x22,0x32,0x52,0x44,0x34,
+0x25,0x33,0x22,0x22,0x23,0x12,0x81,0xb9,0xcc,0xbc,0xcc,0xcc,0xbb,0xcc,0xba,0xbb,
+0xbb,0xbb,0xab,0x89,0x20,0x53,0x34,0x35,0x34,0x35,0x34,0x34,0x32,0x32,0x32,0x32,
+0x22,0x12,0x98,0xdb,0xbc,0xbd,0xbc,0xcc,0xbb,0xbc,0xab,0xbb,0x9a,0x99,0x08,0x30,
+0x44,0x45,0x53,0x43,0x43,0x33,0x33,0x43,0x32,0x32,0x22,0x00,0x90,0xaa,0xdb,0xeb,
+0xdb,0xbc,0xbc,0xac,0xbb,0xcb,0xaa,0xab,0x99,0x08,0x20,0x42,0x44,0x34,0x35,0x33,
+0x25,0x33,0x43,0x22,0x22,0x01,0x99,0xca,0xbb,0xcc,0xcc,0xcc,0xcb,0xcb,0xaa,0xba,
+0xaa,0xbb,0xbb,0x8a,0x18,0x32,0x44,0x53,0x53,0x34,0x34,0x43,0x32,0x33,0x24,0x12,
+0x02,0x81,0x98,0xb9,0xeb,0xeb,0xcb,0xbc,0xbb,0xbb,0xab,0xca,0xba,0x9a,0x18,0x44,
+0x35,0x43,0x43,0x53,0x43,0x24,0x33,0x33,0x32,0x32,0x22,0x11,0x88,0xba,0xbd,0xbe,
+0xbd,0xbd,0xbc,0xbb,0xcb,0xba,0xab,0xac,0xa9,0x08,0x22,0x33,0x43,0x43,0x55,0x53,
+0x23,0x23,0x02,0x00,0x00,0x08,0x98,0x98,0x08,0x81,0xfa,0xdd,0xbc,0xac,0xaa,0x9a,
+0xa9,0xba,0xaa,0xba,0xaa,0x9a,0x40,0x56,0x44,0x24,0x43,0x22,0x33,0x24,0x23,0x02,
+0x81,0x99,0xbb,0xdc,0xdb,0xdb,0xbc,0xdb,0xba,0xab,0xab,0xbb,0xbb,0xab,0x88,0x31,
+0x54,0x53,0x34,0x44,0x33,0x34,0x24,0x32,0x32,0x22,0x22,0x00,0x90,0xaa,0xcb,0xdc,
+0xdb,0xcc,0xbb,0xbb,0xab,0xab,0xcb,0xba,0x8a,0x28,0x54,0x43,0x43,0x43,0x34,0x35,
+0x33,0x24,0x23,0x22,0x22,0x11,0x81,0x98,0xcb,0xcc,0xdb,0xdb,0xbb,0xad,0xcb,0xaa,
+0xab,0xab,0x9b,0x8a,0x10,0x42,0x34,0x35,0x44,0x53,0x33,0x43,0x22,0x23,0x21,0x12,
+0x11,0x98,0xcb,0xdc,0xdb,0xcb,0xcb,0xcb,0xcb,0xba,0xbb,0xbb,0xaa,0x9a,0x88,0x18,
+0x42,0x44,0x44,0x43,0x34,0x33,0x34,0x33,0x33,0x32,0x23,0x12,0x90,0xdb,0xbc,0xbd,
+0xcc,0xdb,0xca,0xba,0xbb,0xbb,0xab,0x89,0x00,0x22,0x43,0x35,0x36,0x35,0x25,0x24,
+0x32,0x32,0x33,0x33,0x33,0x12,0x80,0xb9,0xdb,0xbc,0xbd,0xcd,0xcb,0xbb,0xbc,0xab,
+0xbb,0xbb,0xab,0x89,0x10,0x32,0x45,0x44,0x35,0x43,0x33,0x32,0x33,0x43,0x23,0x02,
+0xa9,0xcc,0xbc,0xcb,0xbb,0xbc,0xcb,0xbb,0xbd,0xbc,0xac,0x9a,0x88,0x10,0x21,0x33,
+0x44,0x43,0x33,0x44,0x34,0x35,0x33,0x24,0x21,0x11,0x11,0x00,0xa9,0xdc,0xdb,0xcb,
+0xcb,0xbc,0xcb,0xbb,0xac,0xba,0xaa,0x9a,0x89,0x08,0x22,0x44,0x44,0x34,0x44,0x33,
+0x34,0x24,0x22,0x13,0x22,0x01,0x81,0x98,0xcb,0xbd,0xbd,0xbc,0xbc,0xcb,0xbb,0xac,
+0xab,0xa9,0x88,0x10,0x31,0x53,0x44,0x34,0x35,0x34,0x24,0x33,0x32,0x33,0x24,0x12,
+0x01,0x90,0xaa,0xbc,0xcc,0xcc,0xbc,0xbc,0xbc,0xba,0xba,0xab,0xbb,0x9a,0x18,0x41,
+0x43,0x44,0x53,0x34,0x44,0x32,0x32,0x23,0x23,0x23,0x11,0x90,0xbb,0xcd,0xcb,0xcc,
+0xcc,0xcb,0xbb,0xcb,0xaa,0xba,0xba,0xbb,0xaa,0x00,0x42,0x43,0x34,0x44,0x34,0x44,
+0x33,0x32,0x23,0x23,0x23,0x12,0x98,0xba,0xbd,0xbd,0xdc,0xdb,0xcb,0xab,0xbb,0xab,
+0xba,0xba,0x9b,0x18,0x44,0x35,0x25,0x43,0x43,0x34,0x34,0x24,0x23,0x22,0x22,0x12,
+0x02,0x80,0xaa,0xcc,0xcc,0xcb,0xbc,0xbc,0xac,0xbb,0xba,0xbb,0xbb,0x9a,0x09,0x32,
+0x45,0x44,0x43,0x43,0x53,0x32,0x24,0x12,0x11,0x01,0x00,0x00,0xba,0xdd,0xdb,0xcb,
+0xbc,0xcb,0xab,0xab,0x99,0x99,0xa9,0x9b,0x09,0x44,0x45,0x33,0x34,0x34,0x34,0x33,
+0x33,0x22,0x24,0x33,0x23,0x91,0xca,0xdb,0xcb,0xbc,0xdc,0xcb,0xcb,0xbb,0xba,0xbb,
+0xab,0xbb,0x9b,0x89,0x41,0x53,0x34,0x53,0x53,0x43,0x43,0x23,0x33,0x23,0x33,0x23,
+0x01,0xb8,0xcb,0xbc,0xbd,0xcd,0xbc,0xbc,0xba,0xbb,0xaa,0xbb,0xab,0x8a,0x31,0x45,
+0x44,0x43,0x53,0x33,0x44,0x33,0x33,0x33,0x23,0x22,0x22,0x01,0x98,0xdb,0xcc,0xcc,
+0xdb,0xcb,0xbb,0xcb,0xba,0xba,0xab,0x9a,0x09,0x31,0x53,0x34,0x44,0x34,0x34,0x34,
+0x24,0x23,0x32,0x22,0x21,0x10,0x98,0xbb,0xce,0xbc,0xcc,0xcb,0xcb,0xbb,0xcb,0xbb,
+0xba,0xab,0x99,0x08,0x10,0x31,0x45,0x44,0x34,0x44,0x32,0x33,0x33,0x43,0x22,0x12,
+0x80,0xb9,0xdb,0xdb,0xdb,0xcb,0xbc,0xcb,0xbb,0xbb,0xbb,0xac,0x99,0x09,0x21,0x43,
+0x34,0x45,0x44,0x43,0x43,0x22,0x23,0x33,0x33,0x24,0x11,0x80,0x9a,0xab,0xcc,0xcc,
+0xbc,0xbd,0xbb,0xac,0xba,0xab,0xbb,0x9a,0x09,0x20,0x43,0x54,0x53,0x53,0x33,0x34,
+0x33,0x32,0x33,0x24,0x12,0x90,0xba,0xbc,0xbd,0xdb,0xcc,0xcc,0xbb,0xbc,0xba,0xbb,
+0x9a,0x89,0x10,0x31,0x33,0x54,0x53,0x44,0x34,0x43,0x32,0x23,0x32,0x11,0x11,0x80,
+0x98,0xa9,0xcc,0xcd,0xdb,0xbb,0xbc,0xac,0xac,0xba,0xab,0xab,0x9a,0x89,0x10,0x32,
+0x45,0x53,0x53,0x43,0x33,0x34,0x32,0x33,0x32,0x23,0x12,0x80,0xaa,0xcd,0xdb,0xbc,
+0xcc,0xcb,0xcb,0xba,0xba,0xba,0xaa,0x8a,0x00,0x42,0x53,0x53,0x43,0x44,0x43,0x33,
+0x33,0x33,0x24,0x33,0x22,0x01,0x98,0xba,0xcc,0xdb,0xcc,0xbc,0xcb,0xcb,0xaa,0xab,
+0xab,0x9b,0x8a,0x18,0x42,0x44,0x43,0x44,0x43,0x24,0x33,0x32,0x32,0x33,0x33,0x11,
+0x90,0xcb,0xbc,0xcc,0xcc,0xdb,0xbc,0xbb,0xac,0xab,0xab,0xbb,0xab,0x9a,0x18,0x42,
+0x44,0x34,0x53,0x43,0x34,0x43,0x32,0x22,0x22,0x11,0x11,0x98,0xca,0xcc,0xbc,0xbd,
+0xbc,0xcc,0xba,0xab,0xab,0xbb,0xba,0x9a,0x18,0x52,0x34,0x35,0x34,0x35,0x43,0x34,
+0x33,0x24,0x32,0x21,0x12,0x02,0x81,0xa9,0xeb,0xbc,0xbd,0xbc,0xcb,0xcb,0xaa,0xab,
+0xab,0xab,0x89,0x20,0x43,0x34,0x35,0x35,0x44,0x33,0x24,0x33,0x23,0x23,0x12,0x01,
+0x08,0xb9,0xdc,0xcd,0xbc,0xdb,0xba,0xbc,0xcb,0xbb,0xac,0xba,0xa9,0x09,0x30,0x44,
+0x44,0x33,0x43,0x43,0x34,0x43,0x33,0x23,0x23,0x12,0x80,0xc9,0xcb,0xac,0xcb,0xdb,
+0xdb,0xbb,0xbc,0xba,0xaa,0xbb,0xba,0x9a,0x09,0x21,0x44,0x34,0x35,0x35,0x53,0x23,
+0x24,0x22,0x23,0x21,0x11,0x00,0xa9,0xca,0xcc,0xdb,0xcb,0xbc,0xbc,0xcb,0xba,0xaa,
+0xab,0x9a,0x99,0x11,0x63,0x53,0x43,0x53,0x33,0x34,0x34,0x43,0x22,0x22,0x12,0x11,
+0x00,0x90,0xba,0xcd,0xcc,0xbc,0xbc,0xcb,0xba,0xbb,0xbb,0xbb,0x9a,0x09,0x32,0x54,
+0x53,0x53,0x53,0x33,0x34,0x33,0x33,0x32,0x22,0x13,0x00,0xa9,0xbd,0xbd,0xbd,0xbd,
+0xbc,0xbc,0xcb,0xba,0xbb,0xba,0xab,0x9a,0x00,0x22,0x53,0x53,0x44,0x34,0x25,0x33,
+0x23,0x33,0x33,0x33,0x22,0x88,0xcb,0xcc,0xdb,0xcb,0xcc,0xcb,0xbb,0xac,0xbb,0xba,
+0xba,0x9a,0x89,0x21,0x43,0x35,0x35,0x35,0x44,0x42,0x22,0x33,0x32,0x23,0x33,0x12,
+0x80,0xb9,0xbc,0xbd,0xcd,0xcb,0xbc,0xbc,0xba,0xbb,0xba,0xba,0x9a,0x08,0x41,0x53,
+0x34,0x35,0x44,0x33,0x34,0x24,0x22,0x22,0x23,0x12,0x00,0xa9,0xbc,0xcc,0xdb,0xdb,
+0xcb,0xbc,0xcb,0xba,0xaa,0xab,0xbb,0xaa,0x89,0x21,0x44,0x44,0x34,0x45,0x33,0x43,
+0x32,0x22,0x33,0x33,0x23,0x02,0xa9,0xcc,0xcc,0xdb,0xbc,0xcb,0xcb,0xba,0xba,0xcb,
+0xaa,0x99,0x09,0x00,0x22,0x44,0x53,0x53,0x43,0x24,0x33,0x23,0x33,0x32,0x22,0x02,
+0x98,0xcb,0xcc,0xbc,0xbd,0xbd,0xcb,0xbb,0xac,0xba,0xbb,0xba,0x99,0x00,0x32,0x35,
+0x44,0x44,0x34,0x25,0x33,0x33,0x33,0x43,0x32,0x12,0x01,0x98,0xba,0xcc,0xcc,0xcc,
+0xcb,0xcb,0xba,0xbb,0xbb,0xbb,0xba,0x99,0x20,0x53,0x44,0x34,0x44,0x43,0x43,0x33,
+0x43,0x22,0x22,0x22,0x11,0x88,0xa9,0xcc,0xdb,0xdb,0xdb,0xbb,0xbc,0xbb,0xcb,0xba,
+0xaa,0xaa,0x89,0x10,0x43,0x44,0x53,0x43,0x34,0x43,0x33,0x33,0x24,0x12,0x11,0x80,
+0xa8,0xca,0xdb,0xcc,0xbc,0xbc,0xbc,0xcb,0xba,0xba,0xab,0xbb,0x99,0x18,0x42,0x34,
+0x35,0x44,0x34,0x34,0x43,0x23,0x33,0x33,0x23,0x22,0x01,0x88,0xba,0xdc,0xdc,0xcb,
+0xbc,0xcb,0xab,0xbb,0xac,0xaa,0x9a,0x89,0x11,0x43,0x44,0x53,0x43,0x34,0x34,0x43,
+0x22,0x23,0x32,0x21,0x11,0x98,0xb9,0xdc,0xcb,0xcc,0xbc,0xbc,0xcb,0xba,0xcb,0xba,
+0xab,0x9a,0x88,0x11,0x22,0x43,0x35,0x36,0x44,0x43,0x33,0x33,0x24,0x22,0x21,0x10,
+0x00,0x98,0xca,0xcc,0xcc,0xbc,0xcc,0xba,0xbb,0xbb,0xba,0xba,0xaa,0x89,0x31,0x35,
+0x35,0x44,0x34,0x34,0x34,0x33,0x32,0x33,0x22,0x12,0x81,0xb9,0xdc,0xdb,0xdb,0xcb,
+0xbc,0xac,0xbb,0xba,0xbb,0xba,0xaa,0x89,0x20,0x44,0x44,0x53,0x43,0x53,0x42,0x32,
+0x32,0x32,0x32,0x22,0x11,0x00,0xa9,0xdb,0xdc,0xdb,0xcb,0xbb,0xbc,0xbb,0xbb,0xcb,
+0xaa,0x89,0x10,0x32,0x44,0x53,0x53,0x53,0x33,0x34,0x32,0x33,0x33,0x33,0x22,0x01,
+0x99,0xcc,0xdb,0xbc,0xbd,0xcc,0xbb,0xbc,0xba,0xbb,0xba,0xab,0x9a,0x10,0x42,0x53,
+0x53,0x53,0x53,0x33,0x43,0x32,0x32,0x22,0x22,0x11,0x01,0x88,0x99,0x99,0x99,0x98,
+0xa9,0xca,0xba,0xbb,0x89,0x89,0xba,0xbf,0xcb,0x9a,0x99,0x98,0xaa,0xa9,0x88,0x10,
+0x80,0x81,0x43,0x27,0x23,0x90,0xcb,0x0a,0x55,0x44,0x23,0x80,0x99,0x29,0x64,0x34,
+0x12,0x90,0xaa,0x9a,0x18,0x20,0x88,0x99,0x08,0x21,0x81,0xba,0x9b,0x53,0x16,0xb1,
+0xef,0xbc,0xbc,0xab,0xa9,0xca,0xdd,0xbc,0xac,0x89,0x88,0xca,0xcd,0xbc,0x9a,0x98,
+0xa9,0xce,0xdb,0xaa,0xaa,0xa9,0x99,0x18,0x73,0x43,0x12,0x00,0x89,0x30,0x44,0x43,
+0x32,0x01,0xa0,0xeb,0xcc,0xab,0x9b,0x88,0xa8,0xda,0xcb,0xab,0x99,0x88,0xa9,0xcb,
+0xbb,0xac,0xba,0xa9,0x99,0xa9,0xcd,0xbc,0xab,0x89,0x80,0xca,0xcd,0xbb,0xab,0x89,
+0x10,0x31,0x43,0x12,0xb9,0xbd,0x0a,0x54,0x24,0x01,0xc9,0x9a,0x31,0x46,0x22,0x80,
+0xba,0x8b,0x62,0x55,0x33,0x22,0x81,0x88,0x28,0x63,0x43,0x11,0x98,0x99,0x31,0x46,
+0x23,0x82,0xa9,0xba,0x00,0x34,0x12,0xd8,0xdb,0x9a,0x08,0x12,0x02,0x98,0xa9,0xdb,
+0xeb,0xcc,0xac,0xab,0xaa,0xbb,0xbd,0xbc,0xac,0xaa,0xb9,0xea,0xdc,0xbc,0xbc,0xa9,
+0x80,0x90,0xd9,0xbd,0xac,0x9a,0x89,0xb9,0xcd,0xbc,0xac,0x99,0x99,0x99,0xba,0xbc,
+0xdb,0xaa,0xab,0x99,0x9a,0xba,0xcc,0xab,0x0a,0x41,0x43,0x12,0x89,0xab,0x19,0x55,
+0x36,0x25,0x02,0x90,0x89,0x41,0x46,0x25,0x12,0x81,0x88,0x20,0x44,0x43,0x22,0x01,
+0x10,0x21,0x23,0x23,0x22,0x11,0x00,0x88,0x9a,0x09,0x22,0x13,0xd1,0xfa,0xda,0xdb,
+0xbc,0xbb,0xaa,0xca,0xdd,0xbc,0x9b,0x18,0x01,0xfc,0xdc,0xba,0x89,0x80,0xa8,0xdd,
+0xbc,0xba,0xa9,0xa9,0x09,0x50,0x54,0x33,0x22,0x80,0x21,0x54,0x34,0x23,0x01,0x00,
+0x98,0xc9,0xdc,0xcb,0x9a,0x09,0x08,0xa9,0xcb,0xab,0x8a,0x99,0xca,0xcb,0xab,0x9a,
+0x99,0x99,0xa9,0xa9,0xba,0xbc,0x08,0x53,0x33,0xc8,0xbe,0x9c,0x08,0x22,0x12,0x12,
+0x53,0x53,0x12,0x00,0x48,0x55,0x34,0x12,0xa0,0xa9,0x30,0x57,0x33,0x14,0x00,0x08,
+0x42,0x45,0x43,0x12,0x81,0x00,0x31,0x45,0x23,0x02,0x98,0x89,0x32,0x47,0x33,0x02,
+0x80,0x00,0x31,0x24,0x12,0x98,0x99,0x08,0x83,0x92,0x9b,0x2c,0x51,0x12,0xea,0xcd,
+0xbb,0x8a,0x88,0xc0,0xeb,0xbc,0xbc,0xba,0xba,0xca,0xbc,0xbc,0xac,0x9a,0xa9,0xfb,
+0xdc,0xcb,0xaa,0x88,0x10,0xa9,0xce,0xbc,0xab,0x8a,0x98,0xaa,0xbd,0xac,0x8a,0x08,
+0x81,0xa9,0xac,0x8b,0x62,0x44,0x24,0x23,0x22,0x21,0x01,0x80,0x00,0x32,0x37,0x24,
+0x12,0x80,0x09,0x22,0x45,0x33,0x43,0x33,0x52,0x32,0x42,0x43,0x33,0x23,0x01,0x18,
+0x31,0x37,0x24,0x01,0xa9,0x99,0x18,0x22,0x81,0xc9,0x8a,0x28,0x24,0x82,0xbb,0xcf,
+0xdc,0xcc,0xac,0xab,0x08,0x12,0xb8,0xcf,0xbc,0x99,0x10,0x81,0xfb,0xcc,0xac,0xab,
+0xaa,0x8a,0x20,0x54,0x34,0x23,0x11,0x10,0x53,0x34,0x24,0x12,0x21,0x21,0x01,0xeb,
+0xbe,0xbb,0x9a,0x00,0x90,0xfb,0xba,0x89,0x21,0x12,0xa8,0xbd,0xaa,0x18,0x01,0xc9,
+0xbd,0xaa,0x08,0x12,0x81,0xaa,0x0a,0x42,0x22,0xca,0xad,0x28,0x37,0x25,0x11,0x08,
+0x30,0x44,0x33,0x01,0x10,0x52,0x44,0x22,0x00,0x00,0x54,0x43,0x01,0x88,0x28,0x46,
+0x34,0x23,0x10,0x32,0x46,0x23,0x81,0x99,0x28,0x54,0x13,0x81,0x99,0x31,0x46,0x13,
+0x90,0xab,0x19,0x33,0x84,0xda,0x9b,0x51,0x35,0x13,0xb8,0xbd,0x8a,0x19,0x00,0x88,
+0x10,0x03,0xe8,0xbe,0xbc,0x09,0x00,0xc8,0xbd,0x9c,0x19,0x11,0xca,0xbf,0xac,0x09,
+0x00,0x90,0xca,0xbb,0xca,0xca,0xbc,0xac,0x09,0x80,0xa0,0xcc,0xab,0x89,0x00,0xd9,
+0xcc,0xaa,0x18,0x10,0x91,0x00,0x64,0x34,0x13,0xb8,0xac,0x28,0x45,0x33,0x82,0x98,
+0x11,0x36,0x44,0x32,0x32,0x24,0x24,0x23,0x34,0x53,0x23,0x11,0x88,0x10,0x44,0x34,
+0x03,0xa8,0xbb,0x28,0x46,0x34,0x12,0x91,0xba,0xae,0xac,0x89,0x10,0x13,0xa1,0xce,
+0xac,0x8a,0x10,0x91,0xfb,0xcc,0xaa,0x08,0x01,0xb8,0xcf,0xbd,0xbb,0xaa,0x9a,0x18,
+0x42,0x36,0x34,0x22,0x80,0x08,0x42,0x45,0x24,0x12,0x01,0x80,0x99,0xcb,0xbc,0xac,
+0x9a,0x98,0xa9,0xdb,0xab,0x9a,0x88,0x90,0xb9,0xbd,0xac,0x89,0x00,0x12,0x00,0xa9,
+0x99,0x29,0x33,0x93,0xeb,0xba,0x51,0x53,0x90,0xbc,0x9c,0x72,0x44,0x13,0x01,0x00,
+0x42,0x44,0x13,0x01,0x08,0x62,0x63,0x33,0x32,0x32,0x43,0x34,0x43,0x43,0x32,0x12,
+0x81,0x80,0x43,0x46,0x34,0x12,0x80,0x88,0x31,0x45,0x23,0x91,0xb9,0x8a,0x51,0x54,
+0x22,0x01,0x98,0x88,0x00,0x10,0x98,0xa8,0x29,0x51,0x02,0xf9,0xcd,0xac,0x9a,0x08,
+0x11,0x01,0x88,0x99,0xba,0xee,0xdc,0xbb,0xab,0x08,0x02,0xc0,0xdd,0xcb,0x8a,0x08,
+0x00,0xca,0xcd,0xbb,0x99,0x00,0x90,0xda,0xbd,0xba,0x88,0x10,0x01,0xa8,0x99,0x10,
+0x23,0x93,0xfb,0x9b,0x41,0x36,0x24,0x02,0x80,0x42,0x44,0x22,0x00,0x28,0x65,0x35,
+0x24,0x12,0x90,0x90,0x00,0x10,0x08,0x0a,0x1a,0x10,0x01,0xa8,0xa9,0x01,0x14,0xa2,
+0xc9,0x98,0x22,0x23,0xaa,0xdb,0x00,0x23,0x91,0xd9,0x99,0x12,0x33,0x1a,0x8d,0x19,
+0x21,0x93,0xa9,0x0c,0x20,0x32,0x99,0xbb,0x90,0x13,0x94,0x09,0x9b,0x10,0x23,0xa1,
+0xb9,0xa0,0x33,0x11,0xb9,0x99,0x29,0x31,0x29,0x1f,0x1a,0x10,0x01,0x99,0x9b,0x01,
+0x95,0xb2,0x09,0x3b,0x59,0x29,0x0b,0xbb,0x02,0x33,0x19,0xbb,0x99,0x32,0x13,0x9b,
+0x0d,0x18,0x84,0xa2,0xcb,0x09,0x53,0x02,0xd8,0xc9,0x11,0x25,0xa2,0xfb,0x8b,0x70,
+0x45,0x33,0x13,0x90,0x99,0x09,0x10,0x11,0x80,0x0a,0x1c,0x29,0x51,0x10,0xda,0xca,
+0x10,0x77,0x33,0x24,0x81,0x98,0x8a,0x10,0x01,0xa2,0xb8,0x08,0x48,0x20,0xb8,0xb9,
+0x59,0x59,0x08,0x99,0x0a,0x10,0x04,0xb1,0xab,0x1a,0x13,0x03,0x99,0x1c,0x4a,0x10,
+0x91,0xaa,0x1a,0x40,0x08,0xa1,0x1b,0x3b,0x93,0xa3,0xb0,0xa0,0x93,0x03,0xd3,0xc2,
+0x92,0x11,0x18,0xa9,0x99,0x20,0x30,0x09,0xaa,0x19,0x21,0xa3,0xa1,0x0a,0x29,0x31,
+0x19,0x9b,0x9a,0x13,0x41,0x3c,0x1d,0x08,0xa3,0xb4,0xb1,0x19,0x31,0x13,0x90,0x0d,
+0x1a,0x94,0xa5,0xa8,0x0b,0x21,0x07,0xb1,0xca,0x2a,0x64,0x12,0xfb,0xbe,0xac,0x8a,
+0x00,0x11,0x80,0x99,0x09,0x21,0x00,0xa8,0x99,0x39,0x40,0x18,0x8d,0x1a,0x20,0x93,
+0xd2,0xb1,0xa3,0x33,0x39,0x0c,0x2a,0x39,0x01,0xb2,0xa9,0x29,0x31,0x3b,0x9b,0xb0,
+0x13,0x31,0x2b,0x1d,0x4a,0x3a,0x19,0x9b,0x1b,0x21,0x11,0xb0,0xa0,0x11,0x32,0x2a,
+0x1d,0x2a,0x7a,0x19,0xb1,0xb1,0x21,0x31,0xa1,0xd9,0x90,0x23,0x41,0x0c,0x0d,0x29,
+0x05,0xb3,0xfb,0x1b,0x73,0x37,0x32,0x11,0x99,0x0a,0x29,0x11,0x90,0xb8,0x90,0x31,
+0x11,0xd0,0xa8,0x20,0x32,0x19,0x1f,0x1b,0x30,0x01,0xda,0xb0,0x04,0x05,0xb9,0x9e,
+0x48,0x67,0x24,0x12,0x88,0xab,0x19,0x54,0x43,0x22,0x00,0x89,0x09,0x18,0x00,0x80,
+0x09,0x09,0x01,0x11,0x1b,0x9b,0x92,0x21,0x2a,0x1b,0x09,0x10,0x91,0x91,0xb1,0x92,
+0x39,0x3a,0x2b,0x3b,0x3b,0x4b,0x2b,0x1b,0x09,0x91,0xb3,0xb3,0xc2,0xb3,0x84,0x90,
+0xb1,0xa2,0x21,0x4b,0x2b,0x9b,0x91,0x92,0xa2,0x91,0x2a,0x19,0x39,0x3b,0x0b,0x19,
+0x39,0x19,0xc1,0xa2,0x31,0x4a,0x1a,0xaa,0x01,0x30,0x39,0x9b,0xa9,0x21,0x59,0x3b,
+0x1c,0x09,0x10,0x12,0x99,0xab,0xb3,0x97,0x92,0x99,0x09,0x30,0x42,0x1b,0x8f,0x29,
+0x31,0x01,0xfb,0xa9,0x32,0x27,0xc1,0xed,0xbc,0x9b,0x88,0x02,0x02,0x99,0x0a,0x39,
+0x20,0x90,0xa9,0x2b,0x30,0x95,0xb1,0xb8,0x39,0x59,0x29,0x8b,0x0b,0x30,0x21,0xb1,
+0xd1,0xa2,0x22,0x19,0xb9,0x99,0x39,0x11,0xb2,0x19,0x3d,0x09,0xb3,0x10,0x2d,0x1a,
+0xa2,0xb3,0xc2,0xb2,0x94,0x02,0x09,0x1b,0x4b,0x2a,0xb2,0xe3,0x91,0x92,0x93,0x91,
+0x9a,0x3a,0x39,0x01,0xa9,0x09,0x5a,0x29,0xa9,0xe4,0xa2,0x93,0x92,0x90,0x1b,0x39,
+0x31,0x3a,0x1e,0x1a,0x11,0x21,0x0c,0x0b,0x10,0x33,0x92,0xbb,0xab,0x04,0x96,0xb1,
+0xab,0x18,0x27,0x92,0xea,0xab,0x71,0x55,0x43,0x12,0x88,0x99,0x88,0x11,0x10,0x09,
+0x0b,0x3a,0x38,0x00,0xb9,0xb9,0x31,0x13,0xa2,0xc0,0x90,0x41,0x10,0xb9,0xa9,0x99,
+0xa4,0xa5,0xa1,0xa0,0x12,0x93,0xa3,0xa9,0x1a,0x11,0x13,0xc2,0xa0,0x01,0x13,0x12,
+0x0b,0x9b,0x39,0x12,0x91,0xb9,0x1b,0x41,0x10,0x9b,0xca,0x92,0x86,0x91,0x99,0x1a,
+0x41,0x30,0xab,0xbb,0x19,0x33,0x93,0xb9,0x1e,0x5a,0x00,0xb2,0x99,0x4c,0x5a,0x28,
+0x8b,0x1c,0x4a,0x48,0x29,0x0e,0x0a,0x12,0x93,0xd1,0xb9,0x20,0x34,0xb2,0xfa,0x99,
+0x33,0x15,0xe9,0xba,0x62,0x37,0x24,0x01,0xaa,0x8a,0x41,0x23,0xc8,0xbe,0x9c,0x28,
+0x33,0x02,0xca,0xac,0x18,0x35,0x15,0x92,0xa8,0x9b,0x18,0x33,0x05,0xc0,0xcc,0xab,
+0x09,0x42,0x12,0xa9,0xbb,0x1a,0x44,0x13,0xd9,0xcb,0x29,0x64,0x33,0x12,0xc9,0xcb,
+0xab,0x88,0x11,0x21,0x80,0xb9,0xc9,0x12,0x33,0x01,0xbd,0xab,0x53,0x25,0xb0,0xcd,
+0x0a,0x65,0x34,0x01,0xc9,0xac,0x9a,0x11,0x11,0x90,0x9a,0x18,0x21,0x92,0xba,0x99,
+0x52,0x21,0xba,0x9c,0x59,0x41,0x08,0x9d,0x1a,0x41,0x82,0xc8,0x9b,0x49,0x53,0x08,
+0x9d,0x1b,0x32,0x05,0xc8,0xab,0x28,0x17,0x92,0xcb,0x8a,0x42,0x14,0xb8,0xbd,0x18,
+0x35,0x02,0xbc,0x9d,0x31,0x35,0x90,0xaf,0x0a,0x52,0x34,0x01,0xaa,0x9b,0x30,0x33,
+0x91,0xae,0x09,0x41,0x02,0xb9,0xba,0x30,0x44,0x90,0xac,0x1a,0x70,0x10,0xa9,0x8b,
+0x38,0x14,0xb2,0xcb,0x2a,0x61,0x01,0xc9,0x9a,0x21,0x06,0xa1,0xbb,0x3a,0x73,0x10,
+0xbb,0x8c,0x51,0x22,0xa9,0xad,0x29,0x34,0x93,0xcc,0x0b,0x51,0x04,0xc0,0xba,0x28,
+0x35,0xa2,0xfa,0x99,0x42,0x22,0xb9,0xbd,0x28,0x26,0x92,0xbc,0x0c,0x52,0x14,0xd9,
+0xbc,0x0a,0x43,0x04,0xc8,0xba,0x38,0x44,0x91,0xcc,0x19,0x55,0x82,0xff,0xbf,0xcd,
+0xbb,0xac,0xab,0x89,0x10,0x32,0x32,0x12,0x32,0x55,0x45,0x43,0x33,0x23,0x12,0x00,
+0xa9,0xab,0xaa,0xaa,0xeb,0xcc,0xbd,0xbb,0xbb,0xbb,0xbc,0xcb,0xaa,0x08,0x20,0x32,
+0x44,0x53,0x34,0x34,0x23,0x33,0x12,0x11,0x80,0x98,0xca,0xdb,0xcc,0xcb,0xac,0xac,
+0xab,0x9a,0x99,0x08,0x10,0x42,0x46,0x44,0x24,0x33,0x33,0x43,0x43,0x33,0x11,0x80,
+0x99,0x99,0xba,0xcd,0xdc,0xba,0xab,0x9a,0x88,0x80,0x11,0x42,0x45,0x34,0x35,0x34,
+0x33,0x24,0x23,0x22,0x12,0x80,0xa9,0xbd,0xcd,0xbc,0xbc,0xcb,0xba,0xba,0xbb,0xaa,
+0x89,0x21,0x43,0x43,0x44,0x44,0x43,0x33,0x12,0x81,0x89,0x89,0xa9,0xec,0xcd,0xbc,
+0xcb,0xab,0xba,0xbb,0xcb,0xab,0x89,0x10,0x42,0x33,0x35,0x35,0x44,0x32,0x23,0x33,
+0x23,0x02,0x90,0xba,0xbb,0xcc,0xdc,0xcc,0xbb,0xab,0x09,0x21,0x21,0x21,0x63,0x46,
+0x34,0x34,0x24,0x22,0x22,0x23,0x33,0x12,0x80,0xb9,0xcb,0xcc,0xdb,0xbc,0xac,0xbb,
+0xbb,0xab,0x9b,0x09,0x41,0x33,0x34,0x44,0x54,0x43,0x23,0x81,0x98,0x99,0x88,0xa9,
+0xee,0xcc,0xbc,0xcb,0xaa,0x9a,0x09,0x11,0x23,0x22,0x12,0x54,0x54,0x53,0x32,0x23,
+0x12,0x01,0xa8,0xaa,0xba,0x99,0xba,0xde,0xcc,0xbb,0xac,0xba,0xba,0xbc,0xab,0x99,
+0x10,0x32,0x34,0x44,0x34,0x25,0x33,0x23,0x13,0x11,0x81,0x98,0xba,0xcc,0xbc,0xbd,
+0xbd,0xcb,0xbb,0xaa,0x9a,0x88,0x10,0x42,0x45,0x45,0x43,0x33,0x33,0x43,0x33,0x34,
+0x22,0x00,0x99,0xa9,0xba,0xeb,0xcc,0xbc,0xbb,0x9a,0x99,0x80,0x01,0x31,0x55,0x34,
+0x35,0x34,0x43,0x23,0x33,0x32,0x12,0x00,0x98,0xdb,0xdc,0xbc,0xbd,0xca,0xaa,0xba,
+0xba,0xaa,0x8a,0x20,0x32,0x34,0x53,0x44,0x34,0x34,0x12,0x00,0x98,0x98,0x88,0xdb,
+0xdd,0xcc,0xbb,0xac,0xab,0xba,0xcb,0xaa,0x9a,0x18,0x21,0x43,0x34,0x45,0x33,0x34,
+0x33,0x33,0x33,0x23,0x80,0xb9,0xbc,0xcb,0xcc,0xcd,0xcb,0xab,0x89,0x10,0x21,0x20,
+0x41,0x55,0x44,0x34,0x33,0x23,0x33,0x42,0x32,0x22,0x81,0x98,0xbb,0xcd,0xdb,0xdb,
+0xbb,0xbb,0xcb,0xab,0xab,0x89,0x21,0x33,0x34,0x53,0x45,0x44,0x32,0x11,0x88,0x99,
+0x88,0xa9,0xec,0xcd,0xbc,0xbc,0xbb,0xaa,0x89,0x11,0x32,0x23,0x22,0x53,0x46,0x34,
+0x34,0x24,0x12,0x01,0x80,0xaa,0xaa,0xaa,0xa9,0xfb,0xcc,0xcb,0xbb,0xab,0xcb,0xca,
+0xaa,0x9a,0x00,0x21,0x32,0x44,0x44,0x43,0x33,0x24,0x12,0x11,0x01,0x88,0xa9,0xca,
+0xdb,0xbc,0xbd,0xbc,0xbb,0xab,0xaa,0x98,0x08,0x22,0x46,0x54,0x53,0x32,0x33,0x43,
+0x32,0x24,0x23,0x11,0x88,0x9a,0xba,0xdb,0xcc,0xcc,0xab,0xab,0x89,0x88,0x00,0x10,
+0x53,0x44,0x35,0x34,0x43,0x33,0x43,0x22,0x21,0x00,0x90,0xba,0xcd,0xcc,0xbc,0xcb,
+0xba,0xbb,0xcb,0xaa,0x99,0x00,0x31,0x33,0x44,0x53,0x34,0x35,0x22,0x02,0x90,0x98,
+0x89,0xba,0xde,0xdc,0xbb,0xbc,0xba,0xba,0xcb,0xba,0x9b,0x09,0x31,0x33,0x45,0x53,
+0x43,0x33,0x24,0x33,0x33,0x22,0x01,0xa9,0xbb,0xbc,0xcc,0xcd,0xbc,0xac,0x8a,0x08,
+0x11,0x10,0x11,0x54,0x45,0x34,0x34,0x32,0x32,0x32,0x33,0x32,0x11,0x98,0xba,0xbd,
+0xbd,0xcd,0xcb,0xca,0xaa,0xba,0xaa,0x99,0x10,0x22,0x24,0x43,0x54,0x53,0x43,0x12,
+0x80,0x89,0x89,0x89,0xcb,0xcf,0xbc,0xcc,0xba,0xaa,0x89,0x18,0x21,0x22,0x21,0x31,
+0x55,0x35,0x35,0x33,0x23,0x22,0x80,0xa9,0xba,0xaa,0xaa,0xdc,0xdc,0xbc,0xcb,0xaa,
+0xbb,0xbb,0xbc,0xaa,0x88,0x11,0x33,0x44,0x44,0x34,0x43,0x32,0x32,0x21,0x01,0x80,
+0x99,0xca,0xdb,0xeb,0xcb,0xcb,0xbb,0xab,0xaa,0x89,0x09,0x10,0x63,0x45,0x44,0x33,
+0x34,0x32,0x33,0x34,0x23,0x13,0x80,0xa9,0xa9,0xcb,0xcd,0xcc,0xcb,0xab,0x99,0x09,
+0x88,0x10,0x32,0x45,0x35,0x25,0x24,0x23,0x33,0x33,0x23,0x11,0x80,0xba,0xdd,0xdb,
+0xbc,0xbc,0xbb,0xac,0xab,0xbb,0xaa,0x88,0x21,0x43,0x43,0x44,0x53,0x43,0x23,0x12,
+0x00,0x89,0x89,0xa9,0xdd,0xcd,0xbc,0xcb,0xaa,0xab,0xcb,0xba,0xaa,0x89,0x10,0x32,
+0x34,0x45,0x53,0x33,0x43,0x23,0x23,0x23,0x11,0x88,0xba,0xcb,0xbc,0xbe,0xbe,0xcb,
+0x9a,0x09,0x11,0x11,0x20,0x42,0x56,0x53,0x33,0x24,0x22,0x22,0x32,0x32,0x12,0x90,
+0xa9,0xbc,0xeb,0xdb,0xbc,0xcb,0xab,0xab,0xab,0xaa,0x09,0x32,0x34,0x34,0x44,0x54,
+0x33,0x33,0x01,0xa8,0x99,0x88,0xc9,0xed,0xbd,0xbd,0xcb,0xaa,0x9a,0x09,0x11,0x22,
+0x12,0x22,0x54,0x54,0x53,0x32,0x32,0x21,0x00,0x98,0xaa,0xaa,0x9a,0xc9,0xec,0xdb,
+0xcb,0xba,0xaa,0xbb,0xbc,0xab,0x89,0x10,0x32,0x53,0x53,0x34,0x34,0x24,0x22,0x12,
+0x01,0x81,0x98,0xaa,0xdb,0xbc,0xbd,0xbd,0xcb,0xba,0xaa,0x89,0x09,0x18,0x32,0x56,
+0x44,0x43,0x33,0x33,0x24,0x24,0x23,0x13,0x81,0x98,0xaa,0xba,0xdc,0xcc,0xbc,0xab,
+0xaa,0x89,0x80,0x00,0x21,0x73,0x34,0x35,0x34,0x24,0x33,0x33,0x32,0x12,0x01,0xa9,
+0xcc,0xdc,0xdb,0xbb,0xbc,0xbb,0xbb,0xbb,0xbb,0x99,0x20,0x42,0x53,0x43,0x44,0x34,
+0x24,0x13,0x81,0x88,0x98,0x98,0xcb,0xce,0xbd,0xbc,0xcb,0xaa,0xba,0xbb,0xbb,0x9a,
+0x18,0x32,0x44,0x53,0x53,0x43,0x33,0x33,0x43,0x22,0x12,0x80,0xa9,0xbb,0xcc,0xcc,
+0xcc,0xcb,0xaa,0x99,0x10,0x10,0x11,0x32,0x47,0x44,0x24,0x24,0x22,0x22,0x32,0x23,
+0x22,0x00,0x99,0xbb,0xcd,0xdb,0xbc,0xbc,0xbb,0xac,0xba,0xaa,0x89,0x11,0x43,0x33,
+0x44,0x44,0x44,0x23,0x12,0x80,0x99,0x88,0x99,0xdd,0xcd,0xbc,0xbc,0xab,0xab,0x89,
+0x10,0x32,0x22,0x21,0x63,0x54,0x44,0x33,0x23,0x23,0x12,0x80,0xaa,0xab,0xab,0xba,
+0xed,0xcc,0xcb,0xbb,0xab,0xcb,0xbb,0xbb,0x9b,0x18,0x22,0x34,0x44,0x44,0x34,0x33,
+0x24,0x12,0x02,0x01,0x88,0x9a,0xcb,0xbc,0xcd,0xcb,0xac,0xbb,0xba,0xa9,0x89,0x08,
+0x21,0x45,0x45,0x44,0x33,0x23,0x24,0x33,0x43,0x22,0x02,0x98,0xa9,0xb9,0xcc,0xcc,
+0xbc,0xbc,0x9a,0x99,0x08,0x80,0x11,0x43,0x45,0x34,0x35,0x33,0x34,0x23,0x23,0x22,
+0x01,0x90,0xca,0xcd,0xcc,0xcb,0xbb,0xac,0xab,0xbb,0xab,0x9a,0x00,0x32,0x34,0x34,
+0x45,0x34,0x34,0x14,0x11,0x88,0x88,0x89,0xba,0xdd,0xbd,0xbd,0xba,0xbb,0xac,0xbb,
+0xbb,0xaa,0x08,0x21,0x43,0x35,0x44,0x43,0x43,0x23,0x33,0x32,0x22,0x01,0x99,0xbb,
+0xbc,0xdd,0xdb,0xbc,0xbb,0x9a,0x18,0x11,0x10,0x22,0x55,0x45,0x34,0x24,0x33,0x32,
+0x23,0x33,0x23,0x02,0xa8,0xba,0xcc,0xbd,0xbd,0xbd,0xbb,0xbb,0xbb,0xab,0x9b,0x10,
+0x53,0x43,0x42,0x53,0x44,0x33,0x23,0x81,0x99,0x89,0x98,0xfb,0xcd,0xbd,0xbc,0xbb,
+0xba,0x9a,0x18,0x31,0x32,0x22,0x33,0x47,0x35,0x35,0x33,0x33,0x21,0x80,0x99,0xba,
+0xaa,0xaa,0xdc,0xcd,0xdb,0xab,0xbb,0xba,0xac,0xcb,0xa9,0x88,0x20,0x31,0x44,0x34,
+0x44,0x32,0x33,0x33,0x12,0x02,0x80,0xa9,0xca,0xdb,0xcc,0xcc,0xbb,0xbc,0xba,0x9a,
+0x99,0x88,0x11,0x63,0x54,0x34,0x34,0x33,0x24,0x33,0x43,0x23,0x12,0x90,0x99,0xaa,
+0xcb,0xdc,0xcc,0xbb,0xbb,0x9a,0x89,0x00,0x10,0x42,0x45,0x44,0x34,0x33,0x34,0x32,
+0x33,0x23,0x12,0x88,0xba,0xce,0xbc,0xbd,0xbc,0xbb,0xac,0xbb,0xab,0xaa,0x88,0x21,
+0x43,0x43,0x44,0x44,0x43,0x32,0x11,0x80,0x88,0x88,0xa8,0xdd,0xdc,0xcb,0xcb,0xaa,
+0xba,0xba,0xcb,0x9a,0x89,0x10,0x32,0x34,0x45,0x43,0x24,0x33,0x33,0x33,0x33,0x02,
+0xa0,0xda,0xca,0xca,0xcc,0xbc,0xbc,0x9b,0x89,0x10,0x10,0x20,0x63,0x54,0x44,0x33,
+0x33,0x33,0x24,0x23,0x23,0x12,0x88,0xb9,0xdb,0xdb,0xcc,0xcb,0xcb,0xba,0xba,0xaa,
+0x9a,0x88,0x22,0x34,0x34,0x35,0x35,0x35,0x32,0x01,0x88,0x98,0x88,0xb9,0xdf,0xcc,
+0xcb,0xac,0xba,0xa9,0x88,0x10,0x12,0x12,0x22,0x54,0x54,0x43,0x33,0x24,0x12,0x01,
+0x98,0xa9,0xa9,0x99,0xba,0xde,0xdb,0xcb,0xba,0xaa,0xbb,0xac,0xab,0x89,0x18,0x32,
+0x34,0x45,0x53,0x33,0x43,0x22,0x22,0x11,0x80,0x98,0xb9,0xdb,0xcc,0xbc,0xbd,0xbb,
+0xcb,0x9a,0x8a,0x89,0x10,0x32,0x46,0x35,0x34,0x34,0x33,0x43,0x33,0x33,0x13,0x01,
+0xa9,0xba,0xdb,0xcc,0xcc,0xcb,0xab,0xaa,0x89,0x08,0x18,0x21,0x54,0x44,0x34,0x53,
+0x32,0x33,0x33,0x22,0x22,0x00,0xa8,0xcc,0xcd,0xbc,0xbc,0xcb,0xab,0xbb,0xbb,0xab,
+0x89,0x11,0x33,0x44,0x44,0x53,0x34,0x43,0x12,0x01,0x88,0x88,0x99,0xda,0xec,0xcb,
+0xbc,0xba,0xbb,0xbb,0xbc,0xab,0x9a,0x10,0x31,0x44,0x43,0x35,0x34,0x43,0x32,0x23,
+0x33,0x12,0x80,0xaa,0xbc,0xdb,0xcc,0xbc,0xbd,0xaa,0x8a,0x00,0x01,0x01,0x42,0x55,
+0x34,0x35,0x33,0x42,0x22,0x23,0x23,0x12,0x81,0xa8,0xca,0xcc,0xdb,0xbc,0xbc,0xab,
+0xbb,0xbb,0xaa,0x0a,0x20,0x34,0x34,0x44,0x44,0x34,0x24,0x02,0x00,0x89,0x88,0xa8,
+0xec,0xdc,0xcb,0xcb,0xab,0xaa,0x89,0x10,0x21,0x21,0x11,0x53,0x55,0x43,0x34,0x32,
+0x22,0x02,0x00,0xa9,0xaa,0xaa,0xb9,0xce,0xdc,0xcb,0xba,0xba,0xbb,0xcb,0xab,0x9a,
+0x08,0x22,0x53,0x34,0x35,0x34,0x34,0x32,0x22,0x11,0x00,0x90,0xa9,0xdb,0xeb,0xcb,
+0xbc,0xcb,0xab,0xab,0x9a,0x89,0x08,0x30,0x64,0x44,0x44,0x23,0x24,0x32,0x32,0x24,
+0x23,0x01,0x98,0xa9,0xca,0xcb,0xbd,0xbd,0xbb,0xab,0x99,0x09,0x08,0x21,0x63,0x44,
+0x44,0x43,0x33,0x24,0x23,0x23,0x12,0x01,0x98,0xba,0xce,0xbc,0xbd,0xac,0xbb,0xbb,
+0xac,0xaa,0x99,0x18,0x31,0x34,0x53,0x53,0x53,0x33,0x33,0x11,0x80,0x98,0x98,0xca,
+0xce,0xcd,0xbb,0xbc,0xba,0xbb,0xac,0xbb,0x9a,0x08,0x22,0x43,0x34,0x45,0x43,0x33,
+0x24,0x23,0x23,0x22,0x81,0xa8,0xbb,0xcc,0xbc,0xbe,0xbd,0xba,0x9a,0x80,0x01,0x01,
+0x31,0x64,0x54,0x53,0x32,0x33,0x32,0x23,0x33,0x23,0x11,0x98,0xcb,0xcc,0xcc,0xdb,
+0xbb,0xcb,0xba,0xba,0xaa,0x8a,0x18,0x43,0x43,0x43,0x44,0x44,0x33,0x22,0x00,0x88,
+0x88,0x98,0xfb,0xdc,0xbc,0xbc,0xac,0xaa,0x9a,0x08,0x11,0x21,0x21,0x32,0x55,0x35,
+0x35,0x42,0x12,0x12,0x00,0x98,0xa9,0x99,0xa9,0xdb,0xdc,0xbc,0xbb,0xac,0xbb,0xcb,
+0xab,0xaa,0x08,0x20,0x42,0x53,0x34,0x35,0x33,0x34,0x22,0x12,0x01,0x88,0xa8,0xba,
+0xcd,0xcc,0xcb,0xbc,0xbb,0xbb,0xab,0x99,0x09,0x20,0x54,0x54,0x53,0x43,0x23,0x33,
+0x33,0x34,0x33,0x11,0x80,0xa9,0xba,0xcc,0xcd,0xdb,0xab,0xbb,0x9a,0x89,0x88,0x11,
+0x42,0x45,0x34,0x44,0x43,0x32,0x23,0x33,0x22,0x11,0x00,0xba,0xcd,0xbd,0xbd,0xac,
+0xac,0xba,0xba,0xaa,0x9a,0x09,0x21,0x43,0x34,0x44,0x44,0x33,0x33,0x13,0x01,0x88,
+0x80,0xb9,0xed,0xdc,0xcb,0xcb,0xaa,0xbb,0xba,0xac,0x9a,0x89,0x20,0x22,0x35,0x44,
+0x53,0x33,0x33,0x24,0x23,0x13,0x02,0xa8,0xba,0xdb,0xdb,0xbc,0xcd,0xbb,0xaa,0x89,
+0x00,0x01,0x21,0x63,0x45,0x44,0x33,0x33,0x33,0x43,0x32,0x23,0x02,0x80,0xba,0xeb,
+0xcb,0xcc,0xcb,0xcb,0xba,0xba,0xba,0x99,0x08,0x22,0x34,0x43,0x35,0x36,0x34,0x32,
+0x01,0x88,0x88,0x88,0xc9,0xdd,0xbd,0xbd,0xbb,0xbb,0xab,0x88,0x10,0x22,0x22,0x42,
+0x54,0x44,0x44,0x23,0x33,0x22,0x01,0x98,0xa9,0xaa,0x99,0xca,0xdd,0xcc,0xcb,0xba,
+0xba,0xbb,0xcb,0xab,0x89,0x11,0x32,0x44,0x53,0x43,0x34,0x33,0x33,0x22,0x02,0x81,
+0x98,0xba,0xcd,0xcc,0xdb,0xcb,0xbb,0xba,0xab,0x9a,0x89,0x00,0x43,0x55,0x44,0x34,
+0x33,0x33,0x34,0x42,0x32,0x12,0x81,0xa8,0xaa,0xdb,0xdb,0xbc,0xad,0xbb,0x9a,0x99,
+0x08,0x00,0x21,0x45,0x44,0x34,0x34,0x33,0x24,0x33,0x32,0x21,0x00,0xa9,0xeb,0xcc,
+0xbc,0xbc,0xcb,0xbb,0xbb,0xbb,0xaa,0x89,0x21,0x42,0x43,0x44,0x34,0x35,0x24,0x22,
+0x01,0x88,0x88,0x98,0xda,0xcd,0xbd,0xcb,0xbb,0xab,0xac,0xbb,0xaa,0x8a,0x18,0x32,
+0x53,0x44,0x53,0x43,0x33,0x23,0x43,0x22,0x11,0x00,0xa9,0xcb,0xcb,0xbd,0xcd,0xbb,
+0xba,0x99,0x00,0x10,0x11,0x52,0x45,0x44,0x34,0x42,0x22,0x22,0x23,0x23,0x22,0x80,
+0x99,0xcb,0xcc,0xbc,0xbd,0xbc,0xbb,0xbb,0xba,0xaa,0x09,0x20,0x34,0x53,0x53,0x44,
+0x34,0x33,0x12,0x00,0x89,0x88,0xa8,0xde,0xdc,0xcb,0xac,0xab,0xaa,0x98,0x10,0x11,
+0x21,0x11,0x52,0x45,0x44,0x43,0x32,0x22,0x11,0x80,0x99,0x9a,0x9a,0xba,0xdd,0xcc,
+0xcb,0xbb,0xbb,0xbb,0xbc,0xbb,0x9a,0x18,0x31,0x44,0x53,0x34,0x35,0x33,0x23,0x23,
+0x12,0x01,0x80,0xaa,0xdc,0xdb,0xbc,0xbc,0xbc,0xba,0xbb,0x9a,0x8a,0x08,0x31,0x55,
+0x44,0x44,0x33,0x33,0x24,0x33,0x43,0x22,0x81,0x90,0xaa,0xca,0xdb,0xcc,0xbc,0xbb,
+0xaa,0x9a,0x89,0x08,0x21,0x44,0x35,0x35,0x44,0x23,0x24,0x23,0x22,0x12,0x01,0x98,
+0xca,0xdc,0xcb,0xbc,0xbc,0xbb,0xbb,0xbb,0xbb,0x8a,0x18,0x42,0x53,0x43,0x44,0x34,
+0x43,0x23,0x11,0x80,0x88,0x88,0xba,0xcf,0xcc,0xcb,0xbb,0xcb,0xba,0xca,0xaa,0x99,
+0x08,0x21,0x42,0x53,0x53,0x43,0x33,0x33,0x24,0x22,0x12,0x81,0xa8,0xba,0xcc,0xcc,
+0xcc,0xcb,0xba,0x9a,0x09,0x18,0x10,0x32,0x54,0x45,0x34,0x43,0x33,0x23,0x33,0x33,
+0x23,0x02,0x98,0xcb,0xcc,0xcc,0xdb,0xbb,0xcb,0xab,0xba,0xaa,0x9a,0x10,0x42,0x53,
+0x43,0x53,0x34,0x34,0x12,0x01,0x88,0x80,0x98,0xeb,0xcd,0xcc,0xbb,0xac,0xab,0xaa,
+0x88,0x11,0x12,0x12,0x42,0x64,0x34,0x35,0x23,0x33,0x12,0x01,0x98,0x9a,0xaa,0xb9,
+0xdc,0xcd,0xbc,0xbb,0xac,0xbb,0xcb,0xab,0x9b,0x88,0x21,0x43,0x34,0x45,0x43,0x33,
+0x43,0x22,0x21,0x10,0x88,0x99,0xca,0xdb,0xbc,0xbd,0xbc,0xbb,0xbb,0xab,0x9a,0x09,
+0x21,0x54,0x45,0x53,0x33,0x34,0x33,0x24,0x33,0x32,0x11,0x90,0xa9,0xca,0xbc,0xcd,
+0xbc,0xbc,0xba,0xa9,0x98,0x80,0x11,0x32,0x46,0x34,0x35,0x43,0x33,0x33,0x33,0x23,
+0x12,0x90,0xba,0xce,0xcc,0xbc,0xcb,0xcb,0xba,0xba,0xaa,0x9a,0x88,0x21,0x34,0x34,
+0x45,0x43,0x43,0x23,0x22,0x00,0x80,0x88,0xa9,0xdd,0xcc,0xcc,0xbb,0xbb,0xbb,0xcb,
+0xbb,0xaa,0x89,0x20,0x42,0x44,0x34,0x44,0x33,0x33,0x24,0x23,0x23,0x01,0x98,0xbb,
+0xcc,0xcb,0xbd,0xbd,0xbc,0xaa,0x98,0x00,0x10,0x21,0x53,0x45,0x35,0x43,0x33,0x33,
+0x33,0x43,0x22,0x02,0x88,0xaa,0xbc,0xbd,0xcd,0xcb,0xbb,0xbb,0xab,0xbb,0xaa,0x08,
+0x42,0x43,0x34,0x35,0x45,0x33,0x33,0x11,0x08,0x09,0x88,0xc9,0xed,0xcc,0xac,0xac,
+0xba,0xa9,0x88,0x00,0x21,0x11,0x22,0x54,0x44,0x44,0x23,0x33,0x22,0x01,0x88,0x99,
+0xa9,0xa9,0xdb,0xcd,0xcc,0xbb,0xac,0xab,0xcb,0xba,0xaa,0x89,0x11,0x32,0x34,0x45,
+0x34,0x34,0x43,0x22,0x21,0x01,0x00,0x88,0xba,0xeb,0xdb,0xdb,0xbb,0xbc,0xab,0xaa,
+0x9a,0x88,0x18,0x51,0x44,0x45,0x33,0x34,0x33,0x24,0x33,0x33,0x22,0x00,0xa9,0xca,
+0xbc,0xbd,0xbd,0xbc,0xac,0x9a,0x99,0x08,0x08,0x31,0x63,0x34,0x35,0x34,0x24,0x33,
+0x33,0x22,0x12,0x00,0xa9,0xcc,0xbd,0xcd,0xbb,0xcb,0xbb,0xbb,0xbb,0xaa,0x89,0x11,
+0x53,0x33,0x36,0x44,0x34,0x33,0x23,0x11,0x80,0x08,0xa9,0xfb,0xcc,0xcc,0xbb,0xbc,
+0xba,0xbb,0xac,0x9b,0x8a,0x00,0x22,0x34,0x45,0x34,0x53,0x32,0x33,0x32,0x23,0x12,
+0x90,0xb9,0xdb,0xdb,0xcc,0xbc,0xbc,0xab,0x8a,0x08,0x00,0x00,0x42,0x55,0x44,0x33,
+0x34,0x33,0x32,0x43,0x22,0x21,0x80,0xa8,0xca,0xcc,0xdb,0xbc,0xcb,0xba,0xbb,0xba,
+0xaa,0x09,0x21,0x34,0x44,0x53,0x53,0x43,0x33,0x12,0x00,0x08,0x88,0xa9,0xdd,0xcd,
+0xdb,0xbb,0xbb,0xba,0x99,0x00,0x11,0x11,0x21,0x44,0x36,0x45,0x33,0x24,0x23,0x11,
+0x00,0x98,0x99,0x9a,0xba,0xdd,0xcc,0xcb,0xbb,0xbb,0xcb,0xbb,0xab,0x9a,0x18,0x22,
+0x44,0x44,0x34,0x34,0x43,0x32,0x22,0x11,0x00,0x88,0xaa,0xdb,0xdb,0xcc,0xcb,0xbb,
+0xac,0xaa,0x9a,0x99,0x08,0x21,0x45,0x35,0x35,0x24,0x33,0x33,0x34,0x33,0x22,0x02,
+0xa8,0xba,0xdb,0xcc,0xbc,0xbd,0xbb,0xab,0x9a,0x89,0x00,0x20,0x63,0x54,0x43,0x43,
+0x43,0x32,0x23,0x23,0x12,0x81,0x90,0xcb,0xdc,0xcc,0xbb,0xad,0xab,0xbb,0xbb,0xab,
+0x9a,0x10,0x42,0x43,0x34,0x45,0x43,0x24,0x22,0x02,0x00,0x88,0x88,0xc9,0xdc,0xcc,
+0xbc,0xbb,0xbb,0xcb,0xab,0xbb,0xaa,0x08,0x22,0x44,0x53,0x53,0x43,0x33,0x43,0x22,
+0x23,0x11,0x81,0xa8,0xca,0xdb,0xdb,0xbc,0xcc,0xaa,0x9a,0x89,0x00,0x10,0x21,0x54,
+0x45,0x43,0x43,0x32,0x32,0x32,0x32,0x13,0x01,0x98,0xbb,0xcd,0xcc,0xdb,0xbb,0xac,
+0xbb,0xba,0xaa,0x8a,0x28,0x52,0x33,0x35,0x54,0x43,0x33,0x22,0x01,0x08,0x88,0x98,
+0xdc,0xcd,0xcc,0xbb,0xac,0xab,0xaa,0x08,0x10,0x11,0x12,0x42,0x45,0x35,0x35,0x32,
+0x33,0x12,0x01,0x88,0xa9,0xa9,0xaa,0xcd,0xcd,0xcb,0xac,0xab,0xbb,0xcb,0xab,0x9a,
+0x88,0x21,0x42,0x44,0x34,0x44,0x33,0x33,0x32,0x12,0x02,0x80,0xa9,0xdb,0xbc,0xcd,
+0xcb,0xbc,0xbb,0xba,0xaa,0x99,0x88,0x20,0x44,0x36,0x45,0x42,0x22,0x33,0x42,0x32,
+0x22,0x11,0x88,0xa9,0xcb,0xdb,0xcc,0xcb,0xcb,0xaa,0xa9,0x88,0x88,0x10,0x42,0x44,
+0x44,0x43,0x43,0x32,0x33,0x23,0x22,0x02,0x90,0xba,0xdd,0xbc,0xbd,0xbc,0xbb,0xcb,
+0xba,0xab,0xab,0x99,0x20,0x52,0x34,0x35,0x44,0x33,0x33,0x23,0x11,0x00,0x88,0xb8,
+0xdd,0xdc,0xdb,0xba,0xac,0xba,0xba,0xbb,0xaa,0x09,0x20,0x33,0x36,0x45,0x43,0x33,
+0x34,0x23,0x23,0x13,0x02,0x99,0xca,0xbc,0xcc,0xcc,0xcb,0xcb,0x9a,0x99,0x08,0x08,
+0x20,0x52,0x44,0x44,0x33,0x34,0x32,0x24,0x22,0x12,0x11,0x88,0xa9,0xbc,0xcd,0xdb,
+0xcb,0xba,0xbb,0xbb,0xbb,0x9a,0x18,0x32,0x45,0x43,0x34,0x45,0x33,0x23,0x12,0x00,
+0x00,0x08,0xc9,0xcd,0xcd,0xbc,0xcb,0xba,0xaa,0x89,0x08,0x00,0x11,0x21,0x45,0x35,
+0x35,0x34,0x32,0x23,0x12,0x00,0x89,0x99,0x9a,0xdb,0xcd,0xcc,0xbb,0xac,0xbb,0xbb,
+0xac,0xaa,0x89,0x10,0x33,0x44,0x44,0x34,0x34,0x33,0x33,0x22,0x12,0x00,0x99,0xba,
+0xcd,0xbd,0xcc,0xcb,0xbb,0xbb,0xba,0xaa,0x89,0x10,0x43,0x36,0x45,0x43,0x43,0x32,
+0x33,0x33,0x33,0x13,0x01,0xa9,0xbc,0xcd,0xdb,0xcb,0xac,0xbb,0xaa,0x9a,0x88,0x00,
+0x32,0x54,0x44,0x43,0x34,0x33,0x24,0x23,0x23,0x11,0x81,0xa8,0xcc,0xcc,0xbc,0xad,
+0xcb,0xba,0xaa,0xab,0x9a,0x89,0x20,0x42,0x53,0x53,0x53,0x43,0x23,0x13,0x02,0x00,
+0x80,0x98,0xdb,0xcd,0xcc,0xbb,0xac,0xcb,0xaa,0xab,0xaa,0x89,0x00,0x22,0x44,0x44,
+0x53,0x33,0x43,0x32,0x23,0x22,0x02,0x80,0xb9,0xeb,0xcb,0xbd,0xcc,0xba,0xab,0xaa,
+0x88,0x08,0x00,0x42,0x45,0x35,0x35,0x33,0x43,0x32,0x22,0x23,0x12,0x00,0xa9,0xbc,
+0xcd,0xbc,0xbc,0xbc,0xac,0xba,0xaa,0x99,0x89,0x21,0x43,0x53,0x53,0x34,0x34,0x33,
+0x23,0x01,0x00,0x80,0xb9,0xed,0xcc,0xbc,0xbc,0xba,0xbb,0x9a,0x08,0x00,0x11,0x21,
+0x63,0x54,0x34,0x44,0x22,0x23,0x21,0x10,0x88,0x89,0xa9,0xba,0xdd,0xbc,0xbd,0xcb,
+0xba,0xbb,0xbb,0xac,0x99,0x00,0x32,0x53,0x34,0x35,0x34,0x34,0x32,0x22,0x11,0x01,
+0x88,0xa8,0xcc,0xbc,0xcd,0xbb,0xad,0xbb,0xaa,0xaa,0x89,0x08,0x21,0x45,0x54,0x43,
+0x43,0x23,0x33,0x24,0x23,0x22,0x00,0x98,0xba,0xcc,0xbc,0xcd,0xbb,0xac,0xaa,0x9a,
+0x89,0x88,0x11,0x53,0x44,0x44,0x43,0x33,0x24,0x23,0x23,0x21,0x00,0x98,0xca,0xdc,
+0xdb,0xcb,0xbb,0xac,0xbb,0xba,0xaa,0x99,0x00,0x42,0x43,0x44,0x53,0x43,0x43,0x22,
+0x12,0x01,0x80,0x90,0xb9,0xce,0xbd,0xcc,0xba,0xbb,0xcb,0xba,0xba,0x9a,0x08,0x32,
+0x53,0x44,0x43,0x34,0x24,0x33,0x23,0x33,0x12,0x00,0xb9,0xcb,0xcc,0xcc,0xdb,0xbb,
+0x9c,0x8a,0x00,0x01,0x00,0x00,0x20,0x32,0x44,0x22,0x12,0x21,0x22,0x43,0x33,0x13,
+0x11,0x21,0x33,0x26,0x13,0x02,0x11,0x01,0xb9,0xbf,0xbb,0x09,0x98,0xed,0xcd,0xaa,
+0x88,0x80,0xeb,0xcd,0xbb,0x99,0x89,0xca,0xbe,0xcd,0xba,0xaa,0x9a,0x10,0x63,0x34,
+0x33,0x12,0x22,0x44,0x34,0x34,0x24,0x11,0x80,0xa9,0xcc,0xab,0xaa,0x89,0x99,0xdb,
+0xcb,0x9a,0x89,0x98,0xca,0xac,0x9b,0x99,0x98,0xba,0xbc,0x9a,0x88,0x80,0xb9,0xcc,
+0xcb,0xaa,0xaa,0x09,0x28,0x63,0x34,0x44,0x22,0x12,0x22,0x53,0x44,0x22,0x12,0x31,
+0x65,0x44,0x32,0x22,0x11,0x52,0x54,0x33,0x23,0x12,0x21,0x34,0x36,0x33,0x22,0x22,
+0x31,0x44,0x24,0x33,0x12,0x12,0x32,0x44,0x32,0x11,0x01,0x11,0x43,0x34,0x43,0x12,
+0x02,0x80,0xdb,0xbc,0xbb,0x88,0x90,0xfb,0xcc,0xbb,0x8a,0xa9,0xdc,0xcd,0xbb,0xab,
+0x99,0xca,0xdc,0xcb,0xbb,0x9a,0x99,0xcb,0xdd,0xcb,0xbb,0x9a,0x99,0xaa,0xbc,0xbc,
+0xaa,0x99,0xa8,0xca,0xbb,0xaa,0x9a,0x99,0x10,0x64,0x44,0x22,0x01,0x31,0x65,0x34,
+0x33,0x12,0x20,0x54,0x44,0x24,0x13,0x12,0x31,0x53,0x34,0x33,0x23,0x22,0x32,0x34,
+0x43,0x22,0x11,0x12,0x22,0x24,0x33,0x21,0x10,0x10,0xa9,0xcd,0xbc,0x8a,0x98,0xdd,
+0xce,0xbb,0x9a,0x88,0xb8,0xdf,0xbc,0xba,0xa9,0xa9,0xcd,0xcc,0xac,0xbb,0xaa,0x09,
+0x41,0x34,0x25,0x12,0x21,0x32,0x54,0x24,0x33,0x12,0x81,0xa9,0xcc,0xbc,0xbb,0x9a,
+0xa9,0xcb,0xcc,0xaa,0x99,0x88,0xa9,0xcc,0xab,0x89,0x08,0xa8,0xba,0xaa,0x09,0x11,
+0x80,0xa9,0xaa,0xba,0xce,0xaa,0x30,0x57,0x24,0x22,0x21,0x31,0x44,0x34,0x33,0x22,
+0x12,0x43,0x55,0x34,0x34,0x22,0x11,0x21,0x45,0x35,0x23,0x02,0x10,0x31,0x55,0x23,
+0x13,0x01,0x21,0x53,0x43,0x23,0x12,0x00,0x20,0x22,0x24,0x22,0x00,0x00,0x22,0x34,
+0x26,0x22,0x90,0xca,0xbd,0xbc,0xba,0xba,0xbb,0xbf,0xbd,0xbb,0xab,0x99,0xdb,0xce,
+0xac,0xbb,0x89,0xa8,0xda,0xcd,0xcb,0x9a,0x89,0xa8,0xcc,0xbd,0xbb,0xaa,0x89,0xba,
+0xcc,0xac,0x8a,0x88,0x80,0xa9,0xbb,0x9a,0x18,0x10,0x20,0x73,0x44,0x33,0x02,0x10,
+0x73,0x45,0x33,0x12,0x00,0x32,0x57,0x43,0x23,0x11,0x10,0x32,0x46,0x33,0x23,0x11,
+0x20,0x41,0x43,0x32,0x11,0x08,0x10,0x33,0x33,0x12,0x98,0xa9,0xcb,0xdd,0xcb,0xaa,
+0x98,0xca,0xde,0xcb,0xaa,0x09,0xa9,0xfc,0xdb,0xba,0xa9,0xa9,0xcb,0xbe,0xcc,0xba,
+0xaa,0x09,0x30,0x54,0x33,0x23,0x12,0x31,0x54,0x34,0x34,0x22,0x11,0x98,0xbb,0xcd,
+0xba,0x9a,0x99,0xba,0xbd,0xac,0x9a,0x89,0xb9,0xeb,0xab,0x9b,0x99,0x98,0xba,0xbb,
+0x9a,0x99,0xba,0xcd,0xbb,0xbb,0xbd,0xbc,0x9a,0x20,0x45,0x33,0x02,0x90,0x00,0x63,
+0x34,0x24,0x11,0x20,0x72,0x44,0x43,0x13,0x12,0x31,0x45,0x35,0x33,0x22,0x12,0x53,
+0x53,0x23,0x13,0x12,0x32,0x53,0x24,0x33,0x22,0x22,0x23,0x43,0x32,0x23,0x33,0x43,
+0x32,0x43,0x34,0x33,0x02,0xb9,0xcc,0xac,0xab,0xaa,0xda,0xfb,0xdb,0xbb,0xac,0x89,
+0xa9,0xdc,0xcc,0xac,0xaa,0x99,0xaa,0xcd,0xcb,0xbb,0xa9,0xb9,0xfb,0xdb,0xbb,0xaa,
+0x9a,0xa9,0xdb,0xcb,0xab,0x9a,0x98,0xaa,0xbb,0xbb,0x9b,0x9a,0x89,0x52,0x36,0x34,
+0x22,0x21,0x64,0x44,0x24,0x13,0x11,0x21,0x55,0x34,0x24,0x22,0x11,0x32,0x44,0x34,
+0x33,0x12,0x11,0x32,0x34,0x34,0x12,0x11,0x11,0x33,0x33,0x13,0x22,0x12,0xa0,0xdf,
+0xbc,0x8b,0x18,0xa0,0xde,0xbd,0xab,0x09,0xa8,0xdc,0xcd,0xba,0x9a,0xa9,0xda,0xcc,
+0xbc,0xcb,0xab,0x9a,0x18,0x43,0x35,0x33,0x21,0x31,0x63,0x34,0x34,0x33,0x12,0x90,
+0xcb,0xbd,0xcb,0x9a,0x89,0xb9,0xcb,0xbc,0xaa,0x89,0x99,0xca,0xac,0xab,0x98,0x88,
+0xa9,0xba,0xaa,0x08,0x10,0x98,0xcb,0xbc,0xab,0x8b,0x28,0x54,0x36,0x35,0x24,0x23,
+0x12,0x43,0x34,0x35,0x23,0x22,0x42,0x45,0x44,0x12,0x01,0x00,0x41,0x45,0x24,0x12,
+0x01,0x10,0x32,0x45,0x23,0x22,0x10,0x31,0x53,0x43,0x33,0x12,0x02,0x10,0x31,0x42,
+0x22,0x12,0x01,0x21,0x53,0x33,0x14,0xa0,0xfb,0xbc,0xbc,0x9a,0x9a,0xca,0xdc,0xbc,
+0xab,0x9a,0xa9,0xcc,0xcd,0xac,0xab,0x99,0xb9,0xcd,0xcc,0xab,0xa9,0x98,0xc9,0xdc,
+0xcb,0xab,0x99,0x99,0xba,0xcc,0xab,0x99,0x88,0xa9,0xdb,0xba,0x99,0x80,0x01,0x10,
+0x53,0x44,0x22,0x10,0x30,0x65,0x34,0x24,0x12,0x11,0x54,0x44,0x43,0x12,0x11,0x21,
+0x63,0x43,0x33,0x12,0x00,0x21,0x53,0x33,0x22,0x80,0x08,0x22,0x44,0x12,0x81,0x80,
+0x10,0xb8,0xdd,0xcb,0x99,0x80,0xc9,0xce,0xac,0x99,0x00,0xc9,0xdd,0xbc,0xaa,0x99,
+0xa9,0xcd,0xdc,0xbb,0xbb,0xaa,0x08,0x53,0x44,0x23,0x22,0x21,0x42,0x35,0x34,0x24,
+0x12,0x00,0xa8,0xbc,0xbc,0xbb,0x9a,0xa9,0xcc,0xbc,0xba,0x99,0x89,0xca,0xcb,0xbb,
+0x9a,0x99,0xba,0xdb,0xba,0x99,0x98,0xaa,0xbc,0xcb,0xbb,0xcb,0xbb,0x0a,0x31,0x45,
+0x22,0x22,0x43,0x44,0x43,0x33,0x12,0x11,0x51,0x64,0x34,0x34,0x22,0x21,0x32,0x46,
+0x34,0x33,0x21,0x21,0x43,0x35,0x34,0x12,0x11,0x22,0x43,0x34,0x24,0x21,0x11,0x21,
+0x33,0x34,0x22,0x11,0x21,0x43,0x34,0x23,0x11,0x80,0x98,0xdb,0xcd,0xbc,0xac,0x99,
+0xba,0xdc,0xbc,0xaa,0xa9,0xd9,0xdc,0xbc,0xac,0x99,0x99,0xc9,0xcc,0xcb,0x9a,0x99,
+0xb9,0xbe,0xbd,0xbb,0xaa,0x99,0xba,0xcd,0xba,0x9a,0x89,0x99,0xba,0xbc,0xaa,0x89,
+0x09,0x20,0x54,0x44,0x22,0x11,0x21,0x55,0x35,0x33,0x23,0x22,0x63,0x44,0x24,0x23,
+0x22,0x22,0x63,0x43,0x43,0x22,0x12,0x11,0x31,0x53,0x32,0x22,0x00,0x01,0x32,0x34,
+0x22,0x02,0x98,0xca,0xbd,0xad,0x9a,0x88,0xc9,0xcf,0xcb,0x9a,0x89,0xb9,0xdd,0xcc,
+0xaa,0x99,0xa9,0xeb,0xcc,0xcb,0xab,0xab,0x89,0x20,0x54,0x33,0x14,0x12,0x21,0x34,
+0x36,0x43,0x22,0x01,0x90,0xcb,0xbc,0xbb,0xaa,0x9a,0xbb,0xcd,0xbb,0xaa,0x98,0xa9,
+0xcb,0xac,0xaa,0x98,0x98,0xbb,0xbb,0x9b,0x08,0x08,0xa9,0xdb,0xcb,0xcb,0xaa,0x28,
+0x55,0x53,0x33,0x33,0x33,0x35,0x53,0x23,0x23,0x12,0x33,0x55,0x54,0x33,0x32,0x21,
+0x32,0x46,0x35,0x33,0x12,0x11,0x32,0x45,0x24,0x23,0x11,0x11,0x42,0x34,0x34,0x12,
+0x01,0x00,0x22,0x35,0x23,0x01,0x98,0x88,0x52,0x34,0x24,0x01,0xa9,0xcc,0xab,0xab,
+0xaa,0xca,0xdc,0xbc,0xac,0xaa,0x98,0xba,0xde,0xdb,0xba,0x9a,0xa9,0xdb,0xcc,0xcb,
+0xaa,0x99,0xaa,0xfb,0xcb,0xac,0x9a,0x99,0x99,0xca,0xbb,0xbb,0x9a,0x99,0xaa,0xac,
+0xab,0xba,0xbb,0x9b,0x61,0x45,0x24,0x01,0x80,0x41,0x55,0x33,0x13,0x01,0x41,0x64,
+0x34,0x43,0x21,0x11,0x31,0x45,0x43,0x22,0x12,0x10,0x21,0x43,0x43,0x12,0x10,0x18,
+0x21,0x23,0x12,0x01,0x10,0x81,0xda,0xbe,0x9c,0x89,0xa8,0xde,0xcc,0xab,0x89,0x88,
+0xdb,0xce,0xab,0x9b,0x89,0xba,0xce,0xbd,0xac,0xbb,0x9a,0x10,0x53,0x34,0x33,0x22,
+0x32,0x44,0x35,0x34,0x23,0x12,0x88,0xca,0xbc,0xac,0xab,0x99,0xaa,0xdb,0xac,0x9b,
+0x8a,0x99,0xba,0xcc,0xaa,0xaa,0xa9,0xaa,0xbb,0x9a,0x98,0xa8,0xdb,0xbd,0xac,0xbb,
+0xbb,0x9a,0x09,0x42,0x45,0x34,0x22,0x22,0x21,0x44,0x44,0x32,0x22,0x52,0x54,0x34,
+0x33,0x12,0x11,0x73,0x34,0x25,0x22,0x01,0x11,0x43,0x34,0x23,0x13,0x21,0x43,0x35,
+0x43,0x22,0x11,0x80,0x99,0xba,0xab,0xab,0x9b,0x0a,0x41,0x44,0x23,0x01,0xa9,0xad,
+0xbc,0xbd,0xbc,0xbb,0xbb,0xbc,0xbd,0xac,0x9b,0xaa,0xdc,0xcd,0xcb,0xaa,0x98,0xa8,
+0xeb,0xbc,0xbb,0x9b,0x98,0xcb,0xce,0xbc,0xba,0xaa,0xa9,0xba,0xbc,0xbc,0x9a,0x99,
+0x9a,0xbb,0xdb,0xa9,0x80,0x22,0x43,0x34,0x34,0x34,0x33,0x45,0x53,0x43,0x23,0x22,
+0x42,0x63,0x34,0x34,0x22,0x21,0x31,0x44,0x44,0x23,0x22,0x11,0x11,0x43,0x33,0x14,
+0x01,0x00,0x21,0x33,0x24,0x11,0x98,0xaa,0xcd,0xdb,0xbb,0x9a,0xa9,0xeb,0xbd,0xad,
+0x9a,0x99,0xda,0xdc,0xbb,0xbb,0x9a,0xcb,0xdc,0xcc,0xbb,0xbc,0xab,0x89,0x32,0x45,
+0x33,0x22,0x21,0x43,0x45,0x33,0x24,0x12,0x00,0xa9,0xdb,0xcb,0xaa,0x9a,0x99,0xcb,
+0xad,0xab,0x89,0x88,0xa9,0xbc,0xab,0x89,0x80,0xa9,0xbc,0x9a,0x00,0x11,0x90,0x99,
+0x8a,0xca,0xdc,0xab,0x30,0x57,0x33,0x33,0x23,0x44,0x43,0x43,0x22,0x02,0x00,0x10,
+0x54,0x45,0x34,0x12,0x81,0x10,0x73,0x34,0x33,0x02,0x00,0x42,0x54,0x33,0x12,0x00,
+0x20,0x44,0x43,0x22,0x01,0x00,0x10,0x22,0x32,0x22,0x33,0x33,0x34,0x44,0x24,0x13,
+0x91,0xda,0xcb,0xba,0xbb,0xcb,0xca,0xaa,0xbc,0xbf,0xbb,0x9c,0x9a,0xda,0xdc,0xbb,
+0xab,0xaa,0xda,0xcc,0xbc,0x9a,0x88,0xb9,0xcf,0xbc,0xab,0x8a,0x88,0xaa,0xbc,0xbc,
+0x9a,0x9a,0xba,0xbc,0xab,0xab,0xdb,0xbb,0x8b,0x52,0x44,0x12,0x90,0x09,0x62,0x44,
+0x33,0x12,0x10,0x53,0x46,0x34,0x23,0x12,0x11,0x31,0x55,0x33,0x24,0x01,0x01,0x31,
+0x44,0x23,0x01,0x88,0x08,0x43,0x43,0x11,0x90,0x99,0x99,0xcb,0xbc,0x9a,0x18,0xa8,
+0xdf,0xbc,0x9b,0x09,0xb9,0xdf,0xbc,0xac,0x99,0xa9,0xdb,0xcc,0xbc,0xcb,0x9a,0x88,
+0x31,0x44,0x43,0x22,0x22,0x32,0x45,0x34,0x33,0x23,0x02,0xa8,0xcc,0xcc,0xaa,0x9a,
+0xa9,0xba,0xcc,0xbb,0x9a,0x8a,0xaa,0xcc,0xbb,0xac,0xa9,0x99,0xa9,0xbb,0xcb,0xba,
+0xaa,0xbc,0xbd,0xbc,0xac,0x9a,0x08,0x11,0x32,0x44,0x33,0x23,0x32,0x54,0x44,0x33,
+0x22,0x21,0x73,0x45,0x43,0x23,0x11,0x22,0x35,0x35,0x24,0x11,0x11,0x42,0x43,0x33,
+0x23,0x22,0x33,0x35,0x34,0x33,0x33,0x34,0x34,0x32,0x22,0x12,0x11,0x21,0x42,0x33,
+0x23,0x00,0xaa,0xcb,0xbd,0xce,0xcb,0xac,0xba,0xcb,0xcc,0xac,0xab,0x98,0xa8,0xdc,
+0xbd,0xac,0x9a,0x99,0xca,0xcc,0xcb,0xaa,0xa9,0xaa,0xbd,0xcd,0xba,0xba,0xa9,0xba,
+0xcb,0xcb,0xaa,0x99,0x89,0x99,0xa9,0x9a,0x09,0x10,0x21,0x53,0x35,0x35,0x34,0x32,
+0x53,0x53,0x24,0x23,0x11,0x31,0x55,0x35,0x24,0x22,0x01,0x21,0x44,0x34,0x23,0x13,
+0x11,0x31,0x53,0x33,0x13,0x01,0x00,0x32,0x34,0x13,0x81,0xb9,0xcc,0xbb,0xbc,0xba,
+0xba,0xcd,0xbe,0xbc,0xab,0xaa,0xca,0xcd,0xcd,0xba,0xab,0xab,0xca,0xdc,0xdb,0xbc,
+0xbb,0x9a,0x10,0x53,0x33,0x33,0x22,0x43,0x45,0x43,0x43,0x22,0x11,0x80,0xb9,0xbd,
+0xcb,0x9a,0x99,0xa9,0xcb,0xac,0xaa,0x88,0x99,0xb9,0xbc,0xbc,0xaa,0xaa,0x89,0x08,
+0x98,0xba,0xbc,0x9a,0x88,0xb9,0xce,0xab,0x31,0x47,0x32,0x12,0x21,0x33,0x45,0x22,
+0x32,0x32,0x44,0x32,0x53,0x63,0x43,0x22,0x01,0x20,0x64,0x54,0x32,0x12,0x01,0x20,
+0x53,0x43,0x23,0x21,0x21,0x53,0x33,0x33,0x13,0x22,0x32,0x43,0x33,0x24,0x33,0x53,
+0x43,0x33,0x33,0x11,0x08,0x00,0x90,0xea,0xbd,0xac,0x0a,0x00,0xb8,0xdf,0xbb,0x9b,
+0x99,0xca,0xce,0xcb,0xaa,0x89,0xba,0xdd,0xbc,0xbb,0x9a,0xa9,0xdb,0xbd,0xbd,0xaa,
+0x9a,0xaa,0xbc,0xcc,0xaa,0x99,0x89,0xa9,0xcb,0xcb,0xab,0x9a,0x0a,0x21,0x36,0x14,
+0x82,0x99,0x28,0x75,0x43,0x22,0x01,0x10,0x73,0x53,0x33,0x22,0x11,0x42,0x44,0x43,
+0x33,0x22,0x21,0x21,0x43,0x33,0x22,0x12,0x21,0x33,0x34,0x23,0x33,0x33,0x82,0xfb,
+0xbd,0x9a,0x18,0x02,0xfc,0xcd,0xab,0x99,0x80,0xc9,0xdc,0xac,0xaa,0x9a,0xcb,0xbd,
+0xbe,0xcb,0xbb,0xab,0x09,0x43,0x45,0x23,0x22,0x11,0x42,0x44,0x33,0x24,0x12,0x81,
+0xa9,0xbd,0xad,0xab,0x9a,0xa9,0xcb,0xbc,0xac,0x99,0x99,0xb9,0xbc,0xbb,0xaa,0x9a,
+0xbc,0xcc,0xaa,0xaa,0x99,0xaa,0xab,0xbb,0xcb,0xbb,0xbb,0x29,0x73,0x43,0x32,0x32,
+0x44,0x54,0x43,0x43,0x12,0x12,0x21,0x44,0x35,0x43,0x22,0x12,0x53,0x44,0x43,0x23,
+0x12,0x21,0x53,0x34,0x34,0x22,0x21,0x21,0x34,0x34,0x33,0x12,0x11,0x20,0x32,0x34,
+0x14,0x81,0x90,0x20,0x44,0x24,0x01,0xa9,0xbc,0xac,0xcb,0xbb,0xac,0xbb,0xec,0xdb,
+0xab,0x9b,0x89,0xca,0xdd,0xbc,0xab,0x89,0x98,0xcc,0xbd,0xac,0x9a,0x98,0xba,0xdd,
+0xcb,0xab,0x9a,0xa9,0xb9,0xdb,0xbb,0xab,0x89,0x00,0x80,0xaa,0xad,0x9a,0x30,0x55,
+0x33,0x32,0x32,0x32,0x64,0x53,0x34,0x33,0x22,0x32,0x45,0x54,0x33,0x23,0x11,0x21,
+0x54,0x44,0x32,0x11,0x01,0x21,0x34,0x33,0x12,0x01,0x21,0x11,0xe9,0xde,0xdb,0xaa,
+0x9a,0x8a,0x9a,0xaa,0x9a,0x98,0xa9,0xcc,0xac,0x8a,0x00,0x98,0xcd,0xbc,0xbb,0x99,
+0xa9,0xdc,0xbd,0xbc,0xcb,0xaa,0x99,0x20,0x44,0x34,0x22,0x11,0x20,0x54,0x34,0x34,
+0x12,0x01,0x90,0xb9,0xcb,0xbb,0xaa,0xa9,0xb9,0xcd,0xbb,0x9b,0x10,0x00,0xca,0xbd,
+0x9c,0x89,0x08,0x80,0x88,0x19,0x10,0x90,0xb0,0x80,0x21,0x02,0xb9,0xbb,0x41,0x34,
+0xd1,0xfb,0x08,0x56,0x34,0x23,0x91,0xba,0x89,0x43,0x36,0x25,0x33,0x34,0x33,0x34,
+0x43,0x43,0x33,0x34,0x42,0x42,0x32,0x43,0x23,0x43,0x43,0x43,0x23,0x12,0x98,0x00,
+0x54,0x35,0x24,0x11,0x88,0x18,0x51,0x43,0x12,0x90,0x9a,0x09,0x22,0x03,0xf9,0xbd,
+0x9c,0x8a,0x20,0x20,0x88,0xbc,0xbe,0xbd,0xbb,0x9a,0x08,0x81,0xdb,0xbe,0xbc,0x9a,
+0xa9,0xcb,0xbe,0xbd,0xaa,0x9a,0xaa,0xba,0xcb,0xbb,0xcb,0xcb,0xca,0xaa,0xcb,0xcb,
+0xac,0x09,0x41,0x24,0x02,0xb8,0xab,0x30,0x46,0x23,0x00,0x99,0x52,0x46,0x34,0x23,
+0x33,0x43,0x34,0x34,0x33,0x21,0x22,0x53,0x34,0x34,0x22,0x00,0x88,0x18,0x32,0x36,
+0x33,0x33,0x12,0x01,0xdb,0xcd,0xaa,0x09,0x22,0x12,0xca,0xae,0xab,0xaa,0xdc,0xbd,
+0xbc,0x9a,0x00,0x98,0xdd,0xcd,0xbc,0xba,0x89,0x28,0x42,0x43,0x23,0x23,0x33,0x54,
+0x43,0x43,0x22,0x01,0xa8,0xcb,0xcc,0xba,0xaa,0xaa,0xca,0xcb,0xcb,0x9a,0x99,0xa9,
+0xcc,0xbb,0x9c,0x8a,0x99,0xba,0xbc,0xbb,0xb9,0xcb,0xcc,0xbb,0x9b,0x88,0x00,0x89,
+0x19,0x62,0x44,0x25,0x32,0x32,0x43,0x43,0x43,0x22,0x23,0x44,0x34,0x45,0x32,0x12,
+0x01,0x21,0x63,0x34,0x24,0x21,0x11,0x43,0x44,0x23,0x12,0x80,0x31,0x55,0x33,0x13,
+0x81,0x08,0x21,0x34,0x23,0x88,0x9a,0x0a,0x11,0x21,0x08,0x8b,0xaa,0xef,0xec,0xbb,
+0x9c,0x09,0x10,0x98,0xdc,0xbc,0xaa,0x99,0xb9,0xdd,0xbc,0xbb,0x89,0x80,0xb9,0xde,
+0xbb,0xaa,0x89,0xca,0xce,0xcb,0xab,0x9a,0x98,0xa8,0xab,0x9b,0x00,0x23,0x92,0xfb,
+0xbb,0x9a,0x31,0x45,0x33,0x25,0x22,0x22,0x43,0x53,0x33,0x23,0x13,0x43,0x55,0x44,
+0x34,0x33,0x23,0x23,0x53,0x43,0x33,0x33,0x12,0x12,0x32,0x44,0x43,0x02,0x81,0x80,
+0x31,0x44,0x24,0x01,0xb9,0xbd,0xac,0x8a,0x11,0x23,0xb1,0xdf,0xcc,0xaa,0x9a,0xa9,
+0xcc,0xbc,0xac,0xab,0xaa,0xcc,0xcc,0xbc,0xbc,0xbb,0xab,0x0a,0x42,0x45,0x23,0x22,
+0x11,0x43,0x45,0x33,0x24,0x11,0x80,0x99,0xcb,0xcc,0xbc,0xcb,0xba,0x9a,0x99,0x98,
+0x99,0x9a,0x9a,0x80,0x11,0x00,0x99,0x89,0x20,0x22,0xb8,0xdc,0x18,0x65,0x33,0x23,
+0x80,0x89,0x98,0x01,0x80,0x80,0x01,0x80,0xad,0x1a,0x77,0x34,0x24,0x81,0x99,0x8a,
+0x11,0x12,0xb0,0xab,0x39,0x44,0x91,0xcc,0x8b,0x45,0x37,0x23,0x01,0x99,0x98,0x10,
+0x20,0x19,0x1b,0x2b,0x18,0x81,0xa0,0x91,0x19,0x29,0x19,0x01,0x09,0x2b,0x3b,0x59,
+0x2a,0x1c,0x1c,0x31,0x23,0xfb,0xac,0x48,0x57,0x34,0x13,0x90,0xa9,0x08,0x21,0x82,
+0xc8,0xa8,0x21,0x22,0xb0,0xcb,0x19,0x35,0x82,0xac,0x0d,0x31,0x06,0xd0,0xba,0x30,
+0x77,0x33,0x11,0x88,0x8a,0x18,0x01,0x91,0x99,0x3a,0x30,0x91,0xe9,0x88,0x32,0x22,
+0xbb,0x8f,0x48,0x41,0x89,0xdb,0x98,0x34,0x23,0xeb,0xac,0x30,0x47,0x24,0x12,0x10,
+0x08,0x80,0xb9,0x8c,0x70,0x44,0x22,0xb0,0xbc,0x8b,0x53,0x25,0x02,0xa9,0x9a,0x10,
+0x13,0x81,0xab,0x0b,0x32,0x14,0xa9,0xcb,0x10,0x53,0x28,0x9d,0x0a,0x20,0x13,0xa0,
+0x9d,0x19,0x33,0x93,0xcb,0x9b,0x31,0x07,0xa1,0xb9,0x90,0x33,0x13,0xb9,0x1d,0x5b,
+0x28,0x88,0xb9,0x90,0x51,0x10,0x99,0xaa,0x10,0x33,0x10,0xab,0xa9,0x22,0x12,0xb1,
+0xb9,0x10,0x12,0x02,0x1b,0x0b,0x10,0x03,0x91,0xa9,0x3a,0x39,0x10,0xa9,0x90,0x39,
+0x5a,0x1a,0x0a,0x99,0x92,0x93,0x90,0x99,0x19,0x11,0xb2,0xe3,0xb3,0x93,0x01,0x2a,
+0x1b,0x3b,0x29,0xa0,0xc3,0x92,0x30,0x3a,0x1a,0x99,0x91,0x01,0x01,0x90,0xb1,0x92,
+0x11,0xa1,0xb2,0xb2,0x93,0x91,0xa1,0xc3,0xb4,0x01,0x90,0x09,0x29,0x3b,0x2a,0x99,
+0x19,0x19,0x39,0x3b,0x3c,0x3b,0x90,0xb2,0xb3,0xb3,0x11,0x19,0x10,0x99,0x91,0xb2,
+0xb3,0xa3,0xb2,0xb3,0xb3,0xa3,0xb2,0x92,0x4a,0x2b,0x99,0x29,0x3b,0x99,0x91,0x29,
+0x3b,0x3b,0x3b,0x1a,0x90,0x91,0x91,0xb2,0x92,0x29,0x3b,0x3b,0x1a,0x00,0x00,0x90,
+0xb2,0xd4,0xa3,0x82,0x3a,0x2b,0x1a,0x00,0x00,0x00,0xa1,0xa3,0x20,0x3b,0x2b,0x09,
+0x90,0xb2,0x92,0x39,0x3d,0x3b,0x29,0x3b,0x1b,0xb2,0xa3,0x20,0x3b,0x3b,0x1a,0x10,
+0x3a,0x3b,0x3b,0x3b,0x3b,0x3b,0x3b,0x1a,0x00,0x00,0x00,0x90,0xb2,0xb3,0xa3,0x20,
+0x1a,0x00,0x09
+};
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a pacman_beginning_48k.wav
+extern const uint8_t pacman_beginning_48k_wav_adpcm[];
+#define PACMAN_BEGINNING_48K_WAV_ADPCM_SAMPLE_RATE 480000
+#define PACMAN_BEGINNING_48K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define PACMAN_BEGINNING_48K_WAV_ADPCM_NUMBER_OF_SAMPLES 202405
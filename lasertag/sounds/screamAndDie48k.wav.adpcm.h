@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a screamAndDie48k.wav
+extern const uint8_t screamAndDie48k_wav_adpcm[];
+#define SCREAMANDDIE48K_WAV_ADPCM_SAMPLE_RATE 480000
+#define SCREAMANDDIE48K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define SCREAMANDDIE48K_WAV_ADPCM_NUMBER_OF_SAMPLES 86158
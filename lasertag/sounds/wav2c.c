@@ -5,6 +5,12 @@
 #include <string.h>
 #include <ctype.h>
 
+#include "../adpcm.h"
+
+// Build with: gcc wav2c.c ../adpcm.c -o wav2c
+// "wav2c file.wav" writes file.wav.c and file.wav.h with 16-bit offset samples.
+// "wav2c -a file.wav" writes file.wav.adpcm.c and file.wav.adpcm.h with IMA ADPCM
+// samples instead, a quarter of the size, for sound.c to decode as it plays.
 
 // Leave the following line uncommented unless you want to generate a simple tone.
 //#define GENERATE_TONE
@@ -16,6 +22,11 @@
 #define EXTERN_STATEMENT "extern"  // Just the C extern statement.
 #define C_DATA_TYPE "uint16_t"  // Type for data in the .c file
 #define SUPPORTED_WAVE_DATA_BIT_SIZE 16  // Program can only handle this size of data for now.
+#define ADPCM_OPTION "-a"              // Write IMA ADPCM data.
+#define ADPCM_FILE_SUFFIX ".adpcm"     // Added to the file and array names for ADPCM.
+#define ADPCM_C_DATA_TYPE "const uint8_t"  // Two 4-bit samples per byte.
+#define ADPCM_BITS_PER_SAMPLE 4        // The size of ADPCM data.
+#define ADPCM_BYTES_PER_LINE 16        // Bytes written on each line of the .c file.
 
 // Header-specific defines. All sizes are numbered in bytes.
 #define CHUNKID "RIFF"          // String
@@ -126,12 +137,14 @@ const char *get_filename_extension(const char* fileName) {
 
 int main(int argc, char* argv[]) {
   // Print a helpful error message and exit if a file-name was not provided on the command line.
-  if (argc != 2) {
-    fprintf(stderr, "Usage: wav2c filename.wav\n");
+  bool adpcm = argc == 3 && !strcmp(argv[1], ADPCM_OPTION);  // Write ADPCM data?
+  if (argc != 2 && !adpcm) {
+    fprintf(stderr, "Usage: wav2c [%s] filename.wav\n", ADPCM_OPTION);
     exit(-1);
   }
+  const char* inputArgument = argv[argc-1];        // The file-name is the last argument.
   char inputFileName[MAX_FILENAME_LENGTH];         // Create a working buffer.
-  strncpy(inputFileName, argv[1], MAX_FILENAME_LENGTH);  // Copy the argv[1] filename into the working buffer.
+  strncpy(inputFileName, inputArgument, MAX_FILENAME_LENGTH);  // Copy the filename into the working buffer.
   // Make sure that the file-name has a .wav suffix.
   const char* extension = get_filename_extension(inputFileName);  // Get the suffix.
   // Compare the suffix and generate an error message if it is incorrect.
@@ -143,7 +156,7 @@ int main(int argc, char* argv[]) {
   // Try to open the file.
   FILE* inputFileFp = fopen(inputFileName, "rb");
   if (inputFileFp == NULL) {
-    printf("unable to find file:%s\n", argv[1]);
+    printf("unable to find file:%s\n", inputArgument);
     exit(-1);
   }
   // File is present and has correct extension if you get this far.
@@ -168,11 +181,15 @@ int main(int argc, char* argv[]) {
   printWaveFileHeader(stderr, &header);
   // Everything looks good. Go ahead and generate the .h and .c files. Exit with an error if either file already exists.
   // First, open the .h file and output the necessary declarations. Then, close the .h file.
+  char baseName[MAX_FILENAME_LENGTH];                      // Input-file-name, plus .adpcm for ADPCM.
+  strncpy(baseName, inputFileName, MAX_FILENAME_LENGTH);
+  if (adpcm)
+    strncat(baseName, ADPCM_FILE_SUFFIX, MAX_FILENAME_LENGTH - strlen(baseName) - 1);
   char hFileName[MAX_FILENAME_LENGTH];                     // .h file-name.
-  strncpy(hFileName, inputFileName, MAX_FILENAME_LENGTH);  // Basename is just the input-file-name.
+  strncpy(hFileName, baseName, MAX_FILENAME_LENGTH);       // Start with the basename.
   strncat(hFileName, H_FILE_SUFFIX, MAX_FILENAME_LENGTH);  // Add the suffix.
   char cFileName[MAX_FILENAME_LENGTH];                     // .c file-name. 
-  strncpy(cFileName, inputFileName, MAX_FILENAME_LENGTH);  // Basename is just the input-file-name.
+  strncpy(cFileName, baseName, MAX_FILENAME_LENGTH);       // Start with the basename.
   strncat(cFileName, C_FILE_SUFFIX, MAX_FILENAME_LENGTH);  // Add the suffix.
 
   FILE* hFileFp = fopen(hFileName, "r");
@@ -191,11 +208,11 @@ int main(int argc, char* argv[]) {
   char arrayName[MAX_FILENAME_LENGTH];  // Array name will be created here.
   uint32_t i = 0;
   // Need to create an array name with no ".". Replace all "." with underscore.
-  for (i=0; inputFileName[i] != '\0'; i++) {
-    if (inputFileName[i] == '.') {
+  for (i=0; baseName[i] != '\0'; i++) {
+    if (baseName[i] == '.') {
       arrayName[i] = '_';
     } else {
-      arrayName[i] = inputFileName[i];
+      arrayName[i] = baseName[i];
     }
     arrayName[i+1] = '\0';  // Make sure to terminate the string.
   }
@@ -204,20 +221,44 @@ int main(int argc, char* argv[]) {
   for (i=0; arrayName[i] != '\0'; i++) {
     arrayNameUpperCase[i] = toupper(arrayName[i]);
   }
-  arrayNameUpperCase[i+1] = '\0';  // Make sure to terminate the string.
+  arrayNameUpperCase[i] = '\0';  // Make sure to terminate the string.
  
+  // The statement that generated the files, for their comments.
+  char command[MAX_FILENAME_LENGTH];
+  snprintf(command, MAX_FILENAME_LENGTH, "wav2c %s%s", adpcm ? ADPCM_OPTION " " : "", inputFileName);
+  uint32_t sampleCount = header.subchunk2Size/2;  // Wave file is counted by bytes, output file is counted in 16-bit samples.
   // .h file just needs a comment and an extern statement.
-  fprintf(hFileFp, "// This file was generated by executing this statement: wav2c %s\n", inputFileName);
-  fprintf(hFileFp, "%s uint16_t %s[];\n", EXTERN_STATEMENT, arrayName);
+  fprintf(hFileFp, "// This file was generated by executing this statement: %s\n", command);
+  fprintf(hFileFp, "%s %s %s[];\n", EXTERN_STATEMENT, adpcm ? ADPCM_C_DATA_TYPE : C_DATA_TYPE, arrayName);
   fprintf(hFileFp, "#define %s_SAMPLE_RATE %d\n", arrayNameUpperCase, header.sampleRate*10);
-  fprintf(hFileFp, "#define %s_BITS_PER_SAMPLE %d\n", arrayNameUpperCase, header.bitsPerSample);
-  fprintf(hFileFp, "#define %s_NUMBER_OF_SAMPLES %d\n", arrayNameUpperCase, header.subchunk2Size/2);
+  fprintf(hFileFp, "#define %s_BITS_PER_SAMPLE %d\n", arrayNameUpperCase, adpcm ? ADPCM_BITS_PER_SAMPLE : header.bitsPerSample);
+  fprintf(hFileFp, "#define %s_NUMBER_OF_SAMPLES %d\n", arrayNameUpperCase, sampleCount);
   fclose(hFileFp);
-  // .c file will contain the data in array form as follows.
-  uint32_t arraySize = header.subchunk2Size/2;  // Wave file is counted by bytes, output file is counted in 16-bit words.
   // Write some helpful comments to the .c file.
-  fprintf(cFileFp, "// This file was generated by executing this statement: wav2c %s\n", inputFileName);
+  fprintf(cFileFp, "// This file was generated by executing this statement: %s\n", command);
   fprintf(cFileFp, "\n#include <stdint.h>\n\n");
+  if (adpcm) {
+    // ADPCM data keeps the signed samples and packs two codes per byte, the first in the low nibble.
+    uint32_t byteCount = (sampleCount + 1) / 2;
+    fprintf(cFileFp, "%s %s[%d] = {", ADPCM_C_DATA_TYPE, arrayName, byteCount);
+    adpcm_state_t state;
+    adpcm_init(&state);
+    for (i=0; i<byteCount; i++) {
+      uint8_t byte = 0;
+      for (uint32_t nibble=0; nibble<2 && 2*i+nibble<sampleCount; nibble++) {
+        int16_t data;  // Program only handles 16-bit PCM data for now. PCM data is signed.
+        fread(&data, header.blockAlign, 1, inputFileFp);  // Read 2 bytes into a signed 16-bit variable.
+        byte |= adpcm_encode(&state, data) << (4*nibble);
+      }
+      fprintf(cFileFp, "%s0x%02x%s", i % ADPCM_BYTES_PER_LINE ? "" : "\n", byte, i != byteCount-1 ? "," : "");
+    }
+    fprintf(cFileFp, "\n};\n");  // Close the array.
+    fclose(cFileFp);
+    fclose(inputFileFp);
+    return 0;
+  }
+  // .c file will contain the data in array form as follows.
+  uint32_t arraySize = sampleCount;
   fprintf(cFileFp, "%s %s[%d] = {\n", C_DATA_TYPE, arrayName, arraySize);
   // File pointer to the input file should be pointing at the first value after the header is read, so just start from there.
   for (i=0; i<header.subchunk2Size/2; i++) {
@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "spscQueue.h"
+
+// Round up to the next power of two
+static uint32_t roundUpToPowerOfTwo(uint32_t value) {
+  uint32_t power = 1;
+  while (power < value)
+    power <<= 1;
+  return power;
+}
+
+// Allocates the data array and initializes the queue.
+bool spscQueue_init(spscQueue_t *q, uint32_t capacity) {
+  uint32_t size = roundUpToPowerOfTwo(capacity ? capacity : 1);
+  q->data = (spscQueue_data_t *)malloc(size * sizeof(spscQueue_data_t));
+  if (q->data == NULL) {
+    printf("spscQueue_init: malloc of %lu elements failed.\n",
+           (unsigned long)size);
+    return false;
+  }
+  spscRing_init(&q->ring, size);
+  return true;
+}
+
+// Empties the queue, keeping the data array.
+void spscQueue_clear(spscQueue_t *q) {
+  spscRing_init(&q->ring, spscRing_capacity(&q->ring));
+}
+
+// Frees the data array.
+void spscQueue_garbageCollect(spscQueue_t *q) {
+  free(q->data);
+  q->data = NULL;
+}
+
+// Producer side. Adds a value, or counts an overflow if the queue is full.
+bool spscQueue_push(spscQueue_t *q, spscQueue_data_t value) {
+  uint32_t slot;
+  if (!spscRing_reserve(&q->ring, &slot))
+    return false;
+  q->data[slot] = value;
+  spscRing_publish(&q->ring);
+  return true;
+}
+
+// Consumer side. Removes the oldest value.
+bool spscQueue_pop(spscQueue_t *q, spscQueue_data_t *value) {
+  uint32_t slot;
+  if (!spscRing_peek(&q->ring, &slot))
+    return false;
+  *value = q->data[slot];
+  spscRing_consume(&q->ring, 1);
+  return true;
+}
+
+// Consumer side. Removes up to count of the oldest values into dst.
+uint32_t spscQueue_popMany(spscQueue_t *q, spscQueue_data_t dst[],
+                           uint32_t count) {
+  uint32_t start;
+  uint32_t available = spscRing_peek(&q->ring, &start);
+  if (count > available)
+    count = available;
+
+  // Copy in at most two contiguous runs: up to the end of the array, then
+  // from the start
+  uint32_t firstRun = spscRing_capacity(&q->ring) - start;
+  if (firstRun > count)
+    firstRun = count;
+  for (uint32_t i = 0; i < firstRun; i++)
+    dst[i] = q->data[start + i];
+  for (uint32_t i = firstRun; i < count; i++)
+    dst[i] = q->data[i - firstRun];
+
+  spscRing_consume(&q->ring, count);
+  return count;
+}
+
+// Returns the number of elements in the queue.
+uint32_t spscQueue_elementCount(spscQueue_t *q) {
+  return spscRing_count(&q->ring);
+}
+
+// Returns the capacity (after rounding).
+uint32_t spscQueue_capacity(spscQueue_t *q) {
+  return spscRing_capacity(&q->ring);
+}
+
+// Returns the number of pushes rejected because the queue was full.
+uint32_t spscQueue_overflowCount(spscQueue_t *q) {
+  return spscRing_overflowCount(&q->ring);
+}
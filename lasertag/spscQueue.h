@@ -0,0 +1,65 @@
+#ifndef SPSCQUEUE_H_
+#define SPSCQUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "spscRing.h"
+
+// Lock-free single-producer/single-consumer queue of ADC values, with a
+// dynamically-allocated data array indexed by an spscRing_t (see spscRing.h).
+// One side (typically an ISR) only pushes, the other (typically main) only
+// pops; neither needs to disable interrupts.
+
+// Same width as isr_AdcValue_t.
+typedef uint32_t spscQueue_data_t;
+
+typedef struct {
+  spscRing_t ring;
+  spscQueue_data_t *data; // Dynamically-allocated array.
+} spscQueue_t;
+
+// Allocates the data array and initializes the queue. The capacity is rounded
+// up to a power of two. Prints an error message and returns false if malloc()
+// fails. Not safe while a producer or consumer is active.
+bool spscQueue_init(spscQueue_t *q, uint32_t capacity);
+
+// Empties the queue, keeping the data array. Not safe while a producer or
+// consumer is active.
+void spscQueue_clear(spscQueue_t *q);
+
+// Frees the data array.
+void spscQueue_garbageCollect(spscQueue_t *q);
+
+// Producer side. Adds a value, or counts an overflow and returns false if the
+// queue is full.
+bool spscQueue_push(spscQueue_t *q, spscQueue_data_t value);
+
+// Consumer side. Removes the oldest value into *value. Returns false if the
+// queue is empty.
+bool spscQueue_pop(spscQueue_t *q, spscQueue_data_t *value);
+
+// Consumer side. Removes up to count of the oldest values into dst, oldest
+// first, and returns how many were removed. The producer may keep pushing
+// meanwhile; it sees the space once the whole batch has been copied.
+uint32_t spscQueue_popMany(spscQueue_t *q, spscQueue_data_t dst[],
+                           uint32_t count);
+
+// Returns the number of elements in the queue. Exact when called from either
+// side; from elsewhere it is a snapshot.
+uint32_t spscQueue_elementCount(spscQueue_t *q);
+
+// Returns the capacity (after rounding).
+uint32_t spscQueue_capacity(spscQueue_t *q);
+
+// Returns the number of pushes rejected because the queue was full.
+uint32_t spscQueue_overflowCount(spscQueue_t *q);
+
+// ISR-versus-main stress test. An interval-timer interrupt pushes a sequence
+// of consecutive values in bursts while main() drains them with spscQueue_pop()
+// and spscQueue_popMany() in varying batch sizes, checking that every value
+// arrives exactly once and in order. Initializes and uses the interrupt
+// controller and INTERVAL_TIMER_0. Returns true if the test passes.
+bool spscQueue_runTest();
+
+#endif /* SPSCQUEUE_H_ */
@@ -0,0 +1,80 @@
+#include <stdio.h>
+
+#include "interrupts.h"
+#include "intervalTimer.h"
+#include "spscQueue.h"
+
+// A small queue so the indices wrap often and the queue regularly fills.
+#define TEST_QUEUE_CAPACITY 64
+#define TEST_VALUE_COUNT 1000000
+#define TEST_BURST_LENGTH 7         // Values pushed per interrupt.
+#define TEST_INTERRUPT_PERIOD 10E-6 // 100 kHz, like the lasertag ISR.
+#define TEST_MAX_BATCH 100          // Largest popMany() request.
+
+static spscQueue_t testQueue;
+static volatile spscQueue_data_t nextPushValue;
+static volatile bool producing;
+
+// Producer: push a burst of consecutive values. A value is only advanced past
+// once it has been accepted, so a full queue never creates a gap.
+static void testIsr() {
+  intervalTimer_ackInterrupt(INTERVAL_TIMER_0);
+  if (!producing)
+    return;
+  for (uint8_t i = 0; i < TEST_BURST_LENGTH; i++) {
+    if (!spscQueue_push(&testQueue, nextPushValue))
+      break;
+    nextPushValue++;
+  }
+}
+
+// ISR-versus-main stress test.
+bool spscQueue_runTest() {
+  printf("starting spscQueue_runTest()\n");
+  if (!spscQueue_init(&testQueue, TEST_QUEUE_CAPACITY))
+    return false;
+  nextPushValue = 0;
+  producing = true;
+
+  interrupts_init();
+  interrupts_register(INTERVAL_TIMER_0_INTERRUPT_IRQ, testIsr);
+  interrupts_irq_enable(INTERVAL_TIMER_0_INTERRUPT_IRQ);
+  intervalTimer_initCountDown(INTERVAL_TIMER_0, TEST_INTERRUPT_PERIOD);
+  intervalTimer_enableInterrupt(INTERVAL_TIMER_0);
+  intervalTimer_start(INTERVAL_TIMER_0);
+
+  // Consumer: alternate single pops with batches of varying size, checking
+  // that the sequence continues exactly where it left off
+  spscQueue_data_t batch[TEST_MAX_BATCH];
+  spscQueue_data_t expected = 0;
+  uint32_t batchSize = 1;
+  bool passed = true;
+  while (passed && expected < TEST_VALUE_COUNT) {
+    uint32_t received;
+    if (batchSize == 1) {
+      received = spscQueue_pop(&testQueue, &batch[0]) ? 1 : 0;
+    } else {
+      received = spscQueue_popMany(&testQueue, batch, batchSize);
+    }
+    for (uint32_t i = 0; i < received; i++, expected++) {
+      if (batch[i] != expected) {
+        printf("spscQueue_runTest: received %lu, expected %lu\n",
+               (unsigned long)batch[i], (unsigned long)expected);
+        passed = false;
+        break;
+      }
+    }
+    batchSize = batchSize % TEST_MAX_BATCH + 1;
+  }
+
+  producing = false;
+  intervalTimer_stop(INTERVAL_TIMER_0);
+  interrupts_irq_disable(INTERVAL_TIMER_0_INTERRUPT_IRQ);
+
+  printf("%lu values checked, %lu pushes rejected while full\n",
+         (unsigned long)expected,
+         (unsigned long)spscQueue_overflowCount(&testQueue));
+  spscQueue_garbageCollect(&testQueue);
+  printf("exiting spscQueue_runTest(): %s\n", passed ? "passed" : "failed");
+  return passed;
+}
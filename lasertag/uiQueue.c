@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "histogram.h"
+#include "intervalTimer.h"
+#include "uiQueue.h"
+
+#define CYCLES_PER_MICROSECOND 100 // The interval timers run at 100 MHz.
+
+typedef struct {
+  uint16_t barIndex;
+  uint16_t value;
+} uiQueue_message_t;
+
+// Posted messages, oldest at messageHead.
+static uiQueue_message_t messages[UIQUEUE_CAPACITY];
+static uint16_t messageHead;
+static uint16_t messageCount;
+static uint32_t droppedCount;
+
+static uint16_t barCount;
+static uint16_t barValues[HISTOGRAM_MAX_BAR_COUNT];
+static uint32_t clockTimer;
+static uint32_t budget;    // In clock cycles.
+static uint32_t threshold; // ADC values.
+// After a change every bar is drawn once, one at a time starting at nextBar;
+// barsToDraw is how many are left.
+static uint16_t barsToDraw;
+static uint16_t nextBar;
+
+// Starts with every bar at 0 and nothing to draw.
+void uiQueue_init(uint16_t count, uint32_t clockTimerNumber,
+                  uint32_t cycleBudget, uint32_t backlogThreshold) {
+  if (count > HISTOGRAM_MAX_BAR_COUNT) {
+    printf("uiQueue_init: %d bars is more than the maximum (%d).\n", count,
+           HISTOGRAM_MAX_BAR_COUNT);
+    count = HISTOGRAM_MAX_BAR_COUNT;
+  }
+  barCount = count;
+  clockTimer = clockTimerNumber;
+  budget = cycleBudget;
+  threshold = backlogThreshold;
+  for (uint16_t i = 0; i < HISTOGRAM_MAX_BAR_COUNT; i++)
+    barValues[i] = 0;
+  messageHead = 0;
+  messageCount = 0;
+  droppedCount = 0;
+  barsToDraw = 0;
+  nextBar = 0;
+}
+
+// Posts an update of one bar.
+bool uiQueue_postBarValue(uint16_t barIndex, uint16_t value) {
+  if (barIndex >= barCount || messageCount == UIQUEUE_CAPACITY) {
+    droppedCount++;
+    return false;
+  }
+  uiQueue_message_t *message =
+      &messages[(messageHead + messageCount) % UIQUEUE_CAPACITY];
+  message->barIndex = barIndex;
+  message->value = value;
+  messageCount++;
+  return true;
+}
+
+// Hands every bar to the histogram, normalized to the largest value, without
+// drawing anything.
+static void uiQueue_setBars() {
+  uint16_t maxValue = 0;
+  for (uint16_t i = 0; i < barCount; i++)
+    maxValue = barValues[i] > maxValue ? barValues[i] : maxValue;
+  for (uint16_t i = 0; i < barCount; i++) {
+    char label[HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS];
+    snprintf(label, HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS, "%d",
+             barValues[i]);
+    histogram_data_t data =
+        maxValue ? (uint32_t)barValues[i] * HISTOGRAM_MAX_BAR_DATA_IN_PIXELS /
+                       maxValue
+                 : 0;
+    histogram_setBarData(i, data, label);
+  }
+}
+
+// Applies the posted messages. If any bar changed, every bar needs drawing
+// because they are normalized together.
+static void uiQueue_takeMessages() {
+  bool changed = false;
+  for (; messageCount > 0; messageCount--) {
+    const uiQueue_message_t *message = &messages[messageHead];
+    messageHead = (messageHead + 1) % UIQUEUE_CAPACITY;
+    changed |= barValues[message->barIndex] != message->value;
+    barValues[message->barIndex] = message->value;
+  }
+  if (!changed)
+    return;
+  uiQueue_setBars();
+  barsToDraw = barCount;
+}
+
+// Takes the messages and draws for up to one time slice.
+uint32_t uiQueue_run(uint32_t adcBacklog) {
+  uiQueue_takeMessages();
+  if (barsToDraw == 0 || adcBacklog > threshold)
+    return 0;
+  uint32_t start = intervalTimer_getCounterValue(clockTimer);
+  uint32_t pixels = 0;
+  do {
+    pixels += histogram_updateBar(nextBar);
+    nextBar = (nextBar + 1) % barCount;
+    barsToDraw--;
+  } while (barsToDraw > 0 &&
+           intervalTimer_getCounterValue(clockTimer) - start < budget);
+  return pixels;
+}
+
+// Returns true if there is nothing waiting to be drawn.
+bool uiQueue_isIdle() { return messageCount == 0 && barsToDraw == 0; }
+
+// Returns the number of messages dropped since uiQueue_init().
+uint32_t uiQueue_getDroppedCount() { return droppedCount; }
+
+/*******************************************************
+ ****************** Test Routines **********************
+ ******************************************************/
+
+#define TEST_ROUND_COUNT 5
+#define TEST_MAX_VALUE 100
+#define TEST_CYCLE_BUDGET (100 * CYCLES_PER_MICROSECOND)
+#define TEST_BACKLOG_THRESHOLD 0
+#define TEST_MAX_CALLS 1000 // Per round, to give up on a stuck queue.
+
+// Posts random values, then draws them a slice at a time.
+bool uiQueue_runTest(uint16_t count, uint32_t clockTimerNumber) {
+  printf("starting uiQueue_runTest()\n");
+  uiQueue_init(count, clockTimerNumber, TEST_CYCLE_BUDGET,
+               TEST_BACKLOG_THRESHOLD);
+  bool success = true;
+  for (uint16_t round = 0; round < TEST_ROUND_COUNT; round++) {
+    for (uint16_t i = 0; i < barCount; i++)
+      uiQueue_postBarValue(i, rand() % (TEST_MAX_VALUE + 1));
+    // A backlog over the threshold must not draw anything.
+    if (uiQueue_run(TEST_BACKLOG_THRESHOLD + 1) != 0) {
+      printf("uiQueue_runTest: drew with the ADC backlog over the "
+             "threshold.\n");
+      success = false;
+    }
+    uint32_t calls = 0;
+    uint32_t pixels = 0;
+    uint32_t longestCall = 0;
+    while (!uiQueue_isIdle() && calls < TEST_MAX_CALLS) {
+      uint32_t start = intervalTimer_getCounterValue(clockTimer);
+      pixels += uiQueue_run(TEST_BACKLOG_THRESHOLD);
+      uint32_t cycles = intervalTimer_getCounterValue(clockTimer) - start;
+      longestCall = cycles > longestCall ? cycles : longestCall;
+      calls++;
+    }
+    success = success && uiQueue_isIdle();
+    printf("round %d: %u calls, %u pixels, longest call %u us (budget %u "
+           "us)\n",
+           round, calls, pixels, longestCall / CYCLES_PER_MICROSECOND,
+           TEST_CYCLE_BUDGET / CYCLES_PER_MICROSECOND);
+  }
+  printf("uiQueue_runTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,49 @@
+#ifndef UIQUEUE_H_
+#define UIQUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Deferred histogram updates, so that a slow TFT redraw does not hold up the
+// detector. The main loop posts small "set bar i to value v" messages, which
+// costs nothing on the display, and calls uiQueue_run() once per iteration.
+// uiQueue_run() only draws while the ADC backlog is under a threshold, and
+// then only for a slice of time: bars are drawn one at a time until the cycle
+// budget is spent, and the rest are left for the next call. Bars are drawn as
+// histogram_plotUserHits() draws them: normalized to the largest value, with
+// the value as the top label.
+
+// Messages that can be waiting. uiQueue_run() takes them all on every call,
+// even when it does not draw, so this only needs to cover one loop iteration.
+#define UIQUEUE_CAPACITY 32
+
+// Starts with every bar at 0 and nothing to draw. barCount must match
+// histogram_init(). The cycle budget is measured on clockTimerNumber, an
+// interval timer that must be running (100 MHz, 10 ns per cycle). Drawing
+// is skipped while more than backlogThreshold ADC values are waiting.
+void uiQueue_init(uint16_t barCount, uint32_t clockTimerNumber,
+                  uint32_t cycleBudget, uint32_t backlogThreshold);
+
+// Posts an update of bar barIndex to value. Returns false, and counts the
+// message as dropped, if the queue is full or barIndex is out of range.
+bool uiQueue_postBarValue(uint16_t barIndex, uint16_t value);
+
+// Takes the posted messages and, if adcBacklog is at most the threshold,
+// draws bars until the cycle budget is spent. At least one bar is drawn per
+// call, so a single bar can overrun the budget. Returns the number of pixels
+// written.
+uint32_t uiQueue_run(uint32_t adcBacklog);
+
+// Returns true if there is nothing waiting to be drawn.
+bool uiQueue_isIdle();
+
+// Returns the number of messages dropped since uiQueue_init().
+uint32_t uiQueue_getDroppedCount();
+
+// Posts random values, then calls uiQueue_run() until everything is drawn,
+// and prints the number of calls, the pixels written and the longest call.
+// Expects histogram_init() to have been called with barCount bars and the
+// clock timer to be running. Returns true if everything was drawn.
+bool uiQueue_runTest(uint16_t barCount, uint32_t clockTimerNumber);
+
+#endif /* UIQUEUE_H_ */
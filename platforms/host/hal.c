@@ -0,0 +1,108 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "armInterrupts.h"
+#include "hostHal.h"
+#include "intervalTimer.h"
+#include "leds.h"
+#include "mio.h"
+#include "utils.h"
+#include "xadcSequencer.h"
+
+#define INTERVAL_TIMER_COUNT 3
+#define MIO_PIN_COUNT 54
+#define NANOSECONDS_PER_SECOND 1e9
+
+static uint32_t adcValue;
+static uint32_t adcChannelValue[XSM_CH_AUX_MAX + 1];
+static uint8_t ledValue;
+static uint8_t mioPins[MIO_PIN_COUNT];
+
+static struct timespec startTime[INTERVAL_TIMER_COUNT];
+static double totalSeconds[INTERVAL_TIMER_COUNT];
+static bool running[INTERVAL_TIMER_COUNT];
+
+// Sets the value that armInterrupts_getAdcData() returns.
+void hostHal_setAdcValue(uint32_t value) { adcValue = value; }
+
+// Sets the value that xadcSequencer_read(channel) returns.
+void hostHal_setAdcChannelValue(uint8_t channel, uint32_t value) {
+  adcChannelValue[channel] = value;
+}
+
+// Returns the last value written to the LEDs.
+uint8_t hostHal_getLeds() { return ledValue; }
+
+/********************************** ARM *************************************/
+
+int armInterrupts_init() { return 0; }
+void armInterrupts_enable() {}
+void armInterrupts_disable() {}
+bool armInterrupts_getAdcInputMode() {
+  return INTERRUPTS_ADC_DEFAULT_INPUT_MODE;
+}
+uint32_t armInterrupts_getAdcData() { return adcValue; }
+
+/****************************** XADC sequencer ******************************/
+
+bool xadcSequencer_init(const uint8_t channels[], uint8_t count, bool bipolar) {
+  for (uint8_t i = 0; i < count; i++)
+    if (channels[i] < XSM_CH_AUX_MIN || channels[i] > XSM_CH_AUX_MAX)
+      return false;
+  return count > 0 && count <= XADCSEQUENCER_MAX_CHANNELS;
+}
+
+uint32_t xadcSequencer_read(uint8_t channel) {
+  return adcChannelValue[channel];
+}
+
+/****************************** LEDs and MIO ********************************/
+
+int32_t leds_init() { return 0; }
+void leds_write(uint8_t value) { ledValue = value; }
+uint8_t leds_read() { return ledValue; }
+
+int mio_init(bool printFailedStatusFlag) { return 0; }
+u8 mio_readPin(u8 mioPinNumber) { return mioPins[mioPinNumber]; }
+void mio_writePin(u8 mioPinNumber, u8 value) { mioPins[mioPinNumber] = value; }
+void mio_setPinAsInput(u8 mioPinNo) {}
+void mio_setPinAsOutput(u8 mioPinNo) {}
+
+// Nothing on the host needs a real delay.
+void utils_msDelay(long ms) {}
+
+/***************************** Interval timers ******************************/
+
+static double secondsSinceStart(uint32_t timerNumber) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - startTime[timerNumber].tv_sec) +
+         (now.tv_nsec - startTime[timerNumber].tv_nsec) /
+             NANOSECONDS_PER_SECOND;
+}
+
+void intervalTimer_initCountUp(uint32_t timerNumber) {
+  totalSeconds[timerNumber] = 0.0;
+  running[timerNumber] = false;
+}
+
+void intervalTimer_start(uint32_t timerNumber) {
+  clock_gettime(CLOCK_MONOTONIC, &startTime[timerNumber]);
+  running[timerNumber] = true;
+}
+
+void intervalTimer_stop(uint32_t timerNumber) {
+  if (running[timerNumber])
+    totalSeconds[timerNumber] += secondsSinceStart(timerNumber);
+  running[timerNumber] = false;
+}
+
+void intervalTimer_reload(uint32_t timerNumber) {
+  intervalTimer_initCountUp(timerNumber);
+}
+
+double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber) {
+  return totalSeconds[timerNumber] +
+         (running[timerNumber] ? secondsSinceStart(timerNumber) : 0.0);
+}
@@ -0,0 +1,9 @@
+# Options for the host-native build ("cmake -DHOST=1"), which compiles the
+# lasertag signal chain with the workstation compiler against the stub HAL in
+# platforms/host instead of the Zybo libraries.
+
+if (NOT CMAKE_BUILD_TYPE)
+    set(CMAKE_BUILD_TYPE Release)
+endif()
+
+add_compile_options(-Wall)
@@ -0,0 +1,22 @@
+#ifndef HOSTHAL_H_
+#define HOSTHAL_H_
+
+#include <stdint.h>
+
+// Host stand-ins for the Zybo drivers. Interrupts are never raised on the
+// host: the caller plays the part of the timer interrupt by setting the next
+// ADC value (or values, with several channels) and calling isr_function()
+// itself. The interval timers read the host's monotonic clock, and the LEDs
+// and MIO pins are plain variables.
+
+// Sets the value that armInterrupts_getAdcData() returns, i.e. what the XADC
+// would read at the next interrupt.
+void hostHal_setAdcValue(uint32_t value);
+
+// Sets the value that xadcSequencer_read() returns for an XADC channel.
+void hostHal_setAdcChannelValue(uint8_t channel, uint32_t value);
+
+// Returns the last value written to the LEDs.
+uint8_t hostHal_getLeds();
+
+#endif /* HOSTHAL_H_ */
@@ -0,0 +1,129 @@
+// Replays an ADC trace captured with runningModes_captureAdcTrace() through
+// the lasertag filters and detector on a PC, much faster than real time, so
+// that fudge factors, ignored frequencies and backends can be compared on the
+// same recording.
+//
+// Usage: adcReplay [-s] [-p] [-f fudgeIndex] [-i ignoreMask] trace
+//   -s  use the sliding-DFT backend instead of the IIR bank.
+//   -p  call detector() per value instead of detector_processBlock().
+//   -f  fudge-factor index (see detector.c).
+//   -i  bit mask of frequency numbers to ignore, e.g. 0x040 ignores 6.
+// The trace may be a raw console log; anything before the trace is skipped.
+// Built by the host configuration: cmake -DHOST=1.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "adcCapture.h"
+#include "detector.h"
+#include "filter.h"
+#include "hostHal.h"
+#include "isr.h"
+#include "lockoutTimer.h"
+
+static void printUsage(const char *name) {
+  printf("usage: %s [-s] [-p] [-f fudgeIndex] [-i ignoreMask] trace\n", name);
+}
+
+static double secondsSince(const struct timespec *start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+  detector_backend_t backend = DETECTOR_BACKEND_IIR;
+  bool perValue = false;
+  int32_t fudgeIndex = -1;
+  uint32_t ignoreMask = 0;
+  int option;
+  while ((option = getopt(argc, argv, "spf:i:")) != -1) {
+    switch (option) {
+    case 's':
+      backend = DETECTOR_BACKEND_SLIDING_DFT;
+      break;
+    case 'p':
+      perValue = true;
+      break;
+    case 'f':
+      fudgeIndex = strtol(optarg, NULL, 0);
+      break;
+    case 'i':
+      ignoreMask = strtoul(optarg, NULL, 0);
+      break;
+    default:
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (optind != argc - 1) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  FILE *in = fopen(argv[optind], "rb");
+  if (in == NULL) {
+    perror(argv[optind]);
+    return EXIT_FAILURE;
+  }
+  isr_AdcValue_t *samples;
+  uint32_t sampleCount, sampleRateHz;
+  bool traceRead = adcCapture_readTrace(in, &samples, &sampleCount,
+                                        &sampleRateHz);
+  fclose(in);
+  if (!traceRead)
+    return EXIT_FAILURE;
+  printf("%u values at %u Hz (%.2f s)\n", sampleCount, sampleRateHz,
+         (double)sampleCount / sampleRateHz);
+
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT];
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    ignoredFrequencies[i] = ignoreMask & (1 << i);
+  isr_init();
+  filter_init();
+  detector_initBackend(ignoredFrequencies, backend);
+  if (fudgeIndex >= 0)
+    detector_setFudgeFactorIndex(fudgeIndex);
+  // Shooter mode ignores the filter start-up transient the same way.
+  lockoutTimer_start();
+
+  // Each value is one ISR invocation, so the lockout lasts as long as it does
+  // on the board. The detector runs whenever a block has built up.
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  uint32_t hitCount = 0;
+  for (uint32_t i = 0; i < sampleCount; i++) {
+    hostHal_setAdcValue(samples[i]);
+    isr_function();
+    if (isr_adcBufferElementCount() < DETECTOR_BLOCK_SIZE &&
+        i + 1 < sampleCount)
+      continue;
+    if (perValue)
+      detector(false);
+    else
+      detector_processBlock();
+    if (detector_hitDetected()) {
+      hitCount++;
+      printf("hit %u: frequency %u at %.4f s\n", hitCount,
+             detector_getFrequencyNumberOfLastHit(),
+             (double)(i + 1) / sampleRateHz);
+      detector_clearHit();
+    }
+  }
+  double seconds = secondsSince(&start);
+  free(samples);
+
+  detector_hitCount_t hitCounts[FILTER_FREQUENCY_COUNT];
+  detector_getHitCounts(hitCounts);
+  printf("hit counts:");
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    printf(" %u", hitCounts[i]);
+  printf("\n");
+  printf("%.3f s, %.1f M values/s, %.1fx real time\n", seconds,
+         sampleCount / seconds * 1e-6,
+         (double)sampleCount / sampleRateHz / seconds);
+  return EXIT_SUCCESS;
+}
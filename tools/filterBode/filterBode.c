@@ -0,0 +1,245 @@
+// Sweeps sine inputs from 0 Hz to half the 100 kHz sample rate through the
+// lasertag FIR filter and each IIR filter, and writes the magnitude and group
+// delay at every frequency as CSV, for plotting Bode diagrams of the filters
+// filterTest.c only probes at a few square-wave periods.
+//
+// Each frequency is measured by running the filter itself: the cos and sin
+// parts of a complex exponential go through two filter states with
+// filterState_addNewInputDecimated() and filterState_iirFilter(), the same
+// calls the detector makes, until the outputs settle. The filter is linear, so
+// the complex gain is the cos output plus j times the sin output, divided by
+// the input at the same instant. The iir columns are the whole chain the
+// detector sees (FIR, decimation, IIR), so they include what aliases into each
+// band. Group delay is the phase slope between neighbouring frequencies, in
+// microseconds. Frequencies are spread over worker threads.
+//
+// Usage: filterBode [-n points] [-t threads] [-o file]
+//   -n  number of frequencies from 0 Hz to 50 kHz inclusive (default 5001).
+//   -t  worker threads (default: one per online CPU).
+//   -o  CSV file (default: standard output).
+// Built by the host configuration: cmake -DHOST=1.
+
+#include <complex.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "filter.h"
+
+#define SAMPLE_RATE_HZ (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000.0)
+#define DEFAULT_POINT_COUNT 5001
+#define MAX_THREADS 64
+// The IIR bands are narrow, so their outputs take a while to settle (poles
+// at a radius of about 0.99). Every SETTLE_CHECK_OUTPUTS decimated outputs
+// the gains are compared with the last check; the sweep moves on once none
+// changes by more than SETTLE_TOLERANCE (-200 dB), or after MAX_OUTPUTS.
+#define SETTLE_CHECK_OUTPUTS 500
+#define SETTLE_TOLERANCE 1e-10
+#define MAX_OUTPUTS 100000
+#define MIN_DB -300.0 // Printed for a gain of exactly zero.
+
+// The complex gain of the FIR and of each chain at one frequency.
+typedef struct {
+  double complex fir;
+  double complex iir[FILTER_FREQUENCY_COUNT];
+  uint32_t outputs; // Decimated outputs it took to settle.
+} response_t;
+
+static uint32_t pointCount = DEFAULT_POINT_COUNT;
+static response_t *responses;
+static atomic_uint nextPoint;
+static atomic_bool outOfMemory; // A worker could not create its states.
+
+// Radians per input sample of point i.
+static double pointOmega(uint32_t i) {
+  return pointCount > 1 ? M_PI * i / (pointCount - 1) : 0.0;
+}
+
+// Returns true once every gain is within SETTLE_TOLERANCE of the last check,
+// and saves the gains for the next one.
+static bool settled(const double complex gain[], double complex lastGain[]) {
+  bool done = true;
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    if (cabs(gain[f] - lastGain[f]) > SETTLE_TOLERANCE)
+      done = false;
+    lastGain[f] = gain[f];
+  }
+  return done;
+}
+
+// The newest value in q.
+static double newest(queue_t *q) {
+  return queue_readElementAtUnchecked(q, queue_elementCount(q) - 1);
+}
+
+// Measures the FIR and every chain at point i, with the states for the cos
+// and sin inputs.
+static void measurePoint(uint32_t i, filter_state_t *cosState,
+                         filter_state_t *sinState) {
+  double omega = pointOmega(i);
+  filterState_init(cosState);
+  filterState_init(sinState);
+  double complex gain[FILTER_FREQUENCY_COUNT];
+  double complex lastGain[FILTER_FREQUENCY_COUNT] = {0};
+  double complex firGain = 0.0;
+  uint64_t n = 0; // Inputs so far.
+  uint32_t outputs = 0;
+  while (outputs < MAX_OUTPUTS) {
+    // Inputs until one completes a decimated output.
+    double complex input;
+    bool done;
+    do {
+      input = cexp(I * omega * n++);
+      filterState_addNewInputDecimated(sinState, cimag(input));
+      done = filterState_addNewInputDecimated(cosState, creal(input));
+    } while (!done);
+    firGain = (newest(filterState_getYQueue(cosState)) +
+               I * newest(filterState_getYQueue(sinState))) /
+              input;
+    for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+      gain[f] = (filterState_iirFilter(cosState, f) +
+                 I * filterState_iirFilter(sinState, f)) /
+                input;
+    if (++outputs % SETTLE_CHECK_OUTPUTS == 0 && settled(gain, lastGain))
+      break;
+  }
+  response_t *r = &responses[i];
+  r->fir = firGain;
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+    r->iir[f] = gain[f];
+  r->outputs = outputs;
+}
+
+// Worker thread: measures points until there are none left, with filter
+// states of its own.
+static void *worker(void *unused) {
+  (void)unused;
+  filter_state_t *cosState = filter_createState();
+  filter_state_t *sinState = filter_createState();
+  if (cosState == NULL || sinState == NULL)
+    atomic_store(&outOfMemory, true);
+  uint32_t i;
+  while (!atomic_load(&outOfMemory) &&
+         (i = atomic_fetch_add(&nextPoint, 1)) < pointCount)
+    measurePoint(i, cosState, sinState);
+  filter_destroyState(cosState);
+  filter_destroyState(sinState);
+  return NULL;
+}
+
+static double toDb(double complex gain) {
+  return cabs(gain) > 0.0 ? 20.0 * log10(cabs(gain)) : MIN_DB;
+}
+
+// Group delay in microseconds from the gains at two neighbouring points.
+static double groupDelayUs(double complex low, double complex high,
+                           double omegaStep) {
+  if (omegaStep == 0.0)
+    return 0.0;
+  double delaySamples = -carg(high * conj(low)) / omegaStep;
+  return delaySamples / SAMPLE_RATE_HZ * 1e6;
+}
+
+static void writeCsv(FILE *out) {
+  fprintf(out, "frequency_hz,fir_db,fir_delay_us");
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+    fprintf(out, ",iir%d_db,iir%d_delay_us", f, f);
+  fprintf(out, "\n");
+  for (uint32_t i = 0; i < pointCount; i++) {
+    // Neighbouring points for the phase slope, one-sided at the ends.
+    uint32_t lowIndex = i > 0 ? i - 1 : i;
+    uint32_t highIndex = i + 1 < pointCount ? i + 1 : i;
+    const response_t *low = &responses[lowIndex];
+    const response_t *high = &responses[highIndex];
+    double omegaStep = pointOmega(highIndex) - pointOmega(lowIndex);
+    const response_t *r = &responses[i];
+    fprintf(out, "%.3f,%.6f,%.3f",
+            pointOmega(i) / (2.0 * M_PI) * SAMPLE_RATE_HZ, toDb(r->fir),
+            groupDelayUs(low->fir, high->fir, omegaStep));
+    for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+      fprintf(out, ",%.6f,%.3f", toDb(r->iir[f]),
+              groupDelayUs(low->iir[f], high->iir[f], omegaStep));
+    fprintf(out, "\n");
+  }
+}
+
+static void printUsage(const char *name) {
+  printf("usage: %s [-n points] [-t threads] [-o file]\n", name);
+}
+
+static double secondsSince(const struct timespec *start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+  long threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+  const char *outputName = NULL;
+  int option;
+  while ((option = getopt(argc, argv, "n:t:o:")) != -1) {
+    switch (option) {
+    case 'n':
+      pointCount = strtoul(optarg, NULL, 0);
+      break;
+    case 't':
+      threadCount = strtol(optarg, NULL, 0);
+      break;
+    case 'o':
+      outputName = optarg;
+      break;
+    default:
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (optind != argc || pointCount == 0) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  threadCount = threadCount < 1 ? 1 : threadCount;
+  threadCount = threadCount > MAX_THREADS ? MAX_THREADS : threadCount;
+
+  responses = (response_t *)malloc(pointCount * sizeof(response_t));
+  if (responses == NULL) {
+    fprintf(stderr, "filterBode: malloc of %u points failed.\n", pointCount);
+    return EXIT_FAILURE;
+  }
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  pthread_t threads[MAX_THREADS];
+  for (long t = 0; t < threadCount; t++)
+    pthread_create(&threads[t], NULL, worker, NULL);
+  for (long t = 0; t < threadCount; t++)
+    pthread_join(threads[t], NULL);
+  double seconds = secondsSince(&start);
+  if (atomic_load(&outOfMemory)) {
+    fprintf(stderr, "filterBode: out of memory for the filter states.\n");
+    free(responses);
+    return EXIT_FAILURE;
+  }
+
+  uint32_t unsettled = 0;
+  for (uint32_t i = 0; i < pointCount; i++)
+    unsettled += responses[i].outputs >= MAX_OUTPUTS;
+  FILE *out = outputName ? fopen(outputName, "w") : stdout;
+  if (out == NULL) {
+    fprintf(stderr, "filterBode: cannot open %s.\n", outputName);
+    free(responses);
+    return EXIT_FAILURE;
+  }
+  writeCsv(out);
+  if (out != stdout)
+    fclose(out);
+  free(responses);
+  fprintf(stderr, "filterBode: %u frequencies on %ld threads in %.2f s",
+          pointCount, threadCount, seconds);
+  fprintf(stderr, unsettled ? ", %u did not settle.\n" : ".\n", unsettled);
+  return EXIT_SUCCESS;
+}